@@ -28,6 +28,7 @@ api_files += $(srcdir)/api/ha-maintenance-start.json
 api_files += $(srcdir)/api/ha-scopes.json
 api_files += $(srcdir)/api/ha-sync.json
 api_files += $(srcdir)/api/lease4-add.json
+api_files += $(srcdir)/api/lease4-bulk-apply.json
 api_files += $(srcdir)/api/lease4-del.json
 api_files += $(srcdir)/api/lease4-get-all.json
 api_files += $(srcdir)/api/lease4-get-by-client-id.json
@@ -138,6 +139,8 @@ api_files += $(srcdir)/api/reservation-get-page.json
 api_files += $(srcdir)/api/reservation-get.json
 api_files += $(srcdir)/api/server-tag-get.json
 api_files += $(srcdir)/api/shutdown.json
+api_files += $(srcdir)/api/stage-latency-get.json
+api_files += $(srcdir)/api/stage-latency-set.json
 api_files += $(srcdir)/api/stat-lease4-get.json
 api_files += $(srcdir)/api/stat-lease6-get.json
 api_files += $(srcdir)/api/statistic-get-all.json
@@ -0,0 +1,542 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <cc/command_interpreter.h>
+#include <cc/data.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/option4_addrlst.h>
+#include <dhcp/option_int_array.h>
+#include <dhcp/pkt4.h>
+#include <dhcp/tests/iface_mgr_test_config.h>
+#include <dhcp4/dhcp4_srv.h>
+#include <dhcp4/json_config_parser.h>
+#include <dhcpsrv/benchmarks/parameters.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <dhcpsrv/stage_latency.h>
+#include <util/latency_histogram.h>
+#include <util/multi_threading_mgr.h>
+#include <util/readwrite_mutex.h>
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::config;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::dhcp::bench;
+using namespace isc::dhcp::test;
+using namespace isc::util;
+using namespace std;
+
+namespace {
+
+/// @brief Number of simulated clients.
+constexpr size_t CLIENT_COUNT = 2048;
+
+/// @brief Code of the first configured option.
+///
+/// The options use the site-specific codes 224 to 254.
+constexpr uint8_t FIRST_OPTION_CODE = 224;
+
+/// @brief Largest number of configured options.
+constexpr size_t MAX_OPTION_COUNT = 31;
+
+/// @brief Local address of the server, the address of the eth0 interface
+/// configured by @c IfaceMgrTestConfig.
+const IOAddress SERVER_ADDRESS("10.0.0.1");
+
+/// @brief Returns the first address of a subnet.
+///
+/// The subnets are /20 subnets starting at 10.128.0.0, so there may be
+/// up to 2048 of them.
+///
+/// @param index Index of the subnet.
+IOAddress
+getSubnetAddress(const size_t index) {
+    return (IOAddress(0x0a800000 + (static_cast<uint32_t>(index) << 12)));
+}
+
+/// @brief Latencies of the processing stages, in nanoseconds.
+struct StageLatencies {
+    /// @brief Classification, including the options unpacked for it.
+    LatencyHistogram classify_;
+
+    /// @brief Subnet selection.
+    LatencyHistogram select_subnet_;
+
+    /// @brief Host reservation lookup and lease allocation.
+    LatencyHistogram allocate_;
+
+    /// @brief Required classification and building of the options.
+    LatencyHistogram build_options_;
+
+    /// @brief Whole processing of a query.
+    LatencyHistogram total_;
+
+    /// @brief Adds the latencies of another thread.
+    ///
+    /// @param other Latencies to add.
+    void merge(const StageLatencies& other) {
+        classify_.merge(other.classify_);
+        select_subnet_.merge(other.select_subnet_);
+        allocate_.merge(other.allocate_);
+        build_options_.merge(other.build_options_);
+        total_.merge(other.total_);
+    }
+
+    /// @brief Removes all latencies.
+    void clear() {
+        classify_.clear();
+        select_subnet_.clear();
+        allocate_.clear();
+        build_options_.clear();
+        total_.clear();
+    }
+};
+
+/// @brief Reports the percentiles of a histogram as benchmark counters.
+///
+/// @param state Benchmark state.
+/// @param name Prefix of the counter names.
+/// @param histogram Latencies.
+void
+addLatencyCounters(benchmark::State& state, const string& name,
+                   const LatencyHistogram& histogram) {
+    if (histogram.getCount() == 0) {
+        return;
+    }
+    state.counters[name + "_p50"] = histogram.getPercentile(50.);
+    state.counters[name + "_p99"] = histogram.getPercentile(99.);
+    state.counters[name + "_p999"] = histogram.getPercentile(99.9);
+}
+
+/// @brief Returns the time elapsed since a time point and moves the time
+/// point to now.
+///
+/// @param start Time point.
+chrono::nanoseconds
+lap(chrono::steady_clock::time_point& start) {
+    const chrono::steady_clock::time_point now = chrono::steady_clock::now();
+    const chrono::nanoseconds elapsed = now - start;
+    start = now;
+    return (elapsed);
+}
+
+/// @brief Server giving access to the processing stages.
+class BenchDhcpv4Srv : public Dhcpv4Srv {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Neither opens sockets nor uses broadcast or direct traffic.
+    BenchDhcpv4Srv() : Dhcpv4Srv(0, 0, false, false) {
+    }
+
+    /// @brief Processes a DHCPDISCOVER or DHCPREQUEST stage by stage.
+    ///
+    /// The stages are those of @c processDiscover and @c processRequest,
+    /// timed one by one. The callouts, the acceptance checks and the
+    /// client race avoidance are left out.
+    ///
+    /// @param query Query in wire format.
+    /// @param latencies Latencies of the stages.
+    /// @return The response or null if the query is dropped.
+    Pkt4Ptr processStages(Pkt4Ptr& query, StageLatencies& latencies) {
+        query->unpack();
+
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        classifyPacket(query);
+        deferredUnpack(query);
+        latencies.classify_.record(lap(start));
+
+        bool drop = false;
+        Subnet4Ptr subnet = selectSubnet(query, drop);
+        latencies.select_subnet_.record(lap(start));
+        if (drop) {
+            return (Pkt4Ptr());
+        }
+
+        Dhcpv4Exchange ex(alloc_engine_, query, subnet);
+        processClientName(ex);
+        if (MultiThreadingMgr::instance().getMode()) {
+            ReadLockGuard share(alloc_engine_->getReadWriteMutex());
+            assignLease(ex);
+        } else {
+            assignLease(ex);
+        }
+        latencies.allocate_.record(lap(start));
+
+        Pkt4Ptr response = ex.getResponse();
+        if (!response || response->getYiaddr().isV4Zero()) {
+            return (Pkt4Ptr());
+        }
+        ex.conditionallySetReservedClientClasses();
+        requiredClassify(ex);
+        buildCfgOptionList(ex);
+        appendRequestedOptions(ex);
+        appendRequestedVendorOptions(ex);
+        appendBasicOptions(ex);
+        setFixedFields(ex);
+        adjustIfaceData(ex);
+        appendServerID(ex);
+        latencies.build_options_.record(lap(start));
+
+        return (response);
+    }
+};
+
+/// @brief Fixture driving the DHCPv4 server with synthetic traffic.
+///
+/// The server runs in-process on fake interfaces with the memfile backend
+/// in memory only, so nothing but the packet processing is measured. The
+/// arguments of a benchmark are the numbers of subnets, client classes and
+/// options in the configuration. Every client is a relay agent in one of
+/// the subnets requesting all options, and has got a lease before the
+/// measurements. The clients are shared between the benchmark threads, the
+/// server running in multi-threading mode when there are more than one.
+///
+/// Every iteration processes one query. Besides the time per query, the
+/// 50th, 99th and 99.9th percentiles of the latencies are reported in
+/// nanoseconds, for the whole processing ("total") and for each stage
+/// when the stages are timed. The benchmarks named *Timed run with the
+/// stage latency timing of the server enabled, to compare with the ones
+/// run with it disabled.
+class Dhcpv4SrvBenchmark : public ::benchmark::Fixture {
+public:
+
+    /// @brief Configures the server and gives a lease to every client.
+    void SetUp(::benchmark::State const& state) override {
+        if (state.thread_index() != 0) {
+            return;
+        }
+        iface_mgr_test_config_.reset(new IfaceMgrTestConfig(true));
+        srv_.reset(new BenchDhcpv4Srv());
+        const size_t subnet_count = state.range(0);
+        configure(subnet_count, state.range(1), state.range(2));
+        MultiThreadingMgr::instance().setMode(state.threads() > 1);
+
+        discovers_.clear();
+        requests_.clear();
+        relays_.clear();
+        for (size_t i = 0; i < CLIENT_COUNT; ++i) {
+            const IOAddress relay(getSubnetAddress(i % subnet_count).toUint32() + 1);
+            relays_.push_back(relay);
+            discovers_.push_back(createQuery(DHCPDISCOVER, i, IOAddress::IPV4_ZERO_ADDRESS()));
+
+            Pkt4Ptr offer;
+            Pkt4Ptr query = receive(discovers_.back(), relay);
+            srv_->processPacket(query, offer, false);
+            const IOAddress address(offer ? offer->getYiaddr() : IOAddress::IPV4_ZERO_ADDRESS());
+            requests_.push_back(createQuery(DHCPREQUEST, i, address));
+
+            Pkt4Ptr ack;
+            query = receive(requests_.back(), relay);
+            srv_->processPacket(query, ack, false);
+        }
+
+        latencies_.clear();
+        reported_ = 0;
+        StageLatency::reset();
+    }
+
+    void SetUp(::benchmark::State& s) override {
+        ::benchmark::State const& cs = s;
+        SetUp(cs);
+    }
+
+    /// @brief Drops the server and its configuration.
+    void TearDown(::benchmark::State const& state) override {
+        if (state.thread_index() != 0) {
+            return;
+        }
+        MultiThreadingMgr::instance().setMode(false);
+        srv_.reset();
+        LeaseMgrFactory::destroy();
+        CfgMgr::instance().clear();
+        iface_mgr_test_config_.reset();
+    }
+
+    void TearDown(::benchmark::State& s) override {
+        ::benchmark::State const& cs = s;
+        TearDown(cs);
+    }
+
+    /// @brief Configures the server.
+    ///
+    /// @param subnet_count Number of subnets.
+    /// @param class_count Number of client classes, each matching the
+    /// clients with a given last byte of the MAC address.
+    /// @param option_count Number of options, requested by all clients.
+    void configure(const size_t subnet_count, const size_t class_count,
+                   const size_t option_count) {
+        ostringstream config;
+        config << "{ \"interfaces-config\": { \"interfaces\": [ ], \"re-detect\": false },"
+               << "\"lease-database\": { \"type\": \"memfile\", \"persist\": false },"
+               << "\"valid-lifetime\": 4000,";
+
+        config << "\"option-def\": [";
+        for (size_t i = 0; i < option_count; ++i) {
+            config << (i ? "," : "") << "{ \"name\": \"bench-" << i << "\","
+                   << "\"code\": " << FIRST_OPTION_CODE + i << ","
+                   << "\"type\": \"uint32\" }";
+        }
+        config << "], \"option-data\": [";
+        for (size_t i = 0; i < option_count; ++i) {
+            config << (i ? "," : "") << "{ \"name\": \"bench-" << i << "\","
+                   << "\"data\": \"" << i << "\" }";
+        }
+
+        // Each class overrides one of the options.
+        config << "], \"client-classes\": [";
+        for (size_t i = 0; i < class_count; ++i) {
+            config << (i ? "," : "") << "{ \"name\": \"bench-" << i << "\","
+                   << "\"test\": \"substring(pkt4.mac,5,1) == 0x"
+                   << hex << setw(2) << setfill('0') << (i % 256) << dec << "\"";
+            if (option_count) {
+                config << ", \"option-data\": [ { \"name\": \"bench-"
+                       << i % option_count << "\", \"data\": \"" << 1000 + i << "\" } ]";
+            }
+            config << "}";
+        }
+
+        config << "], \"subnet4\": [";
+        for (size_t i = 0; i < subnet_count; ++i) {
+            const uint32_t first = getSubnetAddress(i).toUint32();
+            config << (i ? "," : "") << "{ \"id\": " << i + 1 << ","
+                   << "\"subnet\": \"" << IOAddress(first) << "/20\","
+                   << "\"pools\": [ { \"pool\": \"" << IOAddress(first + 16)
+                   << " - " << IOAddress(first + 4079) << "\" } ] }";
+        }
+        config << "] }";
+
+        ElementPtr status = configureDhcp4Server(*srv_, Element::fromJSON(config.str()));
+        int rcode;
+        ElementPtr comment = parseAnswer(rcode, status);
+        if (rcode != 0) {
+            isc_throw(Unexpected, "configuration failed: " << comment->str());
+        }
+        CfgDbAccessPtr cfg_db = CfgMgr::instance().getStagingCfg()->getCfgDbAccess();
+        cfg_db->setAppendedParameters("universe=4");
+        cfg_db->createManagers();
+        CfgMgr::instance().commit();
+    }
+
+    /// @brief Creates a query in wire format.
+    ///
+    /// @param type Message type.
+    /// @param client Index of the client.
+    /// @param address Requested address, included unless it is zero.
+    /// @return The packed query.
+    vector<uint8_t> createQuery(const uint8_t type, const size_t client,
+                                const IOAddress& address) {
+        const vector<uint8_t> mac = { 0x00, 0x0c, 0x01,
+                                      static_cast<uint8_t>(client >> 16),
+                                      static_cast<uint8_t>(client >> 8),
+                                      static_cast<uint8_t>(client) };
+        Pkt4Ptr pkt(new Pkt4(type, 1000 + client));
+        pkt->setHWAddr(HTYPE_ETHER, mac.size(), mac);
+        pkt->setGiaddr(relays_[client]);
+        pkt->setHops(1);
+
+        OptionUint8ArrayPtr prl(new OptionUint8Array(Option::V4,
+                                                     DHO_DHCP_PARAMETER_REQUEST_LIST));
+        for (size_t i = 0; i < MAX_OPTION_COUNT; ++i) {
+            prl->addValue(FIRST_OPTION_CODE + i);
+        }
+        pkt->addOption(prl);
+        if (!address.isV4Zero()) {
+            pkt->addOption(OptionPtr(new Option4AddrLst(DHO_DHCP_REQUESTED_ADDRESS,
+                                                        address)));
+            pkt->addOption(OptionPtr(new Option4AddrLst(DHO_DHCP_SERVER_IDENTIFIER,
+                                                        SERVER_ADDRESS)));
+        }
+        pkt->pack();
+
+        const OutputBuffer& buffer = pkt->getBuffer();
+        const uint8_t* data = static_cast<const uint8_t*>(buffer.getData());
+        return (vector<uint8_t>(data, data + buffer.getLength()));
+    }
+
+    /// @brief Returns a query as received from the relay.
+    ///
+    /// @param wire Query in wire format.
+    /// @param relay Address of the relay.
+    Pkt4Ptr receive(const vector<uint8_t>& wire, const IOAddress& relay) {
+        Pkt4Ptr query(new Pkt4(&wire[0], wire.size()));
+        query->setRemoteAddr(relay);
+        query->setRemotePort(DHCP4_SERVER_PORT);
+        query->setLocalAddr(SERVER_ADDRESS);
+        query->setLocalPort(DHCP4_SERVER_PORT);
+        query->setIface("eth0");
+        query->setIndex(ETH0_INDEX);
+        return (query);
+    }
+
+    /// @brief Processes queries until the benchmark stops.
+    ///
+    /// Each thread takes every n-th client, n being the number of threads,
+    /// so a client has never two queries in progress.
+    ///
+    /// @param state Benchmark state.
+    /// @param queries Queries of the clients.
+    /// @param stages Whether to time the processing stages.
+    void benchProcess(benchmark::State& state, const vector<vector<uint8_t>>& queries,
+                      const bool stages) {
+        StageLatencies latencies;
+        size_t client = state.thread_index();
+        while (state.KeepRunning()) {
+            Pkt4Ptr query = receive(queries[client], relays_[client]);
+            Pkt4Ptr response;
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            if (stages) {
+                response = srv_->processStages(query, latencies);
+            } else {
+                srv_->processPacket(query, response, false);
+            }
+            latencies.total_.record(chrono::steady_clock::now() - start);
+            if (!response) {
+                state.SkipWithError("no response");
+                break;
+            }
+            client += state.threads();
+            if (client >= queries.size()) {
+                client = state.thread_index();
+            }
+        }
+        report(state, latencies);
+    }
+
+    /// @brief Adds the latencies of a thread and reports them once all
+    /// threads have.
+    ///
+    /// The counters of the threads are summed, so only the last thread
+    /// sets them.
+    ///
+    /// @param state Benchmark state of the thread.
+    /// @param latencies Latencies of the thread.
+    void report(benchmark::State& state, const StageLatencies& latencies) {
+        lock_guard<mutex> lk(latencies_mutex_);
+        latencies_.merge(latencies);
+        if (++reported_ < static_cast<size_t>(state.threads())) {
+            return;
+        }
+        addLatencyCounters(state, "classify", latencies_.classify_);
+        addLatencyCounters(state, "select_subnet", latencies_.select_subnet_);
+        addLatencyCounters(state, "allocate", latencies_.allocate_);
+        addLatencyCounters(state, "build_options", latencies_.build_options_);
+        addLatencyCounters(state, "total", latencies_.total_);
+    }
+
+    /// @brief Fake interfaces and packet filter.
+    unique_ptr<IfaceMgrTestConfig> iface_mgr_test_config_;
+
+    /// @brief The server.
+    unique_ptr<BenchDhcpv4Srv> srv_;
+
+    /// @brief DHCPDISCOVER of every client.
+    vector<vector<uint8_t>> discovers_;
+
+    /// @brief DHCPREQUEST of every client, for the leased address.
+    vector<vector<uint8_t>> requests_;
+
+    /// @brief Relay address of every client.
+    vector<IOAddress> relays_;
+
+    /// @brief Protects the latencies merged from the threads.
+    mutex latencies_mutex_;
+
+    /// @brief Latencies merged from the threads.
+    StageLatencies latencies_;
+
+    /// @brief Number of threads which have merged their latencies.
+    size_t reported_ = 0;
+};
+
+/// @brief Sets the configurations and thread counts of a benchmark.
+///
+/// @param bench Benchmark.
+void
+setArguments(benchmark::internal::Benchmark* bench) {
+    // Subnets, classes and options.
+    bench->Args({ 1, 0, 0 });
+    bench->Args({ 64, 16, 8 });
+    bench->Args({ 1024, 64, MAX_OPTION_COUNT });
+    bench->ArgNames({ "subnets", "classes", "options" });
+    bench->ThreadRange(1, 8);
+    bench->UseRealTime();
+    bench->Unit(UNIT);
+}
+
+BENCHMARK_DEFINE_F(Dhcpv4SrvBenchmark, discover)(benchmark::State& state) {
+    benchProcess(state, discovers_, false);
+}
+
+BENCHMARK_DEFINE_F(Dhcpv4SrvBenchmark, discoverStages)(benchmark::State& state) {
+    benchProcess(state, discovers_, true);
+}
+
+BENCHMARK_DEFINE_F(Dhcpv4SrvBenchmark, request)(benchmark::State& state) {
+    benchProcess(state, requests_, false);
+}
+
+BENCHMARK_DEFINE_F(Dhcpv4SrvBenchmark, requestStages)(benchmark::State& state) {
+    benchProcess(state, requests_, true);
+}
+
+BENCHMARK_DEFINE_F(Dhcpv4SrvBenchmark, discoverTimed)(benchmark::State& state) {
+    StageLatency::setEnabled(true);
+    benchProcess(state, discovers_, false);
+    StageLatency::setEnabled(false);
+}
+
+BENCHMARK_DEFINE_F(Dhcpv4SrvBenchmark, requestTimed)(benchmark::State& state) {
+    StageLatency::setEnabled(true);
+    benchProcess(state, requests_, false);
+    StageLatency::setEnabled(false);
+}
+
+/// The DHCPDISCOVER processing.
+BENCHMARK_REGISTER_F(Dhcpv4SrvBenchmark, discover)->Apply(setArguments);
+
+/// The DHCPDISCOVER processing, stage by stage.
+BENCHMARK_REGISTER_F(Dhcpv4SrvBenchmark, discoverStages)->Apply(setArguments);
+
+/// The DHCPREQUEST processing, renewing the leases.
+BENCHMARK_REGISTER_F(Dhcpv4SrvBenchmark, request)->Apply(setArguments);
+
+/// The DHCPREQUEST processing, renewing the leases, stage by stage.
+BENCHMARK_REGISTER_F(Dhcpv4SrvBenchmark, requestStages)->Apply(setArguments);
+
+/// The DHCPDISCOVER processing with the stage latency timing enabled.
+BENCHMARK_REGISTER_F(Dhcpv4SrvBenchmark, discoverTimed)->Apply(setArguments);
+
+/// The DHCPREQUEST processing with the stage latency timing enabled.
+BENCHMARK_REGISTER_F(Dhcpv4SrvBenchmark, requestTimed)->Apply(setArguments);
+
+}  // namespace
@@ -22,6 +22,9 @@
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/configuration_reader.h>
 #include <dhcpsrv/db_type.h>
+#include <dhcpsrv/notifications_manager.h>
+#include <dhcpsrv/stage_latency.h>
+#include <dhcpsrv/subnet_delta.h>
 #include <dhcpsrv/subnet_mgr.h>
 #include <dhcpsrv/subnet_mgr_factory.h>
 #include <hooks/hooks.h>
@@ -389,9 +392,11 @@ ControlledDhcpv4Srv::commandConfigSetHandler(const string&,
         return (result);
     }
 
-    // stop thread pool (if running)
-    MultiThreadingCriticalSection cs;
-
+    // The configuration is parsed and committed while the packets are
+    // processed: the new configuration is published atomically and each
+    // packet uses the configuration it has pinned. The packet processing
+    // is only stopped while the process wide state it uses is replaced,
+    // see processConfig and configureDhcp4Server.
     ++CfgMgr::instance().config_set_command_received_count_;
 
     // Don't reconfigure control-socket & notifications in order to maintain communications.
@@ -404,8 +409,12 @@ ControlledDhcpv4Srv::commandConfigSetHandler(const string&,
 
     // disable multi-threading (it will be applied by new configuration)
     // this must be done in order to properly handle MT to ST transition
-    // when 'multi-threading' structure is missing from new config
-    MultiThreadingMgr::instance().apply(false, 0, 0);
+    // when 'multi-threading' structure is missing from new config. The
+    // thread pool is kept when the multi-threading parameters are the
+    // same, which is the case for most updates sent by kea-netconf.
+    if (!CfgMultiThreading::isApplied(dhcp4->get("multi-threading"))) {
+        MultiThreadingMgr::instance().apply(false, 0, 0);
+    }
 
     // We are starting the configuration process so we should remove any
     // staging configuration that has been created during previous
@@ -658,6 +667,51 @@ ControlledDhcpv4Srv::commandConfigBackendPullHandler(const std::string&,
                          "On demand configuration update successful."));
 }
 
+ElementPtr
+ControlledDhcpv4Srv::commandSubnetDeltaApplyHandler(const string&,
+                                                    ElementPtr args) {
+    SubnetDelta<DHCP_SPACE_V4> delta;
+    try {
+        ElementPtr timestamp;
+        if (args && (args->getType() == Element::map)) {
+            timestamp = args->get("config-timestamp");
+            if (timestamp && (timestamp->getType() != Element::integer)) {
+                isc_throw(BadValue, "'config-timestamp' must be an integer");
+            }
+        }
+
+        // The changes are parsed and validated while the packets are
+        // processed.
+        SrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+        delta.parse(cfg, args);
+
+        // stop thread pool (if running)
+        MultiThreadingCriticalSection cs;
+
+        delta.apply(cfg);
+        if (timestamp) {
+            cfg->setServerCfgTimestamp(timestamp->intValue());
+        }
+    } catch (const std::exception& ex) {
+        LOG_ERROR(dhcp4_logger, DHCP4_SUBNET_DELTA_APPLY_FAIL)
+            .arg(ex.what());
+        return (createAnswer(CONTROL_RESULT_ERROR,
+                             "Applying subnet changes failed: " +
+                             string(ex.what())));
+    }
+
+    LOG_INFO(dhcp4_logger, DHCP4_SUBNET_DELTA_APPLIED)
+        .arg(delta.getAddedCount())
+        .arg(delta.getReplacedCount())
+        .arg(delta.getDeletedCount());
+
+    ostringstream msg;
+    msg << "Subnet changes applied: " << delta.getAddedCount() << " added, "
+        << delta.getReplacedCount() << " replaced, "
+        << delta.getDeletedCount() << " deleted.";
+    return (createAnswer(CONTROL_RESULT_SUCCESS, msg.str()));
+}
+
 ElementPtr
 ControlledDhcpv4Srv::commandStatusGetHandler(const string&,
                                              ElementPtr /*args*/) {
@@ -780,6 +834,15 @@ ControlledDhcpv4Srv::processCommand(const string& command,
 
         } else if (command == "status-get") {
             return (srv->commandStatusGetHandler(command, args));
+
+        } else if (command == "stage-latency-get") {
+            return (StageLatency::commandStageLatencyGetHandler(command, args));
+
+        } else if (command == "stage-latency-set") {
+            return (StageLatency::commandStageLatencySetHandler(command, args));
+
+        } else if (command == "subnet4-delta-apply") {
+            return (srv->commandSubnetDeltaApplyHandler(command, args));
         }
         return isc::config::createAnswer(CONTROL_RESULT_ERROR, "Unrecognized command: " +
                                          command);
@@ -832,62 +895,84 @@ ControlledDhcpv4Srv::processConfig(ElementPtr config) {
         return isc::config::createAnswer(CONTROL_RESULT_ERROR, err.str());
     }
 
-    // Re-open lease and host database with new parameters.
-    try {
-        DatabaseConnection::db_lost_callback =
-            std::bind(&ControlledDhcpv4Srv::dbLostCallback, srv, ph::_1);
-        CfgDbAccessPtr cfg_db = CfgMgr::instance().getStagingCfg()->getCfgDbAccess();
-        cfg_db->setAppendedParameters("universe=4");
-        cfg_db->createManagers();
-    } catch (const std::exception& ex) {
-        err << "Unable to open database: " << ex.what();
-        return isc::config::createAnswer(CONTROL_RESULT_ERROR, err.str());
-    }
+    {
+        // The packet processing threads use the lease and host managers,
+        // the D2 client and the sockets, so they are stopped while these
+        // are replaced.
+        MultiThreadingCriticalSection cs;
+
+        // Re-open lease and host database with new parameters.
+        try {
+            DatabaseConnection::db_lost_callback =
+                std::bind(&ControlledDhcpv4Srv::dbLostCallback, srv, ph::_1);
+            CfgDbAccessPtr cfg_db = CfgMgr::instance().getStagingCfg()->getCfgDbAccess();
+            cfg_db->setAppendedParameters("universe=4");
+            cfg_db->createManagers();
+        } catch (const std::exception& ex) {
+            err << "Unable to open database: " << ex.what();
+            return isc::config::createAnswer(CONTROL_RESULT_ERROR, err.str());
+        }
 
-    // Server will start DDNS communications if its enabled.
-    try {
-        srv->startD2();
-    } catch (const std::exception& ex) {
-        err << "Error starting DHCP_DDNS client after server reconfiguration: "
-            << ex.what();
-        return isc::config::createAnswer(CONTROL_RESULT_ERROR, err.str());
-    }
+        // Server will start DDNS communications if its enabled.
+        try {
+            srv->startD2();
+        } catch (const std::exception& ex) {
+            err << "Error starting DHCP_DDNS client after server reconfiguration: "
+                << ex.what();
+            return isc::config::createAnswer(CONTROL_RESULT_ERROR, err.str());
+        }
 
-    // Setup DHCPv4-over-DHCPv6 IPC
-    try {
-        Dhcp4to6Ipc::instance().open();
-    } catch (const std::exception& ex) {
-        std::ostringstream err;
-        err << "error starting DHCPv4-over-DHCPv6 IPC "
-               " after server reconfiguration: " << ex.what();
-        return isc::config::createAnswer(CONTROL_RESULT_ERROR, err.str());
-    }
+        // Setup DHCPv4-over-DHCPv6 IPC
+        try {
+            Dhcp4to6Ipc::instance().open();
+        } catch (const std::exception& ex) {
+            std::ostringstream err;
+            err << "error starting DHCPv4-over-DHCPv6 IPC "
+                   " after server reconfiguration: " << ex.what();
+            return isc::config::createAnswer(CONTROL_RESULT_ERROR, err.str());
+        }
 
-    // Configure DHCP packet queueing
-    try {
-        ElementPtr qc;
-        qc  = CfgMgr::instance().getStagingCfg()->getDHCPQueueControl();
-        if (IfaceMgr::instance().configureDHCPPacketQueue(AF_INET, qc)) {
-            LOG_INFO(dhcp4_logger, DHCP4_CONFIG_PACKET_QUEUE)
-                     .arg(IfaceMgr::instance().getPacketQueue4()->getInfoStr());
+        // The sockets are still open if the interfaces configuration has not
+        // changed. The packet queue can't be reconfigured while the sockets
+        // are receiving, so they are reopened if the queue controls changed.
+        ElementPtr qc = CfgMgr::instance().getStagingCfg()->getDHCPQueueControl();
+        bool reuse_sockets = IfaceMgr::instance().hasOpenSocket(AF_INET);
+        if (reuse_sockets) {
+            ElementPtr current_qc = CfgMgr::instance().getCurrentCfg()->getDHCPQueueControl();
+            if (!qc || !current_qc || !isEquivalent(qc, current_qc)) {
+                IfaceMgr::instance().closeSockets();
+                reuse_sockets = false;
+            }
         }
 
-    } catch (const std::exception& ex) {
-        err << "Error setting packet queue controls after server reconfiguration: "
-            << ex.what();
-        return (isc::config::createAnswer(1, err.str()));
-    }
+        // Configure DHCP packet queueing
+        if (!reuse_sockets) {
+            try {
+                if (IfaceMgr::instance().configureDHCPPacketQueue(AF_INET, qc)) {
+                    LOG_INFO(dhcp4_logger, DHCP4_CONFIG_PACKET_QUEUE)
+                             .arg(IfaceMgr::instance().getPacketQueue4()->getInfoStr());
+                }
 
-    // Configuration may change active interfaces. Therefore, we have to reopen
-    // sockets according to new configuration. It is possible that this
-    // operation will fail for some interfaces but the openSockets function
-    // guards against exceptions and invokes a callback function to
-    // log warnings. Since we allow that this fails for some interfaces there
-    // is no need to rollback configuration if socket fails to open on any
-    // of the interfaces.
-    CfgMgr::instance().getStagingCfg()->getCfgIface()->
-        openSockets(AF_INET, srv->getServerPort(),
-                    getInstance()->useBroadcast());
+            } catch (const std::exception& ex) {
+                err << "Error setting packet queue controls after server reconfiguration: "
+                    << ex.what();
+                return (isc::config::createAnswer(1, err.str()));
+            }
+        }
+
+        // Configuration may change active interfaces. Therefore, we have to reopen
+        // sockets according to new configuration. It is possible that this
+        // operation will fail for some interfaces but the openSockets function
+        // guards against exceptions and invokes a callback function to
+        // log warnings. Since we allow that this fails for some interfaces there
+        // is no need to rollback configuration if socket fails to open on any
+        // of the interfaces.
+        if (!reuse_sockets) {
+            CfgMgr::instance().getStagingCfg()->getCfgIface()->
+                openSockets(AF_INET, srv->getServerPort(),
+                            getInstance()->useBroadcast());
+        }
+    }
 
     // Install the timers for handling leases reclamation.
     try {
@@ -931,38 +1016,46 @@ ControlledDhcpv4Srv::processConfig(ElementPtr config) {
         }
     }
 
-    // Finally, we can commit runtime option definitions in libdhcp++. This is
-    // exception free.
-    LibDHCP::commitRuntimeOptionDefs();
-
-    // This hook point notifies hooks libraries that the configuration of the
-    // DHCPv4 server has completed. It provides the hook library with the pointer
-    // to the common IO service object, new server configuration in the JSON
-    // format and with the pointer to the configuration storage where the
-    // parsed configuration is stored.
-    if (HooksManager::calloutsPresent(Hooks.hooks_index_dhcp4_srv_configured_)) {
-        CalloutHandlePtr callout_handle = HooksManager::createCalloutHandle();
-
-        callout_handle->setArgument("io_context", srv->getIOService());
-        callout_handle->setArgument("network_state", srv->getNetworkState());
-        callout_handle->setArgument("json_config", config);
-        callout_handle->setArgument("server_config", CfgMgr::instance().getStagingCfg());
-
-        HooksManager::callCallouts(Hooks.hooks_index_dhcp4_srv_configured_,
-                                   *callout_handle);
-
-        // Ignore status code as none of them would have an effect on further
-        // operation.
+    {
+        // The hooks libraries are notified of the new configuration while
+        // the packet processing threads are stopped. The runtime option
+        // definitions are committed with the configuration by the
+        // CfgMgr::commit() function.
+        MultiThreadingCriticalSection cs;
+
+        // This hook point notifies hooks libraries that the configuration of the
+        // DHCPv4 server has completed. It provides the hook library with the pointer
+        // to the common IO service object, new server configuration in the JSON
+        // format and with the pointer to the configuration storage where the
+        // parsed configuration is stored.
+        if (HooksManager::calloutsPresent(Hooks.hooks_index_dhcp4_srv_configured_)) {
+            CalloutHandlePtr callout_handle = HooksManager::createCalloutHandle();
+
+            callout_handle->setArgument("io_context", srv->getIOService());
+            callout_handle->setArgument("network_state", srv->getNetworkState());
+            callout_handle->setArgument("json_config", config);
+            callout_handle->setArgument("server_config", CfgMgr::instance().getStagingCfg());
+
+            HooksManager::callCallouts(Hooks.hooks_index_dhcp4_srv_configured_,
+                                       *callout_handle);
+
+            // Ignore status code as none of them would have an effect on further
+            // operation.
+        }
     }
 
     // Apply multi threading settings.
     // @note These settings are applied/updated only if no errors occur while
     // applying the new configuration.
     // @todo This should be fixed.
+    // The thread pool is only restarted if the parameters have changed.
     try {
-        CfgMultiThreading::apply(CfgMgr::instance().getStagingCfg()->getDHCPMultiThreading());
-        if (MultiThreadingMgr::instance().getMode()) {
-            LOG_FATAL(dhcp4_logger, DHCP4_MULTI_THREADING_WARNING);
+        ElementPtr mt = CfgMgr::instance().getStagingCfg()->getDHCPMultiThreading();
+        if (!CfgMultiThreading::isApplied(mt)) {
+            CfgMultiThreading::apply(mt);
+            if (MultiThreadingMgr::instance().getMode()) {
+                LOG_FATAL(dhcp4_logger, DHCP4_MULTI_THREADING_WARNING);
+            }
         }
     } catch (const std::exception& ex) {
         err << "Error applying multi threading settings: "
@@ -1008,6 +1101,10 @@ ControlledDhcpv4Srv::ControlledDhcpv4Srv(uint16_t server_port /*= DHCP4_SERVER_P
     // CommandMgr uses IO service to run asynchronous socket operations.
     CommandMgr::instance().setIOService(getIOService());
 
+    // Notifications are sent by shared sender threads which live as long as
+    // the server.
+    NotificationsSender::start();
+
     // These are the commands always supported by the DHCPv4 server.
     // Please keep the list in alphabetic order.
     CommandMgr::instance().registerCommand("build-report",
@@ -1054,9 +1151,18 @@ ControlledDhcpv4Srv::ControlledDhcpv4Srv(uint16_t server_port /*= DHCP4_SERVER_P
     CommandMgr::instance().registerCommand("shutdown",
         std::bind(&ControlledDhcpv4Srv::commandShutdownHandler, this, ph::_1, ph::_2));
 
+    CommandMgr::instance().registerCommand("stage-latency-get",
+        std::bind(&StageLatency::commandStageLatencyGetHandler, ph::_1, ph::_2));
+
+    CommandMgr::instance().registerCommand("stage-latency-set",
+        std::bind(&StageLatency::commandStageLatencySetHandler, ph::_1, ph::_2));
+
     CommandMgr::instance().registerCommand("status-get",
         std::bind(&ControlledDhcpv4Srv::commandStatusGetHandler, this, ph::_1, ph::_2));
 
+    CommandMgr::instance().registerCommand("subnet4-delta-apply",
+        std::bind(&ControlledDhcpv4Srv::commandSubnetDeltaApplyHandler, this, ph::_1, ph::_2));
+
     CommandMgr::instance().registerCommand("version-get",
         std::bind(&ControlledDhcpv4Srv::commandVersionGetHandler, this, ph::_1, ph::_2));
 
@@ -1108,6 +1214,9 @@ ControlledDhcpv4Srv::~ControlledDhcpv4Srv() {
 
         timer_mgr_->unregisterTimers();
 
+        // Stop sending notifications before anything they refer to goes away.
+        NotificationsSender::stop();
+
         // Close the command socket (if it exists).
         CommandMgr::instance().closeCommandSocket();
 
@@ -1127,6 +1236,8 @@ ControlledDhcpv4Srv::~ControlledDhcpv4Srv() {
         CommandMgr::instance().deregisterCommand("libreload");
         CommandMgr::instance().deregisterCommand("server-tag-get");
         CommandMgr::instance().deregisterCommand("shutdown");
+        CommandMgr::instance().deregisterCommand("stage-latency-get");
+        CommandMgr::instance().deregisterCommand("stage-latency-set");
         CommandMgr::instance().deregisterCommand("statistic-get");
         CommandMgr::instance().deregisterCommand("statistic-get-all");
         CommandMgr::instance().deregisterCommand("statistic-remove");
@@ -1138,6 +1249,7 @@ ControlledDhcpv4Srv::~ControlledDhcpv4Srv() {
         CommandMgr::instance().deregisterCommand("statistic-sample-count-set");
         CommandMgr::instance().deregisterCommand("statistic-sample-count-set-all");
         CommandMgr::instance().deregisterCommand("status-get");
+        CommandMgr::instance().deregisterCommand("subnet4-delta-apply");
         CommandMgr::instance().deregisterCommand("version-get");
 
     } catch (...) {
@@ -314,6 +314,23 @@ private:
     commandConfigBackendPullHandler(const std::string& command,
                                     isc::data::ElementPtr args);
 
+    /// @brief handler for subnet4-delta-apply command
+    ///
+    /// This method handles the subnet4-delta-apply command, which adds,
+    /// replaces and deletes subnets of the current configuration without
+    /// reconfiguring the whole server. The arguments are described in
+    /// @ref isc::dhcp::SubnetDelta. The optional config-timestamp argument
+    /// is the timestamp of the shard configuration holding the changes,
+    /// which keeps the server from reloading that configuration.
+    ///
+    /// @param command (parameter ignored)
+    /// @param args subnet changes
+    ///
+    /// @return status of the command
+    isc::data::ElementPtr
+    commandSubnetDeltaApplyHandler(const std::string& command,
+                                   isc::data::ElementPtr args);
+
     /// @brief handler for processing 'status-get' command
     ///
     /// This handler processes status-get command, which retrieves
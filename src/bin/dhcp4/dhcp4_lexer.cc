@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 213
-#define YY_END_OF_BUFFER 214
+#define YY_NUM_RULES 221
+#define YY_END_OF_BUFFER 222
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,35 +700,35 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[2057] =
+static const flex_int16_t yy_accept[2161] =
     {   0,
-      206,  206,    0,    0,    0,    0,    0,    0,    0,    0,
-      214,  212,   10,   11,  212,    1,  206,  203,  206,  206,
-      212,  205,  204,  212,  212,  212,  212,  212,  199,  200,
-      212,  212,  212,  201,  202,    5,    5,    5,  212,  212,
-      212,   10,   11,    0,    0,  195,    0,    0,    0,    0,
+      214,  214,    0,    0,    0,    0,    0,    0,    0,    0,
+      222,  220,   10,   11,  220,    1,  214,  211,  214,  214,
+      220,  213,  212,  220,  220,  220,  220,  220,  207,  208,
+      220,  220,  220,  209,  210,    5,    5,    5,  220,  220,
+      220,   10,   11,    0,    0,  203,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    1,  206,  206,
-        0,  205,  206,    3,    2,    6,    0,  206,    0,    0,
-        0,    0,    0,    0,    4,    0,    0,    9,    0,  196,
+        0,    0,    0,    0,    0,    0,    0,    0,    1,  214,
+      214,    0,  213,  214,    3,    2,    6,    0,  214,    0,
+        0,    0,    0,    0,    0,    4,    0,    0,    9,    0,
 
+      204,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  206,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  198,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    2,    0,    0,
-        0,    0,    0,    0,    0,    8,    0,    0,    0,    0,
+        0,    2,    0,    0,    0,    0,    0,    0,    0,    8,
 
-        0,    0,    0,    0,    0,    0,    0,    0,  197,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  205,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   82,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   90,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
@@ -736,198 +736,209 @@ static const flex_int16_t yy_accept[2057] =
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  211,  209,    0,  208,
-      207,    0,    0,    0,    0,    0,    0,    0,    0,  163,
-        0,  162,    0,    0,   88,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       35,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  219,  217,    0,  216,  215,    0,    0,
+        0,    0,    0,    0,    0,    0,  171,    0,  170,    0,
+        0,   96,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   35,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   85,    0,    0,    0,    0,    0,    0,
 
+        0,    0,   93,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   17,    0,    0,    0,    0,    0,    0,
+        0,    0,   17,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   18,    0,    0,    0,    0,    0,    0,
-      210,  207,    0,    0,    0,    0,    0,    0,    0,  164,
-        0,  166,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   89,    0,    0,    0,    0,    0,    0,
-        0,   74,    0,    0,    0,    0,    0,    0,  109,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   38,
+        0,    0,   18,    0,    0,    0,    0,    0,    0,    0,
+      218,  215,    0,    0,    0,    0,    0,    0,    0,  172,
+        0,  174,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   97,    0,    0,    0,    0,    0,    0,
+        0,   82,    0,    0,    0,    0,    0,    0,  117,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   38,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   73,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   77,    0,   39,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       81,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   85,    0,
+       39,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      106,    0,   31,    0,    0,   36,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   12,  168,  167,    0,    0,
+        0,    0,    0,    0,  114,    0,   31,    0,    0,   36,
 
-        0,    0,  119,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       12,  176,  175,    0,    0,    0,    0,  127,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   98,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  106,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   33,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   76,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  120,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,  115,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    7,    0,    0,  169,    0,    0,
+        0,    0,    0,    0,   33,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,   84,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  128,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  123,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    7,    0,    0,  177,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   87,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   95,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  100,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,   96,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  108,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   80,
+        0,  104,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   79,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   88,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  113,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   87,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      125,   94,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   99,   32,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  101,
-       40,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  121,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  133,  102,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  107,   32,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  109,   40,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   68,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  145,    0,    0,    0,    0,    0,
 
+        0,    0,    0,    0,    0,    0,    0,    0,   76,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   84,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      114,    0,    0,    0,    0,    0,    0,   43,    0,    0,
+      153,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   92,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  122,
+        0,    0,    0,    0,    0,    0,   43,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   37,    0,    0,
-      189,    0,    0,    0,   30,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  102,    0,    0,    0,  191,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       37,    0,    0,  197,    0,    0,    0,   30,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  111,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      146,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   81,
+        0,    0,    0,    0,    0,    0,  110,    0,    0,    0,
+      199,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  119,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  154,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   23,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,    0,  151,    0,
-        0,    0,  149,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   89,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  173,    0,    0,    0,    0,    0,    0,
-        0,  112,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  116,    0,    0,    0,    0,    0,   97,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  110,    0,   22,    0,  121,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  155,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   23,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  159,
+        0,    0,    0,  157,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  181,    0,    0,    0,    0,
+        0,    0,    0,  120,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,   71,    0,    0,    0,    0,    0,    0,
-      124,    0,   34,    0,  144,    0,    0,    0,    0,    0,
+        0,    0,    0,  124,    0,    0,    0,    0,    0,  105,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       59,    0,    0,    0,    0,    0,   92,   93,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   75,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   44,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  118,    0,
-        0,    0,    0,    0,    0,    0,    0,  183,    0,    0,
+      118,    0,   22,    0,  129,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  163,    0,    0,    0,    0,
+        0,    0,   79,    0,    0,    0,    0,    0,    0,  132,
+        0,   34,    0,  152,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   67,
+        0,    0,    0,    0,    0,  100,  101,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,  177,    0,    0,    0,
-       72,   86,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   56,    0,    0,    0,    0,    0,    0,
-        0,  152,    0,    0,  150,    0,  140,  139,    0,    0,
-        0,   49,    0,    0,   21,    0,    0,  193,    0,    0,
-        0,    0,  165,    0,    0,    0,    0,  105,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  133,    0,    0,  143,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  122,    0,
-       15,    0,   41,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,  154,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   57,    0,    0,  117,
-        0,    0,    0,    0,  108,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   78,    0,    0,    0,  171,
-        0,    0,    0,  176,    0,    0,    0,    0,    0,    0,
+        0,    0,   83,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   44,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  126,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      191,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       57,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  185,    0,    0,    0,   80,   94,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       64,    0,    0,    0,    0,    0,    0,    0,  160,    0,
+
+        0,  158,    0,  148,  147,    0,    0,    0,   49,    0,
+        0,   21,    0,    0,  201,    0,    0,    0,    0,    0,
+      173,    0,    0,    0,    0,  113,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  188,    0,
+        0,    0,  141,    0,    0,  151,    0,    0,    0,    0,
+       54,    0,   53,    0,    0,    0,    0,    0,    0,  130,
+        0,   15,    0,    0,    0,   41,   58,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  162,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       65,    0,    0,  125,    0,    0,    0,    0,  116,    0,
 
-        0,    0,    0,    0,    0,   14,    0,    0,    0,    0,
-        0,   48,    0,    0,    0,    0,    0,    0,    0,    0,
-      179,    0,  103,   27,    0,    0,    0,    0,   50,  138,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  174,
-        0,  147,    0,    0,    0,    0,    0,    0,    0,    0,
-       25,    0,    0,    0,   24,    0,    0,    0,  153,    0,
-        0,    0,   52,    0,    0,    0,    0,    0,    0,    0,
-       95,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   86,
+        0,    0,    0,    0,  179,    0,    0,    0,  184,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  194,   53,    0,    0,  180,    0,  182,    0,    0,
-
-        0,   42,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  123,    0,    0,    0,
-       26,    0,    0,  185,  175,    0,    0,    0,    0,    0,
-        0,    0,  134,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   47,    0,    0,   20,    0,  178,
-       70,    0,    0,    0,    0,    0,  172,  170,    0,   28,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       16,    0,    0,    0,  159,    0,    0,    0,    0,    0,
-        0,    0,    0,  131,    0,    0,    0,    0,    0,  107,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-       83,    0,    0,    0,  136,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   62,    0,    0,    0,    0,
-        0,    0,    0,    0,  160,   13,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  137,    0,  148,
-        0,    0,    0,    0,    0,    0,    0,    0,  192,    0,
-        0,  181,    0,    0,    0,    0,    0,    0,  142,    0,
-        0,    0,    0,    0,    0,    0,    0,  130,    0,    0,
-       55,   54,    0,   19,    0,  156,    0,    0,    0,    0,
-        0,   45,    0,    0,    0,   91,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  129,    0,    0,    0,
-
-        0,   51,  187,    0,    0,    0,    0,   46,  158,    0,
-        0,   69,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   66,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  196,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   14,    0,    0,    0,    0,    0,   48,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  187,
+
+        0,  111,   27,    0,    0,    0,    0,   50,  146,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  182,    0,
+      155,    0,    0,   55,    0,    0,    0,    0,    0,    0,
+       25,    0,    0,    0,   24,    0,    0,    0,    0,    0,
+      161,    0,    0,    0,   52,    0,    0,    0,    0,    0,
+        0,    0,  103,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   29,    0,    0,   67,    0,
-        0,  135,    0,    0,    0,    0,    0,    0,    0,  157,
-        0,    0,  104,    0,    0,    0,   63,    0,    0,    0,
-        0,    0,    0,    0,  186,    0,    0,  127,    0,  132,
-        0,   65,   58,    0,    0,    0,    0,    0,    0,  190,
-
-        0,    0,  126,    0,    0,  161,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   64,    0,    0,
-        0,    0,    0,    0,    0,   90,    0,    0,   61,    0,
-        0,    0,    0,    0,    0,  184,    0,   60,  128,    0,
+        0,    0,    0,  202,   61,    0,    0,    0,  188,    0,
+      190,    0,    0,    0,   42,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  131,
+
+        0,    0,    0,   26,    0,    0,    0,    0,  193,  183,
+        0,    0,    0,    0,    0,    0,    0,  142,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   47,
+        0,    0,   20,    0,  186,   78,    0,    0,    0,    0,
+        0,    0,  180,  178,    0,   28,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   16,    0,    0,    0,
+      167,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  139,    0,    0,    0,    0,    0,  115,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   91,    0,
+        0,    0,  144,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,   70,    0,    0,    0,    0,    0,
+        0,    0,    0,  168,   13,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  145,    0,
+      156,    0,    0,    0,    0,    0,    0,    0,    0,  200,
+        0,    0,    0,  189,    0,    0,    0,    0,    0,    0,
+      150,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  138,    0,    0,   63,   62,    0,   19,    0,  164,
+        0,    0,    0,    0,    0,   45,    0,    0,    0,    0,
+       99,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  137,    0,    0,    0,    0,    0,    0,   51,  195,
+
+        0,    0,    0,    0,   46,  166,    0,    0,   77,    0,
+       56,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   59,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   74,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   29,    0,    0,   75,
+        0,    0,  143,    0,    0,    0,    0,    0,    0,    0,
+        0,  165,    0,    0,  112,    0,    0,    0,   71,    0,
+        0,    0,    0,    0,    0,    0,    0,  194,    0,    0,
+      135,    0,  140,    0,   73,   66,    0,    0,    0,    0,
+
+        0,   60,    0,  198,    0,    0,  134,    0,    0,  169,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  141,    0
+        0,   72,    0,    0,    0,    0,    0,    0,    0,   98,
+        0,    0,   69,    0,    0,    0,    0,    0,    0,  192,
+        0,   68,  136,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  149,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -974,266 +985,278 @@ static const YY_CHAR yy_meta[74] =
         3,    3,    3
     } ;
 
-static const flex_int16_t yy_base[2069] =
+static const flex_int16_t yy_base[2173] =
     {   0,
         0,   72,   21,   31,   43,   51,   54,   60,   91,   99,
-     2457, 2458,   34, 2453,  145,    0,  207, 2458,  214,  221,
-       13,  228, 2458, 2433,  118,   25,    2,    6, 2458, 2458,
-       73,   11,   17, 2458, 2458, 2458,  104, 2441, 2394,    0,
-     2431,  108, 2448,   24,  262, 2458, 2390,   67, 2396,   84,
-       75,   88,  224,   91,   89,  290,  220, 2388,  206,  285,
-      206,  204,  212,   60,  232, 2397,  294,  296,  325,  313,
-      297, 2380,  230,  317,  371,  335,  236,    0,  375,  393,
-      421,  400,  430, 2458,    0, 2458,  437,  444,  216,  227,
-      229,  275,  338,  338, 2458, 2397, 2438, 2458,  397, 2458,
-
-      420, 2425,  360, 2394,  366,   10,  362,  240,  404,  388,
-      206, 2435,    0,  473,  416, 2377, 2374, 2378,  407, 2374,
-     2382,  416, 2378, 2367, 2368, 2373,   78, 2383, 2366, 2375,
-     2375,   95, 2366,  239, 2367, 2365,  412, 2413, 2417,  233,
-     2411, 2351, 2352, 2373, 2370, 2370, 2364,  413, 2357, 2355,
-     2356, 2348, 2353, 2347,  442, 2344, 2357,  455, 2342, 2341,
-     2355,  462, 2341,  471, 2343,  456, 2334,  492,  300,  470,
-     2355, 2352, 2353, 2341,  447, 2350, 2385, 2384,  471, 2330,
-     2330, 2331,  480, 2323, 2340, 2378, 2331,    0,  472,  461,
-      338,  479,  473,  467, 2330, 2458,    0, 2375,  519, 2324,
-
-      480,  513,  519, 2378,  520, 2377,  516, 2376, 2458,  562,
-      507,  527, 2335, 2327, 2314, 2330, 2331, 2328, 2325, 2324,
-     2315,  532, 2366, 2360, 2324, 2305, 2302, 2310, 2305, 2319,
-     2315, 2303, 2315, 2315, 2306, 2290, 2294, 2307, 2309, 2306,
-     2298, 2288, 2306, 2458, 2286, 2300, 2303, 2284, 2296, 2282,
-     2334, 2281, 2291, 2277, 2293,  550, 2289, 2328, 2273, 2275,
-     2286, 2324, 2269, 2279, 2326, 2284, 2260, 2275,  546, 2265,
-     2271, 2280, 2261, 2259, 2259, 2268, 2264, 2255, 2254, 2253,
-     2260, 2250, 2309, 2265, 2264, 2258,  247, 2265, 2260, 2252,
-     2242, 2257, 2256, 2251, 2255,  501, 2253, 2239, 2245, 2252,
-
-     2288, 2233, 2234, 2237, 2234, 2233,  552, 2228, 2242, 2241,
-     2284, 2243,  541,  510, 2234,  532, 2458, 2458,  565, 2458,
-     2458, 2221,    0,  510,  525, 2269,  571, 2279,  559, 2458,
-     2278, 2458, 2272,  609, 2458, 2234,  558, 2211, 2220, 2268,
-     2212, 2229, 2210, 2216, 2268, 2223, 2218, 2221, 2216,  538,
-     2458, 2218, 2262, 2256, 2214, 2211,  589, 2217, 2257, 2251,
-     2204, 2199, 2196, 2247, 2204, 2193, 2209, 2243, 2189,  632,
-     2203, 2205, 2187, 2200, 2187, 2181, 2196, 2191, 2198, 2193,
-     2192, 2188,  583, 2186, 2189, 2184, 2170, 2182, 2178, 2228,
-      569, 2222, 2181, 2458, 2171, 2219, 2169, 2168, 2167, 2160,
-
-     2162, 2174, 2165, 2154, 2171, 2166, 2171,  575, 2212, 2165,
-     2156, 2161, 2164, 2458, 2163, 2152, 2152, 2164,  581, 2139,
-     2140, 2161,  598, 2143, 2194, 2139, 2153, 2156, 2151, 2137,
-     2149, 2148, 2147, 2148, 2141, 2144, 2143, 2142, 2141,  546,
-     2184, 2143, 2182, 2458, 2124, 2123,  643, 2116, 2120, 2134,
-     2458, 2458, 2133,    0, 2122, 2114,  567, 2173, 2172, 2458,
-     2171, 2458,  619,  683, 2130,  605, 2169, 2111, 2122, 2115,
-     2117, 2116, 2104, 2458, 2109, 2115, 2118, 2101, 2116, 2103,
-     2102, 2458,  610, 2104, 2101,  615, 2099, 2101, 2458, 2109,
-     2106, 2091, 2104, 2099,  655, 2106, 2094, 2087, 2138, 2458,
-
-     2085, 2101, 2135, 2096, 2085, 2092, 2093, 2095, 2083, 2128,
-     2079, 2074, 2073, 2072, 2123, 2084, 2066,  615, 2066, 2084,
-     2058, 2065, 2070, 2080, 2114, 2118, 2458, 2063, 2059, 2057,
-     2066, 2059, 2064, 2058, 2065, 2049, 2049, 2059, 2047, 2061,
-     2050, 2046, 2044, 2037, 2458, 2100, 2458, 2042, 2056, 2052,
-     2091, 2036, 2041, 2050, 2044, 2038, 2047, 2089, 2083, 2045,
-     2028, 2028, 2023, 2043, 2018, 2024, 2029, 2022, 2030, 2034,
-     2017, 2075, 2030, 2015, 2067, 2012, 2013, 2012, 2024, 2013,
-     2458, 2023, 2458, 2012, 2010, 2458, 2021, 2020, 2013, 2055,
-     2015,    0, 1999, 2016, 2056, 2458, 2458, 2458,  630,  632,
-
-     1996,  665, 2458, 2006, 2005, 2012, 1992, 1991, 2044, 1989,
-      657, 1988, 1987, 1986, 1993, 1986, 1998, 1980, 1980, 1995,
-     1994, 1993, 1992, 1992, 1974, 1979, 2020, 1987, 1979, 2024,
-     1968, 1984, 1983, 2458, 1968, 1965, 2023, 1978, 1970, 1976,
-     1967, 1975, 1960, 1974, 1975, 1957, 1971, 2007,  570, 1952,
-     1946, 1951, 2003, 1965, 1963, 1961, 1962, 1941, 1962, 1950,
-     1956, 1999, 1954, 1946, 1937, 2458, 1938, 1940, 1949, 1950,
-     1932, 1945, 1984, 1983, 1934,   16, 1943, 1980, 1925, 1926,
-     1929, 1922, 1975, 2458, 1935, 1924, 1913, 1917, 1931, 1923,
-     1968, 1920, 1927, 1965, 2458, 1910, 1924, 1908, 1922, 1925,
-
-     1906, 1958, 1957, 1956, 1955, 1900, 1953, 1952, 2458, 1899,
-     1896, 1910,  675, 1911,  172,  286,  319,  387,  363,  365,
-      435,  505,  567,  585, 2458,  632,  624, 2458,  647,  666,
-      631,  622,  622,  631,  624,  624,  691,  665,  697,  666,
-      641,  694,  668,  709,  710,  664,  665,  675,  680,  666,
-      669,  668,  725,  678,  688,  691,  729,  692,  688,  685,
-      687,  734,  740,  698,  699, 2458,  702,  698,  689,  704,
-      709,  706,  707,  710,  709,  710,  707,  709,  717,  714,
-      759,  760,  718,  711,  706,  704,  714,  761,  708,  721,
-      770, 2458,  771,  724,  726,  722,  716,  719,  737,  773,
-
-      774,  737,  726,  739, 2458,  729,  740,  729,  742,  744,
-      788,  789,  746,  733,  741,  745,  730,  753,  732,  738,
-      793,  757,  741,  753,  797,  798,  799,  746,  801,  765,
-      760,  767,  763,  748,  760,  761,  757,  769,  756, 2458,
-      821,  779,  780,  770,  782,  772,  785,  770,  777,  771,
-      827,  785,  777,  791,  831,  807,  784,  795,  800,  797,
-      798,  843,  796,  794,  803, 2458,  793,  808,  805,  810,
-      792,  799,  798,  796,  815,  812,  800,  807,  808,  817,
-      817,  807,  805,  804,  816,  812,  868,  825,  810,  811,
-      817,  833,  823, 2458,  833,  833,  826,  837,  835,  880,
-
-      822,  824,  878,  840,  828,  887,  835,  845,  831,  834,
-     2458, 2458,  852,  845,  850,  851,  856,  844,  854,  855,
-      857, 2458, 2458,  858,  845,  863,  850,  844,  847,  850,
-      851,  869,  856,  906,  857,  909,  855,  859,  917, 2458,
-     2458,  865,  863,  920,  868,  867,  864,  924,  877,  867,
-      868,  864,  877,  888,  872,  890,  885,  886,  888,  881,
-      883,  884,  885,  885,  887,  902,  943,  900,  905,  882,
-      947,  906,  890, 2458,  897,  898,  912,  902,  900,  950,
-      908,  898,  915,  908,  915,  916,  904,  936,  944,  913,
-      914,  909,  964,  965, 2458,  928,  932,  973,  921,  916,
-
-      917,  918,  930,  937,  926,  927,  923,  926,  927,  937,
-      946,  982,  938,  933,  992,  949,  950,  941, 2458,  943,
-      946,  954,  956,  941,  957,  951,  998,  964,  948,  949,
-     2458,  965,  968,  951,  962, 1011,  954, 2458,  954,  972,
-      975,  955,  958,  974,  961, 1015,  973,  969,  966,  972,
-     1020, 1021,  983,  969,  987,  986,  983,  988,  989,  975,
-      990,  982,  989,  979,  997,  996,  983, 2458,  996,  992,
-     2458,  998, 1001, 1046, 2458,  995, 1000, 1044,  996, 1008,
-     1002, 1006, 1004, 1002, 1004, 1014, 1059, 1003, 1008, 1004,
-     1063, 1007, 1019, 2458, 1007, 1015, 1013, 2458, 1065, 1027,
-
-     1013, 1014, 1023, 1035, 1022, 1020, 1025, 1035, 1036, 1037,
-     1037, 1039, 1044, 1085, 1057, 1062, 1082, 1046, 1042, 1038,
-     1033, 1093, 1036, 2458, 1036, 1056, 1055, 1050, 1047, 1036,
-     1053, 1060, 1103, 1064, 1057, 1061, 1065, 1048, 1109, 1056,
-     2458, 1106, 1053, 1056, 1057, 1058, 1058, 1079, 1076, 1081,
-     1082, 1068, 1076, 1085, 1065, 1080, 1087, 1129, 1087, 2458,
-     1131, 1132, 1089, 1084, 1094, 1097, 1098, 1086, 1082, 1083,
-     1090, 1099, 1087, 1101, 1095, 1096, 1108, 1149, 1096, 1094,
-     1098, 1097, 1098, 1115, 1156, 1106, 1105, 1111, 1109, 1107,
-     1102, 1163, 1116, 1165, 1161, 1167, 2458, 1124, 1117, 1108,
-
-     1127, 1115, 1125, 1122, 1127, 1124, 1137, 1137, 2458, 1121,
-     1123, 1123, 2458, 1124, 1184, 1123, 1142, 1143, 1145, 1136,
-     1190, 1191, 1144, 1129, 1143, 1151, 1150, 1134, 1155, 1146,
-     1155, 1142, 1160, 2458, 1182, 1173, 1146, 1206, 1146, 1168,
-     1165, 2458, 1152, 1154, 1171, 1166, 1160, 1171, 1216, 1164,
-     1168, 2458, 1160, 1177, 1157, 1178, 1168, 2458, 1183, 1183,
-     1222, 1169, 1224, 1182, 1187, 1174, 1234, 1177, 1188, 1180,
-     1186, 1182, 1200, 1201, 1202, 2458, 1243, 2458, 1202, 2458,
-     1187, 1189, 1189, 1208, 1198, 1209, 1192, 1247, 1205, 1249,
-     1213, 1202, 1204, 1210, 1211, 1217, 2458, 1210, 1262, 1210,
-
-     1204, 1205, 1266, 2458, 1267, 1209, 1215, 1222, 1266, 1228,
-     2458, 1220, 2458, 1216, 2458, 1218, 1232, 1237, 1220, 1279,
-     1236, 1237, 1238, 1278, 1230, 1235, 1286, 1239, 1235, 1289,
-     2458, 1236, 1291, 1292, 1249, 1251, 2458, 2458, 1234, 1296,
-     1292, 1256, 1299, 1241, 1296, 1302, 1245, 1256, 1261, 1276,
-     1307, 1244, 2458, 1265, 1258, 1267, 1312, 1259, 1274, 1310,
-     1263, 1263, 2458, 1259, 1275, 1276, 1277, 1274, 1318, 1281,
-     1285, 1272, 1268, 1328, 1281, 1325, 1331, 1288, 2458, 1289,
-     1283, 1293, 1294, 1291, 1281, 1284, 1284, 2458, 1289, 1344,
-     1303, 1346, 1289, 1348, 1309, 1345, 1291, 1287, 1302, 1295,
-
-     1298, 1298, 1313, 1314, 1312, 1362, 2458, 1305, 1320, 1317,
-     2458, 2458, 1322, 1314, 1324, 1309, 1365, 1327, 1312, 1373,
-     1317, 1327, 1376, 2458, 1324, 1324, 1326, 1328, 1381, 1322,
-     1325, 2458, 1326, 1345, 2458, 1329, 2458, 2458, 1342, 1344,
-     1345, 2458, 1332, 1340, 2458, 1392, 1338, 2458, 1350, 1343,
-     1396, 1376, 2458, 1343, 1399, 1356, 1397, 2458, 1345, 1353,
-     1347, 1344, 1402, 1348, 1351, 1351, 1368, 1407, 1360, 1372,
-     1375, 1357, 1364, 1354, 2458, 1376, 1362, 2458, 1364, 1365,
-     1380, 1380, 1383, 1383, 1380, 1424, 1386, 1378, 2458, 1388,
-     2458, 1389, 2458, 1376, 1387, 1377, 1393, 1394, 1391, 1435,
-
-     1383, 1437, 1399, 1400, 1392, 2458, 1446, 1389, 1391, 1392,
-     1392, 1398, 1397, 1395, 1449, 1410, 2458, 1451, 1398, 2458,
-     1399, 1399, 1401, 1407, 2458, 1409, 1463, 1405, 1413, 1416,
-     1427, 1425, 1469, 1422, 1431, 2458, 1414, 1414, 1430, 2458,
-     1427, 1450, 1433, 2458, 1478, 1420, 1480, 1481, 1438, 1443,
-     1425, 1426, 1486, 1487, 1483, 1447, 1444, 1440, 1433, 1445,
-     1435, 1440, 1496, 1450, 1498, 1494, 1458, 1454, 1499, 1447,
-     1452, 1450, 1509, 1465, 1456, 1512, 1469, 1471, 1467, 1516,
-     1477, 1466, 1460, 1520, 1462, 1463, 1464, 1478, 2458, 1466,
-     1482, 1482, 1528, 1470, 1487, 1483, 1477, 1488, 1472, 1530,
-
-     1531, 1478, 1533, 1496, 1497, 2458, 1497, 1498, 1485, 1484,
-     1540, 2458, 1481, 1499, 1500, 1549, 1550, 1508, 1521, 1553,
-     2458, 1506, 2458, 2458, 1555, 1508, 1493, 1558, 2458, 2458,
-     1504, 1509, 1507, 1557, 1515, 1520, 1511, 1509, 1524, 2458,
-     1512, 2458, 1515, 1566, 1509, 1514, 1574, 1522, 1532, 1533,
-     2458, 1578, 1531, 1522, 2458, 1582, 1583, 1533, 2458, 1527,
-     1542, 1530, 2458, 1531, 1541, 1542, 1591, 1587, 1550, 1554,
-     2458, 1590, 1556, 1532, 1558, 1551, 1560, 1542, 1549, 1603,
-     1562, 1561, 1606, 1554, 1608, 1609, 1559, 1563, 1568, 1562,
-     1572, 2458, 2458, 1616, 1617, 2458, 1566, 2458, 1619, 1561,
-
-     1566, 2458, 1565, 1575, 1619, 1567, 1582, 1569, 1575, 1575,
-     1630, 1587, 1575, 1574, 1634, 1587, 2458, 1631, 1582, 1579,
-     2458, 1593, 1592, 2458, 2458, 1593, 1598, 1643, 1596, 1597,
-     1594, 1595, 2458, 1606, 1649, 1608, 1591, 1593, 1609, 1597,
-     1592, 1608, 1609, 1618, 2458, 1608, 1660, 2458, 1619, 2458,
-     2458, 1603, 1610, 1664, 1660, 1608, 2458, 2458, 1623, 2458,
-     1663, 1625, 1626, 1627, 1612, 1613, 1621, 1675, 1671, 1626,
-     2458, 1638, 1625, 1632, 2458, 1629, 1634, 1632, 1684, 1685,
-     1632, 1622, 1630, 2458, 1645, 1646, 1647, 1648, 1639, 2458,
-     1650, 1640, 1652, 1697, 1658, 1699, 1641, 1649, 1650, 1663,
-
-     2458, 1640, 1700, 1661, 2458, 1665, 1708, 1651, 1651, 1711,
-     1667, 1660, 1659, 1670, 1657, 2458, 1662, 1718, 1676, 1678,
-     1669, 1678, 1680, 1684, 2458, 2458, 1672, 1686, 1727, 1670,
-     1671, 1730, 1731, 1679, 1733, 1691, 1735, 2458, 1684, 2458,
-     1732, 1694, 1695, 1682, 1741, 1684, 1689, 1680, 2458, 1745,
-     1698, 2458, 1699, 1689, 1706, 1705, 1746, 1708, 2458, 1705,
-     1710, 1711, 1756, 1713, 1716, 1754, 1701, 2458, 1761, 1762,
-     2458, 2458, 1718, 2458, 1724, 2458, 1721, 1707, 1767, 1768,
-     1711, 2458, 1730, 1771, 1730, 2458, 1721, 1711, 1770, 1736,
-     1729, 1725, 1722, 1727, 1723, 1725, 2458, 1730, 1740, 1730,
-
-     1738, 2458, 2458, 1739, 1729, 1730, 1742, 2458, 2458, 1747,
-     1740, 2458, 1742, 1750, 1795, 1736, 1738, 1735, 1759, 1752,
-     1755, 1744, 1798, 1745, 1753, 1766, 1753, 1762, 1765, 1766,
-     1759, 1754, 1758, 1770, 1815, 2458, 1761, 1773, 1818, 1767,
-     1766, 1821, 1774, 1761, 1776, 1781, 1769, 1774, 1768, 1829,
-     1773, 1787, 1832, 1782, 1776, 2458, 1792, 1836, 2458, 1793,
-     1795, 2458, 1786, 1800, 1796, 1789, 1803, 1844, 1788, 2458,
-     1788, 1847, 2458, 1804, 1849, 1810, 2458, 1851, 1852, 1807,
-     1806, 1807, 1797, 1805, 2458, 1818, 1859, 2458, 1855, 2458,
-     1802, 2458, 2458, 1862, 1804, 1820, 1865, 1822, 1808, 2458,
-
-     1828, 1825, 2458, 1866, 1815, 2458, 1814, 1826, 1829, 1822,
-     1877, 1819, 1821, 1836, 1827, 1838, 1823, 2458, 1836, 1885,
-     1829, 1834, 1888, 1836, 1838, 2458, 1833, 1887, 2458, 1834,
-     1850, 1895, 1851, 1897, 1898, 2458, 1842, 2458, 2458, 1846,
-     1849, 1897, 1853, 1860, 1865, 1901, 1854, 1864, 1850, 1868,
-     1857, 1859, 1868, 1914, 2458, 2458, 1920, 1925, 1930, 1935,
-     1940, 1945, 1950, 1953, 1927, 1932, 1934, 1947
+     2562, 2563,   34, 2558,  145,    0,  207, 2563,  214,  221,
+       13,  228, 2563, 2538,  118,   25,    2,    6, 2563, 2563,
+       73,   11,   17, 2563, 2563, 2563,  104, 2546, 2499,    0,
+     2536,  108, 2553,   24,  262, 2563, 2495,   67, 2501,   84,
+       75,   88,  224,   91,   89,  290,  220, 2493,  206,  285,
+      206,  210,  219,   60,  232, 2502,  294,  296,  325,  313,
+      297, 2485,  212,  317,  371,  335,  290,  251,    0,  375,
+      393,  421,  400,  430, 2563,    0, 2563,  437,  444,  196,
+      216,  223,  275,  338,  338, 2563, 2502, 2543, 2563,  397,
+
+     2563,  420, 2530,  360, 2499,  366,   10,  362,  388,  404,
+      430,  338, 2540,    0,  478,  416, 2482, 2479, 2483,  244,
+     2479, 2487,  416, 2483, 2472, 2473, 2478,   78, 2488, 2471,
+     2480, 2480,   95, 2471,  416, 2461, 2471, 2469, 2468,  412,
+     2516, 2520,  294, 2514, 2454, 2455, 2476, 2473, 2473, 2467,
+      443, 2460, 2458, 2459, 2451, 2456, 2450,  442, 2447, 2460,
+      420, 2445, 2444, 2458,  450, 2444,  459, 2446,  471, 2437,
+      486,  429,  472, 2458, 2455, 2456, 2444,  238, 2453, 2488,
+     2487,  476, 2433, 2433, 2434,  496, 2426, 2443, 2481, 2434,
+     2436,    0,  454,  489,  509,  502,  510,  513, 2432, 2563,
+
+        0, 2477,  519, 2426,  508,  517,  524, 2480,  525, 2479,
+      521, 2478, 2563,  567,  494,  532, 2437, 2429, 2416, 2432,
+     2433, 2430, 2427, 2426, 2417,  505, 2468, 2462, 2426, 2407,
+     2404, 2412, 2407, 2421, 2417, 2405, 2417, 2417, 2408, 2392,
+     2396, 2400, 2408, 2410, 2390, 2406, 2398, 2388, 2406, 2563,
+     2386, 2400, 2403, 2384, 2396, 2382, 2434, 2381, 2391, 2377,
+     2393,  557, 2389, 2428, 2373, 2375, 2386, 2424, 2369, 2379,
+     2426, 2384, 2360, 2375,  549, 2365, 2371, 2380, 2361, 2359,
+     2359, 2368, 2364, 2355, 2354, 2353, 2360, 2350, 2409, 2365,
+     2364, 2358,  501, 2365, 2360, 2352, 2342, 2357, 2356, 2351,
+
+     2355,  519, 2353, 2339, 2345, 2352, 2388, 2333, 2334, 2337,
+     2334, 2333,  591, 2328, 2342, 2341, 2384, 2343,  560,  428,
+     2334, 2322,  550, 2563, 2563,  561, 2563, 2563, 2320,    0,
+      525,  557, 2368,  572, 2378,  566, 2563, 2377, 2563, 2371,
+      616, 2563, 2333,  565, 2310, 2319, 2367, 2311, 2328, 2309,
+     2315, 2367, 2322, 2317, 2320, 2315,  541, 2563, 2317, 2361,
+     2355, 2313, 2310,  592, 2316, 2356, 2350, 2303, 2298, 2295,
+     2346, 2303, 2307, 2291, 2307, 2291, 2340, 2286,  614, 2300,
+     2302, 2284, 2297, 2284, 2278, 2293,  572, 2296, 2291, 2290,
+     2286,  592, 2284, 2287, 2282, 2268, 2280, 2276, 2326,  596,
+
+     2320, 2279, 2563, 2269, 2317, 2267, 2266, 2265, 2258, 2260,
+     2272, 2263, 2252, 2269, 2264, 2269,  606, 2310, 2263, 2254,
+     2259, 2262, 2563, 2261, 2250, 2250, 2262,  586, 2237, 2238,
+     2259,  596, 2241, 2292, 2237, 2251, 2254, 2249, 2235, 2247,
+     2246, 2245, 2246, 2239, 2242, 2241, 2240, 2239,  549, 2282,
+     2241, 2280, 2563, 2222, 2221,  642, 2214, 2218, 2232, 2269,
+     2563, 2563, 2230,    0, 2219, 2211,  615, 2270, 2269, 2563,
+     2268, 2563,  626,  674, 2227,  616, 2266, 2208, 2219, 2212,
+     2214, 2213, 2201, 2563, 2206, 2212, 2215, 2198, 2213, 2200,
+     2199, 2563,  643, 2201, 2198,  612, 2196, 2198, 2563, 2206,
+
+     2203, 2188, 2201, 2196,  666, 2238, 2202, 2190, 2235, 2182,
+     2233, 2563, 2180, 2196, 2230, 2191, 2180, 2187, 2188, 2190,
+     2178, 2223, 2174, 2173, 2178, 2167, 2166, 2165, 2216, 2177,
+     2159,  621, 2159, 2177, 2151, 2158, 2163, 2173, 2207, 2211,
+     2563, 2156, 2152, 2150, 2159, 2152, 2157, 2151, 2158, 2142,
+     2142, 2152, 2140, 2154, 2143, 2139, 2137, 2130, 2563, 2193,
+     2563, 2135, 2149, 2145, 2184, 2129, 2134, 2143, 2137, 2131,
+     2140, 2182, 2176, 2138, 2121, 2121, 2116, 2136, 2111, 2117,
+     2122, 2115, 2123, 2127, 2110, 2168, 2123, 2108, 2160, 2105,
+     2106, 2105, 2117, 2106, 2563, 2116, 2563, 2105, 2103, 2563,
+
+     2114, 2113, 2106, 2148, 2107, 2107,    0, 2091, 2108, 2148,
+     2563, 2563, 2563,  636,  647, 2088,  698, 2563, 2098, 2097,
+     2104, 2084, 2083, 2136, 2081,  402, 2080, 2079, 2078, 2085,
+     2078, 2090, 2072, 2072, 2087, 2086, 2085, 2084, 2084, 2066,
+     2071, 2112, 2079, 2071, 2116, 2060, 2076, 2075, 2563, 2060,
+      614, 2057, 2115, 2072, 2069, 2061, 2067, 2058, 2066, 2051,
+     2065, 2066, 2048, 2062, 2098,  663, 2043, 2061, 2043, 2035,
+     2040, 2092, 2054, 2052, 2050, 2051, 2030, 2051, 2039, 2045,
+     2088, 2043, 2035, 2026, 2563, 2027, 2029, 2038, 2039, 2021,
+     2034, 2073, 2072, 2023,   16, 2032, 2069, 2014, 2015, 2018,
+
+     2011, 2064, 2563, 2024, 2013, 2002, 2006, 2020, 2012, 2057,
+     2009, 2016, 2054, 2563, 1999,  170,  185,  245,  322,  334,
+      488,  551,  596,  608,  563,  672,  673, 2563,  623,  628,
+      644,  702,  666,  667,  666,  668,  707,  676,  662,  669,
+      673,  682,  675,  673, 2563,  684,  676, 2563,  699,  710,
+      684,  675,  675,  684,  677,  673,  733,  697,  740,  699,
+      686,  741,  703,  743,  744,  698,  698,  708,  713,  700,
+      703,  696,  754,  707,  717,  720,  758,  721,  717,  714,
+      716,  763,  769,  727,  719,  719,  731, 2563,  722,  735,
+      730,  721,  736,  741,  738,  739,  742,  741,  742,  739,
+
+      741,  749,  727,  732,  748,  738,  750,  795,  796,  754,
+      747,  742,  740,  750,  797,  744,  757,  806, 2563,  807,
+      760,  762,  758,  752,  755,  773,  809,  810,  773,  762,
+      775, 2563,  765,  776,  765,  778,  780,  824,  825,  782,
+      769,  777,  781,  766,  789,  768,  774,  829,  793,  777,
+      789,  833,  834,  835,  782,  837,  801,  796,  803,  799,
+      784,  796,  797,  793,  805,  792, 2563,  857,  815,  816,
+      806,  818,  808,  821,  806,  813,  807,  863,  821,  813,
+      814,  828,  868,  844,  821,  832,  837,  834,  835,  880,
+      833,  831,  840, 2563,  830,  845,  842,  847,  829,  836,
+
+      835,  833,  852,  849,  837,  844,  845,  854,  854,  844,
+      842,  841,  853,  849,  905,  862,  847,  848,  854,  870,
+      860, 2563,  870,  854,  863,  872,  864,  866,  877,  875,
+      920,  862,  864,  918,  880,  868,  927,  875,  885,  871,
+      876,  892,  876,  876,  895, 2563, 2563,  896,  889,  894,
+      895,  900,  888,  898,  899,  901, 2563, 2563,  902,  889,
+      907,  894,  888,  891,  894,  895,  913,  900,  950,  901,
+      953,  899,  903,  961, 2563, 2563,  909,  907,  964,  912,
+      911,  908,  968,  921,  911,  912,  908,  921,  932,  916,
+      934,  929,  930,  932,  925,  927,  928,  929,  929,  931,
+
+      946,  987,  944,  949,  926,  991,  950,  934, 2563,  941,
+      942,  956,  946,  944,  994,  952,  942,  959,  952,  959,
+     1000,  962,  949,  981,  989,  958,  959,  954, 1009, 1010,
+     2563,  973,  977, 1018,  966,  961,  962,  963,  975,  982,
+      971,  972,  968,  971,  972,  982,  991, 1027,  983,  978,
+     1037,  994,  995,  986, 2563,  988,  991,  999, 1001,  986,
+     1002,  996, 1004, 1001, 1045,  999, 1012,  996,  997, 2563,
+     1013, 1016,  999, 1010, 1059, 1002, 2563, 1002, 1020, 1023,
+     1016, 1006, 1005, 1020, 1025, 1010, 1026, 1013, 1067, 1025,
+     1021, 1018, 1024, 1072, 1073, 1035, 1021, 1039, 1038, 1035,
+
+     1040, 1041, 1027, 1042, 1034, 1041, 1031, 1049, 1048, 1035,
+     2563, 1048, 1044, 2563, 1050, 1053, 1098, 2563, 1047, 1052,
+     1096, 1048, 1060, 1054, 1058, 1056, 1054, 1056, 1066, 1111,
+     1055, 1060, 1056, 1115, 1059, 1072, 2563, 1060, 1068, 1066,
+     2563, 1117, 1079, 1065, 1066, 1075, 1087, 1074, 1072, 1077,
+     1087, 1088, 1089, 1089, 1091, 1093, 1097, 1138, 1110, 1115,
+     1135, 1099, 1095, 1091, 1086, 1146, 1089, 2563, 1089, 1109,
+     1108, 1103, 1100, 1089, 1106, 1113, 1156, 1117, 1110, 1114,
+     1118, 1101, 1162, 1109, 2563, 1159, 1106, 1109, 1110, 1111,
+     1111, 1132, 1129, 1134, 1135, 1119, 1135, 1123, 1131, 1132,
+
+     1141, 1121, 1136, 1143, 1185, 1143, 2563, 1187, 1188, 1145,
+     1140, 1150, 1136, 1136, 1155, 1142, 1139, 1158, 1146, 1142,
+     1143, 1150, 1159, 1147, 1161, 1155, 1156, 1168, 1209, 1156,
+     1154, 1158, 1157, 1158, 1175, 1216, 1166, 1165, 1171, 1169,
+     1167, 1162, 1223, 1176, 1225, 1221, 1227, 2563, 1184, 1177,
+     1168, 1187, 1176, 1186, 1183, 1188, 1184, 1197, 1197, 2563,
+     1181, 1183, 1183, 2563, 1184, 1244, 1183, 1202, 1203, 1205,
+     1196, 1250, 1251, 1204, 1189, 1203, 1211, 1210, 1194, 1215,
+     1206, 1215, 1202, 1202, 1221, 2563, 1243, 1234, 1207, 1267,
+     1207, 1229, 1226, 2563, 1213, 1215, 1232, 1227, 1221, 1232,
+
+     1277, 1225, 1229, 2563, 1221, 1238, 1218, 1239, 1229, 2563,
+     1244, 1244, 1283, 1230, 1285, 1243, 1248, 1235, 1295, 1238,
+     1249, 1237, 1235, 1243, 1242, 1250, 1246, 1264, 1265, 1266,
+     2563, 1307, 2563, 1266, 2563, 1251, 1253, 1253, 1272, 1273,
+     1309, 1264, 1257, 1317, 1277, 1260, 1315, 1273, 1317, 1281,
+     1270, 1272, 1278, 1279, 1285, 2563, 1278, 1330, 1278, 1272,
+     1273, 1334, 2563, 1335, 1277, 1283, 1290, 1334, 1296, 2563,
+     1288, 2563, 1284, 2563, 1286, 1300, 1305, 1288, 1347, 1304,
+     1305, 1306, 1346, 1298, 1303, 1354, 1307, 1303, 1357, 2563,
+     1304, 1359, 1360, 1317, 1319, 2563, 2563, 1302, 1364, 1360,
+
+     1324, 1367, 1309, 1364, 1370, 1313, 1324, 1316, 1330, 1345,
+     1376, 1313, 2563, 1334, 1327, 1336, 1381, 1328, 1343, 1379,
+     1332, 1332, 2563, 1328, 1344, 1345, 1346, 1343, 1387, 1350,
+     1354, 1341, 1337, 1397, 1350, 1394, 1400, 1357, 2563, 1358,
+     1353, 1366, 1407, 1364, 1409, 1366, 1363, 1353, 1356, 1356,
+     2563, 1361, 1416, 1375, 1418, 1361, 1361, 1379, 1422, 1423,
+     2563, 1384, 1421, 1367, 1363, 1378, 1371, 1374, 1373, 1388,
+     1389, 1387, 1436, 2563, 1380, 1395, 1392, 2563, 2563, 1397,
+     1389, 1399, 1384, 1440, 1402, 1387, 1448, 1392, 1402, 1451,
+     2563, 1399, 1399, 1401, 1403, 1456, 1397, 1400, 2563, 1401,
+
+     1420, 2563, 1404, 2563, 2563, 1417, 1419, 1420, 2563, 1407,
+     1415, 2563, 1467, 1413, 2563, 1425, 1418, 1431, 1472, 1452,
+     2563, 1419, 1475, 1432, 1473, 2563, 1421, 1429, 1423, 1420,
+     1478, 1424, 1427, 1427, 1444, 1483, 1436, 1448, 1451, 1433,
+     1440, 1430, 2563, 1452, 1438, 2563, 1440, 1441, 1456, 1450,
+     2563, 1457, 2563, 1460, 1460, 1457, 1501, 1463, 1455, 2563,
+     1465, 2563, 1466, 1463, 1458, 2563, 2563, 1455, 1466, 1456,
+     1472, 1473, 1470, 1514, 1462, 1516, 1478, 1479, 1471, 2563,
+     1525, 1468, 1470, 1471, 1471, 1477, 1476, 1474, 1528, 1489,
+     2563, 1530, 1477, 2563, 1478, 1478, 1480, 1486, 2563, 1488,
+
+     1542, 1484, 1492, 1495, 1506, 1504, 1548, 1501, 1510, 2563,
+     1493, 1493, 1509, 1513, 2563, 1507, 1530, 1513, 2563, 1558,
+     1500, 1560, 1561, 1518, 1523, 1505, 1506, 1566, 1567, 1563,
+     1527, 1524, 1520, 1513, 1525, 1515, 1520, 1576, 1530, 1578,
+     1574, 1538, 1582, 1536, 1580, 1528, 1533, 1531, 1590, 1546,
+     1537, 1593, 1540, 1535, 1552, 1554, 1550, 1599, 1560, 1549,
+     1543, 1603, 1545, 1546, 1547, 1561, 2563, 1549, 1565, 1565,
+     1611, 1553, 1570, 1566, 1560, 1571, 1555, 1613, 1614, 1561,
+     1616, 1579, 1580, 2563, 1580, 1581, 1568, 1567, 1623, 2563,
+     1564, 1582, 1583, 1632, 1633, 1586, 1592, 1605, 1637, 2563,
+
+     1590, 2563, 2563, 1639, 1592, 1577, 1642, 2563, 2563, 1588,
+     1593, 1591, 1641, 1599, 1605, 1596, 1594, 1608, 2563, 1596,
+     2563, 1599, 1650, 2563, 1593, 1598, 1658, 1606, 1616, 1617,
+     2563, 1662, 1615, 1606, 2563, 1613, 1614, 1668, 1669, 1619,
+     2563, 1613, 1628, 1616, 2563, 1617, 1627, 1628, 1677, 1673,
+     1636, 1640, 2563, 1676, 1642, 1618, 1644, 1637, 1646, 1628,
+     1635, 1689, 1648, 1647, 1692, 1640, 1694, 1695, 1645, 1650,
+     1655, 1648, 1658, 2563, 2563, 1651, 1703, 1704, 2563, 1653,
+     2563, 1706, 1648, 1653, 2563, 1652, 1662, 1706, 1654, 1669,
+     1656, 1662, 1662, 1717, 1674, 1662, 1661, 1721, 1674, 2563,
+
+     1718, 1669, 1666, 2563, 1680, 1679, 1723, 1670, 2563, 2563,
+     1682, 1687, 1732, 1685, 1686, 1683, 1684, 2563, 1695, 1738,
+     1697, 1680, 1682, 1698, 1686, 1681, 1697, 1698, 1707, 2563,
+     1697, 1749, 2563, 1708, 2563, 2563, 1692, 1699, 1753, 1749,
+     1697, 1708, 2563, 2563, 1713, 2563, 1753, 1715, 1716, 1717,
+     1702, 1703, 1711, 1765, 1761, 1716, 2563, 1728, 1715, 1722,
+     2563, 1719, 1724, 1722, 1774, 1775, 1722, 1736, 1734, 1714,
+     1722, 2563, 1737, 1738, 1739, 1740, 1731, 2563, 1742, 1732,
+     1744, 1789, 1750, 1791, 1733, 1741, 1742, 1755, 2563, 1732,
+     1792, 1753, 2563, 1757, 1800, 1742, 1744, 1744, 1804, 1760,
+
+     1753, 1752, 1763, 1750, 2563, 1755, 1811, 1769, 1771, 1762,
+     1771, 1773, 1777, 2563, 2563, 1765, 1759, 1763, 1781, 1822,
+     1765, 1766, 1825, 1826, 1774, 1828, 1786, 1830, 2563, 1779,
+     2563, 1827, 1789, 1790, 1777, 1836, 1779, 1784, 1775, 2563,
+     1776, 1841, 1794, 2563, 1795, 1785, 1802, 1801, 1842, 1804,
+     2563, 1801, 1806, 1807, 1852, 1809, 1812, 1850, 1814, 1799,
+     1799, 2563, 1859, 1860, 2563, 2563, 1816, 2563, 1822, 2563,
+     1819, 1805, 1865, 1866, 1809, 2563, 1828, 1869, 1828, 1871,
+     2563, 1820, 1810, 1869, 1835, 1828, 1824, 1821, 1826, 1822,
+     1824, 2563, 1829, 1839, 1829, 1835, 1886, 1839, 2563, 2563,
+
+     1840, 1830, 1831, 1843, 2563, 2563, 1848, 1841, 2563, 1843,
+     2563, 1851, 1896, 1837, 1839, 1836, 1860, 1853, 1856, 1845,
+     1899, 1846, 1854, 1867, 1864, 2563, 1855, 1864, 1867, 1868,
+     1861, 1856, 1860, 1872, 1917, 2563, 1863, 1875, 1920, 1869,
+     1868, 1923, 1876, 1863, 1878, 1883, 1871, 1870, 1877, 1871,
+     1932, 1876, 1890, 1935, 1885, 1879, 2563, 1895, 1939, 2563,
+     1896, 1898, 2563, 1889, 1903, 1899, 1892, 1906, 1889, 1948,
+     1892, 2563, 1892, 1951, 2563, 1908, 1953, 1914, 2563, 1955,
+     1956, 1911, 1910, 1911, 1901, 1909, 1962, 2563, 1923, 1964,
+     2563, 1960, 2563, 1907, 2563, 2563, 1967, 1909, 1925, 1970,
+
+     1927, 2563, 1913, 2563, 1933, 1930, 2563, 1971, 1920, 2563,
+     1919, 1931, 1934, 1927, 1982, 1924, 1926, 1941, 1932, 1943,
+     1928, 2563, 1941, 1990, 1934, 1939, 1993, 1941, 1943, 2563,
+     1938, 1992, 2563, 1939, 1955, 2000, 1956, 2002, 2003, 2563,
+     1947, 2563, 2563, 1951, 1954, 2002, 1958, 1965, 1970, 2006,
+     1959, 1969, 1955, 1973, 1962, 1964, 1973, 2019, 2563, 2563,
+     2025, 2030, 2035, 2040, 2045, 2050, 2055, 2058, 2032, 2037,
+     2039, 2052
     } ;
 
-static const flex_int16_t yy_def[2069] =
+static const flex_int16_t yy_def[2173] =
     {   0,
-     2057, 2057, 2058, 2058, 2057, 2057, 2057, 2057, 2057, 2057,
-     2056, 2056, 2056, 2056, 2056, 2059, 2056, 2056, 2056, 2056,
-     2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056,
-     2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2060,
-     2056, 2056, 2056, 2061,   15, 2056,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 2062,   45,   45,   45,   45,
+     2161, 2161, 2162, 2162, 2161, 2161, 2161, 2161, 2161, 2161,
+     2160, 2160, 2160, 2160, 2160, 2163, 2160, 2160, 2160, 2160,
+     2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160,
+     2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2164,
+     2160, 2160, 2160, 2165,   15, 2160,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 2166,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 2059, 2056, 2056,
-     2056, 2056, 2056, 2056, 2063, 2056, 2056, 2056, 2056, 2056,
-     2056, 2056, 2056, 2056, 2056, 2056, 2060, 2056, 2061, 2056,
+       45,   45,   45,   45,   45,   45,   45,   45, 2163, 2160,
+     2160, 2160, 2160, 2160, 2160, 2167, 2160, 2160, 2160, 2160,
+     2160, 2160, 2160, 2160, 2160, 2160, 2160, 2164, 2160, 2165,
 
-     2056,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 2064,   45, 2062,   45,   45,   45,   45,   45,   45,
+     2160, 2160,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 2168,   45, 2166,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 2063, 2056, 2056,
-     2056, 2056, 2056, 2056, 2056, 2056, 2065,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45, 2064, 2056, 2062,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 2167, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160,
+
+     2169,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 2168, 2160, 2166,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 2056,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 2160,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
@@ -1241,219 +1264,231 @@ static const flex_int16_t yy_def[2069] =
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 2056, 2056, 2056, 2056, 2056,
-     2056, 2056, 2066,   45,   45,   45,   45,   45,   45, 2056,
-       45, 2056,   45, 2062, 2056,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     2056,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2170,
+       45,   45,   45,   45,   45,   45, 2160,   45, 2160,   45,
+     2166, 2160,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 2160,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 2056,   45,   45,   45,   45,   45,   45,
 
+       45,   45, 2160,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 2056,   45,   45,   45,   45,   45,   45,
+       45,   45, 2160,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 2056,   45,   45,   45,   45,   45,   45,
-     2056, 2056, 2056, 2067,   45,   45,   45,   45,   45, 2056,
-       45, 2056,   45, 2062,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 2056,   45,   45,   45,   45,   45,   45,
-       45, 2056,   45,   45,   45,   45,   45,   45, 2056,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 2056,
+       45,   45, 2160,   45,   45,   45,   45,   45,   45,   45,
+     2160, 2160, 2160, 2171,   45,   45,   45,   45,   45, 2160,
+       45, 2160,   45, 2166,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 2160,   45,   45,   45,   45,   45,   45,
+       45, 2160,   45,   45,   45,   45,   45,   45, 2160,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 2160,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 2056,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 2056,   45, 2056,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     2160,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 2160,   45,
+     2160,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     2056,   45, 2056,   45,   45, 2056,   45,   45,   45,   45,
-     2056, 2068,   45,   45,   45, 2056, 2056, 2056,   45,   45,
+       45,   45,   45,   45, 2160,   45, 2160,   45,   45, 2160,
 
-       45,   45, 2056,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 2160, 2172,   45,   45,   45,
+     2160, 2160, 2160,   45,   45,   45,   45, 2160,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 2056,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 2160,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 2056,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 2056,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 2056,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45, 2056,   45,
+       45,   45,   45,   45, 2160,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 2056,   45,   45, 2056,   45,   45,
+
+       45,   45, 2160,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 2160,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 2160,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 2160,   45,   45, 2160,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 2056,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 2160,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 2056,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45,   45, 2056,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 2160,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 2056,
+       45, 2160,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 2056,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 2160,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 2056,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 2160,   45,   45,   45,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     2056, 2056,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 2056, 2056,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 2056,
-     2056,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 2160,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 2160, 2160,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 2160, 2160,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 2160, 2160,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 2056,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 2056,   45,   45,   45,   45,   45,
 
+       45,   45,   45,   45,   45,   45,   45,   45, 2160,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 2056,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     2056,   45,   45,   45,   45,   45,   45, 2056,   45,   45,
+     2160,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 2160,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 2160,
+       45,   45,   45,   45,   45,   45, 2160,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 2056,   45,   45,
-     2056,   45,   45,   45, 2056,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 2056,   45,   45,   45, 2056,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     2160,   45,   45, 2160,   45,   45,   45, 2160,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 2056,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 2160,   45,   45,   45,
+     2160,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     2056,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 2056,
+       45,   45,   45,   45,   45,   45,   45, 2160,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 2160,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 2056,   45,   45,   45,
 
-       45,   45,   45,   45,   45,   45,   45,   45, 2056,   45,
-       45,   45, 2056,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 2160,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 2056,   45,   45,   45,   45,   45,   45,
-       45, 2056,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 2056,   45,   45,   45,   45,   45, 2056,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 2056,   45, 2056,   45, 2056,
+       45,   45,   45,   45,   45,   45,   45, 2160,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 2160,
+       45,   45,   45, 2160,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 2056,   45,   45,   45,
+       45,   45,   45,   45,   45, 2160,   45,   45,   45,   45,
+       45,   45,   45, 2160,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45, 2056,   45,   45,   45,   45,   45,   45,
-     2056,   45, 2056,   45, 2056,   45,   45,   45,   45,   45,
+       45,   45,   45, 2160,   45,   45,   45,   45,   45, 2160,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     2056,   45,   45,   45,   45,   45, 2056, 2056,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 2056,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 2056,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 2056,   45,
-       45,   45,   45,   45,   45,   45,   45, 2056,   45,   45,
+     2160,   45, 2160,   45, 2160,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 2160,   45,   45,   45,   45,
+       45,   45, 2160,   45,   45,   45,   45,   45,   45, 2160,
+       45, 2160,   45, 2160,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 2160,
+       45,   45,   45,   45,   45, 2160, 2160,   45,   45,   45,
 
-       45,   45,   45,   45,   45,   45, 2056,   45,   45,   45,
-     2056, 2056,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 2056,   45,   45,   45,   45,   45,   45,
-       45, 2056,   45,   45, 2056,   45, 2056, 2056,   45,   45,
-       45, 2056,   45,   45, 2056,   45,   45, 2056,   45,   45,
-       45,   45, 2056,   45,   45,   45,   45, 2056,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 2056,   45,   45, 2056,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 2056,   45,
-     2056,   45, 2056,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45, 2056,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 2056,   45,   45, 2056,
-       45,   45,   45,   45, 2056,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 2056,   45,   45,   45, 2056,
-       45,   45,   45, 2056,   45,   45,   45,   45,   45,   45,
+       45,   45, 2160,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 2160,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 2160,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     2160,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     2160,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 2160,   45,   45,   45, 2160, 2160,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     2160,   45,   45,   45,   45,   45,   45,   45, 2160,   45,
+
+       45, 2160,   45, 2160, 2160,   45,   45,   45, 2160,   45,
+       45, 2160,   45,   45, 2160,   45,   45,   45,   45,   45,
+     2160,   45,   45,   45,   45, 2160,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 2056,   45,
+       45,   45, 2160,   45,   45, 2160,   45,   45,   45,   45,
+     2160,   45, 2160,   45,   45,   45,   45,   45,   45, 2160,
+       45, 2160,   45,   45,   45, 2160, 2160,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 2160,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     2160,   45,   45, 2160,   45,   45,   45,   45, 2160,   45,
 
-       45,   45,   45,   45,   45, 2056,   45,   45,   45,   45,
-       45, 2056,   45,   45,   45,   45,   45,   45,   45,   45,
-     2056,   45, 2056, 2056,   45,   45,   45,   45, 2056, 2056,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 2056,
-       45, 2056,   45,   45,   45,   45,   45,   45,   45,   45,
-     2056,   45,   45,   45, 2056,   45,   45,   45, 2056,   45,
-       45,   45, 2056,   45,   45,   45,   45,   45,   45,   45,
-     2056,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 2160,
+       45,   45,   45,   45, 2160,   45,   45,   45, 2160,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 2056, 2056,   45,   45, 2056,   45, 2056,   45,   45,
-
-       45, 2056,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 2056,   45,   45,   45,
-     2056,   45,   45, 2056, 2056,   45,   45,   45,   45,   45,
-       45,   45, 2056,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 2056,   45,   45, 2056,   45, 2056,
-     2056,   45,   45,   45,   45,   45, 2056, 2056,   45, 2056,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     2056,   45,   45,   45, 2056,   45,   45,   45,   45,   45,
-       45,   45,   45, 2056,   45,   45,   45,   45,   45, 2056,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-     2056,   45,   45,   45, 2056,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 2056,   45,   45,   45,   45,
-       45,   45,   45,   45, 2056, 2056,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 2056,   45, 2056,
-       45,   45,   45,   45,   45,   45,   45,   45, 2056,   45,
-       45, 2056,   45,   45,   45,   45,   45,   45, 2056,   45,
-       45,   45,   45,   45,   45,   45,   45, 2056,   45,   45,
-     2056, 2056,   45, 2056,   45, 2056,   45,   45,   45,   45,
-       45, 2056,   45,   45,   45, 2056,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 2056,   45,   45,   45,
-
-       45, 2056, 2056,   45,   45,   45,   45, 2056, 2056,   45,
-       45, 2056,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 2056,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 2160,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 2056,   45,   45, 2056,   45,
-       45, 2056,   45,   45,   45,   45,   45,   45,   45, 2056,
-       45,   45, 2056,   45,   45,   45, 2056,   45,   45,   45,
-       45,   45,   45,   45, 2056,   45,   45, 2056,   45, 2056,
-       45, 2056, 2056,   45,   45,   45,   45,   45,   45, 2056,
-
-       45,   45, 2056,   45,   45, 2056,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 2056,   45,   45,
-       45,   45,   45,   45,   45, 2056,   45,   45, 2056,   45,
-       45,   45,   45,   45,   45, 2056,   45, 2056, 2056,   45,
+       45,   45,   45, 2160,   45,   45,   45,   45,   45, 2160,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 2160,
+
+       45, 2160, 2160,   45,   45,   45,   45, 2160, 2160,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 2160,   45,
+     2160,   45,   45, 2160,   45,   45,   45,   45,   45,   45,
+     2160,   45,   45,   45, 2160,   45,   45,   45,   45,   45,
+     2160,   45,   45,   45, 2160,   45,   45,   45,   45,   45,
+       45,   45, 2160,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 2056,    0, 2056, 2056, 2056, 2056,
-     2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056
+       45,   45,   45, 2160, 2160,   45,   45,   45, 2160,   45,
+     2160,   45,   45,   45, 2160,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 2160,
+
+       45,   45,   45, 2160,   45,   45,   45,   45, 2160, 2160,
+       45,   45,   45,   45,   45,   45,   45, 2160,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 2160,
+       45,   45, 2160,   45, 2160, 2160,   45,   45,   45,   45,
+       45,   45, 2160, 2160,   45, 2160,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 2160,   45,   45,   45,
+     2160,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 2160,   45,   45,   45,   45,   45, 2160,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 2160,   45,
+       45,   45, 2160,   45,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45, 2160,   45,   45,   45,   45,   45,
+       45,   45,   45, 2160, 2160,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 2160,   45,
+     2160,   45,   45,   45,   45,   45,   45,   45,   45, 2160,
+       45,   45,   45, 2160,   45,   45,   45,   45,   45,   45,
+     2160,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 2160,   45,   45, 2160, 2160,   45, 2160,   45, 2160,
+       45,   45,   45,   45,   45, 2160,   45,   45,   45,   45,
+     2160,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 2160,   45,   45,   45,   45,   45,   45, 2160, 2160,
+
+       45,   45,   45,   45, 2160, 2160,   45,   45, 2160,   45,
+     2160,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 2160,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 2160,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 2160,   45,   45, 2160,
+       45,   45, 2160,   45,   45,   45,   45,   45,   45,   45,
+       45, 2160,   45,   45, 2160,   45,   45,   45, 2160,   45,
+       45,   45,   45,   45,   45,   45,   45, 2160,   45,   45,
+     2160,   45, 2160,   45, 2160, 2160,   45,   45,   45,   45,
+
+       45, 2160,   45, 2160,   45,   45, 2160,   45,   45, 2160,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 2160,   45,   45,   45,   45,   45,   45,   45, 2160,
+       45,   45, 2160,   45,   45,   45,   45,   45,   45, 2160,
+       45, 2160, 2160,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 2160,    0,
+     2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160,
+     2160, 2160
     } ;
 
-static const flex_int16_t yy_nxt[2532] =
+static const flex_int16_t yy_nxt[2637] =
     {   0,
-     2056,   13,   14,   13, 2056,   15,   16, 2056,   17,   18,
+     2160,   13,   14,   13, 2160,   15,   16, 2160,   17,   18,
        19,   20,   21,   22,   22,   22,   22,   22,   23,   24,
-       84,  805,   37,   14,   37,   85,   25,   26,   38,  100,
-     2056,   27,   37,   14,   37,   42,   28,   42,   38,   90,
-       91,   29,  202,   30,   13,   14,   13,   89,   90,   25,
-       31,   91,   13,   14,   13,   13,   14,   13,   32,   40,
-      806,   13,   14,   13,   33,   40,  101,   90,   91,  202,
-       89,   34,   35,   13,   14,   13,   93,   15,   16,   94,
+       85,  832,   37,   14,   37,   86,   25,   26,   38,  101,
+     2160,   27,   37,   14,   37,   42,   28,   42,   38,   91,
+       92,   29,  206,   30,   13,   14,   13,   90,   91,   25,
+       31,   92,   13,   14,   13,   13,   14,   13,   32,   40,
+      833,   13,   14,   13,   33,   40,  102,   91,   92,  206,
+       90,   34,   35,   13,   14,   13,   94,   15,   16,   95,
        17,   18,   19,   20,   21,   22,   22,   22,   22,   22,
-       23,   24,   13,   14,   13,   89,   39,  103,   25,   26,
+       23,   24,   13,   14,   13,   90,   39,  104,   25,   26,
 
-       13,   14,   13,   27,   39,   42,  105,   42,   28,   42,
-      106,   42,   41,   29,  107,   30,  110,  111,   92,  137,
-       41,   25,   31,  103,  227,  228,   87,  138,   87,  105,
-       32,   88,   88,   88,   88,   88,   33,  107,  106,  110,
-      233,  111,  234,   34,   35,   44,   44,   44,   45,   45,
+       13,   14,   13,   27,   39,   42,  106,   42,   28,   42,
+      107,   42,   41,   29,  108,   30,  111,  112,   93,  140,
+       41,   25,   31,  104,  231,  232,   88,  141,   88,  106,
+       32,   89,   89,   89,   89,   89,   33,  108,  107,  111,
+      237,  112,  238,   34,   35,   44,   44,   44,   45,   45,
        46,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   47,   45,   45,   45,   45,   45,   48,   45,   45,
        49,   45,   50,   45,   51,   45,   52,   45,   45,   45,
@@ -1461,282 +1496,293 @@ static const flex_int16_t yy_nxt[2532] =
        57,   58,   59,   60,   61,   62,   63,   64,   65,   51,
 
        66,   67,   68,   69,   70,   71,   72,   73,   74,   75,
-       76,   77,   55,   45,   45,   45,   45,   45,   79,  843,
-       80,   80,   80,   80,   80,   79,  105,   82,   82,   82,
-       82,   82,  207,   81,   83,   83,   83,   83,   83,   79,
-       81,   82,   82,   82,   82,   82,  189,   81,  108,  105,
-      103,  119,  186,  131,   81,  207,   81,  190,  109,  120,
-      134,  135,  121,   81,  132,  122,  191,  123,  136,  124,
-       81,  108,  189,  204,  133,  167,  115,   81,   45,  168,
-      139,  187,  116,  190,   45,  117,  109,   45,  236,   45,
-      140,   45,  141,   45,  191,  113,  245,  246,   45,   45,
-
-      204,   45,   45,  418,  237,  189,  419,   45,   45,   45,
+       76,   77,   78,   45,   45,   45,   45,   45,   80,  852,
+       81,   81,   81,   81,   81,   80,  193,   83,   83,   83,
+       83,   83,  106,   82,   84,   84,   84,   84,   84,   80,
+       82,   83,   83,   83,   83,   83,  194,   82,  109,  853,
+      104,  120,  193,  132,   82,  106,   82,  170,  110,  121,
+      195,  171,  122,   82,  133,  123,  135,  124,  137,  125,
+       82,  109,  194,  136,  134,  138,  116,   82,   45,  112,
+      142,  139,  117,  308,   45,  118,  110,   45,  195,   45,
+      143,   45,  144,   45,  854,  114,  191,  309,   45,   45,
+
+      220,   45,   45,  112,  221,  193,  189,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-      125,  192,   45,  126,  127,  844,   45,  128,  129,  143,
-       45,  148,  162,  144,  145,  149,  163,  146,   45,  150,
-      130,  107,   45,  147,   45,  114,  164,  293,  294,  165,
-      110,  151,  169,  157,  318,  152,  170,  845,  190,  171,
-      153,  158,  154,  159,  155,  191,  172,  173,  160,  161,
-      174,  175,  176,  183,  156,  177,  178,  318,   83,   83,
-       83,   83,   83,  184,  193,  108,  201,  846,  185,  199,
-
-      203,   81,  100,  194,   79,  109,   80,   80,   80,   80,
-       80,   79,  847,   82,   82,   82,   82,   82,  179,   81,
-      180,  206,  201,  181,   81,   99,   81,  199,  203,   87,
-      848,   87,   99,  109,   88,   88,   88,   88,   88,  101,
-      182,  205,   81,   83,   83,   83,   83,   83,  206,   81,
-       88,   88,   88,   88,   88,  199,   81,   88,   88,   88,
-       88,   88,   99,  216,  220,  266,   99,  217,  240,  205,
-       99,  241,  211,  221,  222,  242,  254,  255,   99,   81,
-      203,  256,   99,  212,   99,  197,  210,  210,  210,  210,
-      210,  317,  302,  318,  849,  210,  210,  210,  210,  210,
-
-      210,  281,  284,  317,  204,  282,  303,  316,  203,  271,
-      263,  267,  335,  206,  316,  327,  321,  317,  210,  210,
-      210,  210,  210,  210,  272,  273,  274,  276,  295,  320,
-      277,  307,  296,  278,  279,  316,  297,  285,  286,  287,
-      311,  325,  319,  327,  328,  329,  331,  333,  288,  325,
-      289,  446,  290,  291,  428,  292,  398,  330,  451,  448,
-      383,  850,  440,  455,  325,  457,  336,  429,  329,  331,
-      449,  328,  337,  456,  333,  334,  334,  334,  334,  334,
-      545,  451,  347,  479,  334,  334,  334,  334,  334,  334,
-      348,  451,  399,  461,  457,  349,  350,  459,  457,  486,
-
-      480,  579,  595,  447,  580,  487,  400,  334,  334,  334,
-      334,  334,  334,  384,  452,  851,  385,  778,  779,  528,
-      459,  461,  464,  464,  464,  464,  464,  466,  516,  529,
-      595,  464,  464,  464,  464,  464,  464,  500,  546,  556,
-      595,  852,  501,  557,  517,  518,  519,  561,  586,  520,
-      599,  562,  600,  587,  464,  464,  464,  464,  464,  464,
-      634,  617,  729,  624,  657,  635,  730,  740,  602,  618,
-      728,  619,  620,  621,  658,  732,  625,  599,  626,  600,
-      840,  853,  854,  855,  857,  858,  859,  860,  861,  729,
-      502,  841,  856,  862,  730,  503,   45,   45,   45,   45,
-
-       45,  863,  866,  870,  871,   45,   45,   45,   45,   45,
-       45,  855,  864,  867,  868,  856,  869,  872,  865,  873,
-      874,  875,  741,  876,  877,  878,  879,  880,   45,   45,
-       45,   45,   45,   45,  881,  882,  883,  884,  885,  886,
-      887,  888,  889,  892,  893,  894,  890,  895,  896,  897,
-      891,  898,  899,  900,  901,  902,  903,  904,  905,  906,
-      907,  908,  909,  910,  911,  912,  913,  914,  915,  916,
-      917,  919,  920,  918,  921,  922,  923,  924,  925,  926,
-      927,  928,  929,  930,  931,  932,  933,  934,  935,  936,
-      937,  938,  939,  940,  941,  942,  943,  944,  945,  946,
-
-      947,  948,  949,  950,  951,  952,  953,  954,  955,  956,
-      957,  958,  959,  960,  962,  963,  964,  967,  968,  969,
-      961,  971,  972,  965,  973,  970,  974,  966,  975,  976,
-      977,  978,  979,  980,  981,  982,  983,  984,  985,  986,
-      987,  988,  989,  990,  991,  992,  993,  994,  995,  996,
-      997,  998,  999, 1000, 1001, 1002, 1003, 1004, 1005, 1006,
-     1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016,
-      989, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025,
-     1026, 1027, 1028, 1029, 1030, 1031, 1033, 1034, 1035, 1036,
-     1032, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045,
-
-     1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055,
-     1056, 1057, 1058, 1059, 1060, 1062, 1063, 1064, 1061, 1065,
-     1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075,
-     1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085,
-     1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095,
-     1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105,
-     1106, 1107, 1108, 1109, 1110, 1112, 1113, 1111, 1114, 1115,
-     1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125,
-     1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135,
-     1136, 1137, 1138, 1116, 1139, 1140, 1115, 1141, 1142, 1143,
-
-     1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153,
-     1154, 1155, 1156, 1157, 1158, 1159, 1160, 1162, 1163, 1164,
+      126,  196,   45,  127,  128,  190,   45,  129,  130,  146,
+       45,  151,  165,  147,  148,  152,  166,  149,   45,  153,
+      131,  108,   45,  150,   45,  115,  167,  251,  252,  168,
+      111,  154,  172,  160,  211,  155,  173,  855,  194,  174,
+      156,  161,  157,  162,  158,  195,  175,  176,  163,  164,
+      177,  178,  179,  186,  159,  180,  181,  211,   84,   84,
+       84,   84,   84,  187,  197,  109,  205,  856,  188,  203,
+
+      207,   82,  101,  198,   80,  110,   81,   81,   81,   81,
+       81,   80,  760,   83,   83,   83,   83,   83,  182,   82,
+      183,  208,  205,  184,   82,  100,   82,  203,  207,   88,
+      272,   88,  100,  110,   89,   89,   89,   89,   89,  102,
+      185,  209,   82,   84,   84,   84,   84,   84,  208,   82,
+       89,   89,   89,   89,   89,  203,   82,   89,   89,   89,
+       89,   89,  100,  210,  224,  240,  100,  761,  246,  209,
+      100,  247,  215,  225,  226,  248,  273,  457,  100,   82,
+      207,  241,  100,  216,  100,  201,  299,  300,  458,  323,
+      210,  214,  214,  214,  214,  214,  290,  277,  857,  342,
+
+      214,  214,  214,  214,  214,  214,  260,  261,  207,  208,
+      269,  262,  278,  279,  280,  282,  287,  323,  283,  324,
+      288,  284,  285,  214,  214,  214,  214,  214,  214,  210,
+      301,  291,  292,  293,  302,  325,  313,  323,  303,  325,
+      324,  332,  294,  334,  295,  324,  296,  297,  335,  298,
+      336,  338,  340,  343,  332,  354,  317,  427,  325,  407,
+      428,  858,  328,  355,  332,  326,  327,  392,  356,  357,
+      455,  334,  437,  336,  338,  335,  461,  344,  465,  340,
+      341,  341,  341,  341,  341,  438,  489,  461,  466,  341,
+      341,  341,  341,  341,  341,  408,  337,  467,  469,  461,
+
+      471,  449,  496,  490,  593,  467,  859,  594,  497,  409,
+      462,  559,  341,  341,  341,  341,  341,  341,  860,  512,
+      393,  469,  456,  394,  513,  523,  467,  861,  471,  474,
+      474,  474,  474,  474,  476,  524,  525,  530,  474,  474,
+      474,  474,  474,  474,  570,  575,  542,  600,  571,  576,
+      610,  610,  601,  531,  532,  533,  543,  614,  534,  615,
+      639,  474,  474,  474,  474,  474,  474,  785,  749,  560,
+      676,  649,  514,  640,  786,  641,  650,  515,  610,  617,
+      677,  750,  862,  863,  614,  864,  615,   45,   45,   45,
+       45,   45,  865,  866,  632,  749,   45,   45,   45,   45,
+
+       45,   45,  633,  748,  634,  635,  636,  867,  752,  750,
+      801,  802,  803,  869,  870,  871,  872,  873,  868,   45,
+       45,   45,   45,   45,   45,  874,  804,  875,  876,  877,
+      878,  879,  880,  881,  882,  883,  884,  885,  886,  887,
+      888,  889,  890,  891,  892,  894,  895,  896,  898,  897,
+      893,  899,  900,  901,  902,  903,  904,  905,  906,  884,
+      907,  908,  909,  883,  910,  911,  912,  913,  914,  915,
+      916,  917,  920,  921,  922,  918,  923,  924,  925,  919,
+      926,  927,  928,  929,  930,  931,  932,  933,  934,  935,
+      936,  937,  938,  939,  940,  941,  942,  943,  944,  945,
+
+      946,  947,  948,  949,  950,  951,  952,  954,  955,  953,
+      956,  957,  958,  959,  960,  961,  962,  963,  964,  965,
+      966,  967,  968,  969,  970,  971,  972,  973,  974,  975,
+      976,  977,  978,  979,  980,  981,  982,  983,  984,  985,
+      986,  987,  988,  989,  990,  991,  992,  993,  994,  995,
+      997,  998,  999, 1002, 1003, 1004,  996, 1006, 1007, 1000,
+     1008, 1005, 1009, 1001, 1010, 1011, 1012, 1013, 1014, 1015,
+     1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025,
+     1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035,
+     1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045,
+
+     1046, 1047, 1048, 1049, 1050, 1051, 1052, 1025, 1053, 1054,
+     1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064,
+     1065, 1066, 1067, 1068, 1069, 1070, 1072, 1073, 1074, 1075,
+     1071, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084,
+     1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094,
+     1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1105,
+     1106, 1107, 1104, 1108, 1109, 1110, 1111, 1112, 1113, 1114,
+     1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124,
+     1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134,
+     1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144,
+
+     1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1155,
+     1156, 1154, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164,
      1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174,
-     1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184,
-     1185, 1186, 1187, 1188, 1189, 1191, 1192, 1193, 1194, 1195,
-     1196, 1197, 1198, 1199, 1200, 1190, 1201, 1202, 1203, 1204,
-     1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214,
-     1215, 1216, 1217, 1218, 1161, 1219, 1220, 1221, 1222, 1223,
+     1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1160, 1183,
+     1184, 1159, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192,
+     1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202,
+     1203, 1204, 1205, 1206, 1207, 1209, 1210, 1211, 1212, 1213,
+     1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223,
      1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233,
-     1234, 1235, 1237, 1236, 1238, 1239, 1240, 1241, 1242, 1243,
+     1234, 1235, 1236, 1237, 1238, 1239, 1240, 1242, 1243, 1244,
 
-     1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253,
-     1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1235,
-     1236, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271,
-     1272, 1273, 1274, 1275, 1276, 1277, 1278, 1280, 1282, 1283,
-     1284, 1279, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292,
+     1245, 1246, 1247, 1248, 1249, 1250, 1251, 1241, 1252, 1253,
+     1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263,
+     1264, 1265, 1208, 1266, 1267, 1268, 1269, 1270, 1271, 1272,
+     1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282,
+     1283, 1284, 1285, 1286, 1287, 1289, 1288, 1290, 1291, 1292,
      1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302,
      1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312,
-     1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322,
-     1323, 1281, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331,
-     1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341,
+     1313, 1314, 1287, 1288, 1315, 1316, 1317, 1318, 1319, 1320,
+     1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330,
+     1331, 1332, 1333, 1335, 1337, 1338, 1339, 1334, 1340, 1341,
 
      1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351,
      1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361,
      1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371,
-     1372, 1350, 1373, 1374, 1375, 1376, 1377, 1351, 1378, 1379,
-     1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389,
-     1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399,
-     1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409,
-     1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419,
-     1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 1430,
-     1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440,
-
-     1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450,
-     1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1460, 1461,
-     1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471,
-     1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480, 1452,
-     1481, 1429, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489,
-     1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1500,
-     1501, 1459, 1502, 1503, 1504, 1505, 1499, 1506, 1507, 1508,
-     1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518,
-     1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528,
-     1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538,
-
-     1539, 1540, 1542, 1543, 1544, 1545, 1541, 1546, 1547, 1548,
+     1372, 1373, 1374, 1375, 1376, 1377, 1378, 1336, 1379, 1380,
+     1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390,
+     1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400,
+     1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410,
+     1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420,
+     1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430,
+     1431, 1432, 1410, 1433, 1434, 1435, 1436, 1437, 1411, 1438,
+
+     1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448,
+     1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458,
+     1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468,
+     1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478,
+     1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488,
+     1489, 1490, 1491, 1492, 1493, 1494, 1495, 1497, 1498, 1499,
+     1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509,
+     1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519,
+     1520, 1521, 1522, 1523, 1524, 1525, 1526, 1528, 1529, 1530,
+     1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540,
+
+     1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1520, 1496,
      1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558,
-     1559, 1560, 1561, 1562, 1563, 1542, 1564, 1565, 1566, 1567,
-     1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577,
-     1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587,
+     1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568,
+     1527, 1569, 1570, 1571, 1572, 1574, 1575, 1576, 1577, 1578,
+     1579, 1580, 1573, 1581, 1582, 1583, 1584, 1585, 1586, 1587,
      1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597,
      1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607,
-     1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617,
-     1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626, 1627,
-     1628, 1629, 1630, 1631, 1632, 1634, 1635, 1636, 1637, 1638,
-
-     1639, 1640, 1641, 1642, 1643, 1633, 1644, 1645, 1619, 1646,
-     1647, 1648, 1649, 1650, 1651, 1653, 1654, 1655, 1656, 1657,
-     1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667,
-     1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677,
-     1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686, 1687,
-     1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697,
-     1698, 1700, 1701, 1702, 1703, 1704, 1705, 1706, 1707, 1708,
-     1709, 1710, 1652, 1711, 1712, 1713, 1714, 1715, 1716, 1717,
-     1718, 1719, 1720, 1721, 1722, 1695, 1723, 1724, 1725, 1726,
-     1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736,
+     1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1617, 1618,
+     1619, 1620, 1616, 1621, 1622, 1623, 1624, 1625, 1626, 1627,
+     1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637,
+
+     1638, 1617, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646,
+     1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656,
+     1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666,
+     1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676,
+     1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686,
+     1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696,
+     1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706,
+     1707, 1708, 1709, 1710, 1711, 1713, 1714, 1715, 1716, 1717,
+     1718, 1719, 1720, 1721, 1722, 1712, 1723, 1724, 1698, 1725,
+     1726, 1727, 1728, 1729, 1730, 1731, 1733, 1734, 1735, 1736,
 
      1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746,
-     1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1699, 1755,
-     1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765,
-     1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775,
-     1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785,
-     1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795,
-     1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805,
+     1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756,
+     1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766,
+     1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776,
+     1777, 1778, 1779, 1780, 1781, 1783, 1784, 1785, 1786, 1787,
+     1788, 1789, 1790, 1732, 1791, 1792, 1793, 1794, 1795, 1796,
+     1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1778,
      1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815,
      1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825,
      1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835,
 
-     1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845,
-     1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855,
-     1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865,
-     1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875,
-     1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885,
-     1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895,
-     1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905,
-     1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915,
-     1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924, 1925,
-     1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935,
-
-     1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945,
-     1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955,
-     1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965,
-     1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975,
-     1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985,
-     1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995,
-     1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005,
-     2006, 2007, 2008, 2009, 2011, 2010, 2012, 2013, 2014, 2015,
-     2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025,
-     2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034, 2035,
-
-     2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045,
-     2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055,
-       12,   12,   12,   12,   12,   36,   36,   36,   36,   36,
-       78,  323,   78,   78,   78,   97,  454,   97,  592,   97,
-       99,   99,   99,   99,   99,  112,  112,  112,  112,  112,
-      188,   99,  188,  188,  188,  208,  208,  208,  842,  839,
-      838,  837,  836,  835,  834,  833,  832,  831,  830,  829,
-      828,  827,  826,  825,  824,  823,  822,  821,  820,  819,
-      818,  817,  816,  815,  814,  813,  812,  811,  810,  809,
-      808,  807,  804,  803,  802,  801,  800,  799,  798,  797,
-
-      796,  795,  794,  793,  792,  791,  790,  789,  788,  787,
-      786,  785,  784,  783,  782,  781,  780,  777,  776,  775,
-      774,  773,  772,  771,  770,  769,  768,  767,  766,  765,
-      764,  763,  762,  761,  760,  759,  758,  757,  756,  755,
-      754,  753,  752,  751,  750,  749,  748,  747,  746,  745,
-      744,  743,  742,  739,  738,  737,  736,  735,  734,  733,
-      731,  728,  727,  726,  725,  724,  723,  722,  721,  720,
-      719,  718,  717,  716,  715,  714,  713,  712,  711,  710,
-      709,  708,  707,  706,  705,  704,  703,  702,  701,  700,
-      699,  698,  697,  696,  695,  694,  693,  692,  691,  690,
-
-      689,  688,  687,  686,  685,  684,  683,  682,  681,  680,
-      679,  678,  677,  676,  675,  674,  673,  672,  671,  670,
+     1836, 1837, 1782, 1838, 1839, 1840, 1841, 1842, 1843, 1844,
+     1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854,
+     1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864,
+     1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874,
+     1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884,
+     1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894,
+     1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904,
+     1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914,
+     1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924,
+     1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934,
+
+     1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944,
+     1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954,
+     1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964,
+     1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974,
+     1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984,
+     1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994,
+     1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004,
+     2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014,
+     2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024,
+     2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034,
+
+     2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044,
+     2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054,
+     2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064,
+     2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074,
+     2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084,
+     2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094,
+     2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104,
+     2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2115,
+     2114, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124,
+     2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134,
+
+     2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144,
+     2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154,
+     2155, 2156, 2157, 2158, 2159,   12,   12,   12,   12,   12,
+       36,   36,   36,   36,   36,   79,  330,   79,   79,   79,
+       98,  464,   98,  607,   98,  100,  100,  100,  100,  100,
+      113,  113,  113,  113,  113,  192,  100,  192,  192,  192,
+      212,  212,  212,  851,  850,  849,  848,  847,  846,  845,
+      844,  843,  842,  841,  840,  839,  838,  837,  836,  835,
+      834,  831,  830,  829,  828,  827,  826,  825,  824,  823,
+      822,  821,  820,  819,  818,  817,  816,  815,  814,  813,
+
+      812,  811,  810,  809,  808,  807,  806,  805,  800,  799,
+      798,  797,  796,  795,  794,  793,  792,  791,  790,  789,
+      788,  787,  784,  783,  782,  781,  780,  779,  778,  777,
+      776,  775,  774,  773,  772,  771,  770,  769,  768,  767,
+      766,  765,  764,  763,  762,  759,  758,  757,  756,  755,
+      754,  753,  751,  748,  747,  746,  745,  744,  743,  742,
+      741,  740,  739,  738,  737,  736,  735,  734,  733,  732,
+      731,  730,  729,  728,  727,  726,  725,  724,  723,  722,
+      721,  720,  719,  718,  717,  716,  715,  714,  713,  712,
+      711,  710,  709,  708,  707,  706,  705,  704,  703,  702,
+
+      701,  700,  699,  698,  697,  696,  695,  694,  693,  692,
+      691,  690,  689,  688,  687,  686,  685,  684,  683,  682,
+      681,  680,  679,  678,  675,  674,  673,  672,  671,  670,
       669,  668,  667,  666,  665,  664,  663,  662,  661,  660,
-      659,  656,  655,  654,  653,  652,  651,  650,  649,  648,
-      647,  646,  645,  644,  643,  642,  641,  640,  639,  638,
-      637,  636,  633,  632,  631,  630,  629,  628,  627,  623,
-      622,  616,  615,  614,  613,  612,  611,  610,  609,  608,
-      607,  606,  605,  604,  603,  601,  598,  597,  596,  594,
-      593,  591,  590,  589,  588,  585,  584,  583,  582,  581,
-      578,  577,  576,  575,  574,  573,  572,  571,  570,  569,
-
-      568,  567,  566,  565,  564,  563,  560,  559,  558,  555,
-      554,  553,  552,  551,  550,  549,  548,  547,  544,  543,
-      542,  541,  540,  539,  538,  537,  536,  535,  534,  533,
-      532,  531,  530,  527,  526,  525,  524,  523,  522,  521,
-      515,  514,  513,  512,  511,  510,  509,  508,  507,  506,
-      505,  504,  499,  498,  497,  496,  495,  494,  493,  492,
-      491,  490,  489,  488,  485,  484,  483,  482,  481,  478,
-      477,  476,  475,  474,  473,  472,  471,  470,  469,  468,
-      467,  465,  463,  462,  460,  458,  453,  450,  445,  444,
-      443,  442,  441,  439,  438,  437,  436,  435,  434,  433,
-
-      432,  431,  430,  427,  426,  425,  424,  423,  422,  421,
-      420,  417,  416,  415,  414,  413,  412,  411,  410,  409,
-      408,  407,  406,  405,  404,  403,  402,  401,  397,  396,
-      395,  394,  393,  392,  391,  390,  389,  388,  387,  386,
-      382,  381,  380,  379,  378,  377,  376,  375,  374,  373,
-      372,  371,  370,  369,  368,  367,  366,  365,  364,  363,
-      362,  361,  360,  359,  358,  357,  356,  355,  354,  353,
-      352,  351,  346,  345,  344,  343,  342,  341,  340,  339,
-      338,  209,  332,  330,  326,  324,  322,  315,  314,  313,
-      312,  310,  309,  308,  306,  305,  304,  301,  300,  299,
-
-      298,  283,  280,  275,  270,  269,  268,  265,  264,  262,
-      261,  260,  259,  258,  257,  253,  252,  251,  250,  249,
-      248,  247,  244,  243,  239,  238,  235,  232,  231,  230,
-      229,  226,  225,  224,  223,  219,  218,  215,  214,  213,
-      209,  200,  198,  196,  195,  166,  142,  118,  104,  102,
-       43,   98,   96,   95,   86,   43, 2056,   11, 2056, 2056,
-     2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056,
-     2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056,
-     2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056,
-     2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056,
-
-     2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056,
-     2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056,
-     2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056,
-     2056
+      659,  658,  657,  656,  655,  654,  653,  652,  651,  648,
+      647,  646,  645,  644,  643,  642,  638,  637,  631,  630,
+      629,  628,  627,  626,  625,  624,  623,  622,  621,  620,
+      619,  618,  616,  613,  612,  611,  609,  608,  606,  605,
+      604,  603,  602,  599,  598,  597,  596,  595,  592,  591,
+      590,  589,  588,  587,  586,  585,  584,  583,  582,  581,
+
+      580,  579,  578,  577,  574,  573,  572,  569,  568,  567,
+      566,  565,  564,  563,  562,  561,  558,  557,  556,  555,
+      554,  553,  552,  551,  550,  549,  548,  547,  546,  545,
+      544,  541,  540,  539,  538,  537,  536,  535,  529,  528,
+      527,  526,  522,  521,  520,  519,  518,  517,  516,  511,
+      510,  509,  508,  507,  506,  505,  504,  503,  502,  501,
+      500,  499,  498,  495,  494,  493,  492,  491,  488,  487,
+      486,  485,  484,  483,  482,  481,  480,  479,  478,  477,
+      475,  473,  472,  470,  468,  463,  460,  459,  454,  453,
+      452,  451,  450,  448,  447,  446,  445,  444,  443,  442,
+
+      441,  440,  439,  436,  435,  434,  433,  432,  431,  430,
+      429,  426,  425,  424,  423,  422,  421,  420,  419,  418,
+      417,  416,  415,  414,  413,  412,  411,  410,  406,  405,
+      404,  403,  402,  401,  400,  399,  398,  397,  396,  395,
+      391,  390,  389,  388,  387,  386,  385,  384,  383,  382,
+      381,  380,  379,  378,  377,  376,  375,  374,  373,  372,
+      371,  370,  369,  368,  367,  366,  365,  364,  363,  362,
+      361,  360,  359,  358,  353,  352,  351,  350,  349,  348,
+      347,  346,  345,  213,  339,  337,  333,  331,  329,  322,
+      321,  320,  319,  318,  316,  315,  314,  312,  311,  310,
+
+      307,  306,  305,  304,  289,  286,  281,  276,  275,  274,
+      271,  270,  268,  267,  266,  265,  264,  263,  259,  258,
+      257,  256,  255,  254,  253,  250,  249,  245,  244,  243,
+      242,  239,  236,  235,  234,  233,  230,  229,  228,  227,
+      223,  222,  219,  218,  217,  213,  204,  202,  200,  199,
+      169,  145,  119,  105,  103,   43,   99,   97,   96,   87,
+       43, 2160,   11, 2160, 2160, 2160, 2160, 2160, 2160, 2160,
+     2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160,
+     2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160,
+     2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160,
+
+     2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160,
+     2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160,
+     2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160,
+     2160, 2160, 2160, 2160, 2160, 2160
     } ;
 
-static const flex_int16_t yy_chk[2532] =
+static const flex_int16_t yy_chk[2637] =
     {   0,
         0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-       21,  676,    3,    3,    3,   21,    1,    1,    3,   44,
+       21,  695,    3,    3,    3,   21,    1,    1,    3,   44,
         0,    1,    4,    4,    4,   13,    1,   13,    4,   27,
-       28,    1,  106,    1,    5,    5,    5,   26,   32,    1,
+       28,    1,  107,    1,    5,    5,    5,   26,   32,    1,
         1,   33,    6,    6,    6,    7,    7,    7,    1,    7,
-      676,    8,    8,    8,    1,    8,   44,   27,   28,  106,
+      695,    8,    8,    8,    1,    8,   44,   27,   28,  107,
        26,    1,    1,    2,    2,    2,   32,    2,    2,   33,
         2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
         2,    2,    9,    9,    9,   31,    5,   48,    2,    2,
 
        10,   10,   10,    2,    6,   37,   50,   37,    2,   42,
        51,   42,    9,    2,   52,    2,   54,   55,   31,   64,
-       10,    2,    2,   48,  127,  127,   25,   64,   25,   50,
+       10,    2,    2,   48,  128,  128,   25,   64,   25,   50,
         2,   25,   25,   25,   25,   25,    2,   52,   51,   54,
-      132,   55,  132,    2,    2,   15,   15,   15,   15,   15,
+      133,   55,  133,    2,    2,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
@@ -1744,262 +1790,273 @@ static const flex_int16_t yy_chk[2532] =
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
 
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   17,  715,
-       17,   17,   17,   17,   17,   19,   62,   19,   19,   19,
-       19,   19,  111,   17,   20,   20,   20,   20,   20,   22,
-       19,   22,   22,   22,   22,   22,   89,   20,   53,   62,
-       57,   59,   77,   61,   22,  111,   17,   90,   53,   59,
-       62,   63,   59,   19,   61,   59,   91,   59,   63,   59,
-       20,   53,   89,  108,   61,   73,   57,   22,   45,   73,
-       65,   77,   57,   90,   45,   57,   53,   45,  134,   45,
-       65,   45,   65,   45,   91,   56,  140,  140,   45,   45,
-
-      108,   45,   56,  287,  134,   92,  287,   45,   45,   45,
+       15,   15,   15,   15,   15,   15,   15,   15,   17,  716,
+       17,   17,   17,   17,   17,   19,   90,   19,   19,   19,
+       19,   19,   62,   17,   20,   20,   20,   20,   20,   22,
+       19,   22,   22,   22,   22,   22,   91,   20,   53,  717,
+       57,   59,   90,   61,   22,   62,   17,   73,   53,   59,
+       92,   73,   59,   19,   61,   59,   62,   59,   63,   59,
+       20,   53,   91,   62,   61,   63,   57,   22,   45,   78,
+       65,   63,   57,  178,   45,   57,   53,   45,   92,   45,
+       65,   45,   65,   45,  718,   56,   78,  178,   45,   45,
+
+      120,   45,   56,   78,  120,   93,   77,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       60,   92,   56,   60,   60,  716,   56,   60,   60,   67,
+       60,   93,   56,   60,   60,   77,   56,   60,   60,   67,
        56,   68,   71,   67,   67,   68,   71,   67,   56,   68,
-       60,   69,   56,   67,   56,   56,   71,  169,  169,   71,
-       76,   68,   74,   70,  191,   68,   74,  717,   93,   74,
-       69,   70,   69,   70,   69,   94,   74,   74,   70,   70,
-       74,   74,   74,   76,   69,   75,   75,  191,   79,   79,
-       79,   79,   79,   76,   93,   75,  105,  718,   76,  103,
-
-      107,   79,   99,   94,   80,   75,   80,   80,   80,   80,
-       80,   82,  719,   82,   82,   82,   82,   82,   75,   80,
-       75,  110,  105,   75,   79,  101,   82,  103,  107,   81,
-      720,   81,  101,   75,   81,   81,   81,   81,   81,   99,
-       75,  109,   80,   83,   83,   83,   83,   83,  110,   82,
-       87,   87,   87,   87,   87,  115,   83,   88,   88,   88,
-       88,   88,  101,  119,  122,  158,  101,  119,  137,  109,
-      101,  137,  115,  122,  122,  137,  148,  148,  101,   83,
-      155,  148,  101,  115,  101,  101,  114,  114,  114,  114,
-      114,  190,  175,  194,  721,  114,  114,  114,  114,  114,
-
-      114,  166,  168,  193,  179,  166,  175,  189,  155,  162,
-      155,  158,  211,  183,  192,  201,  194,  190,  114,  114,
-      114,  114,  114,  114,  162,  162,  162,  164,  170,  193,
-      164,  179,  170,  164,  164,  189,  170,  168,  168,  168,
-      183,  199,  192,  201,  202,  203,  205,  207,  168,  212,
-      168,  313,  168,  168,  296,  168,  269,  307,  316,  314,
-      256,  722,  307,  324,  199,  325,  211,  296,  203,  205,
-      314,  202,  212,  324,  207,  210,  210,  210,  210,  210,
-      408,  316,  222,  350,  210,  210,  210,  210,  210,  210,
-      222,  319,  269,  329,  325,  222,  222,  327,  337,  357,
-
-      350,  440,  457,  313,  440,  357,  269,  210,  210,  210,
-      210,  210,  210,  256,  319,  723,  256,  649,  649,  391,
-      327,  329,  334,  334,  334,  334,  334,  337,  383,  391,
-      457,  334,  334,  334,  334,  334,  334,  370,  408,  419,
-      466,  724,  370,  419,  383,  383,  383,  423,  447,  383,
-      463,  423,  463,  447,  334,  334,  334,  334,  334,  334,
-      495,  483,  599,  486,  518,  495,  600,  611,  466,  483,
-      602,  483,  483,  483,  518,  602,  486,  463,  486,  463,
-      713,  726,  727,  729,  731,  732,  733,  734,  735,  599,
-      370,  713,  730,  736,  600,  370,  464,  464,  464,  464,
-
-      464,  737,  739,  741,  742,  464,  464,  464,  464,  464,
-      464,  729,  738,  740,  740,  730,  740,  743,  738,  744,
-      745,  746,  611,  747,  748,  749,  750,  751,  464,  464,
-      464,  464,  464,  464,  752,  753,  754,  755,  756,  757,
-      758,  759,  760,  761,  762,  763,  760,  764,  765,  767,
-      760,  768,  769,  770,  771,  772,  773,  774,  775,  776,
-      777,  778,  779,  780,  781,  782,  783,  784,  785,  786,
-      787,  788,  789,  787,  790,  791,  793,  794,  795,  796,
-      797,  798,  799,  800,  801,  802,  803,  804,  806,  807,
-      808,  809,  810,  811,  812,  813,  814,  815,  816,  817,
-
-      818,  819,  820,  821,  822,  823,  824,  825,  826,  827,
-      828,  829,  830,  831,  832,  833,  833,  834,  835,  836,
-      831,  837,  838,  833,  839,  836,  841,  833,  842,  843,
-      844,  845,  846,  847,  848,  849,  850,  851,  852,  853,
-      854,  855,  856,  857,  858,  859,  860,  861,  862,  863,
-      864,  865,  867,  868,  869,  870,  871,  872,  873,  874,
+       60,   69,   56,   67,   56,   56,   71,  143,  143,   71,
+       76,   68,   74,   70,  112,   68,   74,  719,   94,   74,
+       69,   70,   69,   70,   69,   95,   74,   74,   70,   70,
+       74,   74,   74,   76,   69,   75,   75,  112,   80,   80,
+       80,   80,   80,   76,   94,   75,  106,  720,   76,  104,
+
+      108,   80,  100,   95,   81,   75,   81,   81,   81,   81,
+       81,   83,  626,   83,   83,   83,   83,   83,   75,   81,
+       75,  109,  106,   75,   80,  102,   83,  104,  108,   82,
+      161,   82,  102,   75,   82,   82,   82,   82,   82,  100,
+       75,  110,   81,   84,   84,   84,   84,   84,  109,   83,
+       88,   88,   88,   88,   88,  116,   84,   89,   89,   89,
+       89,   89,  102,  111,  123,  135,  102,  626,  140,  110,
+      102,  140,  116,  123,  123,  140,  161,  320,  102,   84,
+      158,  135,  102,  116,  102,  102,  172,  172,  320,  193,
+      111,  115,  115,  115,  115,  115,  171,  165,  721,  215,
+
+      115,  115,  115,  115,  115,  115,  151,  151,  158,  182,
+      158,  151,  165,  165,  165,  167,  169,  193,  167,  194,
+      169,  167,  167,  115,  115,  115,  115,  115,  115,  186,
+      173,  171,  171,  171,  173,  195,  182,  196,  173,  198,
+      197,  203,  171,  205,  171,  194,  171,  171,  206,  171,
+      207,  209,  211,  215,  216,  226,  186,  293,  195,  275,
+      293,  722,  198,  226,  203,  196,  197,  262,  226,  226,
+      319,  205,  302,  207,  209,  206,  323,  216,  331,  211,
+      214,  214,  214,  214,  214,  302,  357,  326,  331,  214,
+      214,  214,  214,  214,  214,  275,  313,  332,  334,  323,
+
+      336,  313,  364,  357,  449,  344,  723,  449,  364,  275,
+      326,  417,  214,  214,  214,  214,  214,  214,  724,  379,
+      262,  334,  319,  262,  379,  387,  332,  725,  336,  341,
+      341,  341,  341,  341,  344,  387,  387,  392,  341,  341,
+      341,  341,  341,  341,  428,  432,  400,  456,  428,  432,
+      467,  476,  456,  392,  392,  392,  400,  473,  392,  473,
+      496,  341,  341,  341,  341,  341,  341,  651,  614,  417,
+      532,  505,  379,  496,  651,  496,  505,  379,  467,  476,
+      532,  615,  726,  727,  473,  729,  473,  474,  474,  474,
+      474,  474,  730,  731,  493,  614,  474,  474,  474,  474,
+
+      474,  474,  493,  617,  493,  493,  493,  732,  617,  615,
+      666,  666,  666,  733,  734,  735,  736,  737,  732,  474,
+      474,  474,  474,  474,  474,  738,  666,  739,  740,  741,
+      742,  743,  744,  746,  747,  749,  750,  751,  752,  753,
+      754,  755,  756,  757,  758,  759,  760,  760,  761,  760,
+      758,  762,  763,  764,  765,  766,  767,  768,  769,  750,
+      770,  771,  772,  749,  773,  774,  775,  776,  777,  778,
+      779,  780,  781,  782,  783,  780,  784,  785,  786,  780,
+      787,  789,  790,  791,  792,  793,  794,  795,  796,  797,
+      798,  799,  800,  801,  802,  803,  804,  805,  806,  807,
+
+      808,  809,  810,  811,  812,  813,  814,  815,  816,  814,
+      817,  818,  820,  821,  822,  823,  824,  825,  826,  827,
+      828,  829,  830,  831,  833,  834,  835,  836,  837,  838,
+      839,  840,  841,  842,  843,  844,  845,  846,  847,  848,
+      849,  850,  851,  852,  853,  854,  855,  856,  857,  858,
+      859,  860,  860,  861,  862,  863,  858,  864,  865,  860,
+      866,  863,  868,  860,  869,  870,  871,  872,  873,  874,
       875,  876,  877,  878,  879,  880,  881,  882,  883,  884,
-      856,  885,  886,  887,  888,  889,  890,  891,  892,  893,
-      895,  896,  897,  898,  899,  900,  901,  902,  903,  904,
-      900,  905,  906,  907,  908,  909,  910,  913,  914,  915,
-
-      916,  917,  918,  919,  920,  921,  924,  925,  926,  927,
-      928,  929,  930,  931,  932,  933,  934,  935,  932,  936,
-      937,  938,  939,  942,  943,  944,  945,  946,  947,  948,
-      949,  950,  951,  952,  953,  954,  955,  956,  957,  958,
+      885,  886,  887,  888,  889,  890,  891,  892,  893,  895,
+      896,  897,  898,  899,  900,  901,  902,  903,  904,  905,
+
+      906,  907,  908,  909,  910,  911,  912,  884,  913,  914,
+      915,  916,  917,  918,  919,  920,  921,  923,  924,  925,
+      926,  927,  928,  929,  930,  931,  932,  933,  934,  935,
+      931,  936,  937,  938,  939,  940,  941,  942,  943,  944,
+      945,  948,  949,  950,  951,  952,  953,  954,  955,  956,
       959,  960,  961,  962,  963,  964,  965,  966,  967,  968,
-      969,  970,  971,  972,  973,  975,  976,  977,  978,  979,
-      980,  981,  982,  983,  984,  985,  986,  984,  987,  988,
-      989,  990,  991,  992,  993,  994,  996,  997,  998,  999,
-     1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009,
-     1010, 1011, 1012,  989, 1013, 1014,  988, 1015, 1016, 1017,
-
-     1018, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028,
-     1029, 1030, 1032, 1033, 1034, 1035, 1036, 1037, 1039, 1040,
-     1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050,
-     1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060,
-     1061, 1062, 1063, 1064, 1065, 1066, 1067, 1069, 1070, 1072,
-     1073, 1074, 1076, 1077, 1078, 1065, 1079, 1080, 1081, 1082,
-     1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092,
-     1093, 1095, 1096, 1097, 1036, 1099, 1100, 1101, 1102, 1103,
-     1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113,
-     1114, 1115, 1117, 1116, 1118, 1119, 1120, 1121, 1122, 1123,
-
-     1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134,
-     1135, 1136, 1137, 1138, 1139, 1140, 1142, 1143, 1144, 1115,
-     1116, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153,
-     1154, 1155, 1156, 1157, 1158, 1159, 1161, 1162, 1163, 1164,
-     1165, 1161, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173,
-     1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183,
-     1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193,
-     1194, 1195, 1196, 1198, 1199, 1200, 1201, 1202, 1203, 1204,
-     1205, 1162, 1206, 1207, 1208, 1210, 1211, 1212, 1214, 1215,
-     1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225,
-
-     1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1235, 1236,
-     1237, 1238, 1239, 1240, 1241, 1243, 1244, 1245, 1246, 1247,
-     1248, 1249, 1250, 1251, 1253, 1254, 1255, 1256, 1257, 1259,
-     1260, 1235, 1261, 1262, 1263, 1264, 1265, 1236, 1266, 1267,
-     1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1277, 1279,
-     1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290,
-     1291, 1292, 1293, 1294, 1295, 1296, 1298, 1299, 1300, 1301,
-     1302, 1303, 1305, 1306, 1307, 1308, 1309, 1310, 1312, 1314,
-     1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325,
-     1326, 1327, 1328, 1329, 1330, 1332, 1333, 1334, 1335, 1336,
-
-     1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348,
-     1349, 1350, 1351, 1352, 1354, 1355, 1356, 1357, 1358, 1359,
-     1360, 1361, 1362, 1364, 1365, 1366, 1367, 1368, 1369, 1370,
-     1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1380, 1350,
-     1381, 1324, 1382, 1383, 1384, 1385, 1386, 1387, 1389, 1390,
-     1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400,
-     1401, 1357, 1402, 1403, 1404, 1405, 1399, 1406, 1408, 1409,
-     1410, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421,
-     1422, 1423, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1433,
-     1434, 1436, 1439, 1440, 1441, 1443, 1444, 1446, 1447, 1449,
-
-     1450, 1451, 1452, 1454, 1455, 1456, 1451, 1457, 1459, 1460,
-     1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470,
-     1471, 1472, 1473, 1474, 1476, 1452, 1477, 1479, 1480, 1481,
-     1482, 1483, 1484, 1485, 1486, 1487, 1488, 1490, 1492, 1494,
-     1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504,
-     1505, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515,
-     1516, 1518, 1519, 1521, 1522, 1523, 1524, 1526, 1527, 1528,
-     1529, 1530, 1531, 1532, 1533, 1534, 1535, 1537, 1538, 1539,
-     1541, 1542, 1543, 1545, 1546, 1547, 1548, 1549, 1550, 1551,
-     1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561,
-
-     1562, 1563, 1564, 1565, 1566, 1556, 1567, 1568, 1542, 1569,
-     1570, 1571, 1572, 1572, 1573, 1574, 1575, 1576, 1577, 1578,
-     1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588,
-     1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599,
-     1600, 1601, 1602, 1603, 1604, 1605, 1607, 1608, 1609, 1610,
-     1611, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1622,
-     1625, 1626, 1627, 1628, 1631, 1632, 1633, 1634, 1635, 1636,
-     1637, 1638, 1573, 1639, 1641, 1643, 1644, 1645, 1646, 1647,
-     1648, 1649, 1650, 1652, 1653, 1619, 1654, 1656, 1657, 1658,
-     1660, 1661, 1662, 1664, 1665, 1666, 1667, 1668, 1669, 1670,
-
-     1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681,
-     1682, 1683, 1684, 1685, 1686, 1687, 1688, 1689, 1625, 1690,
-     1691, 1694, 1695, 1697, 1699, 1700, 1701, 1703, 1704, 1705,
-     1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715,
-     1716, 1718, 1719, 1720, 1722, 1723, 1726, 1727, 1728, 1729,
-     1730, 1731, 1732, 1734, 1735, 1736, 1737, 1738, 1739, 1740,
-     1741, 1742, 1743, 1744, 1746, 1747, 1749, 1752, 1753, 1754,
-     1755, 1756, 1759, 1761, 1762, 1763, 1764, 1765, 1766, 1767,
-     1768, 1769, 1770, 1772, 1773, 1774, 1776, 1777, 1778, 1779,
-     1780, 1781, 1782, 1783, 1785, 1786, 1787, 1788, 1789, 1791,
-
-     1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800, 1802,
-     1803, 1804, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813,
-     1814, 1815, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824,
-     1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834, 1835, 1836,
-     1837, 1839, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848,
-     1850, 1851, 1853, 1854, 1855, 1856, 1857, 1858, 1860, 1861,
-     1862, 1863, 1864, 1865, 1866, 1867, 1869, 1870, 1873, 1875,
-     1877, 1878, 1879, 1880, 1881, 1883, 1884, 1885, 1887, 1888,
-     1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1898, 1899,
-     1900, 1901, 1904, 1905, 1906, 1907, 1910, 1911, 1913, 1914,
+      969,  970,  967,  971,  972,  973,  974,  977,  978,  979,
+      980,  981,  982,  983,  984,  985,  986,  987,  988,  989,
+      990,  991,  992,  993,  994,  995,  996,  997,  998,  999,
+     1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1010,
+
+     1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020,
+     1021, 1019, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029,
+     1030, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040,
+     1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1025, 1049,
+     1050, 1024, 1051, 1052, 1053, 1054, 1056, 1057, 1058, 1059,
+     1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069,
+     1071, 1072, 1073, 1074, 1075, 1076, 1078, 1079, 1080, 1081,
+     1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091,
+     1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101,
+     1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1112,
+
+     1113, 1115, 1116, 1117, 1119, 1120, 1121, 1108, 1122, 1123,
+     1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133,
+     1134, 1135, 1075, 1136, 1138, 1139, 1140, 1142, 1143, 1144,
+     1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154,
+     1155, 1156, 1157, 1158, 1159, 1161, 1160, 1162, 1163, 1164,
+     1165, 1166, 1167, 1169, 1170, 1171, 1172, 1173, 1174, 1175,
+     1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1186,
+     1187, 1188, 1159, 1160, 1189, 1190, 1191, 1192, 1193, 1194,
+     1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204,
+     1205, 1206, 1208, 1209, 1210, 1211, 1212, 1208, 1213, 1214,
+
+     1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224,
+     1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234,
+     1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244,
+     1245, 1246, 1247, 1249, 1250, 1251, 1252, 1209, 1253, 1254,
+     1255, 1256, 1257, 1258, 1259, 1261, 1262, 1263, 1265, 1266,
+     1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276,
+     1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285, 1287,
+     1288, 1289, 1290, 1291, 1292, 1293, 1295, 1296, 1297, 1298,
+     1299, 1300, 1301, 1302, 1303, 1305, 1306, 1307, 1308, 1309,
+     1311, 1312, 1287, 1313, 1314, 1315, 1316, 1317, 1288, 1318,
+
+     1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328,
+     1329, 1330, 1332, 1334, 1336, 1337, 1338, 1339, 1340, 1341,
+     1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351,
+     1352, 1353, 1354, 1355, 1357, 1358, 1359, 1360, 1361, 1362,
+     1364, 1365, 1366, 1367, 1368, 1369, 1371, 1373, 1375, 1376,
+     1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386,
+     1387, 1388, 1389, 1391, 1392, 1393, 1394, 1395, 1398, 1399,
+     1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409,
+     1410, 1411, 1412, 1414, 1415, 1416, 1417, 1418, 1419, 1420,
+     1421, 1422, 1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431,
 
-     1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924,
-     1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934,
-     1935, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945,
-     1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955,
-     1957, 1958, 1960, 1961, 1963, 1964, 1965, 1966, 1967, 1968,
-     1969, 1971, 1972, 1974, 1975, 1976, 1978, 1979, 1980, 1981,
-     1982, 1983, 1984, 1986, 1987, 1989, 1991, 1994, 1995, 1996,
-     1997, 1998, 1999, 2001, 2002, 2001, 2004, 2005, 2007, 2008,
-     2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2019,
-     2020, 2021, 2022, 2023, 2024, 2025, 2027, 2028, 2030, 2031,
-
-     2032, 2033, 2034, 2035, 2037, 2040, 2041, 2042, 2043, 2044,
-     2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054,
-     2057, 2057, 2057, 2057, 2057, 2058, 2058, 2058, 2058, 2058,
-     2059, 2065, 2059, 2059, 2059, 2060, 2066, 2060, 2067, 2060,
-     2061, 2061, 2061, 2061, 2061, 2062, 2062, 2062, 2062, 2062,
-     2063, 2068, 2063, 2063, 2063, 2064, 2064, 2064,  714,  712,
-      711,  710,  708,  707,  706,  705,  704,  703,  702,  701,
-      700,  699,  698,  697,  696,  694,  693,  692,  691,  690,
-      689,  688,  687,  686,  685,  683,  682,  681,  680,  679,
-      678,  677,  675,  674,  673,  672,  671,  670,  669,  668,
-
-      667,  665,  664,  663,  662,  661,  660,  659,  658,  657,
-      656,  655,  654,  653,  652,  651,  650,  648,  647,  646,
-      645,  644,  643,  642,  641,  640,  639,  638,  637,  636,
-      635,  633,  632,  631,  630,  629,  628,  627,  626,  625,
-      624,  623,  622,  621,  620,  619,  618,  617,  616,  615,
-      614,  613,  612,  610,  609,  608,  607,  606,  605,  604,
-      601,  595,  594,  593,  591,  590,  589,  588,  587,  585,
-      584,  582,  580,  579,  578,  577,  576,  575,  574,  573,
-      572,  571,  570,  569,  568,  567,  566,  565,  564,  563,
-      562,  561,  560,  559,  558,  557,  556,  555,  554,  553,
-
-      552,  551,  550,  549,  548,  546,  544,  543,  542,  541,
-      540,  539,  538,  537,  536,  535,  534,  533,  532,  531,
-      530,  529,  528,  526,  525,  524,  523,  522,  521,  520,
-      519,  517,  516,  515,  514,  513,  512,  511,  510,  509,
-      508,  507,  506,  505,  504,  503,  502,  501,  499,  498,
-      497,  496,  494,  493,  492,  491,  490,  488,  487,  485,
-      484,  481,  480,  479,  478,  477,  476,  475,  473,  472,
-      471,  470,  469,  468,  467,  465,  461,  459,  458,  456,
-      455,  453,  450,  449,  448,  446,  445,  443,  442,  441,
-      439,  438,  437,  436,  435,  434,  433,  432,  431,  430,
-
-      429,  428,  427,  426,  425,  424,  422,  421,  420,  418,
-      417,  416,  415,  413,  412,  411,  410,  409,  407,  406,
-      405,  404,  403,  402,  401,  400,  399,  398,  397,  396,
-      395,  393,  392,  390,  389,  388,  387,  386,  385,  384,
-      382,  381,  380,  379,  378,  377,  376,  375,  374,  373,
-      372,  371,  369,  368,  367,  366,  365,  364,  363,  362,
-      361,  360,  359,  358,  356,  355,  354,  353,  352,  349,
-      348,  347,  346,  345,  344,  343,  342,  341,  340,  339,
-      338,  336,  333,  331,  328,  326,  322,  315,  312,  311,
-      310,  309,  308,  306,  305,  304,  303,  302,  301,  300,
-
-      299,  298,  297,  295,  294,  293,  292,  291,  290,  289,
-      288,  286,  285,  284,  283,  282,  281,  280,  279,  278,
-      277,  276,  275,  274,  273,  272,  271,  270,  268,  267,
-      266,  265,  264,  263,  262,  261,  260,  259,  258,  257,
-      255,  254,  253,  252,  251,  250,  249,  248,  247,  246,
-      245,  243,  242,  241,  240,  239,  238,  237,  236,  235,
-      234,  233,  232,  231,  230,  229,  228,  227,  226,  225,
-      224,  223,  221,  220,  219,  218,  217,  216,  215,  214,
-      213,  208,  206,  204,  200,  198,  195,  187,  186,  185,
-      184,  182,  181,  180,  178,  177,  176,  174,  173,  172,
-
-      171,  167,  165,  163,  161,  160,  159,  157,  156,  154,
-      153,  152,  151,  150,  149,  147,  146,  145,  144,  143,
-      142,  141,  139,  138,  136,  135,  133,  131,  130,  129,
-      128,  126,  125,  124,  123,  121,  120,  118,  117,  116,
-      112,  104,  102,   97,   96,   72,   66,   58,   49,   47,
-       43,   41,   39,   38,   24,   14,   11, 2056, 2056, 2056,
-     2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056,
-     2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056,
-     2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056,
-     2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056,
-
-     2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056,
-     2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056,
-     2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056, 2056,
-     2056
+     1432, 1433, 1434, 1435, 1436, 1437, 1438, 1440, 1410, 1383,
+     1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450,
+     1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1462,
+     1417, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471,
+     1472, 1473, 1466, 1475, 1476, 1477, 1480, 1481, 1482, 1483,
+     1484, 1485, 1486, 1487, 1488, 1489, 1490, 1492, 1493, 1494,
+     1495, 1496, 1497, 1498, 1500, 1501, 1503, 1506, 1507, 1508,
+     1510, 1511, 1513, 1514, 1516, 1517, 1518, 1519, 1520, 1522,
+     1523, 1524, 1519, 1525, 1527, 1528, 1529, 1530, 1531, 1532,
+     1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542,
+
+     1544, 1520, 1545, 1547, 1548, 1549, 1550, 1552, 1554, 1555,
+     1556, 1557, 1558, 1559, 1561, 1563, 1564, 1565, 1568, 1569,
+     1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579,
+     1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589, 1590,
+     1592, 1593, 1595, 1596, 1597, 1598, 1600, 1601, 1602, 1603,
+     1604, 1605, 1606, 1607, 1608, 1609, 1611, 1612, 1613, 1614,
+     1616, 1617, 1618, 1620, 1621, 1622, 1623, 1624, 1625, 1626,
+     1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636,
+     1637, 1638, 1639, 1640, 1641, 1631, 1642, 1643, 1617, 1644,
+     1645, 1646, 1647, 1648, 1648, 1649, 1650, 1651, 1652, 1653,
+
+     1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663,
+     1664, 1665, 1666, 1668, 1669, 1670, 1671, 1672, 1673, 1674,
+     1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1685,
+     1686, 1687, 1688, 1689, 1691, 1692, 1693, 1694, 1695, 1696,
+     1697, 1698, 1699, 1701, 1704, 1705, 1706, 1707, 1710, 1711,
+     1712, 1713, 1714, 1649, 1715, 1716, 1717, 1718, 1720, 1722,
+     1723, 1725, 1726, 1727, 1728, 1729, 1730, 1732, 1733, 1698,
+     1734, 1736, 1737, 1738, 1739, 1740, 1742, 1743, 1744, 1746,
+     1747, 1748, 1749, 1750, 1751, 1752, 1754, 1755, 1756, 1757,
+     1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767,
+
+     1768, 1769, 1704, 1770, 1771, 1772, 1773, 1776, 1777, 1778,
+     1780, 1782, 1783, 1784, 1786, 1787, 1788, 1789, 1790, 1791,
+     1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1801, 1802,
+     1803, 1805, 1806, 1807, 1808, 1811, 1812, 1813, 1814, 1815,
+     1816, 1817, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826,
+     1827, 1828, 1829, 1831, 1832, 1834, 1837, 1838, 1839, 1840,
+     1841, 1842, 1845, 1847, 1848, 1849, 1850, 1851, 1852, 1853,
+     1854, 1855, 1856, 1858, 1859, 1860, 1862, 1863, 1864, 1865,
+     1866, 1867, 1868, 1869, 1870, 1871, 1873, 1874, 1875, 1876,
+     1877, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887,
+
+     1888, 1890, 1891, 1892, 1894, 1895, 1896, 1897, 1898, 1899,
+     1900, 1901, 1902, 1903, 1904, 1906, 1907, 1908, 1909, 1910,
+     1911, 1912, 1913, 1916, 1917, 1918, 1919, 1920, 1921, 1922,
+     1923, 1924, 1925, 1926, 1927, 1928, 1930, 1932, 1933, 1934,
+     1935, 1936, 1937, 1938, 1939, 1941, 1942, 1943, 1945, 1946,
+     1947, 1948, 1949, 1950, 1952, 1953, 1954, 1955, 1956, 1957,
+     1958, 1959, 1960, 1961, 1963, 1964, 1967, 1969, 1971, 1972,
+     1973, 1974, 1975, 1977, 1978, 1979, 1980, 1982, 1983, 1984,
+     1985, 1986, 1987, 1988, 1989, 1990, 1991, 1993, 1994, 1995,
+     1996, 1997, 1998, 2001, 2002, 2003, 2004, 2007, 2008, 2010,
+
+     2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021,
+     2022, 2023, 2024, 2025, 2027, 2028, 2029, 2030, 2031, 2032,
+     2033, 2034, 2035, 2037, 2038, 2039, 2040, 2041, 2042, 2043,
+     2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053,
+     2054, 2055, 2056, 2058, 2059, 2061, 2062, 2064, 2065, 2066,
+     2067, 2068, 2069, 2070, 2071, 2073, 2074, 2076, 2077, 2078,
+     2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2089, 2090,
+     2092, 2094, 2097, 2098, 2099, 2100, 2101, 2103, 2105, 2106,
+     2105, 2108, 2109, 2111, 2112, 2113, 2114, 2115, 2116, 2117,
+     2118, 2119, 2120, 2121, 2123, 2124, 2125, 2126, 2127, 2128,
+
+     2129, 2131, 2132, 2134, 2135, 2136, 2137, 2138, 2139, 2141,
+     2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153,
+     2154, 2155, 2156, 2157, 2158, 2161, 2161, 2161, 2161, 2161,
+     2162, 2162, 2162, 2162, 2162, 2163, 2169, 2163, 2163, 2163,
+     2164, 2170, 2164, 2171, 2164, 2165, 2165, 2165, 2165, 2165,
+     2166, 2166, 2166, 2166, 2166, 2167, 2172, 2167, 2167, 2167,
+     2168, 2168, 2168,  715,  713,  712,  711,  710,  709,  708,
+      707,  706,  705,  704,  702,  701,  700,  699,  698,  697,
+      696,  694,  693,  692,  691,  690,  689,  688,  687,  686,
+      684,  683,  682,  681,  680,  679,  678,  677,  676,  675,
+
+      674,  673,  672,  671,  670,  669,  668,  667,  665,  664,
+      663,  662,  661,  660,  659,  658,  657,  656,  655,  654,
+      653,  652,  650,  648,  647,  646,  645,  644,  643,  642,
+      641,  640,  639,  638,  637,  636,  635,  634,  633,  632,
+      631,  630,  629,  628,  627,  625,  624,  623,  622,  621,
+      620,  619,  616,  610,  609,  608,  606,  605,  604,  603,
+      602,  601,  599,  598,  596,  594,  593,  592,  591,  590,
+      589,  588,  587,  586,  585,  584,  583,  582,  581,  580,
+      579,  578,  577,  576,  575,  574,  573,  572,  571,  570,
+      569,  568,  567,  566,  565,  564,  563,  562,  560,  558,
+
+      557,  556,  555,  554,  553,  552,  551,  550,  549,  548,
+      547,  546,  545,  544,  543,  542,  540,  539,  538,  537,
+      536,  535,  534,  533,  531,  530,  529,  528,  527,  526,
+      525,  524,  523,  522,  521,  520,  519,  518,  517,  516,
+      515,  514,  513,  511,  510,  509,  508,  507,  506,  504,
+      503,  502,  501,  500,  498,  497,  495,  494,  491,  490,
+      489,  488,  487,  486,  485,  483,  482,  481,  480,  479,
+      478,  477,  475,  471,  469,  468,  466,  465,  463,  460,
+      459,  458,  457,  455,  454,  452,  451,  450,  448,  447,
+      446,  445,  444,  443,  442,  441,  440,  439,  438,  437,
+
+      436,  435,  434,  433,  431,  430,  429,  427,  426,  425,
+      424,  422,  421,  420,  419,  418,  416,  415,  414,  413,
+      412,  411,  410,  409,  408,  407,  406,  405,  404,  402,
+      401,  399,  398,  397,  396,  395,  394,  393,  391,  390,
+      389,  388,  386,  385,  384,  383,  382,  381,  380,  378,
+      377,  376,  375,  374,  373,  372,  371,  370,  369,  368,
+      367,  366,  365,  363,  362,  361,  360,  359,  356,  355,
+      354,  353,  352,  351,  350,  349,  348,  347,  346,  345,
+      343,  340,  338,  335,  333,  329,  322,  321,  318,  317,
+      316,  315,  314,  312,  311,  310,  309,  308,  307,  306,
+
+      305,  304,  303,  301,  300,  299,  298,  297,  296,  295,
+      294,  292,  291,  290,  289,  288,  287,  286,  285,  284,
+      283,  282,  281,  280,  279,  278,  277,  276,  274,  273,
+      272,  271,  270,  269,  268,  267,  266,  265,  264,  263,
+      261,  260,  259,  258,  257,  256,  255,  254,  253,  252,
+      251,  249,  248,  247,  246,  245,  244,  243,  242,  241,
+      240,  239,  238,  237,  236,  235,  234,  233,  232,  231,
+      230,  229,  228,  227,  225,  224,  223,  222,  221,  220,
+      219,  218,  217,  212,  210,  208,  204,  202,  199,  191,
+      190,  189,  188,  187,  185,  184,  183,  181,  180,  179,
+
+      177,  176,  175,  174,  170,  168,  166,  164,  163,  162,
+      160,  159,  157,  156,  155,  154,  153,  152,  150,  149,
+      148,  147,  146,  145,  144,  142,  141,  139,  138,  137,
+      136,  134,  132,  131,  130,  129,  127,  126,  125,  124,
+      122,  121,  119,  118,  117,  113,  105,  103,   98,   97,
+       72,   66,   58,   49,   47,   43,   41,   39,   38,   24,
+       14,   11, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160,
+     2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160,
+     2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160,
+     2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160,
+
+     2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160,
+     2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160,
+     2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160, 2160,
+     2160, 2160, 2160, 2160, 2160, 2160
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -2008,32 +2065,32 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[213] =
+static const flex_int16_t yy_rule_linenum[221] =
     {   0,
       145,  147,  149,  154,  155,  160,  161,  162,  174,  177,
       182,  189,  198,  207,  216,  225,  234,  243,  253,  262,
       271,  280,  289,  298,  307,  316,  325,  334,  343,  352,
       361,  374,  383,  392,  401,  410,  422,  434,  446,  458,
       470,  482,  494,  506,  518,  530,  542,  554,  566,  578,
-      590,  602,  611,  622,  633,  644,  655,  666,  675,  684,
-      693,  702,  713,  724,  735,  746,  757,  768,  778,  789,
-      798,  808,  822,  839,  848,  857,  866,  875,  897,  919,
-      928,  938,  948,  959,  968,  977,  986,  995, 1004, 1014,
-     1023, 1034, 1045, 1057, 1066, 1075, 1084, 1093, 1102, 1111,
-
-     1120, 1129, 1138, 1148, 1159, 1171, 1180, 1189, 1199, 1209,
-     1219, 1229, 1239, 1249, 1258, 1268, 1277, 1286, 1295, 1304,
-     1314, 1324, 1333, 1343, 1352, 1361, 1370, 1379, 1388, 1397,
-     1406, 1415, 1424, 1433, 1442, 1451, 1460, 1469, 1478, 1487,
+      590,  602,  611,  620,  629,  638,  647,  656,  665,  674,
+      683,  694,  705,  716,  727,  738,  747,  756,  765,  774,
+      785,  796,  807,  818,  829,  840,  850,  861,  870,  880,
+      894,  911,  920,  929,  938,  947,  969,  991, 1000, 1010,
+     1020, 1031, 1040, 1049, 1058, 1067, 1076, 1086, 1095, 1106,
+
+     1117, 1129, 1138, 1147, 1156, 1165, 1174, 1183, 1192, 1201,
+     1210, 1220, 1231, 1243, 1252, 1261, 1271, 1281, 1291, 1301,
+     1311, 1321, 1330, 1340, 1349, 1358, 1367, 1376, 1386, 1396,
+     1405, 1415, 1424, 1433, 1442, 1451, 1460, 1469, 1478, 1487,
      1496, 1505, 1514, 1523, 1532, 1541, 1550, 1559, 1568, 1577,
      1586, 1595, 1604, 1613, 1622, 1631, 1640, 1649, 1658, 1667,
-     1679, 1691, 1701, 1711, 1721, 1731, 1741, 1751, 1761, 1771,
-     1781, 1790, 1799, 1808, 1817, 1828, 1839, 1852, 1865, 1878,
-     1887, 1896, 1905, 1914, 1923, 1932, 1941, 1953, 1962, 1974,
-     1983, 1995, 2004, 2013, 2022, 2121, 2126, 2131, 2136, 2137,
+     1676, 1685, 1694, 1703, 1712, 1721, 1730, 1739, 1751, 1763,
+     1773, 1783, 1793, 1803, 1813, 1823, 1833, 1843, 1853, 1862,
+     1871, 1880, 1889, 1900, 1911, 1924, 1937, 1950, 1959, 1968,
+     1977, 1986, 1995, 2004, 2013, 2025, 2034, 2046, 2055, 2067,
 
-     2138, 2139, 2140, 2141, 2143, 2161, 2174, 2179, 2183, 2185,
-     2187, 2189
+     2076, 2085, 2094, 2193, 2198, 2203, 2208, 2209, 2210, 2211,
+     2212, 2213, 2215, 2233, 2246, 2251, 2255, 2257, 2259, 2261
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -2086,7 +2143,7 @@ using namespace isc::dhcp;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::dhcp::Parser4Context::fatal(msg)
-#line 2090 "dhcp4_lexer.cc"
+#line 2147 "dhcp4_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -2112,8 +2169,8 @@ using namespace isc::dhcp;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 2116 "dhcp4_lexer.cc"
-#line 2117 "dhcp4_lexer.cc"
+#line 2173 "dhcp4_lexer.cc"
+#line 2174 "dhcp4_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -2441,7 +2498,7 @@ YY_DECL
     }
 
 
-#line 2445 "dhcp4_lexer.cc"
+#line 2502 "dhcp4_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2470,13 +2527,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 2057 )
+				if ( yy_current_state >= 2161 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 2056 );
+		while ( yy_current_state != 2160 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2495,13 +2552,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 213 )
+			else if ( yy_act < 221 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 213 )
+			else if ( yy_act == 221 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 214 )
+			else if ( yy_act == 222 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -3153,6 +3210,102 @@ YY_RULE_SETUP
 case 53:
 YY_RULE_SETUP
 #line 611 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_GROUP_COMMIT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("group-commit", driver.loc_);
+    }
+}
+	YY_BREAK
+case 54:
+YY_RULE_SETUP
+#line 620 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_FSYNC_POLICY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("fsync-policy", driver.loc_);
+    }
+}
+	YY_BREAK
+case 55:
+YY_RULE_SETUP
+#line 629 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_FSYNC_INTERVAL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("fsync-interval", driver.loc_);
+    }
+}
+	YY_BREAK
+case 56:
+YY_RULE_SETUP
+#line 638 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_WAIT_FOR_DURABILITY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("wait-for-durability", driver.loc_);
+    }
+}
+	YY_BREAK
+case 57:
+YY_RULE_SETUP
+#line 647 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_THREADS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-threads", driver.loc_);
+    }
+}
+	YY_BREAK
+case 58:
+YY_RULE_SETUP
+#line 656 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_SNAPSHOT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-snapshot", driver.loc_);
+    }
+}
+	YY_BREAK
+case 59:
+YY_RULE_SETUP
+#line 665 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LEASE_STATS_COUNTERS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lease-stats-counters", driver.loc_);
+    }
+}
+	YY_BREAK
+case 60:
+YY_RULE_SETUP
+#line 674 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LEASE_EXPIRATION_BUCKETS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lease-expiration-buckets", driver.loc_);
+    }
+}
+	YY_BREAK
+case 61:
+YY_RULE_SETUP
+#line 683 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3164,9 +3317,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 54:
+case 62:
 YY_RULE_SETUP
-#line 622 "dhcp4_lexer.ll"
+#line 694 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3178,9 +3331,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 55:
+case 63:
 YY_RULE_SETUP
-#line 633 "dhcp4_lexer.ll"
+#line 705 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3192,9 +3345,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 56:
+case 64:
 YY_RULE_SETUP
-#line 644 "dhcp4_lexer.ll"
+#line 716 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3206,9 +3359,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 57:
+case 65:
 YY_RULE_SETUP
-#line 655 "dhcp4_lexer.ll"
+#line 727 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3220,9 +3373,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 58:
+case 66:
 YY_RULE_SETUP
-#line 666 "dhcp4_lexer.ll"
+#line 738 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3232,9 +3385,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 59:
+case 67:
 YY_RULE_SETUP
-#line 675 "dhcp4_lexer.ll"
+#line 747 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3244,9 +3397,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 60:
+case 68:
 YY_RULE_SETUP
-#line 684 "dhcp4_lexer.ll"
+#line 756 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3256,9 +3409,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 61:
+case 69:
 YY_RULE_SETUP
-#line 693 "dhcp4_lexer.ll"
+#line 765 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3268,9 +3421,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 62:
+case 70:
 YY_RULE_SETUP
-#line 702 "dhcp4_lexer.ll"
+#line 774 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3282,9 +3435,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 63:
+case 71:
 YY_RULE_SETUP
-#line 713 "dhcp4_lexer.ll"
+#line 785 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3296,9 +3449,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 64:
+case 72:
 YY_RULE_SETUP
-#line 724 "dhcp4_lexer.ll"
+#line 796 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3310,9 +3463,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 65:
+case 73:
 YY_RULE_SETUP
-#line 735 "dhcp4_lexer.ll"
+#line 807 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3324,9 +3477,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 66:
+case 74:
 YY_RULE_SETUP
-#line 746 "dhcp4_lexer.ll"
+#line 818 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3338,9 +3491,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 67:
+case 75:
 YY_RULE_SETUP
-#line 757 "dhcp4_lexer.ll"
+#line 829 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3352,9 +3505,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 68:
+case 76:
 YY_RULE_SETUP
-#line 768 "dhcp4_lexer.ll"
+#line 840 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3365,9 +3518,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 69:
+case 77:
 YY_RULE_SETUP
-#line 778 "dhcp4_lexer.ll"
+#line 850 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3379,9 +3532,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 70:
+case 78:
 YY_RULE_SETUP
-#line 789 "dhcp4_lexer.ll"
+#line 861 "dhcp4_lexer.ll"
 {
     switch (driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3391,9 +3544,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 71:
+case 79:
 YY_RULE_SETUP
-#line 798 "dhcp4_lexer.ll"
+#line 870 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3404,9 +3557,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 72:
+case 80:
 YY_RULE_SETUP
-#line 808 "dhcp4_lexer.ll"
+#line 880 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3421,9 +3574,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 73:
+case 81:
 YY_RULE_SETUP
-#line 822 "dhcp4_lexer.ll"
+#line 894 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -3441,9 +3594,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 74:
+case 82:
 YY_RULE_SETUP
-#line 839 "dhcp4_lexer.ll"
+#line 911 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -3453,9 +3606,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 75:
+case 83:
 YY_RULE_SETUP
-#line 848 "dhcp4_lexer.ll"
+#line 920 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -3465,9 +3618,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 76:
+case 84:
 YY_RULE_SETUP
-#line 857 "dhcp4_lexer.ll"
+#line 929 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3477,9 +3630,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 77:
+case 85:
 YY_RULE_SETUP
-#line 866 "dhcp4_lexer.ll"
+#line 938 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::POOLS:
@@ -3489,9 +3642,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 78:
+case 86:
 YY_RULE_SETUP
-#line 875 "dhcp4_lexer.ll"
+#line 947 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3514,9 +3667,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 79:
+case 87:
 YY_RULE_SETUP
-#line 897 "dhcp4_lexer.ll"
+#line 969 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3539,9 +3692,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 80:
+case 88:
 YY_RULE_SETUP
-#line 919 "dhcp4_lexer.ll"
+#line 991 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3551,9 +3704,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 81:
+case 89:
 YY_RULE_SETUP
-#line 928 "dhcp4_lexer.ll"
+#line 1000 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3564,9 +3717,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 82:
+case 90:
 YY_RULE_SETUP
-#line 938 "dhcp4_lexer.ll"
+#line 1010 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::POOLS:
@@ -3577,9 +3730,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 83:
+case 91:
 YY_RULE_SETUP
-#line 948 "dhcp4_lexer.ll"
+#line 1020 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3591,9 +3744,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 84:
+case 92:
 YY_RULE_SETUP
-#line 959 "dhcp4_lexer.ll"
+#line 1031 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3603,9 +3756,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 85:
+case 93:
 YY_RULE_SETUP
-#line 968 "dhcp4_lexer.ll"
+#line 1040 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3615,9 +3768,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 86:
+case 94:
 YY_RULE_SETUP
-#line 977 "dhcp4_lexer.ll"
+#line 1049 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3627,9 +3780,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 87:
+case 95:
 YY_RULE_SETUP
-#line 986 "dhcp4_lexer.ll"
+#line 1058 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3639,9 +3792,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 96:
 YY_RULE_SETUP
-#line 995 "dhcp4_lexer.ll"
+#line 1067 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3651,9 +3804,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
+case 97:
 YY_RULE_SETUP
-#line 1004 "dhcp4_lexer.ll"
+#line 1076 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3664,9 +3817,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 90:
+case 98:
 YY_RULE_SETUP
-#line 1014 "dhcp4_lexer.ll"
+#line 1086 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3676,9 +3829,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 91:
+case 99:
 YY_RULE_SETUP
-#line 1023 "dhcp4_lexer.ll"
+#line 1095 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3690,9 +3843,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 92:
+case 100:
 YY_RULE_SETUP
-#line 1034 "dhcp4_lexer.ll"
+#line 1106 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3704,9 +3857,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 93:
+case 101:
 YY_RULE_SETUP
-#line 1045 "dhcp4_lexer.ll"
+#line 1117 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3718,9 +3871,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 94:
+case 102:
 YY_RULE_SETUP
-#line 1057 "dhcp4_lexer.ll"
+#line 1129 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3730,9 +3883,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 95:
+case 103:
 YY_RULE_SETUP
-#line 1066 "dhcp4_lexer.ll"
+#line 1138 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -3742,9 +3895,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 96:
+case 104:
 YY_RULE_SETUP
-#line 1075 "dhcp4_lexer.ll"
+#line 1147 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3754,9 +3907,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 97:
+case 105:
 YY_RULE_SETUP
-#line 1084 "dhcp4_lexer.ll"
+#line 1156 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -3766,9 +3919,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 98:
+case 106:
 YY_RULE_SETUP
-#line 1093 "dhcp4_lexer.ll"
+#line 1165 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3778,9 +3931,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 99:
+case 107:
 YY_RULE_SETUP
-#line 1102 "dhcp4_lexer.ll"
+#line 1174 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3790,9 +3943,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 100:
+case 108:
 YY_RULE_SETUP
-#line 1111 "dhcp4_lexer.ll"
+#line 1183 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3802,9 +3955,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 101:
+case 109:
 YY_RULE_SETUP
-#line 1120 "dhcp4_lexer.ll"
+#line 1192 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3814,9 +3967,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 102:
+case 110:
 YY_RULE_SETUP
-#line 1129 "dhcp4_lexer.ll"
+#line 1201 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -3826,9 +3979,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 103:
+case 111:
 YY_RULE_SETUP
-#line 1138 "dhcp4_lexer.ll"
+#line 1210 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3839,9 +3992,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 104:
+case 112:
 YY_RULE_SETUP
-#line 1148 "dhcp4_lexer.ll"
+#line 1220 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3853,9 +4006,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 105:
+case 113:
 YY_RULE_SETUP
-#line 1159 "dhcp4_lexer.ll"
+#line 1231 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3868,9 +4021,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 106:
+case 114:
 YY_RULE_SETUP
-#line 1171 "dhcp4_lexer.ll"
+#line 1243 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CLIENT_CLASSES:
@@ -3880,9 +4033,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 107:
+case 115:
 YY_RULE_SETUP
-#line 1180 "dhcp4_lexer.ll"
+#line 1252 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CLIENT_CLASSES:
@@ -3892,9 +4045,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 108:
+case 116:
 YY_RULE_SETUP
-#line 1189 "dhcp4_lexer.ll"
+#line 1261 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3905,9 +4058,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 109:
+case 117:
 YY_RULE_SETUP
-#line 1199 "dhcp4_lexer.ll"
+#line 1271 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3918,9 +4071,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 110:
+case 118:
 YY_RULE_SETUP
-#line 1209 "dhcp4_lexer.ll"
+#line 1281 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3931,9 +4084,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 111:
+case 119:
 YY_RULE_SETUP
-#line 1219 "dhcp4_lexer.ll"
+#line 1291 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3944,9 +4097,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 112:
+case 120:
 YY_RULE_SETUP
-#line 1229 "dhcp4_lexer.ll"
+#line 1301 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3957,9 +4110,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 113:
+case 121:
 YY_RULE_SETUP
-#line 1239 "dhcp4_lexer.ll"
+#line 1311 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3970,9 +4123,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 122:
 YY_RULE_SETUP
-#line 1249 "dhcp4_lexer.ll"
+#line 1321 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATIONS:
@@ -3982,9 +4135,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 123:
 YY_RULE_SETUP
-#line 1258 "dhcp4_lexer.ll"
+#line 1330 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3995,9 +4148,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 124:
 YY_RULE_SETUP
-#line 1268 "dhcp4_lexer.ll"
+#line 1340 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -4007,9 +4160,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 125:
 YY_RULE_SETUP
-#line 1277 "dhcp4_lexer.ll"
+#line 1349 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -4019,9 +4172,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 126:
 YY_RULE_SETUP
-#line 1286 "dhcp4_lexer.ll"
+#line 1358 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -4031,9 +4184,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 127:
 YY_RULE_SETUP
-#line 1295 "dhcp4_lexer.ll"
+#line 1367 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -4043,9 +4196,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 128:
 YY_RULE_SETUP
-#line 1304 "dhcp4_lexer.ll"
+#line 1376 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4056,9 +4209,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 121:
+case 129:
 YY_RULE_SETUP
-#line 1314 "dhcp4_lexer.ll"
+#line 1386 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RELAY:
@@ -4069,9 +4222,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 122:
+case 130:
 YY_RULE_SETUP
-#line 1324 "dhcp4_lexer.ll"
+#line 1396 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RELAY:
@@ -4081,9 +4234,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 123:
+case 131:
 YY_RULE_SETUP
-#line 1333 "dhcp4_lexer.ll"
+#line 1405 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4093,9 +4246,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 124:
+case 132:
 YY_RULE_SETUP
-#line 1343 "dhcp4_lexer.ll"
+#line 1415 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -4105,9 +4258,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 125:
+case 133:
 YY_RULE_SETUP
-#line 1352 "dhcp4_lexer.ll"
+#line 1424 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -4117,9 +4270,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 126:
+case 134:
 YY_RULE_SETUP
-#line 1361 "dhcp4_lexer.ll"
+#line 1433 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4129,9 +4282,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 127:
+case 135:
 YY_RULE_SETUP
-#line 1370 "dhcp4_lexer.ll"
+#line 1442 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -4141,9 +4294,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 128:
+case 136:
 YY_RULE_SETUP
-#line 1379 "dhcp4_lexer.ll"
+#line 1451 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -4153,9 +4306,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 129:
+case 137:
 YY_RULE_SETUP
-#line 1388 "dhcp4_lexer.ll"
+#line 1460 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -4165,9 +4318,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 130:
+case 138:
 YY_RULE_SETUP
-#line 1397 "dhcp4_lexer.ll"
+#line 1469 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -4177,9 +4330,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 131:
+case 139:
 YY_RULE_SETUP
-#line 1406 "dhcp4_lexer.ll"
+#line 1478 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -4189,9 +4342,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 132:
+case 140:
 YY_RULE_SETUP
-#line 1415 "dhcp4_lexer.ll"
+#line 1487 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -4201,9 +4354,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 133:
+case 141:
 YY_RULE_SETUP
-#line 1424 "dhcp4_lexer.ll"
+#line 1496 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4213,9 +4366,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 134:
+case 142:
 YY_RULE_SETUP
-#line 1433 "dhcp4_lexer.ll"
+#line 1505 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4225,9 +4378,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 135:
+case 143:
 YY_RULE_SETUP
-#line 1442 "dhcp4_lexer.ll"
+#line 1514 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_MULTI_THREADING:
@@ -4237,9 +4390,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 136:
+case 144:
 YY_RULE_SETUP
-#line 1451 "dhcp4_lexer.ll"
+#line 1523 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_MULTI_THREADING:
@@ -4249,9 +4402,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 137:
+case 145:
 YY_RULE_SETUP
-#line 1460 "dhcp4_lexer.ll"
+#line 1532 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_MULTI_THREADING:
@@ -4261,9 +4414,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 138:
+case 146:
 YY_RULE_SETUP
-#line 1469 "dhcp4_lexer.ll"
+#line 1541 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4273,9 +4426,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 139:
+case 147:
 YY_RULE_SETUP
-#line 1478 "dhcp4_lexer.ll"
+#line 1550 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -4285,9 +4438,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 140:
+case 148:
 YY_RULE_SETUP
-#line 1487 "dhcp4_lexer.ll"
+#line 1559 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -4297,9 +4450,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 141:
+case 149:
 YY_RULE_SETUP
-#line 1496 "dhcp4_lexer.ll"
+#line 1568 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -4309,9 +4462,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 142:
+case 150:
 YY_RULE_SETUP
-#line 1505 "dhcp4_lexer.ll"
+#line 1577 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4321,9 +4474,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 143:
+case 151:
 YY_RULE_SETUP
-#line 1514 "dhcp4_lexer.ll"
+#line 1586 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_QUEUE_CONTROL:
@@ -4333,9 +4486,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 144:
+case 152:
 YY_RULE_SETUP
-#line 1523 "dhcp4_lexer.ll"
+#line 1595 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_QUEUE_CONTROL:
@@ -4345,9 +4498,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 145:
+case 153:
 YY_RULE_SETUP
-#line 1532 "dhcp4_lexer.ll"
+#line 1604 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_QUEUE_CONTROL:
@@ -4357,9 +4510,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 146:
+case 154:
 YY_RULE_SETUP
-#line 1541 "dhcp4_lexer.ll"
+#line 1613 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4369,9 +4522,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 147:
+case 155:
 YY_RULE_SETUP
-#line 1550 "dhcp4_lexer.ll"
+#line 1622 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4381,9 +4534,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 148:
+case 156:
 YY_RULE_SETUP
-#line 1559 "dhcp4_lexer.ll"
+#line 1631 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4393,9 +4546,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 149:
+case 157:
 YY_RULE_SETUP
-#line 1568 "dhcp4_lexer.ll"
+#line 1640 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4405,9 +4558,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 150:
+case 158:
 YY_RULE_SETUP
-#line 1577 "dhcp4_lexer.ll"
+#line 1649 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4417,9 +4570,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 151:
+case 159:
 YY_RULE_SETUP
-#line 1586 "dhcp4_lexer.ll"
+#line 1658 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4429,9 +4582,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 152:
+case 160:
 YY_RULE_SETUP
-#line 1595 "dhcp4_lexer.ll"
+#line 1667 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4441,9 +4594,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 153:
+case 161:
 YY_RULE_SETUP
-#line 1604 "dhcp4_lexer.ll"
+#line 1676 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4453,9 +4606,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 154:
+case 162:
 YY_RULE_SETUP
-#line 1613 "dhcp4_lexer.ll"
+#line 1685 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4465,9 +4618,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 155:
+case 163:
 YY_RULE_SETUP
-#line 1622 "dhcp4_lexer.ll"
+#line 1694 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4477,9 +4630,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 156:
+case 164:
 YY_RULE_SETUP
-#line 1631 "dhcp4_lexer.ll"
+#line 1703 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4489,9 +4642,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 157:
+case 165:
 YY_RULE_SETUP
-#line 1640 "dhcp4_lexer.ll"
+#line 1712 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4501,9 +4654,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 158:
+case 166:
 YY_RULE_SETUP
-#line 1649 "dhcp4_lexer.ll"
+#line 1721 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4513,9 +4666,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 159:
+case 167:
 YY_RULE_SETUP
-#line 1658 "dhcp4_lexer.ll"
+#line 1730 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -4525,9 +4678,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 160:
+case 168:
 YY_RULE_SETUP
-#line 1667 "dhcp4_lexer.ll"
+#line 1739 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4540,9 +4693,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 161:
+case 169:
 YY_RULE_SETUP
-#line 1679 "dhcp4_lexer.ll"
+#line 1751 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4555,9 +4708,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 162:
+case 170:
 YY_RULE_SETUP
-#line 1691 "dhcp4_lexer.ll"
+#line 1763 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -4568,9 +4721,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 163:
+case 171:
 YY_RULE_SETUP
-#line 1701 "dhcp4_lexer.ll"
+#line 1773 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -4581,9 +4734,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 164:
+case 172:
 YY_RULE_SETUP
-#line 1711 "dhcp4_lexer.ll"
+#line 1783 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_FORMAT) {
@@ -4594,9 +4747,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 165:
+case 173:
 YY_RULE_SETUP
-#line 1721 "dhcp4_lexer.ll"
+#line 1793 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4607,9 +4760,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 166:
+case 174:
 YY_RULE_SETUP
-#line 1731 "dhcp4_lexer.ll"
+#line 1803 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4620,9 +4773,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 167:
+case 175:
 YY_RULE_SETUP
-#line 1741 "dhcp4_lexer.ll"
+#line 1813 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4633,9 +4786,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 168:
+case 176:
 YY_RULE_SETUP
-#line 1751 "dhcp4_lexer.ll"
+#line 1823 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4646,9 +4799,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 169:
+case 177:
 YY_RULE_SETUP
-#line 1761 "dhcp4_lexer.ll"
+#line 1833 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4659,9 +4812,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 170:
+case 178:
 YY_RULE_SETUP
-#line 1771 "dhcp4_lexer.ll"
+#line 1843 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -4672,9 +4825,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 171:
+case 179:
 YY_RULE_SETUP
-#line 1781 "dhcp4_lexer.ll"
+#line 1853 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4684,9 +4837,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 172:
+case 180:
 YY_RULE_SETUP
-#line 1790 "dhcp4_lexer.ll"
+#line 1862 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4696,9 +4849,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 173:
+case 181:
 YY_RULE_SETUP
-#line 1799 "dhcp4_lexer.ll"
+#line 1871 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4708,9 +4861,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 174:
+case 182:
 YY_RULE_SETUP
-#line 1808 "dhcp4_lexer.ll"
+#line 1880 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4720,9 +4873,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 175:
+case 183:
 YY_RULE_SETUP
-#line 1817 "dhcp4_lexer.ll"
+#line 1889 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4734,9 +4887,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 176:
+case 184:
 YY_RULE_SETUP
-#line 1828 "dhcp4_lexer.ll"
+#line 1900 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4748,9 +4901,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 177:
+case 185:
 YY_RULE_SETUP
-#line 1839 "dhcp4_lexer.ll"
+#line 1911 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4764,9 +4917,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 178:
+case 186:
 YY_RULE_SETUP
-#line 1852 "dhcp4_lexer.ll"
+#line 1924 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4780,9 +4933,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 179:
+case 187:
 YY_RULE_SETUP
-#line 1865 "dhcp4_lexer.ll"
+#line 1937 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4796,9 +4949,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 180:
+case 188:
 YY_RULE_SETUP
-#line 1878 "dhcp4_lexer.ll"
+#line 1950 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4808,9 +4961,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 181:
+case 189:
 YY_RULE_SETUP
-#line 1887 "dhcp4_lexer.ll"
+#line 1959 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4820,9 +4973,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 182:
+case 190:
 YY_RULE_SETUP
-#line 1896 "dhcp4_lexer.ll"
+#line 1968 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4832,9 +4985,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 183:
+case 191:
 YY_RULE_SETUP
-#line 1905 "dhcp4_lexer.ll"
+#line 1977 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4844,9 +4997,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 184:
+case 192:
 YY_RULE_SETUP
-#line 1914 "dhcp4_lexer.ll"
+#line 1986 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -4856,9 +5009,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 185:
+case 193:
 YY_RULE_SETUP
-#line 1923 "dhcp4_lexer.ll"
+#line 1995 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4868,9 +5021,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 186:
+case 194:
 YY_RULE_SETUP
-#line 1932 "dhcp4_lexer.ll"
+#line 2004 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::POOLS:
@@ -4880,9 +5033,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 187:
+case 195:
 YY_RULE_SETUP
-#line 1941 "dhcp4_lexer.ll"
+#line 2013 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -4895,9 +5048,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 188:
+case 196:
 YY_RULE_SETUP
-#line 1953 "dhcp4_lexer.ll"
+#line 2025 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4907,9 +5060,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 189:
+case 197:
 YY_RULE_SETUP
-#line 1962 "dhcp4_lexer.ll"
+#line 2034 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -4922,9 +5075,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 190:
+case 198:
 YY_RULE_SETUP
-#line 1974 "dhcp4_lexer.ll"
+#line 2046 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -4934,9 +5087,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 191:
+case 199:
 YY_RULE_SETUP
-#line 1983 "dhcp4_lexer.ll"
+#line 2055 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -4949,9 +5102,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 192:
+case 200:
 YY_RULE_SETUP
-#line 1995 "dhcp4_lexer.ll"
+#line 2067 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4961,9 +5114,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 193:
+case 201:
 YY_RULE_SETUP
-#line 2004 "dhcp4_lexer.ll"
+#line 2076 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4973,9 +5126,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 194:
+case 202:
 YY_RULE_SETUP
-#line 2013 "dhcp4_lexer.ll"
+#line 2085 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4985,9 +5138,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 195:
+case 203:
 YY_RULE_SETUP
-#line 2022 "dhcp4_lexer.ll"
+#line 2094 "dhcp4_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -5087,65 +5240,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 196:
-/* rule 196 can match eol */
+case 204:
+/* rule 204 can match eol */
 YY_RULE_SETUP
-#line 2121 "dhcp4_lexer.ll"
+#line 2193 "dhcp4_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 197:
-/* rule 197 can match eol */
+case 205:
+/* rule 205 can match eol */
 YY_RULE_SETUP
-#line 2126 "dhcp4_lexer.ll"
+#line 2198 "dhcp4_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 198:
+case 206:
 YY_RULE_SETUP
-#line 2131 "dhcp4_lexer.ll"
+#line 2203 "dhcp4_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 199:
+case 207:
 YY_RULE_SETUP
-#line 2136 "dhcp4_lexer.ll"
+#line 2208 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 200:
+case 208:
 YY_RULE_SETUP
-#line 2137 "dhcp4_lexer.ll"
+#line 2209 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 201:
+case 209:
 YY_RULE_SETUP
-#line 2138 "dhcp4_lexer.ll"
+#line 2210 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 202:
+case 210:
 YY_RULE_SETUP
-#line 2139 "dhcp4_lexer.ll"
+#line 2211 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 203:
+case 211:
 YY_RULE_SETUP
-#line 2140 "dhcp4_lexer.ll"
+#line 2212 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 204:
+case 212:
 YY_RULE_SETUP
-#line 2141 "dhcp4_lexer.ll"
+#line 2213 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 205:
+case 213:
 YY_RULE_SETUP
-#line 2143 "dhcp4_lexer.ll"
+#line 2215 "dhcp4_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -5164,9 +5317,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 206:
+case 214:
 YY_RULE_SETUP
-#line 2161 "dhcp4_lexer.ll"
+#line 2233 "dhcp4_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -5180,43 +5333,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 207:
+case 215:
 YY_RULE_SETUP
-#line 2174 "dhcp4_lexer.ll"
+#line 2246 "dhcp4_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp4Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 208:
+case 216:
 YY_RULE_SETUP
-#line 2179 "dhcp4_lexer.ll"
+#line 2251 "dhcp4_lexer.ll"
 {
    return isc::dhcp::Dhcp4Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 209:
+case 217:
 YY_RULE_SETUP
-#line 2183 "dhcp4_lexer.ll"
+#line 2255 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 210:
+case 218:
 YY_RULE_SETUP
-#line 2185 "dhcp4_lexer.ll"
+#line 2257 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 211:
+case 219:
 YY_RULE_SETUP
-#line 2187 "dhcp4_lexer.ll"
+#line 2259 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 212:
+case 220:
 YY_RULE_SETUP
-#line 2189 "dhcp4_lexer.ll"
+#line 2261 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 2191 "dhcp4_lexer.ll"
+#line 2263 "dhcp4_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp4Parser::make_END(driver.loc_);
@@ -5240,12 +5393,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 213:
+case 221:
 YY_RULE_SETUP
-#line 2214 "dhcp4_lexer.ll"
+#line 2286 "dhcp4_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 5249 "dhcp4_lexer.cc"
+#line 5402 "dhcp4_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -5564,7 +5717,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 2057 )
+			if ( yy_current_state >= 2161 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -5597,11 +5750,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 2057 )
+		if ( yy_current_state >= 2161 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 2056);
+	yy_is_jam = (yy_current_state == 2160);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -607,6 +607,78 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"group-commit\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_GROUP_COMMIT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("group-commit", driver.loc_);
+    }
+}
+
+\"fsync-policy\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_FSYNC_POLICY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("fsync-policy", driver.loc_);
+    }
+}
+
+\"fsync-interval\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_FSYNC_INTERVAL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("fsync-interval", driver.loc_);
+    }
+}
+
+\"wait-for-durability\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_WAIT_FOR_DURABILITY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("wait-for-durability", driver.loc_);
+    }
+}
+
+\"lfc-threads\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_THREADS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-threads", driver.loc_);
+    }
+}
+
+\"lfc-snapshot\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LFC_SNAPSHOT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lfc-snapshot", driver.loc_);
+    }
+}
+
+\"lease-stats-counters\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LEASE_STATS_COUNTERS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lease-stats-counters", driver.loc_);
+    }
+}
+
+\"lease-expiration-buckets\" {
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_LEASE_EXPIRATION_BUCKETS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("lease-expiration-buckets", driver.loc_);
+    }
+}
+
 \"valid-lifetime\" {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
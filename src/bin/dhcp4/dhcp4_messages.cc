@@ -156,6 +156,8 @@ extern const isc::log::MessageID DHCP4_STARTED = "DHCP4_STARTED";
 extern const isc::log::MessageID DHCP4_STARTING = "DHCP4_STARTING";
 extern const isc::log::MessageID DHCP4_START_INFO = "DHCP4_START_INFO";
 extern const isc::log::MessageID DHCP4_SUBNET_DATA = "DHCP4_SUBNET_DATA";
+extern const isc::log::MessageID DHCP4_SUBNET_DELTA_APPLIED = "DHCP4_SUBNET_DELTA_APPLIED";
+extern const isc::log::MessageID DHCP4_SUBNET_DELTA_APPLY_FAIL = "DHCP4_SUBNET_DELTA_APPLY_FAIL";
 extern const isc::log::MessageID DHCP4_SUBNET_DYNAMICALLY_CHANGED = "DHCP4_SUBNET_DYNAMICALLY_CHANGED";
 extern const isc::log::MessageID DHCP4_SUBNET_SELECTED = "DHCP4_SUBNET_SELECTED";
 extern const isc::log::MessageID DHCP4_SUBNET_SELECTION_FAILED = "DHCP4_SUBNET_SELECTION_FAILED";
@@ -318,6 +320,8 @@ const char* values[] = {
     "DHCP4_STARTING", "Kea DHCPv4 server version %1 (%2) starting",
     "DHCP4_START_INFO", "pid: %1, server port: %2, client port: %3, verbose: %4",
     "DHCP4_SUBNET_DATA", "%1: the selected subnet details: %2",
+    "DHCP4_SUBNET_DELTA_APPLIED", "applied subnet changes: %1 added, %2 replaced, %3 deleted",
+    "DHCP4_SUBNET_DELTA_APPLY_FAIL", "failed to apply subnet changes: %1",
     "DHCP4_SUBNET_DYNAMICALLY_CHANGED", "%1: changed selected subnet %2 to subnet %3 from shared network %4 for client assignments",
     "DHCP4_SUBNET_SELECTED", "%1: the subnet with ID %2 was selected for client assignments",
     "DHCP4_SUBNET_SELECTION_FAILED", "%1: failed to select subnet for the client",
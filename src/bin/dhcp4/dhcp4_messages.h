@@ -157,6 +157,8 @@ extern const isc::log::MessageID DHCP4_STARTED;
 extern const isc::log::MessageID DHCP4_STARTING;
 extern const isc::log::MessageID DHCP4_START_INFO;
 extern const isc::log::MessageID DHCP4_SUBNET_DATA;
+extern const isc::log::MessageID DHCP4_SUBNET_DELTA_APPLIED;
+extern const isc::log::MessageID DHCP4_SUBNET_DELTA_APPLY_FAIL;
 extern const isc::log::MessageID DHCP4_SUBNET_DYNAMICALLY_CHANGED;
 extern const isc::log::MessageID DHCP4_SUBNET_SELECTED;
 extern const isc::log::MessageID DHCP4_SUBNET_SELECTION_FAILED;
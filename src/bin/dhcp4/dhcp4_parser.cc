@@ -249,30 +249,30 @@ namespace isc { namespace dhcp {
   {
     switch (that.type_get ())
     {
-      case 225: // value
-      case 229: // map_value
-      case 270: // ddns_replace_client_name_value
-      case 292: // socket_type
-      case 295: // outbound_interface_value
-      case 317: // db_type
-      case 411: // hr_mode
-      case 569: // ncr_protocol_value
+      case 233: // value
+      case 237: // map_value
+      case 278: // ddns_replace_client_name_value
+      case 300: // socket_type
+      case 303: // outbound_interface_value
+      case 325: // db_type
+      case 428: // hr_mode
+      case 586: // ncr_protocol_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 209: // "boolean"
+      case 217: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 208: // "floating point"
+      case 216: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 207: // "integer"
+      case 215: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 206: // "constant string"
+      case 214: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -291,30 +291,30 @@ namespace isc { namespace dhcp {
   {
     switch (that.type_get ())
     {
-      case 225: // value
-      case 229: // map_value
-      case 270: // ddns_replace_client_name_value
-      case 292: // socket_type
-      case 295: // outbound_interface_value
-      case 317: // db_type
-      case 411: // hr_mode
-      case 569: // ncr_protocol_value
+      case 233: // value
+      case 237: // map_value
+      case 278: // ddns_replace_client_name_value
+      case 300: // socket_type
+      case 303: // outbound_interface_value
+      case 325: // db_type
+      case 428: // hr_mode
+      case 586: // ncr_protocol_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 209: // "boolean"
+      case 217: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 208: // "floating point"
+      case 216: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 207: // "integer"
+      case 215: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 206: // "constant string"
+      case 214: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -333,30 +333,30 @@ namespace isc { namespace dhcp {
     state = that.state;
     switch (that.type_get ())
     {
-      case 225: // value
-      case 229: // map_value
-      case 270: // ddns_replace_client_name_value
-      case 292: // socket_type
-      case 295: // outbound_interface_value
-      case 317: // db_type
-      case 411: // hr_mode
-      case 569: // ncr_protocol_value
+      case 233: // value
+      case 237: // map_value
+      case 278: // ddns_replace_client_name_value
+      case 300: // socket_type
+      case 303: // outbound_interface_value
+      case 325: // db_type
+      case 428: // hr_mode
+      case 586: // ncr_protocol_value
         value.copy< ElementPtr > (that.value);
         break;
 
-      case 209: // "boolean"
+      case 217: // "boolean"
         value.copy< bool > (that.value);
         break;
 
-      case 208: // "floating point"
+      case 216: // "floating point"
         value.copy< double > (that.value);
         break;
 
-      case 207: // "integer"
+      case 215: // "integer"
         value.copy< int64_t > (that.value);
         break;
 
-      case 206: // "constant string"
+      case 214: // "constant string"
         value.copy< std::string > (that.value);
         break;
 
@@ -374,30 +374,30 @@ namespace isc { namespace dhcp {
     state = that.state;
     switch (that.type_get ())
     {
-      case 225: // value
-      case 229: // map_value
-      case 270: // ddns_replace_client_name_value
-      case 292: // socket_type
-      case 295: // outbound_interface_value
-      case 317: // db_type
-      case 411: // hr_mode
-      case 569: // ncr_protocol_value
+      case 233: // value
+      case 237: // map_value
+      case 278: // ddns_replace_client_name_value
+      case 300: // socket_type
+      case 303: // outbound_interface_value
+      case 325: // db_type
+      case 428: // hr_mode
+      case 586: // ncr_protocol_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 209: // "boolean"
+      case 217: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 208: // "floating point"
+      case 216: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 207: // "integer"
+      case 215: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 206: // "constant string"
+      case 214: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -440,74 +440,74 @@ namespace isc { namespace dhcp {
         << yysym.location << ": ";
     switch (yytype)
     {
-      case 206: // "constant string"
-#line 290 "dhcp4_parser.yy"
+      case 214: // "constant string"
+#line 298 "dhcp4_parser.yy"
                  { yyoutput << yysym.value.template as < std::string > (); }
 #line 447 "dhcp4_parser.cc"
         break;
 
-      case 207: // "integer"
-#line 290 "dhcp4_parser.yy"
+      case 215: // "integer"
+#line 298 "dhcp4_parser.yy"
                  { yyoutput << yysym.value.template as < int64_t > (); }
 #line 453 "dhcp4_parser.cc"
         break;
 
-      case 208: // "floating point"
-#line 290 "dhcp4_parser.yy"
+      case 216: // "floating point"
+#line 298 "dhcp4_parser.yy"
                  { yyoutput << yysym.value.template as < double > (); }
 #line 459 "dhcp4_parser.cc"
         break;
 
-      case 209: // "boolean"
-#line 290 "dhcp4_parser.yy"
+      case 217: // "boolean"
+#line 298 "dhcp4_parser.yy"
                  { yyoutput << yysym.value.template as < bool > (); }
 #line 465 "dhcp4_parser.cc"
         break;
 
-      case 225: // value
-#line 290 "dhcp4_parser.yy"
+      case 233: // value
+#line 298 "dhcp4_parser.yy"
                  { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 471 "dhcp4_parser.cc"
         break;
 
-      case 229: // map_value
-#line 290 "dhcp4_parser.yy"
+      case 237: // map_value
+#line 298 "dhcp4_parser.yy"
                  { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 477 "dhcp4_parser.cc"
         break;
 
-      case 270: // ddns_replace_client_name_value
-#line 290 "dhcp4_parser.yy"
+      case 278: // ddns_replace_client_name_value
+#line 298 "dhcp4_parser.yy"
                  { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 483 "dhcp4_parser.cc"
         break;
 
-      case 292: // socket_type
-#line 290 "dhcp4_parser.yy"
+      case 300: // socket_type
+#line 298 "dhcp4_parser.yy"
                  { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 489 "dhcp4_parser.cc"
         break;
 
-      case 295: // outbound_interface_value
-#line 290 "dhcp4_parser.yy"
+      case 303: // outbound_interface_value
+#line 298 "dhcp4_parser.yy"
                  { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 495 "dhcp4_parser.cc"
         break;
 
-      case 317: // db_type
-#line 290 "dhcp4_parser.yy"
+      case 325: // db_type
+#line 298 "dhcp4_parser.yy"
                  { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 501 "dhcp4_parser.cc"
         break;
 
-      case 411: // hr_mode
-#line 290 "dhcp4_parser.yy"
+      case 428: // hr_mode
+#line 298 "dhcp4_parser.yy"
                  { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 507 "dhcp4_parser.cc"
         break;
 
-      case 569: // ncr_protocol_value
-#line 290 "dhcp4_parser.yy"
+      case 586: // ncr_protocol_value
+#line 298 "dhcp4_parser.yy"
                  { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 513 "dhcp4_parser.cc"
         break;
@@ -727,30 +727,30 @@ namespace isc { namespace dhcp {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 225: // value
-      case 229: // map_value
-      case 270: // ddns_replace_client_name_value
-      case 292: // socket_type
-      case 295: // outbound_interface_value
-      case 317: // db_type
-      case 411: // hr_mode
-      case 569: // ncr_protocol_value
+      case 233: // value
+      case 237: // map_value
+      case 278: // ddns_replace_client_name_value
+      case 300: // socket_type
+      case 303: // outbound_interface_value
+      case 325: // db_type
+      case 428: // hr_mode
+      case 586: // ncr_protocol_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 209: // "boolean"
+      case 217: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 208: // "floating point"
+      case 216: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 207: // "integer"
+      case 215: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 206: // "constant string"
+      case 214: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -775,127 +775,127 @@ namespace isc { namespace dhcp {
           switch (yyn)
             {
   case 2:
-#line 299 "dhcp4_parser.yy"
+#line 307 "dhcp4_parser.yy"
                      { ctx.ctx_ = ctx.NO_KEYWORD; }
 #line 781 "dhcp4_parser.cc"
     break;
 
   case 4:
-#line 300 "dhcp4_parser.yy"
+#line 308 "dhcp4_parser.yy"
                       { ctx.ctx_ = ctx.CONFIG; }
 #line 787 "dhcp4_parser.cc"
     break;
 
   case 6:
-#line 301 "dhcp4_parser.yy"
+#line 309 "dhcp4_parser.yy"
                  { ctx.ctx_ = ctx.DHCP4; }
 #line 793 "dhcp4_parser.cc"
     break;
 
   case 8:
-#line 302 "dhcp4_parser.yy"
+#line 310 "dhcp4_parser.yy"
                        { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
 #line 799 "dhcp4_parser.cc"
     break;
 
   case 10:
-#line 303 "dhcp4_parser.yy"
+#line 311 "dhcp4_parser.yy"
                    { ctx.ctx_ = ctx.SUBNET4; }
 #line 805 "dhcp4_parser.cc"
     break;
 
   case 12:
-#line 304 "dhcp4_parser.yy"
+#line 312 "dhcp4_parser.yy"
                  { ctx.ctx_ = ctx.POOLS; }
 #line 811 "dhcp4_parser.cc"
     break;
 
   case 14:
-#line 305 "dhcp4_parser.yy"
+#line 313 "dhcp4_parser.yy"
                        { ctx.ctx_ = ctx.RESERVATIONS; }
 #line 817 "dhcp4_parser.cc"
     break;
 
   case 16:
-#line 306 "dhcp4_parser.yy"
+#line 314 "dhcp4_parser.yy"
                        { ctx.ctx_ = ctx.DHCP4; }
 #line 823 "dhcp4_parser.cc"
     break;
 
   case 18:
-#line 307 "dhcp4_parser.yy"
+#line 315 "dhcp4_parser.yy"
                       { ctx.ctx_ = ctx.OPTION_DEF; }
 #line 829 "dhcp4_parser.cc"
     break;
 
   case 20:
-#line 308 "dhcp4_parser.yy"
+#line 316 "dhcp4_parser.yy"
                        { ctx.ctx_ = ctx.OPTION_DATA; }
 #line 835 "dhcp4_parser.cc"
     break;
 
   case 22:
-#line 309 "dhcp4_parser.yy"
+#line 317 "dhcp4_parser.yy"
                          { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
 #line 841 "dhcp4_parser.cc"
     break;
 
   case 24:
-#line 310 "dhcp4_parser.yy"
+#line 318 "dhcp4_parser.yy"
                      { ctx.ctx_ = ctx.DHCP_DDNS; }
 #line 847 "dhcp4_parser.cc"
     break;
 
   case 26:
-#line 311 "dhcp4_parser.yy"
+#line 319 "dhcp4_parser.yy"
                           { ctx.ctx_ = ctx.CONFIG_CONTROL; }
 #line 853 "dhcp4_parser.cc"
     break;
 
   case 28:
-#line 319 "dhcp4_parser.yy"
+#line 327 "dhcp4_parser.yy"
                { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
 #line 859 "dhcp4_parser.cc"
     break;
 
   case 29:
-#line 320 "dhcp4_parser.yy"
+#line 328 "dhcp4_parser.yy"
              { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
 #line 865 "dhcp4_parser.cc"
     break;
 
   case 30:
-#line 321 "dhcp4_parser.yy"
+#line 329 "dhcp4_parser.yy"
                { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
 #line 871 "dhcp4_parser.cc"
     break;
 
   case 31:
-#line 322 "dhcp4_parser.yy"
+#line 330 "dhcp4_parser.yy"
               { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
 #line 877 "dhcp4_parser.cc"
     break;
 
   case 32:
-#line 323 "dhcp4_parser.yy"
+#line 331 "dhcp4_parser.yy"
                  { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
 #line 883 "dhcp4_parser.cc"
     break;
 
   case 33:
-#line 324 "dhcp4_parser.yy"
+#line 332 "dhcp4_parser.yy"
             { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 889 "dhcp4_parser.cc"
     break;
 
   case 34:
-#line 325 "dhcp4_parser.yy"
+#line 333 "dhcp4_parser.yy"
                     { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 895 "dhcp4_parser.cc"
     break;
 
   case 35:
-#line 328 "dhcp4_parser.yy"
+#line 336 "dhcp4_parser.yy"
                 {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
@@ -904,7 +904,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 36:
-#line 333 "dhcp4_parser.yy"
+#line 341 "dhcp4_parser.yy"
                      {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -915,7 +915,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 37:
-#line 338 "dhcp4_parser.yy"
+#line 346 "dhcp4_parser.yy"
                              {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -925,13 +925,13 @@ namespace isc { namespace dhcp {
     break;
 
   case 38:
-#line 344 "dhcp4_parser.yy"
+#line 352 "dhcp4_parser.yy"
                 { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 931 "dhcp4_parser.cc"
     break;
 
   case 41:
-#line 351 "dhcp4_parser.yy"
+#line 359 "dhcp4_parser.yy"
                                   {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
@@ -940,7 +940,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 42:
-#line 355 "dhcp4_parser.yy"
+#line 363 "dhcp4_parser.yy"
                                                       {
                   // map consisting of a shorter map followed by
                   // comma and string:value
@@ -950,7 +950,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 43:
-#line 362 "dhcp4_parser.yy"
+#line 370 "dhcp4_parser.yy"
                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
@@ -959,7 +959,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 44:
-#line 365 "dhcp4_parser.yy"
+#line 373 "dhcp4_parser.yy"
                                {
     // list parsing complete. Put any sanity checking here
 }
@@ -967,7 +967,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 47:
-#line 373 "dhcp4_parser.yy"
+#line 381 "dhcp4_parser.yy"
                       {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
@@ -976,7 +976,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 48:
-#line 377 "dhcp4_parser.yy"
+#line 385 "dhcp4_parser.yy"
                                            {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
@@ -985,7 +985,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 49:
-#line 384 "dhcp4_parser.yy"
+#line 392 "dhcp4_parser.yy"
                               {
     // List parsing about to start
 }
@@ -993,7 +993,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 50:
-#line 386 "dhcp4_parser.yy"
+#line 394 "dhcp4_parser.yy"
                                        {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
@@ -1002,7 +1002,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 53:
-#line 395 "dhcp4_parser.yy"
+#line 403 "dhcp4_parser.yy"
                                {
                           ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -1011,7 +1011,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 54:
-#line 399 "dhcp4_parser.yy"
+#line 407 "dhcp4_parser.yy"
                                                             {
                           ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -1020,7 +1020,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 55:
-#line 410 "dhcp4_parser.yy"
+#line 418 "dhcp4_parser.yy"
                                 {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as < std::string > ();
@@ -1031,7 +1031,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 56:
-#line 419 "dhcp4_parser.yy"
+#line 427 "dhcp4_parser.yy"
                            {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -1042,7 +1042,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 57:
-#line 424 "dhcp4_parser.yy"
+#line 432 "dhcp4_parser.yy"
                                 {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -1055,7 +1055,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 61:
-#line 442 "dhcp4_parser.yy"
+#line 450 "dhcp4_parser.yy"
                     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -1070,7 +1070,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 62:
-#line 451 "dhcp4_parser.yy"
+#line 459 "dhcp4_parser.yy"
                                                     {
     // No global parameter is required
     ctx.stack_.pop_back();
@@ -1080,7 +1080,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 63:
-#line 459 "dhcp4_parser.yy"
+#line 467 "dhcp4_parser.yy"
                           {
     // Parse the Dhcp4 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -1090,7 +1090,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 64:
-#line 463 "dhcp4_parser.yy"
+#line 471 "dhcp4_parser.yy"
                                {
     // No global parameter is required
     // parsing completed
@@ -1099,7 +1099,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 128:
-#line 537 "dhcp4_parser.yy"
+#line 545 "dhcp4_parser.yy"
                                              {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
@@ -1108,7 +1108,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 129:
-#line 542 "dhcp4_parser.yy"
+#line 550 "dhcp4_parser.yy"
                                                      {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("min-valid-lifetime", prf);
@@ -1117,7 +1117,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 130:
-#line 547 "dhcp4_parser.yy"
+#line 555 "dhcp4_parser.yy"
                                                      {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-valid-lifetime", prf);
@@ -1126,7 +1126,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 131:
-#line 552 "dhcp4_parser.yy"
+#line 560 "dhcp4_parser.yy"
                                        {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
@@ -1135,7 +1135,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 132:
-#line 557 "dhcp4_parser.yy"
+#line 565 "dhcp4_parser.yy"
                                          {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
@@ -1144,7 +1144,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 133:
-#line 562 "dhcp4_parser.yy"
+#line 570 "dhcp4_parser.yy"
                                                        {
     ElementPtr ctt(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("calculate-tee-times", ctt);
@@ -1153,7 +1153,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 134:
-#line 567 "dhcp4_parser.yy"
+#line 575 "dhcp4_parser.yy"
                                    {
     ElementPtr t1(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("t1-percent", t1);
@@ -1162,7 +1162,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 135:
-#line 572 "dhcp4_parser.yy"
+#line 580 "dhcp4_parser.yy"
                                    {
     ElementPtr t2(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("t2-percent", t2);
@@ -1171,7 +1171,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 136:
-#line 577 "dhcp4_parser.yy"
+#line 585 "dhcp4_parser.yy"
                                                                  {
     ElementPtr dpp(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
@@ -1180,7 +1180,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 137:
-#line 582 "dhcp4_parser.yy"
+#line 590 "dhcp4_parser.yy"
                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1188,7 +1188,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 138:
-#line 584 "dhcp4_parser.yy"
+#line 592 "dhcp4_parser.yy"
                {
     ElementPtr stag(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-tag", stag);
@@ -1198,7 +1198,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 139:
-#line 590 "dhcp4_parser.yy"
+#line 598 "dhcp4_parser.yy"
                                              {
     ElementPtr echo(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("echo-client-id", echo);
@@ -1207,7 +1207,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 140:
-#line 595 "dhcp4_parser.yy"
+#line 603 "dhcp4_parser.yy"
                                                {
     ElementPtr match(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("match-client-id", match);
@@ -1216,7 +1216,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 141:
-#line 600 "dhcp4_parser.yy"
+#line 608 "dhcp4_parser.yy"
                                            {
     ElementPtr prf(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("authoritative", prf);
@@ -1225,7 +1225,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 142:
-#line 605 "dhcp4_parser.yy"
+#line 613 "dhcp4_parser.yy"
                                                    {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-send-updates", b);
@@ -1234,7 +1234,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 143:
-#line 610 "dhcp4_parser.yy"
+#line 618 "dhcp4_parser.yy"
                                                                {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-override-no-update", b);
@@ -1243,7 +1243,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 144:
-#line 615 "dhcp4_parser.yy"
+#line 623 "dhcp4_parser.yy"
                                                                        {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-override-client-update", b);
@@ -1252,7 +1252,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 145:
-#line 620 "dhcp4_parser.yy"
+#line 628 "dhcp4_parser.yy"
                                                    {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
@@ -1260,7 +1260,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 146:
-#line 622 "dhcp4_parser.yy"
+#line 630 "dhcp4_parser.yy"
                                        {
     ctx.stack_.back()->set("ddns-replace-client-name", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
@@ -1269,7 +1269,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 147:
-#line 628 "dhcp4_parser.yy"
+#line 636 "dhcp4_parser.yy"
                  {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location)));
       }
@@ -1277,7 +1277,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 148:
-#line 631 "dhcp4_parser.yy"
+#line 639 "dhcp4_parser.yy"
           {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
@@ -1285,7 +1285,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 149:
-#line 634 "dhcp4_parser.yy"
+#line 642 "dhcp4_parser.yy"
            {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
@@ -1293,7 +1293,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 150:
-#line 637 "dhcp4_parser.yy"
+#line 645 "dhcp4_parser.yy"
                      {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
@@ -1301,7 +1301,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 151:
-#line 640 "dhcp4_parser.yy"
+#line 648 "dhcp4_parser.yy"
             {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
@@ -1310,7 +1310,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 152:
-#line 646 "dhcp4_parser.yy"
+#line 654 "dhcp4_parser.yy"
                                              {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1318,7 +1318,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 153:
-#line 648 "dhcp4_parser.yy"
+#line 656 "dhcp4_parser.yy"
                {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-generated-prefix", s);
@@ -1328,7 +1328,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 154:
-#line 654 "dhcp4_parser.yy"
+#line 662 "dhcp4_parser.yy"
                                                {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1336,7 +1336,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 155:
-#line 656 "dhcp4_parser.yy"
+#line 664 "dhcp4_parser.yy"
                {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-qualifying-suffix", s);
@@ -1346,7 +1346,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 156:
-#line 662 "dhcp4_parser.yy"
+#line 670 "dhcp4_parser.yy"
                                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1354,7 +1354,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 157:
-#line 664 "dhcp4_parser.yy"
+#line 672 "dhcp4_parser.yy"
                {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-set", s);
@@ -1364,7 +1364,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 158:
-#line 670 "dhcp4_parser.yy"
+#line 678 "dhcp4_parser.yy"
                                                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1372,7 +1372,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 159:
-#line 672 "dhcp4_parser.yy"
+#line 680 "dhcp4_parser.yy"
                {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-replacement", s);
@@ -1382,7 +1382,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 160:
-#line 678 "dhcp4_parser.yy"
+#line 686 "dhcp4_parser.yy"
                                                        {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("store-extended-info", b);
@@ -1391,7 +1391,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 161:
-#line 683 "dhcp4_parser.yy"
+#line 691 "dhcp4_parser.yy"
                                                                              {
     ElementPtr count(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("statistic-default-sample-count", count);
@@ -1400,7 +1400,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 162:
-#line 688 "dhcp4_parser.yy"
+#line 696 "dhcp4_parser.yy"
                                                                          {
     ElementPtr age(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("statistic-default-sample-age", age);
@@ -1409,7 +1409,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 163:
-#line 693 "dhcp4_parser.yy"
+#line 701 "dhcp4_parser.yy"
                                      {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
@@ -1420,7 +1420,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 164:
-#line 698 "dhcp4_parser.yy"
+#line 706 "dhcp4_parser.yy"
                                                                {
     // No interfaces config param is required
     ctx.stack_.pop_back();
@@ -1430,7 +1430,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 174:
-#line 717 "dhcp4_parser.yy"
+#line 725 "dhcp4_parser.yy"
                                 {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -1440,7 +1440,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 175:
-#line 721 "dhcp4_parser.yy"
+#line 729 "dhcp4_parser.yy"
                                           {
     // No interfaces config param is required
     // parsing completed
@@ -1449,7 +1449,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 176:
-#line 726 "dhcp4_parser.yy"
+#line 734 "dhcp4_parser.yy"
                             {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
@@ -1460,7 +1460,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 177:
-#line 731 "dhcp4_parser.yy"
+#line 739 "dhcp4_parser.yy"
                      {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1469,7 +1469,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 178:
-#line 736 "dhcp4_parser.yy"
+#line 744 "dhcp4_parser.yy"
                                    {
     ctx.enter(ctx.DHCP_SOCKET_TYPE);
 }
@@ -1477,7 +1477,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 179:
-#line 738 "dhcp4_parser.yy"
+#line 746 "dhcp4_parser.yy"
                     {
     ctx.stack_.back()->set("dhcp-socket-type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
@@ -1486,19 +1486,19 @@ namespace isc { namespace dhcp {
     break;
 
   case 180:
-#line 743 "dhcp4_parser.yy"
+#line 751 "dhcp4_parser.yy"
                  { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("raw", ctx.loc2pos(yystack_[0].location))); }
 #line 1492 "dhcp4_parser.cc"
     break;
 
   case 181:
-#line 744 "dhcp4_parser.yy"
+#line 752 "dhcp4_parser.yy"
                  { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("udp", ctx.loc2pos(yystack_[0].location))); }
 #line 1498 "dhcp4_parser.cc"
     break;
 
   case 182:
-#line 747 "dhcp4_parser.yy"
+#line 755 "dhcp4_parser.yy"
                                        {
     ctx.enter(ctx.OUTBOUND_INTERFACE);
 }
@@ -1506,7 +1506,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 183:
-#line 749 "dhcp4_parser.yy"
+#line 757 "dhcp4_parser.yy"
                                  {
     ctx.stack_.back()->set("outbound-interface", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
@@ -1515,7 +1515,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 184:
-#line 754 "dhcp4_parser.yy"
+#line 762 "dhcp4_parser.yy"
                                           {
     yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("same-as-inbound", ctx.loc2pos(yystack_[0].location)));
 }
@@ -1523,7 +1523,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 185:
-#line 756 "dhcp4_parser.yy"
+#line 764 "dhcp4_parser.yy"
                 {
     yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("use-routing", ctx.loc2pos(yystack_[0].location)));
     }
@@ -1531,7 +1531,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 186:
-#line 760 "dhcp4_parser.yy"
+#line 768 "dhcp4_parser.yy"
                                    {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("re-detect", b);
@@ -1540,7 +1540,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 187:
-#line 766 "dhcp4_parser.yy"
+#line 774 "dhcp4_parser.yy"
                                {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
@@ -1551,7 +1551,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 188:
-#line 771 "dhcp4_parser.yy"
+#line 779 "dhcp4_parser.yy"
                                                           {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
@@ -1562,7 +1562,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 189:
-#line 778 "dhcp4_parser.yy"
+#line 786 "dhcp4_parser.yy"
                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sanity-checks", m);
@@ -1573,7 +1573,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 190:
-#line 783 "dhcp4_parser.yy"
+#line 791 "dhcp4_parser.yy"
                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1582,7 +1582,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 194:
-#line 793 "dhcp4_parser.yy"
+#line 801 "dhcp4_parser.yy"
                            {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1590,7 +1590,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 195:
-#line 795 "dhcp4_parser.yy"
+#line 803 "dhcp4_parser.yy"
                {
 
     if ( (string(yystack_[0].value.as < std::string > ()) == "none") ||
@@ -1610,7 +1610,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 196:
-#line 811 "dhcp4_parser.yy"
+#line 819 "dhcp4_parser.yy"
                                {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
@@ -1621,7 +1621,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 197:
-#line 816 "dhcp4_parser.yy"
+#line 824 "dhcp4_parser.yy"
                                                           {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
@@ -1632,7 +1632,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 198:
-#line 823 "dhcp4_parser.yy"
+#line 831 "dhcp4_parser.yy"
                                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-databases", l);
@@ -1643,7 +1643,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 199:
-#line 828 "dhcp4_parser.yy"
+#line 836 "dhcp4_parser.yy"
                                                       {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1652,7 +1652,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 204:
-#line 841 "dhcp4_parser.yy"
+#line 849 "dhcp4_parser.yy"
                          {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
@@ -1662,7 +1662,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 205:
-#line 845 "dhcp4_parser.yy"
+#line 853 "dhcp4_parser.yy"
                                      {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -1671,16 +1671,16 @@ namespace isc { namespace dhcp {
 #line 1672 "dhcp4_parser.cc"
     break;
 
-  case 232:
-#line 881 "dhcp4_parser.yy"
+  case 240:
+#line 897 "dhcp4_parser.yy"
                     {
     ctx.enter(ctx.DATABASE_TYPE);
 }
 #line 1680 "dhcp4_parser.cc"
     break;
 
-  case 233:
-#line 883 "dhcp4_parser.yy"
+  case 241:
+#line 899 "dhcp4_parser.yy"
                 {
     ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
@@ -1688,40 +1688,40 @@ namespace isc { namespace dhcp {
 #line 1689 "dhcp4_parser.cc"
     break;
 
-  case 234:
-#line 888 "dhcp4_parser.yy"
+  case 242:
+#line 904 "dhcp4_parser.yy"
                  { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
 #line 1695 "dhcp4_parser.cc"
     break;
 
-  case 235:
-#line 889 "dhcp4_parser.yy"
+  case 243:
+#line 905 "dhcp4_parser.yy"
                { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
 #line 1701 "dhcp4_parser.cc"
     break;
 
-  case 236:
-#line 890 "dhcp4_parser.yy"
+  case 244:
+#line 906 "dhcp4_parser.yy"
                     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
 #line 1707 "dhcp4_parser.cc"
     break;
 
-  case 237:
-#line 891 "dhcp4_parser.yy"
+  case 245:
+#line 907 "dhcp4_parser.yy"
              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
 #line 1713 "dhcp4_parser.cc"
     break;
 
-  case 238:
-#line 894 "dhcp4_parser.yy"
+  case 246:
+#line 910 "dhcp4_parser.yy"
            {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1721 "dhcp4_parser.cc"
     break;
 
-  case 239:
-#line 896 "dhcp4_parser.yy"
+  case 247:
+#line 912 "dhcp4_parser.yy"
                {
     ElementPtr user(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
@@ -1730,16 +1730,16 @@ namespace isc { namespace dhcp {
 #line 1731 "dhcp4_parser.cc"
     break;
 
-  case 240:
-#line 902 "dhcp4_parser.yy"
+  case 248:
+#line 918 "dhcp4_parser.yy"
                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1739 "dhcp4_parser.cc"
     break;
 
-  case 241:
-#line 904 "dhcp4_parser.yy"
+  case 249:
+#line 920 "dhcp4_parser.yy"
                {
     ElementPtr pwd(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
@@ -1748,16 +1748,16 @@ namespace isc { namespace dhcp {
 #line 1749 "dhcp4_parser.cc"
     break;
 
-  case 242:
-#line 910 "dhcp4_parser.yy"
+  case 250:
+#line 926 "dhcp4_parser.yy"
            {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1757 "dhcp4_parser.cc"
     break;
 
-  case 243:
-#line 912 "dhcp4_parser.yy"
+  case 251:
+#line 928 "dhcp4_parser.yy"
                {
     ElementPtr h(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
@@ -1766,8 +1766,8 @@ namespace isc { namespace dhcp {
 #line 1767 "dhcp4_parser.cc"
     break;
 
-  case 244:
-#line 918 "dhcp4_parser.yy"
+  case 252:
+#line 934 "dhcp4_parser.yy"
                          {
     ElementPtr p(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", p);
@@ -1775,16 +1775,16 @@ namespace isc { namespace dhcp {
 #line 1776 "dhcp4_parser.cc"
     break;
 
-  case 245:
-#line 923 "dhcp4_parser.yy"
+  case 253:
+#line 939 "dhcp4_parser.yy"
            {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1784 "dhcp4_parser.cc"
     break;
 
-  case 246:
-#line 925 "dhcp4_parser.yy"
+  case 254:
+#line 941 "dhcp4_parser.yy"
                {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
@@ -1793,8 +1793,8 @@ namespace isc { namespace dhcp {
 #line 1794 "dhcp4_parser.cc"
     break;
 
-  case 247:
-#line 931 "dhcp4_parser.yy"
+  case 255:
+#line 947 "dhcp4_parser.yy"
                                {
     ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
@@ -1802,8 +1802,8 @@ namespace isc { namespace dhcp {
 #line 1803 "dhcp4_parser.cc"
     break;
 
-  case 248:
-#line 936 "dhcp4_parser.yy"
+  case 256:
+#line 952 "dhcp4_parser.yy"
                                          {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
@@ -1811,8 +1811,8 @@ namespace isc { namespace dhcp {
 #line 1812 "dhcp4_parser.cc"
     break;
 
-  case 249:
-#line 941 "dhcp4_parser.yy"
+  case 257:
+#line 957 "dhcp4_parser.yy"
                                  {
     ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
@@ -1820,8 +1820,8 @@ namespace isc { namespace dhcp {
 #line 1821 "dhcp4_parser.cc"
     break;
 
-  case 250:
-#line 946 "dhcp4_parser.yy"
+  case 258:
+#line 962 "dhcp4_parser.yy"
                                                {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
@@ -1829,8 +1829,8 @@ namespace isc { namespace dhcp {
 #line 1830 "dhcp4_parser.cc"
     break;
 
-  case 251:
-#line 951 "dhcp4_parser.yy"
+  case 259:
+#line 967 "dhcp4_parser.yy"
                                                {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("request-timeout", n);
@@ -1838,8 +1838,8 @@ namespace isc { namespace dhcp {
 #line 1839 "dhcp4_parser.cc"
     break;
 
-  case 252:
-#line 956 "dhcp4_parser.yy"
+  case 260:
+#line 972 "dhcp4_parser.yy"
                                            {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-keepalive", n);
@@ -1847,8 +1847,8 @@ namespace isc { namespace dhcp {
 #line 1848 "dhcp4_parser.cc"
     break;
 
-  case 253:
-#line 961 "dhcp4_parser.yy"
+  case 261:
+#line 977 "dhcp4_parser.yy"
                                        {
     ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-nodelay", n);
@@ -1856,16 +1856,16 @@ namespace isc { namespace dhcp {
 #line 1857 "dhcp4_parser.cc"
     break;
 
-  case 254:
-#line 966 "dhcp4_parser.yy"
+  case 262:
+#line 982 "dhcp4_parser.yy"
                                {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1865 "dhcp4_parser.cc"
     break;
 
-  case 255:
-#line 968 "dhcp4_parser.yy"
+  case 263:
+#line 984 "dhcp4_parser.yy"
                {
     ElementPtr cp(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("contact-points", cp);
@@ -1874,16 +1874,16 @@ namespace isc { namespace dhcp {
 #line 1875 "dhcp4_parser.cc"
     break;
 
-  case 256:
-#line 974 "dhcp4_parser.yy"
+  case 264:
+#line 990 "dhcp4_parser.yy"
                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1883 "dhcp4_parser.cc"
     break;
 
-  case 257:
-#line 976 "dhcp4_parser.yy"
+  case 265:
+#line 992 "dhcp4_parser.yy"
                {
     ElementPtr ks(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("keyspace", ks);
@@ -1892,16 +1892,16 @@ namespace isc { namespace dhcp {
 #line 1893 "dhcp4_parser.cc"
     break;
 
-  case 258:
-#line 982 "dhcp4_parser.yy"
+  case 266:
+#line 998 "dhcp4_parser.yy"
                          {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1901 "dhcp4_parser.cc"
     break;
 
-  case 259:
-#line 984 "dhcp4_parser.yy"
+  case 267:
+#line 1000 "dhcp4_parser.yy"
                {
     ElementPtr c(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("consistency", c);
@@ -1910,16 +1910,16 @@ namespace isc { namespace dhcp {
 #line 1911 "dhcp4_parser.cc"
     break;
 
-  case 260:
-#line 990 "dhcp4_parser.yy"
+  case 268:
+#line 1006 "dhcp4_parser.yy"
                                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1919 "dhcp4_parser.cc"
     break;
 
-  case 261:
-#line 992 "dhcp4_parser.yy"
+  case 269:
+#line 1008 "dhcp4_parser.yy"
                {
     ElementPtr c(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("serial-consistency", c);
@@ -1928,8 +1928,8 @@ namespace isc { namespace dhcp {
 #line 1929 "dhcp4_parser.cc"
     break;
 
-  case 262:
-#line 998 "dhcp4_parser.yy"
+  case 270:
+#line 1014 "dhcp4_parser.yy"
                                                        {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reconnect-tries", n);
@@ -1937,8 +1937,8 @@ namespace isc { namespace dhcp {
 #line 1938 "dhcp4_parser.cc"
     break;
 
-  case 263:
-#line 1003 "dhcp4_parser.yy"
+  case 271:
+#line 1019 "dhcp4_parser.yy"
                                                        {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reconnect-wait-time", n);
@@ -1946,8 +1946,8 @@ namespace isc { namespace dhcp {
 #line 1947 "dhcp4_parser.cc"
     break;
 
-  case 264:
-#line 1008 "dhcp4_parser.yy"
+  case 272:
+#line 1024 "dhcp4_parser.yy"
                                              {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-row-errors", n);
@@ -1955,322 +1955,403 @@ namespace isc { namespace dhcp {
 #line 1956 "dhcp4_parser.cc"
     break;
 
-  case 265:
-#line 1014 "dhcp4_parser.yy"
+  case 273:
+#line 1029 "dhcp4_parser.yy"
+                                         {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("group-commit", n);
+}
+#line 1965 "dhcp4_parser.cc"
+    break;
+
+  case 274:
+#line 1034 "dhcp4_parser.yy"
+                           {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1973 "dhcp4_parser.cc"
+    break;
+
+  case 275:
+#line 1036 "dhcp4_parser.yy"
+               {
+    ElementPtr n(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("fsync-policy", n);
+    ctx.leave();
+}
+#line 1983 "dhcp4_parser.cc"
+    break;
+
+  case 276:
+#line 1042 "dhcp4_parser.yy"
+                                             {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("fsync-interval", n);
+}
+#line 1992 "dhcp4_parser.cc"
+    break;
+
+  case 277:
+#line 1047 "dhcp4_parser.yy"
+                                                       {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("wait-for-durability", n);
+}
+#line 2001 "dhcp4_parser.cc"
+    break;
+
+  case 278:
+#line 1052 "dhcp4_parser.yy"
+                                       {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-threads", n);
+}
+#line 2010 "dhcp4_parser.cc"
+    break;
+
+  case 279:
+#line 1057 "dhcp4_parser.yy"
+                                         {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-snapshot", n);
+}
+#line 2019 "dhcp4_parser.cc"
+    break;
+
+  case 280:
+#line 1062 "dhcp4_parser.yy"
+                                                         {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lease-stats-counters", n);
+}
+#line 2028 "dhcp4_parser.cc"
+    break;
+
+  case 281:
+#line 1067 "dhcp4_parser.yy"
+                                                                 {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lease-expiration-buckets", n);
+}
+#line 2037 "dhcp4_parser.cc"
+    break;
+
+  case 282:
+#line 1073 "dhcp4_parser.yy"
                                                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOST_RESERVATION_IDENTIFIERS);
 }
-#line 1967 "dhcp4_parser.cc"
+#line 2048 "dhcp4_parser.cc"
     break;
 
-  case 266:
-#line 1019 "dhcp4_parser.yy"
+  case 283:
+#line 1078 "dhcp4_parser.yy"
                                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1976 "dhcp4_parser.cc"
+#line 2057 "dhcp4_parser.cc"
     break;
 
-  case 274:
-#line 1035 "dhcp4_parser.yy"
+  case 291:
+#line 1094 "dhcp4_parser.yy"
                {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1985 "dhcp4_parser.cc"
+#line 2066 "dhcp4_parser.cc"
     break;
 
-  case 275:
-#line 1040 "dhcp4_parser.yy"
+  case 292:
+#line 1099 "dhcp4_parser.yy"
                            {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
 }
-#line 1994 "dhcp4_parser.cc"
+#line 2075 "dhcp4_parser.cc"
     break;
 
-  case 276:
-#line 1045 "dhcp4_parser.yy"
+  case 293:
+#line 1104 "dhcp4_parser.yy"
                         {
     ElementPtr circuit(new StringElement("circuit-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(circuit);
 }
-#line 2003 "dhcp4_parser.cc"
+#line 2084 "dhcp4_parser.cc"
     break;
 
-  case 277:
-#line 1050 "dhcp4_parser.yy"
+  case 294:
+#line 1109 "dhcp4_parser.yy"
                       {
     ElementPtr client(new StringElement("client-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(client);
 }
-#line 2012 "dhcp4_parser.cc"
+#line 2093 "dhcp4_parser.cc"
     break;
 
-  case 278:
-#line 1055 "dhcp4_parser.yy"
+  case 295:
+#line 1114 "dhcp4_parser.yy"
                  {
     ElementPtr flex_id(new StringElement("flex-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(flex_id);
 }
-#line 2021 "dhcp4_parser.cc"
+#line 2102 "dhcp4_parser.cc"
     break;
 
-  case 279:
-#line 1062 "dhcp4_parser.yy"
+  case 296:
+#line 1121 "dhcp4_parser.yy"
                                            {
     ElementPtr mt(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("multi-threading", mt);
     ctx.stack_.push_back(mt);
     ctx.enter(ctx.DHCP_MULTI_THREADING);
 }
-#line 2032 "dhcp4_parser.cc"
+#line 2113 "dhcp4_parser.cc"
     break;
 
-  case 280:
-#line 1067 "dhcp4_parser.yy"
+  case 297:
+#line 1126 "dhcp4_parser.yy"
                                                              {
     // The enable parameter is required.
     ctx.require("enable-multi-threading", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2043 "dhcp4_parser.cc"
+#line 2124 "dhcp4_parser.cc"
     break;
 
-  case 289:
-#line 1086 "dhcp4_parser.yy"
+  case 306:
+#line 1145 "dhcp4_parser.yy"
                                                              {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-multi-threading", b);
 }
-#line 2052 "dhcp4_parser.cc"
+#line 2133 "dhcp4_parser.cc"
     break;
 
-  case 290:
-#line 1091 "dhcp4_parser.yy"
+  case 307:
+#line 1150 "dhcp4_parser.yy"
                                                  {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("thread-pool-size", prf);
 }
-#line 2061 "dhcp4_parser.cc"
+#line 2142 "dhcp4_parser.cc"
     break;
 
-  case 291:
-#line 1096 "dhcp4_parser.yy"
+  case 308:
+#line 1155 "dhcp4_parser.yy"
                                                    {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("packet-queue-size", prf);
 }
-#line 2070 "dhcp4_parser.cc"
+#line 2151 "dhcp4_parser.cc"
     break;
 
-  case 292:
-#line 1101 "dhcp4_parser.yy"
+  case 309:
+#line 1160 "dhcp4_parser.yy"
                                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 2081 "dhcp4_parser.cc"
+#line 2162 "dhcp4_parser.cc"
     break;
 
-  case 293:
-#line 1106 "dhcp4_parser.yy"
+  case 310:
+#line 1165 "dhcp4_parser.yy"
                                                              {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2090 "dhcp4_parser.cc"
+#line 2171 "dhcp4_parser.cc"
     break;
 
-  case 298:
-#line 1119 "dhcp4_parser.yy"
+  case 315:
+#line 1178 "dhcp4_parser.yy"
                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2100 "dhcp4_parser.cc"
+#line 2181 "dhcp4_parser.cc"
     break;
 
-  case 299:
-#line 1123 "dhcp4_parser.yy"
+  case 316:
+#line 1182 "dhcp4_parser.yy"
                               {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2110 "dhcp4_parser.cc"
+#line 2191 "dhcp4_parser.cc"
     break;
 
-  case 300:
-#line 1129 "dhcp4_parser.yy"
+  case 317:
+#line 1188 "dhcp4_parser.yy"
                                   {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2120 "dhcp4_parser.cc"
+#line 2201 "dhcp4_parser.cc"
     break;
 
-  case 301:
-#line 1133 "dhcp4_parser.yy"
+  case 318:
+#line 1192 "dhcp4_parser.yy"
                               {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2130 "dhcp4_parser.cc"
+#line 2211 "dhcp4_parser.cc"
     break;
 
-  case 309:
-#line 1150 "dhcp4_parser.yy"
+  case 326:
+#line 1209 "dhcp4_parser.yy"
                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2138 "dhcp4_parser.cc"
+#line 2219 "dhcp4_parser.cc"
     break;
 
-  case 310:
-#line 1152 "dhcp4_parser.yy"
+  case 327:
+#line 1211 "dhcp4_parser.yy"
                {
     ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 2148 "dhcp4_parser.cc"
+#line 2229 "dhcp4_parser.cc"
     break;
 
-  case 311:
-#line 1158 "dhcp4_parser.yy"
+  case 328:
+#line 1217 "dhcp4_parser.yy"
                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2156 "dhcp4_parser.cc"
+#line 2237 "dhcp4_parser.cc"
     break;
 
-  case 312:
-#line 1160 "dhcp4_parser.yy"
+  case 329:
+#line 1219 "dhcp4_parser.yy"
                   {
     ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2165 "dhcp4_parser.cc"
+#line 2246 "dhcp4_parser.cc"
     break;
 
-  case 313:
-#line 1166 "dhcp4_parser.yy"
+  case 330:
+#line 1225 "dhcp4_parser.yy"
                                                      {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.EXPIRED_LEASES_PROCESSING);
 }
-#line 2176 "dhcp4_parser.cc"
+#line 2257 "dhcp4_parser.cc"
     break;
 
-  case 314:
-#line 1171 "dhcp4_parser.yy"
+  case 331:
+#line 1230 "dhcp4_parser.yy"
                                                             {
     // No expired lease parameter is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2186 "dhcp4_parser.cc"
+#line 2267 "dhcp4_parser.cc"
     break;
 
-  case 323:
-#line 1189 "dhcp4_parser.yy"
+  case 340:
+#line 1248 "dhcp4_parser.yy"
                                                                {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
 }
-#line 2195 "dhcp4_parser.cc"
+#line 2276 "dhcp4_parser.cc"
     break;
 
-  case 324:
-#line 1194 "dhcp4_parser.yy"
+  case 341:
+#line 1253 "dhcp4_parser.yy"
                                                                                {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
 }
-#line 2204 "dhcp4_parser.cc"
+#line 2285 "dhcp4_parser.cc"
     break;
 
-  case 325:
-#line 1199 "dhcp4_parser.yy"
+  case 342:
+#line 1258 "dhcp4_parser.yy"
                                                        {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 }
-#line 2213 "dhcp4_parser.cc"
+#line 2294 "dhcp4_parser.cc"
     break;
 
-  case 326:
-#line 1204 "dhcp4_parser.yy"
+  case 343:
+#line 1263 "dhcp4_parser.yy"
                                                      {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
 }
-#line 2222 "dhcp4_parser.cc"
+#line 2303 "dhcp4_parser.cc"
     break;
 
-  case 327:
-#line 1209 "dhcp4_parser.yy"
+  case 344:
+#line 1268 "dhcp4_parser.yy"
                                                  {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
 }
-#line 2231 "dhcp4_parser.cc"
+#line 2312 "dhcp4_parser.cc"
     break;
 
-  case 328:
-#line 1214 "dhcp4_parser.yy"
+  case 345:
+#line 1273 "dhcp4_parser.yy"
                                                                {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 }
-#line 2240 "dhcp4_parser.cc"
+#line 2321 "dhcp4_parser.cc"
     break;
 
-  case 329:
-#line 1222 "dhcp4_parser.yy"
+  case 346:
+#line 1281 "dhcp4_parser.yy"
                       {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet4", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SUBNET4);
 }
-#line 2251 "dhcp4_parser.cc"
+#line 2332 "dhcp4_parser.cc"
     break;
 
-  case 330:
-#line 1227 "dhcp4_parser.yy"
+  case 347:
+#line 1286 "dhcp4_parser.yy"
                                                              {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2260 "dhcp4_parser.cc"
+#line 2341 "dhcp4_parser.cc"
     break;
 
-  case 335:
-#line 1247 "dhcp4_parser.yy"
+  case 352:
+#line 1306 "dhcp4_parser.yy"
                         {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2270 "dhcp4_parser.cc"
+#line 2351 "dhcp4_parser.cc"
     break;
 
-  case 336:
-#line 1251 "dhcp4_parser.yy"
+  case 353:
+#line 1310 "dhcp4_parser.yy"
                                 {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
@@ -2292,294 +2373,294 @@ namespace isc { namespace dhcp {
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2296 "dhcp4_parser.cc"
+#line 2377 "dhcp4_parser.cc"
     break;
 
-  case 337:
-#line 1273 "dhcp4_parser.yy"
+  case 354:
+#line 1332 "dhcp4_parser.yy"
                             {
     // Parse the subnet4 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2306 "dhcp4_parser.cc"
+#line 2387 "dhcp4_parser.cc"
     break;
 
-  case 338:
-#line 1277 "dhcp4_parser.yy"
+  case 355:
+#line 1336 "dhcp4_parser.yy"
                                 {
     // The subnet subnet4 parameter is required
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2316 "dhcp4_parser.cc"
+#line 2397 "dhcp4_parser.cc"
     break;
 
-  case 383:
-#line 1333 "dhcp4_parser.yy"
+  case 400:
+#line 1392 "dhcp4_parser.yy"
                {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2324 "dhcp4_parser.cc"
+#line 2405 "dhcp4_parser.cc"
     break;
 
-  case 384:
-#line 1335 "dhcp4_parser.yy"
+  case 401:
+#line 1394 "dhcp4_parser.yy"
                {
     ElementPtr subnet(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
     ctx.leave();
 }
-#line 2334 "dhcp4_parser.cc"
+#line 2415 "dhcp4_parser.cc"
     break;
 
-  case 385:
-#line 1341 "dhcp4_parser.yy"
+  case 402:
+#line 1400 "dhcp4_parser.yy"
                                            {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2342 "dhcp4_parser.cc"
+#line 2423 "dhcp4_parser.cc"
     break;
 
-  case 386:
-#line 1343 "dhcp4_parser.yy"
+  case 403:
+#line 1402 "dhcp4_parser.yy"
                {
     ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-interface", iface);
     ctx.leave();
 }
-#line 2352 "dhcp4_parser.cc"
+#line 2433 "dhcp4_parser.cc"
     break;
 
-  case 387:
-#line 1349 "dhcp4_parser.yy"
+  case 404:
+#line 1408 "dhcp4_parser.yy"
                                                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2360 "dhcp4_parser.cc"
+#line 2441 "dhcp4_parser.cc"
     break;
 
-  case 388:
-#line 1351 "dhcp4_parser.yy"
+  case 405:
+#line 1410 "dhcp4_parser.yy"
                {
     ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-interface-id", iface);
     ctx.leave();
 }
-#line 2370 "dhcp4_parser.cc"
+#line 2451 "dhcp4_parser.cc"
     break;
 
-  case 389:
-#line 1357 "dhcp4_parser.yy"
+  case 406:
+#line 1416 "dhcp4_parser.yy"
                                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2378 "dhcp4_parser.cc"
+#line 2459 "dhcp4_parser.cc"
     break;
 
-  case 390:
-#line 1359 "dhcp4_parser.yy"
+  case 407:
+#line 1418 "dhcp4_parser.yy"
                {
     ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-subnet", iface);
     ctx.leave();
 }
-#line 2388 "dhcp4_parser.cc"
+#line 2469 "dhcp4_parser.cc"
     break;
 
-  case 391:
-#line 1365 "dhcp4_parser.yy"
+  case 408:
+#line 1424 "dhcp4_parser.yy"
                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2396 "dhcp4_parser.cc"
+#line 2477 "dhcp4_parser.cc"
     break;
 
-  case 392:
-#line 1367 "dhcp4_parser.yy"
+  case 409:
+#line 1426 "dhcp4_parser.yy"
                {
     ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
     ctx.leave();
 }
-#line 2406 "dhcp4_parser.cc"
+#line 2487 "dhcp4_parser.cc"
     break;
 
-  case 393:
-#line 1373 "dhcp4_parser.yy"
+  case 410:
+#line 1432 "dhcp4_parser.yy"
                            {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2414 "dhcp4_parser.cc"
+#line 2495 "dhcp4_parser.cc"
     break;
 
-  case 394:
-#line 1375 "dhcp4_parser.yy"
+  case 411:
+#line 1434 "dhcp4_parser.yy"
                {
     ElementPtr cls(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
     ctx.leave();
 }
-#line 2424 "dhcp4_parser.cc"
+#line 2505 "dhcp4_parser.cc"
     break;
 
-  case 395:
-#line 1381 "dhcp4_parser.yy"
+  case 412:
+#line 1440 "dhcp4_parser.yy"
                                                {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("require-client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2435 "dhcp4_parser.cc"
+#line 2516 "dhcp4_parser.cc"
     break;
 
-  case 396:
-#line 1386 "dhcp4_parser.yy"
+  case 413:
+#line 1445 "dhcp4_parser.yy"
                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2444 "dhcp4_parser.cc"
+#line 2525 "dhcp4_parser.cc"
     break;
 
-  case 397:
-#line 1391 "dhcp4_parser.yy"
+  case 414:
+#line 1450 "dhcp4_parser.yy"
                                    {
     ctx.enter(ctx.RESERVATION_MODE);
 }
-#line 2452 "dhcp4_parser.cc"
+#line 2533 "dhcp4_parser.cc"
     break;
 
-  case 398:
-#line 1393 "dhcp4_parser.yy"
+  case 415:
+#line 1452 "dhcp4_parser.yy"
                 {
     ctx.stack_.back()->set("reservation-mode", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2461 "dhcp4_parser.cc"
+#line 2542 "dhcp4_parser.cc"
     break;
 
-  case 399:
-#line 1398 "dhcp4_parser.yy"
+  case 416:
+#line 1457 "dhcp4_parser.yy"
                   { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
-#line 2467 "dhcp4_parser.cc"
+#line 2548 "dhcp4_parser.cc"
     break;
 
-  case 400:
-#line 1399 "dhcp4_parser.yy"
+  case 417:
+#line 1458 "dhcp4_parser.yy"
                      { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
-#line 2473 "dhcp4_parser.cc"
+#line 2554 "dhcp4_parser.cc"
     break;
 
-  case 401:
-#line 1400 "dhcp4_parser.yy"
+  case 418:
+#line 1459 "dhcp4_parser.yy"
                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("global", ctx.loc2pos(yystack_[0].location))); }
-#line 2479 "dhcp4_parser.cc"
+#line 2560 "dhcp4_parser.cc"
     break;
 
-  case 402:
-#line 1401 "dhcp4_parser.yy"
+  case 419:
+#line 1460 "dhcp4_parser.yy"
              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
-#line 2485 "dhcp4_parser.cc"
+#line 2566 "dhcp4_parser.cc"
     break;
 
-  case 403:
-#line 1404 "dhcp4_parser.yy"
+  case 420:
+#line 1463 "dhcp4_parser.yy"
                      {
     ElementPtr id(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
 }
-#line 2494 "dhcp4_parser.cc"
+#line 2575 "dhcp4_parser.cc"
     break;
 
-  case 404:
-#line 1411 "dhcp4_parser.yy"
+  case 421:
+#line 1470 "dhcp4_parser.yy"
                                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("shared-networks", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SHARED_NETWORK);
 }
-#line 2505 "dhcp4_parser.cc"
+#line 2586 "dhcp4_parser.cc"
     break;
 
-  case 405:
-#line 1416 "dhcp4_parser.yy"
+  case 422:
+#line 1475 "dhcp4_parser.yy"
                                                                 {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2514 "dhcp4_parser.cc"
+#line 2595 "dhcp4_parser.cc"
     break;
 
-  case 410:
-#line 1431 "dhcp4_parser.yy"
+  case 427:
+#line 1490 "dhcp4_parser.yy"
                                {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2524 "dhcp4_parser.cc"
+#line 2605 "dhcp4_parser.cc"
     break;
 
-  case 411:
-#line 1435 "dhcp4_parser.yy"
+  case 428:
+#line 1494 "dhcp4_parser.yy"
                                        {
     ctx.stack_.pop_back();
 }
-#line 2532 "dhcp4_parser.cc"
+#line 2613 "dhcp4_parser.cc"
     break;
 
-  case 447:
-#line 1482 "dhcp4_parser.yy"
+  case 464:
+#line 1541 "dhcp4_parser.yy"
                             {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DEF);
 }
-#line 2543 "dhcp4_parser.cc"
+#line 2624 "dhcp4_parser.cc"
     break;
 
-  case 448:
-#line 1487 "dhcp4_parser.yy"
+  case 465:
+#line 1546 "dhcp4_parser.yy"
                                                                 {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2552 "dhcp4_parser.cc"
+#line 2633 "dhcp4_parser.cc"
     break;
 
-  case 449:
-#line 1495 "dhcp4_parser.yy"
+  case 466:
+#line 1554 "dhcp4_parser.yy"
                                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2561 "dhcp4_parser.cc"
+#line 2642 "dhcp4_parser.cc"
     break;
 
-  case 450:
-#line 1498 "dhcp4_parser.yy"
+  case 467:
+#line 1557 "dhcp4_parser.yy"
                                  {
     // parsing completed
 }
-#line 2569 "dhcp4_parser.cc"
+#line 2650 "dhcp4_parser.cc"
     break;
 
-  case 455:
-#line 1514 "dhcp4_parser.yy"
+  case 472:
+#line 1573 "dhcp4_parser.yy"
                                  {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2579 "dhcp4_parser.cc"
+#line 2660 "dhcp4_parser.cc"
     break;
 
-  case 456:
-#line 1518 "dhcp4_parser.yy"
+  case 473:
+#line 1577 "dhcp4_parser.yy"
                                    {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2587,21 +2668,21 @@ namespace isc { namespace dhcp {
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2591 "dhcp4_parser.cc"
+#line 2672 "dhcp4_parser.cc"
     break;
 
-  case 457:
-#line 1529 "dhcp4_parser.yy"
+  case 474:
+#line 1588 "dhcp4_parser.yy"
                                {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2601 "dhcp4_parser.cc"
+#line 2682 "dhcp4_parser.cc"
     break;
 
-  case 458:
-#line 1533 "dhcp4_parser.yy"
+  case 475:
+#line 1592 "dhcp4_parser.yy"
                                    {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2609,281 +2690,281 @@ namespace isc { namespace dhcp {
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2613 "dhcp4_parser.cc"
+#line 2694 "dhcp4_parser.cc"
     break;
 
-  case 474:
-#line 1565 "dhcp4_parser.yy"
+  case 491:
+#line 1624 "dhcp4_parser.yy"
                          {
     ElementPtr code(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
 }
-#line 2622 "dhcp4_parser.cc"
+#line 2703 "dhcp4_parser.cc"
     break;
 
-  case 476:
-#line 1572 "dhcp4_parser.yy"
+  case 493:
+#line 1631 "dhcp4_parser.yy"
                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2630 "dhcp4_parser.cc"
+#line 2711 "dhcp4_parser.cc"
     break;
 
-  case 477:
-#line 1574 "dhcp4_parser.yy"
+  case 494:
+#line 1633 "dhcp4_parser.yy"
                {
     ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
     ctx.leave();
 }
-#line 2640 "dhcp4_parser.cc"
+#line 2721 "dhcp4_parser.cc"
     break;
 
-  case 478:
-#line 1580 "dhcp4_parser.yy"
+  case 495:
+#line 1639 "dhcp4_parser.yy"
                                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2648 "dhcp4_parser.cc"
+#line 2729 "dhcp4_parser.cc"
     break;
 
-  case 479:
-#line 1582 "dhcp4_parser.yy"
+  case 496:
+#line 1641 "dhcp4_parser.yy"
                {
     ElementPtr rtypes(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
     ctx.leave();
 }
-#line 2658 "dhcp4_parser.cc"
+#line 2739 "dhcp4_parser.cc"
     break;
 
-  case 480:
-#line 1588 "dhcp4_parser.yy"
+  case 497:
+#line 1647 "dhcp4_parser.yy"
              {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2666 "dhcp4_parser.cc"
+#line 2747 "dhcp4_parser.cc"
     break;
 
-  case 481:
-#line 1590 "dhcp4_parser.yy"
+  case 498:
+#line 1649 "dhcp4_parser.yy"
                {
     ElementPtr space(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
     ctx.leave();
 }
-#line 2676 "dhcp4_parser.cc"
+#line 2757 "dhcp4_parser.cc"
     break;
 
-  case 483:
-#line 1598 "dhcp4_parser.yy"
+  case 500:
+#line 1657 "dhcp4_parser.yy"
                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2684 "dhcp4_parser.cc"
+#line 2765 "dhcp4_parser.cc"
     break;
 
-  case 484:
-#line 1600 "dhcp4_parser.yy"
+  case 501:
+#line 1659 "dhcp4_parser.yy"
                {
     ElementPtr encap(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
     ctx.leave();
 }
-#line 2694 "dhcp4_parser.cc"
+#line 2775 "dhcp4_parser.cc"
     break;
 
-  case 485:
-#line 1606 "dhcp4_parser.yy"
+  case 502:
+#line 1665 "dhcp4_parser.yy"
                                       {
     ElementPtr array(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
 }
-#line 2703 "dhcp4_parser.cc"
+#line 2784 "dhcp4_parser.cc"
     break;
 
-  case 486:
-#line 1615 "dhcp4_parser.yy"
+  case 503:
+#line 1674 "dhcp4_parser.yy"
                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DATA);
 }
-#line 2714 "dhcp4_parser.cc"
+#line 2795 "dhcp4_parser.cc"
     break;
 
-  case 487:
-#line 1620 "dhcp4_parser.yy"
+  case 504:
+#line 1679 "dhcp4_parser.yy"
                                                                  {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2723 "dhcp4_parser.cc"
+#line 2804 "dhcp4_parser.cc"
     break;
 
-  case 492:
-#line 1639 "dhcp4_parser.yy"
+  case 509:
+#line 1698 "dhcp4_parser.yy"
                                   {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2733 "dhcp4_parser.cc"
+#line 2814 "dhcp4_parser.cc"
     break;
 
-  case 493:
-#line 1643 "dhcp4_parser.yy"
+  case 510:
+#line 1702 "dhcp4_parser.yy"
                                     {
     /// @todo: the code or name parameters are required.
     ctx.stack_.pop_back();
 }
-#line 2742 "dhcp4_parser.cc"
+#line 2823 "dhcp4_parser.cc"
     break;
 
-  case 494:
-#line 1651 "dhcp4_parser.yy"
+  case 511:
+#line 1710 "dhcp4_parser.yy"
                                 {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2752 "dhcp4_parser.cc"
+#line 2833 "dhcp4_parser.cc"
     break;
 
-  case 495:
-#line 1655 "dhcp4_parser.yy"
+  case 512:
+#line 1714 "dhcp4_parser.yy"
                                     {
     /// @todo: the code or name parameters are required.
     // parsing completed
 }
-#line 2761 "dhcp4_parser.cc"
+#line 2842 "dhcp4_parser.cc"
     break;
 
-  case 510:
-#line 1688 "dhcp4_parser.yy"
+  case 527:
+#line 1747 "dhcp4_parser.yy"
                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2769 "dhcp4_parser.cc"
+#line 2850 "dhcp4_parser.cc"
     break;
 
-  case 511:
-#line 1690 "dhcp4_parser.yy"
+  case 528:
+#line 1749 "dhcp4_parser.yy"
                {
     ElementPtr data(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
     ctx.leave();
 }
-#line 2779 "dhcp4_parser.cc"
+#line 2860 "dhcp4_parser.cc"
     break;
 
-  case 514:
-#line 1700 "dhcp4_parser.yy"
+  case 531:
+#line 1759 "dhcp4_parser.yy"
                                                  {
     ElementPtr space(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
 }
-#line 2788 "dhcp4_parser.cc"
+#line 2869 "dhcp4_parser.cc"
     break;
 
-  case 515:
-#line 1705 "dhcp4_parser.yy"
+  case 532:
+#line 1764 "dhcp4_parser.yy"
                                                    {
     ElementPtr persist(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-send", persist);
 }
-#line 2797 "dhcp4_parser.cc"
+#line 2878 "dhcp4_parser.cc"
     break;
 
-  case 516:
-#line 1713 "dhcp4_parser.yy"
+  case 533:
+#line 1772 "dhcp4_parser.yy"
                   {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.POOLS);
 }
-#line 2808 "dhcp4_parser.cc"
+#line 2889 "dhcp4_parser.cc"
     break;
 
-  case 517:
-#line 1718 "dhcp4_parser.yy"
+  case 534:
+#line 1777 "dhcp4_parser.yy"
                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2817 "dhcp4_parser.cc"
+#line 2898 "dhcp4_parser.cc"
     break;
 
-  case 522:
-#line 1733 "dhcp4_parser.yy"
+  case 539:
+#line 1792 "dhcp4_parser.yy"
                                 {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2827 "dhcp4_parser.cc"
+#line 2908 "dhcp4_parser.cc"
     break;
 
-  case 523:
-#line 1737 "dhcp4_parser.yy"
+  case 540:
+#line 1796 "dhcp4_parser.yy"
                              {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2837 "dhcp4_parser.cc"
+#line 2918 "dhcp4_parser.cc"
     break;
 
-  case 524:
-#line 1743 "dhcp4_parser.yy"
+  case 541:
+#line 1802 "dhcp4_parser.yy"
                           {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2847 "dhcp4_parser.cc"
+#line 2928 "dhcp4_parser.cc"
     break;
 
-  case 525:
-#line 1747 "dhcp4_parser.yy"
+  case 542:
+#line 1806 "dhcp4_parser.yy"
                              {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2857 "dhcp4_parser.cc"
+#line 2938 "dhcp4_parser.cc"
     break;
 
-  case 537:
-#line 1768 "dhcp4_parser.yy"
+  case 554:
+#line 1827 "dhcp4_parser.yy"
                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2865 "dhcp4_parser.cc"
+#line 2946 "dhcp4_parser.cc"
     break;
 
-  case 538:
-#line 1770 "dhcp4_parser.yy"
+  case 555:
+#line 1829 "dhcp4_parser.yy"
                {
     ElementPtr pool(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
     ctx.leave();
 }
-#line 2875 "dhcp4_parser.cc"
+#line 2956 "dhcp4_parser.cc"
     break;
 
-  case 539:
-#line 1776 "dhcp4_parser.yy"
+  case 556:
+#line 1835 "dhcp4_parser.yy"
                            {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2883 "dhcp4_parser.cc"
+#line 2964 "dhcp4_parser.cc"
     break;
 
-  case 540:
-#line 1778 "dhcp4_parser.yy"
+  case 557:
+#line 1837 "dhcp4_parser.yy"
                   {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
@@ -2906,19 +2987,19 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2910 "dhcp4_parser.cc"
+#line 2991 "dhcp4_parser.cc"
     break;
 
-  case 541:
-#line 1801 "dhcp4_parser.yy"
+  case 558:
+#line 1860 "dhcp4_parser.yy"
                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2918 "dhcp4_parser.cc"
+#line 2999 "dhcp4_parser.cc"
     break;
 
-  case 542:
-#line 1803 "dhcp4_parser.yy"
+  case 559:
+#line 1862 "dhcp4_parser.yy"
                {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
@@ -2943,1304 +3024,1304 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2947 "dhcp4_parser.cc"
+#line 3028 "dhcp4_parser.cc"
     break;
 
-  case 543:
-#line 1831 "dhcp4_parser.yy"
+  case 560:
+#line 1890 "dhcp4_parser.yy"
                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.RESERVATIONS);
 }
-#line 2958 "dhcp4_parser.cc"
+#line 3039 "dhcp4_parser.cc"
     break;
 
-  case 544:
-#line 1836 "dhcp4_parser.yy"
+  case 561:
+#line 1895 "dhcp4_parser.yy"
                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2967 "dhcp4_parser.cc"
+#line 3048 "dhcp4_parser.cc"
     break;
 
-  case 549:
-#line 1849 "dhcp4_parser.yy"
+  case 566:
+#line 1908 "dhcp4_parser.yy"
                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2977 "dhcp4_parser.cc"
+#line 3058 "dhcp4_parser.cc"
     break;
 
-  case 550:
-#line 1853 "dhcp4_parser.yy"
+  case 567:
+#line 1912 "dhcp4_parser.yy"
                                     {
     /// @todo: an identifier parameter is required.
     ctx.stack_.pop_back();
 }
-#line 2986 "dhcp4_parser.cc"
+#line 3067 "dhcp4_parser.cc"
     break;
 
-  case 551:
-#line 1858 "dhcp4_parser.yy"
+  case 568:
+#line 1917 "dhcp4_parser.yy"
                                 {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2996 "dhcp4_parser.cc"
+#line 3077 "dhcp4_parser.cc"
     break;
 
-  case 552:
-#line 1862 "dhcp4_parser.yy"
+  case 569:
+#line 1921 "dhcp4_parser.yy"
                                     {
     /// @todo: an identifier parameter is required.
     // parsing completed
 }
-#line 3005 "dhcp4_parser.cc"
+#line 3086 "dhcp4_parser.cc"
     break;
 
-  case 572:
-#line 1893 "dhcp4_parser.yy"
+  case 589:
+#line 1952 "dhcp4_parser.yy"
                          {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3013 "dhcp4_parser.cc"
+#line 3094 "dhcp4_parser.cc"
     break;
 
-  case 573:
-#line 1895 "dhcp4_parser.yy"
+  case 590:
+#line 1954 "dhcp4_parser.yy"
                {
     ElementPtr next_server(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("next-server", next_server);
     ctx.leave();
 }
-#line 3023 "dhcp4_parser.cc"
+#line 3104 "dhcp4_parser.cc"
     break;
 
-  case 574:
-#line 1901 "dhcp4_parser.yy"
+  case 591:
+#line 1960 "dhcp4_parser.yy"
                                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3031 "dhcp4_parser.cc"
+#line 3112 "dhcp4_parser.cc"
     break;
 
-  case 575:
-#line 1903 "dhcp4_parser.yy"
+  case 592:
+#line 1962 "dhcp4_parser.yy"
                {
     ElementPtr srv(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-hostname", srv);
     ctx.leave();
 }
-#line 3041 "dhcp4_parser.cc"
+#line 3122 "dhcp4_parser.cc"
     break;
 
-  case 576:
-#line 1909 "dhcp4_parser.yy"
+  case 593:
+#line 1968 "dhcp4_parser.yy"
                                {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3049 "dhcp4_parser.cc"
+#line 3130 "dhcp4_parser.cc"
     break;
 
-  case 577:
-#line 1911 "dhcp4_parser.yy"
+  case 594:
+#line 1970 "dhcp4_parser.yy"
                {
     ElementPtr bootfile(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("boot-file-name", bootfile);
     ctx.leave();
 }
-#line 3059 "dhcp4_parser.cc"
+#line 3140 "dhcp4_parser.cc"
     break;
 
-  case 578:
-#line 1917 "dhcp4_parser.yy"
+  case 595:
+#line 1976 "dhcp4_parser.yy"
                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3067 "dhcp4_parser.cc"
+#line 3148 "dhcp4_parser.cc"
     break;
 
-  case 579:
-#line 1919 "dhcp4_parser.yy"
+  case 596:
+#line 1978 "dhcp4_parser.yy"
                {
     ElementPtr addr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", addr);
     ctx.leave();
 }
-#line 3077 "dhcp4_parser.cc"
+#line 3158 "dhcp4_parser.cc"
     break;
 
-  case 580:
-#line 1925 "dhcp4_parser.yy"
+  case 597:
+#line 1984 "dhcp4_parser.yy"
                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-addresses", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3088 "dhcp4_parser.cc"
+#line 3169 "dhcp4_parser.cc"
     break;
 
-  case 581:
-#line 1930 "dhcp4_parser.yy"
+  case 598:
+#line 1989 "dhcp4_parser.yy"
                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3097 "dhcp4_parser.cc"
+#line 3178 "dhcp4_parser.cc"
     break;
 
-  case 582:
-#line 1935 "dhcp4_parser.yy"
+  case 599:
+#line 1994 "dhcp4_parser.yy"
            {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3105 "dhcp4_parser.cc"
+#line 3186 "dhcp4_parser.cc"
     break;
 
-  case 583:
-#line 1937 "dhcp4_parser.yy"
+  case 600:
+#line 1996 "dhcp4_parser.yy"
                {
     ElementPtr d(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
     ctx.leave();
 }
-#line 3115 "dhcp4_parser.cc"
+#line 3196 "dhcp4_parser.cc"
     break;
 
-  case 584:
-#line 1943 "dhcp4_parser.yy"
+  case 601:
+#line 2002 "dhcp4_parser.yy"
                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3123 "dhcp4_parser.cc"
+#line 3204 "dhcp4_parser.cc"
     break;
 
-  case 585:
-#line 1945 "dhcp4_parser.yy"
+  case 602:
+#line 2004 "dhcp4_parser.yy"
                {
     ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
     ctx.leave();
 }
-#line 3133 "dhcp4_parser.cc"
+#line 3214 "dhcp4_parser.cc"
     break;
 
-  case 586:
-#line 1951 "dhcp4_parser.yy"
+  case 603:
+#line 2010 "dhcp4_parser.yy"
                            {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3141 "dhcp4_parser.cc"
+#line 3222 "dhcp4_parser.cc"
     break;
 
-  case 587:
-#line 1953 "dhcp4_parser.yy"
+  case 604:
+#line 2012 "dhcp4_parser.yy"
                {
     ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-id", hw);
     ctx.leave();
 }
-#line 3151 "dhcp4_parser.cc"
+#line 3232 "dhcp4_parser.cc"
     break;
 
-  case 588:
-#line 1959 "dhcp4_parser.yy"
+  case 605:
+#line 2018 "dhcp4_parser.yy"
                              {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3159 "dhcp4_parser.cc"
+#line 3240 "dhcp4_parser.cc"
     break;
 
-  case 589:
-#line 1961 "dhcp4_parser.yy"
+  case 606:
+#line 2020 "dhcp4_parser.yy"
                {
     ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("circuit-id", hw);
     ctx.leave();
 }
-#line 3169 "dhcp4_parser.cc"
+#line 3250 "dhcp4_parser.cc"
     break;
 
-  case 590:
-#line 1967 "dhcp4_parser.yy"
+  case 607:
+#line 2026 "dhcp4_parser.yy"
                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3177 "dhcp4_parser.cc"
+#line 3258 "dhcp4_parser.cc"
     break;
 
-  case 591:
-#line 1969 "dhcp4_parser.yy"
+  case 608:
+#line 2028 "dhcp4_parser.yy"
                {
     ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flex-id", hw);
     ctx.leave();
 }
-#line 3187 "dhcp4_parser.cc"
+#line 3268 "dhcp4_parser.cc"
     break;
 
-  case 592:
-#line 1975 "dhcp4_parser.yy"
+  case 609:
+#line 2034 "dhcp4_parser.yy"
                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3195 "dhcp4_parser.cc"
+#line 3276 "dhcp4_parser.cc"
     break;
 
-  case 593:
-#line 1977 "dhcp4_parser.yy"
+  case 610:
+#line 2036 "dhcp4_parser.yy"
                {
     ElementPtr host(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
     ctx.leave();
 }
-#line 3205 "dhcp4_parser.cc"
+#line 3286 "dhcp4_parser.cc"
     break;
 
-  case 594:
-#line 1983 "dhcp4_parser.yy"
+  case 611:
+#line 2042 "dhcp4_parser.yy"
                                            {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3216 "dhcp4_parser.cc"
+#line 3297 "dhcp4_parser.cc"
     break;
 
-  case 595:
-#line 1988 "dhcp4_parser.yy"
+  case 612:
+#line 2047 "dhcp4_parser.yy"
                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3225 "dhcp4_parser.cc"
+#line 3306 "dhcp4_parser.cc"
     break;
 
-  case 596:
-#line 1996 "dhcp4_parser.yy"
+  case 613:
+#line 2055 "dhcp4_parser.yy"
              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.RELAY);
 }
-#line 3236 "dhcp4_parser.cc"
+#line 3317 "dhcp4_parser.cc"
     break;
 
-  case 597:
-#line 2001 "dhcp4_parser.yy"
+  case 614:
+#line 2060 "dhcp4_parser.yy"
                                                 {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3245 "dhcp4_parser.cc"
+#line 3326 "dhcp4_parser.cc"
     break;
 
-  case 600:
-#line 2013 "dhcp4_parser.yy"
+  case 617:
+#line 2072 "dhcp4_parser.yy"
                                {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CLIENT_CLASSES);
 }
-#line 3256 "dhcp4_parser.cc"
+#line 3337 "dhcp4_parser.cc"
     break;
 
-  case 601:
-#line 2018 "dhcp4_parser.yy"
+  case 618:
+#line 2077 "dhcp4_parser.yy"
                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3265 "dhcp4_parser.cc"
+#line 3346 "dhcp4_parser.cc"
     break;
 
-  case 604:
-#line 2027 "dhcp4_parser.yy"
+  case 621:
+#line 2086 "dhcp4_parser.yy"
                                    {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3275 "dhcp4_parser.cc"
+#line 3356 "dhcp4_parser.cc"
     break;
 
-  case 605:
-#line 2031 "dhcp4_parser.yy"
+  case 622:
+#line 2090 "dhcp4_parser.yy"
                                      {
     // The name client class parameter is required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 3285 "dhcp4_parser.cc"
+#line 3366 "dhcp4_parser.cc"
     break;
 
-  case 622:
-#line 2060 "dhcp4_parser.yy"
+  case 639:
+#line 2119 "dhcp4_parser.yy"
                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3293 "dhcp4_parser.cc"
+#line 3374 "dhcp4_parser.cc"
     break;
 
-  case 623:
-#line 2062 "dhcp4_parser.yy"
+  case 640:
+#line 2121 "dhcp4_parser.yy"
                {
     ElementPtr test(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
     ctx.leave();
 }
-#line 3303 "dhcp4_parser.cc"
+#line 3384 "dhcp4_parser.cc"
     break;
 
-  case 624:
-#line 2068 "dhcp4_parser.yy"
+  case 641:
+#line 2127 "dhcp4_parser.yy"
                                                  {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("only-if-required", b);
 }
-#line 3312 "dhcp4_parser.cc"
+#line 3393 "dhcp4_parser.cc"
     break;
 
-  case 625:
-#line 2075 "dhcp4_parser.yy"
+  case 642:
+#line 2134 "dhcp4_parser.yy"
                                          {
     ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
 }
-#line 3321 "dhcp4_parser.cc"
+#line 3402 "dhcp4_parser.cc"
     break;
 
-  case 626:
-#line 2082 "dhcp4_parser.yy"
+  case 643:
+#line 2141 "dhcp4_parser.yy"
                                {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 3332 "dhcp4_parser.cc"
+#line 3413 "dhcp4_parser.cc"
     break;
 
-  case 627:
-#line 2087 "dhcp4_parser.yy"
+  case 644:
+#line 2146 "dhcp4_parser.yy"
                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3341 "dhcp4_parser.cc"
+#line 3422 "dhcp4_parser.cc"
     break;
 
-  case 643:
-#line 2115 "dhcp4_parser.yy"
+  case 660:
+#line 2174 "dhcp4_parser.yy"
                                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3349 "dhcp4_parser.cc"
+#line 3430 "dhcp4_parser.cc"
     break;
 
-  case 644:
-#line 2117 "dhcp4_parser.yy"
+  case 661:
+#line 2176 "dhcp4_parser.yy"
                {
     ElementPtr stype(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 3359 "dhcp4_parser.cc"
+#line 3440 "dhcp4_parser.cc"
     break;
 
-  case 645:
-#line 2123 "dhcp4_parser.yy"
+  case 662:
+#line 2182 "dhcp4_parser.yy"
                                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3367 "dhcp4_parser.cc"
+#line 3448 "dhcp4_parser.cc"
     break;
 
-  case 646:
-#line 2125 "dhcp4_parser.yy"
+  case 663:
+#line 2184 "dhcp4_parser.yy"
                {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 3377 "dhcp4_parser.cc"
+#line 3458 "dhcp4_parser.cc"
     break;
 
-  case 647:
-#line 2131 "dhcp4_parser.yy"
+  case 664:
+#line 2190 "dhcp4_parser.yy"
                                                                                                              {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("on-boot-request-configuration-from-kea-netconf", b);
 }
-#line 3386 "dhcp4_parser.cc"
+#line 3467 "dhcp4_parser.cc"
     break;
 
-  case 648:
-#line 2138 "dhcp4_parser.yy"
+  case 665:
+#line 2197 "dhcp4_parser.yy"
                                        {
     ElementPtr qc(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-queue-control", qc);
     ctx.stack_.push_back(qc);
     ctx.enter(ctx.DHCP_QUEUE_CONTROL);
 }
-#line 3397 "dhcp4_parser.cc"
+#line 3478 "dhcp4_parser.cc"
     break;
 
-  case 649:
-#line 2143 "dhcp4_parser.yy"
+  case 666:
+#line 2202 "dhcp4_parser.yy"
                                                            {
     // The enable queue parameter is required.
     ctx.require("enable-queue", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3408 "dhcp4_parser.cc"
+#line 3489 "dhcp4_parser.cc"
     break;
 
-  case 658:
-#line 2162 "dhcp4_parser.yy"
+  case 675:
+#line 2221 "dhcp4_parser.yy"
                                          {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-queue", b);
 }
-#line 3417 "dhcp4_parser.cc"
+#line 3498 "dhcp4_parser.cc"
     break;
 
-  case 659:
-#line 2167 "dhcp4_parser.yy"
+  case 676:
+#line 2226 "dhcp4_parser.yy"
                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3425 "dhcp4_parser.cc"
+#line 3506 "dhcp4_parser.cc"
     break;
 
-  case 660:
-#line 2169 "dhcp4_parser.yy"
+  case 677:
+#line 2228 "dhcp4_parser.yy"
                {
     ElementPtr qt(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("queue-type", qt);
     ctx.leave();
 }
-#line 3435 "dhcp4_parser.cc"
+#line 3516 "dhcp4_parser.cc"
     break;
 
-  case 661:
-#line 2175 "dhcp4_parser.yy"
+  case 678:
+#line 2234 "dhcp4_parser.yy"
                                  {
     ElementPtr c(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("capacity", c);
 }
-#line 3444 "dhcp4_parser.cc"
+#line 3525 "dhcp4_parser.cc"
     break;
 
-  case 662:
-#line 2180 "dhcp4_parser.yy"
+  case 679:
+#line 2239 "dhcp4_parser.yy"
                             {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3452 "dhcp4_parser.cc"
+#line 3533 "dhcp4_parser.cc"
     break;
 
-  case 663:
-#line 2182 "dhcp4_parser.yy"
+  case 680:
+#line 2241 "dhcp4_parser.yy"
               {
     ctx.stack_.back()->set(yystack_[3].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3461 "dhcp4_parser.cc"
+#line 3542 "dhcp4_parser.cc"
     break;
 
-  case 664:
-#line 2189 "dhcp4_parser.yy"
+  case 681:
+#line 2248 "dhcp4_parser.yy"
                      {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP_DDNS);
 }
-#line 3472 "dhcp4_parser.cc"
+#line 3553 "dhcp4_parser.cc"
     break;
 
-  case 665:
-#line 2194 "dhcp4_parser.yy"
+  case 682:
+#line 2253 "dhcp4_parser.yy"
                                                        {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3483 "dhcp4_parser.cc"
+#line 3564 "dhcp4_parser.cc"
     break;
 
-  case 666:
-#line 2201 "dhcp4_parser.yy"
+  case 683:
+#line 2260 "dhcp4_parser.yy"
                               {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3493 "dhcp4_parser.cc"
+#line 3574 "dhcp4_parser.cc"
     break;
 
-  case 667:
-#line 2205 "dhcp4_parser.yy"
+  case 684:
+#line 2264 "dhcp4_parser.yy"
                                   {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 3503 "dhcp4_parser.cc"
+#line 3584 "dhcp4_parser.cc"
     break;
 
-  case 688:
-#line 2235 "dhcp4_parser.yy"
+  case 705:
+#line 2294 "dhcp4_parser.yy"
                                              {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
 }
-#line 3512 "dhcp4_parser.cc"
+#line 3593 "dhcp4_parser.cc"
     break;
 
-  case 689:
-#line 2240 "dhcp4_parser.yy"
+  case 706:
+#line 2299 "dhcp4_parser.yy"
                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3520 "dhcp4_parser.cc"
+#line 3601 "dhcp4_parser.cc"
     break;
 
-  case 690:
-#line 2242 "dhcp4_parser.yy"
+  case 707:
+#line 2301 "dhcp4_parser.yy"
                {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
     ctx.leave();
 }
-#line 3530 "dhcp4_parser.cc"
+#line 3611 "dhcp4_parser.cc"
     break;
 
-  case 691:
-#line 2248 "dhcp4_parser.yy"
+  case 708:
+#line 2307 "dhcp4_parser.yy"
                                        {
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
 }
-#line 3539 "dhcp4_parser.cc"
+#line 3620 "dhcp4_parser.cc"
     break;
 
-  case 692:
-#line 2253 "dhcp4_parser.yy"
+  case 709:
+#line 2312 "dhcp4_parser.yy"
                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3547 "dhcp4_parser.cc"
+#line 3628 "dhcp4_parser.cc"
     break;
 
-  case 693:
-#line 2255 "dhcp4_parser.yy"
+  case 710:
+#line 2314 "dhcp4_parser.yy"
                {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
     ctx.leave();
 }
-#line 3557 "dhcp4_parser.cc"
+#line 3638 "dhcp4_parser.cc"
     break;
 
-  case 694:
-#line 2261 "dhcp4_parser.yy"
+  case 711:
+#line 2320 "dhcp4_parser.yy"
                                        {
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
 }
-#line 3566 "dhcp4_parser.cc"
+#line 3647 "dhcp4_parser.cc"
     break;
 
-  case 695:
-#line 2266 "dhcp4_parser.yy"
+  case 712:
+#line 2325 "dhcp4_parser.yy"
                                              {
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
 }
-#line 3575 "dhcp4_parser.cc"
+#line 3656 "dhcp4_parser.cc"
     break;
 
-  case 696:
-#line 2271 "dhcp4_parser.yy"
+  case 713:
+#line 2330 "dhcp4_parser.yy"
                            {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 3583 "dhcp4_parser.cc"
+#line 3664 "dhcp4_parser.cc"
     break;
 
-  case 697:
-#line 2273 "dhcp4_parser.yy"
+  case 714:
+#line 2332 "dhcp4_parser.yy"
                            {
     ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3592 "dhcp4_parser.cc"
+#line 3673 "dhcp4_parser.cc"
     break;
 
-  case 698:
-#line 2279 "dhcp4_parser.yy"
+  case 715:
+#line 2338 "dhcp4_parser.yy"
         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 3598 "dhcp4_parser.cc"
+#line 3679 "dhcp4_parser.cc"
     break;
 
-  case 699:
-#line 2280 "dhcp4_parser.yy"
+  case 716:
+#line 2339 "dhcp4_parser.yy"
         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 3604 "dhcp4_parser.cc"
+#line 3685 "dhcp4_parser.cc"
     break;
 
-  case 700:
-#line 2283 "dhcp4_parser.yy"
+  case 717:
+#line 2342 "dhcp4_parser.yy"
                        {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 3612 "dhcp4_parser.cc"
+#line 3693 "dhcp4_parser.cc"
     break;
 
-  case 701:
-#line 2285 "dhcp4_parser.yy"
+  case 718:
+#line 2344 "dhcp4_parser.yy"
              {
     ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ncr-format", json);
     ctx.leave();
 }
-#line 3622 "dhcp4_parser.cc"
+#line 3703 "dhcp4_parser.cc"
     break;
 
-  case 702:
-#line 2292 "dhcp4_parser.yy"
+  case 719:
+#line 2351 "dhcp4_parser.yy"
                                          {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3630 "dhcp4_parser.cc"
+#line 3711 "dhcp4_parser.cc"
     break;
 
-  case 703:
-#line 2294 "dhcp4_parser.yy"
+  case 720:
+#line 2353 "dhcp4_parser.yy"
                {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
     ctx.leave();
 }
-#line 3640 "dhcp4_parser.cc"
+#line 3721 "dhcp4_parser.cc"
     break;
 
-  case 704:
-#line 2301 "dhcp4_parser.yy"
+  case 721:
+#line 2360 "dhcp4_parser.yy"
                                                          {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
 }
-#line 3649 "dhcp4_parser.cc"
+#line 3730 "dhcp4_parser.cc"
     break;
 
-  case 705:
-#line 2307 "dhcp4_parser.yy"
+  case 722:
+#line 2366 "dhcp4_parser.yy"
                                                                  {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
 }
-#line 3658 "dhcp4_parser.cc"
+#line 3739 "dhcp4_parser.cc"
     break;
 
-  case 706:
-#line 2313 "dhcp4_parser.yy"
+  case 723:
+#line 2372 "dhcp4_parser.yy"
                                              {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 3666 "dhcp4_parser.cc"
+#line 3747 "dhcp4_parser.cc"
     break;
 
-  case 707:
-#line 2315 "dhcp4_parser.yy"
+  case 724:
+#line 2374 "dhcp4_parser.yy"
                                        {
     ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3675 "dhcp4_parser.cc"
+#line 3756 "dhcp4_parser.cc"
     break;
 
-  case 708:
-#line 2321 "dhcp4_parser.yy"
+  case 725:
+#line 2380 "dhcp4_parser.yy"
                                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3683 "dhcp4_parser.cc"
+#line 3764 "dhcp4_parser.cc"
     break;
 
-  case 709:
-#line 2323 "dhcp4_parser.yy"
+  case 726:
+#line 2382 "dhcp4_parser.yy"
                {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
     ctx.leave();
 }
-#line 3693 "dhcp4_parser.cc"
+#line 3774 "dhcp4_parser.cc"
     break;
 
-  case 710:
-#line 2330 "dhcp4_parser.yy"
+  case 727:
+#line 2389 "dhcp4_parser.yy"
                                          {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3701 "dhcp4_parser.cc"
+#line 3782 "dhcp4_parser.cc"
     break;
 
-  case 711:
-#line 2332 "dhcp4_parser.yy"
+  case 728:
+#line 2391 "dhcp4_parser.yy"
                {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-set", s);
     ctx.leave();
 }
-#line 3711 "dhcp4_parser.cc"
+#line 3792 "dhcp4_parser.cc"
     break;
 
-  case 712:
-#line 2339 "dhcp4_parser.yy"
+  case 729:
+#line 2398 "dhcp4_parser.yy"
                                                          {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3719 "dhcp4_parser.cc"
+#line 3800 "dhcp4_parser.cc"
     break;
 
-  case 713:
-#line 2341 "dhcp4_parser.yy"
+  case 730:
+#line 2400 "dhcp4_parser.yy"
                {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-replacement", s);
     ctx.leave();
 }
-#line 3729 "dhcp4_parser.cc"
+#line 3810 "dhcp4_parser.cc"
     break;
 
-  case 714:
-#line 2350 "dhcp4_parser.yy"
+  case 731:
+#line 2409 "dhcp4_parser.yy"
                                {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-control", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.CONFIG_CONTROL);
 }
-#line 3740 "dhcp4_parser.cc"
+#line 3821 "dhcp4_parser.cc"
     break;
 
-  case 715:
-#line 2355 "dhcp4_parser.yy"
+  case 732:
+#line 2414 "dhcp4_parser.yy"
                                                             {
     // No config control params are required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3750 "dhcp4_parser.cc"
+#line 3831 "dhcp4_parser.cc"
     break;
 
-  case 716:
-#line 2361 "dhcp4_parser.yy"
+  case 733:
+#line 2420 "dhcp4_parser.yy"
                                    {
     // Parse the config-control map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3760 "dhcp4_parser.cc"
+#line 3841 "dhcp4_parser.cc"
     break;
 
-  case 717:
-#line 2365 "dhcp4_parser.yy"
+  case 734:
+#line 2424 "dhcp4_parser.yy"
                                        {
     // No config_control params are required
     // parsing completed
 }
-#line 3769 "dhcp4_parser.cc"
+#line 3850 "dhcp4_parser.cc"
     break;
 
-  case 722:
-#line 2380 "dhcp4_parser.yy"
+  case 739:
+#line 2439 "dhcp4_parser.yy"
                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CONFIG_DATABASE);
 }
-#line 3780 "dhcp4_parser.cc"
+#line 3861 "dhcp4_parser.cc"
     break;
 
-  case 723:
-#line 2385 "dhcp4_parser.yy"
+  case 740:
+#line 2444 "dhcp4_parser.yy"
                                                       {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3789 "dhcp4_parser.cc"
+#line 3870 "dhcp4_parser.cc"
     break;
 
-  case 724:
-#line 2390 "dhcp4_parser.yy"
+  case 741:
+#line 2449 "dhcp4_parser.yy"
                                                              {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-fetch-wait-time", value);
 }
-#line 3798 "dhcp4_parser.cc"
+#line 3879 "dhcp4_parser.cc"
     break;
 
-  case 725:
-#line 2397 "dhcp4_parser.yy"
+  case 742:
+#line 2456 "dhcp4_parser.yy"
                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 3809 "dhcp4_parser.cc"
+#line 3890 "dhcp4_parser.cc"
     break;
 
-  case 726:
-#line 2402 "dhcp4_parser.yy"
+  case 743:
+#line 2461 "dhcp4_parser.yy"
                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3818 "dhcp4_parser.cc"
+#line 3899 "dhcp4_parser.cc"
     break;
 
-  case 729:
-#line 2414 "dhcp4_parser.yy"
+  case 746:
+#line 2473 "dhcp4_parser.yy"
                              {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 3828 "dhcp4_parser.cc"
+#line 3909 "dhcp4_parser.cc"
     break;
 
-  case 730:
-#line 2418 "dhcp4_parser.yy"
+  case 747:
+#line 2477 "dhcp4_parser.yy"
                                {
     ctx.stack_.pop_back();
 }
-#line 3836 "dhcp4_parser.cc"
+#line 3917 "dhcp4_parser.cc"
     break;
 
-  case 740:
-#line 2435 "dhcp4_parser.yy"
+  case 757:
+#line 2494 "dhcp4_parser.yy"
                                      {
     ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 3845 "dhcp4_parser.cc"
+#line 3926 "dhcp4_parser.cc"
     break;
 
-  case 741:
-#line 2440 "dhcp4_parser.yy"
+  case 758:
+#line 2499 "dhcp4_parser.yy"
                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3853 "dhcp4_parser.cc"
+#line 3934 "dhcp4_parser.cc"
     break;
 
-  case 742:
-#line 2442 "dhcp4_parser.yy"
+  case 759:
+#line 2501 "dhcp4_parser.yy"
                {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 3863 "dhcp4_parser.cc"
+#line 3944 "dhcp4_parser.cc"
     break;
 
-  case 743:
-#line 2448 "dhcp4_parser.yy"
+  case 760:
+#line 2507 "dhcp4_parser.yy"
                                     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 3874 "dhcp4_parser.cc"
+#line 3955 "dhcp4_parser.cc"
     break;
 
-  case 744:
-#line 2453 "dhcp4_parser.yy"
+  case 761:
+#line 2512 "dhcp4_parser.yy"
                                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3883 "dhcp4_parser.cc"
+#line 3964 "dhcp4_parser.cc"
     break;
 
-  case 747:
-#line 2462 "dhcp4_parser.yy"
+  case 764:
+#line 2521 "dhcp4_parser.yy"
                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3893 "dhcp4_parser.cc"
+#line 3974 "dhcp4_parser.cc"
     break;
 
-  case 748:
-#line 2466 "dhcp4_parser.yy"
+  case 765:
+#line 2525 "dhcp4_parser.yy"
                                     {
     ctx.stack_.pop_back();
 }
-#line 3901 "dhcp4_parser.cc"
+#line 3982 "dhcp4_parser.cc"
     break;
 
-  case 756:
-#line 2481 "dhcp4_parser.yy"
+  case 773:
+#line 2540 "dhcp4_parser.yy"
                {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3909 "dhcp4_parser.cc"
+#line 3990 "dhcp4_parser.cc"
     break;
 
-  case 757:
-#line 2483 "dhcp4_parser.yy"
+  case 774:
+#line 2542 "dhcp4_parser.yy"
                {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 3919 "dhcp4_parser.cc"
+#line 4000 "dhcp4_parser.cc"
     break;
 
-  case 758:
-#line 2489 "dhcp4_parser.yy"
+  case 775:
+#line 2548 "dhcp4_parser.yy"
                            {
     ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 3928 "dhcp4_parser.cc"
+#line 4009 "dhcp4_parser.cc"
     break;
 
-  case 759:
-#line 2494 "dhcp4_parser.yy"
+  case 776:
+#line 2553 "dhcp4_parser.yy"
                                {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 3937 "dhcp4_parser.cc"
+#line 4018 "dhcp4_parser.cc"
     break;
 
-  case 760:
-#line 2499 "dhcp4_parser.yy"
+  case 777:
+#line 2558 "dhcp4_parser.yy"
                              {
     ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 3946 "dhcp4_parser.cc"
+#line 4027 "dhcp4_parser.cc"
     break;
 
-  case 761:
-#line 2504 "dhcp4_parser.yy"
+  case 778:
+#line 2563 "dhcp4_parser.yy"
                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3954 "dhcp4_parser.cc"
+#line 4035 "dhcp4_parser.cc"
     break;
 
-  case 762:
-#line 2506 "dhcp4_parser.yy"
+  case 779:
+#line 2565 "dhcp4_parser.yy"
                {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pattern", sev);
     ctx.leave();
 }
-#line 3964 "dhcp4_parser.cc"
+#line 4045 "dhcp4_parser.cc"
     break;
 
-  case 763:
-#line 2514 "dhcp4_parser.yy"
+  case 780:
+#line 2573 "dhcp4_parser.yy"
                                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3972 "dhcp4_parser.cc"
+#line 4053 "dhcp4_parser.cc"
     break;
 
-  case 764:
-#line 2516 "dhcp4_parser.yy"
+  case 781:
+#line 2575 "dhcp4_parser.yy"
                {
     ElementPtr allocation_type(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("allocation-type", allocation_type);
     ctx.leave();
 }
-#line 3982 "dhcp4_parser.cc"
+#line 4063 "dhcp4_parser.cc"
     break;
 
-  case 765:
-#line 2522 "dhcp4_parser.yy"
+  case 782:
+#line 2581 "dhcp4_parser.yy"
                                  {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.CONFIG_DATABASE);
 }
-#line 3993 "dhcp4_parser.cc"
+#line 4074 "dhcp4_parser.cc"
     break;
 
-  case 766:
-#line 2527 "dhcp4_parser.yy"
+  case 783:
+#line 2586 "dhcp4_parser.yy"
                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 4002 "dhcp4_parser.cc"
+#line 4083 "dhcp4_parser.cc"
     break;
 
-  case 767:
-#line 2532 "dhcp4_parser.yy"
+  case 784:
+#line 2591 "dhcp4_parser.yy"
                                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 4010 "dhcp4_parser.cc"
+#line 4091 "dhcp4_parser.cc"
     break;
 
-  case 768:
-#line 2534 "dhcp4_parser.yy"
+  case 785:
+#line 2593 "dhcp4_parser.yy"
                {
     ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("configuration-type", prf);
     ctx.leave();
 }
-#line 4020 "dhcp4_parser.cc"
+#line 4101 "dhcp4_parser.cc"
     break;
 
-  case 769:
-#line 2540 "dhcp4_parser.yy"
+  case 786:
+#line 2599 "dhcp4_parser.yy"
                          {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 4028 "dhcp4_parser.cc"
+#line 4109 "dhcp4_parser.cc"
     break;
 
-  case 770:
-#line 2542 "dhcp4_parser.yy"
+  case 787:
+#line 2601 "dhcp4_parser.yy"
                {
     ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("instance-id", prf);
     ctx.leave();
 }
-#line 4038 "dhcp4_parser.cc"
+#line 4119 "dhcp4_parser.cc"
     break;
 
-  case 771:
-#line 2548 "dhcp4_parser.yy"
+  case 788:
+#line 2607 "dhcp4_parser.yy"
                                                                {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 4046 "dhcp4_parser.cc"
+#line 4127 "dhcp4_parser.cc"
     break;
 
-  case 772:
-#line 2550 "dhcp4_parser.yy"
+  case 789:
+#line 2609 "dhcp4_parser.yy"
               {
     ctx.stack_.back()->set("lawful-interception-parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 4055 "dhcp4_parser.cc"
+#line 4136 "dhcp4_parser.cc"
     break;
 
-  case 773:
-#line 2555 "dhcp4_parser.yy"
+  case 790:
+#line 2614 "dhcp4_parser.yy"
                                  {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("master-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.MASTER_DATABASE);
 }
-#line 4066 "dhcp4_parser.cc"
+#line 4147 "dhcp4_parser.cc"
     break;
 
-  case 774:
-#line 2560 "dhcp4_parser.yy"
+  case 791:
+#line 2619 "dhcp4_parser.yy"
                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 4075 "dhcp4_parser.cc"
+#line 4156 "dhcp4_parser.cc"
     break;
 
-  case 775:
-#line 2565 "dhcp4_parser.yy"
+  case 792:
+#line 2624 "dhcp4_parser.yy"
                                                                {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-address-utilization", n);
 }
-#line 4084 "dhcp4_parser.cc"
+#line 4165 "dhcp4_parser.cc"
     break;
 
-  case 776:
-#line 2570 "dhcp4_parser.yy"
+  case 793:
+#line 2629 "dhcp4_parser.yy"
                                                        {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-statement-tries", n);
 }
-#line 4093 "dhcp4_parser.cc"
+#line 4174 "dhcp4_parser.cc"
     break;
 
-  case 777:
-#line 2575 "dhcp4_parser.yy"
+  case 794:
+#line 2634 "dhcp4_parser.yy"
                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("notifications", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 4104 "dhcp4_parser.cc"
+#line 4185 "dhcp4_parser.cc"
     break;
 
-  case 778:
-#line 2580 "dhcp4_parser.yy"
+  case 795:
+#line 2639 "dhcp4_parser.yy"
                                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 4113 "dhcp4_parser.cc"
+#line 4194 "dhcp4_parser.cc"
     break;
 
-  case 779:
-#line 2585 "dhcp4_parser.yy"
+  case 796:
+#line 2644 "dhcp4_parser.yy"
                                                             {
     ElementPtr l(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-set-description", l);
 }
-#line 4122 "dhcp4_parser.cc"
+#line 4203 "dhcp4_parser.cc"
     break;
 
-  case 780:
-#line 2590 "dhcp4_parser.yy"
+  case 797:
+#line 2649 "dhcp4_parser.yy"
                                            {
     ElementPtr l(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-set-id", l);
 }
-#line 4131 "dhcp4_parser.cc"
+#line 4212 "dhcp4_parser.cc"
     break;
 
-  case 781:
-#line 2595 "dhcp4_parser.yy"
+  case 798:
+#line 2654 "dhcp4_parser.yy"
                                                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 4139 "dhcp4_parser.cc"
+#line 4220 "dhcp4_parser.cc"
     break;
 
-  case 782:
-#line 2597 "dhcp4_parser.yy"
+  case 799:
+#line 2656 "dhcp4_parser.yy"
               {
     ctx.stack_.back()->set("policy-engine-parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 4148 "dhcp4_parser.cc"
+#line 4229 "dhcp4_parser.cc"
     break;
 
-  case 783:
-#line 2602 "dhcp4_parser.yy"
+  case 800:
+#line 2661 "dhcp4_parser.yy"
                                                          {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("privacy-history-size", prf);
 }
-#line 4157 "dhcp4_parser.cc"
+#line 4238 "dhcp4_parser.cc"
     break;
 
-  case 784:
-#line 2607 "dhcp4_parser.yy"
+  case 801:
+#line 2666 "dhcp4_parser.yy"
                                                              {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("privacy-valid-lifetime", prf);
 }
-#line 4166 "dhcp4_parser.cc"
+#line 4247 "dhcp4_parser.cc"
     break;
 
-  case 785:
-#line 2612 "dhcp4_parser.yy"
+  case 802:
+#line 2671 "dhcp4_parser.yy"
                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 4174 "dhcp4_parser.cc"
+#line 4255 "dhcp4_parser.cc"
     break;
 
-  case 786:
-#line 2614 "dhcp4_parser.yy"
+  case 803:
+#line 2673 "dhcp4_parser.yy"
                {
     ElementPtr protocol(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("protocol", protocol);
     ctx.leave();
 }
-#line 4184 "dhcp4_parser.cc"
+#line 4265 "dhcp4_parser.cc"
     break;
 
-  case 787:
-#line 2620 "dhcp4_parser.yy"
+  case 804:
+#line 2679 "dhcp4_parser.yy"
                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 4192 "dhcp4_parser.cc"
+#line 4273 "dhcp4_parser.cc"
     break;
 
-  case 788:
-#line 2622 "dhcp4_parser.yy"
+  case 805:
+#line 2681 "dhcp4_parser.yy"
                {
     ElementPtr cp(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ssl-cert", cp);
     ctx.leave();
 }
-#line 4202 "dhcp4_parser.cc"
+#line 4283 "dhcp4_parser.cc"
     break;
 
-  case 789:
-#line 2628 "dhcp4_parser.yy"
+  case 806:
+#line 2687 "dhcp4_parser.yy"
                                                            {
     ElementPtr offset(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("v4-psid-offset", offset);
 }
-#line 4211 "dhcp4_parser.cc"
+#line 4292 "dhcp4_parser.cc"
     break;
 
-  case 790:
-#line 2633 "dhcp4_parser.yy"
+  case 807:
+#line 2692 "dhcp4_parser.yy"
                                                      {
     ElementPtr psid_len(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("v4-psid-len", psid_len);
 }
-#line 4220 "dhcp4_parser.cc"
+#line 4301 "dhcp4_parser.cc"
     break;
 
-  case 791:
-#line 2640 "dhcp4_parser.yy"
+  case 808:
+#line 2699 "dhcp4_parser.yy"
                                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("v4-excluded-psids", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 4231 "dhcp4_parser.cc"
+#line 4312 "dhcp4_parser.cc"
     break;
 
-  case 792:
-#line 2645 "dhcp4_parser.yy"
+  case 809:
+#line 2704 "dhcp4_parser.yy"
                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 4240 "dhcp4_parser.cc"
+#line 4321 "dhcp4_parser.cc"
     break;
 
 
-#line 4244 "dhcp4_parser.cc"
+#line 4325 "dhcp4_parser.cc"
 
             default:
               break;
@@ -4511,142 +4592,145 @@ namespace isc { namespace dhcp {
   }
 
 
-  const short Dhcp4Parser::yypact_ninf_ = -985;
+  const short Dhcp4Parser::yypact_ninf_ = -1009;
 
   const signed char Dhcp4Parser::yytable_ninf_ = -1;
 
   const short
   Dhcp4Parser::yypact_[] =
   {
-     570,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,    40,    34,    63,    87,    89,   114,
-     125,   127,   129,   141,   158,   160,   168,   250,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,    34,  -169,    36,   124,    67,   515,
-     183,   240,   -32,   353,   533,   172,   599,   201,  -985,    66,
-      71,   175,    60,   101,  -985,    39,  -985,  -985,  -985,  -985,
-    -985,   216,   280,   291,  -985,  -985,  -985,  -985,  -985,  -985,
-     293,   312,   314,   357,   361,   362,   371,   372,   373,  -985,
-     384,   386,   393,   394,   395,  -985,  -985,  -985,   396,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,   397,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,   398,   399,   402,   404,   406,  -985,
-      41,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,   407,  -985,    70,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,   408,  -985,  -985,  -985,  -985,  -985,   411,   413,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,    77,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,   416,  -985,  -985,  -985,  -985,  -985,
-      85,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,   253,   272,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,   295,  -985,  -985,   417,  -985,  -985,  -985,   418,
-    -985,  -985,   336,   420,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,   421,   422,  -985,
-    -985,  -985,  -985,   352,   425,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,    97,
-    -985,  -985,  -985,  -985,  -985,   426,  -985,  -985,   427,  -985,
-     428,   429,  -985,  -985,   430,   435,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,   100,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,   441,   119,  -985,  -985,  -985,  -985,    34,    34,  -985,
-     223,   445,    36,  -985,   447,   449,   450,   248,   251,   254,
-     455,   458,   460,   462,   465,   470,   269,   273,   274,   278,
-     281,   270,   279,   285,   283,   491,   289,   290,   292,   294,
-     296,   495,   496,   498,   297,   504,   506,   507,   508,   511,
-     514,   516,   517,   519,   521,   522,   523,   322,   526,   527,
-     530,   534,   543,   544,   545,   548,   556,   558,   559,   560,
-     359,   363,   374,   375,  -985,   124,  -985,   562,   576,   587,
-     388,    67,  -985,   591,   594,   595,   596,   597,   598,   401,
-     600,   601,   602,   618,   619,   419,   423,   515,  -985,   625,
-     424,   183,  -985,   630,   632,   633,   634,   635,   636,   637,
-     638,  -985,   240,  -985,   640,   641,   439,   662,   663,   664,
-     466,  -985,   353,   667,   467,   476,  -985,   533,   675,   682,
-     683,   686,   -71,  -985,   487,   693,   694,   492,   696,   494,
-     497,   698,   699,   499,   500,   706,   707,   708,   709,   599,
-    -985,   710,   509,   201,  -985,  -985,  -985,   711,   712,  -985,
-     713,   715,   720,  -985,  -985,  -985,   512,   524,   525,   721,
-     722,   727,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,   529,  -985,  -985,  -985,  -985,  -985,   154,   531,   532,
-    -985,   728,   731,   735,   736,   748,   550,   130,   752,   753,
-     754,   755,   769,  -985,   770,   771,   772,   773,   575,   577,
-     777,   778,   578,   580,   780,   781,  -985,  -985,  -985,  -985,
-    -985,   785,   265,   299,  -985,  -985,   585,   586,   588,   788,
-     589,   590,  -985,   785,   593,   793,   603,   796,  -985,  -985,
-    -985,   604,  -985,  -985,   785,   605,   606,   607,   608,   610,
-     611,   612,  -985,   613,   614,  -985,   615,   616,   617,  -985,
-    -985,   620,  -985,  -985,  -985,   621,   748,    34,    34,  -985,
-    -985,   622,   623,  -985,   624,  -985,  -985,    14,   446,  -985,
-    -985,   154,   626,   627,   628,  -985,   797,  -985,  -985,    34,
-     124,   201,    67,   779,  -985,  -985,  -985,   609,   609,   799,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,   800,
-     801,   817,   818,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,   211,   824,   828,   829,    17,   -42,    65,   -30,   599,
-    -985,  -985,   830,   609,  -985,  -985,   609,    74,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,   831,
-    -985,  -985,  -985,  -985,   210,  -985,    34,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,   799,  -985,   121,
-     155,   163,  -985,   209,  -985,  -985,  -985,  -985,  -985,  -985,
-     835,   836,   837,   838,   839,  -985,  -985,  -985,  -985,   840,
-     841,   842,   843,   844,   845,   846,  -985,  -985,  -985,   213,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,   219,  -985,   798,   714,  -985,  -985,
-     847,   848,  -985,  -985,   849,   851,  -985,  -985,   850,   854,
-    -985,  -985,   852,   856,  -985,  -985,  -985,  -985,  -985,  -985,
-      81,  -985,  -985,  -985,  -985,  -985,  -985,  -985,   122,  -985,
-    -985,   855,   857,  -985,  -985,   858,   859,  -985,   861,   862,
-     863,   864,   865,   866,   242,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,   867,   868,   869,  -985,   245,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,   255,  -985,
-    -985,  -985,   870,  -985,   871,  -985,  -985,  -985,   257,  -985,
-    -985,  -985,  -985,  -985,   264,  -985,   174,  -985,   271,   282,
-     872,  -985,  -985,  -985,   288,  -985,  -985,  -985,  -985,   646,
-    -985,   873,   860,  -985,  -985,  -985,  -985,   874,   875,   877,
-    -985,  -985,  -985,   876,   779,  -985,   880,   881,   882,   883,
-     670,   669,   681,   680,   684,   886,   888,   889,   890,   688,
-     689,   690,   691,   692,   695,   697,   895,   896,   609,  -985,
-    -985,   609,  -985,   799,   515,  -985,   800,   353,  -985,   801,
-     533,  -985,   817,   310,  -985,   818,   211,  -985,   144,   824,
-    -985,   240,  -985,   828,   172,  -985,   829,   700,   701,   702,
-     703,   704,   705,    17,  -985,   716,   717,   719,   -42,  -985,
-     899,   901,    65,  -985,   718,   902,   723,   909,   -30,  -985,
-    -985,   -28,   830,  -985,  -985,  -985,   724,    74,  -985,  -985,
-     908,   912,   183,  -985,   831,   913,  -985,  -985,  -985,   725,
-    -985,   358,   726,   729,   730,  -985,  -985,  -985,  -985,  -985,
-     732,   733,   738,   739,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,   742,   744,  -985,   298,  -985,   301,  -985,   910,  -985,
-     911,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,   323,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-     916,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-     914,   918,  -985,  -985,  -985,  -985,  -985,   915,  -985,   338,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,   747,   761,  -985,  -985,   763,  -985,    34,  -985,
-    -985,   924,  -985,  -985,  -985,  -985,  -985,   339,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,   766,   340,  -985,   785,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,   310,
-    -985,   925,   764,  -985,   144,  -985,  -985,  -985,  -985,  -985,
-    -985,   930,   767,   938,   -28,  -985,  -985,  -985,  -985,  -985,
-     775,  -985,  -985,   956,  -985,   782,  -985,  -985,   969,  -985,
-    -985,   243,  -985,    37,   969,  -985,  -985,   974,   975,   982,
-    -985,   356,  -985,  -985,  -985,  -985,  -985,  -985,  -985,   988,
-     789,   792,   794,  1002,    37,  -985,   809,  -985,  -985,  -985,
-     810,  -985,  -985,  -985
+     584, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009,    36,    34,    37,    59,    63,    65,
+      73,    81,    87,    89,   103,   120,   153,   161, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009,    34,  -174,   164,   124,    67,   633,
+     233,   274,   -34,    69,   126,    95,   423,    52, -1009,    68,
+     133,    38,   214,   229, -1009,    45, -1009, -1009, -1009, -1009,
+   -1009,   230,   243,   250, -1009, -1009, -1009, -1009, -1009, -1009,
+     253,   267,   285,   288,   295,   307,   310,   323,   329, -1009,
+     348,   360,   361,   362,   371, -1009, -1009, -1009,   374, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009,   384, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009,   385,   386,   395,   397,   398, -1009,
+      70, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009,   399, -1009,   101, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009,   402, -1009, -1009, -1009, -1009, -1009,   404,   406, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,   121,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009,   407, -1009, -1009, -1009, -1009, -1009,
+     129, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,   293,   342,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009,   409, -1009, -1009,   408, -1009, -1009, -1009,   411,
+   -1009, -1009,   413,   419, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009,   421,   422, -1009,
+   -1009, -1009, -1009,   415,   431, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,   131,
+   -1009, -1009, -1009, -1009, -1009,   433, -1009, -1009,   434, -1009,
+     435,   437, -1009, -1009,   438,   439, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009,   172, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009,   441,   173, -1009, -1009, -1009, -1009,    34,    34, -1009,
+     221,   442,   164, -1009,   444,   445,   447,   236,   237,   240,
+     455,   456,   458,   459,   460,   462,   254,   259,   264,   266,
+     270,   263,   260,   271,   275,   489,   280,   281,   284,   286,
+     289,   493,   495,   496,   291,   498,   501,   506,   507,   508,
+     511,   516,   517,   519,   523,   525,   526,   316,   530,   534,
+     537,   541,   543,   544,   545,   548,   555,   556,   558,   559,
+     304,   349,   351,   355, -1009,   124, -1009,   561,   568,   569,
+     370,    67, -1009,   585,   586,   587,   588,   591,   592,   373,
+     593,   594,   595,   596,   597,   390,   391,   633, -1009,   603,
+     393,   233, -1009,   605,   606,   607,   608,   609,   610,   614,
+     615, -1009,   274, -1009,   616,   617,   410,   618,   619,   620,
+     414, -1009,    69,   622,   417,   424, -1009,   126,   623,   624,
+     628,   632,   -45, -1009,   425,   634,   635,   428,   636,   429,
+     430,   642,   644,   432,   436,   646,   647,   648,   650,   423,
+   -1009,   651,   443,    52, -1009, -1009, -1009,   652,   657, -1009,
+     658,   659,   660, -1009, -1009, -1009,   454,   457,   461,   669,
+     670,   673, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009,   465, -1009, -1009, -1009, -1009, -1009,  -117,   471,   472,
+   -1009,   682,   683,   685,   686,   687,   479,    35,   691,   692,
+     701,   702,   710, -1009,   714,   722,   723,   724,   494,   513,
+     704,   725,   527,   528,   736,   737, -1009, -1009, -1009, -1009,
+   -1009,   740,   170,   303, -1009, -1009,   532,   535,   538,   743,
+     539,   542, -1009,   740,   598,   748,   599,   752, -1009, -1009,
+   -1009,   601, -1009, -1009,   740,   602,   604,   611,   612,   613,
+     621,   625, -1009,   626,   627, -1009,   629,   630,   631, -1009,
+   -1009,   637, -1009, -1009, -1009,   638,   687,    34,    34, -1009,
+   -1009,   639,   640, -1009,   641, -1009, -1009,    14,   492, -1009,
+   -1009,  -117,   643,   645,   649, -1009,   793, -1009, -1009,    34,
+     124,    52,    67,   775, -1009, -1009, -1009,   720,   720,   794,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,   795,
+     798,   799,   800, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009,   119,   801,   802,   804,   296,   -35,    39,   -56,   423,
+   -1009, -1009,   810,   720, -1009, -1009,   720,    19, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,   812,
+   -1009, -1009, -1009, -1009,   228, -1009,    34, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009,   794, -1009,   174,
+     207,   227, -1009,   257, -1009, -1009, -1009, -1009, -1009, -1009,
+     796,   816,   817,   818,   819, -1009, -1009, -1009, -1009,   820,
+     824,   825,   826,   830,   832,   833, -1009,   834,   838,   842,
+     844,   845,   846,   852, -1009, -1009, -1009,   258, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+     261, -1009,   854,   855, -1009, -1009,   856,   858, -1009, -1009,
+     859,   861, -1009, -1009,   860,   864, -1009, -1009,   862,   866,
+   -1009, -1009, -1009, -1009, -1009, -1009,    84, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009,   108, -1009, -1009,   865,   867, -1009,
+   -1009,   868,   869, -1009,   871,   872,   873,   874,   875,   876,
+     265, -1009, -1009, -1009, -1009, -1009, -1009, -1009,   877,   878,
+     879, -1009,   276, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009,   279, -1009, -1009, -1009,   880, -1009,
+     881, -1009, -1009, -1009,   282, -1009, -1009, -1009, -1009, -1009,
+     283, -1009,   122, -1009,   290,   297,   882, -1009, -1009, -1009,
+     309, -1009, -1009, -1009, -1009,   674, -1009,   883,   870, -1009,
+   -1009, -1009, -1009,   884,   885,   887, -1009, -1009, -1009,   886,
+     775, -1009,   890,   891,   892,   893,   672,   681,   684,   688,
+     689,   896,   897,   898,   899,   694,   695,   696,   697,   690,
+     698,   703,   902,   699,   705,   700,   706,   707,   708,   711,
+     914,   915,   720, -1009, -1009,   720, -1009,   794,   633, -1009,
+     795,    69, -1009,   798,   126, -1009,   799,   302, -1009,   800,
+     119, -1009,   514,   801, -1009,   274, -1009,   802,    95, -1009,
+     804,   712,   713,   715,   716,   717,   718,   296, -1009,   719,
+     726,   727,   -35, -1009,   917,   925,    39, -1009,   721,   931,
+     728,   933,   -56, -1009, -1009,    83,   810, -1009, -1009, -1009,
+     729,    19, -1009, -1009,   934,   936,   233, -1009,   812,   940,
+   -1009, -1009, -1009,   731, -1009,   324,   733,   734,   735, -1009,
+   -1009, -1009, -1009, -1009,   738,   739,   741,   742, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009,   744, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009,   745,   746, -1009,   317, -1009,   318, -1009,
+     942, -1009,   943, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+     334, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009,   950, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009,   949,   959, -1009, -1009, -1009, -1009, -1009,   955,
+   -1009,   340, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009,   754,   755, -1009, -1009,   758, -1009,
+      34, -1009, -1009,   962, -1009, -1009, -1009, -1009, -1009,   341,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,   760,   343,
+   -1009,   740, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009,   302, -1009,   973,   768, -1009,   514, -1009, -1009,
+   -1009, -1009, -1009, -1009,   987,   778,   992,    83, -1009, -1009,
+   -1009, -1009, -1009,   783, -1009, -1009,   993, -1009,   786, -1009,
+   -1009,   995, -1009, -1009,   208, -1009,    98,   995, -1009, -1009,
+     999,  1001,  1006, -1009,   350, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009,  1008,   805,   808,   815,  1012,    98, -1009,   811,
+   -1009, -1009, -1009,   827, -1009, -1009, -1009
   };
 
   const short
@@ -4656,17 +4740,17 @@ namespace isc { namespace dhcp {
       20,    22,    24,    26,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     1,    43,
       36,    32,    31,    28,    29,    30,    35,     3,    33,    34,
-      56,     5,    63,     7,   174,     9,   337,    11,   524,    13,
-     551,    15,   449,    17,   457,    19,   494,    21,   300,    23,
-     666,    25,   716,    27,    45,    39,     0,     0,     0,     0,
-       0,   553,     0,   459,   496,     0,     0,     0,    47,     0,
-      46,     0,     0,    40,    61,     0,    58,    60,   714,   163,
-     189,     0,     0,     0,   572,   574,   576,   187,   196,   198,
+      56,     5,    63,     7,   174,     9,   354,    11,   541,    13,
+     568,    15,   466,    17,   474,    19,   511,    21,   317,    23,
+     683,    25,   733,    27,    45,    39,     0,     0,     0,     0,
+       0,   570,     0,   476,   513,     0,     0,     0,    47,     0,
+      46,     0,     0,    40,    61,     0,    58,    60,   731,   163,
+     189,     0,     0,     0,   589,   591,   593,   187,   196,   198,
        0,     0,     0,     0,     0,     0,     0,     0,     0,   137,
-       0,     0,     0,     0,     0,   145,   152,   154,     0,   329,
-     447,   486,   404,   539,   541,   397,   265,   600,   543,   292,
-     313,     0,   279,   626,   648,   664,   156,   158,   725,   765,
-     767,   769,   773,   777,     0,     0,     0,     0,     0,   127,
+       0,     0,     0,     0,     0,   145,   152,   154,     0,   346,
+     464,   503,   421,   556,   558,   414,   282,   617,   560,   309,
+     330,     0,   296,   643,   665,   681,   156,   158,   742,   782,
+     784,   786,   790,   794,     0,     0,     0,     0,     0,   127,
        0,    65,    67,    68,    69,    70,    71,   102,   103,   104,
       72,   100,    89,    90,    91,   108,   109,   110,   111,   112,
      113,   106,   107,   114,   115,   116,    75,    76,    97,    77,
@@ -4674,26 +4758,26 @@ namespace isc { namespace dhcp {
       95,    96,    98,    92,    93,    94,    80,    85,    86,    87,
       88,    99,   105,   118,   119,   120,   121,   122,   123,   124,
      125,   126,   176,   178,   182,     0,   173,     0,   165,   167,
-     168,   169,   170,   171,   172,   385,   387,   389,   516,   383,
-     391,     0,   395,   393,   596,   763,   791,     0,     0,   382,
-     341,   342,   343,   344,   345,   366,   367,   368,   356,   357,
-     369,   370,   371,   372,   373,   374,   375,   376,   377,     0,
-     339,   348,   361,   362,   363,   349,   351,   352,   354,   350,
-     346,   347,   364,   365,   353,   358,   359,   360,   355,   378,
-     381,   380,   379,   537,     0,   536,   530,   531,   534,   529,
-       0,   526,   528,   532,   533,   535,   594,   582,   584,   588,
-     586,   592,   590,   578,   571,   565,   569,   570,     0,   554,
-     555,   566,   567,   568,   562,   557,   563,   559,   560,   561,
-     564,   558,     0,   476,   245,     0,   480,   478,   483,     0,
-     472,   473,     0,   460,   461,   463,   475,   464,   465,   466,
-     482,   467,   468,   469,   470,   471,   510,     0,     0,   508,
-     509,   512,   513,     0,   497,   498,   500,   501,   502,   503,
-     504,   505,   506,   507,   309,   311,   771,   781,   304,     0,
-     302,   305,   306,   307,   308,     0,   702,   689,     0,   692,
-       0,     0,   696,   700,     0,     0,   706,   708,   710,   712,
-     687,   685,   686,     0,   668,   670,   671,   672,   673,   674,
-     675,   676,   677,   682,   678,   679,   680,   681,   683,   684,
-     722,     0,     0,   718,   720,   721,    44,     0,     0,    37,
+     168,   169,   170,   171,   172,   402,   404,   406,   533,   400,
+     408,     0,   412,   410,   613,   780,   808,     0,     0,   399,
+     358,   359,   360,   361,   362,   383,   384,   385,   373,   374,
+     386,   387,   388,   389,   390,   391,   392,   393,   394,     0,
+     356,   365,   378,   379,   380,   366,   368,   369,   371,   367,
+     363,   364,   381,   382,   370,   375,   376,   377,   372,   395,
+     398,   397,   396,   554,     0,   553,   547,   548,   551,   546,
+       0,   543,   545,   549,   550,   552,   611,   599,   601,   605,
+     603,   609,   607,   595,   588,   582,   586,   587,     0,   571,
+     572,   583,   584,   585,   579,   574,   580,   576,   577,   578,
+     581,   575,     0,   493,   253,     0,   497,   495,   500,     0,
+     489,   490,     0,   477,   478,   480,   492,   481,   482,   483,
+     499,   484,   485,   486,   487,   488,   527,     0,     0,   525,
+     526,   529,   530,     0,   514,   515,   517,   518,   519,   520,
+     521,   522,   523,   524,   326,   328,   788,   798,   321,     0,
+     319,   322,   323,   324,   325,     0,   719,   706,     0,   709,
+       0,     0,   713,   717,     0,     0,   723,   725,   727,   729,
+     704,   702,   703,     0,   685,   687,   688,   689,   690,   691,
+     692,   693,   694,   699,   695,   696,   697,   698,   700,   701,
+     739,     0,     0,   735,   737,   738,    44,     0,     0,    37,
        0,     0,     0,    57,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
@@ -4702,134 +4786,138 @@ namespace isc { namespace dhcp {
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,    55,     0,    64,     0,     0,     0,
        0,     0,   175,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   338,     0,
-       0,     0,   525,     0,     0,     0,     0,     0,     0,     0,
-       0,   552,     0,   450,     0,     0,     0,     0,     0,     0,
-       0,   458,     0,     0,     0,     0,   495,     0,     0,     0,
-       0,     0,     0,   301,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   355,     0,
+       0,     0,   542,     0,     0,     0,     0,     0,     0,     0,
+       0,   569,     0,   467,     0,     0,     0,     0,     0,     0,
+       0,   475,     0,     0,     0,     0,   512,     0,     0,     0,
+       0,     0,     0,   318,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     667,     0,     0,     0,   717,    48,    41,     0,     0,    59,
+     684,     0,     0,     0,   734,    48,    41,     0,     0,    59,
        0,     0,     0,   139,   140,   141,     0,     0,     0,     0,
        0,     0,   128,   129,   130,   131,   132,   133,   134,   135,
      136,     0,   161,   162,   142,   143,   144,     0,     0,     0,
      160,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   625,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   779,   780,   783,   784,
+       0,     0,     0,   642,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   796,   797,   800,   801,
       66,     0,     0,     0,   186,   166,     0,     0,     0,     0,
-       0,     0,   403,     0,     0,     0,     0,     0,   790,   789,
-     340,     0,   775,   527,     0,     0,     0,     0,     0,     0,
-       0,     0,   556,     0,     0,   474,     0,     0,     0,   485,
-     462,     0,   514,   515,   499,     0,     0,     0,     0,   303,
-     688,     0,     0,   691,     0,   694,   695,     0,     0,   704,
-     705,     0,     0,     0,     0,   669,     0,   724,   719,     0,
-       0,     0,     0,     0,   573,   575,   577,     0,     0,   200,
-     138,   147,   148,   149,   150,   151,   146,   153,   155,   331,
-     451,   488,   406,    38,   540,   542,   399,   400,   401,   402,
-     398,     0,     0,   545,   294,     0,     0,     0,     0,     0,
-     157,   159,     0,     0,   768,   770,     0,     0,    49,   177,
-     180,   181,   179,   184,   185,   183,   386,   388,   390,   518,
-     384,   392,   396,   394,     0,   764,    45,   538,   595,   583,
-     585,   589,   587,   593,   591,   579,   477,   246,   481,   479,
-     484,   511,   310,   312,   772,   782,   703,   690,   693,   698,
-     699,   697,   701,   707,   709,   711,   713,   200,    42,     0,
-       0,     0,   194,     0,   191,   193,   232,   238,   240,   242,
-       0,     0,     0,     0,     0,   254,   256,   258,   260,     0,
-       0,     0,     0,     0,     0,     0,   785,   787,   231,     0,
-     206,   208,   209,   210,   211,   212,   213,   214,   215,   216,
-     217,   221,   222,   223,   218,   224,   225,   226,   219,   220,
-     227,   228,   229,   230,     0,   204,     0,   201,   202,   335,
-       0,   332,   333,   455,     0,   452,   453,   492,     0,   489,
-     490,   410,     0,   407,   408,   274,   275,   276,   277,   278,
-       0,   267,   269,   270,   271,   272,   273,   604,     0,   602,
-     549,     0,   546,   547,   298,     0,   295,   296,     0,     0,
-       0,     0,     0,     0,     0,   315,   317,   318,   319,   320,
-     321,   322,     0,     0,     0,   288,     0,   281,   283,   284,
-     285,   286,   287,   643,   645,   634,   632,   633,     0,   628,
-     630,   631,     0,   659,     0,   662,   655,   656,     0,   650,
-     652,   653,   654,   657,     0,   729,     0,   727,     0,     0,
-       0,   642,   639,   640,     0,   635,   637,   638,   641,    51,
-     522,     0,   519,   520,   580,   598,   599,     0,     0,     0,
-      62,   715,   164,     0,     0,   190,     0,     0,     0,     0,
+       0,     0,   420,     0,     0,     0,     0,     0,   807,   806,
+     357,     0,   792,   544,     0,     0,     0,     0,     0,     0,
+       0,     0,   573,     0,     0,   491,     0,     0,     0,   502,
+     479,     0,   531,   532,   516,     0,     0,     0,     0,   320,
+     705,     0,     0,   708,     0,   711,   712,     0,     0,   721,
+     722,     0,     0,     0,     0,   686,     0,   741,   736,     0,
+       0,     0,     0,     0,   590,   592,   594,     0,     0,   200,
+     138,   147,   148,   149,   150,   151,   146,   153,   155,   348,
+     468,   505,   423,    38,   557,   559,   416,   417,   418,   419,
+     415,     0,     0,   562,   311,     0,     0,     0,     0,     0,
+     157,   159,     0,     0,   785,   787,     0,     0,    49,   177,
+     180,   181,   179,   184,   185,   183,   403,   405,   407,   535,
+     401,   409,   413,   411,     0,   781,    45,   555,   612,   600,
+     602,   606,   604,   610,   608,   596,   494,   254,   498,   496,
+     501,   528,   327,   329,   789,   799,   720,   707,   710,   715,
+     716,   714,   718,   724,   726,   728,   730,   200,    42,     0,
+       0,     0,   194,     0,   191,   193,   240,   246,   248,   250,
+       0,     0,     0,     0,     0,   262,   264,   266,   268,     0,
+       0,     0,     0,     0,     0,     0,   274,     0,     0,     0,
+       0,     0,     0,     0,   802,   804,   239,     0,   206,   208,
+     209,   210,   211,   212,   213,   214,   215,   216,   217,   221,
+     222,   223,   218,   224,   225,   226,   219,   220,   227,   231,
+     232,   233,   234,   235,   236,   237,   238,   228,   229,   230,
+       0,   204,     0,   201,   202,   352,     0,   349,   350,   472,
+       0,   469,   470,   509,     0,   506,   507,   427,     0,   424,
+     425,   291,   292,   293,   294,   295,     0,   284,   286,   287,
+     288,   289,   290,   621,     0,   619,   566,     0,   563,   564,
+     315,     0,   312,   313,     0,     0,     0,     0,     0,     0,
+       0,   332,   334,   335,   336,   337,   338,   339,     0,     0,
+       0,   305,     0,   298,   300,   301,   302,   303,   304,   660,
+     662,   651,   649,   650,     0,   645,   647,   648,     0,   676,
+       0,   679,   672,   673,     0,   667,   669,   670,   671,   674,
+       0,   746,     0,   744,     0,     0,     0,   659,   656,   657,
+       0,   652,   654,   655,   658,    51,   539,     0,   536,   537,
+     597,   615,   616,     0,     0,     0,    62,   732,   164,     0,
+       0,   190,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   188,
-     197,     0,   199,     0,     0,   330,     0,   459,   448,     0,
-     496,   487,     0,     0,   405,     0,     0,   266,   606,     0,
-     601,   553,   544,     0,     0,   293,     0,     0,     0,     0,
-       0,     0,     0,     0,   314,     0,     0,     0,     0,   280,
-       0,     0,     0,   627,     0,     0,     0,     0,     0,   649,
-     665,     0,     0,   726,   766,   774,     0,     0,   778,    53,
-       0,    52,     0,   517,     0,     0,   597,   792,   723,     0,
-     192,     0,     0,     0,     0,   244,   247,   248,   249,   250,
-       0,     0,     0,     0,   262,   263,   251,   252,   253,   264,
-     776,     0,     0,   207,     0,   203,     0,   334,     0,   454,
-       0,   491,   446,   429,   430,   431,   417,   418,   434,   435,
-     436,   420,   421,   437,   438,   439,   440,   441,   442,   443,
-     444,   445,   414,   415,   416,   427,   428,   426,     0,   412,
-     419,   432,   433,   422,   423,   424,   425,   409,   268,   622,
-       0,   620,   621,   613,   614,   618,   619,   615,   616,   617,
-       0,   607,   608,   610,   611,   612,   603,     0,   548,     0,
-     297,   323,   324,   325,   326,   327,   328,   316,   289,   290,
-     291,   282,     0,     0,   629,   658,     0,   661,     0,   651,
-     743,     0,   741,   739,   733,   737,   738,     0,   731,   735,
-     736,   734,   728,   647,   636,    50,     0,     0,   521,     0,
-     195,   234,   235,   236,   237,   233,   239,   241,   243,   255,
-     257,   259,   261,   786,   788,   205,   336,   456,   493,     0,
-     411,     0,     0,   605,     0,   550,   299,   644,   646,   660,
-     663,     0,     0,     0,     0,   730,    54,   523,   581,   413,
-       0,   624,   609,     0,   740,     0,   732,   623,     0,   742,
-     747,     0,   745,     0,     0,   744,   756,     0,     0,     0,
-     761,     0,   749,   751,   752,   753,   754,   755,   746,     0,
-       0,     0,     0,     0,     0,   748,     0,   758,   759,   760,
-       0,   750,   757,   762
+       0,     0,     0,   188,   197,     0,   199,     0,     0,   347,
+       0,   476,   465,     0,   513,   504,     0,     0,   422,     0,
+       0,   283,   623,     0,   618,   570,   561,     0,     0,   310,
+       0,     0,     0,     0,     0,     0,     0,     0,   331,     0,
+       0,     0,     0,   297,     0,     0,     0,   644,     0,     0,
+       0,     0,     0,   666,   682,     0,     0,   743,   783,   791,
+       0,     0,   795,    53,     0,    52,     0,   534,     0,     0,
+     614,   809,   740,     0,   192,     0,     0,     0,     0,   252,
+     255,   256,   257,   258,     0,     0,     0,     0,   270,   271,
+     259,   260,   261,   272,   273,     0,   276,   277,   278,   279,
+     280,   281,   793,     0,     0,   207,     0,   203,     0,   351,
+       0,   471,     0,   508,   463,   446,   447,   448,   434,   435,
+     451,   452,   453,   437,   438,   454,   455,   456,   457,   458,
+     459,   460,   461,   462,   431,   432,   433,   444,   445,   443,
+       0,   429,   436,   449,   450,   439,   440,   441,   442,   426,
+     285,   639,     0,   637,   638,   630,   631,   635,   636,   632,
+     633,   634,     0,   624,   625,   627,   628,   629,   620,     0,
+     565,     0,   314,   340,   341,   342,   343,   344,   345,   333,
+     306,   307,   308,   299,     0,     0,   646,   675,     0,   678,
+       0,   668,   760,     0,   758,   756,   750,   754,   755,     0,
+     748,   752,   753,   751,   745,   664,   653,    50,     0,     0,
+     538,     0,   195,   242,   243,   244,   245,   241,   247,   249,
+     251,   263,   265,   267,   269,   275,   803,   805,   205,   353,
+     473,   510,     0,   428,     0,     0,   622,     0,   567,   316,
+     661,   663,   677,   680,     0,     0,     0,     0,   747,    54,
+     540,   598,   430,     0,   641,   626,     0,   757,     0,   749,
+     640,     0,   759,   764,     0,   762,     0,     0,   761,   773,
+       0,     0,     0,   778,     0,   766,   768,   769,   770,   771,
+     772,   763,     0,     0,     0,     0,     0,     0,   765,     0,
+     775,   776,   777,     0,   767,   774,   779
   };
 
   const short
   Dhcp4Parser::yypgoto_[] =
   {
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,    -4,  -985,  -569,  -985,   341,
-    -985,  -985,  -985,  -985,   150,  -985,  -616,  -985,  -985,  -985,
-     -67,  -985,  -985,  -985,   648,  -985,  -985,  -985,  -985,   376,
-     537,   -24,     7,    26,    28,    29,    30,    32,    33,  -985,
-    -985,  -985,  -985,    43,    44,    46,    47,    48,    49,  -985,
-     349,    50,  -985,    51,  -985,    54,  -985,    61,  -985,    62,
-    -985,  -985,  -985,  -985,   369,   581,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,    99,  -985,  -985,  -985,  -985,  -985,  -985,   284,
-    -985,    75,  -985,  -684,    82,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,   -48,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,    68,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,    45,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,    53,  -985,  -985,  -985,    58,
-     546,  -985,  -985,  -985,  -985,  -985,  -985,  -985,    52,  -985,
-    -985,  -985,  -985,  -985,  -985,  -984,  -985,  -985,  -985,    80,
-    -985,  -985,  -985,    83,   582,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -983,  -985,   -53,  -985,    56,  -985,    64,
-    -985,  -985,   -50,  -985,  -985,  -985,  -985,    76,  -985,  -985,
-    -129,   -62,  -985,  -985,  -985,  -985,  -985,    84,  -985,  -985,
-    -985,    88,  -985,   564,  -985,   -69,  -985,  -985,  -985,  -985,
-    -985,   -46,  -985,  -985,  -985,  -985,  -985,   -36,  -985,  -985,
-    -985,    86,  -985,  -985,  -985,    90,  -985,   555,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,    35,
-    -985,  -985,  -985,    42,   583,  -985,  -985,   -55,  -985,   -13,
-    -985,   -57,  -985,  -985,  -985,    78,  -985,  -985,  -985,    91,
-    -985,   584,     0,  -985,     6,  -985,    10,  -985,   333,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -982,  -985,  -985,  -985,
-    -985,  -985,    92,  -985,  -985,  -985,  -122,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,    72,  -985,    59,  -725,  -985,
-    -724,  -985,  -985,  -985,  -985,  -985,    55,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,   366,   549,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,   409,   552,
-    -985,  -985,  -985,  -985,  -985,  -985,    57,  -985,  -985,  -127,
-    -985,  -985,  -985,  -985,  -985,  -985,  -141,  -985,  -985,  -157,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,  -985,
-    -985,  -985,  -985,  -985,  -985,  -985,  -985
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009,    -4, -1009,  -568, -1009,   363,
+   -1009, -1009, -1009, -1009,   298, -1009,  -616, -1009, -1009, -1009,
+     -67, -1009, -1009, -1009,   675, -1009, -1009, -1009, -1009,   346,
+     653,   -24,     7,    26,    28,    29,    30,    32,    33, -1009,
+   -1009, -1009, -1009,    43,    44,    46,    47,    48,    49, -1009,
+     403,    50, -1009,    51, -1009,    54, -1009,    61, -1009,    62,
+   -1009, -1009, -1009, -1009,   338,   654, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009,   105, -1009, -1009, -1009, -1009, -1009, -1009,   299,
+   -1009,    75, -1009,  -684,    78, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009,   -48, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009,    66, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009,    41, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009,    55, -1009, -1009, -1009,    60,   562,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009,    53, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1008, -1009, -1009, -1009,    77, -1009,
+   -1009, -1009,    85,   655, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1007, -1009,   -53, -1009,    56, -1009,    64, -1009,
+   -1009,   -50, -1009, -1009, -1009, -1009,    72, -1009, -1009,  -143,
+     -62, -1009, -1009, -1009, -1009, -1009,    79, -1009, -1009, -1009,
+      86, -1009,   582, -1009,   -69, -1009, -1009, -1009, -1009, -1009,
+     -46, -1009, -1009, -1009, -1009, -1009,   -36, -1009, -1009, -1009,
+      80, -1009, -1009, -1009,    88, -1009,   578, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,    31, -1009,
+   -1009, -1009,    40,   656, -1009, -1009,   -55, -1009,   -13, -1009,
+     -57, -1009, -1009, -1009,    71, -1009, -1009, -1009,    76, -1009,
+     661,     0, -1009,     6, -1009,    10, -1009,   356, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1006, -1009, -1009, -1009, -1009,
+   -1009,    82, -1009, -1009, -1009,  -134, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009,    58, -1009,    74,  -725, -1009,  -724,
+   -1009, -1009, -1009, -1009, -1009,    57, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009,   388,   571, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009,   427,   570, -1009,
+   -1009, -1009, -1009, -1009, -1009,    90, -1009, -1009,  -136, -1009,
+   -1009, -1009, -1009, -1009, -1009,  -155, -1009, -1009,  -173, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009, -1009,
+   -1009, -1009, -1009, -1009, -1009, -1009
   };
 
   const short
@@ -4837,48 +4925,49 @@ namespace isc { namespace dhcp {
   {
       -1,    14,    15,    16,    17,    18,    19,    20,    21,    22,
       23,    24,    25,    26,    27,    78,    37,    38,    65,   724,
-      82,    83,    39,    64,    79,    80,   749,   959,  1060,  1061,
-     828,    41,    66,    85,    86,    87,   421,    43,    67,   150,
+      82,    83,    39,    64,    79,    80,   749,   975,  1084,  1085,
+     836,    41,    66,    85,    86,    87,   421,    43,    67,   150,
      151,   152,   153,   154,   155,   156,   157,   158,   159,   160,
      161,   445,   162,   163,   164,   165,   166,   167,   168,   451,
      716,   169,   452,   170,   453,   171,   472,   172,   473,   173,
      174,   175,   176,   425,   217,   218,    45,    68,   219,   487,
      220,   488,   752,   221,   489,   755,   222,   177,   433,   178,
-     426,   803,   804,   805,   973,   179,   434,   180,   435,   856,
-     857,   858,  1001,   829,   830,   831,   976,  1205,   832,   977,
-     833,   978,   834,   979,   835,   836,   525,   837,   838,   839,
-     840,   841,   842,   843,   844,   985,   845,   986,   846,   987,
-     847,   988,   848,   849,   850,   181,   462,   880,   881,   882,
-     883,   884,   885,   886,   182,   468,   916,   917,   918,   919,
-     920,   183,   465,   895,   896,   897,  1024,    59,    75,   369,
-     370,   371,   538,   372,   539,   184,   466,   904,   905,   906,
-     907,   908,   909,   910,   911,   185,   455,   860,   861,   862,
-    1004,    47,    69,   259,   260,   261,   497,   262,   493,   263,
-     494,   264,   495,   265,   498,   266,   501,   267,   500,   186,
-     461,   730,   269,   187,   458,   872,   873,   874,  1013,  1128,
-    1129,   188,   456,    53,    72,   864,   865,   866,  1007,    55,
-      73,   332,   333,   334,   335,   336,   337,   338,   524,   339,
-     528,   340,   527,   341,   342,   529,   343,   189,   457,   868,
-     869,   870,  1010,    57,    74,   353,   354,   355,   356,   357,
-     533,   358,   359,   360,   361,   271,   496,   961,   962,   963,
-    1062,    49,    70,   290,   291,   292,   509,   190,   459,   191,
-     460,   192,   464,   891,   892,   893,  1021,    51,    71,   308,
-     309,   310,   193,   430,   194,   431,   195,   432,   314,   520,
-     966,  1065,   315,   514,   316,   515,   317,   517,   318,   516,
-     319,   519,   320,   518,   321,   513,   278,   502,   967,   196,
-     463,   888,   889,  1018,  1150,  1151,  1152,  1153,  1154,  1221,
-    1155,   197,   198,   469,   928,   929,   954,   955,   930,  1040,
-     931,  1041,   958,   199,   470,   938,   939,   940,   941,  1045,
-     942,   943,  1047,   200,   471,    61,    76,   393,   394,   395,
-     396,   546,   397,   398,   548,   399,   400,   401,   551,   791,
-     402,   552,   403,   545,   404,   405,   406,   555,   407,   556,
-     408,   557,   409,   558,   201,   424,    63,    77,   412,   413,
-     414,   561,   415,   202,   474,   946,   947,  1051,  1187,  1188,
-    1189,  1190,  1233,  1191,  1231,  1251,  1252,  1253,  1261,  1262,
-    1263,  1269,  1264,  1265,  1266,  1267,  1273,   279,   503,   203,
-     475,   204,   476,   205,   477,   373,   540,   206,   478,   295,
-     851,   207,   479,   208,   209,   374,   541,   210,   211,   852,
-     996,   853,   997,   280,   281,   282,   504
+     426,   803,   804,   805,   989,   179,   434,   180,   435,   872,
+     873,   874,  1025,   837,   838,   839,   992,  1237,   840,   993,
+     841,   994,   842,   995,   843,   844,   525,   845,   846,   847,
+     848,   849,   850,   851,   852,  1001,   853,  1002,   854,  1003,
+     855,  1004,   856,   857,   858,   859,   860,  1012,   861,   862,
+     863,   864,   865,   866,   181,   462,   896,   897,   898,   899,
+     900,   901,   902,   182,   468,   932,   933,   934,   935,   936,
+     183,   465,   911,   912,   913,  1048,    59,    75,   369,   370,
+     371,   538,   372,   539,   184,   466,   920,   921,   922,   923,
+     924,   925,   926,   927,   185,   455,   876,   877,   878,  1028,
+      47,    69,   259,   260,   261,   497,   262,   493,   263,   494,
+     264,   495,   265,   498,   266,   501,   267,   500,   186,   461,
+     730,   269,   187,   458,   888,   889,   890,  1037,  1160,  1161,
+     188,   456,    53,    72,   880,   881,   882,  1031,    55,    73,
+     332,   333,   334,   335,   336,   337,   338,   524,   339,   528,
+     340,   527,   341,   342,   529,   343,   189,   457,   884,   885,
+     886,  1034,    57,    74,   353,   354,   355,   356,   357,   533,
+     358,   359,   360,   361,   271,   496,   977,   978,   979,  1086,
+      49,    70,   290,   291,   292,   509,   190,   459,   191,   460,
+     192,   464,   907,   908,   909,  1045,    51,    71,   308,   309,
+     310,   193,   430,   194,   431,   195,   432,   314,   520,   982,
+    1089,   315,   514,   316,   515,   317,   517,   318,   516,   319,
+     519,   320,   518,   321,   513,   278,   502,   983,   196,   463,
+     904,   905,  1042,  1182,  1183,  1184,  1185,  1186,  1254,  1187,
+     197,   198,   469,   944,   945,   970,   971,   946,  1064,   947,
+    1065,   974,   199,   470,   954,   955,   956,   957,  1069,   958,
+     959,  1071,   200,   471,    61,    76,   393,   394,   395,   396,
+     546,   397,   398,   548,   399,   400,   401,   551,   791,   402,
+     552,   403,   545,   404,   405,   406,   555,   407,   556,   408,
+     557,   409,   558,   201,   424,    63,    77,   412,   413,   414,
+     561,   415,   202,   474,   962,   963,  1075,  1219,  1220,  1221,
+    1222,  1266,  1223,  1264,  1284,  1285,  1286,  1294,  1295,  1296,
+    1302,  1297,  1298,  1299,  1300,  1306,   279,   503,   203,   475,
+     204,   476,   205,   477,   373,   540,   206,   478,   295,   867,
+     207,   479,   208,   209,   374,   541,   210,   211,   868,  1020,
+     869,  1021,   280,   281,   282,   504
   };
 
   const short
@@ -4886,133 +4975,136 @@ namespace isc { namespace dhcp {
   {
      149,   216,   239,   285,   304,   351,   330,   349,   368,   390,
      322,    36,   274,   223,   272,   293,   306,   286,   344,   362,
-     288,   391,   956,   957,   854,   331,   350,   762,   352,  1123,
-    1124,  1136,   789,   270,   289,   305,   723,    81,   768,    29,
-      28,    30,   422,    31,   485,   240,    84,   423,   120,   486,
-     364,   365,   123,   124,   324,   224,   273,   294,   307,   948,
-     345,   363,   949,   392,   123,   124,   123,   124,   419,   275,
-      40,   311,   416,   491,   417,   276,   241,   312,   492,   277,
-     507,   313,   212,   213,  1016,   508,   214,  1017,   511,   215,
-     912,   913,   914,   512,    42,   242,    44,   243,   244,   245,
-     542,   246,   247,   559,   420,   543,   366,   723,   560,   932,
-     933,   934,   248,   249,   367,   250,   251,   252,   253,   254,
-     255,    46,   563,   256,   485,  1019,   287,   564,  1020,   970,
-     257,   258,    48,   268,    50,    88,    52,  1180,    89,  1181,
-    1182,   898,   899,   900,   901,   902,   903,    90,    54,    91,
-      92,    93,    94,    95,    96,    97,    98,    99,   563,   123,
-     124,   123,   124,   971,   148,    56,   491,    58,   123,   124,
-     790,   972,    94,    95,    96,    60,   935,  1052,   148,   418,
-    1053,   100,   101,   102,   103,   104,   105,   106,   107,   108,
-     109,   110,   111,   112,   113,   114,   115,   116,   117,   118,
-     119,   923,   924,  1256,   120,   121,  1257,  1258,  1259,  1260,
-     923,   924,   974,   410,   411,   122,   998,   975,   123,   124,
-     427,   999,   998,   125,   120,   121,   324,  1000,   126,   127,
-     726,   727,   728,   729,   128,  1123,  1124,  1136,   123,   124,
-      32,    33,    34,    35,   129,  1033,  1254,   130,  1038,  1255,
-    1034,  1139,  1140,  1039,   131,   132,   950,    62,  1042,   133,
-    1048,   521,   134,  1043,   121,  1049,   135,   559,    94,    95,
-      96,   148,  1050,   148,   998,   522,   283,   123,   124,  1054,
-     148,   231,   750,   751,   428,   998,   136,   137,   138,   232,
-    1055,  1057,   233,   364,   365,   429,  1058,   436,   139,   140,
-     141,   998,   142,   523,   507,   143,  1215,   144,   145,  1216,
-     146,   147,   711,   712,   713,   714,   437,  1094,   438,   753,
-     754,   121,   875,   876,   877,   878,  1219,   879,   303,   964,
-     148,  1220,   956,   957,   123,   124,    92,    93,    94,    95,
-      96,   542,  1234,   511,   531,   296,  1226,  1235,  1237,   366,
-     148,   297,   298,   299,   300,   301,   302,   367,   303,  1274,
-     536,   439,   284,   715,  1275,   440,   441,   100,   101,   102,
-     103,   104,   105,   106,   107,   442,   443,   444,   148,   112,
-     113,   114,   115,   116,   117,   118,   119,   323,   446,   148,
-     447,   121,   324,  1201,  1202,  1203,  1204,   448,   449,   450,
-     454,   467,   480,   481,   123,   124,   482,   230,   483,   125,
-     484,   490,   499,   565,   566,   505,   232,   506,   149,   233,
-     510,   526,   530,   532,   216,   534,   535,   234,   537,   567,
-     544,   547,   549,   550,   553,   324,   223,   325,   326,   554,
-     239,   327,   328,   329,   285,   562,   148,   123,   124,   568,
-     274,   570,   272,   571,   572,   304,   293,   573,   286,   576,
-     574,   288,   577,   575,   578,   330,   579,   306,   351,   580,
-     349,   270,   136,   137,   581,   289,   582,   344,   224,   587,
-     583,   584,   362,   240,   331,   585,   305,   588,   586,   350,
-     590,   352,   390,   589,   273,   591,   592,   593,   294,   597,
-     598,   594,   599,   595,   391,   596,   600,   275,   601,   307,
-     602,   603,   604,   276,   241,   605,   148,   277,   606,   345,
-     607,   608,   311,   609,   363,   610,   611,   612,   312,   613,
-     614,   615,   313,   242,   616,   243,   244,   245,   617,   246,
-     247,    92,    93,    94,    95,    96,   392,   618,   619,   620,
-     248,   249,   621,   250,   251,   252,   253,   254,   255,   148,
-     622,   256,   623,   624,   625,   626,   631,   287,   257,   258,
-     627,   268,   100,   101,   102,   103,   104,   105,   106,   107,
-     632,   628,   629,  1238,   112,   113,   114,   115,   116,   117,
-     118,   633,   225,   226,   227,   636,   121,   634,   637,   638,
-     639,   640,   641,   792,   643,   644,   645,   228,   642,   123,
-     124,   229,   230,   231,   125,   324,   346,   325,   326,   347,
-     348,   232,   646,   647,   233,   128,   648,   123,   124,   651,
-     649,   652,   234,   149,   654,   216,   655,   656,   657,   658,
-     659,   660,   661,   806,   663,   664,   665,   223,   807,   808,
-     809,   810,   811,   812,   813,   814,   815,   816,   817,   818,
-     819,   820,   821,   822,   823,   824,   666,   667,   668,   915,
-     925,   671,   390,   784,   785,   669,   672,   136,   137,   675,
-     951,   921,   926,   936,   391,   673,   676,   677,   235,   224,
-     678,   324,   952,   123,   124,   798,   680,   681,   682,   683,
-     684,   685,   687,   688,   686,   236,   237,   238,   689,   690,
-     691,   692,   693,   694,   696,   699,   697,  1003,   704,   700,
-     701,   148,   702,   922,   927,   937,   392,   703,   707,   708,
-     705,   706,   709,   719,   953,   710,   720,   717,   718,   148,
-     721,   722,   375,   376,   377,   378,   379,   380,   381,   382,
-     383,   384,   385,   386,   387,    30,   725,   731,   732,   733,
-     734,   388,   389,     1,     2,     3,     4,     5,     6,     7,
-       8,     9,    10,    11,    12,    13,   735,   736,   737,   738,
-     739,   740,   742,   741,   744,   743,   745,   746,   747,   825,
-     748,   756,   757,   759,   758,   760,   761,   826,   827,   763,
-     764,   766,   797,   802,  1002,   148,   855,   859,   863,   765,
-     767,   769,   770,   771,   772,   148,   773,   774,   775,   776,
-     777,   778,   779,   780,   867,   871,   781,   782,   786,   787,
-     788,   887,   794,   795,   796,   890,   894,   945,   960,   980,
-     981,   982,   983,   984,   989,   990,   991,   992,   993,   994,
-     995,  1006,  1059,  1005,  1009,  1008,  1011,  1012,  1014,  1015,
-    1023,  1022,  1026,  1064,  1025,  1027,  1028,  1029,  1030,  1031,
-    1032,  1035,  1036,  1037,  1044,  1046,  1056,  1075,  1076,  1063,
-    1069,  1067,  1066,  1068,  1071,  1072,  1073,  1074,  1077,  1078,
-    1080,  1079,  1081,  1082,  1083,  1084,  1085,  1086,  1087,  1091,
-    1092,  1088,  1089,  1172,  1090,  1173,  1176,  1161,  1162,  1163,
-    1164,  1165,  1166,  1178,  1195,  1196,   968,  1199,  1217,  1218,
-    1222,  1224,  1223,  1225,  1169,  1168,  1170,  1175,  1232,  1240,
-    1177,  1200,  1206,  1193,  1243,  1207,  1208,   239,  1209,  1210,
-     330,   351,  1245,   349,  1211,  1212,  1102,   274,  1213,   272,
-    1214,  1141,   344,  1227,   304,   362,  1143,   368,  1131,   331,
-    1125,  1248,   350,  1145,   352,  1122,   306,  1228,   270,  1229,
-    1142,   915,  1236,  1241,  1244,   925,  1250,  1130,  1270,  1271,
-     240,  1247,  1144,   921,  1183,   305,  1272,   926,  1249,  1103,
-     951,   273,  1276,   936,   345,   285,  1185,   363,  1277,  1278,
-    1132,  1279,   952,  1184,   275,  1146,  1280,   293,   307,   286,
-     276,   241,   288,  1133,   277,  1282,  1283,   783,  1147,  1134,
-    1104,   311,   630,  1135,  1148,   922,   289,   312,  1149,   927,
-     242,   313,   243,   244,   245,   937,   246,   247,  1186,  1105,
-     793,  1106,  1107,  1108,   953,  1109,  1110,   248,   249,   294,
-     250,   251,   252,   253,   254,   255,  1111,  1112,   256,  1113,
-    1114,  1115,  1116,  1117,  1118,   257,   258,  1119,   268,  1126,
-     569,   801,   635,  1070,  1120,  1121,   799,  1127,  1095,  1160,
-    1093,   969,  1159,  1171,  1138,  1167,  1097,  1096,   679,   650,
-    1239,  1137,   674,  1099,   653,  1098,   670,   965,  1101,  1198,
-    1100,  1158,  1242,  1179,  1197,   944,   662,  1246,   695,  1192,
-     800,  1156,  1157,  1268,  1174,   698,  1194,  1281,   287,     0,
+     288,   391,   972,   973,   870,   331,   350,   762,   352,  1155,
+    1156,  1168,   789,   270,   289,   305,    28,   723,   768,    29,
+      81,    30,   418,    31,    40,   240,   123,   124,   422,   711,
+     712,   713,   714,   423,   120,   224,   273,   294,   307,   964,
+     345,   363,   965,   392,   410,   411,    42,   123,   124,   275,
+      44,   311,    46,   485,   416,   276,   241,   312,   486,   277,
+      48,   313,   212,   213,   364,   365,   214,  1040,    50,   215,
+    1041,   948,   949,   950,    52,   242,    54,   243,   244,   245,
+     715,   246,   247,   323,   491,   928,   929,   930,   723,   492,
+      56,  1043,   248,   249,  1044,   250,   251,   252,   253,   254,
+     255,   123,   124,   256,   507,  1076,   287,    58,  1077,   508,
+     257,   258,   511,   268,   542,    88,   417,   512,    89,   543,
+     366,   123,   124,   726,   727,   728,   729,    90,   367,    91,
+      92,    93,    94,    95,    96,    97,    98,    99,   951,   324,
+      60,   325,   326,   939,   940,   327,   328,   329,    62,   123,
+     124,   123,   124,   324,    84,   559,   563,   485,   790,   148,
+     560,   564,   986,   939,   940,   123,   124,   750,   751,   100,
+     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,   117,   118,   119,   966,
+     563,  1287,   120,   121,  1288,   987,   324,   346,   325,   326,
+     347,   348,   419,   122,   364,   365,   123,   124,   123,   124,
+     491,   125,   420,   148,   427,   988,   126,   127,   891,   892,
+     893,   894,   128,   895,  1155,  1156,  1168,   428,    32,    33,
+      34,    35,   129,   148,   429,   130,  1212,   436,  1213,  1214,
+     990,  1022,   131,   132,  1022,   991,  1023,   133,  1057,  1024,
+     134,   437,  1289,  1058,   135,  1290,  1291,  1292,  1293,  1062,
+     366,   148,  1066,   148,  1063,  1072,   559,  1067,   367,   438,
+    1073,  1074,   439,  1022,   136,   137,   138,   148,  1078,   440,
+    1022,   521,    94,    95,    96,  1079,   139,   140,   141,   148,
+     142,   441,  1081,   143,   442,   144,   145,  1082,   146,   147,
+    1022,   507,   121,   753,   754,  1248,  1249,   443,    92,    93,
+      94,    95,    96,   444,   283,   123,   124,  1252,   148,   231,
+     148,  1126,  1253,   542,  1267,   522,   511,   232,  1259,  1268,
+     233,  1270,   446,  1307,   303,   980,   972,   973,  1308,  1233,
+    1234,  1235,  1236,   121,   447,   448,   449,   100,   101,   102,
+     103,   104,   105,   106,   107,   450,   123,   124,   454,   112,
+     113,   114,   115,   116,   117,   118,   119,   296,   467,   480,
+     481,   121,   324,   297,   298,   299,   300,   301,   302,   482,
+     303,   483,   484,   490,   123,   124,   499,   230,   505,   125,
+     506,   510,   526,   565,   566,   530,   232,   523,   149,   233,
+     284,   531,   532,   536,   216,   534,   535,   234,   914,   915,
+     916,   917,   918,   919,   537,   567,   223,   544,   547,   549,
+     239,   550,   553,   554,   285,   562,   568,   148,   570,   571,
+     274,   572,   272,   573,   574,   304,   293,   575,   286,   576,
+     577,   288,   578,   579,   580,   330,   581,   306,   351,   582,
+     349,   270,   136,   137,   583,   289,   588,   344,   224,   584,
+     587,   585,   362,   240,   331,   586,   305,   589,   148,   350,
+     590,   352,   390,   591,   273,   592,   593,   597,   294,   598,
+     599,   594,   601,   595,   391,   602,   596,   275,   600,   307,
+     603,   604,   605,   276,   241,   606,   148,   277,   626,   345,
+     607,   608,   311,   609,   363,   123,   124,   610,   312,   611,
+     612,   613,   313,   242,   614,   243,   244,   245,   615,   246,
+     247,   616,    94,    95,    96,   617,   392,   618,   619,   620,
+     248,   249,   621,   250,   251,   252,   253,   254,   255,   622,
+     623,   256,   624,   625,   627,   631,   628,   287,   257,   258,
+     629,   268,   632,   633,   375,   376,   377,   378,   379,   380,
+     381,   382,   383,   384,   385,   386,   387,   634,   642,   636,
+     637,   638,   639,   388,   389,   640,   641,   643,   644,   645,
+     646,   647,   120,   121,   324,   648,   649,   651,   652,   654,
+     655,   656,   657,   658,   659,  1271,   123,   124,   660,   661,
+     663,   664,   666,   667,   668,   665,   671,   675,   676,  1171,
+    1172,   669,   677,   149,   672,   216,   678,   148,   681,   682,
+     684,   673,   680,   683,   685,   686,   687,   223,   688,   689,
+     691,   692,   693,   690,   694,   696,   699,   792,   697,    92,
+      93,    94,    95,    96,   700,   701,   702,   703,   704,   931,
+     941,   705,   390,   784,   785,   706,   707,   708,   709,   710,
+     967,   937,   942,   952,   391,   717,   718,   719,   720,   224,
+     721,   722,   968,   725,    30,   798,   731,   732,   100,   101,
+     102,   103,   104,   105,   106,   107,   733,   734,   740,   742,
+     112,   113,   114,   115,   116,   117,   118,   735,   225,   226,
+     227,   736,   121,   938,   943,   953,   392,   741,   148,   737,
+     738,   739,   743,   228,   969,   123,   124,   229,   230,   231,
+     125,   744,   745,   746,   747,   748,   756,   232,   759,   757,
+     233,   128,   758,   760,   806,   764,   761,   766,   234,   807,
+     808,   809,   810,   811,   812,   813,   814,   815,   816,   817,
+     818,   819,   820,   821,   822,   823,   824,   825,   826,   827,
+     828,   829,   830,   831,   832,     1,     2,     3,     4,     5,
+       6,     7,     8,     9,    10,    11,    12,    13,   797,   802,
+     996,   871,   875,   136,   137,   879,   883,   887,   903,   906,
+     324,   910,   763,   765,   235,   767,   769,   961,   770,   976,
+     997,   998,   999,  1000,  1005,   771,   772,   773,  1006,  1007,
+    1008,   236,   237,   238,  1009,   774,  1010,  1011,  1013,   775,
+     776,   777,  1014,   778,   779,   780,  1015,   148,  1016,  1017,
+    1018,   781,   782,   786,   787,   788,  1019,   794,  1027,   795,
+    1026,  1030,  1029,   796,  1033,  1032,  1035,  1036,  1038,  1039,
+    1047,  1046,  1050,  1088,  1049,  1051,  1052,  1053,  1054,  1055,
+    1056,  1059,  1060,  1061,  1068,  1070,  1080,  1099,  1083,  1087,
+    1093,  1091,  1090,  1092,  1095,  1096,  1097,  1098,  1100,  1101,
+    1104,  1105,  1106,  1107,  1103,  1102,  1115,  1112,   833,  1108,
+    1109,  1110,  1111,  1113,  1116,  1118,   834,   835,  1123,  1124,
+    1114,  1204,  1117,  1119,  1120,  1121,  1122,  1193,  1194,  1205,
+    1195,  1196,  1197,  1198,   148,  1208,  1200,  1210,  1207,  1228,
+    1227,  1201,  1202,  1209,  1231,  1232,  1225,  1238,  1239,  1240,
+    1250,  1251,  1241,  1242,  1255,  1243,  1244,  1256,  1245,  1246,
+    1247,   239,  1257,  1258,   330,   351,  1265,   349,  1260,  1261,
+    1134,   274,  1262,   272,  1269,  1173,   344,  1273,   304,   362,
+    1175,   368,  1163,   331,  1157,  1274,   350,  1177,   352,  1154,
+     306,  1276,   270,  1277,  1174,   931,  1278,  1280,  1281,   941,
+    1282,  1162,  1283,  1303,   240,  1304,  1176,   937,  1215,   305,
+    1305,   942,  1309,  1135,   967,   273,  1313,   952,   345,   285,
+    1217,   363,  1310,  1311,  1164,  1315,   968,  1216,   275,  1178,
+    1312,   293,   307,   286,   276,   241,   288,  1165,   277,   783,
+     801,  1316,  1179,  1166,  1136,   311,   799,  1167,  1180,   938,
+     289,   312,  1181,   943,   242,   313,   243,   244,   245,   953,
+     246,   247,  1218,  1137,   984,  1138,  1139,  1140,   969,  1141,
+    1142,   248,   249,   294,   250,   251,   252,   253,   254,   255,
+    1143,  1144,   256,  1145,  1146,  1147,  1148,  1149,  1150,   257,
+     258,  1151,   268,  1158,   793,  1094,   985,   569,  1152,  1153,
+    1125,  1159,  1127,  1203,   679,  1192,  1170,  1129,  1191,  1272,
+    1199,  1169,  1131,  1128,   670,   674,  1133,  1130,  1190,  1230,
+     981,  1189,  1132,  1275,  1206,  1188,  1229,   960,   800,  1211,
+     695,  1279,  1301,   698,  1314,     0,     0,     0,   630,     0,
+       0,     0,   287,     0,     0,   635,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  1226,     0,     0,     0,     0,
+       0,     0,   650,     0,     0,     0,  1224,   653,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,  1102,     0,     0,     0,     0,  1141,     0,     0,
-       0,     0,  1143,     0,  1131,     0,  1125,  1183,     0,  1145,
-       0,  1122,     0,     0,  1230,     0,  1142,     0,     0,  1185,
-       0,     0,     0,  1130,     0,     0,  1184,     0,  1144,     0,
-       0,     0,     0,     0,     0,  1103,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,  1132,     0,     0,     0,
-       0,  1146,     0,     0,     0,     0,     0,     0,     0,  1133,
-       0,  1186,     0,     0,  1147,  1134,  1104,     0,     0,  1135,
-    1148,     0,     0,     0,  1149,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,  1105,     0,  1106,  1107,  1108,
-       0,  1109,  1110,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,  1111,  1112,     0,  1113,  1114,  1115,  1116,  1117,
-    1118,     0,     0,  1119,     0,  1126,     0,     0,     0,     0,
-    1120,  1121,     0,  1127
+       0,     0,     0,   662,     0,  1134,     0,     0,     0,     0,
+    1173,     0,     0,     0,     0,  1175,     0,  1163,     0,  1157,
+    1215,     0,  1177,     0,  1154,     0,  1263,     0,     0,  1174,
+       0,     0,  1217,     0,     0,     0,  1162,     0,     0,  1216,
+       0,  1176,     0,     0,     0,     0,     0,     0,  1135,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,  1164,
+       0,     0,     0,     0,  1178,     0,     0,     0,     0,     0,
+       0,     0,  1165,     0,  1218,     0,     0,  1179,  1166,  1136,
+       0,     0,  1167,  1180,     0,     0,     0,  1181,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,  1137,     0,
+    1138,  1139,  1140,     0,  1141,  1142,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,  1143,  1144,     0,  1145,  1146,
+    1147,  1148,  1149,  1150,     0,     0,  1151,     0,  1158,     0,
+       0,     0,     0,  1152,  1153,     0,  1159
   };
 
   const short
@@ -5020,352 +5112,359 @@ namespace isc { namespace dhcp {
   {
       67,    68,    69,    70,    71,    74,    73,    74,    75,    76,
       72,    15,    69,    68,    69,    70,    71,    70,    73,    74,
-      70,    76,   747,   747,   708,    73,    74,   643,    74,  1013,
-    1013,  1013,    18,    69,    70,    71,   605,   206,   654,     5,
-       0,     7,     3,     9,     3,    69,    10,     8,    80,     8,
-     121,   122,    94,    95,    82,    68,    69,    70,    71,   743,
-      73,    74,   746,    76,    94,    95,    94,    95,     8,    69,
-       7,    71,     6,     3,     3,    69,    69,    71,     8,    69,
-       3,    71,    15,    16,     3,     8,    19,     6,     3,    22,
-     132,   133,   134,     8,     7,    69,     7,    69,    69,    69,
-       3,    69,    69,     3,     3,     8,   177,   676,     8,   139,
-     140,   141,    69,    69,   185,    69,    69,    69,    69,    69,
-      69,     7,     3,    69,     3,     3,    70,     8,     6,     8,
-      69,    69,     7,    69,     7,    11,     7,   165,    14,   167,
-     168,   124,   125,   126,   127,   128,   129,    23,     7,    25,
-      26,    27,    28,    29,    30,    31,    32,    33,     3,    94,
-      95,    94,    95,     8,   206,     7,     3,     7,    94,    95,
-     156,     8,    28,    29,    30,     7,   206,     3,   206,     4,
-       6,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+      70,    76,   747,   747,   708,    73,    74,   643,    74,  1037,
+    1037,  1037,    18,    69,    70,    71,     0,   605,   654,     5,
+     214,     7,     4,     9,     7,    69,   102,   103,     3,   166,
+     167,   168,   169,     8,    88,    68,    69,    70,    71,   743,
+      73,    74,   746,    76,    12,    13,     7,   102,   103,    69,
+       7,    71,     7,     3,     6,    69,    69,    71,     8,    69,
+       7,    71,    15,    16,   129,   130,    19,     3,     7,    22,
+       6,   147,   148,   149,     7,    69,     7,    69,    69,    69,
+     217,    69,    69,    34,     3,   140,   141,   142,   676,     8,
+       7,     3,    69,    69,     6,    69,    69,    69,    69,    69,
+      69,   102,   103,    69,     3,     3,    70,     7,     6,     8,
+      69,    69,     3,    69,     3,    11,     3,     8,    14,     8,
+     185,   102,   103,   108,   109,   110,   111,    23,   193,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,   214,    90,
+       7,    92,    93,   144,   145,    96,    97,    98,     7,   102,
+     103,   102,   103,    90,    10,     3,     3,     3,   164,   214,
+       8,     8,     8,   144,   145,   102,   103,    17,    18,    65,
       66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
-      76,   136,   137,   166,    80,    81,   169,   170,   171,   172,
-     136,   137,     3,    12,    13,    91,     3,     8,    94,    95,
-       4,     8,     3,    99,    80,    81,    82,     8,   104,   105,
-     100,   101,   102,   103,   110,  1219,  1219,  1219,    94,    95,
-     206,   207,   208,   209,   120,     3,     3,   123,     3,     6,
-       8,   107,   108,     8,   130,   131,   182,     7,     3,   135,
-       3,     8,   138,     8,    81,     8,   142,     3,    28,    29,
-      30,   206,     8,   206,     3,     3,    93,    94,    95,     8,
-     206,    98,    17,    18,     4,     3,   162,   163,   164,   106,
-       8,     3,   109,   121,   122,     4,     8,     4,   174,   175,
-     176,     3,   178,     8,     3,   181,     8,   183,   184,     8,
-     186,   187,   158,   159,   160,   161,     4,  1001,     4,    20,
-      21,    81,   111,   112,   113,   114,     3,   116,   118,   119,
-     206,     8,  1057,  1057,    94,    95,    26,    27,    28,    29,
-      30,     3,     3,     3,     8,   105,     8,     8,     8,   177,
-     206,   111,   112,   113,   114,   115,   116,   185,   118,     3,
-       8,     4,   179,   209,     8,     4,     4,    57,    58,    59,
-      60,    61,    62,    63,    64,     4,     4,     4,   206,    69,
-      70,    71,    72,    73,    74,    75,    76,    34,     4,   206,
-       4,    81,    82,    35,    36,    37,    38,     4,     4,     4,
-       4,     4,     4,     4,    94,    95,     4,    97,     4,    99,
-       4,     4,     4,   417,   418,     4,   106,     4,   485,   109,
-       4,     4,     4,     3,   491,     4,     4,   117,     3,   206,
-       4,     4,     4,     4,     4,    82,   491,    84,    85,     4,
-     507,    88,    89,    90,   511,     4,   206,    94,    95,     4,
-     507,     4,   507,     4,     4,   522,   511,   209,   511,     4,
-     209,   511,     4,   209,     4,   532,     4,   522,   537,     4,
-     537,   507,   162,   163,     4,   511,   207,   532,   491,   209,
-     207,   207,   537,   507,   532,   207,   522,   208,   207,   537,
-     207,   537,   559,   208,   507,     4,   207,   207,   511,     4,
-       4,   209,     4,   209,   559,   209,   209,   507,     4,   522,
-       4,     4,     4,   507,   507,     4,   206,   507,     4,   532,
-       4,     4,   522,     4,   537,     4,     4,     4,   522,   207,
-       4,     4,   522,   507,     4,   507,   507,   507,     4,   507,
-     507,    26,    27,    28,    29,    30,   559,     4,     4,     4,
-     507,   507,     4,   507,   507,   507,   507,   507,   507,   206,
-       4,   507,     4,     4,     4,   206,     4,   511,   507,   507,
-     207,   507,    57,    58,    59,    60,    61,    62,    63,    64,
-       4,   207,   207,  1199,    69,    70,    71,    72,    73,    74,
-      75,     4,    77,    78,    79,     4,    81,   209,     4,     4,
-       4,     4,     4,   157,     4,     4,     4,    92,   207,    94,
-      95,    96,    97,    98,    99,    82,    83,    84,    85,    86,
-      87,   106,     4,     4,   109,   110,   207,    94,    95,     4,
-     207,   207,   117,   700,     4,   702,     4,     4,     4,     4,
-       4,     4,     4,    34,     4,     4,   207,   702,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
-      51,    52,    53,    54,    55,    56,     4,     4,     4,   736,
-     737,     4,   739,   677,   678,   209,   209,   162,   163,     4,
-     747,   736,   737,   738,   739,   209,     4,     4,   173,   702,
-       4,    82,   747,    94,    95,   699,   209,     4,     4,   207,
-       4,   207,     4,     4,   207,   190,   191,   192,   209,   209,
-       4,     4,     4,     4,     4,     4,   207,     3,   206,     7,
-       7,   206,     7,   736,   737,   738,   739,     7,     7,     7,
-     206,   206,     5,     5,   747,   206,     5,   206,   206,   206,
-       5,     5,   143,   144,   145,   146,   147,   148,   149,   150,
-     151,   152,   153,   154,   155,     7,   206,     5,     5,     5,
-       5,   162,   163,   193,   194,   195,   196,   197,   198,   199,
-     200,   201,   202,   203,   204,   205,     7,     7,     7,     7,
-       7,   206,     5,   206,   206,     7,   206,     7,     7,   180,
-       5,   206,   206,     5,   206,   206,   206,   188,   189,   206,
-       7,     5,     5,    24,     6,   206,     7,     7,     7,   206,
-     206,   206,   206,   206,   206,   206,   206,   206,   206,   206,
-     206,   206,   206,   206,     7,     7,   206,   206,   206,   206,
-     206,     7,   206,   206,   206,     7,     7,     7,     7,     4,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     3,   206,     6,     3,     6,     6,     3,     6,     3,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,   190,
+       3,     3,    88,    89,     6,     8,    90,    91,    92,    93,
+      94,    95,     8,    99,   129,   130,   102,   103,   102,   103,
+       3,   107,     3,   214,     4,     8,   112,   113,   119,   120,
+     121,   122,   118,   124,  1252,  1252,  1252,     4,   214,   215,
+     216,   217,   128,   214,     4,   131,   173,     4,   175,   176,
+       3,     3,   138,   139,     3,     8,     8,   143,     3,     8,
+     146,     4,   174,     8,   150,   177,   178,   179,   180,     3,
+     185,   214,     3,   214,     8,     3,     3,     8,   193,     4,
+       8,     8,     4,     3,   170,   171,   172,   214,     8,     4,
+       3,     8,    28,    29,    30,     8,   182,   183,   184,   214,
+     186,     4,     3,   189,     4,   191,   192,     8,   194,   195,
+       3,     3,    89,    20,    21,     8,     8,     4,    26,    27,
+      28,    29,    30,     4,   101,   102,   103,     3,   214,   106,
+     214,  1025,     8,     3,     3,     3,     3,   114,     8,     8,
+     117,     8,     4,     3,   126,   127,  1081,  1081,     8,    35,
+      36,    37,    38,    89,     4,     4,     4,    65,    66,    67,
+      68,    69,    70,    71,    72,     4,   102,   103,     4,    77,
+      78,    79,    80,    81,    82,    83,    84,   113,     4,     4,
+       4,    89,    90,   119,   120,   121,   122,   123,   124,     4,
+     126,     4,     4,     4,   102,   103,     4,   105,     4,   107,
+       4,     4,     4,   417,   418,     4,   114,     8,   485,   117,
+     187,     8,     3,     8,   491,     4,     4,   125,   132,   133,
+     134,   135,   136,   137,     3,   214,   491,     4,     4,     4,
+     507,     4,     4,     4,   511,     4,     4,   214,     4,     4,
+     507,     4,   507,   217,   217,   522,   511,   217,   511,     4,
+       4,   511,     4,     4,     4,   532,     4,   522,   537,   215,
+     537,   507,   170,   171,   215,   511,   216,   532,   491,   215,
+     217,   215,   537,   507,   532,   215,   522,   216,   214,   537,
+     215,   537,   559,     4,   507,   215,   215,     4,   511,     4,
+       4,   217,     4,   217,   559,     4,   217,   507,   217,   522,
+       4,     4,     4,   507,   507,     4,   214,   507,   214,   532,
+       4,     4,   522,     4,   537,   102,   103,     4,   522,     4,
+       4,   215,   522,   507,     4,   507,   507,   507,     4,   507,
+     507,     4,    28,    29,    30,     4,   559,     4,     4,     4,
+     507,   507,     4,   507,   507,   507,   507,   507,   507,     4,
+       4,   507,     4,     4,   215,     4,   215,   511,   507,   507,
+     215,   507,     4,     4,   151,   152,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   163,   217,   215,     4,
+       4,     4,     4,   170,   171,     4,     4,     4,     4,     4,
+       4,     4,    88,    89,    90,   215,   215,     4,   215,     4,
+       4,     4,     4,     4,     4,  1231,   102,   103,     4,     4,
+       4,     4,     4,     4,     4,   215,     4,     4,     4,   115,
+     116,   217,     4,   700,   217,   702,     4,   214,     4,     4,
+       4,   217,   217,   215,   215,   215,     4,   702,     4,   217,
+       4,     4,     4,   217,     4,     4,     4,   165,   215,    26,
+      27,    28,    29,    30,     7,     7,     7,     7,   214,   736,
+     737,   214,   739,   677,   678,   214,     7,     7,     5,   214,
+     747,   736,   737,   738,   739,   214,   214,     5,     5,   702,
+       5,     5,   747,   214,     7,   699,     5,     5,    65,    66,
+      67,    68,    69,    70,    71,    72,     5,     5,   214,     5,
+      77,    78,    79,    80,    81,    82,    83,     7,    85,    86,
+      87,     7,    89,   736,   737,   738,   739,   214,   214,     7,
+       7,     7,     7,   100,   747,   102,   103,   104,   105,   106,
+     107,   214,   214,     7,     7,     5,   214,   114,     5,   214,
+     117,   118,   214,   214,    34,     7,   214,     5,   125,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
+      60,    61,    62,    63,    64,   201,   202,   203,   204,   205,
+     206,   207,   208,   209,   210,   211,   212,   213,     5,    24,
+       4,     7,     7,   170,   171,     7,     7,     7,     7,     7,
+      90,     7,   214,   214,   181,   214,   214,     7,   214,     7,
+       4,     4,     4,     4,     4,   214,   214,   214,     4,     4,
+       4,   198,   199,   200,     4,   214,     4,     4,     4,   214,
+     214,   214,     4,   214,   214,   214,     4,   214,     4,     4,
+       4,   214,   214,   214,   214,   214,     4,   214,     3,   214,
+       6,     3,     6,   214,     3,     6,     6,     3,     6,     3,
        3,     6,     3,     3,     6,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,   207,   209,     6,
-       4,     6,     8,     6,     4,     4,     4,     4,   207,   209,
-       4,   207,     4,     4,     4,   207,   207,   207,   207,     4,
-       4,   209,   207,     4,   207,     4,     4,   207,   207,   207,
-     207,   207,   207,     4,     6,     3,   766,     4,     8,     8,
-       4,     3,     8,     8,   207,   209,   207,   209,     4,     4,
-     207,   206,   206,   209,     4,   206,   206,  1004,   206,   206,
-    1007,  1010,     4,  1010,   206,   206,  1013,  1004,   206,  1004,
-     206,  1018,  1007,   206,  1021,  1010,  1018,  1024,  1013,  1007,
-    1013,     5,  1010,  1018,  1010,  1013,  1021,   206,  1004,   206,
-    1018,  1038,   206,   209,   207,  1042,     7,  1013,     4,     4,
-    1004,   206,  1018,  1038,  1051,  1021,     4,  1042,   206,  1013,
-    1057,  1004,     4,  1048,  1007,  1062,  1051,  1010,   209,   207,
-    1013,   207,  1057,  1051,  1004,  1018,     4,  1062,  1021,  1062,
-    1004,  1004,  1062,  1013,  1004,   206,   206,   676,  1018,  1013,
-    1013,  1021,   485,  1013,  1018,  1038,  1062,  1021,  1018,  1042,
-    1004,  1021,  1004,  1004,  1004,  1048,  1004,  1004,  1051,  1013,
-     691,  1013,  1013,  1013,  1057,  1013,  1013,  1004,  1004,  1062,
-    1004,  1004,  1004,  1004,  1004,  1004,  1013,  1013,  1004,  1013,
-    1013,  1013,  1013,  1013,  1013,  1004,  1004,  1013,  1004,  1013,
-     422,   702,   491,   974,  1013,  1013,   700,  1013,  1003,  1026,
-     998,   797,  1024,  1038,  1016,  1033,  1006,  1004,   542,   507,
-    1219,  1015,   537,  1009,   511,  1007,   532,   764,  1012,  1064,
-    1010,  1023,  1224,  1048,  1062,   739,   522,  1234,   559,  1052,
-     701,  1019,  1021,  1254,  1042,   563,  1057,  1274,  1062,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       4,     4,     4,     4,     4,     4,     4,   215,   214,     6,
+       4,     6,     8,     6,     4,     4,     4,     4,   217,   215,
+       4,     4,     4,     4,   215,   217,     4,   217,   188,   215,
+     215,   215,   215,   215,   215,   215,   196,   197,     4,     4,
+     217,     4,   217,   217,   217,   217,   215,   215,   215,     4,
+     215,   215,   215,   215,   214,     4,   217,     4,   217,     3,
+       6,   215,   215,   215,     4,   214,   217,   214,   214,   214,
+       8,     8,   214,   214,     4,   214,   214,     8,   214,   214,
+     214,  1028,     3,     8,  1031,  1034,     4,  1034,   214,   214,
+    1037,  1028,   214,  1028,   214,  1042,  1031,     4,  1045,  1034,
+    1042,  1048,  1037,  1031,  1037,   217,  1034,  1042,  1034,  1037,
+    1045,     4,  1028,   215,  1042,  1062,     4,   214,     5,  1066,
+     214,  1037,     7,     4,  1028,     4,  1042,  1062,  1075,  1045,
+       4,  1066,     4,  1037,  1081,  1028,     4,  1072,  1031,  1086,
+    1075,  1034,   217,   215,  1037,   214,  1081,  1075,  1028,  1042,
+     215,  1086,  1045,  1086,  1028,  1028,  1086,  1037,  1028,   676,
+     702,   214,  1042,  1037,  1037,  1045,   700,  1037,  1042,  1062,
+    1086,  1045,  1042,  1066,  1028,  1045,  1028,  1028,  1028,  1072,
+    1028,  1028,  1075,  1037,   766,  1037,  1037,  1037,  1081,  1037,
+    1037,  1028,  1028,  1086,  1028,  1028,  1028,  1028,  1028,  1028,
+    1037,  1037,  1028,  1037,  1037,  1037,  1037,  1037,  1037,  1028,
+    1028,  1037,  1028,  1037,   691,   990,   797,   422,  1037,  1037,
+    1022,  1037,  1027,  1062,   542,  1050,  1040,  1030,  1048,  1252,
+    1057,  1039,  1033,  1028,   532,   537,  1036,  1031,  1047,  1088,
+     764,  1045,  1034,  1257,  1066,  1043,  1086,   739,   701,  1072,
+     559,  1267,  1287,   563,  1307,    -1,    -1,    -1,   485,    -1,
+      -1,    -1,  1086,    -1,    -1,   491,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,  1081,    -1,    -1,    -1,    -1,
+      -1,    -1,   507,    -1,    -1,    -1,  1076,   511,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,  1219,    -1,    -1,    -1,    -1,  1224,    -1,    -1,
-      -1,    -1,  1224,    -1,  1219,    -1,  1219,  1234,    -1,  1224,
-      -1,  1219,    -1,    -1,  1178,    -1,  1224,    -1,    -1,  1234,
-      -1,    -1,    -1,  1219,    -1,    -1,  1234,    -1,  1224,    -1,
-      -1,    -1,    -1,    -1,    -1,  1219,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,  1219,    -1,    -1,    -1,
-      -1,  1224,    -1,    -1,    -1,    -1,    -1,    -1,    -1,  1219,
-      -1,  1234,    -1,    -1,  1224,  1219,  1219,    -1,    -1,  1219,
-    1224,    -1,    -1,    -1,  1224,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,  1219,    -1,  1219,  1219,  1219,
-      -1,  1219,  1219,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,  1219,  1219,    -1,  1219,  1219,  1219,  1219,  1219,
-    1219,    -1,    -1,  1219,    -1,  1219,    -1,    -1,    -1,    -1,
-    1219,  1219,    -1,  1219
+      -1,    -1,    -1,   522,    -1,  1252,    -1,    -1,    -1,    -1,
+    1257,    -1,    -1,    -1,    -1,  1257,    -1,  1252,    -1,  1252,
+    1267,    -1,  1257,    -1,  1252,    -1,  1210,    -1,    -1,  1257,
+      -1,    -1,  1267,    -1,    -1,    -1,  1252,    -1,    -1,  1267,
+      -1,  1257,    -1,    -1,    -1,    -1,    -1,    -1,  1252,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,  1252,
+      -1,    -1,    -1,    -1,  1257,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,  1252,    -1,  1267,    -1,    -1,  1257,  1252,  1252,
+      -1,    -1,  1252,  1257,    -1,    -1,    -1,  1257,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,  1252,    -1,
+    1252,  1252,  1252,    -1,  1252,  1252,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,  1252,  1252,    -1,  1252,  1252,
+    1252,  1252,  1252,  1252,    -1,    -1,  1252,    -1,  1252,    -1,
+      -1,    -1,    -1,  1252,  1252,    -1,  1252
   };
 
   const short
   Dhcp4Parser::yystos_[] =
   {
-       0,   193,   194,   195,   196,   197,   198,   199,   200,   201,
-     202,   203,   204,   205,   211,   212,   213,   214,   215,   216,
-     217,   218,   219,   220,   221,   222,   223,   224,     0,     5,
-       7,     9,   206,   207,   208,   209,   225,   226,   227,   232,
-       7,   241,     7,   247,     7,   286,     7,   391,     7,   471,
-       7,   487,     7,   423,     7,   429,     7,   453,     7,   367,
-       7,   555,     7,   586,   233,   228,   242,   248,   287,   392,
-     472,   488,   424,   430,   454,   368,   556,   587,   225,   234,
-     235,   206,   230,   231,    10,   243,   244,   245,    11,    14,
+       0,   201,   202,   203,   204,   205,   206,   207,   208,   209,
+     210,   211,   212,   213,   219,   220,   221,   222,   223,   224,
+     225,   226,   227,   228,   229,   230,   231,   232,     0,     5,
+       7,     9,   214,   215,   216,   217,   233,   234,   235,   240,
+       7,   249,     7,   255,     7,   294,     7,   408,     7,   488,
+       7,   504,     7,   440,     7,   446,     7,   470,     7,   384,
+       7,   572,     7,   603,   241,   236,   250,   256,   295,   409,
+     489,   505,   441,   447,   471,   385,   573,   604,   233,   242,
+     243,   214,   238,   239,    10,   251,   252,   253,    11,    14,
       23,    25,    26,    27,    28,    29,    30,    31,    32,    33,
-      57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
-      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
-      80,    81,    91,    94,    95,    99,   104,   105,   110,   120,
-     123,   130,   131,   135,   138,   142,   162,   163,   164,   174,
-     175,   176,   178,   181,   183,   184,   186,   187,   206,   240,
-     249,   250,   251,   252,   253,   254,   255,   256,   257,   258,
-     259,   260,   262,   263,   264,   265,   266,   267,   268,   271,
-     273,   275,   277,   279,   280,   281,   282,   297,   299,   305,
-     307,   345,   354,   361,   375,   385,   409,   413,   421,   447,
-     477,   479,   481,   492,   494,   496,   519,   531,   532,   543,
-     553,   584,   593,   619,   621,   623,   627,   631,   633,   634,
-     637,   638,    15,    16,    19,    22,   240,   284,   285,   288,
-     290,   293,   296,   477,   479,    77,    78,    79,    92,    96,
-      97,    98,   106,   109,   117,   173,   190,   191,   192,   240,
-     251,   252,   253,   254,   255,   256,   257,   258,   263,   264,
-     265,   266,   267,   268,   271,   273,   275,   277,   279,   393,
-     394,   395,   397,   399,   401,   403,   405,   407,   409,   412,
-     447,   465,   477,   479,   481,   492,   494,   496,   516,   617,
-     643,   644,   645,    93,   179,   240,   405,   407,   412,   447,
-     473,   474,   475,   477,   479,   629,   105,   111,   112,   113,
-     114,   115,   116,   118,   240,   447,   477,   479,   489,   490,
-     491,   492,   494,   496,   498,   502,   504,   506,   508,   510,
-     512,   514,   421,    34,    82,    84,    85,    88,    89,    90,
-     240,   325,   431,   432,   433,   434,   435,   436,   437,   439,
-     441,   443,   444,   446,   477,   479,    83,    86,    87,   240,
-     325,   435,   441,   455,   456,   457,   458,   459,   461,   462,
-     463,   464,   477,   479,   121,   122,   177,   185,   240,   369,
-     370,   371,   373,   625,   635,   143,   144,   145,   146,   147,
-     148,   149,   150,   151,   152,   153,   154,   155,   162,   163,
-     240,   477,   479,   557,   558,   559,   560,   562,   563,   565,
-     566,   567,   570,   572,   574,   575,   576,   578,   580,   582,
-      12,    13,   588,   589,   590,   592,     6,     3,     4,     8,
-       3,   246,     3,     8,   585,   283,   300,     4,     4,     4,
-     493,   495,   497,   298,   306,   308,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,   261,     4,     4,     4,     4,
-       4,   269,   272,   274,     4,   386,   422,   448,   414,   478,
-     480,   410,   346,   520,   482,   362,   376,     4,   355,   533,
-     544,   554,   276,   278,   594,   620,   622,   624,   628,   632,
-       4,     4,     4,     4,     4,     3,     8,   289,   291,   294,
-       4,     3,     8,   398,   400,   402,   466,   396,   404,     4,
-     408,   406,   517,   618,   646,     4,     4,     3,     8,   476,
-       4,     3,     8,   515,   503,   505,   509,   507,   513,   511,
-     499,     8,     3,     8,   438,   326,     4,   442,   440,   445,
-       4,     8,     3,   460,     4,     4,     8,     3,   372,   374,
-     626,   636,     3,     8,     4,   573,   561,     4,   564,     4,
-       4,   568,   571,     4,     4,   577,   579,   581,   583,     3,
-       8,   591,     4,     3,     8,   225,   225,   206,     4,   244,
-       4,     4,     4,   209,   209,   209,     4,     4,     4,     4,
-       4,     4,   207,   207,   207,   207,   207,   209,   208,   208,
-     207,     4,   207,   207,   209,   209,   209,     4,     4,     4,
-     209,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,   207,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,   206,   207,   207,   207,
-     250,     4,     4,     4,   209,   285,     4,     4,     4,     4,
-       4,     4,   207,     4,     4,     4,     4,     4,   207,   207,
-     394,     4,   207,   474,     4,     4,     4,     4,     4,     4,
-       4,     4,   491,     4,     4,   207,     4,     4,     4,   209,
-     433,     4,   209,   209,   457,     4,     4,     4,     4,   370,
-     209,     4,     4,   207,     4,   207,   207,     4,     4,   209,
-     209,     4,     4,     4,     4,   558,     4,   207,   589,     4,
-       7,     7,     7,     7,   206,   206,   206,     7,     7,     5,
-     206,   158,   159,   160,   161,   209,   270,   206,   206,     5,
-       5,     5,     5,   227,   229,   206,   100,   101,   102,   103,
-     411,     5,     5,     5,     5,     7,     7,     7,     7,     7,
-     206,   206,     5,     7,   206,   206,     7,     7,     5,   236,
-      17,    18,   292,    20,    21,   295,   206,   206,   206,     5,
-     206,   206,   236,   206,     7,   206,     5,   206,   236,   206,
-     206,   206,   206,   206,   206,   206,   206,   206,   206,   206,
-     206,   206,   206,   229,   225,   225,   206,   206,   206,    18,
-     156,   569,   157,   270,   206,   206,   206,     5,   225,   249,
-     588,   284,    24,   301,   302,   303,    34,    39,    40,    41,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      88,    89,    99,   102,   103,   107,   112,   113,   118,   128,
+     131,   138,   139,   143,   146,   150,   170,   171,   172,   182,
+     183,   184,   186,   189,   191,   192,   194,   195,   214,   248,
+     257,   258,   259,   260,   261,   262,   263,   264,   265,   266,
+     267,   268,   270,   271,   272,   273,   274,   275,   276,   279,
+     281,   283,   285,   287,   288,   289,   290,   305,   307,   313,
+     315,   362,   371,   378,   392,   402,   426,   430,   438,   464,
+     494,   496,   498,   509,   511,   513,   536,   548,   549,   560,
+     570,   601,   610,   636,   638,   640,   644,   648,   650,   651,
+     654,   655,    15,    16,    19,    22,   248,   292,   293,   296,
+     298,   301,   304,   494,   496,    85,    86,    87,   100,   104,
+     105,   106,   114,   117,   125,   181,   198,   199,   200,   248,
+     259,   260,   261,   262,   263,   264,   265,   266,   271,   272,
+     273,   274,   275,   276,   279,   281,   283,   285,   287,   410,
+     411,   412,   414,   416,   418,   420,   422,   424,   426,   429,
+     464,   482,   494,   496,   498,   509,   511,   513,   533,   634,
+     660,   661,   662,   101,   187,   248,   422,   424,   429,   464,
+     490,   491,   492,   494,   496,   646,   113,   119,   120,   121,
+     122,   123,   124,   126,   248,   464,   494,   496,   506,   507,
+     508,   509,   511,   513,   515,   519,   521,   523,   525,   527,
+     529,   531,   438,    34,    90,    92,    93,    96,    97,    98,
+     248,   333,   448,   449,   450,   451,   452,   453,   454,   456,
+     458,   460,   461,   463,   494,   496,    91,    94,    95,   248,
+     333,   452,   458,   472,   473,   474,   475,   476,   478,   479,
+     480,   481,   494,   496,   129,   130,   185,   193,   248,   386,
+     387,   388,   390,   642,   652,   151,   152,   153,   154,   155,
+     156,   157,   158,   159,   160,   161,   162,   163,   170,   171,
+     248,   494,   496,   574,   575,   576,   577,   579,   580,   582,
+     583,   584,   587,   589,   591,   592,   593,   595,   597,   599,
+      12,    13,   605,   606,   607,   609,     6,     3,     4,     8,
+       3,   254,     3,     8,   602,   291,   308,     4,     4,     4,
+     510,   512,   514,   306,   314,   316,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,   269,     4,     4,     4,     4,
+       4,   277,   280,   282,     4,   403,   439,   465,   431,   495,
+     497,   427,   363,   537,   499,   379,   393,     4,   372,   550,
+     561,   571,   284,   286,   611,   637,   639,   641,   645,   649,
+       4,     4,     4,     4,     4,     3,     8,   297,   299,   302,
+       4,     3,     8,   415,   417,   419,   483,   413,   421,     4,
+     425,   423,   534,   635,   663,     4,     4,     3,     8,   493,
+       4,     3,     8,   532,   520,   522,   526,   524,   530,   528,
+     516,     8,     3,     8,   455,   334,     4,   459,   457,   462,
+       4,     8,     3,   477,     4,     4,     8,     3,   389,   391,
+     643,   653,     3,     8,     4,   590,   578,     4,   581,     4,
+       4,   585,   588,     4,     4,   594,   596,   598,   600,     3,
+       8,   608,     4,     3,     8,   233,   233,   214,     4,   252,
+       4,     4,     4,   217,   217,   217,     4,     4,     4,     4,
+       4,     4,   215,   215,   215,   215,   215,   217,   216,   216,
+     215,     4,   215,   215,   217,   217,   217,     4,     4,     4,
+     217,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,   215,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,   214,   215,   215,   215,
+     258,     4,     4,     4,   217,   293,     4,     4,     4,     4,
+       4,     4,   215,     4,     4,     4,     4,     4,   215,   215,
+     411,     4,   215,   491,     4,     4,     4,     4,     4,     4,
+       4,     4,   508,     4,     4,   215,     4,     4,     4,   217,
+     450,     4,   217,   217,   474,     4,     4,     4,     4,   387,
+     217,     4,     4,   215,     4,   215,   215,     4,     4,   217,
+     217,     4,     4,     4,     4,   575,     4,   215,   606,     4,
+       7,     7,     7,     7,   214,   214,   214,     7,     7,     5,
+     214,   166,   167,   168,   169,   217,   278,   214,   214,     5,
+       5,     5,     5,   235,   237,   214,   108,   109,   110,   111,
+     428,     5,     5,     5,     5,     7,     7,     7,     7,     7,
+     214,   214,     5,     7,   214,   214,     7,     7,     5,   244,
+      17,    18,   300,    20,    21,   303,   214,   214,   214,     5,
+     214,   214,   244,   214,     7,   214,     5,   214,   244,   214,
+     214,   214,   214,   214,   214,   214,   214,   214,   214,   214,
+     214,   214,   214,   237,   233,   233,   214,   214,   214,    18,
+     164,   586,   165,   278,   214,   214,   214,     5,   233,   257,
+     605,   292,    24,   309,   310,   311,    34,    39,    40,    41,
       42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-      52,    53,    54,    55,    56,   180,   188,   189,   240,   313,
-     314,   315,   318,   320,   322,   324,   325,   327,   328,   329,
-     330,   331,   332,   333,   334,   336,   338,   340,   342,   343,
-     344,   630,   639,   641,   313,     7,   309,   310,   311,     7,
-     387,   388,   389,     7,   425,   426,   427,     7,   449,   450,
-     451,     7,   415,   416,   417,   111,   112,   113,   114,   116,
-     347,   348,   349,   350,   351,   352,   353,     7,   521,   522,
-       7,   483,   484,   485,     7,   363,   364,   365,   124,   125,
-     126,   127,   128,   129,   377,   378,   379,   380,   381,   382,
-     383,   384,   132,   133,   134,   240,   356,   357,   358,   359,
-     360,   477,   479,   136,   137,   240,   477,   479,   534,   535,
-     538,   540,   139,   140,   141,   206,   477,   479,   545,   546,
-     547,   548,   550,   551,   557,     7,   595,   596,   313,   313,
-     182,   240,   477,   479,   536,   537,   538,   540,   542,   237,
-       7,   467,   468,   469,   119,   498,   500,   518,   234,   309,
-       8,     8,     8,   304,     3,     8,   316,   319,   321,   323,
-       4,     4,     4,     4,     4,   335,   337,   339,   341,     4,
-       4,     4,     4,     4,     4,     4,   640,   642,     3,     8,
-       8,   312,     6,     3,   390,     6,     3,   428,     6,     3,
-     452,     6,     3,   418,     6,     3,     3,     6,   523,     3,
-       6,   486,     6,     3,   366,     6,     3,     4,     4,     4,
-       4,     4,     4,     3,     8,     4,     4,     4,     3,     8,
-     539,   541,     3,     8,     4,   549,     4,   552,     3,     8,
-       8,   597,     3,     6,     8,     8,     4,     3,     8,   206,
-     238,   239,   470,     6,     3,   501,     8,     6,     6,     4,
-     302,     4,     4,     4,     4,   207,   209,   207,   209,   207,
-       4,     4,     4,     4,   207,   207,   207,   207,   209,   207,
-     207,     4,     4,   314,   313,   311,   393,   389,   431,   427,
-     455,   451,   240,   251,   252,   253,   254,   255,   256,   257,
-     258,   263,   264,   265,   266,   267,   268,   271,   273,   275,
-     277,   279,   325,   385,   403,   405,   407,   409,   419,   420,
-     447,   477,   479,   492,   494,   496,   516,   417,   348,   107,
-     108,   240,   325,   421,   447,   477,   479,   492,   494,   496,
-     524,   525,   526,   527,   528,   530,   522,   489,   485,   369,
-     365,   207,   207,   207,   207,   207,   207,   378,   209,   207,
-     207,   357,     4,     4,   535,   209,     4,   207,     4,   546,
-     165,   167,   168,   240,   325,   477,   479,   598,   599,   600,
-     601,   603,   596,   209,   537,     6,     3,   473,   469,     4,
-     206,    35,    36,    37,    38,   317,   206,   206,   206,   206,
-     206,   206,   206,   206,   206,     8,     8,     8,     8,     3,
-       8,   529,     4,     8,     3,     8,     8,   206,   206,   206,
-     225,   604,     4,   602,     3,     8,   206,     8,   236,   420,
-       4,   209,   526,     4,   207,     4,   599,   206,     5,   206,
-       7,   605,   606,   607,     3,     6,   166,   169,   170,   171,
-     172,   608,   609,   610,   612,   613,   614,   615,   606,   611,
-       4,     4,     4,   616,     3,     8,     4,   209,   207,   207,
-       4,   609,   206,   206
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,   188,   196,   197,   248,   321,   322,   323,
+     326,   328,   330,   332,   333,   335,   336,   337,   338,   339,
+     340,   341,   342,   344,   346,   348,   350,   351,   352,   353,
+     354,   356,   357,   358,   359,   360,   361,   647,   656,   658,
+     321,     7,   317,   318,   319,     7,   404,   405,   406,     7,
+     442,   443,   444,     7,   466,   467,   468,     7,   432,   433,
+     434,   119,   120,   121,   122,   124,   364,   365,   366,   367,
+     368,   369,   370,     7,   538,   539,     7,   500,   501,   502,
+       7,   380,   381,   382,   132,   133,   134,   135,   136,   137,
+     394,   395,   396,   397,   398,   399,   400,   401,   140,   141,
+     142,   248,   373,   374,   375,   376,   377,   494,   496,   144,
+     145,   248,   494,   496,   551,   552,   555,   557,   147,   148,
+     149,   214,   494,   496,   562,   563,   564,   565,   567,   568,
+     574,     7,   612,   613,   321,   321,   190,   248,   494,   496,
+     553,   554,   555,   557,   559,   245,     7,   484,   485,   486,
+     127,   515,   517,   535,   242,   317,     8,     8,     8,   312,
+       3,     8,   324,   327,   329,   331,     4,     4,     4,     4,
+       4,   343,   345,   347,   349,     4,     4,     4,     4,     4,
+       4,     4,   355,     4,     4,     4,     4,     4,     4,     4,
+     657,   659,     3,     8,     8,   320,     6,     3,   407,     6,
+       3,   445,     6,     3,   469,     6,     3,   435,     6,     3,
+       3,     6,   540,     3,     6,   503,     6,     3,   383,     6,
+       3,     4,     4,     4,     4,     4,     4,     3,     8,     4,
+       4,     4,     3,     8,   556,   558,     3,     8,     4,   566,
+       4,   569,     3,     8,     8,   614,     3,     6,     8,     8,
+       4,     3,     8,   214,   246,   247,   487,     6,     3,   518,
+       8,     6,     6,     4,   310,     4,     4,     4,     4,   215,
+     217,   215,   217,   215,     4,     4,     4,     4,   215,   215,
+     215,   215,   217,   215,   217,     4,   215,   217,   215,   217,
+     217,   217,   215,     4,     4,   322,   321,   319,   410,   406,
+     448,   444,   472,   468,   248,   259,   260,   261,   262,   263,
+     264,   265,   266,   271,   272,   273,   274,   275,   276,   279,
+     281,   283,   285,   287,   333,   402,   420,   422,   424,   426,
+     436,   437,   464,   494,   496,   509,   511,   513,   533,   434,
+     365,   115,   116,   248,   333,   438,   464,   494,   496,   509,
+     511,   513,   541,   542,   543,   544,   545,   547,   539,   506,
+     502,   386,   382,   215,   215,   215,   215,   215,   215,   395,
+     217,   215,   215,   374,     4,     4,   552,   217,     4,   215,
+       4,   563,   173,   175,   176,   248,   333,   494,   496,   615,
+     616,   617,   618,   620,   613,   217,   554,     6,     3,   490,
+     486,     4,   214,    35,    36,    37,    38,   325,   214,   214,
+     214,   214,   214,   214,   214,   214,   214,   214,     8,     8,
+       8,     8,     3,     8,   546,     4,     8,     3,     8,     8,
+     214,   214,   214,   233,   621,     4,   619,     3,     8,   214,
+       8,   244,   437,     4,   217,   543,     4,   215,     4,   616,
+     214,     5,   214,     7,   622,   623,   624,     3,     6,   174,
+     177,   178,   179,   180,   625,   626,   627,   629,   630,   631,
+     632,   623,   628,     4,     4,     4,   633,     3,     8,     4,
+     217,   215,   215,     4,   626,   214,   214
   };
 
   const short
   Dhcp4Parser::yyr1_[] =
   {
-       0,   210,   212,   211,   213,   211,   214,   211,   215,   211,
-     216,   211,   217,   211,   218,   211,   219,   211,   220,   211,
-     221,   211,   222,   211,   223,   211,   224,   211,   225,   225,
-     225,   225,   225,   225,   225,   226,   228,   227,   229,   230,
-     230,   231,   231,   233,   232,   234,   234,   235,   235,   237,
-     236,   238,   238,   239,   239,   240,   242,   241,   243,   243,
-     244,   246,   245,   248,   247,   249,   249,   250,   250,   250,
-     250,   250,   250,   250,   250,   250,   250,   250,   250,   250,
-     250,   250,   250,   250,   250,   250,   250,   250,   250,   250,
-     250,   250,   250,   250,   250,   250,   250,   250,   250,   250,
-     250,   250,   250,   250,   250,   250,   250,   250,   250,   250,
-     250,   250,   250,   250,   250,   250,   250,   250,   250,   250,
-     250,   250,   250,   250,   250,   250,   250,   250,   251,   252,
-     253,   254,   255,   256,   257,   258,   259,   261,   260,   262,
-     263,   264,   265,   266,   267,   269,   268,   270,   270,   270,
-     270,   270,   272,   271,   274,   273,   276,   275,   278,   277,
-     279,   280,   281,   283,   282,   284,   284,   285,   285,   285,
-     285,   285,   285,   285,   287,   286,   289,   288,   291,   290,
-     292,   292,   294,   293,   295,   295,   296,   298,   297,   300,
-     299,   301,   301,   302,   304,   303,   306,   305,   308,   307,
-     309,   309,   310,   310,   312,   311,   313,   313,   314,   314,
-     314,   314,   314,   314,   314,   314,   314,   314,   314,   314,
-     314,   314,   314,   314,   314,   314,   314,   314,   314,   314,
-     314,   314,   316,   315,   317,   317,   317,   317,   319,   318,
-     321,   320,   323,   322,   324,   326,   325,   327,   328,   329,
-     330,   331,   332,   333,   335,   334,   337,   336,   339,   338,
-     341,   340,   342,   343,   344,   346,   345,   347,   347,   348,
-     348,   348,   348,   348,   349,   350,   351,   352,   353,   355,
-     354,   356,   356,   357,   357,   357,   357,   357,   357,   358,
-     359,   360,   362,   361,   363,   363,   364,   364,   366,   365,
-     368,   367,   369,   369,   369,   370,   370,   370,   370,   372,
-     371,   374,   373,   376,   375,   377,   377,   378,   378,   378,
-     378,   378,   378,   379,   380,   381,   382,   383,   384,   386,
-     385,   387,   387,   388,   388,   390,   389,   392,   391,   393,
-     393,   394,   394,   394,   394,   394,   394,   394,   394,   394,
-     394,   394,   394,   394,   394,   394,   394,   394,   394,   394,
-     394,   394,   394,   394,   394,   394,   394,   394,   394,   394,
-     394,   394,   394,   394,   394,   394,   394,   394,   394,   394,
-     394,   394,   394,   396,   395,   398,   397,   400,   399,   402,
-     401,   404,   403,   406,   405,   408,   407,   410,   409,   411,
-     411,   411,   411,   412,   414,   413,   415,   415,   416,   416,
-     418,   417,   419,   419,   420,   420,   420,   420,   420,   420,
-     420,   420,   420,   420,   420,   420,   420,   420,   420,   420,
-     420,   420,   420,   420,   420,   420,   420,   420,   420,   420,
-     420,   420,   420,   420,   420,   420,   420,   422,   421,   424,
-     423,   425,   425,   426,   426,   428,   427,   430,   429,   431,
-     431,   432,   432,   433,   433,   433,   433,   433,   433,   433,
-     433,   433,   433,   434,   435,   436,   438,   437,   440,   439,
-     442,   441,   443,   445,   444,   446,   448,   447,   449,   449,
-     450,   450,   452,   451,   454,   453,   455,   455,   456,   456,
-     457,   457,   457,   457,   457,   457,   457,   457,   457,   458,
-     460,   459,   461,   462,   463,   464,   466,   465,   467,   467,
-     468,   468,   470,   469,   472,   471,   473,   473,   474,   474,
-     474,   474,   474,   474,   474,   474,   474,   476,   475,   478,
-     477,   480,   479,   482,   481,   483,   483,   484,   484,   486,
-     485,   488,   487,   489,   489,   490,   490,   491,   491,   491,
-     491,   491,   491,   491,   491,   491,   491,   491,   491,   491,
-     491,   491,   493,   492,   495,   494,   497,   496,   499,   498,
-     501,   500,   503,   502,   505,   504,   507,   506,   509,   508,
-     511,   510,   513,   512,   515,   514,   517,   516,   518,   518,
-     520,   519,   521,   521,   523,   522,   524,   524,   525,   525,
-     526,   526,   526,   526,   526,   526,   526,   526,   526,   526,
-     526,   527,   529,   528,   530,   531,   533,   532,   534,   534,
-     535,   535,   535,   535,   535,   536,   536,   537,   537,   537,
-     537,   537,   537,   539,   538,   541,   540,   542,   544,   543,
-     545,   545,   546,   546,   546,   546,   546,   546,   547,   549,
-     548,   550,   552,   551,   554,   553,   556,   555,   557,   557,
-     558,   558,   558,   558,   558,   558,   558,   558,   558,   558,
-     558,   558,   558,   558,   558,   558,   558,   558,   559,   561,
-     560,   562,   564,   563,   565,   566,   568,   567,   569,   569,
-     571,   570,   573,   572,   574,   575,   577,   576,   579,   578,
-     581,   580,   583,   582,   585,   584,   587,   586,   588,   588,
-     589,   589,   591,   590,   592,   594,   593,   595,   595,   597,
-     596,   598,   598,   599,   599,   599,   599,   599,   599,   599,
-     600,   602,   601,   604,   603,   605,   605,   607,   606,   608,
-     608,   609,   609,   609,   609,   609,   611,   610,   612,   613,
-     614,   616,   615,   618,   617,   620,   619,   622,   621,   624,
-     623,   626,   625,   628,   627,   629,   630,   632,   631,   633,
-     634,   636,   635,   637,   638,   640,   639,   642,   641,   643,
-     644,   646,   645
+       0,   218,   220,   219,   221,   219,   222,   219,   223,   219,
+     224,   219,   225,   219,   226,   219,   227,   219,   228,   219,
+     229,   219,   230,   219,   231,   219,   232,   219,   233,   233,
+     233,   233,   233,   233,   233,   234,   236,   235,   237,   238,
+     238,   239,   239,   241,   240,   242,   242,   243,   243,   245,
+     244,   246,   246,   247,   247,   248,   250,   249,   251,   251,
+     252,   254,   253,   256,   255,   257,   257,   258,   258,   258,
+     258,   258,   258,   258,   258,   258,   258,   258,   258,   258,
+     258,   258,   258,   258,   258,   258,   258,   258,   258,   258,
+     258,   258,   258,   258,   258,   258,   258,   258,   258,   258,
+     258,   258,   258,   258,   258,   258,   258,   258,   258,   258,
+     258,   258,   258,   258,   258,   258,   258,   258,   258,   258,
+     258,   258,   258,   258,   258,   258,   258,   258,   259,   260,
+     261,   262,   263,   264,   265,   266,   267,   269,   268,   270,
+     271,   272,   273,   274,   275,   277,   276,   278,   278,   278,
+     278,   278,   280,   279,   282,   281,   284,   283,   286,   285,
+     287,   288,   289,   291,   290,   292,   292,   293,   293,   293,
+     293,   293,   293,   293,   295,   294,   297,   296,   299,   298,
+     300,   300,   302,   301,   303,   303,   304,   306,   305,   308,
+     307,   309,   309,   310,   312,   311,   314,   313,   316,   315,
+     317,   317,   318,   318,   320,   319,   321,   321,   322,   322,
+     322,   322,   322,   322,   322,   322,   322,   322,   322,   322,
+     322,   322,   322,   322,   322,   322,   322,   322,   322,   322,
+     322,   322,   322,   322,   322,   322,   322,   322,   322,   322,
+     324,   323,   325,   325,   325,   325,   327,   326,   329,   328,
+     331,   330,   332,   334,   333,   335,   336,   337,   338,   339,
+     340,   341,   343,   342,   345,   344,   347,   346,   349,   348,
+     350,   351,   352,   353,   355,   354,   356,   357,   358,   359,
+     360,   361,   363,   362,   364,   364,   365,   365,   365,   365,
+     365,   366,   367,   368,   369,   370,   372,   371,   373,   373,
+     374,   374,   374,   374,   374,   374,   375,   376,   377,   379,
+     378,   380,   380,   381,   381,   383,   382,   385,   384,   386,
+     386,   386,   387,   387,   387,   387,   389,   388,   391,   390,
+     393,   392,   394,   394,   395,   395,   395,   395,   395,   395,
+     396,   397,   398,   399,   400,   401,   403,   402,   404,   404,
+     405,   405,   407,   406,   409,   408,   410,   410,   411,   411,
+     411,   411,   411,   411,   411,   411,   411,   411,   411,   411,
+     411,   411,   411,   411,   411,   411,   411,   411,   411,   411,
+     411,   411,   411,   411,   411,   411,   411,   411,   411,   411,
+     411,   411,   411,   411,   411,   411,   411,   411,   411,   411,
+     413,   412,   415,   414,   417,   416,   419,   418,   421,   420,
+     423,   422,   425,   424,   427,   426,   428,   428,   428,   428,
+     429,   431,   430,   432,   432,   433,   433,   435,   434,   436,
+     436,   437,   437,   437,   437,   437,   437,   437,   437,   437,
+     437,   437,   437,   437,   437,   437,   437,   437,   437,   437,
+     437,   437,   437,   437,   437,   437,   437,   437,   437,   437,
+     437,   437,   437,   437,   439,   438,   441,   440,   442,   442,
+     443,   443,   445,   444,   447,   446,   448,   448,   449,   449,
+     450,   450,   450,   450,   450,   450,   450,   450,   450,   450,
+     451,   452,   453,   455,   454,   457,   456,   459,   458,   460,
+     462,   461,   463,   465,   464,   466,   466,   467,   467,   469,
+     468,   471,   470,   472,   472,   473,   473,   474,   474,   474,
+     474,   474,   474,   474,   474,   474,   475,   477,   476,   478,
+     479,   480,   481,   483,   482,   484,   484,   485,   485,   487,
+     486,   489,   488,   490,   490,   491,   491,   491,   491,   491,
+     491,   491,   491,   491,   493,   492,   495,   494,   497,   496,
+     499,   498,   500,   500,   501,   501,   503,   502,   505,   504,
+     506,   506,   507,   507,   508,   508,   508,   508,   508,   508,
+     508,   508,   508,   508,   508,   508,   508,   508,   508,   510,
+     509,   512,   511,   514,   513,   516,   515,   518,   517,   520,
+     519,   522,   521,   524,   523,   526,   525,   528,   527,   530,
+     529,   532,   531,   534,   533,   535,   535,   537,   536,   538,
+     538,   540,   539,   541,   541,   542,   542,   543,   543,   543,
+     543,   543,   543,   543,   543,   543,   543,   543,   544,   546,
+     545,   547,   548,   550,   549,   551,   551,   552,   552,   552,
+     552,   552,   553,   553,   554,   554,   554,   554,   554,   554,
+     556,   555,   558,   557,   559,   561,   560,   562,   562,   563,
+     563,   563,   563,   563,   563,   564,   566,   565,   567,   569,
+     568,   571,   570,   573,   572,   574,   574,   575,   575,   575,
+     575,   575,   575,   575,   575,   575,   575,   575,   575,   575,
+     575,   575,   575,   575,   575,   576,   578,   577,   579,   581,
+     580,   582,   583,   585,   584,   586,   586,   588,   587,   590,
+     589,   591,   592,   594,   593,   596,   595,   598,   597,   600,
+     599,   602,   601,   604,   603,   605,   605,   606,   606,   608,
+     607,   609,   611,   610,   612,   612,   614,   613,   615,   615,
+     616,   616,   616,   616,   616,   616,   616,   617,   619,   618,
+     621,   620,   622,   622,   624,   623,   625,   625,   626,   626,
+     626,   626,   626,   628,   627,   629,   630,   631,   633,   632,
+     635,   634,   637,   636,   639,   638,   641,   640,   643,   642,
+     645,   644,   646,   647,   649,   648,   650,   651,   653,   652,
+     654,   655,   657,   656,   659,   658,   660,   661,   663,   662
   };
 
   const signed char
@@ -5394,63 +5493,64 @@ namespace isc { namespace dhcp {
        0,     1,     1,     3,     0,     4,     1,     3,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     0,     4,     1,     1,     1,     1,     0,     4,
-       0,     4,     0,     4,     3,     0,     4,     3,     3,     3,
-       3,     3,     3,     3,     0,     4,     0,     4,     0,     4,
-       0,     4,     3,     3,     3,     0,     6,     1,     3,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
-       6,     1,     3,     1,     1,     1,     1,     1,     1,     3,
-       3,     3,     0,     6,     0,     1,     1,     3,     0,     4,
-       0,     4,     1,     3,     1,     1,     1,     1,     1,     0,
-       4,     0,     4,     0,     6,     1,     3,     1,     1,     1,
-       1,     1,     1,     3,     3,     3,     3,     3,     3,     0,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       0,     4,     1,     1,     1,     1,     0,     4,     0,     4,
+       0,     4,     3,     0,     4,     3,     3,     3,     3,     3,
+       3,     3,     0,     4,     0,     4,     0,     4,     0,     4,
+       3,     3,     3,     3,     0,     4,     3,     3,     3,     3,
+       3,     3,     0,     6,     1,     3,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     0,     6,     1,     3,
+       1,     1,     1,     1,     1,     1,     3,     3,     3,     0,
        6,     0,     1,     1,     3,     0,     4,     0,     4,     1,
-       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       3,     1,     1,     1,     1,     1,     0,     4,     0,     4,
+       0,     6,     1,     3,     1,     1,     1,     1,     1,     1,
+       3,     3,     3,     3,     3,     3,     0,     6,     0,     1,
+       1,     3,     0,     4,     0,     4,     1,     3,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     0,     4,     0,     4,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     0,     4,     1,
-       1,     1,     1,     3,     0,     6,     0,     1,     1,     3,
-       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
+       0,     4,     0,     4,     0,     4,     1,     1,     1,     1,
+       3,     0,     6,     0,     1,     1,     3,     0,     4,     1,
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     0,     6,     0,
-       4,     0,     1,     1,     3,     0,     4,     0,     4,     0,
-       1,     1,     3,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     3,     1,     0,     4,     0,     4,
-       0,     4,     1,     0,     4,     3,     0,     6,     0,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     0,     6,     0,     4,     0,     1,
        1,     3,     0,     4,     0,     4,     0,     1,     1,     3,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       0,     4,     1,     1,     3,     3,     0,     6,     0,     1,
-       1,     3,     0,     4,     0,     4,     1,     3,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     0,     4,     0,
-       4,     0,     4,     0,     6,     0,     1,     1,     3,     0,
+       1,     3,     1,     0,     4,     0,     4,     0,     4,     1,
+       0,     4,     3,     0,     6,     0,     1,     1,     3,     0,
        4,     0,     4,     0,     1,     1,     3,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     0,     4,     1,
+       1,     3,     3,     0,     6,     0,     1,     1,     3,     0,
+       4,     0,     4,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     0,     4,     0,     4,     0,     4,
+       0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
+       0,     1,     1,     3,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
+       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
+       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
+       4,     0,     4,     0,     6,     1,     1,     0,     6,     1,
+       3,     0,     4,     0,     1,     1,     3,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
+       4,     3,     3,     0,     6,     1,     3,     1,     1,     1,
+       1,     1,     1,     3,     1,     1,     1,     1,     1,     1,
+       0,     4,     0,     4,     3,     0,     6,     1,     3,     1,
+       1,     1,     1,     1,     1,     3,     0,     4,     3,     0,
+       4,     0,     6,     0,     4,     1,     3,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     0,     4,     0,     4,     0,     4,     0,     4,
-       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
-       0,     4,     0,     4,     0,     4,     0,     6,     1,     1,
-       0,     6,     1,     3,     0,     4,     0,     1,     1,     3,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     0,     4,     3,     3,     0,     6,     1,     3,
-       1,     1,     1,     1,     1,     1,     3,     1,     1,     1,
-       1,     1,     1,     0,     4,     0,     4,     3,     0,     6,
-       1,     3,     1,     1,     1,     1,     1,     1,     3,     0,
-       4,     3,     0,     4,     0,     6,     0,     4,     1,     3,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     3,     0,
-       4,     3,     0,     4,     3,     3,     0,     4,     1,     1,
-       0,     4,     0,     4,     3,     3,     0,     4,     0,     4,
-       0,     4,     0,     4,     0,     6,     0,     4,     1,     3,
-       1,     1,     0,     6,     3,     0,     6,     1,     3,     0,
-       4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
-       3,     0,     4,     0,     6,     1,     3,     0,     4,     1,
-       3,     1,     1,     1,     1,     1,     0,     4,     3,     3,
-       3,     0,     4,     0,     4,     0,     6,     0,     4,     0,
-       4,     0,     4,     0,     6,     3,     3,     0,     6,     3,
-       3,     0,     4,     3,     3,     0,     4,     0,     4,     3,
-       3,     0,     6
+       1,     1,     1,     1,     1,     3,     0,     4,     3,     0,
+       4,     3,     3,     0,     4,     1,     1,     0,     4,     0,
+       4,     3,     3,     0,     4,     0,     4,     0,     4,     0,
+       4,     0,     6,     0,     4,     1,     3,     1,     1,     0,
+       6,     3,     0,     6,     1,     3,     0,     4,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     3,     0,     4,
+       0,     6,     1,     3,     0,     4,     1,     3,     1,     1,
+       1,     1,     1,     0,     4,     3,     3,     3,     0,     4,
+       0,     4,     0,     6,     0,     4,     0,     4,     0,     4,
+       0,     6,     3,     3,     0,     6,     3,     3,     0,     4,
+       3,     3,     0,     4,     0,     4,     3,     3,     0,     6
   };
 
 
@@ -5475,7 +5575,10 @@ namespace isc { namespace dhcp {
   "\"connect-timeout\"", "\"contact-points\"", "\"keyspace\"",
   "\"consistency\"", "\"serial-consistency\"", "\"max-reconnect-tries\"",
   "\"reconnect-wait-time\"", "\"request-timeout\"", "\"tcp-keepalive\"",
-  "\"tcp-nodelay\"", "\"max-row-errors\"", "\"valid-lifetime\"",
+  "\"tcp-nodelay\"", "\"max-row-errors\"", "\"group-commit\"",
+  "\"fsync-policy\"", "\"fsync-interval\"", "\"wait-for-durability\"",
+  "\"lfc-threads\"", "\"lfc-snapshot\"", "\"lease-stats-counters\"",
+  "\"lease-expiration-buckets\"", "\"valid-lifetime\"",
   "\"min-valid-lifetime\"", "\"max-valid-lifetime\"", "\"renew-timer\"",
   "\"rebind-timer\"", "\"calculate-tee-times\"", "\"t1-percent\"",
   "\"t2-percent\"", "\"decline-probation-period\"", "\"server-tag\"",
@@ -5557,171 +5660,175 @@ namespace isc { namespace dhcp {
   "tcp_keepalive", "tcp_nodelay", "contact_points", "$@42", "keyspace",
   "$@43", "consistency", "$@44", "serial_consistency", "$@45",
   "max_reconnect_tries", "reconnect_wait_time", "max_row_errors",
-  "host_reservation_identifiers", "$@46",
+  "group_commit", "fsync_policy", "$@46", "fsync_interval",
+  "wait_for_durability", "lfc_threads", "lfc_snapshot",
+  "lease_stats_counters", "lease_expiration_buckets",
+  "host_reservation_identifiers", "$@47",
   "host_reservation_identifiers_list", "host_reservation_identifier",
   "duid_id", "hw_address_id", "circuit_id", "client_id", "flex_id",
-  "dhcp_multi_threading", "$@47", "multi_threading_params",
+  "dhcp_multi_threading", "$@48", "multi_threading_params",
   "multi_threading_param", "enable_multi_threading", "thread_pool_size",
-  "packet_queue_size", "hooks_libraries", "$@48", "hooks_libraries_list",
-  "not_empty_hooks_libraries_list", "hooks_library", "$@49",
-  "sub_hooks_library", "$@50", "hooks_params", "hooks_param", "library",
-  "$@51", "parameters", "$@52", "expired_leases_processing", "$@53",
+  "packet_queue_size", "hooks_libraries", "$@49", "hooks_libraries_list",
+  "not_empty_hooks_libraries_list", "hooks_library", "$@50",
+  "sub_hooks_library", "$@51", "hooks_params", "hooks_param", "library",
+  "$@52", "parameters", "$@53", "expired_leases_processing", "$@54",
   "expired_leases_params", "expired_leases_param",
   "reclaim_timer_wait_time", "flush_reclaimed_timer_wait_time",
   "hold_reclaimed_time", "max_reclaim_leases", "max_reclaim_time",
-  "unwarned_reclaim_cycles", "subnet4_list", "$@54",
-  "subnet4_list_content", "not_empty_subnet4_list", "subnet4", "$@55",
-  "sub_subnet4", "$@56", "subnet4_params", "subnet4_param", "subnet",
-  "$@57", "subnet_4o6_interface", "$@58", "subnet_4o6_interface_id",
-  "$@59", "subnet_4o6_subnet", "$@60", "interface", "$@61", "client_class",
-  "$@62", "require_client_classes", "$@63", "reservation_mode", "$@64",
-  "hr_mode", "id", "shared_networks", "$@65", "shared_networks_content",
-  "shared_networks_list", "shared_network", "$@66",
+  "unwarned_reclaim_cycles", "subnet4_list", "$@55",
+  "subnet4_list_content", "not_empty_subnet4_list", "subnet4", "$@56",
+  "sub_subnet4", "$@57", "subnet4_params", "subnet4_param", "subnet",
+  "$@58", "subnet_4o6_interface", "$@59", "subnet_4o6_interface_id",
+  "$@60", "subnet_4o6_subnet", "$@61", "interface", "$@62", "client_class",
+  "$@63", "require_client_classes", "$@64", "reservation_mode", "$@65",
+  "hr_mode", "id", "shared_networks", "$@66", "shared_networks_content",
+  "shared_networks_list", "shared_network", "$@67",
   "shared_network_params", "shared_network_param", "option_def_list",
-  "$@67", "sub_option_def_list", "$@68", "option_def_list_content",
-  "not_empty_option_def_list", "option_def_entry", "$@69",
-  "sub_option_def", "$@70", "option_def_params",
+  "$@68", "sub_option_def_list", "$@69", "option_def_list_content",
+  "not_empty_option_def_list", "option_def_entry", "$@70",
+  "sub_option_def", "$@71", "option_def_params",
   "not_empty_option_def_params", "option_def_param", "option_def_name",
-  "code", "option_def_code", "option_def_type", "$@71",
-  "option_def_record_types", "$@72", "space", "$@73", "option_def_space",
-  "option_def_encapsulate", "$@74", "option_def_array", "option_data_list",
-  "$@75", "option_data_list_content", "not_empty_option_data_list",
-  "option_data_entry", "$@76", "sub_option_data", "$@77",
+  "code", "option_def_code", "option_def_type", "$@72",
+  "option_def_record_types", "$@73", "space", "$@74", "option_def_space",
+  "option_def_encapsulate", "$@75", "option_def_array", "option_data_list",
+  "$@76", "option_data_list_content", "not_empty_option_data_list",
+  "option_data_entry", "$@77", "sub_option_data", "$@78",
   "option_data_params", "not_empty_option_data_params",
-  "option_data_param", "option_data_name", "option_data_data", "$@78",
+  "option_data_param", "option_data_name", "option_data_data", "$@79",
   "option_data_code", "option_data_space", "option_data_csv_format",
-  "option_data_always_send", "pools_list", "$@79", "pools_list_content",
-  "not_empty_pools_list", "pool_list_entry", "$@80", "sub_pool4", "$@81",
-  "pool_params", "pool_param", "pool_entry", "$@82", "user_context",
-  "$@83", "comment", "$@84", "reservations", "$@85", "reservations_list",
-  "not_empty_reservations_list", "reservation", "$@86", "sub_reservation",
-  "$@87", "reservation_params", "not_empty_reservation_params",
-  "reservation_param", "next_server", "$@88", "server_hostname", "$@89",
-  "boot_file_name", "$@90", "ip_address", "$@91", "ip_addresses", "$@92",
-  "duid", "$@93", "hw_address", "$@94", "client_id_value", "$@95",
-  "circuit_id_value", "$@96", "flex_id_value", "$@97", "hostname", "$@98",
-  "reservation_client_classes", "$@99", "relay", "$@100", "relay_map",
-  "client_classes", "$@101", "client_classes_list", "client_class_entry",
-  "$@102", "client_class_params", "not_empty_client_class_params",
-  "client_class_param", "client_class_name", "client_class_test", "$@103",
-  "only_if_required", "dhcp4o6_port", "control_socket", "$@104",
+  "option_data_always_send", "pools_list", "$@80", "pools_list_content",
+  "not_empty_pools_list", "pool_list_entry", "$@81", "sub_pool4", "$@82",
+  "pool_params", "pool_param", "pool_entry", "$@83", "user_context",
+  "$@84", "comment", "$@85", "reservations", "$@86", "reservations_list",
+  "not_empty_reservations_list", "reservation", "$@87", "sub_reservation",
+  "$@88", "reservation_params", "not_empty_reservation_params",
+  "reservation_param", "next_server", "$@89", "server_hostname", "$@90",
+  "boot_file_name", "$@91", "ip_address", "$@92", "ip_addresses", "$@93",
+  "duid", "$@94", "hw_address", "$@95", "client_id_value", "$@96",
+  "circuit_id_value", "$@97", "flex_id_value", "$@98", "hostname", "$@99",
+  "reservation_client_classes", "$@100", "relay", "$@101", "relay_map",
+  "client_classes", "$@102", "client_classes_list", "client_class_entry",
+  "$@103", "client_class_params", "not_empty_client_class_params",
+  "client_class_param", "client_class_name", "client_class_test", "$@104",
+  "only_if_required", "dhcp4o6_port", "control_socket", "$@105",
   "control_socket_params", "control_socket_param",
   "notifications_control_socket_params",
-  "notifications_control_socket_param", "control_socket_type", "$@105",
-  "control_socket_name", "$@106",
+  "notifications_control_socket_param", "control_socket_type", "$@106",
+  "control_socket_name", "$@107",
   "on-boot-request-configuration-from-kea-netconf", "dhcp_queue_control",
-  "$@107", "queue_control_params", "queue_control_param", "enable_queue",
-  "queue_type", "$@108", "capacity", "arbitrary_map_entry", "$@109",
-  "dhcp_ddns", "$@110", "sub_dhcp_ddns", "$@111", "dhcp_ddns_params",
-  "dhcp_ddns_param", "enable_updates", "server_ip", "$@112", "server_port",
-  "sender_ip", "$@113", "sender_port", "max_queue_size", "ncr_protocol",
-  "$@114", "ncr_protocol_value", "ncr_format", "$@115",
-  "dep_qualifying_suffix", "$@116", "dep_override_no_update",
-  "dep_override_client_update", "dep_replace_client_name", "$@117",
-  "dep_generated_prefix", "$@118", "dep_hostname_char_set", "$@119",
-  "dep_hostname_char_replacement", "$@120", "config_control", "$@121",
-  "sub_config_control", "$@122", "config_control_params",
-  "config_control_param", "config_databases", "$@123",
-  "config_fetch_wait_time", "loggers", "$@124", "loggers_entries",
-  "logger_entry", "$@125", "logger_params", "logger_param", "debuglevel",
-  "severity", "$@126", "output_options_list", "$@127",
-  "output_options_list_content", "output_entry", "$@128",
-  "output_params_list", "output_params", "output", "$@129", "flush",
-  "maxsize", "maxver", "pattern", "$@130", "allocation_type", "$@131",
-  "config_database", "$@132", "configuration_type", "$@133", "instance_id",
-  "$@134", "lawful-interception-parameters", "$@135", "master_database",
-  "$@136", "max_address_utilization", "max_statement_tries",
-  "notifications", "$@137", "option_set_description", "option_set_id",
-  "policy-engine-parameters", "$@138", "privacy_history_size",
-  "privacy_valid_lifetime", "protocol", "$@139", "ssl_cert", "$@140",
+  "$@108", "queue_control_params", "queue_control_param", "enable_queue",
+  "queue_type", "$@109", "capacity", "arbitrary_map_entry", "$@110",
+  "dhcp_ddns", "$@111", "sub_dhcp_ddns", "$@112", "dhcp_ddns_params",
+  "dhcp_ddns_param", "enable_updates", "server_ip", "$@113", "server_port",
+  "sender_ip", "$@114", "sender_port", "max_queue_size", "ncr_protocol",
+  "$@115", "ncr_protocol_value", "ncr_format", "$@116",
+  "dep_qualifying_suffix", "$@117", "dep_override_no_update",
+  "dep_override_client_update", "dep_replace_client_name", "$@118",
+  "dep_generated_prefix", "$@119", "dep_hostname_char_set", "$@120",
+  "dep_hostname_char_replacement", "$@121", "config_control", "$@122",
+  "sub_config_control", "$@123", "config_control_params",
+  "config_control_param", "config_databases", "$@124",
+  "config_fetch_wait_time", "loggers", "$@125", "loggers_entries",
+  "logger_entry", "$@126", "logger_params", "logger_param", "debuglevel",
+  "severity", "$@127", "output_options_list", "$@128",
+  "output_options_list_content", "output_entry", "$@129",
+  "output_params_list", "output_params", "output", "$@130", "flush",
+  "maxsize", "maxver", "pattern", "$@131", "allocation_type", "$@132",
+  "config_database", "$@133", "configuration_type", "$@134", "instance_id",
+  "$@135", "lawful-interception-parameters", "$@136", "master_database",
+  "$@137", "max_address_utilization", "max_statement_tries",
+  "notifications", "$@138", "option_set_description", "option_set_id",
+  "policy-engine-parameters", "$@139", "privacy_history_size",
+  "privacy_valid_lifetime", "protocol", "$@140", "ssl_cert", "$@141",
   "subnet_v4_psid_offset", "subnet_v4_psid_len",
-  "subnet_v4_excluded_psids", "$@141", YY_NULLPTR
+  "subnet_v4_excluded_psids", "$@142", YY_NULLPTR
   };
 
 #if PARSER4_DEBUG
   const short
   Dhcp4Parser::yyrline_[] =
   {
-       0,   299,   299,   299,   300,   300,   301,   301,   302,   302,
-     303,   303,   304,   304,   305,   305,   306,   306,   307,   307,
-     308,   308,   309,   309,   310,   310,   311,   311,   319,   320,
-     321,   322,   323,   324,   325,   328,   333,   333,   344,   347,
-     348,   351,   355,   362,   362,   369,   370,   373,   377,   384,
-     384,   391,   392,   395,   399,   410,   419,   419,   434,   435,
-     439,   442,   442,   459,   459,   468,   469,   474,   475,   476,
-     477,   478,   479,   480,   481,   482,   483,   484,   485,   486,
-     487,   488,   489,   490,   491,   492,   493,   494,   495,   496,
-     497,   498,   499,   500,   501,   502,   503,   504,   505,   506,
-     507,   508,   509,   510,   511,   512,   513,   514,   515,   516,
-     517,   518,   519,   520,   521,   522,   523,   524,   525,   526,
-     527,   528,   529,   530,   531,   532,   533,   534,   537,   542,
-     547,   552,   557,   562,   567,   572,   577,   582,   582,   590,
-     595,   600,   605,   610,   615,   620,   620,   628,   631,   634,
-     637,   640,   646,   646,   654,   654,   662,   662,   670,   670,
-     678,   683,   688,   693,   693,   704,   705,   708,   709,   710,
-     711,   712,   713,   714,   717,   717,   726,   726,   736,   736,
-     743,   744,   747,   747,   754,   756,   760,   766,   766,   778,
-     778,   788,   789,   791,   793,   793,   811,   811,   823,   823,
-     833,   834,   837,   838,   841,   841,   851,   852,   855,   856,
-     857,   858,   859,   860,   861,   862,   863,   864,   865,   866,
-     867,   868,   869,   870,   871,   872,   873,   874,   875,   876,
-     877,   878,   881,   881,   888,   889,   890,   891,   894,   894,
-     902,   902,   910,   910,   918,   923,   923,   931,   936,   941,
-     946,   951,   956,   961,   966,   966,   974,   974,   982,   982,
-     990,   990,   998,  1003,  1008,  1014,  1014,  1024,  1025,  1028,
-    1029,  1030,  1031,  1032,  1035,  1040,  1045,  1050,  1055,  1062,
-    1062,  1074,  1075,  1078,  1079,  1080,  1081,  1082,  1083,  1086,
-    1091,  1096,  1101,  1101,  1111,  1112,  1115,  1116,  1119,  1119,
-    1129,  1129,  1139,  1140,  1141,  1144,  1145,  1146,  1147,  1150,
-    1150,  1158,  1158,  1166,  1166,  1177,  1178,  1181,  1182,  1183,
-    1184,  1185,  1186,  1189,  1194,  1199,  1204,  1209,  1214,  1222,
-    1222,  1235,  1236,  1239,  1240,  1247,  1247,  1273,  1273,  1284,
-    1285,  1289,  1290,  1291,  1292,  1293,  1294,  1295,  1296,  1297,
-    1298,  1299,  1300,  1301,  1302,  1303,  1304,  1305,  1306,  1307,
-    1308,  1309,  1310,  1311,  1312,  1313,  1314,  1315,  1316,  1317,
-    1318,  1319,  1320,  1321,  1322,  1323,  1324,  1325,  1326,  1327,
-    1328,  1329,  1330,  1333,  1333,  1341,  1341,  1349,  1349,  1357,
-    1357,  1365,  1365,  1373,  1373,  1381,  1381,  1391,  1391,  1398,
-    1399,  1400,  1401,  1404,  1411,  1411,  1422,  1423,  1427,  1428,
-    1431,  1431,  1439,  1440,  1443,  1444,  1445,  1446,  1447,  1448,
-    1449,  1450,  1451,  1452,  1453,  1454,  1455,  1456,  1457,  1458,
-    1459,  1460,  1461,  1462,  1463,  1464,  1465,  1466,  1467,  1468,
-    1469,  1470,  1471,  1472,  1473,  1474,  1475,  1482,  1482,  1495,
-    1495,  1504,  1505,  1508,  1509,  1514,  1514,  1529,  1529,  1543,
-    1544,  1547,  1548,  1551,  1552,  1553,  1554,  1555,  1556,  1557,
-    1558,  1559,  1560,  1563,  1565,  1570,  1572,  1572,  1580,  1580,
-    1588,  1588,  1596,  1598,  1598,  1606,  1615,  1615,  1627,  1628,
-    1633,  1634,  1639,  1639,  1651,  1651,  1663,  1664,  1669,  1670,
-    1675,  1676,  1677,  1678,  1679,  1680,  1681,  1682,  1683,  1686,
-    1688,  1688,  1696,  1698,  1700,  1705,  1713,  1713,  1725,  1726,
-    1729,  1730,  1733,  1733,  1743,  1743,  1753,  1754,  1757,  1758,
-    1759,  1760,  1761,  1762,  1763,  1764,  1765,  1768,  1768,  1776,
-    1776,  1801,  1801,  1831,  1831,  1841,  1842,  1845,  1846,  1849,
-    1849,  1858,  1858,  1867,  1868,  1871,  1872,  1876,  1877,  1878,
-    1879,  1880,  1881,  1882,  1883,  1884,  1885,  1886,  1887,  1888,
-    1889,  1890,  1893,  1893,  1901,  1901,  1909,  1909,  1917,  1917,
-    1925,  1925,  1935,  1935,  1943,  1943,  1951,  1951,  1959,  1959,
-    1967,  1967,  1975,  1975,  1983,  1983,  1996,  1996,  2006,  2007,
-    2013,  2013,  2023,  2024,  2027,  2027,  2037,  2038,  2041,  2042,
-    2045,  2046,  2047,  2048,  2049,  2050,  2051,  2052,  2053,  2054,
-    2055,  2058,  2060,  2060,  2068,  2075,  2082,  2082,  2092,  2093,
-    2096,  2097,  2098,  2099,  2100,  2103,  2104,  2107,  2108,  2109,
-    2110,  2111,  2112,  2115,  2115,  2123,  2123,  2131,  2138,  2138,
-    2150,  2151,  2154,  2155,  2156,  2157,  2158,  2159,  2162,  2167,
-    2167,  2175,  2180,  2180,  2189,  2189,  2201,  2201,  2211,  2212,
-    2215,  2216,  2217,  2218,  2219,  2220,  2221,  2222,  2223,  2224,
-    2225,  2226,  2227,  2228,  2229,  2230,  2231,  2232,  2235,  2240,
-    2240,  2248,  2253,  2253,  2261,  2266,  2271,  2271,  2279,  2280,
-    2283,  2283,  2292,  2292,  2301,  2307,  2313,  2313,  2321,  2321,
-    2330,  2330,  2339,  2339,  2350,  2350,  2361,  2361,  2371,  2372,
-    2376,  2377,  2380,  2380,  2390,  2397,  2397,  2409,  2410,  2414,
-    2414,  2422,  2423,  2426,  2427,  2428,  2429,  2430,  2431,  2432,
-    2435,  2440,  2440,  2448,  2448,  2458,  2459,  2462,  2462,  2470,
-    2471,  2474,  2475,  2476,  2477,  2478,  2481,  2481,  2489,  2494,
-    2499,  2504,  2504,  2514,  2514,  2522,  2522,  2532,  2532,  2540,
-    2540,  2548,  2548,  2555,  2555,  2565,  2570,  2575,  2575,  2585,
-    2590,  2595,  2595,  2602,  2607,  2612,  2612,  2620,  2620,  2628,
-    2633,  2640,  2640
+       0,   307,   307,   307,   308,   308,   309,   309,   310,   310,
+     311,   311,   312,   312,   313,   313,   314,   314,   315,   315,
+     316,   316,   317,   317,   318,   318,   319,   319,   327,   328,
+     329,   330,   331,   332,   333,   336,   341,   341,   352,   355,
+     356,   359,   363,   370,   370,   377,   378,   381,   385,   392,
+     392,   399,   400,   403,   407,   418,   427,   427,   442,   443,
+     447,   450,   450,   467,   467,   476,   477,   482,   483,   484,
+     485,   486,   487,   488,   489,   490,   491,   492,   493,   494,
+     495,   496,   497,   498,   499,   500,   501,   502,   503,   504,
+     505,   506,   507,   508,   509,   510,   511,   512,   513,   514,
+     515,   516,   517,   518,   519,   520,   521,   522,   523,   524,
+     525,   526,   527,   528,   529,   530,   531,   532,   533,   534,
+     535,   536,   537,   538,   539,   540,   541,   542,   545,   550,
+     555,   560,   565,   570,   575,   580,   585,   590,   590,   598,
+     603,   608,   613,   618,   623,   628,   628,   636,   639,   642,
+     645,   648,   654,   654,   662,   662,   670,   670,   678,   678,
+     686,   691,   696,   701,   701,   712,   713,   716,   717,   718,
+     719,   720,   721,   722,   725,   725,   734,   734,   744,   744,
+     751,   752,   755,   755,   762,   764,   768,   774,   774,   786,
+     786,   796,   797,   799,   801,   801,   819,   819,   831,   831,
+     841,   842,   845,   846,   849,   849,   859,   860,   863,   864,
+     865,   866,   867,   868,   869,   870,   871,   872,   873,   874,
+     875,   876,   877,   878,   879,   880,   881,   882,   883,   884,
+     885,   886,   887,   888,   889,   890,   891,   892,   893,   894,
+     897,   897,   904,   905,   906,   907,   910,   910,   918,   918,
+     926,   926,   934,   939,   939,   947,   952,   957,   962,   967,
+     972,   977,   982,   982,   990,   990,   998,   998,  1006,  1006,
+    1014,  1019,  1024,  1029,  1034,  1034,  1042,  1047,  1052,  1057,
+    1062,  1067,  1073,  1073,  1083,  1084,  1087,  1088,  1089,  1090,
+    1091,  1094,  1099,  1104,  1109,  1114,  1121,  1121,  1133,  1134,
+    1137,  1138,  1139,  1140,  1141,  1142,  1145,  1150,  1155,  1160,
+    1160,  1170,  1171,  1174,  1175,  1178,  1178,  1188,  1188,  1198,
+    1199,  1200,  1203,  1204,  1205,  1206,  1209,  1209,  1217,  1217,
+    1225,  1225,  1236,  1237,  1240,  1241,  1242,  1243,  1244,  1245,
+    1248,  1253,  1258,  1263,  1268,  1273,  1281,  1281,  1294,  1295,
+    1298,  1299,  1306,  1306,  1332,  1332,  1343,  1344,  1348,  1349,
+    1350,  1351,  1352,  1353,  1354,  1355,  1356,  1357,  1358,  1359,
+    1360,  1361,  1362,  1363,  1364,  1365,  1366,  1367,  1368,  1369,
+    1370,  1371,  1372,  1373,  1374,  1375,  1376,  1377,  1378,  1379,
+    1380,  1381,  1382,  1383,  1384,  1385,  1386,  1387,  1388,  1389,
+    1392,  1392,  1400,  1400,  1408,  1408,  1416,  1416,  1424,  1424,
+    1432,  1432,  1440,  1440,  1450,  1450,  1457,  1458,  1459,  1460,
+    1463,  1470,  1470,  1481,  1482,  1486,  1487,  1490,  1490,  1498,
+    1499,  1502,  1503,  1504,  1505,  1506,  1507,  1508,  1509,  1510,
+    1511,  1512,  1513,  1514,  1515,  1516,  1517,  1518,  1519,  1520,
+    1521,  1522,  1523,  1524,  1525,  1526,  1527,  1528,  1529,  1530,
+    1531,  1532,  1533,  1534,  1541,  1541,  1554,  1554,  1563,  1564,
+    1567,  1568,  1573,  1573,  1588,  1588,  1602,  1603,  1606,  1607,
+    1610,  1611,  1612,  1613,  1614,  1615,  1616,  1617,  1618,  1619,
+    1622,  1624,  1629,  1631,  1631,  1639,  1639,  1647,  1647,  1655,
+    1657,  1657,  1665,  1674,  1674,  1686,  1687,  1692,  1693,  1698,
+    1698,  1710,  1710,  1722,  1723,  1728,  1729,  1734,  1735,  1736,
+    1737,  1738,  1739,  1740,  1741,  1742,  1745,  1747,  1747,  1755,
+    1757,  1759,  1764,  1772,  1772,  1784,  1785,  1788,  1789,  1792,
+    1792,  1802,  1802,  1812,  1813,  1816,  1817,  1818,  1819,  1820,
+    1821,  1822,  1823,  1824,  1827,  1827,  1835,  1835,  1860,  1860,
+    1890,  1890,  1900,  1901,  1904,  1905,  1908,  1908,  1917,  1917,
+    1926,  1927,  1930,  1931,  1935,  1936,  1937,  1938,  1939,  1940,
+    1941,  1942,  1943,  1944,  1945,  1946,  1947,  1948,  1949,  1952,
+    1952,  1960,  1960,  1968,  1968,  1976,  1976,  1984,  1984,  1994,
+    1994,  2002,  2002,  2010,  2010,  2018,  2018,  2026,  2026,  2034,
+    2034,  2042,  2042,  2055,  2055,  2065,  2066,  2072,  2072,  2082,
+    2083,  2086,  2086,  2096,  2097,  2100,  2101,  2104,  2105,  2106,
+    2107,  2108,  2109,  2110,  2111,  2112,  2113,  2114,  2117,  2119,
+    2119,  2127,  2134,  2141,  2141,  2151,  2152,  2155,  2156,  2157,
+    2158,  2159,  2162,  2163,  2166,  2167,  2168,  2169,  2170,  2171,
+    2174,  2174,  2182,  2182,  2190,  2197,  2197,  2209,  2210,  2213,
+    2214,  2215,  2216,  2217,  2218,  2221,  2226,  2226,  2234,  2239,
+    2239,  2248,  2248,  2260,  2260,  2270,  2271,  2274,  2275,  2276,
+    2277,  2278,  2279,  2280,  2281,  2282,  2283,  2284,  2285,  2286,
+    2287,  2288,  2289,  2290,  2291,  2294,  2299,  2299,  2307,  2312,
+    2312,  2320,  2325,  2330,  2330,  2338,  2339,  2342,  2342,  2351,
+    2351,  2360,  2366,  2372,  2372,  2380,  2380,  2389,  2389,  2398,
+    2398,  2409,  2409,  2420,  2420,  2430,  2431,  2435,  2436,  2439,
+    2439,  2449,  2456,  2456,  2468,  2469,  2473,  2473,  2481,  2482,
+    2485,  2486,  2487,  2488,  2489,  2490,  2491,  2494,  2499,  2499,
+    2507,  2507,  2517,  2518,  2521,  2521,  2529,  2530,  2533,  2534,
+    2535,  2536,  2537,  2540,  2540,  2548,  2553,  2558,  2563,  2563,
+    2573,  2573,  2581,  2581,  2591,  2591,  2599,  2599,  2607,  2607,
+    2614,  2614,  2624,  2629,  2634,  2634,  2644,  2649,  2654,  2654,
+    2661,  2666,  2671,  2671,  2679,  2679,  2687,  2692,  2699,  2699
   };
 
   // Print the state stack on the debug stream.
@@ -5756,9 +5863,9 @@ namespace isc { namespace dhcp {
 
 #line 14 "dhcp4_parser.yy"
 } } // isc::dhcp
-#line 5760 "dhcp4_parser.cc"
+#line 5867 "dhcp4_parser.cc"
 
-#line 2650 "dhcp4_parser.yy"
+#line 2709 "dhcp4_parser.yy"
 
 
 void
@@ -526,159 +526,167 @@ namespace isc { namespace dhcp {
         TOKEN_TCP_KEEPALIVE = 309,
         TOKEN_TCP_NODELAY = 310,
         TOKEN_MAX_ROW_ERRORS = 311,
-        TOKEN_VALID_LIFETIME = 312,
-        TOKEN_MIN_VALID_LIFETIME = 313,
-        TOKEN_MAX_VALID_LIFETIME = 314,
-        TOKEN_RENEW_TIMER = 315,
-        TOKEN_REBIND_TIMER = 316,
-        TOKEN_CALCULATE_TEE_TIMES = 317,
-        TOKEN_T1_PERCENT = 318,
-        TOKEN_T2_PERCENT = 319,
-        TOKEN_DECLINE_PROBATION_PERIOD = 320,
-        TOKEN_SERVER_TAG = 321,
-        TOKEN_STATISTIC_DEFAULT_SAMPLE_COUNT = 322,
-        TOKEN_STATISTIC_DEFAULT_SAMPLE_AGE = 323,
-        TOKEN_DDNS_SEND_UPDATES = 324,
-        TOKEN_DDNS_OVERRIDE_NO_UPDATE = 325,
-        TOKEN_DDNS_OVERRIDE_CLIENT_UPDATE = 326,
-        TOKEN_DDNS_REPLACE_CLIENT_NAME = 327,
-        TOKEN_DDNS_GENERATED_PREFIX = 328,
-        TOKEN_DDNS_QUALIFYING_SUFFIX = 329,
-        TOKEN_STORE_EXTENDED_INFO = 330,
-        TOKEN_SUBNET4 = 331,
-        TOKEN_SUBNET_4O6_INTERFACE = 332,
-        TOKEN_SUBNET_4O6_INTERFACE_ID = 333,
-        TOKEN_SUBNET_4O6_SUBNET = 334,
-        TOKEN_OPTION_DEF = 335,
-        TOKEN_OPTION_DATA = 336,
-        TOKEN_NAME = 337,
-        TOKEN_DATA = 338,
-        TOKEN_CODE = 339,
-        TOKEN_SPACE = 340,
-        TOKEN_CSV_FORMAT = 341,
-        TOKEN_ALWAYS_SEND = 342,
-        TOKEN_RECORD_TYPES = 343,
-        TOKEN_ENCAPSULATE = 344,
-        TOKEN_ARRAY = 345,
-        TOKEN_SHARED_NETWORKS = 346,
-        TOKEN_POOLS = 347,
-        TOKEN_POOL = 348,
-        TOKEN_USER_CONTEXT = 349,
-        TOKEN_COMMENT = 350,
-        TOKEN_SUBNET = 351,
-        TOKEN_INTERFACE = 352,
-        TOKEN_ID = 353,
-        TOKEN_RESERVATION_MODE = 354,
-        TOKEN_DISABLED = 355,
-        TOKEN_OUT_OF_POOL = 356,
-        TOKEN_GLOBAL = 357,
-        TOKEN_ALL = 358,
-        TOKEN_HOST_RESERVATION_IDENTIFIERS = 359,
-        TOKEN_CLIENT_CLASSES = 360,
-        TOKEN_REQUIRE_CLIENT_CLASSES = 361,
-        TOKEN_TEST = 362,
-        TOKEN_ONLY_IF_REQUIRED = 363,
-        TOKEN_CLIENT_CLASS = 364,
-        TOKEN_RESERVATIONS = 365,
-        TOKEN_DUID = 366,
-        TOKEN_HW_ADDRESS = 367,
-        TOKEN_CIRCUIT_ID = 368,
-        TOKEN_CLIENT_ID = 369,
-        TOKEN_HOSTNAME = 370,
-        TOKEN_FLEX_ID = 371,
-        TOKEN_RELAY = 372,
-        TOKEN_IP_ADDRESS = 373,
-        TOKEN_IP_ADDRESSES = 374,
-        TOKEN_HOOKS_LIBRARIES = 375,
-        TOKEN_LIBRARY = 376,
-        TOKEN_PARAMETERS = 377,
-        TOKEN_EXPIRED_LEASES_PROCESSING = 378,
-        TOKEN_RECLAIM_TIMER_WAIT_TIME = 379,
-        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 380,
-        TOKEN_HOLD_RECLAIMED_TIME = 381,
-        TOKEN_MAX_RECLAIM_LEASES = 382,
-        TOKEN_MAX_RECLAIM_TIME = 383,
-        TOKEN_UNWARNED_RECLAIM_CYCLES = 384,
-        TOKEN_DHCP4O6_PORT = 385,
-        TOKEN_DHCP_MULTI_THREADING = 386,
-        TOKEN_ENABLE_MULTI_THREADING = 387,
-        TOKEN_THREAD_POOL_SIZE = 388,
-        TOKEN_PACKET_QUEUE_SIZE = 389,
-        TOKEN_CONTROL_SOCKET = 390,
-        TOKEN_SOCKET_TYPE = 391,
-        TOKEN_SOCKET_NAME = 392,
-        TOKEN_DHCP_QUEUE_CONTROL = 393,
-        TOKEN_ENABLE_QUEUE = 394,
-        TOKEN_QUEUE_TYPE = 395,
-        TOKEN_CAPACITY = 396,
-        TOKEN_DHCP_DDNS = 397,
-        TOKEN_ENABLE_UPDATES = 398,
-        TOKEN_QUALIFYING_SUFFIX = 399,
-        TOKEN_SERVER_IP = 400,
-        TOKEN_SERVER_PORT = 401,
-        TOKEN_SENDER_IP = 402,
-        TOKEN_SENDER_PORT = 403,
-        TOKEN_MAX_QUEUE_SIZE = 404,
-        TOKEN_NCR_PROTOCOL = 405,
-        TOKEN_NCR_FORMAT = 406,
-        TOKEN_OVERRIDE_NO_UPDATE = 407,
-        TOKEN_OVERRIDE_CLIENT_UPDATE = 408,
-        TOKEN_REPLACE_CLIENT_NAME = 409,
-        TOKEN_GENERATED_PREFIX = 410,
-        TOKEN_TCP = 411,
-        TOKEN_JSON = 412,
-        TOKEN_WHEN_PRESENT = 413,
-        TOKEN_NEVER = 414,
-        TOKEN_ALWAYS = 415,
-        TOKEN_WHEN_NOT_PRESENT = 416,
-        TOKEN_HOSTNAME_CHAR_SET = 417,
-        TOKEN_HOSTNAME_CHAR_REPLACEMENT = 418,
-        TOKEN_LOGGERS = 419,
-        TOKEN_OUTPUT_OPTIONS = 420,
-        TOKEN_OUTPUT = 421,
-        TOKEN_DEBUGLEVEL = 422,
-        TOKEN_SEVERITY = 423,
-        TOKEN_FLUSH = 424,
-        TOKEN_MAXSIZE = 425,
-        TOKEN_MAXVER = 426,
-        TOKEN_PATTERN = 427,
-        TOKEN_ALLOCATION_TYPE = 428,
-        TOKEN_CONFIG_DATABASE = 429,
-        TOKEN_CONFIGURATION_TYPE = 430,
-        TOKEN_INSTANCE_ID = 431,
-        TOKEN_LAWFUL_INTERCEPTION_PARAMETERS = 432,
-        TOKEN_MASTER_DATABASE = 433,
-        TOKEN_MAX_ADDRESS_UTILIZATION = 434,
-        TOKEN_MAX_STATEMENT_TRIES = 435,
-        TOKEN_NOTIFICATIONS = 436,
-        TOKEN_ON_BOOT_REQUEST_CONFIGURATION_FROM_KEA_NETCONF = 437,
-        TOKEN_OPTION_SET_DESCRIPTION = 438,
-        TOKEN_OPTION_SET_ID = 439,
-        TOKEN_POLICY_ENGINE_PARAMETERS = 440,
-        TOKEN_PRIVACY_HISTORY_SIZE = 441,
-        TOKEN_PRIVACY_VALID_LIFETIME = 442,
-        TOKEN_PROTOCOL = 443,
-        TOKEN_SSL_CERT = 444,
-        TOKEN_SUBNET_V4_EXCLUDED_PSIDS = 445,
-        TOKEN_SUBNET_V4_PSID_LEN = 446,
-        TOKEN_SUBNET_V4_PSID_OFFSET = 447,
-        TOKEN_TOPLEVEL_JSON = 448,
-        TOKEN_TOPLEVEL_DHCP4 = 449,
-        TOKEN_SUB_DHCP4 = 450,
-        TOKEN_SUB_INTERFACES4 = 451,
-        TOKEN_SUB_SUBNET4 = 452,
-        TOKEN_SUB_POOL4 = 453,
-        TOKEN_SUB_RESERVATION = 454,
-        TOKEN_SUB_OPTION_DEFS = 455,
-        TOKEN_SUB_OPTION_DEF = 456,
-        TOKEN_SUB_OPTION_DATA = 457,
-        TOKEN_SUB_HOOKS_LIBRARY = 458,
-        TOKEN_SUB_DHCP_DDNS = 459,
-        TOKEN_SUB_CONFIG_CONTROL = 460,
-        TOKEN_STRING = 461,
-        TOKEN_INTEGER = 462,
-        TOKEN_FLOAT = 463,
-        TOKEN_BOOLEAN = 464
+        TOKEN_GROUP_COMMIT = 312,
+        TOKEN_FSYNC_POLICY = 313,
+        TOKEN_FSYNC_INTERVAL = 314,
+        TOKEN_WAIT_FOR_DURABILITY = 315,
+        TOKEN_LFC_THREADS = 316,
+        TOKEN_LFC_SNAPSHOT = 317,
+        TOKEN_LEASE_STATS_COUNTERS = 318,
+        TOKEN_LEASE_EXPIRATION_BUCKETS = 319,
+        TOKEN_VALID_LIFETIME = 320,
+        TOKEN_MIN_VALID_LIFETIME = 321,
+        TOKEN_MAX_VALID_LIFETIME = 322,
+        TOKEN_RENEW_TIMER = 323,
+        TOKEN_REBIND_TIMER = 324,
+        TOKEN_CALCULATE_TEE_TIMES = 325,
+        TOKEN_T1_PERCENT = 326,
+        TOKEN_T2_PERCENT = 327,
+        TOKEN_DECLINE_PROBATION_PERIOD = 328,
+        TOKEN_SERVER_TAG = 329,
+        TOKEN_STATISTIC_DEFAULT_SAMPLE_COUNT = 330,
+        TOKEN_STATISTIC_DEFAULT_SAMPLE_AGE = 331,
+        TOKEN_DDNS_SEND_UPDATES = 332,
+        TOKEN_DDNS_OVERRIDE_NO_UPDATE = 333,
+        TOKEN_DDNS_OVERRIDE_CLIENT_UPDATE = 334,
+        TOKEN_DDNS_REPLACE_CLIENT_NAME = 335,
+        TOKEN_DDNS_GENERATED_PREFIX = 336,
+        TOKEN_DDNS_QUALIFYING_SUFFIX = 337,
+        TOKEN_STORE_EXTENDED_INFO = 338,
+        TOKEN_SUBNET4 = 339,
+        TOKEN_SUBNET_4O6_INTERFACE = 340,
+        TOKEN_SUBNET_4O6_INTERFACE_ID = 341,
+        TOKEN_SUBNET_4O6_SUBNET = 342,
+        TOKEN_OPTION_DEF = 343,
+        TOKEN_OPTION_DATA = 344,
+        TOKEN_NAME = 345,
+        TOKEN_DATA = 346,
+        TOKEN_CODE = 347,
+        TOKEN_SPACE = 348,
+        TOKEN_CSV_FORMAT = 349,
+        TOKEN_ALWAYS_SEND = 350,
+        TOKEN_RECORD_TYPES = 351,
+        TOKEN_ENCAPSULATE = 352,
+        TOKEN_ARRAY = 353,
+        TOKEN_SHARED_NETWORKS = 354,
+        TOKEN_POOLS = 355,
+        TOKEN_POOL = 356,
+        TOKEN_USER_CONTEXT = 357,
+        TOKEN_COMMENT = 358,
+        TOKEN_SUBNET = 359,
+        TOKEN_INTERFACE = 360,
+        TOKEN_ID = 361,
+        TOKEN_RESERVATION_MODE = 362,
+        TOKEN_DISABLED = 363,
+        TOKEN_OUT_OF_POOL = 364,
+        TOKEN_GLOBAL = 365,
+        TOKEN_ALL = 366,
+        TOKEN_HOST_RESERVATION_IDENTIFIERS = 367,
+        TOKEN_CLIENT_CLASSES = 368,
+        TOKEN_REQUIRE_CLIENT_CLASSES = 369,
+        TOKEN_TEST = 370,
+        TOKEN_ONLY_IF_REQUIRED = 371,
+        TOKEN_CLIENT_CLASS = 372,
+        TOKEN_RESERVATIONS = 373,
+        TOKEN_DUID = 374,
+        TOKEN_HW_ADDRESS = 375,
+        TOKEN_CIRCUIT_ID = 376,
+        TOKEN_CLIENT_ID = 377,
+        TOKEN_HOSTNAME = 378,
+        TOKEN_FLEX_ID = 379,
+        TOKEN_RELAY = 380,
+        TOKEN_IP_ADDRESS = 381,
+        TOKEN_IP_ADDRESSES = 382,
+        TOKEN_HOOKS_LIBRARIES = 383,
+        TOKEN_LIBRARY = 384,
+        TOKEN_PARAMETERS = 385,
+        TOKEN_EXPIRED_LEASES_PROCESSING = 386,
+        TOKEN_RECLAIM_TIMER_WAIT_TIME = 387,
+        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 388,
+        TOKEN_HOLD_RECLAIMED_TIME = 389,
+        TOKEN_MAX_RECLAIM_LEASES = 390,
+        TOKEN_MAX_RECLAIM_TIME = 391,
+        TOKEN_UNWARNED_RECLAIM_CYCLES = 392,
+        TOKEN_DHCP4O6_PORT = 393,
+        TOKEN_DHCP_MULTI_THREADING = 394,
+        TOKEN_ENABLE_MULTI_THREADING = 395,
+        TOKEN_THREAD_POOL_SIZE = 396,
+        TOKEN_PACKET_QUEUE_SIZE = 397,
+        TOKEN_CONTROL_SOCKET = 398,
+        TOKEN_SOCKET_TYPE = 399,
+        TOKEN_SOCKET_NAME = 400,
+        TOKEN_DHCP_QUEUE_CONTROL = 401,
+        TOKEN_ENABLE_QUEUE = 402,
+        TOKEN_QUEUE_TYPE = 403,
+        TOKEN_CAPACITY = 404,
+        TOKEN_DHCP_DDNS = 405,
+        TOKEN_ENABLE_UPDATES = 406,
+        TOKEN_QUALIFYING_SUFFIX = 407,
+        TOKEN_SERVER_IP = 408,
+        TOKEN_SERVER_PORT = 409,
+        TOKEN_SENDER_IP = 410,
+        TOKEN_SENDER_PORT = 411,
+        TOKEN_MAX_QUEUE_SIZE = 412,
+        TOKEN_NCR_PROTOCOL = 413,
+        TOKEN_NCR_FORMAT = 414,
+        TOKEN_OVERRIDE_NO_UPDATE = 415,
+        TOKEN_OVERRIDE_CLIENT_UPDATE = 416,
+        TOKEN_REPLACE_CLIENT_NAME = 417,
+        TOKEN_GENERATED_PREFIX = 418,
+        TOKEN_TCP = 419,
+        TOKEN_JSON = 420,
+        TOKEN_WHEN_PRESENT = 421,
+        TOKEN_NEVER = 422,
+        TOKEN_ALWAYS = 423,
+        TOKEN_WHEN_NOT_PRESENT = 424,
+        TOKEN_HOSTNAME_CHAR_SET = 425,
+        TOKEN_HOSTNAME_CHAR_REPLACEMENT = 426,
+        TOKEN_LOGGERS = 427,
+        TOKEN_OUTPUT_OPTIONS = 428,
+        TOKEN_OUTPUT = 429,
+        TOKEN_DEBUGLEVEL = 430,
+        TOKEN_SEVERITY = 431,
+        TOKEN_FLUSH = 432,
+        TOKEN_MAXSIZE = 433,
+        TOKEN_MAXVER = 434,
+        TOKEN_PATTERN = 435,
+        TOKEN_ALLOCATION_TYPE = 436,
+        TOKEN_CONFIG_DATABASE = 437,
+        TOKEN_CONFIGURATION_TYPE = 438,
+        TOKEN_INSTANCE_ID = 439,
+        TOKEN_LAWFUL_INTERCEPTION_PARAMETERS = 440,
+        TOKEN_MASTER_DATABASE = 441,
+        TOKEN_MAX_ADDRESS_UTILIZATION = 442,
+        TOKEN_MAX_STATEMENT_TRIES = 443,
+        TOKEN_NOTIFICATIONS = 444,
+        TOKEN_ON_BOOT_REQUEST_CONFIGURATION_FROM_KEA_NETCONF = 445,
+        TOKEN_OPTION_SET_DESCRIPTION = 446,
+        TOKEN_OPTION_SET_ID = 447,
+        TOKEN_POLICY_ENGINE_PARAMETERS = 448,
+        TOKEN_PRIVACY_HISTORY_SIZE = 449,
+        TOKEN_PRIVACY_VALID_LIFETIME = 450,
+        TOKEN_PROTOCOL = 451,
+        TOKEN_SSL_CERT = 452,
+        TOKEN_SUBNET_V4_EXCLUDED_PSIDS = 453,
+        TOKEN_SUBNET_V4_PSID_LEN = 454,
+        TOKEN_SUBNET_V4_PSID_OFFSET = 455,
+        TOKEN_TOPLEVEL_JSON = 456,
+        TOKEN_TOPLEVEL_DHCP4 = 457,
+        TOKEN_SUB_DHCP4 = 458,
+        TOKEN_SUB_INTERFACES4 = 459,
+        TOKEN_SUB_SUBNET4 = 460,
+        TOKEN_SUB_POOL4 = 461,
+        TOKEN_SUB_RESERVATION = 462,
+        TOKEN_SUB_OPTION_DEFS = 463,
+        TOKEN_SUB_OPTION_DEF = 464,
+        TOKEN_SUB_OPTION_DATA = 465,
+        TOKEN_SUB_HOOKS_LIBRARY = 466,
+        TOKEN_SUB_DHCP_DDNS = 467,
+        TOKEN_SUB_CONFIG_CONTROL = 468,
+        TOKEN_STRING = 469,
+        TOKEN_INTEGER = 470,
+        TOKEN_FLOAT = 471,
+        TOKEN_BOOLEAN = 472
       };
     };
 
@@ -820,30 +828,30 @@ namespace isc { namespace dhcp {
         // Type destructor.
 switch (yytype)
     {
-      case 225: // value
-      case 229: // map_value
-      case 270: // ddns_replace_client_name_value
-      case 292: // socket_type
-      case 295: // outbound_interface_value
-      case 317: // db_type
-      case 411: // hr_mode
-      case 569: // ncr_protocol_value
+      case 233: // value
+      case 237: // map_value
+      case 278: // ddns_replace_client_name_value
+      case 300: // socket_type
+      case 303: // outbound_interface_value
+      case 325: // db_type
+      case 428: // hr_mode
+      case 586: // ncr_protocol_value
         value.template destroy< ElementPtr > ();
         break;
 
-      case 209: // "boolean"
+      case 217: // "boolean"
         value.template destroy< bool > ();
         break;
 
-      case 208: // "floating point"
+      case 216: // "floating point"
         value.template destroy< double > ();
         break;
 
-      case 207: // "integer"
+      case 215: // "integer"
         value.template destroy< int64_t > ();
         break;
 
-      case 206: // "constant string"
+      case 214: // "constant string"
         value.template destroy< std::string > ();
         break;
 
@@ -1846,6 +1854,126 @@ switch (yytype)
         return symbol_type (token::TOKEN_MAX_ROW_ERRORS, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_GROUP_COMMIT (location_type l)
+      {
+        return symbol_type (token::TOKEN_GROUP_COMMIT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_GROUP_COMMIT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_GROUP_COMMIT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FSYNC_POLICY (location_type l)
+      {
+        return symbol_type (token::TOKEN_FSYNC_POLICY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FSYNC_POLICY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FSYNC_POLICY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FSYNC_INTERVAL (location_type l)
+      {
+        return symbol_type (token::TOKEN_FSYNC_INTERVAL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FSYNC_INTERVAL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FSYNC_INTERVAL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_WAIT_FOR_DURABILITY (location_type l)
+      {
+        return symbol_type (token::TOKEN_WAIT_FOR_DURABILITY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_WAIT_FOR_DURABILITY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_WAIT_FOR_DURABILITY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LFC_THREADS (location_type l)
+      {
+        return symbol_type (token::TOKEN_LFC_THREADS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LFC_THREADS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LFC_THREADS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LFC_SNAPSHOT (location_type l)
+      {
+        return symbol_type (token::TOKEN_LFC_SNAPSHOT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LFC_SNAPSHOT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LFC_SNAPSHOT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LEASE_STATS_COUNTERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_LEASE_STATS_COUNTERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LEASE_STATS_COUNTERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LEASE_STATS_COUNTERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LEASE_EXPIRATION_BUCKETS (location_type l)
+      {
+        return symbol_type (token::TOKEN_LEASE_EXPIRATION_BUCKETS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LEASE_EXPIRATION_BUCKETS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LEASE_EXPIRATION_BUCKETS, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -4447,10 +4575,10 @@ switch (yytype)
     enum
     {
       yyeof_ = 0,
-      yylast_ = 1283,     ///< Last index in yytable_.
-      yynnts_ = 437,  ///< Number of nonterminal symbols.
+      yylast_ = 1316,     ///< Last index in yytable_.
+      yynnts_ = 446,  ///< Number of nonterminal symbols.
       yyfinal_ = 28, ///< Termination state number.
-      yyntokens_ = 210  ///< Number of tokens.
+      yyntokens_ = 218  ///< Number of tokens.
     };
 
 
@@ -4514,9 +4642,10 @@ switch (yytype)
      175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
      185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
      195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
-     205,   206,   207,   208,   209
+     205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
+     215,   216,   217
     };
-    const int user_token_number_max_ = 464;
+    const int user_token_number_max_ = 472;
 
     if (t <= 0)
       return yyeof_;
@@ -4536,30 +4665,30 @@ switch (yytype)
   {
     switch (this->type_get ())
     {
-      case 225: // value
-      case 229: // map_value
-      case 270: // ddns_replace_client_name_value
-      case 292: // socket_type
-      case 295: // outbound_interface_value
-      case 317: // db_type
-      case 411: // hr_mode
-      case 569: // ncr_protocol_value
+      case 233: // value
+      case 237: // map_value
+      case 278: // ddns_replace_client_name_value
+      case 300: // socket_type
+      case 303: // outbound_interface_value
+      case 325: // db_type
+      case 428: // hr_mode
+      case 586: // ncr_protocol_value
         value.move< ElementPtr > (std::move (that.value));
         break;
 
-      case 209: // "boolean"
+      case 217: // "boolean"
         value.move< bool > (std::move (that.value));
         break;
 
-      case 208: // "floating point"
+      case 216: // "floating point"
         value.move< double > (std::move (that.value));
         break;
 
-      case 207: // "integer"
+      case 215: // "integer"
         value.move< int64_t > (std::move (that.value));
         break;
 
-      case 206: // "constant string"
+      case 214: // "constant string"
         value.move< std::string > (std::move (that.value));
         break;
 
@@ -4578,30 +4707,30 @@ switch (yytype)
   {
     switch (this->type_get ())
     {
-      case 225: // value
-      case 229: // map_value
-      case 270: // ddns_replace_client_name_value
-      case 292: // socket_type
-      case 295: // outbound_interface_value
-      case 317: // db_type
-      case 411: // hr_mode
-      case 569: // ncr_protocol_value
+      case 233: // value
+      case 237: // map_value
+      case 278: // ddns_replace_client_name_value
+      case 300: // socket_type
+      case 303: // outbound_interface_value
+      case 325: // db_type
+      case 428: // hr_mode
+      case 586: // ncr_protocol_value
         value.copy< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 209: // "boolean"
+      case 217: // "boolean"
         value.copy< bool > (YY_MOVE (that.value));
         break;
 
-      case 208: // "floating point"
+      case 216: // "floating point"
         value.copy< double > (YY_MOVE (that.value));
         break;
 
-      case 207: // "integer"
+      case 215: // "integer"
         value.copy< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 206: // "constant string"
+      case 214: // "constant string"
         value.copy< std::string > (YY_MOVE (that.value));
         break;
 
@@ -4627,30 +4756,30 @@ switch (yytype)
     super_type::move (s);
     switch (this->type_get ())
     {
-      case 225: // value
-      case 229: // map_value
-      case 270: // ddns_replace_client_name_value
-      case 292: // socket_type
-      case 295: // outbound_interface_value
-      case 317: // db_type
-      case 411: // hr_mode
-      case 569: // ncr_protocol_value
+      case 233: // value
+      case 237: // map_value
+      case 278: // ddns_replace_client_name_value
+      case 300: // socket_type
+      case 303: // outbound_interface_value
+      case 325: // db_type
+      case 428: // hr_mode
+      case 586: // ncr_protocol_value
         value.move< ElementPtr > (YY_MOVE (s.value));
         break;
 
-      case 209: // "boolean"
+      case 217: // "boolean"
         value.move< bool > (YY_MOVE (s.value));
         break;
 
-      case 208: // "floating point"
+      case 216: // "floating point"
         value.move< double > (YY_MOVE (s.value));
         break;
 
-      case 207: // "integer"
+      case 215: // "integer"
         value.move< int64_t > (YY_MOVE (s.value));
         break;
 
-      case 206: // "constant string"
+      case 214: // "constant string"
         value.move< std::string > (YY_MOVE (s.value));
         break;
 
@@ -4710,7 +4839,7 @@ switch (yytype)
 
 #line 14 "dhcp4_parser.yy"
 } } // isc::dhcp
-#line 4714 "dhcp4_parser.h"
+#line 4843 "dhcp4_parser.h"
 
 
 
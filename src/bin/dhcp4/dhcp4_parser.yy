@@ -101,6 +101,14 @@ using namespace std;
   TCP_KEEPALIVE "tcp-keepalive"
   TCP_NODELAY "tcp-nodelay"
   MAX_ROW_ERRORS "max-row-errors"
+  GROUP_COMMIT "group-commit"
+  FSYNC_POLICY "fsync-policy"
+  FSYNC_INTERVAL "fsync-interval"
+  WAIT_FOR_DURABILITY "wait-for-durability"
+  LFC_THREADS "lfc-threads"
+  LFC_SNAPSHOT "lfc-snapshot"
+  LEASE_STATS_COUNTERS "lease-stats-counters"
+  LEASE_EXPIRATION_BUCKETS "lease-expiration-buckets"
 
   VALID_LIFETIME "valid-lifetime"
   MIN_VALID_LIFETIME "min-valid-lifetime"
@@ -875,6 +883,14 @@ database_map_param: database_type
                   | max_statement_tries
                   | protocol
                   | ssl_cert
+                  | group_commit
+                  | fsync_policy
+                  | fsync_interval
+                  | wait_for_durability
+                  | lfc_threads
+                  | lfc_snapshot
+                  | lease_stats_counters
+                  | lease_expiration_buckets
                   | unknown_map_entry
                   ;
 
@@ -1010,6 +1026,49 @@ max_row_errors: MAX_ROW_ERRORS COLON INTEGER {
     ctx.stack_.back()->set("max-row-errors", n);
 };
 
+group_commit: GROUP_COMMIT COLON BOOLEAN {
+    ElementPtr n(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("group-commit", n);
+};
+
+fsync_policy: FSYNC_POLICY {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr n(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("fsync-policy", n);
+    ctx.leave();
+};
+
+fsync_interval: FSYNC_INTERVAL COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("fsync-interval", n);
+};
+
+wait_for_durability: WAIT_FOR_DURABILITY COLON BOOLEAN {
+    ElementPtr n(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("wait-for-durability", n);
+};
+
+lfc_threads: LFC_THREADS COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("lfc-threads", n);
+};
+
+lfc_snapshot: LFC_SNAPSHOT COLON BOOLEAN {
+    ElementPtr n(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("lfc-snapshot", n);
+};
+
+lease_stats_counters: LEASE_STATS_COUNTERS COLON BOOLEAN {
+    ElementPtr n(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("lease-stats-counters", n);
+};
+
+lease_expiration_buckets: LEASE_EXPIRATION_BUCKETS COLON BOOLEAN {
+    ElementPtr n(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("lease-expiration-buckets", n);
+};
+
 
 host_reservation_identifiers: HOST_RESERVATION_IDENTIFIERS {
     ElementPtr l(new ListElement(ctx.loc2pos(@1)));
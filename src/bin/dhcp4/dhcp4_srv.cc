@@ -41,9 +41,11 @@
 #include <dhcpsrv/master_config_mgr_factory.h>
 #include <dhcpsrv/ncr_generator.h>
 #include <dhcpsrv/notifications_manager.h>
+#include <dhcpsrv/resolved_options_cache.h>
 #include <dhcpsrv/shard_config_mgr.h>
 #include <dhcpsrv/shard_config_mgr_factory.h>
 #include <dhcpsrv/shared_network.h>
+#include <dhcpsrv/stage_latency.h>
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/subnet_selector.h>
 #include <dhcpsrv/utils.h>
@@ -88,7 +90,8 @@ namespace ph = std::placeholders;
 
 namespace {
 
-/// Structure that holds registered hook indexes
+/// Structure that holds registered hook indexes and the arguments they
+/// pass to the callouts
 struct Dhcp4Hooks {
     int hook_index_buffer4_receive_;   ///< index for "buffer4_receive" hook point
     int hook_index_pkt4_receive_;      ///< index for "pkt4_receive" hook point
@@ -100,17 +103,110 @@ struct Dhcp4Hooks {
     int hook_index_lease4_decline_;    ///< index for "lease4_decline" hook point
     int hook_index_host4_identifier_;  ///< index for "host4_identifier" hook point
 
+    /// Arguments of the "buffer4_receive" hook point
+    CalloutArgument<Pkt4Ptr> buffer4_receive_query4_;
+
+    /// Arguments of the "pkt4_receive" hook point
+    CalloutArgument<Pkt4Ptr> pkt4_receive_query4_;
+
+    /// Arguments of the "subnet4_select" hook point
+    CalloutArgument<Pkt4Ptr> subnet4_select_query4_;
+    CalloutArgument<Subnet4Ptr> subnet4_select_subnet4_;
+    CalloutArgument<const Subnet4Collection*> subnet4_select_subnet4collection_;
+
+    /// Arguments of the "leases4_committed" hook point
+    CalloutArgument<Pkt4Ptr> leases4_committed_query4_;
+    CalloutArgument<Lease4CollectionPtr> leases4_committed_leases4_;
+    CalloutArgument<Lease4CollectionPtr> leases4_committed_deleted_leases4_;
+
+    /// Arguments of the "lease4_release" hook point
+    CalloutArgument<Pkt4Ptr> lease4_release_query4_;
+    CalloutArgument<Lease4Ptr> lease4_release_lease4_;
+
+    /// Arguments of the "pkt4_send" hook point
+    CalloutArgument<Pkt4Ptr> pkt4_send_response4_;
+    CalloutArgument<Pkt4Ptr> pkt4_send_query4_;
+
+    /// Arguments of the "buffer4_send" hook point
+    CalloutArgument<Pkt4Ptr> buffer4_send_response4_;
+
+    /// Arguments of the "lease4_decline" hook point
+    CalloutArgument<Lease4Ptr> lease4_decline_lease4_;
+    CalloutArgument<Pkt4Ptr> lease4_decline_query4_;
+
+    /// Arguments of the "host4_identifier" hook point
+    CalloutArgument<Pkt4Ptr> host4_identifier_query4_;
+    CalloutArgument<Host::IdentifierType> host4_identifier_id_type_;
+    CalloutArgument<std::vector<uint8_t>> host4_identifier_id_value_;
+
     /// Constructor that registers hook points for DHCPv4 engine
     Dhcp4Hooks() {
-        hook_index_buffer4_receive_   = HooksManager::registerHook("buffer4_receive");
-        hook_index_pkt4_receive_      = HooksManager::registerHook("pkt4_receive");
-        hook_index_subnet4_select_    = HooksManager::registerHook("subnet4_select");
-        hook_index_leases4_committed_ = HooksManager::registerHook("leases4_committed");
-        hook_index_lease4_release_    = HooksManager::registerHook("lease4_release");
-        hook_index_pkt4_send_         = HooksManager::registerHook("pkt4_send");
-        hook_index_buffer4_send_      = HooksManager::registerHook("buffer4_send");
-        hook_index_lease4_decline_    = HooksManager::registerHook("lease4_decline");
-        hook_index_host4_identifier_  = HooksManager::registerHook("host4_identifier");
+        hook_index_buffer4_receive_   = HooksManager::registerHook("buffer4_receive",
+                                                                   { "query4" });
+        hook_index_pkt4_receive_      = HooksManager::registerHook("pkt4_receive",
+                                                                   { "query4" });
+        hook_index_subnet4_select_    = HooksManager::registerHook("subnet4_select",
+                                                                   { "query4",
+                                                                     "subnet4",
+                                                                     "subnet4collection" });
+        hook_index_leases4_committed_ = HooksManager::registerHook("leases4_committed",
+                                                                   { "query4",
+                                                                     "leases4",
+                                                                     "deleted_leases4" });
+        hook_index_lease4_release_    = HooksManager::registerHook("lease4_release",
+                                                                   { "query4",
+                                                                     "lease4" });
+        hook_index_pkt4_send_         = HooksManager::registerHook("pkt4_send",
+                                                                   { "response4",
+                                                                     "query4" });
+        hook_index_buffer4_send_      = HooksManager::registerHook("buffer4_send",
+                                                                   { "response4" });
+        hook_index_lease4_decline_    = HooksManager::registerHook("lease4_decline",
+                                                                   { "lease4",
+                                                                     "query4" });
+        hook_index_host4_identifier_  = HooksManager::registerHook("host4_identifier",
+                                                                   { "query4",
+                                                                     "id_type",
+                                                                     "id_value" });
+
+        buffer4_receive_query4_ = HooksManager::getArgument<Pkt4Ptr>(
+            hook_index_buffer4_receive_, "query4");
+        pkt4_receive_query4_ = HooksManager::getArgument<Pkt4Ptr>(
+            hook_index_pkt4_receive_, "query4");
+        subnet4_select_query4_ = HooksManager::getArgument<Pkt4Ptr>(
+            hook_index_subnet4_select_, "query4");
+        subnet4_select_subnet4_ = HooksManager::getArgument<Subnet4Ptr>(
+            hook_index_subnet4_select_, "subnet4");
+        subnet4_select_subnet4collection_ =
+            HooksManager::getArgument<const Subnet4Collection*>(
+                hook_index_subnet4_select_, "subnet4collection");
+        leases4_committed_query4_ = HooksManager::getArgument<Pkt4Ptr>(
+            hook_index_leases4_committed_, "query4");
+        leases4_committed_leases4_ = HooksManager::getArgument<Lease4CollectionPtr>(
+            hook_index_leases4_committed_, "leases4");
+        leases4_committed_deleted_leases4_ =
+            HooksManager::getArgument<Lease4CollectionPtr>(
+                hook_index_leases4_committed_, "deleted_leases4");
+        lease4_release_query4_ = HooksManager::getArgument<Pkt4Ptr>(
+            hook_index_lease4_release_, "query4");
+        lease4_release_lease4_ = HooksManager::getArgument<Lease4Ptr>(
+            hook_index_lease4_release_, "lease4");
+        pkt4_send_response4_ = HooksManager::getArgument<Pkt4Ptr>(
+            hook_index_pkt4_send_, "response4");
+        pkt4_send_query4_ = HooksManager::getArgument<Pkt4Ptr>(
+            hook_index_pkt4_send_, "query4");
+        buffer4_send_response4_ = HooksManager::getArgument<Pkt4Ptr>(
+            hook_index_buffer4_send_, "response4");
+        lease4_decline_lease4_ = HooksManager::getArgument<Lease4Ptr>(
+            hook_index_lease4_decline_, "lease4");
+        lease4_decline_query4_ = HooksManager::getArgument<Pkt4Ptr>(
+            hook_index_lease4_decline_, "query4");
+        host4_identifier_query4_ = HooksManager::getArgument<Pkt4Ptr>(
+            hook_index_host4_identifier_, "query4");
+        host4_identifier_id_type_ = HooksManager::getArgument<Host::IdentifierType>(
+            hook_index_host4_identifier_, "id_type");
+        host4_identifier_id_value_ = HooksManager::getArgument<std::vector<uint8_t>>(
+            hook_index_host4_identifier_, "id_value");
     }
 };
 
@@ -135,6 +231,28 @@ std::set<std::string> dhcp4_statistics = {
     "pkt4-receive-drop"
 };
 
+/// @brief Resolves the options to be added to the response.
+///
+/// The resolved options are cached in the current configuration unless
+/// the host reservation of the client carries options.
+///
+/// @param ex The exchange holding the configured option list.
+/// @param codes Requested option codes.
+/// @param persistent Whether the persistent options are requested as well.
+/// @return The resolved options.
+ResolvedOptionsCache::ResolvedOptionsPtr
+resolveOptions(const Dhcpv4Exchange& ex, const std::vector<uint16_t>& codes,
+               const bool persistent) {
+    const CfgOptionList& co_list = ex.getCfgOptionList();
+    const ConstHostPtr& host = ex.getContext()->currentHost();
+    if (host && !host->getCfgOption4()->empty()) {
+        return (ResolvedOptionsCache::resolve(co_list, DHCP4_OPTION_SPACE,
+                                              codes, persistent));
+    }
+    return (CfgMgr::instance().getCurrentCfg()->getResolvedOptionsCache()->
+            get(co_list, DHCP4_OPTION_SPACE, codes, persistent));
+}
+
 } // end of anonymous namespace
 
 // Declare a Hooks object. As this is outside any function or method, it
@@ -464,16 +582,17 @@ Dhcpv4Exchange::setHostIdentifiers() {
                 ScopedCalloutHandleState callout_handle_state(callout_handle);
 
                 // Pass incoming packet as argument
-                callout_handle->setArgument("query4", context_->query_);
-                callout_handle->setArgument("id_type", type);
-                callout_handle->setArgument("id_value", id);
+                callout_handle->setArgument(Hooks.host4_identifier_query4_,
+                                            context_->query_);
+                callout_handle->setArgument(Hooks.host4_identifier_id_type_, type);
+                callout_handle->setArgument(Hooks.host4_identifier_id_value_, id);
 
                 // Call callouts
                 HooksManager::callCallouts(Hooks.hook_index_host4_identifier_,
                                            *callout_handle);
 
-                callout_handle->getArgument("id_type", type);
-                callout_handle->getArgument("id_value", id);
+                callout_handle->getArgument(Hooks.host4_identifier_id_type_, type);
+                callout_handle->getArgument(Hooks.host4_identifier_id_value_, id);
 
                 if ((callout_handle->getStatus() == CalloutHandle::NEXT_STEP_CONTINUE) &&
                     !id.empty()) {
@@ -720,6 +839,7 @@ Dhcpv4Srv::shutdown() {
 isc::dhcp::Subnet4Ptr
 Dhcpv4Srv::selectSubnet(const Pkt4Ptr& query, bool& drop,
                         bool sanity_only) const {
+    StageLatencyTimer timer(StageLatency::SELECT_SUBNET);
 
     // DHCPv4-over-DHCPv6 is a special (and complex) case
     if (query->isDhcp4o6()) {
@@ -737,6 +857,8 @@ Dhcpv4Srv::selectSubnet(const Pkt4Ptr& query, bool& drop,
     // (skip callouts if the selectSubnet was called to do sanity checks only)
     if (!sanity_only &&
         HooksManager::calloutsPresent(Hooks.hook_index_subnet4_select_)) {
+        StageLatencyTimer hooks_timer(StageLatency::HOOKS);
+
         CalloutHandlePtr callout_handle = getCalloutHandle(query);
 
         // Use the RAII wrapper to make sure that the callout handle state is
@@ -749,9 +871,9 @@ Dhcpv4Srv::selectSubnet(const Pkt4Ptr& query, bool& drop,
         ScopedEnableOptionsCopy<Pkt4> query4_options_copy(query);
 
         // Set new arguments
-        callout_handle->setArgument("query4", query);
-        callout_handle->setArgument("subnet4", subnet);
-        callout_handle->setArgument("subnet4collection",
+        callout_handle->setArgument(Hooks.subnet4_select_query4_, query);
+        callout_handle->setArgument(Hooks.subnet4_select_subnet4_, subnet);
+        callout_handle->setArgument(Hooks.subnet4_select_subnet4collection_,
                                     cfgmgr.getCurrentCfg()->
                                     getCfgSubnets4()->getAll());
 
@@ -780,7 +902,7 @@ Dhcpv4Srv::selectSubnet(const Pkt4Ptr& query, bool& drop,
         }
 
         // Use whatever subnet was specified by the callout
-        callout_handle->getArgument("subnet4", subnet);
+        callout_handle->getArgument(Hooks.subnet4_select_subnet4_, subnet);
     }
 
     if (subnet) {
@@ -862,6 +984,8 @@ Dhcpv4Srv::selectSubnet4o6(const Pkt4Ptr& query, bool& drop,
     // (skip callouts if the selectSubnet was called to do sanity checks only)
     if (!sanity_only &&
         HooksManager::calloutsPresent(Hooks.hook_index_subnet4_select_)) {
+        StageLatencyTimer hooks_timer(StageLatency::HOOKS);
+
         CalloutHandlePtr callout_handle = getCalloutHandle(query);
 
         // Use the RAII wrapper to make sure that the callout handle state is
@@ -871,9 +995,9 @@ Dhcpv4Srv::selectSubnet4o6(const Pkt4Ptr& query, bool& drop,
         ScopedCalloutHandleState callout_handle_state(callout_handle);
 
         // Set new arguments
-        callout_handle->setArgument("query4", query);
-        callout_handle->setArgument("subnet4", subnet);
-        callout_handle->setArgument("subnet4collection",
+        callout_handle->setArgument(Hooks.subnet4_select_query4_, query);
+        callout_handle->setArgument(Hooks.subnet4_select_subnet4_, subnet);
+        callout_handle->setArgument(Hooks.subnet4_select_subnet4collection_,
                                     cfgmgr.getCurrentCfg()->
                                     getCfgSubnets4()->getAll());
 
@@ -902,7 +1026,7 @@ Dhcpv4Srv::selectSubnet4o6(const Pkt4Ptr& query, bool& drop,
         }
 
         // Use whatever subnet was specified by the callout
-        callout_handle->getArgument("subnet4", subnet);
+        callout_handle->getArgument(Hooks.subnet4_select_subnet4_, subnet);
     }
 
     if (subnet) {
@@ -1093,12 +1217,16 @@ Dhcpv4Srv::processPacketAndSendResponseNoThrow(Pkt4Ptr& query) {
 
 void
 Dhcpv4Srv::processPacketAndSendResponse(Pkt4Ptr& query) {
+    // The packet is processed using the configuration which is current
+    // now, even if a new configuration is committed meanwhile.
+    CfgSnapshot snapshot;
     Pkt4Ptr rsp;
 #ifdef ENABLE_DEBUG
     LOG_DEBUG(packet4_logger, isc::log::DBGLVL_TRACE_DETAIL_DATA,
               "[thread %1] processPacketAndSendResponse() started...")
         .arg(std::this_thread::get_id());
 #endif  // ENABLE_DEBUG
+    StageLatencyTimer total_timer(StageLatency::TOTAL);
     auto start(std::chrono::steady_clock::now());
     processPacket(query, rsp);
     auto end(std::chrono::steady_clock::now());
@@ -1142,6 +1270,8 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
     // The packet has just been received so contains the uninterpreted wire
     // data; execute callouts registered for buffer4_receive.
     if (HooksManager::calloutsPresent(Hooks.hook_index_buffer4_receive_)) {
+        StageLatencyTimer hooks_timer(StageLatency::HOOKS);
+
         CalloutHandlePtr callout_handle = getCalloutHandle(query);
 
         // Use the RAII wrapper to make sure that the callout handle state is
@@ -1154,7 +1284,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
         ScopedEnableOptionsCopy<Pkt4> query4_options_copy(query);
 
         // Pass incoming packet as argument
-        callout_handle->setArgument("query4", query);
+        callout_handle->setArgument(Hooks.buffer4_receive_query4_, query);
 
         // Call callouts
         HooksManager::callCallouts(Hooks.hook_index_buffer4_receive_,
@@ -1185,7 +1315,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
             skip_unpack = true;
         }
 
-        callout_handle->getArgument("query4", query);
+        callout_handle->getArgument(Hooks.buffer4_receive_query4_, query);
     }
 
     // Unpack the packet information unless the buffer4_receive callouts
@@ -1257,6 +1387,8 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
 
     // Let's execute all callouts registered for pkt4_receive
     if (HooksManager::calloutsPresent(Hooks.hook_index_pkt4_receive_)) {
+        StageLatencyTimer hooks_timer(StageLatency::HOOKS);
+
         CalloutHandlePtr callout_handle = getCalloutHandle(query);
 
         // Use the RAII wrapper to make sure that the callout handle state is
@@ -1269,7 +1401,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
         ScopedEnableOptionsCopy<Pkt4> query4_options_copy(query);
 
         // Pass incoming packet as argument
-        callout_handle->setArgument("query4", query);
+        callout_handle->setArgument(Hooks.pkt4_receive_query4_, query);
 
         // Call callouts
         HooksManager::callCallouts(Hooks.hook_index_pkt4_receive_,
@@ -1286,7 +1418,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
             return;
         }
 
-        callout_handle->getArgument("query4", query);
+        callout_handle->getArgument(Hooks.pkt4_receive_query4_, query);
     }
 
     // Check the DROP special class.
@@ -1459,6 +1591,8 @@ Dhcpv4Srv::processDhcp4Query(Pkt4Ptr& query, Pkt4Ptr& rsp,
     bool packet_park = false;
 
     if (ctx && HooksManager::calloutsPresent(Hooks.hook_index_leases4_committed_)) {
+        StageLatencyTimer hooks_timer(StageLatency::HOOKS);
+
         CalloutHandlePtr callout_handle = getCalloutHandle(query);
 
         // Use the RAII wrapper to make sure that the callout handle state is
@@ -1470,13 +1604,13 @@ Dhcpv4Srv::processDhcp4Query(Pkt4Ptr& query, Pkt4Ptr& rsp,
         ScopedEnableOptionsCopy<Pkt4> query4_options_copy(query);
 
         // Also pass the corresponding query packet as argument
-        callout_handle->setArgument("query4", query);
+        callout_handle->setArgument(Hooks.leases4_committed_query4_, query);
 
         Lease4CollectionPtr new_leases(new Lease4Collection());
         if (ctx->new_lease_) {
             new_leases->push_back(ctx->new_lease_);
         }
-        callout_handle->setArgument("leases4", new_leases);
+        callout_handle->setArgument(Hooks.leases4_committed_leases4_, new_leases);
 
         Lease4CollectionPtr deleted_leases(new Lease4Collection());
         if (ctx->old_lease_) {
@@ -1484,7 +1618,8 @@ Dhcpv4Srv::processDhcp4Query(Pkt4Ptr& query, Pkt4Ptr& rsp,
                 deleted_leases->push_back(ctx->old_lease_);
             }
         }
-        callout_handle->setArgument("deleted_leases4", deleted_leases);
+        callout_handle->setArgument(Hooks.leases4_committed_deleted_leases4_,
+                                    deleted_leases);
 
         // Call all installed callouts
         HooksManager::callCallouts(Hooks.hook_index_leases4_committed_,
@@ -1563,6 +1698,7 @@ Dhcpv4Srv::processPacketPktSend(hooks::CalloutHandlePtr& callout_handle,
 
     // Execute all callouts registered for pkt4_send
     if (HooksManager::calloutsPresent(Hooks.hook_index_pkt4_send_)) {
+        StageLatencyTimer hooks_timer(StageLatency::HOOKS);
 
         // Use the RAII wrapper to make sure that the callout handle state is
         // reset when this object goes out of scope. All hook points must do
@@ -1575,10 +1711,10 @@ Dhcpv4Srv::processPacketPktSend(hooks::CalloutHandlePtr& callout_handle,
         ScopedEnableOptionsCopy<Pkt4> query_resp_options_copy(query, rsp);
 
         // Set our response
-        callout_handle->setArgument("response4", rsp);
+        callout_handle->setArgument(Hooks.pkt4_send_response4_, rsp);
 
         // Also pass the corresponding query packet as argument
-        callout_handle->setArgument("query4", query);
+        callout_handle->setArgument(Hooks.pkt4_send_query4_, query);
 
         // Call all installed callouts
         HooksManager::callCallouts(Hooks.hook_index_pkt4_send_,
@@ -1654,12 +1790,15 @@ Dhcpv4Srv::processPacketBufferSend(CalloutHandlePtr& callout_handle,
         return;
     }
 
+    StageLatencyTimer timer(StageLatency::SEND);
+
     try {
         // Now all fields and options are constructed into output wire buffer.
         // Option objects modification does not make sense anymore. Hooks
         // can only manipulate wire buffer at this stage.
         // Let's execute all callouts registered for buffer4_send
         if (HooksManager::calloutsPresent(Hooks.hook_index_buffer4_send_)) {
+            StageLatencyTimer hooks_timer(StageLatency::HOOKS);
 
             // Use the RAII wrapper to make sure that the callout handle state is
             // reset when this object goes out of scope. All hook points must do
@@ -1671,7 +1810,7 @@ Dhcpv4Srv::processPacketBufferSend(CalloutHandlePtr& callout_handle,
             ScopedEnableOptionsCopy<Pkt4> resp4_options_copy(rsp);
 
             // Pass incoming packet as argument
-            callout_handle->setArgument("response4", rsp);
+            callout_handle->setArgument(Hooks.buffer4_send_response4_, rsp);
 
             // Call callouts
             HooksManager::callCallouts(Hooks.hook_index_buffer4_send_,
@@ -1688,7 +1827,7 @@ Dhcpv4Srv::processPacketBufferSend(CalloutHandlePtr& callout_handle,
                 return;
             }
 
-            callout_handle->getArgument("response4", rsp);
+            callout_handle->getArgument(Hooks.buffer4_send_response4_, rsp);
         }
 
         LOG_DEBUG(packet4_logger, DBG_DHCP4_BASIC, DHCP4_PACKET_SEND)
@@ -1858,7 +1997,7 @@ Dhcpv4Srv::appendRequestedOptions(Dhcpv4Exchange& ex) {
 
     Pkt4Ptr query = ex.getQuery();
     Pkt4Ptr resp = ex.getResponse();
-    std::vector<uint8_t> requested_opts;
+    std::vector<uint16_t> requested_opts;
 
     // try to get the 'Parameter Request List' option which holds the
     // codes of requested options.
@@ -1866,44 +2005,19 @@ Dhcpv4Srv::appendRequestedOptions(Dhcpv4Exchange& ex) {
         OptionUint8Array>(query->getOption(DHO_DHCP_PARAMETER_REQUEST_LIST));
     // Get the codes of requested options.
     if (option_prl) {
-        requested_opts = option_prl->getValues();
-    }
-    // Iterate on the configured option list to add persistent options
-    for (CfgOptionList::const_iterator copts = co_list.begin();
-         copts != co_list.end(); ++copts) {
-        const OptionContainerPtr& opts = (*copts)->getAll(DHCP4_OPTION_SPACE);
-        if (!opts) {
-            continue;
-        }
-        // Get persistent options
-        const OptionContainerPersistIndex& idx = opts->get<2>();
-        const OptionContainerPersistRange& range = idx.equal_range(true);
-        for (OptionContainerPersistIndex::const_iterator desc = range.first;
-             desc != range.second; ++desc) {
-            // Add the persistent option code to requested options
-            if (desc->option_) {
-                uint8_t code = static_cast<uint8_t>(desc->option_->getType());
-                requested_opts.push_back(code);
-            }
-        }
+        const std::vector<uint8_t>& values = option_prl->getValues();
+        requested_opts.assign(values.begin(), values.end());
     }
 
-    // For each requested option code get the instance of the option
-    // to be returned to the client.
-    for (std::vector<uint8_t>::const_iterator opt = requested_opts.begin();
-         opt != requested_opts.end(); ++opt) {
+    // Get the instances of the requested and persistent options to be
+    // returned to the client. The lookup over the configured option list
+    // is cached for the clients sharing the list and the requested codes.
+    ResolvedOptionsCache::ResolvedOptionsPtr resolved =
+        resolveOptions(ex, requested_opts, true);
+    for (auto const& opt : *resolved) {
         // Add nothing when it is already there
-        if (!resp->getOption(*opt)) {
-            // Iterate on the configured option list
-            for (CfgOptionList::const_iterator copts = co_list.begin();
-                 copts != co_list.end(); ++copts) {
-                OptionDescriptor desc = (*copts)->get(DHCP4_OPTION_SPACE, *opt);
-                // Got it: add it and jump to the outer loop
-                if (desc.option_) {
-                    resp->addOption(desc.option_);
-                    break;
-                }
-            }
+        if (!resp->getOption(opt.first)) {
+            resp->addOption(opt.second);
         }
     }
 }
@@ -2029,15 +2143,12 @@ void
 Dhcpv4Srv::appendBasicOptions(Dhcpv4Exchange& ex) {
     // Identify options that we always want to send to the
     // client (if they are configured).
-    static const uint16_t required_options[] = {
+    static const std::vector<uint16_t> required_options = {
         DHO_ROUTERS,
         DHO_DOMAIN_NAME_SERVERS,
         DHO_DOMAIN_NAME,
         DHO_DHCP_SERVER_IDENTIFIER };
 
-    static size_t required_options_size =
-        sizeof(required_options) / sizeof(required_options[0]);
-
     // Get the subnet.
     Subnet4Ptr subnet = ex.getContext()->subnet_;
     if (!subnet) {
@@ -2053,20 +2164,13 @@ Dhcpv4Srv::appendBasicOptions(Dhcpv4Exchange& ex) {
     Pkt4Ptr resp = ex.getResponse();
 
     // Try to find all 'required' options in the outgoing
-    // message. Those that are not present will be added.
-    for (int i = 0; i < required_options_size; ++i) {
-        OptionPtr opt = resp->getOption(required_options[i]);
-        if (!opt) {
-            // Check whether option has been configured.
-            for (CfgOptionList::const_iterator copts = co_list.begin();
-                 copts != co_list.end(); ++copts) {
-                OptionDescriptor desc = (*copts)->get(DHCP4_OPTION_SPACE,
-                                                      required_options[i]);
-                if (desc.option_) {
-                    resp->addOption(desc.option_);
-                    break;
-                }
-            }
+    // message. Those that are not present and have been configured
+    // will be added.
+    ResolvedOptionsCache::ResolvedOptionsPtr resolved =
+        resolveOptions(ex, required_options, false);
+    for (auto const& opt : *resolved) {
+        if (!resp->getOption(opt.first)) {
+            resp->addOption(opt.second);
         }
     }
 }
@@ -3137,6 +3241,7 @@ Dhcpv4Srv::processDiscover(Pkt4Ptr& discover) {
         // Required classification
         requiredClassify(ex);
 
+        StageLatencyTimer options_timer(StageLatency::BUILD_OPTIONS);
         buildCfgOptionList(ex);
         appendRequestedOptions(ex);
         appendRequestedVendorOptions(ex);
@@ -3144,6 +3249,7 @@ Dhcpv4Srv::processDiscover(Pkt4Ptr& discover) {
         // include in the response. If client did not request
         // them we append them for him.
         appendBasicOptions(ex);
+        options_timer.stop();
 
         // Set fixed fields (siaddr, sname, filename) if defined in
         // the reservation, class or subnet specific configuration.
@@ -3214,6 +3320,7 @@ Dhcpv4Srv::processRequest(Pkt4Ptr& request, AllocEngine::ClientContext4Ptr& cont
         // Required classification
         requiredClassify(ex);
 
+        StageLatencyTimer options_timer(StageLatency::BUILD_OPTIONS);
         buildCfgOptionList(ex);
         appendRequestedOptions(ex);
         appendRequestedVendorOptions(ex);
@@ -3221,6 +3328,7 @@ Dhcpv4Srv::processRequest(Pkt4Ptr& request, AllocEngine::ClientContext4Ptr& cont
         // include in the response. If client did not request
         // them we append them for him.
         appendBasicOptions(ex);
+        options_timer.stop();
 
         // Set fixed fields (siaddr, sname, filename) if defined in
         // the reservation, class or subnet specific configuration.
@@ -3285,6 +3393,8 @@ Dhcpv4Srv::processRelease(Pkt4Ptr& release, AllocEngine::ClientContext4Ptr& cont
 
         // Execute all callouts registered for lease4_release
         if (HooksManager::calloutsPresent(Hooks.hook_index_lease4_release_)) {
+            StageLatencyTimer hooks_timer(StageLatency::HOOKS);
+
             CalloutHandlePtr callout_handle = getCalloutHandle(release);
 
             // Use the RAII wrapper to make sure that the callout handle state is
@@ -3297,10 +3407,10 @@ Dhcpv4Srv::processRelease(Pkt4Ptr& release, AllocEngine::ClientContext4Ptr& cont
             ScopedEnableOptionsCopy<Pkt4> query4_options_copy(release);
 
             // Pass the original packet
-            callout_handle->setArgument("query4", release);
+            callout_handle->setArgument(Hooks.lease4_release_query4_, release);
 
             // Pass the lease to be updated
-            callout_handle->setArgument("lease4", lease);
+            callout_handle->setArgument(Hooks.lease4_release_lease4_, lease);
 
             // Call all installed callouts
             HooksManager::callCallouts(Hooks.hook_index_lease4_release_,
@@ -3441,6 +3551,8 @@ Dhcpv4Srv::declineLease(const Lease4Ptr& lease, const Pkt4Ptr& decline,
     // If they are, let's pass the lease and client's packet. If the hook
     // sets status to drop, we reject this Decline.
     if (HooksManager::calloutsPresent(Hooks.hook_index_lease4_decline_)) {
+        StageLatencyTimer hooks_timer(StageLatency::HOOKS);
+
         CalloutHandlePtr callout_handle = getCalloutHandle(decline);
 
         // Use the RAII wrapper to make sure that the callout handle state is
@@ -3453,8 +3565,8 @@ Dhcpv4Srv::declineLease(const Lease4Ptr& lease, const Pkt4Ptr& decline,
         ScopedEnableOptionsCopy<Pkt4> query4_options_copy(decline);
 
         // Pass incoming Decline and the lease to be declined.
-        callout_handle->setArgument("lease4", lease);
-        callout_handle->setArgument("query4", decline);
+        callout_handle->setArgument(Hooks.lease4_decline_lease4_, lease);
+        callout_handle->setArgument(Hooks.lease4_decline_query4_, decline);
 
         // Call callouts
         HooksManager::callCallouts(Hooks.hook_index_lease4_decline_,
@@ -3542,10 +3654,12 @@ Dhcpv4Srv::processInform(Pkt4Ptr& inform) {
 
     requiredClassify(ex);
 
+    StageLatencyTimer options_timer(StageLatency::BUILD_OPTIONS);
     buildCfgOptionList(ex);
     appendRequestedOptions(ex);
     appendRequestedVendorOptions(ex);
     appendBasicOptions(ex);
+    options_timer.stop();
     adjustIfaceData(ex);
 
     // Set fixed fields (siaddr, sname, filename) if defined in
@@ -3835,10 +3949,13 @@ Dhcpv4Srv::sanityCheck(const Pkt4Ptr& query, RequirementLevel serverid) {
 }
 
 void Dhcpv4Srv::classifyPacket(const Pkt4Ptr& pkt) {
+    StageLatencyTimer timer(StageLatency::CLASSIFY);
     Dhcpv4Exchange::classifyPacket(pkt);
 }
 
 void Dhcpv4Srv::requiredClassify(Dhcpv4Exchange& ex) {
+    StageLatencyTimer timer(StageLatency::CLASSIFY);
+
     // First collect required classes
     Pkt4Ptr query = ex.getQuery();
     ClientClasses classes = query->getClasses(true);
@@ -554,6 +554,7 @@ TEST_F(CtrlChannelDhcpv4SrvTest, commandsRegistration) {
     EXPECT_TRUE(command_list.find("\"statistic-sample-count-set\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-sample-count-set-all\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"status-get\"") != string::npos);
+    EXPECT_TRUE(command_list.find("\"subnet4-delta-apply\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"version-get\"") != string::npos);
 
     // Ok, and now delete the server. It should deregister its commands.
@@ -1058,6 +1059,66 @@ TEST_F(CtrlChannelDhcpv4SrvTest, getVersion) {
     EXPECT_TRUE(response.find("GTEST_VERSION") != string::npos);
 }
 
+// This test verifies that the DHCP server applies subnet changes with
+// the subnet4-delta-apply command.
+TEST_F(CtrlChannelDhcpv4SrvTest, subnetDeltaApply) {
+    createUnixChannelServer();
+
+    // The subnet 1 and the subnet 2 in the shared network "frog".
+    CfgSubnets4Ptr subnets = CfgMgr::instance().getCurrentCfg()->getCfgSubnets4();
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.2.0.0"), 24, 1, 2, 3,
+                                   SubnetID(1)));
+    subnets->add(subnet1);
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.2.1.0"), 24, 1, 2, 3,
+                                   SubnetID(2)));
+    SharedNetwork4Ptr network(new SharedNetwork4("frog"));
+    network->add(subnet2);
+    CfgMgr::instance().getCurrentCfg()->getCfgSharedNetworks4()->add(network);
+    subnets->add(subnet2);
+
+    // Delete the subnet 1, replace the subnet 2 and add the subnet 3 to
+    // the shared network.
+    std::string response;
+    sendUnixCommand("{ \"command\": \"subnet4-delta-apply\", \"arguments\": {"
+                    " \"config-timestamp\": 1234,"
+                    " \"deleted-subnets\": [ 1 ],"
+                    " \"subnet4\": [ { \"id\": 2, \"subnet\": \"192.2.1.0/24\","
+                    " \"pools\": [ { \"pool\": \"192.2.1.10 - 192.2.1.19\" } ] },"
+                    " { \"id\": 3, \"subnet\": \"192.2.2.0/24\","
+                    " \"shared-network-name\": \"frog\" } ] } }", response);
+    EXPECT_EQ("{ \"result\": 0, \"text\": \"Subnet changes applied: 1 added, "
+              "1 replaced, 1 deleted.\" }", response);
+
+    SrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+    EXPECT_EQ(1234, cfg->getServerCfgTimestamp());
+    ConstCfgSubnets4Ptr current = cfg->getCfgSubnets4();
+    EXPECT_FALSE(current->getBySubnetId(1));
+    ConstSubnet4Ptr replaced = current->getBySubnetId(2);
+    ASSERT_TRUE(replaced);
+    EXPECT_EQ(1, replaced->getPools(Lease::TYPE_V4).size());
+    ConstSubnet4Ptr added = current->getBySubnetId(3);
+    ASSERT_TRUE(added);
+    ASSERT_EQ(2, network->getAllSubnets()->size());
+    EXPECT_EQ(replaced, network->getSubnet(2));
+    EXPECT_EQ(added, network->getSubnet(3));
+
+    // An invalid change is rejected and leaves the configuration untouched.
+    sendUnixCommand("{ \"command\": \"subnet4-delta-apply\", \"arguments\": {"
+                    " \"deleted-subnets\": [ 3, 7 ] } }", response);
+    EXPECT_EQ("{ \"result\": 1, \"text\": \"Applying subnet changes failed: "
+              "no subnet with ID of '7' found\" }", response);
+    EXPECT_EQ(current, CfgMgr::instance().getCurrentCfg()->getCfgSubnets4());
+    EXPECT_EQ(2, network->getAllSubnets()->size());
+
+    sendUnixCommand("{ \"command\": \"subnet4-delta-apply\", \"arguments\": {"
+                    " \"subnet4\": [ { \"id\": 4, \"subnet\": \"192.2.3.0/24\","
+                    " \"shared-network-name\": \"toad\" } ] } }", response);
+    EXPECT_TRUE(response.find("\"result\": 1") != string::npos);
+    EXPECT_TRUE(response.find("no shared network with the name of 'toad'")
+                != string::npos);
+    EXPECT_FALSE(CfgMgr::instance().getCurrentCfg()->getCfgSubnets4()->getBySubnetId(4));
+}
+
 // This test verifies that the DHCP server handles server-tag-get command
 TEST_F(CtrlChannelDhcpv4SrvTest, serverTagGet) {
     createUnixChannelServer();
@@ -1310,6 +1371,8 @@ TEST_F(CtrlChannelDhcpv4SrvTest, listCommands) {
     checkListCommands(rsp, "version-get");
     checkListCommands(rsp, "server-tag-get");
     checkListCommands(rsp, "shutdown");
+    checkListCommands(rsp, "stage-latency-get");
+    checkListCommands(rsp, "stage-latency-set");
     checkListCommands(rsp, "statistic-get");
     checkListCommands(rsp, "statistic-get-all");
     checkListCommands(rsp, "statistic-remove");
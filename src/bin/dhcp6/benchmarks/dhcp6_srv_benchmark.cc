@@ -0,0 +1,578 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <cc/command_interpreter.h>
+#include <cc/data.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/option6_ia.h>
+#include <dhcp/option6_iaaddr.h>
+#include <dhcp/option_int_array.h>
+#include <dhcp/pkt6.h>
+#include <dhcp/tests/iface_mgr_test_config.h>
+#include <dhcp6/dhcp6_srv.h>
+#include <dhcp6/json_config_parser.h>
+#include <dhcpsrv/benchmarks/parameters.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <dhcpsrv/stage_latency.h>
+#include <util/latency_histogram.h>
+#include <util/multi_threading_mgr.h>
+#include <util/readwrite_mutex.h>
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::config;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::dhcp::bench;
+using namespace isc::dhcp::test;
+using namespace isc::util;
+using namespace std;
+
+namespace {
+
+/// @brief Number of simulated clients.
+constexpr size_t CLIENT_COUNT = 2048;
+
+/// @brief Code of the first configured option.
+///
+/// The options use the unassigned codes 1000 to 1030.
+constexpr uint16_t FIRST_OPTION_CODE = 1000;
+
+/// @brief Largest number of configured options.
+constexpr size_t MAX_OPTION_COUNT = 31;
+
+/// @brief Local address of the server, an address of the eth0 interface
+/// configured by @c IfaceMgrTestConfig.
+const IOAddress SERVER_ADDRESS("2001:db8:1::1");
+
+/// @brief Returns the prefix of a subnet.
+///
+/// The subnets are /64 subnets in 3000::/48, so there may be up to 65536
+/// of them.
+///
+/// @param index Index of the subnet.
+string
+getSubnetPrefix(const size_t index) {
+    ostringstream prefix;
+    prefix << "3000:0:0:" << hex << index << ":";
+    return (prefix.str());
+}
+
+/// @brief Latencies of the processing stages, in nanoseconds.
+struct StageLatencies {
+    /// @brief Classification, including the options unpacked for it.
+    LatencyHistogram classify_;
+
+    /// @brief Subnet selection.
+    LatencyHistogram select_subnet_;
+
+    /// @brief Host reservation lookup and lease allocation.
+    LatencyHistogram allocate_;
+
+    /// @brief Required classification and building of the options.
+    LatencyHistogram build_options_;
+
+    /// @brief Whole processing of a query.
+    LatencyHistogram total_;
+
+    /// @brief Adds the latencies of another thread.
+    ///
+    /// @param other Latencies to add.
+    void merge(const StageLatencies& other) {
+        classify_.merge(other.classify_);
+        select_subnet_.merge(other.select_subnet_);
+        allocate_.merge(other.allocate_);
+        build_options_.merge(other.build_options_);
+        total_.merge(other.total_);
+    }
+
+    /// @brief Removes all latencies.
+    void clear() {
+        classify_.clear();
+        select_subnet_.clear();
+        allocate_.clear();
+        build_options_.clear();
+        total_.clear();
+    }
+};
+
+/// @brief Reports the percentiles of a histogram as benchmark counters.
+///
+/// @param state Benchmark state.
+/// @param name Prefix of the counter names.
+/// @param histogram Latencies.
+void
+addLatencyCounters(benchmark::State& state, const string& name,
+                   const LatencyHistogram& histogram) {
+    if (histogram.getCount() == 0) {
+        return;
+    }
+    state.counters[name + "_p50"] = histogram.getPercentile(50.);
+    state.counters[name + "_p99"] = histogram.getPercentile(99.);
+    state.counters[name + "_p999"] = histogram.getPercentile(99.9);
+}
+
+/// @brief Returns the time elapsed since a time point and moves the time
+/// point to now.
+///
+/// @param start Time point.
+chrono::nanoseconds
+lap(chrono::steady_clock::time_point& start) {
+    const chrono::steady_clock::time_point now = chrono::steady_clock::now();
+    const chrono::nanoseconds elapsed = now - start;
+    start = now;
+    return (elapsed);
+}
+
+/// @brief Server giving access to the processing stages.
+class BenchDhcpv6Srv : public Dhcpv6Srv {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Doesn't open sockets.
+    BenchDhcpv6Srv() : Dhcpv6Srv(0, 0) {
+    }
+
+    /// @brief Processes a Solicit or a Renew stage by stage.
+    ///
+    /// The stages are those of @c processSolicit and @c processRenew,
+    /// timed one by one. The allocation stage includes the setup of the
+    /// client context, which looks for the host reservations after
+    /// selecting the subnet again. The callouts, the acceptance checks and
+    /// the client race avoidance are left out.
+    ///
+    /// @param query Query in wire format.
+    /// @param latencies Latencies of the stages.
+    /// @return The response or null if the query is dropped.
+    Pkt6Ptr processStages(Pkt6Ptr& query, StageLatencies& latencies) {
+        query->unpack();
+
+        chrono::steady_clock::time_point start = chrono::steady_clock::now();
+        classifyPacket(query);
+        latencies.classify_.record(lap(start));
+
+        bool drop = false;
+        selectSubnet(query, drop);
+        latencies.select_subnet_.record(lap(start));
+        if (drop) {
+            return (Pkt6Ptr());
+        }
+
+        AllocEngine::ClientContext6 ctx;
+        initContext(query, ctx, drop);
+        if (drop) {
+            return (Pkt6Ptr());
+        }
+        const bool solicit = (query->getType() == DHCPV6_SOLICIT);
+        Pkt6Ptr response(new Pkt6(solicit ? DHCPV6_ADVERTISE : DHCPV6_REPLY,
+                                  query->getTransid()));
+        ctx.fake_allocation_ = solicit;
+        processClientFqdn(query, response, ctx);
+        if (MultiThreadingMgr::instance().getMode()) {
+            ReadLockGuard share(alloc_engine_->getReadWriteMutex());
+            if (solicit) {
+                assignLeases(query, response, ctx);
+            } else {
+                extendLeases(query, response, ctx);
+            }
+        } else if (solicit) {
+            assignLeases(query, response, ctx);
+        } else {
+            extendLeases(query, response, ctx);
+        }
+        latencies.allocate_.record(lap(start));
+
+        conditionallySetReservedClientClasses(query, ctx);
+        requiredClassify(query, ctx);
+        copyClientOptions(query, response);
+        CfgOptionList co_list;
+        buildCfgOptionList(query, ctx, co_list);
+        appendDefaultOptions(query, response, co_list);
+        appendRequestedOptions(query, response, ctx, co_list);
+        appendRequestedVendorOptions(query, response, ctx, co_list);
+        latencies.build_options_.record(lap(start));
+
+        return (response);
+    }
+};
+
+/// @brief Fixture driving the DHCPv6 server with synthetic traffic.
+///
+/// The server runs in-process on fake interfaces with the memfile backend
+/// in memory only, so nothing but the packet processing is measured. The
+/// arguments of a benchmark are the numbers of subnets, client classes and
+/// options in the configuration. Every client is behind a relay in one of
+/// the subnets, requests an address and all options, and has got a lease
+/// before the measurements. The clients are shared between the benchmark
+/// threads, the server running in multi-threading mode when there are more
+/// than one.
+///
+/// Every iteration processes one query. Besides the time per query, the
+/// 50th, 99th and 99.9th percentiles of the latencies are reported in
+/// nanoseconds, for the whole processing ("total") and for each stage
+/// when the stages are timed. The benchmarks named *Timed run with the
+/// stage latency timing of the server enabled, to compare with the ones
+/// run with it disabled.
+class Dhcpv6SrvBenchmark : public ::benchmark::Fixture {
+public:
+
+    /// @brief Configures the server and gives a lease to every client.
+    void SetUp(::benchmark::State const& state) override {
+        if (state.thread_index() != 0) {
+            return;
+        }
+        iface_mgr_test_config_.reset(new IfaceMgrTestConfig(true));
+        srv_.reset(new BenchDhcpv6Srv());
+        const size_t subnet_count = state.range(0);
+        configure(subnet_count, state.range(1), state.range(2));
+        MultiThreadingMgr::instance().setMode(state.threads() > 1);
+
+        solicits_.clear();
+        renews_.clear();
+        relays_.clear();
+        for (size_t i = 0; i < CLIENT_COUNT; ++i) {
+            relays_.push_back(IOAddress(getSubnetPrefix(i % subnet_count) + ":1"));
+            solicits_.push_back(createQuery(DHCPV6_SOLICIT, i, IOAddress::IPV6_ZERO_ADDRESS()));
+
+            Pkt6Ptr advertise;
+            Pkt6Ptr query = receive(solicits_.back(), relays_.back());
+            srv_->processPacket(query, advertise);
+            const IOAddress address(getAddress(advertise));
+
+            Pkt6Ptr reply;
+            query = receive(createQuery(DHCPV6_REQUEST, i, address), relays_.back());
+            srv_->processPacket(query, reply);
+            renews_.push_back(createQuery(DHCPV6_RENEW, i, address));
+        }
+
+        latencies_.clear();
+        reported_ = 0;
+        StageLatency::reset();
+    }
+
+    void SetUp(::benchmark::State& s) override {
+        ::benchmark::State const& cs = s;
+        SetUp(cs);
+    }
+
+    /// @brief Drops the server and its configuration.
+    void TearDown(::benchmark::State const& state) override {
+        if (state.thread_index() != 0) {
+            return;
+        }
+        MultiThreadingMgr::instance().setMode(false);
+        srv_.reset();
+        LeaseMgrFactory::destroy();
+        CfgMgr::instance().clear();
+        iface_mgr_test_config_.reset();
+    }
+
+    void TearDown(::benchmark::State& s) override {
+        ::benchmark::State const& cs = s;
+        TearDown(cs);
+    }
+
+    /// @brief Configures the server.
+    ///
+    /// @param subnet_count Number of subnets.
+    /// @param class_count Number of client classes, each matching the
+    /// clients with a given last byte of the DUID.
+    /// @param option_count Number of options, requested by all clients.
+    void configure(const size_t subnet_count, const size_t class_count,
+                   const size_t option_count) {
+        ostringstream config;
+        config << "{ \"interfaces-config\": { \"interfaces\": [ ], \"re-detect\": false },"
+               << "\"lease-database\": { \"type\": \"memfile\", \"persist\": false },"
+               << "\"preferred-lifetime\": 3000, \"valid-lifetime\": 4000,";
+
+        config << "\"option-def\": [";
+        for (size_t i = 0; i < option_count; ++i) {
+            config << (i ? "," : "") << "{ \"name\": \"bench-" << i << "\","
+                   << "\"code\": " << FIRST_OPTION_CODE + i << ","
+                   << "\"type\": \"uint32\" }";
+        }
+        config << "], \"option-data\": [";
+        for (size_t i = 0; i < option_count; ++i) {
+            config << (i ? "," : "") << "{ \"name\": \"bench-" << i << "\","
+                   << "\"data\": \"" << i << "\" }";
+        }
+
+        // Each class overrides one of the options.
+        config << "], \"client-classes\": [";
+        for (size_t i = 0; i < class_count; ++i) {
+            config << (i ? "," : "") << "{ \"name\": \"bench-" << i << "\","
+                   << "\"test\": \"substring(option[1].hex,-1,1) == 0x"
+                   << hex << setw(2) << setfill('0') << (i % 256) << dec << "\"";
+            if (option_count) {
+                config << ", \"option-data\": [ { \"name\": \"bench-"
+                       << i % option_count << "\", \"data\": \"" << 1000 + i << "\" } ]";
+            }
+            config << "}";
+        }
+
+        config << "], \"subnet6\": [";
+        for (size_t i = 0; i < subnet_count; ++i) {
+            const string prefix = getSubnetPrefix(i);
+            config << (i ? "," : "") << "{ \"id\": " << i + 1 << ","
+                   << "\"subnet\": \"" << prefix << ":/64\","
+                   << "\"pools\": [ { \"pool\": \"" << prefix << "1::/80\" } ] }";
+        }
+        config << "] }";
+
+        ElementPtr status = configureDhcp6Server(*srv_, Element::fromJSON(config.str()));
+        int rcode;
+        ElementPtr comment = parseAnswer(rcode, status);
+        if (rcode != 0) {
+            isc_throw(Unexpected, "configuration failed: " << comment->str());
+        }
+        CfgDbAccessPtr cfg_db = CfgMgr::instance().getStagingCfg()->getCfgDbAccess();
+        cfg_db->setAppendedParameters("universe=6");
+        cfg_db->createManagers();
+        CfgMgr::instance().commit();
+    }
+
+    /// @brief Creates a query in wire format.
+    ///
+    /// @param type Message type.
+    /// @param client Index of the client.
+    /// @param address Leased address, included with the server identifier
+    /// unless it is zero.
+    /// @return The packed query, relayed once.
+    vector<uint8_t> createQuery(const uint8_t type, const size_t client,
+                                const IOAddress& address) {
+        // DUID-LL of the client.
+        const vector<uint8_t> duid = { 0x00, 0x03, 0x00, 0x01, 0x00, 0x0c, 0x01,
+                                       static_cast<uint8_t>(client >> 16),
+                                       static_cast<uint8_t>(client >> 8),
+                                       static_cast<uint8_t>(client) };
+        Pkt6Ptr pkt(new Pkt6(type, 1000 + client));
+        pkt->addOption(OptionPtr(new Option(Option::V6, D6O_CLIENTID, duid)));
+
+        Option6IAPtr ia(new Option6IA(D6O_IA_NA, 1));
+        OptionUint16ArrayPtr oro(new OptionUint16Array(Option::V6, D6O_ORO));
+        for (size_t i = 0; i < MAX_OPTION_COUNT; ++i) {
+            oro->addValue(FIRST_OPTION_CODE + i);
+        }
+        pkt->addOption(oro);
+        if (!address.isV6Zero()) {
+            ia->addOption(OptionPtr(new Option6IAAddr(D6O_IAADDR, address, 3000, 4000)));
+            pkt->addOption(srv_->getServerID());
+        }
+        pkt->addOption(ia);
+
+        Pkt6::RelayInfo relay;
+        relay.msg_type_ = DHCPV6_RELAY_FORW;
+        relay.hop_count_ = 0;
+        relay.linkaddr_ = relays_[client];
+        relay.peeraddr_ = IOAddress("fe80::1");
+        pkt->addRelayInfo(relay);
+        pkt->pack();
+
+        const OutputBuffer& buffer = pkt->getBuffer();
+        const uint8_t* data = static_cast<const uint8_t*>(buffer.getData());
+        return (vector<uint8_t>(data, data + buffer.getLength()));
+    }
+
+    /// @brief Returns the address leased in a response.
+    ///
+    /// @param response Response, may be null.
+    /// @return The address, zero if there is none.
+    static IOAddress getAddress(const Pkt6Ptr& response) {
+        if (response) {
+            Option6IAPtr ia = dynamic_pointer_cast<Option6IA>(response->getOption(D6O_IA_NA));
+            if (ia) {
+                Option6IAAddrPtr iaaddr =
+                    dynamic_pointer_cast<Option6IAAddr>(ia->getOption(D6O_IAADDR));
+                if (iaaddr) {
+                    return (iaaddr->getAddress());
+                }
+            }
+        }
+        return (IOAddress::IPV6_ZERO_ADDRESS());
+    }
+
+    /// @brief Returns a query as received from the relay.
+    ///
+    /// @param wire Query in wire format.
+    /// @param relay Address of the relay.
+    Pkt6Ptr receive(const vector<uint8_t>& wire, const IOAddress& relay) {
+        Pkt6Ptr query(new Pkt6(&wire[0], wire.size()));
+        query->setRemoteAddr(relay);
+        query->setRemotePort(DHCP6_SERVER_PORT);
+        query->setLocalAddr(SERVER_ADDRESS);
+        query->setLocalPort(DHCP6_SERVER_PORT);
+        query->setIface("eth0");
+        query->setIndex(ETH0_INDEX);
+        return (query);
+    }
+
+    /// @brief Processes queries until the benchmark stops.
+    ///
+    /// Each thread takes every n-th client, n being the number of threads,
+    /// so a client has never two queries in progress.
+    ///
+    /// @param state Benchmark state.
+    /// @param queries Queries of the clients.
+    /// @param stages Whether to time the processing stages.
+    void benchProcess(benchmark::State& state, const vector<vector<uint8_t>>& queries,
+                      const bool stages) {
+        StageLatencies latencies;
+        size_t client = state.thread_index();
+        while (state.KeepRunning()) {
+            Pkt6Ptr query = receive(queries[client], relays_[client]);
+            Pkt6Ptr response;
+            chrono::steady_clock::time_point start = chrono::steady_clock::now();
+            if (stages) {
+                response = srv_->processStages(query, latencies);
+            } else {
+                srv_->processPacket(query, response);
+            }
+            latencies.total_.record(chrono::steady_clock::now() - start);
+            if (!response) {
+                state.SkipWithError("no response");
+                break;
+            }
+            client += state.threads();
+            if (client >= queries.size()) {
+                client = state.thread_index();
+            }
+        }
+        report(state, latencies);
+    }
+
+    /// @brief Adds the latencies of a thread and reports them once all
+    /// threads have.
+    ///
+    /// The counters of the threads are summed, so only the last thread
+    /// sets them.
+    ///
+    /// @param state Benchmark state of the thread.
+    /// @param latencies Latencies of the thread.
+    void report(benchmark::State& state, const StageLatencies& latencies) {
+        lock_guard<mutex> lk(latencies_mutex_);
+        latencies_.merge(latencies);
+        if (++reported_ < static_cast<size_t>(state.threads())) {
+            return;
+        }
+        addLatencyCounters(state, "classify", latencies_.classify_);
+        addLatencyCounters(state, "select_subnet", latencies_.select_subnet_);
+        addLatencyCounters(state, "allocate", latencies_.allocate_);
+        addLatencyCounters(state, "build_options", latencies_.build_options_);
+        addLatencyCounters(state, "total", latencies_.total_);
+    }
+
+    /// @brief Fake interfaces and packet filter.
+    unique_ptr<IfaceMgrTestConfig> iface_mgr_test_config_;
+
+    /// @brief The server.
+    unique_ptr<BenchDhcpv6Srv> srv_;
+
+    /// @brief Solicit of every client.
+    vector<vector<uint8_t>> solicits_;
+
+    /// @brief Renew of every client, for the leased address.
+    vector<vector<uint8_t>> renews_;
+
+    /// @brief Relay link address of every client.
+    vector<IOAddress> relays_;
+
+    /// @brief Protects the latencies merged from the threads.
+    mutex latencies_mutex_;
+
+    /// @brief Latencies merged from the threads.
+    StageLatencies latencies_;
+
+    /// @brief Number of threads which have merged their latencies.
+    size_t reported_ = 0;
+};
+
+/// @brief Sets the configurations and thread counts of a benchmark.
+///
+/// @param bench Benchmark.
+void
+setArguments(benchmark::internal::Benchmark* bench) {
+    // Subnets, classes and options.
+    bench->Args({ 1, 0, 0 });
+    bench->Args({ 64, 16, 8 });
+    bench->Args({ 1024, 64, MAX_OPTION_COUNT });
+    bench->ArgNames({ "subnets", "classes", "options" });
+    bench->ThreadRange(1, 8);
+    bench->UseRealTime();
+    bench->Unit(UNIT);
+}
+
+BENCHMARK_DEFINE_F(Dhcpv6SrvBenchmark, solicit)(benchmark::State& state) {
+    benchProcess(state, solicits_, false);
+}
+
+BENCHMARK_DEFINE_F(Dhcpv6SrvBenchmark, solicitStages)(benchmark::State& state) {
+    benchProcess(state, solicits_, true);
+}
+
+BENCHMARK_DEFINE_F(Dhcpv6SrvBenchmark, renew)(benchmark::State& state) {
+    benchProcess(state, renews_, false);
+}
+
+BENCHMARK_DEFINE_F(Dhcpv6SrvBenchmark, renewStages)(benchmark::State& state) {
+    benchProcess(state, renews_, true);
+}
+
+BENCHMARK_DEFINE_F(Dhcpv6SrvBenchmark, solicitTimed)(benchmark::State& state) {
+    StageLatency::setEnabled(true);
+    benchProcess(state, solicits_, false);
+    StageLatency::setEnabled(false);
+}
+
+BENCHMARK_DEFINE_F(Dhcpv6SrvBenchmark, renewTimed)(benchmark::State& state) {
+    StageLatency::setEnabled(true);
+    benchProcess(state, renews_, false);
+    StageLatency::setEnabled(false);
+}
+
+/// The Solicit processing.
+BENCHMARK_REGISTER_F(Dhcpv6SrvBenchmark, solicit)->Apply(setArguments);
+
+/// The Solicit processing, stage by stage.
+BENCHMARK_REGISTER_F(Dhcpv6SrvBenchmark, solicitStages)->Apply(setArguments);
+
+/// The Renew processing.
+BENCHMARK_REGISTER_F(Dhcpv6SrvBenchmark, renew)->Apply(setArguments);
+
+/// The Renew processing, stage by stage.
+BENCHMARK_REGISTER_F(Dhcpv6SrvBenchmark, renewStages)->Apply(setArguments);
+
+/// The Solicit processing with the stage latency timing enabled.
+BENCHMARK_REGISTER_F(Dhcpv6SrvBenchmark, solicitTimed)->Apply(setArguments);
+
+/// The Renew processing with the stage latency timing enabled.
+BENCHMARK_REGISTER_F(Dhcpv6SrvBenchmark, renewTimed)->Apply(setArguments);
+
+}  // namespace
@@ -22,7 +22,10 @@
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/configuration_reader.h>
 #include <dhcpsrv/db_type.h>
+#include <dhcpsrv/stage_latency.h>
 #include <dhcpsrv/lease_mgr_factory.h>
+#include <dhcpsrv/notifications_manager.h>
+#include <dhcpsrv/subnet_delta.h>
 #include <dhcpsrv/subnet_mgr.h>
 #include <dhcpsrv/subnet_mgr_factory.h>
 #include <hooks/hooks.h>
@@ -393,9 +396,11 @@ ControlledDhcpv6Srv::commandConfigSetHandler(const string&,
         return (result);
     }
 
-    // stop thread pool (if running)
-    MultiThreadingCriticalSection cs;
-
+    // The configuration is parsed and committed while the packets are
+    // processed: the new configuration is published atomically and each
+    // packet uses the configuration it has pinned. The packet processing
+    // is only stopped while the process wide state it uses is replaced,
+    // see processConfig and configureDhcp6Server.
     ++CfgMgr::instance().config_set_command_received_count_;
 
     // Don't reconfigure control-socket & notifications in order to maintain communications.
@@ -408,8 +413,12 @@ ControlledDhcpv6Srv::commandConfigSetHandler(const string&,
 
     // disable multi-threading (it will be applied by new configuration)
     // this must be done in order to properly handle MT to ST transition
-    // when 'multi-threading' structure is missing from new config
-    MultiThreadingMgr::instance().apply(false, 0, 0);
+    // when 'multi-threading' structure is missing from new config. The
+    // thread pool is kept when the multi-threading parameters are the
+    // same, which is the case for most updates sent by kea-netconf.
+    if (!CfgMultiThreading::isApplied(dhcp6->get("multi-threading"))) {
+        MultiThreadingMgr::instance().apply(false, 0, 0);
+    }
 
     // We are starting the configuration process so we should remove any
     // staging configuration that has been created during previous
@@ -768,6 +777,51 @@ ControlledDhcpv6Srv::commandConfigBackendPullHandler(const std::string&,
                          "On demand configuration update successful."));
 }
 
+ElementPtr
+ControlledDhcpv6Srv::commandSubnetDeltaApplyHandler(const string&,
+                                                    ElementPtr args) {
+    SubnetDelta<DHCP_SPACE_V6> delta;
+    try {
+        ElementPtr timestamp;
+        if (args && (args->getType() == Element::map)) {
+            timestamp = args->get("config-timestamp");
+            if (timestamp && (timestamp->getType() != Element::integer)) {
+                isc_throw(BadValue, "'config-timestamp' must be an integer");
+            }
+        }
+
+        // The changes are parsed and validated while the packets are
+        // processed.
+        SrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+        delta.parse(cfg, args);
+
+        // stop thread pool (if running)
+        MultiThreadingCriticalSection cs;
+
+        delta.apply(cfg);
+        if (timestamp) {
+            cfg->setServerCfgTimestamp(timestamp->intValue());
+        }
+    } catch (const std::exception& ex) {
+        LOG_ERROR(dhcp6_logger, DHCP6_SUBNET_DELTA_APPLY_FAIL)
+            .arg(ex.what());
+        return (createAnswer(CONTROL_RESULT_ERROR,
+                             "Applying subnet changes failed: " +
+                             string(ex.what())));
+    }
+
+    LOG_INFO(dhcp6_logger, DHCP6_SUBNET_DELTA_APPLIED)
+        .arg(delta.getAddedCount())
+        .arg(delta.getReplacedCount())
+        .arg(delta.getDeletedCount());
+
+    ostringstream msg;
+    msg << "Subnet changes applied: " << delta.getAddedCount() << " added, "
+        << delta.getReplacedCount() << " replaced, "
+        << delta.getDeletedCount() << " deleted.";
+    return (createAnswer(CONTROL_RESULT_SUCCESS, msg.str()));
+}
+
 ElementPtr
 ControlledDhcpv6Srv::commandStatusGetHandler(const string&,
                                              ElementPtr /*args*/) {
@@ -896,6 +950,15 @@ ControlledDhcpv6Srv::processCommand(const string& command,
 
         } else if (command == "status-get") {
             return (srv->commandStatusGetHandler(command, args));
+
+        } else if (command == "stage-latency-get") {
+            return (StageLatency::commandStageLatencyGetHandler(command, args));
+
+        } else if (command == "stage-latency-set") {
+            return (StageLatency::commandStageLatencySetHandler(command, args));
+
+        } else if (command == "subnet6-delta-apply") {
+            return (srv->commandSubnetDeltaApplyHandler(command, args));
         }
         return isc::config::createAnswer(CONTROL_RESULT_ERROR, "Unrecognized command: " + command);
     } catch (const Exception& ex) {
@@ -947,81 +1010,104 @@ ControlledDhcpv6Srv::processConfig(ElementPtr config) {
         return (isc::config::createAnswer(CONTROL_RESULT_ERROR, err.str()));
     }
 
-    // Re-open lease and host database with new parameters.
-    try {
-        DatabaseConnection::db_lost_callback =
-            std::bind(&ControlledDhcpv6Srv::dbLostCallback, srv, ph::_1);
-        CfgDbAccessPtr cfg_db = CfgMgr::instance().getStagingCfg()->getCfgDbAccess();
-        cfg_db->setAppendedParameters("universe=6");
-        cfg_db->createManagers();
-    } catch (const std::exception& ex) {
-        err << "Unable to open database: " << ex.what();
-        return (isc::config::createAnswer(CONTROL_RESULT_ERROR, err.str()));
-    }
+    {
+        // The packet processing threads use the lease and host managers,
+        // the server identifier, the D2 client and the sockets, so they are
+        // stopped while these are replaced.
+        MultiThreadingCriticalSection cs;
+
+        // Re-open lease and host database with new parameters.
+        try {
+            DatabaseConnection::db_lost_callback =
+                std::bind(&ControlledDhcpv6Srv::dbLostCallback, srv, ph::_1);
+            CfgDbAccessPtr cfg_db = CfgMgr::instance().getStagingCfg()->getCfgDbAccess();
+            cfg_db->setAppendedParameters("universe=6");
+            cfg_db->createManagers();
+        } catch (const std::exception& ex) {
+            err << "Unable to open database: " << ex.what();
+            return (isc::config::createAnswer(CONTROL_RESULT_ERROR, err.str()));
+        }
 
-    // Regenerate server identifier if needed.
-    try {
-        const std::string duid_file =
-            std::string(CfgMgr::instance().getDataDir()) + "/" +
-            std::string(SERVER_DUID_FILE);
-        DuidPtr duid = CfgMgr::instance().getStagingCfg()->getCfgDUID()->create(duid_file);
-        server_->serverid_.reset(new Option(Option::V6, D6O_SERVERID, duid->getDuid()));
-        if (duid) {
-            LOG_INFO(dhcp6_logger, DHCP6_USING_SERVERID)
-                .arg(duid->toText())
-                .arg(duid_file);
+        // Regenerate server identifier if needed.
+        try {
+            const std::string duid_file =
+                std::string(CfgMgr::instance().getDataDir()) + "/" +
+                std::string(SERVER_DUID_FILE);
+            DuidPtr duid = CfgMgr::instance().getStagingCfg()->getCfgDUID()->create(duid_file);
+            server_->serverid_.reset(new Option(Option::V6, D6O_SERVERID, duid->getDuid()));
+            if (duid) {
+                LOG_INFO(dhcp6_logger, DHCP6_USING_SERVERID)
+                    .arg(duid->toText())
+                    .arg(duid_file);
+            }
+
+        } catch (const std::exception& ex) {
+            std::ostringstream err;
+            err << "unable to configure server identifier: " << ex.what();
+            return (isc::config::createAnswer(CONTROL_RESULT_ERROR, err.str()));
         }
 
-    } catch (const std::exception& ex) {
-        std::ostringstream err;
-        err << "unable to configure server identifier: " << ex.what();
-        return (isc::config::createAnswer(CONTROL_RESULT_ERROR, err.str()));
-    }
+        // Server will start DDNS communications if its enabled.
+        try {
+            srv->startD2();
+        } catch (const std::exception& ex) {
+            err << "Error starting DHCP_DDNS client after server reconfiguration: "
+                << ex.what();
+            return (isc::config::createAnswer(CONTROL_RESULT_ERROR, err.str()));
+        }
 
-    // Server will start DDNS communications if its enabled.
-    try {
-        srv->startD2();
-    } catch (const std::exception& ex) {
-        err << "Error starting DHCP_DDNS client after server reconfiguration: "
-            << ex.what();
-        return (isc::config::createAnswer(CONTROL_RESULT_ERROR, err.str()));
-    }
+        // Setup DHCPv4-over-DHCPv6 IPC
+        try {
+            Dhcp6to4Ipc::instance().open();
+        } catch (const std::exception& ex) {
+            std::ostringstream err;
+            err << "error starting DHCPv4-over-DHCPv6 IPC "
+                   " after server reconfiguration: " << ex.what();
+            return (isc::config::createAnswer(CONTROL_RESULT_ERROR, err.str()));
+        }
 
-    // Setup DHCPv4-over-DHCPv6 IPC
-    try {
-        Dhcp6to4Ipc::instance().open();
-    } catch (const std::exception& ex) {
-        std::ostringstream err;
-        err << "error starting DHCPv4-over-DHCPv6 IPC "
-               " after server reconfiguration: " << ex.what();
-        return (isc::config::createAnswer(CONTROL_RESULT_ERROR, err.str()));
-    }
+        // The sockets are still open if the interfaces configuration has not
+        // changed. The packet queue can't be reconfigured while the sockets
+        // are receiving, so they are reopened if the queue controls changed.
+        data::ElementPtr qc = CfgMgr::instance().getStagingCfg()->getDHCPQueueControl();
+        bool reuse_sockets = IfaceMgr::instance().hasOpenSocket(AF_INET6);
+        if (reuse_sockets) {
+            data::ElementPtr current_qc =
+                CfgMgr::instance().getCurrentCfg()->getDHCPQueueControl();
+            if (!qc || !current_qc || !isEquivalent(qc, current_qc)) {
+                IfaceMgr::instance().closeSockets();
+                reuse_sockets = false;
+            }
+        }
 
-    // Configure DHCP packet queueing
-    try {
-        data::ElementPtr qc;
-        qc  = CfgMgr::instance().getStagingCfg()->getDHCPQueueControl();
-        if (IfaceMgr::instance().configureDHCPPacketQueue(AF_INET6, qc)) {
-            LOG_INFO(dhcp6_logger, DHCP6_CONFIG_PACKET_QUEUE)
-                     .arg(IfaceMgr::instance().getPacketQueue6()->getInfoStr());
+        // Configure DHCP packet queueing
+        if (!reuse_sockets) {
+            try {
+                if (IfaceMgr::instance().configureDHCPPacketQueue(AF_INET6, qc)) {
+                    LOG_INFO(dhcp6_logger, DHCP6_CONFIG_PACKET_QUEUE)
+                             .arg(IfaceMgr::instance().getPacketQueue6()->getInfoStr());
+                }
+
+            } catch (const std::exception& ex) {
+                err << "Error setting packet queue controls after server reconfiguration: "
+                    << ex.what();
+                return (isc::config::createAnswer(1, err.str()));
+            }
         }
 
-    } catch (const std::exception& ex) {
-        err << "Error setting packet queue controls after server reconfiguration: "
-            << ex.what();
-        return (isc::config::createAnswer(1, err.str()));
+        // Configuration may change active interfaces. Therefore, we have to reopen
+        // sockets according to new configuration. It is possible that this
+        // operation will fail for some interfaces but the openSockets function
+        // guards against exceptions and invokes a callback function to
+        // log warnings. Since we allow that this fails for some interfaces there
+        // is no need to rollback configuration if socket fails to open on any
+        // of the interfaces.
+        if (!reuse_sockets) {
+            CfgMgr::instance().getStagingCfg()->getCfgIface()->
+                openSockets(AF_INET6, srv->getServerPort());
+        }
     }
 
-    // Configuration may change active interfaces. Therefore, we have to reopen
-    // sockets according to new configuration. It is possible that this
-    // operation will fail for some interfaces but the openSockets function
-    // guards against exceptions and invokes a callback function to
-    // log warnings. Since we allow that this fails for some interfaces there
-    // is no need to rollback configuration if socket fails to open on any
-    // of the interfaces.
-    CfgMgr::instance().getStagingCfg()->getCfgIface()->
-        openSockets(AF_INET6, srv->getServerPort());
-
     // Install the timers for handling leases reclamation.
     try {
         CfgMgr::instance().getStagingCfg()->getCfgExpiration()->
@@ -1064,38 +1150,46 @@ ControlledDhcpv6Srv::processConfig(ElementPtr config) {
         }
     }
 
-    // Finally, we can commit runtime option definitions in libdhcp++. This is
-    // exception free.
-    LibDHCP::commitRuntimeOptionDefs();
-
-    // This hook point notifies hooks libraries that the configuration of the
-    // DHCPv6 server has completed. It provides the hook library with the pointer
-    // to the common IO service object, new server configuration in the JSON
-    // format and with the pointer to the configuration storage where the
-    // parsed configuration is stored.
-    if (HooksManager::calloutsPresent(Hooks.hooks_index_dhcp6_srv_configured_)) {
-        CalloutHandlePtr callout_handle = HooksManager::createCalloutHandle();
-
-        callout_handle->setArgument("io_context", srv->getIOService());
-        callout_handle->setArgument("network_state", srv->getNetworkState());
-        callout_handle->setArgument("json_config", config);
-        callout_handle->setArgument("server_config", CfgMgr::instance().getStagingCfg());
-
-        HooksManager::callCallouts(Hooks.hooks_index_dhcp6_srv_configured_,
-                                   *callout_handle);
-
-        // Ignore status code as none of them would have an effect on further
-        // operation.
+    {
+        // The hooks libraries are notified of the new configuration while
+        // the packet processing threads are stopped. The runtime option
+        // definitions are committed with the configuration by the
+        // CfgMgr::commit() function.
+        MultiThreadingCriticalSection cs;
+
+        // This hook point notifies hooks libraries that the configuration of the
+        // DHCPv6 server has completed. It provides the hook library with the pointer
+        // to the common IO service object, new server configuration in the JSON
+        // format and with the pointer to the configuration storage where the
+        // parsed configuration is stored.
+        if (HooksManager::calloutsPresent(Hooks.hooks_index_dhcp6_srv_configured_)) {
+            CalloutHandlePtr callout_handle = HooksManager::createCalloutHandle();
+
+            callout_handle->setArgument("io_context", srv->getIOService());
+            callout_handle->setArgument("network_state", srv->getNetworkState());
+            callout_handle->setArgument("json_config", config);
+            callout_handle->setArgument("server_config", CfgMgr::instance().getStagingCfg());
+
+            HooksManager::callCallouts(Hooks.hooks_index_dhcp6_srv_configured_,
+                                       *callout_handle);
+
+            // Ignore status code as none of them would have an effect on further
+            // operation.
+        }
     }
 
     // Apply multi threading settings.
     // @note These settings are applied/updated only if no errors occur while
     // applying the new configuration.
     // @todo This should be fixed.
+    // The thread pool is only restarted if the parameters have changed.
     try {
-        CfgMultiThreading::apply(CfgMgr::instance().getStagingCfg()->getDHCPMultiThreading());
-        if (MultiThreadingMgr::instance().getMode()) {
-            LOG_FATAL(dhcp6_logger, DHCP6_MULTI_THREADING_WARNING);
+        data::ElementPtr mt = CfgMgr::instance().getStagingCfg()->getDHCPMultiThreading();
+        if (!CfgMultiThreading::isApplied(mt)) {
+            CfgMultiThreading::apply(mt);
+            if (MultiThreadingMgr::instance().getMode()) {
+                LOG_FATAL(dhcp6_logger, DHCP6_MULTI_THREADING_WARNING);
+            }
         }
     } catch (const std::exception& ex) {
         err << "Error applying multi threading settings: "
@@ -1141,6 +1235,10 @@ ControlledDhcpv6Srv::ControlledDhcpv6Srv(uint16_t server_port,
     // CommandMgr uses IO service to run asynchronous socket operations.
     CommandMgr::instance().setIOService(getIOService());
 
+    // Notifications are sent by shared sender threads which live as long as
+    // the server.
+    NotificationsSender::start();
+
     // These are the commands always supported by the DHCPv6 server.
     // Please keep the list in alphabetic order.
     CommandMgr::instance().registerCommand("active-duid",
@@ -1196,9 +1294,18 @@ ControlledDhcpv6Srv::ControlledDhcpv6Srv(uint16_t server_port,
     CommandMgr::instance().registerCommand("shutdown",
         std::bind(&ControlledDhcpv6Srv::commandShutdownHandler, this, ph::_1, ph::_2));
 
+    CommandMgr::instance().registerCommand("stage-latency-get",
+        std::bind(&StageLatency::commandStageLatencyGetHandler, ph::_1, ph::_2));
+
+    CommandMgr::instance().registerCommand("stage-latency-set",
+        std::bind(&StageLatency::commandStageLatencySetHandler, ph::_1, ph::_2));
+
     CommandMgr::instance().registerCommand("status-get",
         std::bind(&ControlledDhcpv6Srv::commandStatusGetHandler, this, ph::_1, ph::_2));
 
+    CommandMgr::instance().registerCommand("subnet6-delta-apply",
+        std::bind(&ControlledDhcpv6Srv::commandSubnetDeltaApplyHandler, this, ph::_1, ph::_2));
+
     CommandMgr::instance().registerCommand("version-get",
         std::bind(&ControlledDhcpv6Srv::commandVersionGetHandler, this, ph::_1, ph::_2));
 
@@ -1250,6 +1357,9 @@ ControlledDhcpv6Srv::~ControlledDhcpv6Srv() {
 
         timer_mgr_->unregisterTimers();
 
+        // Stop sending notifications before anything they refer to goes away.
+        NotificationsSender::stop();
+
         // Close the command socket (if it exists).
         CommandMgr::instance().closeCommandSocket();
 
@@ -1271,6 +1381,8 @@ ControlledDhcpv6Srv::~ControlledDhcpv6Srv() {
         CommandMgr::instance().deregisterCommand("libreload");
         CommandMgr::instance().deregisterCommand("server-tag-get");
         CommandMgr::instance().deregisterCommand("shutdown");
+        CommandMgr::instance().deregisterCommand("stage-latency-get");
+        CommandMgr::instance().deregisterCommand("stage-latency-set");
         CommandMgr::instance().deregisterCommand("statistic-get");
         CommandMgr::instance().deregisterCommand("statistic-get-all");
         CommandMgr::instance().deregisterCommand("statistic-remove");
@@ -1282,6 +1394,7 @@ ControlledDhcpv6Srv::~ControlledDhcpv6Srv() {
         CommandMgr::instance().deregisterCommand("statistic-sample-count-set");
         CommandMgr::instance().deregisterCommand("statistic-sample-count-set-all");
         CommandMgr::instance().deregisterCommand("status-get");
+        CommandMgr::instance().deregisterCommand("subnet6-delta-apply");
         CommandMgr::instance().deregisterCommand("version-get");
 
     } catch (...) {
@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 221
-#define YY_END_OF_BUFFER 222
+#define YY_NUM_RULES 229
+#define YY_END_OF_BUFFER 230
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,35 +700,35 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[2118] =
+static const flex_int16_t yy_accept[2222] =
     {   0,
-      214,  214,    0,    0,    0,    0,    0,    0,    0,    0,
-      222,  220,   10,   11,  220,    1,  214,  211,  214,  214,
-      220,  213,  212,  220,  220,  220,  220,  220,  207,  208,
-      220,  220,  220,  209,  210,    5,    5,    5,  220,  220,
-      220,   10,   11,    0,    0,  203,    0,    0,    0,    0,
+      222,  222,    0,    0,    0,    0,    0,    0,    0,    0,
+      230,  228,   10,   11,  228,    1,  222,  219,  222,  222,
+      228,  221,  220,  228,  228,  228,  228,  228,  215,  216,
+      228,  228,  228,  217,  218,    5,    5,    5,  228,  228,
+      228,   10,   11,    0,    0,  211,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    1,  214,  214,
-        0,  213,  214,    3,    2,    6,    0,  214,    0,    0,
-        0,    0,    0,    0,    4,    0,    0,    9,    0,  204,
+        0,    0,    0,    0,    0,    0,    0,    0,    1,  222,
+      222,    0,  221,  222,    3,    2,    6,    0,  222,    0,
+        0,    0,    0,    0,    0,    4,    0,    0,    9,    0,
 
+      212,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  214,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  206,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    2,    0,    0,    0,    0,
-        0,    0,    0,    8,    0,    0,    0,  161,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    2,
+        0,    0,    0,    0,    0,    0,    0,    8,    0,    0,
 
-      162,    0,    0,    0,    0,    0,    0,    0,  205,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  169,    0,    0,  170,    0,    0,    0,    0,    0,
+        0,    0,  213,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  112,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  120,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
@@ -736,205 +736,217 @@ static const flex_int16_t yy_accept[2118] =
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  219,  217,
-        0,  216,  215,    0,    0,    0,    0,    0,    0,  160,
-        0,   28,    0,   27,    0,    0,  119,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   55,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  227,  225,    0,  224,  223,
+        0,    0,    0,    0,    0,    0,  168,    0,   28,    0,
+       27,    0,    0,  127,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   55,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  116,    0,    0,    0,
 
+        0,    0,    0,    0,    0,  124,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  218,  215,    0,    0,    0,    0,    0,   29,    0,
-       31,    0,    0,    0,    0,    0,    0,    0,    0,  120,
-        0,    0,    0,    0,    0,    0,    0,   97,    0,    0,
-        0,    0,    0,    0,    0,    0,  144,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   58,    0,
+        0,  226,  223,    0,    0,    0,    0,    0,   29,    0,
+       31,    0,    0,    0,    0,    0,    0,    0,    0,  128,
+        0,    0,    0,    0,    0,    0,    0,  105,    0,    0,
+        0,    0,    0,    0,    0,    0,  152,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       58,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   96,
+        0,    0,    0,  104,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  106,    0,   59,
+        0,  114,    0,   59,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  139,    0,  165,   51,
-        0,   56,    0,    0,    0,    0,    0,   37,   34,   33,
 
-        0,    0,    0,    0,  152,    0,    0,    0,    0,    0,
+      147,    0,  173,   51,    0,   56,    0,    0,    0,    0,
+        0,    0,   37,   34,   33,    0,    0,    0,    0,  160,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  130,    0,    0,    0,    0,    0,
-        0,    0,    0,  164,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  138,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      172,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   53,    0,    0,   32,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   99,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       53,    0,    0,   32,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,  153,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  148,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  107,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    7,   35,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  161,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  156,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    7,   35,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  118,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  132,    0,
+        0,  126,    0,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      129,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  101,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  140,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  137,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  109,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  109,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  108,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  117,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  147,
+        0,    0,    0,    0,    0,    0,    0,  116,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  157,    0,  127,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  131,   52,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  133,    0,
-       60,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  155,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   91,    0,    0,
+        0,    0,  165,    0,  135,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  139,   52,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  141,    0,   60,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,  186,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  115,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  146,    0,    0,
-        0,    0,    0,    0,    0,   63,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   99,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  194,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   57,  100,    0,
-        0,    0,    0,  143,    0,    0,  201,    0,    0,    0,
-        0,   50,    0,    0,    0,    0,    0,    0,    0,    0,
-
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      135,    0,    0,    0,  202,    0,    0,    0,    0,    0,
+      123,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  154,    0,    0,    0,
+        0,    0,    0,    0,   63,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  187,
+       57,  108,    0,    0,    0,    0,  151,    0,    0,  209,
+        0,    0,    0,    0,   50,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  110,
+        0,    0,    0,  143,    0,    0,    0,  210,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  195,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   41,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   16,    0,    0,  159,
-       14,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  118,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      149,    0,    0,    0,    0,    0,    0,  134,    0,    0,
+        0,    0,    0,    0,    0,   41,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   16,    0,    0,
+      167,   14,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  145,  163,    0,    0,
-       40,    0,  154,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   20,    0,    0,    0,    0,    0,   94,
-        0,    0,    0,    0,    0,  156,    0,   54,    0,  102,
-        0,    0,    0,  185,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   82,
-        0,    0,    0,    0,    0,  125,  126,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   98,    0,    0,    0,
-        0,    0,    0,    0,   64,    0,    0,    0,    0,    0,
+        0,    0,  157,    0,    0,    0,    0,    0,    0,  142,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  153,  171,    0,    0,   40,    0,  162,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      151,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   20,    0,    0,    0,    0,    0,  102,    0,
+        0,    0,    0,    0,  164,    0,   54,    0,  110,    0,
+        0,    0,  193,    0,    0,    0,    0,    0,    0,    0,
 
-        0,  191,    0,    0,    0,    0,    0,    0,    0,    0,
-      121,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   95,  117,
+        0,    0,    0,    0,    0,    0,    0,    0,   90,    0,
+        0,    0,    0,    0,  133,  134,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  106,    0,    0,    0,
+        0,    0,    0,    0,   64,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   79,    0,    0,    0,    0,
-        0,    0,   17,    0,   15,    0,  181,  180,    0,    0,
-        0,   69,    0,    0,    0,    0,    0,   30,    0,    0,
-      138,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  174,    0,
-      184,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,  111,    0,  142,    0,   43,    0,   61,  158,
+      159,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  199,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   77,    0,  129,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   19,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  113,   80,    0,
-        0,  150,    0,    0,    0,    0,    0,  141,    0,    0,
-        0,    0,    0,    0,    0,    0,  107,    0,    0,    0,
+        0,    0,    0,    0,    0,  103,  125,    0,    0,    0,
+
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  105,    0,    0,    0,
-      166,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   87,    0,    0,    0,    0,    0,    0,   17,
+        0,   15,    0,  189,  188,    0,    0,    0,   69,    0,
+        0,    0,    0,    0,    0,   30,    0,    0,  146,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  182,    0,  192,    0,
+        0,    0,    0,    0,    0,   74,    0,   73,    0,    0,
+        0,    0,    0,  119,    0,  150,    0,   43,    0,    0,
+        0,   61,   78,  166,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   19,    0,
 
-        0,    0,    0,    0,    0,    0,    0,  197,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   42,    0,    0,    0,
-        0,   68,    0,    0,    0,    0,    0,    0,  136,   47,
-        0,    0,    0,    0,   70,  179,   38,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   12,    0,    0,    0,
+        0,  121,   88,    0,    0,  158,    0,    0,    0,    0,
+        0,  149,    0,    0,    0,    0,    0,    0,    0,    0,
+      115,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  113,    0,    0,    0,  174,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  205,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,   42,    0,    0,    0,    0,   68,
+        0,    0,    0,    0,    0,    0,    0,  144,   47,    0,
+        0,    0,    0,   70,  187,   38,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   12,    0,    0,    0,   75,
         0,    0,    0,    0,    0,    0,   45,    0,    0,    0,
-       44,    0,    0,    0,    0,   18,    0,    0,    0,   72,
-        0,    0,    0,    0,    0,    0,    0,  128,    0,    0,
+       44,    0,    0,    0,    0,    0,    0,   18,    0,    0,
+        0,   72,    0,    0,    0,    0,    0,    0,    0,  136,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   84,    0,    0,  196,    0,  198,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   76,
-        0,  188,    0,  190,    0,    0,    0,   62,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  103,    0,    0,
-        0,    0,    0,  155,    0,    0,    0,   46,    0,    0,
-      193,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  175,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   67,    0,    0,    0,
-       93,    0,    0,    0,    0,   36,    0,   48,    0,    0,
+       62,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      111,    0,    0,    0,    0,    0,  163,    0,    0,    0,
+       46,    0,    0,    0,    0,  201,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  183,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   24,    0,    0,    0,    0,    0,    0,    0,
+        0,   67,    0,    0,    0,  101,    0,    0,    0,    0,
+        0,   36,    0,   48,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   24,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  180,    0,    0,    0,    0,    0,    0,  148,    0,
 
-        0,    0,    0,  172,    0,    0,    0,    0,    0,    0,
-      140,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  114,    0,    0,    0,  177,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   85,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   25,   39,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  178,    0,    0,    0,    0,   13,    0,
+        0,    0,  122,    0,    0,    0,  185,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   93,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   25,   39,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      189,    0,    0,    0,    0,    0,    0,  183,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  171,
-
-        0,    0,   78,    0,   77,    0,    0,   21,    0,   73,
-        0,    0,    0,    0,    0,    0,    0,   65,    0,    0,
-        0,  124,    0,    0,    0,    0,    0,    0,    0,    0,
-      104,    0,    0,  170,    0,    0,    0,    0,    0,    0,
-       71,  196,    0,    0,    0,    0,    0,    0,    0,   66,
-        0,   23,    0,    0,   92,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  186,    0,    0,    0,    0,   13,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  199,    0,    0,    0,
-        0,    0,    0,    0,   89,    0,    0,    0,    0,    0,
+        0,    0,  197,    0,    0,    0,    0,    0,    0,  191,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  179,    0,    0,   86,    0,   85,    0,
+
+        0,   21,    0,   81,    0,    0,    0,    0,    0,    0,
+        0,   65,    0,    0,    0,    0,  132,    0,    0,    0,
+        0,    0,    0,    0,    0,  112,    0,    0,  178,    0,
+        0,    0,    0,    0,    0,    0,    0,   71,  204,    0,
+        0,    0,    0,    0,    0,    0,   66,    0,   23,    0,
+        0,  100,    0,   76,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   79,    0,
+        0,    0,    0,    0,    0,    0,  207,    0,    0,    0,
+        0,    0,    0,    0,   97,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   49,
-        0,    0,   90,    0,    0,  176,    0,    0,    0,    0,
-        0,    0,    0,   75,   74,    0,   22,    0,  200,    0,
-      122,  137,    0,    0,    0,   86,    0,    0,    0,    0,
-        0,    0,    0,  194,    0,    0,    0,  168,    0,  173,
-        0,   88,   81,    0,    0,    0,    0,    0,  195,    0,
-      198,    0,    0,  167,    0,    0,   26,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   87,    0,
-        0,    0,    0,    0,    0,    0,  123,    0,    0,   84,
-        0,    0,    0,    0,    0,    0,  192,    0,   83,  169,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  182,    0
+       49,    0,    0,   98,    0,    0,  184,    0,    0,    0,
+        0,    0,    0,    0,    0,   83,   82,    0,   22,    0,
+      208,    0,  130,  145,    0,    0,    0,   94,    0,    0,
+        0,    0,    0,    0,    0,    0,  202,    0,    0,    0,
+      176,    0,  181,    0,   96,   89,    0,    0,    0,    0,
+        0,   80,  203,    0,  206,    0,    0,  175,    0,    0,
+       26,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   95,    0,    0,    0,    0,    0,    0,    0,
+      131,    0,    0,   92,    0,    0,    0,    0,    0,    0,
+
+      200,    0,   91,  177,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  190,
+        0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -981,273 +993,285 @@ static const YY_CHAR yy_meta[74] =
         3,    3,    3
     } ;
 
-static const flex_int16_t yy_base[2130] =
+static const flex_int16_t yy_base[2234] =
     {   0,
         0,   72,   21,   31,   43,   51,   54,   60,   91,   99,
-     2519, 2520,   34, 2515,  145,    0,  207, 2520,  214,  221,
-       13,  228, 2520, 2495,  118,   25,    2,    6, 2520, 2520,
-       73,   11,   17, 2520, 2520, 2520,  104, 2503, 2456,    0,
-     2493,  108, 2510,   24,  256, 2520,   67, 2459, 2479,   84,
-       75, 2479,   88,  226,   91,   89,  284,  196,  203,  279,
-      193,  224,  216,   60,  242, 2459,  288,  290,  319,  307,
-      326, 2442,  204,  331,  355,  329, 2461,    0,  384,  405,
-      422,  429,  434, 2520,    0, 2520,  398,  412,  238,  241,
-      288,  306,  326,  321, 2520, 2458, 2499, 2520,  429, 2520,
-
-      447,  342, 2456, 2497,  411,   10,  262,  415,  224,  419,
-      425,  206, 2496,    0,  500,  423, 2438,  219, 2446,  303,
-     2442, 2431, 2432, 2437,  417, 2447, 2430, 2439,  423,  303,
-      412, 2433, 2431,  413, 2420, 2478,  335,  342, 2477, 2417,
-     2418, 2439, 2436, 2436, 2430,  428, 2423, 2421, 2422, 2414,
-     2419, 2413,  428, 2410, 2423,  447, 2408, 2407, 2421,  457,
-     2459, 2406,  436,  479,  437, 2407,  496, 2408,  471, 2420,
-     2417, 2418, 2406,  429, 2415, 2450, 2449,  447, 2395, 2395,
-     2399, 2395, 2387, 2404, 2396,    0,  467,  478,  250,  500,
-      480,  303, 2395, 2520,    0,  517, 2390, 2520,  505,  500,
-
-     2520, 2444,  518, 2443,  525, 2442,  522, 2441, 2520,  568,
-      496,  542, 2400, 2397, 2398, 2393, 2392, 2383,  515, 2434,
-     2428, 2392, 2373, 2370, 2378, 2384, 2372, 2386, 2382, 2383,
-     2383, 2378, 2370, 2372, 2356, 2360, 2373, 2375, 2372, 2364,
-     2354, 2357, 2371, 2520, 2357, 2350, 2364, 2367, 2348, 2360,
-     2346, 2398, 2345, 2355, 2395, 2340,  556, 2353, 2392, 2337,
-     2339, 2350, 2388,  549, 2344, 2391, 2349, 2325, 2340,  550,
-     2330, 2336, 2345, 2326, 2324, 2327, 2323, 2332, 2328, 2319,
-     2318, 2331, 2314, 2315, 2322, 2312, 2323, 2327, 2326, 2320,
-      513, 2327, 2322, 2314, 2304, 2319, 2314, 2318,  523, 2316,
-
-     2302, 2308, 2315, 2351, 2296, 2297, 2300, 2297, 2296,  591,
-     2291, 2305, 2304, 2303, 2306, 2288, 2296,  551, 2520, 2520,
-      560, 2520, 2520, 2283,    0,  530, 2330,  562, 2341, 2520,
-      563, 2520, 2340, 2520, 2334,  613, 2520, 2296,  562, 2273,
-     2276, 2293, 2281, 2333, 2288, 2283, 2286, 2281,   80, 2520,
-     2283,  598, 2322, 2280, 2277, 2278,  596, 2282, 2322, 2270,
-     2265, 2262, 2258, 2260, 2311, 2268, 2257, 2273, 2307, 2253,
-      636, 2266, 2266, 2249, 2267, 2249, 2262, 2249, 2243, 2258,
-     2253, 2260, 2255, 2240, 2253,  587, 2248, 2251, 2246,  585,
-     2245, 2241, 2291,  343,  571, 2245, 2520, 2235, 2283, 2233,
-
-     2232, 2225, 2227, 2239, 2230, 2219, 2236, 2225, 2230, 2235,
-      602, 2276, 2229,  571, 2234, 2219, 2224, 2227, 2227, 2225,
-     2214, 2214, 2226,  594, 2201, 2202, 2223,  615, 2205, 2202,
-     2216, 2219, 2214, 2200, 2212, 2211, 2210, 2211, 2204, 2207,
-     2206, 2205, 2204,  599, 2247, 2206, 2245, 2244, 2186,  661,
-     2199, 2520, 2520, 2198,    0,  607, 2240, 2239, 2520, 2238,
-     2520,  642,  690, 2197,  609, 2236, 2184, 2186, 2174, 2520,
-     2179, 2185, 2188, 2171, 2186, 2173, 2172, 2520, 2182,  618,
-     2173, 2170, 2182,  573, 2167, 2169, 2520, 2175, 2160, 2162,
-     2173, 2171, 2166,  673, 2173, 2161, 2154, 2205, 2520, 2152,
-
-     2168, 2202, 2206, 2162, 2156, 2150, 2157, 2158, 2160, 2148,
-     2193, 2144, 2139, 2138, 2140, 2136, 2149,  626, 2131,  512,
-     2131, 2149, 2123, 2130, 2135, 2128, 2144, 2178, 2182, 2520,
-     2127, 2123, 2179, 2130, 2123, 2128, 2122, 2129, 2114, 2124,
-     2112, 2126, 2115, 2111, 2113, 2108, 2101, 2520, 2164, 2520,
-     2106, 2105, 2098, 2118, 2117, 2113, 2152, 2151, 2096, 2101,
-     2110, 2104, 2098, 2107,  677, 2144, 2106, 2089, 2089, 2084,
-     2080, 2086, 2091, 2084, 2092, 2096, 2079, 2137, 2092, 2077,
-     2129, 2074, 2075, 2074, 2086, 2075, 2520, 2085, 2520, 2520,
-     2074, 2520, 2084, 2120, 2080,    0, 2123, 2520, 2520, 2520,
-
-      652,  633, 2063,  680, 2520, 2081, 2061, 2114, 2059,  209,
-     2058, 2057, 2056, 2063, 2056, 2064, 2067, 2049, 2049, 2064,
-     2063, 2062, 2061, 2045, 2060, 2042, 2089, 2056, 2094, 2038,
-     2040, 2052, 2052, 2051, 2520, 2036, 2033, 2091, 2046, 2038,
-     2044, 2035, 2043, 2520, 2028, 2039, 2041, 2042, 2024, 2038,
-     2074,  644, 2019, 2013, 2018, 2015, 2069, 2030, 2067, 2027,
-     2026, 2027, 2006, 2027, 2015, 2021, 2064, 2019, 2018, 2010,
-     2001, 2520, 2002, 2004, 2520, 2015, 1997, 2010, 2049, 2048,
-       16, 2009, 2046, 1991, 1992, 1995, 1996, 1987, 2040, 2520,
-     2000, 1986,  713, 1978, 1987, 1976, 1980, 1996, 1993, 1985,
-
-     2030, 1982, 1989, 2027, 2520, 1973, 1971, 1985, 1969, 1983,
-     1986, 2020, 2019, 2018, 2017, 1962, 2015, 2014, 2520, 1961,
-     1958, 1972,  638, 1973,   93,  242,  375,  455,  451,  459,
-      548, 2520, 2520,  657,  660,  570,  613,  625,  627,  650,
-      693,  672,  639,  698,  661,  714,  715,  669,  665,  670,
-      680,  685,  671,  674,  667,  724,  692,  684,  694,  734,
-      697,  689,  691,  695,  701,  741,  747,  704,  706, 2520,
-      709,  704,  695,  710,  715,  712,  710,  715,  718,  717,
-      718,  715,  717,  725,  722,  767,  768,  712,  727,  714,
-      715,  729,  715,  725,  772,  719,  732,  781, 2520,  782,
-
-      738,  736,  738,  734,  728,  748,  784,  785,  748,  737,
-     2520,  739,  750,  739,  752,  754,  798,  741,  800,  757,
-      744,  759, 2520,  753,  747,  801,  756,  760,  745,  756,
-      769,  748,  754,  809,  773,  757,  757,  770,  814,  815,
-      816,  763,  781,  776,  783,  778,  763,  775,  776,  771,
-      784,  771, 2520,  836,  794,  795,  785,  797,  787,  800,
-      791,  797,  841,  817,  794,  805,  806,  851,  801, 2520,
-      799,  814,  811,  816,  798,  805,  804,  802,  821,  818,
-      819,  807,  814,  815,  824,  824,  814,  827,  813,  812,
-      818,  874,  816,  817,  823,  839,  822,  876,  831, 2520,
-
-      841,  841,  834,  845,  843,  888,  830,  832,  847,  887,
-      850,  837,  896,  844,  854,  840,  843, 2520,  846, 2520,
-      860,  863,  860,  850,  862,  863,  868,  856,  866,  867,
-      869, 2520, 2520,  869,  871,  858,  876,  863,  859,  862,
-      863,  881,  868,  868,  919,  866,  870,  928, 2520,  929,
-     2520,  877,  875,  889,  889,  934,  888,  936,  884,  883,
-      887,  881,  941,  894,  884,  885,  881,  891,  895,  906,
-      891,  909,  904,  906,  899,  901,  902,  914,  904,  919,
-      960,  917,  922,  899,  964,  923,  907, 2520,  914,  915,
-      930,  920,  918,  968,  915,  930,  948,  956,  925,  926,
-
-      975, 2520,  941,  929,  924,  925,  926,  938,  945,  934,
-      935,  931,  949,  935,  936,  946,  955,  991,  946,  941,
-      994, 1001,  958,  950, 2520,  954,  962,  964,  949,  965,
-      955,  967,  961, 1008,  974,  958,  959, 2520,  975,  978,
-      961,  963,  973, 1022,  965, 2520,  965,  983,  986,  967,
-      989,  986,  972,  974,  993,  977, 1030,  988,  984,  981,
-      987, 1035,  984, 1037,  999,  985, 1003,  998, 1003, 1004,
-      990, 1005,  997,  993, 1011, 1010,  997, 2520, 2520, 1010,
-     1006, 1053, 1006, 2520, 1012, 1021, 2520, 1016, 1019, 1013,
-     1066, 2520, 1015, 1020, 1064, 1015, 1016, 1028, 1022, 1026,
-
-     1024, 1022, 1033, 1078, 1022, 1028, 1082, 1083, 1027, 1039,
-     2520, 1027, 1035, 1033, 2520, 1084, 1046, 1032, 1033, 1042,
-     1054, 1041, 1039, 1053, 1054, 1070, 1075, 1095, 1059, 1044,
-     1046, 1046, 1066, 1065, 1060, 1057, 1046, 1063, 1070, 1113,
-     1055, 1075, 1068, 1072, 1076, 1059, 1120, 1067, 1071, 2520,
-     1118, 1067, 1066, 1066, 1089, 1086, 1126, 1075, 1093, 1094,
-     1080, 1088, 1097, 1077, 1092, 1099, 1141, 1142, 1100, 2520,
-     1096, 1145, 1146, 1103, 1098, 1108, 1111, 1093, 1095, 1114,
-     1097, 1114, 1100, 1100, 1107, 1116, 1104, 1118, 1112, 1107,
-     1114, 1126, 1167, 1114, 1115, 1114, 1115, 1132, 1173, 1123,
-
-     1127, 1125, 1123, 1118, 1179, 1132, 1181, 1131, 1183, 1126,
-     1134, 1181, 1187, 1140, 2520, 1145, 1139, 1130, 1149, 1143,
-     1138, 1148, 1145, 1150, 1146, 1158, 2520, 1142, 1144, 2520,
-     2520, 1144, 1204, 1143, 1162, 1163, 1165, 1156, 1210, 1211,
-     1164, 1149, 1163, 1171, 1153, 1158, 1197, 1188, 1161, 1221,
-     1178, 1165, 1167, 1184, 1179, 1173, 1184, 1229, 1177, 1181,
-     2520, 1178, 1174, 1191, 1171, 1192, 1182, 2520, 1197, 1195,
-     1198, 1183, 1195, 1200, 1186, 1246, 1200, 1205, 1192, 1203,
-     1195, 1201, 1197, 1215, 1216, 1217, 2520, 2520, 1258, 1216,
-     2520, 1218, 2520, 1203, 1205, 1205, 1224, 1214, 1219, 1267,
-
-     1227, 1264, 1226, 1227, 1224, 1268, 1232, 1221, 1223, 1229,
-     1234, 1231, 1237, 2520, 1230, 1229, 1223, 1224, 1285, 2520,
-     1286, 1233, 1240, 1284, 1246, 2520, 1238, 2520, 1244, 2520,
-     1234, 1246, 1237, 2520, 1237, 1240, 1254, 1259, 1242, 1253,
-     1302, 1259, 1260, 1261, 1301, 1257, 1308, 1261, 1310, 2520,
-     1257, 1312, 1313, 1270, 1272, 2520, 2520, 1255, 1317, 1313,
-     1277, 1261, 1273, 1292, 1323, 1260, 2520, 1281, 1326, 1273,
-     1288, 1324, 1277, 1277, 2520, 1273, 1289, 1277, 1291, 1292,
-     1289, 1333, 1296, 1300, 1288, 1288, 1343, 1339, 1345, 1302,
-     2520, 1304, 1303, 1305, 1299, 1308, 1309, 1306, 1296, 1299,
-
-     1299, 2520, 1358, 1306, 1361, 1320, 1363, 1306, 1365, 1366,
-     2520, 1327, 1308, 1364, 1328, 1307, 1322, 1315, 1318, 1317,
-     1332, 1335, 1334, 1332, 1382, 1325, 1340, 1337, 2520, 2520,
-     1333, 1343, 1328, 1384, 1346, 1346, 1338, 1350, 1334, 1395,
-     1396, 1340, 1350, 1399, 1356, 2520, 1348, 1348, 1350, 1352,
-     1405, 1348, 2520, 1349, 2520, 1351, 2520, 2520, 1364, 1366,
-     1367, 2520, 1354, 1362, 1414, 1363, 1395, 2520, 1362, 1413,
-     2520, 1361, 1369, 1363, 1360, 1418, 1364, 1367, 1367, 1363,
-     1385, 1424, 1377, 1389, 1392, 1374, 1434, 1382, 2520, 1377,
-     2520, 1379, 1438, 1392, 1383, 1398, 1398, 1401, 1401, 1398,
-
-     1442, 1404, 2520, 1396, 2520, 1406, 2520, 1407, 2520, 2520,
-     1394, 1394, 1394, 1450, 1412, 1413, 1410, 1454, 1402, 1456,
-     1418, 1458, 1420, 1412, 2520, 1466, 1409, 1411, 1411, 1417,
-     1416, 1414, 1468, 1430, 1418, 1471, 1432, 2520, 2520, 1473,
-     1420, 2520, 1437, 1422, 1422, 1424, 1430, 2520, 1485, 1427,
-     1437, 1448, 1446, 1490, 1443, 1452, 2520, 1449, 1468, 1451,
-     1437, 1497, 1498, 1455, 1460, 1442, 1443, 1503, 1504, 1505,
-     1501, 1465, 1462, 1458, 1451, 1463, 2520, 1453, 1466, 1514,
-     2520, 1452, 1511, 1474, 1471, 1515, 1464, 1469, 1467, 1526,
-     1482, 1473, 1529, 1486, 1483, 1473, 1482, 1534, 1495, 1484,
-
-     1478, 1538, 1480, 1481, 1490, 1483, 1497, 2520, 1485, 1501,
-     1546, 1488, 1505, 1501, 1495, 1492, 1488, 1502, 1509, 1493,
-     1551, 1552, 1553, 1500, 1555, 1518, 2520, 1518, 1505, 1504,
-     1560, 2520, 1501, 1519, 1568, 1538, 1570, 1523, 2520, 2520,
-     1572, 1525, 1510, 1575, 2520, 2520, 2520, 1521, 1526, 1524,
-     1574, 1532, 1537, 1528, 1526, 1528, 2520, 1586, 1532, 1583,
-     1526, 1531, 1592, 1540, 1550, 1551, 2520, 1596, 1550, 1540,
-     2520, 1600, 1550, 1554, 1555, 2520, 1546, 1561, 1549, 2520,
-     1550, 1560, 1561, 1562, 1611, 1607, 1570, 2520, 1609, 1575,
-     1551, 1577, 1570, 1614, 1572, 1573, 1582, 1564, 1570, 1572,
-
-     1626, 1585, 1584, 1576, 1631, 1581, 1585, 1590, 1583, 2520,
-     1636, 2520, 1585, 2520, 1638, 1580, 1585, 2520, 1584, 1594,
-     1638, 1586, 1601, 1588, 1594, 1594, 1605, 2520, 1599, 1594,
-     1593, 1653, 1606, 2520, 1650, 1601, 1598, 2520, 1612, 1611,
-     2520, 1612, 1610, 1617, 1619, 1664, 1617, 1618, 1615, 1623,
-     1617, 2520, 1628, 1671, 1612, 1614, 1630, 1618, 1624, 1619,
-     1633, 1616, 1632, 1633, 1627, 1643, 2520, 1633, 1685, 1644,
-     2520, 1628, 1635, 1689, 1685, 2520, 1647, 2520, 1687, 1649,
-     1650, 1651, 1636, 1637, 1645, 1699, 1695, 1650, 1662, 1659,
-     1650, 1657, 2520, 1654, 1659, 1657, 1709, 1710, 1657, 1647,
-
-     1665, 1670, 1657, 2520, 1672, 1673, 1674, 1675, 1676, 1667,
-     2520, 1667, 1679, 1724, 1685, 1682, 1679, 1684, 1729, 1671,
-     1679, 1673, 1681, 1694, 2520, 1671, 1731, 1692, 2520, 1696,
-     1681, 1681, 1741, 1697, 1690, 1689, 1700, 1687, 2520, 1692,
-     1748, 1706, 1697, 1709, 1700, 1709, 1711, 1715, 2520, 2520,
-     1703, 1717, 1693, 1700, 1760, 1703, 1704, 1763, 1705, 1765,
-     1713, 1724, 1768, 2520, 1717, 1770, 1706, 1713, 2520, 1768,
-     1730, 1727, 1732, 1719, 1778, 1721, 1726, 1717, 1782, 1735,
-     2520, 1736, 1726, 1743, 1742, 1783, 1745, 2520, 1742, 1791,
-     1748, 1749, 1794, 1751, 1754, 1792, 1739, 1759, 1752, 2520,
-
-     1801, 1802, 2520, 1755, 2520, 1759, 1765, 2520, 1762, 2520,
-     1763, 1760, 1750, 1810, 1757, 1812, 1755, 2520, 1774, 1815,
-     1774, 2520, 1765, 1755, 1814, 1780, 1773, 1769, 1766, 1771,
-     2520, 1767, 1769, 2520, 1774, 1784, 1774, 1782, 1772, 1780,
-     2520, 2520, 1781, 1786, 1776, 1777, 1837, 1786, 1791, 2520,
-     1787, 2520, 1797, 1790, 2520, 1792, 1800, 1845, 1786, 1788,
-     1785, 1809, 1802, 1805, 1794, 1848, 1795, 1803, 1816, 1803,
-     1810, 1815, 1816, 1815, 1818, 1819, 2520, 1820, 1813, 1808,
-     1809, 1813, 1825, 1870, 2520, 1816, 1828, 1873, 1822, 1821,
-     1876, 1829, 1816, 1831, 1836, 1824, 1829, 1829, 1884, 1885,
-
-     1826, 1887, 1831, 1889, 1846, 1891, 1892, 1842, 1836, 2520,
-     1852, 1896, 2520, 1853, 1855, 2520, 1846, 1860, 1856, 1849,
-     1863, 1904, 1852, 2520, 2520, 1849, 2520, 1849, 2520, 1908,
-     2520, 2520, 1865, 1910, 1871, 2520, 1912, 1913, 1868, 1867,
-     1868, 1858, 1866, 2520, 1919, 1880, 1921, 2520, 1917, 2520,
-     1864, 2520, 2520, 1924, 1866, 1882, 1927, 1884, 2520, 1870,
-     2520, 1890, 1887, 2520, 1928, 1877, 2520, 1876, 1888, 1891,
-     1884, 1939, 1881, 1883, 1898, 1889, 1900, 1885, 2520, 1898,
-     1947, 1891, 1896, 1950, 1898, 1900, 2520, 1895, 1949, 2520,
-     1896, 1912, 1957, 1913, 1959, 1960, 2520, 1904, 2520, 2520,
-
-     1908, 1911, 1959, 1915, 1922, 1927, 1963, 1916, 1926, 1912,
-     1930, 1919, 1921, 1930, 1976, 2520, 2520, 1982, 1987, 1992,
-     1997, 2002, 2007, 2012, 2015, 1989, 1994, 1996, 2009
+     2624, 2625,   34, 2620,  145,    0,  207, 2625,  214,  221,
+       13,  228, 2625, 2600,  118,   25,    2,    6, 2625, 2625,
+       73,   11,   17, 2625, 2625, 2625,  104, 2608, 2561,    0,
+     2598,  108, 2615,   24,  256, 2625,   67, 2564, 2584,   84,
+       75, 2584,   88,  226,   91,   89,  284,  196,  203,  279,
+      193,  235,  289,   60,  207, 2564,  305,  288,  314,  302,
+      321, 2547,  204,  326,  373,  221, 2566,  348,    0,  388,
+      395,  433,  402,  439, 2625,    0, 2625,  416,  444,  238,
+      241,  235,  246,  269,  319, 2625, 2563, 2604, 2625,  330,
+
+     2625,  422,  356, 2561, 2602,  309,   10,  338,  358,  403,
+      401,  407,  413, 2601,    0,  476,  438, 2543,  321, 2551,
+      421, 2547, 2536, 2537, 2542,  427, 2552, 2535, 2544,  450,
+      172,  225, 2527, 2537, 2535, 2534,  448, 2523, 2581,  466,
+      335, 2580, 2520, 2521, 2542, 2539, 2539, 2533,  449, 2526,
+     2524, 2525, 2517, 2522, 2516,  443, 2513, 2526,  326, 2511,
+     2510, 2524,  466, 2562, 2509,  475,  457,  487, 2510,  498,
+     2511,  484, 2523, 2520, 2521, 2509,  474, 2518, 2553, 2552,
+      487, 2498, 2498, 2502, 2498, 2490, 2507, 2499, 2501,    0,
+      492,  509,  492,  500,  510,  522, 2497, 2625,    0,  527,
+
+     2492, 2625,  516,  522, 2625, 2546,  526, 2545,  534, 2544,
+      526, 2543, 2625,  572,  270,  545, 2502, 2499, 2500, 2495,
+     2494, 2485,  518, 2536, 2530, 2494, 2475, 2472, 2480, 2486,
+     2474, 2488, 2484, 2485, 2485, 2480, 2472, 2474, 2458, 2462,
+     2466, 2474, 2476, 2456, 2472, 2464, 2454, 2457, 2471, 2625,
+     2457, 2450, 2464, 2467, 2448, 2460, 2446, 2498, 2445, 2455,
+     2495, 2440,  560, 2453, 2492, 2437, 2439, 2450, 2488,  543,
+     2444, 2491, 2449, 2425, 2440,  552, 2430, 2436, 2445, 2426,
+     2424, 2427, 2423, 2432, 2428, 2419, 2418, 2431, 2414, 2415,
+     2422, 2412, 2423, 2427, 2426, 2420,  426, 2427, 2422, 2414,
+
+     2404, 2419, 2414, 2418,  326, 2416, 2402, 2408, 2415, 2451,
+     2396, 2397, 2400, 2397, 2396,  465, 2391, 2405, 2404, 2403,
+     2406, 2388, 2396, 2384,  551, 2625, 2625,  552, 2625, 2625,
+     2382,    0,  524, 2429,  565, 2440, 2625,  540, 2625, 2439,
+     2625, 2433,  614, 2625, 2395,  563, 2372, 2375, 2392, 2380,
+     2432, 2387, 2382, 2385, 2380,   80, 2625, 2382,  599, 2421,
+     2379, 2376, 2377,  595, 2381, 2421, 2369, 2364, 2361, 2357,
+     2359, 2410, 2367, 2371, 2355, 2371, 2355, 2404, 2350,  637,
+     2363, 2363, 2346, 2364, 2346, 2359, 2346, 2340, 2355,  571,
+     2358, 2353, 2338, 2351,  588, 2346, 2349, 2344,  547, 2343,
+
+     2339, 2389,  556,  581, 2343, 2625, 2333, 2381, 2331, 2330,
+     2323, 2325, 2337, 2328, 2317, 2334, 2323, 2328, 2333,  603,
+     2374, 2327,  603, 2332, 2317, 2322, 2325, 2325, 2323, 2312,
+     2312, 2324,  595, 2299, 2300, 2321,  616, 2303, 2300, 2314,
+     2317, 2312, 2298, 2310, 2309, 2308, 2309, 2302, 2305, 2304,
+     2303, 2302,  600, 2345, 2304, 2343, 2342, 2284,  662, 2297,
+     2334, 2625, 2625, 2295,    0,  610, 2337, 2336, 2625, 2335,
+     2625,  643,  691, 2294,  633, 2333, 2281, 2283, 2271, 2625,
+     2276, 2282, 2285, 2268, 2283, 2270, 2269, 2625, 2279,  619,
+     2270, 2267, 2279,  623, 2264, 2266, 2625, 2272, 2257, 2259,
+
+     2270, 2268, 2263,  678, 2305, 2269, 2257, 2302, 2249, 2300,
+     2625, 2247, 2263, 2297, 2301, 2257, 2251, 2245, 2252, 2253,
+     2255, 2243, 2288, 2239, 2238, 2243, 2232, 2231, 2233, 2229,
+     2242,  627, 2224,  628, 2224, 2242, 2216, 2223, 2228, 2221,
+     2237, 2271, 2275, 2625, 2220, 2216, 2272, 2223, 2216, 2221,
+     2215, 2222, 2207, 2217, 2205, 2219, 2208, 2204, 2206, 2201,
+     2194, 2625, 2257, 2625, 2199, 2198, 2191, 2211, 2210, 2206,
+     2245, 2244, 2189, 2194, 2203, 2197, 2191, 2200,  680, 2237,
+     2199, 2182, 2182, 2177, 2173, 2179, 2184, 2177, 2185, 2189,
+     2172, 2230, 2185, 2170, 2222, 2167, 2168, 2167, 2179, 2168,
+
+     2625, 2178, 2625, 2625, 2167, 2625, 2177, 2213, 2172, 2172,
+        0, 2215, 2625, 2625, 2625,  660,  659, 2155,  681, 2625,
+     2173, 2153, 2206, 2151,  634, 2150, 2149, 2148, 2155, 2148,
+     2156, 2159, 2141, 2141, 2156, 2155, 2154, 2153, 2137, 2152,
+     2134, 2181, 2148, 2186, 2130, 2132, 2144, 2144, 2143, 2625,
+     2128,  649, 2125, 2183, 2140, 2137, 2129, 2135, 2126, 2134,
+     2625, 2119, 2130, 2132, 2133, 2115, 2129, 2165,  663, 2110,
+     2128, 2110, 2102, 2107, 2104, 2158, 2119, 2156, 2116, 2115,
+     2116, 2095, 2116, 2104, 2110, 2153, 2108, 2107, 2099, 2090,
+     2625, 2091, 2093, 2625, 2104, 2086, 2099, 2138, 2137,   16,
+
+     2098, 2135, 2080, 2081, 2084, 2085, 2076, 2129, 2625, 2089,
+     2075,  715, 2067, 2076, 2065, 2069, 2085, 2082, 2074, 2119,
+     2071, 2078, 2116, 2625, 2062,   76,  298,  330,  396,  431,
+      563,  600,  615,  636,  615,  684,  687, 2625,  636,  658,
+      674,  725,  677,  680,  679,  681,  721,  683,  674,  678,
+      676, 2625, 2625,  707,  718,  692,  683,  683,  679,  702,
+      745,  704,  691,  745,  707,  747,  748,  702,  698,  703,
+      713,  718,  705,  708,  702,  759,  721,  714,  724,  764,
+      727,  719,  721,  725,  731,  771,  777,  734,  727,  727,
+      738, 2625,  729,  742,  737,  728,  743,  748,  745,  742,
+
+      747,  750,  749,  750,  747,  749,  757,  735,  740,  756,
+      746,  758,  803,  804,  748,  763,  750,  751,  765,  751,
+      761,  808,  755,  768,  817, 2625,  818,  774,  772,  774,
+      770,  764,  784,  820,  821,  784,  773, 2625,  775,  786,
+      775,  788,  790,  834,  777,  836,  793,  780,  795, 2625,
+      789,  783,  837,  792,  796,  781,  792,  805,  784,  790,
+      845,  809,  793,  793,  806,  850,  851,  852,  799,  817,
+      812,  819,  814,  799,  811,  812,  807,  820,  807, 2625,
+      872,  830,  831,  821,  833,  823,  836,  827,  833,  825,
+      878,  854,  831,  842,  843,  888,  838, 2625,  836,  851,
+
+      848,  853,  835,  842,  841,  839,  858,  855,  856,  844,
+      851,  852,  861,  861,  851,  864,  850,  849,  855,  911,
+      853,  854,  860,  876,  859,  913,  868, 2625,  878,  862,
+      871,  880,  872,  874,  885,  883,  928,  870,  872,  887,
+      927,  890,  877,  936,  884,  894,  880,  885,  901,  885,
+      885,  904, 2625,  890, 2625,  904,  907,  904,  894,  906,
+      907,  912,  900,  910,  911,  913, 2625, 2625,  913,  915,
+      902,  920,  907,  903,  906,  907,  925,  912,  912,  963,
+      910,  914,  972, 2625,  973, 2625,  921,  919,  933,  933,
+      978,  932,  980,  928,  927,  931,  925,  985,  938,  928,
+
+      929,  925,  935,  939,  950,  935,  953,  948,  950,  943,
+      945,  946,  958,  948,  963, 1004,  961,  966,  943, 1008,
+      967,  951, 2625,  958,  959,  974,  964,  962, 1012,  959,
+      974, 1015,  993, 1001,  970,  971, 1020, 2625,  986,  974,
+      969,  970,  971,  983,  990,  979,  980,  976,  994,  980,
+      981,  991, 1000, 1036,  991,  986, 1039, 1046, 1003,  995,
+     2625,  999, 1007, 1009,  994, 1010, 1000, 1012, 1006, 1014,
+     1011, 1055, 1009, 1022, 1006, 1007, 2625, 1023, 1026, 1009,
+     1011, 1021, 1070, 1013, 2625, 1013, 1031, 1034, 1028, 1018,
+     1017, 1032, 1037, 1041, 1038, 1024, 1026, 1045, 1029, 1082,
+
+     1040, 1036, 1033, 1039, 1087, 1036, 1089, 1051, 1037, 1055,
+     1050, 1055, 1056, 1042, 1057, 1049, 1045, 1063, 1062, 1049,
+     2625, 2625, 1062, 1058, 1105, 1058, 2625, 1064, 1073, 2625,
+     1068, 1071, 1065, 1118, 2625, 1067, 1072, 1116, 1067, 1068,
+     1080, 1074, 1078, 1076, 1075, 1086, 1131, 1075, 1080, 1134,
+     1135, 1079, 1091, 2625, 1079, 1087, 1085, 2625, 1136, 1098,
+     1084, 1085, 1094, 1106, 1093, 1091, 1105, 1106, 1108, 1123,
+     1128, 1148, 1112, 1097, 1099, 1099, 1119, 1118, 1113, 1110,
+     1099, 1116, 1123, 1166, 1108, 1128, 1121, 1125, 1129, 1112,
+     1173, 1120, 1124, 2625, 1171, 1120, 1119, 1119, 1142, 1139,
+
+     1179, 1128, 1146, 1147, 1131, 1147, 1135, 1143, 1144, 1153,
+     1133, 1148, 1155, 1197, 1198, 1156, 2625, 1152, 1201, 1202,
+     1159, 1154, 1164, 1150, 1150, 1169, 1156, 1153, 1153, 1155,
+     1174, 1157, 1174, 1160, 1160, 1167, 1176, 1164, 1178, 1172,
+     1167, 1174, 1186, 1227, 1174, 1175, 1174, 1175, 1192, 1233,
+     1183, 1187, 1185, 1183, 1178, 1239, 1192, 1241, 1191, 1243,
+     1186, 1194, 1242, 1248, 1201, 2625, 1206, 1199, 1190, 1209,
+     1203, 1198, 1208, 1205, 1210, 1206, 1218, 2625, 1202, 1204,
+     2625, 2625, 1204, 1264, 1203, 1222, 1223, 1225, 1216, 1270,
+     1271, 1224, 1209, 1223, 1231, 1213, 1218, 1218, 1258, 1249,
+
+     1222, 1282, 1239, 1226, 1228, 1245, 1240, 1234, 1245, 1290,
+     1238, 1242, 2625, 1239, 1235, 1252, 1232, 1253, 1243, 2625,
+     1258, 1256, 1259, 1244, 1256, 1261, 1247, 1307, 1261, 1266,
+     1253, 1264, 1252, 1250, 1258, 1257, 1265, 1261, 1279, 1280,
+     1281, 2625, 2625, 1322, 1280, 2625, 1282, 2625, 1267, 1269,
+     1269, 1288, 1289, 1325, 1280, 1273, 1333, 1287, 1335, 1295,
+     1332, 1294, 1295, 1292, 1336, 1300, 1289, 1291, 1297, 1302,
+     1299, 1305, 2625, 1298, 1297, 1291, 1292, 1353, 2625, 1354,
+     1301, 1308, 1352, 1314, 2625, 1306, 2625, 1312, 2625, 1302,
+     1314, 1305, 2625, 1305, 1308, 1322, 1327, 1310, 1321, 1370,
+
+     1327, 1328, 1329, 1369, 1325, 1376, 1329, 1378, 2625, 1325,
+     1380, 1381, 1338, 1340, 2625, 2625, 1323, 1385, 1381, 1345,
+     1329, 1341, 1333, 1361, 1392, 1329, 2625, 1350, 1395, 1342,
+     1357, 1393, 1346, 1346, 2625, 1342, 1358, 1346, 1360, 1361,
+     1358, 1402, 1365, 1369, 1357, 1357, 1412, 1408, 1414, 1371,
+     2625, 1373, 1372, 1374, 1368, 1381, 1422, 1379, 1424, 1381,
+     1378, 1369, 1372, 1372, 2625, 1431, 1378, 1433, 1392, 1435,
+     1378, 1378, 1396, 1440, 1441, 2625, 1442, 2625, 1403, 1384,
+     1440, 1403, 1382, 1397, 1390, 1393, 1392, 1407, 1410, 1409,
+     1407, 1457, 1400, 1415, 1412, 2625, 2625, 1408, 1418, 1403,
+
+     1459, 1421, 1421, 1413, 1425, 1409, 1470, 1471, 1415, 1425,
+     1474, 1431, 2625, 1423, 1423, 1425, 1427, 1480, 1423, 2625,
+     1424, 2625, 1426, 2625, 2625, 1439, 1441, 1442, 2625, 1429,
+     1437, 1489, 1438, 1451, 1471, 2625, 1438, 1489, 2625, 1437,
+     1445, 1439, 1436, 1494, 1440, 1443, 1443, 1439, 1461, 1500,
+     1453, 1465, 1468, 1450, 1510, 1458, 2625, 1453, 2625, 1455,
+     1514, 1468, 1459, 1474, 1468, 2625, 1475, 2625, 1478, 1478,
+     1475, 1519, 1481, 2625, 1473, 2625, 1483, 2625, 1484, 1481,
+     1476, 2625, 2625, 2625, 1473, 1473, 1473, 1529, 1491, 1492,
+     1489, 1533, 1481, 1535, 1497, 1537, 1499, 1491, 2625, 1545,
+
+     1488, 1490, 1490, 1496, 1495, 1493, 1547, 1509, 1497, 1550,
+     1511, 2625, 2625, 1552, 1499, 2625, 1516, 1501, 1501, 1503,
+     1509, 2625, 1564, 1506, 1516, 1527, 1525, 1569, 1522, 1531,
+     2625, 1528, 1532, 1548, 1531, 1517, 1577, 1578, 1535, 1540,
+     1522, 1523, 1583, 1584, 1585, 1581, 1545, 1542, 1538, 1531,
+     1543, 2625, 1533, 1546, 1594, 2625, 1532, 1591, 1554, 1599,
+     1552, 1597, 1545, 1550, 1548, 1607, 1563, 1554, 1610, 1557,
+     1552, 1569, 1566, 1556, 1565, 1617, 1578, 1567, 1561, 1621,
+     1563, 1564, 1573, 1566, 1580, 2625, 1568, 1584, 1629, 1571,
+     1588, 1584, 1578, 1575, 1571, 1585, 1592, 1576, 1634, 1635,
+
+     1636, 1583, 1638, 1601, 2625, 1601, 1588, 1587, 1643, 2625,
+     1584, 1602, 1651, 1604, 1622, 1654, 1607, 2625, 2625, 1656,
+     1609, 1594, 1659, 2625, 2625, 2625, 1605, 1610, 1608, 1658,
+     1616, 1622, 1613, 1611, 1612, 2625, 1670, 1616, 1667, 2625,
+     1610, 1615, 1676, 1624, 1634, 1635, 2625, 1680, 1634, 1624,
+     2625, 1631, 1632, 1686, 1636, 1640, 1641, 2625, 1632, 1647,
+     1635, 2625, 1636, 1646, 1647, 1648, 1697, 1693, 1656, 2625,
+     1695, 1661, 1637, 1663, 1656, 1700, 1658, 1659, 1668, 1650,
+     1656, 1658, 1712, 1671, 1671, 1663, 1717, 1667, 1671, 1676,
+     1669, 2625, 1671, 1723, 2625, 1672, 2625, 1725, 1667, 1672,
+
+     2625, 1671, 1681, 1725, 1673, 1688, 1675, 1681, 1681, 1692,
+     2625, 1686, 1681, 1680, 1740, 1693, 2625, 1737, 1688, 1685,
+     2625, 1699, 1698, 1742, 1689, 2625, 1701, 1699, 1706, 1708,
+     1753, 1706, 1707, 1704, 1712, 1706, 2625, 1717, 1760, 1701,
+     1703, 1719, 1707, 1713, 1708, 1722, 1705, 1721, 1722, 1716,
+     1732, 2625, 1722, 1774, 1733, 2625, 1717, 1724, 1778, 1774,
+     1732, 2625, 1737, 2625, 1777, 1739, 1740, 1741, 1726, 1727,
+     1735, 1789, 1785, 1740, 1752, 1749, 1740, 1747, 2625, 1744,
+     1749, 1747, 1799, 1800, 1747, 1761, 1759, 1739, 1757, 1762,
+     1749, 2625, 1764, 1765, 1766, 1767, 1768, 1759, 2625, 1759,
+
+     1771, 1816, 1777, 1774, 1771, 1776, 1821, 1763, 1771, 1765,
+     1773, 1786, 2625, 1763, 1823, 1784, 2625, 1788, 1772, 1774,
+     1774, 1834, 1790, 1783, 1782, 1793, 1780, 2625, 1785, 1841,
+     1799, 1790, 1802, 1793, 1802, 1804, 1808, 2625, 2625, 1796,
+     1790, 1794, 1812, 1788, 1795, 1855, 1798, 1799, 1858, 1800,
+     1860, 1808, 1819, 1863, 2625, 1812, 1865, 1801, 1808, 2625,
+     1863, 1825, 1822, 1827, 1814, 1873, 1816, 1821, 1812, 1813,
+     1878, 1831, 2625, 1832, 1822, 1839, 1838, 1879, 1841, 2625,
+     1838, 1887, 1844, 1845, 1890, 1847, 1850, 1888, 1852, 1837,
+     1837, 1857, 1850, 2625, 1899, 1900, 2625, 1853, 2625, 1857,
+
+     1863, 2625, 1860, 2625, 1861, 1858, 1848, 1908, 1855, 1910,
+     1853, 2625, 1872, 1913, 1872, 1915, 2625, 1864, 1854, 1913,
+     1879, 1872, 1868, 1865, 1870, 2625, 1866, 1868, 2625, 1873,
+     1883, 1873, 1879, 1930, 1883, 1873, 1881, 2625, 2625, 1882,
+     1887, 1877, 1878, 1938, 1887, 1892, 2625, 1888, 2625, 1898,
+     1891, 2625, 1893, 2625, 1901, 1946, 1887, 1889, 1886, 1910,
+     1903, 1906, 1895, 1949, 1896, 1904, 1917, 1914, 2625, 1905,
+     1912, 1917, 1918, 1917, 1920, 1921, 2625, 1922, 1915, 1910,
+     1911, 1915, 1927, 1972, 2625, 1918, 1930, 1975, 1924, 1923,
+     1978, 1931, 1918, 1933, 1938, 1926, 1925, 1932, 1932, 1987,
+
+     1988, 1929, 1990, 1934, 1992, 1949, 1994, 1995, 1945, 1939,
+     2625, 1955, 1999, 2625, 1956, 1958, 2625, 1949, 1963, 1959,
+     1952, 1966, 1949, 2008, 1956, 2625, 2625, 1953, 2625, 1953,
+     2625, 2012, 2625, 2625, 1969, 2014, 1975, 2625, 2016, 2017,
+     1972, 1971, 1972, 1962, 1970, 2023, 2625, 2024, 1985, 2026,
+     2625, 2022, 2625, 1969, 2625, 2625, 2029, 1971, 1987, 2032,
+     1989, 2625, 2625, 1975, 2625, 1995, 1992, 2625, 2033, 1982,
+     2625, 1981, 1993, 1996, 1989, 2044, 1986, 1988, 2003, 1994,
+     2005, 1990, 2625, 2003, 2052, 1996, 2001, 2055, 2003, 2005,
+     2625, 2000, 2054, 2625, 2001, 2017, 2062, 2018, 2064, 2065,
+
+     2625, 2009, 2625, 2625, 2013, 2016, 2064, 2020, 2027, 2032,
+     2068, 2021, 2031, 2017, 2035, 2024, 2026, 2035, 2081, 2625,
+     2625, 2087, 2092, 2097, 2102, 2107, 2112, 2117, 2120, 2094,
+     2099, 2101, 2114
     } ;
 
-static const flex_int16_t yy_def[2130] =
+static const flex_int16_t yy_def[2234] =
     {   0,
-     2118, 2118, 2119, 2119, 2118, 2118, 2118, 2118, 2118, 2118,
-     2117, 2117, 2117, 2117, 2117, 2120, 2117, 2117, 2117, 2117,
-     2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117,
-     2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2121,
-     2117, 2117, 2117, 2122,   15, 2117,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 2123,   45,   45,   45,
+     2222, 2222, 2223, 2223, 2222, 2222, 2222, 2222, 2222, 2222,
+     2221, 2221, 2221, 2221, 2221, 2224, 2221, 2221, 2221, 2221,
+     2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221,
+     2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2225,
+     2221, 2221, 2221, 2226,   15, 2221,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 2227,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 2120, 2117, 2117,
-     2117, 2117, 2117, 2117, 2124, 2117, 2117, 2117, 2117, 2117,
-     2117, 2117, 2117, 2117, 2117, 2117, 2121, 2117, 2122, 2117,
+       45,   45,   45,   45,   45,   45,   45,   45, 2224, 2221,
+     2221, 2221, 2221, 2221, 2221, 2228, 2221, 2221, 2221, 2221,
+     2221, 2221, 2221, 2221, 2221, 2221, 2221, 2225, 2221, 2226,
 
-     2117,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 2125,   45, 2123,   45,   45,   45,   45,   45,
+     2221, 2221,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 2229,   45, 2227,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 2124, 2117, 2117, 2117, 2117,
-     2117, 2117, 2117, 2117, 2126,   45,   45, 2117,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 2228,
+     2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2230,   45,
 
-     2117,   45,   45,   45,   45,   45,   45, 2125, 2117, 2123,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 2221,   45,   45, 2221,   45,   45,   45,   45,   45,
+       45, 2229, 2221, 2227,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 2117,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 2221,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
@@ -1255,226 +1279,238 @@ static const flex_int16_t yy_def[2130] =
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 2117, 2117, 2117,
-     2117, 2117, 2117, 2117, 2127,   45,   45,   45,   45, 2117,
-       45, 2117,   45, 2117,   45, 2123, 2117,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 2117,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 2221, 2221, 2221, 2221, 2221, 2221,
+     2221, 2231,   45,   45,   45,   45, 2221,   45, 2221,   45,
+     2221,   45, 2227, 2221,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 2221,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 2117,   45,   45,   45,
 
+       45,   45,   45,   45,   45, 2221,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 2117, 2117, 2117, 2128,   45,   45,   45, 2117,   45,
-     2117,   45, 2123,   45,   45,   45,   45,   45,   45, 2117,
-       45,   45,   45,   45,   45,   45,   45, 2117,   45,   45,
-       45,   45,   45,   45,   45,   45, 2117,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 2117,   45,
+       45, 2221, 2221, 2221, 2232,   45,   45,   45, 2221,   45,
+     2221,   45, 2227,   45,   45,   45,   45,   45,   45, 2221,
+       45,   45,   45,   45,   45,   45,   45, 2221,   45,   45,
+       45,   45,   45,   45,   45,   45, 2221,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     2221,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 2117,
+       45,   45,   45, 2221,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 2117,   45, 2117,
+       45, 2221,   45, 2221,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 2117,   45, 2117, 2117,
-       45, 2117,   45,   45, 2117, 2129,   45, 2117, 2117, 2117,
 
-       45,   45,   45,   45, 2117,   45,   45,   45,   45,   45,
+     2221,   45, 2221, 2221,   45, 2221,   45,   45,   45, 2221,
+     2233,   45, 2221, 2221, 2221,   45,   45,   45,   45, 2221,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 2117,   45,   45,   45,   45,   45,
-       45,   45,   45, 2117,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 2221,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     2221,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 2117,   45,   45, 2117,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 2117,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     2221,   45,   45, 2221,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45,   45, 2117,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 2117,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 2221,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 2117, 2117,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 2221,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 2221,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 2221, 2221,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 2117,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 2117,   45,
+       45, 2221,   45,   45,   45,   45,   45,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     2117,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 2117,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 2221,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 2221,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 2221,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 2117,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 2117,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 2221,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 2117,
+       45,   45,   45,   45,   45,   45,   45, 2221,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 2117,   45, 2117,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 2117, 2117,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 2117,   45,
-     2117,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 2221,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 2117,   45,   45,
+       45,   45, 2221,   45, 2221,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 2221, 2221,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 2221,   45, 2221,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45, 2117,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 2117,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 2117,   45,   45,
-       45,   45,   45,   45,   45, 2117,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 2221,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 2221,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 2117, 2117,   45,
-       45,   45,   45, 2117,   45,   45, 2117,   45,   45,   45,
-       45, 2117,   45,   45,   45,   45,   45,   45,   45,   45,
+     2221,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 2221,   45,   45,   45,
+       45,   45,   45,   45, 2221,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     2117,   45,   45,   45, 2117,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     2221, 2221,   45,   45,   45,   45, 2221,   45,   45, 2221,
+       45,   45,   45,   45, 2221,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 2221,   45,   45,   45, 2221,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 2117,
+       45,   45,   45, 2221,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 2221,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 2117,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 2221,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 2221,   45,   45,
+     2221, 2221,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 2117,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 2117,   45,   45, 2117,
-     2117,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 2221,   45,   45,   45,   45,   45,   45, 2221,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 2221, 2221,   45,   45, 2221,   45, 2221,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     2117,   45,   45,   45,   45,   45,   45, 2117,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 2117, 2117,   45,   45,
-     2117,   45, 2117,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 2221,   45,   45,   45,   45,   45, 2221,   45,
+       45,   45,   45,   45, 2221,   45, 2221,   45, 2221,   45,
+       45,   45, 2221,   45,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45, 2221,   45,
+       45,   45,   45,   45, 2221, 2221,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 2221,   45,   45,   45,
+       45,   45,   45,   45, 2221,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     2221,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 2221,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 2221,   45, 2221,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 2221, 2221,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 2117,   45,   45,   45,   45,   45, 2117,
-       45,   45,   45,   45,   45, 2117,   45, 2117,   45, 2117,
-       45,   45,   45, 2117,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 2117,
-       45,   45,   45,   45,   45, 2117, 2117,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 2117,   45,   45,   45,
-       45,   45,   45,   45, 2117,   45,   45,   45,   45,   45,
+       45,   45, 2221,   45,   45,   45,   45,   45,   45, 2221,
+       45, 2221,   45, 2221, 2221,   45,   45,   45, 2221,   45,
+       45,   45,   45,   45,   45, 2221,   45,   45, 2221,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     2117,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 2221,   45, 2221,   45,
+       45,   45,   45,   45,   45, 2221,   45, 2221,   45,   45,
+       45,   45,   45, 2221,   45, 2221,   45, 2221,   45,   45,
+       45, 2221, 2221, 2221,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 2221,   45,
 
-       45, 2117,   45,   45,   45,   45,   45,   45,   45,   45,
-     2117,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 2117, 2117,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 2117,   45,   45,   45,   45,
-       45,   45, 2117,   45, 2117,   45, 2117, 2117,   45,   45,
-       45, 2117,   45,   45,   45,   45,   45, 2117,   45,   45,
-     2117,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 2117,   45,
-     2117,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45, 2117,   45, 2117,   45, 2117,   45, 2117, 2117,
+       45, 2221, 2221,   45,   45, 2221,   45,   45,   45,   45,
+       45, 2221,   45,   45,   45,   45,   45,   45,   45,   45,
+     2221,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 2117,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 2117, 2117,   45,
-       45, 2117,   45,   45,   45,   45,   45, 2117,   45,   45,
-       45,   45,   45,   45,   45,   45, 2117,   45,   45,   45,
+       45, 2221,   45,   45,   45, 2221,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 2117,   45,   45,   45,
-     2117,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 2221,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45,   45,   45,   45,   45, 2117,   45,   45,
+       45,   45,   45,   45, 2221,   45,   45,   45,   45, 2221,
+       45,   45,   45,   45,   45,   45,   45, 2221, 2221,   45,
+       45,   45,   45, 2221, 2221, 2221,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 2221,   45,   45,   45, 2221,
+       45,   45,   45,   45,   45,   45, 2221,   45,   45,   45,
+     2221,   45,   45,   45,   45,   45,   45, 2221,   45,   45,
+       45, 2221,   45,   45,   45,   45,   45,   45,   45, 2221,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 2117,   45,   45,   45,
-       45, 2117,   45,   45,   45,   45,   45,   45, 2117, 2117,
-       45,   45,   45,   45, 2117, 2117, 2117,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 2117,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 2117,   45,   45,   45,
-     2117,   45,   45,   45,   45, 2117,   45,   45,   45, 2117,
-       45,   45,   45,   45,   45,   45,   45, 2117,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 2221,   45,   45, 2221,   45, 2221,   45,   45,   45,
 
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 2117,
-       45, 2117,   45, 2117,   45,   45,   45, 2117,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 2117,   45,   45,
-       45,   45,   45, 2117,   45,   45,   45, 2117,   45,   45,
-     2117,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 2117,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 2117,   45,   45,   45,
-     2117,   45,   45,   45,   45, 2117,   45, 2117,   45,   45,
+     2221,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     2221,   45,   45,   45,   45,   45, 2221,   45,   45,   45,
+     2221,   45,   45,   45,   45, 2221,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 2221,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 2221,   45,   45,   45, 2221,   45,   45,   45,   45,
+       45, 2221,   45, 2221,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 2221,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 2117,   45,   45,   45,   45,   45,   45,   45,
+       45, 2221,   45,   45,   45,   45,   45,   45, 2221,   45,
 
-       45,   45,   45, 2117,   45,   45,   45,   45,   45,   45,
-     2117,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 2117,   45,   45,   45, 2117,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 2117,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 2117, 2117,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 2117,   45,   45,   45,   45, 2117,   45,
+       45,   45, 2221,   45,   45,   45, 2221,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 2221,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 2221, 2221,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     2117,   45,   45,   45,   45,   45,   45, 2117,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 2117,
-
-       45,   45, 2117,   45, 2117,   45,   45, 2117,   45, 2117,
-       45,   45,   45,   45,   45,   45,   45, 2117,   45,   45,
-       45, 2117,   45,   45,   45,   45,   45,   45,   45,   45,
-     2117,   45,   45, 2117,   45,   45,   45,   45,   45,   45,
-     2117, 2117,   45,   45,   45,   45,   45,   45,   45, 2117,
-       45, 2117,   45,   45, 2117,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 2221,   45,   45,   45,   45, 2221,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 2117,   45,   45,   45,
-       45,   45,   45,   45, 2117,   45,   45,   45,   45,   45,
+       45,   45, 2221,   45,   45,   45,   45,   45,   45, 2221,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 2221,   45,   45, 2221,   45, 2221,   45,
+
+       45, 2221,   45, 2221,   45,   45,   45,   45,   45,   45,
+       45, 2221,   45,   45,   45,   45, 2221,   45,   45,   45,
+       45,   45,   45,   45,   45, 2221,   45,   45, 2221,   45,
+       45,   45,   45,   45,   45,   45,   45, 2221, 2221,   45,
+       45,   45,   45,   45,   45,   45, 2221,   45, 2221,   45,
+       45, 2221,   45, 2221,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 2221,   45,
+       45,   45,   45,   45,   45,   45, 2221,   45,   45,   45,
+       45,   45,   45,   45, 2221,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 2117,
-       45,   45, 2117,   45,   45, 2117,   45,   45,   45,   45,
-       45,   45,   45, 2117, 2117,   45, 2117,   45, 2117,   45,
-     2117, 2117,   45,   45,   45, 2117,   45,   45,   45,   45,
-       45,   45,   45, 2117,   45,   45,   45, 2117,   45, 2117,
-       45, 2117, 2117,   45,   45,   45,   45,   45, 2117,   45,
-     2117,   45,   45, 2117,   45,   45, 2117,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 2117,   45,
-       45,   45,   45,   45,   45,   45, 2117,   45,   45, 2117,
-       45,   45,   45,   45,   45,   45, 2117,   45, 2117, 2117,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 2117,    0, 2117, 2117, 2117,
-     2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117
+     2221,   45,   45, 2221,   45,   45, 2221,   45,   45,   45,
+       45,   45,   45,   45,   45, 2221, 2221,   45, 2221,   45,
+     2221,   45, 2221, 2221,   45,   45,   45, 2221,   45,   45,
+       45,   45,   45,   45,   45,   45, 2221,   45,   45,   45,
+     2221,   45, 2221,   45, 2221, 2221,   45,   45,   45,   45,
+       45, 2221, 2221,   45, 2221,   45,   45, 2221,   45,   45,
+     2221,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 2221,   45,   45,   45,   45,   45,   45,   45,
+     2221,   45,   45, 2221,   45,   45,   45,   45,   45,   45,
+
+     2221,   45, 2221, 2221,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 2221,
+        0, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221,
+     2221, 2221, 2221
     } ;
 
-static const flex_int16_t yy_nxt[2594] =
+static const flex_int16_t yy_nxt[2699] =
     {   0,
-     2117,   13,   14,   13, 2117,   15,   16, 2117,   17,   18,
+     2221,   13,   14,   13, 2221,   15,   16, 2221,   17,   18,
        19,   20,   21,   22,   22,   22,   22,   22,   23,   24,
-       84,  811,   37,   14,   37,   85,   25,   26,   38,  100,
-     2117,   27,   37,   14,   37,   42,   28,   42,   38,   90,
-       91,   29,  200,   30,   13,   14,   13,   89,   90,   25,
-       31,   91,   13,   14,   13,   13,   14,   13,   32,   40,
-      812,   13,   14,   13,   33,   40,  101,   90,   91,  200,
-       89,   34,   35,   13,   14,   13,   93,   15,   16,   94,
+       85,  838,   37,   14,   37,   86,   25,   26,   38,  101,
+     2221,   27,   37,   14,   37,   42,   28,   42,   38,   91,
+       92,   29,  204,   30,   13,   14,   13,   90,   91,   25,
+       31,   92,   13,   14,   13,   13,   14,   13,   32,   40,
+      839,   13,   14,   13,   33,   40,  102,   91,   92,  204,
+       90,   34,   35,   13,   14,   13,   94,   15,   16,   95,
        17,   18,   19,   20,   21,   22,   22,   22,   22,   22,
-       23,   24,   13,   14,   13,   89,   39,  102,   25,   26,
+       23,   24,   13,   14,   13,   90,   39,  103,   25,   26,
 
-       13,   14,   13,   27,   39,   42,  105,   42,   28,   42,
-      106,   42,   41,   29,  108,   30,  111,  112,   92,  134,
-       41,   25,   31,  102,  135,  475,   87,  136,   87,  105,
-       32,   88,   88,   88,   88,   88,   33,  108,  106,  111,
-      856,  112,  476,   34,   35,   44,   44,   44,   45,   45,
+       13,   14,   13,   27,   39,   42,  106,   42,   28,   42,
+      107,   42,   41,   29,  109,   30,  112,  113,   93,  137,
+       41,   25,   31,  103,  138,  485,   88,  139,   88,  106,
+       32,   89,   89,   89,   89,   89,   33,  109,  107,  112,
+      865,  113,  486,   34,   35,   44,   44,   44,   45,   45,
        46,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   47,   45,   45,
        48,   49,   50,   45,   51,   52,   53,   45,   45,   45,
@@ -1482,289 +1518,300 @@ static const flex_int16_t yy_nxt[2594] =
        58,   45,   59,   60,   61,   62,   63,   64,   65,   51,
 
        66,   67,   68,   69,   70,   71,   72,   73,   74,   75,
-       76,   77,   56,   45,   45,   45,   45,   45,   79,  742,
-       80,   80,   80,   80,   80,   79,  102,   82,   82,   82,
-       82,   82,  207,   81,   83,   83,   83,   83,   83,   79,
-       81,   82,   82,   82,   82,   82,  105,   81,  118,  166,
-      109,  129,  116,  167,   81,  207,   81,  204,  117,  119,
-      110,  130,  120,   81,  121,  132,  122,  201,  187,  105,
-       81,  188,  133,  109,  743,  214,  320,   81,   45,  215,
-      131,   45,   45,   45,  204,   45,   45,   45,  110,  114,
-      137,  857,   45,   45,  187,   45,   45,  188,  202,  320,
-
-      138,   45,  139,   45,   45,   45,   45,   45,   45,   45,
+       76,   77,   78,   45,   45,   45,   45,   45,   80,  237,
+       81,   81,   81,   81,   81,   80,  103,   83,   83,   83,
+       83,   83,  238,   82,   84,   84,   84,   84,   84,   80,
+       82,   83,   83,   83,   83,   83,  112,   82,  119,  169,
+      110,  130,  117,  170,   82,  140,   82,  106,  118,  120,
+      111,  131,  121,   82,  122,  141,  123,  142,  191,  112,
+       82,  192,  193,  110,  239,  344,  191,   82,   45,  186,
+      106,   45,   45,   45,  187,   45,   45,   45,  111,  115,
+      240,  132,   45,   45,  191,   45,   45,  192,  133,  192,
+
+      193,   45,  194,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,  123,  189,   45,  124,  125,  320,
-       45,  126,  127,  141,   45,  146,  187,  142,  143,  147,
-      244,  144,   45,  148,  128,  108,   45,  145,   45,  115,
-      233,  217,  323,  189,  111,  149,  188,  155,  189,  150,
-      218,  219,  190,  234,  151,  156,  152,  157,  153,  176,
-      177,  160,  158,  159,  161,  162,  168,  111,  154,  109,
-      169,  196,  191,  170,  245,  163,  192,  183,  164,  110,
-      171,  172,  184,  531,  173,  174,  175,   83,   83,   83,
-
-       83,   83,  178,  532,  179,  246,  247,  180,  181,  196,
-       81,   88,   88,   88,   88,   88,   79,  110,   80,   80,
-       80,   80,   80,  858,  182,   88,   88,   88,   88,   88,
-       87,   81,   87,   81,  100,   88,   88,   88,   88,   88,
-       79,  199,   82,   82,   82,   82,   82,   83,   83,   83,
-       83,   83,   99,  203,   81,   81,  205,  267,  206,   99,
-       81,  235,  196,  224,  225,  859,  203,  199,  230,  239,
-      231,  101,  240,  226,  305,  255,  241,  236,   81,  211,
-      204,  203,  285,   81,  205,  206,  286,  232,  306,   99,
-      212,  256,  278,   99,  264,  279,  257,   99,  280,  281,
-
-      860,  337,  318,  268,  272,   99,  288,  310,  319,   99,
-      319,   99,  195,  210,  210,  210,  210,  210,  861,  273,
-      274,  275,  210,  210,  210,  210,  210,  210,  282,  298,
-      318,  329,  283,  299,  319,  318,  322,  300,  284,  326,
-      328,  289,  290,  291,  331,  210,  210,  210,  210,  210,
-      210,  333,  292,  335,  293,  338,  294,  295,  329,  296,
-      401,  662,  326,  321,  326,  346,  386,  331,  328,  423,
-      456,  663,  424,  347,  333,  331,  432,  452,  348,  349,
-      335,  336,  336,  336,  336,  336,  452,  339,  458,  433,
-      336,  336,  336,  336,  336,  336,  332,  460,  395,  456,
-
-      452,  444,  456,  478,  862,  460,  484,  548,  479,  453,
-      402,  458,  485,  336,  336,  336,  336,  336,  336,  387,
-      552,  625,  388,  865,  553,  460,  463,  463,  463,  463,
-      463,  465,  517,  533,  626,  463,  463,  463,  463,  463,
-      463,  499,  597,  853,  597,  526,  500,  518,  519,  520,
-      521,  527,  563,  522,  585,  854,  564,  586,  463,  463,
-      463,  463,  463,  463,  568,  549,  592,  735,  569,  617,
-      597,  593,  604,  601,  659,  602,  866,  618,  635,  619,
-      620,  621,  705,  636,  734,  733,  864,  706,  660,  867,
-      737,  783,  784,  863,  501,  735,  868,  869,  870,  502,
-
-      601,  874,  602,   45,   45,   45,   45,   45,  875,  864,
-      876,  734,   45,   45,   45,   45,   45,   45,  823,  871,
-      872,  863,  873,  824,  877,  878,  879,  880,  881,  882,
-      883,  884,  885,  886,  887,   45,   45,   45,   45,   45,
-       45,  888,  889,  890,  891,  892,  893,  896,  897,  898,
-      894,  899,  900,  901,  895,  902,  903,  904,  905,  906,
-      907,  908,  825,  909,  910,  911,  912,  913,  914,  915,
-      916,  917,  918,  920,  921,  922,  923,  919,  924,  925,
-      926,  927,  929,  930,  928,  931,  932,  933,  934,  935,
-      936,  937,  938,  939,  940,  941,  942,  943,  944,  945,
-
-      946,  947,  948,  949,  950,  951,  952,  953,  954,  955,
-      956,  957,  958,  959,  960,  961,  962,  963,  964,  965,
-      966,  967,  968,  969,  970,  971,  972,  973,  974,  975,
-      977,  978,  981,  982,  983,  985,  976,  986,  979,  987,
-      984,  988,  980,  989,  990,  991,  992,  993,  994,  995,
-      996,  997,  998,  999, 1000, 1001, 1002, 1003, 1004, 1005,
-     1006, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015,
-     1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025,
-      998, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034,
-     1035, 1036, 1037, 1038, 1040, 1041, 1042, 1043, 1039, 1044,
+       45,   45,   45,   45,  124,  195,   45,  125,  126,  345,
+       45,  127,  128,  149,   45,  101,  273,  150,  134,  203,
+      109,  151,   45,  205,  129,  135,   45,  866,   45,  116,
+      144,  136,  158,  152,  145,  146,  193,  153,  147,  154,
+      159,  155,  160,  156,  148,  203,  163,  161,  162,  164,
+      165,  171,  102,  157,  206,  172,  113,  218,  173,  441,
+      166,  219,  274,  167,  196,  174,  175,  179,  180,  176,
+      177,  178,  442,  189,  867,  200,  207,  110,  252,  253,
+
+      113,   84,   84,   84,   84,   84,   80,  111,   81,   81,
+       81,   81,   81,   80,   82,   83,   83,   83,   83,   83,
+      181,   82,  182,  200,  207,  183,  184,  100,   82,   89,
+       89,   89,   89,   89,  100,  111,  208,   82,  209,  211,
+      210,   88,  185,   88,   82,  868,   89,   89,   89,   89,
+       89,   82,   84,   84,   84,   84,   84,   89,   89,   89,
+       89,   89,  211,  208,  100,   82,  209,  210,  100,  221,
+      339,  250,  100,  228,  229,  453,  869,  200,  222,  223,
+      100,  207,  432,  230,  100,  433,  100,  199,   82,  214,
+      214,  214,  214,  214,  215,  234,  261,  235,  214,  214,
+
+      214,  214,  214,  214,  245,  216,  288,  246,  294,  270,
+      289,  247,  262,  278,  236,  251,  290,  263,  327,  311,
+      208,  214,  214,  214,  214,  214,  214,  325,  279,  280,
+      281,  284,  291,  312,  285,  325,  292,  286,  287,  326,
+      326,  327,  304,  295,  296,  297,  305,  316,  327,  333,
+      306,  335,  338,  336,  298,  325,  299,  342,  300,  301,
+      340,  302,  410,  328,  466,  326,  329,  333,  353,  338,
+      395,  330,  333,  870,  470,  338,  354,  462,  462,  335,
+      336,  355,  356,  340,  342,  343,  343,  343,  343,  343,
+      346,  468,  404,  466,  343,  343,  343,  343,  343,  343,
+
+      462,  463,  470,  466,  488,  494,  545,  540,  562,  489,
+      871,  495,  411,  541,  468,  470,  546,  343,  343,  343,
+      343,  343,  343,  396,  524,  872,  397,  473,  473,  473,
+      473,  473,  475,  531,  525,  526,  473,  473,  473,  473,
+      473,  473,  511,  547,  762,  612,  873,  512,  532,  533,
+      534,  535,  566,  577,  536,  599,  567,  578,  600,  473,
+      473,  473,  473,  473,  473,  582,  563,  606,  612,  583,
+      632,  640,  607,  612,  616,  678,  617,  681,  633,  874,
+      634,  635,  636,  650,  641,  724,  753,  682,  651,  679,
+      725,  757,  754,  755,  875,  513,  619,  876,  877,  763,
+
+      514,  616,  789,  617,   45,   45,   45,   45,   45,  790,
+      806,  807,  808,   45,   45,   45,   45,   45,   45,  754,
+      850,  755,  878,  879,  882,  851,  809,  883,  884,  885,
+      880,  886,  887,  888,  889,  890,   45,   45,   45,   45,
+       45,   45,  881,  891,  892,  893,  894,  895,  896,  897,
+      898,  899,  900,  902,  901,  903,  904,  905,  906,  907,
+      908,  909,  910,  911,  852,  912,  913,  892,  914,  915,
+      916,  891,  917,  918,  919,  920,  921,  924,  925,  926,
+      922,  927,  928,  929,  923,  930,  931,  932,  933,  934,
+      935,  936,  937,  938,  939,  940,  941,  942,  943,  944,
+
+      945,  946,  947,  948,  949,  950,  951,  952,  953,  955,
+      956,  957,  958,  954,  959,  960,  961,  962,  964,  965,
+      963,  966,  967,  968,  969,  970,  971,  972,  973,  974,
+      975,  976,  977,  978,  979,  980,  981,  982,  983,  984,
+      985,  986,  987,  988,  989,  990,  991,  992,  993,  994,
+      995,  996,  997,  998,  999, 1000, 1001, 1002, 1003, 1004,
+     1005, 1006, 1007, 1008, 1009, 1010, 1012, 1013, 1016, 1017,
+     1018, 1020, 1011, 1021, 1014, 1022, 1019, 1023, 1015, 1024,
+     1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034,
+     1035, 1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044,
 
      1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054,
-     1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064,
-     1065, 1066, 1067, 1068, 1069, 1070, 1071, 1073, 1074, 1075,
-     1072, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084,
-     1085, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095,
-     1096, 1097, 1098, 1099, 1086, 1100, 1101, 1102, 1103, 1104,
-     1105, 1106, 1107, 1109, 1110, 1111, 1112, 1113, 1114, 1115,
-     1116, 1117, 1118, 1119, 1108, 1120, 1121, 1122, 1123, 1124,
-     1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134,
-     1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144,
-
-     1145, 1146, 1147, 1148, 1149, 1127, 1150, 1151, 1126, 1152,
-     1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162,
-     1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1173, 1174,
-     1175, 1176, 1171, 1177, 1178, 1179, 1180, 1181, 1182, 1183,
+     1055, 1056, 1057, 1058, 1059, 1060, 1061, 1034, 1062, 1063,
+     1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073,
+     1074, 1075, 1076, 1077, 1079, 1080, 1081, 1082, 1078, 1083,
+     1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093,
+     1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+     1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113,
+     1114, 1116, 1117, 1118, 1115, 1119, 1120, 1121, 1122, 1123,
+     1124, 1125, 1126, 1127, 1128, 1130, 1131, 1132, 1133, 1134,
+     1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1129, 1143,
+
+     1144, 1145, 1146, 1147, 1148, 1149, 1150, 1152, 1153, 1154,
+     1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1151, 1163,
+     1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173,
+     1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183,
      1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193,
-     1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1204,
-     1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1203,
-     1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223,
-     1224, 1225, 1226, 1227, 1228, 1172, 1229, 1230, 1231, 1232,
+     1171, 1194, 1195, 1170, 1196, 1197, 1198, 1199, 1200, 1201,
+     1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211,
+     1212, 1213, 1214, 1215, 1216, 1217, 1220, 1221, 1222, 1223,
+     1218, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232,
      1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242,
 
-     1243, 1244, 1245, 1246, 1247, 1249, 1248, 1250, 1251, 1252,
-     1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262,
-     1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272,
-     1273, 1274, 1247, 1248, 1275, 1276, 1277, 1278, 1279, 1280,
-     1281, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290,
-     1291, 1293, 1295, 1296, 1297, 1292, 1298, 1299, 1300, 1301,
+     1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252,
+     1253, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263,
+     1264, 1254, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272,
+     1273, 1274, 1275, 1219, 1276, 1277, 1278, 1279, 1280, 1281,
+     1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291,
+     1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1301, 1300,
      1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311,
      1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321,
-     1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331,
-     1332, 1333, 1334, 1335, 1336, 1294, 1337, 1338, 1339, 1340,
+     1322, 1323, 1324, 1325, 1326, 1299, 1300, 1327, 1328, 1329,
+     1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339,
 
-     1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350,
-     1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360,
+     1340, 1341, 1342, 1343, 1344, 1345, 1346, 1348, 1350, 1351,
+     1352, 1347, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360,
      1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370,
      1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380,
-     1381, 1382, 1383, 1384, 1385, 1386, 1364, 1387, 1388, 1389,
-     1390, 1391, 1365, 1392, 1393, 1394, 1395, 1396, 1397, 1398,
-     1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408,
-     1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418,
-     1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428,
-     1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438,
-
-     1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448,
-     1449, 1450, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459,
-     1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469,
-     1470, 1471, 1473, 1474, 1475, 1476, 1477, 1478, 1479, 1480,
-     1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490,
-     1491, 1492, 1493, 1494, 1495, 1467, 1496, 1497, 1498, 1499,
-     1500, 1501, 1502, 1503, 1451, 1504, 1505, 1506, 1507, 1508,
-     1509, 1510, 1511, 1512, 1513, 1472, 1514, 1515, 1516, 1518,
-     1519, 1520, 1521, 1522, 1523, 1524, 1517, 1525, 1526, 1527,
-     1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537,
-
-     1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547,
-     1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557,
-     1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567,
-     1568, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577,
-     1578, 1579, 1580, 1581, 1559, 1582, 1583, 1584, 1585, 1586,
-     1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596,
-     1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605, 1606,
+     1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390,
+     1391, 1349, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399,
+     1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409,
+     1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419,
+     1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429,
+     1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439,
+
+     1440, 1441, 1442, 1443, 1444, 1445, 1446, 1424, 1447, 1448,
+     1449, 1450, 1451, 1425, 1452, 1453, 1454, 1455, 1456, 1457,
+     1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467,
+     1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477,
+     1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487,
+     1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497,
+     1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507,
+     1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517,
+     1519, 1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528,
+     1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538,
+
+     1539, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549,
+     1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559,
+     1560, 1561, 1562, 1563, 1535, 1564, 1565, 1566, 1567, 1568,
+     1569, 1570, 1518, 1571, 1572, 1573, 1574, 1575, 1576, 1577,
+     1578, 1579, 1580, 1581, 1540, 1582, 1583, 1584, 1585, 1586,
+     1587, 1588, 1589, 1590, 1592, 1593, 1594, 1595, 1596, 1597,
+     1598, 1591, 1599, 1600, 1601, 1602, 1603, 1604, 1605, 1606,
      1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616,
      1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624, 1625, 1626,
      1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636,
 
      1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646,
-     1647, 1648, 1649, 1651, 1652, 1653, 1654, 1655, 1656, 1657,
-     1658, 1659, 1660, 1650, 1661, 1662, 1636, 1663, 1664, 1665,
-     1666, 1667, 1669, 1670, 1671, 1672, 1673, 1674, 1675, 1676,
-     1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685, 1686,
-     1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696,
-     1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706,
-     1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714, 1716, 1717,
-     1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1668,
-     1727, 1728, 1730, 1731, 1732, 1733, 1729, 1734, 1735, 1736,
-
-     1737, 1738, 1711, 1739, 1740, 1741, 1742, 1743, 1744, 1745,
-     1746, 1747, 1748, 1749, 1750, 1751, 1752, 1753, 1754, 1755,
+     1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656,
+     1634, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665,
+     1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673, 1674, 1675,
+     1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685,
+     1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695,
+     1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705,
+     1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715,
+     1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725,
+     1726, 1727, 1728, 1730, 1731, 1732, 1733, 1734, 1735, 1736,
+
+     1737, 1738, 1739, 1729, 1740, 1741, 1715, 1742, 1743, 1744,
+     1745, 1746, 1747, 1749, 1750, 1751, 1752, 1753, 1754, 1755,
      1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765,
-     1766, 1767, 1768, 1769, 1770, 1715, 1771, 1772, 1773, 1774,
-     1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784,
-     1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794,
-     1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1803, 1804,
-     1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814,
-     1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824,
+     1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775,
+     1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785,
+     1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795,
+     1796, 1797, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806,
+     1748, 1807, 1808, 1809, 1810, 1811, 1813, 1814, 1815, 1816,
+     1812, 1817, 1818, 1819, 1820, 1821, 1794, 1822, 1823, 1824,
      1825, 1826, 1827, 1828, 1829, 1830, 1831, 1832, 1833, 1834,
 
      1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844,
-     1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854,
-     1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864,
-     1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874,
-     1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884,
-     1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894,
-     1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904,
-     1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914,
-     1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924,
-     1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934,
-
-     1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944,
-     1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954,
-     1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963, 1964,
-     1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974,
-     1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984,
-     1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994,
-     1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004,
-     2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014,
-     2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024,
-     2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033, 2034,
-
-     2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044,
-     2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053, 2054,
-     2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064,
-     2065, 2066, 2067, 2068, 2069, 2070, 2072, 2071, 2073, 2074,
-     2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083, 2084,
-     2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094,
-     2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104,
-     2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2114,
-     2115, 2116,   12,   12,   12,   12,   12,   36,   36,   36,
-       36,   36,   78,  325,   78,   78,   78,   97,  455,   97,
-
-      596,   97,   99,   99,   99,   99,   99,  113,  113,  113,
-      113,  113,  186,   99,  186,  186,  186,  208,  208,  208,
-      855,  852,  851,  850,  849,  848,  847,  846,  845,  844,
-      843,  842,  841,  840,  839,  838,  837,  836,  835,  834,
-      833,  832,  831,  830,  829,  828,  827,  826,  822,  821,
-      820,  819,  818,  817,  816,  815,  814,  813,  810,  809,
-      808,  807,  806,  805,  804,  803,  802,  801,  800,  799,
-      798,  797,  796,  795,  794,  793,  792,  791,  790,  789,
-      788,  787,  786,  785,  782,  781,  780,  779,  778,  777,
-      776,  775,  774,  773,  772,  771,  770,  769,  768,  767,
-
-      766,  765,  764,  763,  762,  761,  760,  759,  758,  757,
-      756,  755,  754,  753,  752,  751,  750,  749,  748,  747,
-      746,  745,  744,  741,  740,  739,  738,  736,  733,  732,
-      731,  730,  729,  728,  727,  726,  725,  724,  723,  722,
+     1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1798,
+     1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863,
+     1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873,
+     1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883,
+     1884, 1885, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1893,
+     1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903,
+     1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913,
+     1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923,
+     1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933,
+
+     1934, 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943,
+     1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953,
+     1954, 1955, 1956, 1957, 1958, 1959, 1960, 1961, 1962, 1963,
+     1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973,
+     1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983,
+     1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993,
+     1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003,
+     2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013,
+     2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022, 2023,
+     2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032, 2033,
+
+     2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043,
+     2044, 2045, 2046, 2047, 2048, 2049, 2050, 2051, 2052, 2053,
+     2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063,
+     2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073,
+     2074, 2075, 2076, 2077, 2078, 2079, 2080, 2081, 2082, 2083,
+     2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093,
+     2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103,
+     2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113,
+     2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123,
+     2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133,
+
+     2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141, 2142, 2143,
+     2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153,
+     2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163,
+     2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 2173,
+     2174, 2176, 2175, 2177, 2178, 2179, 2180, 2181, 2182, 2183,
+     2184, 2185, 2186, 2187, 2188, 2189, 2190, 2191, 2192, 2193,
+     2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203,
+     2204, 2205, 2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213,
+     2214, 2215, 2216, 2217, 2218, 2219, 2220,   12,   12,   12,
+       12,   12,   36,   36,   36,   36,   36,   79,  332,   79,
+
+       79,   79,   98,  465,   98,  611,   98,  100,  100,  100,
+      100,  100,  114,  114,  114,  114,  114,  190,  100,  190,
+      190,  190,  212,  212,  212,  864,  863,  862,  861,  860,
+      859,  858,  857,  856,  855,  854,  853,  849,  848,  847,
+      846,  845,  844,  843,  842,  841,  840,  837,  836,  835,
+      834,  833,  832,  831,  830,  829,  828,  827,  826,  825,
+      824,  823,  822,  821,  820,  819,  818,  817,  816,  815,
+      814,  813,  812,  811,  810,  805,  804,  803,  802,  801,
+      800,  799,  798,  797,  796,  795,  794,  793,  792,  791,
+      788,  787,  786,  785,  784,  783,  782,  781,  780,  779,
+
+      778,  777,  776,  775,  774,  773,  772,  771,  770,  769,
+      768,  767,  766,  765,  764,  761,  760,  759,  758,  756,
+      753,  752,  751,  750,  749,  748,  747,  746,  745,  744,
+      743,  742,  741,  740,  739,  738,  737,  736,  735,  734,
+      733,  732,  731,  730,  729,  728,  727,  726,  723,  722,
       721,  720,  719,  718,  717,  716,  715,  714,  713,  712,
-      711,  710,  709,  708,  707,  704,  703,  702,  701,  700,
-      699,  698,  697,  696,  695,  694,  693,  692,  691,  690,
-      689,  688,  687,  686,  685,  684,  683,  682,  681,  680,
-      679,  678,  677,  676,  675,  674,  673,  672,  671,  670,
-      669,  668,  667,  666,  665,  664,  661,  658,  657,  656,
-
-      655,  654,  653,  652,  651,  650,  649,  648,  647,  646,
-      645,  644,  643,  642,  641,  640,  639,  638,  637,  634,
-      633,  632,  631,  630,  629,  628,  627,  624,  623,  622,
-      616,  615,  614,  613,  612,  611,  610,  609,  608,  607,
-      606,  605,  603,  600,  599,  598,  595,  594,  591,  590,
-      589,  588,  587,  584,  583,  582,  581,  580,  579,  578,
-      577,  576,  575,  574,  573,  572,  571,  570,  567,  566,
-      565,  562,  561,  560,  559,  558,  557,  556,  555,  554,
-      551,  550,  547,  546,  545,  544,  543,  542,  541,  540,
-      539,  538,  537,  536,  535,  534,  530,  529,  528,  525,
-
-      524,  523,  516,  515,  514,  513,  512,  511,  510,  509,
-      508,  507,  506,  505,  504,  503,  498,  497,  496,  495,
-      494,  493,  492,  491,  490,  489,  488,  487,  486,  483,
-      482,  481,  480,  477,  474,  473,  472,  471,  470,  469,
-      468,  467,  466,  464,  462,  461,  459,  457,  454,  451,
-      450,  449,  448,  447,  446,  445,  443,  442,  441,  440,
-      439,  438,  437,  436,  435,  434,  431,  430,  429,  428,
-      427,  426,  425,  422,  421,  420,  419,  418,  417,  416,
-      415,  414,  413,  412,  411,  410,  409,  408,  407,  406,
-      405,  404,  403,  400,  399,  398,  397,  396,  394,  393,
-
-      392,  391,  390,  389,  385,  384,  383,  382,  381,  380,
-      379,  378,  377,  376,  375,  374,  373,  372,  371,  370,
-      369,  368,  367,  366,  365,  364,  363,  362,  361,  360,
-      359,  358,  357,  356,  355,  354,  353,  352,  351,  350,
-      345,  344,  343,  342,  341,  340,  209,  334,  332,  330,
-      327,  324,  317,  316,  315,  314,  313,  312,  311,  309,
-      308,  307,  304,  303,  302,  301,  297,  287,  277,  276,
-      271,  270,  269,  266,  265,  263,  262,  261,  260,  259,
-      258,  254,  253,  252,  251,  250,  249,  248,  243,  242,
-      238,  237,  229,  228,  227,  223,  222,  221,  220,  216,
-
-      213,  209,  198,  197,  194,  193,  185,  165,  140,  107,
-      104,  103,   43,   98,   96,   95,   86,   43, 2117,   11,
-     2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117,
-     2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117,
-     2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117,
-     2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117,
-     2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117,
-     2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117,
-     2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117,
-     2117, 2117, 2117
+      711,  710,  709,  708,  707,  706,  705,  704,  703,  702,
+      701,  700,  699,  698,  697,  696,  695,  694,  693,  692,
+      691,  690,  689,  688,  687,  686,  685,  684,  683,  680,
+      677,  676,  675,  674,  673,  672,  671,  670,  669,  668,
+
+      667,  666,  665,  664,  663,  662,  661,  660,  659,  658,
+      657,  656,  655,  654,  653,  652,  649,  648,  647,  646,
+      645,  644,  643,  642,  639,  638,  637,  631,  630,  629,
+      628,  627,  626,  625,  624,  623,  622,  621,  620,  618,
+      615,  614,  613,  610,  609,  608,  605,  604,  603,  602,
+      601,  598,  597,  596,  595,  594,  593,  592,  591,  590,
+      589,  588,  587,  586,  585,  584,  581,  580,  579,  576,
+      575,  574,  573,  572,  571,  570,  569,  568,  565,  564,
+      561,  560,  559,  558,  557,  556,  555,  554,  553,  552,
+      551,  550,  549,  548,  544,  543,  542,  539,  538,  537,
+
+      530,  529,  528,  527,  523,  522,  521,  520,  519,  518,
+      517,  516,  515,  510,  509,  508,  507,  506,  505,  504,
+      503,  502,  501,  500,  499,  498,  497,  496,  493,  492,
+      491,  490,  487,  484,  483,  482,  481,  480,  479,  478,
+      477,  476,  474,  472,  471,  469,  467,  464,  461,  460,
+      459,  458,  457,  456,  455,  454,  452,  451,  450,  449,
+      448,  447,  446,  445,  444,  443,  440,  439,  438,  437,
+      436,  435,  434,  431,  430,  429,  428,  427,  426,  425,
+      424,  423,  422,  421,  420,  419,  418,  417,  416,  415,
+      414,  413,  412,  409,  408,  407,  406,  405,  403,  402,
+
+      401,  400,  399,  398,  394,  393,  392,  391,  390,  389,
+      388,  387,  386,  385,  384,  383,  382,  381,  380,  379,
+      378,  377,  376,  375,  374,  373,  372,  371,  370,  369,
+      368,  367,  366,  365,  364,  363,  362,  361,  360,  359,
+      358,  357,  352,  351,  350,  349,  348,  347,  213,  341,
+      339,  337,  334,  331,  324,  323,  322,  321,  320,  319,
+      318,  317,  315,  314,  313,  310,  309,  308,  307,  303,
+      293,  283,  282,  277,  276,  275,  272,  271,  269,  268,
+      267,  266,  265,  264,  260,  259,  258,  257,  256,  255,
+      254,  249,  248,  244,  243,  242,  241,  233,  232,  231,
+
+      227,  226,  225,  224,  220,  217,  213,  202,  201,  198,
+      197,  188,  168,  143,  108,  105,  104,   43,   99,   97,
+       96,   87,   43, 2221,   11, 2221, 2221, 2221, 2221, 2221,
+     2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221,
+     2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221,
+     2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221,
+     2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221,
+     2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221,
+     2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221,
+     2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221
 
     } ;
 
-static const flex_int16_t yy_chk[2594] =
+static const flex_int16_t yy_chk[2699] =
     {   0,
         0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-       21,  681,    3,    3,    3,   21,    1,    1,    3,   44,
+       21,  700,    3,    3,    3,   21,    1,    1,    3,   44,
         0,    1,    4,    4,    4,   13,    1,   13,    4,   27,
-       28,    1,  106,    1,    5,    5,    5,   26,   32,    1,
+       28,    1,  107,    1,    5,    5,    5,   26,   32,    1,
         1,   33,    6,    6,    6,    7,    7,    7,    1,    7,
-      681,    8,    8,    8,    1,    8,   44,   27,   28,  106,
+      700,    8,    8,    8,    1,    8,   44,   27,   28,  107,
        26,    1,    1,    2,    2,    2,   32,    2,    2,   33,
         2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
         2,    2,    9,    9,    9,   31,    5,   47,    2,    2,
 
        10,   10,   10,    2,    6,   37,   50,   37,    2,   42,
        51,   42,    9,    2,   53,    2,   55,   56,   31,   64,
-       10,    2,    2,   47,   64,  349,   25,   64,   25,   50,
+       10,    2,    2,   47,   64,  356,   25,   64,   25,   50,
         2,   25,   25,   25,   25,   25,    2,   53,   51,   55,
-      725,   56,  349,    2,    2,   15,   15,   15,   15,   15,
+      726,   56,  356,    2,    2,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
@@ -1772,268 +1819,279 @@ static const flex_int16_t yy_chk[2594] =
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
 
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   17,  610,
+       15,   15,   15,   15,   15,   15,   15,   15,   17,  131,
        17,   17,   17,   17,   17,   19,   58,   19,   19,   19,
-       19,   19,  112,   17,   20,   20,   20,   20,   20,   22,
-       19,   22,   22,   22,   22,   22,   62,   20,   59,   73,
-       54,   61,   58,   73,   22,  112,   17,  109,   58,   59,
-       54,   61,   59,   19,   59,   63,   59,  107,   89,   62,
-       20,   90,   63,   54,  610,  118,  189,   22,   45,  118,
-       62,   45,   45,   45,  109,   45,   45,   45,   54,   57,
-       65,  726,   45,   45,   89,   45,   57,   90,  107,  189,
-
-       65,   45,   65,   45,   45,   45,   45,   45,   45,   45,
+       19,   19,  131,   17,   20,   20,   20,   20,   20,   22,
+       19,   22,   22,   22,   22,   22,   76,   20,   59,   73,
+       54,   61,   58,   73,   22,   65,   17,   62,   58,   59,
+       54,   61,   59,   19,   59,   65,   59,   65,   90,   76,
+       20,   91,   92,   54,  132,  215,   93,   22,   45,   76,
+       62,   45,   45,   45,   76,   45,   45,   45,   54,   57,
+      132,   62,   45,   45,   90,   45,   57,   91,   62,   94,
+
+       92,   45,   93,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   60,   91,   57,   60,   60,  192,
-       57,   60,   60,   67,   57,   68,   92,   67,   67,   68,
-      137,   67,   57,   68,   60,   69,   57,   67,   57,   57,
-      130,  120,  192,   91,   76,   68,   93,   70,   94,   68,
-      120,  120,   92,  130,   69,   70,   69,   70,   69,   75,
-       75,   71,   70,   70,   71,   71,   74,   76,   69,   75,
-       74,  102,   93,   74,  137,   71,   94,   76,   71,   75,
-       74,   74,   76,  394,   74,   74,   74,   79,   79,   79,
-
-       79,   79,   75,  394,   75,  138,  138,   75,   75,  102,
-       79,   87,   87,   87,   87,   87,   80,   75,   80,   80,
-       80,   80,   80,  727,   75,   88,   88,   88,   88,   88,
-       81,   80,   81,   79,   99,   81,   81,   81,   81,   81,
-       82,  105,   82,   82,   82,   82,   82,   83,   83,   83,
-       83,   83,  101,  108,   80,   82,  110,  156,  111,  101,
-       83,  131,  116,  125,  125,  728,  153,  105,  129,  134,
-      129,   99,  134,  125,  174,  146,  134,  131,   82,  116,
-      178,  108,  165,   83,  110,  111,  165,  129,  174,  101,
-      116,  146,  163,  101,  153,  163,  146,  101,  163,  163,
-
-      729,  211,  187,  156,  160,  101,  167,  178,  188,  101,
-      191,  101,  101,  115,  115,  115,  115,  115,  730,  160,
-      160,  160,  115,  115,  115,  115,  115,  115,  164,  169,
-      187,  200,  164,  169,  188,  190,  191,  169,  164,  196,
-      199,  167,  167,  167,  203,  115,  115,  115,  115,  115,
-      115,  205,  167,  207,  167,  211,  167,  167,  200,  167,
-      270,  520,  196,  190,  212,  219,  257,  203,  199,  291,
-      326,  520,  291,  219,  205,  264,  299,  318,  219,  219,
-      207,  210,  210,  210,  210,  210,  321,  212,  328,  299,
-      210,  210,  210,  210,  210,  210,  310,  331,  264,  326,
-
-      318,  310,  339,  352,  731,  395,  357,  411,  352,  321,
-      270,  328,  357,  210,  210,  210,  210,  210,  210,  257,
-      414,  484,  257,  736,  414,  331,  336,  336,  336,  336,
-      336,  339,  386,  395,  484,  336,  336,  336,  336,  336,
-      336,  371,  456,  723,  465,  390,  371,  386,  386,  386,
-      386,  390,  424,  386,  444,  723,  424,  444,  336,  336,
-      336,  336,  336,  336,  428,  411,  450,  602,  428,  480,
-      456,  450,  465,  462,  518,  462,  737,  480,  494,  480,
-      480,  480,  565,  494,  601,  604,  735,  565,  518,  738,
-      604,  652,  652,  734,  371,  602,  739,  740,  741,  371,
-
-      462,  743,  462,  463,  463,  463,  463,  463,  744,  735,
-      745,  601,  463,  463,  463,  463,  463,  463,  693,  742,
-      742,  734,  742,  693,  746,  747,  748,  749,  750,  751,
-      752,  753,  754,  755,  756,  463,  463,  463,  463,  463,
-      463,  757,  758,  759,  760,  761,  762,  763,  764,  765,
-      762,  766,  767,  768,  762,  769,  771,  772,  773,  774,
-      775,  776,  693,  777,  778,  779,  780,  781,  782,  783,
-      784,  785,  786,  787,  788,  789,  790,  786,  791,  792,
-      793,  794,  795,  796,  794,  797,  798,  800,  801,  802,
-      803,  804,  805,  806,  807,  808,  809,  810,  812,  813,
-
-      814,  815,  816,  817,  818,  819,  820,  821,  822,  824,
-      825,  826,  827,  828,  829,  830,  831,  832,  833,  834,
-      835,  836,  837,  838,  839,  840,  841,  842,  843,  844,
-      845,  846,  847,  848,  849,  850,  844,  851,  846,  852,
-      849,  854,  846,  855,  856,  857,  858,  859,  860,  861,
-      862,  863,  864,  865,  866,  867,  868,  869,  871,  872,
-      873,  874,  875,  876,  877,  878,  879,  880,  881,  882,
+       45,   45,   45,   45,   60,   94,   57,   60,   60,  215,
+       57,   60,   60,   68,   57,  100,  159,   68,   63,  106,
+       69,   68,   57,  108,   60,   63,   57,  727,   57,   57,
+       67,   63,   70,   68,   67,   67,   95,   68,   67,   69,
+       70,   69,   70,   69,   67,  106,   71,   70,   70,   71,
+       71,   74,  100,   69,  108,   74,   78,  119,   74,  305,
+       71,  119,  159,   71,   95,   74,   74,   75,   75,   74,
+       74,   74,  305,   78,  728,  103,  109,   75,  141,  141,
+
+       78,   80,   80,   80,   80,   80,   81,   75,   81,   81,
+       81,   81,   81,   83,   80,   83,   83,   83,   83,   83,
+       75,   81,   75,  103,  109,   75,   75,  102,   83,   88,
+       88,   88,   88,   88,  102,   75,  110,   80,  111,  113,
+      112,   82,   75,   82,   81,  729,   82,   82,   82,   82,
+       82,   83,   84,   84,   84,   84,   84,   89,   89,   89,
+       89,   89,  113,  110,  102,   84,  111,  112,  102,  121,
+      316,  140,  102,  126,  126,  316,  730,  117,  121,  121,
+      102,  156,  297,  126,  102,  297,  102,  102,   84,  116,
+      116,  116,  116,  116,  117,  130,  149,  130,  116,  116,
+
+      116,  116,  116,  116,  137,  117,  167,  137,  170,  156,
+      167,  137,  149,  163,  130,  140,  167,  149,  193,  177,
+      181,  116,  116,  116,  116,  116,  116,  191,  163,  163,
+      163,  166,  168,  177,  166,  194,  168,  166,  166,  192,
+      195,  193,  172,  170,  170,  170,  172,  181,  196,  200,
+      172,  203,  207,  204,  170,  191,  170,  211,  170,  170,
+      209,  170,  276,  194,  333,  192,  195,  216,  223,  270,
+      263,  196,  200,  731,  338,  207,  223,  325,  328,  203,
+      204,  223,  223,  209,  211,  214,  214,  214,  214,  214,
+      216,  335,  270,  333,  214,  214,  214,  214,  214,  214,
+
+      325,  328,  338,  346,  359,  364,  403,  399,  420,  359,
+      732,  364,  276,  399,  335,  404,  403,  214,  214,  214,
+      214,  214,  214,  263,  390,  733,  263,  343,  343,  343,
+      343,  343,  346,  395,  390,  390,  343,  343,  343,  343,
+      343,  343,  380,  404,  625,  466,  734,  380,  395,  395,
+      395,  395,  423,  433,  395,  453,  423,  433,  453,  343,
+      343,  343,  343,  343,  343,  437,  420,  459,  475,  437,
+      490,  494,  459,  466,  472,  532,  472,  534,  490,  735,
+      490,  490,  490,  504,  494,  579,  619,  534,  504,  532,
+      579,  619,  616,  617,  736,  380,  475,  737,  739,  625,
+
+      380,  472,  652,  472,  473,  473,  473,  473,  473,  652,
+      669,  669,  669,  473,  473,  473,  473,  473,  473,  616,
+      712,  617,  740,  741,  743,  712,  669,  744,  745,  746,
+      742,  747,  748,  749,  750,  751,  473,  473,  473,  473,
+      473,  473,  742,  754,  755,  756,  757,  758,  759,  760,
+      761,  762,  762,  763,  762,  764,  765,  766,  767,  768,
+      769,  770,  771,  772,  712,  773,  774,  755,  775,  776,
+      777,  754,  778,  779,  780,  781,  782,  783,  784,  785,
+      782,  786,  787,  788,  782,  789,  790,  791,  793,  794,
+      795,  796,  797,  798,  799,  800,  801,  802,  803,  804,
+
+      805,  806,  807,  808,  809,  810,  811,  812,  813,  814,
+      815,  816,  817,  813,  818,  819,  820,  821,  822,  823,
+      821,  824,  825,  827,  828,  829,  830,  831,  832,  833,
+      834,  835,  836,  837,  839,  840,  841,  842,  843,  844,
+      845,  846,  847,  848,  849,  851,  852,  853,  854,  855,
+      856,  857,  858,  859,  860,  861,  862,  863,  864,  865,
+      866,  867,  868,  869,  870,  871,  872,  873,  874,  875,
+      876,  877,  871,  878,  873,  879,  876,  881,  873,  882,
       883,  884,  885,  886,  887,  888,  889,  890,  891,  892,
-      864,  893,  894,  895,  896,  897,  898,  899,  901,  902,
-      903,  904,  905,  906,  907,  908,  909,  910,  906,  911,
-
-      912,  913,  914,  915,  916,  917,  919,  921,  922,  923,
-      924,  925,  926,  927,  928,  929,  930,  931,  934,  935,
-      936,  937,  938,  939,  940,  941,  942,  943,  944,  945,
-      942,  946,  947,  948,  950,  952,  953,  954,  955,  956,
-      957,  958,  959,  960,  961,  962,  963,  964,  965,  966,
-      967,  968,  969,  970,  957,  971,  972,  973,  974,  975,
-      976,  977,  978,  979,  980,  981,  982,  983,  984,  985,
-      986,  987,  989,  990,  978,  991,  992,  993,  994,  995,
-      996,  997,  998,  999, 1000, 1001, 1003, 1004, 1005, 1006,
-     1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016,
+      893,  894,  895,  896,  897,  899,  900,  901,  902,  903,
+
+      904,  905,  906,  907,  908,  909,  910,  911,  912,  913,
+      914,  915,  916,  917,  918,  919,  920,  892,  921,  922,
+      923,  924,  925,  926,  927,  929,  930,  931,  932,  933,
+      934,  935,  936,  937,  938,  939,  940,  941,  937,  942,
+      943,  944,  945,  946,  947,  948,  949,  950,  951,  952,
+      954,  956,  957,  958,  959,  960,  961,  962,  963,  964,
+      965,  966,  969,  970,  971,  972,  973,  974,  975,  976,
+      977,  978,  979,  980,  977,  981,  982,  983,  985,  987,
+      988,  989,  990,  991,  992,  993,  994,  995,  996,  997,
+      998,  999, 1000, 1001, 1002, 1003, 1004, 1005,  992, 1006,
 
-     1017, 1018, 1019, 1020, 1021,  998, 1022, 1023,  997, 1024,
-     1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035,
-     1036, 1037, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1047,
-     1048, 1049, 1044, 1050, 1051, 1052, 1053, 1054, 1055, 1056,
-     1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066,
+     1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016,
+     1017, 1018, 1019, 1020, 1021, 1022, 1024, 1025, 1013, 1026,
+     1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036,
+     1037, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047,
+     1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057,
+     1034, 1058, 1059, 1033, 1060, 1062, 1063, 1064, 1065, 1066,
      1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076,
-     1077, 1080, 1081, 1082, 1083, 1085, 1086, 1088, 1089, 1075,
-     1090, 1091, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100,
-     1101, 1102, 1103, 1104, 1105, 1044, 1106, 1107, 1108, 1109,
-     1110, 1112, 1113, 1114, 1116, 1117, 1118, 1119, 1120, 1121,
-
-     1122, 1123, 1124, 1125, 1126, 1128, 1127, 1129, 1130, 1131,
-     1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141,
-     1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1151, 1152,
-     1153, 1154, 1126, 1127, 1155, 1156, 1157, 1158, 1159, 1160,
-     1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1171,
-     1172, 1173, 1174, 1175, 1176, 1172, 1177, 1178, 1179, 1180,
-     1181, 1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190,
-     1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200,
-     1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210,
-     1211, 1212, 1213, 1214, 1216, 1173, 1217, 1218, 1219, 1220,
-
-     1221, 1222, 1223, 1224, 1225, 1226, 1228, 1229, 1232, 1233,
-     1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243,
-     1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253,
-     1254, 1255, 1256, 1257, 1258, 1259, 1260, 1262, 1263, 1264,
-     1265, 1266, 1267, 1269, 1270, 1271, 1247, 1272, 1273, 1274,
-     1275, 1276, 1248, 1277, 1278, 1279, 1280, 1281, 1282, 1283,
-     1284, 1285, 1286, 1289, 1290, 1292, 1294, 1295, 1296, 1297,
-     1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307,
-     1308, 1309, 1310, 1311, 1312, 1313, 1315, 1316, 1317, 1318,
-     1319, 1321, 1322, 1323, 1324, 1325, 1327, 1329, 1331, 1332,
-
-     1333, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343,
-     1344, 1345, 1346, 1347, 1348, 1349, 1351, 1352, 1353, 1354,
-     1355, 1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366,
-     1368, 1369, 1370, 1371, 1372, 1373, 1374, 1376, 1377, 1378,
-     1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388,
-     1389, 1390, 1392, 1393, 1394, 1364, 1395, 1396, 1397, 1398,
-     1399, 1400, 1401, 1403, 1345, 1404, 1405, 1406, 1407, 1408,
-     1409, 1410, 1412, 1413, 1414, 1369, 1415, 1416, 1417, 1418,
-     1419, 1420, 1421, 1422, 1423, 1424, 1417, 1425, 1426, 1427,
-     1428, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439,
-
-     1440, 1441, 1442, 1443, 1444, 1445, 1447, 1448, 1449, 1450,
-     1451, 1452, 1454, 1456, 1459, 1460, 1461, 1463, 1464, 1465,
-     1466, 1467, 1469, 1470, 1472, 1473, 1474, 1475, 1476, 1477,
-     1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487,
-     1488, 1490, 1492, 1493, 1467, 1494, 1495, 1496, 1497, 1498,
-     1499, 1500, 1501, 1502, 1504, 1506, 1508, 1511, 1512, 1513,
-     1514, 1515, 1516, 1517, 1518, 1519, 1520, 1521, 1522, 1523,
-     1524, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534,
-     1535, 1536, 1537, 1540, 1541, 1543, 1544, 1545, 1546, 1547,
-     1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1558, 1559,
-
-     1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569,
-     1570, 1571, 1572, 1573, 1574, 1575, 1576, 1578, 1579, 1580,
-     1582, 1583, 1584, 1572, 1585, 1586, 1559, 1587, 1588, 1589,
+     1078, 1079, 1080, 1081, 1082, 1083, 1084, 1086, 1087, 1088,
+     1083, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097,
+     1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107,
+
+     1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117,
+     1118, 1119, 1120, 1123, 1124, 1125, 1126, 1128, 1129, 1131,
+     1132, 1118, 1133, 1134, 1136, 1137, 1138, 1139, 1140, 1141,
+     1142, 1143, 1144, 1083, 1145, 1146, 1147, 1148, 1149, 1150,
+     1151, 1152, 1153, 1155, 1156, 1157, 1159, 1160, 1161, 1162,
+     1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1172, 1171,
+     1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182,
+     1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192,
+     1193, 1195, 1196, 1197, 1198, 1170, 1171, 1199, 1200, 1201,
+     1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211,
+
+     1212, 1213, 1214, 1215, 1216, 1218, 1219, 1220, 1221, 1222,
+     1223, 1219, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231,
+     1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241,
+     1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251,
+     1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261,
+     1262, 1220, 1263, 1264, 1265, 1267, 1268, 1269, 1270, 1271,
+     1272, 1273, 1274, 1275, 1276, 1277, 1279, 1280, 1283, 1284,
+     1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294,
+     1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304,
+     1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1314, 1315,
+
+     1316, 1317, 1318, 1319, 1321, 1322, 1323, 1299, 1324, 1325,
+     1326, 1327, 1328, 1300, 1329, 1330, 1331, 1332, 1333, 1334,
+     1335, 1336, 1337, 1338, 1339, 1340, 1341, 1344, 1345, 1347,
+     1349, 1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358,
+     1359, 1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368,
+     1369, 1370, 1371, 1372, 1374, 1375, 1376, 1377, 1378, 1380,
+     1381, 1382, 1383, 1384, 1386, 1388, 1390, 1391, 1392, 1394,
+     1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404,
+     1405, 1406, 1407, 1408, 1410, 1411, 1412, 1413, 1414, 1417,
+     1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1428,
+
+     1429, 1430, 1431, 1432, 1433, 1434, 1436, 1437, 1438, 1439,
+     1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449,
+     1450, 1452, 1453, 1454, 1424, 1455, 1456, 1457, 1458, 1459,
+     1460, 1461, 1404, 1462, 1463, 1464, 1466, 1467, 1468, 1469,
+     1470, 1471, 1472, 1473, 1429, 1474, 1475, 1477, 1479, 1480,
+     1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490,
+     1491, 1484, 1492, 1493, 1494, 1495, 1498, 1499, 1500, 1501,
+     1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511,
+     1512, 1514, 1515, 1516, 1517, 1518, 1519, 1521, 1523, 1526,
+     1527, 1528, 1530, 1531, 1532, 1533, 1534, 1535, 1537, 1538,
+
+     1540, 1541, 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549,
+     1550, 1551, 1552, 1553, 1554, 1555, 1556, 1558, 1560, 1561,
+     1535, 1562, 1563, 1564, 1565, 1567, 1569, 1570, 1571, 1572,
+     1573, 1575, 1577, 1579, 1580, 1581, 1585, 1586, 1587, 1588,
      1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598,
-     1599, 1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607, 1609,
-     1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619,
-     1620, 1621, 1622, 1623, 1624, 1625, 1626, 1628, 1629, 1630,
-     1631, 1633, 1634, 1635, 1636, 1637, 1638, 1641, 1642, 1643,
-     1644, 1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1590,
-     1656, 1658, 1659, 1660, 1661, 1662, 1658, 1663, 1664, 1665,
-
-     1666, 1668, 1636, 1669, 1670, 1672, 1673, 1674, 1675, 1677,
-     1678, 1679, 1681, 1682, 1683, 1684, 1685, 1686, 1687, 1689,
-     1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699,
-     1700, 1701, 1702, 1703, 1704, 1641, 1705, 1706, 1707, 1708,
-     1709, 1711, 1713, 1715, 1716, 1717, 1719, 1720, 1721, 1722,
-     1723, 1724, 1725, 1726, 1727, 1729, 1730, 1731, 1732, 1733,
-     1735, 1736, 1737, 1739, 1740, 1742, 1743, 1744, 1745, 1746,
-     1747, 1748, 1749, 1750, 1751, 1753, 1754, 1755, 1756, 1757,
-     1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1768,
-     1769, 1770, 1772, 1773, 1774, 1775, 1777, 1779, 1780, 1781,
-
-     1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791,
-     1792, 1794, 1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802,
-     1803, 1805, 1806, 1807, 1808, 1809, 1810, 1812, 1813, 1814,
-     1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824,
-     1826, 1827, 1828, 1830, 1831, 1832, 1833, 1834, 1835, 1836,
-     1837, 1838, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847,
-     1848, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859,
-     1860, 1861, 1862, 1863, 1865, 1866, 1867, 1868, 1870, 1871,
-     1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1882,
-     1883, 1884, 1885, 1886, 1887, 1889, 1890, 1891, 1892, 1893,
-
-     1894, 1895, 1896, 1897, 1898, 1899, 1901, 1902, 1904, 1906,
-     1907, 1909, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1919,
-     1920, 1921, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930,
-     1932, 1933, 1935, 1936, 1937, 1938, 1939, 1940, 1943, 1944,
-     1945, 1946, 1947, 1948, 1949, 1951, 1953, 1954, 1956, 1957,
-     1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967,
-     1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975, 1976, 1978,
-     1979, 1980, 1981, 1982, 1983, 1984, 1986, 1987, 1988, 1989,
-     1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999,
-     2000, 2001, 2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009,
-
-     2011, 2012, 2014, 2015, 2017, 2018, 2019, 2020, 2021, 2022,
-     2023, 2026, 2028, 2030, 2033, 2034, 2035, 2037, 2038, 2039,
-     2040, 2041, 2042, 2043, 2045, 2046, 2047, 2049, 2051, 2054,
-     2055, 2056, 2057, 2058, 2060, 2062, 2063, 2062, 2065, 2066,
-     2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 2077,
-     2078, 2080, 2081, 2082, 2083, 2084, 2085, 2086, 2088, 2089,
-     2091, 2092, 2093, 2094, 2095, 2096, 2098, 2101, 2102, 2103,
-     2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113,
-     2114, 2115, 2118, 2118, 2118, 2118, 2118, 2119, 2119, 2119,
-     2119, 2119, 2120, 2126, 2120, 2120, 2120, 2121, 2127, 2121,
-
-     2128, 2121, 2122, 2122, 2122, 2122, 2122, 2123, 2123, 2123,
-     2123, 2123, 2124, 2129, 2124, 2124, 2124, 2125, 2125, 2125,
-      724,  722,  721,  720,  718,  717,  716,  715,  714,  713,
-      712,  711,  710,  709,  708,  707,  706,  704,  703,  702,
-      701,  700,  699,  698,  697,  696,  695,  694,  692,  691,
-      689,  688,  687,  686,  685,  684,  683,  682,  680,  679,
-      678,  677,  676,  674,  673,  671,  670,  669,  668,  667,
-      666,  665,  664,  663,  662,  661,  660,  659,  658,  657,
-      656,  655,  654,  653,  651,  650,  649,  648,  647,  646,
-      645,  643,  642,  641,  640,  639,  638,  637,  636,  634,
-
-      633,  632,  631,  630,  629,  628,  627,  626,  625,  624,
-      623,  622,  621,  620,  619,  618,  617,  616,  615,  614,
-      613,  612,  611,  609,  608,  607,  606,  603,  597,  595,
-      594,  593,  591,  588,  586,  585,  584,  583,  582,  581,
-      580,  579,  578,  577,  576,  575,  574,  573,  572,  571,
-      570,  569,  568,  567,  566,  564,  563,  562,  561,  560,
-      559,  558,  557,  556,  555,  554,  553,  552,  551,  549,
-      547,  546,  545,  544,  543,  542,  541,  540,  539,  538,
-      537,  536,  535,  534,  533,  532,  531,  529,  528,  527,
-      526,  525,  524,  523,  522,  521,  519,  517,  516,  515,
-
-      514,  513,  512,  511,  510,  509,  508,  507,  506,  505,
-      504,  503,  502,  501,  500,  498,  497,  496,  495,  493,
-      492,  491,  490,  489,  488,  486,  485,  483,  482,  481,
-      479,  477,  476,  475,  474,  473,  472,  471,  469,  468,
-      467,  466,  464,  460,  458,  457,  454,  451,  449,  448,
-      447,  446,  445,  443,  442,  441,  440,  439,  438,  437,
-      436,  435,  434,  433,  432,  431,  430,  429,  427,  426,
-      425,  423,  422,  421,  420,  419,  418,  417,  416,  415,
-      413,  412,  410,  409,  408,  407,  406,  405,  404,  403,
-      402,  401,  400,  399,  398,  396,  393,  392,  391,  389,
-
-      388,  387,  385,  384,  383,  382,  381,  380,  379,  378,
-      377,  376,  375,  374,  373,  372,  370,  369,  368,  367,
-      366,  365,  364,  363,  362,  361,  360,  359,  358,  356,
-      355,  354,  353,  351,  348,  347,  346,  345,  344,  343,
-      342,  341,  340,  338,  335,  333,  329,  327,  324,  317,
-      316,  315,  314,  313,  312,  311,  309,  308,  307,  306,
-      305,  304,  303,  302,  301,  300,  298,  297,  296,  295,
-      294,  293,  292,  290,  289,  288,  287,  286,  285,  284,
-      283,  282,  281,  280,  279,  278,  277,  276,  275,  274,
-      273,  272,  271,  269,  268,  267,  266,  265,  263,  262,
-
-      261,  260,  259,  258,  256,  255,  254,  253,  252,  251,
-      250,  249,  248,  247,  246,  245,  243,  242,  241,  240,
-      239,  238,  237,  236,  235,  234,  233,  232,  231,  230,
-      229,  228,  227,  226,  225,  224,  223,  222,  221,  220,
-      218,  217,  216,  215,  214,  213,  208,  206,  204,  202,
-      197,  193,  185,  184,  183,  182,  181,  180,  179,  177,
-      176,  175,  173,  172,  171,  170,  168,  166,  162,  161,
-      159,  158,  157,  155,  154,  152,  151,  150,  149,  148,
-      147,  145,  144,  143,  142,  141,  140,  139,  136,  135,
-      133,  132,  128,  127,  126,  124,  123,  122,  121,  119,
-
-      117,  113,  104,  103,   97,   96,   77,   72,   66,   52,
-       49,   48,   43,   41,   39,   38,   24,   14,   11, 2117,
-     2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117,
-     2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117,
-     2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117,
-     2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117,
-     2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117,
-     2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117,
-     2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117, 2117,
-     2117, 2117, 2117
+     1600, 1601, 1602, 1603, 1604, 1605, 1606, 1607, 1608, 1609,
+     1610, 1611, 1614, 1615, 1617, 1618, 1619, 1620, 1621, 1623,
+     1624, 1625, 1626, 1627, 1628, 1629, 1630, 1632, 1633, 1634,
+     1635, 1636, 1637, 1638, 1639, 1640, 1641, 1642, 1643, 1644,
+     1645, 1646, 1647, 1648, 1649, 1650, 1651, 1653, 1654, 1655,
+
+     1657, 1658, 1659, 1647, 1660, 1661, 1634, 1662, 1663, 1664,
+     1665, 1665, 1666, 1667, 1668, 1669, 1670, 1671, 1672, 1673,
+     1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683,
+     1684, 1685, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694,
+     1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704,
+     1706, 1707, 1708, 1709, 1711, 1712, 1713, 1714, 1715, 1716,
+     1717, 1720, 1721, 1722, 1723, 1727, 1728, 1729, 1730, 1731,
+     1666, 1732, 1733, 1734, 1735, 1737, 1738, 1739, 1741, 1742,
+     1737, 1743, 1744, 1745, 1746, 1748, 1715, 1749, 1750, 1752,
+     1753, 1754, 1755, 1756, 1757, 1759, 1760, 1761, 1763, 1764,
+
+     1765, 1766, 1767, 1768, 1769, 1771, 1772, 1773, 1774, 1775,
+     1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1720,
+     1785, 1786, 1787, 1788, 1789, 1790, 1791, 1793, 1794, 1796,
+     1798, 1799, 1800, 1802, 1803, 1804, 1805, 1806, 1807, 1808,
+     1809, 1810, 1812, 1813, 1814, 1815, 1816, 1818, 1819, 1820,
+     1822, 1823, 1824, 1825, 1827, 1828, 1829, 1830, 1831, 1832,
+     1833, 1834, 1835, 1836, 1838, 1839, 1840, 1841, 1842, 1843,
+     1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1853, 1854,
+     1855, 1857, 1858, 1859, 1860, 1861, 1863, 1865, 1866, 1867,
+     1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877,
+
+     1878, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888,
+     1889, 1890, 1891, 1893, 1894, 1895, 1896, 1897, 1898, 1900,
+     1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910,
+     1911, 1912, 1914, 1915, 1916, 1918, 1919, 1920, 1921, 1922,
+     1923, 1924, 1925, 1926, 1927, 1929, 1930, 1931, 1932, 1933,
+     1934, 1935, 1936, 1937, 1940, 1941, 1942, 1943, 1944, 1945,
+     1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1956,
+     1957, 1958, 1959, 1961, 1962, 1963, 1964, 1965, 1966, 1967,
+     1968, 1969, 1970, 1971, 1972, 1974, 1975, 1976, 1977, 1978,
+     1979, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989,
+
+     1990, 1991, 1992, 1993, 1995, 1996, 1998, 2000, 2001, 2003,
+     2005, 2006, 2007, 2008, 2009, 2010, 2011, 2013, 2014, 2015,
+     2016, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2027,
+     2028, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2040,
+     2041, 2042, 2043, 2044, 2045, 2046, 2048, 2050, 2051, 2053,
+     2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063, 2064,
+     2065, 2066, 2067, 2068, 2070, 2071, 2072, 2073, 2074, 2075,
+     2076, 2078, 2079, 2080, 2081, 2082, 2083, 2084, 2086, 2087,
+     2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097,
+     2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107,
+
+     2108, 2109, 2110, 2112, 2113, 2115, 2116, 2118, 2119, 2120,
+     2121, 2122, 2123, 2124, 2125, 2128, 2130, 2132, 2135, 2136,
+     2137, 2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146, 2148,
+     2149, 2150, 2152, 2154, 2157, 2158, 2159, 2160, 2161, 2164,
+     2166, 2167, 2166, 2169, 2170, 2172, 2173, 2174, 2175, 2176,
+     2177, 2178, 2179, 2180, 2181, 2182, 2184, 2185, 2186, 2187,
+     2188, 2189, 2190, 2192, 2193, 2195, 2196, 2197, 2198, 2199,
+     2200, 2202, 2205, 2206, 2207, 2208, 2209, 2210, 2211, 2212,
+     2213, 2214, 2215, 2216, 2217, 2218, 2219, 2222, 2222, 2222,
+     2222, 2222, 2223, 2223, 2223, 2223, 2223, 2224, 2230, 2224,
+
+     2224, 2224, 2225, 2231, 2225, 2232, 2225, 2226, 2226, 2226,
+     2226, 2226, 2227, 2227, 2227, 2227, 2227, 2228, 2233, 2228,
+     2228, 2228, 2229, 2229, 2229,  725,  723,  722,  721,  720,
+      719,  718,  717,  716,  715,  714,  713,  711,  710,  708,
+      707,  706,  705,  704,  703,  702,  701,  699,  698,  697,
+      696,  695,  693,  692,  690,  689,  688,  687,  686,  685,
+      684,  683,  682,  681,  680,  679,  678,  677,  676,  675,
+      674,  673,  672,  671,  670,  668,  667,  666,  665,  664,
+      663,  662,  660,  659,  658,  657,  656,  655,  654,  653,
+      651,  649,  648,  647,  646,  645,  644,  643,  642,  641,
+
+      640,  639,  638,  637,  636,  635,  634,  633,  632,  631,
+      630,  629,  628,  627,  626,  624,  623,  622,  621,  618,
+      612,  610,  609,  608,  607,  605,  602,  600,  599,  598,
+      597,  596,  595,  594,  593,  592,  591,  590,  589,  588,
+      587,  586,  585,  584,  583,  582,  581,  580,  578,  577,
+      576,  575,  574,  573,  572,  571,  570,  569,  568,  567,
+      566,  565,  563,  561,  560,  559,  558,  557,  556,  555,
+      554,  553,  552,  551,  550,  549,  548,  547,  546,  545,
+      543,  542,  541,  540,  539,  538,  537,  536,  535,  533,
+      531,  530,  529,  528,  527,  526,  525,  524,  523,  522,
+
+      521,  520,  519,  518,  517,  516,  515,  514,  513,  512,
+      510,  509,  508,  507,  506,  505,  503,  502,  501,  500,
+      499,  498,  496,  495,  493,  492,  491,  489,  487,  486,
+      485,  484,  483,  482,  481,  479,  478,  477,  476,  474,
+      470,  468,  467,  464,  461,  460,  458,  457,  456,  455,
+      454,  452,  451,  450,  449,  448,  447,  446,  445,  444,
+      443,  442,  441,  440,  439,  438,  436,  435,  434,  432,
+      431,  430,  429,  428,  427,  426,  425,  424,  422,  421,
+      419,  418,  417,  416,  415,  414,  413,  412,  411,  410,
+      409,  408,  407,  405,  402,  401,  400,  398,  397,  396,
+
+      394,  393,  392,  391,  389,  388,  387,  386,  385,  384,
+      383,  382,  381,  379,  378,  377,  376,  375,  374,  373,
+      372,  371,  370,  369,  368,  367,  366,  365,  363,  362,
+      361,  360,  358,  355,  354,  353,  352,  351,  350,  349,
+      348,  347,  345,  342,  340,  336,  334,  331,  324,  323,
+      322,  321,  320,  319,  318,  317,  315,  314,  313,  312,
+      311,  310,  309,  308,  307,  306,  304,  303,  302,  301,
+      300,  299,  298,  296,  295,  294,  293,  292,  291,  290,
+      289,  288,  287,  286,  285,  284,  283,  282,  281,  280,
+      279,  278,  277,  275,  274,  273,  272,  271,  269,  268,
+
+      267,  266,  265,  264,  262,  261,  260,  259,  258,  257,
+      256,  255,  254,  253,  252,  251,  249,  248,  247,  246,
+      245,  244,  243,  242,  241,  240,  239,  238,  237,  236,
+      235,  234,  233,  232,  231,  230,  229,  228,  227,  226,
+      225,  224,  222,  221,  220,  219,  218,  217,  212,  210,
+      208,  206,  201,  197,  189,  188,  187,  186,  185,  184,
+      183,  182,  180,  179,  178,  176,  175,  174,  173,  171,
+      169,  165,  164,  162,  161,  160,  158,  157,  155,  154,
+      153,  152,  151,  150,  148,  147,  146,  145,  144,  143,
+      142,  139,  138,  136,  135,  134,  133,  129,  128,  127,
+
+      125,  124,  123,  122,  120,  118,  114,  105,  104,   98,
+       97,   77,   72,   66,   52,   49,   48,   43,   41,   39,
+       38,   24,   14,   11, 2221, 2221, 2221, 2221, 2221, 2221,
+     2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221,
+     2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221,
+     2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221,
+     2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221,
+     2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221,
+     2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221,
+     2221, 2221, 2221, 2221, 2221, 2221, 2221, 2221
 
     } ;
 
@@ -2043,7 +2101,7 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[221] =
+static const flex_int16_t yy_rule_linenum[229] =
     {   0,
       147,  149,  151,  156,  157,  162,  163,  164,  176,  179,
       184,  191,  200,  209,  218,  227,  236,  245,  254,  263,
@@ -2052,23 +2110,24 @@ static const flex_int16_t yy_rule_linenum[221] =
       467,  476,  485,  494,  503,  512,  521,  530,  539,  548,
       557,  571,  580,  589,  598,  607,  619,  631,  643,  655,
       668,  680,  692,  704,  716,  728,  740,  752,  764,  776,
-      788,  800,  809,  820,  831,  842,  853,  864,  875,  886,
-      897,  906,  915,  924,  933,  944,  955,  966,  977,  988,
-      999, 1009, 1020, 1029, 1038, 1053, 1070, 1079, 1088, 1097,
-
-     1106, 1115, 1124, 1133, 1142, 1151, 1160, 1184, 1208, 1217,
-     1227, 1237, 1248, 1258, 1269, 1278, 1287, 1296, 1305, 1314,
-     1324, 1333, 1342, 1351, 1362, 1373, 1384, 1393, 1402, 1411,
-     1420, 1429, 1438, 1447, 1456, 1465, 1475, 1487, 1500, 1509,
-     1518, 1528, 1538, 1547, 1558, 1568, 1577, 1587, 1597, 1606,
-     1615, 1624, 1633, 1643, 1652, 1661, 1670, 1679, 1688, 1697,
-     1706, 1715, 1724, 1733, 1742, 1751, 1760, 1769, 1778, 1787,
+      788,  800,  809,  818,  827,  836,  845,  854,  863,  872,
+      881,  892,  903,  914,  925,  936,  947,  958,  969,  978,
+      987,  996, 1005, 1016, 1027, 1038, 1049, 1060, 1071, 1081,
+
+     1092, 1101, 1110, 1125, 1142, 1151, 1160, 1169, 1178, 1187,
+     1196, 1205, 1214, 1223, 1232, 1256, 1280, 1289, 1299, 1309,
+     1320, 1330, 1341, 1350, 1359, 1368, 1377, 1386, 1396, 1405,
+     1414, 1423, 1434, 1445, 1456, 1465, 1474, 1483, 1492, 1501,
+     1510, 1519, 1528, 1537, 1547, 1559, 1572, 1581, 1590, 1600,
+     1610, 1619, 1630, 1640, 1649, 1659, 1669, 1678, 1687, 1696,
+     1705, 1715, 1724, 1733, 1742, 1751, 1760, 1769, 1778, 1787,
      1796, 1805, 1814, 1823, 1832, 1841, 1850, 1859, 1868, 1877,
      1886, 1895, 1904, 1913, 1922, 1931, 1940, 1949, 1958, 1967,
-     1976, 1985, 1994, 2003, 2012, 2021, 2033, 2042, 2051, 2060,
+     1976, 1985, 1994, 2003, 2012, 2021, 2030, 2039, 2048, 2057,
 
-     2069, 2081, 2093, 2192, 2197, 2202, 2207, 2208, 2209, 2210,
-     2211, 2212, 2214, 2232, 2245, 2250, 2254, 2256, 2258, 2260
+     2066, 2075, 2084, 2093, 2105, 2114, 2123, 2132, 2141, 2153,
+     2165, 2264, 2269, 2274, 2279, 2280, 2281, 2282, 2283, 2284,
+     2286, 2304, 2317, 2322, 2326, 2328, 2330, 2332
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -2121,7 +2180,7 @@ using namespace isc::dhcp;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::dhcp::Parser6Context::fatal(msg)
-#line 2125 "dhcp6_lexer.cc"
+#line 2184 "dhcp6_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -2147,8 +2206,8 @@ using namespace isc::dhcp;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 2151 "dhcp6_lexer.cc"
-#line 2152 "dhcp6_lexer.cc"
+#line 2210 "dhcp6_lexer.cc"
+#line 2211 "dhcp6_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -2478,7 +2537,7 @@ YY_DECL
     }
 
 
-#line 2482 "dhcp6_lexer.cc"
+#line 2541 "dhcp6_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2507,13 +2566,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 2118 )
+				if ( yy_current_state >= 2222 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 2117 );
+		while ( yy_current_state != 2221 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2532,13 +2591,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 221 )
+			else if ( yy_act < 229 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], yytext );
-			else if ( yy_act == 221 )
+			else if ( yy_act == 229 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         yytext );
-			else if ( yy_act == 222 )
+			else if ( yy_act == 230 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -3446,6 +3505,102 @@ YY_RULE_SETUP
 case 73:
 YY_RULE_SETUP
 #line 809 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_GROUP_COMMIT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("group-commit", driver.loc_);
+    }
+}
+	YY_BREAK
+case 74:
+YY_RULE_SETUP
+#line 818 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_FSYNC_POLICY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("fsync-policy", driver.loc_);
+    }
+}
+	YY_BREAK
+case 75:
+YY_RULE_SETUP
+#line 827 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_FSYNC_INTERVAL(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("fsync-interval", driver.loc_);
+    }
+}
+	YY_BREAK
+case 76:
+YY_RULE_SETUP
+#line 836 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_WAIT_FOR_DURABILITY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("wait-for-durability", driver.loc_);
+    }
+}
+	YY_BREAK
+case 77:
+YY_RULE_SETUP
+#line 845 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_LFC_THREADS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("lfc-threads", driver.loc_);
+    }
+}
+	YY_BREAK
+case 78:
+YY_RULE_SETUP
+#line 854 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_LFC_SNAPSHOT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("lfc-snapshot", driver.loc_);
+    }
+}
+	YY_BREAK
+case 79:
+YY_RULE_SETUP
+#line 863 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_LEASE_STATS_COUNTERS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("lease-stats-counters", driver.loc_);
+    }
+}
+	YY_BREAK
+case 80:
+YY_RULE_SETUP
+#line 872 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_LEASE_EXPIRATION_BUCKETS(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("lease-expiration-buckets", driver.loc_);
+    }
+}
+	YY_BREAK
+case 81:
+YY_RULE_SETUP
+#line 881 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3457,9 +3612,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 74:
+case 82:
 YY_RULE_SETUP
-#line 820 "dhcp6_lexer.ll"
+#line 892 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3471,9 +3626,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 75:
+case 83:
 YY_RULE_SETUP
-#line 831 "dhcp6_lexer.ll"
+#line 903 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3485,9 +3640,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 76:
+case 84:
 YY_RULE_SETUP
-#line 842 "dhcp6_lexer.ll"
+#line 914 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3499,9 +3654,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 77:
+case 85:
 YY_RULE_SETUP
-#line 853 "dhcp6_lexer.ll"
+#line 925 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3513,9 +3668,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 78:
+case 86:
 YY_RULE_SETUP
-#line 864 "dhcp6_lexer.ll"
+#line 936 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3527,9 +3682,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 79:
+case 87:
 YY_RULE_SETUP
-#line 875 "dhcp6_lexer.ll"
+#line 947 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3541,9 +3696,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 80:
+case 88:
 YY_RULE_SETUP
-#line 886 "dhcp6_lexer.ll"
+#line 958 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3555,9 +3710,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 81:
+case 89:
 YY_RULE_SETUP
-#line 897 "dhcp6_lexer.ll"
+#line 969 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3567,9 +3722,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 82:
+case 90:
 YY_RULE_SETUP
-#line 906 "dhcp6_lexer.ll"
+#line 978 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3579,9 +3734,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 83:
+case 91:
 YY_RULE_SETUP
-#line 915 "dhcp6_lexer.ll"
+#line 987 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3591,9 +3746,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 84:
+case 92:
 YY_RULE_SETUP
-#line 924 "dhcp6_lexer.ll"
+#line 996 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3603,9 +3758,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 85:
+case 93:
 YY_RULE_SETUP
-#line 933 "dhcp6_lexer.ll"
+#line 1005 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3617,9 +3772,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 86:
+case 94:
 YY_RULE_SETUP
-#line 944 "dhcp6_lexer.ll"
+#line 1016 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3631,9 +3786,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 87:
+case 95:
 YY_RULE_SETUP
-#line 955 "dhcp6_lexer.ll"
+#line 1027 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3645,9 +3800,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 96:
 YY_RULE_SETUP
-#line 966 "dhcp6_lexer.ll"
+#line 1038 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3659,9 +3814,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
+case 97:
 YY_RULE_SETUP
-#line 977 "dhcp6_lexer.ll"
+#line 1049 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3673,9 +3828,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 90:
+case 98:
 YY_RULE_SETUP
-#line 988 "dhcp6_lexer.ll"
+#line 1060 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3687,9 +3842,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 91:
+case 99:
 YY_RULE_SETUP
-#line 999 "dhcp6_lexer.ll"
+#line 1071 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3700,9 +3855,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 92:
+case 100:
 YY_RULE_SETUP
-#line 1009 "dhcp6_lexer.ll"
+#line 1081 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3714,9 +3869,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 93:
+case 101:
 YY_RULE_SETUP
-#line 1020 "dhcp6_lexer.ll"
+#line 1092 "dhcp6_lexer.ll"
 {
     switch (driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3726,9 +3881,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 94:
+case 102:
 YY_RULE_SETUP
-#line 1029 "dhcp6_lexer.ll"
+#line 1101 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3738,9 +3893,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 95:
+case 103:
 YY_RULE_SETUP
-#line 1038 "dhcp6_lexer.ll"
+#line 1110 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3756,9 +3911,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 96:
+case 104:
 YY_RULE_SETUP
-#line 1053 "dhcp6_lexer.ll"
+#line 1125 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -3776,9 +3931,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 97:
+case 105:
 YY_RULE_SETUP
-#line 1070 "dhcp6_lexer.ll"
+#line 1142 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -3788,9 +3943,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 98:
+case 106:
 YY_RULE_SETUP
-#line 1079 "dhcp6_lexer.ll"
+#line 1151 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -3800,9 +3955,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 99:
+case 107:
 YY_RULE_SETUP
-#line 1088 "dhcp6_lexer.ll"
+#line 1160 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3812,9 +3967,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 100:
+case 108:
 YY_RULE_SETUP
-#line 1097 "dhcp6_lexer.ll"
+#line 1169 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3824,9 +3979,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 101:
+case 109:
 YY_RULE_SETUP
-#line 1106 "dhcp6_lexer.ll"
+#line 1178 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3836,9 +3991,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 102:
+case 110:
 YY_RULE_SETUP
-#line 1115 "dhcp6_lexer.ll"
+#line 1187 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3848,9 +4003,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 103:
+case 111:
 YY_RULE_SETUP
-#line 1124 "dhcp6_lexer.ll"
+#line 1196 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3860,9 +4015,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 104:
+case 112:
 YY_RULE_SETUP
-#line 1133 "dhcp6_lexer.ll"
+#line 1205 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3872,9 +4027,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 105:
+case 113:
 YY_RULE_SETUP
-#line 1142 "dhcp6_lexer.ll"
+#line 1214 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -3884,9 +4039,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 106:
+case 114:
 YY_RULE_SETUP
-#line 1151 "dhcp6_lexer.ll"
+#line 1223 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::POOLS:
@@ -3896,9 +4051,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 107:
+case 115:
 YY_RULE_SETUP
-#line 1160 "dhcp6_lexer.ll"
+#line 1232 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3923,9 +4078,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 108:
+case 116:
 YY_RULE_SETUP
-#line 1184 "dhcp6_lexer.ll"
+#line 1256 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3950,9 +4105,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 109:
+case 117:
 YY_RULE_SETUP
-#line 1208 "dhcp6_lexer.ll"
+#line 1280 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3962,9 +4117,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 110:
+case 118:
 YY_RULE_SETUP
-#line 1217 "dhcp6_lexer.ll"
+#line 1289 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3975,9 +4130,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 111:
+case 119:
 YY_RULE_SETUP
-#line 1227 "dhcp6_lexer.ll"
+#line 1299 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3988,9 +4143,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 112:
+case 120:
 YY_RULE_SETUP
-#line 1237 "dhcp6_lexer.ll"
+#line 1309 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -4002,9 +4157,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 113:
+case 121:
 YY_RULE_SETUP
-#line 1248 "dhcp6_lexer.ll"
+#line 1320 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -4015,9 +4170,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 122:
 YY_RULE_SETUP
-#line 1258 "dhcp6_lexer.ll"
+#line 1330 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4029,9 +4184,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 123:
 YY_RULE_SETUP
-#line 1269 "dhcp6_lexer.ll"
+#line 1341 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -4041,9 +4196,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 124:
 YY_RULE_SETUP
-#line 1278 "dhcp6_lexer.ll"
+#line 1350 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -4053,9 +4208,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 125:
 YY_RULE_SETUP
-#line 1287 "dhcp6_lexer.ll"
+#line 1359 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -4065,9 +4220,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 126:
 YY_RULE_SETUP
-#line 1296 "dhcp6_lexer.ll"
+#line 1368 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -4077,9 +4232,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 127:
 YY_RULE_SETUP
-#line 1305 "dhcp6_lexer.ll"
+#line 1377 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATION_MODE:
@@ -4089,9 +4244,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 128:
 YY_RULE_SETUP
-#line 1314 "dhcp6_lexer.ll"
+#line 1386 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -4102,9 +4257,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 121:
+case 129:
 YY_RULE_SETUP
-#line 1324 "dhcp6_lexer.ll"
+#line 1396 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4114,9 +4269,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 122:
+case 130:
 YY_RULE_SETUP
-#line 1333 "dhcp6_lexer.ll"
+#line 1405 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4126,9 +4281,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 123:
+case 131:
 YY_RULE_SETUP
-#line 1342 "dhcp6_lexer.ll"
+#line 1414 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4138,9 +4293,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 124:
+case 132:
 YY_RULE_SETUP
-#line 1351 "dhcp6_lexer.ll"
+#line 1423 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4152,9 +4307,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 125:
+case 133:
 YY_RULE_SETUP
-#line 1362 "dhcp6_lexer.ll"
+#line 1434 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4166,9 +4321,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 126:
+case 134:
 YY_RULE_SETUP
-#line 1373 "dhcp6_lexer.ll"
+#line 1445 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4180,9 +4335,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 127:
+case 135:
 YY_RULE_SETUP
-#line 1384 "dhcp6_lexer.ll"
+#line 1456 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4192,9 +4347,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 128:
+case 136:
 YY_RULE_SETUP
-#line 1393 "dhcp6_lexer.ll"
+#line 1465 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -4204,9 +4359,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 129:
+case 137:
 YY_RULE_SETUP
-#line 1402 "dhcp6_lexer.ll"
+#line 1474 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -4216,9 +4371,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 130:
+case 138:
 YY_RULE_SETUP
-#line 1411 "dhcp6_lexer.ll"
+#line 1483 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -4228,9 +4383,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 131:
+case 139:
 YY_RULE_SETUP
-#line 1420 "dhcp6_lexer.ll"
+#line 1492 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -4240,9 +4395,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 132:
+case 140:
 YY_RULE_SETUP
-#line 1429 "dhcp6_lexer.ll"
+#line 1501 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -4252,9 +4407,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 133:
+case 141:
 YY_RULE_SETUP
-#line 1438 "dhcp6_lexer.ll"
+#line 1510 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -4264,9 +4419,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 134:
+case 142:
 YY_RULE_SETUP
-#line 1447 "dhcp6_lexer.ll"
+#line 1519 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -4276,9 +4431,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 135:
+case 143:
 YY_RULE_SETUP
-#line 1456 "dhcp6_lexer.ll"
+#line 1528 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -4288,9 +4443,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 136:
+case 144:
 YY_RULE_SETUP
-#line 1465 "dhcp6_lexer.ll"
+#line 1537 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4301,9 +4456,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 137:
+case 145:
 YY_RULE_SETUP
-#line 1475 "dhcp6_lexer.ll"
+#line 1547 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -4316,9 +4471,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 138:
+case 146:
 YY_RULE_SETUP
-#line 1487 "dhcp6_lexer.ll"
+#line 1559 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -4332,9 +4487,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 139:
+case 147:
 YY_RULE_SETUP
-#line 1500 "dhcp6_lexer.ll"
+#line 1572 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CLIENT_CLASSES:
@@ -4344,9 +4499,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 140:
+case 148:
 YY_RULE_SETUP
-#line 1509 "dhcp6_lexer.ll"
+#line 1581 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CLIENT_CLASSES:
@@ -4356,9 +4511,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 141:
+case 149:
 YY_RULE_SETUP
-#line 1518 "dhcp6_lexer.ll"
+#line 1590 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4369,9 +4524,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 142:
+case 150:
 YY_RULE_SETUP
-#line 1528 "dhcp6_lexer.ll"
+#line 1600 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -4382,9 +4537,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 143:
+case 151:
 YY_RULE_SETUP
-#line 1538 "dhcp6_lexer.ll"
+#line 1610 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -4394,9 +4549,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 144:
+case 152:
 YY_RULE_SETUP
-#line 1547 "dhcp6_lexer.ll"
+#line 1619 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::MAC_SOURCES:
@@ -4408,9 +4563,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 145:
+case 153:
 YY_RULE_SETUP
-#line 1558 "dhcp6_lexer.ll"
+#line 1630 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOST_RESERVATION_IDENTIFIERS:
@@ -4421,9 +4576,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 146:
+case 154:
 YY_RULE_SETUP
-#line 1568 "dhcp6_lexer.ll"
+#line 1640 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -4433,9 +4588,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 147:
+case 155:
 YY_RULE_SETUP
-#line 1577 "dhcp6_lexer.ll"
+#line 1649 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOST_RESERVATION_IDENTIFIERS:
@@ -4446,9 +4601,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 148:
+case 156:
 YY_RULE_SETUP
-#line 1587 "dhcp6_lexer.ll"
+#line 1659 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -4459,9 +4614,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 149:
+case 157:
 YY_RULE_SETUP
-#line 1597 "dhcp6_lexer.ll"
+#line 1669 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -4471,9 +4626,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 150:
+case 158:
 YY_RULE_SETUP
-#line 1606 "dhcp6_lexer.ll"
+#line 1678 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -4483,9 +4638,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 151:
+case 159:
 YY_RULE_SETUP
-#line 1615 "dhcp6_lexer.ll"
+#line 1687 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -4495,9 +4650,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 152:
+case 160:
 YY_RULE_SETUP
-#line 1624 "dhcp6_lexer.ll"
+#line 1696 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -4507,9 +4662,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 153:
+case 161:
 YY_RULE_SETUP
-#line 1633 "dhcp6_lexer.ll"
+#line 1705 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -4520,9 +4675,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 154:
+case 162:
 YY_RULE_SETUP
-#line 1643 "dhcp6_lexer.ll"
+#line 1715 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RELAY:
@@ -4532,9 +4687,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 155:
+case 163:
 YY_RULE_SETUP
-#line 1652 "dhcp6_lexer.ll"
+#line 1724 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4544,9 +4699,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 156:
+case 164:
 YY_RULE_SETUP
-#line 1661 "dhcp6_lexer.ll"
+#line 1733 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -4556,9 +4711,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 157:
+case 165:
 YY_RULE_SETUP
-#line 1670 "dhcp6_lexer.ll"
+#line 1742 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -4568,9 +4723,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 158:
+case 166:
 YY_RULE_SETUP
-#line 1679 "dhcp6_lexer.ll"
+#line 1751 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -4580,9 +4735,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 159:
+case 167:
 YY_RULE_SETUP
-#line 1688 "dhcp6_lexer.ll"
+#line 1760 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4592,9 +4747,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 160:
+case 168:
 YY_RULE_SETUP
-#line 1697 "dhcp6_lexer.ll"
+#line 1769 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -4604,9 +4759,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 161:
+case 169:
 YY_RULE_SETUP
-#line 1706 "dhcp6_lexer.ll"
+#line 1778 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -4616,9 +4771,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 162:
+case 170:
 YY_RULE_SETUP
-#line 1715 "dhcp6_lexer.ll"
+#line 1787 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -4628,9 +4783,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 163:
+case 171:
 YY_RULE_SETUP
-#line 1724 "dhcp6_lexer.ll"
+#line 1796 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -4640,9 +4795,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 164:
+case 172:
 YY_RULE_SETUP
-#line 1733 "dhcp6_lexer.ll"
+#line 1805 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -4652,9 +4807,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 165:
+case 173:
 YY_RULE_SETUP
-#line 1742 "dhcp6_lexer.ll"
+#line 1814 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -4664,9 +4819,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 166:
+case 174:
 YY_RULE_SETUP
-#line 1751 "dhcp6_lexer.ll"
+#line 1823 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -4676,9 +4831,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 167:
+case 175:
 YY_RULE_SETUP
-#line 1760 "dhcp6_lexer.ll"
+#line 1832 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4688,9 +4843,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 168:
+case 176:
 YY_RULE_SETUP
-#line 1769 "dhcp6_lexer.ll"
+#line 1841 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4700,9 +4855,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 169:
+case 177:
 YY_RULE_SETUP
-#line 1778 "dhcp6_lexer.ll"
+#line 1850 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4712,9 +4867,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 170:
+case 178:
 YY_RULE_SETUP
-#line 1787 "dhcp6_lexer.ll"
+#line 1859 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4724,9 +4879,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 171:
+case 179:
 YY_RULE_SETUP
-#line 1796 "dhcp6_lexer.ll"
+#line 1868 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4736,9 +4891,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 172:
+case 180:
 YY_RULE_SETUP
-#line 1805 "dhcp6_lexer.ll"
+#line 1877 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4748,9 +4903,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 173:
+case 181:
 YY_RULE_SETUP
-#line 1814 "dhcp6_lexer.ll"
+#line 1886 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4760,9 +4915,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 174:
+case 182:
 YY_RULE_SETUP
-#line 1823 "dhcp6_lexer.ll"
+#line 1895 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4772,9 +4927,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 175:
+case 183:
 YY_RULE_SETUP
-#line 1832 "dhcp6_lexer.ll"
+#line 1904 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4784,9 +4939,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 176:
+case 184:
 YY_RULE_SETUP
-#line 1841 "dhcp6_lexer.ll"
+#line 1913 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_MULTI_THREADING:
@@ -4796,9 +4951,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 177:
+case 185:
 YY_RULE_SETUP
-#line 1850 "dhcp6_lexer.ll"
+#line 1922 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_MULTI_THREADING:
@@ -4808,9 +4963,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 178:
+case 186:
 YY_RULE_SETUP
-#line 1859 "dhcp6_lexer.ll"
+#line 1931 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_MULTI_THREADING:
@@ -4820,9 +4975,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 179:
+case 187:
 YY_RULE_SETUP
-#line 1868 "dhcp6_lexer.ll"
+#line 1940 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4832,9 +4987,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 180:
+case 188:
 YY_RULE_SETUP
-#line 1877 "dhcp6_lexer.ll"
+#line 1949 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -4844,9 +4999,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 181:
+case 189:
 YY_RULE_SETUP
-#line 1886 "dhcp6_lexer.ll"
+#line 1958 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -4856,9 +5011,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 182:
+case 190:
 YY_RULE_SETUP
-#line 1895 "dhcp6_lexer.ll"
+#line 1967 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -4868,9 +5023,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 183:
+case 191:
 YY_RULE_SETUP
-#line 1904 "dhcp6_lexer.ll"
+#line 1976 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4880,9 +5035,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 184:
+case 192:
 YY_RULE_SETUP
-#line 1913 "dhcp6_lexer.ll"
+#line 1985 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_QUEUE_CONTROL:
@@ -4892,9 +5047,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 185:
+case 193:
 YY_RULE_SETUP
-#line 1922 "dhcp6_lexer.ll"
+#line 1994 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_QUEUE_CONTROL:
@@ -4904,9 +5059,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 186:
+case 194:
 YY_RULE_SETUP
-#line 1931 "dhcp6_lexer.ll"
+#line 2003 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_QUEUE_CONTROL:
@@ -4916,9 +5071,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 187:
+case 195:
 YY_RULE_SETUP
-#line 1940 "dhcp6_lexer.ll"
+#line 2012 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4928,9 +5083,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 188:
+case 196:
 YY_RULE_SETUP
-#line 1949 "dhcp6_lexer.ll"
+#line 2021 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -4940,9 +5095,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 189:
+case 197:
 YY_RULE_SETUP
-#line 1958 "dhcp6_lexer.ll"
+#line 2030 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4952,9 +5107,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 190:
+case 198:
 YY_RULE_SETUP
-#line 1967 "dhcp6_lexer.ll"
+#line 2039 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4964,9 +5119,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 191:
+case 199:
 YY_RULE_SETUP
-#line 1976 "dhcp6_lexer.ll"
+#line 2048 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4976,9 +5131,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 192:
+case 200:
 YY_RULE_SETUP
-#line 1985 "dhcp6_lexer.ll"
+#line 2057 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -4988,9 +5143,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 193:
+case 201:
 YY_RULE_SETUP
-#line 1994 "dhcp6_lexer.ll"
+#line 2066 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -5000,9 +5155,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 194:
+case 202:
 YY_RULE_SETUP
-#line 2003 "dhcp6_lexer.ll"
+#line 2075 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::POOLS:
@@ -5012,9 +5167,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 195:
+case 203:
 YY_RULE_SETUP
-#line 2012 "dhcp6_lexer.ll"
+#line 2084 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::POOLS:
@@ -5024,9 +5179,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 196:
+case 204:
 YY_RULE_SETUP
-#line 2021 "dhcp6_lexer.ll"
+#line 2093 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -5039,9 +5194,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 197:
+case 205:
 YY_RULE_SETUP
-#line 2033 "dhcp6_lexer.ll"
+#line 2105 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -5051,9 +5206,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 198:
+case 206:
 YY_RULE_SETUP
-#line 2042 "dhcp6_lexer.ll"
+#line 2114 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -5063,9 +5218,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 199:
+case 207:
 YY_RULE_SETUP
-#line 2051 "dhcp6_lexer.ll"
+#line 2123 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -5075,9 +5230,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 200:
+case 208:
 YY_RULE_SETUP
-#line 2060 "dhcp6_lexer.ll"
+#line 2132 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -5087,9 +5242,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 201:
+case 209:
 YY_RULE_SETUP
-#line 2069 "dhcp6_lexer.ll"
+#line 2141 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -5102,9 +5257,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 202:
+case 210:
 YY_RULE_SETUP
-#line 2081 "dhcp6_lexer.ll"
+#line 2153 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -5117,9 +5272,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 203:
+case 211:
 YY_RULE_SETUP
-#line 2093 "dhcp6_lexer.ll"
+#line 2165 "dhcp6_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -5219,65 +5374,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 204:
-/* rule 204 can match eol */
+case 212:
+/* rule 212 can match eol */
 YY_RULE_SETUP
-#line 2192 "dhcp6_lexer.ll"
+#line 2264 "dhcp6_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 205:
-/* rule 205 can match eol */
+case 213:
+/* rule 213 can match eol */
 YY_RULE_SETUP
-#line 2197 "dhcp6_lexer.ll"
+#line 2269 "dhcp6_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 206:
+case 214:
 YY_RULE_SETUP
-#line 2202 "dhcp6_lexer.ll"
+#line 2274 "dhcp6_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 207:
+case 215:
 YY_RULE_SETUP
-#line 2207 "dhcp6_lexer.ll"
+#line 2279 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 208:
+case 216:
 YY_RULE_SETUP
-#line 2208 "dhcp6_lexer.ll"
+#line 2280 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 209:
+case 217:
 YY_RULE_SETUP
-#line 2209 "dhcp6_lexer.ll"
+#line 2281 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 210:
+case 218:
 YY_RULE_SETUP
-#line 2210 "dhcp6_lexer.ll"
+#line 2282 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 211:
+case 219:
 YY_RULE_SETUP
-#line 2211 "dhcp6_lexer.ll"
+#line 2283 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 212:
+case 220:
 YY_RULE_SETUP
-#line 2212 "dhcp6_lexer.ll"
+#line 2284 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 213:
+case 221:
 YY_RULE_SETUP
-#line 2214 "dhcp6_lexer.ll"
+#line 2286 "dhcp6_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -5296,9 +5451,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 214:
+case 222:
 YY_RULE_SETUP
-#line 2232 "dhcp6_lexer.ll"
+#line 2304 "dhcp6_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -5312,43 +5467,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 215:
+case 223:
 YY_RULE_SETUP
-#line 2245 "dhcp6_lexer.ll"
+#line 2317 "dhcp6_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp6Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 216:
+case 224:
 YY_RULE_SETUP
-#line 2250 "dhcp6_lexer.ll"
+#line 2322 "dhcp6_lexer.ll"
 {
    return isc::dhcp::Dhcp6Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 217:
+case 225:
 YY_RULE_SETUP
-#line 2254 "dhcp6_lexer.ll"
+#line 2326 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 218:
+case 226:
 YY_RULE_SETUP
-#line 2256 "dhcp6_lexer.ll"
+#line 2328 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 219:
+case 227:
 YY_RULE_SETUP
-#line 2258 "dhcp6_lexer.ll"
+#line 2330 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 220:
+case 228:
 YY_RULE_SETUP
-#line 2260 "dhcp6_lexer.ll"
+#line 2332 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 2262 "dhcp6_lexer.ll"
+#line 2334 "dhcp6_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp6Parser::make_END(driver.loc_);
@@ -5372,12 +5527,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 221:
+case 229:
 YY_RULE_SETUP
-#line 2285 "dhcp6_lexer.ll"
+#line 2357 "dhcp6_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 5381 "dhcp6_lexer.cc"
+#line 5536 "dhcp6_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -5696,7 +5851,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 2118 )
+			if ( yy_current_state >= 2222 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -5729,11 +5884,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 2118 )
+		if ( yy_current_state >= 2222 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 2117);
+	yy_is_jam = (yy_current_state == 2221);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
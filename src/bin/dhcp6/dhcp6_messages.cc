@@ -153,6 +153,8 @@ extern const isc::log::MessageID DHCP6_STARTED = "DHCP6_STARTED";
 extern const isc::log::MessageID DHCP6_STARTING = "DHCP6_STARTING";
 extern const isc::log::MessageID DHCP6_START_INFO = "DHCP6_START_INFO";
 extern const isc::log::MessageID DHCP6_SUBNET_DATA = "DHCP6_SUBNET_DATA";
+extern const isc::log::MessageID DHCP6_SUBNET_DELTA_APPLIED = "DHCP6_SUBNET_DELTA_APPLIED";
+extern const isc::log::MessageID DHCP6_SUBNET_DELTA_APPLY_FAIL = "DHCP6_SUBNET_DELTA_APPLY_FAIL";
 extern const isc::log::MessageID DHCP6_SUBNET_DYNAMICALLY_CHANGED = "DHCP6_SUBNET_DYNAMICALLY_CHANGED";
 extern const isc::log::MessageID DHCP6_SUBNET_SELECTED = "DHCP6_SUBNET_SELECTED";
 extern const isc::log::MessageID DHCP6_SUBNET_SELECTION_FAILED = "DHCP6_SUBNET_SELECTION_FAILED";
@@ -313,6 +315,8 @@ const char* values[] = {
     "DHCP6_STARTING", "Kea DHCPv6 server version %1 (%2) starting",
     "DHCP6_START_INFO", "pid: %1, server port: %2, client port: %3, verbose: %4",
     "DHCP6_SUBNET_DATA", "%1: the selected subnet details: %2",
+    "DHCP6_SUBNET_DELTA_APPLIED", "applied subnet changes: %1 added, %2 replaced, %3 deleted",
+    "DHCP6_SUBNET_DELTA_APPLY_FAIL", "failed to apply subnet changes: %1",
     "DHCP6_SUBNET_DYNAMICALLY_CHANGED", "%1: changed selected subnet %2 to subnet %3 from shared network %4 for client assignments",
     "DHCP6_SUBNET_SELECTED", "%1: the subnet with ID %2 was selected for client assignments",
     "DHCP6_SUBNET_SELECTION_FAILED", "%1: failed to select subnet for the client",
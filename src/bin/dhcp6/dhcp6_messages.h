@@ -154,6 +154,8 @@ extern const isc::log::MessageID DHCP6_STARTED;
 extern const isc::log::MessageID DHCP6_STARTING;
 extern const isc::log::MessageID DHCP6_START_INFO;
 extern const isc::log::MessageID DHCP6_SUBNET_DATA;
+extern const isc::log::MessageID DHCP6_SUBNET_DELTA_APPLIED;
+extern const isc::log::MessageID DHCP6_SUBNET_DELTA_APPLY_FAIL;
 extern const isc::log::MessageID DHCP6_SUBNET_DYNAMICALLY_CHANGED;
 extern const isc::log::MessageID DHCP6_SUBNET_SELECTED;
 extern const isc::log::MessageID DHCP6_SUBNET_SELECTION_FAILED;
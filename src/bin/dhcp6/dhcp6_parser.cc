@@ -249,29 +249,29 @@ namespace isc { namespace dhcp {
   {
     switch (that.type_get ())
     {
-      case 233: // value
-      case 237: // map_value
-      case 278: // ddns_replace_client_name_value
-      case 315: // db_type
-      case 418: // hr_mode
-      case 554: // duid_type
-      case 600: // ncr_protocol_value
+      case 241: // value
+      case 245: // map_value
+      case 286: // ddns_replace_client_name_value
+      case 323: // db_type
+      case 435: // hr_mode
+      case 571: // duid_type
+      case 617: // ncr_protocol_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 216: // "boolean"
+      case 224: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 215: // "floating point"
+      case 223: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 214: // "integer"
+      case 222: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 213: // "constant string"
+      case 221: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -290,29 +290,29 @@ namespace isc { namespace dhcp {
   {
     switch (that.type_get ())
     {
-      case 233: // value
-      case 237: // map_value
-      case 278: // ddns_replace_client_name_value
-      case 315: // db_type
-      case 418: // hr_mode
-      case 554: // duid_type
-      case 600: // ncr_protocol_value
+      case 241: // value
+      case 245: // map_value
+      case 286: // ddns_replace_client_name_value
+      case 323: // db_type
+      case 435: // hr_mode
+      case 571: // duid_type
+      case 617: // ncr_protocol_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 216: // "boolean"
+      case 224: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 215: // "floating point"
+      case 223: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 214: // "integer"
+      case 222: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 213: // "constant string"
+      case 221: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -331,29 +331,29 @@ namespace isc { namespace dhcp {
     state = that.state;
     switch (that.type_get ())
     {
-      case 233: // value
-      case 237: // map_value
-      case 278: // ddns_replace_client_name_value
-      case 315: // db_type
-      case 418: // hr_mode
-      case 554: // duid_type
-      case 600: // ncr_protocol_value
+      case 241: // value
+      case 245: // map_value
+      case 286: // ddns_replace_client_name_value
+      case 323: // db_type
+      case 435: // hr_mode
+      case 571: // duid_type
+      case 617: // ncr_protocol_value
         value.copy< ElementPtr > (that.value);
         break;
 
-      case 216: // "boolean"
+      case 224: // "boolean"
         value.copy< bool > (that.value);
         break;
 
-      case 215: // "floating point"
+      case 223: // "floating point"
         value.copy< double > (that.value);
         break;
 
-      case 214: // "integer"
+      case 222: // "integer"
         value.copy< int64_t > (that.value);
         break;
 
-      case 213: // "constant string"
+      case 221: // "constant string"
         value.copy< std::string > (that.value);
         break;
 
@@ -371,29 +371,29 @@ namespace isc { namespace dhcp {
     state = that.state;
     switch (that.type_get ())
     {
-      case 233: // value
-      case 237: // map_value
-      case 278: // ddns_replace_client_name_value
-      case 315: // db_type
-      case 418: // hr_mode
-      case 554: // duid_type
-      case 600: // ncr_protocol_value
+      case 241: // value
+      case 245: // map_value
+      case 286: // ddns_replace_client_name_value
+      case 323: // db_type
+      case 435: // hr_mode
+      case 571: // duid_type
+      case 617: // ncr_protocol_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 216: // "boolean"
+      case 224: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 215: // "floating point"
+      case 223: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 214: // "integer"
+      case 222: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 213: // "constant string"
+      case 221: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -436,68 +436,68 @@ namespace isc { namespace dhcp {
         << yysym.location << ": ";
     switch (yytype)
     {
-      case 213: // "constant string"
-#line 295 "dhcp6_parser.yy"
+      case 221: // "constant string"
+#line 303 "dhcp6_parser.yy"
                  { yyoutput << yysym.value.template as < std::string > (); }
 #line 443 "dhcp6_parser.cc"
         break;
 
-      case 214: // "integer"
-#line 295 "dhcp6_parser.yy"
+      case 222: // "integer"
+#line 303 "dhcp6_parser.yy"
                  { yyoutput << yysym.value.template as < int64_t > (); }
 #line 449 "dhcp6_parser.cc"
         break;
 
-      case 215: // "floating point"
-#line 295 "dhcp6_parser.yy"
+      case 223: // "floating point"
+#line 303 "dhcp6_parser.yy"
                  { yyoutput << yysym.value.template as < double > (); }
 #line 455 "dhcp6_parser.cc"
         break;
 
-      case 216: // "boolean"
-#line 295 "dhcp6_parser.yy"
+      case 224: // "boolean"
+#line 303 "dhcp6_parser.yy"
                  { yyoutput << yysym.value.template as < bool > (); }
 #line 461 "dhcp6_parser.cc"
         break;
 
-      case 233: // value
-#line 295 "dhcp6_parser.yy"
+      case 241: // value
+#line 303 "dhcp6_parser.yy"
                  { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 467 "dhcp6_parser.cc"
         break;
 
-      case 237: // map_value
-#line 295 "dhcp6_parser.yy"
+      case 245: // map_value
+#line 303 "dhcp6_parser.yy"
                  { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 473 "dhcp6_parser.cc"
         break;
 
-      case 278: // ddns_replace_client_name_value
-#line 295 "dhcp6_parser.yy"
+      case 286: // ddns_replace_client_name_value
+#line 303 "dhcp6_parser.yy"
                  { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 479 "dhcp6_parser.cc"
         break;
 
-      case 315: // db_type
-#line 295 "dhcp6_parser.yy"
+      case 323: // db_type
+#line 303 "dhcp6_parser.yy"
                  { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 485 "dhcp6_parser.cc"
         break;
 
-      case 418: // hr_mode
-#line 295 "dhcp6_parser.yy"
+      case 435: // hr_mode
+#line 303 "dhcp6_parser.yy"
                  { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 491 "dhcp6_parser.cc"
         break;
 
-      case 554: // duid_type
-#line 295 "dhcp6_parser.yy"
+      case 571: // duid_type
+#line 303 "dhcp6_parser.yy"
                  { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 497 "dhcp6_parser.cc"
         break;
 
-      case 600: // ncr_protocol_value
-#line 295 "dhcp6_parser.yy"
+      case 617: // ncr_protocol_value
+#line 303 "dhcp6_parser.yy"
                  { yyoutput << yysym.value.template as < ElementPtr > (); }
 #line 503 "dhcp6_parser.cc"
         break;
@@ -717,29 +717,29 @@ namespace isc { namespace dhcp {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 233: // value
-      case 237: // map_value
-      case 278: // ddns_replace_client_name_value
-      case 315: // db_type
-      case 418: // hr_mode
-      case 554: // duid_type
-      case 600: // ncr_protocol_value
+      case 241: // value
+      case 245: // map_value
+      case 286: // ddns_replace_client_name_value
+      case 323: // db_type
+      case 435: // hr_mode
+      case 571: // duid_type
+      case 617: // ncr_protocol_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 216: // "boolean"
+      case 224: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 215: // "floating point"
+      case 223: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 214: // "integer"
+      case 222: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 213: // "constant string"
+      case 221: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -764,133 +764,133 @@ namespace isc { namespace dhcp {
           switch (yyn)
             {
   case 2:
-#line 304 "dhcp6_parser.yy"
+#line 312 "dhcp6_parser.yy"
                      { ctx.ctx_ = ctx.NO_KEYWORD; }
 #line 770 "dhcp6_parser.cc"
     break;
 
   case 4:
-#line 305 "dhcp6_parser.yy"
+#line 313 "dhcp6_parser.yy"
                       { ctx.ctx_ = ctx.CONFIG; }
 #line 776 "dhcp6_parser.cc"
     break;
 
   case 6:
-#line 306 "dhcp6_parser.yy"
+#line 314 "dhcp6_parser.yy"
                  { ctx.ctx_ = ctx.DHCP6; }
 #line 782 "dhcp6_parser.cc"
     break;
 
   case 8:
-#line 307 "dhcp6_parser.yy"
+#line 315 "dhcp6_parser.yy"
                        { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
 #line 788 "dhcp6_parser.cc"
     break;
 
   case 10:
-#line 308 "dhcp6_parser.yy"
+#line 316 "dhcp6_parser.yy"
                    { ctx.ctx_ = ctx.SUBNET6; }
 #line 794 "dhcp6_parser.cc"
     break;
 
   case 12:
-#line 309 "dhcp6_parser.yy"
+#line 317 "dhcp6_parser.yy"
                  { ctx.ctx_ = ctx.POOLS; }
 #line 800 "dhcp6_parser.cc"
     break;
 
   case 14:
-#line 310 "dhcp6_parser.yy"
+#line 318 "dhcp6_parser.yy"
                    { ctx.ctx_ = ctx.PD_POOLS; }
 #line 806 "dhcp6_parser.cc"
     break;
 
   case 16:
-#line 311 "dhcp6_parser.yy"
+#line 319 "dhcp6_parser.yy"
                        { ctx.ctx_ = ctx.RESERVATIONS; }
 #line 812 "dhcp6_parser.cc"
     break;
 
   case 18:
-#line 312 "dhcp6_parser.yy"
+#line 320 "dhcp6_parser.yy"
                        { ctx.ctx_ = ctx.DHCP6; }
 #line 818 "dhcp6_parser.cc"
     break;
 
   case 20:
-#line 313 "dhcp6_parser.yy"
+#line 321 "dhcp6_parser.yy"
                       { ctx.ctx_ = ctx.OPTION_DEF; }
 #line 824 "dhcp6_parser.cc"
     break;
 
   case 22:
-#line 314 "dhcp6_parser.yy"
+#line 322 "dhcp6_parser.yy"
                        { ctx.ctx_ = ctx.OPTION_DATA; }
 #line 830 "dhcp6_parser.cc"
     break;
 
   case 24:
-#line 315 "dhcp6_parser.yy"
+#line 323 "dhcp6_parser.yy"
                          { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
 #line 836 "dhcp6_parser.cc"
     break;
 
   case 26:
-#line 316 "dhcp6_parser.yy"
+#line 324 "dhcp6_parser.yy"
                      { ctx.ctx_ = ctx.DHCP_DDNS; }
 #line 842 "dhcp6_parser.cc"
     break;
 
   case 28:
-#line 317 "dhcp6_parser.yy"
+#line 325 "dhcp6_parser.yy"
                           { ctx.ctx_ = ctx.CONFIG_CONTROL; }
 #line 848 "dhcp6_parser.cc"
     break;
 
   case 30:
-#line 325 "dhcp6_parser.yy"
+#line 333 "dhcp6_parser.yy"
                { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
 #line 854 "dhcp6_parser.cc"
     break;
 
   case 31:
-#line 326 "dhcp6_parser.yy"
+#line 334 "dhcp6_parser.yy"
              { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
 #line 860 "dhcp6_parser.cc"
     break;
 
   case 32:
-#line 327 "dhcp6_parser.yy"
+#line 335 "dhcp6_parser.yy"
                { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
 #line 866 "dhcp6_parser.cc"
     break;
 
   case 33:
-#line 328 "dhcp6_parser.yy"
+#line 336 "dhcp6_parser.yy"
               { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
 #line 872 "dhcp6_parser.cc"
     break;
 
   case 34:
-#line 329 "dhcp6_parser.yy"
+#line 337 "dhcp6_parser.yy"
                  { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
 #line 878 "dhcp6_parser.cc"
     break;
 
   case 35:
-#line 330 "dhcp6_parser.yy"
+#line 338 "dhcp6_parser.yy"
             { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 884 "dhcp6_parser.cc"
     break;
 
   case 36:
-#line 331 "dhcp6_parser.yy"
+#line 339 "dhcp6_parser.yy"
                     { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 890 "dhcp6_parser.cc"
     break;
 
   case 37:
-#line 334 "dhcp6_parser.yy"
+#line 342 "dhcp6_parser.yy"
                 {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
@@ -899,7 +899,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 38:
-#line 339 "dhcp6_parser.yy"
+#line 347 "dhcp6_parser.yy"
                      {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -910,7 +910,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 39:
-#line 344 "dhcp6_parser.yy"
+#line 352 "dhcp6_parser.yy"
                              {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -920,13 +920,13 @@ namespace isc { namespace dhcp {
     break;
 
   case 40:
-#line 350 "dhcp6_parser.yy"
+#line 358 "dhcp6_parser.yy"
                 { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 926 "dhcp6_parser.cc"
     break;
 
   case 43:
-#line 357 "dhcp6_parser.yy"
+#line 365 "dhcp6_parser.yy"
                                   {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
@@ -935,7 +935,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 44:
-#line 361 "dhcp6_parser.yy"
+#line 369 "dhcp6_parser.yy"
                                                       {
                   // map consisting of a shorter map followed by
                   // comma and string:value
@@ -945,7 +945,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 45:
-#line 368 "dhcp6_parser.yy"
+#line 376 "dhcp6_parser.yy"
                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
@@ -954,7 +954,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 46:
-#line 371 "dhcp6_parser.yy"
+#line 379 "dhcp6_parser.yy"
                                {
     // list parsing complete. Put any sanity checking here
 }
@@ -962,7 +962,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 49:
-#line 379 "dhcp6_parser.yy"
+#line 387 "dhcp6_parser.yy"
                       {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
@@ -971,7 +971,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 50:
-#line 383 "dhcp6_parser.yy"
+#line 391 "dhcp6_parser.yy"
                                            {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
@@ -980,7 +980,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 51:
-#line 390 "dhcp6_parser.yy"
+#line 398 "dhcp6_parser.yy"
                               {
     // List parsing about to start
 }
@@ -988,7 +988,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 52:
-#line 392 "dhcp6_parser.yy"
+#line 400 "dhcp6_parser.yy"
                                        {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
@@ -997,7 +997,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 55:
-#line 401 "dhcp6_parser.yy"
+#line 409 "dhcp6_parser.yy"
                                {
                           ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -1006,7 +1006,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 56:
-#line 405 "dhcp6_parser.yy"
+#line 413 "dhcp6_parser.yy"
                                                             {
                           ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -1015,7 +1015,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 57:
-#line 416 "dhcp6_parser.yy"
+#line 424 "dhcp6_parser.yy"
                                 {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as < std::string > ();
@@ -1026,7 +1026,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 58:
-#line 425 "dhcp6_parser.yy"
+#line 433 "dhcp6_parser.yy"
                            {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -1037,7 +1037,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 59:
-#line 430 "dhcp6_parser.yy"
+#line 438 "dhcp6_parser.yy"
                                 {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -1050,7 +1050,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 63:
-#line 448 "dhcp6_parser.yy"
+#line 456 "dhcp6_parser.yy"
                     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -1065,7 +1065,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 64:
-#line 457 "dhcp6_parser.yy"
+#line 465 "dhcp6_parser.yy"
                                                     {
     // No global parameter is required
     ctx.stack_.pop_back();
@@ -1075,7 +1075,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 65:
-#line 465 "dhcp6_parser.yy"
+#line 473 "dhcp6_parser.yy"
                           {
     // Parse the Dhcp6 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -1085,7 +1085,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 66:
-#line 469 "dhcp6_parser.yy"
+#line 477 "dhcp6_parser.yy"
                                {
     // No global parameter is required
     // parsing completed
@@ -1094,7 +1094,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 131:
-#line 544 "dhcp6_parser.yy"
+#line 552 "dhcp6_parser.yy"
                                {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1102,7 +1102,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 132:
-#line 546 "dhcp6_parser.yy"
+#line 554 "dhcp6_parser.yy"
                {
     ElementPtr datadir(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data-directory", datadir);
@@ -1112,7 +1112,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 133:
-#line 552 "dhcp6_parser.yy"
+#line 560 "dhcp6_parser.yy"
                                                      {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("preferred-lifetime", prf);
@@ -1121,7 +1121,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 134:
-#line 557 "dhcp6_parser.yy"
+#line 565 "dhcp6_parser.yy"
                                                              {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("min-preferred-lifetime", prf);
@@ -1130,7 +1130,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 135:
-#line 562 "dhcp6_parser.yy"
+#line 570 "dhcp6_parser.yy"
                                                              {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-preferred-lifetime", prf);
@@ -1139,7 +1139,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 136:
-#line 567 "dhcp6_parser.yy"
+#line 575 "dhcp6_parser.yy"
                                              {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
@@ -1148,7 +1148,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 137:
-#line 572 "dhcp6_parser.yy"
+#line 580 "dhcp6_parser.yy"
                                                      {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("min-valid-lifetime", prf);
@@ -1157,7 +1157,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 138:
-#line 577 "dhcp6_parser.yy"
+#line 585 "dhcp6_parser.yy"
                                                      {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-valid-lifetime", prf);
@@ -1166,7 +1166,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 139:
-#line 582 "dhcp6_parser.yy"
+#line 590 "dhcp6_parser.yy"
                                        {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
@@ -1175,7 +1175,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 140:
-#line 587 "dhcp6_parser.yy"
+#line 595 "dhcp6_parser.yy"
                                          {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
@@ -1184,7 +1184,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 141:
-#line 592 "dhcp6_parser.yy"
+#line 600 "dhcp6_parser.yy"
                                                        {
     ElementPtr ctt(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("calculate-tee-times", ctt);
@@ -1193,7 +1193,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 142:
-#line 597 "dhcp6_parser.yy"
+#line 605 "dhcp6_parser.yy"
                                    {
     ElementPtr t1(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("t1-percent", t1);
@@ -1202,7 +1202,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 143:
-#line 602 "dhcp6_parser.yy"
+#line 610 "dhcp6_parser.yy"
                                    {
     ElementPtr t2(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("t2-percent", t2);
@@ -1211,7 +1211,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 144:
-#line 607 "dhcp6_parser.yy"
+#line 615 "dhcp6_parser.yy"
                                                                  {
     ElementPtr dpp(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
@@ -1220,7 +1220,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 145:
-#line 612 "dhcp6_parser.yy"
+#line 620 "dhcp6_parser.yy"
                                                    {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-send-updates", b);
@@ -1229,7 +1229,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 146:
-#line 617 "dhcp6_parser.yy"
+#line 625 "dhcp6_parser.yy"
                                                                {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-override-no-update", b);
@@ -1238,7 +1238,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 147:
-#line 622 "dhcp6_parser.yy"
+#line 630 "dhcp6_parser.yy"
                                                                        {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-override-client-update", b);
@@ -1247,7 +1247,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 148:
-#line 627 "dhcp6_parser.yy"
+#line 635 "dhcp6_parser.yy"
                                                    {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
@@ -1255,7 +1255,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 149:
-#line 629 "dhcp6_parser.yy"
+#line 637 "dhcp6_parser.yy"
                                        {
     ctx.stack_.back()->set("ddns-replace-client-name", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
@@ -1264,7 +1264,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 150:
-#line 635 "dhcp6_parser.yy"
+#line 643 "dhcp6_parser.yy"
                  {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location)));
       }
@@ -1272,7 +1272,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 151:
-#line 638 "dhcp6_parser.yy"
+#line 646 "dhcp6_parser.yy"
           {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
@@ -1280,7 +1280,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 152:
-#line 641 "dhcp6_parser.yy"
+#line 649 "dhcp6_parser.yy"
            {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
@@ -1288,7 +1288,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 153:
-#line 644 "dhcp6_parser.yy"
+#line 652 "dhcp6_parser.yy"
                      {
       yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
@@ -1296,7 +1296,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 154:
-#line 647 "dhcp6_parser.yy"
+#line 655 "dhcp6_parser.yy"
             {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
@@ -1305,7 +1305,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 155:
-#line 653 "dhcp6_parser.yy"
+#line 661 "dhcp6_parser.yy"
                                              {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1313,7 +1313,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 156:
-#line 655 "dhcp6_parser.yy"
+#line 663 "dhcp6_parser.yy"
                {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-generated-prefix", s);
@@ -1323,7 +1323,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 157:
-#line 661 "dhcp6_parser.yy"
+#line 669 "dhcp6_parser.yy"
                                                {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1331,7 +1331,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 158:
-#line 663 "dhcp6_parser.yy"
+#line 671 "dhcp6_parser.yy"
                {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-qualifying-suffix", s);
@@ -1341,7 +1341,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 159:
-#line 669 "dhcp6_parser.yy"
+#line 677 "dhcp6_parser.yy"
                                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1349,7 +1349,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 160:
-#line 671 "dhcp6_parser.yy"
+#line 679 "dhcp6_parser.yy"
                {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-set", s);
@@ -1359,7 +1359,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 161:
-#line 677 "dhcp6_parser.yy"
+#line 685 "dhcp6_parser.yy"
                                                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1367,7 +1367,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 162:
-#line 679 "dhcp6_parser.yy"
+#line 687 "dhcp6_parser.yy"
                {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-replacement", s);
@@ -1377,7 +1377,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 163:
-#line 685 "dhcp6_parser.yy"
+#line 693 "dhcp6_parser.yy"
                                                        {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("store-extended-info", b);
@@ -1386,7 +1386,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 164:
-#line 690 "dhcp6_parser.yy"
+#line 698 "dhcp6_parser.yy"
                                                                              {
     ElementPtr count(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("statistic-default-sample-count", count);
@@ -1395,7 +1395,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 165:
-#line 695 "dhcp6_parser.yy"
+#line 703 "dhcp6_parser.yy"
                                                                          {
     ElementPtr age(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("statistic-default-sample-age", age);
@@ -1404,7 +1404,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 166:
-#line 700 "dhcp6_parser.yy"
+#line 708 "dhcp6_parser.yy"
                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1412,7 +1412,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 167:
-#line 702 "dhcp6_parser.yy"
+#line 710 "dhcp6_parser.yy"
                {
     ElementPtr stag(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-tag", stag);
@@ -1422,7 +1422,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 168:
-#line 708 "dhcp6_parser.yy"
+#line 716 "dhcp6_parser.yy"
                                      {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
@@ -1433,7 +1433,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 169:
-#line 713 "dhcp6_parser.yy"
+#line 721 "dhcp6_parser.yy"
                                                                {
     // No interfaces config param is required
     ctx.stack_.pop_back();
@@ -1443,7 +1443,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 170:
-#line 719 "dhcp6_parser.yy"
+#line 727 "dhcp6_parser.yy"
                                 {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -1453,7 +1453,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 171:
-#line 723 "dhcp6_parser.yy"
+#line 731 "dhcp6_parser.yy"
                                           {
     // No interfaces config param is required
     // parsing completed
@@ -1462,7 +1462,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 179:
-#line 739 "dhcp6_parser.yy"
+#line 747 "dhcp6_parser.yy"
                             {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
@@ -1473,7 +1473,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 180:
-#line 744 "dhcp6_parser.yy"
+#line 752 "dhcp6_parser.yy"
                      {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1482,7 +1482,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 181:
-#line 749 "dhcp6_parser.yy"
+#line 757 "dhcp6_parser.yy"
                                    {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("re-detect", b);
@@ -1491,7 +1491,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 182:
-#line 754 "dhcp6_parser.yy"
+#line 762 "dhcp6_parser.yy"
                                {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
@@ -1502,7 +1502,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 183:
-#line 759 "dhcp6_parser.yy"
+#line 767 "dhcp6_parser.yy"
                                                           {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
@@ -1513,7 +1513,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 184:
-#line 766 "dhcp6_parser.yy"
+#line 774 "dhcp6_parser.yy"
                                {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
@@ -1524,7 +1524,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 185:
-#line 771 "dhcp6_parser.yy"
+#line 779 "dhcp6_parser.yy"
                                                           {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
@@ -1535,7 +1535,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 186:
-#line 778 "dhcp6_parser.yy"
+#line 786 "dhcp6_parser.yy"
                                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-databases", l);
@@ -1546,7 +1546,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 187:
-#line 783 "dhcp6_parser.yy"
+#line 791 "dhcp6_parser.yy"
                                                       {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1555,7 +1555,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 192:
-#line 796 "dhcp6_parser.yy"
+#line 804 "dhcp6_parser.yy"
                          {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
@@ -1565,7 +1565,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 193:
-#line 800 "dhcp6_parser.yy"
+#line 808 "dhcp6_parser.yy"
                                      {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -1574,16 +1574,16 @@ namespace isc { namespace dhcp {
 #line 1575 "dhcp6_parser.cc"
     break;
 
-  case 220:
-#line 836 "dhcp6_parser.yy"
+  case 228:
+#line 852 "dhcp6_parser.yy"
                     {
     ctx.enter(ctx.DATABASE_TYPE);
 }
 #line 1583 "dhcp6_parser.cc"
     break;
 
-  case 221:
-#line 838 "dhcp6_parser.yy"
+  case 229:
+#line 854 "dhcp6_parser.yy"
                 {
     ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
@@ -1591,40 +1591,40 @@ namespace isc { namespace dhcp {
 #line 1592 "dhcp6_parser.cc"
     break;
 
-  case 222:
-#line 843 "dhcp6_parser.yy"
+  case 230:
+#line 859 "dhcp6_parser.yy"
                  { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
 #line 1598 "dhcp6_parser.cc"
     break;
 
-  case 223:
-#line 844 "dhcp6_parser.yy"
+  case 231:
+#line 860 "dhcp6_parser.yy"
                { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
 #line 1604 "dhcp6_parser.cc"
     break;
 
-  case 224:
-#line 845 "dhcp6_parser.yy"
+  case 232:
+#line 861 "dhcp6_parser.yy"
                     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
 #line 1610 "dhcp6_parser.cc"
     break;
 
-  case 225:
-#line 846 "dhcp6_parser.yy"
+  case 233:
+#line 862 "dhcp6_parser.yy"
              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
 #line 1616 "dhcp6_parser.cc"
     break;
 
-  case 226:
-#line 849 "dhcp6_parser.yy"
+  case 234:
+#line 865 "dhcp6_parser.yy"
            {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1624 "dhcp6_parser.cc"
     break;
 
-  case 227:
-#line 851 "dhcp6_parser.yy"
+  case 235:
+#line 867 "dhcp6_parser.yy"
                {
     ElementPtr user(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
@@ -1633,16 +1633,16 @@ namespace isc { namespace dhcp {
 #line 1634 "dhcp6_parser.cc"
     break;
 
-  case 228:
-#line 857 "dhcp6_parser.yy"
+  case 236:
+#line 873 "dhcp6_parser.yy"
                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1642 "dhcp6_parser.cc"
     break;
 
-  case 229:
-#line 859 "dhcp6_parser.yy"
+  case 237:
+#line 875 "dhcp6_parser.yy"
                {
     ElementPtr pwd(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
@@ -1651,16 +1651,16 @@ namespace isc { namespace dhcp {
 #line 1652 "dhcp6_parser.cc"
     break;
 
-  case 230:
-#line 865 "dhcp6_parser.yy"
+  case 238:
+#line 881 "dhcp6_parser.yy"
            {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1660 "dhcp6_parser.cc"
     break;
 
-  case 231:
-#line 867 "dhcp6_parser.yy"
+  case 239:
+#line 883 "dhcp6_parser.yy"
                {
     ElementPtr h(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
@@ -1669,8 +1669,8 @@ namespace isc { namespace dhcp {
 #line 1670 "dhcp6_parser.cc"
     break;
 
-  case 232:
-#line 873 "dhcp6_parser.yy"
+  case 240:
+#line 889 "dhcp6_parser.yy"
                          {
     ElementPtr p(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", p);
@@ -1678,16 +1678,16 @@ namespace isc { namespace dhcp {
 #line 1679 "dhcp6_parser.cc"
     break;
 
-  case 233:
-#line 878 "dhcp6_parser.yy"
+  case 241:
+#line 894 "dhcp6_parser.yy"
            {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1687 "dhcp6_parser.cc"
     break;
 
-  case 234:
-#line 880 "dhcp6_parser.yy"
+  case 242:
+#line 896 "dhcp6_parser.yy"
                {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
@@ -1696,8 +1696,8 @@ namespace isc { namespace dhcp {
 #line 1697 "dhcp6_parser.cc"
     break;
 
-  case 235:
-#line 886 "dhcp6_parser.yy"
+  case 243:
+#line 902 "dhcp6_parser.yy"
                                {
     ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
@@ -1705,8 +1705,8 @@ namespace isc { namespace dhcp {
 #line 1706 "dhcp6_parser.cc"
     break;
 
-  case 236:
-#line 891 "dhcp6_parser.yy"
+  case 244:
+#line 907 "dhcp6_parser.yy"
                                          {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
@@ -1714,8 +1714,8 @@ namespace isc { namespace dhcp {
 #line 1715 "dhcp6_parser.cc"
     break;
 
-  case 237:
-#line 896 "dhcp6_parser.yy"
+  case 245:
+#line 912 "dhcp6_parser.yy"
                                  {
     ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
@@ -1723,8 +1723,8 @@ namespace isc { namespace dhcp {
 #line 1724 "dhcp6_parser.cc"
     break;
 
-  case 238:
-#line 901 "dhcp6_parser.yy"
+  case 246:
+#line 917 "dhcp6_parser.yy"
                                                {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
@@ -1732,8 +1732,8 @@ namespace isc { namespace dhcp {
 #line 1733 "dhcp6_parser.cc"
     break;
 
-  case 239:
-#line 906 "dhcp6_parser.yy"
+  case 247:
+#line 922 "dhcp6_parser.yy"
                                                        {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reconnect-wait-time", n);
@@ -1741,8 +1741,8 @@ namespace isc { namespace dhcp {
 #line 1742 "dhcp6_parser.cc"
     break;
 
-  case 240:
-#line 911 "dhcp6_parser.yy"
+  case 248:
+#line 927 "dhcp6_parser.yy"
                                              {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-row-errors", n);
@@ -1750,8 +1750,8 @@ namespace isc { namespace dhcp {
 #line 1751 "dhcp6_parser.cc"
     break;
 
-  case 241:
-#line 916 "dhcp6_parser.yy"
+  case 249:
+#line 932 "dhcp6_parser.yy"
                                                {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("request-timeout", n);
@@ -1759,8 +1759,8 @@ namespace isc { namespace dhcp {
 #line 1760 "dhcp6_parser.cc"
     break;
 
-  case 242:
-#line 921 "dhcp6_parser.yy"
+  case 250:
+#line 937 "dhcp6_parser.yy"
                                            {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-keepalive", n);
@@ -1768,8 +1768,8 @@ namespace isc { namespace dhcp {
 #line 1769 "dhcp6_parser.cc"
     break;
 
-  case 243:
-#line 926 "dhcp6_parser.yy"
+  case 251:
+#line 942 "dhcp6_parser.yy"
                                        {
     ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-nodelay", n);
@@ -1777,16 +1777,16 @@ namespace isc { namespace dhcp {
 #line 1778 "dhcp6_parser.cc"
     break;
 
-  case 244:
-#line 931 "dhcp6_parser.yy"
+  case 252:
+#line 947 "dhcp6_parser.yy"
                                {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1786 "dhcp6_parser.cc"
     break;
 
-  case 245:
-#line 933 "dhcp6_parser.yy"
+  case 253:
+#line 949 "dhcp6_parser.yy"
                {
     ElementPtr cp(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("contact-points", cp);
@@ -1795,8 +1795,8 @@ namespace isc { namespace dhcp {
 #line 1796 "dhcp6_parser.cc"
     break;
 
-  case 246:
-#line 939 "dhcp6_parser.yy"
+  case 254:
+#line 955 "dhcp6_parser.yy"
                                                        {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reconnect-tries", n);
@@ -1804,16 +1804,16 @@ namespace isc { namespace dhcp {
 #line 1805 "dhcp6_parser.cc"
     break;
 
-  case 247:
-#line 944 "dhcp6_parser.yy"
+  case 255:
+#line 960 "dhcp6_parser.yy"
                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1813 "dhcp6_parser.cc"
     break;
 
-  case 248:
-#line 946 "dhcp6_parser.yy"
+  case 256:
+#line 962 "dhcp6_parser.yy"
                {
     ElementPtr ks(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("keyspace", ks);
@@ -1822,16 +1822,16 @@ namespace isc { namespace dhcp {
 #line 1823 "dhcp6_parser.cc"
     break;
 
-  case 249:
-#line 952 "dhcp6_parser.yy"
+  case 257:
+#line 968 "dhcp6_parser.yy"
                          {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1831 "dhcp6_parser.cc"
     break;
 
-  case 250:
-#line 954 "dhcp6_parser.yy"
+  case 258:
+#line 970 "dhcp6_parser.yy"
                {
     ElementPtr c(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("consistency", c);
@@ -1840,16 +1840,16 @@ namespace isc { namespace dhcp {
 #line 1841 "dhcp6_parser.cc"
     break;
 
-  case 251:
-#line 960 "dhcp6_parser.yy"
+  case 259:
+#line 976 "dhcp6_parser.yy"
                                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1849 "dhcp6_parser.cc"
     break;
 
-  case 252:
-#line 962 "dhcp6_parser.yy"
+  case 260:
+#line 978 "dhcp6_parser.yy"
                {
     ElementPtr c(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("serial-consistency", c);
@@ -1858,8 +1858,8 @@ namespace isc { namespace dhcp {
 #line 1859 "dhcp6_parser.cc"
     break;
 
-  case 253:
-#line 968 "dhcp6_parser.yy"
+  case 261:
+#line 984 "dhcp6_parser.yy"
                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sanity-checks", m);
@@ -1869,8 +1869,8 @@ namespace isc { namespace dhcp {
 #line 1870 "dhcp6_parser.cc"
     break;
 
-  case 254:
-#line 973 "dhcp6_parser.yy"
+  case 262:
+#line 989 "dhcp6_parser.yy"
                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1878,16 +1878,97 @@ namespace isc { namespace dhcp {
 #line 1879 "dhcp6_parser.cc"
     break;
 
-  case 258:
-#line 983 "dhcp6_parser.yy"
+  case 263:
+#line 994 "dhcp6_parser.yy"
+                                         {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("group-commit", n);
+}
+#line 1888 "dhcp6_parser.cc"
+    break;
+
+  case 264:
+#line 999 "dhcp6_parser.yy"
                            {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1887 "dhcp6_parser.cc"
+#line 1896 "dhcp6_parser.cc"
     break;
 
-  case 259:
-#line 985 "dhcp6_parser.yy"
+  case 265:
+#line 1001 "dhcp6_parser.yy"
+               {
+    ElementPtr n(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("fsync-policy", n);
+    ctx.leave();
+}
+#line 1906 "dhcp6_parser.cc"
+    break;
+
+  case 266:
+#line 1007 "dhcp6_parser.yy"
+                                             {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("fsync-interval", n);
+}
+#line 1915 "dhcp6_parser.cc"
+    break;
+
+  case 267:
+#line 1012 "dhcp6_parser.yy"
+                                                       {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("wait-for-durability", n);
+}
+#line 1924 "dhcp6_parser.cc"
+    break;
+
+  case 268:
+#line 1017 "dhcp6_parser.yy"
+                                       {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-threads", n);
+}
+#line 1933 "dhcp6_parser.cc"
+    break;
+
+  case 269:
+#line 1022 "dhcp6_parser.yy"
+                                         {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-snapshot", n);
+}
+#line 1942 "dhcp6_parser.cc"
+    break;
+
+  case 270:
+#line 1027 "dhcp6_parser.yy"
+                                                         {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lease-stats-counters", n);
+}
+#line 1951 "dhcp6_parser.cc"
+    break;
+
+  case 271:
+#line 1032 "dhcp6_parser.yy"
+                                                                 {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lease-expiration-buckets", n);
+}
+#line 1960 "dhcp6_parser.cc"
+    break;
+
+  case 275:
+#line 1042 "dhcp6_parser.yy"
+                           {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1968 "dhcp6_parser.cc"
+    break;
+
+  case 276:
+#line 1044 "dhcp6_parser.yy"
                {
 
     if ( (string(yystack_[0].value.as < std::string > ()) == "none") ||
@@ -1903,376 +1984,376 @@ namespace isc { namespace dhcp {
               ", supported values are: none, warn, fix, fix-del, del");
     }
 }
-#line 1907 "dhcp6_parser.cc"
+#line 1988 "dhcp6_parser.cc"
     break;
 
-  case 260:
-#line 1001 "dhcp6_parser.yy"
+  case 277:
+#line 1060 "dhcp6_parser.yy"
                          {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("mac-sources", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.MAC_SOURCES);
 }
-#line 1918 "dhcp6_parser.cc"
+#line 1999 "dhcp6_parser.cc"
     break;
 
-  case 261:
-#line 1006 "dhcp6_parser.yy"
+  case 278:
+#line 1065 "dhcp6_parser.yy"
                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1927 "dhcp6_parser.cc"
+#line 2008 "dhcp6_parser.cc"
     break;
 
-  case 266:
-#line 1019 "dhcp6_parser.yy"
+  case 283:
+#line 1078 "dhcp6_parser.yy"
                {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1936 "dhcp6_parser.cc"
+#line 2017 "dhcp6_parser.cc"
     break;
 
-  case 267:
-#line 1024 "dhcp6_parser.yy"
+  case 284:
+#line 1083 "dhcp6_parser.yy"
                    {
     ElementPtr duid(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1945 "dhcp6_parser.cc"
+#line 2026 "dhcp6_parser.cc"
     break;
 
-  case 268:
-#line 1029 "dhcp6_parser.yy"
+  case 285:
+#line 1088 "dhcp6_parser.yy"
                                                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOST_RESERVATION_IDENTIFIERS);
 }
-#line 1956 "dhcp6_parser.cc"
+#line 2037 "dhcp6_parser.cc"
     break;
 
-  case 269:
-#line 1034 "dhcp6_parser.yy"
+  case 286:
+#line 1093 "dhcp6_parser.yy"
                                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1965 "dhcp6_parser.cc"
+#line 2046 "dhcp6_parser.cc"
     break;
 
-  case 275:
-#line 1048 "dhcp6_parser.yy"
+  case 292:
+#line 1107 "dhcp6_parser.yy"
                            {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
 }
-#line 1974 "dhcp6_parser.cc"
+#line 2055 "dhcp6_parser.cc"
     break;
 
-  case 276:
-#line 1053 "dhcp6_parser.yy"
+  case 293:
+#line 1112 "dhcp6_parser.yy"
                   {
     ElementPtr flex_id(new StringElement("flex-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(flex_id);
 }
-#line 1983 "dhcp6_parser.cc"
+#line 2064 "dhcp6_parser.cc"
     break;
 
-  case 277:
-#line 1060 "dhcp6_parser.yy"
+  case 294:
+#line 1119 "dhcp6_parser.yy"
                                                {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay-supplied-options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1994 "dhcp6_parser.cc"
+#line 2075 "dhcp6_parser.cc"
     break;
 
-  case 278:
-#line 1065 "dhcp6_parser.yy"
+  case 295:
+#line 1124 "dhcp6_parser.yy"
                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2003 "dhcp6_parser.cc"
+#line 2084 "dhcp6_parser.cc"
     break;
 
-  case 279:
-#line 1072 "dhcp6_parser.yy"
+  case 296:
+#line 1131 "dhcp6_parser.yy"
                                            {
     ElementPtr mt(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("multi-threading", mt);
     ctx.stack_.push_back(mt);
     ctx.enter(ctx.DHCP_MULTI_THREADING);
 }
-#line 2014 "dhcp6_parser.cc"
+#line 2095 "dhcp6_parser.cc"
     break;
 
-  case 280:
-#line 1077 "dhcp6_parser.yy"
+  case 297:
+#line 1136 "dhcp6_parser.yy"
                                                              {
     // The enable parameter is required.
     ctx.require("enable-multi-threading", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2025 "dhcp6_parser.cc"
+#line 2106 "dhcp6_parser.cc"
     break;
 
-  case 289:
-#line 1096 "dhcp6_parser.yy"
+  case 306:
+#line 1155 "dhcp6_parser.yy"
                                                              {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-multi-threading", b);
 }
-#line 2034 "dhcp6_parser.cc"
+#line 2115 "dhcp6_parser.cc"
     break;
 
-  case 290:
-#line 1101 "dhcp6_parser.yy"
+  case 307:
+#line 1160 "dhcp6_parser.yy"
                                                  {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("thread-pool-size", prf);
 }
-#line 2043 "dhcp6_parser.cc"
+#line 2124 "dhcp6_parser.cc"
     break;
 
-  case 291:
-#line 1106 "dhcp6_parser.yy"
+  case 308:
+#line 1165 "dhcp6_parser.yy"
                                                    {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("packet-queue-size", prf);
 }
-#line 2052 "dhcp6_parser.cc"
+#line 2133 "dhcp6_parser.cc"
     break;
 
-  case 292:
-#line 1111 "dhcp6_parser.yy"
+  case 309:
+#line 1170 "dhcp6_parser.yy"
                                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 2063 "dhcp6_parser.cc"
+#line 2144 "dhcp6_parser.cc"
     break;
 
-  case 293:
-#line 1116 "dhcp6_parser.yy"
+  case 310:
+#line 1175 "dhcp6_parser.yy"
                                                              {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2072 "dhcp6_parser.cc"
+#line 2153 "dhcp6_parser.cc"
     break;
 
-  case 298:
-#line 1129 "dhcp6_parser.yy"
+  case 315:
+#line 1188 "dhcp6_parser.yy"
                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2082 "dhcp6_parser.cc"
+#line 2163 "dhcp6_parser.cc"
     break;
 
-  case 299:
-#line 1133 "dhcp6_parser.yy"
+  case 316:
+#line 1192 "dhcp6_parser.yy"
                               {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("library-path", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2093 "dhcp6_parser.cc"
+#line 2174 "dhcp6_parser.cc"
     break;
 
-  case 300:
-#line 1140 "dhcp6_parser.yy"
+  case 317:
+#line 1199 "dhcp6_parser.yy"
                                   {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2103 "dhcp6_parser.cc"
+#line 2184 "dhcp6_parser.cc"
     break;
 
-  case 301:
-#line 1144 "dhcp6_parser.yy"
+  case 318:
+#line 1203 "dhcp6_parser.yy"
                               {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("library-path", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2114 "dhcp6_parser.cc"
+#line 2195 "dhcp6_parser.cc"
     break;
 
-  case 310:
-#line 1163 "dhcp6_parser.yy"
+  case 327:
+#line 1222 "dhcp6_parser.yy"
                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2122 "dhcp6_parser.cc"
+#line 2203 "dhcp6_parser.cc"
     break;
 
-  case 311:
-#line 1165 "dhcp6_parser.yy"
+  case 328:
+#line 1224 "dhcp6_parser.yy"
                {
     ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 2132 "dhcp6_parser.cc"
+#line 2213 "dhcp6_parser.cc"
     break;
 
-  case 312:
-#line 1171 "dhcp6_parser.yy"
+  case 329:
+#line 1230 "dhcp6_parser.yy"
                            {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2140 "dhcp6_parser.cc"
+#line 2221 "dhcp6_parser.cc"
     break;
 
-  case 313:
-#line 1173 "dhcp6_parser.yy"
+  case 330:
+#line 1232 "dhcp6_parser.yy"
                {
     ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library-path", lib);
     ctx.leave();
 }
-#line 2150 "dhcp6_parser.cc"
+#line 2231 "dhcp6_parser.cc"
     break;
 
-  case 314:
-#line 1179 "dhcp6_parser.yy"
+  case 331:
+#line 1238 "dhcp6_parser.yy"
                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2158 "dhcp6_parser.cc"
+#line 2239 "dhcp6_parser.cc"
     break;
 
-  case 315:
-#line 1181 "dhcp6_parser.yy"
+  case 332:
+#line 1240 "dhcp6_parser.yy"
                   {
     ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2167 "dhcp6_parser.cc"
+#line 2248 "dhcp6_parser.cc"
     break;
 
-  case 316:
-#line 1187 "dhcp6_parser.yy"
+  case 333:
+#line 1246 "dhcp6_parser.yy"
                                                      {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.EXPIRED_LEASES_PROCESSING);
 }
-#line 2178 "dhcp6_parser.cc"
+#line 2259 "dhcp6_parser.cc"
     break;
 
-  case 317:
-#line 1192 "dhcp6_parser.yy"
+  case 334:
+#line 1251 "dhcp6_parser.yy"
                                                             {
     // No expired lease parameter is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2188 "dhcp6_parser.cc"
+#line 2269 "dhcp6_parser.cc"
     break;
 
-  case 326:
-#line 1210 "dhcp6_parser.yy"
+  case 343:
+#line 1269 "dhcp6_parser.yy"
                                                                {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
 }
-#line 2197 "dhcp6_parser.cc"
+#line 2278 "dhcp6_parser.cc"
     break;
 
-  case 327:
-#line 1215 "dhcp6_parser.yy"
+  case 344:
+#line 1274 "dhcp6_parser.yy"
                                                                                {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
 }
-#line 2206 "dhcp6_parser.cc"
+#line 2287 "dhcp6_parser.cc"
     break;
 
-  case 328:
-#line 1220 "dhcp6_parser.yy"
+  case 345:
+#line 1279 "dhcp6_parser.yy"
                                                        {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 }
-#line 2215 "dhcp6_parser.cc"
+#line 2296 "dhcp6_parser.cc"
     break;
 
-  case 329:
-#line 1225 "dhcp6_parser.yy"
+  case 346:
+#line 1284 "dhcp6_parser.yy"
                                                      {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
 }
-#line 2224 "dhcp6_parser.cc"
+#line 2305 "dhcp6_parser.cc"
     break;
 
-  case 330:
-#line 1230 "dhcp6_parser.yy"
+  case 347:
+#line 1289 "dhcp6_parser.yy"
                                                  {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
 }
-#line 2233 "dhcp6_parser.cc"
+#line 2314 "dhcp6_parser.cc"
     break;
 
-  case 331:
-#line 1235 "dhcp6_parser.yy"
+  case 348:
+#line 1294 "dhcp6_parser.yy"
                                                                {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 }
-#line 2242 "dhcp6_parser.cc"
+#line 2323 "dhcp6_parser.cc"
     break;
 
-  case 332:
-#line 1243 "dhcp6_parser.yy"
+  case 349:
+#line 1302 "dhcp6_parser.yy"
                       {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet6", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SUBNET6);
 }
-#line 2253 "dhcp6_parser.cc"
+#line 2334 "dhcp6_parser.cc"
     break;
 
-  case 333:
-#line 1248 "dhcp6_parser.yy"
+  case 350:
+#line 1307 "dhcp6_parser.yy"
                                                              {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2262 "dhcp6_parser.cc"
+#line 2343 "dhcp6_parser.cc"
     break;
 
-  case 338:
-#line 1268 "dhcp6_parser.yy"
+  case 355:
+#line 1327 "dhcp6_parser.yy"
                         {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2272 "dhcp6_parser.cc"
+#line 2353 "dhcp6_parser.cc"
     break;
 
-  case 339:
-#line 1272 "dhcp6_parser.yy"
+  case 356:
+#line 1331 "dhcp6_parser.yy"
                                 {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
@@ -2294,267 +2375,267 @@ namespace isc { namespace dhcp {
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2298 "dhcp6_parser.cc"
+#line 2379 "dhcp6_parser.cc"
     break;
 
-  case 340:
-#line 1294 "dhcp6_parser.yy"
+  case 357:
+#line 1353 "dhcp6_parser.yy"
                             {
     // Parse the subnet6 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2308 "dhcp6_parser.cc"
+#line 2389 "dhcp6_parser.cc"
     break;
 
-  case 341:
-#line 1298 "dhcp6_parser.yy"
+  case 358:
+#line 1357 "dhcp6_parser.yy"
                                 {
     // The subnet subnet6 parameter is required
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2318 "dhcp6_parser.cc"
+#line 2399 "dhcp6_parser.cc"
     break;
 
-  case 381:
-#line 1349 "dhcp6_parser.yy"
+  case 398:
+#line 1408 "dhcp6_parser.yy"
                {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2326 "dhcp6_parser.cc"
+#line 2407 "dhcp6_parser.cc"
     break;
 
-  case 382:
-#line 1351 "dhcp6_parser.yy"
+  case 399:
+#line 1410 "dhcp6_parser.yy"
                {
     ElementPtr subnet(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
     ctx.leave();
 }
-#line 2336 "dhcp6_parser.cc"
+#line 2417 "dhcp6_parser.cc"
     break;
 
-  case 383:
-#line 1357 "dhcp6_parser.yy"
+  case 400:
+#line 1416 "dhcp6_parser.yy"
                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2344 "dhcp6_parser.cc"
+#line 2425 "dhcp6_parser.cc"
     break;
 
-  case 384:
-#line 1359 "dhcp6_parser.yy"
+  case 401:
+#line 1418 "dhcp6_parser.yy"
                {
     ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
     ctx.leave();
 }
-#line 2354 "dhcp6_parser.cc"
+#line 2435 "dhcp6_parser.cc"
     break;
 
-  case 385:
-#line 1365 "dhcp6_parser.yy"
+  case 402:
+#line 1424 "dhcp6_parser.yy"
                            {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2362 "dhcp6_parser.cc"
+#line 2443 "dhcp6_parser.cc"
     break;
 
-  case 386:
-#line 1367 "dhcp6_parser.yy"
+  case 403:
+#line 1426 "dhcp6_parser.yy"
                {
     ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface-id", iface);
     ctx.leave();
 }
-#line 2372 "dhcp6_parser.cc"
+#line 2453 "dhcp6_parser.cc"
     break;
 
-  case 387:
-#line 1373 "dhcp6_parser.yy"
+  case 404:
+#line 1432 "dhcp6_parser.yy"
                            {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2380 "dhcp6_parser.cc"
+#line 2461 "dhcp6_parser.cc"
     break;
 
-  case 388:
-#line 1375 "dhcp6_parser.yy"
+  case 405:
+#line 1434 "dhcp6_parser.yy"
                {
     ElementPtr cls(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
     ctx.leave();
 }
-#line 2390 "dhcp6_parser.cc"
+#line 2471 "dhcp6_parser.cc"
     break;
 
-  case 389:
-#line 1381 "dhcp6_parser.yy"
+  case 406:
+#line 1440 "dhcp6_parser.yy"
                                                {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("require-client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2401 "dhcp6_parser.cc"
+#line 2482 "dhcp6_parser.cc"
     break;
 
-  case 390:
-#line 1386 "dhcp6_parser.yy"
+  case 407:
+#line 1445 "dhcp6_parser.yy"
                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2410 "dhcp6_parser.cc"
+#line 2491 "dhcp6_parser.cc"
     break;
 
-  case 391:
-#line 1391 "dhcp6_parser.yy"
+  case 408:
+#line 1450 "dhcp6_parser.yy"
                                    {
     ctx.enter(ctx.RESERVATION_MODE);
 }
-#line 2418 "dhcp6_parser.cc"
+#line 2499 "dhcp6_parser.cc"
     break;
 
-  case 392:
-#line 1393 "dhcp6_parser.yy"
+  case 409:
+#line 1452 "dhcp6_parser.yy"
                 {
     ctx.stack_.back()->set("reservation-mode", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2427 "dhcp6_parser.cc"
+#line 2508 "dhcp6_parser.cc"
     break;
 
-  case 393:
-#line 1398 "dhcp6_parser.yy"
+  case 410:
+#line 1457 "dhcp6_parser.yy"
                   { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
-#line 2433 "dhcp6_parser.cc"
+#line 2514 "dhcp6_parser.cc"
     break;
 
-  case 394:
-#line 1399 "dhcp6_parser.yy"
+  case 411:
+#line 1458 "dhcp6_parser.yy"
                      { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
-#line 2439 "dhcp6_parser.cc"
+#line 2520 "dhcp6_parser.cc"
     break;
 
-  case 395:
-#line 1400 "dhcp6_parser.yy"
+  case 412:
+#line 1459 "dhcp6_parser.yy"
                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("global", ctx.loc2pos(yystack_[0].location))); }
-#line 2445 "dhcp6_parser.cc"
+#line 2526 "dhcp6_parser.cc"
     break;
 
-  case 396:
-#line 1401 "dhcp6_parser.yy"
+  case 413:
+#line 1460 "dhcp6_parser.yy"
              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
-#line 2451 "dhcp6_parser.cc"
+#line 2532 "dhcp6_parser.cc"
     break;
 
-  case 397:
-#line 1404 "dhcp6_parser.yy"
+  case 414:
+#line 1463 "dhcp6_parser.yy"
                      {
     ElementPtr id(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
 }
-#line 2460 "dhcp6_parser.cc"
+#line 2541 "dhcp6_parser.cc"
     break;
 
-  case 398:
-#line 1409 "dhcp6_parser.yy"
+  case 415:
+#line 1468 "dhcp6_parser.yy"
                                          {
     ElementPtr rc(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rapid-commit", rc);
 }
-#line 2469 "dhcp6_parser.cc"
+#line 2550 "dhcp6_parser.cc"
     break;
 
-  case 399:
-#line 1416 "dhcp6_parser.yy"
+  case 416:
+#line 1475 "dhcp6_parser.yy"
                                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("shared-networks", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SHARED_NETWORK);
 }
-#line 2480 "dhcp6_parser.cc"
+#line 2561 "dhcp6_parser.cc"
     break;
 
-  case 400:
-#line 1421 "dhcp6_parser.yy"
+  case 417:
+#line 1480 "dhcp6_parser.yy"
                                                                 {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2489 "dhcp6_parser.cc"
+#line 2570 "dhcp6_parser.cc"
     break;
 
-  case 405:
-#line 1436 "dhcp6_parser.yy"
+  case 422:
+#line 1495 "dhcp6_parser.yy"
                                {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2499 "dhcp6_parser.cc"
+#line 2580 "dhcp6_parser.cc"
     break;
 
-  case 406:
-#line 1440 "dhcp6_parser.yy"
+  case 423:
+#line 1499 "dhcp6_parser.yy"
                                        {
     ctx.stack_.pop_back();
 }
-#line 2507 "dhcp6_parser.cc"
+#line 2588 "dhcp6_parser.cc"
     break;
 
-  case 442:
-#line 1487 "dhcp6_parser.yy"
+  case 459:
+#line 1546 "dhcp6_parser.yy"
                             {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DEF);
 }
-#line 2518 "dhcp6_parser.cc"
+#line 2599 "dhcp6_parser.cc"
     break;
 
-  case 443:
-#line 1492 "dhcp6_parser.yy"
+  case 460:
+#line 1551 "dhcp6_parser.yy"
                                                                 {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2527 "dhcp6_parser.cc"
+#line 2608 "dhcp6_parser.cc"
     break;
 
-  case 444:
-#line 1500 "dhcp6_parser.yy"
+  case 461:
+#line 1559 "dhcp6_parser.yy"
                                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2536 "dhcp6_parser.cc"
+#line 2617 "dhcp6_parser.cc"
     break;
 
-  case 445:
-#line 1503 "dhcp6_parser.yy"
+  case 462:
+#line 1562 "dhcp6_parser.yy"
                                  {
     // parsing completed
 }
-#line 2544 "dhcp6_parser.cc"
+#line 2625 "dhcp6_parser.cc"
     break;
 
-  case 450:
-#line 1519 "dhcp6_parser.yy"
+  case 467:
+#line 1578 "dhcp6_parser.yy"
                                  {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2554 "dhcp6_parser.cc"
+#line 2635 "dhcp6_parser.cc"
     break;
 
-  case 451:
-#line 1523 "dhcp6_parser.yy"
+  case 468:
+#line 1582 "dhcp6_parser.yy"
                                    {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2562,21 +2643,21 @@ namespace isc { namespace dhcp {
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2566 "dhcp6_parser.cc"
+#line 2647 "dhcp6_parser.cc"
     break;
 
-  case 452:
-#line 1534 "dhcp6_parser.yy"
+  case 469:
+#line 1593 "dhcp6_parser.yy"
                                {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2576 "dhcp6_parser.cc"
+#line 2657 "dhcp6_parser.cc"
     break;
 
-  case 453:
-#line 1538 "dhcp6_parser.yy"
+  case 470:
+#line 1597 "dhcp6_parser.yy"
                                    {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2584,281 +2665,281 @@ namespace isc { namespace dhcp {
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2588 "dhcp6_parser.cc"
+#line 2669 "dhcp6_parser.cc"
     break;
 
-  case 469:
-#line 1570 "dhcp6_parser.yy"
+  case 486:
+#line 1629 "dhcp6_parser.yy"
                          {
     ElementPtr code(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
 }
-#line 2597 "dhcp6_parser.cc"
+#line 2678 "dhcp6_parser.cc"
     break;
 
-  case 471:
-#line 1577 "dhcp6_parser.yy"
+  case 488:
+#line 1636 "dhcp6_parser.yy"
                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2605 "dhcp6_parser.cc"
+#line 2686 "dhcp6_parser.cc"
     break;
 
-  case 472:
-#line 1579 "dhcp6_parser.yy"
+  case 489:
+#line 1638 "dhcp6_parser.yy"
                {
     ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
     ctx.leave();
 }
-#line 2615 "dhcp6_parser.cc"
+#line 2696 "dhcp6_parser.cc"
     break;
 
-  case 473:
-#line 1585 "dhcp6_parser.yy"
+  case 490:
+#line 1644 "dhcp6_parser.yy"
                                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2623 "dhcp6_parser.cc"
+#line 2704 "dhcp6_parser.cc"
     break;
 
-  case 474:
-#line 1587 "dhcp6_parser.yy"
+  case 491:
+#line 1646 "dhcp6_parser.yy"
                {
     ElementPtr rtypes(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
     ctx.leave();
 }
-#line 2633 "dhcp6_parser.cc"
+#line 2714 "dhcp6_parser.cc"
     break;
 
-  case 475:
-#line 1593 "dhcp6_parser.yy"
+  case 492:
+#line 1652 "dhcp6_parser.yy"
              {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2641 "dhcp6_parser.cc"
+#line 2722 "dhcp6_parser.cc"
     break;
 
-  case 476:
-#line 1595 "dhcp6_parser.yy"
+  case 493:
+#line 1654 "dhcp6_parser.yy"
                {
     ElementPtr space(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
     ctx.leave();
 }
-#line 2651 "dhcp6_parser.cc"
+#line 2732 "dhcp6_parser.cc"
     break;
 
-  case 478:
-#line 1603 "dhcp6_parser.yy"
+  case 495:
+#line 1662 "dhcp6_parser.yy"
                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2659 "dhcp6_parser.cc"
+#line 2740 "dhcp6_parser.cc"
     break;
 
-  case 479:
-#line 1605 "dhcp6_parser.yy"
+  case 496:
+#line 1664 "dhcp6_parser.yy"
                {
     ElementPtr encap(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
     ctx.leave();
 }
-#line 2669 "dhcp6_parser.cc"
+#line 2750 "dhcp6_parser.cc"
     break;
 
-  case 480:
-#line 1611 "dhcp6_parser.yy"
+  case 497:
+#line 1670 "dhcp6_parser.yy"
                                       {
     ElementPtr array(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
 }
-#line 2678 "dhcp6_parser.cc"
+#line 2759 "dhcp6_parser.cc"
     break;
 
-  case 481:
-#line 1620 "dhcp6_parser.yy"
+  case 498:
+#line 1679 "dhcp6_parser.yy"
                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DATA);
 }
-#line 2689 "dhcp6_parser.cc"
+#line 2770 "dhcp6_parser.cc"
     break;
 
-  case 482:
-#line 1625 "dhcp6_parser.yy"
+  case 499:
+#line 1684 "dhcp6_parser.yy"
                                                                  {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2698 "dhcp6_parser.cc"
+#line 2779 "dhcp6_parser.cc"
     break;
 
-  case 487:
-#line 1644 "dhcp6_parser.yy"
+  case 504:
+#line 1703 "dhcp6_parser.yy"
                                   {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2708 "dhcp6_parser.cc"
+#line 2789 "dhcp6_parser.cc"
     break;
 
-  case 488:
-#line 1648 "dhcp6_parser.yy"
+  case 505:
+#line 1707 "dhcp6_parser.yy"
                                     {
     /// @todo: the code or name parameters are required.
     ctx.stack_.pop_back();
 }
-#line 2717 "dhcp6_parser.cc"
+#line 2798 "dhcp6_parser.cc"
     break;
 
-  case 489:
-#line 1656 "dhcp6_parser.yy"
+  case 506:
+#line 1715 "dhcp6_parser.yy"
                                 {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2727 "dhcp6_parser.cc"
+#line 2808 "dhcp6_parser.cc"
     break;
 
-  case 490:
-#line 1660 "dhcp6_parser.yy"
+  case 507:
+#line 1719 "dhcp6_parser.yy"
                                     {
     /// @todo: the code or name parameters are required.
     // parsing completed
 }
-#line 2736 "dhcp6_parser.cc"
+#line 2817 "dhcp6_parser.cc"
     break;
 
-  case 505:
-#line 1693 "dhcp6_parser.yy"
+  case 522:
+#line 1752 "dhcp6_parser.yy"
                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2744 "dhcp6_parser.cc"
+#line 2825 "dhcp6_parser.cc"
     break;
 
-  case 506:
-#line 1695 "dhcp6_parser.yy"
+  case 523:
+#line 1754 "dhcp6_parser.yy"
                {
     ElementPtr data(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
     ctx.leave();
 }
-#line 2754 "dhcp6_parser.cc"
+#line 2835 "dhcp6_parser.cc"
     break;
 
-  case 509:
-#line 1705 "dhcp6_parser.yy"
+  case 526:
+#line 1764 "dhcp6_parser.yy"
                                                  {
     ElementPtr space(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
 }
-#line 2763 "dhcp6_parser.cc"
+#line 2844 "dhcp6_parser.cc"
     break;
 
-  case 510:
-#line 1710 "dhcp6_parser.yy"
+  case 527:
+#line 1769 "dhcp6_parser.yy"
                                                    {
     ElementPtr persist(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-send", persist);
 }
-#line 2772 "dhcp6_parser.cc"
+#line 2853 "dhcp6_parser.cc"
     break;
 
-  case 511:
-#line 1718 "dhcp6_parser.yy"
+  case 528:
+#line 1777 "dhcp6_parser.yy"
                   {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.POOLS);
 }
-#line 2783 "dhcp6_parser.cc"
+#line 2864 "dhcp6_parser.cc"
     break;
 
-  case 512:
-#line 1723 "dhcp6_parser.yy"
+  case 529:
+#line 1782 "dhcp6_parser.yy"
                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2792 "dhcp6_parser.cc"
+#line 2873 "dhcp6_parser.cc"
     break;
 
-  case 517:
-#line 1738 "dhcp6_parser.yy"
+  case 534:
+#line 1797 "dhcp6_parser.yy"
                                 {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2802 "dhcp6_parser.cc"
+#line 2883 "dhcp6_parser.cc"
     break;
 
-  case 518:
-#line 1742 "dhcp6_parser.yy"
+  case 535:
+#line 1801 "dhcp6_parser.yy"
                              {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2812 "dhcp6_parser.cc"
+#line 2893 "dhcp6_parser.cc"
     break;
 
-  case 519:
-#line 1748 "dhcp6_parser.yy"
+  case 536:
+#line 1807 "dhcp6_parser.yy"
                           {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2822 "dhcp6_parser.cc"
+#line 2903 "dhcp6_parser.cc"
     break;
 
-  case 520:
-#line 1752 "dhcp6_parser.yy"
+  case 537:
+#line 1811 "dhcp6_parser.yy"
                              {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2832 "dhcp6_parser.cc"
+#line 2913 "dhcp6_parser.cc"
     break;
 
-  case 532:
-#line 1773 "dhcp6_parser.yy"
+  case 549:
+#line 1832 "dhcp6_parser.yy"
                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2840 "dhcp6_parser.cc"
+#line 2921 "dhcp6_parser.cc"
     break;
 
-  case 533:
-#line 1775 "dhcp6_parser.yy"
+  case 550:
+#line 1834 "dhcp6_parser.yy"
                {
     ElementPtr pool(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
     ctx.leave();
 }
-#line 2850 "dhcp6_parser.cc"
+#line 2931 "dhcp6_parser.cc"
     break;
 
-  case 534:
-#line 1781 "dhcp6_parser.yy"
+  case 551:
+#line 1840 "dhcp6_parser.yy"
                            {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2858 "dhcp6_parser.cc"
+#line 2939 "dhcp6_parser.cc"
     break;
 
-  case 535:
-#line 1783 "dhcp6_parser.yy"
+  case 552:
+#line 1842 "dhcp6_parser.yy"
                   {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
@@ -2881,19 +2962,19 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2885 "dhcp6_parser.cc"
+#line 2966 "dhcp6_parser.cc"
     break;
 
-  case 536:
-#line 1806 "dhcp6_parser.yy"
+  case 553:
+#line 1865 "dhcp6_parser.yy"
                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2893 "dhcp6_parser.cc"
+#line 2974 "dhcp6_parser.cc"
     break;
 
-  case 537:
-#line 1808 "dhcp6_parser.yy"
+  case 554:
+#line 1867 "dhcp6_parser.yy"
                {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
@@ -2918,41 +2999,41 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2922 "dhcp6_parser.cc"
+#line 3003 "dhcp6_parser.cc"
     break;
 
-  case 538:
-#line 1836 "dhcp6_parser.yy"
+  case 555:
+#line 1895 "dhcp6_parser.yy"
                         {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pd-pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.PD_POOLS);
 }
-#line 2933 "dhcp6_parser.cc"
+#line 3014 "dhcp6_parser.cc"
     break;
 
-  case 539:
-#line 1841 "dhcp6_parser.yy"
+  case 556:
+#line 1900 "dhcp6_parser.yy"
                                                               {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2942 "dhcp6_parser.cc"
+#line 3023 "dhcp6_parser.cc"
     break;
 
-  case 544:
-#line 1856 "dhcp6_parser.yy"
+  case 561:
+#line 1915 "dhcp6_parser.yy"
                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2952 "dhcp6_parser.cc"
+#line 3033 "dhcp6_parser.cc"
     break;
 
-  case 545:
-#line 1860 "dhcp6_parser.yy"
+  case 562:
+#line 1919 "dhcp6_parser.yy"
                                 {
     // The prefix, prefix len and delegated len parameters are required.
     ctx.require("prefix", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2960,21 +3041,21 @@ namespace isc { namespace dhcp {
     ctx.require("delegated-len", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2964 "dhcp6_parser.cc"
+#line 3045 "dhcp6_parser.cc"
     break;
 
-  case 546:
-#line 1868 "dhcp6_parser.yy"
+  case 563:
+#line 1927 "dhcp6_parser.yy"
                             {
     // Parse the pd-pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2974 "dhcp6_parser.cc"
+#line 3055 "dhcp6_parser.cc"
     break;
 
-  case 547:
-#line 1872 "dhcp6_parser.yy"
+  case 564:
+#line 1931 "dhcp6_parser.yy"
                                 {
     // The prefix, prefix len and delegated len parameters are required.
     ctx.require("prefix", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2982,1370 +3063,1370 @@ namespace isc { namespace dhcp {
     ctx.require("delegated-len", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2986 "dhcp6_parser.cc"
+#line 3067 "dhcp6_parser.cc"
     break;
 
-  case 563:
-#line 1899 "dhcp6_parser.yy"
+  case 580:
+#line 1958 "dhcp6_parser.yy"
                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2994 "dhcp6_parser.cc"
+#line 3075 "dhcp6_parser.cc"
     break;
 
-  case 564:
-#line 1901 "dhcp6_parser.yy"
+  case 581:
+#line 1960 "dhcp6_parser.yy"
                {
     ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix", prf);
     ctx.leave();
 }
-#line 3004 "dhcp6_parser.cc"
+#line 3085 "dhcp6_parser.cc"
     break;
 
-  case 565:
-#line 1907 "dhcp6_parser.yy"
+  case 582:
+#line 1966 "dhcp6_parser.yy"
                                         {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix-len", prf);
 }
-#line 3013 "dhcp6_parser.cc"
+#line 3094 "dhcp6_parser.cc"
     break;
 
-  case 566:
-#line 1912 "dhcp6_parser.yy"
+  case 583:
+#line 1971 "dhcp6_parser.yy"
                                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3021 "dhcp6_parser.cc"
+#line 3102 "dhcp6_parser.cc"
     break;
 
-  case 567:
-#line 1914 "dhcp6_parser.yy"
+  case 584:
+#line 1973 "dhcp6_parser.yy"
                {
     ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix", prf);
     ctx.leave();
 }
-#line 3031 "dhcp6_parser.cc"
+#line 3112 "dhcp6_parser.cc"
     break;
 
-  case 568:
-#line 1920 "dhcp6_parser.yy"
+  case 585:
+#line 1979 "dhcp6_parser.yy"
                                                        {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix-len", prf);
 }
-#line 3040 "dhcp6_parser.cc"
+#line 3121 "dhcp6_parser.cc"
     break;
 
-  case 569:
-#line 1925 "dhcp6_parser.yy"
+  case 586:
+#line 1984 "dhcp6_parser.yy"
                                               {
     ElementPtr deleg(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("delegated-len", deleg);
 }
-#line 3049 "dhcp6_parser.cc"
+#line 3130 "dhcp6_parser.cc"
     break;
 
-  case 570:
-#line 1933 "dhcp6_parser.yy"
+  case 587:
+#line 1992 "dhcp6_parser.yy"
                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.RESERVATIONS);
 }
-#line 3060 "dhcp6_parser.cc"
+#line 3141 "dhcp6_parser.cc"
     break;
 
-  case 571:
-#line 1938 "dhcp6_parser.yy"
+  case 588:
+#line 1997 "dhcp6_parser.yy"
                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3069 "dhcp6_parser.cc"
+#line 3150 "dhcp6_parser.cc"
     break;
 
-  case 576:
-#line 1951 "dhcp6_parser.yy"
+  case 593:
+#line 2010 "dhcp6_parser.yy"
                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3079 "dhcp6_parser.cc"
+#line 3160 "dhcp6_parser.cc"
     break;
 
-  case 577:
-#line 1955 "dhcp6_parser.yy"
+  case 594:
+#line 2014 "dhcp6_parser.yy"
                                     {
     /// @todo: an identifier parameter is required.
     ctx.stack_.pop_back();
 }
-#line 3088 "dhcp6_parser.cc"
+#line 3169 "dhcp6_parser.cc"
     break;
 
-  case 578:
-#line 1960 "dhcp6_parser.yy"
+  case 595:
+#line 2019 "dhcp6_parser.yy"
                                 {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3098 "dhcp6_parser.cc"
+#line 3179 "dhcp6_parser.cc"
     break;
 
-  case 579:
-#line 1964 "dhcp6_parser.yy"
+  case 596:
+#line 2023 "dhcp6_parser.yy"
                                     {
     /// @todo: an identifier parameter is required.
     // parsing completed
 }
-#line 3107 "dhcp6_parser.cc"
+#line 3188 "dhcp6_parser.cc"
     break;
 
-  case 595:
-#line 1991 "dhcp6_parser.yy"
+  case 612:
+#line 2050 "dhcp6_parser.yy"
                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-addresses", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3118 "dhcp6_parser.cc"
+#line 3199 "dhcp6_parser.cc"
     break;
 
-  case 596:
-#line 1996 "dhcp6_parser.yy"
+  case 613:
+#line 2055 "dhcp6_parser.yy"
                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3127 "dhcp6_parser.cc"
+#line 3208 "dhcp6_parser.cc"
     break;
 
-  case 597:
-#line 2001 "dhcp6_parser.yy"
+  case 614:
+#line 2060 "dhcp6_parser.yy"
                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefixes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3138 "dhcp6_parser.cc"
+#line 3219 "dhcp6_parser.cc"
     break;
 
-  case 598:
-#line 2006 "dhcp6_parser.yy"
+  case 615:
+#line 2065 "dhcp6_parser.yy"
                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3147 "dhcp6_parser.cc"
+#line 3228 "dhcp6_parser.cc"
     break;
 
-  case 599:
-#line 2011 "dhcp6_parser.yy"
+  case 616:
+#line 2070 "dhcp6_parser.yy"
            {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3155 "dhcp6_parser.cc"
+#line 3236 "dhcp6_parser.cc"
     break;
 
-  case 600:
-#line 2013 "dhcp6_parser.yy"
+  case 617:
+#line 2072 "dhcp6_parser.yy"
                {
     ElementPtr d(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
     ctx.leave();
 }
-#line 3165 "dhcp6_parser.cc"
+#line 3246 "dhcp6_parser.cc"
     break;
 
-  case 601:
-#line 2019 "dhcp6_parser.yy"
+  case 618:
+#line 2078 "dhcp6_parser.yy"
                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3173 "dhcp6_parser.cc"
+#line 3254 "dhcp6_parser.cc"
     break;
 
-  case 602:
-#line 2021 "dhcp6_parser.yy"
+  case 619:
+#line 2080 "dhcp6_parser.yy"
                {
     ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
     ctx.leave();
 }
-#line 3183 "dhcp6_parser.cc"
+#line 3264 "dhcp6_parser.cc"
     break;
 
-  case 603:
-#line 2027 "dhcp6_parser.yy"
+  case 620:
+#line 2086 "dhcp6_parser.yy"
                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3191 "dhcp6_parser.cc"
+#line 3272 "dhcp6_parser.cc"
     break;
 
-  case 604:
-#line 2029 "dhcp6_parser.yy"
+  case 621:
+#line 2088 "dhcp6_parser.yy"
                {
     ElementPtr host(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
     ctx.leave();
 }
-#line 3201 "dhcp6_parser.cc"
+#line 3282 "dhcp6_parser.cc"
     break;
 
-  case 605:
-#line 2035 "dhcp6_parser.yy"
+  case 622:
+#line 2094 "dhcp6_parser.yy"
                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3209 "dhcp6_parser.cc"
+#line 3290 "dhcp6_parser.cc"
     break;
 
-  case 606:
-#line 2037 "dhcp6_parser.yy"
+  case 623:
+#line 2096 "dhcp6_parser.yy"
                {
     ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flex-id", hw);
     ctx.leave();
 }
-#line 3219 "dhcp6_parser.cc"
+#line 3300 "dhcp6_parser.cc"
     break;
 
-  case 607:
-#line 2043 "dhcp6_parser.yy"
+  case 624:
+#line 2102 "dhcp6_parser.yy"
                                            {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3230 "dhcp6_parser.cc"
+#line 3311 "dhcp6_parser.cc"
     break;
 
-  case 608:
-#line 2048 "dhcp6_parser.yy"
+  case 625:
+#line 2107 "dhcp6_parser.yy"
                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3239 "dhcp6_parser.cc"
+#line 3320 "dhcp6_parser.cc"
     break;
 
-  case 609:
-#line 2056 "dhcp6_parser.yy"
+  case 626:
+#line 2115 "dhcp6_parser.yy"
              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.RELAY);
 }
-#line 3250 "dhcp6_parser.cc"
+#line 3331 "dhcp6_parser.cc"
     break;
 
-  case 610:
-#line 2061 "dhcp6_parser.yy"
+  case 627:
+#line 2120 "dhcp6_parser.yy"
                                                 {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3259 "dhcp6_parser.cc"
+#line 3340 "dhcp6_parser.cc"
     break;
 
-  case 613:
-#line 2070 "dhcp6_parser.yy"
+  case 630:
+#line 2129 "dhcp6_parser.yy"
                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3267 "dhcp6_parser.cc"
+#line 3348 "dhcp6_parser.cc"
     break;
 
-  case 614:
-#line 2072 "dhcp6_parser.yy"
+  case 631:
+#line 2131 "dhcp6_parser.yy"
                {
     ElementPtr addr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", addr);
     ctx.leave();
 }
-#line 3277 "dhcp6_parser.cc"
+#line 3358 "dhcp6_parser.cc"
     break;
 
-  case 615:
-#line 2081 "dhcp6_parser.yy"
+  case 632:
+#line 2140 "dhcp6_parser.yy"
                                {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CLIENT_CLASSES);
 }
-#line 3288 "dhcp6_parser.cc"
+#line 3369 "dhcp6_parser.cc"
     break;
 
-  case 616:
-#line 2086 "dhcp6_parser.yy"
+  case 633:
+#line 2145 "dhcp6_parser.yy"
                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3297 "dhcp6_parser.cc"
+#line 3378 "dhcp6_parser.cc"
     break;
 
-  case 619:
-#line 2095 "dhcp6_parser.yy"
+  case 636:
+#line 2154 "dhcp6_parser.yy"
                                    {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3307 "dhcp6_parser.cc"
+#line 3388 "dhcp6_parser.cc"
     break;
 
-  case 620:
-#line 2099 "dhcp6_parser.yy"
+  case 637:
+#line 2158 "dhcp6_parser.yy"
                                      {
     // The name client class parameter is required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 3317 "dhcp6_parser.cc"
+#line 3398 "dhcp6_parser.cc"
     break;
 
-  case 633:
-#line 2124 "dhcp6_parser.yy"
+  case 650:
+#line 2183 "dhcp6_parser.yy"
                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3325 "dhcp6_parser.cc"
+#line 3406 "dhcp6_parser.cc"
     break;
 
-  case 634:
-#line 2126 "dhcp6_parser.yy"
+  case 651:
+#line 2185 "dhcp6_parser.yy"
                {
     ElementPtr test(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
     ctx.leave();
 }
-#line 3335 "dhcp6_parser.cc"
+#line 3416 "dhcp6_parser.cc"
     break;
 
-  case 635:
-#line 2132 "dhcp6_parser.yy"
+  case 652:
+#line 2191 "dhcp6_parser.yy"
                                                  {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("only-if-required", b);
 }
-#line 3344 "dhcp6_parser.cc"
+#line 3425 "dhcp6_parser.cc"
     break;
 
-  case 636:
-#line 2140 "dhcp6_parser.yy"
+  case 653:
+#line 2199 "dhcp6_parser.yy"
                      {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-id", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER_ID);
 }
-#line 3355 "dhcp6_parser.cc"
+#line 3436 "dhcp6_parser.cc"
     break;
 
-  case 637:
-#line 2145 "dhcp6_parser.yy"
+  case 654:
+#line 2204 "dhcp6_parser.yy"
                                                        {
     // The type parameter is required.
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3366 "dhcp6_parser.cc"
+#line 3447 "dhcp6_parser.cc"
     break;
 
-  case 649:
-#line 2167 "dhcp6_parser.yy"
+  case 666:
+#line 2226 "dhcp6_parser.yy"
                      {
     ctx.enter(ctx.DUID_TYPE);
 }
-#line 3374 "dhcp6_parser.cc"
+#line 3455 "dhcp6_parser.cc"
     break;
 
-  case 650:
-#line 2169 "dhcp6_parser.yy"
+  case 667:
+#line 2228 "dhcp6_parser.yy"
                   {
     ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3383 "dhcp6_parser.cc"
+#line 3464 "dhcp6_parser.cc"
     break;
 
-  case 651:
-#line 2174 "dhcp6_parser.yy"
+  case 668:
+#line 2233 "dhcp6_parser.yy"
                { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("LLT", ctx.loc2pos(yystack_[0].location))); }
-#line 3389 "dhcp6_parser.cc"
+#line 3470 "dhcp6_parser.cc"
     break;
 
-  case 652:
-#line 2175 "dhcp6_parser.yy"
+  case 669:
+#line 2234 "dhcp6_parser.yy"
               { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("EN", ctx.loc2pos(yystack_[0].location))); }
-#line 3395 "dhcp6_parser.cc"
+#line 3476 "dhcp6_parser.cc"
     break;
 
-  case 653:
-#line 2176 "dhcp6_parser.yy"
+  case 670:
+#line 2235 "dhcp6_parser.yy"
               { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("LL", ctx.loc2pos(yystack_[0].location))); }
-#line 3401 "dhcp6_parser.cc"
+#line 3482 "dhcp6_parser.cc"
     break;
 
-  case 654:
-#line 2179 "dhcp6_parser.yy"
+  case 671:
+#line 2238 "dhcp6_parser.yy"
                            {
     ElementPtr htype(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("htype", htype);
 }
-#line 3410 "dhcp6_parser.cc"
+#line 3491 "dhcp6_parser.cc"
     break;
 
-  case 655:
-#line 2184 "dhcp6_parser.yy"
+  case 672:
+#line 2243 "dhcp6_parser.yy"
                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3418 "dhcp6_parser.cc"
+#line 3499 "dhcp6_parser.cc"
     break;
 
-  case 656:
-#line 2186 "dhcp6_parser.yy"
+  case 673:
+#line 2245 "dhcp6_parser.yy"
                {
     ElementPtr id(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("identifier", id);
     ctx.leave();
 }
-#line 3428 "dhcp6_parser.cc"
+#line 3509 "dhcp6_parser.cc"
     break;
 
-  case 657:
-#line 2192 "dhcp6_parser.yy"
+  case 674:
+#line 2251 "dhcp6_parser.yy"
                          {
     ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("time", time);
 }
-#line 3437 "dhcp6_parser.cc"
+#line 3518 "dhcp6_parser.cc"
     break;
 
-  case 658:
-#line 2197 "dhcp6_parser.yy"
+  case 675:
+#line 2256 "dhcp6_parser.yy"
                                            {
     ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enterprise-id", time);
 }
-#line 3446 "dhcp6_parser.cc"
+#line 3527 "dhcp6_parser.cc"
     break;
 
-  case 659:
-#line 2204 "dhcp6_parser.yy"
+  case 676:
+#line 2263 "dhcp6_parser.yy"
                                          {
     ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
 }
-#line 3455 "dhcp6_parser.cc"
+#line 3536 "dhcp6_parser.cc"
     break;
 
-  case 660:
-#line 2211 "dhcp6_parser.yy"
+  case 677:
+#line 2270 "dhcp6_parser.yy"
                                {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 3466 "dhcp6_parser.cc"
+#line 3547 "dhcp6_parser.cc"
     break;
 
-  case 661:
-#line 2216 "dhcp6_parser.yy"
+  case 678:
+#line 2275 "dhcp6_parser.yy"
                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3475 "dhcp6_parser.cc"
+#line 3556 "dhcp6_parser.cc"
     break;
 
-  case 677:
-#line 2244 "dhcp6_parser.yy"
+  case 694:
+#line 2303 "dhcp6_parser.yy"
                          {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3483 "dhcp6_parser.cc"
+#line 3564 "dhcp6_parser.cc"
     break;
 
-  case 678:
-#line 2246 "dhcp6_parser.yy"
+  case 695:
+#line 2305 "dhcp6_parser.yy"
                {
     ElementPtr stype(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 3493 "dhcp6_parser.cc"
+#line 3574 "dhcp6_parser.cc"
     break;
 
-  case 679:
-#line 2252 "dhcp6_parser.yy"
+  case 696:
+#line 2311 "dhcp6_parser.yy"
                          {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3501 "dhcp6_parser.cc"
+#line 3582 "dhcp6_parser.cc"
     break;
 
-  case 680:
-#line 2254 "dhcp6_parser.yy"
+  case 697:
+#line 2313 "dhcp6_parser.yy"
                {
     ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 3511 "dhcp6_parser.cc"
+#line 3592 "dhcp6_parser.cc"
     break;
 
-  case 681:
-#line 2260 "dhcp6_parser.yy"
+  case 698:
+#line 2319 "dhcp6_parser.yy"
                                                                                                              {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("on-boot-request-configuration-from-kea-netconf", b);
 }
-#line 3520 "dhcp6_parser.cc"
+#line 3601 "dhcp6_parser.cc"
     break;
 
-  case 682:
-#line 2267 "dhcp6_parser.yy"
+  case 699:
+#line 2326 "dhcp6_parser.yy"
                                        {
     ElementPtr qc(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-queue-control", qc);
     ctx.stack_.push_back(qc);
     ctx.enter(ctx.DHCP_QUEUE_CONTROL);
 }
-#line 3531 "dhcp6_parser.cc"
+#line 3612 "dhcp6_parser.cc"
     break;
 
-  case 683:
-#line 2272 "dhcp6_parser.yy"
+  case 700:
+#line 2331 "dhcp6_parser.yy"
                                                            {
     // The enable queue parameter is required.
     ctx.require("enable-queue", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3542 "dhcp6_parser.cc"
+#line 3623 "dhcp6_parser.cc"
     break;
 
-  case 692:
-#line 2291 "dhcp6_parser.yy"
+  case 709:
+#line 2350 "dhcp6_parser.yy"
                                          {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-queue", b);
 }
-#line 3551 "dhcp6_parser.cc"
+#line 3632 "dhcp6_parser.cc"
     break;
 
-  case 693:
-#line 2296 "dhcp6_parser.yy"
+  case 710:
+#line 2355 "dhcp6_parser.yy"
                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3559 "dhcp6_parser.cc"
+#line 3640 "dhcp6_parser.cc"
     break;
 
-  case 694:
-#line 2298 "dhcp6_parser.yy"
+  case 711:
+#line 2357 "dhcp6_parser.yy"
                {
     ElementPtr qt(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("queue-type", qt);
     ctx.leave();
 }
-#line 3569 "dhcp6_parser.cc"
+#line 3650 "dhcp6_parser.cc"
     break;
 
-  case 695:
-#line 2304 "dhcp6_parser.yy"
+  case 712:
+#line 2363 "dhcp6_parser.yy"
                                  {
     ElementPtr c(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("capacity", c);
 }
-#line 3578 "dhcp6_parser.cc"
+#line 3659 "dhcp6_parser.cc"
     break;
 
-  case 696:
-#line 2309 "dhcp6_parser.yy"
+  case 713:
+#line 2368 "dhcp6_parser.yy"
                             {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3586 "dhcp6_parser.cc"
+#line 3667 "dhcp6_parser.cc"
     break;
 
-  case 697:
-#line 2311 "dhcp6_parser.yy"
+  case 714:
+#line 2370 "dhcp6_parser.yy"
               {
     ctx.stack_.back()->set(yystack_[3].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3595 "dhcp6_parser.cc"
+#line 3676 "dhcp6_parser.cc"
     break;
 
-  case 698:
-#line 2318 "dhcp6_parser.yy"
+  case 715:
+#line 2377 "dhcp6_parser.yy"
                      {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP_DDNS);
 }
-#line 3606 "dhcp6_parser.cc"
+#line 3687 "dhcp6_parser.cc"
     break;
 
-  case 699:
-#line 2323 "dhcp6_parser.yy"
+  case 716:
+#line 2382 "dhcp6_parser.yy"
                                                        {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3617 "dhcp6_parser.cc"
+#line 3698 "dhcp6_parser.cc"
     break;
 
-  case 700:
-#line 2330 "dhcp6_parser.yy"
+  case 717:
+#line 2389 "dhcp6_parser.yy"
                               {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3627 "dhcp6_parser.cc"
+#line 3708 "dhcp6_parser.cc"
     break;
 
-  case 701:
-#line 2334 "dhcp6_parser.yy"
+  case 718:
+#line 2393 "dhcp6_parser.yy"
                                   {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 3637 "dhcp6_parser.cc"
+#line 3718 "dhcp6_parser.cc"
     break;
 
-  case 722:
-#line 2364 "dhcp6_parser.yy"
+  case 739:
+#line 2423 "dhcp6_parser.yy"
                                              {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
 }
-#line 3646 "dhcp6_parser.cc"
+#line 3727 "dhcp6_parser.cc"
     break;
 
-  case 723:
-#line 2369 "dhcp6_parser.yy"
+  case 740:
+#line 2428 "dhcp6_parser.yy"
                                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3654 "dhcp6_parser.cc"
+#line 3735 "dhcp6_parser.cc"
     break;
 
-  case 724:
-#line 2371 "dhcp6_parser.yy"
+  case 741:
+#line 2430 "dhcp6_parser.yy"
                {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
     ctx.leave();
 }
-#line 3664 "dhcp6_parser.cc"
+#line 3745 "dhcp6_parser.cc"
     break;
 
-  case 725:
-#line 2377 "dhcp6_parser.yy"
+  case 742:
+#line 2436 "dhcp6_parser.yy"
                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3672 "dhcp6_parser.cc"
+#line 3753 "dhcp6_parser.cc"
     break;
 
-  case 726:
-#line 2379 "dhcp6_parser.yy"
+  case 743:
+#line 2438 "dhcp6_parser.yy"
                {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
     ctx.leave();
 }
-#line 3682 "dhcp6_parser.cc"
+#line 3763 "dhcp6_parser.cc"
     break;
 
-  case 727:
-#line 2385 "dhcp6_parser.yy"
+  case 744:
+#line 2444 "dhcp6_parser.yy"
                                        {
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
 }
-#line 3691 "dhcp6_parser.cc"
+#line 3772 "dhcp6_parser.cc"
     break;
 
-  case 728:
-#line 2390 "dhcp6_parser.yy"
+  case 745:
+#line 2449 "dhcp6_parser.yy"
                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3699 "dhcp6_parser.cc"
+#line 3780 "dhcp6_parser.cc"
     break;
 
-  case 729:
-#line 2392 "dhcp6_parser.yy"
+  case 746:
+#line 2451 "dhcp6_parser.yy"
                {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
     ctx.leave();
 }
-#line 3709 "dhcp6_parser.cc"
+#line 3790 "dhcp6_parser.cc"
     break;
 
-  case 730:
-#line 2398 "dhcp6_parser.yy"
+  case 747:
+#line 2457 "dhcp6_parser.yy"
                                        {
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
 }
-#line 3718 "dhcp6_parser.cc"
+#line 3799 "dhcp6_parser.cc"
     break;
 
-  case 731:
-#line 2403 "dhcp6_parser.yy"
+  case 748:
+#line 2462 "dhcp6_parser.yy"
                                              {
     ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
 }
-#line 3727 "dhcp6_parser.cc"
+#line 3808 "dhcp6_parser.cc"
     break;
 
-  case 732:
-#line 2408 "dhcp6_parser.yy"
+  case 749:
+#line 2467 "dhcp6_parser.yy"
                            {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 3735 "dhcp6_parser.cc"
+#line 3816 "dhcp6_parser.cc"
     break;
 
-  case 733:
-#line 2410 "dhcp6_parser.yy"
+  case 750:
+#line 2469 "dhcp6_parser.yy"
                            {
     ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3744 "dhcp6_parser.cc"
+#line 3825 "dhcp6_parser.cc"
     break;
 
-  case 734:
-#line 2416 "dhcp6_parser.yy"
+  case 751:
+#line 2475 "dhcp6_parser.yy"
         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 3750 "dhcp6_parser.cc"
+#line 3831 "dhcp6_parser.cc"
     break;
 
-  case 735:
-#line 2417 "dhcp6_parser.yy"
+  case 752:
+#line 2476 "dhcp6_parser.yy"
         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 3756 "dhcp6_parser.cc"
+#line 3837 "dhcp6_parser.cc"
     break;
 
-  case 736:
-#line 2420 "dhcp6_parser.yy"
+  case 753:
+#line 2479 "dhcp6_parser.yy"
                        {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 3764 "dhcp6_parser.cc"
+#line 3845 "dhcp6_parser.cc"
     break;
 
-  case 737:
-#line 2422 "dhcp6_parser.yy"
+  case 754:
+#line 2481 "dhcp6_parser.yy"
              {
     ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ncr-format", json);
     ctx.leave();
 }
-#line 3774 "dhcp6_parser.cc"
+#line 3855 "dhcp6_parser.cc"
     break;
 
-  case 738:
-#line 2429 "dhcp6_parser.yy"
+  case 755:
+#line 2488 "dhcp6_parser.yy"
                                                          {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
 }
-#line 3783 "dhcp6_parser.cc"
+#line 3864 "dhcp6_parser.cc"
     break;
 
-  case 739:
-#line 2435 "dhcp6_parser.yy"
+  case 756:
+#line 2494 "dhcp6_parser.yy"
                                                                  {
     ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
 }
-#line 3792 "dhcp6_parser.cc"
+#line 3873 "dhcp6_parser.cc"
     break;
 
-  case 740:
-#line 2441 "dhcp6_parser.yy"
+  case 757:
+#line 2500 "dhcp6_parser.yy"
                                              {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 3800 "dhcp6_parser.cc"
+#line 3881 "dhcp6_parser.cc"
     break;
 
-  case 741:
-#line 2443 "dhcp6_parser.yy"
+  case 758:
+#line 2502 "dhcp6_parser.yy"
                                        {
     ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3809 "dhcp6_parser.cc"
+#line 3890 "dhcp6_parser.cc"
     break;
 
-  case 742:
-#line 2449 "dhcp6_parser.yy"
+  case 759:
+#line 2508 "dhcp6_parser.yy"
                                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3817 "dhcp6_parser.cc"
+#line 3898 "dhcp6_parser.cc"
     break;
 
-  case 743:
-#line 2451 "dhcp6_parser.yy"
+  case 760:
+#line 2510 "dhcp6_parser.yy"
                {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
     ctx.leave();
 }
-#line 3827 "dhcp6_parser.cc"
+#line 3908 "dhcp6_parser.cc"
     break;
 
-  case 744:
-#line 2458 "dhcp6_parser.yy"
+  case 761:
+#line 2517 "dhcp6_parser.yy"
                                          {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3835 "dhcp6_parser.cc"
+#line 3916 "dhcp6_parser.cc"
     break;
 
-  case 745:
-#line 2460 "dhcp6_parser.yy"
+  case 762:
+#line 2519 "dhcp6_parser.yy"
                {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-set", s);
     ctx.leave();
 }
-#line 3845 "dhcp6_parser.cc"
+#line 3926 "dhcp6_parser.cc"
     break;
 
-  case 746:
-#line 2467 "dhcp6_parser.yy"
+  case 763:
+#line 2526 "dhcp6_parser.yy"
                                                          {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3853 "dhcp6_parser.cc"
+#line 3934 "dhcp6_parser.cc"
     break;
 
-  case 747:
-#line 2469 "dhcp6_parser.yy"
+  case 764:
+#line 2528 "dhcp6_parser.yy"
                {
     ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-replacement", s);
     ctx.leave();
 }
-#line 3863 "dhcp6_parser.cc"
+#line 3944 "dhcp6_parser.cc"
     break;
 
-  case 748:
-#line 2478 "dhcp6_parser.yy"
+  case 765:
+#line 2537 "dhcp6_parser.yy"
                                {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-control", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.CONFIG_CONTROL);
 }
-#line 3874 "dhcp6_parser.cc"
+#line 3955 "dhcp6_parser.cc"
     break;
 
-  case 749:
-#line 2483 "dhcp6_parser.yy"
+  case 766:
+#line 2542 "dhcp6_parser.yy"
                                                             {
     // No config control params are required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3884 "dhcp6_parser.cc"
+#line 3965 "dhcp6_parser.cc"
     break;
 
-  case 750:
-#line 2489 "dhcp6_parser.yy"
+  case 767:
+#line 2548 "dhcp6_parser.yy"
                                    {
     // Parse the config-control map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3894 "dhcp6_parser.cc"
+#line 3975 "dhcp6_parser.cc"
     break;
 
-  case 751:
-#line 2493 "dhcp6_parser.yy"
+  case 768:
+#line 2552 "dhcp6_parser.yy"
                                        {
     // No config_control params are required
     // parsing completed
 }
-#line 3903 "dhcp6_parser.cc"
+#line 3984 "dhcp6_parser.cc"
     break;
 
-  case 756:
-#line 2508 "dhcp6_parser.yy"
+  case 773:
+#line 2567 "dhcp6_parser.yy"
                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CONFIG_DATABASE);
 }
-#line 3914 "dhcp6_parser.cc"
+#line 3995 "dhcp6_parser.cc"
     break;
 
-  case 757:
-#line 2513 "dhcp6_parser.yy"
+  case 774:
+#line 2572 "dhcp6_parser.yy"
                                                       {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3923 "dhcp6_parser.cc"
+#line 4004 "dhcp6_parser.cc"
     break;
 
-  case 758:
-#line 2518 "dhcp6_parser.yy"
+  case 775:
+#line 2577 "dhcp6_parser.yy"
                                                              {
     ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-fetch-wait-time", value);
 }
-#line 3932 "dhcp6_parser.cc"
+#line 4013 "dhcp6_parser.cc"
     break;
 
-  case 759:
-#line 2525 "dhcp6_parser.yy"
+  case 776:
+#line 2584 "dhcp6_parser.yy"
                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 3943 "dhcp6_parser.cc"
+#line 4024 "dhcp6_parser.cc"
     break;
 
-  case 760:
-#line 2530 "dhcp6_parser.yy"
+  case 777:
+#line 2589 "dhcp6_parser.yy"
                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3952 "dhcp6_parser.cc"
+#line 4033 "dhcp6_parser.cc"
     break;
 
-  case 763:
-#line 2542 "dhcp6_parser.yy"
+  case 780:
+#line 2601 "dhcp6_parser.yy"
                              {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 3962 "dhcp6_parser.cc"
+#line 4043 "dhcp6_parser.cc"
     break;
 
-  case 764:
-#line 2546 "dhcp6_parser.yy"
+  case 781:
+#line 2605 "dhcp6_parser.yy"
                                {
     ctx.stack_.pop_back();
 }
-#line 3970 "dhcp6_parser.cc"
+#line 4051 "dhcp6_parser.cc"
     break;
 
-  case 774:
-#line 2563 "dhcp6_parser.yy"
+  case 791:
+#line 2622 "dhcp6_parser.yy"
                                      {
     ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 3979 "dhcp6_parser.cc"
+#line 4060 "dhcp6_parser.cc"
     break;
 
-  case 775:
-#line 2568 "dhcp6_parser.yy"
+  case 792:
+#line 2627 "dhcp6_parser.yy"
                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3987 "dhcp6_parser.cc"
+#line 4068 "dhcp6_parser.cc"
     break;
 
-  case 776:
-#line 2570 "dhcp6_parser.yy"
+  case 793:
+#line 2629 "dhcp6_parser.yy"
                {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 3997 "dhcp6_parser.cc"
+#line 4078 "dhcp6_parser.cc"
     break;
 
-  case 777:
-#line 2576 "dhcp6_parser.yy"
+  case 794:
+#line 2635 "dhcp6_parser.yy"
                                     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 4008 "dhcp6_parser.cc"
+#line 4089 "dhcp6_parser.cc"
     break;
 
-  case 778:
-#line 2581 "dhcp6_parser.yy"
+  case 795:
+#line 2640 "dhcp6_parser.yy"
                                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 4017 "dhcp6_parser.cc"
+#line 4098 "dhcp6_parser.cc"
     break;
 
-  case 781:
-#line 2590 "dhcp6_parser.yy"
+  case 798:
+#line 2649 "dhcp6_parser.yy"
                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 4027 "dhcp6_parser.cc"
+#line 4108 "dhcp6_parser.cc"
     break;
 
-  case 782:
-#line 2594 "dhcp6_parser.yy"
+  case 799:
+#line 2653 "dhcp6_parser.yy"
                                     {
     ctx.stack_.pop_back();
 }
-#line 4035 "dhcp6_parser.cc"
+#line 4116 "dhcp6_parser.cc"
     break;
 
-  case 790:
-#line 2609 "dhcp6_parser.yy"
+  case 807:
+#line 2668 "dhcp6_parser.yy"
                {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 4043 "dhcp6_parser.cc"
+#line 4124 "dhcp6_parser.cc"
     break;
 
-  case 791:
-#line 2611 "dhcp6_parser.yy"
+  case 808:
+#line 2670 "dhcp6_parser.yy"
                {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 4053 "dhcp6_parser.cc"
+#line 4134 "dhcp6_parser.cc"
     break;
 
-  case 792:
-#line 2617 "dhcp6_parser.yy"
+  case 809:
+#line 2676 "dhcp6_parser.yy"
                            {
     ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 4062 "dhcp6_parser.cc"
+#line 4143 "dhcp6_parser.cc"
     break;
 
-  case 793:
-#line 2622 "dhcp6_parser.yy"
+  case 810:
+#line 2681 "dhcp6_parser.yy"
                                {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 4071 "dhcp6_parser.cc"
+#line 4152 "dhcp6_parser.cc"
     break;
 
-  case 794:
-#line 2627 "dhcp6_parser.yy"
+  case 811:
+#line 2686 "dhcp6_parser.yy"
                              {
     ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 4080 "dhcp6_parser.cc"
+#line 4161 "dhcp6_parser.cc"
     break;
 
-  case 795:
-#line 2632 "dhcp6_parser.yy"
+  case 812:
+#line 2691 "dhcp6_parser.yy"
                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 4088 "dhcp6_parser.cc"
+#line 4169 "dhcp6_parser.cc"
     break;
 
-  case 796:
-#line 2634 "dhcp6_parser.yy"
+  case 813:
+#line 2693 "dhcp6_parser.yy"
                {
     ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pattern", sev);
     ctx.leave();
 }
-#line 4098 "dhcp6_parser.cc"
+#line 4179 "dhcp6_parser.cc"
     break;
 
-  case 797:
-#line 2642 "dhcp6_parser.yy"
+  case 814:
+#line 2701 "dhcp6_parser.yy"
                                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 4106 "dhcp6_parser.cc"
+#line 4187 "dhcp6_parser.cc"
     break;
 
-  case 798:
-#line 2644 "dhcp6_parser.yy"
+  case 815:
+#line 2703 "dhcp6_parser.yy"
                {
     ElementPtr allocation_type(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("allocation-type", allocation_type);
     ctx.leave();
 }
-#line 4116 "dhcp6_parser.cc"
+#line 4197 "dhcp6_parser.cc"
     break;
 
-  case 799:
-#line 2650 "dhcp6_parser.yy"
+  case 816:
+#line 2709 "dhcp6_parser.yy"
                                  {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.CONFIG_DATABASE);
 }
-#line 4127 "dhcp6_parser.cc"
+#line 4208 "dhcp6_parser.cc"
     break;
 
-  case 800:
-#line 2655 "dhcp6_parser.yy"
+  case 817:
+#line 2714 "dhcp6_parser.yy"
                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 4136 "dhcp6_parser.cc"
+#line 4217 "dhcp6_parser.cc"
     break;
 
-  case 801:
-#line 2660 "dhcp6_parser.yy"
+  case 818:
+#line 2719 "dhcp6_parser.yy"
                                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 4144 "dhcp6_parser.cc"
+#line 4225 "dhcp6_parser.cc"
     break;
 
-  case 802:
-#line 2662 "dhcp6_parser.yy"
+  case 819:
+#line 2721 "dhcp6_parser.yy"
                {
     ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("configuration-type", prf);
     ctx.leave();
 }
-#line 4154 "dhcp6_parser.cc"
+#line 4235 "dhcp6_parser.cc"
     break;
 
-  case 803:
-#line 2668 "dhcp6_parser.yy"
+  case 820:
+#line 2727 "dhcp6_parser.yy"
                          {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 4162 "dhcp6_parser.cc"
+#line 4243 "dhcp6_parser.cc"
     break;
 
-  case 804:
-#line 2670 "dhcp6_parser.yy"
+  case 821:
+#line 2729 "dhcp6_parser.yy"
                {
     ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("instance-id", prf);
     ctx.leave();
 }
-#line 4172 "dhcp6_parser.cc"
+#line 4253 "dhcp6_parser.cc"
     break;
 
-  case 805:
-#line 2677 "dhcp6_parser.yy"
+  case 822:
+#line 2736 "dhcp6_parser.yy"
                                                                {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 4180 "dhcp6_parser.cc"
+#line 4261 "dhcp6_parser.cc"
     break;
 
-  case 806:
-#line 2679 "dhcp6_parser.yy"
+  case 823:
+#line 2738 "dhcp6_parser.yy"
               {
     ctx.stack_.back()->set("lawful-interception-parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 4189 "dhcp6_parser.cc"
+#line 4270 "dhcp6_parser.cc"
     break;
 
-  case 807:
-#line 2684 "dhcp6_parser.yy"
+  case 824:
+#line 2743 "dhcp6_parser.yy"
                                  {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("master-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.MASTER_DATABASE);
 }
-#line 4200 "dhcp6_parser.cc"
+#line 4281 "dhcp6_parser.cc"
     break;
 
-  case 808:
-#line 2689 "dhcp6_parser.yy"
+  case 825:
+#line 2748 "dhcp6_parser.yy"
                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 4209 "dhcp6_parser.cc"
+#line 4290 "dhcp6_parser.cc"
     break;
 
-  case 809:
-#line 2694 "dhcp6_parser.yy"
+  case 826:
+#line 2753 "dhcp6_parser.yy"
                                                                {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-address-utilization", n);
 }
-#line 4218 "dhcp6_parser.cc"
+#line 4299 "dhcp6_parser.cc"
     break;
 
-  case 810:
-#line 2699 "dhcp6_parser.yy"
+  case 827:
+#line 2758 "dhcp6_parser.yy"
                                                                  {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-pd-space-utilization", n);
 }
-#line 4227 "dhcp6_parser.cc"
+#line 4308 "dhcp6_parser.cc"
     break;
 
-  case 811:
-#line 2704 "dhcp6_parser.yy"
+  case 828:
+#line 2763 "dhcp6_parser.yy"
                                                        {
     ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-statement-tries", n);
 }
-#line 4236 "dhcp6_parser.cc"
+#line 4317 "dhcp6_parser.cc"
     break;
 
-  case 812:
-#line 2709 "dhcp6_parser.yy"
+  case 829:
+#line 2768 "dhcp6_parser.yy"
                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("notifications", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 4247 "dhcp6_parser.cc"
+#line 4328 "dhcp6_parser.cc"
     break;
 
-  case 813:
-#line 2714 "dhcp6_parser.yy"
+  case 830:
+#line 2773 "dhcp6_parser.yy"
                                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 4256 "dhcp6_parser.cc"
+#line 4337 "dhcp6_parser.cc"
     break;
 
-  case 814:
-#line 2719 "dhcp6_parser.yy"
+  case 831:
+#line 2778 "dhcp6_parser.yy"
                                                             {
     ElementPtr l(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-set-description", l);
 }
-#line 4265 "dhcp6_parser.cc"
+#line 4346 "dhcp6_parser.cc"
     break;
 
-  case 815:
-#line 2724 "dhcp6_parser.yy"
+  case 832:
+#line 2783 "dhcp6_parser.yy"
                                            {
     ElementPtr l(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-set-id", l);
 }
-#line 4274 "dhcp6_parser.cc"
+#line 4355 "dhcp6_parser.cc"
     break;
 
-  case 816:
-#line 2729 "dhcp6_parser.yy"
+  case 833:
+#line 2788 "dhcp6_parser.yy"
                                                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 4282 "dhcp6_parser.cc"
+#line 4363 "dhcp6_parser.cc"
     break;
 
-  case 817:
-#line 2731 "dhcp6_parser.yy"
+  case 834:
+#line 2790 "dhcp6_parser.yy"
               {
     ctx.stack_.back()->set("policy-engine-parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 4291 "dhcp6_parser.cc"
+#line 4372 "dhcp6_parser.cc"
     break;
 
-  case 818:
-#line 2736 "dhcp6_parser.yy"
+  case 835:
+#line 2795 "dhcp6_parser.yy"
                                                          {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("privacy-history-size", prf);
 }
-#line 4300 "dhcp6_parser.cc"
+#line 4381 "dhcp6_parser.cc"
     break;
 
-  case 819:
-#line 2741 "dhcp6_parser.yy"
+  case 836:
+#line 2800 "dhcp6_parser.yy"
                                                              {
     ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("privacy-valid-lifetime", prf);
 }
-#line 4309 "dhcp6_parser.cc"
+#line 4390 "dhcp6_parser.cc"
     break;
 
-  case 820:
-#line 2746 "dhcp6_parser.yy"
+  case 837:
+#line 2805 "dhcp6_parser.yy"
                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 4317 "dhcp6_parser.cc"
+#line 4398 "dhcp6_parser.cc"
     break;
 
-  case 821:
-#line 2748 "dhcp6_parser.yy"
+  case 838:
+#line 2807 "dhcp6_parser.yy"
                {
     ElementPtr protocol(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("protocol", protocol);
     ctx.leave();
 }
-#line 4327 "dhcp6_parser.cc"
+#line 4408 "dhcp6_parser.cc"
     break;
 
-  case 822:
-#line 2754 "dhcp6_parser.yy"
+  case 839:
+#line 2813 "dhcp6_parser.yy"
                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 4335 "dhcp6_parser.cc"
+#line 4416 "dhcp6_parser.cc"
     break;
 
-  case 823:
-#line 2756 "dhcp6_parser.yy"
+  case 840:
+#line 2815 "dhcp6_parser.yy"
                {
     ElementPtr cp(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ssl-cert", cp);
     ctx.leave();
 }
-#line 4345 "dhcp6_parser.cc"
+#line 4426 "dhcp6_parser.cc"
     break;
 
 
-#line 4349 "dhcp6_parser.cc"
+#line 4430 "dhcp6_parser.cc"
 
             default:
               break;
@@ -4616,148 +4697,151 @@ namespace isc { namespace dhcp {
   }
 
 
-  const short Dhcp6Parser::yypact_ninf_ = -1019;
+  const short Dhcp6Parser::yypact_ninf_ = -1042;
 
   const signed char Dhcp6Parser::yytable_ninf_ = -1;
 
   const short
   Dhcp6Parser::yypact_[] =
   {
-     536, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019,    67,    33,    85,    92,    94,
-     130,   140,   148,   208,   212,   224,   235,   236,   237,   243,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,    33,  -174,
-      59,   123,    45,   538,   326,   194,   312,    -7,    77,   131,
-     118,   521,    36, -1019,    78,   163,   269,   274,   281, -1019,
-      56, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,   296,
-     300,   306,   310,   316,   333,   338,   353,   374,   375,   377,
-     385, -1019,   387,   404,   414,   416,   417, -1019, -1019, -1019,
-     425, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019,   432, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-     433,   442,   443,   450,   456, -1019,    60, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-     458, -1019,    72, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019,   459,   460, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-      75, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,   462,
-   -1019, -1019, -1019, -1019, -1019,   110, -1019, -1019, -1019, -1019,
-   -1019, -1019,   464, -1019,   465,   466,   467, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019,   121, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019,   394,   390, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019,   403, -1019, -1019,   468, -1019, -1019, -1019,
-     471, -1019, -1019,   470,   481, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,   485,   488,
-   -1019, -1019, -1019, -1019,   477,   491, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019,   125, -1019, -1019, -1019, -1019, -1019, -1019,   492, -1019,
-   -1019,   495, -1019,   496,   498, -1019, -1019,   499,   500, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019,   203, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019,   502,   204, -1019, -1019, -1019, -1019,
-      33,    33, -1019,   294,   504,    59, -1019,   505,   506,   508,
-     511,   512,   513,   308,   313,   319,   321,   323,   330,   336,
-     339,   304,   341,   342,   340,   524,   354,   355,   322,   345,
-     346,   560,   561,   563,   356,   569,   571,   572,   573,   574,
-     576,   577,   589,   590,   591,   592,   600,   601,   605,   606,
-     607,   399,   608,   610,   611,   613,   615,   616,   617,   618,
-     619,   628,   629,   630,   422,   423,   424,   426, -1019,   123,
-   -1019,   632,   429,    45, -1019,   635,   637,   638,   640,   644,
-     436,   435,   649,   651,   652,   653,   538, -1019,   654,   445,
-     326, -1019,   656,   447,   658,   449,   451,   452,   194, -1019,
-     660,   663,   665,   666,   680,   684,   686, -1019,   312, -1019,
-     689,   690,   482,   691,   694,   695,   484, -1019,    77,   706,
-     501,   507, -1019,   131,   707,   708,   710,   711,   712,   -64,
-   -1019,   509,   714,   716,   510,   718,   515,   516,   722,   727,
-     517,   533,   728,   746,   748,   749,   521, -1019,   755,   546,
-      36, -1019, -1019, -1019,   757,   720, -1019,   549,   756,   758,
-     771,   772,   759, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019,   567, -1019, -1019, -1019, -1019,
-   -1019,   180,   568,   580, -1019,   785,   789,   790,   791,   583,
-     347,   792,   794,   795,   796,   797,   798,   800,   801,   804,
-     807, -1019,   810,   811,   812,   813,   594,   595,   816,   815,
-     612,   614,   817,   819, -1019, -1019, -1019, -1019, -1019,   818,
-   -1019, -1019,   824,   825,   620,   621,   622, -1019, -1019,   818,
-     623,   830,   625, -1019,   627, -1019, -1019,   631, -1019,   633,
-   -1019, -1019, -1019, -1019,   818,   818,   818,   634,   636,   639,
-     641, -1019,   642,   643, -1019,   645,   646,   647, -1019, -1019,
-     648, -1019, -1019, -1019,   650,   655,   791,    33,    33, -1019,
-   -1019,   657,   659, -1019,   661, -1019, -1019,  -118,   667, -1019,
-   -1019,   180,   662,   664,   668, -1019,   836, -1019, -1019,    33,
-     123, -1019,    36,    45,   334,   334,   835, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019,   838,   841,   843, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019,   844,   -77,    33,
-     343,   699,   846,   850,   855,   260,    23,    58,     7,   177,
-     521, -1019, -1019,   857,   334, -1019, -1019,   334,    17, -1019,
-   -1019,   858,   859, -1019, -1019, -1019, -1019, -1019,   -59, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019,   835, -1019,   232,   248,   266, -1019, -1019, -1019,
-   -1019,   839,   863,   865,   867,   869, -1019,   872,   874, -1019,
-   -1019, -1019,   875,   876,   878,   879,   880, -1019, -1019, -1019,
-     288, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019,   289, -1019,   881,   882, -1019,
-   -1019,   883,   885, -1019, -1019,   884,   888, -1019, -1019,   886,
-     892, -1019, -1019,   890,   894, -1019, -1019, -1019,   108, -1019,
-   -1019, -1019,   893, -1019, -1019, -1019,   159, -1019, -1019, -1019,
-   -1019,   314, -1019, -1019, -1019,   264, -1019, -1019,   895,   897,
-   -1019, -1019,   896,   900, -1019,   901,   902,   903,   904,   905,
-     906,   318, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019,   907,   908,   909, -1019, -1019, -1019, -1019,   324, -1019,
-   -1019, -1019, -1019, -1019, -1019,   910,   911,   912, -1019,   325,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019,   327, -1019, -1019, -1019,   913, -1019,   914, -1019, -1019,
-   -1019,   331, -1019, -1019, -1019, -1019, -1019,   335, -1019,   295,
-   -1019,   348,   350,   915, -1019, -1019, -1019,   351, -1019, -1019,
-   -1019, -1019,   673, -1019,   898,   917, -1019, -1019,   916,   918,
-   -1019, -1019, -1019,   919, -1019,   920, -1019, -1019, -1019,   921,
-     924,   925,   926,   709,   682,   717,   719,   724,   928,   725,
-     726,   929,   930,   933,   729,   730,   731,   732,   734,   937,
-     938,   334, -1019, -1019,   334, -1019,   835,   538, -1019,   838,
-      77, -1019,   841,   131, -1019,   843,   723, -1019,   844,   -77,
-   -1019, -1019,   343, -1019,   941,   699, -1019,   127,   846, -1019,
-     312, -1019,   850,   118, -1019,   855,   735,   736,   737,   738,
-     739,   740,   260, -1019,   951,   952,   743,   744,   745,    23,
-   -1019,   747,   750,   751,    58, -1019,   956,   957,     7, -1019,
-     752,   958,   753,   966,   177, -1019, -1019,    53,   857, -1019,
-   -1019, -1019,   765,    17, -1019, -1019,   965,   971,   326, -1019,
-     858,   194, -1019,   859,   979, -1019, -1019,   428,   774,   780,
-     781, -1019, -1019, -1019, -1019, -1019,   783, -1019, -1019,   786,
-     802,   806, -1019, -1019, -1019, -1019, -1019,   809,   821, -1019,
-     389, -1019,   392, -1019,   976, -1019,   990, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019,   398, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019,   823, -1019, -1019,   999,
-   -1019, -1019, -1019, -1019, -1019,  1006,  1004, -1019, -1019, -1019,
-   -1019, -1019,  1015, -1019,   401, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019,    62,   833, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019,   834,   849, -1019, -1019,   852, -1019,    33,
-   -1019, -1019,  1024, -1019, -1019, -1019, -1019, -1019,   407, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019,   870,   411, -1019,
-     427, -1019,   891, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019,   723, -1019, -1019,  1027,   827, -1019,   127, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,  1045,
-     854,  1048,    53, -1019, -1019, -1019, -1019, -1019, -1019,   899,
-   -1019, -1019,  1052, -1019,   922, -1019, -1019,  1056, -1019, -1019,
-     305, -1019,   109,  1056, -1019, -1019,  1068,  1090,  1094, -1019,
-     430, -1019, -1019, -1019, -1019, -1019, -1019, -1019,  1099,   889,
-     923,   927,  1103,   109, -1019,   931, -1019, -1019, -1019,   932,
-   -1019, -1019, -1019
+     201, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042,    53,    33,    62,    71,    73,
+      84,    97,   107,   134,   137,   145,   170,   171,   178,   179,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,    33,   -93,
+     203,   135,    41,   538,   359,   229,   155,    63,    80,    89,
+     -84,   582,   108, -1042,   214,   225,   234,   250,   257, -1042,
+      48, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,   266,
+     267,   275,   296,   312,   313,   326,   336,   340,   377,   426,
+     430, -1042,   440,   443,   447,   448,   451, -1042, -1042, -1042,
+     452, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042,   456, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+     466,   467,   474,   480,   481, -1042,    52, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+     488, -1042,    91, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042,   490,   492, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+      95, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,   499,
+   -1042, -1042, -1042, -1042, -1042,   105, -1042, -1042, -1042, -1042,
+   -1042, -1042,   500, -1042,   508,   509,   511, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042,   121, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042,   279,   305, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042,   343, -1042, -1042,   512, -1042, -1042, -1042,
+     513, -1042, -1042,   363,   329, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,   516,   518,
+   -1042, -1042, -1042, -1042,   415,   361, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042,   131, -1042, -1042, -1042, -1042, -1042, -1042,   519, -1042,
+   -1042,   521, -1042,   523,   524, -1042, -1042,   527,   528, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042,   140, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042,   529,   148, -1042, -1042, -1042, -1042,
+      33,    33, -1042,   268,   531,   203, -1042,   533,   534,   535,
+     540,   543,   546,   335,   342,   346,   350,   351,   353,   365,
+     366,   332,   355,   378,   380,   561,   381,   382,   352,   388,
+     389,   563,   565,   585,   391,   612,   613,   614,   615,   616,
+     617,   618,   619,   621,   623,   624,   625,   626,   627,   636,
+     637,   420,   639,   640,   641,   642,   643,   644,   646,   649,
+     652,   653,   654,   655,   439,   441,   442,   444, -1042,   135,
+   -1042,   657,   445,    41, -1042,   661,   663,   666,   667,   668,
+     453,   449,   670,   674,   675,   676,   538, -1042,   677,   460,
+     359, -1042,   679,   462,   684,   468,   469,   470,   229, -1042,
+     689,   690,   691,   692,   694,   695,   696, -1042,   155, -1042,
+     702,   703,   489,   706,   708,   710,   491, -1042,    80,   714,
+     495,   496, -1042,    89,   718,   719,   720,   721,   722,   -44,
+   -1042,   504,   725,   727,   510,   729,   514,   515,   730,   731,
+     539,   541,   734,   735,   749,   758,   582, -1042,   760,   556,
+     108, -1042, -1042, -1042,   775,   773, -1042,   560,   783,   786,
+     787,   788,   791, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042,   576, -1042, -1042, -1042, -1042,
+   -1042,   119,   577,   578, -1042,   795,   796,   797,   798,   583,
+     334,   801,   802,   803,   806,   807,   812,   813,   814,   815,
+     816, -1042,   817,   818,   819,   820,   599,   600,   824,   823,
+     611,   620,   826,   827, -1042, -1042, -1042, -1042, -1042,   830,
+   -1042, -1042,   831,   832,   622,   628,   629, -1042, -1042,   830,
+     630,   833,   631, -1042,   632, -1042, -1042,   633, -1042,   634,
+   -1042, -1042, -1042, -1042,   830,   830,   830,   635,   638,   645,
+     647, -1042,   648,   650, -1042,   651,   656,   658, -1042, -1042,
+     659, -1042, -1042, -1042,   660,   662,   798,    33,    33, -1042,
+   -1042,   664,   665, -1042,   669, -1042, -1042,   -10,   671, -1042,
+   -1042,   119,   678,   680,   681, -1042,   837, -1042, -1042,    33,
+     135, -1042,   108,    41,   356,   356,   838, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042,   839,   840,   841, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042,   850,   -81,    33,
+     379,   747,   853,   854,   855,   450,    38,    78,   -45,   128,
+     582, -1042, -1042,   856,   356, -1042, -1042,   356,   138, -1042,
+   -1042,   857,   858, -1042, -1042, -1042, -1042, -1042,   -43, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042,   838, -1042,   211,   231,   232, -1042, -1042, -1042,
+   -1042,   834,   863,   866,   869,   870, -1042,   871,   872, -1042,
+   -1042, -1042,   874,   878,   880,   883,   884, -1042,   885,   887,
+     888,   891,   892,   893,   894, -1042, -1042, -1042,   243, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042,   245, -1042,   897,   901, -1042, -1042,   899,   903, -1042,
+   -1042,   902,   904, -1042, -1042,   905,   906, -1042, -1042,   907,
+     909, -1042, -1042, -1042,   139, -1042, -1042, -1042,   908, -1042,
+   -1042, -1042,   218, -1042, -1042, -1042, -1042,   283, -1042, -1042,
+   -1042,   328, -1042, -1042,   910,   912, -1042, -1042,   911,   915,
+   -1042,   896,   916,   917,   918,   919,   920,   294, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042,   921,   922,   923,
+   -1042, -1042, -1042, -1042,   295, -1042, -1042, -1042, -1042, -1042,
+   -1042,   924,   925,   926, -1042,   301, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042,   303, -1042, -1042,
+   -1042,   927, -1042,   928, -1042, -1042, -1042,   304, -1042, -1042,
+   -1042, -1042, -1042,   338, -1042,   354, -1042,   344,   345,   929,
+   -1042, -1042, -1042,   347, -1042, -1042, -1042, -1042,   698, -1042,
+     931,   932, -1042, -1042,   933,   935, -1042, -1042, -1042,   934,
+   -1042,   937, -1042, -1042, -1042,   930,   936,   940,   941,   688,
+     717,   724,   723,   726,   945,   728,   732,   947,   948,   949,
+     733,   736,   737,   738,   739,   952,   740,   741,   742,   743,
+     744,   745,   748,   953,   955,   356, -1042, -1042,   356, -1042,
+     838,   538, -1042,   839,    80, -1042,   840,    89, -1042,   841,
+     715, -1042,   850,   -81, -1042, -1042,   379, -1042,   962,   747,
+   -1042,    16,   853, -1042,   155, -1042,   854,   -84, -1042,   855,
+     750,   751,   752,   753,   754,   755,   450, -1042,   967,   974,
+     757,   759,   761,    38, -1042,   756,   762,   763,    78, -1042,
+     978,   982,   -45, -1042,   764,   983,   767,   987,   128, -1042,
+   -1042,   285,   856, -1042, -1042, -1042,   768,   138, -1042, -1042,
+     988,   992,   359, -1042,   857,   229, -1042,   858,   994, -1042,
+   -1042,   485,   784,   790,   799, -1042, -1042, -1042, -1042, -1042,
+     810, -1042, -1042,   822,   825,   846, -1042, -1042, -1042, -1042,
+   -1042,   849, -1042, -1042, -1042, -1042, -1042, -1042, -1042,   852,
+     860, -1042,   358, -1042,   360, -1042,   999, -1042,  1000, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,   364,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,   865, -1042,
+   -1042,  1013, -1042, -1042, -1042, -1042, -1042,  1010,  1019, -1042,
+   -1042, -1042, -1042, -1042,  1015, -1042,   367, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042,   324,   868, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042,   875,   886, -1042, -1042,   913,
+   -1042,    33, -1042, -1042,  1023, -1042, -1042, -1042, -1042, -1042,
+     370, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,   914,
+     419, -1042,   421, -1042,   938, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042,   715, -1042, -1042,  1034,   828, -1042,
+      16, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042,  1035,   836,  1043,   285, -1042, -1042, -1042, -1042,
+   -1042, -1042,   939, -1042, -1042,  1050, -1042,   942, -1042, -1042,
+    1053, -1042, -1042,   437, -1042,    30,  1053, -1042, -1042,  1067,
+    1072,  1083, -1042,   423, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042,  1088,   898,   943,   944,  1114,    30, -1042,   946, -1042,
+   -1042, -1042,   950, -1042, -1042, -1042
   };
 
   const short
@@ -4767,17 +4851,17 @@ namespace isc { namespace dhcp {
       20,    22,    24,    26,    28,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        1,    45,    38,    34,    33,    30,    31,    32,    37,     3,
-      35,    36,    58,     5,    65,     7,   170,     9,   340,    11,
-     519,    13,   546,    15,   578,    17,   444,    19,   452,    21,
-     489,    23,   300,    25,   700,    27,   750,    29,    47,    41,
-       0,     0,     0,     0,     0,     0,   580,     0,   454,   491,
+      35,    36,    58,     5,    65,     7,   170,     9,   357,    11,
+     536,    13,   563,    15,   595,    17,   461,    19,   469,    21,
+     506,    23,   317,    25,   717,    27,   767,    29,    47,    41,
+       0,     0,     0,     0,     0,     0,   597,     0,   471,   508,
        0,     0,     0,    49,     0,    48,     0,     0,    42,    63,
-       0,    60,    62,   131,   748,   168,   182,   184,   186,     0,
+       0,    60,    62,   131,   765,   168,   182,   184,   186,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,   166,     0,     0,     0,     0,     0,   148,   155,   157,
-       0,   332,   442,   481,   534,   536,   391,   399,   260,   277,
-     268,   253,   615,   570,   292,   316,   636,     0,   279,   660,
-     682,   698,   159,   161,   759,   799,   801,   803,   807,   812,
+       0,   349,   459,   498,   551,   553,   408,   416,   277,   294,
+     285,   261,   632,   587,   309,   333,   653,     0,   296,   677,
+     699,   715,   159,   161,   776,   816,   818,   820,   824,   829,
        0,     0,     0,     0,     0,   130,     0,    67,    69,    70,
       71,    72,    73,    74,    75,    76,    77,   105,   106,   107,
       78,   111,   112,   113,   114,   115,   116,   109,   110,   117,
@@ -4785,27 +4869,27 @@ namespace isc { namespace dhcp {
       86,   120,    91,    92,    79,   104,    80,    89,    90,    98,
       99,   101,    88,    93,    94,    95,    96,    97,   102,   108,
      121,   122,   123,   124,   125,   126,   127,   128,   129,   179,
-       0,   178,     0,   172,   174,   175,   176,   177,   511,   538,
-     381,   383,   385,     0,     0,   389,   387,   609,   797,   380,
-     344,   345,   346,   347,   348,   349,   350,   351,   367,   368,
-     369,   372,   373,   374,   375,   376,   377,   370,   371,   378,
-       0,   342,   355,   356,   357,   360,   361,   363,   358,   359,
-     352,   353,   365,   366,   354,   362,   364,   379,   532,     0,
-     531,   525,   526,   529,   524,     0,   521,   523,   527,   528,
-     530,   563,     0,   566,     0,     0,     0,   562,   554,   555,
-     560,   553,   558,   559,     0,   548,   550,   551,   556,   557,
-     552,   561,   607,   595,   597,   599,   601,   603,   605,   594,
-     591,   592,   593,     0,   581,   582,   586,   587,   584,   588,
-     589,   590,   585,     0,   471,   233,     0,   475,   473,   478,
-       0,   467,   468,     0,   455,   456,   458,   470,   459,   460,
-     461,   477,   462,   463,   464,   465,   466,   505,     0,     0,
-     503,   504,   507,   508,     0,   492,   493,   495,   496,   497,
-     498,   499,   500,   501,   502,   310,   312,   314,   805,   816,
-     304,     0,   302,   305,   306,   307,   308,   309,     0,   723,
-     725,     0,   728,     0,     0,   732,   736,     0,     0,   740,
-     742,   744,   746,   721,   719,   720,     0,   702,   704,   705,
-     706,   707,   708,   709,   710,   711,   712,   713,   714,   715,
-     716,   717,   718,   756,     0,     0,   752,   754,   755,    46,
+       0,   178,     0,   172,   174,   175,   176,   177,   528,   555,
+     398,   400,   402,     0,     0,   406,   404,   626,   814,   397,
+     361,   362,   363,   364,   365,   366,   367,   368,   384,   385,
+     386,   389,   390,   391,   392,   393,   394,   387,   388,   395,
+       0,   359,   372,   373,   374,   377,   378,   380,   375,   376,
+     369,   370,   382,   383,   371,   379,   381,   396,   549,     0,
+     548,   542,   543,   546,   541,     0,   538,   540,   544,   545,
+     547,   580,     0,   583,     0,     0,     0,   579,   571,   572,
+     577,   570,   575,   576,     0,   565,   567,   568,   573,   574,
+     569,   578,   624,   612,   614,   616,   618,   620,   622,   611,
+     608,   609,   610,     0,   598,   599,   603,   604,   601,   605,
+     606,   607,   602,     0,   488,   241,     0,   492,   490,   495,
+       0,   484,   485,     0,   472,   473,   475,   487,   476,   477,
+     478,   494,   479,   480,   481,   482,   483,   522,     0,     0,
+     520,   521,   524,   525,     0,   509,   510,   512,   513,   514,
+     515,   516,   517,   518,   519,   327,   329,   331,   822,   833,
+     321,     0,   319,   322,   323,   324,   325,   326,     0,   740,
+     742,     0,   745,     0,     0,   749,   753,     0,     0,   757,
+     759,   761,   763,   738,   736,   737,     0,   719,   721,   722,
+     723,   724,   725,   726,   727,   728,   729,   730,   731,   732,
+     733,   734,   735,   773,     0,     0,   769,   771,   772,    46,
        0,     0,    39,     0,     0,     0,    59,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
@@ -4814,141 +4898,145 @@ namespace isc { namespace dhcp {
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,    57,     0,
       66,     0,     0,     0,   171,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   341,     0,     0,
-       0,   520,     0,     0,     0,     0,     0,     0,     0,   547,
-       0,     0,     0,     0,     0,     0,     0,   579,     0,   445,
-       0,     0,     0,     0,     0,     0,     0,   453,     0,     0,
-       0,     0,   490,     0,     0,     0,     0,     0,     0,     0,
-     301,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   701,     0,     0,
-       0,   751,    50,    43,     0,     0,    61,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   358,     0,     0,
+       0,   537,     0,     0,     0,     0,     0,     0,     0,   564,
+       0,     0,     0,     0,     0,     0,     0,   596,     0,   462,
+       0,     0,     0,     0,     0,     0,     0,   470,     0,     0,
+       0,     0,   507,     0,     0,     0,     0,     0,     0,     0,
+     318,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   718,     0,     0,
+       0,   768,    50,    43,     0,     0,    61,     0,     0,     0,
        0,     0,     0,   133,   134,   135,   136,   137,   138,   139,
      140,   141,   142,   143,   144,     0,   164,   165,   145,   146,
      147,     0,     0,     0,   163,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   659,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   814,   815,   818,   819,    68,     0,
-     181,   173,     0,     0,     0,     0,     0,   397,   398,     0,
-       0,     0,     0,   343,     0,   809,   522,     0,   565,     0,
-     568,   569,   810,   549,     0,     0,     0,     0,     0,     0,
-       0,   583,     0,     0,   469,     0,     0,     0,   480,   457,
-       0,   509,   510,   494,     0,     0,     0,     0,     0,   303,
-     722,     0,     0,   727,     0,   730,   731,     0,     0,   738,
-     739,     0,     0,     0,     0,   703,     0,   758,   753,     0,
+       0,   676,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   831,   832,   835,   836,    68,     0,
+     181,   173,     0,     0,     0,     0,     0,   414,   415,     0,
+       0,     0,     0,   360,     0,   826,   539,     0,   582,     0,
+     585,   586,   827,   566,     0,     0,     0,     0,     0,     0,
+       0,   600,     0,     0,   486,     0,     0,     0,   497,   474,
+       0,   526,   527,   511,     0,     0,     0,     0,     0,   320,
+     739,     0,     0,   744,     0,   747,   748,     0,     0,   755,
+     756,     0,     0,     0,     0,   720,     0,   775,   770,     0,
        0,   132,     0,     0,     0,     0,   188,   167,   150,   151,
-     152,   153,   154,   149,   156,   158,   334,   446,   483,    40,
-     535,   537,   393,   394,   395,   396,   392,   401,     0,    47,
-       0,     0,     0,   572,   294,     0,     0,     0,     0,     0,
-       0,   160,   162,     0,     0,   802,   804,     0,     0,    51,
-     180,   513,   540,   382,   384,   386,   390,   388,     0,   798,
-     533,   564,   567,   608,   596,   598,   600,   602,   604,   606,
-     472,   234,   476,   474,   479,   506,   311,   313,   315,   806,
-     817,   724,   726,   729,   734,   735,   733,   737,   741,   743,
-     745,   747,   188,    44,     0,     0,     0,   220,   226,   228,
-     230,     0,     0,     0,     0,     0,   244,     0,     0,   247,
-     249,   251,     0,     0,     0,     0,     0,   820,   822,   219,
-       0,   194,   196,   197,   198,   199,   200,   201,   202,   203,
-     204,   205,   208,   215,   209,   210,   211,   206,   207,   212,
-     213,   214,   216,   217,   218,     0,   192,     0,   189,   190,
-     338,     0,   335,   336,   450,     0,   447,   448,   487,     0,
-     484,   485,   405,     0,   402,   403,   266,   267,     0,   262,
-     264,   265,     0,   275,   276,   272,     0,   270,   273,   274,
-     258,     0,   255,   257,   619,     0,   617,   576,     0,   573,
-     574,   298,     0,   295,   296,     0,     0,     0,     0,     0,
-       0,     0,   318,   320,   321,   322,   323,   324,   325,   649,
-     655,     0,     0,     0,   648,   645,   646,   647,     0,   638,
-     640,   643,   641,   642,   644,     0,     0,     0,   288,     0,
-     281,   283,   284,   285,   286,   287,   677,   679,   668,   666,
-     667,     0,   662,   664,   665,     0,   693,     0,   696,   689,
-     690,     0,   684,   686,   687,   688,   691,     0,   763,     0,
-     761,     0,     0,     0,   676,   673,   674,     0,   669,   671,
-     672,   675,    53,   517,     0,   514,   515,   544,     0,   541,
-     542,   613,   612,     0,   611,     0,    64,   749,   169,     0,
+     152,   153,   154,   149,   156,   158,   351,   463,   500,    40,
+     552,   554,   410,   411,   412,   413,   409,   418,     0,    47,
+       0,     0,     0,   589,   311,     0,     0,     0,     0,     0,
+       0,   160,   162,     0,     0,   819,   821,     0,     0,    51,
+     180,   530,   557,   399,   401,   403,   407,   405,     0,   815,
+     550,   581,   584,   625,   613,   615,   617,   619,   621,   623,
+     489,   242,   493,   491,   496,   523,   328,   330,   332,   823,
+     834,   741,   743,   746,   751,   752,   750,   754,   758,   760,
+     762,   764,   188,    44,     0,     0,     0,   228,   234,   236,
+     238,     0,     0,     0,     0,     0,   252,     0,     0,   255,
+     257,   259,     0,     0,     0,     0,     0,   264,     0,     0,
+       0,     0,     0,     0,     0,   837,   839,   227,     0,   194,
+     196,   197,   198,   199,   200,   201,   202,   203,   204,   205,
+     208,   215,   209,   210,   211,   206,   207,   212,   213,   214,
+     219,   220,   221,   222,   223,   224,   225,   226,   216,   217,
+     218,     0,   192,     0,   189,   190,   355,     0,   352,   353,
+     467,     0,   464,   465,   504,     0,   501,   502,   422,     0,
+     419,   420,   283,   284,     0,   279,   281,   282,     0,   292,
+     293,   289,     0,   287,   290,   291,   275,     0,   272,   274,
+     636,     0,   634,   593,     0,   590,   591,   315,     0,   312,
+     313,     0,     0,     0,     0,     0,     0,     0,   335,   337,
+     338,   339,   340,   341,   342,   666,   672,     0,     0,     0,
+     665,   662,   663,   664,     0,   655,   657,   660,   658,   659,
+     661,     0,     0,     0,   305,     0,   298,   300,   301,   302,
+     303,   304,   694,   696,   685,   683,   684,     0,   679,   681,
+     682,     0,   710,     0,   713,   706,   707,     0,   701,   703,
+     704,   705,   708,     0,   780,     0,   778,     0,     0,     0,
+     693,   690,   691,     0,   686,   688,   689,   692,    53,   534,
+       0,   531,   532,   561,     0,   558,   559,   630,   629,     0,
+     628,     0,    64,   766,   169,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   183,   185,     0,   187,     0,     0,   333,     0,
-     454,   443,     0,   491,   482,     0,     0,   400,     0,     0,
-     261,   278,     0,   269,     0,     0,   254,   621,     0,   616,
-     580,   571,     0,     0,   293,     0,     0,     0,     0,     0,
-       0,     0,     0,   317,     0,     0,     0,     0,     0,     0,
-     637,     0,     0,     0,     0,   280,     0,     0,     0,   661,
-       0,     0,     0,     0,     0,   683,   699,     0,     0,   760,
-     800,   808,     0,     0,   813,    55,     0,    54,     0,   512,
-       0,     0,   539,     0,     0,   610,   757,     0,     0,     0,
-       0,   232,   235,   236,   237,   238,     0,   246,   239,     0,
-       0,     0,   241,   242,   243,   240,   811,     0,     0,   195,
-       0,   191,     0,   337,     0,   449,     0,   486,   441,   420,
-     421,   422,   424,   425,   426,   413,   414,   429,   430,   431,
-     434,   435,   436,   437,   438,   439,   432,   433,   440,   409,
-     410,   411,   412,   418,   419,   417,   423,     0,   407,   415,
-     427,   428,   416,   404,   263,   271,     0,   256,   633,     0,
-     631,   632,   628,   629,   630,     0,   622,   623,   625,   626,
-     627,   618,     0,   575,     0,   297,   326,   327,   328,   329,
-     330,   331,   319,     0,     0,   654,   657,   658,   639,   289,
-     290,   291,   282,     0,     0,   663,   692,     0,   695,     0,
-     685,   777,     0,   775,   773,   767,   771,   772,     0,   765,
-     769,   770,   768,   762,   681,   670,    52,     0,     0,   516,
-       0,   543,     0,   222,   223,   224,   225,   221,   227,   229,
-     231,   245,   248,   250,   252,   821,   823,   193,   339,   451,
-     488,     0,   406,   259,     0,     0,   620,     0,   577,   299,
-     651,   652,   653,   650,   656,   678,   680,   694,   697,     0,
-       0,     0,     0,   764,    56,   518,   545,   614,   408,     0,
-     635,   624,     0,   774,     0,   766,   634,     0,   776,   781,
-       0,   779,     0,     0,   778,   790,     0,     0,     0,   795,
-       0,   783,   785,   786,   787,   788,   789,   780,     0,     0,
-       0,     0,     0,     0,   782,     0,   792,   793,   794,     0,
-     784,   791,   796
+       0,     0,     0,     0,     0,     0,   183,   185,     0,   187,
+       0,     0,   350,     0,   471,   460,     0,   508,   499,     0,
+       0,   417,     0,     0,   278,   295,     0,   286,     0,     0,
+     262,   638,     0,   633,   597,   588,     0,     0,   310,     0,
+       0,     0,     0,     0,     0,     0,     0,   334,     0,     0,
+       0,     0,     0,     0,   654,     0,     0,     0,     0,   297,
+       0,     0,     0,   678,     0,     0,     0,     0,     0,   700,
+     716,     0,     0,   777,   817,   825,     0,     0,   830,    55,
+       0,    54,     0,   529,     0,     0,   556,     0,     0,   627,
+     774,     0,     0,     0,     0,   240,   243,   244,   245,   246,
+       0,   254,   247,     0,     0,     0,   249,   250,   251,   248,
+     263,     0,   266,   267,   268,   269,   270,   271,   828,     0,
+       0,   195,     0,   191,     0,   354,     0,   466,     0,   503,
+     458,   437,   438,   439,   441,   442,   443,   430,   431,   446,
+     447,   448,   451,   452,   453,   454,   455,   456,   449,   450,
+     457,   426,   427,   428,   429,   435,   436,   434,   440,     0,
+     424,   432,   444,   445,   433,   421,   280,   288,     0,   273,
+     650,     0,   648,   649,   645,   646,   647,     0,   639,   640,
+     642,   643,   644,   635,     0,   592,     0,   314,   343,   344,
+     345,   346,   347,   348,   336,     0,     0,   671,   674,   675,
+     656,   306,   307,   308,   299,     0,     0,   680,   709,     0,
+     712,     0,   702,   794,     0,   792,   790,   784,   788,   789,
+       0,   782,   786,   787,   785,   779,   698,   687,    52,     0,
+       0,   533,     0,   560,     0,   230,   231,   232,   233,   229,
+     235,   237,   239,   253,   256,   258,   260,   265,   838,   840,
+     193,   356,   468,   505,     0,   423,   276,     0,     0,   637,
+       0,   594,   316,   668,   669,   670,   667,   673,   695,   697,
+     711,   714,     0,     0,     0,     0,   781,    56,   535,   562,
+     631,   425,     0,   652,   641,     0,   791,     0,   783,   651,
+       0,   793,   798,     0,   796,     0,     0,   795,   807,     0,
+       0,     0,   812,     0,   800,   802,   803,   804,   805,   806,
+     797,     0,     0,     0,     0,     0,     0,   799,     0,   809,
+     810,   811,     0,   801,   808,   813
   };
 
   const short
   Dhcp6Parser::yypgoto_[] =
   {
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019,     9, -1019,  -577, -1019,
-     228, -1019, -1019, -1019, -1019,   359, -1019,  -568, -1019, -1019,
-   -1019,   -71, -1019, -1019, -1019,   675, -1019, -1019, -1019, -1019,
-     391,   624, -1019, -1019,   -42,   -40,   -37,   -36,   -26,   -25,
-     -21,   -19,     8,    13,    24, -1019,    27,    29,    32,    39,
-   -1019,   402,    42, -1019,    43, -1019,    44, -1019,    47, -1019,
-      50, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,   393,
-     669, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-     302, -1019,    79, -1019,  -682,    86, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019,   -67, -1019,  -734, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,    63,
-   -1019, -1019, -1019, -1019, -1019,    70,  -723, -1019, -1019, -1019,
-   -1019,    68, -1019, -1019, -1019, -1019, -1019, -1019, -1019,    37,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019,    61, -1019, -1019,
-   -1019,    64,   565, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019,    66, -1019, -1019, -1019, -1019, -1019, -1019, -1018,
-   -1019, -1019, -1019,    89, -1019, -1019, -1019,    93,   626, -1019,
-   -1019, -1017, -1019, -1016, -1019,    21, -1019,    51, -1019,    54,
-   -1019, -1019,    -9, -1014, -1019, -1019, -1019, -1019,    83, -1019,
-   -1019,  -138,  1057, -1019, -1019, -1019, -1019, -1019,    97, -1019,
-   -1019, -1019,    96, -1019,   598, -1019,   -66, -1019, -1019, -1019,
-   -1019, -1019,   -65, -1019, -1019, -1019, -1019, -1019,    14, -1019,
-   -1019, -1019,    95, -1019, -1019, -1019,   100, -1019,   596, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-      38, -1019, -1019, -1019,    46,   670, -1019, -1019,   -55, -1019,
-      -2, -1019, -1019, -1019, -1019, -1019,    34, -1019, -1019, -1019,
-      40,   671, -1019, -1019, -1019, -1019, -1019, -1019, -1019,   -57,
-   -1019, -1019, -1019,    88, -1019, -1019, -1019,    98, -1019,   674,
-     378, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1012, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019,    99, -1019, -1019, -1019,  -125, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019,    74, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019,    73, -1019,    52,
-    -762, -1019,  -753, -1019, -1019, -1019, -1019, -1019,    69, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,   400,
-     588, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-     444,   585, -1019, -1019, -1019, -1019, -1019, -1019,    71, -1019,
-   -1019,  -124, -1019, -1019, -1019, -1019, -1019, -1019,  -146, -1019,
-   -1019,  -163, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019, -1019,
-   -1019, -1019, -1019, -1019, -1019, -1019
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042,    11, -1042,  -577, -1042,
+     431, -1042, -1042, -1042, -1042,   383, -1042,  -613, -1042, -1042,
+   -1042,   -71, -1042, -1042, -1042,   693, -1042, -1042, -1042, -1042,
+     409,   673, -1042, -1042,   -42,   -40,   -37,   -36,   -26,   -25,
+     -21,   -19,     8,    13,    24, -1042,    27,    29,    32,    39,
+   -1042,   425,    42, -1042,    43, -1042,    44, -1042,    47, -1042,
+      50, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,   408,
+     672, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+     325, -1042,    79, -1042,  -700,    83, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042,   -67, -1042,  -734, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,    61, -1042,
+   -1042, -1042, -1042, -1042,    68,  -722, -1042, -1042, -1042, -1042,
+      66, -1042, -1042, -1042, -1042, -1042, -1042, -1042,    35, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042,    55, -1042, -1042, -1042,
+      58,   588, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042,    56, -1042, -1042, -1042, -1042, -1042, -1042, -1041, -1042,
+   -1042, -1042,    85, -1042, -1042, -1042,    90,   682, -1042, -1042,
+   -1040, -1042, -1038, -1042,    21, -1042,    51, -1042,    54, -1042,
+   -1042,    -9, -1036, -1042, -1042, -1042, -1042,    82, -1042, -1042,
+    -154,  1078, -1042, -1042, -1042, -1042, -1042,    92, -1042, -1042,
+   -1042,    93, -1042,   683, -1042,   -66, -1042, -1042, -1042, -1042,
+   -1042,   -65, -1042, -1042, -1042, -1042, -1042,    14, -1042, -1042,
+   -1042,    99, -1042, -1042, -1042,    94, -1042,   609, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,    36,
+   -1042, -1042, -1042,    37,   685, -1042, -1042,   -55, -1042,    -2,
+   -1042, -1042, -1042, -1042, -1042,    40, -1042, -1042, -1042,    45,
+     686, -1042, -1042, -1042, -1042, -1042, -1042, -1042,   -57, -1042,
+   -1042, -1042,    87, -1042, -1042, -1042,    98, -1042,   687,   386,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1035, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042,    96, -1042, -1042, -1042,  -136, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042,    76, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042,    64, -1042,    57,  -762,
+   -1042,  -753, -1042, -1042, -1042, -1042, -1042,    67, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,   427,   605,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,   471,
+     608, -1042, -1042, -1042, -1042, -1042, -1042,    69, -1042, -1042,
+    -135, -1042, -1042, -1042, -1042, -1042, -1042,  -157, -1042, -1042,
+    -174, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042, -1042,
+   -1042, -1042, -1042, -1042, -1042
   };
 
   const short
@@ -4956,188 +5044,192 @@ namespace isc { namespace dhcp {
   {
       -1,    15,    16,    17,    18,    19,    20,    21,    22,    23,
       24,    25,    26,    27,    28,    29,    83,    39,    40,    69,
-     740,    87,    88,    41,    68,    84,    85,   770,   992,  1106,
-    1107,   839,    43,    70,    90,    91,    92,   434,    45,    71,
+     740,    87,    88,    41,    68,    84,    85,   770,  1008,  1130,
+    1131,   847,    43,    70,    90,    91,    92,   434,    45,    71,
      156,   157,   158,   437,   159,   160,   161,   162,   163,   164,
      165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
      461,   733,   175,   462,   176,   463,   177,   486,   178,   487,
      179,   180,   181,   182,   455,   183,   439,    47,    72,   222,
      223,   224,   501,   225,   184,   440,   185,   441,   186,   442,
-     867,   868,   869,  1034,   840,   841,   842,  1009,  1257,   843,
-    1010,   844,  1011,   845,  1012,   846,   847,   541,   848,   849,
-     850,   851,   852,   853,   854,   855,   856,   857,  1018,   858,
-     859,  1021,   860,  1022,   861,  1023,   187,   475,   901,   902,
-     903,  1054,   188,   472,   888,   889,   890,   891,   189,   474,
-     896,   897,   898,   899,   190,   473,   191,   482,   949,   950,
-     951,   952,   953,   192,   478,   912,   913,   914,  1063,    63,
-      80,   381,   382,   383,   554,   384,   555,   385,   556,   193,
-     479,   921,   922,   923,   924,   925,   926,   927,   928,   194,
-     465,   871,   872,   873,  1037,    49,    73,   260,   261,   262,
-     507,   263,   508,   264,   509,   265,   513,   266,   512,   195,
-     470,   746,   268,   269,   196,   471,   883,   884,   885,  1046,
-    1177,  1178,   197,   466,    57,    77,   875,   876,   877,  1040,
-      59,    78,   343,   344,   345,   346,   347,   348,   349,   540,
-     350,   544,   351,   543,   352,   353,   545,   354,   198,   467,
-     879,   880,   881,  1043,    61,    79,   364,   365,   366,   367,
-     368,   549,   369,   370,   371,   372,   271,   505,   994,   995,
-     996,  1108,    51,    74,   285,   286,   287,   518,   199,   468,
-     200,   469,   274,   506,   998,   999,  1000,  1111,    53,    75,
-     304,   305,   306,   522,   307,   308,   524,   309,   310,   201,
-     477,   908,   909,   910,  1060,    55,    76,   323,   324,   325,
-     326,   531,   327,   532,   328,   533,   329,   534,   330,   535,
-     331,   536,   332,   530,   276,   514,  1003,  1004,  1114,   202,
-     476,   905,   906,  1057,  1195,  1196,  1197,  1198,  1199,  1274,
-    1200,   203,   480,   938,   939,   940,  1074,  1283,   941,   942,
-    1075,   943,   944,   204,   205,   483,   961,   962,   987,   988,
-     963,  1086,   964,  1087,   991,   206,   484,   971,   972,   973,
-     974,  1091,   975,   976,  1093,   207,   485,    65,    81,   406,
-     407,   408,   409,   562,   410,   563,   411,   412,   565,   413,
-     414,   415,   568,   806,   416,   569,   417,   418,   419,   572,
-     420,   573,   421,   574,   422,   575,   208,   438,    67,    82,
-     425,   426,   427,   578,   428,   209,   488,   979,   980,  1097,
-    1238,  1239,  1240,  1241,  1291,  1242,  1289,  1310,  1311,  1312,
-    1320,  1321,  1322,  1328,  1323,  1324,  1325,  1326,  1332,   277,
-     515,   210,   489,   211,   490,   212,   491,   386,   557,   213,
-     492,   290,   311,   862,   214,   493,   215,   216,   387,   558,
-     217,   218,   863,  1029,   864,  1030
+     883,   884,   885,  1058,   848,   849,   850,  1025,  1289,   851,
+    1026,   852,  1027,   853,  1028,   854,   855,   541,   856,   857,
+     858,   859,   860,   861,   862,   863,   864,   865,  1034,   866,
+     867,  1037,   868,  1038,   869,  1039,   187,   475,   870,   871,
+    1045,   872,   873,   874,   875,   876,   877,   917,   918,   919,
+    1078,   188,   472,   904,   905,   906,   907,   189,   474,   912,
+     913,   914,   915,   190,   473,   191,   482,   965,   966,   967,
+     968,   969,   192,   478,   928,   929,   930,  1087,    63,    80,
+     381,   382,   383,   554,   384,   555,   385,   556,   193,   479,
+     937,   938,   939,   940,   941,   942,   943,   944,   194,   465,
+     887,   888,   889,  1061,    49,    73,   260,   261,   262,   507,
+     263,   508,   264,   509,   265,   513,   266,   512,   195,   470,
+     746,   268,   269,   196,   471,   899,   900,   901,  1070,  1209,
+    1210,   197,   466,    57,    77,   891,   892,   893,  1064,    59,
+      78,   343,   344,   345,   346,   347,   348,   349,   540,   350,
+     544,   351,   543,   352,   353,   545,   354,   198,   467,   895,
+     896,   897,  1067,    61,    79,   364,   365,   366,   367,   368,
+     549,   369,   370,   371,   372,   271,   505,  1010,  1011,  1012,
+    1132,    51,    74,   285,   286,   287,   518,   199,   468,   200,
+     469,   274,   506,  1014,  1015,  1016,  1135,    53,    75,   304,
+     305,   306,   522,   307,   308,   524,   309,   310,   201,   477,
+     924,   925,   926,  1084,    55,    76,   323,   324,   325,   326,
+     531,   327,   532,   328,   533,   329,   534,   330,   535,   331,
+     536,   332,   530,   276,   514,  1019,  1020,  1138,   202,   476,
+     921,   922,  1081,  1227,  1228,  1229,  1230,  1231,  1307,  1232,
+     203,   480,   954,   955,   956,  1098,  1316,   957,   958,  1099,
+     959,   960,   204,   205,   483,   977,   978,  1003,  1004,   979,
+    1110,   980,  1111,  1007,   206,   484,   987,   988,   989,   990,
+    1115,   991,   992,  1117,   207,   485,    65,    81,   406,   407,
+     408,   409,   562,   410,   563,   411,   412,   565,   413,   414,
+     415,   568,   806,   416,   569,   417,   418,   419,   572,   420,
+     573,   421,   574,   422,   575,   208,   438,    67,    82,   425,
+     426,   427,   578,   428,   209,   488,   995,   996,  1121,  1270,
+    1271,  1272,  1273,  1324,  1274,  1322,  1343,  1344,  1345,  1353,
+    1354,  1355,  1361,  1356,  1357,  1358,  1359,  1365,   277,   515,
+     210,   489,   211,   490,   212,   491,   386,   557,   213,   492,
+     290,   311,   878,   214,   493,   215,   216,   387,   558,   217,
+     218,   879,  1053,   880,  1054
   };
 
   const short
   Dhcp6Parser::yytable_[] =
   {
-     155,   221,   239,   280,   297,   319,   989,   341,   360,   380,
-     403,   342,   361,   362,   363,   990,   275,   226,   272,   288,
-     302,   321,   935,   355,   373,    38,   404,   895,  1170,  1171,
-    1172,   240,  1176,   241,  1182,   886,   242,   243,    31,    86,
-      32,   739,    33,   865,   929,   804,   805,   244,   245,   423,
-     424,   313,   246,   822,   247,   375,   376,   377,  1001,   435,
-     122,   219,   220,   499,   436,   283,   300,    30,   500,    89,
-     227,   273,   289,   303,   322,   503,   356,   374,   516,   405,
-     504,   248,   981,   517,   429,   982,   249,   270,   284,   301,
-     320,   776,    42,   124,   125,   281,   298,   250,   334,    44,
-     251,    46,   252,   124,   125,   253,   783,   784,   785,   124,
-     125,  1049,   254,   520,  1050,   255,   256,   257,   521,   739,
-     258,   378,   335,   259,   528,   282,   299,   267,   559,   529,
-     379,   124,   125,   560,    93,    94,   887,    48,    95,   124,
-     125,    96,    97,    98,   124,   125,   335,    50,   336,   337,
-     956,   957,   338,   339,   340,    52,   930,   931,   932,   933,
-     956,   957,  1052,   124,   125,  1053,   430,    99,   100,   101,
+     155,   221,   239,   280,   297,   319,  1005,   341,   360,   380,
+     403,   342,   361,   362,   363,  1006,   275,   226,   272,   288,
+     302,   321,   951,   355,   373,   881,   404,    38,   911,  1202,
+    1203,   240,  1204,   241,  1208,  1214,   242,   243,    31,   902,
+      32,   739,    33,   375,   376,   377,   776,   244,   245,   124,
+     125,   435,   246,    30,   247,   499,   436,   219,   220,   945,
+     500,   783,   784,   785,   997,   283,   300,   998,   822,    42,
+     227,   273,   289,   303,   322,   313,   356,   374,    44,   405,
+      46,   248,  1017,   375,   376,   377,   249,   270,   284,   301,
+     320,    48,   123,   335,   503,   281,   298,   250,   516,   504,
+     251,   334,   252,   517,    50,   253,   972,   973,   520,   378,
+     124,   125,   254,   521,    52,   255,   256,   257,   379,   739,
+     258,   423,   424,   259,   528,   282,   299,   267,    86,   529,
+    1220,  1221,   124,   125,   559,   124,   125,   154,   122,   560,
+     903,    54,  1073,   576,    56,  1074,    93,    94,   577,   378,
+      95,   580,    58,    96,    97,    98,   581,   335,   379,   336,
+     337,   804,   805,   338,   339,   340,   335,   357,   336,   337,
+     358,   359,   124,   125,   124,   125,   154,    60,    62,   946,
+     947,   948,   949,   124,   125,    64,    66,    99,   100,   101,
      102,   103,   104,   105,   106,   107,   108,   109,   110,   111,
      112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
-     122,   123,  1280,  1281,  1282,   123,   335,   945,   946,   947,
-     335,   357,   336,   337,   358,   359,   576,   580,   983,   124,
-     125,   577,   581,   124,   125,    54,   126,   124,   125,    56,
-     154,   127,   128,   129,   130,   131,  1231,   132,  1232,  1233,
-     154,    58,   133,  1188,  1189,   499,   154,   375,   376,   377,
-    1006,   134,    60,    62,    64,   135,    34,    35,    36,    37,
-      66,   580,   136,  1170,  1171,  1172,  1007,  1176,   154,  1182,
-     137,   138,   123,   124,   125,   139,   154,  1058,   140,   503,
-    1059,   154,   141,   431,  1008,   291,   292,   293,   294,   295,
-     124,   125,   432,  1315,   433,   233,  1316,  1317,  1318,  1319,
-     154,  1031,  1031,   142,   143,   144,  1032,  1033,  1098,   235,
-     443,  1099,   236,   378,   444,   145,   146,   147,  1313,   148,
-     445,  1314,   379,   149,   446,   150,   151,  1055,   152,   153,
-     447,  1072,  1056,   965,   966,   967,  1073,  1079,  1084,   895,
-    1088,   154,  1080,  1085,  1094,  1089,   154,   448,   576,  1095,
-     154,   989,   449,  1096,   154,   935,   728,   729,   730,   731,
-     990,  1031,  1140,  1031,  1103,   817,  1100,   450,  1101,  1104,
-     818,   819,   820,   821,   822,   823,   824,   825,   826,   827,
-     828,   829,   830,   831,   832,   833,   834,   835,   451,   452,
-     123,   453,   296,   915,   916,   917,   918,   919,   920,   454,
-     968,   456,  1031,   538,   123,   516,   732,  1267,   124,   125,
-    1268,  1271,   537,   335,   559,   278,  1272,   154,   457,  1279,
-    1292,   539,   124,   125,   520,  1293,   312,   233,   458,  1295,
-     459,   460,   313,   314,   315,   316,   317,   318,   155,   464,
-     528,   235,   221,  1333,   236,  1296,   481,   494,  1334,   582,
-     583,   742,   743,   744,   745,   239,   495,   496,   226,   280,
-    1253,  1254,  1255,  1256,   497,   886,   893,   297,   894,   275,
-     498,   272,   502,   510,   511,   288,   519,   319,   523,   525,
-     526,   527,   542,   302,   240,   546,   241,   341,   547,   242,
-     243,   342,   360,   321,   548,   552,   361,   362,   363,   550,
-     244,   245,   551,   355,   553,   246,   561,   247,   373,   564,
-     566,   227,   567,   570,   571,   403,   579,   584,   585,   587,
-     588,   283,   589,   279,   273,   590,   591,   592,   289,   300,
-     601,   404,   593,   836,   248,   154,   303,   594,   605,   249,
-     270,   837,   838,   595,   284,   596,   322,   597,   608,   154,
-     250,   281,   301,   251,   598,   252,   356,   154,   253,   298,
-     599,   374,   320,   600,   604,   254,   602,   603,   255,   256,
-     257,   609,   610,   258,   611,   612,   259,   613,   606,   607,
-     267,   282,   614,   615,   405,   616,   617,   618,   619,   299,
-     620,   621,    99,   100,   101,   102,   103,   104,   105,   106,
-     107,   108,   109,   622,   623,   624,   625,   114,   115,   116,
-     117,   118,   119,   120,   626,   627,   123,   124,   125,   628,
-     629,   630,   632,   631,   633,   634,   228,   635,   229,   636,
-     637,   638,   639,   640,   124,   125,   230,   231,   232,   233,
-     234,   126,   641,   642,   643,   644,   649,   645,   646,   652,
-     647,   653,   654,   235,   655,   650,   236,   133,   656,   155,
-     657,   658,   221,   659,   237,   660,   661,   662,   664,   665,
-     667,   668,   669,   670,   674,   671,   672,   675,   226,   676,
-     677,   388,   389,   390,   391,   392,   393,   394,   395,   396,
-     397,   398,   399,   400,   678,   934,   948,   958,   679,   403,
-     680,   401,   402,   682,   683,   685,   684,   984,   686,   687,
-     688,   936,   954,   959,   969,   404,   799,   800,   142,   143,
-     690,   694,   695,   985,   696,   697,   698,   691,   701,   238,
-     702,   227,   704,   692,   703,   700,   707,   720,   813,   705,
-     706,   708,   711,   709,   154,     1,     2,     3,     4,     5,
-       6,     7,     8,     9,    10,    11,    12,    13,    14,   710,
-     712,   154,   713,   714,   937,   955,   960,   970,   405,   716,
-     717,   719,   721,   722,   726,   723,   986,    99,   100,   101,
-     102,   103,   104,   105,   106,   107,   108,   109,   724,   725,
-     727,   734,   114,   115,   116,   117,   118,   119,   120,   121,
-     736,   123,   335,   735,   737,   738,   741,   747,    32,   748,
-     749,   750,   900,   752,   751,   753,   754,   761,   762,   124,
-     125,   755,   231,   232,   756,   234,   126,   757,   758,   759,
-     760,   763,   764,   769,   767,   765,   768,   766,   235,   771,
-     772,   236,   807,   773,   774,   775,   777,   778,   779,   237,
-     780,   812,   866,  1013,   781,   870,   782,   786,   874,   787,
-     878,   882,   788,   904,   789,   790,   791,   907,   792,   793,
-     794,   795,   911,   796,   978,   993,   997,  1014,   797,  1015,
-     801,  1016,   802,  1017,   803,   809,  1019,   810,  1020,  1024,
-    1025,   811,  1026,  1027,  1028,  1036,  1105,  1035,  1039,  1038,
-    1041,  1042,  1044,   142,   143,  1045,  1047,  1048,  1122,  1051,
-    1062,  1061,  1064,  1065,  1109,  1066,  1067,  1068,  1069,  1070,
-    1071,  1076,  1077,  1078,  1081,  1082,  1083,  1090,  1092,  1102,
-    1110,  1113,  1112,  1121,   798,  1117,  1116,  1115,  1118,  1119,
-    1120,  1123,  1126,  1129,  1130,  1124,   154,  1131,  1125,  1127,
-    1128,  1137,  1138,  1132,  1133,  1186,  1135,  1134,  1136,  1206,
-    1207,  1208,  1209,  1210,  1211,  1213,  1214,  1215,  1216,  1217,
-    1223,  1224,  1227,  1219,  1220,  1221,   239,  1228,  1226,   341,
-    1229,  1246,   360,   342,  1247,  1148,   361,   362,   363,  1169,
-     275,  1244,   272,  1252,  1269,   355,  1190,  1258,   373,   319,
-    1191,  1180,   380,  1259,  1260,   240,  1261,   241,  1270,  1262,
-     242,   243,  1193,  1275,  1149,   321,  1150,  1277,   934,  1151,
-    1152,   244,   245,   948,  1276,  1263,   246,   958,   247,  1264,
-    1153,  1154,  1265,  1278,   936,  1155,  1234,  1156,  1290,   954,
-    1235,  1299,   984,   959,  1266,   273,  1273,   280,   356,   969,
-     297,   374,  1236,  1300,  1181,   248,  1284,  1285,   985,  1302,
-     249,   270,  1304,   288,  1157,  1194,   302,  1307,   322,  1158,
-    1179,   250,  1286,  1309,   251,  1287,   252,  1173,  1303,   253,
-    1159,  1192,  1329,  1160,   320,  1161,   254,   937,  1162,   255,
-     256,   257,   955,  1294,   258,  1163,   960,   259,  1164,  1165,
-    1166,   267,   970,  1167,  1330,  1237,  1168,  1174,  1331,   283,
-    1175,   986,   300,  1335,  1297,  1336,   289,  1339,   892,   303,
-     586,   814,  1306,   808,  1005,  1141,   816,  1139,  1187,  1184,
-    1185,  1222,   284,   648,   699,   301,  1205,  1204,  1143,   281,
-    1142,  1183,   298,  1298,   333,  1308,  1144,  1337,  1212,  1145,
-    1147,  1338,   663,  1146,  1341,  1342,   689,  1251,  1249,   693,
-    1203,  1250,  1301,  1218,  1248,  1245,  1002,  1201,  1202,   282,
-     977,  1225,   299,  1230,   715,   718,   815,  1327,  1305,  1243,
-    1340,     0,   651,     0,     0,     0,     0,     0,     0,     0,
+     122,   123,  1348,    89,   499,  1349,  1350,  1351,  1352,  1022,
+     429,  1076,   124,   125,  1077,   961,   962,   963,   430,   124,
+     125,   123,   124,   125,   580,   503,   126,   154,   431,  1023,
+    1024,   127,   128,   129,   130,   131,  1055,   132,  1055,   124,
+     125,  1056,   133,  1057,    34,    35,    36,    37,   432,   154,
+     433,   134,   154,  1202,  1203,   135,  1204,   312,  1208,  1214,
+     443,   444,   136,   313,   314,   315,   316,   317,   318,   445,
+     137,   138,   981,   982,   983,   139,  1079,   537,   140,   972,
+     973,  1080,   141,   728,   729,   730,   731,  1096,  1103,   154,
+     446,   154,  1097,  1104,  1108,   123,  1112,  1118,   538,  1109,
+     154,  1113,  1119,   142,   143,   144,   447,   448,   291,   292,
+     293,   294,   295,   124,   125,   145,   146,   147,   233,   148,
+     449,  1082,   548,   149,  1083,   150,   151,   999,   152,   153,
+     450,   576,   235,   732,   451,   236,  1120,  1055,  1055,   984,
+    1127,   539,  1124,  1125,   911,  1128,   154,  1122,  1172,   154,
+    1123,  1055,   335,   516,   553,  1005,  1300,  1304,  1301,   951,
+     559,   547,  1305,  1325,  1006,  1312,   154,   817,  1326,   124,
+     125,   452,   818,   819,   820,   821,   822,   823,   824,   825,
+     826,   827,   828,   829,   830,   831,   832,   833,   834,   835,
+     836,   837,   838,   839,   840,   841,   842,   843,     1,     2,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,   520,   552,   528,   296,  1366,  1328,   155,  1329,
+     453,  1367,   221,   335,   454,   123,   742,   743,   744,   745,
+    1346,   582,   583,  1347,   456,   239,   278,   457,   226,   280,
+     154,   458,   459,   124,   125,   460,   464,   297,   233,   275,
+     481,   272,  1313,  1314,  1315,   288,  1263,   319,  1264,  1265,
+     494,   495,   235,   302,   240,   236,   241,   341,   496,   242,
+     243,   342,   360,   321,   497,   498,   361,   362,   363,   584,
+     244,   245,   502,   355,   510,   246,   511,   247,   373,   902,
+     909,   227,   910,   519,   523,   403,   154,  1285,  1286,  1287,
+    1288,   283,   525,   526,   273,   527,   542,   546,   289,   300,
+     550,   404,   551,   561,   248,   564,   303,   566,   567,   249,
+     270,   570,   571,   579,   284,   585,   322,   587,   588,   589,
+     250,   281,   301,   251,   590,   252,   356,   591,   253,   298,
+     592,   374,   320,   844,   279,   254,   601,   593,   255,   256,
+     257,   845,   846,   258,   594,   605,   259,   611,   595,   612,
+     267,   282,   596,   597,   405,   598,   608,   154,   602,   299,
+     154,   931,   932,   933,   934,   935,   936,   599,   600,   613,
+      99,   100,   101,   102,   103,   104,   105,   106,   107,   108,
+     109,   603,   604,   606,   607,   114,   115,   116,   117,   118,
+     119,   120,   609,   610,   123,   614,   615,   616,   617,   618,
+     619,   620,   621,   622,   228,   623,   229,   624,   625,   626,
+     627,   628,   124,   125,   230,   231,   232,   233,   234,   126,
+     629,   630,   631,   632,   633,   634,   635,   636,   637,   155,
+     638,   235,   221,   639,   236,   133,   640,   641,   642,   643,
+     644,   649,   237,   645,   646,   652,   647,   653,   226,   650,
+     654,   655,   656,   658,   659,   657,   124,   125,   660,   661,
+     662,   664,   665,   667,   668,   950,   964,   974,   669,   403,
+     670,   671,   672,   674,   675,   676,   677,  1000,   678,   679,
+     680,   952,   970,   975,   985,   404,   682,   683,   799,   800,
+     685,   684,   686,  1001,   687,   688,   142,   143,   690,   691,
+     692,   227,   694,   695,   696,   697,   698,   238,   700,   701,
+     813,   702,   703,   704,   707,   708,   705,   706,   711,   712,
+     388,   389,   390,   391,   392,   393,   394,   395,   396,   397,
+     398,   399,   400,   713,   953,   971,   976,   986,   405,   154,
+     401,   402,   714,   709,   716,   710,  1002,    99,   100,   101,
+     102,   103,   104,   105,   106,   107,   108,   109,   717,   719,
+     720,   721,   114,   115,   116,   117,   118,   119,   120,   121,
+     722,   123,   335,   723,   724,   725,   726,   727,   734,   735,
+     736,   737,   738,   154,   741,    32,   747,   748,   749,   124,
+     125,   750,   231,   232,   751,   234,   126,   752,   753,   754,
+     761,   762,   755,   756,   757,   758,   759,   760,   235,   763,
+     764,   236,   765,   767,   768,   769,   771,   772,  1029,   237,
+     778,   766,   812,   773,   807,   882,   886,   890,   894,   774,
+     775,   777,   779,   780,   781,   782,   786,   898,   916,   787,
+     920,   923,   927,   994,  1009,  1013,   788,  1030,   789,   790,
+    1031,   791,   792,  1032,  1033,  1035,  1036,   793,  1040,   794,
+     795,   796,  1041,   797,  1042,   801,   802,  1043,  1044,  1046,
+     803,  1047,  1048,   142,   143,  1049,  1050,  1051,  1052,   809,
+    1090,   810,   811,  1059,  1060,  1062,  1063,  1066,  1065,  1069,
+    1145,  1068,  1072,  1071,  1075,  1086,  1085,  1088,  1089,  1129,
+    1091,  1092,  1093,  1094,  1095,  1100,  1101,  1102,  1105,  1106,
+    1107,  1114,  1116,  1126,  1141,  1134,   154,  1133,  1137,  1136,
+    1142,  1146,  1139,  1140,  1143,  1144,  1147,  1148,  1149,  1150,
+    1151,  1153,  1154,  1155,  1152,  1156,  1161,  1169,  1157,  1170,
+    1159,  1158,  1162,  1160,  1164,  1163,  1218,  1165,  1166,  1167,
+    1168,  1245,  1238,  1239,  1240,  1241,  1242,  1243,  1246,  1247,
+    1251,  1248,  1255,  1249,  1252,  1253,  1256,  1259,  1258,  1260,
+     239,  1261,  1276,   341,  1278,  1279,   360,   342,  1284,  1180,
+     361,   362,   363,  1201,   275,  1290,   272,  1302,  1303,   355,
+    1222,  1291,   373,   319,  1223,  1212,   380,  1308,  1309,   240,
+    1292,   241,  1310,  1311,   242,   243,  1225,  1323,  1181,   321,
+    1182,  1293,   950,  1183,  1184,   244,   245,   964,  1332,  1335,
+     246,   974,   247,  1294,  1185,  1186,  1295,  1337,   952,  1187,
+    1266,  1188,  1333,   970,  1267,  1340,  1000,   975,  1336,   273,
+    1342,   280,   356,   985,   297,   374,  1268,  1296,  1213,   248,
+    1297,  1362,  1001,  1298,   249,   270,  1363,   288,  1189,  1226,
+     302,  1299,   322,  1190,  1211,   250,  1306,  1364,   251,  1317,
+     252,  1205,  1368,   253,  1191,  1224,  1318,  1192,   320,  1193,
+     254,   953,  1194,   255,   256,   257,   971,  1319,   258,  1195,
+     976,   259,  1196,  1197,  1198,   267,   986,  1199,  1372,  1269,
+    1200,  1206,  1369,   283,  1207,  1002,   300,   798,   586,   814,
+     289,   816,   908,   303,  1320,  1327,   808,  1021,  1171,  1173,
+    1219,  1216,  1217,  1254,  1237,  1236,   284,   699,  1175,   301,
+    1331,  1174,  1244,   281,  1215,   333,   298,  1176,  1177,  1330,
+    1339,  1178,   693,  1341,  1018,  1370,  1371,  1374,  1179,  1280,
+    1281,  1375,   648,  1235,  1334,   651,  1257,  1283,  1233,  1250,
+    1282,   715,  1234,   282,  1277,  1262,   299,   993,   718,  1360,
+    1338,  1275,  1373,   815,     0,     0,     0,     0,   663,     0,
+       0,     0,     0,     0,     0,   666,     0,     0,     0,     0,
+       0,     0,     0,     0,   673,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   681,     0,     0,     0,     0,
+       0,   689,     0,  1180,     0,     0,     0,  1201,     0,  1222,
+       0,     0,     0,  1223,     0,     0,     0,     0,     0,  1212,
+       0,     0,     0,     0,  1266,  1225,     0,     0,  1267,     0,
+       0,     0,  1181,     0,  1182,     0,     0,  1183,  1184,     0,
+    1268,     0,  1321,     0,     0,     0,     0,     0,  1185,  1186,
+       0,     0,     0,  1187,     0,  1188,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     666,     0,     0,     0,     0,     0,     0,     0,     0,   673,
-    1148,     0,     0,     0,  1169,     0,  1190,     0,     0,     0,
-    1191,     0,   681,     0,     0,     0,  1180,     0,     0,     0,
-       0,  1234,  1193,     0,     0,  1235,     0,     0,     0,  1149,
-       0,  1150,     0,     0,  1151,  1152,     0,  1236,  1288,     0,
-       0,     0,     0,     0,     0,  1153,  1154,     0,     0,     0,
-    1155,     0,  1156,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,  1181,
-       0,     0,     0,     0,     0,  1194,     0,     0,     0,  1157,
-       0,     0,     0,     0,  1158,  1179,     0,     0,     0,     0,
-    1237,  1192,  1173,     0,     0,  1159,     0,     0,  1160,     0,
-    1161,     0,     0,  1162,     0,     0,     0,     0,     0,     0,
-    1163,     0,     0,  1164,  1165,  1166,     0,     0,  1167,     0,
-       0,  1168,  1174,     0,     0,  1175
+       0,     0,  1213,     0,     0,     0,     0,     0,  1226,     0,
+       0,     0,  1189,     0,     0,     0,     0,  1190,  1211,     0,
+       0,     0,     0,  1269,  1224,  1205,     0,     0,  1191,     0,
+       0,  1192,     0,  1193,     0,     0,  1194,     0,     0,     0,
+       0,     0,     0,  1195,     0,     0,  1196,  1197,  1198,     0,
+       0,  1199,     0,     0,  1200,  1206,     0,     0,  1207
   };
 
   const short
@@ -5145,365 +5237,373 @@ namespace isc { namespace dhcp {
   {
       71,    72,    73,    74,    75,    76,   768,    78,    79,    80,
       81,    78,    79,    79,    79,   768,    73,    72,    73,    74,
-      75,    76,   756,    78,    79,    16,    81,   750,  1046,  1046,
-    1046,    73,  1046,    73,  1046,   112,    73,    73,     5,   213,
-       7,   618,     9,   725,    21,   163,   164,    73,    73,    13,
-      14,   110,    73,    30,    73,   119,   120,   121,   117,     3,
-      67,    16,    17,     3,     8,    74,    75,     0,     8,    10,
-      72,    73,    74,    75,    76,     3,    78,    79,     3,    81,
-       8,    73,   764,     8,     6,   767,    73,    73,    74,    75,
-      76,   659,     7,    86,    87,    74,    75,    73,    21,     7,
-      73,     7,    73,    86,    87,    73,   674,   675,   676,    86,
-      87,     3,    73,     3,     6,    73,    73,    73,     8,   696,
-      73,   185,    69,    73,     3,    74,    75,    73,     3,     8,
-     194,    86,    87,     8,    11,    12,   213,     7,    15,    86,
-      87,    18,    19,    20,    86,    87,    69,     7,    71,    72,
-     143,   144,    75,    76,    77,     7,   133,   134,   135,   136,
-     143,   144,     3,    86,    87,     6,     3,    44,    45,    46,
-      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
-      67,    68,   130,   131,   132,    68,    69,   139,   140,   141,
-      69,    70,    71,    72,    73,    74,     3,     3,   191,    86,
-      87,     8,     8,    86,    87,     7,    93,    86,    87,     7,
-     213,    98,    99,   100,   101,   102,   173,   104,   175,   176,
-     213,     7,   109,   106,   107,     3,   213,   119,   120,   121,
-       8,   118,     7,     7,     7,   122,   213,   214,   215,   216,
-       7,     3,   129,  1271,  1271,  1271,     8,  1271,   213,  1271,
-     137,   138,    68,    86,    87,   142,   213,     3,   145,     3,
-       6,   213,   149,     4,     8,    81,    82,    83,    84,    85,
-      86,    87,     8,   174,     3,    91,   177,   178,   179,   180,
-     213,     3,     3,   170,   171,   172,     8,     8,     3,   105,
-       4,     6,   108,   185,     4,   182,   183,   184,     3,   186,
-       4,     6,   194,   190,     4,   192,   193,     3,   195,   196,
-       4,     3,     8,   146,   147,   148,     8,     3,     3,  1052,
-       3,   213,     8,     8,     3,     8,   213,     4,     3,     8,
-     213,  1103,     4,     8,   213,  1079,   166,   167,   168,   169,
-    1103,     3,  1034,     3,     3,    21,     8,     4,     8,     8,
-      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,     4,     4,
-      68,     4,   188,   123,   124,   125,   126,   127,   128,     4,
-     213,     4,     3,     3,    68,     3,   216,     8,    86,    87,
-       8,     3,     8,    69,     3,    79,     8,   213,     4,     8,
-       3,     8,    86,    87,     3,     8,   104,    91,     4,     8,
-       4,     4,   110,   111,   112,   113,   114,   115,   499,     4,
-       3,   105,   503,     3,   108,     8,     4,     4,     8,   430,
-     431,    94,    95,    96,    97,   516,     4,     4,   503,   520,
-      22,    23,    24,    25,     4,   112,   113,   528,   115,   516,
-       4,   516,     4,     4,     4,   520,     4,   538,     4,     4,
-       4,     4,     4,   528,   516,     4,   516,   548,     8,   516,
-     516,   548,   553,   538,     3,     8,   553,   553,   553,     4,
-     516,   516,     4,   548,     3,   516,     4,   516,   553,     4,
-       4,   503,     4,     4,     4,   576,     4,   213,     4,     4,
-       4,   520,     4,   187,   516,     4,     4,     4,   520,   528,
-     216,   576,   214,   189,   516,   213,   528,   214,     4,   516,
-     516,   197,   198,   214,   520,   214,   538,   214,   216,   213,
-     516,   520,   528,   516,   214,   516,   548,   213,   516,   528,
-     214,   553,   538,   214,   214,   516,   215,   215,   516,   516,
-     516,   216,   216,   516,     4,     4,   516,     4,   214,   214,
-     516,   520,   216,     4,   576,     4,     4,     4,     4,   528,
-       4,     4,    44,    45,    46,    47,    48,    49,    50,    51,
-      52,    53,    54,     4,     4,     4,     4,    59,    60,    61,
-      62,    63,    64,    65,     4,     4,    68,    86,    87,     4,
-       4,     4,     4,   214,     4,     4,    78,     4,    80,     4,
-       4,     4,     4,     4,    86,    87,    88,    89,    90,    91,
-      92,    93,     4,     4,     4,   213,     4,   214,   214,     4,
-     214,     4,     4,   105,     4,   216,   108,   109,     4,   720,
-     214,   216,   723,     4,   116,     4,     4,     4,     4,   214,
-       4,   214,     4,   214,     4,   214,   214,     4,   723,     4,
-       4,   150,   151,   152,   153,   154,   155,   156,   157,   158,
-     159,   160,   161,   162,     4,   756,   757,   758,     4,   760,
-       4,   170,   171,     4,     4,     4,   214,   768,     4,     4,
-     216,   756,   757,   758,   759,   760,   697,   698,   170,   171,
-       4,     4,     4,   768,     4,     4,     4,   216,     4,   181,
-       4,   723,     4,   216,   214,   216,     4,     7,   719,   214,
-     214,     4,     4,   216,   213,   199,   200,   201,   202,   203,
-     204,   205,   206,   207,   208,   209,   210,   211,   212,   216,
-       4,   213,     4,     4,   756,   757,   758,   759,   760,     4,
-     214,     4,   213,     7,     5,     7,   768,    44,    45,    46,
-      47,    48,    49,    50,    51,    52,    53,    54,     7,     7,
-     213,   213,    59,    60,    61,    62,    63,    64,    65,    66,
-       5,    68,    69,   213,     5,     5,   213,     5,     7,     5,
-       5,     5,   103,     5,     7,     5,     5,   213,   213,    86,
-      87,     7,    89,    90,     7,    92,    93,     7,     7,     7,
-       7,     5,     7,     5,     7,   213,     7,   213,   105,     5,
-       5,   108,   165,   213,   213,   213,   213,     7,   213,   116,
-     213,     5,     7,     4,   213,     7,   213,   213,     7,   213,
-       7,     7,   213,     7,   213,   213,   213,     7,   213,   213,
-     213,   213,     7,   213,     7,     7,     7,     4,   213,     4,
-     213,     4,   213,     4,   213,   213,     4,   213,     4,     4,
-       4,   213,     4,     4,     4,     3,   213,     6,     3,     6,
-       6,     3,     6,   170,   171,     3,     6,     3,   216,     6,
-       3,     6,     6,     3,     6,     4,     4,     4,     4,     4,
+      75,    76,   756,    78,    79,   725,    81,    16,   750,  1070,
+    1070,    73,  1070,    73,  1070,  1070,    73,    73,     5,   120,
+       7,   618,     9,   127,   128,   129,   659,    73,    73,    94,
+      95,     3,    73,     0,    73,     3,     8,    16,    17,    21,
+       8,   674,   675,   676,   764,    74,    75,   767,    30,     7,
+      72,    73,    74,    75,    76,   118,    78,    79,     7,    81,
+       7,    73,   125,   127,   128,   129,    73,    73,    74,    75,
+      76,     7,    76,    77,     3,    74,    75,    73,     3,     8,
+      73,    21,    73,     8,     7,    73,   151,   152,     3,   193,
+      94,    95,    73,     8,     7,    73,    73,    73,   202,   696,
+      73,    13,    14,    73,     3,    74,    75,    73,   221,     8,
+     114,   115,    94,    95,     3,    94,    95,   221,    75,     8,
+     221,     7,     3,     3,     7,     6,    11,    12,     8,   193,
+      15,     3,     7,    18,    19,    20,     8,    77,   202,    79,
+      80,   171,   172,    83,    84,    85,    77,    78,    79,    80,
+      81,    82,    94,    95,    94,    95,   221,     7,     7,   141,
+     142,   143,   144,    94,    95,     7,     7,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,   182,    10,     3,   185,   186,   187,   188,     8,
+       6,     3,    94,    95,     6,   147,   148,   149,     3,    94,
+      95,    76,    94,    95,     3,     3,   101,   221,     4,     8,
+       8,   106,   107,   108,   109,   110,     3,   112,     3,    94,
+      95,     8,   117,     8,   221,   222,   223,   224,     8,   221,
+       3,   126,   221,  1304,  1304,   130,  1304,   112,  1304,  1304,
+       4,     4,   137,   118,   119,   120,   121,   122,   123,     4,
+     145,   146,   154,   155,   156,   150,     3,     8,   153,   151,
+     152,     8,   157,   174,   175,   176,   177,     3,     3,   221,
+       4,   221,     8,     8,     3,    76,     3,     3,     3,     8,
+     221,     8,     8,   178,   179,   180,     4,     4,    89,    90,
+      91,    92,    93,    94,    95,   190,   191,   192,    99,   194,
+       4,     3,     3,   198,     6,   200,   201,   199,   203,   204,
+       4,     3,   113,   224,     4,   116,     8,     3,     3,   221,
+       3,     8,     8,     8,  1076,     8,   221,     3,  1058,   221,
+       6,     3,    77,     3,     3,  1127,     8,     3,     8,  1103,
+       3,     8,     8,     3,  1127,     8,   221,    21,     8,    94,
+      95,     4,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,   207,   208,
+     209,   210,   211,   212,   213,   214,   215,   216,   217,   218,
+     219,   220,     3,     8,     3,   196,     3,     8,   499,     8,
+       4,     8,   503,    77,     4,    76,   102,   103,   104,   105,
+       3,   430,   431,     6,     4,   516,    87,     4,   503,   520,
+     221,     4,     4,    94,    95,     4,     4,   528,    99,   516,
+       4,   516,   138,   139,   140,   520,   181,   538,   183,   184,
+       4,     4,   113,   528,   516,   116,   516,   548,     4,   516,
+     516,   548,   553,   538,     4,     4,   553,   553,   553,   221,
+     516,   516,     4,   548,     4,   516,     4,   516,   553,   120,
+     121,   503,   123,     4,     4,   576,   221,    22,    23,    24,
+      25,   520,     4,     4,   516,     4,     4,     4,   520,   528,
+       4,   576,     4,     4,   516,     4,   528,     4,     4,   516,
+     516,     4,     4,     4,   520,     4,   538,     4,     4,     4,
+     516,   520,   528,   516,     4,   516,   548,     4,   516,   528,
+       4,   553,   538,   197,   195,   516,   224,   222,   516,   516,
+     516,   205,   206,   516,   222,     4,   516,     4,   222,     4,
+     516,   520,   222,   222,   576,   222,   224,   221,   223,   528,
+     221,   131,   132,   133,   134,   135,   136,   222,   222,     4,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,   223,   222,   222,   222,    67,    68,    69,    70,    71,
+      72,    73,   224,   224,    76,   224,     4,     4,     4,     4,
+       4,     4,     4,     4,    86,     4,    88,     4,     4,     4,
+       4,     4,    94,    95,    96,    97,    98,    99,   100,   101,
+       4,     4,   222,     4,     4,     4,     4,     4,     4,   720,
+       4,   113,   723,     4,   116,   117,     4,     4,     4,     4,
+     221,     4,   124,   222,   222,     4,   222,     4,   723,   224,
+       4,     4,     4,   224,     4,   222,    94,    95,     4,     4,
+       4,     4,   222,     4,   222,   756,   757,   758,     4,   760,
+     222,   222,   222,     4,     4,     4,     4,   768,     4,     4,
+       4,   756,   757,   758,   759,   760,     4,     4,   697,   698,
+       4,   222,     4,   768,     4,   224,   178,   179,     4,   224,
+     224,   723,     4,     4,     4,     4,     4,   189,   224,     4,
+     719,     4,   222,     4,     4,     4,   222,   222,     4,     4,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,     4,   756,   757,   758,   759,   760,   221,
+     178,   179,     4,   224,     4,   224,   768,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,   222,     4,
+       7,   221,    67,    68,    69,    70,    71,    72,    73,    74,
+       7,    76,    77,     7,     7,     7,     5,   221,   221,   221,
+       5,     5,     5,   221,   221,     7,     5,     5,     5,    94,
+      95,     5,    97,    98,     7,   100,   101,     5,     5,     5,
+     221,   221,     7,     7,     7,     7,     7,     7,   113,     5,
+       7,   116,   221,     7,     7,     5,     5,     5,     4,   124,
+       7,   221,     5,   221,   173,     7,     7,     7,     7,   221,
+     221,   221,   221,   221,   221,   221,   221,     7,   111,   221,
+       7,     7,     7,     7,     7,     7,   221,     4,   221,   221,
+       4,   221,   221,     4,     4,     4,     4,   221,     4,   221,
+     221,   221,     4,   221,     4,   221,   221,     4,     4,     4,
+     221,     4,     4,   178,   179,     4,     4,     4,     4,   221,
+       4,   221,   221,     6,     3,     6,     3,     3,     6,     3,
+     222,     6,     3,     6,     6,     3,     6,     6,     3,   221,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       3,     3,     6,   214,   696,     4,     6,     8,     4,     4,
-       4,   214,     4,     4,     4,   216,   213,     4,   214,   214,
-     214,     4,     4,   214,   214,     4,   214,   216,   214,   214,
-     214,   214,   214,   214,   214,     4,     4,   214,   214,   214,
-       4,     4,     4,   216,   214,   214,  1037,   214,   216,  1040,
-       4,     6,  1043,  1040,     3,  1046,  1043,  1043,  1043,  1046,
-    1037,   216,  1037,     4,     8,  1040,  1057,   213,  1043,  1060,
-    1057,  1046,  1063,   213,   213,  1037,   213,  1037,     8,   213,
-    1037,  1037,  1057,     4,  1046,  1060,  1046,     3,  1079,  1046,
-    1046,  1037,  1037,  1084,     8,   213,  1037,  1088,  1037,   213,
-    1046,  1046,   213,     8,  1079,  1046,  1097,  1046,     4,  1084,
-    1097,     4,  1103,  1088,   213,  1037,   213,  1108,  1040,  1094,
-    1111,  1043,  1097,   216,  1046,  1037,   213,   213,  1103,     4,
-    1037,  1037,     4,  1108,  1046,  1057,  1111,     5,  1060,  1046,
-    1046,  1037,   213,     7,  1037,   213,  1037,  1046,   214,  1037,
-    1046,  1057,     4,  1046,  1060,  1046,  1037,  1079,  1046,  1037,
-    1037,  1037,  1084,   213,  1037,  1046,  1088,  1037,  1046,  1046,
-    1046,  1037,  1094,  1046,     4,  1097,  1046,  1046,     4,  1108,
-    1046,  1103,  1111,     4,   213,   216,  1108,     4,   749,  1111,
-     435,   720,   213,   711,   812,  1036,   723,  1031,  1055,  1049,
-    1052,  1084,  1108,   499,   559,  1111,  1065,  1063,  1039,  1108,
-    1037,  1048,  1111,  1271,    77,   213,  1040,   214,  1072,  1042,
-    1045,   214,   516,  1043,   213,   213,   548,  1113,  1110,   553,
-    1062,  1111,  1277,  1079,  1108,  1103,   778,  1058,  1060,  1108,
-     760,  1088,  1111,  1094,   576,   580,   722,  1313,  1292,  1098,
-    1333,    -1,   503,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+       4,     4,     4,     4,     4,     3,   221,     6,     3,     6,
+       4,   224,     8,     6,     4,     4,   222,   224,   222,     4,
+     222,     4,     4,     4,   222,   222,     4,     4,   222,     4,
+     222,   224,   222,   224,   222,   224,     4,   224,   224,   224,
+     222,     4,   222,   222,   222,   222,   222,   222,     4,   222,
+     224,   222,     4,   222,   222,   222,     4,     4,   224,   222,
+    1061,     4,   224,  1064,     6,     3,  1067,  1064,     4,  1070,
+    1067,  1067,  1067,  1070,  1061,   221,  1061,     8,     8,  1064,
+    1081,   221,  1067,  1084,  1081,  1070,  1087,     4,     8,  1061,
+     221,  1061,     3,     8,  1061,  1061,  1081,     4,  1070,  1084,
+    1070,   221,  1103,  1070,  1070,  1061,  1061,  1108,     4,     4,
+    1061,  1112,  1061,   221,  1070,  1070,   221,     4,  1103,  1070,
+    1121,  1070,   224,  1108,  1121,     5,  1127,  1112,   222,  1061,
+       7,  1132,  1064,  1118,  1135,  1067,  1121,   221,  1070,  1061,
+     221,     4,  1127,   221,  1061,  1061,     4,  1132,  1070,  1081,
+    1135,   221,  1084,  1070,  1070,  1061,   221,     4,  1061,   221,
+    1061,  1070,     4,  1061,  1070,  1081,   221,  1070,  1084,  1070,
+    1061,  1103,  1070,  1061,  1061,  1061,  1108,   221,  1061,  1070,
+    1112,  1061,  1070,  1070,  1070,  1061,  1118,  1070,     4,  1121,
+    1070,  1070,   224,  1132,  1070,  1127,  1135,   696,   435,   720,
+    1132,   723,   749,  1135,   221,   221,   711,   812,  1055,  1060,
+    1079,  1073,  1076,  1108,  1089,  1087,  1132,   559,  1063,  1135,
+    1304,  1061,  1096,  1132,  1072,    77,  1135,  1064,  1066,   221,
+     221,  1067,   553,   221,   778,   222,   222,   221,  1069,  1132,
+    1134,   221,   499,  1086,  1310,   503,  1112,  1137,  1082,  1103,
+    1135,   576,  1084,  1132,  1127,  1118,  1135,   760,   580,  1346,
+    1325,  1122,  1366,   722,    -1,    -1,    -1,    -1,   516,    -1,
+      -1,    -1,    -1,    -1,    -1,   520,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,   528,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   538,    -1,    -1,    -1,    -1,
+      -1,   548,    -1,  1304,    -1,    -1,    -1,  1304,    -1,  1310,
+      -1,    -1,    -1,  1310,    -1,    -1,    -1,    -1,    -1,  1304,
+      -1,    -1,    -1,    -1,  1325,  1310,    -1,    -1,  1325,    -1,
+      -1,    -1,  1304,    -1,  1304,    -1,    -1,  1304,  1304,    -1,
+    1325,    -1,  1261,    -1,    -1,    -1,    -1,    -1,  1304,  1304,
+      -1,    -1,    -1,  1304,    -1,  1304,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     520,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   528,
-    1271,    -1,    -1,    -1,  1271,    -1,  1277,    -1,    -1,    -1,
-    1277,    -1,   538,    -1,    -1,    -1,  1271,    -1,    -1,    -1,
-      -1,  1292,  1277,    -1,    -1,  1292,    -1,    -1,    -1,  1271,
-      -1,  1271,    -1,    -1,  1271,  1271,    -1,  1292,  1229,    -1,
-      -1,    -1,    -1,    -1,    -1,  1271,  1271,    -1,    -1,    -1,
-    1271,    -1,  1271,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,  1271,
-      -1,    -1,    -1,    -1,    -1,  1277,    -1,    -1,    -1,  1271,
-      -1,    -1,    -1,    -1,  1271,  1271,    -1,    -1,    -1,    -1,
-    1292,  1277,  1271,    -1,    -1,  1271,    -1,    -1,  1271,    -1,
-    1271,    -1,    -1,  1271,    -1,    -1,    -1,    -1,    -1,    -1,
-    1271,    -1,    -1,  1271,  1271,  1271,    -1,    -1,  1271,    -1,
-      -1,  1271,  1271,    -1,    -1,  1271
+      -1,    -1,  1304,    -1,    -1,    -1,    -1,    -1,  1310,    -1,
+      -1,    -1,  1304,    -1,    -1,    -1,    -1,  1304,  1304,    -1,
+      -1,    -1,    -1,  1325,  1310,  1304,    -1,    -1,  1304,    -1,
+      -1,  1304,    -1,  1304,    -1,    -1,  1304,    -1,    -1,    -1,
+      -1,    -1,    -1,  1304,    -1,    -1,  1304,  1304,  1304,    -1,
+      -1,  1304,    -1,    -1,  1304,  1304,    -1,    -1,  1304
   };
 
   const short
   Dhcp6Parser::yystos_[] =
   {
-       0,   199,   200,   201,   202,   203,   204,   205,   206,   207,
-     208,   209,   210,   211,   212,   218,   219,   220,   221,   222,
-     223,   224,   225,   226,   227,   228,   229,   230,   231,   232,
-       0,     5,     7,     9,   213,   214,   215,   216,   233,   234,
-     235,   240,     7,   249,     7,   255,     7,   294,     7,   402,
-       7,   479,     7,   495,     7,   512,     7,   431,     7,   437,
-       7,   461,     7,   376,     7,   584,     7,   615,   241,   236,
-     250,   256,   295,   403,   480,   496,   513,   432,   438,   462,
-     377,   585,   616,   233,   242,   243,   213,   238,   239,    10,
-     251,   252,   253,    11,    12,    15,    18,    19,    20,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    86,    87,    93,    98,    99,   100,
-     101,   102,   104,   109,   118,   122,   129,   137,   138,   142,
-     145,   149,   170,   171,   172,   182,   183,   184,   186,   190,
-     192,   193,   195,   196,   213,   248,   257,   258,   259,   261,
-     262,   263,   264,   265,   266,   267,   268,   269,   270,   271,
-     272,   273,   274,   275,   276,   279,   281,   283,   285,   287,
-     288,   289,   290,   292,   301,   303,   305,   343,   349,   355,
-     361,   363,   370,   386,   396,   416,   421,   429,   455,   485,
-     487,   506,   536,   548,   560,   561,   572,   582,   613,   622,
-     648,   650,   652,   656,   661,   663,   664,   667,   668,    16,
-      17,   248,   296,   297,   298,   300,   485,   487,    78,    80,
-      88,    89,    90,    91,    92,   105,   108,   116,   181,   248,
-     261,   262,   263,   264,   265,   266,   267,   268,   269,   270,
-     271,   273,   274,   275,   276,   279,   281,   283,   285,   287,
-     404,   405,   406,   408,   410,   412,   414,   416,   419,   420,
-     455,   473,   485,   487,   489,   506,   531,   646,    79,   187,
-     248,   412,   414,   419,   455,   481,   482,   483,   485,   487,
-     658,    81,    82,    83,    84,    85,   188,   248,   412,   414,
-     419,   455,   485,   487,   497,   498,   499,   501,   502,   504,
-     505,   659,   104,   110,   111,   112,   113,   114,   115,   248,
-     455,   485,   487,   514,   515,   516,   517,   519,   521,   523,
-     525,   527,   529,   429,    21,    69,    71,    72,    75,    76,
-      77,   248,   323,   439,   440,   441,   442,   443,   444,   445,
-     447,   449,   451,   452,   454,   485,   487,    70,    73,    74,
-     248,   323,   443,   449,   463,   464,   465,   466,   467,   469,
-     470,   471,   472,   485,   487,   119,   120,   121,   185,   194,
-     248,   378,   379,   380,   382,   384,   654,   665,   150,   151,
-     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
-     162,   170,   171,   248,   485,   487,   586,   587,   588,   589,
-     591,   593,   594,   596,   597,   598,   601,   603,   604,   605,
-     607,   609,   611,    13,    14,   617,   618,   619,   621,     6,
-       3,     4,     8,     3,   254,     3,     8,   260,   614,   293,
-     302,   304,   306,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,   291,     4,     4,     4,     4,
-       4,   277,   280,   282,     4,   397,   430,   456,   486,   488,
-     417,   422,   350,   362,   356,   344,   537,   507,   371,   387,
-     549,     4,   364,   562,   573,   583,   284,   286,   623,   649,
-     651,   653,   657,   662,     4,     4,     4,     4,     4,     3,
-       8,   299,     4,     3,     8,   474,   490,   407,   409,   411,
-       4,     4,   415,   413,   532,   647,     3,     8,   484,     4,
-       3,     8,   500,     4,   503,     4,     4,     4,     3,     8,
-     530,   518,   520,   522,   524,   526,   528,     8,     3,     8,
-     446,   324,     4,   450,   448,   453,     4,     8,     3,   468,
-       4,     4,     8,     3,   381,   383,   385,   655,   666,     3,
-       8,     4,   590,   592,     4,   595,     4,     4,   599,   602,
-       4,     4,   606,   608,   610,   612,     3,     8,   620,     4,
-       3,     8,   233,   233,   213,     4,   252,     4,     4,     4,
-       4,     4,     4,   214,   214,   214,   214,   214,   214,   214,
-     214,   216,   215,   215,   214,     4,   214,   214,   216,   216,
-     216,     4,     4,     4,   216,     4,     4,     4,     4,     4,
+       0,   207,   208,   209,   210,   211,   212,   213,   214,   215,
+     216,   217,   218,   219,   220,   226,   227,   228,   229,   230,
+     231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
+       0,     5,     7,     9,   221,   222,   223,   224,   241,   242,
+     243,   248,     7,   257,     7,   263,     7,   302,     7,   419,
+       7,   496,     7,   512,     7,   529,     7,   448,     7,   454,
+       7,   478,     7,   393,     7,   601,     7,   632,   249,   244,
+     258,   264,   303,   420,   497,   513,   530,   449,   455,   479,
+     394,   602,   633,   241,   250,   251,   221,   246,   247,    10,
+     259,   260,   261,    11,    12,    15,    18,    19,    20,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    94,    95,   101,   106,   107,   108,
+     109,   110,   112,   117,   126,   130,   137,   145,   146,   150,
+     153,   157,   178,   179,   180,   190,   191,   192,   194,   198,
+     200,   201,   203,   204,   221,   256,   265,   266,   267,   269,
+     270,   271,   272,   273,   274,   275,   276,   277,   278,   279,
+     280,   281,   282,   283,   284,   287,   289,   291,   293,   295,
+     296,   297,   298,   300,   309,   311,   313,   351,   366,   372,
+     378,   380,   387,   403,   413,   433,   438,   446,   472,   502,
+     504,   523,   553,   565,   577,   578,   589,   599,   630,   639,
+     665,   667,   669,   673,   678,   680,   681,   684,   685,    16,
+      17,   256,   304,   305,   306,   308,   502,   504,    86,    88,
+      96,    97,    98,    99,   100,   113,   116,   124,   189,   256,
+     269,   270,   271,   272,   273,   274,   275,   276,   277,   278,
+     279,   281,   282,   283,   284,   287,   289,   291,   293,   295,
+     421,   422,   423,   425,   427,   429,   431,   433,   436,   437,
+     472,   490,   502,   504,   506,   523,   548,   663,    87,   195,
+     256,   429,   431,   436,   472,   498,   499,   500,   502,   504,
+     675,    89,    90,    91,    92,    93,   196,   256,   429,   431,
+     436,   472,   502,   504,   514,   515,   516,   518,   519,   521,
+     522,   676,   112,   118,   119,   120,   121,   122,   123,   256,
+     472,   502,   504,   531,   532,   533,   534,   536,   538,   540,
+     542,   544,   546,   446,    21,    77,    79,    80,    83,    84,
+      85,   256,   331,   456,   457,   458,   459,   460,   461,   462,
+     464,   466,   468,   469,   471,   502,   504,    78,    81,    82,
+     256,   331,   460,   466,   480,   481,   482,   483,   484,   486,
+     487,   488,   489,   502,   504,   127,   128,   129,   193,   202,
+     256,   395,   396,   397,   399,   401,   671,   682,   158,   159,
+     160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
+     170,   178,   179,   256,   502,   504,   603,   604,   605,   606,
+     608,   610,   611,   613,   614,   615,   618,   620,   621,   622,
+     624,   626,   628,    13,    14,   634,   635,   636,   638,     6,
+       3,     4,     8,     3,   262,     3,     8,   268,   631,   301,
+     310,   312,   314,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,   299,     4,     4,     4,     4,
+       4,   285,   288,   290,     4,   414,   447,   473,   503,   505,
+     434,   439,   367,   379,   373,   352,   554,   524,   388,   404,
+     566,     4,   381,   579,   590,   600,   292,   294,   640,   666,
+     668,   670,   674,   679,     4,     4,     4,     4,     4,     3,
+       8,   307,     4,     3,     8,   491,   507,   424,   426,   428,
+       4,     4,   432,   430,   549,   664,     3,     8,   501,     4,
+       3,     8,   517,     4,   520,     4,     4,     4,     3,     8,
+     547,   535,   537,   539,   541,   543,   545,     8,     3,     8,
+     463,   332,     4,   467,   465,   470,     4,     8,     3,   485,
+       4,     4,     8,     3,   398,   400,   402,   672,   683,     3,
+       8,     4,   607,   609,     4,   612,     4,     4,   616,   619,
+       4,     4,   623,   625,   627,   629,     3,     8,   637,     4,
+       3,     8,   241,   241,   221,     4,   260,     4,     4,     4,
+       4,     4,     4,   222,   222,   222,   222,   222,   222,   222,
+     222,   224,   223,   223,   222,     4,   222,   222,   224,   224,
+     224,     4,     4,     4,   224,     4,     4,     4,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,   214,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,   213,   214,   214,   214,   258,     4,
-     216,   297,     4,     4,     4,     4,     4,   214,   216,     4,
-       4,     4,     4,   405,     4,   214,   482,     4,   214,     4,
-     214,   214,   214,   498,     4,     4,     4,     4,     4,     4,
-       4,   516,     4,     4,   214,     4,     4,     4,   216,   441,
-       4,   216,   216,   465,     4,     4,     4,     4,     4,   379,
-     216,     4,     4,   214,     4,   214,   214,     4,     4,   216,
-     216,     4,     4,     4,     4,   587,     4,   214,   618,     4,
-       7,   213,     7,     7,     7,     7,     5,   213,   166,   167,
-     168,   169,   216,   278,   213,   213,     5,     5,     5,   235,
-     237,   213,    94,    95,    96,    97,   418,     5,     5,     5,
+       4,   222,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,   221,   222,   222,   222,   266,     4,
+     224,   305,     4,     4,     4,     4,     4,   222,   224,     4,
+       4,     4,     4,   422,     4,   222,   499,     4,   222,     4,
+     222,   222,   222,   515,     4,     4,     4,     4,     4,     4,
+       4,   533,     4,     4,   222,     4,     4,     4,   224,   458,
+       4,   224,   224,   482,     4,     4,     4,     4,     4,   396,
+     224,     4,     4,   222,     4,   222,   222,     4,     4,   224,
+     224,     4,     4,     4,     4,   604,     4,   222,   635,     4,
+       7,   221,     7,     7,     7,     7,     5,   221,   174,   175,
+     176,   177,   224,   286,   221,   221,     5,     5,     5,   243,
+     245,   221,   102,   103,   104,   105,   435,     5,     5,     5,
        5,     7,     5,     5,     5,     7,     7,     7,     7,     7,
-       7,   213,   213,     5,     7,   213,   213,     7,     7,     5,
-     244,     5,     5,   213,   213,   213,   244,   213,     7,   213,
-     213,   213,   213,   244,   244,   244,   213,   213,   213,   213,
-     213,   213,   213,   213,   213,   213,   213,   213,   237,   233,
-     233,   213,   213,   213,   163,   164,   600,   165,   278,   213,
-     213,   213,     5,   233,   257,   617,   296,    21,    26,    27,
+       7,   221,   221,     5,     7,   221,   221,     7,     7,     5,
+     252,     5,     5,   221,   221,   221,   252,   221,     7,   221,
+     221,   221,   221,   252,   252,   252,   221,   221,   221,   221,
+     221,   221,   221,   221,   221,   221,   221,   221,   245,   241,
+     241,   221,   221,   221,   171,   172,   617,   173,   286,   221,
+     221,   221,     5,   241,   265,   634,   304,    21,    26,    27,
       28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,   189,   197,   198,   248,
-     311,   312,   313,   316,   318,   320,   322,   323,   325,   326,
-     327,   328,   329,   330,   331,   332,   333,   334,   336,   337,
-     339,   341,   660,   669,   671,   311,     7,   307,   308,   309,
-       7,   398,   399,   400,     7,   433,   434,   435,     7,   457,
-     458,   459,     7,   423,   424,   425,   112,   213,   351,   352,
-     353,   354,   242,   113,   115,   353,   357,   358,   359,   360,
-     103,   345,   346,   347,     7,   538,   539,     7,   508,   509,
-     510,     7,   372,   373,   374,   123,   124,   125,   126,   127,
-     128,   388,   389,   390,   391,   392,   393,   394,   395,    21,
-     133,   134,   135,   136,   248,   325,   485,   487,   550,   551,
-     552,   555,   556,   558,   559,   139,   140,   141,   248,   365,
-     366,   367,   368,   369,   485,   487,   143,   144,   248,   485,
-     487,   563,   564,   567,   569,   146,   147,   148,   213,   485,
-     487,   574,   575,   576,   577,   579,   580,   586,     7,   624,
-     625,   311,   311,   191,   248,   485,   487,   565,   566,   567,
-     569,   571,   245,     7,   475,   476,   477,     7,   491,   492,
-     493,   117,   517,   533,   534,   307,     8,     8,     8,   314,
-     317,   319,   321,     4,     4,     4,     4,     4,   335,     4,
-       4,   338,   340,   342,     4,     4,     4,     4,     4,   670,
-     672,     3,     8,     8,   310,     6,     3,   401,     6,     3,
-     436,     6,     3,   460,     6,     3,   426,     6,     3,     3,
-       6,     6,     3,     6,   348,     3,     8,   540,     3,     6,
-     511,     6,     3,   375,     6,     3,     4,     4,     4,     4,
-       4,     4,     3,     8,   553,   557,     4,     4,     4,     3,
-       8,     4,     4,     4,     3,     8,   568,   570,     3,     8,
-       4,   578,     4,   581,     3,     8,     8,   626,     3,     6,
-       8,     8,     4,     3,     8,   213,   246,   247,   478,     6,
-       3,   494,     6,     3,   535,     8,     6,     4,     4,     4,
-       4,   214,   216,   214,   216,   214,     4,   214,   214,     4,
-       4,     4,   214,   214,   216,   214,   214,     4,     4,   312,
-     311,   309,   404,   400,   439,   435,   463,   459,   248,   261,
-     262,   263,   264,   265,   266,   267,   268,   269,   270,   271,
-     273,   274,   275,   276,   279,   281,   283,   285,   287,   323,
-     396,   408,   410,   412,   414,   416,   420,   427,   428,   455,
-     485,   487,   531,   425,   352,   358,     4,   346,   106,   107,
-     248,   323,   455,   485,   487,   541,   542,   543,   544,   545,
-     547,   539,   514,   510,   378,   374,   214,   214,   214,   214,
-     214,   214,   389,     4,     4,   214,   214,   214,   551,   216,
-     214,   214,   366,     4,     4,   564,   216,     4,   214,     4,
-     575,   173,   175,   176,   248,   323,   485,   487,   627,   628,
-     629,   630,   632,   625,   216,   566,     6,     3,   481,   477,
-     497,   493,     4,    22,    23,    24,    25,   315,   213,   213,
-     213,   213,   213,   213,   213,   213,   213,     8,     8,     8,
-       8,     3,     8,   213,   546,     4,     8,     3,     8,     8,
-     130,   131,   132,   554,   213,   213,   213,   213,   233,   633,
-       4,   631,     3,     8,   213,     8,     8,   213,   428,     4,
-     216,   543,     4,   214,     4,   628,   213,     5,   213,     7,
-     634,   635,   636,     3,     6,   174,   177,   178,   179,   180,
-     637,   638,   639,   641,   642,   643,   644,   635,   640,     4,
-       4,     4,   645,     3,     8,     4,   216,   214,   214,     4,
-     638,   213,   213
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,   197,   205,   206,   256,   319,   320,
+     321,   324,   326,   328,   330,   331,   333,   334,   335,   336,
+     337,   338,   339,   340,   341,   342,   344,   345,   347,   349,
+     353,   354,   356,   357,   358,   359,   360,   361,   677,   686,
+     688,   319,     7,   315,   316,   317,     7,   415,   416,   417,
+       7,   450,   451,   452,     7,   474,   475,   476,     7,   440,
+     441,   442,   120,   221,   368,   369,   370,   371,   250,   121,
+     123,   370,   374,   375,   376,   377,   111,   362,   363,   364,
+       7,   555,   556,     7,   525,   526,   527,     7,   389,   390,
+     391,   131,   132,   133,   134,   135,   136,   405,   406,   407,
+     408,   409,   410,   411,   412,    21,   141,   142,   143,   144,
+     256,   333,   502,   504,   567,   568,   569,   572,   573,   575,
+     576,   147,   148,   149,   256,   382,   383,   384,   385,   386,
+     502,   504,   151,   152,   256,   502,   504,   580,   581,   584,
+     586,   154,   155,   156,   221,   502,   504,   591,   592,   593,
+     594,   596,   597,   603,     7,   641,   642,   319,   319,   199,
+     256,   502,   504,   582,   583,   584,   586,   588,   253,     7,
+     492,   493,   494,     7,   508,   509,   510,   125,   534,   550,
+     551,   315,     8,     8,     8,   322,   325,   327,   329,     4,
+       4,     4,     4,     4,   343,     4,     4,   346,   348,   350,
+       4,     4,     4,     4,     4,   355,     4,     4,     4,     4,
+       4,     4,     4,   687,   689,     3,     8,     8,   318,     6,
+       3,   418,     6,     3,   453,     6,     3,   477,     6,     3,
+     443,     6,     3,     3,     6,     6,     3,     6,   365,     3,
+       8,   557,     3,     6,   528,     6,     3,   392,     6,     3,
+       4,     4,     4,     4,     4,     4,     3,     8,   570,   574,
+       4,     4,     4,     3,     8,     4,     4,     4,     3,     8,
+     585,   587,     3,     8,     4,   595,     4,   598,     3,     8,
+       8,   643,     3,     6,     8,     8,     4,     3,     8,   221,
+     254,   255,   495,     6,     3,   511,     6,     3,   552,     8,
+       6,     4,     4,     4,     4,   222,   224,   222,   224,   222,
+       4,   222,   222,     4,     4,     4,   222,   222,   224,   222,
+     224,     4,   222,   224,   222,   224,   224,   224,   222,     4,
+       4,   320,   319,   317,   421,   417,   456,   452,   480,   476,
+     256,   269,   270,   271,   272,   273,   274,   275,   276,   277,
+     278,   279,   281,   282,   283,   284,   287,   289,   291,   293,
+     295,   331,   413,   425,   427,   429,   431,   433,   437,   444,
+     445,   472,   502,   504,   548,   442,   369,   375,     4,   363,
+     114,   115,   256,   331,   472,   502,   504,   558,   559,   560,
+     561,   562,   564,   556,   531,   527,   395,   391,   222,   222,
+     222,   222,   222,   222,   406,     4,     4,   222,   222,   222,
+     568,   224,   222,   222,   383,     4,     4,   581,   224,     4,
+     222,     4,   592,   181,   183,   184,   256,   331,   502,   504,
+     644,   645,   646,   647,   649,   642,   224,   583,     6,     3,
+     498,   494,   514,   510,     4,    22,    23,    24,    25,   323,
+     221,   221,   221,   221,   221,   221,   221,   221,   221,   221,
+       8,     8,     8,     8,     3,     8,   221,   563,     4,     8,
+       3,     8,     8,   138,   139,   140,   571,   221,   221,   221,
+     221,   241,   650,     4,   648,     3,     8,   221,     8,     8,
+     221,   445,     4,   224,   560,     4,   222,     4,   645,   221,
+       5,   221,     7,   651,   652,   653,     3,     6,   182,   185,
+     186,   187,   188,   654,   655,   656,   658,   659,   660,   661,
+     652,   657,     4,     4,     4,   662,     3,     8,     4,   224,
+     222,   222,     4,   655,   221,   221
   };
 
   const short
   Dhcp6Parser::yyr1_[] =
   {
-       0,   217,   219,   218,   220,   218,   221,   218,   222,   218,
-     223,   218,   224,   218,   225,   218,   226,   218,   227,   218,
-     228,   218,   229,   218,   230,   218,   231,   218,   232,   218,
-     233,   233,   233,   233,   233,   233,   233,   234,   236,   235,
-     237,   238,   238,   239,   239,   241,   240,   242,   242,   243,
-     243,   245,   244,   246,   246,   247,   247,   248,   250,   249,
-     251,   251,   252,   254,   253,   256,   255,   257,   257,   258,
-     258,   258,   258,   258,   258,   258,   258,   258,   258,   258,
-     258,   258,   258,   258,   258,   258,   258,   258,   258,   258,
-     258,   258,   258,   258,   258,   258,   258,   258,   258,   258,
-     258,   258,   258,   258,   258,   258,   258,   258,   258,   258,
-     258,   258,   258,   258,   258,   258,   258,   258,   258,   258,
-     258,   258,   258,   258,   258,   258,   258,   258,   258,   258,
-     258,   260,   259,   261,   262,   263,   264,   265,   266,   267,
-     268,   269,   270,   271,   272,   273,   274,   275,   277,   276,
-     278,   278,   278,   278,   278,   280,   279,   282,   281,   284,
-     283,   286,   285,   287,   288,   289,   291,   290,   293,   292,
-     295,   294,   296,   296,   297,   297,   297,   297,   297,   299,
-     298,   300,   302,   301,   304,   303,   306,   305,   307,   307,
-     308,   308,   310,   309,   311,   311,   312,   312,   312,   312,
-     312,   312,   312,   312,   312,   312,   312,   312,   312,   312,
-     312,   312,   312,   312,   312,   312,   312,   312,   312,   312,
-     314,   313,   315,   315,   315,   315,   317,   316,   319,   318,
-     321,   320,   322,   324,   323,   325,   326,   327,   328,   329,
-     330,   331,   332,   333,   335,   334,   336,   338,   337,   340,
-     339,   342,   341,   344,   343,   345,   345,   346,   348,   347,
-     350,   349,   351,   351,   352,   352,   353,   354,   356,   355,
-     357,   357,   358,   358,   358,   359,   360,   362,   361,   364,
-     363,   365,   365,   366,   366,   366,   366,   366,   366,   367,
-     368,   369,   371,   370,   372,   372,   373,   373,   375,   374,
-     377,   376,   378,   378,   378,   379,   379,   379,   379,   379,
-     381,   380,   383,   382,   385,   384,   387,   386,   388,   388,
-     389,   389,   389,   389,   389,   389,   390,   391,   392,   393,
-     394,   395,   397,   396,   398,   398,   399,   399,   401,   400,
-     403,   402,   404,   404,   405,   405,   405,   405,   405,   405,
-     405,   405,   405,   405,   405,   405,   405,   405,   405,   405,
-     405,   405,   405,   405,   405,   405,   405,   405,   405,   405,
-     405,   405,   405,   405,   405,   405,   405,   405,   405,   405,
-     405,   407,   406,   409,   408,   411,   410,   413,   412,   415,
-     414,   417,   416,   418,   418,   418,   418,   419,   420,   422,
-     421,   423,   423,   424,   424,   426,   425,   427,   427,   428,
-     428,   428,   428,   428,   428,   428,   428,   428,   428,   428,
-     428,   428,   428,   428,   428,   428,   428,   428,   428,   428,
-     428,   428,   428,   428,   428,   428,   428,   428,   428,   428,
-     428,   428,   430,   429,   432,   431,   433,   433,   434,   434,
-     436,   435,   438,   437,   439,   439,   440,   440,   441,   441,
-     441,   441,   441,   441,   441,   441,   441,   441,   442,   443,
-     444,   446,   445,   448,   447,   450,   449,   451,   453,   452,
-     454,   456,   455,   457,   457,   458,   458,   460,   459,   462,
-     461,   463,   463,   464,   464,   465,   465,   465,   465,   465,
-     465,   465,   465,   465,   466,   468,   467,   469,   470,   471,
-     472,   474,   473,   475,   475,   476,   476,   478,   477,   480,
-     479,   481,   481,   482,   482,   482,   482,   482,   482,   482,
-     482,   482,   484,   483,   486,   485,   488,   487,   490,   489,
-     491,   491,   492,   492,   494,   493,   496,   495,   497,   497,
-     498,   498,   498,   498,   498,   498,   498,   498,   498,   498,
-     498,   498,   498,   500,   499,   501,   503,   502,   504,   505,
-     507,   506,   508,   508,   509,   509,   511,   510,   513,   512,
-     514,   514,   515,   515,   516,   516,   516,   516,   516,   516,
-     516,   516,   516,   516,   516,   518,   517,   520,   519,   522,
-     521,   524,   523,   526,   525,   528,   527,   530,   529,   532,
-     531,   533,   533,   535,   534,   537,   536,   538,   538,   540,
-     539,   541,   541,   542,   542,   543,   543,   543,   543,   543,
-     543,   543,   544,   546,   545,   547,   549,   548,   550,   550,
-     551,   551,   551,   551,   551,   551,   551,   551,   551,   553,
-     552,   554,   554,   554,   555,   557,   556,   558,   559,   560,
-     562,   561,   563,   563,   564,   564,   564,   564,   564,   565,
-     565,   566,   566,   566,   566,   566,   566,   568,   567,   570,
-     569,   571,   573,   572,   574,   574,   575,   575,   575,   575,
-     575,   575,   576,   578,   577,   579,   581,   580,   583,   582,
-     585,   584,   586,   586,   587,   587,   587,   587,   587,   587,
-     587,   587,   587,   587,   587,   587,   587,   587,   587,   587,
-     587,   587,   588,   590,   589,   592,   591,   593,   595,   594,
-     596,   597,   599,   598,   600,   600,   602,   601,   603,   604,
-     606,   605,   608,   607,   610,   609,   612,   611,   614,   613,
-     616,   615,   617,   617,   618,   618,   620,   619,   621,   623,
-     622,   624,   624,   626,   625,   627,   627,   628,   628,   628,
-     628,   628,   628,   628,   629,   631,   630,   633,   632,   634,
-     634,   636,   635,   637,   637,   638,   638,   638,   638,   638,
-     640,   639,   641,   642,   643,   645,   644,   647,   646,   649,
-     648,   651,   650,   653,   652,   655,   654,   657,   656,   658,
-     659,   660,   662,   661,   663,   664,   666,   665,   667,   668,
-     670,   669,   672,   671
+       0,   225,   227,   226,   228,   226,   229,   226,   230,   226,
+     231,   226,   232,   226,   233,   226,   234,   226,   235,   226,
+     236,   226,   237,   226,   238,   226,   239,   226,   240,   226,
+     241,   241,   241,   241,   241,   241,   241,   242,   244,   243,
+     245,   246,   246,   247,   247,   249,   248,   250,   250,   251,
+     251,   253,   252,   254,   254,   255,   255,   256,   258,   257,
+     259,   259,   260,   262,   261,   264,   263,   265,   265,   266,
+     266,   266,   266,   266,   266,   266,   266,   266,   266,   266,
+     266,   266,   266,   266,   266,   266,   266,   266,   266,   266,
+     266,   266,   266,   266,   266,   266,   266,   266,   266,   266,
+     266,   266,   266,   266,   266,   266,   266,   266,   266,   266,
+     266,   266,   266,   266,   266,   266,   266,   266,   266,   266,
+     266,   266,   266,   266,   266,   266,   266,   266,   266,   266,
+     266,   268,   267,   269,   270,   271,   272,   273,   274,   275,
+     276,   277,   278,   279,   280,   281,   282,   283,   285,   284,
+     286,   286,   286,   286,   286,   288,   287,   290,   289,   292,
+     291,   294,   293,   295,   296,   297,   299,   298,   301,   300,
+     303,   302,   304,   304,   305,   305,   305,   305,   305,   307,
+     306,   308,   310,   309,   312,   311,   314,   313,   315,   315,
+     316,   316,   318,   317,   319,   319,   320,   320,   320,   320,
+     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
+     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
+     320,   320,   320,   320,   320,   320,   320,   320,   322,   321,
+     323,   323,   323,   323,   325,   324,   327,   326,   329,   328,
+     330,   332,   331,   333,   334,   335,   336,   337,   338,   339,
+     340,   341,   343,   342,   344,   346,   345,   348,   347,   350,
+     349,   352,   351,   353,   355,   354,   356,   357,   358,   359,
+     360,   361,   362,   362,   363,   365,   364,   367,   366,   368,
+     368,   369,   369,   370,   371,   373,   372,   374,   374,   375,
+     375,   375,   376,   377,   379,   378,   381,   380,   382,   382,
+     383,   383,   383,   383,   383,   383,   384,   385,   386,   388,
+     387,   389,   389,   390,   390,   392,   391,   394,   393,   395,
+     395,   395,   396,   396,   396,   396,   396,   398,   397,   400,
+     399,   402,   401,   404,   403,   405,   405,   406,   406,   406,
+     406,   406,   406,   407,   408,   409,   410,   411,   412,   414,
+     413,   415,   415,   416,   416,   418,   417,   420,   419,   421,
+     421,   422,   422,   422,   422,   422,   422,   422,   422,   422,
+     422,   422,   422,   422,   422,   422,   422,   422,   422,   422,
+     422,   422,   422,   422,   422,   422,   422,   422,   422,   422,
+     422,   422,   422,   422,   422,   422,   422,   422,   424,   423,
+     426,   425,   428,   427,   430,   429,   432,   431,   434,   433,
+     435,   435,   435,   435,   436,   437,   439,   438,   440,   440,
+     441,   441,   443,   442,   444,   444,   445,   445,   445,   445,
+     445,   445,   445,   445,   445,   445,   445,   445,   445,   445,
+     445,   445,   445,   445,   445,   445,   445,   445,   445,   445,
+     445,   445,   445,   445,   445,   445,   445,   445,   445,   447,
+     446,   449,   448,   450,   450,   451,   451,   453,   452,   455,
+     454,   456,   456,   457,   457,   458,   458,   458,   458,   458,
+     458,   458,   458,   458,   458,   459,   460,   461,   463,   462,
+     465,   464,   467,   466,   468,   470,   469,   471,   473,   472,
+     474,   474,   475,   475,   477,   476,   479,   478,   480,   480,
+     481,   481,   482,   482,   482,   482,   482,   482,   482,   482,
+     482,   483,   485,   484,   486,   487,   488,   489,   491,   490,
+     492,   492,   493,   493,   495,   494,   497,   496,   498,   498,
+     499,   499,   499,   499,   499,   499,   499,   499,   499,   501,
+     500,   503,   502,   505,   504,   507,   506,   508,   508,   509,
+     509,   511,   510,   513,   512,   514,   514,   515,   515,   515,
+     515,   515,   515,   515,   515,   515,   515,   515,   515,   515,
+     517,   516,   518,   520,   519,   521,   522,   524,   523,   525,
+     525,   526,   526,   528,   527,   530,   529,   531,   531,   532,
+     532,   533,   533,   533,   533,   533,   533,   533,   533,   533,
+     533,   533,   535,   534,   537,   536,   539,   538,   541,   540,
+     543,   542,   545,   544,   547,   546,   549,   548,   550,   550,
+     552,   551,   554,   553,   555,   555,   557,   556,   558,   558,
+     559,   559,   560,   560,   560,   560,   560,   560,   560,   561,
+     563,   562,   564,   566,   565,   567,   567,   568,   568,   568,
+     568,   568,   568,   568,   568,   568,   570,   569,   571,   571,
+     571,   572,   574,   573,   575,   576,   577,   579,   578,   580,
+     580,   581,   581,   581,   581,   581,   582,   582,   583,   583,
+     583,   583,   583,   583,   585,   584,   587,   586,   588,   590,
+     589,   591,   591,   592,   592,   592,   592,   592,   592,   593,
+     595,   594,   596,   598,   597,   600,   599,   602,   601,   603,
+     603,   604,   604,   604,   604,   604,   604,   604,   604,   604,
+     604,   604,   604,   604,   604,   604,   604,   604,   604,   605,
+     607,   606,   609,   608,   610,   612,   611,   613,   614,   616,
+     615,   617,   617,   619,   618,   620,   621,   623,   622,   625,
+     624,   627,   626,   629,   628,   631,   630,   633,   632,   634,
+     634,   635,   635,   637,   636,   638,   640,   639,   641,   641,
+     643,   642,   644,   644,   645,   645,   645,   645,   645,   645,
+     645,   646,   648,   647,   650,   649,   651,   651,   653,   652,
+     654,   654,   655,   655,   655,   655,   655,   657,   656,   658,
+     659,   660,   662,   661,   664,   663,   666,   665,   668,   667,
+     670,   669,   672,   671,   674,   673,   675,   676,   677,   679,
+     678,   680,   681,   683,   682,   684,   685,   687,   686,   689,
+     688
   };
 
   const signed char
@@ -5531,67 +5631,69 @@ namespace isc { namespace dhcp {
        1,     3,     0,     4,     1,     3,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       0,     4,     1,     1,     1,     1,     0,     4,     0,     4,
-       0,     4,     3,     0,     4,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     0,     4,     3,     0,     4,     0,
-       4,     0,     4,     0,     6,     1,     3,     1,     0,     4,
-       0,     6,     1,     3,     1,     1,     1,     1,     0,     6,
-       1,     3,     1,     1,     1,     1,     1,     0,     6,     0,
-       6,     1,     3,     1,     1,     1,     1,     1,     1,     3,
-       3,     3,     0,     6,     0,     1,     1,     3,     0,     4,
-       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
-       0,     4,     0,     4,     0,     4,     0,     6,     1,     3,
-       1,     1,     1,     1,     1,     1,     3,     3,     3,     3,
-       3,     3,     0,     6,     0,     1,     1,     3,     0,     4,
-       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     4,
+       1,     1,     1,     1,     0,     4,     0,     4,     0,     4,
+       3,     0,     4,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     0,     4,     3,     0,     4,     0,     4,     0,
+       4,     0,     6,     3,     0,     4,     3,     3,     3,     3,
+       3,     3,     1,     3,     1,     0,     4,     0,     6,     1,
+       3,     1,     1,     1,     1,     0,     6,     1,     3,     1,
+       1,     1,     1,     1,     0,     6,     0,     6,     1,     3,
+       1,     1,     1,     1,     1,     1,     3,     3,     3,     0,
+       6,     0,     1,     1,     3,     0,     4,     0,     4,     1,
+       3,     1,     1,     1,     1,     1,     1,     0,     4,     0,
+       4,     0,     4,     0,     6,     1,     3,     1,     1,     1,
+       1,     1,     1,     3,     3,     3,     3,     3,     3,     0,
+       6,     0,     1,     1,     3,     0,     4,     0,     4,     1,
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       4,     0,     4,     1,     1,     1,     1,     3,     3,     0,
-       6,     0,     1,     1,     3,     0,     4,     1,     3,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     4,
+       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
+       1,     1,     1,     1,     3,     3,     0,     6,     0,     1,
+       1,     3,     0,     4,     1,     3,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     0,     6,     0,     4,     0,     1,     1,     3,
-       0,     4,     0,     4,     0,     1,     1,     3,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     3,
-       1,     0,     4,     0,     4,     0,     4,     1,     0,     4,
-       3,     0,     6,     0,     1,     1,     3,     0,     4,     0,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
+       6,     0,     4,     0,     1,     1,     3,     0,     4,     0,
        4,     0,     1,     1,     3,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     0,     4,     1,     1,     3,
-       3,     0,     6,     0,     1,     1,     3,     0,     4,     0,
-       4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     0,     4,     0,     4,     0,     4,     0,     6,
+       1,     1,     1,     1,     1,     1,     3,     1,     0,     4,
+       0,     4,     0,     4,     1,     0,     4,     3,     0,     6,
+       0,     1,     1,     3,     0,     4,     0,     4,     0,     1,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     0,     4,     1,     1,     3,     3,     0,     6,
        0,     1,     1,     3,     0,     4,     0,     4,     1,     3,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     0,     4,     3,     0,     4,     3,     3,
-       0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
-       0,     1,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     0,     4,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       6,     1,     1,     0,     4,     0,     6,     1,     3,     0,
-       4,     0,     1,     1,     3,     1,     1,     1,     1,     1,
-       1,     1,     1,     0,     4,     3,     0,     6,     1,     3,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
-       4,     1,     1,     1,     3,     0,     4,     3,     3,     3,
-       0,     6,     1,     3,     1,     1,     1,     1,     1,     1,
-       3,     1,     1,     1,     1,     1,     1,     0,     4,     0,
-       4,     3,     0,     6,     1,     3,     1,     1,     1,     1,
-       1,     1,     3,     0,     4,     3,     0,     4,     0,     6,
-       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
+       4,     0,     4,     0,     4,     0,     6,     0,     1,     1,
+       3,     0,     4,     0,     4,     1,     3,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     3,     0,     4,     0,     4,     3,     0,     4,
-       3,     3,     0,     4,     1,     1,     0,     4,     3,     3,
-       0,     4,     0,     4,     0,     4,     0,     4,     0,     6,
-       0,     4,     1,     3,     1,     1,     0,     6,     3,     0,
-       6,     1,     3,     0,     4,     1,     3,     1,     1,     1,
-       1,     1,     1,     1,     3,     0,     4,     0,     6,     1,
-       3,     0,     4,     1,     3,     1,     1,     1,     1,     1,
-       0,     4,     3,     3,     3,     0,     4,     0,     4,     0,
-       6,     0,     4,     0,     4,     0,     4,     0,     6,     3,
-       3,     3,     0,     6,     3,     3,     0,     4,     3,     3,
-       0,     4,     0,     4
+       0,     4,     3,     0,     4,     3,     3,     0,     6,     0,
+       1,     1,     3,     0,     4,     0,     4,     0,     1,     1,
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     0,     4,     0,     4,     0,     4,     0,     4,
+       0,     4,     0,     4,     0,     4,     0,     6,     1,     1,
+       0,     4,     0,     6,     1,     3,     0,     4,     0,     1,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       0,     4,     3,     0,     6,     1,     3,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     0,     4,     1,     1,
+       1,     3,     0,     4,     3,     3,     3,     0,     6,     1,
+       3,     1,     1,     1,     1,     1,     1,     3,     1,     1,
+       1,     1,     1,     1,     0,     4,     0,     4,     3,     0,
+       6,     1,     3,     1,     1,     1,     1,     1,     1,     3,
+       0,     4,     3,     0,     4,     0,     6,     0,     4,     1,
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     3,
+       0,     4,     0,     4,     3,     0,     4,     3,     3,     0,
+       4,     1,     1,     0,     4,     3,     3,     0,     4,     0,
+       4,     0,     4,     0,     4,     0,     6,     0,     4,     1,
+       3,     1,     1,     0,     6,     3,     0,     6,     1,     3,
+       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
+       1,     3,     0,     4,     0,     6,     1,     3,     0,     4,
+       1,     3,     1,     1,     1,     1,     1,     0,     4,     3,
+       3,     3,     0,     4,     0,     4,     0,     6,     0,     4,
+       0,     4,     0,     4,     0,     6,     3,     3,     3,     0,
+       6,     3,     3,     0,     4,     3,     3,     0,     4,     0,
+       4
   };
 
 
@@ -5612,7 +5714,10 @@ namespace isc { namespace dhcp {
   "\"connect-timeout\"", "\"contact-points\"", "\"max-reconnect-tries\"",
   "\"reconnect-wait-time\"", "\"keyspace\"", "\"consistency\"",
   "\"serial-consistency\"", "\"request-timeout\"", "\"tcp-keepalive\"",
-  "\"tcp-nodelay\"", "\"max-row-errors\"", "\"preferred-lifetime\"",
+  "\"tcp-nodelay\"", "\"max-row-errors\"", "\"group-commit\"",
+  "\"fsync-policy\"", "\"fsync-interval\"", "\"wait-for-durability\"",
+  "\"lfc-threads\"", "\"lfc-snapshot\"", "\"lease-stats-counters\"",
+  "\"lease-expiration-buckets\"", "\"preferred-lifetime\"",
   "\"min-preferred-lifetime\"", "\"max-preferred-lifetime\"",
   "\"valid-lifetime\"", "\"min-valid-lifetime\"", "\"max-valid-lifetime\"",
   "\"renew-timer\"", "\"rebind-timer\"", "\"calculate-tee-times\"",
@@ -5698,181 +5803,186 @@ namespace isc { namespace dhcp {
   "readonly", "connect_timeout", "reconnect_wait_time", "max_row_errors",
   "request_timeout", "tcp_keepalive", "tcp_nodelay", "contact_points",
   "$@40", "max_reconnect_tries", "keyspace", "$@41", "consistency", "$@42",
-  "serial_consistency", "$@43", "sanity_checks", "$@44",
-  "sanity_checks_params", "sanity_checks_param", "lease_checks", "$@45",
-  "mac_sources", "$@46", "mac_sources_list", "mac_sources_value",
-  "duid_id", "string_id", "host_reservation_identifiers", "$@47",
+  "serial_consistency", "$@43", "sanity_checks", "$@44", "group_commit",
+  "fsync_policy", "$@45", "fsync_interval", "wait_for_durability",
+  "lfc_threads", "lfc_snapshot", "lease_stats_counters",
+  "lease_expiration_buckets", "sanity_checks_params",
+  "sanity_checks_param", "lease_checks", "$@46", "mac_sources", "$@47",
+  "mac_sources_list", "mac_sources_value", "duid_id", "string_id",
+  "host_reservation_identifiers", "$@48",
   "host_reservation_identifiers_list", "host_reservation_identifier",
-  "hw_address_id", "flex_id", "relay_supplied_options", "$@48",
-  "dhcp_multi_threading", "$@49", "multi_threading_params",
+  "hw_address_id", "flex_id", "relay_supplied_options", "$@49",
+  "dhcp_multi_threading", "$@50", "multi_threading_params",
   "multi_threading_param", "enable_multi_threading", "thread_pool_size",
-  "packet_queue_size", "hooks_libraries", "$@50", "hooks_libraries_list",
-  "not_empty_hooks_libraries_list", "hooks_library", "$@51",
-  "sub_hooks_library", "$@52", "hooks_params", "hooks_param", "library",
-  "$@53", "library-path", "$@54", "parameters", "$@55",
-  "expired_leases_processing", "$@56", "expired_leases_params",
+  "packet_queue_size", "hooks_libraries", "$@51", "hooks_libraries_list",
+  "not_empty_hooks_libraries_list", "hooks_library", "$@52",
+  "sub_hooks_library", "$@53", "hooks_params", "hooks_param", "library",
+  "$@54", "library-path", "$@55", "parameters", "$@56",
+  "expired_leases_processing", "$@57", "expired_leases_params",
   "expired_leases_param", "reclaim_timer_wait_time",
   "flush_reclaimed_timer_wait_time", "hold_reclaimed_time",
   "max_reclaim_leases", "max_reclaim_time", "unwarned_reclaim_cycles",
-  "subnet6_list", "$@57", "subnet6_list_content", "not_empty_subnet6_list",
-  "subnet6", "$@58", "sub_subnet6", "$@59", "subnet6_params",
-  "subnet6_param", "subnet", "$@60", "interface", "$@61", "interface_id",
-  "$@62", "client_class", "$@63", "require_client_classes", "$@64",
-  "reservation_mode", "$@65", "hr_mode", "id", "rapid_commit",
-  "shared_networks", "$@66", "shared_networks_content",
-  "shared_networks_list", "shared_network", "$@67",
+  "subnet6_list", "$@58", "subnet6_list_content", "not_empty_subnet6_list",
+  "subnet6", "$@59", "sub_subnet6", "$@60", "subnet6_params",
+  "subnet6_param", "subnet", "$@61", "interface", "$@62", "interface_id",
+  "$@63", "client_class", "$@64", "require_client_classes", "$@65",
+  "reservation_mode", "$@66", "hr_mode", "id", "rapid_commit",
+  "shared_networks", "$@67", "shared_networks_content",
+  "shared_networks_list", "shared_network", "$@68",
   "shared_network_params", "shared_network_param", "option_def_list",
-  "$@68", "sub_option_def_list", "$@69", "option_def_list_content",
-  "not_empty_option_def_list", "option_def_entry", "$@70",
-  "sub_option_def", "$@71", "option_def_params",
+  "$@69", "sub_option_def_list", "$@70", "option_def_list_content",
+  "not_empty_option_def_list", "option_def_entry", "$@71",
+  "sub_option_def", "$@72", "option_def_params",
   "not_empty_option_def_params", "option_def_param", "option_def_name",
-  "code", "option_def_code", "option_def_type", "$@72",
-  "option_def_record_types", "$@73", "space", "$@74", "option_def_space",
-  "option_def_encapsulate", "$@75", "option_def_array", "option_data_list",
-  "$@76", "option_data_list_content", "not_empty_option_data_list",
-  "option_data_entry", "$@77", "sub_option_data", "$@78",
+  "code", "option_def_code", "option_def_type", "$@73",
+  "option_def_record_types", "$@74", "space", "$@75", "option_def_space",
+  "option_def_encapsulate", "$@76", "option_def_array", "option_data_list",
+  "$@77", "option_data_list_content", "not_empty_option_data_list",
+  "option_data_entry", "$@78", "sub_option_data", "$@79",
   "option_data_params", "not_empty_option_data_params",
-  "option_data_param", "option_data_name", "option_data_data", "$@79",
+  "option_data_param", "option_data_name", "option_data_data", "$@80",
   "option_data_code", "option_data_space", "option_data_csv_format",
-  "option_data_always_send", "pools_list", "$@80", "pools_list_content",
-  "not_empty_pools_list", "pool_list_entry", "$@81", "sub_pool6", "$@82",
-  "pool_params", "pool_param", "pool_entry", "$@83", "user_context",
-  "$@84", "comment", "$@85", "pd_pools_list", "$@86",
+  "option_data_always_send", "pools_list", "$@81", "pools_list_content",
+  "not_empty_pools_list", "pool_list_entry", "$@82", "sub_pool6", "$@83",
+  "pool_params", "pool_param", "pool_entry", "$@84", "user_context",
+  "$@85", "comment", "$@86", "pd_pools_list", "$@87",
   "pd_pools_list_content", "not_empty_pd_pools_list", "pd_pool_entry",
-  "$@87", "sub_pd_pool", "$@88", "pd_pool_params", "pd_pool_param",
-  "pd_prefix", "$@89", "pd_prefix_len", "excluded_prefix", "$@90",
-  "excluded_prefix_len", "pd_delegated_len", "reservations", "$@91",
+  "$@88", "sub_pd_pool", "$@89", "pd_pool_params", "pd_pool_param",
+  "pd_prefix", "$@90", "pd_prefix_len", "excluded_prefix", "$@91",
+  "excluded_prefix_len", "pd_delegated_len", "reservations", "$@92",
   "reservations_list", "not_empty_reservations_list", "reservation",
-  "$@92", "sub_reservation", "$@93", "reservation_params",
+  "$@93", "sub_reservation", "$@94", "reservation_params",
   "not_empty_reservation_params", "reservation_param", "ip_addresses",
-  "$@94", "prefixes", "$@95", "duid", "$@96", "hw_address", "$@97",
-  "hostname", "$@98", "flex_id_value", "$@99",
-  "reservation_client_classes", "$@100", "relay", "$@101", "relay_map",
-  "ip_address", "$@102", "client_classes", "$@103", "client_classes_list",
-  "client_class_entry", "$@104", "client_class_params",
+  "$@95", "prefixes", "$@96", "duid", "$@97", "hw_address", "$@98",
+  "hostname", "$@99", "flex_id_value", "$@100",
+  "reservation_client_classes", "$@101", "relay", "$@102", "relay_map",
+  "ip_address", "$@103", "client_classes", "$@104", "client_classes_list",
+  "client_class_entry", "$@105", "client_class_params",
   "not_empty_client_class_params", "client_class_param",
-  "client_class_name", "client_class_test", "$@105", "only_if_required",
-  "server_id", "$@106", "server_id_params", "server_id_param",
-  "server_id_type", "$@107", "duid_type", "htype", "identifier", "$@108",
-  "time", "enterprise_id", "dhcp4o6_port", "control_socket", "$@109",
+  "client_class_name", "client_class_test", "$@106", "only_if_required",
+  "server_id", "$@107", "server_id_params", "server_id_param",
+  "server_id_type", "$@108", "duid_type", "htype", "identifier", "$@109",
+  "time", "enterprise_id", "dhcp4o6_port", "control_socket", "$@110",
   "control_socket_params", "control_socket_param",
   "notifications_control_socket_params",
-  "notifications_control_socket_param", "socket_type", "$@110",
-  "socket_name", "$@111", "on-boot-request-configuration-from-kea-netconf",
-  "dhcp_queue_control", "$@112", "queue_control_params",
-  "queue_control_param", "enable_queue", "queue_type", "$@113", "capacity",
-  "arbitrary_map_entry", "$@114", "dhcp_ddns", "$@115", "sub_dhcp_ddns",
-  "$@116", "dhcp_ddns_params", "dhcp_ddns_param", "enable_updates",
-  "qualifying_suffix", "$@117", "server_ip", "$@118", "server_port",
-  "sender_ip", "$@119", "sender_port", "max_queue_size", "ncr_protocol",
-  "$@120", "ncr_protocol_value", "ncr_format", "$@121",
+  "notifications_control_socket_param", "socket_type", "$@111",
+  "socket_name", "$@112", "on-boot-request-configuration-from-kea-netconf",
+  "dhcp_queue_control", "$@113", "queue_control_params",
+  "queue_control_param", "enable_queue", "queue_type", "$@114", "capacity",
+  "arbitrary_map_entry", "$@115", "dhcp_ddns", "$@116", "sub_dhcp_ddns",
+  "$@117", "dhcp_ddns_params", "dhcp_ddns_param", "enable_updates",
+  "qualifying_suffix", "$@118", "server_ip", "$@119", "server_port",
+  "sender_ip", "$@120", "sender_port", "max_queue_size", "ncr_protocol",
+  "$@121", "ncr_protocol_value", "ncr_format", "$@122",
   "dep_override_no_update", "dep_override_client_update",
-  "dep_replace_client_name", "$@122", "dep_generated_prefix", "$@123",
-  "dep_hostname_char_set", "$@124", "dep_hostname_char_replacement",
-  "$@125", "config_control", "$@126", "sub_config_control", "$@127",
+  "dep_replace_client_name", "$@123", "dep_generated_prefix", "$@124",
+  "dep_hostname_char_set", "$@125", "dep_hostname_char_replacement",
+  "$@126", "config_control", "$@127", "sub_config_control", "$@128",
   "config_control_params", "config_control_param", "config_databases",
-  "$@128", "config_fetch_wait_time", "loggers", "$@129", "loggers_entries",
-  "logger_entry", "$@130", "logger_params", "logger_param", "debuglevel",
-  "severity", "$@131", "output_options_list", "$@132",
-  "output_options_list_content", "output_entry", "$@133",
-  "output_params_list", "output_params", "output", "$@134", "flush",
-  "maxsize", "maxver", "pattern", "$@135", "allocation_type", "$@136",
-  "config_database", "$@137", "configuration_type", "$@138", "instance_id",
-  "$@139", "lawful-interception-parameters", "$@140", "master_database",
-  "$@141", "max_address_utilization", "max_pd_space_utilization",
-  "max_statement_tries", "notifications", "$@142",
+  "$@129", "config_fetch_wait_time", "loggers", "$@130", "loggers_entries",
+  "logger_entry", "$@131", "logger_params", "logger_param", "debuglevel",
+  "severity", "$@132", "output_options_list", "$@133",
+  "output_options_list_content", "output_entry", "$@134",
+  "output_params_list", "output_params", "output", "$@135", "flush",
+  "maxsize", "maxver", "pattern", "$@136", "allocation_type", "$@137",
+  "config_database", "$@138", "configuration_type", "$@139", "instance_id",
+  "$@140", "lawful-interception-parameters", "$@141", "master_database",
+  "$@142", "max_address_utilization", "max_pd_space_utilization",
+  "max_statement_tries", "notifications", "$@143",
   "option_set_description", "option_set_id", "policy-engine-parameters",
-  "$@143", "privacy_history_size", "privacy_valid_lifetime", "protocol",
-  "$@144", "ssl_cert", "$@145", YY_NULLPTR
+  "$@144", "privacy_history_size", "privacy_valid_lifetime", "protocol",
+  "$@145", "ssl_cert", "$@146", YY_NULLPTR
   };
 
 #if PARSER6_DEBUG
   const short
   Dhcp6Parser::yyrline_[] =
   {
-       0,   304,   304,   304,   305,   305,   306,   306,   307,   307,
-     308,   308,   309,   309,   310,   310,   311,   311,   312,   312,
-     313,   313,   314,   314,   315,   315,   316,   316,   317,   317,
-     325,   326,   327,   328,   329,   330,   331,   334,   339,   339,
-     350,   353,   354,   357,   361,   368,   368,   375,   376,   379,
-     383,   390,   390,   397,   398,   401,   405,   416,   425,   425,
-     440,   441,   445,   448,   448,   465,   465,   474,   475,   480,
-     481,   482,   483,   484,   485,   486,   487,   488,   489,   490,
-     491,   492,   493,   494,   495,   496,   497,   498,   499,   500,
-     501,   502,   503,   504,   505,   506,   507,   508,   509,   510,
-     511,   512,   513,   514,   515,   516,   517,   518,   519,   520,
-     521,   522,   523,   524,   525,   526,   527,   528,   529,   530,
-     531,   532,   533,   534,   535,   536,   537,   538,   539,   540,
-     541,   544,   544,   552,   557,   562,   567,   572,   577,   582,
-     587,   592,   597,   602,   607,   612,   617,   622,   627,   627,
-     635,   638,   641,   644,   647,   653,   653,   661,   661,   669,
-     669,   677,   677,   685,   690,   695,   700,   700,   708,   708,
-     719,   719,   728,   729,   732,   733,   734,   735,   736,   739,
-     739,   749,   754,   754,   766,   766,   778,   778,   788,   789,
-     792,   793,   796,   796,   806,   807,   810,   811,   812,   813,
-     814,   815,   816,   817,   818,   819,   820,   821,   822,   823,
-     824,   825,   826,   827,   828,   829,   830,   831,   832,   833,
-     836,   836,   843,   844,   845,   846,   849,   849,   857,   857,
-     865,   865,   873,   878,   878,   886,   891,   896,   901,   906,
-     911,   916,   921,   926,   931,   931,   939,   944,   944,   952,
-     952,   960,   960,   968,   968,   978,   979,   981,   983,   983,
-    1001,  1001,  1011,  1012,  1015,  1016,  1019,  1024,  1029,  1029,
-    1039,  1040,  1043,  1044,  1045,  1048,  1053,  1060,  1060,  1072,
-    1072,  1084,  1085,  1088,  1089,  1090,  1091,  1092,  1093,  1096,
-    1101,  1106,  1111,  1111,  1121,  1122,  1125,  1126,  1129,  1129,
-    1140,  1140,  1151,  1152,  1153,  1156,  1157,  1158,  1159,  1160,
-    1163,  1163,  1171,  1171,  1179,  1179,  1187,  1187,  1198,  1199,
-    1202,  1203,  1204,  1205,  1206,  1207,  1210,  1215,  1220,  1225,
-    1230,  1235,  1243,  1243,  1256,  1257,  1260,  1261,  1268,  1268,
-    1294,  1294,  1305,  1306,  1310,  1311,  1312,  1313,  1314,  1315,
-    1316,  1317,  1318,  1319,  1320,  1321,  1322,  1323,  1324,  1325,
-    1326,  1327,  1328,  1329,  1330,  1331,  1332,  1333,  1334,  1335,
-    1336,  1337,  1338,  1339,  1340,  1341,  1342,  1343,  1344,  1345,
-    1346,  1349,  1349,  1357,  1357,  1365,  1365,  1373,  1373,  1381,
-    1381,  1391,  1391,  1398,  1399,  1400,  1401,  1404,  1409,  1416,
-    1416,  1427,  1428,  1432,  1433,  1436,  1436,  1444,  1445,  1448,
-    1449,  1450,  1451,  1452,  1453,  1454,  1455,  1456,  1457,  1458,
-    1459,  1460,  1461,  1462,  1463,  1464,  1465,  1466,  1467,  1468,
-    1469,  1470,  1471,  1472,  1473,  1474,  1475,  1476,  1477,  1478,
-    1479,  1480,  1487,  1487,  1500,  1500,  1509,  1510,  1513,  1514,
-    1519,  1519,  1534,  1534,  1548,  1549,  1552,  1553,  1556,  1557,
-    1558,  1559,  1560,  1561,  1562,  1563,  1564,  1565,  1568,  1570,
-    1575,  1577,  1577,  1585,  1585,  1593,  1593,  1601,  1603,  1603,
-    1611,  1620,  1620,  1632,  1633,  1638,  1639,  1644,  1644,  1656,
-    1656,  1668,  1669,  1674,  1675,  1680,  1681,  1682,  1683,  1684,
-    1685,  1686,  1687,  1688,  1691,  1693,  1693,  1701,  1703,  1705,
-    1710,  1718,  1718,  1730,  1731,  1734,  1735,  1738,  1738,  1748,
-    1748,  1758,  1759,  1762,  1763,  1764,  1765,  1766,  1767,  1768,
-    1769,  1770,  1773,  1773,  1781,  1781,  1806,  1806,  1836,  1836,
-    1848,  1849,  1852,  1853,  1856,  1856,  1868,  1868,  1880,  1881,
-    1884,  1885,  1886,  1887,  1888,  1889,  1890,  1891,  1892,  1893,
-    1894,  1895,  1896,  1899,  1899,  1907,  1912,  1912,  1920,  1925,
-    1933,  1933,  1943,  1944,  1947,  1948,  1951,  1951,  1960,  1960,
-    1969,  1970,  1973,  1974,  1978,  1979,  1980,  1981,  1982,  1983,
-    1984,  1985,  1986,  1987,  1988,  1991,  1991,  2001,  2001,  2011,
-    2011,  2019,  2019,  2027,  2027,  2035,  2035,  2043,  2043,  2056,
-    2056,  2066,  2067,  2070,  2070,  2081,  2081,  2091,  2092,  2095,
-    2095,  2105,  2106,  2109,  2110,  2113,  2114,  2115,  2116,  2117,
-    2118,  2119,  2122,  2124,  2124,  2132,  2140,  2140,  2152,  2153,
-    2156,  2157,  2158,  2159,  2160,  2161,  2162,  2163,  2164,  2167,
-    2167,  2174,  2175,  2176,  2179,  2184,  2184,  2192,  2197,  2204,
-    2211,  2211,  2221,  2222,  2225,  2226,  2227,  2228,  2229,  2232,
-    2233,  2236,  2237,  2238,  2239,  2240,  2241,  2244,  2244,  2252,
-    2252,  2260,  2267,  2267,  2279,  2280,  2283,  2284,  2285,  2286,
-    2287,  2288,  2291,  2296,  2296,  2304,  2309,  2309,  2318,  2318,
-    2330,  2330,  2340,  2341,  2344,  2345,  2346,  2347,  2348,  2349,
-    2350,  2351,  2352,  2353,  2354,  2355,  2356,  2357,  2358,  2359,
-    2360,  2361,  2364,  2369,  2369,  2377,  2377,  2385,  2390,  2390,
-    2398,  2403,  2408,  2408,  2416,  2417,  2420,  2420,  2429,  2435,
-    2441,  2441,  2449,  2449,  2458,  2458,  2467,  2467,  2478,  2478,
-    2489,  2489,  2499,  2500,  2504,  2505,  2508,  2508,  2518,  2525,
-    2525,  2537,  2538,  2542,  2542,  2550,  2551,  2554,  2555,  2556,
-    2557,  2558,  2559,  2560,  2563,  2568,  2568,  2576,  2576,  2586,
-    2587,  2590,  2590,  2598,  2599,  2602,  2603,  2604,  2605,  2606,
-    2609,  2609,  2617,  2622,  2627,  2632,  2632,  2642,  2642,  2650,
-    2650,  2660,  2660,  2668,  2668,  2677,  2677,  2684,  2684,  2694,
-    2699,  2704,  2709,  2709,  2719,  2724,  2729,  2729,  2736,  2741,
-    2746,  2746,  2754,  2754
+       0,   312,   312,   312,   313,   313,   314,   314,   315,   315,
+     316,   316,   317,   317,   318,   318,   319,   319,   320,   320,
+     321,   321,   322,   322,   323,   323,   324,   324,   325,   325,
+     333,   334,   335,   336,   337,   338,   339,   342,   347,   347,
+     358,   361,   362,   365,   369,   376,   376,   383,   384,   387,
+     391,   398,   398,   405,   406,   409,   413,   424,   433,   433,
+     448,   449,   453,   456,   456,   473,   473,   482,   483,   488,
+     489,   490,   491,   492,   493,   494,   495,   496,   497,   498,
+     499,   500,   501,   502,   503,   504,   505,   506,   507,   508,
+     509,   510,   511,   512,   513,   514,   515,   516,   517,   518,
+     519,   520,   521,   522,   523,   524,   525,   526,   527,   528,
+     529,   530,   531,   532,   533,   534,   535,   536,   537,   538,
+     539,   540,   541,   542,   543,   544,   545,   546,   547,   548,
+     549,   552,   552,   560,   565,   570,   575,   580,   585,   590,
+     595,   600,   605,   610,   615,   620,   625,   630,   635,   635,
+     643,   646,   649,   652,   655,   661,   661,   669,   669,   677,
+     677,   685,   685,   693,   698,   703,   708,   708,   716,   716,
+     727,   727,   736,   737,   740,   741,   742,   743,   744,   747,
+     747,   757,   762,   762,   774,   774,   786,   786,   796,   797,
+     800,   801,   804,   804,   814,   815,   818,   819,   820,   821,
+     822,   823,   824,   825,   826,   827,   828,   829,   830,   831,
+     832,   833,   834,   835,   836,   837,   838,   839,   840,   841,
+     842,   843,   844,   845,   846,   847,   848,   849,   852,   852,
+     859,   860,   861,   862,   865,   865,   873,   873,   881,   881,
+     889,   894,   894,   902,   907,   912,   917,   922,   927,   932,
+     937,   942,   947,   947,   955,   960,   960,   968,   968,   976,
+     976,   984,   984,   994,   999,   999,  1007,  1012,  1017,  1022,
+    1027,  1032,  1037,  1038,  1040,  1042,  1042,  1060,  1060,  1070,
+    1071,  1074,  1075,  1078,  1083,  1088,  1088,  1098,  1099,  1102,
+    1103,  1104,  1107,  1112,  1119,  1119,  1131,  1131,  1143,  1144,
+    1147,  1148,  1149,  1150,  1151,  1152,  1155,  1160,  1165,  1170,
+    1170,  1180,  1181,  1184,  1185,  1188,  1188,  1199,  1199,  1210,
+    1211,  1212,  1215,  1216,  1217,  1218,  1219,  1222,  1222,  1230,
+    1230,  1238,  1238,  1246,  1246,  1257,  1258,  1261,  1262,  1263,
+    1264,  1265,  1266,  1269,  1274,  1279,  1284,  1289,  1294,  1302,
+    1302,  1315,  1316,  1319,  1320,  1327,  1327,  1353,  1353,  1364,
+    1365,  1369,  1370,  1371,  1372,  1373,  1374,  1375,  1376,  1377,
+    1378,  1379,  1380,  1381,  1382,  1383,  1384,  1385,  1386,  1387,
+    1388,  1389,  1390,  1391,  1392,  1393,  1394,  1395,  1396,  1397,
+    1398,  1399,  1400,  1401,  1402,  1403,  1404,  1405,  1408,  1408,
+    1416,  1416,  1424,  1424,  1432,  1432,  1440,  1440,  1450,  1450,
+    1457,  1458,  1459,  1460,  1463,  1468,  1475,  1475,  1486,  1487,
+    1491,  1492,  1495,  1495,  1503,  1504,  1507,  1508,  1509,  1510,
+    1511,  1512,  1513,  1514,  1515,  1516,  1517,  1518,  1519,  1520,
+    1521,  1522,  1523,  1524,  1525,  1526,  1527,  1528,  1529,  1530,
+    1531,  1532,  1533,  1534,  1535,  1536,  1537,  1538,  1539,  1546,
+    1546,  1559,  1559,  1568,  1569,  1572,  1573,  1578,  1578,  1593,
+    1593,  1607,  1608,  1611,  1612,  1615,  1616,  1617,  1618,  1619,
+    1620,  1621,  1622,  1623,  1624,  1627,  1629,  1634,  1636,  1636,
+    1644,  1644,  1652,  1652,  1660,  1662,  1662,  1670,  1679,  1679,
+    1691,  1692,  1697,  1698,  1703,  1703,  1715,  1715,  1727,  1728,
+    1733,  1734,  1739,  1740,  1741,  1742,  1743,  1744,  1745,  1746,
+    1747,  1750,  1752,  1752,  1760,  1762,  1764,  1769,  1777,  1777,
+    1789,  1790,  1793,  1794,  1797,  1797,  1807,  1807,  1817,  1818,
+    1821,  1822,  1823,  1824,  1825,  1826,  1827,  1828,  1829,  1832,
+    1832,  1840,  1840,  1865,  1865,  1895,  1895,  1907,  1908,  1911,
+    1912,  1915,  1915,  1927,  1927,  1939,  1940,  1943,  1944,  1945,
+    1946,  1947,  1948,  1949,  1950,  1951,  1952,  1953,  1954,  1955,
+    1958,  1958,  1966,  1971,  1971,  1979,  1984,  1992,  1992,  2002,
+    2003,  2006,  2007,  2010,  2010,  2019,  2019,  2028,  2029,  2032,
+    2033,  2037,  2038,  2039,  2040,  2041,  2042,  2043,  2044,  2045,
+    2046,  2047,  2050,  2050,  2060,  2060,  2070,  2070,  2078,  2078,
+    2086,  2086,  2094,  2094,  2102,  2102,  2115,  2115,  2125,  2126,
+    2129,  2129,  2140,  2140,  2150,  2151,  2154,  2154,  2164,  2165,
+    2168,  2169,  2172,  2173,  2174,  2175,  2176,  2177,  2178,  2181,
+    2183,  2183,  2191,  2199,  2199,  2211,  2212,  2215,  2216,  2217,
+    2218,  2219,  2220,  2221,  2222,  2223,  2226,  2226,  2233,  2234,
+    2235,  2238,  2243,  2243,  2251,  2256,  2263,  2270,  2270,  2280,
+    2281,  2284,  2285,  2286,  2287,  2288,  2291,  2292,  2295,  2296,
+    2297,  2298,  2299,  2300,  2303,  2303,  2311,  2311,  2319,  2326,
+    2326,  2338,  2339,  2342,  2343,  2344,  2345,  2346,  2347,  2350,
+    2355,  2355,  2363,  2368,  2368,  2377,  2377,  2389,  2389,  2399,
+    2400,  2403,  2404,  2405,  2406,  2407,  2408,  2409,  2410,  2411,
+    2412,  2413,  2414,  2415,  2416,  2417,  2418,  2419,  2420,  2423,
+    2428,  2428,  2436,  2436,  2444,  2449,  2449,  2457,  2462,  2467,
+    2467,  2475,  2476,  2479,  2479,  2488,  2494,  2500,  2500,  2508,
+    2508,  2517,  2517,  2526,  2526,  2537,  2537,  2548,  2548,  2558,
+    2559,  2563,  2564,  2567,  2567,  2577,  2584,  2584,  2596,  2597,
+    2601,  2601,  2609,  2610,  2613,  2614,  2615,  2616,  2617,  2618,
+    2619,  2622,  2627,  2627,  2635,  2635,  2645,  2646,  2649,  2649,
+    2657,  2658,  2661,  2662,  2663,  2664,  2665,  2668,  2668,  2676,
+    2681,  2686,  2691,  2691,  2701,  2701,  2709,  2709,  2719,  2719,
+    2727,  2727,  2736,  2736,  2743,  2743,  2753,  2758,  2763,  2768,
+    2768,  2778,  2783,  2788,  2788,  2795,  2800,  2805,  2805,  2813,
+    2813
   };
 
   // Print the state stack on the debug stream.
@@ -5907,9 +6017,9 @@ namespace isc { namespace dhcp {
 
 #line 14 "dhcp6_parser.yy"
 } } // isc::dhcp
-#line 5911 "dhcp6_parser.cc"
+#line 6021 "dhcp6_parser.cc"
 
-#line 2762 "dhcp6_parser.yy"
+#line 2821 "dhcp6_parser.yy"
 
 
 void
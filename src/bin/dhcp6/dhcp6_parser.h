@@ -512,179 +512,187 @@ namespace isc { namespace dhcp {
         TOKEN_TCP_KEEPALIVE = 296,
         TOKEN_TCP_NODELAY = 297,
         TOKEN_MAX_ROW_ERRORS = 298,
-        TOKEN_PREFERRED_LIFETIME = 299,
-        TOKEN_MIN_PREFERRED_LIFETIME = 300,
-        TOKEN_MAX_PREFERRED_LIFETIME = 301,
-        TOKEN_VALID_LIFETIME = 302,
-        TOKEN_MIN_VALID_LIFETIME = 303,
-        TOKEN_MAX_VALID_LIFETIME = 304,
-        TOKEN_RENEW_TIMER = 305,
-        TOKEN_REBIND_TIMER = 306,
-        TOKEN_CALCULATE_TEE_TIMES = 307,
-        TOKEN_T1_PERCENT = 308,
-        TOKEN_T2_PERCENT = 309,
-        TOKEN_DECLINE_PROBATION_PERIOD = 310,
-        TOKEN_SERVER_TAG = 311,
-        TOKEN_STATISTIC_DEFAULT_SAMPLE_COUNT = 312,
-        TOKEN_STATISTIC_DEFAULT_SAMPLE_AGE = 313,
-        TOKEN_DDNS_SEND_UPDATES = 314,
-        TOKEN_DDNS_OVERRIDE_NO_UPDATE = 315,
-        TOKEN_DDNS_OVERRIDE_CLIENT_UPDATE = 316,
-        TOKEN_DDNS_REPLACE_CLIENT_NAME = 317,
-        TOKEN_DDNS_GENERATED_PREFIX = 318,
-        TOKEN_DDNS_QUALIFYING_SUFFIX = 319,
-        TOKEN_STORE_EXTENDED_INFO = 320,
-        TOKEN_SUBNET6 = 321,
-        TOKEN_OPTION_DEF = 322,
-        TOKEN_OPTION_DATA = 323,
-        TOKEN_NAME = 324,
-        TOKEN_DATA = 325,
-        TOKEN_CODE = 326,
-        TOKEN_SPACE = 327,
-        TOKEN_CSV_FORMAT = 328,
-        TOKEN_ALWAYS_SEND = 329,
-        TOKEN_RECORD_TYPES = 330,
-        TOKEN_ENCAPSULATE = 331,
-        TOKEN_ARRAY = 332,
-        TOKEN_POOLS = 333,
-        TOKEN_POOL = 334,
-        TOKEN_PD_POOLS = 335,
-        TOKEN_PREFIX = 336,
-        TOKEN_PREFIX_LEN = 337,
-        TOKEN_EXCLUDED_PREFIX = 338,
-        TOKEN_EXCLUDED_PREFIX_LEN = 339,
-        TOKEN_DELEGATED_LEN = 340,
-        TOKEN_USER_CONTEXT = 341,
-        TOKEN_COMMENT = 342,
-        TOKEN_SUBNET = 343,
-        TOKEN_INTERFACE = 344,
-        TOKEN_INTERFACE_ID = 345,
-        TOKEN_ID = 346,
-        TOKEN_RAPID_COMMIT = 347,
-        TOKEN_RESERVATION_MODE = 348,
-        TOKEN_DISABLED = 349,
-        TOKEN_OUT_OF_POOL = 350,
-        TOKEN_GLOBAL = 351,
-        TOKEN_ALL = 352,
-        TOKEN_SHARED_NETWORKS = 353,
-        TOKEN_MAC_SOURCES = 354,
-        TOKEN_RELAY_SUPPLIED_OPTIONS = 355,
-        TOKEN_HOST_RESERVATION_IDENTIFIERS = 356,
-        TOKEN_SANITY_CHECKS = 357,
-        TOKEN_LEASE_CHECKS = 358,
-        TOKEN_CLIENT_CLASSES = 359,
-        TOKEN_REQUIRE_CLIENT_CLASSES = 360,
-        TOKEN_TEST = 361,
-        TOKEN_ONLY_IF_REQUIRED = 362,
-        TOKEN_CLIENT_CLASS = 363,
-        TOKEN_RESERVATIONS = 364,
-        TOKEN_IP_ADDRESSES = 365,
-        TOKEN_PREFIXES = 366,
-        TOKEN_DUID = 367,
-        TOKEN_HW_ADDRESS = 368,
-        TOKEN_HOSTNAME = 369,
-        TOKEN_FLEX_ID = 370,
-        TOKEN_RELAY = 371,
-        TOKEN_IP_ADDRESS = 372,
-        TOKEN_HOOKS_LIBRARIES = 373,
-        TOKEN_LIBRARY = 374,
-        TOKEN_LIBRARY_PATH = 375,
-        TOKEN_PARAMETERS = 376,
-        TOKEN_EXPIRED_LEASES_PROCESSING = 377,
-        TOKEN_RECLAIM_TIMER_WAIT_TIME = 378,
-        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 379,
-        TOKEN_HOLD_RECLAIMED_TIME = 380,
-        TOKEN_MAX_RECLAIM_LEASES = 381,
-        TOKEN_MAX_RECLAIM_TIME = 382,
-        TOKEN_UNWARNED_RECLAIM_CYCLES = 383,
-        TOKEN_SERVER_ID = 384,
-        TOKEN_LLT = 385,
-        TOKEN_EN = 386,
-        TOKEN_LL = 387,
-        TOKEN_IDENTIFIER = 388,
-        TOKEN_HTYPE = 389,
-        TOKEN_TIME = 390,
-        TOKEN_ENTERPRISE_ID = 391,
-        TOKEN_DHCP4O6_PORT = 392,
-        TOKEN_DHCP_MULTI_THREADING = 393,
-        TOKEN_ENABLE_MULTI_THREADING = 394,
-        TOKEN_THREAD_POOL_SIZE = 395,
-        TOKEN_PACKET_QUEUE_SIZE = 396,
-        TOKEN_CONTROL_SOCKET = 397,
-        TOKEN_SOCKET_TYPE = 398,
-        TOKEN_SOCKET_NAME = 399,
-        TOKEN_DHCP_QUEUE_CONTROL = 400,
-        TOKEN_ENABLE_QUEUE = 401,
-        TOKEN_QUEUE_TYPE = 402,
-        TOKEN_CAPACITY = 403,
-        TOKEN_DHCP_DDNS = 404,
-        TOKEN_ENABLE_UPDATES = 405,
-        TOKEN_QUALIFYING_SUFFIX = 406,
-        TOKEN_SERVER_IP = 407,
-        TOKEN_SERVER_PORT = 408,
-        TOKEN_SENDER_IP = 409,
-        TOKEN_SENDER_PORT = 410,
-        TOKEN_MAX_QUEUE_SIZE = 411,
-        TOKEN_NCR_PROTOCOL = 412,
-        TOKEN_NCR_FORMAT = 413,
-        TOKEN_OVERRIDE_NO_UPDATE = 414,
-        TOKEN_OVERRIDE_CLIENT_UPDATE = 415,
-        TOKEN_REPLACE_CLIENT_NAME = 416,
-        TOKEN_GENERATED_PREFIX = 417,
-        TOKEN_UDP = 418,
-        TOKEN_TCP = 419,
-        TOKEN_JSON = 420,
-        TOKEN_WHEN_PRESENT = 421,
-        TOKEN_NEVER = 422,
-        TOKEN_ALWAYS = 423,
-        TOKEN_WHEN_NOT_PRESENT = 424,
-        TOKEN_HOSTNAME_CHAR_SET = 425,
-        TOKEN_HOSTNAME_CHAR_REPLACEMENT = 426,
-        TOKEN_LOGGERS = 427,
-        TOKEN_OUTPUT_OPTIONS = 428,
-        TOKEN_OUTPUT = 429,
-        TOKEN_DEBUGLEVEL = 430,
-        TOKEN_SEVERITY = 431,
-        TOKEN_FLUSH = 432,
-        TOKEN_MAXSIZE = 433,
-        TOKEN_MAXVER = 434,
-        TOKEN_PATTERN = 435,
-        TOKEN_ALLOCATION_TYPE = 436,
-        TOKEN_CONFIG_DATABASE = 437,
-        TOKEN_CONFIGURATION_TYPE = 438,
-        TOKEN_INSTANCE_ID = 439,
-        TOKEN_LAWFUL_INTERCEPTION_PARAMETERS = 440,
-        TOKEN_MASTER_DATABASE = 441,
-        TOKEN_MAX_ADDRESS_UTILIZATION = 442,
-        TOKEN_MAX_PD_SPACE_UTILIZATION = 443,
-        TOKEN_MAX_STATEMENT_TRIES = 444,
-        TOKEN_NOTIFICATIONS = 445,
-        TOKEN_ON_BOOT_REQUEST_CONFIGURATION_FROM_KEA_NETCONF = 446,
-        TOKEN_OPTION_SET_DESCRIPTION = 447,
-        TOKEN_OPTION_SET_ID = 448,
-        TOKEN_POLICY_ENGINE_PARAMETERS = 449,
-        TOKEN_PRIVACY_HISTORY_SIZE = 450,
-        TOKEN_PRIVACY_VALID_LIFETIME = 451,
-        TOKEN_PROTOCOL = 452,
-        TOKEN_SSL_CERT = 453,
-        TOKEN_TOPLEVEL_JSON = 454,
-        TOKEN_TOPLEVEL_DHCP6 = 455,
-        TOKEN_SUB_DHCP6 = 456,
-        TOKEN_SUB_INTERFACES6 = 457,
-        TOKEN_SUB_SUBNET6 = 458,
-        TOKEN_SUB_POOL6 = 459,
-        TOKEN_SUB_PD_POOL = 460,
-        TOKEN_SUB_RESERVATION = 461,
-        TOKEN_SUB_OPTION_DEFS = 462,
-        TOKEN_SUB_OPTION_DEF = 463,
-        TOKEN_SUB_OPTION_DATA = 464,
-        TOKEN_SUB_HOOKS_LIBRARY = 465,
-        TOKEN_SUB_DHCP_DDNS = 466,
-        TOKEN_SUB_CONFIG_CONTROL = 467,
-        TOKEN_STRING = 468,
-        TOKEN_INTEGER = 469,
-        TOKEN_FLOAT = 470,
-        TOKEN_BOOLEAN = 471
+        TOKEN_GROUP_COMMIT = 299,
+        TOKEN_FSYNC_POLICY = 300,
+        TOKEN_FSYNC_INTERVAL = 301,
+        TOKEN_WAIT_FOR_DURABILITY = 302,
+        TOKEN_LFC_THREADS = 303,
+        TOKEN_LFC_SNAPSHOT = 304,
+        TOKEN_LEASE_STATS_COUNTERS = 305,
+        TOKEN_LEASE_EXPIRATION_BUCKETS = 306,
+        TOKEN_PREFERRED_LIFETIME = 307,
+        TOKEN_MIN_PREFERRED_LIFETIME = 308,
+        TOKEN_MAX_PREFERRED_LIFETIME = 309,
+        TOKEN_VALID_LIFETIME = 310,
+        TOKEN_MIN_VALID_LIFETIME = 311,
+        TOKEN_MAX_VALID_LIFETIME = 312,
+        TOKEN_RENEW_TIMER = 313,
+        TOKEN_REBIND_TIMER = 314,
+        TOKEN_CALCULATE_TEE_TIMES = 315,
+        TOKEN_T1_PERCENT = 316,
+        TOKEN_T2_PERCENT = 317,
+        TOKEN_DECLINE_PROBATION_PERIOD = 318,
+        TOKEN_SERVER_TAG = 319,
+        TOKEN_STATISTIC_DEFAULT_SAMPLE_COUNT = 320,
+        TOKEN_STATISTIC_DEFAULT_SAMPLE_AGE = 321,
+        TOKEN_DDNS_SEND_UPDATES = 322,
+        TOKEN_DDNS_OVERRIDE_NO_UPDATE = 323,
+        TOKEN_DDNS_OVERRIDE_CLIENT_UPDATE = 324,
+        TOKEN_DDNS_REPLACE_CLIENT_NAME = 325,
+        TOKEN_DDNS_GENERATED_PREFIX = 326,
+        TOKEN_DDNS_QUALIFYING_SUFFIX = 327,
+        TOKEN_STORE_EXTENDED_INFO = 328,
+        TOKEN_SUBNET6 = 329,
+        TOKEN_OPTION_DEF = 330,
+        TOKEN_OPTION_DATA = 331,
+        TOKEN_NAME = 332,
+        TOKEN_DATA = 333,
+        TOKEN_CODE = 334,
+        TOKEN_SPACE = 335,
+        TOKEN_CSV_FORMAT = 336,
+        TOKEN_ALWAYS_SEND = 337,
+        TOKEN_RECORD_TYPES = 338,
+        TOKEN_ENCAPSULATE = 339,
+        TOKEN_ARRAY = 340,
+        TOKEN_POOLS = 341,
+        TOKEN_POOL = 342,
+        TOKEN_PD_POOLS = 343,
+        TOKEN_PREFIX = 344,
+        TOKEN_PREFIX_LEN = 345,
+        TOKEN_EXCLUDED_PREFIX = 346,
+        TOKEN_EXCLUDED_PREFIX_LEN = 347,
+        TOKEN_DELEGATED_LEN = 348,
+        TOKEN_USER_CONTEXT = 349,
+        TOKEN_COMMENT = 350,
+        TOKEN_SUBNET = 351,
+        TOKEN_INTERFACE = 352,
+        TOKEN_INTERFACE_ID = 353,
+        TOKEN_ID = 354,
+        TOKEN_RAPID_COMMIT = 355,
+        TOKEN_RESERVATION_MODE = 356,
+        TOKEN_DISABLED = 357,
+        TOKEN_OUT_OF_POOL = 358,
+        TOKEN_GLOBAL = 359,
+        TOKEN_ALL = 360,
+        TOKEN_SHARED_NETWORKS = 361,
+        TOKEN_MAC_SOURCES = 362,
+        TOKEN_RELAY_SUPPLIED_OPTIONS = 363,
+        TOKEN_HOST_RESERVATION_IDENTIFIERS = 364,
+        TOKEN_SANITY_CHECKS = 365,
+        TOKEN_LEASE_CHECKS = 366,
+        TOKEN_CLIENT_CLASSES = 367,
+        TOKEN_REQUIRE_CLIENT_CLASSES = 368,
+        TOKEN_TEST = 369,
+        TOKEN_ONLY_IF_REQUIRED = 370,
+        TOKEN_CLIENT_CLASS = 371,
+        TOKEN_RESERVATIONS = 372,
+        TOKEN_IP_ADDRESSES = 373,
+        TOKEN_PREFIXES = 374,
+        TOKEN_DUID = 375,
+        TOKEN_HW_ADDRESS = 376,
+        TOKEN_HOSTNAME = 377,
+        TOKEN_FLEX_ID = 378,
+        TOKEN_RELAY = 379,
+        TOKEN_IP_ADDRESS = 380,
+        TOKEN_HOOKS_LIBRARIES = 381,
+        TOKEN_LIBRARY = 382,
+        TOKEN_LIBRARY_PATH = 383,
+        TOKEN_PARAMETERS = 384,
+        TOKEN_EXPIRED_LEASES_PROCESSING = 385,
+        TOKEN_RECLAIM_TIMER_WAIT_TIME = 386,
+        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 387,
+        TOKEN_HOLD_RECLAIMED_TIME = 388,
+        TOKEN_MAX_RECLAIM_LEASES = 389,
+        TOKEN_MAX_RECLAIM_TIME = 390,
+        TOKEN_UNWARNED_RECLAIM_CYCLES = 391,
+        TOKEN_SERVER_ID = 392,
+        TOKEN_LLT = 393,
+        TOKEN_EN = 394,
+        TOKEN_LL = 395,
+        TOKEN_IDENTIFIER = 396,
+        TOKEN_HTYPE = 397,
+        TOKEN_TIME = 398,
+        TOKEN_ENTERPRISE_ID = 399,
+        TOKEN_DHCP4O6_PORT = 400,
+        TOKEN_DHCP_MULTI_THREADING = 401,
+        TOKEN_ENABLE_MULTI_THREADING = 402,
+        TOKEN_THREAD_POOL_SIZE = 403,
+        TOKEN_PACKET_QUEUE_SIZE = 404,
+        TOKEN_CONTROL_SOCKET = 405,
+        TOKEN_SOCKET_TYPE = 406,
+        TOKEN_SOCKET_NAME = 407,
+        TOKEN_DHCP_QUEUE_CONTROL = 408,
+        TOKEN_ENABLE_QUEUE = 409,
+        TOKEN_QUEUE_TYPE = 410,
+        TOKEN_CAPACITY = 411,
+        TOKEN_DHCP_DDNS = 412,
+        TOKEN_ENABLE_UPDATES = 413,
+        TOKEN_QUALIFYING_SUFFIX = 414,
+        TOKEN_SERVER_IP = 415,
+        TOKEN_SERVER_PORT = 416,
+        TOKEN_SENDER_IP = 417,
+        TOKEN_SENDER_PORT = 418,
+        TOKEN_MAX_QUEUE_SIZE = 419,
+        TOKEN_NCR_PROTOCOL = 420,
+        TOKEN_NCR_FORMAT = 421,
+        TOKEN_OVERRIDE_NO_UPDATE = 422,
+        TOKEN_OVERRIDE_CLIENT_UPDATE = 423,
+        TOKEN_REPLACE_CLIENT_NAME = 424,
+        TOKEN_GENERATED_PREFIX = 425,
+        TOKEN_UDP = 426,
+        TOKEN_TCP = 427,
+        TOKEN_JSON = 428,
+        TOKEN_WHEN_PRESENT = 429,
+        TOKEN_NEVER = 430,
+        TOKEN_ALWAYS = 431,
+        TOKEN_WHEN_NOT_PRESENT = 432,
+        TOKEN_HOSTNAME_CHAR_SET = 433,
+        TOKEN_HOSTNAME_CHAR_REPLACEMENT = 434,
+        TOKEN_LOGGERS = 435,
+        TOKEN_OUTPUT_OPTIONS = 436,
+        TOKEN_OUTPUT = 437,
+        TOKEN_DEBUGLEVEL = 438,
+        TOKEN_SEVERITY = 439,
+        TOKEN_FLUSH = 440,
+        TOKEN_MAXSIZE = 441,
+        TOKEN_MAXVER = 442,
+        TOKEN_PATTERN = 443,
+        TOKEN_ALLOCATION_TYPE = 444,
+        TOKEN_CONFIG_DATABASE = 445,
+        TOKEN_CONFIGURATION_TYPE = 446,
+        TOKEN_INSTANCE_ID = 447,
+        TOKEN_LAWFUL_INTERCEPTION_PARAMETERS = 448,
+        TOKEN_MASTER_DATABASE = 449,
+        TOKEN_MAX_ADDRESS_UTILIZATION = 450,
+        TOKEN_MAX_PD_SPACE_UTILIZATION = 451,
+        TOKEN_MAX_STATEMENT_TRIES = 452,
+        TOKEN_NOTIFICATIONS = 453,
+        TOKEN_ON_BOOT_REQUEST_CONFIGURATION_FROM_KEA_NETCONF = 454,
+        TOKEN_OPTION_SET_DESCRIPTION = 455,
+        TOKEN_OPTION_SET_ID = 456,
+        TOKEN_POLICY_ENGINE_PARAMETERS = 457,
+        TOKEN_PRIVACY_HISTORY_SIZE = 458,
+        TOKEN_PRIVACY_VALID_LIFETIME = 459,
+        TOKEN_PROTOCOL = 460,
+        TOKEN_SSL_CERT = 461,
+        TOKEN_TOPLEVEL_JSON = 462,
+        TOKEN_TOPLEVEL_DHCP6 = 463,
+        TOKEN_SUB_DHCP6 = 464,
+        TOKEN_SUB_INTERFACES6 = 465,
+        TOKEN_SUB_SUBNET6 = 466,
+        TOKEN_SUB_POOL6 = 467,
+        TOKEN_SUB_PD_POOL = 468,
+        TOKEN_SUB_RESERVATION = 469,
+        TOKEN_SUB_OPTION_DEFS = 470,
+        TOKEN_SUB_OPTION_DEF = 471,
+        TOKEN_SUB_OPTION_DATA = 472,
+        TOKEN_SUB_HOOKS_LIBRARY = 473,
+        TOKEN_SUB_DHCP_DDNS = 474,
+        TOKEN_SUB_CONFIG_CONTROL = 475,
+        TOKEN_STRING = 476,
+        TOKEN_INTEGER = 477,
+        TOKEN_FLOAT = 478,
+        TOKEN_BOOLEAN = 479
       };
     };
 
@@ -826,29 +834,29 @@ namespace isc { namespace dhcp {
         // Type destructor.
 switch (yytype)
     {
-      case 233: // value
-      case 237: // map_value
-      case 278: // ddns_replace_client_name_value
-      case 315: // db_type
-      case 418: // hr_mode
-      case 554: // duid_type
-      case 600: // ncr_protocol_value
+      case 241: // value
+      case 245: // map_value
+      case 286: // ddns_replace_client_name_value
+      case 323: // db_type
+      case 435: // hr_mode
+      case 571: // duid_type
+      case 617: // ncr_protocol_value
         value.template destroy< ElementPtr > ();
         break;
 
-      case 216: // "boolean"
+      case 224: // "boolean"
         value.template destroy< bool > ();
         break;
 
-      case 215: // "floating point"
+      case 223: // "floating point"
         value.template destroy< double > ();
         break;
 
-      case 214: // "integer"
+      case 222: // "integer"
         value.template destroy< int64_t > ();
         break;
 
-      case 213: // "constant string"
+      case 221: // "constant string"
         value.template destroy< std::string > ();
         break;
 
@@ -1656,6 +1664,126 @@ switch (yytype)
         return symbol_type (token::TOKEN_MAX_ROW_ERRORS, l);
       }
 #endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_GROUP_COMMIT (location_type l)
+      {
+        return symbol_type (token::TOKEN_GROUP_COMMIT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_GROUP_COMMIT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_GROUP_COMMIT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FSYNC_POLICY (location_type l)
+      {
+        return symbol_type (token::TOKEN_FSYNC_POLICY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FSYNC_POLICY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FSYNC_POLICY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FSYNC_INTERVAL (location_type l)
+      {
+        return symbol_type (token::TOKEN_FSYNC_INTERVAL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FSYNC_INTERVAL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FSYNC_INTERVAL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_WAIT_FOR_DURABILITY (location_type l)
+      {
+        return symbol_type (token::TOKEN_WAIT_FOR_DURABILITY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_WAIT_FOR_DURABILITY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_WAIT_FOR_DURABILITY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LFC_THREADS (location_type l)
+      {
+        return symbol_type (token::TOKEN_LFC_THREADS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LFC_THREADS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LFC_THREADS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LFC_SNAPSHOT (location_type l)
+      {
+        return symbol_type (token::TOKEN_LFC_SNAPSHOT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LFC_SNAPSHOT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LFC_SNAPSHOT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LEASE_STATS_COUNTERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_LEASE_STATS_COUNTERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LEASE_STATS_COUNTERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LEASE_STATS_COUNTERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LEASE_EXPIRATION_BUCKETS (location_type l)
+      {
+        return symbol_type (token::TOKEN_LEASE_EXPIRATION_BUCKETS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LEASE_EXPIRATION_BUCKETS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LEASE_EXPIRATION_BUCKETS, l);
+      }
+#endif
 #if 201103L <= YY_CPLUSPLUS
       static
       symbol_type
@@ -4557,10 +4685,10 @@ switch (yytype)
     enum
     {
       yyeof_ = 0,
-      yylast_ = 1325,     ///< Last index in yytable_.
-      yynnts_ = 456,  ///< Number of nonterminal symbols.
+      yylast_ = 1358,     ///< Last index in yytable_.
+      yynnts_ = 465,  ///< Number of nonterminal symbols.
       yyfinal_ = 30, ///< Termination state number.
-      yyntokens_ = 217  ///< Number of tokens.
+      yyntokens_ = 225  ///< Number of tokens.
     };
 
 
@@ -4625,9 +4753,9 @@ switch (yytype)
      185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
      195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
      205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
-     215,   216
+     215,   216,   217,   218,   219,   220,   221,   222,   223,   224
     };
-    const int user_token_number_max_ = 471;
+    const int user_token_number_max_ = 479;
 
     if (t <= 0)
       return yyeof_;
@@ -4647,29 +4775,29 @@ switch (yytype)
   {
     switch (this->type_get ())
     {
-      case 233: // value
-      case 237: // map_value
-      case 278: // ddns_replace_client_name_value
-      case 315: // db_type
-      case 418: // hr_mode
-      case 554: // duid_type
-      case 600: // ncr_protocol_value
+      case 241: // value
+      case 245: // map_value
+      case 286: // ddns_replace_client_name_value
+      case 323: // db_type
+      case 435: // hr_mode
+      case 571: // duid_type
+      case 617: // ncr_protocol_value
         value.move< ElementPtr > (std::move (that.value));
         break;
 
-      case 216: // "boolean"
+      case 224: // "boolean"
         value.move< bool > (std::move (that.value));
         break;
 
-      case 215: // "floating point"
+      case 223: // "floating point"
         value.move< double > (std::move (that.value));
         break;
 
-      case 214: // "integer"
+      case 222: // "integer"
         value.move< int64_t > (std::move (that.value));
         break;
 
-      case 213: // "constant string"
+      case 221: // "constant string"
         value.move< std::string > (std::move (that.value));
         break;
 
@@ -4688,29 +4816,29 @@ switch (yytype)
   {
     switch (this->type_get ())
     {
-      case 233: // value
-      case 237: // map_value
-      case 278: // ddns_replace_client_name_value
-      case 315: // db_type
-      case 418: // hr_mode
-      case 554: // duid_type
-      case 600: // ncr_protocol_value
+      case 241: // value
+      case 245: // map_value
+      case 286: // ddns_replace_client_name_value
+      case 323: // db_type
+      case 435: // hr_mode
+      case 571: // duid_type
+      case 617: // ncr_protocol_value
         value.copy< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 216: // "boolean"
+      case 224: // "boolean"
         value.copy< bool > (YY_MOVE (that.value));
         break;
 
-      case 215: // "floating point"
+      case 223: // "floating point"
         value.copy< double > (YY_MOVE (that.value));
         break;
 
-      case 214: // "integer"
+      case 222: // "integer"
         value.copy< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 213: // "constant string"
+      case 221: // "constant string"
         value.copy< std::string > (YY_MOVE (that.value));
         break;
 
@@ -4736,29 +4864,29 @@ switch (yytype)
     super_type::move (s);
     switch (this->type_get ())
     {
-      case 233: // value
-      case 237: // map_value
-      case 278: // ddns_replace_client_name_value
-      case 315: // db_type
-      case 418: // hr_mode
-      case 554: // duid_type
-      case 600: // ncr_protocol_value
+      case 241: // value
+      case 245: // map_value
+      case 286: // ddns_replace_client_name_value
+      case 323: // db_type
+      case 435: // hr_mode
+      case 571: // duid_type
+      case 617: // ncr_protocol_value
         value.move< ElementPtr > (YY_MOVE (s.value));
         break;
 
-      case 216: // "boolean"
+      case 224: // "boolean"
         value.move< bool > (YY_MOVE (s.value));
         break;
 
-      case 215: // "floating point"
+      case 223: // "floating point"
         value.move< double > (YY_MOVE (s.value));
         break;
 
-      case 214: // "integer"
+      case 222: // "integer"
         value.move< int64_t > (YY_MOVE (s.value));
         break;
 
-      case 213: // "constant string"
+      case 221: // "constant string"
         value.move< std::string > (YY_MOVE (s.value));
         break;
 
@@ -4818,7 +4946,7 @@ switch (yytype)
 
 #line 14 "dhcp6_parser.yy"
 } } // isc::dhcp
-#line 4822 "dhcp6_parser.h"
+#line 4950 "dhcp6_parser.h"
 
 
 
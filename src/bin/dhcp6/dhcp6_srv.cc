@@ -43,8 +43,10 @@
 #include <dhcpsrv/master_config_mgr_factory.h>
 #include <dhcpsrv/ncr_generator.h>
 #include <dhcpsrv/notifications_manager.h>
+#include <dhcpsrv/resolved_options_cache.h>
 #include <dhcpsrv/shard_config_mgr.h>
 #include <dhcpsrv/shard_config_mgr_factory.h>
+#include <dhcpsrv/stage_latency.h>
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/subnet_selector.h>
 #include <dhcpsrv/utils.h>
@@ -105,7 +107,8 @@ using isc::data::Element;
 
 namespace {
 
-/// Structure that holds registered hook indexes
+/// Structure that holds registered hook indexes and the arguments they
+/// pass to the callouts
 struct Dhcp6Hooks {
     int hook_index_buffer6_receive_;  ///< index for "buffer6_receive" hook point
     int hook_index_pkt6_receive_;     ///< index for "pkt6_receive" hook point
@@ -117,17 +120,110 @@ struct Dhcp6Hooks {
     int hook_index_lease6_decline_;   ///< index for "lease6_decline" hook point
     int hook_index_host6_identifier_; ///< index for "host6_identifier" hook point
 
+    /// Arguments of the "buffer6_receive" hook point
+    CalloutArgument<Pkt6Ptr> buffer6_receive_query6_;
+
+    /// Arguments of the "pkt6_receive" hook point
+    CalloutArgument<Pkt6Ptr> pkt6_receive_query6_;
+
+    /// Arguments of the "subnet6_select" hook point
+    CalloutArgument<Pkt6Ptr> subnet6_select_query6_;
+    CalloutArgument<Subnet6Ptr> subnet6_select_subnet6_;
+    CalloutArgument<const Subnet6Collection*> subnet6_select_subnet6collection_;
+
+    /// Arguments of the "leases6_committed" hook point
+    CalloutArgument<Pkt6Ptr> leases6_committed_query6_;
+    CalloutArgument<Lease6CollectionPtr> leases6_committed_leases6_;
+    CalloutArgument<Lease6CollectionPtr> leases6_committed_deleted_leases6_;
+
+    /// Arguments of the "lease6_release" hook point
+    CalloutArgument<Pkt6Ptr> lease6_release_query6_;
+    CalloutArgument<Lease6Ptr> lease6_release_lease6_;
+
+    /// Arguments of the "pkt6_send" hook point
+    CalloutArgument<Pkt6Ptr> pkt6_send_query6_;
+    CalloutArgument<Pkt6Ptr> pkt6_send_response6_;
+
+    /// Arguments of the "buffer6_send" hook point
+    CalloutArgument<Pkt6Ptr> buffer6_send_response6_;
+
+    /// Arguments of the "lease6_decline" hook point
+    CalloutArgument<Pkt6Ptr> lease6_decline_query6_;
+    CalloutArgument<Lease6Ptr> lease6_decline_lease6_;
+
+    /// Arguments of the "host6_identifier" hook point
+    CalloutArgument<Pkt6Ptr> host6_identifier_query6_;
+    CalloutArgument<Host::IdentifierType> host6_identifier_id_type_;
+    CalloutArgument<std::vector<uint8_t>> host6_identifier_id_value_;
+
     /// Constructor that registers hook points for DHCPv6 engine
     Dhcp6Hooks() {
-        hook_index_buffer6_receive_   = HooksManager::registerHook("buffer6_receive");
-        hook_index_pkt6_receive_      = HooksManager::registerHook("pkt6_receive");
-        hook_index_subnet6_select_    = HooksManager::registerHook("subnet6_select");
-        hook_index_leases6_committed_ = HooksManager::registerHook("leases6_committed");
-        hook_index_lease6_release_    = HooksManager::registerHook("lease6_release");
-        hook_index_pkt6_send_         = HooksManager::registerHook("pkt6_send");
-        hook_index_buffer6_send_      = HooksManager::registerHook("buffer6_send");
-        hook_index_lease6_decline_    = HooksManager::registerHook("lease6_decline");
-        hook_index_host6_identifier_  = HooksManager::registerHook("host6_identifier");
+        hook_index_buffer6_receive_   = HooksManager::registerHook("buffer6_receive",
+                                                                   { "query6" });
+        hook_index_pkt6_receive_      = HooksManager::registerHook("pkt6_receive",
+                                                                   { "query6" });
+        hook_index_subnet6_select_    = HooksManager::registerHook("subnet6_select",
+                                                                   { "query6",
+                                                                     "subnet6",
+                                                                     "subnet6collection" });
+        hook_index_leases6_committed_ = HooksManager::registerHook("leases6_committed",
+                                                                   { "query6",
+                                                                     "leases6",
+                                                                     "deleted_leases6" });
+        hook_index_lease6_release_    = HooksManager::registerHook("lease6_release",
+                                                                   { "query6",
+                                                                     "lease6" });
+        hook_index_pkt6_send_         = HooksManager::registerHook("pkt6_send",
+                                                                   { "query6",
+                                                                     "response6" });
+        hook_index_buffer6_send_      = HooksManager::registerHook("buffer6_send",
+                                                                   { "response6" });
+        hook_index_lease6_decline_    = HooksManager::registerHook("lease6_decline",
+                                                                   { "query6",
+                                                                     "lease6" });
+        hook_index_host6_identifier_  = HooksManager::registerHook("host6_identifier",
+                                                                   { "query6",
+                                                                     "id_type",
+                                                                     "id_value" });
+
+        buffer6_receive_query6_ = HooksManager::getArgument<Pkt6Ptr>(
+            hook_index_buffer6_receive_, "query6");
+        pkt6_receive_query6_ = HooksManager::getArgument<Pkt6Ptr>(
+            hook_index_pkt6_receive_, "query6");
+        subnet6_select_query6_ = HooksManager::getArgument<Pkt6Ptr>(
+            hook_index_subnet6_select_, "query6");
+        subnet6_select_subnet6_ = HooksManager::getArgument<Subnet6Ptr>(
+            hook_index_subnet6_select_, "subnet6");
+        subnet6_select_subnet6collection_ =
+            HooksManager::getArgument<const Subnet6Collection*>(
+                hook_index_subnet6_select_, "subnet6collection");
+        leases6_committed_query6_ = HooksManager::getArgument<Pkt6Ptr>(
+            hook_index_leases6_committed_, "query6");
+        leases6_committed_leases6_ = HooksManager::getArgument<Lease6CollectionPtr>(
+            hook_index_leases6_committed_, "leases6");
+        leases6_committed_deleted_leases6_ =
+            HooksManager::getArgument<Lease6CollectionPtr>(
+                hook_index_leases6_committed_, "deleted_leases6");
+        lease6_release_query6_ = HooksManager::getArgument<Pkt6Ptr>(
+            hook_index_lease6_release_, "query6");
+        lease6_release_lease6_ = HooksManager::getArgument<Lease6Ptr>(
+            hook_index_lease6_release_, "lease6");
+        pkt6_send_query6_ = HooksManager::getArgument<Pkt6Ptr>(
+            hook_index_pkt6_send_, "query6");
+        pkt6_send_response6_ = HooksManager::getArgument<Pkt6Ptr>(
+            hook_index_pkt6_send_, "response6");
+        buffer6_send_response6_ = HooksManager::getArgument<Pkt6Ptr>(
+            hook_index_buffer6_send_, "response6");
+        lease6_decline_query6_ = HooksManager::getArgument<Pkt6Ptr>(
+            hook_index_lease6_decline_, "query6");
+        lease6_decline_lease6_ = HooksManager::getArgument<Lease6Ptr>(
+            hook_index_lease6_decline_, "lease6");
+        host6_identifier_query6_ = HooksManager::getArgument<Pkt6Ptr>(
+            hook_index_host6_identifier_, "query6");
+        host6_identifier_id_type_ = HooksManager::getArgument<Host::IdentifierType>(
+            hook_index_host6_identifier_, "id_type");
+        host6_identifier_id_value_ = HooksManager::getArgument<std::vector<uint8_t>>(
+            hook_index_host6_identifier_, "id_value");
     }
 };
 
@@ -442,16 +538,16 @@ Dhcpv6Srv::initContext(const Pkt6Ptr& pkt,
                     ScopedCalloutHandleState callout_handle_state(callout_handle);
 
                     // Pass incoming packet as argument
-                    callout_handle->setArgument("query6", pkt);
-                    callout_handle->setArgument("id_type", type);
-                    callout_handle->setArgument("id_value", id);
+                    callout_handle->setArgument(Hooks.host6_identifier_query6_, pkt);
+                    callout_handle->setArgument(Hooks.host6_identifier_id_type_, type);
+                    callout_handle->setArgument(Hooks.host6_identifier_id_value_, id);
 
                     // Call callouts
                     HooksManager::callCallouts(Hooks.hook_index_host6_identifier_,
                                                *callout_handle);
 
-                    callout_handle->getArgument("id_type", type);
-                    callout_handle->getArgument("id_value", id);
+                    callout_handle->getArgument(Hooks.host6_identifier_id_type_, type);
+                    callout_handle->getArgument(Hooks.host6_identifier_id_value_, id);
 
                     if ((callout_handle->getStatus() == CalloutHandle::NEXT_STEP_CONTINUE) &&
                         !id.empty()) {
@@ -685,12 +781,16 @@ Dhcpv6Srv::processPacketAndSendResponseNoThrow(Pkt6Ptr& query) {
 
 void
 Dhcpv6Srv::processPacketAndSendResponse(Pkt6Ptr& query) {
+    // The packet is processed using the configuration which is current
+    // now, even if a new configuration is committed meanwhile.
+    CfgSnapshot snapshot;
     Pkt6Ptr rsp;
 #ifdef ENABLE_DEBUG
     LOG_DEBUG(packet6_logger, isc::log::DBGLVL_TRACE_DETAIL_DATA,
               "[thread %1] processPacketAndSendResponse() started...")
         .arg(std::this_thread::get_id());
 #endif  // ENABLE_DEBUG
+    StageLatencyTimer total_timer(StageLatency::TOTAL);
     auto start(std::chrono::steady_clock::now());
     processPacket(query, rsp);
     auto end(std::chrono::steady_clock::now());
@@ -727,6 +827,8 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
     // The packet has just been received so contains the uninterpreted wire
     // data; execute callouts registered for buffer6_receive.
     if (HooksManager::calloutsPresent(Hooks.hook_index_buffer6_receive_)) {
+        StageLatencyTimer hooks_timer(StageLatency::HOOKS);
+
         CalloutHandlePtr callout_handle = getCalloutHandle(query);
 
         // Use the RAII wrapper to make sure that the callout handle state is
@@ -739,7 +841,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
         ScopedEnableOptionsCopy<Pkt6> query6_options_copy(query);
 
         // Pass incoming packet as argument
-        callout_handle->setArgument("query6", query);
+        callout_handle->setArgument(Hooks.buffer6_receive_query6_, query);
 
         // Call callouts
         HooksManager::callCallouts(Hooks.hook_index_buffer6_receive_, *callout_handle);
@@ -771,7 +873,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
             return;
         }
 
-        callout_handle->getArgument("query6", query);
+        callout_handle->getArgument(Hooks.buffer6_receive_query6_, query);
     }
 
     // Unpack the packet information unless the buffer6_receive callouts
@@ -847,6 +949,8 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
     // the various packet fields and option objects has been created.
     // Execute callouts registered for packet6_receive.
     if (HooksManager::calloutsPresent(Hooks.hook_index_pkt6_receive_)) {
+        StageLatencyTimer hooks_timer(StageLatency::HOOKS);
+
         CalloutHandlePtr callout_handle = getCalloutHandle(query);
 
         // Use the RAII wrapper to make sure that the callout handle state is
@@ -859,7 +963,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
         ScopedEnableOptionsCopy<Pkt6> query6_options_copy(query);
 
         // Pass incoming packet as argument
-        callout_handle->setArgument("query6", query);
+        callout_handle->setArgument(Hooks.pkt6_receive_query6_, query);
 
         // Call callouts
         HooksManager::callCallouts(Hooks.hook_index_pkt6_receive_, *callout_handle);
@@ -877,7 +981,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
             return;
         }
 
-        callout_handle->getArgument("query6", query);
+        callout_handle->getArgument(Hooks.pkt6_receive_query6_, query);
     }
 
     // Reject the message if it doesn't pass the sanity check.
@@ -1134,6 +1238,8 @@ Dhcpv6Srv::processDhcp6Query(Pkt6Ptr& query, Pkt6Ptr& rsp) {
     if (!ctx.fake_allocation_ && (ctx.query_->getType() != DHCPV6_CONFIRM) &&
         (ctx.query_->getType() != DHCPV6_INFORMATION_REQUEST) &&
         HooksManager::calloutsPresent(Hooks.hook_index_leases6_committed_)) {
+        StageLatencyTimer hooks_timer(StageLatency::HOOKS);
+
         CalloutHandlePtr callout_handle = getCalloutHandle(query);
 
         // Use the RAII wrapper to make sure that the callout handle state is
@@ -1145,14 +1251,14 @@ Dhcpv6Srv::processDhcp6Query(Pkt6Ptr& query, Pkt6Ptr& rsp) {
         ScopedEnableOptionsCopy<Pkt6> query6_options_copy(query);
 
         // Also pass the corresponding query packet as argument
-        callout_handle->setArgument("query6", query);
+        callout_handle->setArgument(Hooks.leases6_committed_query6_, query);
 
         Lease6CollectionPtr new_leases(new Lease6Collection());
         if (!ctx.new_leases_.empty()) {
             new_leases->assign(ctx.new_leases_.cbegin(),
                                ctx.new_leases_.cend());
         }
-        callout_handle->setArgument("leases6", new_leases);
+        callout_handle->setArgument(Hooks.leases6_committed_leases6_, new_leases);
 
         Lease6CollectionPtr deleted_leases(new Lease6Collection());
 
@@ -1178,7 +1284,7 @@ Dhcpv6Srv::processDhcp6Query(Pkt6Ptr& query, Pkt6Ptr& rsp) {
                 }
             }
         }
-        callout_handle->setArgument("deleted_leases6", deleted_leases);
+        callout_handle->setArgument(Hooks.leases6_committed_deleted_leases6_, deleted_leases);
 
         // Call all installed callouts
         HooksManager::callCallouts(Hooks.hook_index_leases6_committed_,
@@ -1259,6 +1365,7 @@ Dhcpv6Srv::processPacketPktSend(hooks::CalloutHandlePtr& callout_handle,
     // output wire data has not been prepared yet.
     // Execute all callouts registered for packet6_send
     if (HooksManager::calloutsPresent(Hooks.hook_index_pkt6_send_)) {
+        StageLatencyTimer hooks_timer(StageLatency::HOOKS);
 
         // Use the RAII wrapper to make sure that the callout handle state is
         // reset when this object goes out of scope. All hook points must do
@@ -1270,10 +1377,10 @@ Dhcpv6Srv::processPacketPktSend(hooks::CalloutHandlePtr& callout_handle,
         ScopedEnableOptionsCopy<Pkt6> query_resp_options_copy(query, rsp);
 
         // Pass incoming packet as argument
-        callout_handle->setArgument("query6", query);
+        callout_handle->setArgument(Hooks.pkt6_send_query6_, query);
 
         // Set our response
-        callout_handle->setArgument("response6", rsp);
+        callout_handle->setArgument(Hooks.pkt6_send_response6_, rsp);
 
         // Call all installed callouts
         HooksManager::callCallouts(Hooks.hook_index_pkt6_send_, *callout_handle);
@@ -1316,12 +1423,15 @@ Dhcpv6Srv::processPacketBufferSend(CalloutHandlePtr& callout_handle,
         return;
     }
 
+    StageLatencyTimer timer(StageLatency::SEND);
+
     try {
         // Now all fields and options are constructed into output wire buffer.
         // Option objects modification does not make sense anymore. Hooks
         // can only manipulate wire buffer at this stage.
         // Let's execute all callouts registered for buffer6_send
         if (HooksManager::calloutsPresent(Hooks.hook_index_buffer6_send_)) {
+            StageLatencyTimer hooks_timer(StageLatency::HOOKS);
 
             // Use the RAII wrapper to make sure that the callout handle state is
             // reset when this object goes out of scope. All hook points must do
@@ -1333,7 +1443,7 @@ Dhcpv6Srv::processPacketBufferSend(CalloutHandlePtr& callout_handle,
             ScopedEnableOptionsCopy<Pkt6> response6_options_copy(rsp);
 
             // Pass incoming packet as argument
-            callout_handle->setArgument("response6", rsp);
+            callout_handle->setArgument(Hooks.buffer6_send_response6_, rsp);
 
             // Call callouts
             HooksManager::callCallouts(Hooks.hook_index_buffer6_send_,
@@ -1350,7 +1460,7 @@ Dhcpv6Srv::processPacketBufferSend(CalloutHandlePtr& callout_handle,
                 return;
             }
 
-            callout_handle->getArgument("response6", rsp);
+            callout_handle->getArgument(Hooks.buffer6_send_response6_, rsp);
         }
 
         LOG_DEBUG(packet6_logger, DBG_DHCP6_BASIC, DHCP6_PACKET_SEND)
@@ -1491,6 +1601,7 @@ Dhcpv6Srv::buildCfgOptionList(const Pkt6Ptr& question,
 
 void
 Dhcpv6Srv::appendRequestedOptions(const Pkt6Ptr& question, Pkt6Ptr& answer,
+                                  AllocEngine::ClientContext6& ctx,
                                   const CfgOptionList& co_list) {
 
     // Unlikely short cut
@@ -1510,34 +1621,21 @@ Dhcpv6Srv::appendRequestedOptions(const Pkt6Ptr& question, Pkt6Ptr& answer,
     if (option_oro) {
         requested_opts = option_oro->getValues();
     }
-    // Iterate on the configured option list to add persistent options
-    for (CfgOptionList::const_iterator copts = co_list.begin();
-         copts != co_list.end(); ++copts) {
-        const OptionContainerPtr& opts = (*copts)->getAll(DHCP6_OPTION_SPACE);
-        if (!opts) {
-            continue;
-        }
-        // Get persistent options
-        const OptionContainerPersistIndex& idx = opts->get<2>();
-        const OptionContainerPersistRange& range = idx.equal_range(true);
-        for (OptionContainerPersistIndex::const_iterator desc = range.first;
-             desc != range.second; ++desc) {
-            // Add the persistent option code to requested options
-            requested_opts.push_back(desc->option_->getType());
-        }
-    }
 
-    BOOST_FOREACH(uint16_t opt, requested_opts) {
-        // Iterate on the configured option list
-        for (CfgOptionList::const_iterator copts = co_list.begin();
-             copts != co_list.end(); ++copts) {
-            OptionDescriptor desc = (*copts)->get(DHCP6_OPTION_SPACE, opt);
-            // Got it: add it and jump to the outer loop
-            if (desc.option_) {
-                answer->addOption(desc.option_);
-                break;
-            }
-        }
+    // Get the instances of the requested and persistent options. The
+    // lookup over the configured option list is cached for the clients
+    // sharing the list and the requested codes, except for the clients
+    // with host specific options.
+    ResolvedOptionsCache::ResolvedOptionsPtr resolved;
+    if (ctx.currentHost() && !ctx.currentHost()->getCfgOption6()->empty()) {
+        resolved = ResolvedOptionsCache::resolve(co_list, DHCP6_OPTION_SPACE,
+                                                 requested_opts, true);
+    } else {
+        resolved = CfgMgr::instance().getCurrentCfg()->getResolvedOptionsCache()->
+            get(co_list, DHCP6_OPTION_SPACE, requested_opts, true);
+    }
+    for (auto const& opt : *resolved) {
+        answer->addOption(opt.second);
     }
 }
 
@@ -1767,6 +1865,8 @@ void Dhcpv6Srv::sanityCheckDUID(const OptionPtr& opt, const std::string& opt_nam
 
 Subnet6Ptr
 Dhcpv6Srv::selectSubnet(const Pkt6Ptr& question, bool& drop) {
+    StageLatencyTimer timer(StageLatency::SELECT_SUBNET);
+
     const SubnetSelector& selector = CfgSubnets6::initSelector(question);
 
     Subnet6Ptr subnet = CfgMgr::instance().getCurrentCfg()->
@@ -1774,6 +1874,8 @@ Dhcpv6Srv::selectSubnet(const Pkt6Ptr& question, bool& drop) {
 
     // Let's execute all callouts registered for subnet6_receive
     if (HooksManager::calloutsPresent(Hooks.hook_index_subnet6_select_)) {
+        StageLatencyTimer hooks_timer(StageLatency::HOOKS);
+
         CalloutHandlePtr callout_handle = getCalloutHandle(question);
 
         // Use the RAII wrapper to make sure that the callout handle state is
@@ -1786,13 +1888,13 @@ Dhcpv6Srv::selectSubnet(const Pkt6Ptr& question, bool& drop) {
         ScopedEnableOptionsCopy<Pkt6> query6_options_copy(question);
 
         // Set new arguments
-        callout_handle->setArgument("query6", question);
-        callout_handle->setArgument("subnet6", subnet);
+        callout_handle->setArgument(Hooks.subnet6_select_query6_, question);
+        callout_handle->setArgument(Hooks.subnet6_select_subnet6_, subnet);
 
         // We pass pointer to const collection for performance reasons.
         // Otherwise we would get a non-trivial performance penalty each
         // time subnet6_select is called.
-        callout_handle->setArgument("subnet6collection",
+        callout_handle->setArgument(Hooks.subnet6_select_subnet6collection_,
                                     CfgMgr::instance().getCurrentCfg()->
                                     getCfgSubnets6()->getAll());
 
@@ -1819,7 +1921,7 @@ Dhcpv6Srv::selectSubnet(const Pkt6Ptr& question, bool& drop) {
         }
 
         // Use whatever subnet was specified by the callout
-        callout_handle->getArgument("subnet6", subnet);
+        callout_handle->getArgument(Hooks.subnet6_select_subnet6_, subnet);
     }
 
     if (subnet) {
@@ -2936,6 +3038,8 @@ Dhcpv6Srv::releaseIA_NA(const DuidPtr& duid, const Pkt6Ptr& query,
     bool skip = false;
     // Execute all callouts registered for packet6_send
     if (HooksManager::calloutsPresent(Hooks.hook_index_lease6_release_)) {
+        StageLatencyTimer hooks_timer(StageLatency::HOOKS);
+
         CalloutHandlePtr callout_handle = getCalloutHandle(query);
 
         // Use the RAII wrapper to make sure that the callout handle state is
@@ -2951,10 +3055,10 @@ Dhcpv6Srv::releaseIA_NA(const DuidPtr& duid, const Pkt6Ptr& query,
         callout_handle->deleteAllArguments();
 
         // Pass the original packet
-        callout_handle->setArgument("query6", query);
+        callout_handle->setArgument(Hooks.lease6_release_query6_, query);
 
         // Pass the lease to be updated
-        callout_handle->setArgument("lease6", lease);
+        callout_handle->setArgument(Hooks.lease6_release_lease6_, lease);
 
         // Call all installed callouts
         HooksManager::callCallouts(Hooks.hook_index_lease6_release_, *callout_handle);
@@ -3105,6 +3209,8 @@ Dhcpv6Srv::releaseIA_PD(const DuidPtr& duid, const Pkt6Ptr& query,
     bool skip = false;
     // Execute all callouts registered for packet6_send
     if (HooksManager::calloutsPresent(Hooks.hook_index_lease6_release_)) {
+        StageLatencyTimer hooks_timer(StageLatency::HOOKS);
+
         CalloutHandlePtr callout_handle = getCalloutHandle(query);
 
         // Use the RAII wrapper to make sure that the callout handle state is
@@ -3117,10 +3223,10 @@ Dhcpv6Srv::releaseIA_PD(const DuidPtr& duid, const Pkt6Ptr& query,
         ScopedEnableOptionsCopy<Pkt6> query6_options_copy(query);
 
         // Pass the original packet
-        callout_handle->setArgument("query6", query);
+        callout_handle->setArgument(Hooks.lease6_release_query6_, query);
 
         // Pass the lease to be updated
-        callout_handle->setArgument("lease6", lease);
+        callout_handle->setArgument(Hooks.lease6_release_lease6_, lease);
 
         // Call all installed callouts
         HooksManager::callCallouts(Hooks.hook_index_lease6_release_, *callout_handle);
@@ -3225,12 +3331,14 @@ Dhcpv6Srv::processSolicit(AllocEngine::ClientContext6& ctx) {
     conditionallySetReservedClientClasses(solicit, ctx);
     requiredClassify(solicit, ctx);
 
+    StageLatencyTimer options_timer(StageLatency::BUILD_OPTIONS);
     copyClientOptions(solicit, response);
     CfgOptionList co_list;
     buildCfgOptionList(solicit, ctx, co_list);
     appendDefaultOptions(solicit, response, co_list);
-    appendRequestedOptions(solicit, response, co_list);
+    appendRequestedOptions(solicit, response, ctx, co_list);
     appendRequestedVendorOptions(solicit, response, ctx, co_list);
+    options_timer.stop();
 
     updateReservedFqdn(ctx, response);
 
@@ -3263,12 +3371,14 @@ Dhcpv6Srv::processRequest(AllocEngine::ClientContext6& ctx) {
     conditionallySetReservedClientClasses(request, ctx);
     requiredClassify(request, ctx);
 
+    StageLatencyTimer options_timer(StageLatency::BUILD_OPTIONS);
     copyClientOptions(request, reply);
     CfgOptionList co_list;
     buildCfgOptionList(request, ctx, co_list);
     appendDefaultOptions(request, reply, co_list);
-    appendRequestedOptions(request, reply, co_list);
+    appendRequestedOptions(request, reply, ctx, co_list);
     appendRequestedVendorOptions(request, reply, ctx, co_list);
+    options_timer.stop();
 
     updateReservedFqdn(ctx, reply);
     generateFqdn(reply, ctx);
@@ -3297,12 +3407,14 @@ Dhcpv6Srv::processRenew(AllocEngine::ClientContext6& ctx) {
     conditionallySetReservedClientClasses(renew, ctx);
     requiredClassify(renew, ctx);
 
+    StageLatencyTimer options_timer(StageLatency::BUILD_OPTIONS);
     copyClientOptions(renew, reply);
     CfgOptionList co_list;
     buildCfgOptionList(renew, ctx, co_list);
     appendDefaultOptions(renew, reply, co_list);
-    appendRequestedOptions(renew, reply, co_list);
+    appendRequestedOptions(renew, reply, ctx, co_list);
     appendRequestedVendorOptions(renew, reply, ctx, co_list);
+    options_timer.stop();
 
     updateReservedFqdn(ctx, reply);
     generateFqdn(reply, ctx);
@@ -3331,12 +3443,14 @@ Dhcpv6Srv::processRebind(AllocEngine::ClientContext6& ctx) {
     conditionallySetReservedClientClasses(rebind, ctx);
     requiredClassify(rebind, ctx);
 
+    StageLatencyTimer options_timer(StageLatency::BUILD_OPTIONS);
     copyClientOptions(rebind, reply);
     CfgOptionList co_list;
     buildCfgOptionList(rebind, ctx, co_list);
     appendDefaultOptions(rebind, reply, co_list);
-    appendRequestedOptions(rebind, reply, co_list);
+    appendRequestedOptions(rebind, reply, ctx, co_list);
     appendRequestedVendorOptions(rebind, reply, ctx, co_list);
+    options_timer.stop();
 
     updateReservedFqdn(ctx, reply);
     generateFqdn(reply, ctx);
@@ -3362,12 +3476,14 @@ Dhcpv6Srv::processConfirm(AllocEngine::ClientContext6& ctx) {
     // The server sends Reply message in response to Confirm.
     Pkt6Ptr reply(new Pkt6(DHCPV6_REPLY, confirm->getTransid()));
     // Make sure that the necessary options are included.
+    StageLatencyTimer options_timer(StageLatency::BUILD_OPTIONS);
     copyClientOptions(confirm, reply);
     CfgOptionList co_list;
     buildCfgOptionList(confirm, ctx, co_list);
     appendDefaultOptions(confirm, reply, co_list);
-    appendRequestedOptions(confirm, reply, co_list);
+    appendRequestedOptions(confirm, reply, ctx, co_list);
     appendRequestedVendorOptions(confirm, reply, ctx, co_list);
+    options_timer.stop();
     // Indicates if at least one address has been verified. If no addresses
     // are verified it means that the client has sent no IA_NA options
     // or no IAAddr options and that client's message has to be discarded.
@@ -3689,6 +3805,8 @@ Dhcpv6Srv::declineLease(const Pkt6Ptr& decline, const Lease6Ptr lease,
 
     // Let's call lease6_decline hooks if necessary.
     if (HooksManager::calloutsPresent(Hooks.hook_index_lease6_decline_)) {
+        StageLatencyTimer hooks_timer(StageLatency::HOOKS);
+
         CalloutHandlePtr callout_handle = getCalloutHandle(decline);
 
         // Use the RAII wrapper to make sure that the callout handle state is
@@ -3701,8 +3819,8 @@ Dhcpv6Srv::declineLease(const Pkt6Ptr& decline, const Lease6Ptr lease,
         ScopedEnableOptionsCopy<Pkt6> query6_options_copy(decline);
 
         // Pass incoming packet as argument
-        callout_handle->setArgument("query6", decline);
-        callout_handle->setArgument("lease6", lease);
+        callout_handle->setArgument(Hooks.lease6_decline_query6_, decline);
+        callout_handle->setArgument(Hooks.lease6_decline_lease6_, lease);
 
         // Call callouts
         HooksManager::callCallouts(Hooks.hook_index_lease6_decline_,
@@ -3795,7 +3913,7 @@ Dhcpv6Srv::processInfRequest(AllocEngine::ClientContext6& ctx) {
     appendDefaultOptions(inf_request, reply, co_list);
 
     // Try to assign options that were requested by the client.
-    appendRequestedOptions(inf_request, reply, co_list);
+    appendRequestedOptions(inf_request, reply, ctx, co_list);
 
     // Try to assign vendor options that were requested by the client.
     appendRequestedVendorOptions(inf_request, reply, ctx, co_list);
@@ -3849,6 +3967,8 @@ void Dhcpv6Srv::classifyByVendor(const Pkt6Ptr& pkt, std::string& classes) {
 }
 
 void Dhcpv6Srv::classifyPacket(const Pkt6Ptr& pkt) {
+    StageLatencyTimer timer(StageLatency::CLASSIFY);
+
     // All packets belongs to ALL
     pkt->addClass("ALL");
     string classes = "ALL ";
@@ -3941,6 +4061,8 @@ Dhcpv6Srv::conditionallySetReservedClientClasses(const Pkt6Ptr& pkt,
 
 void
 Dhcpv6Srv::requiredClassify(const Pkt6Ptr& pkt, AllocEngine::ClientContext6& ctx) {
+    StageLatencyTimer timer(StageLatency::CLASSIFY);
+
     // First collect required classes
     ClientClasses classes = pkt->getClasses(true);
     Subnet6Ptr subnet = ctx.subnet_;
@@ -630,12 +630,15 @@ protected:
     /// @brief Appends requested options to server's answer.
     ///
     /// Appends options requested by client to the server's answer.
+    /// The options resolved from the configured option list are cached
+    /// unless the host reservation of the client carries options.
     ///
     /// @param question client's message
     /// @param answer server's message (options will be added here)
-    ///
+    /// @param ctx client context (contains the host reservation)
     /// @param co_list configured option list
     void appendRequestedOptions(const Pkt6Ptr& question, Pkt6Ptr& answer,
+                                AllocEngine::ClientContext6& ctx,
                                 const CfgOptionList& co_list);
 
     /// @brief Appends requested vendor options to server's answer.
@@ -46,6 +46,7 @@
 #include <process/config_ctl_parser.h>
 #include <util/encode/hex.h>
 #include <util/functional.h>
+#include <util/multi_threading_mgr.h>
 #include <util/strutil.h>
 
 #include <boost/algorithm/string.hpp>
@@ -69,6 +70,7 @@ using namespace isc::dhcp;
 using namespace isc::hooks;
 using namespace isc::process;
 using namespace isc::config;
+using namespace isc::util;
 
 namespace {
 
@@ -424,15 +426,25 @@ configureDhcp6Server(Dhcpv6Srv& server, isc::data::ElementPtr config_set,
     // so newly recreated configuration starts with first subnet-id equal 0.
     Subnet::resetSubnetID();
 
-    // Close DHCP sockets and remove any existing timers.
-    if (!check_only) {
-        IfaceMgr::instance().closeSockets();
-        TimerMgr::instance()->unregisterTimers();
-        server.discardPackets();
-        server.getCBControl()->reset();
+    {
+        // The parking lots are used by the packet processing threads, so
+        // they are stopped while these are changed. The rest of the
+        // configuration is parsed into the staging configuration while the
+        // packets are processed.
+        MultiThreadingCriticalSection cs;
+
+        // Remove any existing timers. The DHCP sockets are closed below unless
+        // the interfaces configuration is unchanged.
+        if (!check_only) {
+            TimerMgr::instance()->unregisterTimers();
+            server.discardPackets();
+            server.getCBControl()->reset();
+        }
     }
 
     // Revert any runtime option definitions configured so far and not committed.
+    // The definitions are staged for this thread: the packet processing threads
+    // use the committed ones until the configuration is committed.
     LibDHCP::revertRuntimeOptionDefs();
     // Let's set empty container in case a user hasn't specified any configuration
     // for option definitions. This is equivalent to committing empty container.
@@ -454,6 +466,7 @@ configureDhcp6Server(Dhcpv6Srv& server, isc::data::ElementPtr config_set,
     // Global parameter name in case of an error.
     string parameter_name;
     SrvConfigPtr srv_config;
+    bool reuse_sockets = false;
     try {
         // Get the staging configuration.
         srv_config = CfgMgr::instance().getStagingCfg();
@@ -470,6 +483,22 @@ configureDhcp6Server(Dhcpv6Srv& server, isc::data::ElementPtr config_set,
         // And now derive (inherit) global parameters to subnets, if not specified.
         SimpleParser6::deriveParameters(mutable_cfg);
 
+        // Keep the DHCP sockets open when the interfaces configuration is
+        // the same as the current one. The interfaces are not detected
+        // again then. Otherwise the sockets are closed here and reopened
+        // when the new configuration has been applied.
+        if (!check_only) {
+            ElementPtr ifaces_config = config_set->get("interfaces-config");
+            reuse_sockets = ifaces_config &&
+                IfaceMgr::instance().hasOpenSocket(AF_INET6) &&
+                isEquivalent(ifaces_config, CfgMgr::instance().getCurrentCfg()->
+                             getCfgIface()->toElement());
+            if (!reuse_sockets) {
+                MultiThreadingCriticalSection cs;
+                IfaceMgr::instance().closeSockets();
+            }
+        }
+
         // In principle we could have the following code structured as a series
         // of long if else if clauses. That would give a marginal performance
         // boost, but would make the code less readable. We had serious issues
@@ -489,6 +518,7 @@ configureDhcp6Server(Dhcpv6Srv& server, isc::data::ElementPtr config_set,
             parameter_name = "option-def";
             OptionDefListParser parser(AF_INET6);
             CfgOptionDefPtr cfg_option_def = srv_config->getCfgOptionDef();
+            // The parser stages the runtime option definitions.
             parser.parse(cfg_option_def, option_defs);
         }
 
@@ -548,7 +578,7 @@ configureDhcp6Server(Dhcpv6Srv& server, isc::data::ElementPtr config_set,
         ElementPtr ifaces_config = mutable_cfg->get("interfaces-config");
         if (ifaces_config) {
             parameter_name = "interfaces-config";
-            IfacesConfigParser parser(AF_INET6, check_only);
+            IfacesConfigParser parser(AF_INET6, check_only || reuse_sockets);
             CfgIfacePtr cfg_iface = srv_config->getCfgIface();
             parser.parse(cfg_iface, ifaces_config);
         }
@@ -892,6 +922,10 @@ configureDhcp6Server(Dhcpv6Srv& server, isc::data::ElementPtr config_set,
     // This operation should be exception safe but let's make sure.
     if (!rollback) {
         try {
+            // The D2 client and the hooks libraries are used by the packet
+            // processing threads.
+            MultiThreadingCriticalSection cs;
+
             if (IfaceMgr::instance().isServerMode()) {
                 // Setup the command channel.
                 configureCommandChannel6();
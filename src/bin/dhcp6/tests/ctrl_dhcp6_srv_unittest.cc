@@ -571,6 +571,7 @@ TEST_F(CtrlDhcpv6SrvTest, commandsRegistration) {
     EXPECT_TRUE(command_list.find("\"statistic-sample-count-set\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-sample-count-set-all\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"status-get\"") != string::npos);
+    EXPECT_TRUE(command_list.find("\"subnet6-delta-apply\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"version-get\"") != string::npos);
 
     // Ok, and now delete the server. It should deregister its commands.
@@ -1065,6 +1066,66 @@ TEST_F(CtrlChannelDhcpv6SrvTest, statusGet) {
     EXPECT_EQ(found_queue_size->intValue(), 64);
 }
 
+// This test verifies that the DHCP server applies subnet changes with
+// the subnet6-delta-apply command.
+TEST_F(CtrlChannelDhcpv6SrvTest, subnetDeltaApply) {
+    createUnixChannelServer();
+
+    // The subnet 1 and the subnet 2 in the shared network "frog".
+    CfgSubnets6Ptr subnets = CfgMgr::instance().getCurrentCfg()->getCfgSubnets6();
+    Subnet6Ptr subnet1(new Subnet6(IOAddress("2001:db8:1::"), 64, 1, 2, 3, 4,
+                                   SubnetID(1)));
+    subnets->add(subnet1);
+    Subnet6Ptr subnet2(new Subnet6(IOAddress("2001:db8:2::"), 64, 1, 2, 3, 4,
+                                   SubnetID(2)));
+    SharedNetwork6Ptr network(new SharedNetwork6("frog"));
+    network->add(subnet2);
+    CfgMgr::instance().getCurrentCfg()->getCfgSharedNetworks6()->add(network);
+    subnets->add(subnet2);
+
+    // Delete the subnet 1, replace the subnet 2 and add the subnet 3 to
+    // the shared network.
+    std::string response;
+    sendUnixCommand("{ \"command\": \"subnet6-delta-apply\", \"arguments\": {"
+                    " \"config-timestamp\": 1234,"
+                    " \"deleted-subnets\": [ 1 ],"
+                    " \"subnet6\": [ { \"id\": 2, \"subnet\": \"2001:db8:2::/64\","
+                    " \"pools\": [ { \"pool\": \"2001:db8:2::10 - 2001:db8:2::1f\" } ] },"
+                    " { \"id\": 3, \"subnet\": \"2001:db8:3::/64\","
+                    " \"shared-network-name\": \"frog\" } ] } }", response);
+    EXPECT_EQ("{ \"result\": 0, \"text\": \"Subnet changes applied: 1 added, "
+              "1 replaced, 1 deleted.\" }", response);
+
+    SrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+    EXPECT_EQ(1234, cfg->getServerCfgTimestamp());
+    ConstCfgSubnets6Ptr current = cfg->getCfgSubnets6();
+    EXPECT_FALSE(current->getBySubnetId(1));
+    ConstSubnet6Ptr replaced = current->getBySubnetId(2);
+    ASSERT_TRUE(replaced);
+    EXPECT_EQ(1, replaced->getPools(Lease::TYPE_NA).size());
+    ConstSubnet6Ptr added = current->getBySubnetId(3);
+    ASSERT_TRUE(added);
+    ASSERT_EQ(2, network->getAllSubnets()->size());
+    EXPECT_EQ(replaced, network->getSubnet(2));
+    EXPECT_EQ(added, network->getSubnet(3));
+
+    // An invalid change is rejected and leaves the configuration untouched.
+    sendUnixCommand("{ \"command\": \"subnet6-delta-apply\", \"arguments\": {"
+                    " \"deleted-subnets\": [ 3, 7 ] } }", response);
+    EXPECT_EQ("{ \"result\": 1, \"text\": \"Applying subnet changes failed: "
+              "no subnet with ID of '7' found\" }", response);
+    EXPECT_EQ(current, CfgMgr::instance().getCurrentCfg()->getCfgSubnets6());
+    EXPECT_EQ(2, network->getAllSubnets()->size());
+
+    sendUnixCommand("{ \"command\": \"subnet6-delta-apply\", \"arguments\": {"
+                    " \"subnet6\": [ { \"id\": 4, \"subnet\": \"2001:db8:4::/64\","
+                    " \"shared-network-name\": \"toad\" } ] } }", response);
+    EXPECT_TRUE(response.find("\"result\": 1") != string::npos);
+    EXPECT_TRUE(response.find("no shared network with the name of 'toad'")
+                != string::npos);
+    EXPECT_FALSE(CfgMgr::instance().getCurrentCfg()->getCfgSubnets6()->getBySubnetId(4));
+}
+
 // This test verifies that the DHCP server handles server-tag-get command
 TEST_F(CtrlChannelDhcpv6SrvTest, serverTagGet) {
     createUnixChannelServer();
@@ -1341,6 +1402,8 @@ TEST_F(CtrlChannelDhcpv6SrvTest, listCommands) {
     checkListCommands(rsp, "version-get");
     checkListCommands(rsp, "server-tag-get");
     checkListCommands(rsp, "shutdown");
+    checkListCommands(rsp, "stage-latency-get");
+    checkListCommands(rsp, "stage-latency-set");
     checkListCommands(rsp, "statistic-get");
     checkListCommands(rsp, "statistic-get-all");
     checkListCommands(rsp, "statistic-remove");
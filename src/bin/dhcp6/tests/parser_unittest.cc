@@ -609,6 +609,98 @@ TEST(ParserTest, errors) {
               "(previous at <string>:1:3)");
 }
 
+// Check that the group commit parameters of the lease database are
+// accepted in the lease-database map and rejected in the hosts-database map.
+TEST(ParserTest, leaseDatabaseGroupCommit) {
+    string txt = "{ \"Dhcp6\": { \"lease-database\": {"
+        " \"type\": \"memfile\", \"group-commit\": true,"
+        " \"fsync-policy\": \"interval\", \"fsync-interval\": 100,"
+        " \"wait-for-durability\": false } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+
+    testError("{ \"Dhcp6\": { \"hosts-database\": {"
+              " \"type\": \"memfile\", \"group-commit\": true } } }",
+              Parser6Context::PARSER_DHCP6,
+              "<string>:1.53-66: got unexpected keyword "
+              "\"group-commit\" in hosts-database map.");
+}
+
+// Check that lfc-threads is accepted in the lease-database map and
+// rejected in the hosts-database map.
+TEST(ParserTest, leaseDatabaseLfcThreads) {
+    string txt = "{ \"Dhcp6\": { \"lease-database\": {"
+        " \"type\": \"memfile\", \"lfc-threads\": 4 } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+
+    // Outside of the lease-database map it is an ordinary string.
+    testParser("{ \"Dhcp6\": { \"user-context\": {"
+               " \"lfc-threads\": 4 } } }",
+               Parser6Context::PARSER_DHCP6);
+
+    testError("{ \"Dhcp6\": { \"hosts-database\": {"
+              " \"type\": \"memfile\", \"lfc-threads\": 4 } } }",
+              Parser6Context::PARSER_DHCP6,
+              "<string>:1.53-65: got unexpected keyword "
+              "\"lfc-threads\" in hosts-database map.");
+}
+
+// Check that lfc-snapshot is accepted in the lease-database map and
+// rejected in the hosts-database map.
+TEST(ParserTest, leaseDatabaseLfcSnapshot) {
+    string txt = "{ \"Dhcp6\": { \"lease-database\": {"
+        " \"type\": \"memfile\", \"lfc-snapshot\": true } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+
+    // Outside of the lease-database map it is an ordinary string.
+    testParser("{ \"Dhcp6\": { \"user-context\": {"
+               " \"lfc-snapshot\": true } } }",
+               Parser6Context::PARSER_DHCP6);
+
+    testError("{ \"Dhcp6\": { \"hosts-database\": {"
+              " \"type\": \"memfile\", \"lfc-snapshot\": true } } }",
+              Parser6Context::PARSER_DHCP6,
+              "<string>:1.53-66: got unexpected keyword "
+              "\"lfc-snapshot\" in hosts-database map.");
+}
+
+// Check that lease-stats-counters is accepted in the lease-database map and
+// rejected in the hosts-database map.
+TEST(ParserTest, leaseDatabaseLeaseStatsCounters) {
+    string txt = "{ \"Dhcp6\": { \"lease-database\": {"
+        " \"type\": \"memfile\", \"lease-stats-counters\": true } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+
+    // Outside of the lease-database map it is an ordinary string.
+    testParser("{ \"Dhcp6\": { \"user-context\": {"
+               " \"lease-stats-counters\": true } } }",
+               Parser6Context::PARSER_DHCP6);
+
+    testError("{ \"Dhcp6\": { \"hosts-database\": {"
+              " \"type\": \"memfile\", \"lease-stats-counters\": true } } }",
+              Parser6Context::PARSER_DHCP6,
+              "<string>:1.53-74: got unexpected keyword "
+              "\"lease-stats-counters\" in hosts-database map.");
+}
+
+// Check that lease-expiration-buckets is accepted in the lease-database map and
+// rejected in the hosts-database map.
+TEST(ParserTest, leaseDatabaseLeaseExpirationBuckets) {
+    string txt = "{ \"Dhcp6\": { \"lease-database\": {"
+        " \"type\": \"memfile\", \"lease-expiration-buckets\": true } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+
+    // Outside of the lease-database map it is an ordinary string.
+    testParser("{ \"Dhcp6\": { \"user-context\": {"
+               " \"lease-expiration-buckets\": true } } }",
+               Parser6Context::PARSER_DHCP6);
+
+    testError("{ \"Dhcp6\": { \"hosts-database\": {"
+              " \"type\": \"memfile\", \"lease-expiration-buckets\": true } } }",
+              Parser6Context::PARSER_DHCP6,
+              "<string>:1.53-78: got unexpected keyword "
+              "\"lease-expiration-buckets\" in hosts-database map.");
+}
+
 // Check unicode escapes
 TEST(ParserTest, unicodeEscapes) {
     ElementPtr result;
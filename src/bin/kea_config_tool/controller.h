@@ -372,18 +372,29 @@ private:
         setShardsConfigCommon(master_ini, subnet_list, item_list, options, shards_directory_path);
     }
 
-    void addSubnet(isc::data::ElementPtr const& subnets,
-                   isc::dhcp::SubnetInfoPtr<D> const& subnet_info) {
-        bool found(false);
-        for (isc::data::ElementPtr s : subnets->listValue()) {
-            if (s->get("subnet")->stringValue() == subnet_info->strings_.subnet_) {  // Overwrite.
-                s = subnet_info->toElement();
-                found = true;
-                break;
+    /// @brief Adds the subnets to the list, replacing the subnets with the same prefix.
+    ///
+    /// The positions of the subnets in the list are indexed by prefix so that merging is linear
+    /// in the number of subnets.
+    void mergeSubnets(isc::data::ElementPtr const& subnets,
+                      isc::dhcp::SubnetInfoCollection<D> const& collection) {
+        std::unordered_map<std::string, size_t> positions;
+        positions.reserve(subnets->size() + collection.size());
+        for (size_t i = 0; i < subnets->size(); ++i) {
+            isc::data::ElementPtr const& prefix(subnets->get(i)->get("subnet"));
+            if (prefix) {
+                positions.emplace(prefix->stringValue(), i);
             }
         }
-        if (!found) {
-            subnets->add(subnet_info->toElement());
+        for (isc::dhcp::SubnetInfoPtr<D> const& subnet_info : collection) {
+            auto const& [position, inserted] =
+                positions.emplace(subnet_info->strings_.subnet_, subnets->size());
+            if (inserted) {
+                subnets->add(subnet_info->toElement());
+            } else {
+                // Overwrite.
+                subnets->set(position->second, subnet_info->toElement());
+            }
         }
     }
 
@@ -398,20 +409,11 @@ private:
         }
         isc::data::ElementPtr subnets(dhcp->get(subnet));
         if (options.count("get-subnets")) {
-            for (std::string& subnet : subnet_list) {
-                isc::dhcp::SubnetInfoPtr<D> subnet_info(
-                    isc::dhcp::SubnetMgrFactory<D>::instance().selectBySubnet(
-                        subnet, config_timestamp_path));
-                if (subnet_info) {
-                    addSubnet(subnets, subnet_info);
-                }
-            }
+            mergeSubnets(subnets, isc::dhcp::SubnetMgrFactory<D>::instance().selectBySubnets(
+                                      subnet_list, config_timestamp_path));
         } else {
-            isc::dhcp::SubnetInfoCollection<D> collection(
-                isc::dhcp::SubnetMgrFactory<D>::instance().select(config_timestamp_path));
-            for (isc::dhcp::SubnetInfoPtr<D> const& subnet_info : collection) {
-                addSubnet(subnets, subnet_info);
-            }
+            mergeSubnets(subnets, isc::dhcp::SubnetMgrFactory<D>::instance().select(
+                                      config_timestamp_path));
         }
     }
 
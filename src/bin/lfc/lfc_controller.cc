@@ -16,12 +16,18 @@
 #include <dhcpsrv/memfile_lease_mgr.h>
 #include <dhcpsrv/memfile_lease_storage.h>
 #include <dhcpsrv/lease_mgr.h>
+#include <dhcpsrv/lease_file_compactor.h>
 #include <dhcpsrv/lease_file_loader.h>
+#include <dhcpsrv/lease_snapshot.h>
 #include <log/logger_manager.h>
 #include <log/logger_name.h>
 #include <cfgrpt/config_report.h>
 
+#include <boost/lexical_cast.hpp>
+
 #include <iostream>
+#include <limits>
+#include <memory>
 #include <sstream>
 #include <unistd.h>
 #include <stdlib.h>
@@ -52,7 +58,8 @@ const char* LFCController::lfc_bin_name_ = "kea-lfc";
 
 LFCController::LFCController()
     : protocol_version_(0), verbose_(false), config_file_(""), previous_file_(""),
-      copy_file_(""), output_file_(""), finish_file_(""), pid_file_("") {
+      copy_file_(""), output_file_(""), finish_file_(""), pid_file_(""),
+      threads_(-1), snapshot_file_("") {
 }
 
 LFCController::~LFCController() {
@@ -109,7 +116,13 @@ LFCController::launch(int argc, char* argv[], const bool test_mode) {
           .arg(copy_file_);
 
         try {
-            if (getProtocolVersion() == 4) {
+            if (threads_ >= 0) {
+                if (getProtocolVersion() == 4) {
+                    processLeasesStreaming<Lease4, CSVLeaseFile4>();
+                } else {
+                    processLeasesStreaming<Lease6, CSVLeaseFile6>();
+                }
+            } else if (getProtocolVersion() == 4) {
                 processLeases<Lease4, CSVLeaseFile4, Lease4Storage>();
             } else {
                 processLeases<Lease6, CSVLeaseFile6, Lease6Storage>();
@@ -151,7 +164,7 @@ LFCController::parseArgs(int argc, char* argv[]) {
 
     opterr = 0;
     optind = 1;
-    while ((ch = getopt(argc, argv, ":46dhvVWp:x:i:o:c:f:")) != -1) {
+    while ((ch = getopt(argc, argv, ":46dhvVWp:x:i:o:c:f:j:s:")) != -1) {
         switch (ch) {
         case '4':
             // Process DHCPv4 lease files.
@@ -231,6 +244,31 @@ LFCController::parseArgs(int argc, char* argv[]) {
             config_file_ = optarg;
             break;
 
+        case 'j':
+            // Number of threads of the streaming cleanup.
+            if (optarg == NULL) {
+                isc_throw(InvalidUsage, "Number of threads missing");
+            }
+            try {
+                threads_ = boost::lexical_cast<int>(optarg);
+            } catch (const boost::bad_lexical_cast&) {
+                threads_ = -1;
+            }
+            if ((threads_ < 0) ||
+                (threads_ > std::numeric_limits<uint16_t>::max())) {
+                isc_throw(InvalidUsage, "Invalid number of threads: "
+                          << optarg);
+            }
+            break;
+
+        case 's':
+            // Lease snapshot file name.
+            if (optarg == NULL) {
+                isc_throw(InvalidUsage, "Snapshot file name missing");
+            }
+            snapshot_file_ = optarg;
+            break;
+
         case 'h':
             usage("");
             exit(EXIT_SUCCESS);
@@ -292,8 +330,14 @@ LFCController::parseArgs(int argc, char* argv[]) {
                   << "Output lease file:         " << output_file_ << std::endl
                   << "Finish file:               " << finish_file_ << std::endl
                   << "Config file:               " << config_file_ << std::endl
-                  << "PID file:                  " << pid_file_ << std::endl
-                  << std::endl;
+                  << "PID file:                  " << pid_file_ << std::endl;
+        if (threads_ >= 0) {
+            std::cout << "Streaming threads:         " << threads_ << std::endl;
+        }
+        if (!snapshot_file_.empty()) {
+            std::cout << "Lease snapshot:            " << snapshot_file_ << std::endl;
+        }
+        std::cout << std::endl;
     }
 }
 
@@ -304,7 +348,8 @@ LFCController::usage(const std::string& text) {
     }
 
     std::cerr << "Usage: " << lfc_bin_name_ << std::endl
-              << " [-4|-6] -p file -x file -i file -o file -f file -c file" << std::endl
+              << " [-4|-6] -p file -x file -i file -o file -f file -c file [-j threads]"
+              << " [-s file]" << std::endl
               << "   -4 or -6 clean a set of v4 or v6 lease files" << std::endl
               << "   -p <file>: PID file" << std::endl
               << "   -x <file>: previous or ex lease file" << std::endl
@@ -312,6 +357,13 @@ LFCController::usage(const std::string& text) {
               << "   -o <file>: output lease file" << std::endl
               << "   -f <file>: finish file" << std::endl
               << "   -c <file>: configuration file" << std::endl
+              << "   -j <threads>: optional, process the files in chunks using"
+              << " the given number" << std::endl
+              << "                 of threads (0 for one per processor)"
+              << " instead of loading" << std::endl
+              << "                 all leases in memory" << std::endl
+              << "   -s <file>: optional, write the binary lease snapshot"
+              << " loaded by the server" << std::endl
               << "   -v: print version number and exit" << std::endl
               << "   -V: print extended version information and exit" << std::endl
               << "   -d: optional, verbose output " << std::endl
@@ -337,9 +389,11 @@ void
 LFCController::processLeases() const {
     StorageType storage;
 
-    // If a previous file exists read the entries into storage
+    // If a previous file exists read the entries into storage, from
+    // the snapshot written by the previous cleanup if possible.
     LeaseFileType lf_prev(getPreviousFile());
-    if (lf_prev.exists()) {
+    if (lf_prev.exists() &&
+        !readSnapshot<LeaseObjectType>(storage)) {
         LeaseFileLoader::load<LeaseObjectType>(lf_prev, storage,
                                                MAX_LEASE_ERRORS);
     }
@@ -366,7 +420,117 @@ LFCController::processLeases() const {
       .arg(lf_output.getWrites())
       .arg(lf_output.getWriteErrs());
 
+    // Write the same leases to the snapshot. The failure is not fatal
+    // as the server falls back to reading the lease file.
+    if (!snapshot_file_.empty()) {
+        LeaseSnapshotWriter snapshot(snapshot_file_, getProtocolVersion());
+        try {
+            LeaseFileLoader::writeSnapshot<LeaseObjectType>(snapshot, storage,
+                                                            getOutputFile());
+            LOG_INFO(lfc_logger, LFC_WRITE_SNAPSHOT)
+              .arg(snapshot.getRecordCount())
+              .arg(snapshot_file_);
+        } catch (const std::exception& ex) {
+            LOG_WARN(lfc_logger, LFC_FAIL_SNAPSHOT).arg(ex.what());
+        }
+    }
+
+    // Once we've finished the output file move it to the complete file
+    finishOutput();
+}
+
+template<typename LeaseObjectType, typename LeaseFileType>
+void
+LFCController::processLeasesStreaming() const {
+    LeaseFileCompactor<LeaseObjectType, LeaseFileType> compactor(threads_);
+
+    LOG_INFO(lfc_logger, LFC_STREAMING).arg(compactor.getThreadCount());
+
+    // The copy file holds entries written after the previous file.
+    std::vector<std::string> inputs;
+    inputs.push_back(getPreviousFile());
+    inputs.push_back(getCopyFile());
+
+    // The leases are also written to the snapshot as they are written
+    // to the output file.
+    LeaseFileType lf_output(getOutputFile());
+    std::unique_ptr<LeaseSnapshotWriter> snapshot;
+    if (!snapshot_file_.empty()) {
+        snapshot.reset(new LeaseSnapshotWriter(snapshot_file_,
+                                               getProtocolVersion()));
+        try {
+            snapshot->open();
+        } catch (const std::exception& ex) {
+            LOG_WARN(lfc_logger, LFC_FAIL_SNAPSHOT).arg(ex.what());
+            snapshot.reset();
+        }
+    }
+    auto append = [&snapshot](const LeaseObjectType& lease) {
+        if (!snapshot) {
+            return;
+        }
+        try {
+            snapshot->append(lease);
+        } catch (const std::exception& ex) {
+            LOG_WARN(lfc_logger, LFC_FAIL_SNAPSHOT).arg(ex.what());
+            snapshot.reset();
+        }
+    };
+    compactor.compact(inputs, lf_output, MAX_LEASE_ERRORS, append);
+
+    // If desired log the stats
+    LOG_INFO(lfc_logger, LFC_READ_STATS)
+      .arg(compactor.getReadLeases())
+      .arg(compactor.getReads())
+      .arg(compactor.getReadErrs());
+
+    LOG_INFO(lfc_logger, LFC_WRITE_STATS)
+      .arg(lf_output.getWriteLeases())
+      .arg(lf_output.getWrites())
+      .arg(lf_output.getWriteErrs());
+
+    if (snapshot) {
+        try {
+            snapshot->commit(getOutputFile());
+            LOG_INFO(lfc_logger, LFC_WRITE_SNAPSHOT)
+              .arg(snapshot->getRecordCount())
+              .arg(snapshot_file_);
+        } catch (const std::exception& ex) {
+            LOG_WARN(lfc_logger, LFC_FAIL_SNAPSHOT).arg(ex.what());
+        }
+    }
+
     // Once we've finished the output file move it to the complete file
+    finishOutput();
+}
+
+template<typename LeaseObjectType, typename StorageType>
+bool
+LFCController::readSnapshot(StorageType& storage) const {
+    if (snapshot_file_.empty()) {
+        return (false);
+    }
+    LeaseSnapshotFile snapshot(snapshot_file_);
+    if (!snapshot.exists()) {
+        return (false);
+    }
+    try {
+        snapshot.open(getProtocolVersion(), getPreviousFile());
+        LeaseFileLoader::loadSnapshot<LeaseObjectType>(snapshot, storage);
+    } catch (const std::exception& ex) {
+        LOG_WARN(lfc_logger, LFC_FAIL_SNAPSHOT).arg(ex.what());
+        storage.clear();
+        return (false);
+    }
+    LOG_INFO(lfc_logger, LFC_READ_SNAPSHOT)
+      .arg(storage.size())
+      .arg(snapshot_file_)
+      .arg(previous_file_);
+    return (true);
+}
+
+void
+LFCController::finishOutput() const {
     if (rename(getOutputFile().c_str(), getFinishFile().c_str()) != 0) {
         isc_throw(RunTimeFail, "Unable to move output (" << output_file_
                   << ") to complete (" << finish_file_
@@ -142,6 +142,22 @@ public:
     std::string getPidFile() const {
         return (pid_file_);
     }
+
+    /// @brief Gets the number of threads of the streaming cleanup
+    ///
+    /// @return Returns the number of threads, 0 for the number of
+    /// processors, or -1 when the leases are loaded in memory.
+    int getThreads() const {
+        return (threads_);
+    }
+
+    /// @brief Gets the lease snapshot file name
+    ///
+    /// @return Returns the path to the lease snapshot, empty if the
+    /// snapshot is not written.
+    std::string getSnapshotFile() const {
+        return (snapshot_file_);
+    }
     //@}
 
 private:
@@ -155,6 +171,8 @@ private:
     std::string output_file_;   ///< The path to the output file
     std::string finish_file_;   ///< The path to the finished output file
     std::string pid_file_;      ///< The path to the pid file
+    int threads_;               ///< Threads of the streaming cleanup or -1
+    std::string snapshot_file_; ///< The path to the lease snapshot (if any)
 
     /// @brief Prints the program usage text to std error.
     ///
@@ -182,6 +200,38 @@ private:
     template<typename LeaseObjectType, typename LeaseFileType, typename StorageType>
     void processLeases() const;
 
+    /// @brief Process files in the streaming mode.
+    ///
+    /// Same as @c processLeases but uses the @c LeaseFileCompactor, which
+    /// reads the files in chunks using multiple threads and keeps only
+    /// the location of the last entry for every lease in memory.
+    ///
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    ///
+    /// @throw RunTimeFail if we can't move the file.
+    template<typename LeaseObjectType, typename LeaseFileType>
+    void processLeasesStreaming() const;
+
+    /// @brief Reads the leases of the previous file from the lease snapshot.
+    ///
+    /// The snapshot written by the previous cleanup holds the leases of
+    /// the previous file, unless either has been modified since.
+    ///
+    /// @param storage Empty storage for the leases.
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    ///
+    /// @return true if the leases have been read from the snapshot, false
+    /// if the leases must be read from the previous file.
+    template<typename LeaseObjectType, typename StorageType>
+    bool readSnapshot(StorageType& storage) const;
+
+    /// @brief Moves the output file to the finish file.
+    ///
+    /// @throw RunTimeFail if we can't move the file.
+    void finishOutput() const;
+
     ///@brief Start up the logging system
     ///
     /// @param test_mode indicates if we have have been started from the test
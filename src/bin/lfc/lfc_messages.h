@@ -12,12 +12,16 @@ extern const isc::log::MessageID LFC_FAIL_PID_CREATE;
 extern const isc::log::MessageID LFC_FAIL_PID_DEL;
 extern const isc::log::MessageID LFC_FAIL_PROCESS;
 extern const isc::log::MessageID LFC_FAIL_ROTATE;
+extern const isc::log::MessageID LFC_FAIL_SNAPSHOT;
 extern const isc::log::MessageID LFC_PROCESSING;
+extern const isc::log::MessageID LFC_READ_SNAPSHOT;
 extern const isc::log::MessageID LFC_READ_STATS;
 extern const isc::log::MessageID LFC_ROTATING;
 extern const isc::log::MessageID LFC_RUNNING;
 extern const isc::log::MessageID LFC_START;
+extern const isc::log::MessageID LFC_STREAMING;
 extern const isc::log::MessageID LFC_TERMINATE;
+extern const isc::log::MessageID LFC_WRITE_SNAPSHOT;
 extern const isc::log::MessageID LFC_WRITE_STATS;
 
 } // namespace lfc
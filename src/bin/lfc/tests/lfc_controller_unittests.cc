@@ -7,6 +7,7 @@
 #include <config.h>
 
 #include <lfc/lfc_controller.h>
+#include <dhcpsrv/lease_snapshot.h>
 #include <util/csv_file.h>
 #include <gtest/gtest.h>
 #include <fstream>
@@ -28,6 +29,7 @@ public:
     string ostr_; ///< String for name for output file
     string fstr_; ///< String for name for finish file
     string cstr_; ///< String for name for config file
+    string sstr_; ///< String for name for snapshot file
 
     string v4_hdr_; ///< String for the header of the v4 csv test file
     string v6_hdr_; ///< String for the header of the v6 csv test file
@@ -69,6 +71,7 @@ public:
         remove(istr_.c_str());
         remove(ostr_.c_str());
         remove(fstr_.c_str());
+        remove(sstr_.c_str());
     }
 
 protected:
@@ -85,6 +88,7 @@ protected:
         ostr_ = base_dir + "/" + lf + "output";     // output
         fstr_ = base_dir + "/" + lf + "completed";  // finish
         cstr_ = base_dir + "/" + "config_file";     // config
+        sstr_ = base_dir + "/" + lf + "snapshot";   // snapshot
 
         v4_hdr_ = "address,hwaddr,client_id,valid_lifetime,expire,subnet_id,"
                   "fqdn_fwd,fqdn_rev,hostname,state,user_context\n";
@@ -148,6 +152,7 @@ TEST_F(LFCControllerTest, initialValues) {
     EXPECT_TRUE(lfc_controller.getOutputFile().empty());
     EXPECT_TRUE(lfc_controller.getFinishFile().empty());
     EXPECT_TRUE(lfc_controller.getPidFile().empty());
+    EXPECT_EQ(lfc_controller.getThreads(), -1);
 }
 
 /// @todo verify that parsing -v/V/W/h works well without ASSERT_EXIT
@@ -187,6 +192,43 @@ TEST_F(LFCControllerTest, fullCommandLine) {
     EXPECT_EQ(lfc_controller.getPidFile(), "pid");
 }
 
+/// @brief Verify that the number of threads of the streaming cleanup
+/// is parsed and validated.
+TEST_F(LFCControllerTest, threadsCommandLine) {
+    LFCController lfc_controller;
+
+    char* argv[] = { const_cast<char*>("progName"),
+                     const_cast<char*>("-4"),
+                     const_cast<char*>("-x"),
+                     const_cast<char*>("previous"),
+                     const_cast<char*>("-i"),
+                     const_cast<char*>("copy"),
+                     const_cast<char*>("-o"),
+                     const_cast<char*>("output"),
+                     const_cast<char*>("-c"),
+                     const_cast<char*>("config"),
+                     const_cast<char*>("-f"),
+                     const_cast<char*>("finish"),
+                     const_cast<char*>("-p"),
+                     const_cast<char*>("pid"),
+                     const_cast<char*>("-j"),
+                     const_cast<char*>("4") };
+    int argc = 16;
+
+    ASSERT_NO_THROW(lfc_controller.parseArgs(argc, argv));
+    EXPECT_EQ(lfc_controller.getThreads(), 4);
+
+    argv[15] = const_cast<char*>("0");
+    ASSERT_NO_THROW(lfc_controller.parseArgs(argc, argv));
+    EXPECT_EQ(lfc_controller.getThreads(), 0);
+
+    argv[15] = const_cast<char*>("many");
+    EXPECT_THROW(lfc_controller.parseArgs(argc, argv), InvalidUsage);
+
+    argv[15] = const_cast<char*>("-1");
+    EXPECT_THROW(lfc_controller.parseArgs(argc, argv), InvalidUsage);
+}
+
 /// @brief Verify that parsing a correct but incomplete line fails.
 /// Parse a command line that is correctly formatted but isn't complete
 /// (doesn't include some options or an some option arguments).  We
@@ -518,6 +560,179 @@ TEST_F(LFCControllerTest, launch4) {
     EXPECT_TRUE(noExistIOFP());
 }
 
+/// @brief Verify that the streaming cleanup combines and cleans up
+/// files like the cleanup loading the leases in memory.
+TEST_F(LFCControllerTest, launch4Streaming) {
+    LFCController lfc_controller;
+
+    char* argv[] = { const_cast<char*>("progName"),
+                     const_cast<char*>("-4"),
+                     const_cast<char*>("-x"),
+                     const_cast<char*>(xstr_.c_str()),
+                     const_cast<char*>("-i"),
+                     const_cast<char*>(istr_.c_str()),
+                     const_cast<char*>("-o"),
+                     const_cast<char*>(ostr_.c_str()),
+                     const_cast<char*>("-c"),
+                     const_cast<char*>(cstr_.c_str()),
+                     const_cast<char*>("-f"),
+                     const_cast<char*>(fstr_.c_str()),
+                     const_cast<char*>("-p"),
+                     const_cast<char*>(pstr_.c_str()),
+                     const_cast<char*>("-j"),
+                     const_cast<char*>("2")
+    };
+    int argc = 16;
+    string test_str, astr;
+
+    string a_1 = "192.0.2.1,06:07:08:09:0a:bc,,"
+                 "200,200,8,1,1,host.example.com,1,\n";
+    string a_2 = "192.0.2.1,06:07:08:09:0a:bc,,"
+                 "200,500,8,1,1,host.example.com,1,\n";
+    string a_3 = "192.0.2.1,06:07:08:09:0a:bc,,"
+                 "200,800,8,1,1,host.example.com,1,{ \"foo\": true }\n";
+
+    string b_1 = "192.0.3.15,dd:de:ba:0d:1b:2e:3e:4f,0a:00:01:04,"
+                 "100,100,7,0,0,,1,{ \"bar\": false }\n";
+    string b_2 = "192.0.3.15,dd:de:ba:0d:1b:2e:3e:4f,0a:00:01:04,"
+                 "100,135,7,0,0,,1,\n";
+    string b_3 = "192.0.3.15,dd:de:ba:0d:1b:2e:3e:4f,0a:00:01:04,"
+                 "100,150,7,0,0,,1,\n";
+
+    // This one should be invalid, no hardware address or client id
+    // and state is not declined
+    string c_1 = "192.0.2.3,,,"
+                 "200,200,8,1,1,host.example.com,0,\n";
+
+    string d_1 = "192.0.2.5,16:17:18:19:1a:bc,,"
+                 "200,200,8,1,1,host.example.com,1,\n";
+    string d_2 = "192.0.2.5,16:17:18:19:1a:bc,,"
+                 "0,200,8,1,1,host.example.com,1,\n";
+
+    // Subtest 1: both previous and copy available.
+    test_str = v4_hdr_ + a_1 + b_1 + c_1 + b_2 + a_2 + d_1;
+    writeFile(xstr_, test_str);
+    test_str = v4_hdr_ + a_3 + b_3 + d_2;
+    writeFile(istr_, test_str);
+
+    launch(lfc_controller, argc, argv);
+
+    test_str = v4_hdr_ + a_3 + b_3;
+    EXPECT_EQ(readFile(xstr_), test_str);
+    EXPECT_TRUE(noExistIOFP());
+    removeTestFile();
+
+    // Subtest 2: only previous available
+    test_str = v4_hdr_ + a_1 + b_1 + c_1 + b_2 + a_2 + d_1;
+    writeFile(xstr_, test_str);
+
+    launch(lfc_controller, argc, argv);
+
+    test_str = v4_hdr_ + a_2 + d_1 + b_2;
+    EXPECT_EQ(readFile(xstr_), test_str);
+    EXPECT_TRUE(noExistIOFP());
+    removeTestFile();
+
+    // Subtest 3: a file with a lot of errors
+    astr = "1,\n2,\n3,\n4,\n5,\n6,\n7,\n7,\n8,\n9,\n10,\n";
+    test_str = v4_hdr_ + astr + astr + astr + astr + astr +
+               astr + astr + astr + astr + astr + astr;
+    writeFile(xstr_, test_str);
+
+    // Run the cleanup, the file should fail but we should
+    // catch the error and properly cleanup.
+    launch(lfc_controller, argc, argv);
+
+    // And we shouldn't have deleted the previous file.
+    EXPECT_EQ(readFile(xstr_), test_str);
+    EXPECT_TRUE(noExistIOFP());
+}
+
+/// @brief Verify that the lease snapshot is written along with the
+/// cleaned up file and that the next cleanup reads the leases of the
+/// previous file from it, with and without the streaming cleanup.
+TEST_F(LFCControllerTest, launch4Snapshot) {
+    for (auto threads : { "", "2" }) {
+        SCOPED_TRACE(string("threads: ") + threads);
+        LFCController lfc_controller;
+
+        char* argv[] = { const_cast<char*>("progName"),
+                         const_cast<char*>("-4"),
+                         const_cast<char*>("-x"),
+                         const_cast<char*>(xstr_.c_str()),
+                         const_cast<char*>("-i"),
+                         const_cast<char*>(istr_.c_str()),
+                         const_cast<char*>("-o"),
+                         const_cast<char*>(ostr_.c_str()),
+                         const_cast<char*>("-c"),
+                         const_cast<char*>(cstr_.c_str()),
+                         const_cast<char*>("-f"),
+                         const_cast<char*>(fstr_.c_str()),
+                         const_cast<char*>("-p"),
+                         const_cast<char*>(pstr_.c_str()),
+                         const_cast<char*>("-s"),
+                         const_cast<char*>(sstr_.c_str()),
+                         const_cast<char*>("-j"),
+                         const_cast<char*>(threads)
+        };
+        int argc = (*threads ? 18 : 16);
+        string test_str;
+
+        ASSERT_NO_THROW(lfc_controller.parseArgs(argc, argv));
+        EXPECT_EQ(lfc_controller.getSnapshotFile(), sstr_);
+
+        string a_1 = "192.0.2.1,06:07:08:09:0a:bc,,"
+                     "200,200,8,1,1,host.example.com,1,\n";
+        string a_2 = "192.0.2.1,06:07:08:09:0a:bc,,"
+                     "200,800,8,1,1,host.example.com,1,{ \"foo\": true }\n";
+        string b_1 = "192.0.3.15,dd:de:ba:0d:1b:2e:3e:4f,0a:00:01:04,"
+                     "100,100,7,0,0,,1,\n";
+        string c_1 = "192.0.2.5,16:17:18:19:1a:bc,,"
+                     "200,200,8,1,1,host.example.com,1,\n";
+
+        // Subtest 1: the snapshot holds the leases of the cleaned up file,
+        // which is now the previous file.
+        writeFile(xstr_, v4_hdr_ + a_1 + b_1);
+        writeFile(istr_, v4_hdr_ + a_2);
+
+        launch(lfc_controller, argc, argv);
+
+        test_str = v4_hdr_ + a_2 + b_1;
+        EXPECT_EQ(readFile(xstr_), test_str);
+        EXPECT_TRUE(noExistIOFP());
+        {
+            isc::dhcp::LeaseSnapshotFile snapshot(sstr_);
+            ASSERT_NO_THROW(snapshot.open(4, xstr_));
+            EXPECT_EQ(2, snapshot.getRecordCount());
+        }
+
+        // Subtest 2: the previous file is read from the snapshot and the
+        // result is the same.
+        writeFile(istr_, v4_hdr_ + c_1);
+
+        launch(lfc_controller, argc, argv);
+
+        test_str = v4_hdr_ + a_2 + c_1 + b_1;
+        EXPECT_EQ(readFile(xstr_), test_str);
+        EXPECT_TRUE(noExistIOFP());
+        {
+            isc::dhcp::LeaseSnapshotFile snapshot(sstr_);
+            ASSERT_NO_THROW(snapshot.open(4, xstr_));
+            EXPECT_EQ(3, snapshot.getRecordCount());
+        }
+
+        // Subtest 3: a stale snapshot is ignored.
+        writeFile(xstr_, v4_hdr_ + a_1);
+
+        launch(lfc_controller, argc, argv);
+
+        test_str = v4_hdr_ + a_1;
+        EXPECT_EQ(readFile(xstr_), test_str);
+        EXPECT_TRUE(noExistIOFP());
+        removeTestFile();
+    }
+}
+
 /// @brief Verify that we properly combine and clean up files
 ///
 /// This is mostly a retest as we already test that the loader and
@@ -351,9 +351,6 @@ struct ConfigurationCallback {
                                bool const fresh = false,
                                bool const conversion = true) {
         isc::yang::TranslatorUniversal translator(session, model);
-        if (fresh) {
-            translator.del();
-        }
         isc::data::ElementPtr mutable_config(config);
         if (conversion) {
             convert<isc::yang::Kea_to_IETF>(mutable_config, model);
@@ -361,7 +358,12 @@ struct ConfigurationCallback {
         LOG_DEBUG(netconf_logger, NETCONF_DBG_TRACE_DETAIL_DATA, NETCONF_UPDATE_SYNC)
             .arg(model)
             .arg("push directly to sysrepo\n" + prettyPrint(mutable_config));
-        translator.set(mutable_config);
+        if (fresh) {
+            // Replaces the current data, but only touches what differs.
+            translator.setDiff(mutable_config);
+        } else {
+            translator.set(mutable_config);
+        }
     }
 
     void pushDirectlyToSysrepoAsynchronously(std::string const& model,
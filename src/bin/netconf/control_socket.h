@@ -127,6 +127,14 @@ struct ControlSocketInterface {
     /// @return The JSON element answer of resource-get.
     /// @throw ControlSocketError when a communication error occurs.
     virtual isc::data::ElementPtr resourceGet(std::string resource) = 0;
+
+    /// @brief Get stage latencies.
+    ///
+    /// Call stage-latency-get over the control socket.
+    ///
+    /// @return The JSON element answer of stage-latency-get.
+    /// @throw ControlSocketError when a communication error occurs.
+    virtual isc::data::ElementPtr stageLatencyGet() = 0;
 };
 
 /// @brief Base class for control socket communication.
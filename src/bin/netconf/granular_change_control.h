@@ -20,7 +20,9 @@
 
 #include <cc/command_interpreter.h>
 #include <cc/data.h>
+#include <config/command_mgr.h>
 #include <dhcpsrv/master_config_mgr.h>
+#include <dhcpsrv/shard_cfg_mgrs.h>
 #include <dhcpsrv/subnet_mgr.h>
 #include <kea_config_tool/controller.h>
 #include <netconf/control_socket.h>
@@ -31,8 +33,18 @@
 #include <util/func.h>
 #include <util/magic_enum.hpp>
 #include <util/strutil.h>
+#include <util/thread_pool.h>
 #include <util/tuple_hash.h>
 
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 namespace isc {
 namespace netconf {
 
@@ -81,6 +93,28 @@ struct GranularChangeManager : ControlSocketBase<D> {
     using shard_set_t = std::set<double_key_t>;
     using subnet_set_t = std::set<triple_key_t>;
 
+    /// @brief What config-get retrieves from the database of a shard.
+    struct ShardRetrieval {
+        /// @brief whether the shard configuration is retrieved
+        bool shard_configuration_requested_ = false;
+
+        /// @brief the subnets to retrieve as pairs of subnet key and prefix
+        std::vector<std::pair<std::string, std::string>> subnets_;
+
+        /// @brief the managers of the shard
+        isc::dhcp::ShardCfgMgrsPtr<D> shard_cfg_mgrs_;
+
+        /// @brief the retrieved shard configuration
+        isc::dhcp::ShardConfigPtr shard_configuration_;
+
+        /// @brief the retrieved subnets
+        isc::dhcp::SubnetInfoCollection<D> subnet_infos_;
+    };
+    using shard_retrievals_t = std::map<double_key_t, ShardRetrieval>;
+
+    /// @brief Upper limit of the number of shards processed concurrently.
+    static constexpr uint32_t MAX_SHARD_THREADS = 16u;
+
     /// @brief Constructor.
     ///
     /// @param ctrl_sock The control socket configuration.
@@ -249,9 +283,7 @@ struct GranularChangeManager : ControlSocketBase<D> {
 
     template <typename T>
     bool shardsToDistributedConfiguration(T& retrieved_shards,
-                                          isc::data::ElementPtr const& distributed_configuration,
-                                          isc::util::Dir const& workspace,
-                                          isc::data::ElementPtr const& sysrepo_config,
+                                          shard_retrievals_t& retrievals,
                                           std::string const& xpath) {
         // Does xpath match or has it been processed already?
         auto const& [match, master, shard, the_rest](matchesShards(xpath));
@@ -267,39 +299,14 @@ struct GranularChangeManager : ControlSocketBase<D> {
         // Mark entities as resolved for external visibility.
         retrieved_shards.emplace(tuple);
 
-        // Configure credentials.
-        isc::dhcp::CfgMgr::instance().getStagingCfg()->getCfgDbAccess()->createShardCfgMgrs<D>(
-            {sysrepo_config->xpath(isc::dhcp::ShardConstants::credentials_xpath(master, shard))});
-
-        isc::util::Dir shard_directory(workspace() + "/" + master + "/" + shard);
-        isc::dhcp::ShardConfigPtr shard_configuration(
-            isc::dhcp::ShardConfigMgrFactory<D>::instance().select(shard_directory() +
-                                                                   "/config.timestamp"));
-
-        if (!shard_configuration) {
-            return true;
-        }
-
-        /// @{
-        /// Subnets need to be restored as they are enclosed by the shard configuration
-        /// being set here.
-        std::string xpath_for_all_subnets(
-            isc::dhcp::SubnetConstants<D>::xpath_for_all(master, shard));
-        isc::data::ElementPtr all_subnets(distributed_configuration->xpath(xpath_for_all_subnets));
-        /// @}
-
-        distributed_configuration->xpath(isc::dhcp::ShardConstants::xpath(master, shard),
-                                         shard_configuration->configuration());
-
-        // Restore here.
-        distributed_configuration->xpath(xpath_for_all_subnets, all_subnets);
+        // Retrieved later on together with the other shards.
+        retrievals[tuple].shard_configuration_requested_ = true;
         return true;
     }
 
     template <typename T>
     bool subnetsToDistributedConfiguration(T& retrieved_subnets,
-                                           isc::data::ElementPtr const& distributed_configuration,
-                                           isc::util::Dir const& workspace,
+                                           shard_retrievals_t& retrievals,
                                            isc::data::ElementPtr const& sysrepo_config,
                                            std::string const& xpath) {
         // Does xpath match or has it been processed already?
@@ -316,30 +323,87 @@ struct GranularChangeManager : ControlSocketBase<D> {
         // Mark entities as resolved for external visibility.
         retrieved_subnets.emplace(tuple);
 
-        // Configure credentials.
-        isc::dhcp::CfgMgr::instance().getStagingCfg()->getCfgDbAccess()->createShardCfgMgrs<D>(
-            {sysrepo_config->xpath(isc::dhcp::ShardConstants::credentials_xpath(master, shard))});
-
-        isc::util::Dir shard_directory(workspace() + "/" + master + "/" + shard);
-
         isc::data::ElementPtr subnet_element(sysrepo_config->xpath(
             isc::dhcp::SubnetConstantsT<D, has_IETF>::subnetElementXpath(master, shard, subnet)));
         if (!subnet_element) {
             return true;
         }
 
-        std::string subnet_mutable(subnet_element->stringValue());
-        isc::dhcp::SubnetInfoPtr<D> subnet_info(
-            isc::dhcp::SubnetMgrFactory<D>::instance().selectBySubnet(
-                subnet_mutable, shard_directory() + "/config.timestamp"));
+        // Retrieved later on together with the other subnets of the shard.
+        retrievals[std::make_tuple(master, shard)].subnets_.emplace_back(
+            subnet, subnet_element->stringValue());
+        return true;
+    }
+
+    /// @brief Retrieves the shard configurations and the subnets gathered in configGet from the
+    /// shard databases, one shard per thread, and places them inside the distributed
+    /// configuration.
+    void retrieveShards(shard_retrievals_t& retrievals,
+                        isc::data::ElementPtr const& distributed_configuration,
+                        isc::util::Dir const& workspace,
+                        isc::data::ElementPtr const& sysrepo_config) {
+        isc::dhcp::ShardTasks<D> tasks;
+        for (auto& [master_shard, retrieval] : retrievals) {
+            auto const& [master, shard] = master_shard;
 
-        if (!subnet_info) {
-            return true;
+            // Configure credentials.
+            retrieval.shard_cfg_mgrs_ = shard_cfg_mgrs_.get(
+                master, shard,
+                sysrepo_config->xpath(isc::dhcp::ShardConstants::credentials_xpath(master, shard)));
+
+            std::string const config_timestamp_path(workspace() + "/" + master + "/" + shard +
+                                                    "/config.timestamp");
+            ShardRetrieval& r(retrieval);
+            tasks.add(r.shard_cfg_mgrs_, [&r, config_timestamp_path]() {
+                if (r.shard_configuration_requested_) {
+                    r.shard_configuration_ =
+                        r.shard_cfg_mgrs_->shard_config_mgr_->select(config_timestamp_path);
+                }
+                if (!r.subnets_.empty()) {
+                    std::vector<std::string> prefixes;
+                    for (auto const& [subnet, prefix] : r.subnets_) {
+                        prefixes.push_back(prefix);
+                    }
+                    r.subnet_infos_ = r.shard_cfg_mgrs_->subnet_mgr_->selectBySubnets(
+                        prefixes, config_timestamp_path);
+                }
+            });
         }
+        runConcurrently(tasks);
 
-        distributed_configuration->xpath(
-            isc::dhcp::SubnetConstants<D>::xpath(master, shard, subnet), subnet_info->toElement());
-        return true;
+        for (auto const& [master_shard, retrieval] : retrievals) {
+            auto const& [master, shard] = master_shard;
+            if (retrieval.shard_configuration_) {
+                /// @{
+                /// Subnets need to be restored as they are enclosed by the shard configuration
+                /// being set here.
+                std::string xpath_for_all_subnets(
+                    isc::dhcp::SubnetConstants<D>::xpath_for_all(master, shard));
+                isc::data::ElementPtr all_subnets(
+                    distributed_configuration->xpath(xpath_for_all_subnets));
+                /// @}
+
+                distributed_configuration->xpath(isc::dhcp::ShardConstants::xpath(master, shard),
+                                                 retrieval.shard_configuration_->configuration());
+
+                // Restore here.
+                distributed_configuration->xpath(xpath_for_all_subnets, all_subnets);
+            }
+
+            std::unordered_map<std::string, isc::dhcp::SubnetInfoPtr<D>> subnet_infos;
+            for (isc::dhcp::SubnetInfoPtr<D> const& subnet_info : retrieval.subnet_infos_) {
+                subnet_infos.emplace(subnet_info->strings_.subnet_, subnet_info);
+            }
+            for (auto const& [subnet, prefix] : retrieval.subnets_) {
+                auto const& iterator(subnet_infos.find(prefix));
+                if (iterator == subnet_infos.end()) {
+                    continue;
+                }
+                distributed_configuration->xpath(
+                    isc::dhcp::SubnetConstants<D>::xpath(master, shard, subnet),
+                    iterator->second->toElement());
+            }
+        }
     }
     /// @}
 
@@ -405,24 +469,37 @@ struct GranularChangeManager : ControlSocketBase<D> {
             }
         }
 
-        hook_library_set_t retrieved_hook_libraries;
-        master_set_t retrieved_masters;
+        // Gather what is needed from the shard databases first so that the shards can be
+        // queried concurrently.
         shard_set_t retrieved_shards;
         subnet_set_t retrieved_subnets;
-        std::set<std::string> masters;
+        shard_retrievals_t retrievals;
+        std::vector<std::string> remaining_xpaths;
         for (Change const& change : changes) {
             std::string const& xpath(Changes::xpath(change));
-            if (hookLibrariesToDistributedConfiguration(retrieved_hook_libraries,
-                                                        distributed_configuration, workspace,
-                                                        sysrepo_config, xpath)) {
+            if (std::get<0>(matchesHookLibraries(xpath))) {
+                remaining_xpaths.push_back(xpath);
                 continue;
             }
-            if (subnetsToDistributedConfiguration(retrieved_subnets, distributed_configuration,
-                                                  workspace, sysrepo_config, xpath)) {
+            if (subnetsToDistributedConfiguration(retrieved_subnets, retrievals, sysrepo_config,
+                                                  xpath)) {
+                continue;
+            }
+            if (shardsToDistributedConfiguration(retrieved_shards, retrievals, xpath)) {
                 continue;
             }
-            if (shardsToDistributedConfiguration(retrieved_shards, distributed_configuration,
-                                                 workspace, sysrepo_config, xpath)) {
+            remaining_xpaths.push_back(xpath);
+        }
+        retrieveShards(retrievals, distributed_configuration, workspace, sysrepo_config);
+
+        // Hook libraries are loaded in the process-wide dummy server and masters share the
+        // process-wide master configuration manager, so these are handled one at a time.
+        hook_library_set_t retrieved_hook_libraries;
+        master_set_t retrieved_masters;
+        for (std::string const& xpath : remaining_xpaths) {
+            if (hookLibrariesToDistributedConfiguration(retrieved_hook_libraries,
+                                                        distributed_configuration, workspace,
+                                                        sysrepo_config, xpath)) {
                 continue;
             }
             if (mastersToDistributedConfiguration(retrieved_masters, distributed_configuration,
@@ -514,6 +591,17 @@ struct GranularChangeManager : ControlSocketBase<D> {
                                          "Command not supported on granular change socket");
     }
 
+    /// @brief Get stage latencies.
+    ///
+    /// Call stage-latency-get over the control socket.
+    ///
+    /// @return The JSON element answer of stage-latency-get.
+    /// @throw ControlSocketError when a communication error occurs.
+    isc::data::ElementPtr stageLatencyGet() override final {
+        return isc::config::createAnswer(isc::config::CONTROL_RESULT_COMMAND_UNSUPPORTED,
+                                         "Command not supported on granular change socket");
+    }
+
 private:
     /// @brief Updates the de facto effect of compartment with new effect.
     isc::data::effect_t combine(isc::data::effect_t const& effect,
@@ -861,6 +949,7 @@ private:
                      [[maybe_unused]] isc::data::ElementPtr const& sysrepo_config,
                      isc::util::Dir const& workspace,
                      bool const test) {
+        isc::dhcp::ShardTasks<D> tasks;
         for (auto const& [master_shard, effect] : shard_effects_) {
             if (effect.none() || (effect.test(isc::data::KEY_IS_AFFECTED) && effect.count() == 1)) {
                 continue;
@@ -880,19 +969,26 @@ private:
             // Configure credentials.
             std::string const& credentials_xpath(
                 isc::dhcp::ShardConstants::credentials_xpath(master, shard));
-            isc::dhcp::CfgMgr::instance().getStagingCfg()->getCfgDbAccess()->createShardCfgMgrs<D>(
-                {config->xpath(credentials_xpath)});
+            isc::dhcp::ShardCfgMgrsPtr<D> shard_cfg_mgrs(
+                shard_cfg_mgrs_.get(master, shard, config->xpath(credentials_xpath)));
 
             isc::util::Dir shard_directory(workspace() + "/" + master + "/" + shard);
             if (!test) {
-                LOG_DEBUG(netconf_logger, NETCONF_DBG_TRACE_DETAIL_DATA, NETCONF_INFO)
-                    .arg(PRETTY_METHOD_NAME() + ": ShardConfigMgr::action(" +
-                         isc::data::Effect::print(effect) + ")");
-                isc::dhcp::ShardConfigMgrFactory<D>::instance().action(
-                    effect, shard_config, shard_directory() + "/config.timestamp");
+                std::string const config_timestamp_path(shard_directory() + "/config.timestamp");
+                std::string const method(PRETTY_METHOD_NAME());
+                isc::data::effect_t const shard_effect(effect);
+                tasks.add(shard_cfg_mgrs, [shard_cfg_mgrs, shard_config, shard_effect,
+                                           config_timestamp_path, method]() mutable {
+                    LOG_DEBUG(netconf_logger, NETCONF_DBG_TRACE_DETAIL_DATA, NETCONF_INFO)
+                        .arg(method + ": ShardConfigMgr::action(" +
+                             isc::data::Effect::print(shard_effect) + ")");
+                    shard_cfg_mgrs->shard_config_mgr_->action(shard_effect, shard_config,
+                                                              config_timestamp_path);
+                });
                 affected_shard_configurations_.emplace(master_shard);
             }
         }
+        runConcurrently(tasks);
     }
 
     void actOnSubnets(isc::data::ElementPtr const& db_config,
@@ -900,6 +996,11 @@ private:
                       [[maybe_unused]] isc::data::ElementPtr const& sysrepo_config,
                       isc::util::Dir const& workspace,
                       bool const test) {
+        // Group the subnets by shard. The subnets of a shard are handled in order on a single
+        // connection while the shards are handled concurrently.
+        std::map<double_key_t,
+                 std::vector<std::pair<isc::dhcp::SubnetInfoPtr<D>, isc::data::effect_t>>>
+            subnets_by_shard;
         for (auto const& [master_shard_subnet, effect] : subnet_effects_) {
             if (effect.none() || (effect.test(isc::data::KEY_IS_AFFECTED) && effect.count() == 1)) {
                 continue;
@@ -915,24 +1016,38 @@ private:
             auto const& [master, shard, subnet] = master_shard_subnet;
             isc::dhcp::SubnetInfoPtr<D> config_subnet(std::make_shared<isc::dhcp::SubnetInfo<D>>());
             config_subnet->fromDistributedConfiguration(config_pointer, master, shard, subnet);
+            subnets_by_shard[std::make_tuple(master, shard)].emplace_back(config_subnet, effect);
+        }
+
+        isc::dhcp::ShardTasks<D> tasks;
+        for (auto& [master_shard, subnets] : subnets_by_shard) {
+            auto const& [master, shard] = master_shard;
 
             // Configure credentials.
             std::string const& credentials_xpath(
                 isc::dhcp::ShardConstants::credentials_xpath(master, shard));
-            isc::dhcp::CfgMgr::instance().getStagingCfg()->getCfgDbAccess()->createShardCfgMgrs<D>(
-                {config->xpath(credentials_xpath)});
+            isc::dhcp::ShardCfgMgrsPtr<D> shard_cfg_mgrs(
+                shard_cfg_mgrs_.get(master, shard, config->xpath(credentials_xpath)));
 
             isc::util::Dir const& shard_directory(workspace() + "/" + master + "/" + shard);
             if (!test) {
-                LOG_DEBUG(netconf_logger, NETCONF_DBG_TRACE_DETAIL_DATA, NETCONF_INFO)
-                    .arg(PRETTY_METHOD_NAME() + ": SubnetMgr::action(" +
-                         isc::data::Effect::print(effect) + ")");
-                isc::dhcp::SubnetMgrFactory<D>::instance().action(
-                    effect, config_subnet, shard_directory() + "/config.timestamp");
-                required_to_be_affected_shard_configurations_.emplace(
-                    std::make_tuple(master, shard));
+                std::string const config_timestamp_path(shard_directory() + "/config.timestamp");
+                std::string const method(PRETTY_METHOD_NAME());
+                auto& shard_subnets(subnets);
+                tasks.add(shard_cfg_mgrs, [shard_cfg_mgrs, &shard_subnets, config_timestamp_path,
+                                           method]() {
+                    for (auto& [config_subnet, effect] : shard_subnets) {
+                        LOG_DEBUG(netconf_logger, NETCONF_DBG_TRACE_DETAIL_DATA, NETCONF_INFO)
+                            .arg(method + ": SubnetMgr::action(" +
+                                 isc::data::Effect::print(effect) + ")");
+                        shard_cfg_mgrs->subnet_mgr_->action(effect, config_subnet,
+                                                            config_timestamp_path);
+                    }
+                });
+                required_to_be_affected_shard_configurations_.emplace(master_shard);
             }
         }
+        runConcurrently(tasks);
     }
     /// @}
 
@@ -940,6 +1055,7 @@ private:
     /// server is able to trigger reconfiguration.
     void maybeUpdateTimestamp(isc::data::ElementPtr const& config,
                               isc::util::Dir const& workspace) {
+        isc::dhcp::ShardTasks<D> tasks;
         for (auto const& [master, shard] : required_to_be_affected_shard_configurations_) {
             bool found(false);
             for (auto const& [affected_master, affected_shard] : affected_shard_configurations_) {
@@ -952,17 +1068,146 @@ private:
                 // Configure credentials.
                 std::string const& credentials_xpath(
                     isc::dhcp::ShardConstants::credentials_xpath(master, shard));
-                isc::dhcp::CfgMgr::instance()
-                    .getStagingCfg()
-                    ->getCfgDbAccess()
-                    ->createShardCfgMgrs<D>({config->xpath(credentials_xpath)});
+                isc::dhcp::ShardCfgMgrsPtr<D> shard_cfg_mgrs(
+                    shard_cfg_mgrs_.get(master, shard, config->xpath(credentials_xpath)));
+
+                std::string const config_timestamp_path(workspace() + "/" + master + "/" + shard +
+                                                        "/config.timestamp");
+                tasks.add(shard_cfg_mgrs, [shard_cfg_mgrs, config_timestamp_path]() {
+                    shard_cfg_mgrs->shard_config_mgr_->updateTimestamp(config_timestamp_path);
+                });
+            }
+        }
+        runConcurrently(tasks);
+    }
+
+    /// @brief Push the subnet changes to the servers of the shards in which only subnets have
+    /// been modified so that they don't have to reload the whole configuration.
+    ///
+    /// The changes are sent in a subnet4-delta-apply or subnet6-delta-apply command along with
+    /// the updated timestamp of the shard configuration. If the server can't be reached or
+    /// rejects the changes, it notices the updated timestamp and reloads the whole configuration
+    /// as before.
+    void sendSubnetDeltas(isc::data::ElementPtr const& config,
+                          isc::data::ElementPtr const& db_config,
+                          isc::util::Dir const& workspace) {
+        if constexpr (has_IETF) {
+            // IETF subnets need translation. Leave it to the reconfiguration.
+            return;
+        }
 
-                isc::dhcp::ShardConfigMgrFactory<D>::instance().updateTimestamp(
-                    workspace() + "/" + master + "/" + shard + "/config.timestamp");
+        // Shards with changes other than subnets are reconfigured as a whole.
+        std::unordered_set<double_key_t> excluded_shards(affected_shard_configurations_);
+        for (auto const& [key, effect] : hook_library_effects_) {
+            if (!effect.none()) {
+                excluded_shards.emplace(std::make_tuple(std::get<0>(key), std::get<1>(key)));
+            }
+        }
+
+        // Group the changes by shard.
+        std::map<double_key_t, std::pair<isc::data::ElementPtr, isc::data::ElementPtr>> deltas;
+        for (auto const& [master_shard_subnet, effect] : subnet_effects_) {
+            if (effect.none() || (effect.test(isc::data::KEY_IS_AFFECTED) && effect.count() == 1)) {
+                continue;
+            }
+            auto const& [master, shard, subnet] = master_shard_subnet;
+            double_key_t const master_shard(std::make_tuple(master, shard));
+            if (excluded_shards.contains(master_shard)) {
+                continue;
+            }
+            if (!deltas.contains(master_shard)) {
+                deltas.emplace(master_shard, std::make_pair(isc::data::Element::createList(),
+                                                            isc::data::Element::createList()));
+            }
+            auto& [subnets, deleted_subnets] = deltas.at(master_shard);
+
+            std::string const& xpath(isc::dhcp::SubnetConstants<D>::xpath(master, shard, subnet));
+            isc::data::ElementPtr subnet_element(config->xpath(xpath));
+            if (effect.test(isc::data::DELETED) || !subnet_element) {
+                isc::data::ElementPtr db_subnet_element(db_config->xpath(xpath));
+                isc::data::ElementPtr id(db_subnet_element ? db_subnet_element->get("id") :
+                                                             isc::data::ElementPtr());
+                if (!id) {
+                    // Don't know what to delete so let the server reload.
+                    excluded_shards.emplace(master_shard);
+                    continue;
+                }
+                deleted_subnets->add(isc::data::Element::create(id->intValue()));
+            } else {
+                subnets->add(subnet_element);
+            }
+        }
+
+        std::string const command_name("subnet" + isc::dhcp::dhcpSpaceToString<D>() +
+                                       "-delta-apply");
+        for (auto const& [master_shard, delta] : deltas) {
+            if (excluded_shards.contains(master_shard)) {
+                continue;
+            }
+            auto const& [master, shard] = master_shard;
+            std::string const& shard_name(master + "/" + shard);
+            try {
+                isc::data::ElementPtr const& shard_config(
+                    config->xpath(isc::dhcp::ShardConstants::xpath(master, shard)));
+                isc::data::ElementPtr control_socket(
+                    shard_config ?
+                        isc::dhcp::ConfigurationManager<D, has_IETF>::getDhcp(shard_config)->get(
+                            "control-socket") :
+                        isc::data::ElementPtr());
+                isc::data::ElementPtr socket_name(
+                    control_socket ? control_socket->get("socket-name") : isc::data::ElementPtr());
+                if (!socket_name) {
+                    continue;
+                }
+
+                // Configure credentials.
+                std::string const& credentials_xpath(
+                    isc::dhcp::ShardConstants::credentials_xpath(master, shard));
+                isc::dhcp::ShardConfigPtr const& timestamp(
+                    shard_cfg_mgrs_.get(master, shard, config->xpath(credentials_xpath))
+                        ->shard_config_mgr_->selectTimestamp(workspace() + "/" + master + "/" +
+                                                             shard + "/config.timestamp"));
+
+                isc::data::ElementPtr arguments(isc::data::Element::createMap());
+                arguments->set(isc::dhcp::ConfigurationElements<D, has_IETF>::subnet(),
+                               delta.first);
+                arguments->set("deleted-subnets", delta.second);
+                if (timestamp) {
+                    arguments->set("config-timestamp",
+                                   isc::data::Element::create(timestamp->timestamp_));
+                }
+
+                int return_code;
+                isc::data::ElementPtr const& answer(isc::config::CommandMgr::sendCommand(
+                    socket_name->stringValue(),
+                    isc::config::createCommand(command_name, arguments)));
+                isc::data::ElementPtr const& text(isc::config::parseAnswer(return_code, answer));
+                std::string const& result(PRETTY_METHOD_NAME() + ": " + command_name +
+                                          " to shard " + shard_name + ": " +
+                                          (text ? text->str() : std::to_string(return_code)));
+                if (return_code == isc::config::CONTROL_RESULT_SUCCESS) {
+                    LOG_INFO(netconf_logger, NETCONF_INFO).arg(result);
+                } else {
+                    LOG_WARN(netconf_logger, NETCONF_WARNING)
+                        .arg(result + ", the server is going to reload its configuration");
+                }
+            } catch (std::exception const& exception) {
+                LOG_WARN(netconf_logger, NETCONF_WARNING)
+                    .arg(PRETTY_METHOD_NAME() + ": " + command_name + " to shard " + shard_name +
+                         " failed, the server is going to reload its configuration: " +
+                         exception.what());
             }
         }
     }
 
+    /// @brief Runs tasks that belong to different shards concurrently and waits for all of them.
+    ///
+    /// The tasks using the same managers run on a single thread, see @ref isc::dhcp::ShardTasks.
+    void runConcurrently(isc::dhcp::ShardTasks<D>& tasks) {
+        tasks.run(pool_,
+                  std::min(std::max(std::thread::hardware_concurrency(), 1u), MAX_SHARD_THREADS));
+    }
+
     void prepareForConfigSet(isc::data::ElementPtr const& config,
                              isc::data::ElementPtr const& db_config,
                              [[maybe_unused]] isc::data::ElementPtr const& sysrepo_config,
@@ -1024,6 +1269,9 @@ private:
             actOnShards(db_config, config, sysrepo_config, workspace, test);
             actOnMasters(db_config, config, sysrepo_config, workspace, test);
             maybeUpdateTimestamp(config, workspace);
+            if (!test) {
+                sendSubnetDeltas(config, db_config, workspace);
+            }
         } catch (isc::db::TimestampHasChanged const& exception) {
             return isc::config::createAnswer(
                 isc::kea_config_tool::Controller::EXIT_TIMESTAMP_HAS_CHANGED, exception.what());
@@ -1039,6 +1287,12 @@ private:
     ControlSocketBasePtr<D> kea_config_tool_control_;
     std::string model_;
 
+    /// @brief the managers of the shards, kept to reuse the database connections
+    isc::dhcp::ShardCfgMgrsCache<D> shard_cfg_mgrs_;
+
+    /// @brief the threads processing the shards concurrently, started on first use
+    isc::util::ThreadPool<std::function<void()>> pool_;
+
     std::unordered_map<quadruple_key_t, bool> matches_key_xpath_map1_, the_rest_empty_map1_,
         matches_key_xpath_map2_, the_rest_empty_map2_;
     std::unordered_map<double_key_t, bool> has_config_database_xpath_been_handled_;
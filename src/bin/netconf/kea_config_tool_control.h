@@ -260,6 +260,16 @@ struct KeaConfigToolControl : ControlSocketBase<D> {
         isc_throw(NotImplemented, "No resource-get for kea-config-tool control socket");
     }
 
+    /// @brief Get stage latencies.
+    ///
+    /// Call stage-latency-get over the control socket.
+    ///
+    /// @return The JSON element answer of stage-latency-get.
+    /// @throw ControlSocketError when a communication error occurs.
+    isc::data::ElementPtr stageLatencyGet() override final {
+        isc_throw(NotImplemented, "No stage-latency-get for kea-config-tool control socket");
+    }
+
 private:
     isc::kea_config_tool::Controller kea_config_tool_;
 };
@@ -20,6 +20,7 @@
 
 #include <cc/command_interpreter.h>
 #include <config/command_mgr.h>
+#include <dhcpsrv/notifications_manager.h>
 #include <netconf/configuration_callback.h>
 #include <netconf/control_socket.h>
 #include <netconf/netconf_config.h>
@@ -259,6 +260,29 @@ private:
                 return isc::config::createAnswer(isc::config::CONTROL_RESULT_SUCCESS,
                                                  "non-success-code-sent notification sent.");
             });
+
+        // Batch of notifications queued by the DHCP server, see
+        // isc::dhcp::NotificationsSender. Each notification is handled by its
+        // own command above and the answers are returned in the same order.
+        isc::config::CommandMgr::instance().registerCommand(
+            isc::dhcp::NotificationsSender::BATCH_COMMAND,
+            []([[maybe_unused]] std::string const& command,
+               isc::data::ElementPtr const& data) -> isc::data::ElementPtr {
+                isc::data::ElementPtr const& notifications(data ? data->get("notifications") :
+                                                                  nullptr);
+                if (!notifications || notifications->getType() != isc::data::Element::list) {
+                    return isc::config::createAnswer(isc::config::CONTROL_RESULT_ERROR,
+                                                     "missing 'notifications' list");
+                }
+                isc::data::ElementPtr const& answers(isc::data::Element::createList());
+                for (isc::data::ElementPtr const& notification : notifications->listValue()) {
+                    answers->add(
+                        isc::config::CommandMgr::instance().processCommand(notification));
+                }
+                return isc::config::createAnswer(
+                    isc::config::CONTROL_RESULT_SUCCESS,
+                    std::to_string(answers->size()) + " notifications handled.", answers);
+            });
     }
 
 public:
@@ -416,6 +416,59 @@ void OperationalCallback::setAllResources(S_Data_Node& parent,
     setXpath(session, parent, request_xpath + getResourcePrefix<D>() + "kea-dhcp-cpu-usage", value);
 }
 
+template <DhcpSpaceType D>
+void OperationalCallback::setAllStageLatencies(S_Data_Node& parent,
+                                               S_Session& session,
+                                               string const& request_xpath) {
+    shared_ptr<ControlSocketInterface> comm;
+    string const& model(model_config_->getModel());
+    try {
+        comm = ControlSocketFactory<D>::create(model_config_->getOperational(), model);
+    } catch (exception const& exception) {
+        LOG_ERROR(netconf_logger, NETCONF_GET_OPER_ITEM_FAILED)
+            .arg(string("control socket creation failed with ") + exception.what());
+        return;
+    }
+    ElementPtr answer, latencies;
+    int rcode;
+    try {
+        answer = comm->stageLatencyGet();
+        latencies = parseAnswer(rcode, answer);
+    } catch (exception const& exception) {
+        LOG_ERROR(netconf_logger, NETCONF_GET_OPER_ITEM_FAILED)
+            .arg(string("stage-latency-get command failed with ") + exception.what());
+        return;
+    }
+    if (rcode != CONTROL_RESULT_SUCCESS) {
+        LOG_ERROR(netconf_logger, NETCONF_GET_OPER_ITEM_FAILED)
+            .arg("stage-latency-get command returned " + answerToText(answer));
+        return;
+    }
+    ElementPtr stages(latencies ? latencies->get("stages") : ElementPtr());
+    if (!stages || stages->getType() != Element::map) {
+        LOG_ERROR(netconf_logger, NETCONF_GET_OPER_ITEM_FAILED).arg("no stage latency found");
+        return;
+    }
+    for (auto const& [stage, values] : stages->mapValue()) {
+        // Stages which have not been timed are left out.
+        if (!values->contains("count") || values->get("count")->intValue() == 0) {
+            continue;
+        }
+        string const stage_xpath(request_xpath + getResourcePrefix<D>() +
+                                 "kea-dhcp-stage-latency[stage='" + stage + "']/");
+        for (string const& leaf : {"count", "min", "max", "p50", "p90", "p99", "p999"}) {
+            if (values->contains(leaf)) {
+                setXpath(session, parent, stage_xpath + leaf,
+                         to_string(values->get(leaf)->intValue()));
+            }
+        }
+        if (values->contains("mean")) {
+            setXpath(session, parent, stage_xpath + "mean",
+                     to_string(static_cast<uint64_t>(values->get("mean")->doubleValue())));
+        }
+    }
+}
+
 template <DhcpSpaceType D>
 void OperationalCallback::setAllStatistics(S_Data_Node& parent,
                                            S_Session& session,
@@ -680,6 +733,7 @@ int OperationalCallback::setOperationalData<DHCP_SPACE_V6>(S_Session session,
     parent->insert(sysrepo_get_session_->get_data(setXpath.c_str())->child());
     setAllStatistics<DHCP_SPACE_V6>(parent, session, setXpath + "/");
     setAllResources<DHCP_SPACE_V6>(parent, session, setXpath + "/");
+    setAllStageLatencies<DHCP_SPACE_V6>(parent, session, setXpath + "/");
     prepareAndSetActiveLeases(parent, session, module_name, setXpath);
 
     LOG_INFO(netconf_logger, NETCONF_GET_OPER_ITEM_SUCCESS).arg(setXpath);
@@ -702,6 +756,7 @@ int OperationalCallback::setOperationalData<DHCP_SPACE_V4>(S_Session session,
     parent = sysrepo_get_session_->get_data(setXpath.c_str());
     setAllStatistics<DHCP_SPACE_V4>(parent, session, setXpath + "/");
     setAllResources<DHCP_SPACE_V4>(parent, session, setXpath + "/");
+    setAllStageLatencies<DHCP_SPACE_V4>(parent, session, setXpath + "/");
 
     LOG_INFO(netconf_logger, NETCONF_GET_OPER_ITEM_SUCCESS).arg(setXpath);
     return SR_ERR_OK;
@@ -711,6 +766,12 @@ template void OperationalCallback::setAllResources<DHCP_SPACE_V6>(S_Data_Node&,
 
 template void OperationalCallback::setAllResources<DHCP_SPACE_V4>(S_Data_Node&, S_Session&, string);
 
+template void
+OperationalCallback::setAllStageLatencies<DHCP_SPACE_V6>(S_Data_Node&, S_Session&, string const&);
+
+template void
+OperationalCallback::setAllStageLatencies<DHCP_SPACE_V4>(S_Data_Node&, S_Session&, string const&);
+
 template void
 OperationalCallback::setAllStatistics<DHCP_SPACE_V6>(S_Data_Node&, S_Session&, string const&);
 
@@ -104,6 +104,16 @@ protected:
                          sysrepo::S_Session& session,
                          std::string request_xpath);
 
+    /// @brief Sets the stage latency operational nodes from the Kea server
+    ///
+    /// @param parent Inherited from the main callback and is set by this function
+    /// @param session Current session
+    /// @param request_xpath The path where to set the latencies
+    template <isc::dhcp::DhcpSpaceType D>
+    void setAllStageLatencies(libyang::S_Data_Node& parent,
+                              sysrepo::S_Session& session,
+                              std::string const& request_xpath);
+
     /// @brief Sets the message-stats operational nodes from the IETF Model
     ///
     /// @param parent Inherited from the main callback and is set by this function
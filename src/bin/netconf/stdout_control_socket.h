@@ -122,6 +122,16 @@ struct StdoutControlSocket : ControlSocketBase<D> {
         isc_throw(NotImplemented, "No resource-get for stdout control socket");
     }
 
+    /// @brief Get stage latencies.
+    ///
+    /// Call stage-latency-get over the control socket.
+    ///
+    /// @return The JSON element answer of stage-latency-get.
+    /// @throw ControlSocketError when a communication error occurs.
+    isc::data::ElementPtr stageLatencyGet() override final {
+        isc_throw(NotImplemented, "No stage-latency-get for stdout control socket");
+    }
+
 protected:
     /// @brief Alternative constructor for tests.
     ///
@@ -1266,4 +1266,80 @@ TEST_F(NetconfAgentTest, getOperationalData) {
     EXPECT_NO_THROW(oper_session_->get_items(operXpath.c_str()));
 }
 
+/// Verifies that a fresh push replaces the data and an incremental push merges it.
+TEST_F(NetconfAgentTest, freshPush) {
+    using Callback = ConfigurationCallback<isc::dhcp::DHCP_SPACE_V6>;
+
+    ASSERT_NO_THROW(agent_->initSysrepo());
+    S_Session session(agent_->running_session_);
+    TranslatorUniversal translator(session, KEA_DHCP6_SERVER);
+    translator.del();
+    session->apply_changes();
+
+    Callback callback((CfgModelPtr()));
+    ElementPtr const initial(Element::fromJSON(R"(
+{
+  "Dhcp6": {
+    "subnet6": [
+      { "id": 1, "subnet": "2001:db8:1::/64" },
+      { "id": 2, "subnet": "2001:db8:2::/64" },
+      { "id": 3, "subnet": "2001:db8:3::/64" }
+    ],
+    "valid-lifetime": 4000
+  }
+}
+)"));
+    ASSERT_NO_THROW(callback.pushDirectlyToSysrepo(KEA_DHCP6_SERVER, initial, session,
+                                                   Callback::FRESH_PUSH, Callback::STRAIGHT_PUSH));
+    session->apply_changes();
+    ElementPtr output(translator.get());
+    EXPECT_TRUE(isEquivalent(initial, output)) << prettyPrint(output);
+
+    // A fresh push drops what is missing and keeps the order of the subnets.
+    ElementPtr const fresh(Element::fromJSON(R"(
+{
+  "Dhcp6": {
+    "subnet6": [
+      { "id": 3, "subnet": "2001:db8:3::/64" },
+      { "id": 1, "subnet": "2001:db8:1::/64", "valid-lifetime": 5000 }
+    ]
+  }
+}
+)"));
+    ASSERT_NO_THROW(callback.pushDirectlyToSysrepo(KEA_DHCP6_SERVER, fresh, session,
+                                                   Callback::FRESH_PUSH, Callback::STRAIGHT_PUSH));
+    session->apply_changes();
+    output = translator.get();
+    EXPECT_TRUE(isEquivalent(fresh, output)) << prettyPrint(output);
+    EXPECT_EQ(prettyPrint(fresh), prettyPrint(output));
+
+    // An incremental push merges into what is there.
+    ElementPtr const incremental(Element::fromJSON(R"(
+{
+  "Dhcp6": {
+    "subnet6": [
+      { "id": 2, "subnet": "2001:db8:2::/64" }
+    ]
+  }
+}
+)"));
+    ASSERT_NO_THROW(callback.pushDirectlyToSysrepo(KEA_DHCP6_SERVER, incremental, session,
+                                                   Callback::INCREMENTAL_PUSH,
+                                                   Callback::STRAIGHT_PUSH));
+    session->apply_changes();
+    output = translator.get();
+    ElementPtr const merged(Element::fromJSON(R"(
+{
+  "Dhcp6": {
+    "subnet6": [
+      { "id": 3, "subnet": "2001:db8:3::/64" },
+      { "id": 1, "subnet": "2001:db8:1::/64", "valid-lifetime": 5000 },
+      { "id": 2, "subnet": "2001:db8:2::/64" }
+    ]
+  }
+}
+)"));
+    EXPECT_TRUE(isEquivalent(merged, output)) << prettyPrint(output);
+}
+
 }
@@ -125,6 +125,16 @@ struct UnixControlSocket : ControlSocketBase<D> {
         return sendCommand(isc::config::createCommand("resource-get", resource_elem));
     }
 
+    /// @brief Get stage latencies.
+    ///
+    /// Call stage-latency-get over the control socket.
+    ///
+    /// @return The JSON element answer of stage-latency-get.
+    /// @throw ControlSocketError when a communication error occurs.
+    isc::data::ElementPtr stageLatencyGet() override final {
+        return sendCommand(isc::config::createCommand("stage-latency-get"));
+    }
+
 private:
     /// @brief Perform the actual communication.
     ///
@@ -23,10 +23,13 @@ public:
     /// \brief Default and the only constructor of AbstractScen.
     ///
     /// \param options reference to command options,
-    /// \param socket reference to a socket.
-    AbstractScen(CommandOptions& options, BasePerfSocket &socket) :
+    /// \param socket reference to a socket,
+    /// \param thread_index index of the traffic thread running the test.
+    AbstractScen(CommandOptions& options, BasePerfSocket &socket,
+                 const size_t thread_index = 0) :
         options_(options),
-        tc_(options, socket)
+        tc_(options, socket, thread_index),
+        thread_index_(thread_index)
     {
         if (options_.getIpVersion() == 4) {
             stage1_xchg_ = ExchangeType::DO;
@@ -50,6 +53,7 @@ public:
 protected:
     CommandOptions& options_; ///< Reference to commandline options.
     TestControl tc_;  ///< Object for controling sending and receiving packets.
+    size_t thread_index_; ///< Index of the traffic thread running the test.
 
     // Helper fields to avoid checking IP version each time an exchange type
     // is needed.
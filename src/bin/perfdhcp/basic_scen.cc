@@ -11,6 +11,8 @@
 
 #include <boost/date_time/posix_time/posix_time.hpp>
 
+#include <algorithm>
+
 using namespace std;
 using namespace boost::posix_time;
 using namespace isc;
@@ -46,14 +48,14 @@ BasicScen::checkExitConditions() {
     // Check if we reached maximum number of DISCOVER/SOLICIT sent.
     if (options_.getNumRequests().size() > 0) {
         if (stats_mgr.getSentPacketsNum(stage1_xchg_) >=
-            options_.getNumRequests()[0]) {
+            share(options_.getNumRequests()[0])) {
             max_requests = true;
         }
     }
     // Check if we reached maximum number REQUEST packets.
     if (options_.getNumRequests().size() > 1) {
         if (stats_mgr.getSentPacketsNum(stage2_xchg_) >=
-            options_.getNumRequests()[1]) {
+            share(options_.getNumRequests()[1])) {
             max_requests = true;
         }
     }
@@ -67,17 +69,19 @@ BasicScen::checkExitConditions() {
     }
 
     // Check if we reached maximum number of drops of OFFER/ADVERTISE packets.
+    // Each traffic thread stops after its share of the drops, and after
+    // one drop at least.
     bool max_drops = false;
     if (options_.getMaxDrop().size() > 0) {
         if (stats_mgr.getDroppedPacketsNum(stage1_xchg_) >=
-            options_.getMaxDrop()[0]) {
+            std::max<uint64_t>(share(options_.getMaxDrop()[0]), 1)) {
             max_drops = true;
         }
     }
     // Check if we reached maximum number of drops of ACK/REPLY packets.
     if (options_.getMaxDrop().size() > 1) {
         if (stats_mgr.getDroppedPacketsNum(stage2_xchg_) >=
-            options_.getMaxDrop()[1]) {
+            std::max<uint64_t>(share(options_.getMaxDrop()[1]), 1)) {
             max_drops = true;
         }
     }
@@ -124,25 +128,42 @@ BasicScen::checkExitConditions() {
 
 int
 BasicScen::run() {
-    StatsMgr& stats_mgr(tc_.getStatsMgr());
-
     if (options_.loadRepliesFromFile()) {
         tc_.loadReplyStorageFromFile();
     }
 
-    // Preload server with the number of packets.
-    if (options_.getPreload() > 0) {
-        tc_.sendPackets(options_.getPreload(), true);
-    }
+    preload();
 
     // Fork and run command specified with -w<wrapped-command>
     if (!options_.getWrapped().empty()) {
         tc_.runWrapped();
     }
 
+    exchangePackets();
+
+    return (report());
+}
+
+void
+BasicScen::preload() {
+    // Preload server with the number of packets.
+    const uint64_t preload = share(options_.getPreload());
+    if (preload > 0) {
+        tc_.sendPackets(preload, true);
+    }
+}
+
+void
+BasicScen::exchangePackets() {
+    StatsMgr& stats_mgr(tc_.getStatsMgr());
+
     tc_.start();
 
     for (;;) {
+        // Other traffic threads read the statistics between
+        // the iterations.
+        std::lock_guard<std::mutex> lock(stats_mutex_);
+
         // Calculate number of packets to be sent to stay
         // catch up with rate.
         uint64_t packets_due =
@@ -158,7 +179,7 @@ BasicScen::run() {
         // If there is nothing to do in this loop iteration then do some sleep to make
         // CPU idle for a moment, to not consume 100% CPU all the time
         // but only if it is not that high request rate expected.
-        if (options_.getRate() < 10000 && packets_due == 0 && pkt_count == 0) {
+        if (basic_rate_control_.getRate() < 10000 && packets_due == 0 && pkt_count == 0) {
             /// @todo: need to implement adaptive time here, so the sleep time
             /// is not fixed, but adjusts to current situation.
             usleep(1);
@@ -173,7 +194,8 @@ BasicScen::run() {
 
         // If we are in renew only mode, only send discovers / solicits until
         // we get one offer / advertise. Otherwise, always send.
-        if (tc_.replyStorageSize() < options_.requestCountForRenews() || !options_.renewOnly()) {
+        if (tc_.replyStorageSize() < share(options_.requestCountForRenews()) ||
+            !options_.renewOnly()) {
             // Initiate new DHCP packet exchanges.
             tc_.sendPackets(packets_due);
         }
@@ -202,8 +224,9 @@ BasicScen::run() {
         }
 
         // Report delay means that user requested printing number
-        // of sent/received/dropped packets repeatedly.
-        if (options_.getReportDelay() > 0) {
+        // of sent/received/dropped packets repeatedly. With many
+        // traffic threads, the main thread prints these reports.
+        if ((options_.getReportDelay() > 0) && (options_.getThreadCount() == 1)) {
             tc_.printIntermediateStats();
         }
 
@@ -217,6 +240,20 @@ BasicScen::run() {
     }
 
     tc_.stop();
+}
+
+void
+BasicScen::mergeStatsTo(StatsMgr& stats_mgr, const bool new_interval) {
+    std::lock_guard<std::mutex> lock(stats_mutex_);
+    stats_mgr.merge(tc_.getStatsMgr());
+    if (new_interval) {
+        tc_.getStatsMgr().clearIntervalDelays();
+    }
+}
+
+int
+BasicScen::report() {
+    StatsMgr& stats_mgr(tc_.getStatsMgr());
 
     tc_.printStats();
 
@@ -11,6 +11,8 @@
 
 #include <perfdhcp/abstract_scen.h>
 
+#include <mutex>
+
 
 namespace isc {
 namespace perfdhcp {
@@ -24,14 +26,22 @@ class BasicScen : public AbstractScen {
 public:
     /// \brief Default and the only constructor of BasicScen.
     ///
+    /// With many traffic threads, each one of them runs its own BasicScen
+    /// which sends its share of the packets.
+    ///
     /// \param options reference to command options,
-    /// \param socket reference to a socket.
-    BasicScen(CommandOptions& options, BasePerfSocket &socket):
-        AbstractScen(options, socket)
+    /// \param socket reference to a socket,
+    /// \param thread_index index of the traffic thread running the test.
+    BasicScen(CommandOptions& options, BasePerfSocket &socket,
+              const size_t thread_index = 0):
+        AbstractScen(options, socket, thread_index)
     {
-        basic_rate_control_.setRate(options_.getRate());
-        renew_rate_control_.setRate(options_.getRenewRate());
-        release_rate_control_.setRate(options_.getReleaseRate());
+        basic_rate_control_.setRate(options_.getThreadShare(options_.getRate(),
+                                                            thread_index_));
+        renew_rate_control_.setRate(options_.getThreadShare(options_.getRenewRate(),
+                                                            thread_index_));
+        release_rate_control_.setRate(options_.getThreadShare(options_.getReleaseRate(),
+                                                              thread_index_));
     };
 
     /// brief\ Run performance test.
@@ -45,6 +55,29 @@ public:
     /// \return execution status.
     int run() override;
 
+    /// \brief Send the preload packets.
+    void preload();
+
+    /// \brief Exchange packets with the server until the test ends.
+    void exchangePackets();
+
+    /// \brief Print the final report.
+    ///
+    /// \return execution status.
+    int report();
+
+    /// \brief Add the statistics of the test to other ones.
+    ///
+    /// It may be called from another thread while the test runs.
+    ///
+    /// \param stats_mgr statistics to add to.
+    /// \param new_interval start a new period of the periodic reports
+    /// once the statistics are added.
+    void mergeStatsTo(StatsMgr& stats_mgr, const bool new_interval = false);
+
+    /// \brief Returns the statistics of the test.
+    StatsMgr& getStatsMgr() { return (tc_.getStatsMgr()); }
+
 protected:
     /// \brief A rate control class for Discover and Solicit messages.
     RateControl basic_rate_control_;
@@ -53,6 +86,16 @@ protected:
     /// \brief A rate control class for Release messages.
     RateControl release_rate_control_;
 
+    /// \brief Lock of the statistics, held by each loop iteration.
+    std::mutex stats_mutex_;
+
+    /// \brief Returns the share of the test thread of a count.
+    ///
+    /// \param total count of all the threads.
+    uint64_t share(const uint64_t total) const {
+        return (options_.getThreadShare(total, thread_index_));
+    }
+
     /// \brief Check if test exit conditions fulfilled.
     ///
     /// Method checks if the test exit conditions are fulfilled.
@@ -14,6 +14,7 @@
 #include <dhcp/option.h>
 #include <cfgrpt/config_report.h>
 #include <util/encode/hex.h>
+#include <util/strutil.h>
 #include <asiolink/io_error.h>
 
 #include <boost/lexical_cast.hpp>
@@ -23,6 +24,7 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <unistd.h>
+#include <algorithm>
 #include <fstream>
 #include <thread>
 #include <getopt.h>
@@ -167,6 +169,9 @@ CommandOptions::reset() {
     } else {
         single_thread_mode_ = false;
     }
+    thread_count_ = 1;
+    percentiles_ = { 50., 90., 99., 99.9 };
+    latency_histogram_file_.clear();
     scenario_ = Scenario::BASIC;
 }
 
@@ -217,6 +222,9 @@ CommandOptions::parse(int argc, char** const argv, bool print_cmd_line) {
 }
 
 const int LONG_OPT_SCENARIO = 300;
+const int LONG_OPT_THREADS = 301;
+const int LONG_OPT_PERCENTILES = 302;
+const int LONG_OPT_LATENCY_HISTOGRAM = 303;
 
 bool
 CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
@@ -237,6 +245,9 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
 
     struct option long_options[] = {
         {"scenario", required_argument, 0, LONG_OPT_SCENARIO},
+        {"threads",  required_argument, 0, LONG_OPT_THREADS},
+        {"percentiles", required_argument, 0, LONG_OPT_PERCENTILES},
+        {"latency-histogram", required_argument, 0, LONG_OPT_LATENCY_HISTOGRAM},
         {0,          0,                 0, 0}
     };
 
@@ -610,11 +621,46 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
             }
             break;
         }
+        case LONG_OPT_THREADS:
+            thread_count_ = positiveInteger("value of the number of threads:"
+                                            " --threads <threads> must be a"
+                                            " positive integer");
+            break;
+
+        case LONG_OPT_PERCENTILES: {
+            percentiles_.clear();
+            std::vector<std::string> tokens =
+                isc::util::str::tokens(optarg, ",");
+            for (auto const& token : tokens) {
+                double percentile = 0.;
+                try {
+                    percentile = boost::lexical_cast<double>(token);
+                } catch (const boost::bad_lexical_cast&) {
+                    percentile = -1.;
+                }
+                check((percentile <= 0.) || (percentile > 100.),
+                      "value of percentiles: --percentiles <list> must be"
+                      " a comma separated list of numbers greater than 0"
+                      " and at most 100");
+                percentiles_.push_back(percentile);
+            }
+            break;
+        }
+
+        case LONG_OPT_LATENCY_HISTOGRAM:
+            latency_histogram_file_ = std::string(optarg);
+            break;
+
         default:
             isc_throw(isc::InvalidParameter, "wrong command line option");
         }
     }
 
+    // Each traffic thread receives its packets itself.
+    if (thread_count_ > 1) {
+        single_thread_mode_ = true;
+    }
+
     // If the IP version was not specified in the
     // command line, assume IPv4.
     if (ipversion_ == 0) {
@@ -666,7 +712,9 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
             std::cout << "Scenario: avalanche." << std::endl;
         }
 
-        if (!isSingleThreaded()) {
+        if (thread_count_ > 1) {
+            std::cout << "Traffic threads: " << thread_count_ << "." << std::endl;
+        } else if (!isSingleThreaded()) {
             std::cout << "Multi-thread mode enabled." << std::endl;
         }
     }
@@ -984,7 +1032,45 @@ CommandOptions::validate() {
     check((!getMacListFile().empty() && base_.size() > 0),
           "Can't use -b with -M option");
 
+    if (getThreadCount() > 1) {
+        check(getScenario() != Scenario::BASIC,
+              "--threads is only supported by the basic scenario");
+        check(isUseRelayedV6(),
+              "--threads is not compatible with -A<encapsulation-level>");
+        check(!getTemplateFiles().empty(),
+              "--threads is not compatible with -T<template-file>");
+        check(!getWrapped().empty(),
+              "--threads is not compatible with -w<wrapped>");
+        check(loadRepliesFromFile() || saveRepliesToFile(),
+              "--threads is not compatible with -y and -Y");
+        check(testDiags('t'),
+              "--threads is not compatible with -x t");
+        check(!getMacsFromFile().empty() &&
+              (getMacsFromFile().size() < getThreadCount()),
+              "the MAC address list given with -M must hold at least"
+              " one address per thread");
+        check((getClientsNum() > 1) && (getClientsNum() < getThreadCount()),
+              "-R<range> must be at least the number of threads");
+        const int threads = static_cast<int>(getThreadCount());
+        check(((getRate() > 0) && (getRate() < threads)) ||
+              ((getRenewRate() > 0) && (getRenewRate() < threads)) ||
+              ((getReleaseRate() > 0) && (getReleaseRate() < threads)),
+              "the rates given with -r, -f and -F must be at least the"
+              " number of threads");
+        for (auto num_request : getNumRequests()) {
+            check(num_request < threads,
+                  "-n<num-request> must be at least the number of threads");
+        }
+        check(renewOnly() && (requestCountForRenews() < threads),
+              "-z<request-count> must be at least the number of threads");
+    }
+
+    // The traffic threads receive their packets themselves so the
+    // thread mode does not apply to them.
     auto nthreads = std::thread::hardware_concurrency();
+    if (getThreadCount() > 1) {
+        nthreads = 0;
+    }
     if (nthreads == 1 && isSingleThreaded() == false) {
         std::cout << "WARNING: Currently system can run only 1 thread in parallel." << std::endl
                   << "WARNING: Better results are achieved when run in single-threaded mode." << std::endl
@@ -1009,6 +1095,20 @@ CommandOptions::validate() {
     }
 }
 
+uint64_t
+CommandOptions::getThreadShare(const uint64_t total,
+                               const size_t thread_index) const {
+    return ((total / thread_count_) +
+            ((thread_index < total % thread_count_) ? 1 : 0));
+}
+
+uint64_t
+CommandOptions::getThreadOffset(const uint64_t total,
+                                const size_t thread_index) const {
+    return ((total / thread_count_) * thread_index +
+            std::min(static_cast<uint64_t>(thread_index), total % thread_count_));
+}
+
 void
 CommandOptions::check(bool condition, const std::string& errmsg) const {
     // The same could have been done with macro or just if statement but
@@ -1164,6 +1264,17 @@ CommandOptions::printCommandLine() const {
     } else {
         std::cout << "multi-thread-mode" << std::endl;
     }
+    if (thread_count_ > 1) {
+        std::cout << "threads=" << thread_count_ << std::endl;
+    }
+    std::cout << "percentiles=";
+    for (size_t i = 0; i < percentiles_.size(); ++i) {
+        std::cout << (i > 0 ? "," : "") << percentiles_[i];
+    }
+    std::cout << std::endl;
+    if (!latency_histogram_file_.empty()) {
+        std::cout << "latency-histogram=" << latency_histogram_file_ << std::endl;
+    }
 }
 
 void
@@ -1179,7 +1290,8 @@ CommandOptions::usage() const {
         "         [-c] [-1] [-M<mac-list-file>] [-T<template-file>]\n"
         "         [-X<xid-offset>] [-O<random-offset] [-E<time-offset>]\n"
         "         [-S<srvid-offset>] [-I<ip-offset>] [-x<diagnostic-selector>]\n"
-        "         [-w<wrapped>] [-z] [server]\n"
+        "         [-w<wrapped>] [-z] [--threads <threads>]\n"
+        "         [--percentiles <list>] [--latency-histogram <file>] [server]\n"
         "\n"
         "The [server] argument is the name/address of the DHCP server to\n"
         "contact.  For DHCPv4 operation, exchanges are initiated by\n"
@@ -1250,6 +1362,10 @@ CommandOptions::usage() const {
         "    normally be routed to the server is used.\n"
         "    For DHCPv6 operation, specify the name of the network interface\n"
         "    via which exchanges are initiated.\n"
+        "--latency-histogram <file>: Save the histograms of the delays of\n"
+        "    the exchanges to <file> at the end of the test, in CSV if the\n"
+        "    name ends with .csv and in JSON otherwise. The delays are in\n"
+        "    nanoseconds.\n"
         "-L<local-port>: Specify the local port to use\n"
         "    (the value 0 means to use the default).\n"
         "-M<mac-list-file>: A text file containing a list of MAC addresses,\n"
@@ -1261,6 +1377,9 @@ CommandOptions::usage() const {
         "    (the value 0 means to use the default).\n"
         "-O<random-offset>: Offset of the last octet to randomize in the template.\n"
         "-P<preload>: Initiate first <preload> exchanges back to back at startup.\n"
+        "--percentiles <list>: Comma separated list of the percentiles of the\n"
+        "    delays to report, 50,90,99,99.9 by default. The periodic reports\n"
+        "    give them for the delays of the last period.\n"
         "-r<rate>: Initiate <rate> DORA/SARR (or if -i is given, DO/SA)\n"
         "    exchanges per second.  A periodic report is generated showing the\n"
         "    number of exchanges which were not completed, as well as the\n"
@@ -1274,6 +1393,14 @@ CommandOptions::usage() const {
         "    (second/request) template.\n"
         "-T<template-file>: The name of a file containing the template to use\n"
         "    as a stream of hexadecimal digits.\n"
+        "--threads <threads>: Generate the traffic from <threads> threads,\n"
+        "    1 by default. Each thread has its own socket, bound to the same\n"
+        "    local port, and simulates its own range of clients. The rates,\n"
+        "    request counts and the client range are split between the\n"
+        "    threads, and their statistics are merged in the reports. The\n"
+        "    responses are steered to the threads by transaction id, which\n"
+        "    requires Linux. Only the basic scenario is supported, without\n"
+        "    -A, -T, -w, -y, -Y and -x t.\n"
         "-v: Report the version number of this program.\n"
         "-W<time>: Specifies exit-wait-time parameter, that makes perfdhcp wait\n"
         "    for <time> us after an exit condition has been met to receive all\n"
@@ -378,6 +378,42 @@ public:
     /// \return true if single-threaded mode is enabled.
     bool isSingleThreaded() const { return single_thread_mode_; }
 
+    /// \brief Returns the number of traffic threads.
+    ///
+    /// \return number of threads given with --threads, 1 by default.
+    size_t getThreadCount() const { return thread_count_; }
+
+    /// \brief Returns the share of a thread in a total.
+    ///
+    /// Rates, request counts and the client range are split evenly
+    /// between the threads, the first threads getting one more when the
+    /// total is not a multiple of the number of threads.
+    ///
+    /// \param total the value to split.
+    /// \param thread_index index of the thread.
+    /// \return share of the thread.
+    uint64_t getThreadShare(const uint64_t total,
+                            const size_t thread_index) const;
+
+    /// \brief Returns the sum of the shares of the previous threads.
+    ///
+    /// \param total the value to split.
+    /// \param thread_index index of the thread.
+    /// \return the first value of the range of the thread.
+    uint64_t getThreadOffset(const uint64_t total,
+                             const size_t thread_index) const;
+
+    /// \brief Returns the delay percentiles to report.
+    ///
+    /// \return percentiles given with --percentiles, 50, 90, 99 and 99.9
+    /// by default.
+    const std::vector<double>& getPercentiles() const { return percentiles_; }
+
+    /// \brief Returns the file the delay histograms are saved to.
+    ///
+    /// \return file given with --latency-histogram, empty by default.
+    std::string getLatencyHistogramFile() const { return latency_histogram_file_; }
+
     /// \brief Returns selected scenario.
     ///
     /// \return enum Scenario.
@@ -742,6 +778,15 @@ private:
     /// @brief Option to switch modes between single-threaded and multi-threaded.
     bool single_thread_mode_;
 
+    /// @brief Number of threads generating traffic.
+    size_t thread_count_;
+
+    /// @brief Percentiles of the delays to report.
+    std::vector<double> percentiles_;
+
+    /// @brief File to save the delay histograms to.
+    std::string latency_histogram_file_;
+
     /// @brief Selected performance scenario. Default is basic.
     Scenario scenario_;
 
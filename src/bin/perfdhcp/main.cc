@@ -9,6 +9,7 @@
 #include <perfdhcp/avalanche_scen.h>
 #include <perfdhcp/basic_scen.h>
 #include <perfdhcp/command_options.h>
+#include <perfdhcp/threaded_scen.h>
 
 #include <exceptions/exceptions.h>
 
@@ -45,13 +46,18 @@ main(int argc, char* argv[]) {
     }
     try{
         auto scenario = command_options.getScenario();
-        PerfSocket socket(command_options);
-        if (scenario == Scenario::BASIC) {
-            BasicScen scen(command_options, socket);
-            ret_code = scen.run();
-        } else if (scenario == Scenario::AVALANCHE) {
-            AvalancheScen scen(command_options, socket);
+        if (command_options.getThreadCount() > 1) {
+            ThreadedScen scen(command_options);
             ret_code = scen.run();
+        } else {
+            PerfSocket socket(command_options);
+            if (scenario == Scenario::BASIC) {
+                BasicScen scen(command_options, socket);
+                ret_code = scen.run();
+            } else if (scenario == Scenario::AVALANCHE) {
+                AvalancheScen scen(command_options, socket);
+                ret_code = scen.run();
+            }
         }
     } catch (const std::exception& e) {
         ret_code = 1;
@@ -50,6 +50,12 @@ public:
 
     /// \brief See description of this method in PerfSocket class below.
     virtual dhcp::IfacePtr getIface() = 0;
+
+    /// \brief Send the packets queued by send.
+    ///
+    /// The sockets which send the packets in batches queue them in
+    /// send. The others send them at once, so there is nothing to do.
+    virtual void flush() { }
 };
 
 /// \brief Socket wrapper structure.
@@ -8,6 +8,11 @@
 
 #include <perfdhcp/stats_mgr.h>
 
+#include <cc/data.h>
+
+#include <algorithm>
+#include <fstream>
+
 namespace isc {
 namespace perfdhcp {
 
@@ -111,6 +116,30 @@ ExchangeStats::updateDelays(const dhcp::PktPtr& sent_packet,
     // mean delays.
     sum_delay_ += delta;
     sum_delay_squared_ += delta * delta;
+
+    // Count the delay in the histograms, for the percentiles.
+    const uint64_t delay_ns = period.length().total_nanoseconds();
+    delays_.record(delay_ns);
+    interval_delays_.record(delay_ns);
+}
+
+void
+ExchangeStats::merge(const ExchangeStats& other) {
+    min_delay_ = std::min(min_delay_, other.min_delay_);
+    max_delay_ = std::max(max_delay_, other.max_delay_);
+    sum_delay_ += other.sum_delay_;
+    sum_delay_squared_ += other.sum_delay_squared_;
+    delays_.merge(other.delays_);
+    interval_delays_.merge(other.interval_delays_);
+    orphans_ += other.orphans_;
+    collected_ += other.collected_;
+    unordered_lookup_size_sum_ += other.unordered_lookup_size_sum_;
+    unordered_lookups_ += other.unordered_lookups_;
+    ordered_lookups_ += other.ordered_lookups_;
+    sent_packets_num_ += other.sent_packets_num_;
+    rcvd_packets_num_ += other.rcvd_packets_num_;
+    non_unique_addr_num_ += other.non_unique_addr_num_;
+    rejected_leases_num_ += other.rejected_leases_num_;
 }
 
 dhcp::PktPtr
@@ -318,6 +347,7 @@ ExchangeStats::printTimestamps() {
 
 StatsMgr::StatsMgr(CommandOptions& options) :
     exchanges_(),
+    percentiles_(options.getPercentiles()),
     boot_time_(boost::posix_time::microsec_clock::universal_time())
 {
     // Check if packet archive mode is required. If user
@@ -350,7 +380,87 @@ StatsMgr::StatsMgr(CommandOptions& options) :
         addCustomCounter("shortwait", "Short waits for packets");
     }
 }
-int ExchangeStats::malformed_pkts_{0};
+void
+StatsMgr::merge(const StatsMgr& other) {
+    for (auto const& xchg : other.exchanges_) {
+        auto it = exchanges_.find(xchg.first);
+        if (it != exchanges_.end()) {
+            it->second->merge(*xchg.second);
+        }
+    }
+    for (auto const& counter : other.custom_counters_) {
+        auto it = custom_counters_.find(counter.first);
+        if (it != custom_counters_.end()) {
+            *it->second += counter.second->getValue();
+        }
+    }
+    if (other.boot_time_ < boot_time_) {
+        boot_time_ = other.boot_time_;
+    }
+}
+
+void
+StatsMgr::saveLatencyHistograms(const std::string& file) const {
+    std::ofstream out(file.c_str());
+    if (!out.good()) {
+        isc_throw(InvalidOperation, "unable to open the file " << file
+                  << " to save the latency histograms");
+    }
+
+    const std::string csv(".csv");
+    if ((file.size() >= csv.size()) &&
+        (file.compare(file.size() - csv.size(), csv.size(), csv) == 0)) {
+        out << "exchange,lowest-ns,highest-ns,count" << std::endl;
+        for (auto const& xchg : exchanges_) {
+            for (auto const& bucket : xchg.second->getDelays().getBuckets()) {
+                out << xchg.first << "," << bucket.lowest_ << ","
+                    << bucket.highest_ << "," << bucket.count_ << std::endl;
+            }
+        }
+    } else {
+        using namespace isc::data;
+        ElementPtr exchanges = Element::createList();
+        for (auto const& xchg : exchanges_) {
+            const util::LatencyHistogram& delays = xchg.second->getDelays();
+            ElementPtr exchange = Element::createMap();
+            std::ostringstream name;
+            name << xchg.first;
+            exchange->set("exchange", Element::create(name.str()));
+            exchange->set("count", Element::create(static_cast<long long int>(delays.getCount())));
+            exchange->set("min-ns", Element::create(static_cast<long long int>(delays.getMin())));
+            exchange->set("max-ns", Element::create(static_cast<long long int>(delays.getMax())));
+            exchange->set("mean-ns", Element::create(delays.getMean()));
+            ElementPtr percentiles = Element::createList();
+            for (auto percentile : percentiles_) {
+                ElementPtr entry = Element::createMap();
+                entry->set("percentile", Element::create(percentile));
+                entry->set("delay-ns", Element::create(static_cast<long long int>(delays.getPercentile(percentile))));
+                percentiles->add(entry);
+            }
+            exchange->set("percentiles", percentiles);
+            ElementPtr buckets = Element::createList();
+            for (auto const& bucket : delays.getBuckets()) {
+                ElementPtr entry = Element::createMap();
+                entry->set("lowest-ns", Element::create(static_cast<long long int>(bucket.lowest_)));
+                entry->set("highest-ns", Element::create(static_cast<long long int>(bucket.highest_)));
+                entry->set("count", Element::create(static_cast<long long int>(bucket.count_)));
+                buckets->add(entry);
+            }
+            exchange->set("buckets", buckets);
+            exchanges->add(exchange);
+        }
+        ElementPtr histograms = Element::createMap();
+        histograms->set("exchanges", exchanges);
+        prettyPrint(histograms, out);
+        out << std::endl;
+    }
+    if (!out.good()) {
+        isc_throw(InvalidOperation, "unable to write the latency histograms"
+                  " to the file " << file);
+    }
+}
+
+std::atomic<int> ExchangeStats::malformed_pkts_{0};
 
 }
 }
@@ -10,6 +10,7 @@
 #include <dhcp/pkt.h>
 #include <exceptions/exceptions.h>
 #include <perfdhcp/command_options.h>
+#include <util/latency_histogram.h>
 
 #include <boost/noncopyable.hpp>
 #include <boost/multi_index_container.hpp>
@@ -19,9 +20,13 @@
 #include <boost/multi_index/mem_fun.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 
+#include <atomic>
+#include <iomanip>
 #include <iostream>
 #include <map>
 #include <queue>
+#include <sstream>
+#include <vector>
 
 
 namespace isc {
@@ -326,6 +331,14 @@ public:
     /// not found
     dhcp::PktPtr matchPackets(const dhcp::PktPtr& rcvd_packet);
 
+    /// \brief Add the counters and delays of other statistics.
+    ///
+    /// Used to merge the statistics of the traffic threads. The
+    /// packet lists are not merged.
+    ///
+    /// \param other statistics of the same exchange type.
+    void merge(const ExchangeStats& other);
+
     /// \brief Return minimum delay between sent and received packet.
     ///
     /// Method returns minimum delay between sent and received packet.
@@ -518,7 +531,9 @@ public:
     /// packet delay and standard deviation of delays. Packet delay
     /// is a duration between sending a packet to server and receiving
     /// response from server.
-    void printRTTStats() const {
+    ///
+    /// \param percentiles percentiles of the delays to print.
+    void printRTTStats(const std::vector<double>& percentiles = {}) const {
         using namespace std;
         try {
             cout << fixed << setprecision(3)
@@ -526,18 +541,47 @@ public:
                  << "avg delay: " << getAvgDelay() * 1e3 << " ms" << endl
                  << "max delay: " << getMaxDelay() * 1e3 << " ms" << endl
                  << "std deviation: " << getStdDevDelay() * 1e3 << " ms"
-                 << endl
-                 << "collected packets: " << getCollectedNum() << endl;
+                 << endl;
+            for (auto percentile : percentiles) {
+                cout << percentileName(percentile) << " delay: "
+                     << delays_.getPercentile(percentile) * 1e-6 << " ms"
+                     << endl;
+            }
+            cout << "collected packets: " << getCollectedNum() << endl;
         } catch (const Exception&) {
             // repeated output for easier automated parsing
             cout << "min delay: n/a" << endl
                  << "avg delay: n/a" << endl
                  << "max delay: n/a" << endl
-                 << "std deviation: n/a" << endl
-                 << "collected packets: 0" << endl;
+                 << "std deviation: n/a" << endl;
+            for (auto percentile : percentiles) {
+                cout << percentileName(percentile) << " delay: n/a" << endl;
+            }
+            cout << "collected packets: 0" << endl;
         }
     }
 
+    /// \brief Returns the name of a percentile, e.g. p99.9.
+    ///
+    /// \param percentile percentile.
+    static std::string percentileName(const double percentile) {
+        std::ostringstream name;
+        name << "p" << percentile;
+        return (name.str());
+    }
+
+    /// \brief Returns the histogram of the delays in nanoseconds.
+    const util::LatencyHistogram& getDelays() const { return (delays_); }
+
+    /// \brief Returns the histogram of the delays in nanoseconds since
+    /// the last periodic report.
+    const util::LatencyHistogram& getIntervalDelays() const {
+        return (interval_delays_);
+    }
+
+    /// \brief Starts a new period of the periodic reports.
+    void clearIntervalDelays() { interval_delays_.clear(); }
+
     //// \brief Print timestamps for sent and received packets.
     ///
     /// Method prints timestamps for all sent and received packets for
@@ -554,7 +598,7 @@ public:
         return(std::make_tuple(sent_packets_.begin(), sent_packets_.end()));
     }
 
-    static int malformed_pkts_;
+    static std::atomic<int> malformed_pkts_;
 
 // Private stuff of ExchangeStats class
 private:
@@ -628,6 +672,11 @@ private:
     double sum_delay_squared_;     ///< Squared sum of delays between
                                    ///< sent and received packets.
 
+    util::LatencyHistogram delays_;          ///< Histogram of delays in
+                                             ///< nanoseconds.
+    util::LatencyHistogram interval_delays_; ///< Histogram of delays since
+                                             ///< the last periodic report.
+
     uint64_t orphans_;   ///< Number of orphan received packets.
 
     uint64_t collected_; ///< Number of garbage collected packets.
@@ -790,6 +839,16 @@ public:
         return (*counter);
     }
 
+    /// \brief Add the counters and delays of another manager.
+    ///
+    /// Used to merge the statistics of the traffic threads into the
+    /// statistics of the whole test. The exchanges and counters which are
+    /// not tracked by this manager are skipped. The test is deemed to
+    /// have started with the earliest of the two managers.
+    ///
+    /// \param other statistics manager of a traffic thread.
+    void merge(const StatsMgr& other);
+
     /// \brief Adds new packet to the sent packets list.
     ///
     /// Method adds new packet to the sent packets list.
@@ -882,6 +941,24 @@ public:
         return(xchg_stats->getStdDevDelay());
     }
 
+    /// \brief Return histogram of packet delays.
+    ///
+    /// \param xchg_type exchange type.
+    /// \throw isc::BadValue if invalid exchange type specified.
+    /// \return histogram of the delays in nanoseconds.
+    const util::LatencyHistogram& getDelays(const ExchangeType xchg_type) const {
+        return(getExchangeStats(xchg_type)->getDelays());
+    }
+
+    /// \brief Return histogram of packet delays since the last report.
+    ///
+    /// \param xchg_type exchange type.
+    /// \throw isc::BadValue if invalid exchange type specified.
+    /// \return histogram of the delays in nanoseconds.
+    const util::LatencyHistogram& getIntervalDelays(const ExchangeType xchg_type) const {
+        return(getExchangeStats(xchg_type)->getIntervalDelays());
+    }
+
     /// \brief Return number of orphan packets.
     ///
     /// Method returns number of orphan packets for specified
@@ -1078,7 +1155,7 @@ public:
                       << "***" << std::endl;
             xchg_stats->printMainStats();
             std::cout << std::endl;
-            xchg_stats->printRTTStats();
+            xchg_stats->printRTTStats(percentiles_);
             std::cout << std::endl;
         }
     }
@@ -1087,16 +1164,18 @@ public:
     ///
     /// Method prints intermediate statistics for all exchanges.
     /// Statistics includes sent, received and dropped packets
-    /// counters.
+    /// counters, and the percentiles of the delays since the previous
+    /// report.
     ///
     /// \param clean_report value to generate easy to parse report.
     /// \param clean_sep string used as separator if clean_report enabled..
     void
-    printIntermediateStats(bool clean_report, std::string clean_sep) const {
+    printIntermediateStats(bool clean_report, std::string clean_sep) {
         std::ostringstream stream_sent;
         std::ostringstream stream_rcvd;
         std::ostringstream stream_drops;
         std::ostringstream stream_reject;
+        std::vector<std::ostringstream> stream_percentiles(percentiles_.size());
         std::string sep("");
         for (ExchangesMapIterator it = exchanges_.begin();
              it != exchanges_.end(); ++it) {
@@ -1112,21 +1191,39 @@ public:
             stream_rcvd << sep << it->second->getRcvdPacketsNum();
             stream_drops << sep << it->second->getDroppedPacketsNum();
             stream_reject << sep << it->second->getRejLeasesNum();
+            const util::LatencyHistogram& delays = it->second->getIntervalDelays();
+            for (size_t i = 0; i < percentiles_.size(); ++i) {
+                stream_percentiles[i] << sep;
+                if (delays.getCount() > 0) {
+                    stream_percentiles[i] << std::fixed << std::setprecision(3)
+                                          << delays.getPercentile(percentiles_[i]) * 1e-6;
+                } else {
+                    stream_percentiles[i] << "n/a";
+                }
+            }
+            it->second->clearIntervalDelays();
         }
 
         if (clean_report) {
         std::cout << stream_sent.str()
                   << clean_sep << stream_rcvd.str()
                   << clean_sep << stream_drops.str()
-                  << clean_sep << stream_reject.str()
-                  << std::endl;
+                  << clean_sep << stream_reject.str();
+        for (auto const& stream : stream_percentiles) {
+            std::cout << clean_sep << stream.str();
+        }
+        std::cout << std::endl;
 
         } else {
         std::cout << "sent: " << stream_sent.str()
                   << "; received: " << stream_rcvd.str()
                   << "; drops: " << stream_drops.str()
-                  << "; rejected: " << stream_reject.str()
-                  << std::endl;
+                  << "; rejected: " << stream_reject.str();
+        for (size_t i = 0; i < percentiles_.size(); ++i) {
+            std::cout << "; " << ExchangeStats::percentileName(percentiles_[i])
+                      << " delay: " << stream_percentiles[i].str() << " ms";
+        }
+        std::cout << std::endl;
         }
     }
 
@@ -1177,6 +1274,25 @@ public:
         }
     }
 
+    /// \brief Start a new period of the periodic reports.
+    ///
+    /// The delays counted since the last report are forgotten.
+    void clearIntervalDelays() {
+        for (auto const& xchg : exchanges_) {
+            xchg.second->clearIntervalDelays();
+        }
+    }
+
+    /// \brief Save the histograms of the delays to a file.
+    ///
+    /// The file is in CSV, with one line per bucket of each exchange,
+    /// if its name ends with .csv and in JSON otherwise. The delays are
+    /// in nanoseconds.
+    ///
+    /// \param file name of the file.
+    /// \throw isc::InvalidOperation if the file cannot be written.
+    void saveLatencyHistograms(const std::string& file) const;
+
     std::tuple<typename ExchangeStats::PktListIterator, typename ExchangeStats::PktListIterator> getSentPackets(const ExchangeType xchg_type) const {
         ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
         std::tuple<typename ExchangeStats::PktListIterator, typename ExchangeStats::PktListIterator> sent_packets_its = xchg_stats->getSentPackets();
@@ -1214,6 +1330,9 @@ private:
     /// archived.
     bool archive_enabled_;
 
+    /// Percentiles of the delays to report.
+    std::vector<double> percentiles_;
+
     boost::posix_time::ptime boot_time_; ///< Time when test is started.
 };
 
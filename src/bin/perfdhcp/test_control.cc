@@ -41,7 +41,7 @@ using namespace isc::asiolink;
 namespace isc {
 namespace perfdhcp {
 
-bool TestControl::interrupted_ = false;
+std::atomic<bool> TestControl::interrupted_(false);
 
 bool
 TestControl::waitToExit() {
@@ -75,9 +75,9 @@ TestControl::haveAllPacketsBeenReceived() const {
     }
 
     uint32_t responses = 0;
-    uint32_t requests = num_request[0];
+    uint32_t requests = options_.getThreadShare(num_request[0], thread_index_);
     if (num_request_size >= 2) {
-        requests += num_request[1];
+        requests += options_.getThreadShare(num_request[1], thread_index_);
     }
 
     if (ipversion == 4) {
@@ -99,11 +99,8 @@ TestControl::cleanCachedPackets() {
         return;
     }
 
-    static boost::posix_time::ptime last_clean =
-        microsec_clock::universal_time();
-
     // Check how much time has passed since last cleanup.
-    time_period time_since_clean(last_clean,
+    time_period time_since_clean(last_clean_,
                                  microsec_clock::universal_time());
     // Cleanup every 1 second.
     if (time_since_clean.length().total_seconds() >= 1) {
@@ -112,13 +109,14 @@ TestControl::cleanCachedPackets() {
         // since we want to randomize leases to be renewed so leave 5
         // times more packets to randomize from.
         /// @todo The cache size might be controlled from the command line.
-        if (reply_storage_.size() > 5 * options_.getRenewRate()) {
-            reply_storage_.clear(reply_storage_.size() -
-                                 5 * options_.getRenewRate());
+        const uint64_t renew_rate =
+            options_.getThreadShare(options_.getRenewRate(), thread_index_);
+        if (reply_storage_.size() > 5 * renew_rate) {
+            reply_storage_.clear(reply_storage_.size() - 5 * renew_rate);
         }
         // Remember when we performed a cleanup for the last time.
         // We want to do the next cleanup not earlier than in one second.
-        last_clean = microsec_clock::universal_time();
+        last_clean_ = microsec_clock::universal_time();
     }
 }
 
@@ -312,8 +310,8 @@ TestControl::generateMacAddress(uint8_t& randomized) {
     // if we are using the -M option return a random one from the list...
     if (macs.size() > 0) {
       uint16_t r = number_generator_();
-      if (r >= macs.size()) {
-        r = 0;
+      if (r >= macs_end_) {
+        r = macs_first_;
       }
       return macs[r];
 
@@ -368,8 +366,8 @@ TestControl::generateDuid(uint8_t& randomized) {
     // pick a random mac address if we are using option -M..
     if (macs.size() > 0) {
       uint16_t r = number_generator_();
-      if (r >= macs.size()) {
-        r = 0;
+      if (r >= macs_end_) {
+        r = macs_first_;
       }
       std::vector<uint8_t> mac = macs[r];
       // DUID_LL is in this format
@@ -531,27 +529,28 @@ TestControl::sendPackets(const uint64_t packets_num,
             }
         }
     }
+    socket_.flush();
 }
 
 uint64_t
 TestControl::sendMultipleRequests(const uint64_t msg_num) {
-    for (uint64_t i = 0; i < msg_num; ++i) {
-        if (!sendRequestFromAck()) {
-            return (i);
-        }
+    uint64_t sent = 0;
+    while ((sent < msg_num) && sendRequestFromAck()) {
+        ++sent;
     }
-    return (msg_num);
+    socket_.flush();
+    return (sent);
 }
 
 uint64_t
 TestControl::sendMultipleMessages6(const uint32_t msg_type,
                                    const uint64_t msg_num) {
-    for (uint64_t i = 0; i < msg_num; ++i) {
-        if (!sendMessageFromReply(msg_type)) {
-            return (i);
-        }
+    uint64_t sent = 0;
+    while ((sent < msg_num) && sendMessageFromReply(msg_type)) {
+        ++sent;
     }
-    return (msg_num);
+    socket_.flush();
+    return (sent);
 }
 
 void
@@ -693,6 +692,9 @@ TestControl::printStats() const {
     if (options_.testDiags('i')) {
         stats_mgr_.printCustomCounters();
     }
+    if (!options_.getLatencyHistogramFile().empty()) {
+        stats_mgr_.saveLatencyHistograms(options_.getLatencyHistogramFile());
+    }
 }
 
 std::string
@@ -966,6 +968,8 @@ TestControl::consumeReceivedPackets() {
             processReceivedPacket6(pkt6);
         }
     }
+    // Send the requests built from the received offers and advertises.
+    socket_.flush();
     return pkt_count;
 }
 void
@@ -1054,12 +1058,22 @@ TestControl::reset() {
     interrupted_ = false;
 }
 
-TestControl::TestControl(CommandOptions& options, BasePerfSocket &socket) :
+TestControl::TestControl(CommandOptions& options, BasePerfSocket &socket,
+                         const size_t thread_index) :
     exit_time_(not_a_date_time),
-    number_generator_(0, options.getMacsFromFile().size()),
+    number_generator_(options.getThreadOffset(options.getMacsFromFile().size(),
+                                              thread_index),
+                      options.getThreadOffset(options.getMacsFromFile().size(),
+                                              thread_index + 1)),
     socket_(socket),
     receiver_(socket, options.isSingleThreaded(), options.getIpVersion()),
     stats_mgr_(options),
+    thread_index_(thread_index),
+    macs_first_(options.getThreadOffset(options.getMacsFromFile().size(),
+                                        thread_index)),
+    macs_end_(options.getThreadOffset(options.getMacsFromFile().size(),
+                                      thread_index + 1)),
+    last_clean_(microsec_clock::universal_time()),
     options_(options)
 {
     // Reset singleton state before test starts.
@@ -1086,8 +1100,28 @@ TestControl::TestControl(CommandOptions& options, BasePerfSocket &socket) :
         1 : options_.getClientsNum();
     setMacAddrGenerator(NumberGeneratorPtr(new SequentialGenerator(clients_num)));
 
-    // Diagnostics are command line options mainly.
-    printDiagnostics();
+    // Each traffic thread uses the transaction ids which are equal to its
+    // index modulo the number of threads, so the responses can be steered
+    // to it, and its own range of clients.
+    const size_t thread_count = options_.getThreadCount();
+    if (thread_count > 1) {
+        const uint32_t transid_range =
+            (options_.getIpVersion() == 4 ? 0xFFFFFFFF : 0x00FFFFFF);
+        setTransidGenerator(NumberGeneratorPtr(new StridedGenerator(thread_index_,
+                                                                    thread_count,
+                                                                    transid_range)));
+        if (clients_num > 1) {
+            const uint32_t first = options_.getThreadOffset(clients_num, thread_index_);
+            const uint32_t end = options_.getThreadOffset(clients_num, thread_index_ + 1);
+            setMacAddrGenerator(NumberGeneratorPtr(new StridedGenerator(first, 1, end)));
+        }
+    }
+
+    // Diagnostics are command line options mainly: the first traffic
+    // thread prints them for all.
+    if (thread_index_ == 0) {
+        printDiagnostics();
+    }
     // Option factories have to be registered.
     registerOptionFactories();
     // Initialize packet templates.
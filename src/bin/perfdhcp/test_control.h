@@ -25,6 +25,7 @@
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/noncopyable.hpp>
 
+#include <atomic>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -146,7 +147,13 @@ static const size_t DHCPV6_IA_NA_OFFSET = 40;
 class TestControl : public boost::noncopyable {
 public:
     /// \brief Default constructor.
-    TestControl(CommandOptions& options, BasePerfSocket& socket);
+    ///
+    /// \param options command options.
+    /// \param socket socket used for the traffic.
+    /// \param thread_index index of the traffic thread, when the
+    /// traffic is generated by many threads (--threads).
+    TestControl(CommandOptions& options, BasePerfSocket& socket,
+                const size_t thread_index = 0);
 
     /// Packet template buffer.
     typedef std::vector<uint8_t> TemplateBuffer;
@@ -211,6 +218,48 @@ public:
         uint32_t range_; ///< Number of unique numbers generated.
     };
 
+    /// \brief Strided numbers generator class.
+    ///
+    /// Generates first, first + step, first + 2 * step... below the
+    /// range and then starts over. With many traffic threads, it gives
+    /// each thread the transaction ids which are equal to its index
+    /// modulo the number of threads, and its own range of clients.
+    class StridedGenerator : public NumberGenerator {
+    public:
+        /// \brief Constructor.
+        ///
+        /// \param first first number generated.
+        /// \param step difference between two numbers.
+        /// \param range numbers are generated below this value.
+        StridedGenerator(uint32_t first, uint32_t step, uint32_t range) :
+            NumberGenerator(),
+            first_(first),
+            step_(step == 0 ? 1 : step),
+            num_(0),
+            count_(0) {
+            if (range > first_) {
+                count_ = (static_cast<uint64_t>(range) - first_ + step_ - 1) / step_;
+            }
+            if (count_ == 0) {
+                count_ = 1;
+            }
+        }
+
+        /// \brief Generate the next number.
+        ///
+        /// \return generated number.
+        virtual uint32_t generate() {
+            uint32_t num = first_ + num_ * step_;
+            num_ = (num_ + 1) % count_;
+            return (num);
+        }
+    private:
+        uint32_t first_; ///< First number.
+        uint32_t step_;  ///< Difference between two numbers.
+        uint32_t num_;   ///< Index of the next number.
+        uint32_t count_; ///< Number of numbers generated.
+    };
+
     /// \brief Length of the Ethernet HW address (MAC) in bytes.
     ///
     /// \todo Make this variable length as there are cases when HW
@@ -252,6 +301,9 @@ public:
     /// \brief Get interrupted flag.
     bool interrupted() const { return interrupted_; }
 
+    /// \brief Interrupt the test of all the traffic threads, as SIGINT does.
+    static void interrupt() { interrupted_ = true; }
+
     /// \brief Get stats manager.
     StatsMgr& getStatsMgr() { return stats_mgr_; };
 
@@ -1235,7 +1287,19 @@ protected:
     std::map<uint8_t, dhcp::Pkt6Ptr> template_packets_v6_;
 
     /// \brief Program interrupted flag.
-    static bool interrupted_;
+    static std::atomic<bool> interrupted_;
+
+    /// \brief Index of the traffic thread.
+    size_t thread_index_;
+
+    /// \brief First index in the MAC address list (-M) used.
+    size_t macs_first_;
+
+    /// \brief Index in the MAC address list (-M) after the last used.
+    size_t macs_end_;
+
+    /// \brief Last time the cached packets were cleaned.
+    boost::posix_time::ptime last_clean_;
 
     /// \brief Command options.
     CommandOptions& options_;
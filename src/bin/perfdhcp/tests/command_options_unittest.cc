@@ -821,6 +821,77 @@ TEST_F(CommandOptionsTest, LoadMacsFromFile) {
     EXPECT_EQ(4, m.size());
 }
 
+TEST_F(CommandOptionsTest, Threads) {
+    CommandOptions opt;
+    EXPECT_NO_THROW(process(opt, "perfdhcp all"));
+    EXPECT_EQ(1, opt.getThreadCount());
+
+    EXPECT_NO_THROW(process(opt, "perfdhcp --threads 4 -r 10 -R 100 -n 8 all"));
+    EXPECT_EQ(4, opt.getThreadCount());
+    // The traffic threads receive their packets themselves.
+    EXPECT_TRUE(opt.isSingleThreaded());
+
+    // The counts are split between the threads, the first ones
+    // taking the remainder.
+    EXPECT_EQ(3, opt.getThreadShare(10, 0));
+    EXPECT_EQ(3, opt.getThreadShare(10, 1));
+    EXPECT_EQ(2, opt.getThreadShare(10, 2));
+    EXPECT_EQ(2, opt.getThreadShare(10, 3));
+    EXPECT_EQ(0, opt.getThreadOffset(10, 0));
+    EXPECT_EQ(3, opt.getThreadOffset(10, 1));
+    EXPECT_EQ(6, opt.getThreadOffset(10, 2));
+    EXPECT_EQ(8, opt.getThreadOffset(10, 3));
+    EXPECT_EQ(10, opt.getThreadOffset(10, 4));
+
+    // The number of threads must be positive.
+    EXPECT_THROW(process(opt, "perfdhcp --threads 0 all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp --threads -2 all"),
+                 isc::InvalidParameter);
+
+    // Each thread needs its share of the counts.
+    EXPECT_THROW(process(opt, "perfdhcp --threads 4 -r 3 all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp --threads 4 -R 3 all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp --threads 4 -n 3 all"),
+                 isc::InvalidParameter);
+    std::ostringstream cmd;
+    cmd << "perfdhcp --threads 5 -M " << getFullPath("mac-list.txt") << " all";
+    EXPECT_THROW(process(opt, cmd.str()), isc::InvalidParameter);
+
+    // Only the basic scenario and the options which do not share
+    // a state between the threads are supported.
+    EXPECT_THROW(process(opt, "perfdhcp --threads 2 --scenario avalanche all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp --threads 2 -w script all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp --threads 2 -x t all"),
+                 isc::InvalidParameter);
+}
+
+TEST_F(CommandOptionsTest, Percentiles) {
+    CommandOptions opt;
+    EXPECT_NO_THROW(process(opt, "perfdhcp all"));
+    std::vector<double> percentiles = { 50., 90., 99., 99.9 };
+    EXPECT_EQ(percentiles, opt.getPercentiles());
+    EXPECT_TRUE(opt.getLatencyHistogramFile().empty());
+
+    EXPECT_NO_THROW(process(opt, "perfdhcp --percentiles 99.99,100"
+                            " --latency-histogram delays.csv all"));
+    percentiles = { 99.99, 100. };
+    EXPECT_EQ(percentiles, opt.getPercentiles());
+    EXPECT_EQ("delays.csv", opt.getLatencyHistogramFile());
+
+    // The percentiles must be greater than 0 and at most 100.
+    EXPECT_THROW(process(opt, "perfdhcp --percentiles 0 all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp --percentiles 50,100.1 all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process(opt, "perfdhcp --percentiles p99 all"),
+                 isc::InvalidParameter);
+}
+
 TEST_F(CommandOptionsTest, LoadGiaddrFromFile) {
     CommandOptions opt;
     std::string giaddr_list_full_path = getFullPath("giaddr-list.txt");
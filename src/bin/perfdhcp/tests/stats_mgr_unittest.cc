@@ -10,6 +10,7 @@
 
 #include <perfdhcp/stats_mgr.h>
 
+#include <cc/data.h>
 #include <exceptions/exceptions.h>
 #include <dhcp/dhcp4.h>
 #include <dhcp/dhcp6.h>
@@ -20,6 +21,8 @@
 
 #include <boost/date_time/posix_time/posix_time.hpp>
 
+#include <fstream>
+
 using namespace std;
 using namespace isc;
 using namespace isc::dhcp;
@@ -488,6 +491,83 @@ TEST_F(StatsMgrTest, Delays) {
     EXPECT_GT(stats_mgr->getStdDevDelay(ExchangeType::DO), 0);
 }
 
+TEST_F(StatsMgrTest, DelayHistograms) {
+    CommandOptions opt;
+    CommandOptionsHelper::process(opt, "perfdhcp --percentiles 50,100 127.0.0.1");
+    std::shared_ptr<StatsMgr> stats_mgr(new StatsMgr(opt));
+    stats_mgr->addExchangeStats(ExchangeType::DO, 5);
+
+    passDOPacketsWithDelay(stats_mgr, 2, common_transid);
+    passDOPacketsWithDelay(stats_mgr, 1, common_transid + 1);
+
+    // The delays are known within 1/32 of their value.
+    const util::LatencyHistogram& delays = stats_mgr->getDelays(ExchangeType::DO);
+    EXPECT_EQ(2, delays.getCount());
+    EXPECT_NEAR(1e9, delays.getPercentile(50), 1e9 / 32);
+    EXPECT_NEAR(2e9, delays.getPercentile(100), 2e9 / 32);
+
+    // The periodic report starts a new period.
+    EXPECT_EQ(2, stats_mgr->getIntervalDelays(ExchangeType::DO).getCount());
+    EXPECT_NO_THROW(stats_mgr->printIntermediateStats(false, ""));
+    EXPECT_EQ(0, stats_mgr->getIntervalDelays(ExchangeType::DO).getCount());
+    EXPECT_EQ(2, delays.getCount());
+    EXPECT_NO_THROW(stats_mgr->printIntermediateStats(true, ","));
+    EXPECT_NO_THROW(stats_mgr->printStats());
+
+    // The histograms are saved in CSV, one line per bucket.
+    ASSERT_NO_THROW(stats_mgr->saveLatencyHistograms("latency-histogram.csv"));
+    std::ifstream csv("latency-histogram.csv");
+    std::string line;
+    ASSERT_TRUE(std::getline(csv, line));
+    EXPECT_EQ("exchange,lowest-ns,highest-ns,count", line);
+    size_t lines = 0;
+    while (std::getline(csv, line)) {
+        EXPECT_EQ(0, line.find("DISCOVER-OFFER,"));
+        ++lines;
+    }
+    EXPECT_EQ(2, lines);
+
+    // Or in JSON.
+    ASSERT_NO_THROW(stats_mgr->saveLatencyHistograms("latency-histogram.json"));
+    data::ElementPtr json;
+    ASSERT_NO_THROW(json = data::Element::fromJSONFile("latency-histogram.json"));
+    data::ElementPtr exchange = json->get("exchanges")->get(0);
+    ASSERT_TRUE(exchange);
+    EXPECT_EQ("DISCOVER-OFFER", exchange->get("exchange")->stringValue());
+    EXPECT_EQ(2, exchange->get("count")->intValue());
+    EXPECT_EQ(2, exchange->get("percentiles")->size());
+    EXPECT_EQ(2, exchange->get("buckets")->size());
+}
+
+TEST_F(StatsMgrTest, Merge) {
+    CommandOptions opt;
+    std::shared_ptr<StatsMgr> stats_mgr(new StatsMgr(opt));
+    std::shared_ptr<StatsMgr> other(new StatsMgr(opt));
+    stats_mgr->addExchangeStats(ExchangeType::DO, 5);
+    other->addExchangeStats(ExchangeType::DO, 5);
+    stats_mgr->addCustomCounter("shortwait", "Short waits");
+    other->addCustomCounter("shortwait", "Short waits");
+
+    // The traffic threads exchange packets with different delays.
+    passDOPacketsWithDelay(stats_mgr, 2, common_transid);
+    passDOPacketsWithDelay(other, 1, common_transid + 1);
+    std::shared_ptr<Pkt4> sent_packet(createPacket4(DHCPDISCOVER,
+                                                    common_transid + 2));
+    other->passSentPacket(ExchangeType::DO, sent_packet);
+    other->incrementCounter("shortwait");
+    other->incrementCounter("shortwait");
+
+    stats_mgr->merge(*other);
+    EXPECT_EQ(3, stats_mgr->getSentPacketsNum(ExchangeType::DO));
+    EXPECT_EQ(2, stats_mgr->getRcvdPacketsNum(ExchangeType::DO));
+    EXPECT_LT(stats_mgr->getMinDelay(ExchangeType::DO), 1.5);
+    EXPECT_GT(stats_mgr->getMaxDelay(ExchangeType::DO), 1.5);
+    EXPECT_EQ(2, stats_mgr->getCounter("shortwait")->getValue());
+
+    // The statistics merged from are not modified.
+    EXPECT_EQ(2, other->getSentPacketsNum(ExchangeType::DO));
+}
+
 TEST_F(StatsMgrTest, CustomCounters) {
     CommandOptions opt;
     std::unique_ptr<StatsMgr> stats_mgr(new StatsMgr(opt));
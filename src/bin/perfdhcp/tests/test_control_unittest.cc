@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <stdint.h>
+#include <set>
 #include <string>
 #include <fstream>
 #include <gtest/gtest.h>
@@ -143,6 +144,7 @@ public:
     using TestControl::generateClientId;
     using TestControl::generateDuid;
     using TestControl::generateMacAddress;
+    using TestControl::generateTransid;
     using TestControl::getTemplateBuffer;
     using TestControl::initPacketTemplates;
     using TestControl::processReceivedPacket4;
@@ -179,6 +181,13 @@ public:
         setMacAddrGenerator(NumberGeneratorPtr(new TestControl::SequentialGenerator(clients_num)));
     };
 
+    /// \brief Constructor of the test control of a traffic thread.
+    ///
+    /// It keeps the generators set up for the thread.
+    NakedTestControl(CommandOptions &opt, const size_t thread_index) :
+        TestControl(opt, fake_sock_, thread_index) {
+    };
+
 };
 
 
@@ -1204,6 +1213,53 @@ TEST_F(TestControlTest, GenerateDuid) {
     ASSERT_TRUE(std::find(macs.begin(), macs.end(), mac) != macs.end());
 }
 
+// Check that the transaction ids and the MAC addresses generated by
+// the traffic threads are their own.
+TEST_F(TestControlTest, Threads) {
+    CommandOptions opt;
+    processCmdLine(opt, "perfdhcp -l 127.0.0.1 -R 30 --threads 3 all");
+
+    std::set<std::vector<uint8_t> > all_macs;
+    for (size_t thread_index = 0; thread_index < 3; ++thread_index) {
+        NakedTestControl tc(opt, thread_index);
+        std::set<std::vector<uint8_t> > macs;
+        for (int i = 0; i < 50; ++i) {
+            // The responses are steered to the thread by transaction id.
+            EXPECT_EQ(thread_index, tc.generateTransid() % 3);
+            uint8_t randomized = 0;
+            macs.insert(tc.generateMacAddress(randomized));
+        }
+        // Each thread simulates a third of the clients.
+        EXPECT_EQ(10, macs.size());
+        all_macs.insert(macs.begin(), macs.end());
+    }
+    EXPECT_EQ(30, all_macs.size());
+
+    // The DHCPv6 transaction ids are 24 bits long.
+    processCmdLine(opt, "perfdhcp -6 -l 127.0.0.1 --threads 4 servers");
+    NakedTestControl tc(opt, 3);
+    for (int i = 0; i < 50; ++i) {
+        const uint32_t transid = tc.generateTransid();
+        EXPECT_EQ(3, transid % 4);
+        EXPECT_EQ(0, transid & 0xFF000000);
+    }
+}
+
+// Check the generator of the numbers of the traffic threads.
+TEST_F(TestControlTest, StridedGenerator) {
+    TestControl::StridedGenerator gen(1, 3, 10);
+    EXPECT_EQ(1, gen.generate());
+    EXPECT_EQ(4, gen.generate());
+    EXPECT_EQ(7, gen.generate());
+    // The numbers start again after the range.
+    EXPECT_EQ(1, gen.generate());
+
+    // An empty range generates the first number.
+    TestControl::StridedGenerator empty(5, 1, 5);
+    EXPECT_EQ(5, empty.generate());
+    EXPECT_EQ(5, empty.generate());
+}
+
 TEST_F(TestControlTest, GenerateMacAddress) {
     CommandOptions opt;
     // Simulate one client only. Always the same MAC address will be
@@ -0,0 +1,84 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include "command_options_helper.h"
+#include "../thread_perf_socket.h"
+
+#include <asiolink/io_address.h>
+#include <exceptions/exceptions.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/pkt4.h>
+
+#include <gtest/gtest.h>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::perfdhcp;
+
+namespace {
+
+TEST(ThreadPerfSocketTest, WrongCommandOptions) {
+    CommandOptions opt;
+
+    // make sure we catch -6 paired with v4 address
+    CommandOptionsHelper::process(opt, "perfdhcp -l 127.0.0.1 -6 --threads 2 192.168.1.1");
+    EXPECT_THROW(ThreadPerfSocket sock(opt, 0), isc::InvalidParameter);
+}
+
+#if defined (OS_LINUX)
+
+// Check that the responses are received by the socket of the thread
+// which sent the request.
+TEST(ThreadPerfSocketTest, Steering) {
+    CommandOptions opt;
+    CommandOptionsHelper::process(opt, "perfdhcp -l 127.0.0.1 -L 10067 --threads 2 127.0.0.1");
+    ThreadPerfSocket sock0(opt, 0);
+    ThreadPerfSocket sock1(opt, 1);
+    EXPECT_EQ(IOAddress("127.0.0.1"), sock0.addr_);
+    EXPECT_EQ(10067, sock1.port_);
+
+    // Both packets are sent by the first thread to the shared port.
+    for (uint32_t transid = 10; transid < 12; ++transid) {
+        Pkt4Ptr pkt(new Pkt4(DHCPOFFER, transid));
+        pkt->setRemoteAddr(IOAddress("127.0.0.1"));
+        pkt->setRemotePort(10067);
+        pkt->pack();
+        EXPECT_TRUE(sock0.send(pkt));
+    }
+    // Nothing goes out before the flush.
+    EXPECT_FALSE(sock0.receive4(0, 0));
+    ASSERT_NO_THROW(sock0.flush());
+
+    Pkt4Ptr pkt0 = sock0.receive4(1, 0);
+    ASSERT_TRUE(pkt0);
+    EXPECT_EQ(10, pkt0->getTransid());
+    EXPECT_EQ(DHCPOFFER, pkt0->getType());
+    EXPECT_EQ(10067, pkt0->getRemotePort());
+    Pkt4Ptr pkt1 = sock1.receive4(1, 0);
+    ASSERT_TRUE(pkt1);
+    EXPECT_EQ(11, pkt1->getTransid());
+
+    EXPECT_FALSE(sock0.receive4(0, 1000));
+    EXPECT_FALSE(sock1.receive4(0, 1000));
+}
+
+#endif
+
+}
@@ -0,0 +1,511 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <perfdhcp/thread_perf_socket.h>
+#include <perfdhcp/stats_mgr.h>
+
+#include <asiolink/io_address.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/iface_mgr.h>
+#include <exceptions/exceptions.h>
+
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#if defined (OS_LINUX)
+#include <linux/filter.h>
+#endif
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+
+namespace {
+
+/// \brief Fill in a socket address.
+///
+/// \param addr address.
+/// \param port port.
+/// \param ifindex index of the interface, used as the scope of IPv6
+/// link-local and multicast addresses.
+/// \param[out] storage socket address.
+/// \return length of the socket address.
+socklen_t
+toSockaddr(const IOAddress& addr, uint16_t port, uint16_t ifindex,
+           sockaddr_storage& storage) {
+    memset(&storage, 0, sizeof(storage));
+    if (addr.isV4()) {
+        sockaddr_in* sa = reinterpret_cast<sockaddr_in*>(&storage);
+        sa->sin_family = AF_INET;
+        sa->sin_port = htons(port);
+        sa->sin_addr.s_addr = htonl(addr.toUint32());
+        return (sizeof(sockaddr_in));
+    }
+    sockaddr_in6* sa = reinterpret_cast<sockaddr_in6*>(&storage);
+    sa->sin6_family = AF_INET6;
+    sa->sin6_port = htons(port);
+    const std::vector<uint8_t> bytes = addr.toBytes();
+    memcpy(&sa->sin6_addr, &bytes[0], sizeof(sa->sin6_addr));
+    if (addr.isV6LinkLocal() || addr.isV6Multicast()) {
+        sa->sin6_scope_id = ifindex;
+    }
+    return (sizeof(sockaddr_in6));
+}
+
+/// \brief Read the address and the port of a socket address.
+///
+/// \param storage socket address.
+/// \param[out] port port.
+/// \return address.
+IOAddress
+fromSockaddr(const sockaddr_storage& storage, uint16_t& port) {
+    if (storage.ss_family == AF_INET6) {
+        const sockaddr_in6* sa = reinterpret_cast<const sockaddr_in6*>(&storage);
+        port = ntohs(sa->sin6_port);
+        return (IOAddress::fromBytes(AF_INET6, sa->sin6_addr.s6_addr));
+    }
+    const sockaddr_in* sa = reinterpret_cast<const sockaddr_in*>(&storage);
+    port = ntohs(sa->sin_port);
+    return (IOAddress(ntohl(sa->sin_addr.s_addr)));
+}
+
+/// \brief Find the local address used to reach a remote address.
+///
+/// \param remote remote address.
+/// \param port remote port.
+/// \return local address.
+/// \throw isc::BadValue if the address cannot be found.
+IOAddress
+getLocalAddress(const IOAddress& remote, uint16_t port) {
+    sockaddr_storage storage;
+    socklen_t len = toSockaddr(remote, port, 0, storage);
+    int sock = socket(storage.ss_family, SOCK_DGRAM, 0);
+    if (sock < 0) {
+        isc_throw(isc::BadValue, "unable to open socket: " << strerror(errno));
+    }
+    // Connecting a datagram socket sends nothing: it only selects
+    // the route and so the local address.
+    if (connect(sock, reinterpret_cast<sockaddr*>(&storage), len) < 0) {
+        const int error = errno;
+        close(sock);
+        isc_throw(isc::BadValue, "unable to find the local address to reach "
+                  << remote << ": " << strerror(error));
+    }
+    len = sizeof(storage);
+    if (getsockname(sock, reinterpret_cast<sockaddr*>(&storage), &len) < 0) {
+        const int error = errno;
+        close(sock);
+        isc_throw(isc::BadValue, "unable to find the local address to reach "
+                  << remote << ": " << strerror(error));
+    }
+    close(sock);
+    uint16_t local_port;
+    return (fromSockaddr(storage, local_port));
+}
+
+/// \brief Find the interface which holds an address.
+///
+/// \param addr address.
+/// \return interface or null pointer if none holds it.
+IfacePtr
+getIfaceByAddress(const IOAddress& addr) {
+    for (IfacePtr iface : IfaceMgr::instance().getIfaces()) {
+        if (iface->hasAddress(addr)) {
+            return (iface);
+        }
+    }
+    return (IfacePtr());
+}
+
+}
+
+namespace isc {
+namespace perfdhcp {
+
+const size_t ThreadPerfSocket::BATCH_SIZE;
+
+ThreadPerfSocket::ThreadPerfSocket(CommandOptions& options,
+                                   const size_t thread_index) :
+    ip_version_(options.getIpVersion()),
+    buffers_(BATCH_SIZE * IfaceMgr::RCVBUFSIZE) {
+    openSocket(options);
+    try {
+        // The first socket of the group decides the program
+        // for all of them.
+        if (thread_index == 0) {
+            attachSteeringFilter(options.getThreadCount());
+        }
+    } catch (...) {
+        close(sockfd_);
+        throw;
+    }
+    queued_.reserve(BATCH_SIZE);
+}
+
+ThreadPerfSocket::~ThreadPerfSocket() {
+    close(sockfd_);
+}
+
+void
+ThreadPerfSocket::openSocket(CommandOptions& options) {
+    const std::string localname = options.getLocalName();
+    const std::string servername = options.getServerName();
+    uint16_t port = options.getLocalPort();
+
+    const short family = (ip_version_ == 6) ? AF_INET6 : AF_INET;
+    IOAddress remoteaddr(servername);
+
+    // Check for mismatch between IP option and server address
+    if (family != remoteaddr.getFamily()) {
+        isc_throw(InvalidParameter,
+                  "Values for IP version: " <<
+                  static_cast<unsigned int>(ip_version_) <<
+                  " and server address: " << servername << " are mismatched.");
+    }
+
+    if (port == 0) {
+        if (family == AF_INET6) {
+            port = DHCP6_CLIENT_PORT;
+            if (options.isUseRelayedV6()) {
+                port = DHCP6_SERVER_PORT;
+            }
+        } else {
+            port = 67;
+        }
+    }
+
+    // Local name is specified along with '-l' option.
+    // It may point to interface name or local address.
+    IfacePtr iface;
+    IOAddress localaddr = (family == AF_INET6) ? IOAddress::IPV6_ZERO_ADDRESS() :
+        IOAddress::IPV4_ZERO_ADDRESS();
+    if (!localname.empty() && options.isInterface()) {
+        iface = IfaceMgr::instance().getIface(localname);
+        if (!iface) {
+            isc_throw(BadValue, "unknown interface " << localname);
+        }
+        bool found = false;
+        for (Iface::Address addr : iface->getAddresses()) {
+            if (addr.get().getFamily() == family) {
+                localaddr = addr.get();
+                found = true;
+                break;
+            }
+        }
+        if (!found) {
+            isc_throw(BadValue, "interface " << localname << " has no IPv"
+                      << static_cast<unsigned int>(ip_version_) << " address");
+        }
+    } else {
+        if (!localname.empty()) {
+            localaddr = IOAddress(localname);
+        } else {
+            localaddr = getLocalAddress(remoteaddr, port);
+        }
+        iface = getIfaceByAddress(localaddr);
+        if (!iface) {
+            isc_throw(BadValue, "no interface holds the address " << localaddr);
+        }
+    }
+    ifindex_ = iface->getIndex();
+    iface_name_ = iface->getName();
+    addr_ = localaddr;
+    port_ = port;
+    family_ = family;
+
+    sockfd_ = socket(family, SOCK_DGRAM, 0);
+    if (sockfd_ < 0) {
+        isc_throw(BadValue, "unable to open socket to communicate with "
+                  "DHCP server: " << strerror(errno));
+    }
+    try {
+        if (fcntl(sockfd_, F_SETFD, FD_CLOEXEC) < 0) {
+            isc_throw(BadValue, "unable to set close-on-exec on the socket");
+        }
+
+        int flag = 1;
+#ifdef SO_REUSEPORT
+        if (setsockopt(sockfd_, SOL_SOCKET, SO_REUSEPORT,
+                       &flag, sizeof(flag)) < 0) {
+            isc_throw(BadValue, "unable to set SO_REUSEPORT on the socket: "
+                      << strerror(errno));
+        }
+#else
+        isc_throw(NotImplemented, "many traffic threads require SO_REUSEPORT");
+#endif
+        if ((family == AF_INET6) &&
+            (setsockopt(sockfd_, IPPROTO_IPV6, IPV6_V6ONLY,
+                        &flag, sizeof(flag)) < 0)) {
+            isc_throw(BadValue, "unable to set IPV6_V6ONLY on the socket");
+        }
+
+        sockaddr_storage storage;
+        socklen_t len = toSockaddr(localaddr, port, ifindex_, storage);
+        if (bind(sockfd_, reinterpret_cast<sockaddr*>(&storage), len) < 0) {
+            isc_throw(BadValue, "unable to bind socket to " << localaddr
+                      << " port " << port << ": " << strerror(errno));
+        }
+
+        // The options below are set as PerfSocket sets them.
+        if ((ip_version_ == 4) && options.isBroadcast()) {
+            if (setsockopt(sockfd_, SOL_SOCKET, SO_BROADCAST,
+                           &flag, sizeof(flag)) < 0) {
+                isc_throw(InvalidOperation,
+                          "unable to set broadcast option on the socket");
+            }
+        } else if ((ip_version_ == 6) && remoteaddr.isV6Multicast()) {
+            int hops = 1;
+            int idx = ifindex_;
+            if ((setsockopt(sockfd_, IPPROTO_IPV6, IPV6_MULTICAST_HOPS,
+                            &hops, sizeof(hops)) < 0) ||
+                (setsockopt(sockfd_, IPPROTO_IPV6, IPV6_MULTICAST_IF,
+                            &idx, sizeof(idx)) < 0)) {
+                isc_throw(InvalidOperation,
+                          "unable to enable multicast on socket " << sockfd_
+                          << ". errno = " << errno);
+            }
+        }
+    } catch (...) {
+        close(sockfd_);
+        throw;
+    }
+}
+
+void
+ThreadPerfSocket::attachSteeringFilter(const size_t thread_count) {
+#if defined (OS_LINUX) && defined (SO_ATTACH_REUSEPORT_CBPF)
+    // The program gets the UDP payload. The transaction id of DHCPv4
+    // is the word at the offset 4, the one of DHCPv6 is made of the
+    // three bytes following the message type. The remainder of the
+    // id is the index of the socket receiving the packet.
+    const uint32_t offset = (ip_version_ == 6) ? 0 : 4;
+    const uint32_t mask = (ip_version_ == 6) ? 0x00FFFFFF : 0xFFFFFFFF;
+    sock_filter code[] = {
+        BPF_STMT(BPF_LD | BPF_W | BPF_ABS, offset),
+        BPF_STMT(BPF_ALU | BPF_AND | BPF_K, mask),
+        BPF_STMT(BPF_ALU | BPF_MOD | BPF_K, static_cast<uint32_t>(thread_count)),
+        BPF_STMT(BPF_RET | BPF_A, 0)
+    };
+    sock_fprog prog;
+    prog.len = sizeof(code) / sizeof(code[0]);
+    prog.filter = code;
+    if (setsockopt(sockfd_, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF,
+                   &prog, sizeof(prog)) < 0) {
+        isc_throw(BadValue, "unable to attach the program steering the "
+                  "responses to the threads: " << strerror(errno));
+    }
+#else
+    static_cast<void>(thread_count);
+    isc_throw(NotImplemented, "steering the responses to many traffic "
+              "threads is supported on Linux only");
+#endif
+}
+
+bool
+ThreadPerfSocket::receiveBatch(uint32_t timeout_sec, uint32_t timeout_usec) {
+#if defined (OS_LINUX)
+    if ((timeout_sec > 0) || (timeout_usec > 0)) {
+        pollfd pfd;
+        pfd.fd = sockfd_;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        // Round the wait time up to a millisecond.
+        const int timeout = timeout_sec * 1000 + (timeout_usec + 999) / 1000;
+        const int ret = poll(&pfd, 1, timeout);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                return (false);
+            }
+            isc_throw(SocketReadError, "failed to poll socket " << sockfd_
+                      << ": " << strerror(errno));
+        }
+        if (ret == 0) {
+            return (false);
+        }
+    }
+
+    mmsghdr msgs[BATCH_SIZE];
+    iovec iovs[BATCH_SIZE];
+    sockaddr_storage from[BATCH_SIZE];
+    memset(msgs, 0, sizeof(msgs));
+    for (size_t i = 0; i < BATCH_SIZE; ++i) {
+        iovs[i].iov_base = &buffers_[i * IfaceMgr::RCVBUFSIZE];
+        iovs[i].iov_len = IfaceMgr::RCVBUFSIZE;
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+        msgs[i].msg_hdr.msg_name = &from[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(from[i]);
+    }
+    const int count = recvmmsg(sockfd_, msgs, BATCH_SIZE, MSG_DONTWAIT, 0);
+    if (count < 0) {
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)) {
+            return (false);
+        }
+        isc_throw(SocketReadError, "failed to receive data from socket "
+                  << sockfd_ << ": " << strerror(errno));
+    }
+
+    for (int i = 0; i < count; ++i) {
+        const uint8_t* data = &buffers_[i * IfaceMgr::RCVBUFSIZE];
+        const size_t len = msgs[i].msg_len;
+        uint16_t remote_port;
+        const IOAddress remote = fromSockaddr(from[i], remote_port);
+        PktPtr pkt;
+        try {
+            if (ip_version_ == 6) {
+                pkt.reset(new Pkt6(data, len));
+            } else {
+                pkt.reset(new Pkt4(data, len));
+            }
+        } catch (const std::exception&) {
+            // Too short to be a DHCP message.
+            ExchangeStats::malformed_pkts_++;
+            continue;
+        }
+        initReceived(pkt, remote, remote_port);
+        received_.push_back(pkt);
+    }
+    return (!received_.empty());
+#else
+    static_cast<void>(timeout_sec);
+    static_cast<void>(timeout_usec);
+    isc_throw(NotImplemented, "batched receiving is supported on Linux only");
+#endif
+}
+
+void
+ThreadPerfSocket::initReceived(const PktPtr& pkt, const IOAddress& remote,
+                               uint16_t remote_port) {
+    pkt->updateTimestamp();
+    pkt->setIndex(ifindex_);
+    pkt->setIface(iface_name_);
+    pkt->setRemoteAddr(remote);
+    pkt->setRemotePort(remote_port);
+    pkt->setLocalAddr(addr_);
+    pkt->setLocalPort(port_);
+    try {
+        pkt->unpack();
+    } catch (const std::exception &e) {
+        ExchangeStats::malformed_pkts_++;
+        std::cout << "Incorrect DHCP packet received"
+                  << e.what() << std::endl;
+    }
+}
+
+Pkt4Ptr
+ThreadPerfSocket::receive4(uint32_t timeout_sec, uint32_t timeout_usec) {
+    if (received_.empty() && !receiveBatch(timeout_sec, timeout_usec)) {
+        return (Pkt4Ptr());
+    }
+    Pkt4Ptr pkt = std::dynamic_pointer_cast<Pkt4>(received_.front());
+    received_.pop_front();
+    return (pkt);
+}
+
+Pkt6Ptr
+ThreadPerfSocket::receive6(uint32_t timeout_sec, uint32_t timeout_usec) {
+    if (received_.empty() && !receiveBatch(timeout_sec, timeout_usec)) {
+        return (Pkt6Ptr());
+    }
+    Pkt6Ptr pkt = std::dynamic_pointer_cast<Pkt6>(received_.front());
+    received_.pop_front();
+    return (pkt);
+}
+
+bool
+ThreadPerfSocket::send(const Pkt4Ptr& pkt) {
+    enqueue(pkt);
+    return (true);
+}
+
+bool
+ThreadPerfSocket::send(const Pkt6Ptr& pkt) {
+    enqueue(pkt);
+    return (true);
+}
+
+void
+ThreadPerfSocket::enqueue(const PktPtr& pkt) {
+    // The statistics may look at the send time before the batch
+    // goes out: it is set again when the packet is really sent.
+    pkt->updateTimestamp();
+    queued_.push_back(pkt);
+    if (queued_.size() >= BATCH_SIZE) {
+        flush();
+    }
+}
+
+void
+ThreadPerfSocket::flush() {
+    if (queued_.empty()) {
+        return;
+    }
+#if defined (OS_LINUX)
+    const size_t count = queued_.size();
+    mmsghdr msgs[BATCH_SIZE];
+    iovec iovs[BATCH_SIZE];
+    sockaddr_storage to[BATCH_SIZE];
+    memset(msgs, 0, sizeof(msgs));
+    for (size_t i = 0; i < count; ++i) {
+        const PktPtr& pkt = queued_[i];
+        const util::OutputBuffer& buf = pkt->getBuffer();
+        iovs[i].iov_base = const_cast<void*>(buf.getData());
+        iovs[i].iov_len = buf.getLength();
+        msgs[i].msg_hdr.msg_iov = &iovs[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+        msgs[i].msg_hdr.msg_name = &to[i];
+        msgs[i].msg_hdr.msg_namelen = toSockaddr(pkt->getRemoteAddr(),
+                                                 pkt->getRemotePort(),
+                                                 ifindex_, to[i]);
+        pkt->updateTimestamp();
+    }
+    size_t sent = 0;
+    while (sent < count) {
+        const int ret = sendmmsg(sockfd_, &msgs[sent], count - sent, 0);
+        if (ret < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            const int error = errno;
+            queued_.clear();
+            isc_throw(SocketWriteError, "failed to send data over socket "
+                      << sockfd_ << ": " << strerror(error));
+        }
+        sent += ret;
+    }
+    queued_.clear();
+#else
+    queued_.clear();
+    isc_throw(NotImplemented, "batched sending is supported on Linux only");
+#endif
+}
+
+IfacePtr
+ThreadPerfSocket::getIface() {
+    return (IfaceMgr::instance().getIface(ifindex_));
+}
+
+}
+}
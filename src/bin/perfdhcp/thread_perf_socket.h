@@ -0,0 +1,158 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef THREAD_PERF_SOCKET_H
+#define THREAD_PERF_SOCKET_H
+
+#include <perfdhcp/command_options.h>
+#include <perfdhcp/perf_socket.h>
+
+#include <dhcp/pkt4.h>
+#include <dhcp/pkt6.h>
+
+#include <deque>
+#include <vector>
+
+namespace isc {
+namespace perfdhcp {
+
+/// \brief Socket of one of the traffic threads.
+///
+/// All the traffic threads share the local address and port: each one
+/// of them opens its own socket with SO_REUSEPORT. A classic BPF program
+/// attached to the group steers each response to the socket of the
+/// thread which sent the request: perfdhcp generates the transaction ids
+/// so that the remainder of the id divided by the number of threads is
+/// the index of the thread, and the index of a socket in the group is
+/// the order in which it has been bound. The sockets must thus be opened
+/// one after another in the order of the thread indexes.
+///
+/// The socket is not registered in IfaceMgr which is not meant to be
+/// used by many threads at once. The packets are received and sent in
+/// batches with recvmmsg and sendmmsg: send only queues the packet and
+/// the batch goes out when it is full or when flush is called.
+///
+/// This socket is available on Linux only.
+class ThreadPerfSocket : public BasePerfSocket {
+public:
+    /// Maximal number of packets received or sent by one system call.
+    static const size_t BATCH_SIZE = 64;
+
+    /// \brief Constructor.
+    ///
+    /// Opens the socket and joins it to the group of the sockets of
+    /// the traffic threads.
+    ///
+    /// \param options command options.
+    /// \param thread_index index of the thread which uses the socket.
+    /// \throw isc::NotImplemented if the system does not support
+    /// steering the packets to the threads.
+    /// \throw isc::BadValue if the socket cannot be opened.
+    ThreadPerfSocket(CommandOptions& options, const size_t thread_index);
+
+    /// \brief Destructor.
+    ///
+    /// Closes the socket.
+    virtual ~ThreadPerfSocket();
+
+    /// \brief Receive DHCPv4 packet from the socket.
+    ///
+    /// \param timeout_sec seconds part of the wait time.
+    /// \param timeout_usec microseconds part of the wait time.
+    /// \return received packet or null pointer on timeout.
+    virtual dhcp::Pkt4Ptr receive4(uint32_t timeout_sec, uint32_t timeout_usec) override;
+
+    /// \brief Receive DHCPv6 packet from the socket.
+    ///
+    /// \param timeout_sec seconds part of the wait time.
+    /// \param timeout_usec microseconds part of the wait time.
+    /// \return received packet or null pointer on timeout.
+    virtual dhcp::Pkt6Ptr receive6(uint32_t timeout_sec, uint32_t timeout_usec) override;
+
+    /// \brief Queue DHCPv4 packet to be sent.
+    ///
+    /// \param pkt packet to be sent.
+    /// \return true always: errors are reported by flush.
+    virtual bool send(const dhcp::Pkt4Ptr& pkt) override;
+
+    /// \brief Queue DHCPv6 packet to be sent.
+    ///
+    /// \param pkt packet to be sent.
+    /// \return true always: errors are reported by flush.
+    virtual bool send(const dhcp::Pkt6Ptr& pkt) override;
+
+    /// \brief Send the queued packets.
+    ///
+    /// \throw isc::dhcp::SocketWriteError if sending fails. The packets
+    /// which have not been sent are discarded.
+    virtual void flush() override;
+
+    /// \brief Returns the interface of the socket.
+    virtual dhcp::IfacePtr getIface() override;
+
+private:
+    /// \brief Open the socket and bind it to the local address.
+    ///
+    /// \param options command options.
+    void openSocket(CommandOptions& options);
+
+    /// \brief Attach the program steering the responses to the threads.
+    ///
+    /// \param thread_count number of the traffic threads.
+    void attachSteeringFilter(const size_t thread_count);
+
+    /// \brief Queue packet to be sent, sending the batch when it is full.
+    ///
+    /// \param pkt packet to be sent.
+    void enqueue(const dhcp::PktPtr& pkt);
+
+    /// \brief Receive a batch of packets.
+    ///
+    /// \param timeout_sec seconds part of the wait time.
+    /// \param timeout_usec microseconds part of the wait time.
+    /// \return true if some packets have been received.
+    bool receiveBatch(uint32_t timeout_sec, uint32_t timeout_usec);
+
+    /// \brief Fill in the addresses of a received packet and unpack it.
+    ///
+    /// \param pkt received packet.
+    /// \param remote address of the sender.
+    /// \param remote_port port of the sender.
+    void initReceived(const dhcp::PktPtr& pkt,
+                      const asiolink::IOAddress& remote,
+                      uint16_t remote_port);
+
+    /// IP version of the test.
+    uint8_t ip_version_;
+
+    /// Name of the interface of the socket.
+    std::string iface_name_;
+
+    /// Buffers of the batch being received.
+    std::vector<uint8_t> buffers_;
+
+    /// Received packets not returned yet.
+    std::deque<dhcp::PktPtr> received_;
+
+    /// Packets queued by send.
+    std::vector<dhcp::PktPtr> queued_;
+};
+
+}
+}
+
+#endif /* THREAD_PERF_SOCKET_H */
@@ -0,0 +1,103 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <perfdhcp/threaded_scen.h>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <thread>
+
+using namespace boost::posix_time;
+
+namespace isc {
+namespace perfdhcp {
+
+int
+ThreadedScen::run() {
+    const size_t thread_count = options_.getThreadCount();
+
+    // The sockets join the group sharing the local port in the order
+    // of the thread indexes, which the steering of the responses
+    // relies on, so they are all opened here.
+    for (size_t i = 0; i < thread_count; ++i) {
+        sockets_.push_back(std::make_unique<ThreadPerfSocket>(options_, i));
+        scens_.push_back(std::make_unique<BasicScen>(options_, *sockets_.back(), i));
+    }
+
+    std::atomic<size_t> running(thread_count);
+    std::vector<std::exception_ptr> errors(thread_count);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < thread_count; ++i) {
+        threads.push_back(std::thread([this, i, &running, &errors]() {
+            try {
+                scens_[i]->preload();
+                scens_[i]->exchangePackets();
+            } catch (...) {
+                errors[i] = std::current_exception();
+                // Stop the other threads too.
+                TestControl::interrupt();
+            }
+            --running;
+        }));
+    }
+
+    ptime last_report = microsec_clock::universal_time();
+    while (running > 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        // Report delay means that user requested printing number
+        // of sent/received/dropped packets repeatedly.
+        if (options_.getReportDelay() > 0) {
+            ptime now = microsec_clock::universal_time();
+            time_period time_since_report(last_report, now);
+            if (time_since_report.length().total_seconds() >= options_.getReportDelay()) {
+                printIntermediateStats();
+                last_report = now;
+            }
+        }
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    for (size_t i = 1; i < thread_count; ++i) {
+        scens_[i]->mergeStatsTo(scens_[0]->getStatsMgr());
+    }
+    return (scens_[0]->report());
+}
+
+void
+ThreadedScen::printIntermediateStats() {
+    StatsMgr stats_mgr(options_);
+    for (auto& scen : scens_) {
+        scen->mergeStatsTo(stats_mgr, true);
+    }
+    stats_mgr.printIntermediateStats(options_.getCleanReport(),
+                                     options_.getCleanReportSeparator());
+}
+
+}
+}
@@ -0,0 +1,72 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef THREADED_SCEN_H
+#define THREADED_SCEN_H
+
+#include <perfdhcp/basic_scen.h>
+#include <perfdhcp/command_options.h>
+#include <perfdhcp/thread_perf_socket.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace isc {
+namespace perfdhcp {
+
+/// \brief Basic scenario run by many traffic threads.
+///
+/// Each thread runs its own BasicScen over its own ThreadPerfSocket:
+/// it simulates its own range of clients and sends its share of the
+/// packets. The main thread prints the intermediate reports from the
+/// statistics of all the threads and, once they are done, the final
+/// report of the first thread to which the statistics of the other
+/// ones have been added.
+class ThreadedScen : public boost::noncopyable {
+public:
+    /// \brief Constructor.
+    ///
+    /// \param options reference to command options.
+    ThreadedScen(CommandOptions& options) : options_(options) { }
+
+    /// \brief Run performance test.
+    ///
+    /// \return execution status.
+    /// \throw isc::NotImplemented if the system does not support
+    /// many traffic threads.
+    int run();
+
+private:
+    /// \brief Print the intermediate report of all the threads.
+    void printIntermediateStats();
+
+    /// Reference to commandline options.
+    CommandOptions& options_;
+
+    /// Sockets of the threads.
+    std::vector<std::unique_ptr<ThreadPerfSocket>> sockets_;
+
+    /// Tests of the threads.
+    std::vector<std::unique_ptr<BasicScen>> scens_;
+};
+
+}
+}
+
+#endif // THREADED_SCEN_H
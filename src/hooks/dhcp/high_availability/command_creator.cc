@@ -63,6 +63,34 @@ CommandCreator::createLease4Delete(const Lease4& lease4) {
     return (command);
 }
 
+ElementPtr
+CommandCreator::createLease4BulkApply(const Lease4CollectionPtr& leases,
+                                      const Lease4CollectionPtr& deleted_leases) {
+    ElementPtr deleted_leases_list = Element::createList();
+    for (auto lease = deleted_leases->begin(); lease != deleted_leases->end();
+         ++lease) {
+        ElementPtr lease_as_json = (*lease)->toElement();
+        insertLeaseExpireTime(lease_as_json);
+        deleted_leases_list->add(lease_as_json);
+    }
+
+    ElementPtr leases_list = Element::createList();
+    for (auto lease = leases->begin(); lease != leases->end();
+         ++lease) {
+        ElementPtr lease_as_json = (*lease)->toElement();
+        insertLeaseExpireTime(lease_as_json);
+        leases_list->add(lease_as_json);
+    }
+
+    ElementPtr args = Element::createMap();
+    args->set("deleted-leases", deleted_leases_list);
+    args->set("leases", leases_list);
+
+    ElementPtr command = config::createCommand("lease4-bulk-apply", args);
+    insertService(command, HAServerType::DHCPv4);
+    return (command);
+}
+
 ElementPtr
 CommandCreator::createLease4GetAll() {
     ElementPtr command = config::createCommand("lease4-get-all");
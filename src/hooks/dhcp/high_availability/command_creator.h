@@ -61,6 +61,17 @@ public:
     static data::ElementPtr
     createLease4Delete(const dhcp::Lease4& lease4);
 
+    /// @brief Creates lease4-bulk-apply command.
+    ///
+    /// @param leases Pointer to the collection of leases to be created
+    /// or/and updated.
+    /// @param deleted_leases Pointer to the collection of leases to be
+    /// deleted.
+    /// @return Pointer to the JSON representation of the command.
+    static data::ElementPtr
+    createLease4BulkApply(const dhcp::Lease4CollectionPtr& leases,
+                          const dhcp::Lease4CollectionPtr& deleted_leases);
+
     /// @brief Creates lease4-get-all command.
     ///
     /// @return Pointer to the JSON representation of the command.
@@ -142,8 +142,11 @@ HAConfig::StateMachineConfig::getStateConfig(const int state) {
 HAConfig::HAConfig()
     : this_server_name_(), ha_mode_(HOT_STANDBY), send_lease_updates_(true),
       sync_leases_(true), sync_timeout_(60000), sync_page_limit_(10000),
+      sync_threads_(4),
       heartbeat_delay_(10000), max_response_delay_(60000), max_ack_delay_(10000),
-      max_unacked_clients_(10), wait_backup_ack_(false), peers_(),
+      max_unacked_clients_(10), wait_backup_ack_(false),
+      lease_update_batch_size_(0), lease_update_batch_delay_(5),
+      lease_update_connections_(1), peers_(),
       state_machine_(new StateMachineConfig()) {
 }
 
@@ -255,6 +258,12 @@ HAConfig::validate() const {
                   << getThisServerName() << "'");
     }
 
+    // At least one connection is required to send batched lease updates.
+    if (lease_update_connections_ == 0) {
+        isc_throw(HAConfigValidationError, "'lease-update-connections' must be"
+                  " greater than 0");
+    }
+
     // Gather all the roles and see how many occurrences of each role we get.
     std::map<PeerConfig::Role, unsigned> peers_cnt;
     for (auto p = peers_.begin(); p != peers_.end(); ++p) {
@@ -365,6 +365,25 @@ public:
         sync_page_limit_ = sync_page_limit;
     }
 
+    /// @brief Returns the number of threads applying the leases fetched
+    /// during database synchronization.
+    ///
+    /// The threads are only used when multi-threading is enabled. A value
+    /// of 0 applies the leases in the thread receiving them.
+    ///
+    /// @return Number of threads.
+    uint32_t getSyncThreads() const {
+        return (sync_threads_);
+    }
+
+    /// @brief Sets the number of threads applying the leases fetched
+    /// during database synchronization.
+    ///
+    /// @param sync_threads New number of threads.
+    void setSyncThreads(const uint32_t sync_threads) {
+        sync_threads_ = sync_threads;
+    }
+
     /// @brief Returns heartbeat delay in milliseconds.
     ///
     /// This value indicates the delay in sending a heartbeat command after
@@ -458,6 +477,65 @@ public:
         return (wait_backup_ack_);
     }
 
+    /// @brief Returns the maximum number of lease updates sent to a peer
+    /// in a single bulk apply command.
+    ///
+    /// A value of 0 disables the batching of the lease updates. In that
+    /// case the lease updates for every DHCP query are sent in separate
+    /// commands.
+    ///
+    /// @return Maximum number of lease updates in a batch.
+    uint32_t getLeaseUpdateBatchSize() const {
+        return (lease_update_batch_size_);
+    }
+
+    /// @brief Sets the maximum number of lease updates sent to a peer
+    /// in a single bulk apply command.
+    ///
+    /// @param lease_update_batch_size new batch size, 0 disables batching.
+    void setLeaseUpdateBatchSize(const uint32_t lease_update_batch_size) {
+        lease_update_batch_size_ = lease_update_batch_size;
+    }
+
+    /// @brief Checks if the lease updates are batched.
+    ///
+    /// @return true if the lease updates are batched, false otherwise.
+    bool amBatchingLeaseUpdates() const {
+        return (lease_update_batch_size_ > 0);
+    }
+
+    /// @brief Returns the maximum time a lease update may wait in a batch
+    /// before the batch is sent.
+    ///
+    /// @return Batch delay in milliseconds.
+    uint32_t getLeaseUpdateBatchDelay() const {
+        return (lease_update_batch_delay_);
+    }
+
+    /// @brief Sets the maximum time a lease update may wait in a batch
+    /// before the batch is sent.
+    ///
+    /// @param lease_update_batch_delay new batch delay in milliseconds.
+    void setLeaseUpdateBatchDelay(const uint32_t lease_update_batch_delay) {
+        lease_update_batch_delay_ = lease_update_batch_delay;
+    }
+
+    /// @brief Returns the number of concurrent connections to each peer
+    /// used for batched lease updates.
+    ///
+    /// @return Number of connections.
+    uint32_t getLeaseUpdateConnections() const {
+        return (lease_update_connections_);
+    }
+
+    /// @brief Sets the number of concurrent connections to each peer
+    /// used for batched lease updates.
+    ///
+    /// @param lease_update_connections new number of connections.
+    void setLeaseUpdateConnections(const uint32_t lease_update_connections) {
+        lease_update_connections_ = lease_update_connections;
+    }
+
     /// @brief Returns configuration of the specified server.
     ///
     /// @param name Server name.
@@ -516,12 +594,16 @@ public:
     bool sync_leases_;                    ///< Synchronize databases on startup?
     uint32_t sync_timeout_;               ///< Timeout for syncing lease database (ms)
     uint32_t sync_page_limit_;            ///< Page size limit while synchronizing
+    uint32_t sync_threads_;               ///< Threads applying synchronized leases.
                                           ///< leases.
     uint32_t heartbeat_delay_;            ///< Heartbeat delay in milliseconds.
     uint32_t max_response_delay_;         ///< Max delay in response to heartbeats.
     uint32_t max_ack_delay_;              ///< Maximum DHCP message ack delay.
     uint32_t max_unacked_clients_;        ///< Maximum number of unacked clients.
     bool wait_backup_ack_;                ///< Wait for lease update ack from backup?
+    uint32_t lease_update_batch_size_;    ///< Maximum lease updates in a batch.
+    uint32_t lease_update_batch_delay_;   ///< Maximum batch delay in milliseconds.
+    uint32_t lease_update_connections_;   ///< Connections per peer for batches.
     PeerConfigMap peers_;                 ///< Map of peers' configurations.
     StateMachineConfigPtr state_machine_; ///< State machine configuration.
 };
@@ -21,6 +21,9 @@ namespace {
 /// @brief Default values for HA configuration.
 const SimpleDefaults HA_CONFIG_DEFAULTS = {
     { "heartbeat-delay", Element::integer, "10000" },
+    { "lease-update-batch-delay", Element::integer, "5" },
+    { "lease-update-batch-size", Element::integer, "0" },
+    { "lease-update-connections", Element::integer, "1" },
     { "max-ack-delay", Element::integer, "10000" },
     { "max-response-delay", Element::integer, "60000" },
     { "max-unacked-clients", Element::integer, "10" },
@@ -28,6 +31,7 @@ const SimpleDefaults HA_CONFIG_DEFAULTS = {
     { "sync-leases", Element::boolean, "true" },
     { "sync-timeout", Element::integer, "60000" },
     { "sync-page-limit", Element::integer, "10000" },
+    { "sync-threads", Element::integer, "4" },
     { "wait-backup-ack", Element::boolean, "false" }
 };
 
@@ -142,6 +146,10 @@ HAConfigParser::parseInternal(const HAConfigPtr& config_storage,
     uint32_t sync_page_limit = getAndValidateInteger<uint32_t>(c, "sync-page-limit");
     config_storage->setSyncPageLimit(sync_page_limit);
 
+    // Get 'sync-threads'.
+    uint16_t sync_threads = getAndValidateInteger<uint16_t>(c, "sync-threads");
+    config_storage->setSyncThreads(sync_threads);
+
     // Get 'heartbeat-delay'.
     uint16_t heartbeat_delay = getAndValidateInteger<uint16_t>(c, "heartbeat-delay");
     config_storage->setHeartbeatDelay(heartbeat_delay);
@@ -161,6 +169,18 @@ HAConfigParser::parseInternal(const HAConfigPtr& config_storage,
     // Get 'wait-backup-ack'.
     config_storage->setWaitBackupAck(getBoolean(c, "wait-backup-ack"));
 
+    // Get 'lease-update-batch-size'.
+    uint32_t batch_size = getAndValidateInteger<uint32_t>(c, "lease-update-batch-size");
+    config_storage->setLeaseUpdateBatchSize(batch_size);
+
+    // Get 'lease-update-batch-delay'.
+    uint32_t batch_delay = getAndValidateInteger<uint32_t>(c, "lease-update-batch-delay");
+    config_storage->setLeaseUpdateBatchDelay(batch_delay);
+
+    // Get 'lease-update-connections'.
+    uint16_t connections = getAndValidateInteger<uint16_t>(c, "lease-update-connections");
+    config_storage->setLeaseUpdateConnections(connections);
+
     // Peers configuration parsing.
     const auto& peers_vec = peers->listValue();
 
@@ -48,6 +48,7 @@ extern const isc::log::MessageID HA_LEASES4_COMMITTED_FAILED;
 extern const isc::log::MessageID HA_LEASES4_COMMITTED_NOTHING_TO_UPDATE;
 extern const isc::log::MessageID HA_LEASES6_COMMITTED_FAILED;
 extern const isc::log::MessageID HA_LEASES6_COMMITTED_NOTHING_TO_UPDATE;
+extern const isc::log::MessageID HA_LEASES_SYNC_APPLY_FAILED;
 extern const isc::log::MessageID HA_LEASES_SYNC_COMMUNICATIONS_FAILED;
 extern const isc::log::MessageID HA_LEASES_SYNC_FAILED;
 extern const isc::log::MessageID HA_LEASES_SYNC_LEASE_PAGE_RECEIVED;
@@ -56,6 +57,9 @@ extern const isc::log::MessageID HA_LEASE_SYNC_STALE_LEASE4_SKIP;
 extern const isc::log::MessageID HA_LEASE_SYNC_STALE_LEASE6_SKIP;
 extern const isc::log::MessageID HA_LEASE_UPDATES_DISABLED;
 extern const isc::log::MessageID HA_LEASE_UPDATES_ENABLED;
+extern const isc::log::MessageID HA_LEASE_UPDATE_BATCH_COMMUNICATIONS_FAILED;
+extern const isc::log::MessageID HA_LEASE_UPDATE_BATCH_FAILED;
+extern const isc::log::MessageID HA_LEASE_UPDATE_BATCH_SEND;
 extern const isc::log::MessageID HA_LEASE_UPDATE_COMMUNICATIONS_FAILED;
 extern const isc::log::MessageID HA_LEASE_UPDATE_CREATE_UPDATE_FAILED_ON_PEER;
 extern const isc::log::MessageID HA_LEASE_UPDATE_DELETE_FAILED_ON_PEER;
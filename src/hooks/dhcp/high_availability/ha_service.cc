@@ -49,7 +49,9 @@ HAService::HAService(const IOServicePtr& io_service, const NetworkStatePtr& netw
                      const HAConfigPtr& config, const HAServerType& server_type)
     : io_service_(io_service), network_state_(network_state), config_(config),
       server_type_(server_type), client_(*io_service), communication_state_(),
-      query_filter_(config), mutex_(), pending_requests_() {
+      query_filter_(config), lease_update_clients_(), lease_update_batches_(),
+      lease_update_timer_(), lease_update_flush_scheduled_(false),
+      lease_update_mutex_(), mutex_(), pending_requests_() {
 
     if (server_type == HAServerType::DHCPv4) {
         communication_state_.reset(new CommunicationState4(io_service_, config));
@@ -58,6 +60,15 @@ HAService::HAService(const IOServicePtr& io_service, const NetworkStatePtr& netw
         communication_state_.reset(new CommunicationState6(io_service_, config));
     }
 
+    // Batched lease updates are sent over dedicated connections, so they
+    // are not queued behind the heartbeats and the lease syncing.
+    if (config->amBatchingLeaseUpdates()) {
+        for (uint16_t i = 0; i < config->getLeaseUpdateConnections(); ++i) {
+            lease_update_clients_.push_back(std::make_shared<HttpClient>(*io_service));
+        }
+        lease_update_timer_.reset(new IntervalTimer(*io_service));
+    }
+
     startModel(HA_WAITING_ST);
 
     LOG_INFO(ha_logger, HA_SERVICE_STARTED)
@@ -866,6 +877,12 @@ HAService::asyncSendLeaseUpdates(const dhcp::Pkt4Ptr& query,
             ++sent_num;
         }
 
+        // Add the lease updates to the batches sent to this peer.
+        if (config_->amBatchingLeaseUpdates()) {
+            queueLeaseUpdates(query, conf, leases, deleted_leases, parking_lot);
+            continue;
+        }
+
         // Lease updates for deleted leases.
         for (auto l = deleted_leases->begin(); l != deleted_leases->end(); ++l) {
             asyncSendLeaseUpdate(query, conf, CommandCreator::createLease4Delete(**l),
@@ -910,6 +927,12 @@ HAService::asyncSendLeaseUpdates(const dhcp::Pkt6Ptr& query,
             ++sent_num;
         }
 
+        // Add the lease updates to the batches sent to this peer.
+        if (config_->amBatchingLeaseUpdates()) {
+            queueLeaseUpdates(query, conf, leases, deleted_leases, parking_lot);
+            continue;
+        }
+
         // Send new/updated leases and deleted leases in one command.
         asyncSendLeaseUpdate(query, conf, CommandCreator::createLease6BulkApply(leases, deleted_leases),
                              parking_lot);
@@ -1103,6 +1126,234 @@ HAService::asyncSendLeaseUpdate(const QueryPtrType& query,
     }
 }
 
+template<typename QueryPtrType, typename LeaseCollectionPtrType>
+void
+HAService::queueLeaseUpdates(const QueryPtrType& query,
+                             const HAConfig::PeerConfigPtr& config,
+                             const LeaseCollectionPtrType& leases,
+                             const LeaseCollectionPtrType& deleted_leases,
+                             const ParkingLotHandlePtr& parking_lot) {
+    // Same as for the individual lease updates, the query waits for the
+    // acknowledgments from the backup servers only if configured to.
+    bool waiting = (config_->amWaitingBackupAck() ||
+                    (config->getRole() != HAConfig::PeerConfig::BACKUP));
+
+    const size_t connections = lease_update_clients_.size();
+    std::vector<std::pair<LeaseUpdateBatchPtr, size_t> > full_batches;
+
+    {
+        std::lock_guard<std::mutex> lock(lease_update_mutex_);
+
+        auto& batches = lease_update_batches_[config->getName()];
+        if (batches.size() != connections) {
+            batches.resize(connections);
+        }
+
+        // Remember the batches to which this query has been already added.
+        std::vector<bool> query_added(connections, false);
+
+        auto add_lease = [&](const LeasePtr& lease, const bool deleted) {
+            size_t index = LeaseUpdateBatch::getConnectionIndex(*lease, connections);
+            auto& batch = batches[index];
+            if (!batch) {
+                batch.reset(new LeaseUpdateBatch(config));
+            }
+            batch->addLease(lease, deleted);
+            if (!query_added[index]) {
+                query_added[index] = true;
+                batch->addQuery(query, parking_lot);
+                // Each batch holding the updates of the query is a request
+                // for which the query waits.
+                if (waiting) {
+                    updatePendingRequest(query);
+                }
+            }
+        };
+
+        for (auto l = deleted_leases->begin(); l != deleted_leases->end(); ++l) {
+            add_lease(*l, true);
+        }
+        for (auto l = leases->begin(); l != leases->end(); ++l) {
+            add_lease(*l, false);
+        }
+
+        // Full batches are sent right away.
+        bool pending = false;
+        for (size_t i = 0; i < connections; ++i) {
+            if (!batches[i]) {
+                continue;
+            }
+            if (batches[i]->getLeaseCount() >= config_->getLeaseUpdateBatchSize()) {
+                full_batches.push_back(std::make_pair(batches[i], i));
+                batches[i].reset();
+            } else {
+                pending = true;
+            }
+        }
+
+        if (pending) {
+            scheduleLeaseUpdatesFlush();
+        }
+    }
+
+    for (auto const& batch : full_batches) {
+        asyncSendLeaseUpdateBatch(batch.first, batch.second);
+    }
+}
+
+void
+HAService::scheduleLeaseUpdatesFlush() {
+    if (lease_update_flush_scheduled_) {
+        return;
+    }
+    lease_update_flush_scheduled_ = true;
+
+    // The timer is only touched from the IO service thread, because the
+    // lease updates may be queued by the packet processing threads.
+    long delay = static_cast<long>(config_->getLeaseUpdateBatchDelay());
+    if (delay == 0) {
+        io_service_->post(std::bind(&HAService::flushLeaseUpdates, this));
+
+    } else {
+        io_service_->post([this, delay]() {
+            lease_update_timer_->setup(std::bind(&HAService::flushLeaseUpdates, this),
+                                       delay, IntervalTimer::ONE_SHOT);
+        });
+    }
+}
+
+void
+HAService::flushLeaseUpdates() {
+    std::vector<std::pair<LeaseUpdateBatchPtr, size_t> > batches_to_send;
+
+    {
+        std::lock_guard<std::mutex> lock(lease_update_mutex_);
+        lease_update_flush_scheduled_ = false;
+        for (auto& peer_batches : lease_update_batches_) {
+            for (size_t i = 0; i < peer_batches.second.size(); ++i) {
+                auto& batch = peer_batches.second[i];
+                if (batch && !batch->empty()) {
+                    batches_to_send.push_back(std::make_pair(batch, i));
+                }
+                batch.reset();
+            }
+        }
+    }
+
+    for (auto const& batch : batches_to_send) {
+        asyncSendLeaseUpdateBatch(batch.first, batch.second);
+    }
+}
+
+template<typename QueryPtrType>
+bool
+HAService::leaseUpdateBatchComplete(QueryPtrType query,
+                                    const ParkingLotHandlePtr& parking_lot,
+                                    const bool success) {
+    if (!query) {
+        return (false);
+    }
+    if (!success) {
+        parking_lot->drop(query);
+    }
+    return (leaseUpdateComplete(query, parking_lot));
+}
+
+void
+HAService::asyncSendLeaseUpdateBatch(const LeaseUpdateBatchPtr& batch,
+                                     const size_t connection) {
+    HAConfig::PeerConfigPtr config = batch->getPeerConfig();
+
+    LOG_DEBUG(ha_logger, DBGLVL_TRACE_BASIC, HA_LEASE_UPDATE_BATCH_SEND)
+        .arg(batch->getLeaseCount())
+        .arg(batch->getQueryCount())
+        .arg(config->getLogLabel());
+
+    // Create HTTP/1.1 request including our command.
+    PostHttpRequestJsonPtr request = std::make_shared<PostHttpRequestJson>
+        (HttpRequest::Method::HTTP_POST, "/", HttpVersion::HTTP_11(),
+         HostHttpHeader(config->getUrl().getHostname()));
+    request->setBodyAsJson(batch->createCommand(server_type_));
+    request->finalize();
+
+    // Response object should also be created because the HTTP client needs
+    // to know the type of the expected response.
+    HttpResponseJsonPtr response = std::make_shared<HttpResponseJson>();
+
+    // The batch holds weak pointers to the queries, so it is safe to pass
+    // it to the callback.
+    lease_update_clients_[connection]->asyncSendRequest(config->getUrl(), request, response,
+        [this, batch, config]
+            (const boost::system::error_code& ec,
+             const HttpResponsePtr& response,
+             const std::string& error_str) {
+
+            bool lease_update_success = true;
+
+            if (ec || !error_str.empty()) {
+                LOG_WARN(ha_logger, HA_LEASE_UPDATE_BATCH_COMMUNICATIONS_FAILED)
+                    .arg(batch->getLeaseCount())
+                    .arg(batch->getQueryCount())
+                    .arg(config->getLogLabel())
+                    .arg(ec ? ec.message() : error_str);
+                lease_update_success = false;
+
+            } else {
+                try {
+                    int rcode = 0;
+                    auto args = verifyAsyncResponse(response, rcode);
+                    logFailedLeaseUpdates(config->getLogLabel(), args);
+
+                } catch (const std::exception& ex) {
+                    LOG_WARN(ha_logger, HA_LEASE_UPDATE_BATCH_FAILED)
+                        .arg(batch->getLeaseCount())
+                        .arg(batch->getQueryCount())
+                        .arg(config->getLogLabel())
+                        .arg(ex.what());
+                    lease_update_success = false;
+                }
+            }
+
+            // We don't care about the result of the lease update to the backup server.
+            if (config->getRole() != HAConfig::PeerConfig::BACKUP) {
+                if (lease_update_success) {
+                    communication_state_->poke();
+
+                } else {
+                    communication_state_->setPartnerState("unavailable");
+                }
+            }
+
+            // Nothing more to do if the queries are not waiting for this server.
+            if (!config_->amWaitingBackupAck() &&
+                (config->getRole() == HAConfig::PeerConfig::BACKUP)) {
+                return;
+            }
+
+            bool complete = false;
+            for (auto const& pending : batch->getQueries()) {
+                PktPtr query = pending.query_.lock();
+                if (server_type_ == HAServerType::DHCPv4) {
+                    complete = leaseUpdateBatchComplete(std::dynamic_pointer_cast<Pkt4>(query),
+                                                        pending.parking_lot_,
+                                                        lease_update_success) || complete;
+                } else {
+                    complete = leaseUpdateBatchComplete(std::dynamic_pointer_cast<Pkt6>(query),
+                                                        pending.parking_lot_,
+                                                        lease_update_success) || complete;
+                }
+            }
+
+            if (complete) {
+                runModel(HA_LEASE_UPDATES_COMPLETE_EVT);
+            }
+        },
+        HttpClient::RequestTimeout(TIMEOUT_DEFAULT_HTTP_CLIENT_REQUEST),
+        std::bind(&HAService::clientConnectHandler, this, ph::_1, ph::_2),
+        std::bind(&HAService::clientCloseHandler, this, ph::_1)
+    );
+}
+
 bool
 HAService::shouldSendLeaseUpdates(const HAConfig::PeerConfigPtr& peer_config) const {
     // Never send lease updates if they are administratively disabled.
@@ -1138,6 +1389,12 @@ HAService::shouldSendLeaseUpdates(const HAConfig::PeerConfigPtr& peer_config) co
 void
 HAService::logFailedLeaseUpdates(const PktPtr& query,
                                  const ElementPtr& args) const {
+    logFailedLeaseUpdates(query->getLabel(), args);
+}
+
+void
+HAService::logFailedLeaseUpdates(const std::string& label,
+                                 const ElementPtr& args) const {
     // If there are no arguments, it means that the update was successful.
     if (!args || (args->getType() != Element::map)) {
         return;
@@ -1145,7 +1402,7 @@ HAService::logFailedLeaseUpdates(const PktPtr& query,
 
     // Instead of duplicating the code between the failed-deleted-leases and
     // failed-leases, let's just have one function that does it for both.
-    auto log_proc = [](const PktPtr query, const ElementPtr& args,
+    auto log_proc = [](const std::string& label, const ElementPtr& args,
                        const std::string& param_name, const log::MessageID& mesid) {
 
         // Check if there are any failed leases.
@@ -1168,7 +1425,7 @@ HAService::logFailedLeaseUpdates(const PktPtr& query,
                     auto error_message = lease->get("error-message");
 
                     LOG_INFO(ha_logger, mesid)
-                        .arg(query->getLabel())
+                        .arg(label)
                         .arg(lease_type && (lease_type->getType() == Element::string) ?
                              lease_type->stringValue() : "(uknown)")
                         .arg(ip_address && (ip_address->getType() == Element::string) ?
@@ -1181,10 +1438,10 @@ HAService::logFailedLeaseUpdates(const PktPtr& query,
     };
 
     // Process "failed-deleted-leases"
-    log_proc(query, args, "failed-deleted-leases", HA_LEASE_UPDATE_DELETE_FAILED_ON_PEER);
+    log_proc(label, args, "failed-deleted-leases", HA_LEASE_UPDATE_DELETE_FAILED_ON_PEER);
 
     // Process "failed-leases".
-    log_proc(query, args, "failed-leases", HA_LEASE_UPDATE_CREATE_UPDATE_FAILED_ON_PEER);
+    log_proc(label, args, "failed-leases", HA_LEASE_UPDATE_CREATE_UPDATE_FAILED_ON_PEER);
 }
 
 ElementPtr
@@ -1569,7 +1826,16 @@ HAService::asyncSyncLeases(http::HttpClient& http_client,
                            const unsigned int max_period,
                            const dhcp::LeasePtr& last_lease,
                            PostSyncCallback post_sync_action,
-                           const bool dhcp_disabled) {
+                           const bool dhcp_disabled,
+                           const LeaseSyncApplierPtr& applier) {
+    // The same applier stores all pages fetched during the synchronization.
+    LeaseSyncApplierPtr sync_applier = applier;
+    if (!sync_applier) {
+        sync_applier.reset(new LeaseSyncApplier(server_type_,
+                                                config_->getSyncThreads(),
+                                                *io_service_));
+    }
+
     // Synchronization starts with a command to disable DHCP service of the
     // peer from which we're fetching leases. We don't want the other server
     // to allocate new leases while we fetch from it. The DHCP service will
@@ -1577,19 +1843,24 @@ HAService::asyncSyncLeases(http::HttpClient& http_client,
     // re-enabled if we die during the synchronization.
     asyncDisableDHCPService(http_client, server_name, max_period,
                             [this, &http_client, server_name, max_period, last_lease,
-                             post_sync_action, dhcp_disabled]
+                             post_sync_action, dhcp_disabled, sync_applier]
                             (const bool success, const std::string& error_message) {
 
         // If we have successfully disabled the DHCP service on the peer,
         // we can start fetching the leases.
         if (success) {
-            // The last argument indicates that disabling the DHCP
+            // The last but one argument indicates that disabling the DHCP
             // service on the partner server was successful.
             asyncSyncLeasesInternal(http_client, server_name, max_period,
-                                    last_lease, post_sync_action, true);
+                                    last_lease, post_sync_action, true,
+                                    sync_applier);
 
         } else {
-            post_sync_action(success, error_message, dhcp_disabled);
+            // Make sure that the pages received so far have been stored.
+            sync_applier->whenApplied([post_sync_action, success, error_message,
+                                       dhcp_disabled]() {
+                post_sync_action(success, error_message, dhcp_disabled);
+            });
         }
     });
 }
@@ -1600,7 +1871,8 @@ HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
                                    const unsigned int max_period,
                                    const dhcp::LeasePtr& last_lease,
                                    PostSyncCallback post_sync_action,
-                                   const bool dhcp_disabled) {
+                                   const bool dhcp_disabled,
+                                   const LeaseSyncApplierPtr& applier) {
 
     HAConfig::PeerConfigPtr partner_config = config_->getFailoverPeerConfig();
 
@@ -1625,7 +1897,7 @@ HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
     // Schedule asynchronous HTTP request.
     http_client.asyncSendRequest(partner_config->getUrl(), request, response,
         [this, partner_config, post_sync_action, &http_client, server_name,
-         max_period, dhcp_disabled]
+         max_period, dhcp_disabled, applier]
             (const boost::system::error_code& ec,
              const HttpResponsePtr& response,
              const std::string& error_str) {
@@ -1668,82 +1940,51 @@ HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
                                   " argument is not a list");
                     }
 
-                    // Iterate over the leases and update the database as appropriate.
                     const auto& leases_element = leases->listValue();
 
                     LOG_INFO(ha_logger, HA_LEASES_SYNC_LEASE_PAGE_RECEIVED)
                         .arg(leases_element.size())
                         .arg(server_name);
 
-                    for (auto l = leases_element.begin(); l != leases_element.end(); ++l) {
+                    // If we're not on the last page, let's record the final lease
+                    // on this page as input to the next leaseX-get-page command.
+                    if (!leases_element.empty() &&
+                        (leases_element.size() >= config_->getSyncPageLimit())) {
                         try {
-
                             if (server_type_ == HAServerType::DHCPv4) {
-                                Lease4Ptr lease = Lease4::fromElement(*l);
-
-                                // Check if there is such lease in the database already.
-                                Lease4Ptr existing_lease = LeaseMgrFactory::instance().getLease4(lease->addr_);
-                                if (!existing_lease) {
-                                    // There is no such lease, so let's add it.
-                                    LeaseMgrFactory::instance().addLease(lease);
-
-                                } else if (existing_lease->cltt_ < lease->cltt_) {
-                                    // If the existing lease is older than the fetched lease, update
-                                    // the lease in our local database.
-                                    LeaseMgrFactory::instance().updateLease4(lease);
-
-                                } else {
-                                    LOG_DEBUG(ha_logger, DBGLVL_TRACE_BASIC, HA_LEASE_SYNC_STALE_LEASE4_SKIP)
-                                        .arg(lease->addr_.toText())
-                                        .arg(lease->subnet_id_);
-                                }
-
-                                // If we're not on the last page and we're processing final lease on
-                                // this page, let's record the lease as input to the next
-                                // lease4-get-page command.
-                                if ((leases_element.size() >= config_->getSyncPageLimit()) &&
-                                    (l + 1 == leases_element.end())) {
-                                    last_lease = std::dynamic_pointer_cast<Lease>(lease);
-                                }
+                                last_lease = Lease4::fromElement(leases_element.back());
 
                             } else {
-                                Lease6Ptr lease = Lease6::fromElement(*l);
-
-                                // Check if there is such lease in the database already.
-                                Lease6Ptr existing_lease = LeaseMgrFactory::instance().getLease6(lease->type_,
-                                                                                                 lease->addr_);
-                                if (!existing_lease) {
-                                    // There is no such lease, so let's add it.
-                                    LeaseMgrFactory::instance().addLease(lease);
-
-                                } else if (existing_lease->cltt_ < lease->cltt_) {
-                                    // If the existing lease is older than the fetched lease, update
-                                    // the lease in our local database.
-                                    LeaseMgrFactory::instance().updateLease6(lease);
-
-                                } else {
-                                    LOG_DEBUG(ha_logger, DBGLVL_TRACE_BASIC, HA_LEASE_SYNC_STALE_LEASE6_SKIP)
-                                        .arg(lease->addr_.toText())
-                                        .arg(lease->subnet_id_);
-                                }
-
-                                // If we're not on the last page and we're processing final lease on
-                                // this page, let's record the lease as input to the next
-                                // lease6-get-page command.
-                                if ((leases_element.size() >= config_->getSyncPageLimit()) &&
-                                    (l + 1 == leases_element.end())) {
-                                    last_lease = std::dynamic_pointer_cast<Lease>(lease);
-                                }
+                                last_lease = Lease6::fromElement(leases_element.back());
                             }
 
-
-                        } catch (const std::exception& ex) {
-                            LOG_WARN(ha_logger, HA_LEASE_SYNC_FAILED)
-                                .arg((*l)->str())
-                                .arg(ex.what());
+                        } catch (const std::exception&) {
+                            // The malformed lease is reported when the page
+                            // is applied. The synchronization ends on this page.
                         }
                     }
 
+                    // Store the leases in the database. Depending on the
+                    // configuration this happens in this thread or in the
+                    // synchronization threads.
+                    if (last_lease) {
+                        // Request the next page as soon as the applier can
+                        // take it, so the partner prepares the next page while
+                        // this one is stored, and the pages are not fetched
+                        // faster than they are stored.
+                        applier->apply(leases, [this, &http_client, server_name,
+                                                max_period, last_lease,
+                                                post_sync_action, dhcp_disabled,
+                                                applier]() {
+                            asyncSyncLeases(http_client, server_name, max_period,
+                                            last_lease, post_sync_action,
+                                            dhcp_disabled, applier);
+                        });
+
+                    } else {
+                        applier->apply(leases);
+                    }
+
                 } catch (const std::exception& ex) {
                     error_message = ex.what();
                     LOG_ERROR(ha_logger, HA_LEASES_SYNC_FAILED)
@@ -1759,18 +2000,19 @@ HAService::asyncSyncLeasesInternal(http::HttpClient& http_client,
 
              } else if (last_lease) {
                  // This indicates that there are more leases to be fetched.
-                 // Therefore, we have to send another leaseX-get-page command.
-                 asyncSyncLeases(http_client, server_name, max_period, last_lease,
-                                 post_sync_action, dhcp_disabled);
+                 // The next leaseX-get-page command has already been sent.
                  return;
              }
 
-            // Invoke post synchronization action if it was specified.
-            if (post_sync_action) {
-                post_sync_action(error_message.empty(),
-                                 error_message,
-                                 dhcp_disabled);
-            }
+            // Invoke post synchronization action if it was specified, when
+            // all received pages have been stored.
+            applier->whenApplied([post_sync_action, error_message, dhcp_disabled]() {
+                if (post_sync_action) {
+                    post_sync_action(error_message.empty(),
+                                     error_message,
+                                     dhcp_disabled);
+                }
+            });
         },
         HttpClient::RequestTimeout(config_->getSyncTimeout()),
         std::bind(&HAService::clientConnectHandler, this, ph::_1, ph::_2),
@@ -1793,6 +2035,11 @@ HAService::synchronize(std::string& status_message, const std::string& server_na
     IOService io_service;
     HttpClient client(io_service);
 
+    // The pages of leases are stored while this IO service runs.
+    LeaseSyncApplierPtr applier(new LeaseSyncApplier(server_type_,
+                                                     config_->getSyncThreads(),
+                                                     io_service));
+
     asyncSyncLeases(client, server_name, max_period, Lease4Ptr(),
                     [&](const bool success, const std::string& error_message,
                         const bool dhcp_disabled) {
@@ -1828,7 +2075,7 @@ HAService::synchronize(std::string& status_message, const std::string& server_na
             // service.
             io_service.stop();
         }
-    });
+    }, false, applier);
 
     LOG_INFO(ha_logger, HA_SYNC_START).arg(server_name);
 
@@ -2218,6 +2465,9 @@ HAService::socketReadyHandler(int tcp_native_fd) {
     // IfaceMgr and ensure the client starts over with a fresh connection
     // if it needs to do so.
     client_.closeIfOutOfBand(tcp_native_fd);
+    for (auto const& client : lease_update_clients_) {
+        client->closeIfOutOfBand(tcp_native_fd);
+    }
 }
 
 void
@@ -10,7 +10,10 @@
 #include <communication_state.h>
 #include <ha_config.h>
 #include <ha_server_type.h>
+#include <lease_sync_applier.h>
+#include <lease_update_batch.h>
 #include <query_filter.h>
+#include <asiolink/interval_timer.h>
 #include <asiolink/io_service.h>
 #include <cc/data.h>
 #include <dhcp/pkt4.h>
@@ -527,6 +530,80 @@ protected:
     void logFailedLeaseUpdates(const dhcp::PktPtr& query,
                                const data::ElementPtr& args) const;
 
+    /// @brief Log failed lease updates.
+    ///
+    /// This variant is used for the batched lease updates which are not
+    /// associated with a single query. The peer's label is logged instead.
+    ///
+    /// @param label Label to be used in the log messages.
+    /// @param args Arguments of the response. It may be null, in which
+    /// case the function simply returns.
+    void logFailedLeaseUpdates(const std::string& label,
+                               const data::ElementPtr& args) const;
+
+    /// @brief Adds lease updates to the batches sent to the peer.
+    ///
+    /// The lease updates are distributed between the lease update
+    /// connections by the lease address. The query is added to each
+    /// batch holding at least one of its lease updates and the number
+    /// of pending requests for the query is increased accordingly. The
+    /// batches which reached the configured size are sent immediately.
+    /// Other batches are sent when the batch delay elapses.
+    ///
+    /// @param query Pointer to the DHCP client's query.
+    /// @param config Pointer to the configuration of the peer.
+    /// @param leases Pointer to the collection of new or updated leases.
+    /// @param deleted_leases Pointer to the collection of deleted leases.
+    /// @param parking_lot Parking lot where the query is parked.
+    /// @tparam QueryPtrType Type of the pointer to the DHCP client's message,
+    /// i.e. Pkt4Ptr or Pkt6Ptr.
+    /// @tparam LeaseCollectionPtrType Type of the pointer to the lease
+    /// collection, i.e. Lease4CollectionPtr or Lease6CollectionPtr.
+    template<typename QueryPtrType, typename LeaseCollectionPtrType>
+    void queueLeaseUpdates(const QueryPtrType& query,
+                           const HAConfig::PeerConfigPtr& config,
+                           const LeaseCollectionPtrType& leases,
+                           const LeaseCollectionPtrType& deleted_leases,
+                           const hooks::ParkingLotHandlePtr& parking_lot);
+
+public:
+
+    /// @brief Sends all non-empty lease update batches.
+    ///
+    /// It is invoked when the batch delay elapses.
+    void flushLeaseUpdates();
+
+protected:
+
+    /// @brief Asynchronously sends a batch of lease updates to the peer.
+    ///
+    /// When the response is received the queries waiting for the batch
+    /// are unparked, or dropped if the lease updates failed.
+    ///
+    /// @param batch Pointer to the batch to be sent.
+    /// @param connection Index of the lease update connection to be used.
+    void asyncSendLeaseUpdateBatch(const LeaseUpdateBatchPtr& batch,
+                                   const size_t connection);
+
+    /// @brief Completes the lease updates of a batched query.
+    ///
+    /// @param query Pointer to the DHCP client's query.
+    /// @param parking_lot Parking lot where the query is parked.
+    /// @param success true if the batch holding the lease updates of the
+    /// query has been applied by the peer.
+    /// @tparam QueryPtrType Type of the pointer to the DHCP client's message,
+    /// i.e. Pkt4Ptr or Pkt6Ptr.
+    /// @return true if all lease updates for the query are complete.
+    template<typename QueryPtrType>
+    bool leaseUpdateBatchComplete(QueryPtrType query,
+                                  const hooks::ParkingLotHandlePtr& parking_lot,
+                                  const bool success);
+
+    /// @brief Schedules sending of the non-empty lease update batches.
+    ///
+    /// Should be called with the lease update mutex held.
+    void scheduleLeaseUpdatesFlush();
+
     /// @brief Checks if the lease updates should be sent as result of leases
     /// allocation or release.
     ///
@@ -662,9 +739,12 @@ protected:
     ///
     /// The @c asyncSyncLeases method calls itself (recurses) when the previous
     /// @c lease4-get-page or @c lease6-get-page command has completed
-    /// successfully. If the last page of leases was fetched or if any
-    /// error occurred, the synchronization is terminated and the
-    /// @c post_sync_action callback is invoked.
+    /// successfully. The next page is requested as soon as the applier can
+    /// take it, so fetching the next page overlaps with storing the current
+    /// one, and the pages are not fetched faster than they are stored. If
+    /// the last page of leases was fetched or if any error occurred, the
+    /// synchronization is terminated and the @c post_sync_action callback
+    /// is invoked when all received pages have been stored.
     ///
     /// The last parameter passed to the @c post_sync_action callback indicates
     /// whether this server has successfully disabled DHCP service on
@@ -692,12 +772,16 @@ protected:
     /// server is disabled. This flag propagates down to the
     /// @c post_sync_action to indicate whether the DHCP service has to
     /// be enabled after the leases synchronization.
+    /// @param applier Pointer to the object storing the received pages of
+    /// leases. If it is null, a new one is created using the configured
+    /// number of synchronization threads.
     void asyncSyncLeases(http::HttpClient& http_client,
                          const std::string& server_name,
                          const unsigned int max_period,
                          const dhcp::LeasePtr& last_lease,
                          PostSyncCallback post_sync_action,
-                         const bool dhcp_disabled = false);
+                         const bool dhcp_disabled = false,
+                         const LeaseSyncApplierPtr& applier = LeaseSyncApplierPtr());
 
     /// @brief Implements fetching one page of leases during synchronization.
     ///
@@ -725,12 +809,15 @@ protected:
     /// server is disabled. This flag propagates down to the
     /// @c post_sync_action to indicate whether the DHCP service has to
     /// be enabled after the leases synchronization.
+    /// @param applier Pointer to the object storing the received pages of
+    /// leases.
     void asyncSyncLeasesInternal(http::HttpClient& http_client,
                                  const std::string& server_name,
                                  const unsigned int max_period,
                                  const dhcp::LeasePtr& last_lease,
                                  PostSyncCallback post_sync_action,
-                                 const bool dhcp_disabled);
+                                 const bool dhcp_disabled,
+                                 const LeaseSyncApplierPtr& applier);
 
 
 public:
@@ -917,6 +1004,30 @@ protected:
     /// @brief Selects queries to be processed/dropped.
     QueryFilter query_filter_;
 
+    /// @brief HTTP clients used to send batched lease updates.
+    ///
+    /// Each client maintains its own connection to every peer, so the
+    /// number of clients is the configured number of lease update
+    /// connections. It is empty when the lease updates are not batched.
+    std::vector<std::shared_ptr<http::HttpClient> > lease_update_clients_;
+
+    /// @brief Lease update batches being filled, by peer name.
+    ///
+    /// Each peer has one batch per lease update connection.
+    std::map<std::string, std::vector<LeaseUpdateBatchPtr> > lease_update_batches_;
+
+    /// @brief Timer sending the lease update batches after the batch delay.
+    asiolink::IntervalTimerPtr lease_update_timer_;
+
+    /// @brief Indicates if sending of the lease update batches has been
+    /// scheduled.
+    bool lease_update_flush_scheduled_;
+
+    /// @brief Mutex protecting the lease update batches.
+    ///
+    /// It must be acquired before @c mutex_ if both are needed.
+    std::mutex lease_update_mutex_;
+
     /// @brief Handle last pending request for this query.
     ///
     /// Search if there are pending requests for this query:
@@ -0,0 +1,256 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <ha_log.h>
+#include <lease_sync_applier.h>
+#include <dhcpsrv/lease_mgr.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <util/multi_threading_mgr.h>
+
+#include <vector>
+
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::log;
+using namespace isc::util;
+
+namespace {
+
+/// @brief Stores a page of leases of one family in the lease database.
+///
+/// @tparam LeaseType Lease4 or Lease6.
+/// @tparam LeaseCollection Lease4Collection or Lease6Collection.
+/// @param leases List of leases in the JSON format.
+/// @param get_lease Function returning the existing lease in the database.
+/// @param update_lease Function updating the lease in the database.
+/// @param stale_message Message logged when the fetched lease is older than
+/// the existing one.
+template<typename LeaseType, typename LeaseCollection>
+void
+applyLeases(const ElementPtr& leases,
+            std::function<std::shared_ptr<LeaseType>(const LeaseType&)> get_lease,
+            std::function<void(const std::shared_ptr<LeaseType>&)> update_lease,
+            const isc::log::MessageID& stale_message) {
+    LeaseCollection new_leases;
+    std::vector<ElementPtr> new_elements;
+
+    for (auto const& l : leases->listValue()) {
+        try {
+            std::shared_ptr<LeaseType> lease = LeaseType::fromElement(l);
+
+            // Check if there is such lease in the database already.
+            std::shared_ptr<LeaseType> existing_lease = get_lease(*lease);
+            if (!existing_lease) {
+                // There is no such lease, so let's add it with the others.
+                new_leases.push_back(lease);
+                new_elements.push_back(l);
+
+            } else if (existing_lease->cltt_ < lease->cltt_) {
+                // If the existing lease is older than the fetched lease, update
+                // the lease in our local database.
+                update_lease(lease);
+
+            } else {
+                LOG_DEBUG(isc::ha::ha_logger, DBGLVL_TRACE_BASIC, stale_message)
+                    .arg(lease->addr_.toText())
+                    .arg(lease->subnet_id_);
+            }
+
+        } catch (const std::exception& ex) {
+            LOG_WARN(isc::ha::ha_logger, isc::ha::HA_LEASE_SYNC_FAILED)
+                .arg(l->str())
+                .arg(ex.what());
+        }
+    }
+
+    if (new_leases.empty()) {
+        return;
+    }
+
+    try {
+        LeaseMgrFactory::instance().addLeases(new_leases);
+        return;
+
+    } catch (const std::exception&) {
+        // The bulk insert failed as a whole. Add the leases one by one
+        // to find out which of them can't be stored.
+    }
+
+    for (size_t i = 0; i < new_leases.size(); ++i) {
+        try {
+            LeaseMgrFactory::instance().addLease(new_leases[i]);
+
+        } catch (const std::exception& ex) {
+            LOG_WARN(isc::ha::ha_logger, isc::ha::HA_LEASE_SYNC_FAILED)
+                .arg(new_elements[i]->str())
+                .arg(ex.what());
+        }
+    }
+}
+
+}
+
+namespace isc {
+namespace ha {
+
+LeaseSyncApplier::LeaseSyncApplier(const HAServerType& server_type,
+                                   const uint32_t threads,
+                                   asiolink::IOService& io_service)
+    : server_type_(server_type), io_service_(io_service), pool_(),
+      max_pending_(0), pending_(0), ready_(), done_(), mutex_(), cv_() {
+    // The lease managers can be used from many threads only when
+    // multi-threading is enabled.
+    if (threads && MultiThreadingMgr::instance().getMode()) {
+        pool_.start(threads);
+        max_pending_ = 2 * threads;
+    }
+}
+
+LeaseSyncApplier::~LeaseSyncApplier() {
+    wait();
+    if (pool_.size()) {
+        pool_.stop();
+    }
+}
+
+void
+LeaseSyncApplier::apply(const ElementPtr& leases, const Callback& ready) {
+    if (!pool_.size()) {
+        // Let the caller fetch the next page while this one is applied.
+        if (ready) {
+            ready();
+        }
+        applyPageInternal(leases);
+        return;
+    }
+
+    bool room = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++pending_;
+        room = (pending_ < max_pending_);
+        if (!room) {
+            // Hold the next page back until a worker is done.
+            ready_ = ready;
+        }
+    }
+
+    auto work = std::make_shared<std::function<void()>>([this, leases]() {
+        applyPageInWorker(leases);
+    });
+    pool_.add(work);
+
+    if (room && ready) {
+        ready();
+    }
+}
+
+void
+LeaseSyncApplier::whenApplied(const Callback& done) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (pending_) {
+            done_ = done;
+            return;
+        }
+    }
+    if (done) {
+        done();
+    }
+}
+
+void
+LeaseSyncApplier::wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this]() { return (pending_ == 0); });
+}
+
+size_t
+LeaseSyncApplier::getThreadCount() {
+    return (pool_.size());
+}
+
+void
+LeaseSyncApplier::applyPageInWorker(const ElementPtr& leases) {
+    applyPageInternal(leases);
+
+    Callback ready;
+    Callback done;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --pending_;
+        if (pending_ < max_pending_) {
+            ready.swap(ready_);
+        }
+        if (!pending_) {
+            done.swap(done_);
+        }
+        cv_.notify_all();
+    }
+
+    // The callbacks continue the synchronization, which runs in the
+    // thread of the IO service.
+    if (ready) {
+        io_service_.post(ready);
+    }
+    if (done) {
+        io_service_.post(done);
+    }
+}
+
+void
+LeaseSyncApplier::applyPageInternal(const ElementPtr& leases) {
+    try {
+        applyPage(server_type_, leases);
+
+    } catch (const std::exception& ex) {
+        LOG_ERROR(ha_logger, HA_LEASES_SYNC_APPLY_FAILED)
+            .arg(leases->size())
+            .arg(ex.what());
+    }
+}
+
+void
+LeaseSyncApplier::applyPage(const HAServerType& server_type,
+                            const ElementPtr& leases) {
+    if (server_type == HAServerType::DHCPv4) {
+        applyLeases<Lease4, Lease4Collection>(leases,
+            [](const Lease4& lease) {
+                return (LeaseMgrFactory::instance().getLease4(lease.addr_));
+            },
+            [](const Lease4Ptr& lease) {
+                LeaseMgrFactory::instance().updateLease4(lease);
+            },
+            HA_LEASE_SYNC_STALE_LEASE4_SKIP);
+
+    } else {
+        applyLeases<Lease6, Lease6Collection>(leases,
+            [](const Lease6& lease) {
+                return (LeaseMgrFactory::instance().getLease6(lease.type_,
+                                                              lease.addr_));
+            },
+            [](const Lease6Ptr& lease) {
+                LeaseMgrFactory::instance().updateLease6(lease);
+            },
+            HA_LEASE_SYNC_STALE_LEASE6_SKIP);
+    }
+}
+
+} // end of namespace isc::ha
+} // end of namespace isc
@@ -0,0 +1,167 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef HA_LEASE_SYNC_APPLIER_H
+#define HA_LEASE_SYNC_APPLIER_H
+
+#include <ha_server_type.h>
+#include <asiolink/io_service.h>
+#include <cc/data.h>
+#include <util/thread_pool.h>
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace isc {
+namespace ha {
+
+/// @brief Applies the pages of leases fetched from the partner during
+/// lease database synchronization.
+///
+/// Each page is decoded and stored in the local lease database. The
+/// leases which are not in the database yet are inserted with a single
+/// call to @c LeaseMgr::addLeases, which the SQL backends implement with
+/// multi-row inserts. The existing leases are updated if they are older
+/// than the fetched ones.
+///
+/// When multi-threading is enabled and the number of threads is not 0,
+/// the pages are applied by a pool of worker threads, so the thread
+/// receiving the pages can fetch the next page in the meantime. The
+/// thread running the IO service is never blocked: the callbacks passed
+/// to @c apply and @c whenApplied are invoked by the IO service when the
+/// workers have made progress. The caller fetches the next page in the
+/// callback passed to @c apply, which is delayed while twice the number
+/// of threads pages are waiting, so the pages are not fetched faster than
+/// they are stored. When multi-threading is disabled the pages are
+/// applied in the calling thread, because the lease managers are not
+/// thread safe then.
+class LeaseSyncApplier {
+public:
+
+    /// @brief Type of the callbacks invoked when the pages are applied.
+    typedef std::function<void()> Callback;
+
+    /// @brief Constructor.
+    ///
+    /// @param server_type DHCP server type, i.e. DHCPv4 or DHCPv6.
+    /// @param threads Number of threads applying the pages.
+    /// @param io_service IO service invoking the callbacks.
+    LeaseSyncApplier(const HAServerType& server_type, const uint32_t threads,
+                     asiolink::IOService& io_service);
+
+    /// @brief Destructor.
+    ///
+    /// Waits for the pending pages and stops the threads.
+    ~LeaseSyncApplier();
+
+    /// @brief Applies a page of leases.
+    ///
+    /// Without the threads the @c ready callback is invoked first, then
+    /// the page is applied. With the threads the page is queued and the
+    /// @c ready callback is invoked at once if fewer than twice the number
+    /// of threads pages are pending, otherwise by the IO service when a
+    /// page has been applied.
+    ///
+    /// @param leases List of leases in the JSON format.
+    /// @param ready Callback invoked when the next page can be applied.
+    void apply(const data::ElementPtr& leases, const Callback& ready = Callback());
+
+    /// @brief Invokes a callback when all pages have been applied.
+    ///
+    /// The callback is invoked at once if no page is pending, otherwise
+    /// by the IO service when the last pending page has been applied.
+    ///
+    /// @param done Callback invoked when all pages have been applied.
+    void whenApplied(const Callback& done);
+
+    /// @brief Waits until all pages have been applied.
+    ///
+    /// This blocks the calling thread, so it must not be called by the
+    /// thread running the IO service while the synchronization is in
+    /// progress.
+    void wait();
+
+    /// @brief Returns the number of threads applying the pages.
+    ///
+    /// @return Number of threads, 0 if the pages are applied in the
+    /// calling thread.
+    size_t getThreadCount();
+
+    /// @brief Stores a page of leases in the lease database.
+    ///
+    /// Errors are logged for the leases which can't be stored and the
+    /// remaining leases are processed.
+    ///
+    /// @param server_type DHCP server type, i.e. DHCPv4 or DHCPv6.
+    /// @param leases List of leases in the JSON format.
+    static void applyPage(const HAServerType& server_type,
+                          const data::ElementPtr& leases);
+
+private:
+
+    /// @brief Applies a page and logs unexpected errors.
+    ///
+    /// The errors don't terminate the synchronization, because the next
+    /// page may have been requested already.
+    ///
+    /// @param leases List of leases in the JSON format.
+    void applyPageInternal(const data::ElementPtr& leases);
+
+    /// @brief Applies a page in a worker thread and posts the callbacks
+    /// which can be invoked after it.
+    ///
+    /// @param leases List of leases in the JSON format.
+    void applyPageInWorker(const data::ElementPtr& leases);
+
+    /// @brief DHCP server type.
+    HAServerType server_type_;
+
+    /// @brief IO service invoking the callbacks.
+    asiolink::IOService& io_service_;
+
+    /// @brief Pool of threads applying the pages.
+    util::ThreadPool<std::function<void()>> pool_;
+
+    /// @brief Maximal number of pages waiting for the workers.
+    size_t max_pending_;
+
+    /// @brief Number of pages queued or being applied.
+    size_t pending_;
+
+    /// @brief Callback waiting for a page to be applied.
+    Callback ready_;
+
+    /// @brief Callback waiting for all pages to be applied.
+    Callback done_;
+
+    /// @brief Mutex protecting the number of pending pages and the
+    /// callbacks.
+    std::mutex mutex_;
+
+    /// @brief Condition variable signaled when a page has been applied.
+    std::condition_variable cv_;
+};
+
+/// @brief Pointer to the @c LeaseSyncApplier.
+typedef std::shared_ptr<LeaseSyncApplier> LeaseSyncApplierPtr;
+
+} // end of namespace isc::ha
+} // end of namespace isc
+
+#endif // HA_LEASE_SYNC_APPLIER_H
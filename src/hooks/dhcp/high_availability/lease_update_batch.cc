@@ -0,0 +1,110 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <command_creator.h>
+#include <lease_update_batch.h>
+
+using namespace isc::asiolink;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::hooks;
+
+namespace isc {
+namespace ha {
+
+LeaseUpdateBatch::LeaseUpdateBatch(const HAConfig::PeerConfigPtr& config)
+    : config_(config), queries_(), updates_(), index_() {
+}
+
+void
+LeaseUpdateBatch::addQuery(const PktPtr& query,
+                           const ParkingLotHandlePtr& parking_lot) {
+    PendingQuery pending;
+    pending.query_ = query;
+    pending.parking_lot_ = parking_lot;
+    queries_.push_back(pending);
+}
+
+void
+LeaseUpdateBatch::addLease(const LeasePtr& lease, const bool deleted) {
+    Lease::Type type = Lease::TYPE_V4;
+    Lease6Ptr lease6 = std::dynamic_pointer_cast<Lease6>(lease);
+    if (lease6) {
+        type = lease6->type_;
+    }
+    auto key = std::make_pair(type, lease->addr_);
+    auto it = index_.find(key);
+    if (it != index_.end()) {
+        // The later update of the lease supersedes the earlier one.
+        updates_[it->second] = std::make_pair(lease, deleted);
+        return;
+    }
+    index_.insert(std::make_pair(key, updates_.size()));
+    updates_.push_back(std::make_pair(lease, deleted));
+}
+
+ElementPtr
+LeaseUpdateBatch::createCommand(const HAServerType& server_type) const {
+    if (server_type == HAServerType::DHCPv4) {
+        Lease4CollectionPtr leases(new Lease4Collection());
+        Lease4CollectionPtr deleted_leases(new Lease4Collection());
+        for (auto const& update : updates_) {
+            auto lease = std::dynamic_pointer_cast<Lease4>(update.first);
+            if (update.second) {
+                deleted_leases->push_back(lease);
+            } else {
+                leases->push_back(lease);
+            }
+        }
+        return (CommandCreator::createLease4BulkApply(leases, deleted_leases));
+    }
+
+    Lease6CollectionPtr leases(new Lease6Collection());
+    Lease6CollectionPtr deleted_leases(new Lease6Collection());
+    for (auto const& update : updates_) {
+        auto lease = std::dynamic_pointer_cast<Lease6>(update.first);
+        if (update.second) {
+            deleted_leases->push_back(lease);
+        } else {
+            leases->push_back(lease);
+        }
+    }
+    return (CommandCreator::createLease6BulkApply(leases, deleted_leases));
+}
+
+size_t
+LeaseUpdateBatch::getConnectionIndex(const Lease& lease,
+                                     const size_t connections) {
+    if (connections <= 1) {
+        return (0);
+    }
+    if (lease.addr_.isV4()) {
+        return (lease.addr_.toUint32() % connections);
+    }
+    // FNV-1a over the address bytes.
+    uint32_t hash = 2166136261U;
+    for (auto byte : lease.addr_.toBytes()) {
+        hash ^= byte;
+        hash *= 16777619U;
+    }
+    return (hash % connections);
+}
+
+} // end of namespace isc::ha
+} // end of namespace isc
@@ -0,0 +1,145 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef HA_LEASE_UPDATE_BATCH_H
+#define HA_LEASE_UPDATE_BATCH_H
+
+#include <ha_config.h>
+#include <ha_server_type.h>
+#include <asiolink/io_address.h>
+#include <cc/data.h>
+#include <dhcp/pkt.h>
+#include <dhcpsrv/lease.h>
+#include <hooks/parking_lots.h>
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace isc {
+namespace ha {
+
+/// @brief Lease updates collected for a peer and sent in a single
+/// lease4-bulk-apply or lease6-bulk-apply command.
+///
+/// The lease updates of many DHCP queries are added to the batch until
+/// it is full or until the batch delay elapses. The batch keeps track
+/// of the queries which wait for the lease updates, so that the parked
+/// packets can be released when the peer responds.
+///
+/// The batch holds at most one update for every lease. When a lease is
+/// updated or deleted again before the batch is sent, the later update
+/// replaces the earlier one, because the bulk apply commands process
+/// the deleted leases before the new or updated leases.
+class LeaseUpdateBatch {
+public:
+
+    /// @brief DHCP query waiting for the lease updates in the batch.
+    struct PendingQuery {
+        /// @brief Weak pointer to the parked query.
+        std::weak_ptr<dhcp::Pkt> query_;
+
+        /// @brief Parking lot where the query is parked.
+        hooks::ParkingLotHandlePtr parking_lot_;
+    };
+
+    /// @brief Constructor.
+    ///
+    /// @param config Configuration of the peer to which the batch is sent.
+    explicit LeaseUpdateBatch(const HAConfig::PeerConfigPtr& config);
+
+    /// @brief Returns the configuration of the peer.
+    HAConfig::PeerConfigPtr getPeerConfig() const {
+        return (config_);
+    }
+
+    /// @brief Adds a query waiting for the lease updates in the batch.
+    ///
+    /// @param query Pointer to the DHCP client's query.
+    /// @param parking_lot Parking lot where the query is parked.
+    void addQuery(const dhcp::PktPtr& query,
+                  const hooks::ParkingLotHandlePtr& parking_lot);
+
+    /// @brief Adds a lease update to the batch.
+    ///
+    /// @param lease Pointer to the new, updated or deleted lease.
+    /// @param deleted true if the lease has been deleted.
+    void addLease(const dhcp::LeasePtr& lease, const bool deleted);
+
+    /// @brief Returns the number of lease updates in the batch.
+    size_t getLeaseCount() const {
+        return (updates_.size());
+    }
+
+    /// @brief Returns the number of queries waiting for the batch.
+    size_t getQueryCount() const {
+        return (queries_.size());
+    }
+
+    /// @brief Checks if the batch holds no lease updates.
+    bool empty() const {
+        return (updates_.empty());
+    }
+
+    /// @brief Returns the queries waiting for the batch.
+    const std::vector<PendingQuery>& getQueries() const {
+        return (queries_);
+    }
+
+    /// @brief Creates the bulk apply command for the lease updates.
+    ///
+    /// @param server_type DHCP server type, i.e. DHCPv4 or DHCPv6.
+    /// @return Pointer to the lease4-bulk-apply or lease6-bulk-apply
+    /// command.
+    data::ElementPtr createCommand(const HAServerType& server_type) const;
+
+    /// @brief Returns the index of the connection used for the lease.
+    ///
+    /// All updates of a lease are sent over the same connection, so they
+    /// are applied by the peer in the order in which they were made.
+    ///
+    /// @param lease Lease for which the connection is selected.
+    /// @param connections Number of connections.
+    /// @return Index of the connection, lower than @c connections.
+    static size_t getConnectionIndex(const dhcp::Lease& lease,
+                                     const size_t connections);
+
+private:
+
+    /// @brief Configuration of the peer.
+    HAConfig::PeerConfigPtr config_;
+
+    /// @brief Queries waiting for the batch.
+    std::vector<PendingQuery> queries_;
+
+    /// @brief Lease updates in the order of arrival.
+    ///
+    /// The flag is true for the deleted leases.
+    std::vector<std::pair<dhcp::LeasePtr, bool> > updates_;
+
+    /// @brief Index of the lease updates by lease type and address.
+    std::map<std::pair<dhcp::Lease::Type, asiolink::IOAddress>, size_t> index_;
+};
+
+/// @brief Pointer to the @c LeaseUpdateBatch.
+typedef std::shared_ptr<LeaseUpdateBatch> LeaseUpdateBatchPtr;
+
+} // end of namespace isc::ha
+} // end of namespace isc
+
+#endif // HA_LEASE_UPDATE_BATCH_H
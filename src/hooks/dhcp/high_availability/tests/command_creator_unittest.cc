@@ -199,6 +199,39 @@ TEST(CommandCreatorTest, createLease4Delete) {
     EXPECT_EQ(lease_as_json->str(), arguments->str());
 }
 
+// This test verifies that the lease4-bulk-apply command is correct.
+TEST(CommandCreatorTest, createLease4BulkApply) {
+    Lease4Ptr lease = createLease4();
+    Lease4Ptr deleted_lease = createLease4();
+
+    Lease4CollectionPtr leases(new Lease4Collection());
+    Lease4CollectionPtr deleted_leases(new Lease4Collection());
+
+    leases->push_back(lease);
+    deleted_leases->push_back(deleted_lease);
+
+    ElementPtr command = CommandCreator::createLease4BulkApply(leases, deleted_leases);
+    ElementPtr arguments;
+    ASSERT_NO_FATAL_FAILURE(testCommandBasics(command, "lease4-bulk-apply",
+                                              "dhcp4", arguments));
+
+    // Verify deleted-leases.
+    auto deleted_leases_json = arguments->get("deleted-leases");
+    ASSERT_TRUE(deleted_leases_json);
+    ASSERT_EQ(Element::list, deleted_leases_json->getType());
+    ASSERT_EQ(1, deleted_leases_json->size());
+    auto lease_as_json = deleted_leases_json->get(0);
+    EXPECT_EQ(leaseAsJson(createLease4())->str(), lease_as_json->str());
+
+    // Verify leases.
+    auto leases_json = arguments->get("leases");
+    ASSERT_TRUE(leases_json);
+    ASSERT_EQ(Element::list, leases_json->getType());
+    ASSERT_EQ(1, leases_json->size());
+    lease_as_json = leases_json->get(0);
+    EXPECT_EQ(leaseAsJson(createLease4())->str(), lease_as_json->str());
+}
+
 // This test verifies that the lease4-get-all command is correct.
 TEST(CommandCreatorTest, createLease4GetAll) {
     ElementPtr command = CommandCreator::createLease4GetAll();
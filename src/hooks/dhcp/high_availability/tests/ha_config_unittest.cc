@@ -69,11 +69,15 @@ TEST_F(HAConfigTest, configureLoadBalancing) {
         "        \"sync-leases\": false,"
         "        \"sync-timeout\": 20000,"
         "        \"sync-page-limit\": 3,"
+        "        \"sync-threads\": 2,"
         "        \"heartbeat-delay\": 8,"
         "        \"max-response-delay\": 11,"
         "        \"max-ack-delay\": 5,"
         "        \"max-unacked-clients\": 20,"
         "        \"wait-backup-ack\": false,"
+        "        \"lease-update-batch-size\": 100,"
+        "        \"lease-update-batch-delay\": 2,"
+        "        \"lease-update-connections\": 4,"
         "        \"peers\": ["
         "            {"
         "                \"name\": \"server1\","
@@ -120,11 +124,16 @@ TEST_F(HAConfigTest, configureLoadBalancing) {
     EXPECT_FALSE(impl->getConfig()->amSyncingLeases());
     EXPECT_EQ(20000, impl->getConfig()->getSyncTimeout());
     EXPECT_EQ(3, impl->getConfig()->getSyncPageLimit());
+    EXPECT_EQ(2, impl->getConfig()->getSyncThreads());
     EXPECT_EQ(8, impl->getConfig()->getHeartbeatDelay());
     EXPECT_EQ(11, impl->getConfig()->getMaxResponseDelay());
     EXPECT_EQ(5, impl->getConfig()->getMaxAckDelay());
     EXPECT_EQ(20, impl->getConfig()->getMaxUnackedClients());
     EXPECT_FALSE(impl->getConfig()->amWaitingBackupAck());
+    EXPECT_TRUE(impl->getConfig()->amBatchingLeaseUpdates());
+    EXPECT_EQ(100, impl->getConfig()->getLeaseUpdateBatchSize());
+    EXPECT_EQ(2, impl->getConfig()->getLeaseUpdateBatchDelay());
+    EXPECT_EQ(4, impl->getConfig()->getLeaseUpdateConnections());
 
     HAConfig::PeerConfigPtr cfg = impl->getConfig()->getThisServerConfig();
     ASSERT_TRUE(cfg);
@@ -227,10 +236,15 @@ TEST_F(HAConfigTest, configureHotStandby) {
     EXPECT_TRUE(impl->getConfig()->amSyncingLeases());
     EXPECT_EQ(60000, impl->getConfig()->getSyncTimeout());
     EXPECT_EQ(10000, impl->getConfig()->getSyncPageLimit());
+    EXPECT_EQ(4, impl->getConfig()->getSyncThreads());
     EXPECT_EQ(10000, impl->getConfig()->getHeartbeatDelay());
     EXPECT_EQ(10000, impl->getConfig()->getMaxAckDelay());
     EXPECT_EQ(10, impl->getConfig()->getMaxUnackedClients());
     EXPECT_FALSE(impl->getConfig()->amWaitingBackupAck());
+    EXPECT_FALSE(impl->getConfig()->amBatchingLeaseUpdates());
+    EXPECT_EQ(0, impl->getConfig()->getLeaseUpdateBatchSize());
+    EXPECT_EQ(5, impl->getConfig()->getLeaseUpdateBatchDelay());
+    EXPECT_EQ(1, impl->getConfig()->getLeaseUpdateConnections());
 
     HAConfig::PeerConfigPtr cfg = impl->getConfig()->getThisServerConfig();
     ASSERT_TRUE(cfg);
@@ -1063,6 +1077,32 @@ TEST_F(HAConfigTest, waitBackupAckHotStandby) {
         "'wait-backup-ack' must be set to false in the hot standby configuration");
 }
 
+// Test that at least one connection must be used for the lease updates.
+TEST_F(HAConfigTest, zeroLeaseUpdateConnections) {
+    testInvalidConfig(
+        "["
+        "    {"
+        "        \"this-server-name\": \"server1\","
+        "        \"mode\": \"load-balancing\","
+        "        \"lease-update-batch-size\": 100,"
+        "        \"lease-update-connections\": 0,"
+        "        \"peers\": ["
+        "            {"
+        "                \"name\": \"server1\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"primary\""
+        "            },"
+        "            {"
+        "                \"name\": \"server2\","
+        "                \"url\": \"http://127.0.0.1:8081/\","
+        "                \"role\": \"secondary\""
+        "            }"
+        "        ]"
+        "    }"
+        "]",
+        "'lease-update-connections' must be greater than 0");
+}
+
 // Test that secondary server is not allowed in the passive-backup mode.
 TEST_F(HAConfigTest, passiveBackupSecondaryServer) {
     testInvalidConfig(
@@ -1121,6 +1121,116 @@ public:
         EXPECT_FALSE(delete_request3);
     }
 
+    /// @brief Tests scenarios when the lease updates are batched.
+    ///
+    /// Two queries are processed. The first one allocates one lease and
+    /// releases another. The second one allocates a third lease.
+    ///
+    /// @param connections number of lease update connections.
+    /// @param should_pass indicates if the updates are expected to be
+    /// successful.
+    void testSendBatchedLeaseUpdates(const uint16_t connections,
+                                     const bool should_pass) {
+        HAConfigPtr config_storage = createValidConfiguration();
+        config_storage->setLeaseUpdateBatchSize(100);
+        config_storage->setLeaseUpdateBatchDelay(1);
+        config_storage->setLeaseUpdateConnections(connections);
+
+        ParkingLotPtr parking_lot(new ParkingLot());
+        ParkingLotHandlePtr parking_lot_handle(new ParkingLotHandle(parking_lot));
+
+        HWAddrPtr hwaddr(new HWAddr(std::vector<uint8_t>(6, 1), HTYPE_ETHER));
+        Lease4Ptr lease1(new Lease4(IOAddress("192.1.2.3"), hwaddr,
+                                    static_cast<const uint8_t*>(0), 0,
+                                    60, 0, 1));
+        Lease4Ptr lease2(new Lease4(IOAddress("192.2.3.4"), hwaddr,
+                                    static_cast<const uint8_t*>(0), 0,
+                                    60, 0, 1));
+        Lease4Ptr lease3(new Lease4(IOAddress("192.1.2.6"), hwaddr,
+                                    static_cast<const uint8_t*>(0), 0,
+                                    60, 0, 1));
+
+        Pkt4Ptr query1(new Pkt4(DHCPREQUEST, 1234));
+        Lease4CollectionPtr leases1(new Lease4Collection());
+        leases1->push_back(lease1);
+        Lease4CollectionPtr deleted_leases1(new Lease4Collection());
+        deleted_leases1->push_back(lease2);
+
+        Pkt4Ptr query2(new Pkt4(DHCPREQUEST, 5678));
+        Lease4CollectionPtr leases2(new Lease4Collection());
+        leases2->push_back(lease3);
+        Lease4CollectionPtr deleted_leases2(new Lease4Collection());
+
+        NakedCommunicationState4Ptr state(new NakedCommunicationState4(io_service_,
+                                                                       config_storage));
+        state->modifyPokeTime(-30);
+
+        TestHAService service(io_service_, network_state_, config_storage);
+        service.communication_state_ = state;
+        service.transition(HA_LOAD_BALANCING_ST, HAService::NOP_EVT);
+
+        EXPECT_EQ(1, service.asyncSendLeaseUpdates(query1, leases1, deleted_leases1,
+                                                   parking_lot_handle));
+        EXPECT_EQ(1, service.asyncSendLeaseUpdates(query2, leases2, deleted_leases2,
+                                                   parking_lot_handle));
+
+        // The query waits for one request per connection carrying its
+        // lease updates to the server 2. The updates to the backup server
+        // are not acknowledged.
+        size_t index1 = LeaseUpdateBatch::getConnectionIndex(*lease1, connections);
+        size_t index2 = LeaseUpdateBatch::getConnectionIndex(*lease2, connections);
+        EXPECT_EQ(index1 == index2 ? 1 : 2, service.getPendingRequest(query1));
+        EXPECT_EQ(1, service.getPendingRequest(query2));
+
+        // Nothing has been sent yet.
+        EXPECT_FALSE(state->isPoked());
+
+        bool unpark_called1 = false;
+        bool unpark_called2 = false;
+        ASSERT_NO_THROW(parking_lot->reference(query1));
+        ASSERT_NO_THROW(parking_lot->park(query1, [&unpark_called1] {
+            unpark_called1 = true;
+        }));
+        ASSERT_NO_THROW(parking_lot->reference(query2));
+        ASSERT_NO_THROW(parking_lot->park(query2, [&unpark_called2] {
+            unpark_called2 = true;
+        }));
+
+        ASSERT_NO_THROW(runIOService(TEST_TIMEOUT, [&service]() {
+            return (service.pendingRequestSize() == 0);
+        }));
+
+        EXPECT_EQ(should_pass, unpark_called1);
+        EXPECT_EQ(should_pass, unpark_called2);
+        EXPECT_EQ(should_pass, state->isPoked());
+
+        // The updates should not be sent to this server.
+        EXPECT_TRUE(factory_->getResponseCreator()->getReceivedRequests().empty());
+
+        if (!should_pass) {
+            EXPECT_FALSE(parking_lot_handle->drop(query1));
+            EXPECT_FALSE(parking_lot_handle->drop(query2));
+            return;
+        }
+
+        // All lease updates were sent in as many commands as there are
+        // connections in use.
+        std::set<size_t> indexes;
+        indexes.insert(index1);
+        indexes.insert(index2);
+        indexes.insert(LeaseUpdateBatch::getConnectionIndex(*lease3, connections));
+        EXPECT_EQ(indexes.size(),
+                  factory2_->getResponseCreator()->getReceivedRequests().size());
+        EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease4-bulk-apply",
+                                                                 "192.1.2.3"));
+        EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease4-bulk-apply",
+                                                                 "192.2.3.4"));
+        EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease4-bulk-apply",
+                                                                 "192.1.2.6"));
+        EXPECT_FALSE(factory2_->getResponseCreator()->findRequest("lease4-update",
+                                                                  "192.1.2.3"));
+    }
+
     /// @brief Tests scenarios when all lease updates are sent successfully.
     void testSendSuccessfulUpdates6() {
         // Start HTTP servers.
@@ -1672,6 +1782,60 @@ TEST_F(HAServiceTest, sendUpdatesControlResultErrorMultiThreading) {
     testSndUpdatesControlResultError();
 }
 
+// Test scenario when the lease updates are batched.
+TEST_F(HAServiceTest, sendBatchedUpdates) {
+    ASSERT_NO_THROW({
+            listener_->start();
+            listener2_->start();
+            listener3_->start();
+    });
+    testSendBatchedLeaseUpdates(1, true);
+}
+
+// Test scenario when the lease updates are batched.
+TEST_F(HAServiceTest, sendBatchedUpdatesMultiThreading) {
+    MultiThreadingMgr::instance().setMode(true);
+    ASSERT_NO_THROW({
+            listener_->start();
+            listener2_->start();
+            listener3_->start();
+    });
+    testSendBatchedLeaseUpdates(1, true);
+}
+
+// Test scenario when the batched lease updates are sent over multiple
+// connections.
+TEST_F(HAServiceTest, sendBatchedUpdatesMultipleConnections) {
+    ASSERT_NO_THROW({
+            listener_->start();
+            listener2_->start();
+            listener3_->start();
+    });
+    testSendBatchedLeaseUpdates(4, true);
+}
+
+// Test scenario when the batched lease updates are sent over multiple
+// connections.
+TEST_F(HAServiceTest, sendBatchedUpdatesMultipleConnectionsMultiThreading) {
+    MultiThreadingMgr::instance().setMode(true);
+    ASSERT_NO_THROW({
+            listener_->start();
+            listener2_->start();
+            listener3_->start();
+    });
+    testSendBatchedLeaseUpdates(4, true);
+}
+
+// Test scenario when the server to which the batched updates are sent
+// is offline.
+TEST_F(HAServiceTest, sendBatchedUpdatesActiveServerOffline) {
+    ASSERT_NO_THROW({
+            listener_->start();
+            listener3_->start();
+    });
+    testSendBatchedLeaseUpdates(2, false);
+}
+
 // Test scenario when all lease updates are sent successfully.
 TEST_F(HAServiceTest, sendSuccessfulUpdates6) {
     testSendSuccessfulUpdates6();
@@ -0,0 +1,284 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <ha_server_type.h>
+#include <lease_sync_applier.h>
+#include <asiolink/interval_timer.h>
+#include <asiolink/io_address.h>
+#include <asiolink/io_service.h>
+#include <cc/data.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/duid.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/lease.h>
+#include <dhcpsrv/lease_mgr.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <util/multi_threading_mgr.h>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::ha;
+using namespace isc::util;
+
+namespace {
+
+/// @brief Number of pages used in the tests.
+const size_t PAGES = 10;
+
+/// @brief Number of leases on a page.
+const size_t PAGE_SIZE = 20;
+
+/// @brief Creates IPv4 lease for the specified address.
+Lease4Ptr createLease4(const std::string& address, const time_t cltt) {
+    HWAddrPtr hwaddr(new HWAddr(std::vector<uint8_t>(6, 11), HTYPE_ETHER));
+    Lease4Ptr lease4(new Lease4(IOAddress(address), hwaddr,
+                                static_cast<const uint8_t*>(0), 0,
+                                60, cltt, 1));
+    return (lease4);
+}
+
+/// @brief Creates IPv6 lease for the specified address.
+Lease6Ptr createLease6(const std::string& address, const time_t cltt) {
+    DuidPtr duid(new DUID(std::vector<uint8_t>(8, 02)));
+    Lease6Ptr lease6(new Lease6(Lease::TYPE_NA, IOAddress(address),
+                                duid, 1234, 50, 60, 1));
+    lease6->cltt_ = cltt;
+    return (lease6);
+}
+
+/// @brief Returns the IPv4 address of the lease on the page.
+std::string address4(const size_t page, const size_t index) {
+    std::ostringstream s;
+    s << "192.1." << page << "." << (index + 1);
+    return (s.str());
+}
+
+/// @brief Returns the IPv6 address of the lease on the page.
+std::string address6(const size_t page, const size_t index) {
+    std::ostringstream s;
+    s << "2001:db8:" << page << "::" << std::hex << (index + 1);
+    return (s.str());
+}
+
+/// @brief Test fixture class for @c LeaseSyncApplier.
+class LeaseSyncApplierTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    LeaseSyncApplierTest() {
+        MultiThreadingMgr::instance().setMode(false);
+    }
+
+    /// @brief Destructor.
+    virtual ~LeaseSyncApplierTest() {
+        LeaseMgrFactory::destroy();
+        MultiThreadingMgr::instance().setMode(false);
+    }
+
+    /// @brief Applies the pages the way the synchronization does.
+    ///
+    /// The next page is applied in the callback invoked when the applier
+    /// can take it, and the IO service runs until all pages have been
+    /// applied.
+    ///
+    /// @param applier Object applying the pages.
+    /// @param pages Pages of leases.
+    void applyPages(LeaseSyncApplier& applier, const std::vector<ElementPtr>& pages) {
+        size_t next = 0;
+        bool done = false;
+        std::function<void()> apply_next = [&]() {
+            const ElementPtr& page = pages[next++];
+            if (next < pages.size()) {
+                applier.apply(page, apply_next);
+            } else {
+                applier.apply(page);
+                applier.whenApplied([&]() {
+                    done = true;
+                    io_service_.stop();
+                });
+            }
+        };
+
+        // Make sure the test ends if a callback is lost.
+        IntervalTimer timer(io_service_);
+        timer.setup([&]() { io_service_.stop(); }, 10000, IntervalTimer::ONE_SHOT);
+
+        apply_next();
+        if (!done) {
+            io_service_.run();
+        }
+        EXPECT_TRUE(done);
+        EXPECT_EQ(pages.size(), next);
+    }
+
+    /// @brief IO service invoking the callbacks of the applier.
+    IOService io_service_;
+
+    /// @brief Applies pages of IPv4 leases and checks the lease database.
+    ///
+    /// The first lease of every page is in the database already and is
+    /// newer than the fetched one. The second lease is in the database
+    /// already and is older than the fetched one.
+    ///
+    /// @param threads Number of threads applying the pages.
+    void testApply4(const uint32_t threads) {
+        ASSERT_NO_THROW(LeaseMgrFactory::create("universe=4 type=memfile persist=false"));
+        LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+
+        const time_t now = time(0);
+        std::vector<ElementPtr> pages;
+        for (size_t page = 0; page < PAGES; ++page) {
+            ElementPtr leases = Element::createList();
+            for (size_t i = 0; i < PAGE_SIZE; ++i) {
+                leases->add(createLease4(address4(page, i), now - 100)->toElement());
+            }
+            pages.push_back(leases);
+            ASSERT_TRUE(lease_mgr.addLease(createLease4(address4(page, 0), now)));
+            ASSERT_TRUE(lease_mgr.addLease(createLease4(address4(page, 1), now - 200)));
+        }
+
+        {
+            LeaseSyncApplier applier(HAServerType::DHCPv4, threads, io_service_);
+            applyPages(applier, pages);
+        }
+
+        for (size_t page = 0; page < PAGES; ++page) {
+            for (size_t i = 0; i < PAGE_SIZE; ++i) {
+                Lease4Ptr lease = lease_mgr.getLease4(IOAddress(address4(page, i)));
+                ASSERT_TRUE(lease) << address4(page, i);
+                EXPECT_EQ((i == 0 ? now : now - 100), lease->cltt_);
+            }
+        }
+    }
+
+    /// @brief Applies pages of IPv6 leases and checks the lease database.
+    ///
+    /// @param threads Number of threads applying the pages.
+    void testApply6(const uint32_t threads) {
+        ASSERT_NO_THROW(LeaseMgrFactory::create("universe=6 type=memfile persist=false"));
+        LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+
+        const time_t now = time(0);
+        std::vector<ElementPtr> pages;
+        for (size_t page = 0; page < PAGES; ++page) {
+            ElementPtr leases = Element::createList();
+            for (size_t i = 0; i < PAGE_SIZE; ++i) {
+                leases->add(createLease6(address6(page, i), now - 100)->toElement());
+            }
+            pages.push_back(leases);
+            ASSERT_TRUE(lease_mgr.addLease(createLease6(address6(page, 0), now)));
+            ASSERT_TRUE(lease_mgr.addLease(createLease6(address6(page, 1), now - 200)));
+        }
+
+        {
+            LeaseSyncApplier applier(HAServerType::DHCPv6, threads, io_service_);
+            applyPages(applier, pages);
+        }
+
+        for (size_t page = 0; page < PAGES; ++page) {
+            for (size_t i = 0; i < PAGE_SIZE; ++i) {
+                Lease6Ptr lease = lease_mgr.getLease6(Lease::TYPE_NA,
+                                                      IOAddress(address6(page, i)));
+                ASSERT_TRUE(lease) << address6(page, i);
+                EXPECT_EQ((i == 0 ? now : now - 100), lease->cltt_);
+            }
+        }
+    }
+};
+
+// Verifies that the threads are only used when multi-threading is enabled.
+TEST_F(LeaseSyncApplierTest, threadCount) {
+    {
+        LeaseSyncApplier applier(HAServerType::DHCPv4, 4, io_service_);
+        EXPECT_EQ(0, applier.getThreadCount());
+    }
+
+    MultiThreadingMgr::instance().setMode(true);
+    {
+        LeaseSyncApplier applier(HAServerType::DHCPv4, 0, io_service_);
+        EXPECT_EQ(0, applier.getThreadCount());
+    }
+    {
+        LeaseSyncApplier applier(HAServerType::DHCPv4, 4, io_service_);
+        EXPECT_EQ(4, applier.getThreadCount());
+    }
+}
+
+// Verifies that the IPv4 leases are applied in the calling thread.
+TEST_F(LeaseSyncApplierTest, apply4) {
+    testApply4(4);
+}
+
+// Verifies that the IPv4 leases are applied by the threads.
+TEST_F(LeaseSyncApplierTest, apply4MultiThreading) {
+    MultiThreadingMgr::instance().setMode(true);
+    testApply4(4);
+}
+
+// Verifies that the IPv6 leases are applied in the calling thread.
+TEST_F(LeaseSyncApplierTest, apply6) {
+    testApply6(4);
+}
+
+// Verifies that the IPv6 leases are applied by the threads.
+TEST_F(LeaseSyncApplierTest, apply6MultiThreading) {
+    MultiThreadingMgr::instance().setMode(true);
+    testApply6(4);
+}
+
+// Verifies that the pages are applied by a single thread, which makes
+// the applier hold the next page back.
+TEST_F(LeaseSyncApplierTest, apply4SingleThread) {
+    MultiThreadingMgr::instance().setMode(true);
+    testApply4(1);
+}
+
+// Verifies that the callbacks are invoked at once when no page is pending.
+TEST_F(LeaseSyncApplierTest, callbacksWithoutPages) {
+    MultiThreadingMgr::instance().setMode(true);
+    LeaseSyncApplier applier(HAServerType::DHCPv4, 4, io_service_);
+    bool done = false;
+    applier.whenApplied([&done]() { done = true; });
+    EXPECT_TRUE(done);
+}
+
+// Verifies that malformed leases are skipped and the remaining leases
+// are stored.
+TEST_F(LeaseSyncApplierTest, malformedLease) {
+    ASSERT_NO_THROW(LeaseMgrFactory::create("universe=4 type=memfile persist=false"));
+
+    ElementPtr leases = Element::createList();
+    leases->add(createLease4("192.1.2.3", time(0))->toElement());
+    leases->add(Element::fromJSON("{ \"ip-address\": \"2001:db8:1::1\" }"));
+    leases->add(createLease4("192.1.2.4", time(0))->toElement());
+
+    LeaseSyncApplier applier(HAServerType::DHCPv4, 0, io_service_);
+    ASSERT_NO_THROW(applier.apply(leases));
+
+    EXPECT_TRUE(LeaseMgrFactory::instance().getLease4(IOAddress("192.1.2.3")));
+    EXPECT_TRUE(LeaseMgrFactory::instance().getLease4(IOAddress("192.1.2.4")));
+}
+
+}
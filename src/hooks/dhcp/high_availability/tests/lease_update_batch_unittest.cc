@@ -0,0 +1,169 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <ha_config.h>
+#include <ha_server_type.h>
+#include <lease_update_batch.h>
+#include <asiolink/io_address.h>
+#include <cc/data.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/hwaddr.h>
+#include <dhcp/pkt4.h>
+#include <dhcpsrv/lease.h>
+#include <http/url.h>
+#include <gtest/gtest.h>
+#include <set>
+#include <sstream>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::ha;
+using namespace isc::http;
+
+namespace {
+
+/// @brief Creates configuration of the peer used in tests.
+HAConfig::PeerConfigPtr createPeerConfig() {
+    HAConfig::PeerConfigPtr config(new HAConfig::PeerConfig());
+    config->setName("server2");
+    config->setUrl(Url("http://127.0.0.1:18124/"));
+    config->setRole("secondary");
+    return (config);
+}
+
+/// @brief Creates IPv4 lease for the specified address.
+Lease4Ptr createLease4(const std::string& address, const uint32_t valid_lft = 60) {
+    HWAddrPtr hwaddr(new HWAddr(std::vector<uint8_t>(6, 11), HTYPE_ETHER));
+    Lease4Ptr lease4(new Lease4(IOAddress(address), hwaddr,
+                                static_cast<const uint8_t*>(0), 0,
+                                valid_lft, 0, 1));
+    return (lease4);
+}
+
+/// @brief Creates IPv6 lease for the specified address.
+Lease6Ptr createLease6(const std::string& address) {
+    DuidPtr duid(new DUID(std::vector<uint8_t>(8, 02)));
+    Lease6Ptr lease6(new Lease6(Lease::TYPE_NA, IOAddress(address),
+                                duid, 1234, 50, 60, 1));
+    return (lease6);
+}
+
+// Verifies that the later update of a lease replaces the earlier one.
+TEST(LeaseUpdateBatchTest, addLease) {
+    LeaseUpdateBatch batch(createPeerConfig());
+    EXPECT_TRUE(batch.empty());
+    EXPECT_EQ("server2", batch.getPeerConfig()->getName());
+
+    batch.addLease(createLease4("192.1.2.3", 60), false);
+    batch.addLease(createLease4("192.1.2.4"), false);
+    batch.addLease(createLease4("192.1.2.3", 120), false);
+    EXPECT_FALSE(batch.empty());
+    EXPECT_EQ(2, batch.getLeaseCount());
+
+    ElementPtr command = batch.createCommand(HAServerType::DHCPv4);
+    ASSERT_TRUE(command);
+    ASSERT_EQ("lease4-bulk-apply", command->get("command")->stringValue());
+    ElementPtr args = command->get("arguments");
+    ASSERT_TRUE(args);
+    ElementPtr leases = args->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(2, leases->size());
+    EXPECT_EQ("192.1.2.3", leases->get(0)->get("ip-address")->stringValue());
+    EXPECT_EQ(120, leases->get(0)->get("valid-lft")->intValue());
+    EXPECT_EQ("192.1.2.4", leases->get(1)->get("ip-address")->stringValue());
+    ElementPtr deleted_leases = args->get("deleted-leases");
+    ASSERT_TRUE(deleted_leases);
+    EXPECT_EQ(0, deleted_leases->size());
+
+    // The lease gets deleted after it has been updated.
+    batch.addLease(createLease4("192.1.2.4"), true);
+    EXPECT_EQ(2, batch.getLeaseCount());
+
+    command = batch.createCommand(HAServerType::DHCPv4);
+    args = command->get("arguments");
+    EXPECT_EQ(1, args->get("leases")->size());
+    ASSERT_EQ(1, args->get("deleted-leases")->size());
+    EXPECT_EQ("192.1.2.4",
+              args->get("deleted-leases")->get(0)->get("ip-address")->stringValue());
+}
+
+// Verifies that the lease6-bulk-apply command is created for the DHCPv6
+// server.
+TEST(LeaseUpdateBatchTest, createCommand6) {
+    LeaseUpdateBatch batch(createPeerConfig());
+    batch.addLease(createLease6("2001:db8:1::cafe"), false);
+    batch.addLease(createLease6("2001:db8:1::efac"), true);
+
+    ElementPtr command = batch.createCommand(HAServerType::DHCPv6);
+    ASSERT_TRUE(command);
+    ASSERT_EQ("lease6-bulk-apply", command->get("command")->stringValue());
+    ElementPtr args = command->get("arguments");
+    ASSERT_TRUE(args);
+    EXPECT_EQ(1, args->get("leases")->size());
+    EXPECT_EQ(1, args->get("deleted-leases")->size());
+}
+
+// Verifies that the queries are recorded.
+TEST(LeaseUpdateBatchTest, addQuery) {
+    LeaseUpdateBatch batch(createPeerConfig());
+    Pkt4Ptr query1(new Pkt4(DHCPREQUEST, 1234));
+    Pkt4Ptr query2(new Pkt4(DHCPREQUEST, 5678));
+    batch.addQuery(query1, hooks::ParkingLotHandlePtr());
+    batch.addQuery(query2, hooks::ParkingLotHandlePtr());
+    ASSERT_EQ(2, batch.getQueryCount());
+    EXPECT_EQ(query1, batch.getQueries()[0].query_.lock());
+    EXPECT_EQ(query2, batch.getQueries()[1].query_.lock());
+
+    // The batch doesn't keep the queries alive.
+    query1.reset();
+    EXPECT_FALSE(batch.getQueries()[0].query_.lock());
+}
+
+// Verifies that the leases are spread between the connections and that
+// the same lease always uses the same connection.
+TEST(LeaseUpdateBatchTest, getConnectionIndex) {
+    EXPECT_EQ(0, LeaseUpdateBatch::getConnectionIndex(*createLease4("192.1.2.3"), 1));
+    EXPECT_EQ(0, LeaseUpdateBatch::getConnectionIndex(*createLease4("192.1.2.3"), 0));
+
+    std::set<size_t> indexes4;
+    std::set<size_t> indexes6;
+    for (int i = 1; i < 64; ++i) {
+        auto lease4 = createLease4("192.1.2." + std::to_string(i));
+        size_t index = LeaseUpdateBatch::getConnectionIndex(*lease4, 4);
+        ASSERT_LT(index, 4);
+        EXPECT_EQ(index, LeaseUpdateBatch::getConnectionIndex(*lease4, 4));
+        indexes4.insert(index);
+
+        std::ostringstream s;
+        s << "2001:db8:1::" << std::hex << i;
+        auto lease6 = createLease6(s.str());
+        index = LeaseUpdateBatch::getConnectionIndex(*lease6, 4);
+        ASSERT_LT(index, 4);
+        EXPECT_EQ(index, LeaseUpdateBatch::getConnectionIndex(*lease6, 4));
+        indexes6.insert(index);
+    }
+    EXPECT_EQ(4, indexes4.size());
+    EXPECT_EQ(4, indexes6.size());
+}
+
+}
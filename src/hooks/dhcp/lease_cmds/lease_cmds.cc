@@ -147,6 +147,18 @@ public:
     int
     lease6BulkApplyHandler(CalloutHandle& handle);
 
+    /// @brief lease4-bulk-apply command handler
+    ///
+    /// Provides the implementation for the
+    /// @ref isc::lease_cmds::LeaseCmds::lease4BulkApplyHandler.
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// add command JSON text in the "command" argument
+    ///
+    /// @return 0 upon success, non-zero otherwise
+    int
+    lease4BulkApplyHandler(CalloutHandle& handle);
+
     /// @brief lease4-get, lease6-get command handler
     ///
     /// Provides the implementation for @ref isc::lease_cmds::LeaseCmds::leaseGetHandler
@@ -357,6 +369,19 @@ public:
     /// @throw InvalidOperation if the query type is unknown.
     Lease6Ptr getIPv6LeaseForDelete(const Parameters& parameters) const;
 
+    /// @brief Convenience function fetching an IPv4 lease to be deleted.
+    ///
+    /// The lease is looked up by address, HW address or client identifier,
+    /// depending on the @c query_type value stored in the passed object.
+    ///
+    /// @param parameters parameters extracted from the command.
+    ///
+    /// @return Lease to be deleted or null if there is no such lease.
+    ///
+    /// @throw InvalidParameter if the query type is by DUID.
+    /// @throw InvalidOperation if the query type is unknown.
+    Lease4Ptr getIPv4LeaseForDelete(const Parameters& parameters) const;
+
     /// @brief Returns a map holding brief information about a lease which
     /// failed to be deleted, updated or added.
     ///
@@ -1696,6 +1721,203 @@ LeaseCmdsImpl::lease6BulkApplyHandler(CalloutHandle& handle) {
     return (CONTROL_RESULT_SUCCESS);
 }
 
+int
+LeaseCmdsImpl::lease4BulkApplyHandler(CalloutHandle& handle) {
+    try {
+        extractCommand(handle);
+
+        // Arguments are mandatory.
+        if (!cmd_args_ || (cmd_args_->getType() != Element::map)) {
+            isc_throw(BadValue, "Command arguments missing or a not a map.");
+        }
+
+        // At least one of the 'deleted-leases' or 'leases' must be present.
+        auto deleted_leases = cmd_args_->get("deleted-leases");
+        auto leases = cmd_args_->get("leases");
+
+        if (!deleted_leases && !leases) {
+            isc_throw(BadValue, "neither 'deleted-leases' nor 'leases' parameter"
+                      " specified");
+        }
+
+        // Make sure that 'deleted-leases' is a list, if present.
+        if (deleted_leases && (deleted_leases->getType() != Element::list)) {
+            isc_throw(BadValue, "the 'deleted-leases' parameter must be a list");
+        }
+
+        // Make sure that 'leases' is a list, if present.
+        if (leases && (leases->getType() != Element::list)) {
+            isc_throw(BadValue, "the 'leases' parameter must be a list");
+        }
+
+        // Parse deleted leases without deleting them from the database
+        // yet. If any of the deleted leases or new leases appears to be
+        // malformed we can easily rollback.
+        std::list<std::pair<Parameters, Lease4Ptr> > parsed_deleted_list;
+        if (deleted_leases) {
+            auto leases_list = deleted_leases->listValue();
+
+            // Iterate over leases to be deleted.
+            for (auto lease_params : leases_list) {
+                // Parsing the lease may throw and it means that the lease
+                // information is malformed.
+                Parameters p = getParameters(false, lease_params);
+                auto lease = getIPv4LeaseForDelete(p);
+                parsed_deleted_list.push_back(std::make_pair(p, lease));
+            }
+        }
+
+        // Parse new/updated leases without affecting the database to detect
+        // any errors that should cause an error response.
+        std::list<Lease4Ptr> parsed_leases_list;
+        if (leases) {
+            ConstSrvConfigPtr config = CfgMgr::instance().getCurrentCfg();
+
+            // Iterate over all leases.
+            auto leases_list = leases->listValue();
+            for (auto lease_params : leases_list) {
+
+                Lease4Parser parser;
+                bool force_update;
+
+                // If parsing the lease fails we throw, as it indicates that the
+                // command is malformed.
+                Lease4Ptr lease4 = parser.parse(config, lease_params, force_update);
+                parsed_leases_list.push_back(lease4);
+            }
+        }
+
+        // Count successful deletions and updates.
+        size_t success_count = 0;
+
+        ElementPtr failed_deleted_list;
+        if (!parsed_deleted_list.empty()) {
+
+            // Iterate over leases to be deleted.
+            for (auto lease_params_pair : parsed_deleted_list) {
+
+                Parameters p = lease_params_pair.first;
+                auto lease = lease_params_pair.second;
+
+                try {
+                    // This may throw if the lease couldn't be deleted for
+                    // any reason, but we still want to proceed with other
+                    // leases.
+                    if (lease && LeaseMgrFactory::instance().deleteLease(lease)) {
+                        ++success_count;
+                        LeaseCmdsImpl::updateStatsOnDelete(lease);
+
+                    } else {
+                        // Lazy creation of the list of leases which failed to delete.
+                        if (!failed_deleted_list) {
+                            failed_deleted_list = Element::createList();
+                        }
+
+                        // If the lease doesn't exist we also want to put it
+                        // on the list of leases which failed to delete. That
+                        // corresponds to the lease4-del command which returns
+                        // an error when the lease doesn't exist.
+                        failed_deleted_list->add(createFailedLeaseMap(Lease::TYPE_V4,
+                                                                      lease ? lease->addr_ :
+                                                                      p.addr,
+                                                                      DuidPtr(),
+                                                                      CONTROL_RESULT_EMPTY,
+                                                                      "lease not found"));
+                    }
+
+                } catch (const std::exception& ex) {
+                    // Lazy creation of the list of leases which failed to delete.
+                    if (!failed_deleted_list) {
+                         failed_deleted_list = Element::createList();
+                    }
+                    failed_deleted_list->add(createFailedLeaseMap(Lease::TYPE_V4,
+                                                                  lease->addr_,
+                                                                  DuidPtr(),
+                                                                  CONTROL_RESULT_ERROR,
+                                                                  ex.what()));
+                }
+            }
+        }
+
+        // Process leases to be added or/and updated.
+        ElementPtr failed_leases_list;
+        if (!parsed_leases_list.empty()) {
+
+            // Iterate over all leases.
+            for (auto lease : parsed_leases_list) {
+
+                try {
+                    if (MultiThreadingMgr::instance().getMode() &&
+                        !MultiThreadingMgr::instance().isInCriticalSection()) {
+                        bool use_cs = false;
+                        {
+                            // Try to avoid a race.
+                            ResourceHandler4 resource_handler;
+                            use_cs = !resource_handler.tryLock4(lease->addr_);
+                            if (!use_cs) {
+                                addOrUpdate4(lease, true);
+                            }
+                        }
+                        if (use_cs) {
+                            // Failed to avoid the race.
+                            MultiThreadingCriticalSection cs;
+                            addOrUpdate4(lease, true);
+                        }
+                    } else {
+                        // No multi-threading.
+                        addOrUpdate4(lease, true);
+                    }
+
+                    ++success_count;
+
+                } catch (const std::exception& ex) {
+                    // Lazy creation of the list of leases which failed to add/update.
+                    if (!failed_leases_list) {
+                         failed_leases_list = Element::createList();
+                    }
+                    failed_leases_list->add(createFailedLeaseMap(Lease::TYPE_V4,
+                                                                 lease->addr_,
+                                                                 DuidPtr(),
+                                                                 CONTROL_RESULT_ERROR,
+                                                                 ex.what()));
+                }
+            }
+        }
+
+        // Start preparing the response.
+        ElementPtr args;
+
+        if (failed_deleted_list || failed_leases_list) {
+            // If there are any failed leases, let's include them in the response.
+            args = Element::createMap();
+
+            // failed-deleted-leases
+            if (failed_deleted_list) {
+                args->set("failed-deleted-leases", failed_deleted_list);
+            }
+
+            // failed-leases
+            if (failed_leases_list) {
+                args->set("failed-leases", failed_leases_list);
+            }
+        }
+
+        // Send the success response and include failed leases.
+        std::ostringstream resp_text;
+        resp_text << "Bulk apply of " << success_count << " IPv4 leases completed.";
+        auto answer = createAnswer(success_count > 0 ? CONTROL_RESULT_SUCCESS :
+                                   CONTROL_RESULT_EMPTY, resp_text.str(), args);
+        setResponse(handle, answer);
+
+    } catch (const std::exception& ex) {
+        // Unable to parse the command and similar issues.
+        setErrorResponse(handle, ex.what());
+        return (CONTROL_RESULT_ERROR);
+    }
+
+    return (CONTROL_RESULT_SUCCESS);
+}
+
 int
 LeaseCmdsImpl::lease6DelHandler(CalloutHandle& handle) {
     Parameters p;
@@ -2073,6 +2295,47 @@ LeaseCmdsImpl::getIPv6LeaseForDelete(const Parameters& parameters) const {
     return (lease6);
 }
 
+Lease4Ptr
+LeaseCmdsImpl::getIPv4LeaseForDelete(const Parameters& parameters) const {
+    Lease4Ptr lease4;
+
+    switch (parameters.query_type) {
+    case Parameters::TYPE_ADDR: {
+        lease4 = LeaseMgrFactory::instance().getLease4(parameters.addr);
+        break;
+    }
+    case Parameters::TYPE_HWADDR: {
+        if (!parameters.hwaddr) {
+            isc_throw(InvalidParameter, "Program error: Query by hw-address "
+                      "requires hwaddr to be specified");
+        }
+
+        lease4 = LeaseMgrFactory::instance().getLease4(*parameters.hwaddr,
+                                                       parameters.subnet_id);
+        break;
+    }
+    case Parameters::TYPE_CLIENT_ID: {
+        if (!parameters.client_id) {
+            isc_throw(InvalidParameter, "Program error: Query by client-id "
+                      "requires client-id to be specified");
+        }
+
+        lease4 = LeaseMgrFactory::instance().getLease4(*parameters.client_id,
+                                                       parameters.subnet_id);
+        break;
+    }
+    case Parameters::TYPE_DUID: {
+        isc_throw(InvalidParameter, "Delete by duid is not allowed in v4.");
+        break;
+    }
+    default:
+        isc_throw(InvalidOperation, "Unknown query type: "
+                  << static_cast<int>(parameters.query_type));
+    }
+
+    return (lease4);
+}
+
 IOAddress
 LeaseCmdsImpl::getAddressParam(ElementPtr params, const std::string name,
                                short family) const {
@@ -2227,6 +2490,11 @@ LeaseCmds::lease6BulkApplyHandler(CalloutHandle& handle) {
     return (impl_->lease6BulkApplyHandler(handle));
 }
 
+int
+LeaseCmds::lease4BulkApplyHandler(CalloutHandle& handle) {
+    return (impl_->lease4BulkApplyHandler(handle));
+}
+
 int
 LeaseCmds::leaseGetHandler(CalloutHandle& handle) {
     return (impl_->leaseGetHandler(handle));
@@ -164,6 +164,47 @@ public:
     int
     lease6BulkApplyHandler(hooks::CalloutHandle& handle);
 
+    /// @brief lease4-bulk-apply command handler
+    ///
+    /// This command is the DHCPv4 counterpart of the lease6-bulk-apply
+    /// command. It is used by the High Availability hooks library to
+    /// send the lease updates for many DHCPv4 queries in a single request.
+    ///
+    /// @note Unlike lease4-del, this command does not support "update-ddns"
+    /// and this will not generate CHG_REMOVEs for deleted leases.
+    ///
+    /// Example structure of the command:
+    ///
+    /// {
+    ///     "command": "lease4-bulk-apply",
+    ///     "arguments": {
+    ///         "deleted-leases": [
+    ///             {
+    ///                 "ip-address": "192.0.2.202",
+    ///                 ...
+    ///             }
+    ///         ],
+    ///         "leases": [
+    ///             {
+    ///                 "subnet-id": 44,
+    ///                 "ip-address": "192.0.2.1",
+    ///                 "hw-address": "1a:1b:1c:1d:1e:1f",
+    ///                 ...
+    ///             }
+    ///         ]
+    ///     }
+    /// }
+    ///
+    /// The deleted leases may also be specified by HW address or client
+    /// identifier and subnet identifier. The response has the same format
+    /// as the response to the lease6-bulk-apply command.
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// add command JSON text in the "command" argument
+    /// @return result of the operation
+    int
+    lease4BulkApplyHandler(hooks::CalloutHandle& handle);
+
     /// @brief lease4-get, lease6-get command handler
     ///
     /// This command attempts to retrieve a lease that match selected criteria.
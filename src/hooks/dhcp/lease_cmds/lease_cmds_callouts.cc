@@ -55,6 +55,17 @@ int lease6_bulk_apply(CalloutHandle& handle) {
     return (lease_cmds.lease6BulkApplyHandler(handle));
 }
 
+/// @brief This is a command callout for 'lease4-bulk-apply' command.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return 0 if this callout has been invoked successfully,
+/// 1 otherwise.
+int lease4_bulk_apply(CalloutHandle& handle) {
+    LeaseCmds lease_cmds;
+    return (lease_cmds.lease4BulkApplyHandler(handle));
+}
+
 /// @brief This is a command callout for 'lease4-get' command.
 ///
 /// @param handle Callout handle used to retrieve a command and
@@ -271,6 +282,7 @@ int lease6_resend_ddns(CalloutHandle& handle) {
 int load(LibraryHandle& handle) {
     handle.registerCommandCallout("lease4-add", lease4_add);
     handle.registerCommandCallout("lease6-add", lease6_add);
+    handle.registerCommandCallout("lease4-bulk-apply", lease4_bulk_apply);
     handle.registerCommandCallout("lease6-bulk-apply", lease6_bulk_apply);
     handle.registerCommandCallout("lease4-get", lease4_get);
     handle.registerCommandCallout("lease6-get", lease6_get);
@@ -5830,6 +5830,166 @@ TEST_F(LeaseCmdsTest, Lease6BulkApplyRollback) {
     EXPECT_TRUE(lmptr_->getLease6(Lease::TYPE_NA, IOAddress("2001:db8:1::2")));
 }
 
+// This test verifies that it is possible to add two leases and delete
+// two leases as a result of the single lease4-bulk-apply command.
+TEST_F(LeaseCmdsTest, Lease4BulkApply) {
+
+    // Initialize lease manager (false = v4, true = add leases)
+    initLeaseMgr(false, true);
+
+    checkLease4Stats(44, 2, 0);
+
+    checkLease4Stats(88, 2, 0);
+
+    // Now send the command.
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\",\n"
+        "    \"arguments\": {"
+        "        \"deleted-leases\": ["
+        "            {"
+        "                \"ip-address\": \"192.0.2.1\""
+        "            },"
+        "            {"
+        "                \"ip-address\": \"192.0.2.2\""
+        "            }"
+        "        ],"
+        "        \"leases\": ["
+        "            {"
+        "                \"subnet-id\": 44,\n"
+        "                \"ip-address\": \"192.0.2.202\",\n"
+        "                \"hw-address\": \"1a:1b:1c:1d:1e:1f\"\n"
+        "            },"
+        "            {"
+        "                \"subnet-id\": 88,\n"
+        "                \"ip-address\": \"192.0.3.1\",\n"
+        "                \"hw-address\": \"2a:2b:2c:2d:2e:2f\"\n"
+        "            }"
+        "        ]"
+        "    }"
+        "}";
+    string exp_rsp = "Bulk apply of 4 IPv4 leases completed.";
+
+    // The status expected is success.
+    testCommand(cmd, CONTROL_RESULT_SUCCESS, exp_rsp);
+
+    checkLease4Stats(44, 1, 0);
+
+    checkLease4Stats(88, 2, 0);
+
+    // Check that the lease we inserted is stored.
+    EXPECT_TRUE(lmptr_->getLease4(IOAddress("192.0.2.202")));
+
+    // Check that the lease we updated has the new HW address.
+    Lease4Ptr lease = lmptr_->getLease4(IOAddress("192.0.3.1"));
+    ASSERT_TRUE(lease);
+    ASSERT_TRUE(lease->hwaddr_);
+    EXPECT_EQ("hwtype=1 2a:2b:2c:2d:2e:2f", lease->hwaddr_->toText());
+
+    // Check that the leases we deleted are gone,
+    EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.2.1")));
+    EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.2.2")));
+}
+
+// This test verifies that the leases which do not exist are reported
+// by the lease4-bulk-apply.
+TEST_F(LeaseCmdsTest, Lease4BulkApplyDeleteNonExiting) {
+
+    // Initialize lease manager (false = v4, true = add leases)
+    initLeaseMgr(false, true);
+
+    checkLease4Stats(44, 2, 0);
+
+    // Now send the command.
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\",\n"
+        "    \"arguments\": {"
+        "        \"deleted-leases\": ["
+        "            {"
+        "                \"ip-address\": \"192.0.2.123\""
+        "            },"
+        "            {"
+        "                \"ip-address\": \"192.0.2.234\""
+        "            }"
+        "        ]"
+        "    }"
+        "}";
+    string exp_rsp = "Bulk apply of 0 IPv4 leases completed.";
+
+    // The status expected is empty.
+    auto resp = testCommand(cmd, CONTROL_RESULT_EMPTY, exp_rsp);
+    ASSERT_TRUE(resp);
+    ASSERT_EQ(Element::map, resp->getType());
+
+    checkLease4Stats(44, 2, 0);
+
+    auto args = resp->get("arguments");
+    ASSERT_TRUE(args);
+    ASSERT_EQ(Element::map, args->getType());
+
+    auto failed_deleted_leases = args->get("failed-deleted-leases");
+    ASSERT_TRUE(failed_deleted_leases);
+    ASSERT_EQ(Element::list, failed_deleted_leases->getType());
+    ASSERT_EQ(2, failed_deleted_leases->size());
+
+    {
+        SCOPED_TRACE("lease address 192.0.2.123");
+        checkFailedLease(failed_deleted_leases, "V4", "192.0.2.123",
+                         CONTROL_RESULT_EMPTY, "lease not found");
+    }
+
+    {
+        SCOPED_TRACE("lease address 192.0.2.234");
+        checkFailedLease(failed_deleted_leases, "V4", "192.0.2.234",
+                         CONTROL_RESULT_EMPTY, "lease not found");
+    }
+}
+
+// Check that changes for other leases are not applied if one of
+// the IPv4 leases is malformed.
+TEST_F(LeaseCmdsTest, Lease4BulkApplyRollback) {
+
+    // Initialize lease manager (false = v4, true = add leases)
+    initLeaseMgr(false, true);
+
+    checkLease4Stats(44, 2, 0);
+
+    // Now send the command.
+    string cmd =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\",\n"
+        "    \"arguments\": {"
+        "        \"deleted-leases\": ["
+        "            {"
+        "                \"ip-address\": \"192.0.2.1\""
+        "            }"
+        "        ],"
+        "        \"leases\": ["
+        "            {"
+        "                \"subnet-id\": 44,\n"
+        "                \"ip-address\": \"192.0.2.202\","
+        "                \"hw-address\": \"1a:1b:1c:1d:1e:1f\""
+        "            },"
+        "            {"
+        "                \"subnet-id\": 44,"
+        "                \"ip-address\": \"192.0.2.203\""
+        "            }"
+        "        ]"
+        "    }"
+        "}";
+
+    // The second lease lacks the HW address.
+    auto resp = testCommand(cmd, CONTROL_RESULT_ERROR, "");
+    ASSERT_TRUE(resp);
+
+    checkLease4Stats(44, 2, 0);
+
+    EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.2.202")));
+    EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.2.203")));
+    EXPECT_TRUE(lmptr_->getLease4(IOAddress("192.0.2.1")));
+}
+
 // Checks that lease4-resend-ddns sanitizes its input.
 TEST_F(LeaseCmdsTest, Lease4ResendDdnsBadParam) {
 
@@ -0,0 +1,60 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <asiolink/compact_address.h>
+
+#include <arpa/inet.h>
+#include <sys/socket.h>
+
+namespace isc {
+namespace asiolink {
+
+std::string
+CompactAddress::toText() const {
+    char text[INET6_ADDRSTRLEN];
+    if (!v6_) {
+        uint8_t bytes[V4ADDRESS_LEN];
+        for (size_t i = 0; i < V4ADDRESS_LEN; ++i) {
+            bytes[V4ADDRESS_LEN - 1 - i] = static_cast<uint8_t>(lo_ >> (8 * i));
+        }
+        inet_ntop(AF_INET, bytes, text, sizeof(text));
+    } else {
+        uint8_t bytes[V6ADDRESS_LEN];
+        for (size_t i = 0; i < 8; ++i) {
+            bytes[7 - i] = static_cast<uint8_t>(hi_ >> (8 * i));
+            bytes[15 - i] = static_cast<uint8_t>(lo_ >> (8 * i));
+        }
+        inet_ntop(AF_INET6, bytes, text, sizeof(text));
+    }
+    return (std::string(text));
+}
+
+short
+CompactAddress::getFamily() const {
+    return (v6_ ? AF_INET6 : AF_INET);
+}
+
+std::ostream&
+operator<<(std::ostream& os, const CompactAddress& address) {
+    os << address.toText();
+    return (os);
+}
+
+}  // namespace asiolink
+}  // namespace isc
@@ -0,0 +1,274 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef COMPACT_ADDRESS_H
+#define COMPACT_ADDRESS_H
+
+#include <asiolink/io_address.h>
+
+#include <stdint.h>
+
+#include <ostream>
+#include <string>
+
+namespace isc {
+namespace asiolink {
+
+/// @brief IP address held in 128 bits and a family tag.
+///
+/// This is an alternative to the @c IOAddress for the containers and the
+/// loops in which the addresses are compared, hashed and incremented many
+/// times. The @c IOAddress wraps the @c boost::asio::ip::address, which
+/// holds an IPv4 address, an IPv6 address and a scope identifier, and its
+/// arithmetic goes through vectors and text conversions.
+///
+/// The address is held as an unsigned 128 bit number split in two 64 bit
+/// halves. An IPv4 address takes the lowest 32 bits. The comparison,
+/// hashing, prefix and range checks work on the two halves without branches
+/// and without allocating memory. The addresses are ordered the way the
+/// @c IOAddress orders them: all IPv4 addresses precede the IPv6 addresses.
+///
+/// The scope identifier and the port set parameters of the @c IOAddress
+/// are not kept.
+class CompactAddress {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Creates the IPv4 zero address.
+    CompactAddress() : hi_(0), lo_(0), v6_(0) {
+    }
+
+    /// @brief Constructor.
+    ///
+    /// Creates an IPv4 address.
+    ///
+    /// @param v4address IPv4 address in the host byte order.
+    explicit CompactAddress(const uint32_t v4address)
+        : hi_(0), lo_(v4address), v6_(0) {
+    }
+
+    /// @brief Constructor.
+    ///
+    /// Converts the @c IOAddress without allocating memory.
+    ///
+    /// @param address Address to convert.
+    CompactAddress(const IOAddress& address) : hi_(0), lo_(0), v6_(0) {
+        if (address.asio_address_.is_v4()) {
+            lo_ = address.asio_address_.to_v4().to_uint();
+        } else {
+            v6_ = 1;
+            const boost::asio::ip::address_v6::bytes_type bytes =
+                address.asio_address_.to_v6().to_bytes();
+            for (size_t i = 0; i < 8; ++i) {
+                hi_ = (hi_ << 8) | bytes[i];
+                lo_ = (lo_ << 8) | bytes[i + 8];
+            }
+        }
+    }
+
+    /// @brief Converts the address to the @c IOAddress.
+    ///
+    /// @return The @c IOAddress.
+    IOAddress toIOAddress() const {
+        if (!v6_) {
+            return (IOAddress(static_cast<uint32_t>(lo_)));
+        }
+        boost::asio::ip::address_v6::bytes_type bytes;
+        for (size_t i = 0; i < 8; ++i) {
+            bytes[7 - i] = static_cast<uint8_t>(hi_ >> (8 * i));
+            bytes[15 - i] = static_cast<uint8_t>(lo_ >> (8 * i));
+        }
+        return (IOAddress(boost::asio::ip::address(
+                    boost::asio::ip::address_v6(bytes))));
+    }
+
+    /// @brief Returns the address in the textual format.
+    ///
+    /// @return The address in the textual format.
+    std::string toText() const;
+
+    /// @brief Checks if the address is an IPv4 address.
+    bool isV4() const {
+        return (!v6_);
+    }
+
+    /// @brief Checks if the address is an IPv6 address.
+    bool isV6() const {
+        return (v6_);
+    }
+
+    /// @brief Returns the address family, AF_INET or AF_INET6.
+    short getFamily() const;
+
+    /// @brief Returns the number of bits of the address.
+    uint8_t getBits() const {
+        return (v6_ ? 128 : 32);
+    }
+
+    /// @brief Returns the most significant half of the 128 bit number.
+    uint64_t getHigh() const {
+        return (hi_);
+    }
+
+    /// @brief Returns the least significant half of the 128 bit number.
+    uint64_t getLow() const {
+        return (lo_);
+    }
+
+    /// @brief Checks if the address belongs to the prefix.
+    ///
+    /// The address and the prefix are compared under a mask, without
+    /// computing the first and the last address of the prefix.
+    ///
+    /// @param prefix Prefix.
+    /// @param len Prefix length, not greater than the number of bits of
+    /// the prefix.
+    /// @return true if the address has the family of the prefix and the
+    /// same first @c len bits.
+    bool inPrefix(const CompactAddress& prefix, const uint8_t len) const {
+        // The IPv4 address is held in the lowest 32 bits.
+        const unsigned shift = 128 - len - (v6_ ? 0 : 96);
+        uint64_t mask_hi;
+        uint64_t mask_lo;
+        maskAbove(shift, mask_hi, mask_lo);
+        return ((v6_ == prefix.v6_) &
+                ((((hi_ ^ prefix.hi_) & mask_hi) |
+                  ((lo_ ^ prefix.lo_) & mask_lo)) == 0));
+    }
+
+    /// @brief Checks if the address belongs to the range.
+    ///
+    /// @param first First address of the range.
+    /// @param last Last address of the range.
+    /// @return true if the address is between @c first and @c last,
+    /// inclusive.
+    bool inRange(const CompactAddress& first, const CompactAddress& last) const {
+        return (!(*this < first) & !(last < *this));
+    }
+
+    /// @brief Returns the address increased by one.
+    ///
+    /// The address wraps around after the last address of its family.
+    CompactAddress increase() const {
+        return (increasePrefix(getBits()));
+    }
+
+    /// @brief Returns the first address of the next prefix.
+    ///
+    /// The bits following the prefix are left unchanged. The address wraps
+    /// around after the last prefix of its family.
+    ///
+    /// @param len Prefix length, between 1 and the number of bits of the
+    /// address.
+    CompactAddress increasePrefix(const uint8_t len) const {
+        const unsigned shift = getBits() - len;
+        CompactAddress next(*this);
+        if (shift < 64) {
+            next.lo_ += (static_cast<uint64_t>(1) << shift);
+            next.hi_ += (next.lo_ < lo_);
+        } else {
+            next.hi_ += (static_cast<uint64_t>(1) << (shift - 64));
+        }
+        if (!v6_) {
+            next.lo_ &= 0xffffffff;
+        }
+        return (next);
+    }
+
+    /// @brief Compares two addresses for equality.
+    bool operator==(const CompactAddress& other) const {
+        return (((hi_ ^ other.hi_) | (lo_ ^ other.lo_) |
+                 static_cast<uint64_t>(v6_ ^ other.v6_)) == 0);
+    }
+
+    /// @brief Compares two addresses for inequality.
+    bool operator!=(const CompactAddress& other) const {
+        return (!(*this == other));
+    }
+
+    /// @brief Checks if the address precedes the other address.
+    bool operator<(const CompactAddress& other) const {
+        return ((v6_ < other.v6_) |
+                ((v6_ == other.v6_) &
+                 ((hi_ < other.hi_) |
+                  ((hi_ == other.hi_) & (lo_ < other.lo_)))));
+    }
+
+    /// @brief Checks if the address precedes or is equal to the other address.
+    bool operator<=(const CompactAddress& other) const {
+        return (!(other < *this));
+    }
+
+    /// @brief Returns the hash of the address.
+    size_t hash() const {
+        // Multiply-xorshift mixing of both halves.
+        uint64_t h = (hi_ * 0x9e3779b97f4a7c15ULL) ^ lo_ ^
+            (static_cast<uint64_t>(v6_) << 63);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return (static_cast<size_t>(h));
+    }
+
+private:
+
+    /// @brief Computes the mask of the bits above the specified position.
+    ///
+    /// @param shift Number of the least significant bits left out of
+    /// the mask, up to 128.
+    /// @param [out] mask_hi Mask of the most significant half.
+    /// @param [out] mask_lo Mask of the least significant half.
+    static void maskAbove(const unsigned shift, uint64_t& mask_hi,
+                          uint64_t& mask_lo) {
+        const uint64_t ones = ~static_cast<uint64_t>(0);
+        mask_lo = (shift >= 64) ? 0 : (ones << shift);
+        mask_hi = (shift <= 64) ? ones :
+            ((shift >= 128) ? 0 : (ones << (shift - 64)));
+    }
+
+    /// @brief Most significant half of the address.
+    uint64_t hi_;
+
+    /// @brief Least significant half of the address.
+    uint64_t lo_;
+
+    /// @brief Family tag: 0 for IPv4, 1 for IPv6.
+    uint8_t v6_;
+};
+
+/// @brief Inserts the textual form of the address into a stream.
+///
+/// @param os Output stream.
+/// @param address Address.
+/// @return Output stream.
+std::ostream&
+operator<<(std::ostream& os, const CompactAddress& address);
+
+/// @brief Hash function for the unordered containers.
+///
+/// @param address Address.
+/// @return Hash of the address.
+inline size_t
+hash_value(const CompactAddress& address) {
+    return (address.hash());
+}
+
+}  // namespace asiolink
+}  // namespace isc
+
+#endif  // COMPACT_ADDRESS_H
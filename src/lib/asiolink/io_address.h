@@ -350,6 +350,9 @@ public:
     //@}
 
 private:
+    /// The @c CompactAddress converts the address without allocating memory.
+    friend class CompactAddress;
+
     boost::asio::ip::address asio_address_;
     uint8_t offset_;
     uint8_t psid_len_;
@@ -0,0 +1,144 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <asiolink/compact_address.h>
+
+#include <gtest/gtest.h>
+
+#include <boost/functional/hash.hpp>
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+using namespace isc::asiolink;
+
+namespace {
+
+/// @brief Addresses used in the tests, in the ascending order.
+const char* ADDRESSES[] = {
+    "0.0.0.0", "10.0.0.1", "192.0.2.255", "255.255.255.255",
+    "::", "::1", "::ffff:ffff:ffff:ffff", "2001:db8::1",
+    "2001:db8:0:1::", "fe80::1", "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"
+};
+
+// Verifies the conversions from and to the IOAddress.
+TEST(CompactAddressTest, conversions) {
+    for (auto const& text : ADDRESSES) {
+        IOAddress address(text);
+        CompactAddress compact(address);
+        EXPECT_EQ(address.isV4(), compact.isV4()) << text;
+        EXPECT_EQ(address.isV6(), compact.isV6()) << text;
+        EXPECT_EQ(address.getFamily(), compact.getFamily()) << text;
+        EXPECT_EQ(address, compact.toIOAddress()) << text;
+        EXPECT_EQ(address.toText(), compact.toText()) << text;
+    }
+
+    EXPECT_EQ("192.0.2.1", CompactAddress(0xc0000201).toText());
+    EXPECT_EQ(0xc0000201, CompactAddress(IOAddress("192.0.2.1")).getLow());
+    EXPECT_EQ(0x20010db800000000ULL,
+              CompactAddress(IOAddress("2001:db8::1")).getHigh());
+    EXPECT_EQ(1, CompactAddress(IOAddress("2001:db8::1")).getLow());
+}
+
+// Verifies that the addresses are ordered the way the IOAddress orders them.
+TEST(CompactAddressTest, compare) {
+    const size_t count = sizeof(ADDRESSES) / sizeof(ADDRESSES[0]);
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t j = 0; j < count; ++j) {
+            IOAddress a(ADDRESSES[i]);
+            IOAddress b(ADDRESSES[j]);
+            CompactAddress ca(a);
+            CompactAddress cb(b);
+            EXPECT_EQ(i < j, ca < cb) << a << " " << b;
+            EXPECT_EQ(a < b, ca < cb) << a << " " << b;
+            EXPECT_EQ(a <= b, ca <= cb) << a << " " << b;
+            EXPECT_EQ(a == b, ca == cb) << a << " " << b;
+            EXPECT_EQ(a != b, ca != cb) << a << " " << b;
+        }
+    }
+
+    // The IPv4 address is not equal to the IPv6 address with the same bits.
+    EXPECT_NE(CompactAddress(IOAddress("0.0.0.1")), CompactAddress(IOAddress("::1")));
+}
+
+// Verifies the hashing.
+TEST(CompactAddressTest, hash) {
+    std::unordered_set<CompactAddress, boost::hash<CompactAddress>> set;
+    for (auto const& text : ADDRESSES) {
+        EXPECT_TRUE(set.insert(CompactAddress(IOAddress(text))).second) << text;
+    }
+    EXPECT_FALSE(set.insert(CompactAddress(IOAddress("2001:db8::1"))).second);
+    EXPECT_EQ(CompactAddress(IOAddress("2001:db8::1")).hash(),
+              CompactAddress(IOAddress("2001:db8::1")).hash());
+}
+
+// Verifies the prefix checks.
+TEST(CompactAddressTest, inPrefix) {
+    CompactAddress v4(IOAddress("192.0.2.77"));
+    EXPECT_TRUE(v4.inPrefix(IOAddress("192.0.2.0"), 24));
+    EXPECT_TRUE(v4.inPrefix(IOAddress("192.0.2.64"), 26));
+    EXPECT_FALSE(v4.inPrefix(IOAddress("192.0.2.0"), 26));
+    EXPECT_TRUE(v4.inPrefix(IOAddress("192.0.2.77"), 32));
+    EXPECT_TRUE(v4.inPrefix(IOAddress("0.0.0.0"), 0));
+    EXPECT_FALSE(v4.inPrefix(IOAddress("::"), 0));
+
+    CompactAddress v6(IOAddress("2001:db8:1:2:3::1"));
+    EXPECT_TRUE(v6.inPrefix(IOAddress("2001:db8::"), 32));
+    EXPECT_TRUE(v6.inPrefix(IOAddress("2001:db8:1:2::"), 64));
+    EXPECT_FALSE(v6.inPrefix(IOAddress("2001:db8:1:3::"), 64));
+    EXPECT_TRUE(v6.inPrefix(IOAddress("2001:db8:1:2:3::"), 80));
+    EXPECT_FALSE(v6.inPrefix(IOAddress("2001:db8:1:2:3::"), 128));
+    EXPECT_TRUE(v6.inPrefix(IOAddress("2001:db8:1:2:3::1"), 128));
+    EXPECT_TRUE(v6.inPrefix(IOAddress("::"), 0));
+    EXPECT_FALSE(v6.inPrefix(IOAddress("0.0.0.0"), 0));
+}
+
+// Verifies the range checks.
+TEST(CompactAddressTest, inRange) {
+    CompactAddress first(IOAddress("192.0.2.10"));
+    CompactAddress last(IOAddress("192.0.2.20"));
+    EXPECT_FALSE(CompactAddress(IOAddress("192.0.2.9")).inRange(first, last));
+    EXPECT_TRUE(CompactAddress(IOAddress("192.0.2.10")).inRange(first, last));
+    EXPECT_TRUE(CompactAddress(IOAddress("192.0.2.20")).inRange(first, last));
+    EXPECT_FALSE(CompactAddress(IOAddress("192.0.2.21")).inRange(first, last));
+    EXPECT_FALSE(CompactAddress(IOAddress("::c000:20f")).inRange(first, last));
+}
+
+// Verifies that the addresses and the prefixes are increased with carry.
+TEST(CompactAddressTest, increase) {
+    for (auto const& text : ADDRESSES) {
+        IOAddress address(text);
+        EXPECT_EQ(IOAddress::increase(address),
+                  CompactAddress(address).increase().toIOAddress()) << text;
+    }
+
+    EXPECT_EQ("0.0.0.0", CompactAddress(IOAddress("255.255.255.255")).increase().toText());
+    EXPECT_EQ("2001:db8:0:1::",
+              CompactAddress(IOAddress("2001:db8::ffff:ffff:ffff:ffff")).increase().toText());
+    EXPECT_EQ("2001:db8::1:0",
+              CompactAddress(IOAddress("2001:db8::ff00")).increasePrefix(120).toText());
+    EXPECT_EQ("2001:db8:1::",
+              CompactAddress(IOAddress("2001:db8:0:ffff::")).increasePrefix(64).toText());
+    EXPECT_EQ("2001:db9::",
+              CompactAddress(IOAddress("2001:db8::")).increasePrefix(32).toText());
+    EXPECT_EQ("::", CompactAddress(IOAddress("ffff::")).increasePrefix(16).toText());
+}
+
+}  // namespace
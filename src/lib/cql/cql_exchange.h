@@ -30,6 +30,7 @@
 
 #include <any>
 #include <chrono>
+#include <exception>
 #include <mutex>
 #include <set>
 #include <string>
@@ -44,7 +45,7 @@ static size_t constexpr MAJOR = 0;
 static size_t constexpr MINOR = 1;
 
 /// @brief Define CQL schema version: 7.0
-VersionTuple constexpr CQL_SCHEMA_VERSION = std::make_tuple(7, 0);
+VersionTuple constexpr CQL_SCHEMA_VERSION = std::make_tuple(9, 0);
 
 struct OperationalVersionTuple : VersionTuple {};
 
@@ -779,6 +780,230 @@ struct CqlExchange : DatabaseExchange {
         }
     }
 
+    /// @brief Executes a mutation for several sets of bound values.
+    ///
+    /// All statements are sent before waiting for any of the results, so
+    /// the round trips to the cluster overlap. Conditional statements
+    /// (IF NOT EXISTS) can't be grouped in a BATCH spanning multiple
+    /// partitions, hence this is used instead of a batch. Statements that
+    /// fail are retried one by one with @ref executeMutation. All the
+    /// statements sent are waited for before an error is thrown.
+    ///
+    /// @param connection connection used to communicate with the Cassandra
+    ///     database
+    /// @param assigned_values arrays of bound objects, one per statement
+    /// @param statement_tag prepared statement being executed
+    ///
+    /// @return flags indicating which statements have been applied
+    ///
+    /// @throw DbOperationError
+    std::vector<bool> executeMutations(CqlConnection const& connection,
+                                       std::vector<AnyArray> const& assigned_values,
+                                       StatementTag statement_tag) {
+        CqlTaggedStatement const& tagged_statement(connection.statements_.at(statement_tag));
+
+        std::vector<CassStatementPtr> statements;
+        std::vector<CassFuturePtr> futures;
+        statements.reserve(assigned_values.size());
+        futures.reserve(assigned_values.size());
+
+        try {
+            for (AnyArray const& values : assigned_values) {
+                CassStatementPtr statement(
+                    MakePtr(cass_prepared_bind(tagged_statement.prepared_statement_.get())));
+                if (!statement) {
+                    isc_throw(DbOperationError, PRETTY_METHOD_NAME()
+                                                    << ": unable to bind statement "
+                                                    << tagged_statement.name_);
+                }
+                if (connection.force_consistency_) {
+                    CassError rc(cass_statement_set_consistency(statement.get(),
+                                                                connection.consistency_));
+                    if (rc != CASS_OK) {
+                        isc_throw(DbOperationError,
+                                  PRETTY_METHOD_NAME() + ": unable to set"
+                                                         " statement consistency for statement "
+                                      << tagged_statement.name_
+                                      << ", Cassandra error code: " << cass_error_desc(rc));
+                    }
+                }
+                try {
+                    CqlCommon::bindData(values, statement);
+                } catch (std::exception const& ex) {
+                    isc_throw(DbOperationError, ex.what());
+                }
+#ifdef TERASTREAM_FULL_TRANSACTIONS
+                cass_statement_add_key_index(statement.get(), values.size() - 1);
+#endif  // TERASTREAM_FULL_TRANSACTIONS
+                futures.push_back(
+                    MakePtr(cass_session_execute(connection.session_.get(), statement.get())));
+                statements.push_back(std::move(statement));
+            }
+        } catch (...) {
+            // Do not leave statements running in the background.
+            waitAll(futures);
+            throw;
+        }
+
+        std::vector<bool> applied(assigned_values.size(), false);
+        std::exception_ptr error;
+        for (size_t i = 0; i < futures.size(); ++i) {
+            if (futures[i]) {
+                cass_future_wait(futures[i].get());
+            }
+            if (error) {
+                // Only wait for the remaining statements.
+                continue;
+            }
+            if (!futures[i] || (cass_future_error_code(futures[i].get()) != CASS_OK)) {
+                try {
+                    executeMutation(connection, assigned_values[i], statement_tag);
+                    applied[i] = true;
+                } catch (StatementNotApplied const&) {
+                } catch (TransactionException const&) {
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                continue;
+            }
+            applied[i] = statementApplied(futures[i]);
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        return applied;
+    }
+
+    /// @brief Executes a select statement for several sets of bound values.
+    ///
+    /// The counterpart of @ref executeMutations for selects: all statements
+    /// are sent before waiting for any of the results. Statements that fail
+    /// are retried one by one with @ref executeSelect. All the statements
+    /// sent are waited for before an error is thrown.
+    ///
+    /// @param connection connection used to communicate with the Cassandra
+    ///     database
+    /// @param where_values arrays of bound objects, one per statement
+    /// @param statement_tag prepared statement being executed
+    ///
+    /// @return the records retrieved by all the statements
+    ///
+    /// @throw DbOperationError
+    Collection<T> executeSelects(CqlConnection const& connection,
+                                 std::vector<AnyArray> const& where_values,
+                                 StatementTag statement_tag) {
+        CqlTaggedStatement const& tagged_statement(connection.statements_.at(statement_tag));
+        if (tagged_statement.is_raw_) {
+            isc_throw(DbOperationError, PRETTY_METHOD_NAME() << ": raw statement "
+                                                             << tagged_statement.name_);
+        }
+
+        std::vector<CassStatementPtr> statements;
+        std::vector<CassFuturePtr> futures;
+        statements.reserve(where_values.size());
+        futures.reserve(where_values.size());
+
+        try {
+            for (AnyArray const& values : where_values) {
+                CassStatementPtr statement(
+                    MakePtr(cass_prepared_bind(tagged_statement.prepared_statement_.get())));
+                if (!statement) {
+                    isc_throw(DbOperationError, PRETTY_METHOD_NAME()
+                                                    << ": unable to bind statement "
+                                                    << tagged_statement.name_);
+                }
+                if (connection.force_consistency_) {
+                    CassError rc(cass_statement_set_consistency(statement.get(),
+                                                                connection.consistency_));
+                    if (rc != CASS_OK) {
+                        isc_throw(DbOperationError,
+                                  PRETTY_METHOD_NAME() + ": unable to set consistency"
+                                                         " for statement "
+                                      << tagged_statement.name_
+                                      << ", Cassandra error code: " << cass_error_desc(rc));
+                    }
+                }
+                if (connection.serial_consistency_ != CASS_CONSISTENCY_UNKNOWN) {
+                    CassError rc(cass_statement_set_serial_consistency(
+                        statement.get(), connection.serial_consistency_));
+                    if (rc != CASS_OK) {
+                        isc_throw(DbOperationError,
+                                  PRETTY_METHOD_NAME() + ": unable to set statement "
+                                                         "serial consistency for statement "
+                                      << tagged_statement.name_
+                                      << ", Cassandra error code: " << cass_error_desc(rc));
+                    }
+                }
+                try {
+                    CqlCommon::bindData(values, statement);
+                } catch (std::exception const& ex) {
+                    isc_throw(DbOperationError, ex.what());
+                }
+#ifdef TERASTREAM_FULL_TRANSACTIONS
+                cass_statement_add_key_index(statement.get(), values.size() - 1);
+#endif  // TERASTREAM_FULL_TRANSACTIONS
+                futures.push_back(
+                    MakePtr(cass_session_execute(connection.session_.get(), statement.get())));
+                statements.push_back(std::move(statement));
+            }
+        } catch (...) {
+            // Do not leave statements running in the background.
+            waitAll(futures);
+            throw;
+        }
+
+        Collection<T> collection;
+        std::exception_ptr error;
+        for (size_t i = 0; i < futures.size(); ++i) {
+            if (futures[i]) {
+                cass_future_wait(futures[i].get());
+            }
+            if (error) {
+                // Only wait for the remaining statements.
+                continue;
+            }
+            try {
+                if (!futures[i] || (cass_future_error_code(futures[i].get()) != CASS_OK)) {
+                    Collection<T> const& retried(
+                        executeSelect(connection, where_values[i], statement_tag));
+                    collection.insert(collection.end(), retried.begin(), retried.end());
+                    continue;
+                }
+
+                CassResultPtr const& result_collection(
+                    MakePtr(cass_future_get_result(futures[i].get())));
+                AnyArray return_values;
+                CassIteratorPtr const& rows(
+                    MakePtr(cass_iterator_from_result(result_collection.get())));
+                while (cass_iterator_next(rows.get())) {
+                    CassRow const* row(cass_iterator_get_row(rows.get()));
+                    createBindForSelect(return_values, statement_tag);
+                    CqlCommon::getData(row, return_values);
+                    collection.push_back(retrieve());
+                }
+            } catch (...) {
+                error = std::current_exception();
+            }
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        return collection;
+    }
+
+    /// @brief Waits for all the given statements to complete.
+    ///
+    /// @param futures futures of the statements sent, some may be null
+    static void waitAll(std::vector<CassFuturePtr> const& futures) {
+        for (CassFuturePtr const& future : futures) {
+            if (future) {
+                cass_future_wait(future.get());
+            }
+        }
+    }
+
     /// @brief Check if CQL statement has been applied.
     ///
     /// @param future structure used to wait on statement executions
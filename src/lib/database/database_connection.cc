@@ -173,7 +173,9 @@ DatabaseConnection::toElement(ParameterMap const& params) {
             (keyword == "request-timeout") ||
             (keyword == "tcp-keepalive") ||
             (keyword == "port") ||
-            (keyword == "max-row-errors")) {
+            (keyword == "max-row-errors") ||
+            (keyword == "fsync-interval") ||
+            (keyword == "lfc-threads")) {
             // integer parameters
             int64_t int_value;
             try {
@@ -185,7 +187,12 @@ DatabaseConnection::toElement(ParameterMap const& params) {
             }
         } else if ((keyword == "persist") ||
                    (keyword == "tcp-nodelay") ||
-                   (keyword == "readonly")) {
+                   (keyword == "readonly") ||
+                   (keyword == "group-commit") ||
+                   (keyword == "wait-for-durability") ||
+                   (keyword == "lfc-snapshot") ||
+                   (keyword == "lease-stats-counters") ||
+                   (keyword == "lease-expiration-buckets")) {
             if (value == "true") {
                 result->set(keyword, isc::data::Element::create(true));
             } else if (value == "false") {
@@ -204,7 +211,8 @@ DatabaseConnection::toElement(ParameterMap const& params) {
                    (keyword == "protocol") ||
                    (keyword == "consistency") ||
                    (keyword == "serial-consistency") ||
-                   (keyword == "keyspace")) {
+                   (keyword == "keyspace") ||
+                   (keyword == "fsync-policy")) {
             result->set(keyword, isc::data::Element::create(value));
         } else {
             LOG_ERROR(database_logger, DATABASE_TO_JSON_ERROR)
@@ -50,13 +50,20 @@ DbAccessParser::parse(std::string& access_string,
     int64_t request_timeout = 0;
     int64_t tcp_keepalive = 0;
     int64_t max_row_errors = 0;
+    int64_t fsync_interval = 0;
+    int64_t lfc_threads = 0;
 
     // 2. Update the copy with the passed keywords.
     for (std::pair<std::string, ElementPtr> param : database_config->mapValue()) {
         try {
             if ((param.first == "persist") ||
                 (param.first == "tcp-nodelay") ||
-                (param.first == "readonly")) {
+                (param.first == "readonly") ||
+                (param.first == "group-commit") ||
+                (param.first == "wait-for-durability") ||
+                (param.first == "lfc-snapshot") ||
+                (param.first == "lease-stats-counters") ||
+                (param.first == "lease-expiration-buckets")) {
                 values_copy[param.first] = (param.second->boolValue() ?
                                             "true" : "false");
 
@@ -105,6 +112,16 @@ DbAccessParser::parse(std::string& access_string,
                 values_copy[param.first] =
                     boost::lexical_cast<std::string>(max_row_errors);
 
+            } else if (param.first == "fsync-interval") {
+                fsync_interval = param.second->intValue();
+                values_copy[param.first] =
+                    boost::lexical_cast<std::string>(fsync_interval);
+
+            } else if (param.first == "lfc-threads") {
+                lfc_threads = param.second->intValue();
+                values_copy[param.first] =
+                    boost::lexical_cast<std::string>(lfc_threads);
+
             } else {
                 // all remaining string parameters
                 // type
@@ -118,6 +135,7 @@ DbAccessParser::parse(std::string& access_string,
                 // protocol
                 // consistency
                 // serial-consistency
+                // fsync-policy
                 values_copy[param.first] = param.second->stringValue();
             }
         } catch (const isc::data::TypeError& ex) {
@@ -235,6 +253,24 @@ DbAccessParser::parse(std::string& access_string,
                   << " (" << value->getPosition() << ")");
     }
 
+    // Check that fsync_interval value makes sense.
+    if ((fsync_interval < 0) ||
+        (fsync_interval > std::numeric_limits<uint32_t>::max())) {
+        ElementPtr value = database_config->get("fsync-interval");
+        isc_throw(DbConfigError, "fsync-interval " << fsync_interval
+                  << " must be in range 0...MAX_UINT32 (4294967295) "
+                  << " (" << value->getPosition() << ")");
+    }
+
+    // Check that lfc_threads value makes sense.
+    if ((lfc_threads < 0) ||
+        (lfc_threads > std::numeric_limits<uint16_t>::max())) {
+        ElementPtr value = database_config->get("lfc-threads");
+        isc_throw(DbConfigError, "lfc-threads " << lfc_threads
+                  << " must be in range 0...MAX_UINT16 (65535) "
+                  << " (" << value->getPosition() << ")");
+    }
+
     // 4. If all is OK, update the stored keyword/value pairs.  We do this by
     // swapping contents - values_copy is destroyed immediately after the
     // operation (when the method exits), so we are not interested in its new
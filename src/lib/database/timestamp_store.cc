@@ -46,6 +46,21 @@ namespace {
 
 static string const timestamp_match("(.*?$)");
 
+/// @brief Splits a line into its table, key and timestamp.
+///
+/// @return false if the line is malformed, true otherwise
+bool splitLine(string const& line, string& table, string& key, string& timestamp) {
+    size_t const first(line.find(' '));
+    size_t const last(line.rfind(' '));
+    if (first == string::npos || first == last) {
+        return false;
+    }
+    table = line.substr(0, first);
+    key = line.substr(first + 1, last - first - 1);
+    timestamp = line.substr(last + 1);
+    return true;
+}
+
 }  // namespace
 
 void TimestampStore::del(string const& table, string const& key) {
@@ -61,8 +76,8 @@ void TimestampStore::del(string const& table, string const& key) {
     istringstream stream(content);
     string line;
     string new_content;
+    regex const r(table + " " + key + " " + timestamp_match);
     while (getline(stream, line)) {
-        regex r(regex(table + " " + key + " " + timestamp_match));
         if (!regex_match(line, r)) {
             new_content += line + "\n";
         }
@@ -84,8 +99,8 @@ timestamp_t TimestampStore::read(string const& table, string const& key) {
     // Check if the line is there.
     istringstream stream(content);
     string line;
+    regex const r(table + " " + key + " " + timestamp_match);
     while (getline(stream, line)) {
-        regex r(regex(table + " " + key + " " + timestamp_match));
         if (regex_match(line, r)) {
             // If it is, replace the timestamp.
             return lexical_cast<timestamp_t>(regex_replace(line, r, "$1$2"));
@@ -109,8 +124,8 @@ void TimestampStore::write(string const& table, string const& key, timestamp_t c
     string new_content;
     bool found(false);
     string new_line(table + " " + key + " " + to_string(timestamp));
+    regex const r(table + " " + key + " " + timestamp_match);
     while (getline(stream, line)) {
-        regex r(regex(table + " " + key + " " + timestamp_match));
         if (!found && regex_match(line, r)) {
             // If it is, replace the timestamp.
             new_content += regex_replace(line, r, new_line);
@@ -130,6 +145,97 @@ void TimestampStore::write(string const& table, string const& key, timestamp_t c
     *config_timestamp_ << new_content;
 }
 
+void TimestampStore::del(string const& table, std::unordered_set<string> const& keys) {
+    if (!config_timestamp_ || keys.empty()) {
+        return;
+    }
+
+    // Read from the file.
+    string content;
+    *config_timestamp_ >> content;
+
+    // Keep the lines of the other keys.
+    istringstream stream(content);
+    string line;
+    string new_content;
+    string line_table, line_key, line_timestamp;
+    while (getline(stream, line)) {
+        if (splitLine(line, line_table, line_key, line_timestamp) && line_table == table &&
+            keys.count(line_key)) {
+            continue;
+        }
+        new_content += line + "\n";
+    }
+
+    // Write back to the file.
+    *config_timestamp_ << new_content;
+}
+
+std::unordered_map<string, timestamp_t> TimestampStore::read(string const& table) {
+    std::unordered_map<string, timestamp_t> timestamps;
+    if (!config_timestamp_) {
+        return timestamps;
+    }
+
+    // Read from file.
+    string content;
+    *config_timestamp_ >> content;
+
+    istringstream stream(content);
+    string line;
+    string line_table, line_key, line_timestamp;
+    while (getline(stream, line)) {
+        if (!splitLine(line, line_table, line_key, line_timestamp) || line_table != table) {
+            continue;
+        }
+        try {
+            // The first line of a key wins, like in the single key read.
+            timestamps.emplace(line_key, lexical_cast<timestamp_t>(line_timestamp));
+        } catch (bad_lexical_cast const&) {
+            // Not a timestamp, same as if the line was not there.
+        }
+    }
+    return timestamps;
+}
+
+void TimestampStore::write(string const& table,
+                           std::unordered_map<string, timestamp_t> const& timestamps) {
+    if (!config_timestamp_ || timestamps.empty()) {
+        return;
+    }
+
+    // Read from the file.
+    string content;
+    *config_timestamp_ >> content;
+
+    // Replace the timestamps of the keys which are there.
+    istringstream stream(content);
+    string line;
+    string new_content;
+    string line_table, line_key, line_timestamp;
+    std::unordered_set<string> found;
+    while (getline(stream, line)) {
+        if (splitLine(line, line_table, line_key, line_timestamp) && line_table == table) {
+            auto const& timestamp(timestamps.find(line_key));
+            if (timestamp != timestamps.end() && found.insert(line_key).second) {
+                new_content += table + " " + line_key + " " + to_string(timestamp->second) + "\n";
+                continue;
+            }
+        }
+        new_content += line + "\n";
+    }
+
+    // Add the others.
+    for (auto const& [key, timestamp] : timestamps) {
+        if (!found.count(key)) {
+            new_content += table + " " + key + " " + to_string(timestamp) + "\n";
+        }
+    }
+
+    // Write back to the file.
+    *config_timestamp_ << new_content;
+}
+
 timestamp_t TimestampStore::generate() {
     mt19937_64 engine(random_device{}());
     uniform_int_distribution<timestamp_t> distribution;
@@ -23,6 +23,8 @@
 #include <memory>
 #include <regex>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace isc {
 namespace db {
@@ -51,6 +53,15 @@ struct TimestampStore {
     timestamp_t read(std::string const& table, std::string const& key);
     void write(std::string const& table, std::string const& key, timestamp_t const& timestamp);
 
+    /// @brief Batch versions of the above which go through the file once for
+    ///     all the keys instead of once per key.
+    /// @{
+    void del(std::string const& table, std::unordered_set<std::string> const& keys);
+    std::unordered_map<std::string, timestamp_t> read(std::string const& table);
+    void write(std::string const& table,
+               std::unordered_map<std::string, timestamp_t> const& timestamps);
+    /// @}
+
     static timestamp_t generate();
     static timestamp_t now();
 
@@ -25,6 +25,7 @@
 
 #include <limits>
 #include <list>
+#include <memory>
 
 using namespace std;
 using namespace isc::dhcp;
@@ -53,6 +54,27 @@ const OptionDefParamsEncapsulation OPTION_DEF_PARAMS[] = {
     { NULL,                                 0,                                       ""                          }
 };
 
+/// @brief Committed option definitions created in runtime.
+///
+/// The pointer is only replaced using atomic operations on the shared
+/// pointer, because it is read by the packet processing threads.
+std::shared_ptr<OptionDefSpaceContainer>
+runtime_option_defs(new OptionDefSpaceContainer());
+
+/// @brief Option definitions created in runtime by the calling thread and
+/// not committed yet, null if there are none.
+thread_local std::shared_ptr<OptionDefSpaceContainer> staging_runtime_option_defs;
+
+/// @brief Returns the option definitions created in runtime seen by the
+/// calling thread.
+std::shared_ptr<OptionDefSpaceContainer>
+getRuntimeOptionDefSpaces() {
+    if (staging_runtime_option_defs) {
+        return (staging_runtime_option_defs);
+    }
+    return (std::atomic_load(&runtime_option_defs));
+}
+
 }  // namespace
 
 }  // namespace dhcp
@@ -67,9 +89,6 @@ std::map<unsigned short, Option::Factory*> LibDHCP::v6factories_;
 // Static container with option definitions grouped by option space.
 OptionDefContainers LibDHCP::option_defs_;
 
-// Static container with option definitions created in runtime.
-StagedValue<OptionDefSpaceContainer> LibDHCP::runtime_option_defs_;
-
 // Null container.
 const OptionDefContainerPtr null_option_def_container_(new OptionDefContainer());
 
@@ -179,7 +198,7 @@ LibDHCP::getVendorOptionDef(const Option::Universe u, const uint32_t vendor_id,
 
 OptionDefinitionPtr
 LibDHCP::getRuntimeOptionDef(const std::string& space, const uint16_t code) {
-    OptionDefContainerPtr container = runtime_option_defs_.getValue().getItems(space);
+    OptionDefContainerPtr container = getRuntimeOptionDefSpaces()->getItems(space);
     const OptionDefContainerTypeIndex& index = container->get<1>();
     const OptionDefContainerTypeRange& range = index.equal_range(code);
     if (range.first != range.second) {
@@ -191,7 +210,7 @@ LibDHCP::getRuntimeOptionDef(const std::string& space, const uint16_t code) {
 
 OptionDefinitionPtr
 LibDHCP::getRuntimeOptionDef(const std::string& space, const std::string& name) {
-    OptionDefContainerPtr container = runtime_option_defs_.getValue().getItems(space);
+    OptionDefContainerPtr container = getRuntimeOptionDefSpaces()->getItems(space);
     const OptionDefContainerNameIndex& index = container->get<2>();
     const OptionDefContainerNameRange& range = index.equal_range(name);
     if (range.first != range.second) {
@@ -203,12 +222,12 @@ LibDHCP::getRuntimeOptionDef(const std::string& space, const std::string& name)
 
 OptionDefContainerPtr
 LibDHCP::getRuntimeOptionDefs(const std::string& space) {
-    return (runtime_option_defs_.getValue().getItems(space));
+    return (getRuntimeOptionDefSpaces()->getItems(space));
 }
 
 void
 LibDHCP::setRuntimeOptionDefs(const OptionDefSpaceContainer& defs) {
-    OptionDefSpaceContainer defs_copy;
+    std::shared_ptr<OptionDefSpaceContainer> defs_copy(new OptionDefSpaceContainer());
     std::list<std::string> option_space_names = defs.getOptionSpaceNames();
     for (std::list<std::string>::const_iterator name = option_space_names.begin();
          name != option_space_names.end(); ++name) {
@@ -216,25 +235,30 @@ LibDHCP::setRuntimeOptionDefs(const OptionDefSpaceContainer& defs) {
         for (OptionDefContainer::const_iterator def = container->begin();
              def != container->end(); ++def) {
             OptionDefinitionPtr def_copy(new OptionDefinition(**def));
-            defs_copy.addItem(def_copy, *name);
+            defs_copy->addItem(def_copy, *name);
         }
     }
-    runtime_option_defs_ = defs_copy;
+    staging_runtime_option_defs = defs_copy;
 }
 
 void
 LibDHCP::clearRuntimeOptionDefs() {
-    runtime_option_defs_.reset();
+    staging_runtime_option_defs.reset();
+    std::atomic_store(&runtime_option_defs,
+                      std::shared_ptr<OptionDefSpaceContainer>(new OptionDefSpaceContainer()));
 }
 
 void
 LibDHCP::revertRuntimeOptionDefs() {
-    runtime_option_defs_.revert();
+    staging_runtime_option_defs.reset();
 }
 
 void
 LibDHCP::commitRuntimeOptionDefs() {
-    runtime_option_defs_.commit();
+    if (staging_runtime_option_defs) {
+        std::atomic_store(&runtime_option_defs, staging_runtime_option_defs);
+        staging_runtime_option_defs.reset();
+    }
 }
 
 OptionDefinitionPtr
@@ -13,7 +13,6 @@
 #include <dhcp/pkt4.h>
 #include <dhcp/pkt6.h>
 #include <util/buffer.h>
-#include <util/staged_value.h>
 
 #include <iostream>
 #include <stdint.h>
@@ -338,6 +337,11 @@ public:
     /// in the server configuration. These option definitions should be removed
     /// or replaced with new option definitions upon reconfiguration.
     ///
+    /// The copied definitions are staged for the calling thread, which
+    /// parses the configuration. The other threads, e.g. the packet
+    /// processing threads, use the committed definitions until
+    /// @c commitRuntimeOptionDefs is called.
+    ///
     /// @param defs Const reference to a container holding option definitions
     /// grouped by option spaces.
     static void setRuntimeOptionDefs(const OptionDefSpaceContainer& defs);
@@ -345,10 +349,15 @@ public:
     /// @brief Removes runtime option definitions.
     static void clearRuntimeOptionDefs();
 
-    /// @brief Reverts uncommitted changes to runtime option definitions.
+    /// @brief Reverts runtime option definitions staged by the calling
+    /// thread.
     static void revertRuntimeOptionDefs();
 
-    /// @brief Commits runtime option definitions.
+    /// @brief Commits runtime option definitions staged by the calling
+    /// thread.
+    ///
+    /// The committed definitions are replaced at once and the threads
+    /// looking them up see either the previous or the new ones.
     static void commitRuntimeOptionDefs();
 
     /// @brief Converts option space name to vendor id.
@@ -388,9 +397,6 @@ private:
 
     /// Container that holds option definitions for various option spaces.
     static OptionDefContainers option_defs_;
-
-    /// Container for additional option definitions created in runtime.
-    static util::StagedValue<OptionDefSpaceContainer> runtime_option_defs_;
 };
 
 }
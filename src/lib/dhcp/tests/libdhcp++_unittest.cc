@@ -35,6 +35,7 @@
 
 #include <iostream>
 #include <sstream>
+#include <thread>
 #include <typeinfo>
 
 #include <arpa/inet.h>
@@ -2294,6 +2295,34 @@ TEST_F(LibDhcpTest, setRuntimeOptionDefs) {
     testRuntimeOptionDefs(5, 100, false);
 }
 
+// This test verifies that the runtime option definitions are only seen by
+// the other threads when they are committed.
+TEST_F(LibDhcpTest, commitRuntimeOptionDefs) {
+    OptionDefSpaceContainer defs;
+    createRuntimeOptionDefs(5, 100, defs);
+    ASSERT_NO_THROW(LibDHCP::setRuntimeOptionDefs(defs));
+
+    // The staging thread sees the definitions, the other threads don't.
+    testRuntimeOptionDefs(5, 100, true);
+    std::thread([] { testRuntimeOptionDefs(5, 100, false); }).join();
+
+    // Reverting the definitions doesn't affect the committed ones.
+    ASSERT_NO_THROW(LibDHCP::revertRuntimeOptionDefs());
+    testRuntimeOptionDefs(5, 100, false);
+
+    // Once committed, all the threads see the definitions.
+    ASSERT_NO_THROW(LibDHCP::setRuntimeOptionDefs(defs));
+    ASSERT_NO_THROW(LibDHCP::commitRuntimeOptionDefs());
+    testRuntimeOptionDefs(5, 100, true);
+    std::thread([] { testRuntimeOptionDefs(5, 100, true); }).join();
+
+    // Staging new definitions hides the committed ones only for the
+    // staging thread.
+    ASSERT_NO_THROW(LibDHCP::setRuntimeOptionDefs(OptionDefSpaceContainer()));
+    testRuntimeOptionDefs(5, 100, false);
+    std::thread([] { testRuntimeOptionDefs(5, 100, true); }).join();
+}
+
 // This test verifies the processing of option 43
 TEST_F(LibDhcpTest, option43) {
     // Check shouldDeferOptionUnpack()
@@ -6,6 +6,7 @@
 
 #include <config.h>
 
+#include <asiolink/compact_address.h>
 #include <dhcp/dhcp6.h>
 #include <dhcp/pkt4.h>
 #include <dhcp/pkt6.h>
@@ -23,6 +24,7 @@
 #include <dhcpsrv/network.h>
 #include <dhcpsrv/resource_handler.h>
 #include <dhcpsrv/shared_network.h>
+#include <dhcpsrv/stage_latency.h>
 #include <hooks/callout_handle.h>
 #include <hooks/hooks_manager.h>
 #include <dhcpsrv/callout_handle_store.h>
@@ -36,7 +38,10 @@
 #include <boost/foreach.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
+#include <exception>
 #include <limits>
 #include <sstream>
 #include <stdint.h>
@@ -87,6 +92,48 @@ struct AllocEngineHooks {
 // module is called.
 AllocEngineHooks Hooks;
 
+/// @brief Checks if an expired lease is still stored as it was found.
+///
+/// @param lease Expired lease.
+/// @param expire Expiration time of the lease when it was found.
+/// @return true if the lease stored at the address of the lease has the
+/// same expiration time and has not been reclaimed.
+bool
+isLeaseStillExpired(const Lease4Ptr& lease, const int64_t expire) {
+    Lease4Ptr stored = LeaseMgrFactory::instance().getLease4(lease->addr_);
+    return (stored && !stored->stateExpiredReclaimed() &&
+            (stored->getExpirationTime() == expire));
+}
+
+/// @brief Checks if an expired lease is still stored as it was found.
+///
+/// @param lease Expired lease.
+/// @param expire Expiration time of the lease when it was found.
+/// @return true if the lease stored at the address of the lease has the
+/// same expiration time and has not been reclaimed.
+bool
+isLeaseStillExpired(const Lease6Ptr& lease, const int64_t expire) {
+    Lease6Ptr stored = LeaseMgrFactory::instance().getLease6(lease->type_, lease->addr_);
+    return (stored && !stored->stateExpiredReclaimed() &&
+            (stored->getExpirationTime() == expire));
+}
+
+/// @brief Updates an IPv4 lease in the lease database.
+///
+/// @param lease Lease to update.
+void
+updateStoredLease(const Lease4Ptr& lease) {
+    LeaseMgrFactory::instance().updateLease4(lease);
+}
+
+/// @brief Updates an IPv6 lease in the lease database.
+///
+/// @param lease Lease to update.
+void
+updateStoredLease(const Lease6Ptr& lease) {
+    LeaseMgrFactory::instance().updateLease6(lease);
+}
+
 }  // namespace
 
 namespace isc {
@@ -104,49 +151,14 @@ AllocEngine::IterativeAllocator::increasePrefix(const isc::asiolink::IOAddress&
                   "increase prefix " << prefix << ")");
     }
 
-    // Get a buffer holding an address.
-    const std::vector<uint8_t>& vec = prefix.toBytes();
-
     if (prefix_len < 1 || prefix_len > 128) {
         isc_throw(BadValue, "Cannot increase prefix: invalid prefix length: "
                   << prefix_len);
     }
 
-    uint8_t n_bytes = (prefix_len - 1)/8;
-    uint8_t n_bits = 8 - (prefix_len - n_bytes*8);
-    uint8_t mask = 1 << n_bits;
-
-    // Explanation: n_bytes specifies number of full bytes that are in-prefix.
-    // They can also be used as an offset for the first byte that is not in
-    // prefix. n_bits specifies number of bits on the last byte that is
-    // (often partially) in prefix. For example for a /125 prefix, the values
-    // are 15 and 3, respectively. Mask is a bitmask that has the least
-    // significant bit from the prefix set.
-
-    uint8_t packed[V6ADDRESS_LEN];
-
-    // Copy the address. It must be V6, but we already checked that.
-    std::memcpy(packed, &vec[0], V6ADDRESS_LEN);
-
-    // Can we safely increase only the last byte in prefix without overflow?
-    if (packed[n_bytes] + uint16_t(mask) < 256u) {
-        packed[n_bytes] += mask;
-        return (IOAddress::fromBytes(AF_INET6, packed));
-    }
-
-    // Overflow (done on uint8_t, but the sum is greater than 255)
-    packed[n_bytes] += mask;
-
-    // Deal with the overflow. Start increasing the least significant byte
-    for (int i = n_bytes - 1; i >= 0; --i) {
-        ++packed[i];
-        // If we haven't overflowed (0xff->0x0) the next byte, then we are done
-        if (packed[i] != 0) {
-            break;
-        }
-    }
-
-    return (IOAddress::fromBytes(AF_INET6, packed));
+    // Add one at the last bit of the prefix, with carry to the more
+    // significant bits.
+    return (CompactAddress(prefix).increasePrefix(prefix_len).toIOAddress());
 }
 
 isc::asiolink::IOAddress
@@ -156,7 +168,11 @@ AllocEngine::IterativeAllocator::increaseAddress(const isc::asiolink::IOAddress&
                                                  uint8_t const psid_offset,
                                                  uint8_t const psid_len) {
     if (!prefix) {
-        return (IOAddress::increase(address, psid_offset, psid_len));
+        if (psid_len) {
+            // Iterate over the port sets before moving to the next address.
+            return (IOAddress::increase(address, psid_offset, psid_len));
+        }
+        return (CompactAddress(address).increase().toIOAddress());
     } else {
         return (increasePrefix(address, prefix_len));
     }
@@ -568,6 +584,8 @@ AllocEngine::ClientContext6::getDdnsParams() {
 }
 
 void AllocEngine::findReservation(ClientContext6& ctx) {
+    StageLatencyTimer timer(StageLatency::HOST_LOOKUP);
+
     ctx.hosts_.clear();
 
     // If there is no subnet, there is nothing to do.
@@ -676,6 +694,7 @@ AllocEngine::findGlobalReservation(ClientContext6& ctx) {
 
 Lease6Collection
 AllocEngine::allocateLeases6(ClientContext6& ctx) {
+    StageLatencyTimer timer(StageLatency::LEASE_ALLOCATION);
 
     try {
         if (!ctx.subnet_) {
@@ -1987,6 +2006,8 @@ Lease6Ptr AllocEngine::createLease6(ClientContext6& ctx,
 
 Lease6Collection
 AllocEngine::renewLeases6(ClientContext6& ctx) {
+    StageLatencyTimer timer(StageLatency::LEASE_ALLOCATION);
+
     try {
         if (!ctx.subnet_) {
             isc_throw(InvalidOperation, "Subnet is required for allocation");
@@ -2377,54 +2398,26 @@ AllocEngine::reclaimExpiredLeases6(const size_t max_leases, const uint16_t timeo
         lease_mgr.getExpiredLeases6(leases, max_leases);
     }
 
-    // Do not initialize the callout handle until we know if there are any
-    // lease6_expire callouts installed.
-    CalloutHandlePtr callout_handle;
-    if (!leases.empty() &&
-        HooksManager::calloutsPresent(Hooks.hook_index_lease6_expire_)) {
-        callout_handle = HooksManager::createCalloutHandle();
-    }
-
-    size_t leases_processed = 0;
-    BOOST_FOREACH(Lease6Ptr lease, leases) {
-
-        try {
-            // Reclaim the lease.
-            if (MultiThreadingMgr::instance().getMode()) {
-                // The reclamation is exclusive of packet processing.
-                WriteLockGuard exclusive(rw_mutex_);
-
-                reclaimExpiredLease(lease, remove_lease, callout_handle);
-                ++leases_processed;
-            } else {
-                reclaimExpiredLease(lease, remove_lease, callout_handle);
-                ++leases_processed;
-            }
-
-        } catch (const std::exception& ex) {
-            LOG_ERROR(alloc_engine_logger, ALLOC_ENGINE_V6_LEASE_RECLAMATION_FAILED)
-                .arg(lease->addr_.toText())
-                .arg(ex.what());
-        }
-
-        // Check if we have hit the timeout for running reclamation routine and
-        // return if we have. We're checking it here, because we always want to
-        // allow reclaiming at least one lease.
-        if ((timeout > 0) && (stopwatch.getTotalMilliseconds() >= timeout)) {
-            // Timeout. This will likely mean that we haven't been able to process
-            // all leases we wanted to process. The reclamation pass will be
-            // probably marked as incomplete.
-            if (!incomplete_reclamation) {
-                if (leases_processed < leases.size()) {
-                    incomplete_reclamation = true;
-                }
+    bool timed_out = false;
+    size_t leases_processed =
+        reclaimExpiredLeasesBatch(leases, remove_lease,
+                                  Hooks.hook_index_lease6_expire_, timeout,
+                                  stopwatch, ALLOC_ENGINE_V6_LEASE_RECLAMATION_FAILED,
+                                  timed_out);
+
+    if (timed_out) {
+        // Timeout. This will likely mean that we haven't been able to process
+        // all leases we wanted to process. The reclamation pass will be
+        // probably marked as incomplete.
+        if (!incomplete_reclamation) {
+            if (leases_processed < leases.size()) {
+                incomplete_reclamation = true;
             }
-
-            LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
-                      ALLOC_ENGINE_V6_LEASES_RECLAMATION_TIMEOUT)
-                .arg(timeout);
-            break;
         }
+
+        LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+                  ALLOC_ENGINE_V6_LEASES_RECLAMATION_TIMEOUT)
+            .arg(timeout);
     }
 
     // Stop measuring the time.
@@ -2523,54 +2516,26 @@ AllocEngine::reclaimExpiredLeases4(const size_t max_leases, const uint16_t timeo
         lease_mgr.getExpiredLeases4(leases, max_leases);
     }
 
-    // Do not initialize the callout handle until we know if there are any
-    // lease4_expire callouts installed.
-    CalloutHandlePtr callout_handle;
-    if (!leases.empty() &&
-        HooksManager::calloutsPresent(Hooks.hook_index_lease4_expire_)) {
-        callout_handle = HooksManager::createCalloutHandle();
-    }
-
-    size_t leases_processed = 0;
-    BOOST_FOREACH(Lease4Ptr lease, leases) {
-
-        try {
-            // Reclaim the lease.
-            if (MultiThreadingMgr::instance().getMode()) {
-                // The reclamation is exclusive of packet processing.
-                WriteLockGuard exclusive(rw_mutex_);
-
-                reclaimExpiredLease(lease, remove_lease, callout_handle);
-                ++leases_processed;
-            } else {
-                reclaimExpiredLease(lease, remove_lease, callout_handle);
-                ++leases_processed;
+    bool timed_out = false;
+    size_t leases_processed =
+        reclaimExpiredLeasesBatch(leases, remove_lease,
+                                  Hooks.hook_index_lease4_expire_, timeout,
+                                  stopwatch, ALLOC_ENGINE_V4_LEASE_RECLAMATION_FAILED,
+                                  timed_out);
+
+    if (timed_out) {
+        // Timeout. This will likely mean that we haven't been able to process
+        // all leases we wanted to process. The reclamation pass will be
+        // probably marked as incomplete.
+        if (!incomplete_reclamation) {
+            if (leases_processed < leases.size()) {
+                incomplete_reclamation = true;
             }
-
-        } catch (const std::exception& ex) {
-            LOG_ERROR(alloc_engine_logger, ALLOC_ENGINE_V4_LEASE_RECLAMATION_FAILED)
-                .arg(lease->addr_.toText())
-                .arg(ex.what());
-        }
-
-        // Check if we have hit the timeout for running reclamation routine and
-        // return if we have. We're checking it here, because we always want to
-        // allow reclaiming at least one lease.
-        if ((timeout > 0) && (stopwatch.getTotalMilliseconds() >= timeout)) {
-            // Timeout. This will likely mean that we haven't been able to process
-            // all leases we wanted to process. The reclamation pass will be
-            // probably marked as incomplete.
-            if (!incomplete_reclamation) {
-                if (leases_processed < leases.size()) {
-                    incomplete_reclamation = true;
-                }
-            }
-
-            LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
-                      ALLOC_ENGINE_V4_LEASES_RECLAMATION_TIMEOUT)
-                .arg(timeout);
-            break;
         }
+
+        LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+                  ALLOC_ENGINE_V4_LEASES_RECLAMATION_TIMEOUT)
+            .arg(timeout);
     }
 
     // Stop measuring the time.
@@ -2605,6 +2570,208 @@ AllocEngine::reclaimExpiredLeases4(const size_t max_leases, const uint16_t timeo
     }
 }
 
+template<typename LeaseCollectionType>
+size_t
+AllocEngine::reclaimExpiredLeasesBatch(const LeaseCollectionType& leases,
+                                       const bool remove_lease,
+                                       const int hook_index,
+                                       const uint16_t timeout,
+                                       const util::Stopwatch& stopwatch,
+                                       const isc::log::MessageID& failed_message,
+                                       bool& timed_out) {
+    timed_out = false;
+    if (leases.empty()) {
+        return (0);
+    }
+
+    // Do not initialize the callout handles until we know if there are any
+    // lease expire callouts installed.
+    const bool callouts = HooksManager::calloutsPresent(hook_index);
+    const DbReclaimMode reclaim_mode = (remove_lease ? DB_RECLAIM_REMOVE : DB_RECLAIM_UPDATE);
+
+    // In multi-threading mode the leases are shared out among as many threads
+    // as the packet processing uses.
+    const bool multi_threading = MultiThreadingMgr::instance().getMode();
+    size_t thread_count = 1;
+    if (multi_threading) {
+        thread_count = std::min(std::max(MultiThreadingMgr::instance().getThreadPoolSize(),
+                                         static_cast<size_t>(1)),
+                                leases.size());
+    }
+
+    // Progress of each lease. Bytes rather than bools are used so that the
+    // threads can write them concurrently.
+    enum : uint8_t {
+        PENDING,  // not handled before the timeout
+        FAILED,   // the reclamation failed
+        SKIPPED,  // the callouts have taken responsibility for the lease
+        UPDATE,   // to be set to the expired-reclaimed state
+        REMOVE    // to be removed from the lease database
+    };
+    std::vector<uint8_t> progress(leases.size(), PENDING);
+
+    // Declined leases which the recover callouts let be recovered. Their
+    // statistics are updated by the second stage.
+    std::vector<uint8_t> recovered(leases.size(), false);
+
+    // The expiration times are saved before the callouts get the leases.
+    std::vector<int64_t> expire(leases.size());
+    for (size_t i = 0; i < leases.size(); ++i) {
+        expire[i] = leases[i]->getExpirationTime();
+    }
+
+    std::atomic<size_t> next(0);
+    std::atomic<size_t> leases_processed(0);
+    std::atomic<bool> timeout_hit(false);
+
+    // First stage: the callouts, which run while the packets are processed.
+    auto call_callouts = [&]() {
+        // The callout handle is not shared by the threads.
+        CalloutHandlePtr callout_handle;
+        if (callouts) {
+            callout_handle = HooksManager::createCalloutHandle();
+        }
+
+        for (size_t i = next++; (i < leases.size()) && !timeout_hit; i = next++) {
+            try {
+                if (startLeaseReclamation(leases[i], reclaim_mode, callout_handle)) {
+                    progress[i] = SKIPPED;
+                } else {
+                    // A declined lease is removed unless the recover callouts
+                    // have set the skip flag.
+                    bool remove = remove_lease;
+                    if (leases[i]->state_ == Lease::STATE_DECLINED) {
+                        remove = callRecoverCallouts(leases[i]);
+                        recovered[i] = remove;
+                    }
+                    progress[i] = (remove ? REMOVE : UPDATE);
+                }
+
+            } catch (const std::exception& ex) {
+                progress[i] = FAILED;
+                LOG_ERROR(alloc_engine_logger, failed_message)
+                    .arg(leases[i]->addr_.toText())
+                    .arg(ex.what());
+            }
+
+            // Check if we have hit the timeout for running reclamation routine
+            // and stop taking leases if we have. We're checking it here,
+            // because we always want to allow reclaiming at least one lease.
+            if ((timeout > 0) && (stopwatch.getTotalMilliseconds() >= timeout)) {
+                timeout_hit = true;
+            }
+        }
+    };
+
+    // The name change requests are queued one at a time. The packet
+    // processing, which queues them too, is stopped during the second stage.
+    std::mutex ncr_mutex;
+
+    // Second stage: the DNS removals, the lease database and the statistics,
+    // including the declined addresses ones, for all the leases which went
+    // through the first stage. A lease which packet processing has renewed
+    // or released in the meantime is left as it is.
+    auto reclaim = [&]() {
+        for (size_t i = next++; i < leases.size(); i = next++) {
+            if ((progress[i] == PENDING) || (progress[i] == FAILED)) {
+                continue;
+            }
+            try {
+                if (progress[i] != SKIPPED) {
+                    if (multi_threading && !isLeaseStillExpired(leases[i], expire[i])) {
+                        LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+                                  ALLOC_ENGINE_LEASE_RECLAMATION_CHANGED)
+                            .arg(leases[i]->addr_.toText());
+                        ++leases_processed;
+                        continue;
+                    }
+
+                    if (recovered[i]) {
+                        updateDeclinedStats(leases[i]);
+                    }
+
+                    // Generate removal name change request for D2, if required.
+                    // This will return immediately if the DNS wasn't updated
+                    // when the lease was created.
+                    if (multi_threading) {
+                        std::lock_guard<std::mutex> lock(ncr_mutex);
+                        queueNCR(CHG_REMOVE, leases[i]);
+                    } else {
+                        queueNCR(CHG_REMOVE, leases[i]);
+                    }
+
+                    reclaimLeaseInDatabase<typename LeaseCollectionType::value_type>(
+                        leases[i], progress[i] == REMOVE,
+                        [](const typename LeaseCollectionType::value_type& lease) {
+                            updateStoredLease(lease);
+                        });
+                }
+
+                updateReclaimedLeaseStats(leases[i]);
+                ++leases_processed;
+
+            } catch (const std::exception& ex) {
+                LOG_ERROR(alloc_engine_logger, failed_message)
+                    .arg(leases[i]->addr_.toText())
+                    .arg(ex.what());
+            }
+        }
+    };
+
+    // The pool is resized when the packet thread pool is.
+    if ((thread_count > 1) && (reclamation_pool_.size() != thread_count - 1)) {
+        reclamation_pool_.reset();
+        reclamation_pool_.start(thread_count - 1);
+    }
+
+    // Runs a stage on the threads, the calling thread being one of them.
+    // The first exception thrown by a thread is rethrown once all the
+    // threads are done with the stage, which uses this frame.
+    auto run = [&](const std::function<void()>& stage) {
+        next = 0;
+        std::mutex mutex;
+        std::condition_variable cv;
+        size_t pending = thread_count;
+        std::exception_ptr first_exception;
+        auto run_stage = [&]() {
+            std::exception_ptr exception;
+            try {
+                stage();
+            } catch (...) {
+                exception = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            if (exception && !first_exception) {
+                first_exception = exception;
+            }
+            --pending;
+            cv.notify_all();
+        };
+        for (size_t i = 1; i < thread_count; ++i) {
+            reclamation_pool_.add(
+                std::make_shared<std::function<void()>>(run_stage));
+        }
+        run_stage();
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&]() { return (pending == 0); });
+        if (first_exception) {
+            std::rethrow_exception(first_exception);
+        }
+    };
+
+    run(call_callouts);
+    if (multi_threading) {
+        // Only the changes of the leases are exclusive of packet processing.
+        WriteLockGuard exclusive(rw_mutex_);
+        run(reclaim);
+    } else {
+        run(reclaim);
+    }
+
+    timed_out = timeout_hit;
+    return (leases_processed);
+}
+
 template<typename LeasePtrType>
 void
 AllocEngine::reclaimExpiredLease(const LeasePtrType& lease, const bool remove_lease,
@@ -2630,34 +2797,11 @@ AllocEngine::reclaimExpiredLease(const Lease6Ptr& lease,
                                  const DbReclaimMode& reclaim_mode,
                                  const CalloutHandlePtr& callout_handle) {
 
-    LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
-              ALLOC_ENGINE_V6_LEASE_RECLAIM)
-        .arg(Pkt6::makeLabel(lease->duid_, lease->hwaddr_))
-        .arg(lease->addr_.toText())
-        .arg(static_cast<int>(lease->prefixlen_));
-
     // The skip flag indicates if the callouts have taken responsibility
     // for reclaiming the lease. The callout will set this to true if
     // it reclaims the lease itself. In this case the reclamation routine
     // will not update DNS nor update the database.
-    bool skipped = false;
-    if (callout_handle) {
-
-        // Use the RAII wrapper to make sure that the callout handle state is
-        // reset when this object goes out of scope. All hook points must do
-        // it to prevent possible circular dependency between the callout
-        // handle and its arguments.
-        ScopedCalloutHandleState callout_handle_state(callout_handle);
-
-        callout_handle->deleteAllArguments();
-        callout_handle->setArgument("lease6", lease);
-        callout_handle->setArgument("remove_lease", reclaim_mode == DB_RECLAIM_REMOVE);
-
-        HooksManager::callCallouts(Hooks.hook_index_lease6_expire_,
-                                   *callout_handle);
-
-        skipped = callout_handle->getStatus() == CalloutHandle::NEXT_STEP_SKIP;
-    }
+    bool skipped = startLeaseReclamation(lease, reclaim_mode, callout_handle);
 
     /// DROP status does not make sense here.
     /// Not sure if we need to support every possible status everywhere.
@@ -2694,8 +2838,44 @@ AllocEngine::reclaimExpiredLease(const Lease6Ptr& lease,
         }
     }
 
-    // Update statistics.
+    updateReclaimedLeaseStats(lease);
+}
+
+bool
+AllocEngine::startLeaseReclamation(const Lease6Ptr& lease,
+                                   const DbReclaimMode& reclaim_mode,
+                                   const CalloutHandlePtr& callout_handle) {
 
+    LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+              ALLOC_ENGINE_V6_LEASE_RECLAIM)
+        .arg(Pkt6::makeLabel(lease->duid_, lease->hwaddr_))
+        .arg(lease->addr_.toText())
+        .arg(static_cast<int>(lease->prefixlen_));
+
+    bool skipped = false;
+    if (callout_handle) {
+
+        // Use the RAII wrapper to make sure that the callout handle state is
+        // reset when this object goes out of scope. All hook points must do
+        // it to prevent possible circular dependency between the callout
+        // handle and its arguments.
+        ScopedCalloutHandleState callout_handle_state(callout_handle);
+
+        callout_handle->deleteAllArguments();
+        callout_handle->setArgument("lease6", lease);
+        callout_handle->setArgument("remove_lease", reclaim_mode == DB_RECLAIM_REMOVE);
+
+        HooksManager::callCallouts(Hooks.hook_index_lease6_expire_,
+                                   *callout_handle);
+
+        skipped = callout_handle->getStatus() == CalloutHandle::NEXT_STEP_SKIP;
+    }
+
+    return (skipped);
+}
+
+void
+AllocEngine::updateReclaimedLeaseStats(const Lease6Ptr& lease) {
     // Decrease number of assigned leases.
     if (lease->type_ == Lease::TYPE_NA) {
         // IA_NA
@@ -2728,32 +2908,11 @@ AllocEngine::reclaimExpiredLease(const Lease4Ptr& lease,
                                  const DbReclaimMode& reclaim_mode,
                                  const CalloutHandlePtr& callout_handle) {
 
-    LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
-              ALLOC_ENGINE_V4_LEASE_RECLAIM)
-        .arg(Pkt4::makeLabel(lease->hwaddr_, lease->client_id_))
-        .arg(lease->addr_.toText());
-
     // The skip flag indicates if the callouts have taken responsibility
     // for reclaiming the lease. The callout will set this to true if
     // it reclaims the lease itself. In this case the reclamation routine
     // will not update DNS nor update the database.
-    bool skipped = false;
-    if (callout_handle) {
-
-        // Use the RAII wrapper to make sure that the callout handle state is
-        // reset when this object goes out of scope. All hook points must do
-        // it to prevent possible circular dependency between the callout
-        // handle and its arguments.
-        ScopedCalloutHandleState callout_handle_state(callout_handle);
-
-        callout_handle->setArgument("lease4", lease);
-        callout_handle->setArgument("remove_lease", reclaim_mode == DB_RECLAIM_REMOVE);
-
-        HooksManager::callCallouts(Hooks.hook_index_lease4_expire_,
-                                   *callout_handle);
-
-        skipped = callout_handle->getStatus() == CalloutHandle::NEXT_STEP_SKIP;
-    }
+    bool skipped = startLeaseReclamation(lease, reclaim_mode, callout_handle);
 
     /// DROP status does not make sense here.
     /// Not sure if we need to support every possible status everywhere.
@@ -2790,8 +2949,42 @@ AllocEngine::reclaimExpiredLease(const Lease4Ptr& lease,
         }
     }
 
-    // Update statistics.
+    updateReclaimedLeaseStats(lease);
+}
+
+bool
+AllocEngine::startLeaseReclamation(const Lease4Ptr& lease,
+                                   const DbReclaimMode& reclaim_mode,
+                                   const CalloutHandlePtr& callout_handle) {
+
+    LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+              ALLOC_ENGINE_V4_LEASE_RECLAIM)
+        .arg(Pkt4::makeLabel(lease->hwaddr_, lease->client_id_))
+        .arg(lease->addr_.toText());
+
+    bool skipped = false;
+    if (callout_handle) {
+
+        // Use the RAII wrapper to make sure that the callout handle state is
+        // reset when this object goes out of scope. All hook points must do
+        // it to prevent possible circular dependency between the callout
+        // handle and its arguments.
+        ScopedCalloutHandleState callout_handle_state(callout_handle);
+
+        callout_handle->setArgument("lease4", lease);
+        callout_handle->setArgument("remove_lease", reclaim_mode == DB_RECLAIM_REMOVE);
+
+        HooksManager::callCallouts(Hooks.hook_index_lease4_expire_,
+                                   *callout_handle);
+
+        skipped = callout_handle->getStatus() == CalloutHandle::NEXT_STEP_SKIP;
+    }
+
+    return (skipped);
+}
 
+void
+AllocEngine::updateReclaimedLeaseStats(const Lease4Ptr& lease) {
     // Decrease number of assigned addresses.
     StatsMgr::instance().addValue(StatsMgr::generateName("subnet",
                                                          lease->subnet_id_,
@@ -2836,6 +3029,16 @@ AllocEngine::reclaimDeclined(const Lease4Ptr& lease) {
         return (true);
     }
 
+    if (!callRecoverCallouts(lease)) {
+        return (false);
+    }
+
+    updateDeclinedStats(lease);
+    return (true);
+}
+
+bool
+AllocEngine::callRecoverCallouts(const Lease4Ptr& lease) {
     if (HooksManager::calloutsPresent(Hooks.hook_index_lease4_recover_)) {
         CalloutHandlePtr callout_handle = HooksManager::createCalloutHandle();
 
@@ -2861,6 +3064,11 @@ AllocEngine::reclaimDeclined(const Lease4Ptr& lease) {
         }
     }
 
+    return (true);
+}
+
+void
+AllocEngine::updateDeclinedStats(const Lease4Ptr& lease) {
     LOG_INFO(alloc_engine_logger, ALLOC_ENGINE_V4_DECLINED_RECOVERED)
         .arg(lease->addr_.toText())
         .arg(lease->valid_lft_);
@@ -2881,7 +3089,6 @@ AllocEngine::reclaimDeclined(const Lease4Ptr& lease) {
 
     // Note that we do not touch assigned-addresses counters. Those are
     // modified in whatever code calls this method.
-    return (true);
 }
 
 bool
@@ -2890,6 +3097,16 @@ AllocEngine::reclaimDeclined(const Lease6Ptr& lease) {
         return (true);
     }
 
+    if (!callRecoverCallouts(lease)) {
+        return (false);
+    }
+
+    updateDeclinedStats(lease);
+    return (true);
+}
+
+bool
+AllocEngine::callRecoverCallouts(const Lease6Ptr& lease) {
     if (HooksManager::calloutsPresent(Hooks.hook_index_lease6_recover_)) {
         CalloutHandlePtr callout_handle = HooksManager::createCalloutHandle();
 
@@ -2915,6 +3132,11 @@ AllocEngine::reclaimDeclined(const Lease6Ptr& lease) {
         }
     }
 
+    return (true);
+}
+
+void
+AllocEngine::updateDeclinedStats(const Lease6Ptr& lease) {
     LOG_INFO(alloc_engine_logger, ALLOC_ENGINE_V6_DECLINED_RECOVERED)
         .arg(lease->addr_.toText())
         .arg(lease->valid_lft_);
@@ -2935,8 +3157,6 @@ AllocEngine::reclaimDeclined(const Lease6Ptr& lease) {
 
     // Note that we do not touch assigned-nas counters. Those are
     // modified in whatever code calls this method.
-
-    return (true);
 }
 
 template<typename LeasePtrType>
@@ -3389,6 +3609,8 @@ AllocEngine::ClientContext4::getDdnsParams() {
 
 Lease4Ptr
 AllocEngine::allocateLease4(ClientContext4& ctx) {
+    StageLatencyTimer timer(StageLatency::LEASE_ALLOCATION);
+
     // The NULL pointer indicates that the old lease didn't exist. It may
     // be later set to non NULL value if existing lease is found in the
     // database.
@@ -3433,6 +3655,8 @@ AllocEngine::allocateLease4(ClientContext4& ctx) {
 
 void
 AllocEngine::findReservation(ClientContext4& ctx) {
+    StageLatencyTimer timer(StageLatency::HOST_LOOKUP);
+
     ctx.hosts_.clear();
 
     // If there is no subnet, there is nothing to do.
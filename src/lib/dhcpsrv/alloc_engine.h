@@ -22,8 +22,11 @@
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/srv_config.h>
 #include <hooks/callout_handle.h>
+#include <log/message_types.h>
 #include <util/multi_threading_mgr.h>
 #include <util/readwrite_mutex.h>
+#include <util/stopwatch.h>
+#include <util/thread_pool.h>
 
 #include <boost/noncopyable.hpp>
 
@@ -1215,6 +1218,42 @@ private:
         DB_RECLAIM_LEAVE_UNCHANGED
     };
 
+    /// @brief Reclaims a batch of expired leases.
+    ///
+    /// The reclamation runs in two stages. The first one calls the lease
+    /// expire and recover callouts, until the timeout is hit. The second one
+    /// sends the DNS removals, updates or removes the leases in the lease
+    /// database and updates the statistics, for all the leases which went
+    /// through the first stage.
+    ///
+    /// In multi-threading mode, the leases are shared out among the calling
+    /// thread and the threads of @c reclamation_pool_, as many in total as
+    /// the packet thread pool has, each with its own callout handle. Only the second stage is exclusive of packet processing, and
+    /// it leaves alone the leases which have been renewed or released while
+    /// the callouts were running.
+    ///
+    /// @param leases Leases to reclaim, the ones expiring first at the front.
+    /// @param remove_lease A boolean flag indicating if the leases should be
+    /// removed from the lease database (if true) upon reclamation.
+    /// @param hook_index Index of the lease4_expire or lease6_expire hook
+    /// point.
+    /// @param timeout Maximum amount of time that the reclamation routine
+    /// may take, in milliseconds. The value of 0 means no limit.
+    /// @param stopwatch Stopwatch started with the reclamation routine.
+    /// @param failed_message Message logged when a lease can't be reclaimed.
+    /// @param [out] timed_out Set to true when the timeout has been hit.
+    /// @tparam LeaseCollectionType @c Lease4Collection or
+    /// @c Lease6Collection.
+    /// @return The number of reclaimed leases.
+    template<typename LeaseCollectionType>
+    size_t reclaimExpiredLeasesBatch(const LeaseCollectionType& leases,
+                                     const bool remove_lease,
+                                     const int hook_index,
+                                     const uint16_t timeout,
+                                     const util::Stopwatch& stopwatch,
+                                     const isc::log::MessageID& failed_message,
+                                     bool& timed_out);
+
     /// @brief Reclaim DHCPv4 or DHCPv6 lease with updating lease database.
     ///
     /// This method is called by the lease reclamation routine to reclaim the
@@ -1273,6 +1312,46 @@ private:
                              const DbReclaimMode& reclaim_mode,
                              const hooks::CalloutHandlePtr& callout_handle);
 
+    /// @brief Starts the reclamation of a DHCPv4 lease.
+    ///
+    /// Logs the reclamation and calls the lease4_expire callouts.
+    ///
+    /// @param lease Pointer to the DHCPv4 lease.
+    /// @param reclaim_mode Indicates what the reclamation does with the
+    /// lease in the lease database.
+    /// @param callout_handle Pointer to the callout handle, null when there
+    /// are no callouts.
+    /// @return true if the callouts have set the skip flag, i.e. taken
+    /// responsibility for the reclamation of the lease.
+    bool startLeaseReclamation(const Lease4Ptr& lease,
+                               const DbReclaimMode& reclaim_mode,
+                               const hooks::CalloutHandlePtr& callout_handle);
+
+    /// @brief Starts the reclamation of a DHCPv6 lease.
+    ///
+    /// Logs the reclamation and calls the lease6_expire callouts.
+    ///
+    /// @param lease Pointer to the DHCPv6 lease.
+    /// @param reclaim_mode Indicates what the reclamation does with the
+    /// lease in the lease database.
+    /// @param callout_handle Pointer to the callout handle, null when there
+    /// are no callouts.
+    /// @return true if the callouts have set the skip flag, i.e. taken
+    /// responsibility for the reclamation of the lease.
+    bool startLeaseReclamation(const Lease6Ptr& lease,
+                               const DbReclaimMode& reclaim_mode,
+                               const hooks::CalloutHandlePtr& callout_handle);
+
+    /// @brief Updates the statistics of a reclaimed DHCPv4 lease.
+    ///
+    /// @param lease Pointer to the DHCPv4 lease.
+    void updateReclaimedLeaseStats(const Lease4Ptr& lease);
+
+    /// @brief Updates the statistics of a reclaimed DHCPv6 lease.
+    ///
+    /// @param lease Pointer to the DHCPv6 lease.
+    void updateReclaimedLeaseStats(const Lease6Ptr& lease);
+
     /// @brief Marks lease as reclaimed in the database.
     ///
     /// This method is called internally by the leases reclamation routines.
@@ -1311,6 +1390,20 @@ private:
     ///         to keep it)
     bool reclaimDeclined(const Lease4Ptr& lease);
 
+    /// @brief Calls the lease4_recover callouts for a declined lease.
+    ///
+    /// @param lease Declined lease being reclaimed.
+    ///
+    /// @return true if it's ok to remove the lease (false = hooks status says
+    ///         to keep it)
+    bool callRecoverCallouts(const Lease4Ptr& lease);
+
+    /// @brief Logs the recovery of a declined lease and updates the
+    /// declined addresses statistics.
+    ///
+    /// @param lease Declined lease being reclaimed.
+    void updateDeclinedStats(const Lease4Ptr& lease);
+
     /// @anchor reclaimDeclinedLease6
     /// @brief Conducts steps necessary for reclaiming declined IPv6 lease.
     ///
@@ -1325,6 +1418,20 @@ private:
     ///         to keep it)
     bool reclaimDeclined(const Lease6Ptr& lease);
 
+    /// @brief Calls the lease6_recover callouts for a declined lease.
+    ///
+    /// @param lease Declined lease being reclaimed.
+    ///
+    /// @return true if it's ok to remove the lease (false = hooks status says
+    ///         to keep it)
+    bool callRecoverCallouts(const Lease6Ptr& lease);
+
+    /// @brief Logs the recovery of a declined lease and updates the
+    /// declined addresses statistics.
+    ///
+    /// @param lease Declined lease being reclaimed.
+    void updateDeclinedStats(const Lease6Ptr& lease);
+
 public:
 
     /// @brief Context information for the DHCPv4 lease allocation.
@@ -1891,6 +1998,10 @@ private:
     /// which there are still expired leases in the database.
     uint16_t incomplete_v6_reclamations_;
 
+    /// @brief Threads helping the calling thread to reclaim the batches of
+    /// expired leases in multi-threading mode, started on first use.
+    util::ThreadPool<std::function<void()>> reclamation_pool_;
+
 #ifdef TERASTREAM
     void removeNonmatchingPoolLeases6(ClientContext6& ctx, Lease6Collection& existing_leases);
     template<typename ContextType, typename LeaseCollection, typename LeasePtrType>
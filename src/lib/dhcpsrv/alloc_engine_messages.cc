@@ -8,6 +8,7 @@ namespace isc {
 namespace dhcp {
 
 extern const isc::log::MessageID ALLOC_ENGINE_LEASE_RECLAIMED = "ALLOC_ENGINE_LEASE_RECLAIMED";
+extern const isc::log::MessageID ALLOC_ENGINE_LEASE_RECLAMATION_CHANGED = "ALLOC_ENGINE_LEASE_RECLAMATION_CHANGED";
 extern const isc::log::MessageID ALLOC_ENGINE_REMOVAL_NCR_FAILED = "ALLOC_ENGINE_REMOVAL_NCR_FAILED";
 extern const isc::log::MessageID ALLOC_ENGINE_TRANSACTION_FAILED = "ALLOC_ENGINE_TRANSACTION_FAILED";
 extern const isc::log::MessageID ALLOC_ENGINE_V4_ALLOC_ERROR = "ALLOC_ENGINE_V4_ALLOC_ERROR";
@@ -81,6 +82,7 @@ namespace {
 
 const char* values[] = {
     "ALLOC_ENGINE_LEASE_RECLAIMED", "successfully reclaimed lease %1",
+    "ALLOC_ENGINE_LEASE_RECLAMATION_CHANGED", "lease %1 has changed while it was being reclaimed, it is left as it is",
     "ALLOC_ENGINE_REMOVAL_NCR_FAILED", "sending removal name change request failed for lease %1: %2",
     "ALLOC_ENGINE_TRANSACTION_FAILED", "transaction failed. error: %1",
     "ALLOC_ENGINE_V4_ALLOC_ERROR", "%1: error during attempt to allocate an IPv4 address: %2",
@@ -9,6 +9,7 @@ namespace isc {
 namespace dhcp {
 
 extern const isc::log::MessageID ALLOC_ENGINE_LEASE_RECLAIMED;
+extern const isc::log::MessageID ALLOC_ENGINE_LEASE_RECLAMATION_CHANGED;
 extern const isc::log::MessageID ALLOC_ENGINE_REMOVAL_NCR_FAILED;
 extern const isc::log::MessageID ALLOC_ENGINE_TRANSACTION_FAILED;
 extern const isc::log::MessageID ALLOC_ENGINE_V4_ALLOC_ERROR;
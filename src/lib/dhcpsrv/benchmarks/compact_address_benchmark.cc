@@ -0,0 +1,325 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <asiolink/addr_utilities.h>
+#include <asiolink/compact_address.h>
+#include <asiolink/io_address.h>
+#include <dhcpsrv/benchmarks/parameters.h>
+#include <dhcpsrv/memfile_lease_storage.h>
+
+#include <benchmark/benchmark.h>
+
+#include <boost/functional/hash.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index_container.hpp>
+
+#include <random>
+#include <vector>
+
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::dhcp::bench;
+
+namespace {
+
+/// @brief A minimum number of leases in the containers.
+constexpr size_t MIN_ADDRESS_COUNT = 65536;
+
+/// @brief A maximum number of leases in the containers.
+constexpr size_t MAX_ADDRESS_COUNT = 1000000;
+
+/// @brief A number of operations in a benchmark iteration.
+constexpr size_t OPERATION_COUNT = 4096;
+
+/// @brief Key extractor returning the lease address in the compact form.
+struct CompactAddressKey {
+    typedef CompactAddress result_type;
+
+    CompactAddress operator()(const LeasePtr& lease) const {
+        return (CompactAddress(lease->addr_));
+    }
+};
+
+/// @brief Lease container with the address index only.
+typedef boost::multi_index_container<
+    LeasePtr,
+    boost::multi_index::indexed_by<
+        boost::multi_index::ordered_unique<
+            boost::multi_index::member<Lease, IOAddress, &Lease::addr_>
+        >
+    >
+> AddressLeaseStorage;
+
+/// @brief Lease container with the address index only, keyed by the
+/// compact form of the address.
+typedef boost::multi_index_container<
+    LeasePtr,
+    boost::multi_index::indexed_by<
+        boost::multi_index::ordered_unique<CompactAddressKey>
+    >
+> CompactLeaseStorage;
+
+/// @brief Fixture comparing the @c IOAddress with the @c CompactAddress.
+///
+/// The lookups use the memfile lease storage, @c Lease4Storage or
+/// @c Lease6Storage, holding state.range(0) leases of the family
+/// state.range(1), 4 or 6. The cost of the key alone is measured with
+/// containers having only the address index, keyed by the @c IOAddress
+/// or by the @c CompactAddress. Every benchmark iteration runs
+/// OPERATION_COUNT lookups, increments, prefix checks or hashes.
+class CompactAddressBenchmark : public ::benchmark::Fixture {
+public:
+
+    /// @brief Returns the address of the specified lease.
+    ///
+    /// The IPv6 addresses differ in both halves of the 128 bit number.
+    ///
+    /// @param family Address family, 4 or 6.
+    /// @param index Lease index.
+    static IOAddress leaseAddress(const int64_t family, const uint32_t index) {
+        if (family == 4) {
+            return (IOAddress(0x0a000000 + index));
+        }
+        std::vector<uint8_t> bytes = IOAddress("2001:db8::").toBytes();
+        bytes[6] = static_cast<uint8_t>(index >> 24);
+        bytes[7] = static_cast<uint8_t>(index >> 16);
+        bytes[14] = static_cast<uint8_t>(index >> 8);
+        bytes[15] = static_cast<uint8_t>(index);
+        return (IOAddress::fromBytes(AF_INET6, &bytes[0]));
+    }
+
+    /// @brief Creates the addresses looked up in the benchmarks.
+    void SetUp(::benchmark::State const& state) override {
+        const size_t count = state.range(0);
+        std::mt19937 generator(1);
+        std::uniform_int_distribution<uint32_t> distribution(0, count - 1);
+        keys_.clear();
+        compact_keys_.clear();
+        for (size_t i = 0; i < OPERATION_COUNT; ++i) {
+            IOAddress key = leaseAddress(state.range(1), distribution(generator));
+            keys_.push_back(key);
+            compact_keys_.push_back(CompactAddress(key));
+        }
+    }
+
+    void SetUp(::benchmark::State& s) override {
+        ::benchmark::State const& cs = s;
+        SetUp(cs);
+    }
+
+    /// @brief Releases the containers.
+    void TearDown(::benchmark::State const&) override {
+        storage4_.clear();
+        storage6_.clear();
+        address_storage_.clear();
+        compact_storage_.clear();
+    }
+
+    void TearDown(::benchmark::State& s) override {
+        ::benchmark::State const& cs = s;
+        TearDown(cs);
+    }
+
+    /// @brief Creates the lease of the specified index.
+    ///
+    /// @param family Address family, 4 or 6.
+    /// @param index Lease index.
+    static LeasePtr createLease(const int64_t family, const uint32_t index) {
+        if (family == 4) {
+            return (Lease4Ptr(new Lease4(leaseAddress(family, index), HWAddrPtr(),
+                                         ClientIdPtr(), 3600, 0, SubnetID(1))));
+        }
+        static DuidPtr duid(new DUID(std::vector<uint8_t>(8, 0x01)));
+        return (Lease6Ptr(new Lease6(Lease::TYPE_NA, leaseAddress(family, index),
+                                     duid, index, 1800, 3600, SubnetID(1))));
+    }
+
+    /// @brief Fills the memfile lease storage of the family.
+    void createStorage(::benchmark::State& state) {
+        const size_t count = state.range(0);
+        for (size_t i = 0; i < count; ++i) {
+            LeasePtr lease = createLease(state.range(1), i);
+            if (state.range(1) == 4) {
+                storage4_.insert(std::static_pointer_cast<Lease4>(lease));
+            } else {
+                storage6_.insert(std::static_pointer_cast<Lease6>(lease));
+            }
+        }
+    }
+
+    /// @brief Fills the container keyed by the addresses.
+    void createAddressStorage(::benchmark::State& state) {
+        const size_t count = state.range(0);
+        for (size_t i = 0; i < count; ++i) {
+            address_storage_.insert(createLease(state.range(1), i));
+        }
+    }
+
+    /// @brief Fills the container keyed by the compact addresses.
+    void createCompactStorage(::benchmark::State& state) {
+        const size_t count = state.range(0);
+        for (size_t i = 0; i < count; ++i) {
+            compact_storage_.insert(createLease(state.range(1), i));
+        }
+    }
+
+    /// @brief Memfile storage of the IPv4 leases.
+    Lease4Storage storage4_;
+
+    /// @brief Memfile storage of the IPv6 leases.
+    Lease6Storage storage6_;
+
+    /// @brief Leases keyed by their addresses.
+    AddressLeaseStorage address_storage_;
+
+    /// @brief Leases keyed by the compact form of their addresses.
+    CompactLeaseStorage compact_storage_;
+
+    /// @brief Addresses looked up in the benchmarks.
+    std::vector<IOAddress> keys_;
+
+    /// @brief Addresses looked up in the benchmarks in the compact form.
+    std::vector<CompactAddress> compact_keys_;
+};
+
+BENCHMARK_DEFINE_F(CompactAddressBenchmark, lookup)(benchmark::State& state) {
+    createStorage(state);
+    const Lease4StorageAddressIndex& index4 = storage4_.get<AddressIndexTag>();
+    const Lease6StorageAddressIndex& index6 = storage6_.get<AddressIndexTag>();
+    while (state.KeepRunning()) {
+        for (auto const& key : keys_) {
+            if (state.range(1) == 4) {
+                benchmark::DoNotOptimize(index4.find(key));
+            } else {
+                benchmark::DoNotOptimize(index6.find(key));
+            }
+        }
+    }
+}
+
+BENCHMARK_DEFINE_F(CompactAddressBenchmark, lookupAddress)(benchmark::State& state) {
+    createAddressStorage(state);
+    while (state.KeepRunning()) {
+        for (auto const& key : keys_) {
+            benchmark::DoNotOptimize(address_storage_.find(key));
+        }
+    }
+}
+
+BENCHMARK_DEFINE_F(CompactAddressBenchmark, lookupCompact)(benchmark::State& state) {
+    createCompactStorage(state);
+    while (state.KeepRunning()) {
+        for (auto const& key : keys_) {
+            // The memfile lease manager gets the IOAddress to look up.
+            benchmark::DoNotOptimize(compact_storage_.find(CompactAddress(key)));
+        }
+    }
+}
+
+BENCHMARK_DEFINE_F(CompactAddressBenchmark, increase)(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        IOAddress address = keys_[0];
+        for (size_t i = 0; i < OPERATION_COUNT; ++i) {
+            address = IOAddress::increase(address);
+        }
+        benchmark::DoNotOptimize(address);
+    }
+}
+
+BENCHMARK_DEFINE_F(CompactAddressBenchmark, increaseCompact)(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        CompactAddress address = compact_keys_[0];
+        for (size_t i = 0; i < OPERATION_COUNT; ++i) {
+            address = address.increase();
+        }
+        benchmark::DoNotOptimize(address);
+    }
+}
+
+BENCHMARK_DEFINE_F(CompactAddressBenchmark, inPrefix)(benchmark::State& state) {
+    const IOAddress prefix = leaseAddress(state.range(1), 0);
+    const uint8_t len = (state.range(1) == 4 ? 16 : 48);
+    while (state.KeepRunning()) {
+        // This is how the subnets checked the addresses.
+        for (auto const& key : keys_) {
+            IOAddress first = firstAddrInPrefix(prefix, len);
+            IOAddress last = lastAddrInPrefix(prefix, len);
+            benchmark::DoNotOptimize((first <= key) && (key <= last));
+        }
+    }
+}
+
+BENCHMARK_DEFINE_F(CompactAddressBenchmark, inPrefixCompact)(benchmark::State& state) {
+    const CompactAddress prefix(leaseAddress(state.range(1), 0));
+    const uint8_t len = (state.range(1) == 4 ? 16 : 48);
+    while (state.KeepRunning()) {
+        for (auto const& key : compact_keys_) {
+            benchmark::DoNotOptimize(key.inPrefix(prefix, len));
+        }
+    }
+}
+
+BENCHMARK_DEFINE_F(CompactAddressBenchmark, hash)(benchmark::State& state) {
+    boost::hash<IOAddress> hasher;
+    while (state.KeepRunning()) {
+        for (auto const& key : keys_) {
+            benchmark::DoNotOptimize(hasher(key));
+        }
+    }
+}
+
+BENCHMARK_DEFINE_F(CompactAddressBenchmark, hashCompact)(benchmark::State& state) {
+    boost::hash<CompactAddress> hasher;
+    while (state.KeepRunning()) {
+        for (auto const& key : compact_keys_) {
+            benchmark::DoNotOptimize(hasher(key));
+        }
+    }
+}
+
+/// Benchmarks that look leases up by address in containers of 64K and 1M
+/// IPv4 and IPv6 leases.
+BENCHMARK_REGISTER_F(CompactAddressBenchmark, lookup)
+    ->Args({MIN_ADDRESS_COUNT, 4})->Args({MAX_ADDRESS_COUNT, 4})
+    ->Args({MIN_ADDRESS_COUNT, 6})->Args({MAX_ADDRESS_COUNT, 6})
+    ->Unit(UNIT);
+BENCHMARK_REGISTER_F(CompactAddressBenchmark, lookupAddress)
+    ->Args({MIN_ADDRESS_COUNT, 4})->Args({MAX_ADDRESS_COUNT, 4})
+    ->Args({MIN_ADDRESS_COUNT, 6})->Args({MAX_ADDRESS_COUNT, 6})
+    ->Unit(UNIT);
+BENCHMARK_REGISTER_F(CompactAddressBenchmark, lookupCompact)
+    ->Args({MIN_ADDRESS_COUNT, 4})->Args({MAX_ADDRESS_COUNT, 4})
+    ->Args({MIN_ADDRESS_COUNT, 6})->Args({MAX_ADDRESS_COUNT, 6})
+    ->Unit(UNIT);
+
+/// Benchmarks of the operations not depending on the container size.
+BENCHMARK_REGISTER_F(CompactAddressBenchmark, increase)
+    ->Args({MIN_ADDRESS_COUNT, 4})->Args({MIN_ADDRESS_COUNT, 6})->Unit(UNIT);
+BENCHMARK_REGISTER_F(CompactAddressBenchmark, increaseCompact)
+    ->Args({MIN_ADDRESS_COUNT, 4})->Args({MIN_ADDRESS_COUNT, 6})->Unit(UNIT);
+BENCHMARK_REGISTER_F(CompactAddressBenchmark, inPrefix)
+    ->Args({MIN_ADDRESS_COUNT, 4})->Args({MIN_ADDRESS_COUNT, 6})->Unit(UNIT);
+BENCHMARK_REGISTER_F(CompactAddressBenchmark, inPrefixCompact)
+    ->Args({MIN_ADDRESS_COUNT, 4})->Args({MIN_ADDRESS_COUNT, 6})->Unit(UNIT);
+BENCHMARK_REGISTER_F(CompactAddressBenchmark, hash)
+    ->Args({MIN_ADDRESS_COUNT, 4})->Args({MIN_ADDRESS_COUNT, 6})->Unit(UNIT);
+BENCHMARK_REGISTER_F(CompactAddressBenchmark, hashCompact)
+    ->Args({MIN_ADDRESS_COUNT, 4})->Args({MIN_ADDRESS_COUNT, 6})->Unit(UNIT);
+
+}  // namespace
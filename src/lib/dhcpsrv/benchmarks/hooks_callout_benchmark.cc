@@ -0,0 +1,179 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/pkt4.h>
+#include <dhcpsrv/benchmarks/parameters.h>
+#include <dhcpsrv/subnet.h>
+#include <hooks/callout_handle.h>
+#include <hooks/callout_manager.h>
+#include <hooks/server_hooks.h>
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::dhcp::bench;
+using namespace isc::hooks;
+
+namespace {
+
+/// @brief A maximum number of callouts registered on the hook point.
+constexpr int MAX_CALLOUT_COUNT = 3;
+
+/// @brief Name of the hook point used in the benchmarks.
+const char* HOOK_NAME = "benchmark4_select";
+
+/// @brief Callout reading the arguments by name, as the libraries do.
+///
+/// @param handle Callout handle.
+/// @return Always 0.
+int
+calloutReadArguments(CalloutHandle& handle) {
+    Pkt4Ptr query;
+    Subnet4Ptr subnet;
+    handle.getArgument("query4", query);
+    handle.getArgument("subnet4", subnet);
+    benchmark::DoNotOptimize(query);
+    benchmark::DoNotOptimize(subnet);
+    return (0);
+}
+
+/// @brief Fixture measuring the cost of passing arguments to the callouts
+/// of a hook point.
+///
+/// state.range(0) callouts are registered on a hook point declaring the
+/// arguments the subnet4_select hook point passes. The hook point is
+/// called the way the server calls it: the arguments are only set when
+/// there are callouts and they are deleted after the callouts returned.
+class HooksCalloutBenchmark : public ::benchmark::Fixture {
+public:
+
+    /// @brief Registers the hook point and the callouts.
+    void SetUp(::benchmark::State const& state) override {
+        ServerHooks& hooks = ServerHooks::getServerHooks();
+        hook_index_ = hooks.registerHook(HOOK_NAME, { "query4", "subnet4",
+                                                      "subnet4collection" });
+        query4_ = hooks.getArgument<Pkt4Ptr>(hook_index_, "query4");
+        subnet4_ = hooks.getArgument<Subnet4Ptr>(hook_index_, "subnet4");
+        subnet4collection_ = hooks.getArgument<const Subnet4Collection*>(
+            hook_index_, "subnet4collection");
+
+        manager_.reset(new CalloutManager(MAX_CALLOUT_COUNT));
+        for (int i = 0; i < state.range(0); ++i) {
+            manager_->registerCallout(HOOK_NAME, calloutReadArguments, i + 1);
+        }
+        handle_.reset(new CalloutHandle(manager_));
+
+        query_.reset(new Pkt4(DHCPDISCOVER, 1234));
+        subnet_.reset(new Subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 3, 1));
+    }
+
+    void SetUp(::benchmark::State& s) override {
+        ::benchmark::State const& cs = s;
+        SetUp(cs);
+    }
+
+    /// @brief Drops the callouts.
+    void TearDown(::benchmark::State const&) override {
+        handle_.reset();
+        manager_.reset();
+    }
+
+    void TearDown(::benchmark::State& s) override {
+        ::benchmark::State const& cs = s;
+        TearDown(cs);
+    }
+
+    /// @brief Calls the hook point setting the arguments by name.
+    void callByName() {
+        if (manager_->calloutsPresent(hook_index_)) {
+            handle_->setArgument("query4", query_);
+            handle_->setArgument("subnet4", subnet_);
+            handle_->setArgument("subnet4collection",
+                                 static_cast<const Subnet4Collection*>(&subnets_));
+            manager_->callCallouts(hook_index_, *handle_);
+            handle_->getArgument("subnet4", subnet_);
+            handle_->deleteAllArguments();
+        }
+    }
+
+    /// @brief Calls the hook point setting the arguments in their slots.
+    void callBySlot() {
+        if (manager_->calloutsPresent(hook_index_)) {
+            handle_->setArgument(query4_, query_);
+            handle_->setArgument(subnet4_, subnet_);
+            handle_->setArgument(subnet4collection_,
+                                 static_cast<const Subnet4Collection*>(&subnets_));
+            manager_->callCallouts(hook_index_, *handle_);
+            handle_->getArgument(subnet4_, subnet_);
+            handle_->deleteAllArguments();
+        }
+    }
+
+    /// @brief Index of the hook point.
+    int hook_index_;
+
+    /// @brief Slot of the query argument.
+    CalloutArgument<Pkt4Ptr> query4_;
+
+    /// @brief Slot of the subnet argument.
+    CalloutArgument<Subnet4Ptr> subnet4_;
+
+    /// @brief Slot of the subnet collection argument.
+    CalloutArgument<const Subnet4Collection*> subnet4collection_;
+
+    /// @brief Callout manager holding the callouts.
+    std::shared_ptr<CalloutManager> manager_;
+
+    /// @brief Callout handle of the packet.
+    CalloutHandlePtr handle_;
+
+    /// @brief Query passed to the callouts.
+    Pkt4Ptr query_;
+
+    /// @brief Subnet passed to the callouts.
+    Subnet4Ptr subnet_;
+
+    /// @brief Subnet collection passed to the callouts.
+    Subnet4Collection subnets_;
+};
+
+BENCHMARK_DEFINE_F(HooksCalloutBenchmark, callByName)(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        callByName();
+    }
+}
+
+BENCHMARK_DEFINE_F(HooksCalloutBenchmark, callBySlot)(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        callBySlot();
+    }
+}
+
+/// Benchmarks that measure a hook point call with 0, 1 and 3 callouts.
+BENCHMARK_REGISTER_F(HooksCalloutBenchmark, callByName)
+    ->Arg(0)->Arg(1)->Arg(MAX_CALLOUT_COUNT)->Unit(UNIT);
+BENCHMARK_REGISTER_F(HooksCalloutBenchmark, callBySlot)
+    ->Arg(0)->Arg(1)->Arg(MAX_CALLOUT_COUNT)->Unit(UNIT);
+
+}  // namespace
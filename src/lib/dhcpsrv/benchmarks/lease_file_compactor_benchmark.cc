@@ -0,0 +1,161 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/benchmarks/parameters.h>
+#include <dhcpsrv/csv_lease_file4.h>
+#include <dhcpsrv/lease.h>
+#include <dhcpsrv/lease_file_compactor.h>
+#include <dhcpsrv/lease_file_loader.h>
+#include <dhcpsrv/memfile_lease_storage.h>
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::dhcp::bench;
+using namespace std;
+
+namespace {
+
+/// @brief Number of distinct addresses in the generated lease file.
+constexpr uint32_t ADDRESS_COUNT = 0x40000;
+
+/// @brief Number of rows written for every address.
+constexpr uint32_t UPDATES_PER_ADDRESS = 4;
+
+/// @brief Fixture comparing lease file cleanup with the lease file loader
+/// and with the streaming @c LeaseFileCompactor.
+///
+/// The input lease file is generated in every setup: it holds
+/// @c UPDATES_PER_ADDRESS rows for each of @c ADDRESS_COUNT addresses,
+/// interleaved as the server would write them over time.
+class LeaseFileCompactorBenchmark : public ::benchmark::Fixture {
+public:
+
+    /// @brief Constructor.
+    LeaseFileCompactorBenchmark()
+        : input_(string(TEST_DATA_BUILDDIR) + "/leasefile4_bench.csv"),
+          output_(string(TEST_DATA_BUILDDIR) + "/leasefile4_bench.output") {
+    }
+
+    /// @brief Generates the input lease file.
+    ///
+    /// The state parameter is ignored.
+    void SetUp(::benchmark::State const&) override {
+        removeFiles();
+        CSVLeaseFile4 lf(input_);
+        lf.open();
+        vector<uint8_t> hwaddr(6, 0);
+        for (uint32_t update = 0; update < UPDATES_PER_ADDRESS; ++update) {
+            for (uint32_t i = 0; i < ADDRESS_COUNT; ++i) {
+                hwaddr[2] = static_cast<uint8_t>(i >> 16);
+                hwaddr[3] = static_cast<uint8_t>(i >> 8);
+                hwaddr[4] = static_cast<uint8_t>(i);
+                hwaddr[5] = static_cast<uint8_t>(update);
+                HWAddrPtr hw(new HWAddr(hwaddr, HTYPE_ETHER));
+                Lease4 lease(IOAddress(0x0a000000 + i), hw, ClientIdPtr(),
+                             3600, 1000 + update, 1);
+                lf.append(lease);
+            }
+        }
+        lf.close();
+    }
+
+    void SetUp(::benchmark::State& s) override {
+        ::benchmark::State const& cs = s;
+        SetUp(cs);
+    }
+
+    /// @brief Removes the lease files.
+    ///
+    /// The state parameter is ignored.
+    void TearDown(::benchmark::State const&) override {
+        removeFiles();
+    }
+
+    void TearDown(::benchmark::State& s) override {
+        ::benchmark::State const& cs = s;
+        TearDown(cs);
+    }
+
+    /// @brief Removes the input and output files.
+    void removeFiles() const {
+        static_cast<void>(remove(input_.c_str()));
+        static_cast<void>(remove(output_.c_str()));
+    }
+
+    /// @brief Cleans up the input file the way kea-lfc does by default.
+    void loadAndWrite() {
+        Lease4Storage storage;
+        CSVLeaseFile4 lf_input(input_);
+        lf_input.open();
+        LeaseFileLoader::load<Lease4>(lf_input, storage, 0);
+        static_cast<void>(remove(output_.c_str()));
+        CSVLeaseFile4 lf_output(output_);
+        LeaseFileLoader::write<Lease4>(lf_output, storage);
+    }
+
+    /// @brief Cleans up the input file using the compactor.
+    ///
+    /// @param threads Number of threads used by the compactor.
+    void compact(const size_t threads) {
+        static_cast<void>(remove(output_.c_str()));
+        CSVLeaseFile4 lf_output(output_);
+        LeaseFileCompactor<Lease4, CSVLeaseFile4> compactor(threads);
+        compactor.compact({ input_ }, lf_output);
+    }
+
+    /// @brief Name of the input lease file.
+    string input_;
+
+    /// @brief Name of the output lease file.
+    string output_;
+};
+
+BENCHMARK_DEFINE_F(LeaseFileCompactorBenchmark, loadAndWrite4)(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        loadAndWrite();
+    }
+}
+
+BENCHMARK_DEFINE_F(LeaseFileCompactorBenchmark, compact4)(benchmark::State& state) {
+    const size_t threads = state.range(0);
+    while (state.KeepRunning()) {
+        compact(threads);
+    }
+}
+
+/// A benchmark that measures the cleanup of an IPv4 lease file by the lease
+/// file loader.
+BENCHMARK_REGISTER_F(LeaseFileCompactorBenchmark, loadAndWrite4)
+    ->Unit(UNIT);
+
+/// A benchmark that measures the cleanup of an IPv4 lease file by the
+/// compactor, for 1 to 8 threads.
+BENCHMARK_REGISTER_F(LeaseFileCompactorBenchmark, compact4)
+    ->RangeMultiplier(2)->Range(1, 8)
+    ->Unit(UNIT);
+
+}  // namespace
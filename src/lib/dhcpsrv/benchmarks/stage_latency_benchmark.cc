@@ -0,0 +1,70 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <dhcpsrv/stage_latency.h>
+
+#include <benchmark/benchmark.h>
+
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Times an empty stage.
+///
+/// Every benchmark iteration runs one timer, so the results are the cost
+/// of the timing of a stage, to multiply by the number of timed stages of
+/// a query (about 8) and compare with the processing time of a query.
+///
+/// @param state Benchmark state.
+/// @param enabled Whether the timing is enabled.
+void
+benchTimer(benchmark::State& state, const bool enabled) {
+    if (state.thread_index() == 0) {
+        StageLatency::reset();
+        StageLatency::setEnabled(enabled);
+    }
+    for (auto _ : state) {
+        StageLatencyTimer timer(StageLatency::CLASSIFY);
+        benchmark::ClobberMemory();
+    }
+    if (state.thread_index() == 0) {
+        StageLatency::setEnabled(false);
+    }
+}
+
+/// @brief The cost of a timer when the timing is disabled.
+void
+timerDisabled(benchmark::State& state) {
+    benchTimer(state, false);
+}
+
+/// @brief The cost of a timer when the timing is enabled.
+void
+timerEnabled(benchmark::State& state) {
+    benchTimer(state, true);
+}
+
+/// The timer with the timing disabled, which only reads the flag.
+BENCHMARK(timerDisabled)->ThreadRange(1, 8)->Unit(benchmark::kNanosecond);
+
+/// The timer with the timing enabled, which reads the clock twice and
+/// records in the histogram of the thread.
+BENCHMARK(timerEnabled)->ThreadRange(1, 8)->Unit(benchmark::kNanosecond);
+
+}  // namespace
@@ -0,0 +1,155 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <cc/data.h>
+#include <dhcpsrv/benchmarks/parameters.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <dhcpsrv/parsers/dhcp_parsers.h>
+#include <dhcpsrv/parsers/simple_parser4.h>
+#include <dhcpsrv/srv_config.h>
+#include <dhcpsrv/subnet_delta.h>
+#include <stats/stats_mgr.h>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::dhcp::bench;
+using namespace isc::stats;
+using namespace std;
+
+namespace {
+
+/// @brief A number of subnets of a small configuration.
+constexpr size_t SMALL_SUBNET_COUNT = 1000;
+
+/// @brief A number of subnets of a large configuration.
+constexpr size_t LARGE_SUBNET_COUNT = 50000;
+
+/// @brief Fixture comparing a one-subnet change applied with
+/// @c SubnetDelta with parsing all the subnets again, as a full
+/// reconfiguration does.
+///
+/// The configuration holds state.range(0) IPv4 /24 subnets with one pool
+/// each. The leases are counted in an empty memfile lease database.
+class SubnetDeltaBenchmark : public ::benchmark::Fixture {
+public:
+
+    /// @brief Creates the subnets.
+    void SetUp(::benchmark::State const& state) override {
+        const size_t count = state.range(0);
+        CfgMgr::instance().clear();
+        StatsMgr::instance().removeAll();
+        LeaseMgrFactory::create("universe=4 type=memfile persist=false");
+
+        subnets_ = Element::createList();
+        for (uint32_t i = 0; i < count; ++i) {
+            const string prefix(to_string(10 + (i >> 16)) + "." +
+                                to_string((i >> 8) & 0xff) + "." +
+                                to_string(i & 0xff) + ".");
+            ElementPtr subnet = Element::fromJSON(
+                "{ \"id\": " + to_string(i + 1) + ","
+                " \"subnet\": \"" + prefix + "0/24\","
+                " \"pools\": [ { \"pool\": \"" + prefix + "10 - " + prefix + "99\" } ] }");
+            SimpleParser::setDefaults(subnet, SimpleParser4::SUBNET4_DEFAULTS);
+            subnets_->add(subnet);
+        }
+
+        cfg_.reset(new SrvConfig());
+        Subnets4ListConfigParser parser(false);
+        parser.parse(cfg_, isc::data::copy(subnets_));
+        cfg_->getCfgSubnets4()->buildSelectionIndex();
+        cfg_->getCfgSubnets4()->updateStatistics();
+    }
+
+    void SetUp(::benchmark::State& s) override {
+        ::benchmark::State const& cs = s;
+        SetUp(cs);
+    }
+
+    /// @brief Drops the subnets.
+    void TearDown(::benchmark::State const&) override {
+        cfg_.reset();
+        subnets_.reset();
+        LeaseMgrFactory::destroy();
+        CfgMgr::instance().clear();
+        StatsMgr::instance().removeAll();
+    }
+
+    void TearDown(::benchmark::State& s) override {
+        ::benchmark::State const& cs = s;
+        TearDown(cs);
+    }
+
+    /// @brief Replaces the pool of the first subnet with a delta.
+    void replaceSubnet4() {
+        ElementPtr arguments = Element::fromJSON(
+            "{ \"subnet4\": [ { \"id\": 1, \"subnet\": \"10.0.0.0/24\","
+            " \"pools\": [ { \"pool\": \"10.0.0.10 - 10.0.0.199\" } ] } ] }");
+        SubnetDelta<DHCP_SPACE_V4> delta(false);
+        delta.parse(cfg_, arguments);
+        delta.apply(cfg_);
+    }
+
+    /// @brief Parses all the subnets into a new configuration.
+    ///
+    /// @param subnets Subnets to parse.
+    void parseAllSubnets4(ElementPtr const& subnets) {
+        SrvConfigPtr cfg(new SrvConfig());
+        Subnets4ListConfigParser parser(false);
+        parser.parse(cfg, subnets);
+        cfg->getCfgSubnets4()->buildSelectionIndex();
+        cfg->getCfgSubnets4()->updateStatistics();
+    }
+
+    /// @brief Configuration holding the subnets.
+    SrvConfigPtr cfg_;
+
+    /// @brief Subnets of the configuration in JSON.
+    ElementPtr subnets_;
+};
+
+BENCHMARK_DEFINE_F(SubnetDeltaBenchmark, replaceSubnet4)(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        replaceSubnet4();
+    }
+}
+
+BENCHMARK_DEFINE_F(SubnetDeltaBenchmark, parseAllSubnets4)(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        // The parsers may alter the elements they are given.
+        state.PauseTiming();
+        ElementPtr const& subnets(isc::data::copy(subnets_));
+        state.ResumeTiming();
+        parseAllSubnets4(subnets);
+    }
+}
+
+/// A benchmark that measures a one-subnet change applied with a delta.
+BENCHMARK_REGISTER_F(SubnetDeltaBenchmark, replaceSubnet4)
+    ->Arg(SMALL_SUBNET_COUNT)->Arg(LARGE_SUBNET_COUNT)->Unit(UNIT);
+
+/// A benchmark that measures parsing all subnets of the configuration.
+BENCHMARK_REGISTER_F(SubnetDeltaBenchmark, parseAllSubnets4)
+    ->Arg(SMALL_SUBNET_COUNT)->Arg(LARGE_SUBNET_COUNT)->Unit(UNIT);
+
+}  // namespace
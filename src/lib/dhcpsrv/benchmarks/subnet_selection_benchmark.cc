@@ -0,0 +1,266 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <dhcp/classify.h>
+#include <dhcpsrv/benchmarks/parameters.h>
+#include <dhcpsrv/cfg_subnets4.h>
+#include <dhcpsrv/cfg_subnets6.h>
+#include <dhcpsrv/subnet.h>
+#include <dhcpsrv/subnet_selector.h>
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::dhcp::bench;
+using namespace std;
+
+namespace {
+
+/// @brief A minimum number of subnets used in a benchmark.
+constexpr size_t MIN_SUBNET_COUNT = 256;
+
+/// @brief A maximum number of subnets used in a benchmark.
+constexpr size_t MAX_SUBNET_COUNT = 16384;
+
+/// @brief Fixture comparing the subnet selection by scanning all subnets
+/// with the selection using the subnet selection index.
+///
+/// The configuration holds state.range(0) IPv4 /24 subnets and IPv6 /64
+/// subnets, each with its own relay address. Every benchmark iteration
+/// selects a subnet for each configured subnet, so the results are the
+/// average cost of a selection multiplied by the subnet count.
+class SubnetSelectionBenchmark : public ::benchmark::Fixture {
+public:
+
+    /// @brief Creates the subnets.
+    void SetUp(::benchmark::State const& state) override {
+        const size_t count = state.range(0);
+        cfg4_.reset(new CfgSubnets4());
+        cfg6_.reset(new CfgSubnets6());
+        addresses4_.clear();
+        relays4_.clear();
+        addresses6_.clear();
+        relays6_.clear();
+        for (uint32_t i = 0; i < count; ++i) {
+            const SubnetID id = i + 1;
+            Subnet4Ptr subnet4(new Subnet4(IOAddress(0x0a000000 + (i << 8)), 24,
+                                           1, 2, 3, id));
+            IOAddress relay4(0xac100000 + i);
+            subnet4->addRelayAddress(relay4);
+            cfg4_->add(subnet4);
+            addresses4_.push_back(IOAddress(0x0a000000 + (i << 8) + 10));
+            relays4_.push_back(relay4);
+
+            vector<uint8_t> prefix6 = IOAddress("2001:db8::").toBytes();
+            prefix6[4] = static_cast<uint8_t>(i >> 8);
+            prefix6[5] = static_cast<uint8_t>(i);
+            Subnet6Ptr subnet6(new Subnet6(IOAddress::fromBytes(AF_INET6, &prefix6[0]), 64,
+                                           1, 2, 3, 4, id));
+            vector<uint8_t> relay6 = IOAddress("3000::").toBytes();
+            relay6[14] = static_cast<uint8_t>(i >> 8);
+            relay6[15] = static_cast<uint8_t>(i);
+            subnet6->addRelayAddress(IOAddress::fromBytes(AF_INET6, &relay6[0]));
+            cfg6_->add(subnet6);
+            prefix6[15] = 10;
+            addresses6_.push_back(IOAddress::fromBytes(AF_INET6, &prefix6[0]));
+            relays6_.push_back(IOAddress::fromBytes(AF_INET6, &relay6[0]));
+        }
+    }
+
+    void SetUp(::benchmark::State& s) override {
+        ::benchmark::State const& cs = s;
+        SetUp(cs);
+    }
+
+    /// @brief Drops the subnets.
+    void TearDown(::benchmark::State const&) override {
+        cfg4_.reset();
+        cfg6_.reset();
+    }
+
+    void TearDown(::benchmark::State& s) override {
+        ::benchmark::State const& cs = s;
+        TearDown(cs);
+    }
+
+    /// @brief Selects IPv4 subnets by the client address.
+    void selectByAddress4() {
+        SubnetSelector selector;
+        selector.local_address_ = IOAddress("10.255.255.1");
+        for (auto const& address : addresses4_) {
+            selector.ciaddr_ = address;
+            benchmark::DoNotOptimize(cfg4_->selectSubnet(selector));
+        }
+    }
+
+    /// @brief Selects IPv4 subnets by the relay address.
+    void selectByRelay4() {
+        SubnetSelector selector;
+        for (auto const& relay : relays4_) {
+            selector.giaddr_ = relay;
+            benchmark::DoNotOptimize(cfg4_->selectSubnet(selector));
+        }
+    }
+
+    /// @brief Selects IPv4 subnets by the subnet identifier.
+    void getById4() {
+        for (size_t i = 0; i < addresses4_.size(); ++i) {
+            benchmark::DoNotOptimize(cfg4_->getSubnet(i + 1));
+        }
+    }
+
+    /// @brief Selects IPv6 subnets by the client address.
+    void selectByAddress6() {
+        SubnetSelector selector;
+        for (auto const& address : addresses6_) {
+            selector.remote_address_ = address;
+            benchmark::DoNotOptimize(cfg6_->selectSubnet(selector));
+        }
+    }
+
+    /// @brief Selects IPv6 subnets by the relay link address.
+    void selectByRelay6() {
+        SubnetSelector selector;
+        for (auto const& relay : relays6_) {
+            selector.first_relay_linkaddr_ = relay;
+            benchmark::DoNotOptimize(cfg6_->selectSubnet(selector));
+        }
+    }
+
+    /// @brief IPv4 subnets.
+    CfgSubnets4Ptr cfg4_;
+
+    /// @brief IPv6 subnets.
+    CfgSubnets6Ptr cfg6_;
+
+    /// @brief An address in every IPv4 subnet.
+    vector<IOAddress> addresses4_;
+
+    /// @brief The relay address of every IPv4 subnet.
+    vector<IOAddress> relays4_;
+
+    /// @brief An address in every IPv6 subnet.
+    vector<IOAddress> addresses6_;
+
+    /// @brief The relay address of every IPv6 subnet.
+    vector<IOAddress> relays6_;
+};
+
+BENCHMARK_DEFINE_F(SubnetSelectionBenchmark, selectByAddress4Scan)(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        selectByAddress4();
+    }
+}
+
+BENCHMARK_DEFINE_F(SubnetSelectionBenchmark, selectByAddress4Index)(benchmark::State& state) {
+    cfg4_->buildSelectionIndex();
+    while (state.KeepRunning()) {
+        selectByAddress4();
+    }
+}
+
+BENCHMARK_DEFINE_F(SubnetSelectionBenchmark, selectByRelay4Scan)(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        selectByRelay4();
+    }
+}
+
+BENCHMARK_DEFINE_F(SubnetSelectionBenchmark, selectByRelay4Index)(benchmark::State& state) {
+    cfg4_->buildSelectionIndex();
+    while (state.KeepRunning()) {
+        selectByRelay4();
+    }
+}
+
+BENCHMARK_DEFINE_F(SubnetSelectionBenchmark, getById4)(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        getById4();
+    }
+}
+
+BENCHMARK_DEFINE_F(SubnetSelectionBenchmark, selectByAddress6Scan)(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        selectByAddress6();
+    }
+}
+
+BENCHMARK_DEFINE_F(SubnetSelectionBenchmark, selectByAddress6Index)(benchmark::State& state) {
+    cfg6_->buildSelectionIndex();
+    while (state.KeepRunning()) {
+        selectByAddress6();
+    }
+}
+
+BENCHMARK_DEFINE_F(SubnetSelectionBenchmark, selectByRelay6Scan)(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        selectByRelay6();
+    }
+}
+
+BENCHMARK_DEFINE_F(SubnetSelectionBenchmark, selectByRelay6Index)(benchmark::State& state) {
+    cfg6_->buildSelectionIndex();
+    while (state.KeepRunning()) {
+        selectByRelay6();
+    }
+}
+
+BENCHMARK_DEFINE_F(SubnetSelectionBenchmark, buildSelectionIndex)(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        cfg4_->buildSelectionIndex();
+        cfg6_->buildSelectionIndex();
+    }
+}
+
+/// Benchmarks that measure the IPv4 subnet selection by the client address.
+BENCHMARK_REGISTER_F(SubnetSelectionBenchmark, selectByAddress4Scan)
+    ->Range(MIN_SUBNET_COUNT, MAX_SUBNET_COUNT)->Unit(UNIT);
+BENCHMARK_REGISTER_F(SubnetSelectionBenchmark, selectByAddress4Index)
+    ->Range(MIN_SUBNET_COUNT, MAX_SUBNET_COUNT)->Unit(UNIT);
+
+/// Benchmarks that measure the IPv4 subnet selection by the relay address.
+BENCHMARK_REGISTER_F(SubnetSelectionBenchmark, selectByRelay4Scan)
+    ->Range(MIN_SUBNET_COUNT, MAX_SUBNET_COUNT)->Unit(UNIT);
+BENCHMARK_REGISTER_F(SubnetSelectionBenchmark, selectByRelay4Index)
+    ->Range(MIN_SUBNET_COUNT, MAX_SUBNET_COUNT)->Unit(UNIT);
+
+/// A benchmark that measures the IPv4 subnet lookup by identifier.
+BENCHMARK_REGISTER_F(SubnetSelectionBenchmark, getById4)
+    ->Range(MIN_SUBNET_COUNT, MAX_SUBNET_COUNT)->Unit(UNIT);
+
+/// Benchmarks that measure the IPv6 subnet selection by the client address.
+BENCHMARK_REGISTER_F(SubnetSelectionBenchmark, selectByAddress6Scan)
+    ->Range(MIN_SUBNET_COUNT, MAX_SUBNET_COUNT)->Unit(UNIT);
+BENCHMARK_REGISTER_F(SubnetSelectionBenchmark, selectByAddress6Index)
+    ->Range(MIN_SUBNET_COUNT, MAX_SUBNET_COUNT)->Unit(UNIT);
+
+/// Benchmarks that measure the IPv6 subnet selection by the relay address.
+BENCHMARK_REGISTER_F(SubnetSelectionBenchmark, selectByRelay6Scan)
+    ->Range(MIN_SUBNET_COUNT, MAX_SUBNET_COUNT)->Unit(UNIT);
+BENCHMARK_REGISTER_F(SubnetSelectionBenchmark, selectByRelay6Index)
+    ->Range(MIN_SUBNET_COUNT, MAX_SUBNET_COUNT)->Unit(UNIT);
+
+/// A benchmark that measures building the subnet selection indexes.
+BENCHMARK_REGISTER_F(SubnetSelectionBenchmark, buildSelectionIndex)
+    ->Range(MIN_SUBNET_COUNT, MAX_SUBNET_COUNT)->Unit(UNIT);
+
+}  // namespace
@@ -26,6 +26,23 @@ CfgMultiThreading::apply(ElementPtr value) {
         MultiThreadingMgr::instance().apply(enabled, thread_count, queue_size);
 }
 
+bool
+CfgMultiThreading::isApplied(ElementPtr value) {
+        bool enabled = false;
+        uint32_t thread_count = 0;
+        uint32_t queue_size = 0;
+        CfgMultiThreading::extract(value, enabled, thread_count, queue_size);
+        MultiThreadingMgr& mgr = MultiThreadingMgr::instance();
+        if (enabled && !thread_count) {
+            thread_count = MultiThreadingMgr::detectThreadCount();
+        }
+        if (!enabled || !thread_count) {
+            return (!mgr.getMode());
+        }
+        return (mgr.getMode() && (mgr.getThreadPoolSize() == thread_count) &&
+                (mgr.getPacketQueueSize() == queue_size));
+}
+
 void
 CfgMultiThreading::extract(ElementPtr value, bool& enabled,
                            uint32_t& thread_count, uint32_t& queue_size) {
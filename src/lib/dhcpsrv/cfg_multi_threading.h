@@ -21,6 +21,16 @@ public:
     /// @param value The multi-threading configuration
     static void apply(data::ElementPtr value);
 
+    /// @brief check if multi threading configuration is in effect
+    ///
+    /// Used to skip stopping and restarting the thread pool when a new
+    /// configuration doesn't change the multi threading parameters.
+    ///
+    /// @param value The multi-threading configuration
+    /// @return true if applying the configuration would not change the
+    /// multi threading mode, the thread pool size and the queue size.
+    static bool isApplied(data::ElementPtr value);
+
     /// @brief extract multi threading parameters
     ///
     /// @param[in] value The multi-threading configuration
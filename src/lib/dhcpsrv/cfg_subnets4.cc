@@ -39,6 +39,7 @@ CfgSubnets4::add(const Subnet4Ptr& subnet) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_ADD_SUBNET4)
               .arg(subnet->toText());
     static_cast<void>(subnets_.insert(subnet));
+    invalidateSelectionIndex();
 }
 
 Subnet4Ptr
@@ -52,6 +53,7 @@ CfgSubnets4::replace(const Subnet4Ptr& subnet) {
     }
     Subnet4Ptr old = *subnet_it;
     bool ret = index.replace(subnet_it, subnet);
+    invalidateSelectionIndex();
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_UPDATE_SUBNET4)
         .arg(subnet_id).arg(ret);
@@ -79,6 +81,7 @@ CfgSubnets4::del(const SubnetID& subnet_id) {
     Subnet4Ptr subnet = *subnet_it;
 
     index.erase(subnet_it);
+    invalidateSelectionIndex();
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_DEL_SUBNET4)
         .arg(subnet->toText());
@@ -87,6 +90,8 @@ CfgSubnets4::del(const SubnetID& subnet_id) {
 void
 CfgSubnets4::merge(CfgOptionDefPtr cfg_def, CfgSharedNetworks4Ptr networks,
                    CfgSubnets4& other) {
+    invalidateSelectionIndex();
+
     auto& index_id = subnets_.get<SubnetSubnetIdIndexTag>();
     auto& index_prefix = subnets_.get<SubnetPrefixIndexTag>();
 
@@ -321,7 +326,15 @@ CfgSubnets4::selectSubnet(const SubnetSelector& selector) const {
     // possible that the relay address will not match with any of the relay
     // addresses across all subnets, but we need to verify that for all subnets
     // before we can try to use the giaddr to match with the subnet prefix.
-    if (!selector.giaddr_.isV4Zero()) {
+    if (!selector.giaddr_.isV4Zero() && selection_index_) {
+        for (uint32_t position : selection_index_->relayCandidates(selector.giaddr_)) {
+            const Subnet4Ptr& subnet = selection_subnets_[position];
+            if (subnet->clientSupported(selector.client_classes_)) {
+                return (subnet);
+            }
+        }
+
+    } else if (!selector.giaddr_.isV4Zero()) {
         for (Subnet4Collection::const_iterator subnet = subnets_.begin();
              subnet != subnets_.end(); ++subnet) {
 
@@ -408,6 +421,20 @@ CfgSubnets4::selectSubnet(const SubnetSelector& selector) const {
 Subnet4Ptr
 CfgSubnets4::selectSubnet(const std::string& iface,
                           const ClientClasses& client_classes) const {
+    if (selection_index_) {
+        for (uint32_t position : selection_index_->interfaceCandidates(iface)) {
+            const Subnet4Ptr& subnet = selection_subnets_[position];
+            if (subnet->clientSupported(client_classes)) {
+                LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
+                          DHCPSRV_CFGMGR_SUBNET4_IFACE)
+                    .arg(subnet->toText())
+                    .arg(iface);
+                return (subnet);
+            }
+        }
+        return (Subnet4Ptr());
+    }
+
     for (Subnet4Collection::const_iterator subnet = subnets_.begin();
          subnet != subnets_.end(); ++subnet) {
 
@@ -450,20 +477,27 @@ CfgSubnets4::selectSubnet(const std::string& iface,
 
 Subnet4Ptr
 CfgSubnets4::getSubnet(const SubnetID id) const {
-
-    /// @todo: Once this code is migrated to multi-index container, use
-    /// an index rather than full scan.
-    for (auto subnet = subnets_.begin(); subnet != subnets_.end(); ++subnet) {
-        if ((*subnet)->getID() == id) {
-            return (*subnet);
-        }
-    }
-    return (Subnet4Ptr());
+    const auto& index = subnets_.get<SubnetSubnetIdIndexTag>();
+    auto subnet_it = index.find(id);
+    return ((subnet_it != index.cend()) ? (*subnet_it) : Subnet4Ptr());
 }
 
 Subnet4Ptr
 CfgSubnets4::selectSubnet(const IOAddress& address,
                  const ClientClasses& client_classes) const {
+    if (selection_index_) {
+        for (uint32_t position : selection_index_->prefixCandidates(address)) {
+            const Subnet4Ptr& subnet = selection_subnets_[position];
+            if (subnet->clientSupported(client_classes)) {
+                LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_SUBNET4_ADDR)
+                    .arg(subnet->toText())
+                    .arg(address.toText());
+                return (subnet);
+            }
+        }
+        return (Subnet4Ptr());
+    }
+
     for (Subnet4Collection::const_iterator subnet = subnets_.begin();
          subnet != subnets_.end(); ++subnet) {
 
@@ -486,32 +520,77 @@ CfgSubnets4::selectSubnet(const IOAddress& address,
 }
 
 void
-CfgSubnets4::removeStatistics() {
-    using namespace isc::stats;
+CfgSubnets4::buildSelectionIndex() {
+    std::shared_ptr<SubnetSelectionIndex> index(new SubnetSelectionIndex());
+    std::vector<Subnet4Ptr> subnets;
+    subnets.reserve(subnets_.size());
+
+    for (auto const& subnet : subnets_) {
+        const uint32_t position = subnets.size();
+        subnets.push_back(subnet);
+
+        // The pools are committed along with the subnet.
+        subnet->buildPoolIndex();
+
+        const std::pair<IOAddress, uint8_t>& prefix = subnet->get();
+        index->addPrefix(prefix.first, prefix.second, position);
+
+        // The relay addresses of the subnet take precedence over the
+        // relay addresses of its shared network.
+        SharedNetwork4Ptr network;
+        subnet->getSharedNetwork(network);
+        if (subnet->hasRelays()) {
+            for (auto const& relay : subnet->getRelayAddresses()) {
+                index->addRelay(relay, position);
+            }
+        } else if (network) {
+            for (auto const& relay : network->getRelayAddresses()) {
+                index->addRelay(relay, position);
+            }
+        }
 
+        if (!subnet->getIface().empty()) {
+            index->addInterface(subnet->getIface(), position);
+        } else if (network && !network->getIface().empty()) {
+            index->addInterface(network->getIface(), position);
+        }
+    }
+
+    selection_index_ = index;
+    selection_subnets_.swap(subnets);
+}
+
+void
+CfgSubnets4::removeStatistics() {
     // For each v4 subnet currently configured, remove the statistic.
-    StatsMgr& stats_mgr = StatsMgr::instance();
     for (Subnet4Collection::const_iterator subnet4 = subnets_.begin();
          subnet4 != subnets_.end(); ++subnet4) {
-        SubnetID subnet_id = (*subnet4)->getID();
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "total-addresses"));
+        removeStatistics((*subnet4)->getID());
+    }
+}
+
+void
+CfgSubnets4::removeStatistics(const SubnetID& subnet_id) {
+    using namespace isc::stats;
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-addresses"));
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "total-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "cumulative-assigned-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "cumulative-assigned-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "reclaimed-declined-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "reclaimed-leases"));
-    }
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "reclaimed-declined-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "reclaimed-leases"));
 }
 
 void
@@ -541,6 +620,30 @@ CfgSubnets4::updateStatistics() {
     }
 }
 
+void
+CfgSubnets4::updateStatistics(const SubnetID& subnet_id, bool recount) {
+    using namespace isc::stats;
+
+    ConstSubnet4Ptr subnet = getBySubnetId(subnet_id);
+    if (!subnet) {
+        return;
+    }
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "total-addresses"),
+                       static_cast<int64_t>(subnet->getPoolCapacity(Lease::TYPE_V4)));
+    const std::string& name =
+        StatsMgr::generateName("subnet", subnet_id, "cumulative-assigned-addresses");
+    if (!stats_mgr.getObservation(name)) {
+        stats_mgr.setValue(name, static_cast<int64_t>(0));
+    }
+
+    if (recount) {
+        LeaseMgrFactory::instance().recountLeaseStats4(subnet_id);
+    }
+}
+
 ElementPtr
 CfgSubnets4::toElement() const {
     ElementPtr result = Element::createList();
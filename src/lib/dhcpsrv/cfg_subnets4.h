@@ -14,6 +14,7 @@
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/subnet_id.h>
 #include <dhcpsrv/subnet_selector.h>
+#include <dhcpsrv/subnet_selection_index.h>
 #include <string>
 
 namespace isc {
@@ -201,13 +202,9 @@ public:
     ///
     /// If the address matches with a subnet, the subnet is returned.
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets (possibly a couple of times)
-    /// to find the one which fulfills the search criteria. The subnet storage
-    /// is implemented as a simple STL vector which precludes fast searches
-    /// using specific keys. Hence, full scan is required. To improve the
-    /// search performance a different container type is required, e.g.
-    /// multi-index container, or something of a similar functionality.
+    /// When the configuration has been committed, the candidate subnets are
+    /// looked up in the subnet selection index rather than by iterating
+    /// over all subnets, see @ref buildSelectionIndex.
     ///
     /// @param selector Const reference to the selector structure which holds
     /// various information extracted from the client's packet which are used
@@ -220,9 +217,6 @@ public:
 
     /// @brief Returns subnet with specified subnet-id value
     ///
-    /// Warning: this method uses full scan. Its use is not recommended for
-    /// packet processing.
-    ///
     /// @return Subnet (or NULL)
     Subnet4Ptr getSubnet(const SubnetID id) const;
 
@@ -233,13 +227,9 @@ public:
     /// testing. This method is also called by the
     /// @c selectSubnet(SubnetSelector).
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets to find the one which fulfills
-    /// the search criteria. The subnet storage is implemented as a simple
-    /// STL vector which precludes fast searches using specific keys.
-    /// Hence, full scan is required. To improve the search performance a
-    /// different container type is required, e.g. multi-index container,
-    /// or something of a similar functionality.
+    /// When the configuration has been committed, the candidate subnets are
+    /// looked up in the subnet selection index rather than by iterating
+    /// over all subnets, see @ref buildSelectionIndex.
     ///
     /// @param address Address for which the subnet is searched.
     /// @param client_classes Optional parameter specifying the classes that
@@ -258,13 +248,9 @@ public:
     /// not match a subnet definition. This method is also called by the
     /// @c selectSubnet(SubnetSelector).
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets to find the one which fulfills
-    /// the search criteria. The subnet storage is implemented as a simple
-    /// STL vector which precludes fast searches using specific keys.
-    /// Hence, full scan is required. To improve the search performance a
-    /// different container type is required, e.g. multi-index container,
-    /// or something of a similar functionality.
+    /// When the configuration has been committed, the candidate subnets are
+    /// looked up in the subnet selection index rather than by iterating
+    /// over all subnets, see @ref buildSelectionIndex.
     ///
     /// @param iface name of the interface to be matched.
     /// @param client_classes Optional parameter specifying the classes that
@@ -313,6 +299,21 @@ public:
     /// configuration and also subnet-ids may change.
     void removeStatistics();
 
+    /// @brief Updates statistics of a single subnet.
+    ///
+    /// Used when subnets are added or replaced in the current configuration
+    /// without committing a new one. It updates the number of available
+    /// addresses in the subnet and, if requested, recounts its leases.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    /// @param recount Recount the leases of the subnet.
+    void updateStatistics(const SubnetID& subnet_id, bool recount);
+
+    /// @brief Removes statistics of a single subnet.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    void removeStatistics(const SubnetID& subnet_id);
+
     /// @brief Unparse a configuration object
     ///
     /// @return a pointer to unparsed configuration
@@ -320,12 +321,36 @@ public:
 
     void clear() {
         subnets_.clear();
+        invalidateSelectionIndex();
     }
 
+    /// @brief Builds the index used for subnet selection.
+    ///
+    /// Called when the configuration is committed. Until then, and after any
+    /// subnet is added, replaced or removed, the subnets are selected by
+    /// iterating over all of them. The index captures the relay addresses,
+    /// interfaces of the subnets and of their shared
+    /// networks, so it must be rebuilt when these are modified in place.
+    /// The pool capacity index of each subnet is built as well, see
+    /// @ref Subnet::buildPoolIndex.
+    void buildSelectionIndex();
+
 private:
+    /// @brief Drops the subnet selection index.
+    void invalidateSelectionIndex() {
+        selection_index_.reset();
+        selection_subnets_.clear();
+    }
+
     /// @brief A container for IPv4 subnets.
     Subnet4Collection subnets_;
 
+    /// @brief Subnet selection index, null if not built.
+    ConstSubnetSelectionIndexPtr selection_index_;
+
+    /// @brief Subnets by their position in the subnet selection index.
+    std::vector<Subnet4Ptr> selection_subnets_;
+
 };
 
 /// @name Pointer to the @c CfgSubnets4 objects.
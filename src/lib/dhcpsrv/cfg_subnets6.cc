@@ -39,6 +39,7 @@ CfgSubnets6::add(const Subnet6Ptr& subnet) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_ADD_SUBNET6)
               .arg(subnet->toText());
     static_cast<void>(subnets_.insert(subnet));
+    invalidateSelectionIndex();
 }
 
 Subnet6Ptr
@@ -52,6 +53,7 @@ CfgSubnets6::replace(const Subnet6Ptr& subnet) {
     }
     Subnet6Ptr old = *subnet_it;
     bool ret = index.replace(subnet_it, subnet);
+    invalidateSelectionIndex();
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_UPDATE_SUBNET6)
         .arg(subnet_id).arg(ret);
@@ -79,6 +81,7 @@ CfgSubnets6::del(const SubnetID& subnet_id) {
     Subnet6Ptr subnet = *subnet_it;
 
     index.erase(subnet_it);
+    invalidateSelectionIndex();
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_DEL_SUBNET6)
         .arg(subnet->toText());
@@ -87,6 +90,8 @@ CfgSubnets6::del(const SubnetID& subnet_id) {
 void
 CfgSubnets6::merge(CfgOptionDefPtr cfg_def, CfgSharedNetworks6Ptr networks,
                    CfgSubnets6& other) {
+    invalidateSelectionIndex();
+
     auto& index_id = subnets_.get<SubnetSubnetIdIndexTag>();
     auto& index_prefix = subnets_.get<SubnetPrefixIndexTag>();
 
@@ -264,6 +269,30 @@ CfgSubnets6::selectSubnet(const SubnetSelector& selector) const {
 Subnet6Ptr CfgSubnets6::selectSubnet(const asiolink::IOAddress& address,
                                      const ClientClasses& client_classes,
                                      const bool is_relay_address) const {
+    if (selection_index_) {
+        if (is_relay_address) {
+            for (uint32_t position : selection_index_->relayCandidates(address)) {
+                Subnet6Ptr const& subnet(selection_subnets_[position]);
+                if (subnet->clientSupported(client_classes)) {
+                    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_SUBNET6_RELAY)
+                        .arg(subnet->toText())
+                        .arg(address.toText());
+                    return subnet;
+                }
+            }
+        }
+        for (uint32_t position : selection_index_->prefixCandidates(address)) {
+            Subnet6Ptr const& subnet(selection_subnets_[position]);
+            if (subnet->clientSupported(client_classes)) {
+                LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_SUBNET6)
+                    .arg(subnet->toText())
+                    .arg(address.toText());
+                return subnet;
+            }
+        }
+        return Subnet6Ptr();
+    }
+
     // If the specified address is a relay address we first need to match
     // it with the relay addresses specified for all subnets.
     if (is_relay_address) {
@@ -313,7 +342,18 @@ CfgSubnets6::selectSubnet(const std::string& iface_name,
                           const ClientClasses& client_classes) const {
 
     // If empty interface specified, we can't select subnet by interface.
-    if (!iface_name.empty()) {
+    if (!iface_name.empty() && selection_index_) {
+        for (uint32_t position : selection_index_->interfaceCandidates(iface_name)) {
+            Subnet6Ptr const& subnet(selection_subnets_[position]);
+            if (subnet->clientSupported(client_classes)) {
+                LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
+                          DHCPSRV_CFGMGR_SUBNET6_IFACE)
+                    .arg(subnet->toText()).arg(iface_name);
+                return (subnet);
+            }
+        }
+
+    } else if (!iface_name.empty()) {
         for (Subnet6Collection::const_iterator subnet = subnets_.begin();
              subnet != subnets_.end(); ++subnet) {
 
@@ -343,6 +383,20 @@ Subnet6Ptr CfgSubnets6::selectSubnet(const OptionPtr& interface_id,
         return Subnet6Ptr();
     }
 
+    if (selection_index_) {
+        for (uint32_t position : selection_index_->interfaceIdCandidates(interface_id)) {
+            Subnet6Ptr const& subnet(selection_subnets_[position]);
+            // Candidates have the same interface id data, compare the options.
+            OptionPtr const& interface_ID(subnet->getInterfaceId());
+            if (interface_ID->equals(interface_id) && subnet->clientSupported(client_classes)) {
+                LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_SUBNET6_IFACE_ID)
+                    .arg(subnet->toText());
+                return subnet;
+            }
+        }
+        return Subnet6Ptr();
+    }
+
     for (Subnet6Ptr const& subnet : subnets_) {
         // If interface id matches for the subnet and the subnet is not
         // rejected based on the classification.
@@ -361,51 +415,95 @@ Subnet6Ptr CfgSubnets6::selectSubnet(const OptionPtr& interface_id,
 
 Subnet6Ptr
 CfgSubnets6::getSubnet(const SubnetID id) const {
+    const auto& index = subnets_.get<SubnetSubnetIdIndexTag>();
+    auto subnet_it = index.find(id);
+    return ((subnet_it != index.cend()) ? (*subnet_it) : Subnet6Ptr());
+}
 
-    /// @todo: Once this code is migrated to multi-index container, use
-    /// an index rather than full scan.
-    for (auto subnet = subnets_.begin(); subnet != subnets_.end(); ++subnet) {
-        if ((*subnet)->getID() == id) {
-            return (*subnet);
+void
+CfgSubnets6::buildSelectionIndex() {
+    std::shared_ptr<SubnetSelectionIndex> index(new SubnetSelectionIndex());
+    std::vector<Subnet6Ptr> subnets;
+    subnets.reserve(subnets_.size());
+
+    for (Subnet6Ptr const& subnet : subnets_) {
+        uint32_t const position(subnets.size());
+        subnets.push_back(subnet);
+
+        // The pools are committed along with the subnet.
+        subnet->buildPoolIndex();
+
+        std::pair<IOAddress, uint8_t> const& prefix(subnet->get());
+        index->addPrefix(prefix.first, prefix.second, position);
+
+        // The relay addresses of the subnet take precedence over the
+        // relay addresses of its shared network.
+        if (subnet->hasRelays()) {
+            for (IOAddress const& relay : subnet->getRelayAddresses()) {
+                index->addRelay(relay, position);
+            }
+        } else {
+            SharedNetwork6Ptr network;
+            subnet->getSharedNetwork(network);
+            if (network) {
+                for (IOAddress const& relay : network->getRelayAddresses()) {
+                    index->addRelay(relay, position);
+                }
+            }
+        }
+
+        if (!subnet->getIface().empty()) {
+            index->addInterface(subnet->getIface(), position);
+        }
+
+        OptionPtr const& interface_id(subnet->getInterfaceId());
+        if (interface_id) {
+            index->addInterfaceId(interface_id, position);
         }
     }
-    return (Subnet6Ptr());
+
+    selection_index_ = index;
+    selection_subnets_.swap(subnets);
 }
 
 void
 CfgSubnets6::removeStatistics() {
-    using namespace isc::stats;
-
-    StatsMgr& stats_mgr = StatsMgr::instance();
     // For each v6 subnet currently configured, remove the statistics.
     for (Subnet6Collection::const_iterator subnet6 = subnets_.begin();
          subnet6 != subnets_.end(); ++subnet6) {
-        SubnetID subnet_id = (*subnet6)->getID();
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-nas"));
+        removeStatistics((*subnet6)->getID());
+    }
+}
+
+void
+CfgSubnets6::removeStatistics(const SubnetID& subnet_id) {
+    using namespace isc::stats;
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-nas"));
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-nas"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "cumulative-assigned-nas"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-nas"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-pds"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "cumulative-assigned-nas"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-pds"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-pds"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "cumulative-assigned-pds"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-pds"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "cumulative-assigned-pds"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "reclaimed-declined-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "reclaimed-leases"));
-    }
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "reclaimed-declined-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "reclaimed-leases"));
 }
 
 void
@@ -447,6 +545,41 @@ CfgSubnets6::updateStatistics() {
     }
 }
 
+void
+CfgSubnets6::updateStatistics(const SubnetID& subnet_id, bool recount) {
+    using namespace isc::stats;
+
+    ConstSubnet6Ptr subnet = getBySubnetId(subnet_id);
+    if (!subnet) {
+        return;
+    }
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "total-nas"),
+                       static_cast<int64_t>(subnet->getPoolCapacity(Lease::TYPE_NA)));
+
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "total-pds"),
+                       static_cast<int64_t>(subnet->getPoolCapacity(Lease::TYPE_PD)));
+
+    const std::string& name_nas =
+        StatsMgr::generateName("subnet", subnet_id, "cumulative-assigned-nas");
+    if (!stats_mgr.getObservation(name_nas)) {
+        stats_mgr.setValue(name_nas, static_cast<int64_t>(0));
+    }
+
+    const std::string& name_pds =
+        StatsMgr::generateName("subnet", subnet_id, "cumulative-assigned-pds");
+    if (!stats_mgr.getObservation(name_pds)) {
+        stats_mgr.setValue(name_pds, static_cast<int64_t>(0));
+    }
+
+    if (recount) {
+        LeaseMgrFactory::instance().recountLeaseStats6(subnet_id);
+    }
+}
+
 ElementPtr
 CfgSubnets6::toElement() const {
     ElementPtr result = Element::createList();
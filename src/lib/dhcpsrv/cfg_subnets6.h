@@ -15,6 +15,7 @@
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/subnet_id.h>
 #include <dhcpsrv/subnet_selector.h>
+#include <dhcpsrv/subnet_selection_index.h>
 #include <util/optional.h>
 #include <string>
 
@@ -185,13 +186,9 @@ public:
     /// associated with any subnet. If not, it is checked if the link address
     /// is in range with any of the subnets.
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets (possibly a couple of times)
-    /// to find the one which fulfills the search criteria. The subnet storage
-    /// is implemented as a simple STL vector which precludes fast searches
-    /// using specific keys. Hence, full scan is required. To improve the
-    /// search performance a different container type is required, e.g.
-    /// multi-index container, or something of a similar functionality.
+    /// When the configuration has been committed, the candidate subnets are
+    /// looked up in the subnet selection index rather than by iterating
+    /// over all subnets, see @ref buildSelectionIndex.
     ///
     /// @param selector Const reference to the selector structure which holds
     /// various information extracted from the client's packet which are used
@@ -202,9 +199,6 @@ public:
 
     /// @brief Returns subnet with specified subnet-id value
     ///
-    /// Warning: this method uses full scan. Its use is not recommended for
-    /// packet processing.
-    ///
     /// @return Subnet (or NULL)
     Subnet6Ptr getSubnet(const SubnetID id) const;
 
@@ -226,13 +220,9 @@ public:
     /// address. For other purposes the @c selectSubnet(SubnetSelector) should
     /// rather be used instead.
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets (possibly a couple of times)
-    /// to find the one which fulfills the search criteria. The subnet storage
-    /// is implemented as a simple STL vector which precludes fast searches
-    /// using specific keys. Hence, full scan is required. To improve the
-    /// search performance a different container type is required, e.g.
-    /// multi-index container, or something of a similar functionality.
+    /// When the configuration has been committed, the candidate subnets are
+    /// looked up in the subnet selection index rather than by iterating
+    /// over all subnets, see @ref buildSelectionIndex.
     ///
     /// @param address Address for which the subnet is searched.
     /// @param client_classes Optional parameter specifying the classes that
@@ -263,6 +253,21 @@ public:
     /// configuration and also subnet-ids may change.
     void removeStatistics();
 
+    /// @brief Updates statistics of a single subnet.
+    ///
+    /// Used when subnets are added or replaced in the current configuration
+    /// without committing a new one. It updates the number of available
+    /// addresses and prefixes in the subnet and, if requested, recounts its leases.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    /// @param recount Recount the leases of the subnet.
+    void updateStatistics(const SubnetID& subnet_id, bool recount);
+
+    /// @brief Removes statistics of a single subnet.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    void removeStatistics(const SubnetID& subnet_id);
+
     /// @brief Unparse a configuration object
     ///
     /// @return a pointer to unparsed configuration
@@ -270,22 +275,36 @@ public:
 
     void clear() {
         subnets_.clear();
+        invalidateSelectionIndex();
     }
 
+    /// @brief Builds the index used for subnet selection.
+    ///
+    /// Called when the configuration is committed. Until then, and after any
+    /// subnet is added, replaced or removed, the subnets are selected by
+    /// iterating over all of them. The index captures the relay addresses,
+    /// interfaces and interface ids of the subnets and of their shared
+    /// networks, so it must be rebuilt when these are modified in place.
+    /// The pool capacity index of each subnet is built as well, see
+    /// @ref Subnet::buildPoolIndex.
+    void buildSelectionIndex();
+
 private:
+    /// @brief Drops the subnet selection index.
+    void invalidateSelectionIndex() {
+        selection_index_.reset();
+        selection_subnets_.clear();
+    }
+
     /// @brief Selects a subnet using the interface name.
     ///
     /// This method searches for the subnet using the name of the interface.
     /// If any of the subnets is explicitly associated with the interface
     /// name, the subnet is returned.
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets to find the one which fulfills
-    /// the search criteria. The subnet storage is implemented as a
-    /// simple STL vector which precludes fast searches using specific
-    /// keys. Hence, full scan is required. To improve the search
-    /// performance a different container type is required, e.g.
-    /// multi-index container, or something of a similar functionality.
+    /// When the configuration has been committed, the candidate subnets are
+    /// looked up in the subnet selection index rather than by iterating
+    /// over all subnets, see @ref buildSelectionIndex.
     ///
     /// @param iface_name Interface name.
     /// @param client_classes Optional parameter specifying the classes that
@@ -303,13 +322,9 @@ private:
     /// of the subnets is explicitly associated with that interface id, the
     /// subnet is returned.
     ///
-    /// @todo This method requires performance improvement! It currently
-    /// iterates over all existing subnets to find the one which fulfills
-    /// the search criteria. The subnet storage is implemented as a
-    /// simple STL vector which precludes fast searches using specific
-    /// keys. Hence, full scan is required. To improve the search
-    /// performance a different container type is required, e.g.
-    /// multi-index container, or something of a similar functionality.
+    /// When the configuration has been committed, the candidate subnets are
+    /// looked up in the subnet selection index rather than by iterating
+    /// over all subnets, see @ref buildSelectionIndex.
     ///
     /// @param interface_id An instance of the Interface ID option received
     /// from the client.
@@ -324,6 +339,12 @@ private:
     /// @brief A container for IPv6 subnets.
     Subnet6Collection subnets_;
 
+    /// @brief Subnet selection index, null if not built.
+    ConstSubnetSelectionIndexPtr selection_index_;
+
+    /// @brief Subnets by their position in the subnet selection index.
+    std::vector<Subnet6Ptr> selection_subnets_;
+
 };
 
 /// @name Pointer to the @c CfgSubnets6 objects.
@@ -10,15 +10,71 @@
 #include <dhcp/libdhcp++.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/dhcpsrv_log.h>
+#include <atomic>
+#include <memory>
 #include <sstream>
 #include <string>
 
 using namespace isc::asiolink;
 using namespace isc::util;
 
+namespace {
+
+/// @brief Configuration pinned for the calling thread by @c CfgSnapshot.
+thread_local isc::dhcp::CfgPublicationPtr pinned_configuration;
+
+}  // namespace
+
 namespace isc {
 namespace dhcp {
 
+CfgPublication::CfgPublication(const SrvConfigPtr& configuration)
+    : configuration_(configuration) {
+}
+
+CfgPublication::~CfgPublication() {
+    for (auto const& subnet_id : stale_subnets4_) {
+        configuration_->getCfgSubnets4()->removeStatistics(subnet_id);
+    }
+    for (auto const& subnet_id : stale_subnets6_) {
+        configuration_->getCfgSubnets6()->removeStatistics(subnet_id);
+    }
+}
+
+void
+CfgPublication::retire(const CfgPublicationPtr& next) {
+    next_ = next;
+    SrvConfigPtr configuration;
+    if (next) {
+        configuration = next->getConfiguration();
+    }
+    if (configuration == configuration_) {
+        return;
+    }
+    for (auto const& subnet : *configuration_->getCfgSubnets4()->getAll()) {
+        if (!configuration ||
+            !configuration->getCfgSubnets4()->getBySubnetId(subnet->getID())) {
+            stale_subnets4_.insert(subnet->getID());
+        }
+    }
+    for (auto const& subnet : *configuration_->getCfgSubnets6()->getAll()) {
+        if (!configuration ||
+            !configuration->getCfgSubnets6()->getBySubnetId(subnet->getID())) {
+            stale_subnets6_.insert(subnet->getID());
+        }
+    }
+}
+
+void
+CfgPublication::keep(const SrvConfig& next) {
+    for (auto const& subnet : *next.getCfgSubnets4()->getAll()) {
+        stale_subnets4_.erase(subnet->getID());
+    }
+    for (auto const& subnet : *next.getCfgSubnets6()->getAll()) {
+        stale_subnets6_.erase(subnet->getID());
+    }
+}
+
 const size_t CfgMgr::CONFIG_LIST_SIZE = 10;
 
 CfgMgr& CfgMgr::instance() {
@@ -62,8 +118,55 @@ D2ClientMgr& CfgMgr::getD2ClientMgr() {
 
 void CfgMgr::ensureCurrentAllocated() {
     if (!configuration_ || configs_.empty()) {
-        configuration_.reset(new SrvConfig());
-        configs_.push_back(configuration_);
+        SrvConfigPtr configuration(new SrvConfig());
+        configs_.push_back(configuration);
+        publish(configuration);
+    }
+}
+
+void
+CfgMgr::publish(const SrvConfigPtr& configuration) {
+    CfgPublicationPtr publication;
+    if (configuration) {
+        publication.reset(new CfgPublication(configuration));
+    }
+    // The replaced publications are updated before the new configuration
+    // becomes visible. Otherwise a thread dropping the last pin on one of
+    // them could remove the statistics the new configuration sets again.
+    retire(publication_, publication);
+    std::atomic_store(&publication_, publication);
+    std::atomic_store(&configuration_, configuration);
+}
+
+CfgPublicationPtr
+CfgMgr::getCurrentPublication() {
+    CfgPublicationPtr publication = std::atomic_load(&publication_);
+    if (publication) {
+        return (publication);
+    }
+    ensureCurrentAllocated();
+    return (publication_);
+}
+
+void
+CfgMgr::retire(const CfgPublicationPtr& previous, const CfgPublicationPtr& next) {
+    // The publications replaced before and still pinned must not remove
+    // the statistics of the subnets which are configured again.
+    for (auto it = retired_publications_.begin();
+         it != retired_publications_.end(); ) {
+        CfgPublicationPtr retired = it->lock();
+        if (!retired) {
+            it = retired_publications_.erase(it);
+            continue;
+        }
+        if (next) {
+            retired->keep(*next->getConfiguration());
+        }
+        ++it;
+    }
+    if (previous) {
+        previous->retire(next);
+        retired_publications_.push_back(previous);
     }
 }
 
@@ -71,6 +174,7 @@ void CfgMgr::clear() {
     if (configuration_) {
         configuration_->removeStatistics();
     }
+    publish(SrvConfigPtr());
     configs_.clear();
     external_configs_.clear();
     D2ClientConfigPtr d2_default_conf(new D2ClientConfig());
@@ -81,13 +185,9 @@ void CfgMgr::commit() {
 
     ensureCurrentAllocated();
 
-    // First we need to remove statistics. The new configuration can have fewer
-    // subnets. Also, it may change subnet-ids. So we need to remove them all
-    // and add it back.
-    configuration_->removeStatistics();
-
+    SrvConfigPtr configuration = configuration_;
     if (!configs_.back()->sequenceEquals(*configuration_)) {
-        configuration_ = configs_.back();
+        configuration = configs_.back();
         // Keep track of the maximum size of the configs history. Before adding
         // new element, we have to remove the oldest one.
         if (configs_.size() > CONFIG_LIST_SIZE) {
@@ -99,10 +199,27 @@ void CfgMgr::commit() {
 
     // Set the last commit timestamp.
     auto now = boost::posix_time::second_clock::universal_time();
-    configuration_->setLastCommitTime(now);
+    configuration->setLastCommitTime(now);
 
-    // Now we need to set the statistics back.
-    configuration_->updateStatistics();
+    // Subnets are selected using indexes from now on.
+    configuration->buildSubnetSelectionIndexes();
+
+    // The resolved options refer to the options of this configuration.
+    configuration->getResolvedOptionsCache()->clear();
+
+    // The runtime option definitions staged while the configuration was
+    // parsed are installed together with it.
+    LibDHCP::commitRuntimeOptionDefs();
+
+    // Publish the new configuration. The packets being processed keep
+    // using the configuration they have pinned, see @c CfgSnapshot.
+    publish(configuration);
+
+    // Now we need to set the statistics back. The new configuration can
+    // have fewer subnets. Also, it may change subnet-ids. The statistics
+    // of the subnets which are no longer configured are removed when the
+    // last packet processed with the previous configuration is done.
+    configuration->updateStatistics();
 }
 
 void CfgMgr::rollback() {
@@ -146,6 +263,13 @@ void CfgMgr::revert(const size_t index) {
 
 SrvConfigPtr
 CfgMgr::getCurrentCfg() {
+    if (pinned_configuration) {
+        return (pinned_configuration->getConfiguration());
+    }
+    SrvConfigPtr configuration = std::atomic_load(&configuration_);
+    if (configuration) {
+        return (configuration);
+    }
     ensureCurrentAllocated();
     return (configuration_);
 }
@@ -184,9 +308,13 @@ void CfgMgr::mergeIntoCurrentCfg(const uint32_t seq) {
     } catch (...) {
         // Make sure the statistics is updated even if the merge failed.
         getCurrentCfg()->updateStatistics();
+        getCurrentCfg()->buildSubnetSelectionIndexes();
+        getCurrentCfg()->getResolvedOptionsCache()->clear();
         throw;
     }
     getCurrentCfg()->updateStatistics();
+    getCurrentCfg()->buildSubnetSelectionIndexes();
+    getCurrentCfg()->getResolvedOptionsCache()->clear();
 }
 
 void CfgMgr::mergeIntoCfg(const SrvConfigPtr& target_config, const uint32_t seq) {
@@ -214,5 +342,16 @@ CfgMgr::CfgMgr()
     }
 }
 
+CfgSnapshot::CfgSnapshot()
+    : previous_(pinned_configuration) {
+    if (!pinned_configuration) {
+        pinned_configuration = CfgMgr::instance().getCurrentPublication();
+    }
+}
+
+CfgSnapshot::~CfgSnapshot() {
+    pinned_configuration = previous_;
+}
+
 }  // namespace dhcp
 }  // namespace isc
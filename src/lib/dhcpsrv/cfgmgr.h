@@ -14,6 +14,7 @@
 #include <dhcpsrv/d2_client_mgr.h>
 #include <dhcpsrv/pool.h>
 #include <dhcpsrv/srv_config.h>
+#include <dhcpsrv/subnet_id.h>
 #include <util/buffer.h>
 #include <util/optional.h>
 
@@ -21,6 +22,8 @@
 
 #include <list>
 #include <map>
+#include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -66,6 +69,76 @@ public:
 /// Parameter inheritance is implemented in dedicated classes. See
 /// @ref isc::dhcp::SimpleParser4::deriveParameters and
 /// @ref isc::dhcp::SimpleParser6::deriveParameters.
+/// @brief Published configuration.
+///
+/// The configuration committed by @c CfgMgr is published together with
+/// this object, which the threads pinning the configuration with
+/// @c CfgSnapshot share. When a new configuration is committed, the
+/// statistics of the subnets which are no longer configured are removed
+/// when the last thread which has pinned the previous configuration is
+/// done with it, i.e. when this object is destroyed. Until then, the
+/// packets processed with the previous configuration can still update
+/// them. A replaced publication holds the one which replaced it, so the
+/// publications are destroyed in the order of the commits and a subnet
+/// which is still in a pinned configuration keeps its statistics.
+///
+/// The object is only modified by the thread committing the configuration,
+/// while it holds a reference to it.
+class CfgPublication;
+
+/// @brief Pointer to the published configuration.
+typedef std::shared_ptr<CfgPublication> CfgPublicationPtr;
+
+class CfgPublication : public boost::noncopyable {
+public:
+    /// @brief Constructor.
+    ///
+    /// @param configuration Published configuration.
+    explicit CfgPublication(const SrvConfigPtr& configuration);
+
+    /// @brief Destructor.
+    ///
+    /// Removes the statistics of the subnets marked by @c retire.
+    ~CfgPublication();
+
+    /// @brief Returns the published configuration.
+    SrvConfigPtr getConfiguration() const {
+        return (configuration_);
+    }
+
+    /// @brief Marks the configuration as replaced.
+    ///
+    /// @param next Publication of the new configuration, or null when the
+    /// configuration is cleared. The statistics of the subnets of this
+    /// configuration which are not in the new one are removed by the
+    /// destructor.
+    void retire(const CfgPublicationPtr& next);
+
+    /// @brief Keeps the statistics of the subnets of a configuration.
+    ///
+    /// Called when a configuration is committed while this one is still
+    /// pinned, so the destructor doesn't remove the statistics of the
+    /// subnets configured again.
+    ///
+    /// @param next New configuration.
+    void keep(const SrvConfig& next);
+
+private:
+    /// @brief Published configuration.
+    SrvConfigPtr configuration_;
+
+    /// @brief Publication which replaced this one.
+    CfgPublicationPtr next_;
+
+    /// @brief Identifiers of the DHCPv4 subnets which statistics are
+    /// removed by the destructor.
+    std::set<SubnetID> stale_subnets4_;
+
+    /// @brief Identifiers of the DHCPv6 subnets which statistics are
+    /// removed by the destructor.
+    std::set<SubnetID> stale_subnets6_;
+};
+
 class CfgMgr : public boost::noncopyable {
 public:
     /// @brief A number of configurations held by @c CfgMgr.
@@ -214,6 +287,11 @@ public:
     /// caution and one has to make sure that the configuration data integrity
     /// is preserved.
     ///
+    /// The current configuration is replaced atomically by @c commit, so
+    /// this function can be called by the packet processing threads while
+    /// a new configuration is committed. A thread which has pinned the
+    /// configuration using @c CfgSnapshot gets the pinned one.
+    ///
     /// @return Non-null pointer to the current configuration.
     SrvConfigPtr getCurrentCfg();
 
@@ -301,6 +379,25 @@ private:
     /// default current configuration.
     void ensureCurrentAllocated();
 
+    /// @brief Publishes the current configuration.
+    ///
+    /// The previous publication is retired before the new one is
+    /// published, see @c retire.
+    ///
+    /// @param configuration New current configuration, may be null.
+    void publish(const SrvConfigPtr& configuration);
+
+    /// @brief Returns the current publication.
+    ///
+    /// Allocates the current configuration if needed.
+    CfgPublicationPtr getCurrentPublication();
+
+    /// @brief Marks the previous publication as replaced.
+    ///
+    /// @param previous Previous publication, may be null.
+    /// @param next New publication, may be null.
+    void retire(const CfgPublicationPtr& previous, const CfgPublicationPtr& next);
+
     /// @brief Merges external configuration with the given sequence number
     /// into the specified configuration.
     ///
@@ -319,8 +416,20 @@ private:
     ///
     /// This is a structure that will hold all configuration.
     /// @todo: migrate all other parameters to that structure.
+    ///
+    /// The pointer is only replaced using atomic operations on the shared
+    /// pointer, because it is read by the packet processing threads.
     SrvConfigPtr configuration_;
 
+    /// @brief Publication of the current configuration.
+    ///
+    /// It is replaced together with @c configuration_, using atomic
+    /// operations on the shared pointer.
+    CfgPublicationPtr publication_;
+
+    /// @brief Replaced publications which may still be pinned.
+    std::list<std::weak_ptr<CfgPublication>> retired_publications_;
+
     /// @name Configuration List.
     ///
     //@{
@@ -344,6 +453,34 @@ private:
 
     /// @brief Address family.
     uint16_t family_;
+
+    friend class CfgSnapshot;
+};
+
+/// @brief Pins the current configuration for the calling thread.
+///
+/// While the object exists, @c CfgMgr::getCurrentCfg called by the thread
+/// returns the configuration which was current when the object was
+/// created, even if a new configuration is committed meanwhile. The packet
+/// processing creates it for every packet, so a packet is processed using
+/// a single configuration and picks up a new one at the packet boundary.
+/// The pinned configuration is kept alive until the object is destroyed,
+/// and so are the statistics of its subnets, see @c CfgPublication.
+class CfgSnapshot : public boost::noncopyable {
+public:
+    /// @brief Constructor.
+    ///
+    /// Pins the current configuration.
+    CfgSnapshot();
+
+    /// @brief Destructor.
+    ///
+    /// Restores the configuration pinned before, if any.
+    ~CfgSnapshot();
+
+private:
+    /// @brief Configuration pinned before this object was created.
+    CfgPublicationPtr previous_;
 };
 
 }  // namespace dhcp
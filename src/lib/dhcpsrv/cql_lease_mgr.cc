@@ -21,6 +21,7 @@
 #include <cql/cql_exchange.h>
 #include <cql/cql_transaction.h>
 #include <dhcpsrv/cql_lease_mgr.h>
+#include <dhcpsrv/lease_expiration_buckets.h>
 #include <dhcpsrv/utils.h>
 
 #include <dhcp/duid.h>
@@ -28,7 +29,12 @@
 
 #include <asiolink/io_address.h>
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <map>
 #include <mutex>
+#include <thread>
 
 using namespace isc::data;
 using namespace isc::db;
@@ -41,6 +47,9 @@ static constexpr size_t HOSTNAME_MAX_LEN = 255u;
 static constexpr size_t ADDRESS6_TEXT_MAX_LEN = 39u;
 static constexpr char NULL_USER_CONTEXT[] = "";
 
+/// @brief Maximum number of lease insertions in flight during a bulk insert.
+static constexpr size_t MAX_BULK_INSERT_ROWS = 100u;
+
 #ifdef CASSANDRA_DENORMALIZED_TABLES
 static const CassBlob NULL_HWADDR({0x00, 0x00, 0x00, 0x00, 0x00, 0x00});
 static const CassBlob NULL_CLIENTID({0x00, 0x00, 0x00, 0x00, 0x00, 0x00});
@@ -1480,6 +1489,7 @@ Lease4Ptr CqlLease4Exchange::retrieve() {
 #endif  // TERASTREAM
 
         result->state_ = state_;
+        result->old_state_ = state_;
 
         if (ctx) {
             result->setContext(ctx);
@@ -2821,6 +2831,7 @@ Lease6Ptr CqlLease6Exchange::retrieve() {
 #endif  // TERASTREAM
 
         result->state_ = state_;
+        result->old_state_ = state_;
 
         if (ctx) {
             result->setContext(ctx);
@@ -2905,11 +2916,554 @@ void CqlLease6Exchange::getExpiredLeases(const size_t &max_leases,
 #endif  // CASSANDRA_DENORMALIZED_TABLES
 }
 
+/// @brief Returns the counter of a lease.
+///
+/// @param lease the lease
+/// @return subnet, type and state of the lease
+static LeaseStatsRow leaseStatKey(Lease4 const &lease) {
+    return LeaseStatsRow(lease.subnet_id_, lease.state_, 0);
+}
+
+/// @brief Returns the counter of a lease.
+///
+/// @param lease the lease
+/// @return subnet, type and state of the lease
+static LeaseStatsRow leaseStatKey(Lease6 const &lease) {
+    return LeaseStatsRow(lease.subnet_id_, lease.type_, lease.state_, 0);
+}
+
+/// @brief Returns the counter of a lease as stored in the database.
+///
+/// @param lease the lease
+/// @return subnet, type and state of the lease before update
+static LeaseStatsRow oldLeaseStatKey(Lease4 const &lease) {
+    return LeaseStatsRow(lease.old_subnet_id_, lease.old_state_, 0);
+}
+
+/// @brief Returns the counter of a lease as stored in the database.
+///
+/// @param lease the lease
+/// @return subnet, type and state of the lease before update
+static LeaseStatsRow oldLeaseStatKey(Lease6 const &lease) {
+    return LeaseStatsRow(lease.old_subnet_id_, lease.type_, lease.old_state_, 0);
+}
+
+/// @brief Exchange of the lease statistics
+///
+/// Reads and updates the lease4_stat and lease6_stat delta counter
+/// tables, the lease4_stat_base and lease6_stat_base base counter tables
+/// and the lease_stat_status table, and counts the leases of a token range
+/// of the lease tables.
+struct CqlLeaseStatExchange : CqlExchange<LeaseStatsRow> {
+    /// @brief Values of the status column of lease_stat_status
+    /// @{
+    static constexpr cass_int32_t STATUS_REBUILDING = 0;
+    static constexpr cass_int32_t STATUS_READY = 1;
+    /// @}
+
+    /// @brief Constructor
+    ///
+    /// @param fetch_type Indicates whether or not lease_type should be
+    /// fetched from the result set (should be true for v6)
+    explicit CqlLeaseStatExchange(const bool fetch_type)
+        : fetch_type_(fetch_type), subnet_id_(0), lease_type_(0), state_(0), leases_(0) {
+    }
+
+    /// @brief Destructor
+    virtual ~CqlLeaseStatExchange() = default;
+
+    /// @brief Create BIND array to receive C++ data.
+    ///
+    /// The counters bind the leases column. A row of a lease table counts
+    /// one lease. The status of lease_stat_status is received in the
+    /// state of the returned row and its generation in the count.
+    ///
+    /// @param data array of bound objects representing data to be retrieved
+    /// @param statement_tag prepared statement being executed
+    void createBindForSelect(AnyArray &data,
+                             StatementTag const &statement_tag = StatementTag()) override final;
+
+    /// @brief Copy received data into the derived class' object.
+    ///
+    /// @return a pointer to the object retrieved.
+    LeaseStatsRowPtr retrieve() override final;
+
+    /// @brief Adds values to the counters of a lease family.
+    ///
+    /// The updates are sent together with @ref executeMutations.
+    ///
+    /// @param connection connection used to communicate with the Cassandra
+    ///     database
+    /// @param v6 true for the lease6_stat counters, false for lease4_stat
+    /// @param deltas values to add, by counter
+    /// @param generation generation of the base counters to add to, null
+    ///     to add to the delta counters
+    static void updateCounters(CqlConnection const &connection, const bool v6,
+                               const LeaseStatCounts &deltas,
+                               cass_int64_t const *generation = nullptr);
+
+    static StatementMap &tagged_statements() {
+        static StatementMap _{
+            // Return the IPv4 counters
+            {GET_LEASE4_STAT(),
+             {GET_LEASE4_STAT(), "SELECT "
+                                 "subnet_id, state, leases "
+                                 "FROM lease4_stat "}},
+
+            // Return the IPv6 counters
+            {GET_LEASE6_STAT(),
+             {GET_LEASE6_STAT(), "SELECT "
+                                 "subnet_id, lease_type, state, leases "
+                                 "FROM lease6_stat "}},
+
+            // Return the IPv4 base counters of a generation
+            {GET_LEASE4_STAT_BASE(),
+             {GET_LEASE4_STAT_BASE(), "SELECT "
+                                      "subnet_id, state, leases "
+                                      "FROM lease4_stat_base "
+                                      "WHERE generation = ? "}},
+
+            // Return the IPv6 base counters of a generation
+            {GET_LEASE6_STAT_BASE(),
+             {GET_LEASE6_STAT_BASE(), "SELECT "
+                                      "subnet_id, lease_type, state, leases "
+                                      "FROM lease6_stat_base "
+                                      "WHERE generation = ? "}},
+
+            // Add a value to an IPv4 base counter
+            {UPDATE_LEASE4_STAT_BASE(),
+             {UPDATE_LEASE4_STAT_BASE(), "UPDATE lease4_stat_base "
+                                         "SET leases = leases + ? "
+                                         "WHERE generation = ? "
+                                         "AND subnet_id = ? "
+                                         "AND state = ? "}},
+
+            // Add a value to an IPv6 base counter
+            {UPDATE_LEASE6_STAT_BASE(),
+             {UPDATE_LEASE6_STAT_BASE(), "UPDATE lease6_stat_base "
+                                         "SET leases = leases + ? "
+                                         "WHERE generation = ? "
+                                         "AND subnet_id = ? "
+                                         "AND lease_type = ? "
+                                         "AND state = ? "}},
+
+            // Drop the IPv4 base counters of a generation
+            {DELETE_LEASE4_STAT_BASE(),
+             {DELETE_LEASE4_STAT_BASE(), "DELETE FROM lease4_stat_base "
+                                         "WHERE generation = ? "}},
+
+            // Drop the IPv6 base counters of a generation
+            {DELETE_LEASE6_STAT_BASE(),
+             {DELETE_LEASE6_STAT_BASE(), "DELETE FROM lease6_stat_base "
+                                         "WHERE generation = ? "}},
+
+            // Add a value to an IPv4 counter
+            {UPDATE_LEASE4_STAT(),
+             {UPDATE_LEASE4_STAT(), "UPDATE lease4_stat "
+                                    "SET leases = leases + ? "
+                                    "WHERE subnet_id = ? "
+                                    "AND state = ? "}},
+
+            // Add a value to an IPv6 counter
+            {UPDATE_LEASE6_STAT(),
+             {UPDATE_LEASE6_STAT(), "UPDATE lease6_stat "
+                                    "SET leases = leases + ? "
+                                    "WHERE subnet_id = ? "
+                                    "AND lease_type = ? "
+                                    "AND state = ? "}},
+
+            // Return subnet_id and state of the v4 leases of a token range
+            {SCAN_LEASE4_STATS(),
+             {SCAN_LEASE4_STATS(), "SELECT "
+                                   "subnet_id, state "
+#ifdef CASSANDRA_DENORMALIZED_TABLES
+                                   "FROM lease4_address "
+#else  // CASSANDRA_DENORMALIZED_TABLES
+                                   "FROM lease4 "
+#endif  // CASSANDRA_DENORMALIZED_TABLES
+                                   "WHERE token(address) >= ? "
+                                   "AND token(address) <= ? "}},
+
+            // Return subnet_id, lease_type and state of the v6 leases of a
+            // token range
+            {SCAN_LEASE6_STATS(),
+             {SCAN_LEASE6_STATS(), "SELECT "
+                                   "subnet_id, lease_type, state "
+#ifdef CASSANDRA_DENORMALIZED_TABLES
+                                   "FROM lease6_address_leasetype "
+#else  // CASSANDRA_DENORMALIZED_TABLES
+                                   "FROM lease6 "
+#endif  // CASSANDRA_DENORMALIZED_TABLES
+                                   "WHERE token(address) >= ? "
+                                   "AND token(address) <= ? "}},
+
+            // Return the status of the counters of a lease family
+            {GET_LEASE_STAT_STATUS(),
+             {GET_LEASE_STAT_STATUS(), "SELECT "
+                                       "status, generation "
+                                       "FROM lease_stat_status "
+                                       "WHERE family = ? "}},
+
+            // Claim the rebuild of the counters of a lease family
+            {INSERT_LEASE_STAT_STATUS(),
+             {INSERT_LEASE_STAT_STATUS(), "INSERT INTO lease_stat_status "
+                                          "(family, status, generation) "
+                                          "VALUES (?, ?, ?) "
+                                          "IF NOT EXISTS "}},
+
+            // Set the status of the counters of a lease family
+            {UPDATE_LEASE_STAT_STATUS(),
+             {UPDATE_LEASE_STAT_STATUS(), "UPDATE lease_stat_status "
+                                          "SET status = ? "
+                                          "WHERE family = ? "}},
+
+            // Forget the status of the counters of a lease family
+            {DELETE_LEASE_STAT_STATUS(),
+             {DELETE_LEASE_STAT_STATUS(), "DELETE FROM lease_stat_status "
+                                          "WHERE family = ? "}},
+        };
+
+        return _;
+    }
+
+    /// @brief Statement tags
+    /// @{
+    // Return the IPv4 counters
+    static StatementTag &GET_LEASE4_STAT() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Return the IPv6 counters
+    static StatementTag &GET_LEASE6_STAT() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Return the IPv4 base counters of a generation
+    static StatementTag &GET_LEASE4_STAT_BASE() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Return the IPv6 base counters of a generation
+    static StatementTag &GET_LEASE6_STAT_BASE() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Add a value to an IPv4 base counter
+    static StatementTag &UPDATE_LEASE4_STAT_BASE() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Add a value to an IPv6 base counter
+    static StatementTag &UPDATE_LEASE6_STAT_BASE() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Drop the IPv4 base counters of a generation
+    static StatementTag &DELETE_LEASE4_STAT_BASE() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Drop the IPv6 base counters of a generation
+    static StatementTag &DELETE_LEASE6_STAT_BASE() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Add a value to an IPv4 counter
+    static StatementTag &UPDATE_LEASE4_STAT() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Add a value to an IPv6 counter
+    static StatementTag &UPDATE_LEASE6_STAT() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Return the v4 leases of a token range
+    static StatementTag &SCAN_LEASE4_STATS() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Return the v6 leases of a token range
+    static StatementTag &SCAN_LEASE6_STATS() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Return the status of the counters
+    static StatementTag &GET_LEASE_STAT_STATUS() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Claim the rebuild of the counters
+    static StatementTag &INSERT_LEASE_STAT_STATUS() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Set the status of the counters
+    static StatementTag &UPDATE_LEASE_STAT_STATUS() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Forget the status of the counters
+    static StatementTag &DELETE_LEASE_STAT_STATUS() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    /// @}
+
+private:
+    /// @brief fetch from the result set? (should be true for v6)
+    bool fetch_type_;
+
+    /// @brief Subnet identifier
+    cass_int32_t subnet_id_;
+
+    /// @brief Lease type (NA, TA or PD)
+    cass_int32_t lease_type_;
+
+    /// @brief Lease state, or status of the counters
+    cass_int32_t state_;
+
+    /// @brief Number of leases
+    cass_int64_t leases_;
+};
+
+void CqlLeaseStatExchange::createBindForSelect(AnyArray &data, StatementTag const &statement_tag) {
+    // Start with a fresh array.
+    data.clear();
+
+    // The lease type is always NA for v4 and a row of a lease table
+    // counts one lease.
+    lease_type_ = Lease::TYPE_NA;
+    leases_ = 1;
+
+    // status: int, generation: bigint
+    if (statement_tag == GET_LEASE_STAT_STATUS()) {
+        data.add(&state_);
+        data.add(&leases_);
+        return;
+    }
+
+    // subnet_id: int
+    data.add(&subnet_id_);
+
+    // lease_type: int
+    if (fetch_type_) {
+        data.add(&lease_type_);
+    }
+
+    // state: int
+    data.add(&state_);
+
+    // leases: counter
+    if (statement_tag == GET_LEASE4_STAT() || statement_tag == GET_LEASE6_STAT() ||
+        statement_tag == GET_LEASE4_STAT_BASE() || statement_tag == GET_LEASE6_STAT_BASE()) {
+        data.add(&leases_);
+    }
+}
+
+LeaseStatsRowPtr CqlLeaseStatExchange::retrieve() {
+    return std::make_shared<LeaseStatsRow>(subnet_id_, static_cast<Lease::Type>(lease_type_),
+                                           state_, leases_);
+}
+
+void CqlLeaseStatExchange::updateCounters(CqlConnection const &connection, const bool v6,
+                                          const LeaseStatCounts &deltas,
+                                          cass_int64_t const *generation) {
+    if (deltas.empty()) {
+        return;
+    }
+
+    // The bound values point to the elements of these vectors, so they
+    // are sized before any value is bound.
+    std::vector<cass_int64_t> values;
+    std::vector<cass_int32_t> subnet_ids;
+    std::vector<cass_int32_t> lease_types;
+    std::vector<cass_int32_t> states;
+    values.reserve(deltas.size());
+    subnet_ids.reserve(deltas.size());
+    lease_types.reserve(deltas.size());
+    states.reserve(deltas.size());
+    cass_int64_t generation_value(generation ? *generation : 0);
+
+    std::vector<AnyArray> data;
+    for (auto const &delta : deltas) {
+        values.push_back(static_cast<cass_int64_t>(delta.second));
+        subnet_ids.push_back(static_cast<cass_int32_t>(delta.first.subnet_id_));
+        lease_types.push_back(static_cast<cass_int32_t>(delta.first.lease_type_));
+        states.push_back(static_cast<cass_int32_t>(delta.first.lease_state_));
+
+        AnyArray assigned{&values.back()};
+        if (generation) {
+            assigned.add(&generation_value);
+        }
+        assigned.add(&subnet_ids.back());
+        if (v6) {
+            assigned.add(&lease_types.back());
+        }
+        assigned.add(&states.back());
+        data.push_back(assigned);
+    }
+
+    StatementTag const &statement_tag =
+        generation ? (v6 ? UPDATE_LEASE6_STAT_BASE() : UPDATE_LEASE4_STAT_BASE())
+                   : (v6 ? UPDATE_LEASE6_STAT() : UPDATE_LEASE4_STAT());
+    CqlLeaseStatExchange exchange(v6);
+    exchange.executeMutations(connection, data, statement_tag);
+}
+
+/// @brief Lease statistics queries of the Cassandra backend
+///
+/// Gives @ref LeaseStatCollector access to the counters and to the token
+/// ranges of the lease table of one lease family.
+///
+/// The generation of the base counters is read with the status, or picked
+/// when the rebuild is claimed. It is the current time in microseconds, so
+/// a rebuild given up and claimed again gets a fresh generation.
+struct CqlLeaseStatSource : LeaseStatSource {
+    /// @brief Constructor
+    ///
+    /// @param connection An open connection to the database housing the lease data
+    /// @param v6 true for the IPv6 leases, false for the IPv4 leases
+    CqlLeaseStatSource(CqlConnection const &connection, const bool v6)
+        : connection_(connection), v6_(v6), family_(v6 ? 6 : 4), generation_(0) {
+    }
+
+    /// @brief Returns the state of the counter table.
+    ///
+    /// Also reads the generation of the base counters.
+    CounterStatus getCounterStatus() override final {
+        cass_int32_t family(family_);
+        AnyArray where{&family};
+        CqlLeaseStatExchange exchange(v6_);
+        Collection<LeaseStatsRow> rows =
+            exchange.executeSelect(connection_, where,
+                                   CqlLeaseStatExchange::GET_LEASE_STAT_STATUS(), true);
+        if (rows.empty()) {
+            return (COUNTERS_ABSENT);
+        }
+        generation_ = rows.front()->state_count_;
+        if (rows.front()->lease_state_ == CqlLeaseStatExchange::STATUS_READY) {
+            return (COUNTERS_READY);
+        }
+        return (COUNTERS_REBUILDING);
+    }
+
+    /// @brief Marks the absent counters as being rebuilt.
+    bool claimCounterRebuild() override final {
+        cass_int32_t family(family_);
+        cass_int32_t status(CqlLeaseStatExchange::STATUS_REBUILDING);
+        generation_ = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        AnyArray data{&family, &status, &generation_};
+        CqlLeaseStatExchange exchange(v6_);
+        try {
+            exchange.executeMutation(connection_, data,
+                                     CqlLeaseStatExchange::INSERT_LEASE_STAT_STATUS());
+#ifdef TERASTREAM_FULL_TRANSACTIONS
+        } catch (TransactionException const &) {
+#else  // TERASTREAM_FULL_TRANSACTIONS
+        } catch (StatementNotApplied const &) {
+#endif  // TERASTREAM_FULL_TRANSACTIONS
+            return (false);
+        }
+        return (true);
+    }
+
+    /// @brief Marks the counters as absent again after a failed rebuild.
+    void abortCounterRebuild() override final {
+        AnyArray generation{&generation_};
+        CqlLeaseStatExchange base_exchange(v6_);
+        base_exchange.executeMutation(connection_, generation,
+                                      v6_ ? CqlLeaseStatExchange::DELETE_LEASE6_STAT_BASE()
+                                          : CqlLeaseStatExchange::DELETE_LEASE4_STAT_BASE());
+
+        cass_int32_t family(family_);
+        AnyArray where{&family};
+        CqlLeaseStatExchange exchange(v6_);
+        exchange.executeMutation(connection_, where,
+                                 CqlLeaseStatExchange::DELETE_LEASE_STAT_STATUS());
+    }
+
+    /// @brief Marks the counters as up to date.
+    void setCountersReady() override final {
+        cass_int32_t status(CqlLeaseStatExchange::STATUS_READY);
+        cass_int32_t family(family_);
+        AnyArray data{&status, &family};
+        CqlLeaseStatExchange exchange(v6_);
+        exchange.executeMutation(connection_, data,
+                                 CqlLeaseStatExchange::UPDATE_LEASE_STAT_STATUS());
+    }
+
+    /// @brief Reads all counters.
+    void readCounters(LeaseStatCounts &counts) override final {
+        AnyArray where{&generation_};
+        CqlLeaseStatExchange exchange(v6_);
+        Collection<LeaseStatsRow> rows = exchange.executeSelect(
+            connection_, where,
+            v6_ ? CqlLeaseStatExchange::GET_LEASE6_STAT_BASE()
+                : CqlLeaseStatExchange::GET_LEASE4_STAT_BASE());
+        for (LeaseStatsRowPtr const &row : rows) {
+            counts[*row] += row->state_count_;
+        }
+        readDeltaCounters(counts);
+    }
+
+    /// @brief Reads the delta counters.
+    void readDeltaCounters(LeaseStatCounts &counts) override final {
+        AnyArray where;
+        CqlLeaseStatExchange exchange(v6_);
+        Collection<LeaseStatsRow> rows = exchange.executeSelect(
+            connection_, where,
+            v6_ ? CqlLeaseStatExchange::GET_LEASE6_STAT() : CqlLeaseStatExchange::GET_LEASE4_STAT());
+        for (LeaseStatsRowPtr const &row : rows) {
+            counts[*row] += row->state_count_;
+        }
+    }
+
+    /// @brief Adds values to the base counters of the claimed generation.
+    void addToBaseCounters(const LeaseStatCounts &values) override final {
+        CqlLeaseStatExchange::updateCounters(connection_, v6_, values, &generation_);
+    }
+
+    /// @brief Counts the leases stored in a token range.
+    void scanTokenRange(const TokenRange &range, LeaseStatCounts &counts) override final {
+        cass_int64_t first(range.first);
+        cass_int64_t last(range.second);
+        AnyArray where{&first, &last};
+        CqlLeaseStatExchange exchange(v6_);
+        Collection<LeaseStatsRow> rows = exchange.executeSelect(
+            connection_, where,
+            v6_ ? CqlLeaseStatExchange::SCAN_LEASE6_STATS()
+                : CqlLeaseStatExchange::SCAN_LEASE4_STATS());
+        for (LeaseStatsRowPtr const &row : rows) {
+            counts[*row] += row->state_count_;
+        }
+    }
+
+private:
+    /// @brief Database connection
+    CqlConnection const &connection_;
+
+    /// @brief IPv6 leases?
+    bool v6_;
+
+    /// @brief Lease family of the lease_stat_status row
+    cass_int32_t family_;
+
+    /// @brief Generation of the base counters
+    cass_int64_t generation_;
+};
+
 /// @brief Base CQL derivation of the statistical lease data query
 ///
 /// This class provides the functionality such as results storage and row
 /// fetching common to fulfilling the statistical lease data query.
 ///
+/// The statistics of all subnets and of a range of subnets are collected
+/// by a @ref LeaseStatCollector, from the counters when they are enabled
+/// and up to date, by a parallel scan of the token ring otherwise. The
+/// statistics of a single subnet are read from the counters when they
+/// are up to date and selected by subnet otherwise.
 struct CqlLeaseStatsQuery : LeaseStatsQuery, CqlExchange<LeaseStatsRow> {
     /// @brief Constructor to query for all subnets' stats
     ///
@@ -2917,14 +3471,17 @@ struct CqlLeaseStatsQuery : LeaseStatsQuery, CqlExchange<LeaseStatsRow> {
     ///
     /// @param connection An open connection to the database housing the lease data
     /// @param statement The lease data SQL prepared statement tag to execute
+    ///     when the statistics are selected by subnet
     /// @param fetch_type Indicates whether or not lease_type should be
     /// fetched from the result set (should be true for v6)
+    /// @param use_counters Whether the lease statistics counters are enabled
     CqlLeaseStatsQuery(CqlConnection &connection,
                        StatementTag const &statement,
-                       const bool fetch_type)
+                       const bool fetch_type,
+                       const bool use_counters)
         : connection_(connection), statement_(statement), fetch_type_(fetch_type),
-          cummulative_rows_(), next_row_(cummulative_rows_.begin()), subnet_id_(0), lease_type_(0),
-          state_(0) {
+          use_counters_(use_counters), cummulative_rows_(),
+          next_row_(cummulative_rows_.begin()), subnet_id_(0), lease_type_(0), state_(0) {
     }
 
     /// @brief Constructor to query for a single subnet's stats
@@ -2933,16 +3490,19 @@ struct CqlLeaseStatsQuery : LeaseStatsQuery, CqlExchange<LeaseStatsRow> {
     ///
     /// @param connection An open connection to the database housing the lease data
     /// @param statement The lease data SQL prepared statement tag to execute
+    ///     when the statistics are selected by subnet
     /// @param fetch_type Indicates whether or not lease_type should be
     /// fetched from the result set (should be true for v6)
+    /// @param use_counters Whether the lease statistics counters are enabled
     /// @param subnet_id id of the subnet for which stats are desired
     CqlLeaseStatsQuery(CqlConnection &connection,
                        StatementTag const &statement,
                        const bool fetch_type,
+                       const bool use_counters,
                        const SubnetID &subnet_id)
         : LeaseStatsQuery(subnet_id), connection_(connection), statement_(statement),
-          fetch_type_(fetch_type), cummulative_rows_(), next_row_(cummulative_rows_.begin()),
-          subnet_id_(0), lease_type_(0), state_(0) {
+          fetch_type_(fetch_type), use_counters_(use_counters), cummulative_rows_(),
+          next_row_(cummulative_rows_.begin()), subnet_id_(0), lease_type_(0), state_(0) {
     }
 
     /// @brief Constructor to query for the stats for a range of subnets
@@ -2952,18 +3512,22 @@ struct CqlLeaseStatsQuery : LeaseStatsQuery, CqlExchange<LeaseStatsRow> {
     ///
     /// @param connection An open connection to the database housing the lease data
     /// @param statement The lease data SQL prepared statement tag to execute
+    ///     when the statistics are selected by subnet
     /// @param fetch_type Indicates whether or not lease_type should be
     /// fetched from the result set (should be true for v6)
+    /// @param use_counters Whether the lease statistics counters are enabled
     /// @param first_subnet_id first subnet in the range of subnets
     /// @param last_subnet_id last subnet in the range of subnets
     CqlLeaseStatsQuery(CqlConnection &connection,
                        StatementTag const &statement,
                        const bool fetch_type,
+                       const bool use_counters,
                        const SubnetID &first_subnet_id,
                        const SubnetID &last_subnet_id)
         : LeaseStatsQuery(first_subnet_id, last_subnet_id), connection_(connection),
-          statement_(statement), fetch_type_(fetch_type), cummulative_rows_(),
-          next_row_(cummulative_rows_.begin()), subnet_id_(0), lease_type_(0), state_(0) {
+          statement_(statement), fetch_type_(fetch_type), use_counters_(use_counters),
+          cummulative_rows_(), next_row_(cummulative_rows_.begin()), subnet_id_(0),
+          lease_type_(0), state_(0) {
     }
 
     /// @brief Destructor
@@ -2971,10 +3535,10 @@ struct CqlLeaseStatsQuery : LeaseStatsQuery, CqlExchange<LeaseStatsRow> {
 
     /// @brief Creates the lease statistical data result set
     ///
-    /// The result set is populated by executing a  prepared SQL query
-    /// against the database which sums the leases per lease state per
-    /// subnet id.  Positions internal row tracking to point to the
-    /// first row of the aggregate results.
+    /// The result set is populated from the counters, from a scan of the
+    /// token ring or by executing a prepared SQL query, which sums the
+    /// leases per lease state per subnet id. Positions internal row
+    /// tracking to point to the first row of the aggregate results.
     void start() override final;
 
     /// @brief Fetches the next row in the result set
@@ -3011,12 +3575,6 @@ struct CqlLeaseStatsQuery : LeaseStatsQuery, CqlExchange<LeaseStatsRow> {
 
     static StatementMap &tagged_statements() {
         static StatementMap _{
-            // Return subnet_id and state of each v4 lease
-            {ALL_LEASE4_STATS(),
-             {ALL_LEASE4_STATS(), "SELECT "
-                                  "subnet_id, state "
-                                  "FROM lease4 "}},
-
             // Return state of each v4 lease for a single subnet
             {SUBNET_LEASE4_STATS(),
              {SUBNET_LEASE4_STATS(), "SELECT "
@@ -3024,42 +3582,12 @@ struct CqlLeaseStatsQuery : LeaseStatsQuery, CqlExchange<LeaseStatsRow> {
                                      "FROM lease4 "
                                      "WHERE subnet_id = ? "}},
 
-            // Return state of each v4 lease for a subnet range
-            {SUBNET_RANGE_LEASE4_STATS(),
-             {SUBNET_RANGE_LEASE4_STATS(), "SELECT "
-                                           "subnet_id, state "
-                                           "FROM lease4 "
-                                           "WHERE subnet_id >= ? and subnet_id <= ? "
-#ifdef CASSANDRA_DENORMALIZED_TABLES
-#else  // CASSANDRA_DENORMALIZED_TABLES
-                                           "ALLOW FILTERING "
-#endif  // CASSANDRA_DENORMALIZED_TABLES
-             }},
-
-            // Return subnet_id, lease_type, and state of each v6 lease
-            {ALL_LEASE6_STATS(),
-             {ALL_LEASE6_STATS(), "SELECT "
-                                  "subnet_id, lease_type, state "
-                                  "FROM lease6 "}},
-
             // Return type and state of each v6 lease for a single subnet
             {SUBNET_LEASE6_STATS(),
              {SUBNET_LEASE6_STATS(), "SELECT "
                                      "subnet_id, lease_type, state "
                                      "FROM lease6 "
                                      "WHERE subnet_id = ? "}},
-
-            // Return type and state of each v6 lease for single range
-            {SUBNET_RANGE_LEASE6_STATS(),
-             {SUBNET_RANGE_LEASE6_STATS(), "SELECT "
-                                           "subnet_id, lease_type, state "
-                                           "FROM lease6 "
-                                           "WHERE subnet_id >= ? and subnet_id <= ? "
-#ifdef CASSANDRA_DENORMALIZED_TABLES
-#else  // CASSANDRA_DENORMALIZED_TABLES
-                                           "ALLOW FILTERING "
-#endif  // CASSANDRA_DENORMALIZED_TABLES
-             }},
         };
 
         return _;
@@ -3067,39 +3595,36 @@ struct CqlLeaseStatsQuery : LeaseStatsQuery, CqlExchange<LeaseStatsRow> {
 
     /// @brief Statement tags
     /// @{
-    // Return lease4 lease statistics for all subnets
-    static StatementTag &ALL_LEASE4_STATS() {
-        static StatementTag _(FUNCTION_NAME());
-        return _;
-    }
     /// Return lease4 lease statistics for a single subnet
     static StatementTag &SUBNET_LEASE4_STATS() {
         static StatementTag _(FUNCTION_NAME());
         return _;
     }
-    /// Return lease4 lease statistics for a range of subnets
-    static StatementTag &SUBNET_RANGE_LEASE4_STATS() {
-        static StatementTag _(FUNCTION_NAME());
-        return _;
-    }
-    // Return lease6 lease statistics for all subnets
-    static StatementTag &ALL_LEASE6_STATS() {
-        static StatementTag _(FUNCTION_NAME());
-        return _;
-    }
     /// Return lease6 lease statistics for a single subnet
     static StatementTag &SUBNET_LEASE6_STATS() {
         static StatementTag _(FUNCTION_NAME());
         return _;
     }
-    /// Return lease6 lease statistics for a range of subnets
-    static StatementTag &SUBNET_RANGE_LEASE6_STATS() {
-        static StatementTag _(FUNCTION_NAME());
-        return _;
-    }
     /// @}
 
+    /// @brief Number of threads scanning the token ring
+    static size_t scanThreadCount() {
+        return (std::min(16u, std::max(1u, std::thread::hardware_concurrency())));
+    }
+
+    /// @brief Number of token ranges the ring is scanned in
+    static constexpr size_t SCAN_RANGE_COUNT = 256u;
+
 private:
+    /// @brief Adds a row to the result set if it is to be reported
+    ///
+    /// Only the leases in the default and declined states of the selected
+    /// subnets are reported.
+    ///
+    /// @param row Subnet, type and state of the leases
+    /// @param count Number of leases
+    void addRow(LeaseStatsRow const &row, int64_t const count);
+
     /// @brief Database connection
     CqlConnection const &connection_;
 
@@ -3109,11 +3634,14 @@ private:
     /// @brief fetch from the result set? (should be true for v6)
     bool fetch_type_;
 
+    /// @brief Are the lease statistics counters enabled?
+    bool use_counters_;
+
     /// @brief map containing the aggregated lease counts
-    std::map<LeaseStatsRow, int> cummulative_rows_;
+    std::map<LeaseStatsRow, int64_t> cummulative_rows_;
 
     /// @brief cursor pointing to the next row to read in aggregate map
-    std::map<LeaseStatsRow, int>::iterator next_row_;
+    std::map<LeaseStatsRow, int64_t>::iterator next_row_;
 
     /// @brief Subnet identifier
     cass_int32_t subnet_id_;
@@ -3126,40 +3654,57 @@ private:
 };
 
 void CqlLeaseStatsQuery::start() {
-    // Set up where clause parameters as needed
-    AnyArray data;
-    cass_int32_t first_subnet_id_data;
-    cass_int32_t last_subnet_id_data;
-    if (getSelectMode() != ALL_SUBNETS) {
-        first_subnet_id_data = static_cast<cass_int32_t>(first_subnet_id_);
-        data.add(&first_subnet_id_data);
-
-        if (getSelectMode() == SUBNET_RANGE) {
-            last_subnet_id_data = static_cast<cass_int32_t>(last_subnet_id_);
-            data.add(&last_subnet_id_data);
+    CqlLeaseStatSource source(connection_, fetch_type_);
+
+    // A single subnet is selected by subnet, unless the counters can be
+    // read. The other queries would have to go through the whole table.
+    if ((getSelectMode() == SINGLE_SUBNET) &&
+        (!use_counters_ ||
+         (source.getCounterStatus() != LeaseStatSource::COUNTERS_READY))) {
+        cass_int32_t subnet_id_data(static_cast<cass_int32_t>(first_subnet_id_));
+        AnyArray data{&subnet_id_data};
+        Collection<LeaseStatsRow> collection = executeSelect(connection_, data, statement_);
+        for (LeaseStatsRowPtr &stats : collection) {
+            addRow(*stats, 1);
         }
-    }
-    Collection<LeaseStatsRow> collection = executeSelect(connection_, data, statement_);
 
-    // Form LeaseStatsRowPtr objects.
-    for (LeaseStatsRowPtr &stats : collection) {
-        if (stats->lease_state_ != Lease::STATE_DEFAULT &&
-            stats->lease_state_ != Lease::STATE_DECLINED) {
-            continue;
-        }
-        auto cum_row = cummulative_rows_.find(*stats);
-        if (cum_row != cummulative_rows_.end()) {
-            cummulative_rows_[*stats] = cum_row->second + 1;
-        } else {
-            cummulative_rows_.insert(std::make_pair(*stats, 1));
+    } else {
+        LeaseStatCollector collector(source, use_counters_, scanThreadCount(), SCAN_RANGE_COUNT);
+        LeaseStatCounts const counts(collector.collect());
+        for (auto const &count : counts) {
+            addRow(count.first, count.second);
         }
+
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_CQL_LEASE_STATS_COLLECTED)
+            .arg(fetch_type_ ? 6 : 4)
+            .arg(collector.getMethod() == LeaseStatCollector::COUNTERS ? "counters" :
+                 (collector.getMethod() == LeaseStatCollector::REBUILD ? "rebuild" : "scan"));
     }
 
     // Set our row iterator to the beginning
     next_row_ = cummulative_rows_.begin();
 }
 
+void CqlLeaseStatsQuery::addRow(LeaseStatsRow const &row, int64_t const count) {
+    if (row.lease_state_ != Lease::STATE_DEFAULT &&
+        row.lease_state_ != Lease::STATE_DECLINED) {
+        return;
+    }
+    if ((getSelectMode() != ALL_SUBNETS) &&
+        ((row.subnet_id_ < first_subnet_id_) ||
+         (row.subnet_id_ > (getSelectMode() == SUBNET_RANGE ? last_subnet_id_
+                                                            : first_subnet_id_)))) {
+        return;
+    }
+    cummulative_rows_[row] += count;
+}
+
 bool CqlLeaseStatsQuery::getNextRow(LeaseStatsRow &row) {
+    // Skip the counters which went down to zero.
+    while (next_row_ != cummulative_rows_.end() && next_row_->second <= 0) {
+        ++next_row_;
+    }
+
     // If we're past the end, punt.
     if (next_row_ == cummulative_rows_.end()) {
         return (false);
@@ -3202,20 +3747,679 @@ LeaseStatsRowPtr CqlLeaseStatsQuery::retrieve() {
                                            state_, 1);
 }
 
-CqlLeaseMgr::CqlLeaseMgr(const DatabaseConnection::ParameterMap &parameters)
-    : parameters_(parameters), connection_(parameters)
-#ifdef TERASTREAM_LOCK
-      ,
-      lock_mgr4_(connection_), lock_mgr6_(connection_)
-#endif  // TERASTREAM_LOCK
-{
-    CqlVersionExchange<isc::db::OperationalVersionTuple> version_exchange;
-    version_exchange.validateSchema(connection_);
+/// @brief Row of the expiration index
+///
+/// Also holds a cursor of lease_expiration_cursor or a lease of a token
+/// range scan.
+struct LeaseExpirationRow {
+    /// @brief Address of the lease
+    IOAddress address_ = IOAddress::IPV4_ZERO_ADDRESS();
 
-    // Now prepare the rest of the exchanges.
-#ifdef TERASTREAM_FULL_TRANSACTIONS
-    connection_.setTransactionOperations(CqlTransactionExchange::BEGIN_TXN,
-                                         CqlTransactionExchange::COMMIT_TXN,
+    /// @brief Lease type, always NA for v4
+    Lease::Type lease_type_ = Lease::TYPE_NA;
+
+    /// @brief Bucket of the entry or of the cursor
+    int64_t bucket_ = 0;
+
+    /// @brief Expiration time of the lease
+    int64_t expire_ = 0;
+
+    /// @brief Lease state
+    uint32_t state_ = Lease::STATE_DEFAULT;
+};
+
+/// @brief Exchange of the expiration index
+///
+/// Reads and updates the lease4_expiration and lease6_expiration tables
+/// and the lease_expiration_cursor table, and reads the expiration times of
+/// a token range of the lease tables.
+struct CqlLeaseExpirationExchange : CqlExchange<LeaseExpirationRow> {
+    /// @brief Cursor of the leases to reclaim while the index is rebuilt
+    static constexpr cass_int64_t CURSOR_REBUILDING = std::numeric_limits<cass_int64_t>::min();
+
+    /// @brief Constructor
+    ///
+    /// @param v6 true for the IPv6 tables, false for the IPv4 tables
+    explicit CqlLeaseExpirationExchange(const bool v6)
+        : v6_(v6), address4_(0), lease_type_(Lease::TYPE_NA), bucket_(0), expire_(0),
+          state_(0) {
+    }
+
+    /// @brief Destructor
+    virtual ~CqlLeaseExpirationExchange() = default;
+
+    /// @brief Create BIND array to receive C++ data.
+    ///
+    /// @param data array of bound objects representing data to be retrieved
+    /// @param statement_tag prepared statement being executed
+    void createBindForSelect(AnyArray &data,
+                             StatementTag const &statement_tag = StatementTag()) override final;
+
+    /// @brief Copy received data into the derived class' object.
+    ///
+    /// @return a pointer to the object retrieved.
+    Ptr<LeaseExpirationRow> retrieve() override final;
+
+    /// @brief Inserts entries in the index of a lease family.
+    ///
+    /// The insertions are sent together with @ref executeMutations.
+    ///
+    /// @param connection connection used to communicate with the Cassandra
+    ///     database
+    /// @param v6 true for lease6_expiration, false for lease4_expiration
+    /// @param rows address, lease type, bucket and state of the entries
+    static void insertEntries(CqlConnection const &connection, const bool v6,
+                              const std::vector<LeaseExpirationRow> &rows);
+
+    static StatementMap &tagged_statements() {
+        static StatementMap _{
+            // Return the addresses of an IPv4 bucket
+            {GET_LEASE4_EXPIRATION(),
+             {GET_LEASE4_EXPIRATION(), "SELECT "
+                                       "address "
+                                       "FROM lease4_expiration "
+                                       "WHERE reclaimed = ? "
+                                       "AND bucket = ? "}},
+
+            // Return the addresses and lease types of an IPv6 bucket
+            {GET_LEASE6_EXPIRATION(),
+             {GET_LEASE6_EXPIRATION(), "SELECT "
+                                       "address, lease_type "
+                                       "FROM lease6_expiration "
+                                       "WHERE reclaimed = ? "
+                                       "AND bucket = ? "}},
+
+            // Add an IPv4 entry
+            {INSERT_LEASE4_EXPIRATION(),
+             {INSERT_LEASE4_EXPIRATION(), "INSERT INTO lease4_expiration "
+                                          "(reclaimed, bucket, address) "
+                                          "VALUES (?, ?, ?) "}},
+
+            // Add an IPv6 entry
+            {INSERT_LEASE6_EXPIRATION(),
+             {INSERT_LEASE6_EXPIRATION(), "INSERT INTO lease6_expiration "
+                                          "(reclaimed, bucket, address, lease_type) "
+                                          "VALUES (?, ?, ?, ?) "}},
+
+            // Delete an IPv4 entry
+            {DELETE_LEASE4_EXPIRATION(),
+             {DELETE_LEASE4_EXPIRATION(), "DELETE FROM lease4_expiration "
+                                          "WHERE reclaimed = ? "
+                                          "AND bucket = ? "
+                                          "AND address = ? "}},
+
+            // Delete an IPv6 entry
+            {DELETE_LEASE6_EXPIRATION(),
+             {DELETE_LEASE6_EXPIRATION(), "DELETE FROM lease6_expiration "
+                                          "WHERE reclaimed = ? "
+                                          "AND bucket = ? "
+                                          "AND address = ? "}},
+
+            // Return address, expire and state of the v4 leases of a token
+            // range
+            {SCAN_LEASE4_EXPIRATION(),
+             {SCAN_LEASE4_EXPIRATION(), "SELECT "
+                                        "address, expire, state "
+#ifdef CASSANDRA_DENORMALIZED_TABLES
+                                        "FROM lease4_address "
+#else  // CASSANDRA_DENORMALIZED_TABLES
+                                        "FROM lease4 "
+#endif  // CASSANDRA_DENORMALIZED_TABLES
+                                        "WHERE token(address) >= ? "
+                                        "AND token(address) <= ? "}},
+
+            // Return address, lease_type, expire and state of the v6 leases
+            // of a token range
+            {SCAN_LEASE6_EXPIRATION(),
+             {SCAN_LEASE6_EXPIRATION(), "SELECT "
+                                        "address, lease_type, expire, state "
+#ifdef CASSANDRA_DENORMALIZED_TABLES
+                                        "FROM lease6_address_leasetype "
+#else  // CASSANDRA_DENORMALIZED_TABLES
+                                        "FROM lease6 "
+#endif  // CASSANDRA_DENORMALIZED_TABLES
+                                        "WHERE token(address) >= ? "
+                                        "AND token(address) <= ? "}},
+
+            // Return a cursor
+            {GET_LEASE_EXPIRATION_CURSOR(),
+             {GET_LEASE_EXPIRATION_CURSOR(), "SELECT "
+                                             "bucket "
+                                             "FROM lease_expiration_cursor "
+                                             "WHERE family = ? "
+                                             "AND reclaimed = ? "}},
+
+            // Claim the rebuild of the index of a lease family
+            {INSERT_LEASE_EXPIRATION_CURSOR(),
+             {INSERT_LEASE_EXPIRATION_CURSOR(), "INSERT INTO lease_expiration_cursor "
+                                                "(family, reclaimed, bucket) "
+                                                "VALUES (?, ?, ?) "
+                                                "IF NOT EXISTS "}},
+
+            // Set a cursor
+            {UPDATE_LEASE_EXPIRATION_CURSOR(),
+             {UPDATE_LEASE_EXPIRATION_CURSOR(), "UPDATE lease_expiration_cursor "
+                                                "SET bucket = ? "
+                                                "WHERE family = ? "
+                                                "AND reclaimed = ? "}},
+
+            // Move a cursor which has not moved since it was read
+            {MOVE_LEASE_EXPIRATION_CURSOR(),
+             {MOVE_LEASE_EXPIRATION_CURSOR(), "UPDATE lease_expiration_cursor "
+                                              "SET bucket = ? "
+                                              "WHERE family = ? "
+                                              "AND reclaimed = ? "
+                                              "IF bucket = ? "}},
+
+            // Forget the cursors of a lease family
+            {DELETE_LEASE_EXPIRATION_CURSOR(),
+             {DELETE_LEASE_EXPIRATION_CURSOR(), "DELETE FROM lease_expiration_cursor "
+                                                "WHERE family = ? "}},
+        };
+
+        return _;
+    }
+
+    /// @brief Statement tags
+    /// @{
+    // Return the addresses of an IPv4 bucket
+    static StatementTag &GET_LEASE4_EXPIRATION() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Return the addresses of an IPv6 bucket
+    static StatementTag &GET_LEASE6_EXPIRATION() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Add an IPv4 entry
+    static StatementTag &INSERT_LEASE4_EXPIRATION() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Add an IPv6 entry
+    static StatementTag &INSERT_LEASE6_EXPIRATION() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Delete an IPv4 entry
+    static StatementTag &DELETE_LEASE4_EXPIRATION() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Delete an IPv6 entry
+    static StatementTag &DELETE_LEASE6_EXPIRATION() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Return the v4 leases of a token range
+    static StatementTag &SCAN_LEASE4_EXPIRATION() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Return the v6 leases of a token range
+    static StatementTag &SCAN_LEASE6_EXPIRATION() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Return a cursor
+    static StatementTag &GET_LEASE_EXPIRATION_CURSOR() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Claim the rebuild of the index
+    static StatementTag &INSERT_LEASE_EXPIRATION_CURSOR() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Set a cursor
+    static StatementTag &UPDATE_LEASE_EXPIRATION_CURSOR() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Move a cursor
+    static StatementTag &MOVE_LEASE_EXPIRATION_CURSOR() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    // Forget the cursors
+    static StatementTag &DELETE_LEASE_EXPIRATION_CURSOR() {
+        static StatementTag _(FUNCTION_NAME());
+        return _;
+    }
+    /// @}
+
+private:
+    /// @brief IPv6 tables?
+    bool v6_;
+
+    /// @brief IPv4 address
+    cass_int64_t address4_;
+
+    /// @brief IPv6 address
+    std::string address6_;
+
+    /// @brief Lease type (NA, TA or PD)
+    cass_int32_t lease_type_;
+
+    /// @brief Bucket of the cursor
+    cass_int64_t bucket_;
+
+    /// @brief Expiration time of the lease
+    cass_int64_t expire_;
+
+    /// @brief Lease state
+    cass_int32_t state_;
+};
+
+void CqlLeaseExpirationExchange::createBindForSelect(AnyArray &data,
+                                                     StatementTag const &statement_tag) {
+    // Start with a fresh array.
+    data.clear();
+
+    // The lease type is always NA for v4.
+    lease_type_ = Lease::TYPE_NA;
+
+    // bucket: bigint
+    if (statement_tag == GET_LEASE_EXPIRATION_CURSOR()) {
+        data.add(&bucket_);
+        return;
+    }
+
+    // address: bigint or varchar
+    if (v6_) {
+        data.add(&address6_);
+        // lease_type: int
+        data.add(&lease_type_);
+    } else {
+        data.add(&address4_);
+    }
+
+    // expire: bigint
+    // state: int
+    if (statement_tag == SCAN_LEASE4_EXPIRATION() || statement_tag == SCAN_LEASE6_EXPIRATION()) {
+        data.add(&expire_);
+        data.add(&state_);
+    }
+}
+
+Ptr<LeaseExpirationRow> CqlLeaseExpirationExchange::retrieve() {
+    Ptr<LeaseExpirationRow> row(std::make_shared<LeaseExpirationRow>());
+    row->address_ = v6_ ? IOAddress(address6_) : IOAddress(static_cast<uint64_t>(address4_));
+    row->lease_type_ = static_cast<Lease::Type>(lease_type_);
+    row->bucket_ = bucket_;
+    row->expire_ = expire_;
+    row->state_ = static_cast<uint32_t>(state_);
+    return row;
+}
+
+void CqlLeaseExpirationExchange::insertEntries(CqlConnection const &connection, const bool v6,
+                                               const std::vector<LeaseExpirationRow> &rows) {
+    if (rows.empty()) {
+        return;
+    }
+
+    // The bound values point to the elements of these vectors, so they
+    // are sized before any value is bound.
+    std::vector<cass_bool_t> reclaimed;
+    std::vector<cass_int64_t> buckets;
+    std::vector<cass_int64_t> addresses4;
+    std::vector<std::string> addresses6;
+    std::vector<cass_int32_t> lease_types;
+    reclaimed.reserve(rows.size());
+    buckets.reserve(rows.size());
+    addresses4.reserve(rows.size());
+    addresses6.reserve(rows.size());
+    lease_types.reserve(rows.size());
+
+    std::vector<AnyArray> data;
+    for (LeaseExpirationRow const &row : rows) {
+        reclaimed.push_back(row.state_ == Lease::STATE_EXPIRED_RECLAIMED ? cass_true : cass_false);
+        buckets.push_back(static_cast<cass_int64_t>(row.bucket_));
+
+        AnyArray assigned{&reclaimed.back(), &buckets.back()};
+        if (v6) {
+            addresses6.push_back(row.address_.toText());
+            lease_types.push_back(static_cast<cass_int32_t>(row.lease_type_));
+            assigned.add(&addresses6.back());
+            assigned.add(&lease_types.back());
+        } else {
+            addresses4.push_back(static_cast<cass_int64_t>(row.address_.addressPlusPortToUint64()));
+            assigned.add(&addresses4.back());
+        }
+        data.push_back(assigned);
+    }
+
+    CqlLeaseExpirationExchange exchange(v6);
+    exchange.executeMutations(connection, data,
+                              v6 ? INSERT_LEASE6_EXPIRATION() : INSERT_LEASE4_EXPIRATION());
+}
+
+/// @brief Expiration index queries of the Cassandra backend
+///
+/// Gives @ref LeaseExpirationBuckets access to the expiration index, its
+/// cursors and the token ranges of the lease table of one lease family.
+/// The cursor of the leases to reclaim also tells the state of the index.
+struct CqlExpirationBucketSource : ExpirationBucketSource {
+    /// @brief Constructor
+    ///
+    /// @param connection An open connection to the database housing the lease data
+    /// @param v6 true for the IPv6 leases, false for the IPv4 leases
+    CqlExpirationBucketSource(CqlConnection const &connection, const bool v6)
+        : connection_(connection), v6_(v6), family_(v6 ? 6 : 4) {
+    }
+
+    /// @brief Returns the state of the index and the cursor of a set.
+    IndexStatus getCursor(const bool reclaimed, int64_t &cursor) override final {
+        int64_t bucket(0);
+        if (!readCursor(false, bucket)) {
+            return (INDEX_ABSENT);
+        }
+        if (bucket == CqlLeaseExpirationExchange::CURSOR_REBUILDING) {
+            return (INDEX_REBUILDING);
+        }
+        if (reclaimed && !readCursor(true, bucket)) {
+            return (INDEX_REBUILDING);
+        }
+        cursor = bucket;
+        return (INDEX_READY);
+    }
+
+    /// @brief Marks the absent index as being rebuilt.
+    bool claimIndexRebuild() override final {
+        cass_int32_t family(family_);
+        cass_bool_t reclaimed(cass_false);
+        cass_int64_t bucket(CqlLeaseExpirationExchange::CURSOR_REBUILDING);
+        AnyArray data{&family, &reclaimed, &bucket};
+        CqlLeaseExpirationExchange exchange(v6_);
+        try {
+            exchange.executeMutation(connection_, data,
+                                     CqlLeaseExpirationExchange::INSERT_LEASE_EXPIRATION_CURSOR());
+#ifdef TERASTREAM_FULL_TRANSACTIONS
+        } catch (TransactionException const &) {
+#else  // TERASTREAM_FULL_TRANSACTIONS
+        } catch (StatementNotApplied const &) {
+#endif  // TERASTREAM_FULL_TRANSACTIONS
+            return (false);
+        }
+        return (true);
+    }
+
+    /// @brief Marks the index as absent again after a failed rebuild.
+    void abortIndexRebuild() override final {
+        cass_int32_t family(family_);
+        AnyArray where{&family};
+        CqlLeaseExpirationExchange exchange(v6_);
+        exchange.executeMutation(connection_, where,
+                                 CqlLeaseExpirationExchange::DELETE_LEASE_EXPIRATION_CURSOR());
+    }
+
+    /// @brief Marks the index as up to date.
+    void setIndexReady(const int64_t cursor) override final {
+        // The cursor of the leases to reclaim goes last as it tells the
+        // state of the index.
+        writeCursor(true, cursor);
+        writeCursor(false, cursor);
+    }
+
+    /// @brief Moves a cursor forward.
+    void moveCursor(const bool reclaimed, const int64_t from, const int64_t to) override final {
+        cass_int64_t bucket(to);
+        cass_int32_t family(family_);
+        cass_bool_t reclaimed_data(reclaimed ? cass_true : cass_false);
+        cass_int64_t expected(from);
+        AnyArray data{&bucket, &family, &reclaimed_data, &expected};
+        CqlLeaseExpirationExchange exchange(v6_);
+        try {
+            exchange.executeMutation(connection_, data,
+                                     CqlLeaseExpirationExchange::MOVE_LEASE_EXPIRATION_CURSOR());
+#ifdef TERASTREAM_FULL_TRANSACTIONS
+        } catch (TransactionException const &) {
+#else  // TERASTREAM_FULL_TRANSACTIONS
+        } catch (StatementNotApplied const &) {
+#endif  // TERASTREAM_FULL_TRANSACTIONS
+            // Another server has moved it.
+        }
+    }
+
+    /// @brief Reads the entries of a bucket with their leases.
+    ///
+    /// The leases are fetched by address with up to
+    /// @ref MAX_BULK_INSERT_ROWS queries in flight.
+    void readBucket(const bool reclaimed, const int64_t bucket,
+                    std::vector<ExpirationBucketEntry> &entries) override final {
+        cass_bool_t reclaimed_data(reclaimed ? cass_true : cass_false);
+        cass_int64_t bucket_data(bucket);
+        AnyArray where{&reclaimed_data, &bucket_data};
+        CqlLeaseExpirationExchange exchange(v6_);
+        Collection<LeaseExpirationRow> const rows(exchange.executeSelect(
+            connection_, where,
+            v6_ ? CqlLeaseExpirationExchange::GET_LEASE6_EXPIRATION()
+                : CqlLeaseExpirationExchange::GET_LEASE4_EXPIRATION()));
+
+        std::map<IOAddress, LeasePtr> leases;
+        for (size_t first = 0; first < rows.size(); first += MAX_BULK_INSERT_ROWS) {
+            size_t const count(std::min(MAX_BULK_INSERT_ROWS, rows.size() - first));
+            if (v6_) {
+                fetchLeases6(rows, first, count, leases);
+            } else {
+                fetchLeases4(rows, first, count, leases);
+            }
+        }
+
+        for (Ptr<LeaseExpirationRow> const &row : rows) {
+            auto const lease(leases.find(row->address_));
+            entries.push_back({row->address_,
+                               lease == leases.end() ? LeasePtr() : lease->second});
+        }
+    }
+
+    /// @brief Deletes an entry.
+    void deleteEntry(const bool reclaimed, const int64_t bucket,
+                     const IOAddress &address) override final {
+        cass_bool_t reclaimed_data(reclaimed ? cass_true : cass_false);
+        cass_int64_t bucket_data(bucket);
+        AnyArray where{&reclaimed_data, &bucket_data};
+        cass_int64_t address4(0);
+        std::string address6;
+        if (v6_) {
+            address6 = address.toText();
+            where.add(&address6);
+        } else {
+            address4 = static_cast<cass_int64_t>(address.addressPlusPortToUint64());
+            where.add(&address4);
+        }
+        CqlLeaseExpirationExchange exchange(v6_);
+        exchange.executeMutation(connection_, where,
+                                 v6_ ? CqlLeaseExpirationExchange::DELETE_LEASE6_EXPIRATION()
+                                     : CqlLeaseExpirationExchange::DELETE_LEASE4_EXPIRATION());
+    }
+
+    /// @brief Adds an entry for every lease stored in a token range.
+    void indexTokenRange(const TokenRange &range, const int64_t now) override final {
+        cass_int64_t first(range.first);
+        cass_int64_t last(range.second);
+        AnyArray where{&first, &last};
+        CqlLeaseExpirationExchange exchange(v6_);
+        Collection<LeaseExpirationRow> const leases(exchange.executeSelect(
+            connection_, where,
+            v6_ ? CqlLeaseExpirationExchange::SCAN_LEASE6_EXPIRATION()
+                : CqlLeaseExpirationExchange::SCAN_LEASE4_EXPIRATION()));
+
+        std::vector<LeaseExpirationRow> rows;
+        for (Ptr<LeaseExpirationRow> const &lease : leases) {
+            rows.push_back(*lease);
+            rows.back().bucket_ = LeaseExpirationBuckets::getEntryBucket(lease->expire_, now);
+            if (rows.size() == MAX_BULK_INSERT_ROWS) {
+                CqlLeaseExpirationExchange::insertEntries(connection_, v6_, rows);
+                rows.clear();
+            }
+        }
+        CqlLeaseExpirationExchange::insertEntries(connection_, v6_, rows);
+    }
+
+private:
+    /// @brief Reads a cursor.
+    ///
+    /// @param reclaimed set of buckets
+    /// @param bucket bucket of the cursor
+    /// @return false if the cursor is absent
+    bool readCursor(const bool reclaimed, int64_t &bucket) {
+        cass_int32_t family(family_);
+        cass_bool_t reclaimed_data(reclaimed ? cass_true : cass_false);
+        AnyArray where{&family, &reclaimed_data};
+        CqlLeaseExpirationExchange exchange(v6_);
+        Collection<LeaseExpirationRow> const rows(exchange.executeSelect(
+            connection_, where, CqlLeaseExpirationExchange::GET_LEASE_EXPIRATION_CURSOR(), true));
+        if (rows.empty()) {
+            return (false);
+        }
+        bucket = rows.front()->bucket_;
+        return (true);
+    }
+
+    /// @brief Sets a cursor.
+    ///
+    /// @param reclaimed set of buckets
+    /// @param bucket bucket of the cursor
+    void writeCursor(const bool reclaimed, const int64_t bucket) {
+        cass_int64_t bucket_data(bucket);
+        cass_int32_t family(family_);
+        cass_bool_t reclaimed_data(reclaimed ? cass_true : cass_false);
+        AnyArray data{&bucket_data, &family, &reclaimed_data};
+        CqlLeaseExpirationExchange exchange(v6_);
+        exchange.executeMutation(connection_, data,
+                                 CqlLeaseExpirationExchange::UPDATE_LEASE_EXPIRATION_CURSOR());
+    }
+
+    /// @brief Fetches the IPv4 leases of index entries.
+    ///
+    /// @param rows index entries
+    /// @param first first entry to fetch
+    /// @param count number of entries to fetch
+    /// @param leases fetched leases, by address
+    void fetchLeases4(Collection<LeaseExpirationRow> const &rows, size_t const first,
+                      size_t const count, std::map<IOAddress, LeasePtr> &leases) {
+#ifdef TERASTREAM_FULL_TRANSACTIONS
+        CassUuid txid(connection_.getTransactionID());
+#endif  // TERASTREAM_FULL_TRANSACTIONS
+        std::vector<cass_int64_t> addresses(count);
+        std::vector<AnyArray> where(count);
+        for (size_t i = 0; i < count; ++i) {
+            addresses[i] =
+                static_cast<cass_int64_t>(rows[first + i]->address_.addressPlusPortToUint64());
+            where[i].add(&addresses[i]);
+#ifdef TERASTREAM_FULL_TRANSACTIONS
+            where[i].add(&txid);
+#endif  // TERASTREAM_FULL_TRANSACTIONS
+        }
+        CqlLease4Exchange exchange(connection_);
+        for (Lease4Ptr const &lease :
+             exchange.executeSelects(connection_, where, CqlLease4Exchange::GET_LEASE4_ADDR())) {
+            leases[lease->addr_] = lease;
+        }
+    }
+
+    /// @brief Fetches the IPv6 leases of index entries.
+    ///
+    /// @param rows index entries
+    /// @param first first entry to fetch
+    /// @param count number of entries to fetch
+    /// @param leases fetched leases, by address
+    void fetchLeases6(Collection<LeaseExpirationRow> const &rows, size_t const first,
+                      size_t const count, std::map<IOAddress, LeasePtr> &leases) {
+#ifdef TERASTREAM_FULL_TRANSACTIONS
+        CassUuid txid(connection_.getTransactionID());
+#endif  // TERASTREAM_FULL_TRANSACTIONS
+        std::vector<std::string> addresses(count);
+        std::vector<cass_int32_t> lease_types(count);
+        std::vector<AnyArray> where(count);
+        for (size_t i = 0; i < count; ++i) {
+            addresses[i] = rows[first + i]->address_.toText();
+            lease_types[i] = static_cast<cass_int32_t>(rows[first + i]->lease_type_);
+            where[i].add(&addresses[i]);
+            where[i].add(&lease_types[i]);
+#ifdef TERASTREAM_FULL_TRANSACTIONS
+            where[i].add(&txid);
+#endif  // TERASTREAM_FULL_TRANSACTIONS
+        }
+        CqlLease6Exchange exchange(connection_);
+        for (Lease6Ptr const &lease :
+             exchange.executeSelects(connection_, where, CqlLease6Exchange::GET_LEASE6_ADDR())) {
+            leases[lease->addr_] = lease;
+        }
+    }
+
+    /// @brief Database connection
+    CqlConnection const &connection_;
+
+    /// @brief IPv6 leases?
+    bool v6_;
+
+    /// @brief Lease family of the lease_expiration_cursor rows
+    cass_int32_t family_;
+};
+
+/// @brief Gets expired leases from the expiration index
+///
+/// @param connection An open connection to the database housing the lease data
+/// @param v6 true for the IPv6 leases, false for the IPv4 leases
+/// @param reclaimed true for the reclaimed leases, false for the leases to reclaim
+/// @param limit time before which the leases have expired
+/// @param max_leases maximum number of leases, 0 for no limit
+/// @param leases leases found
+/// @return false if the index can't be used yet
+static bool getIndexedExpiredLeases(CqlConnection const &connection, const bool v6,
+                                    const bool reclaimed, const int64_t limit,
+                                    const size_t max_leases, std::vector<LeasePtr> &leases) {
+    CqlExpirationBucketSource source(connection, v6);
+    LeaseExpirationBuckets buckets(source, CqlLeaseStatsQuery::scanThreadCount(),
+                                   CqlLeaseStatsQuery::SCAN_RANGE_COUNT);
+    return buckets.getExpiredLeases(reclaimed, limit, static_cast<int64_t>(time(NULL)),
+                                    max_leases, leases);
+}
+
+CqlLeaseMgr::CqlLeaseMgr(const DatabaseConnection::ParameterMap &parameters)
+    : parameters_(parameters), connection_(parameters), lease_stats_counters_(false),
+      lease_expiration_buckets_(false)
+#ifdef TERASTREAM_LOCK
+      ,
+      lock_mgr4_(connection_), lock_mgr6_(connection_)
+#endif  // TERASTREAM_LOCK
+{
+    std::string lease_stats_counters("false");
+    try {
+        lease_stats_counters = connection_.getParameter("lease-stats-counters");
+    } catch (...) {
+        // No lease-stats-counters. Fine, the counters are disabled.
+    }
+    if (lease_stats_counters == "true") {
+        lease_stats_counters_ = true;
+    } else if (lease_stats_counters != "false") {
+        isc_throw(BadValue, "invalid value of the lease-stats-counters " << lease_stats_counters
+                                                                         << " specified");
+    }
+
+    std::string lease_expiration_buckets("false");
+    try {
+        lease_expiration_buckets = connection_.getParameter("lease-expiration-buckets");
+    } catch (...) {
+        // No lease-expiration-buckets. Fine, the index is disabled.
+    }
+    if (lease_expiration_buckets == "true") {
+        lease_expiration_buckets_ = true;
+    } else if (lease_expiration_buckets != "false") {
+        isc_throw(BadValue, "invalid value of the lease-expiration-buckets "
+                                << lease_expiration_buckets << " specified");
+    }
+
+    CqlVersionExchange<isc::db::OperationalVersionTuple> version_exchange;
+    version_exchange.validateSchema(connection_);
+
+    // Now prepare the rest of the exchanges.
+#ifdef TERASTREAM_FULL_TRANSACTIONS
+    connection_.setTransactionOperations(CqlTransactionExchange::BEGIN_TXN,
+                                         CqlTransactionExchange::COMMIT_TXN,
                                          CqlTransactionExchange::ROLLBACK_TXN);
 #endif  // TERASTREAM_FULL_TRANSACTIONS
     connection_.prepareStatements(CqlLease4Exchange::tagged_statements());
@@ -3226,6 +4430,8 @@ CqlLeaseMgr::CqlLeaseMgr(const DatabaseConnection::ParameterMap &parameters)
     connection_.prepareStatements(CqlTransactionExchange::tagged_statements());
 #endif  // TERASTREAM_FULL_TRANSACTIONS
     connection_.prepareStatements(CqlLeaseStatsQuery::tagged_statements());
+    connection_.prepareStatements(CqlLeaseStatExchange::tagged_statements());
+    connection_.prepareStatements(CqlLeaseExpirationExchange::tagged_statements());
 }
 
 std::string CqlLeaseMgr::getDBVersion() {
@@ -3238,6 +4444,45 @@ std::string CqlLeaseMgr::getDBVersion() {
     return tmp.str();
 }
 
+void CqlLeaseMgr::updateLeaseStatCounters(const bool v6, const LeaseStatCounts &deltas) {
+    if (!lease_stats_counters_) {
+        return;
+    }
+    try {
+        CqlLeaseStatExchange::updateCounters(connection_, v6, deltas);
+    } catch (const std::exception &exception) {
+        LOG_WARN(dhcpsrv_logger, DHCPSRV_CQL_LEASE_STAT_UPDATE_FAILED)
+            .arg(v6 ? 6 : 4)
+            .arg(exception.what());
+    }
+}
+
+void CqlLeaseMgr::addExpirationEntries(const bool v6, const std::vector<LeasePtr> &leases) {
+    if (!lease_expiration_buckets_ || leases.empty()) {
+        return;
+    }
+    int64_t const now(static_cast<int64_t>(time(NULL)));
+    std::vector<LeaseExpirationRow> rows;
+    rows.reserve(leases.size());
+    for (LeasePtr const &lease : leases) {
+        LeaseExpirationRow row;
+        row.address_ = lease->addr_;
+        if (v6) {
+            row.lease_type_ = std::static_pointer_cast<Lease6>(lease)->type_;
+        }
+        row.bucket_ = LeaseExpirationBuckets::getEntryBucket(lease->getExpirationTime(), now);
+        row.state_ = lease->state_;
+        rows.push_back(row);
+    }
+    try {
+        CqlLeaseExpirationExchange::insertEntries(connection_, v6, rows);
+    } catch (const std::exception &exception) {
+        LOG_WARN(dhcpsrv_logger, DHCPSRV_CQL_LEASE_EXPIRATION_UPDATE_FAILED)
+            .arg(v6 ? 6 : 4)
+            .arg(exception.what());
+    }
+}
+
 bool CqlLeaseMgr::addLease(const Lease4Ptr &lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_CQL_ADD_ADDR4)
         .arg(lease->addr_.toText());
@@ -3263,8 +4508,15 @@ bool CqlLeaseMgr::addLease(const Lease4Ptr &lease) {
         return false;
     }
 
+    LeaseStatCounts deltas;
+    ++deltas[leaseStatKey(*lease)];
+    updateLeaseStatCounters(false, deltas);
+    addExpirationEntries(false, {lease});
+
     lease->old_cltt_ = lease->cltt_;
     lease->old_valid_lft_ = lease->valid_lft_;
+    lease->old_subnet_id_ = lease->subnet_id_;
+    lease->old_state_ = lease->state_;
 
     return true;
 }
@@ -3292,12 +4544,196 @@ bool CqlLeaseMgr::addLease(const Lease6Ptr &lease) {
         return false;
     }
 
+    LeaseStatCounts deltas;
+    ++deltas[leaseStatKey(*lease)];
+    updateLeaseStatCounters(true, deltas);
+    addExpirationEntries(true, {lease});
+
     lease->old_cltt_ = lease->cltt_;
     lease->old_valid_lft_ = lease->valid_lft_;
+    lease->old_subnet_id_ = lease->subnet_id_;
+    lease->old_state_ = lease->state_;
 
     return true;
 }
 
+size_t CqlLeaseMgr::addLeases(const Lease4Collection& leases) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_CQL_ADD_LEASES4)
+        .arg(leases.size());
+
+    size_t added(0);
+    for (size_t first = 0; first < leases.size(); first += MAX_BULK_INSERT_ROWS) {
+        size_t const count(std::min(MAX_BULK_INSERT_ROWS, leases.size() - first));
+
+        // The bound values point to the exchange members, so each lease
+        // needs its own exchange.
+        std::vector<std::unique_ptr<CqlLease4Exchange>> exchanges;
+        std::vector<AnyArray> data(count);
+        for (size_t i = 0; i < count; ++i) {
+            exchanges.emplace_back(new CqlLease4Exchange(connection_));
+            exchanges.back()->createBindForInsert(leases[first + i], data[i]);
+        }
+
+        std::vector<bool> applied;
+        try {
+#ifdef CASSANDRA_DENORMALIZED_TABLES
+            applied = exchanges.front()->executeMutations(
+                connection_, data, CqlLease4Exchange::INSERT_LEASE4_ADDRESS());
+            // The other tables are written only for the leases which have
+            // been inserted into the main one.
+            std::vector<AnyArray> inserted;
+            for (size_t i = 0; i < count; ++i) {
+                if (applied[i]) {
+                    inserted.push_back(data[i]);
+                }
+            }
+            exchanges.front()->executeMutations(
+                connection_, inserted, CqlLease4Exchange::INSERT_LEASE4_CLIENTID_SUBNETID());
+            exchanges.front()->executeMutations(
+                connection_, inserted, CqlLease4Exchange::INSERT_LEASE4_HWADDR_SUBNETID());
+            exchanges.front()->executeMutations(
+                connection_, inserted, CqlLease4Exchange::INSERT_LEASE4_SUBNETID());
+#else  // CASSANDRA_DENORMALIZED_TABLES
+            applied = exchanges.front()->executeMutations(
+                connection_, data, CqlLease4Exchange::INSERT_LEASE4());
+#endif  // CASSANDRA_DENORMALIZED_TABLES
+        } catch (const Exception &exception) {
+            LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_CQL_LEASE_EXCEPTION_THROWN)
+                .arg(exception.what());
+            // Retry the leases of the chunk one by one so that a single
+            // failing lease does not drop the others.
+            applied.assign(count, false);
+            for (size_t i = 0; i < count; ++i) {
+                try {
+#ifdef CASSANDRA_DENORMALIZED_TABLES
+                    exchanges[i]->executeMutation(connection_, data[i],
+                                                  CqlLease4Exchange::INSERT_LEASE4_ADDRESS());
+                    exchanges[i]->executeMutation(connection_, data[i],
+                                                  CqlLease4Exchange::INSERT_LEASE4_CLIENTID_SUBNETID());
+                    exchanges[i]->executeMutation(connection_, data[i],
+                                                  CqlLease4Exchange::INSERT_LEASE4_HWADDR_SUBNETID());
+                    exchanges[i]->executeMutation(connection_, data[i],
+                                                  CqlLease4Exchange::INSERT_LEASE4_SUBNETID());
+#else  // CASSANDRA_DENORMALIZED_TABLES
+                    exchanges[i]->executeMutation(connection_, data[i],
+                                                  CqlLease4Exchange::INSERT_LEASE4());
+#endif  // CASSANDRA_DENORMALIZED_TABLES
+                    applied[i] = true;
+                } catch (const StatementNotApplied &) {
+                    // The lease already exists.
+                } catch (const Exception &ex) {
+                    LOG_WARN(dhcpsrv_logger, DHCPSRV_CQL_ADD_LEASE_FAILED)
+                        .arg(leases[first + i]->addr_.toText())
+                        .arg(ex.what());
+                }
+            }
+        }
+
+        LeaseStatCounts deltas;
+        std::vector<LeasePtr> stored;
+        for (size_t i = 0; i < count; ++i) {
+            if (applied[i]) {
+                ++deltas[leaseStatKey(*leases[first + i])];
+                stored.push_back(leases[first + i]);
+                leases[first + i]->old_cltt_ = leases[first + i]->cltt_;
+                leases[first + i]->old_valid_lft_ = leases[first + i]->valid_lft_;
+                leases[first + i]->old_subnet_id_ = leases[first + i]->subnet_id_;
+                leases[first + i]->old_state_ = leases[first + i]->state_;
+                ++added;
+            }
+        }
+        updateLeaseStatCounters(false, deltas);
+        addExpirationEntries(false, stored);
+    }
+
+    return added;
+}
+
+size_t CqlLeaseMgr::addLeases(const Lease6Collection& leases) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_CQL_ADD_LEASES6)
+        .arg(leases.size());
+
+    size_t added(0);
+    for (size_t first = 0; first < leases.size(); first += MAX_BULK_INSERT_ROWS) {
+        size_t const count(std::min(MAX_BULK_INSERT_ROWS, leases.size() - first));
+
+        // The bound values point to the exchange members, so each lease
+        // needs its own exchange.
+        std::vector<std::unique_ptr<CqlLease6Exchange>> exchanges;
+        std::vector<AnyArray> data(count);
+        for (size_t i = 0; i < count; ++i) {
+            exchanges.emplace_back(new CqlLease6Exchange(connection_));
+            exchanges.back()->createBindForInsert(leases[first + i], data[i]);
+        }
+
+        std::vector<bool> applied;
+        try {
+#ifdef CASSANDRA_DENORMALIZED_TABLES
+            applied = exchanges.front()->executeMutations(
+                connection_, data, CqlLease6Exchange::INSERT_LEASE6_ADDRESS_LEASETYPE());
+            // The other table is written only for the leases which have
+            // been inserted into the main one.
+            std::vector<AnyArray> inserted;
+            for (size_t i = 0; i < count; ++i) {
+                if (applied[i]) {
+                    inserted.push_back(data[i]);
+                }
+            }
+            exchanges.front()->executeMutations(
+                connection_, inserted,
+                CqlLease6Exchange::INSERT_LEASE6_DUID_IAID_LEASETYPE_SUBNETID());
+#else  // CASSANDRA_DENORMALIZED_TABLES
+            applied = exchanges.front()->executeMutations(
+                connection_, data, CqlLease6Exchange::INSERT_LEASE6());
+#endif  // CASSANDRA_DENORMALIZED_TABLES
+        } catch (const Exception &exception) {
+            LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_CQL_LEASE_EXCEPTION_THROWN)
+                .arg(exception.what());
+            // Retry the leases of the chunk one by one so that a single
+            // failing lease does not drop the others.
+            applied.assign(count, false);
+            for (size_t i = 0; i < count; ++i) {
+                try {
+#ifdef CASSANDRA_DENORMALIZED_TABLES
+                    exchanges[i]->executeMutation(connection_, data[i],
+                                                  CqlLease6Exchange::INSERT_LEASE6_ADDRESS_LEASETYPE());
+                    exchanges[i]->executeMutation(connection_, data[i],
+                                                  CqlLease6Exchange::INSERT_LEASE6_DUID_IAID_LEASETYPE_SUBNETID());
+#else  // CASSANDRA_DENORMALIZED_TABLES
+                    exchanges[i]->executeMutation(connection_, data[i],
+                                                  CqlLease6Exchange::INSERT_LEASE6());
+#endif  // CASSANDRA_DENORMALIZED_TABLES
+                    applied[i] = true;
+                } catch (const StatementNotApplied &) {
+                    // The lease already exists.
+                } catch (const Exception &ex) {
+                    LOG_WARN(dhcpsrv_logger, DHCPSRV_CQL_ADD_LEASE_FAILED)
+                        .arg(leases[first + i]->addr_.toText())
+                        .arg(ex.what());
+                }
+            }
+        }
+
+        LeaseStatCounts deltas;
+        std::vector<LeasePtr> stored;
+        for (size_t i = 0; i < count; ++i) {
+            if (applied[i]) {
+                ++deltas[leaseStatKey(*leases[first + i])];
+                stored.push_back(leases[first + i]);
+                leases[first + i]->old_cltt_ = leases[first + i]->cltt_;
+                leases[first + i]->old_valid_lft_ = leases[first + i]->valid_lft_;
+                leases[first + i]->old_subnet_id_ = leases[first + i]->subnet_id_;
+                leases[first + i]->old_state_ = leases[first + i]->state_;
+                ++added;
+            }
+        }
+        updateLeaseStatCounters(true, deltas);
+        addExpirationEntries(true, stored);
+    }
+
+    return added;
+}
+
 Lease4Ptr CqlLeaseMgr::getLease4(const IOAddress &addr) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_CQL_GET_ADDR4).arg(addr.toText());
 
@@ -3778,6 +5214,19 @@ void CqlLeaseMgr::getExpiredLeases4(Lease4Collection &expired_leases,
                                     const size_t max_leases) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_CQL_GET_EXPIRED4).arg(max_leases);
 
+#ifndef CASSANDRA_DENORMALIZED_TABLES
+    if (lease_expiration_buckets_) {
+        std::vector<LeasePtr> leases;
+        if (getIndexedExpiredLeases(connection_, false, false, static_cast<int64_t>(time(NULL)),
+                                    max_leases, leases)) {
+            for (LeasePtr const &lease : leases) {
+                expired_leases.push_back(std::static_pointer_cast<Lease4>(lease));
+            }
+            return;
+        }
+    }
+#endif  // CASSANDRA_DENORMALIZED_TABLES
+
     CqlLease4Exchange exchange(connection_);
     exchange.getExpiredLeases(max_leases, expired_leases);
 }
@@ -3786,6 +5235,19 @@ void CqlLeaseMgr::getExpiredLeases6(Lease6Collection &expired_leases,
                                     const size_t max_leases) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_CQL_GET_EXPIRED6).arg(max_leases);
 
+#ifndef CASSANDRA_DENORMALIZED_TABLES
+    if (lease_expiration_buckets_) {
+        std::vector<LeasePtr> leases;
+        if (getIndexedExpiredLeases(connection_, true, false, static_cast<int64_t>(time(NULL)),
+                                    max_leases, leases)) {
+            for (LeasePtr const &lease : leases) {
+                expired_leases.push_back(std::static_pointer_cast<Lease6>(lease));
+            }
+            return;
+        }
+    }
+#endif  // CASSANDRA_DENORMALIZED_TABLES
+
     CqlLease6Exchange exchange(connection_);
     exchange.getExpiredLeases(max_leases, expired_leases);
 }
@@ -3819,8 +5281,17 @@ void CqlLeaseMgr::updateLease4(const Lease4Ptr &lease) {
         isc_throw(NoSuchLease, exception.what());
     }
 
+    LeaseStatCounts deltas;
+    addLeaseStatDelta(deltas, oldLeaseStatKey(*lease), leaseStatKey(*lease));
+    updateLeaseStatCounters(false, deltas);
+    if (LeaseExpirationBuckets::needsEntry(*lease, static_cast<int64_t>(time(NULL)))) {
+        addExpirationEntries(false, {lease});
+    }
+
     lease->old_cltt_ = lease->cltt_;
     lease->old_valid_lft_ = lease->valid_lft_;
+    lease->old_subnet_id_ = lease->subnet_id_;
+    lease->old_state_ = lease->state_;
 }
 
 void CqlLeaseMgr::updateLease6(const Lease6Ptr &lease) {
@@ -3848,8 +5319,17 @@ void CqlLeaseMgr::updateLease6(const Lease6Ptr &lease) {
         isc_throw(NoSuchLease, exception.what());
     }
 
+    LeaseStatCounts deltas;
+    addLeaseStatDelta(deltas, oldLeaseStatKey(*lease), leaseStatKey(*lease));
+    updateLeaseStatCounters(true, deltas);
+    if (LeaseExpirationBuckets::needsEntry(*lease, static_cast<int64_t>(time(NULL)))) {
+        addExpirationEntries(true, {lease});
+    }
+
     lease->old_cltt_ = lease->cltt_;
     lease->old_valid_lft_ = lease->valid_lft_;
+    lease->old_subnet_id_ = lease->subnet_id_;
+    lease->old_state_ = lease->state_;
 }
 
 bool CqlLeaseMgr::deleteLease(const Lease4Ptr &lease) {
@@ -3889,6 +5369,11 @@ bool CqlLeaseMgr::deleteLeaseInternal(const Lease4Ptr &lease) {
             .arg(exception.what());
         return false;
     }
+
+    LeaseStatCounts deltas;
+    --deltas[oldLeaseStatKey(*lease)];
+    updateLeaseStatCounters(false, deltas);
+
     return true;
 }
 
@@ -3925,6 +5410,11 @@ bool CqlLeaseMgr::deleteLeaseInternal(const Lease6Ptr &lease) {
             .arg(exception.what());
         return false;
     }
+
+    LeaseStatCounts deltas;
+    --deltas[oldLeaseStatKey(*lease)];
+    updateLeaseStatCounters(true, deltas);
+
     return true;
 }
 
@@ -3934,6 +5424,21 @@ uint64_t CqlLeaseMgr::deleteExpiredReclaimedLeases4(const uint32_t secs) {
 #ifdef CASSANDRA_DENORMALIZED_TABLES
     return 0u;
 #else  // CASSANDRA_DENORMALIZED_TABLES
+    if (lease_expiration_buckets_) {
+        std::vector<LeasePtr> indexed;
+        if (getIndexedExpiredLeases(
+                connection_, false, true,
+                static_cast<int64_t>(time(NULL)) - static_cast<int64_t>(secs), 1024, indexed)) {
+            uint64_t deleted = 0u;
+            for (LeasePtr const &lease : indexed) {
+                if (deleteLeaseInternal(std::static_pointer_cast<Lease4>(lease))) {
+                    ++deleted;
+                }
+            }
+            return (deleted);
+        }
+    }
+
     AnyArray data;
     uint64_t deleted = 0u;
     cass_int32_t limit = 1024;
@@ -3972,6 +5477,21 @@ uint64_t CqlLeaseMgr::deleteExpiredReclaimedLeases6(const uint32_t secs) {
 #ifdef CASSANDRA_DENORMALIZED_TABLES
     return 0u;
 #else  // CASSANDRA_DENORMALIZED_TABLES
+    if (lease_expiration_buckets_) {
+        std::vector<LeasePtr> indexed;
+        if (getIndexedExpiredLeases(
+                connection_, true, true,
+                static_cast<int64_t>(time(NULL)) - static_cast<int64_t>(secs), 1024, indexed)) {
+            uint64_t deleted = 0u;
+            for (LeasePtr const &lease : indexed) {
+                if (deleteLeaseInternal(std::static_pointer_cast<Lease6>(lease))) {
+                    ++deleted;
+                }
+            }
+            return (deleted);
+        }
+    }
+
     uint64_t deleted = 0u;
     cass_int32_t limit = 1024;
 
@@ -4003,14 +5523,16 @@ uint64_t CqlLeaseMgr::deleteExpiredReclaimedLeases6(const uint32_t secs) {
 
 LeaseStatsQueryPtr CqlLeaseMgr::startLeaseStatsQuery4() {
     LeaseStatsQueryPtr query(
-        new CqlLeaseStatsQuery(connection_, CqlLeaseStatsQuery::ALL_LEASE4_STATS(), false));
+        new CqlLeaseStatsQuery(connection_, CqlLeaseStatsQuery::SUBNET_LEASE4_STATS(), false,
+                               lease_stats_counters_));
     query->start();
     return query;
 }
 
 LeaseStatsQueryPtr CqlLeaseMgr::startSubnetLeaseStatsQuery4(const SubnetID &subnet_id) {
     LeaseStatsQueryPtr query(new CqlLeaseStatsQuery(
-        connection_, CqlLeaseStatsQuery::SUBNET_LEASE4_STATS(), false, subnet_id));
+        connection_, CqlLeaseStatsQuery::SUBNET_LEASE4_STATS(), false, lease_stats_counters_,
+        subnet_id));
     query->start();
     return query;
 }
@@ -4018,22 +5540,25 @@ LeaseStatsQueryPtr CqlLeaseMgr::startSubnetLeaseStatsQuery4(const SubnetID &subn
 LeaseStatsQueryPtr CqlLeaseMgr::startSubnetRangeLeaseStatsQuery4(const SubnetID &first_subnet_id,
                                                                  const SubnetID &last_subnet_id) {
     LeaseStatsQueryPtr query(new CqlLeaseStatsQuery(connection_,
-                                                    CqlLeaseStatsQuery::SUBNET_RANGE_LEASE4_STATS(),
-                                                    false, first_subnet_id, last_subnet_id));
+                                                    CqlLeaseStatsQuery::SUBNET_LEASE4_STATS(),
+                                                    false, lease_stats_counters_, first_subnet_id,
+                                                    last_subnet_id));
     query->start();
     return query;
 }
 
 LeaseStatsQueryPtr CqlLeaseMgr::startLeaseStatsQuery6() {
     LeaseStatsQueryPtr query(
-        new CqlLeaseStatsQuery(connection_, CqlLeaseStatsQuery::ALL_LEASE6_STATS(), true));
+        new CqlLeaseStatsQuery(connection_, CqlLeaseStatsQuery::SUBNET_LEASE6_STATS(), true,
+                               lease_stats_counters_));
     query->start();
     return query;
 }
 
 LeaseStatsQueryPtr CqlLeaseMgr::startSubnetLeaseStatsQuery6(const SubnetID &subnet_id) {
     LeaseStatsQueryPtr query(new CqlLeaseStatsQuery(
-        connection_, CqlLeaseStatsQuery::SUBNET_LEASE6_STATS(), true, subnet_id));
+        connection_, CqlLeaseStatsQuery::SUBNET_LEASE6_STATS(), true, lease_stats_counters_,
+        subnet_id));
     query->start();
     return query;
 }
@@ -4041,8 +5566,9 @@ LeaseStatsQueryPtr CqlLeaseMgr::startSubnetLeaseStatsQuery6(const SubnetID &subn
 LeaseStatsQueryPtr CqlLeaseMgr::startSubnetRangeLeaseStatsQuery6(const SubnetID &first_subnet_id,
                                                                  const SubnetID &last_subnet_id) {
     LeaseStatsQueryPtr query(new CqlLeaseStatsQuery(connection_,
-                                                    CqlLeaseStatsQuery::SUBNET_RANGE_LEASE6_STATS(),
-                                                    true, first_subnet_id, last_subnet_id));
+                                                    CqlLeaseStatsQuery::SUBNET_LEASE6_STATS(),
+                                                    true, lease_stats_counters_, first_subnet_id,
+                                                    last_subnet_id));
     query->start();
     return query;
 }
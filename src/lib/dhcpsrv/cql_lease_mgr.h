@@ -26,6 +26,7 @@
 #include <dhcpsrv/dhcpsrv_exceptions.h>
 #include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/lease_mgr.h>
+#include <dhcpsrv/lease_stat_collector.h>
 
 #include <string>
 #include <utility>
@@ -58,6 +59,12 @@ struct CqlLeaseMgr : LeaseMgr {
     /// - tcp-keepalive no
     /// - tcp-nodelay no
     /// - max-statement-tries 1
+    /// - lease-stats-counters no
+    ///
+    /// When lease-stats-counters is enabled, the lease4_stat and lease6_stat
+    /// delta counters are maintained by the lease changes and the lease
+    /// statistics are read from them and from the base counters of the
+    /// last rebuild. See @ref LeaseStatCollector.
     ///
     /// Finally, all the CQL commands are pre-compiled.
     ///
@@ -96,6 +103,28 @@ struct CqlLeaseMgr : LeaseMgr {
     ///        failed.
     bool addLease(const Lease6Ptr& lease) override final;
 
+    /// @brief Adds a collection of IPv4 leases
+    ///
+    /// The insertions are sent concurrently rather than in a BATCH,
+    /// because conditional insertions of leases in different partitions
+    /// can't be batched.
+    ///
+    /// @param leases leases to be added
+    ///
+    /// @return number of added leases
+    size_t addLeases(const Lease4Collection& leases) override final;
+
+    /// @brief Adds a collection of IPv6 leases
+    ///
+    /// The insertions are sent concurrently rather than in a BATCH,
+    /// because conditional insertions of leases in different partitions
+    /// can't be batched.
+    ///
+    /// @param leases leases to be added
+    ///
+    /// @return number of added leases
+    size_t addLeases(const Lease6Collection& leases) override final;
+
     /// @brief Basic lease access methods. Obtain leases from the database using
     ///     various criteria.
     /// @{
@@ -594,11 +623,36 @@ struct CqlLeaseMgr : LeaseMgr {
     void rollback() override final;
 
 private:
+    /// @brief Adds values to the lease statistics counters.
+    ///
+    /// Does nothing when the counters are not enabled. The lease changes
+    /// have been stored already, so errors are logged but not thrown.
+    ///
+    /// @param v6 true for the IPv6 counters, false for the IPv4 counters
+    /// @param deltas values to add, by counter
+    void updateLeaseStatCounters(const bool v6, const LeaseStatCounts& deltas);
+
+    /// @brief Adds the expiration index entries of stored leases.
+    ///
+    /// Does nothing when the expiration index is not enabled. The lease
+    /// changes have been stored already, so errors are logged but not
+    /// thrown.
+    ///
+    /// @param v6 true for the IPv6 index, false for the IPv4 index
+    /// @param leases leases needing an entry
+    void addExpirationEntries(const bool v6, const std::vector<LeasePtr>& leases);
+
     /// @brief Connection parameters
     isc::db::DatabaseConnection::ParameterMap parameters_;
 
     isc::db::CqlConnection connection_;
 
+    /// @brief Are the lease statistics counters enabled?
+    bool lease_stats_counters_;
+
+    /// @brief Is the expiration index enabled?
+    bool lease_expiration_buckets_;
+
 #ifdef TERASTREAM_LOCK
     isc::db::CqlLockMgr<DHCP_SPACE_V4> lock_mgr4_;
     isc::db::CqlLockMgr<DHCP_SPACE_V6> lock_mgr6_;
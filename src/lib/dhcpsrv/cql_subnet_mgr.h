@@ -29,8 +29,12 @@
 #include <dhcpsrv/subnet_mgr.h>
 #include <util/dhcp.h>
 
+#include <algorithm>
 #include <mutex>
 #include <stack>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace isc {
 namespace dhcp {
@@ -258,6 +262,9 @@ private:
 
 template <DhcpSpaceType D>
 struct CqlSubnetMgr : SubnetMgr<D> {
+    /// @brief Maximum number of statements in flight during a batch operation.
+    static constexpr size_t MAX_IN_FLIGHT = 100u;
+
     explicit CqlSubnetMgr(isc::db::DatabaseConnection::ParameterMap const &parameters)
         : connection_(parameters) {
         isc::db::CqlVersionExchange<ShardConfigVersionTuple> version_exchange;
@@ -470,6 +477,198 @@ struct CqlSubnetMgr : SubnetMgr<D> {
         config_timestamp.write(exchange.table(), subnet->strings_.subnet_, subnet->timestamp_);
     }
 
+    /// @brief The batch interface
+    ///
+    /// The conditional statements can't be grouped in a BATCH spanning multiple partitions, so
+    /// up to @ref MAX_IN_FLIGHT statements are executed concurrently instead. The config
+    /// timestamp file is read and written once per call.
+    /// @{
+    SubnetInfoCollection<D>
+    selectBySubnets(std::vector<std::string> &subnets,
+                    std::string const &config_timestamp_path = std::string()) override final {
+        CqlSubnetExchange<D> exchange;
+        std::string const &statement_tag("SELECT_SUBNET" + dhcpSpaceToString<D>() + "_ALL");
+
+#ifdef TERASTREAM_FULL_TRANSACTIONS
+        CassUuid txid(connection_.getTransactionID());
+#endif  // TERASTREAM_FULL_TRANSACTIONS
+
+        SubnetInfoCollection<D> collection;
+        for (size_t first = 0; first < subnets.size(); first += MAX_IN_FLIGHT) {
+            size_t const count(std::min(MAX_IN_FLIGHT, subnets.size() - first));
+            std::vector<isc::db::AnyArray> data(count);
+            for (size_t i = 0; i < count; ++i) {
+                data[i].add(&subnets[first + i]);
+#ifdef TERASTREAM_FULL_TRANSACTIONS
+                data[i].add(&txid);
+#endif  // TERASTREAM_FULL_TRANSACTIONS
+            }
+            SubnetInfoCollection<D> const &records(
+                exchange.executeSelects(connection_, data, statement_tag));
+            collection.insert(collection.end(), records.begin(), records.end());
+        }
+
+        std::unordered_map<std::string, isc::db::timestamp_t> timestamps;
+        for (auto const &record : collection) {
+            timestamps.insert_or_assign(record->strings_.subnet_, record->timestamp_);
+        }
+        isc::db::TimestampStore config_timestamp(config_timestamp_path);
+        config_timestamp.write(exchange.table(), timestamps);
+
+        return collection;
+    }
+
+    void delBatch(SubnetInfoCollection<D> &subnets,
+                  std::string const &config_timestamp_path) override final {
+#ifdef GRANULAR_RETRIES
+        SubnetMgr<D>::delBatch(subnets, config_timestamp_path);
+#else  // GRANULAR_RETRIES
+        CqlSubnetExchange<D> exchange;
+        std::string const &statement_tag("DELETE_SUBNET" + dhcpSpaceToString<D>() + "_ALL");
+
+        isc::db::TimestampStore config_timestamp(config_timestamp_path);
+        std::unordered_map<std::string, isc::db::timestamp_t> const &old_timestamps(
+            config_timestamp.read(exchange.table()));
+
+#ifdef TERASTREAM_FULL_TRANSACTIONS
+        CassUuid txid(connection_.getTransactionID());
+#endif  // TERASTREAM_FULL_TRANSACTIONS
+
+        std::unordered_set<std::string> deleted;
+        std::string not_applied;
+        for (size_t first = 0; first < subnets.size(); first += MAX_IN_FLIGHT) {
+            size_t const count(std::min(MAX_IN_FLIGHT, subnets.size() - first));
+            std::vector<isc::db::AnyArray> data(count);
+            std::vector<isc::db::timestamp_t> timestamps(count, 0);
+            for (size_t i = 0; i < count; ++i) {
+                SubnetInfoPtr<D> &subnet(subnets[first + i]);
+                auto const &old_timestamp(old_timestamps.find(subnet->strings_.subnet_));
+                if (old_timestamp != old_timestamps.end()) {
+                    timestamps[i] = old_timestamp->second;
+                }
+                data[i].add(&subnet->strings_.subnet_);
+                data[i].add(&timestamps[i]);
+#ifdef TERASTREAM_FULL_TRANSACTIONS
+                data[i].add(&txid);
+#endif  // TERASTREAM_FULL_TRANSACTIONS
+            }
+            std::vector<bool> const &applied(
+                exchange.executeMutations(connection_, data, statement_tag));
+            for (size_t i = 0; i < count; ++i) {
+                if (applied[i]) {
+                    deleted.insert(subnets[first + i]->strings_.subnet_);
+                } else if (not_applied.empty()) {
+                    not_applied = subnets[first + i]->strings_.subnet_;
+                }
+            }
+        }
+        config_timestamp.del(exchange.table(), deleted);
+
+        if (!not_applied.empty()) {
+            isc_throw(isc::db::StatementNotApplied,
+                      PRETTY_METHOD_NAME() << ": subnet " << not_applied
+                                           << " has not been deleted");
+        }
+#endif  // GRANULAR_RETRIES
+    }
+
+    std::vector<bool> insertBatch(SubnetInfoCollection<D> &subnets,
+                                  std::string const &config_timestamp_path) override final {
+        CqlSubnetExchange<D> exchange;
+        std::string const &statement_tag("INSERT_SUBNET" + dhcpSpaceToString<D>() + "_ALL");
+
+#ifdef TERASTREAM_FULL_TRANSACTIONS
+        CassUuid txid(connection_.getTransactionID());
+#endif  // TERASTREAM_FULL_TRANSACTIONS
+
+        std::vector<bool> applied;
+        applied.reserve(subnets.size());
+        std::unordered_map<std::string, isc::db::timestamp_t> timestamps;
+        for (size_t first = 0; first < subnets.size(); first += MAX_IN_FLIGHT) {
+            size_t const count(std::min(MAX_IN_FLIGHT, subnets.size() - first));
+            std::vector<isc::db::AnyArray> data(count);
+            for (size_t i = 0; i < count; ++i) {
+                SubnetInfoPtr<D> &subnet(subnets[first + i]);
+                subnet->timestamp_ = isc::db::TimestampStore::now();
+                data[i].add(&subnet->strings_.subnet_);
+                exchange.bindCommon(data[i], *subnet);
+                exchange.bindDelta(data[i], *subnet);
+#ifdef TERASTREAM_FULL_TRANSACTIONS
+                data[i].add(&txid);
+#endif  // TERASTREAM_FULL_TRANSACTIONS
+            }
+            std::vector<bool> const &chunk_applied(
+                exchange.executeMutations(connection_, data, statement_tag));
+            for (size_t i = 0; i < count; ++i) {
+                if (chunk_applied[i]) {
+                    timestamps.insert_or_assign(subnets[first + i]->strings_.subnet_,
+                                                subnets[first + i]->timestamp_);
+                }
+                applied.push_back(chunk_applied[i]);
+            }
+        }
+
+        isc::db::TimestampStore config_timestamp(config_timestamp_path);
+        config_timestamp.write(exchange.table(), timestamps);
+
+        return applied;
+    }
+
+    std::vector<bool> updateBatch(SubnetInfoCollection<D> &subnets,
+                                  std::string const &config_timestamp_path) override final {
+#ifdef GRANULAR_RETRIES
+        return SubnetMgr<D>::updateBatch(subnets, config_timestamp_path);
+#else  // GRANULAR_RETRIES
+        CqlSubnetExchange<D> exchange;
+        std::string const &statement_tag("UPDATE_SUBNET" + dhcpSpaceToString<D>() + "_ALL");
+
+        isc::db::TimestampStore config_timestamp(config_timestamp_path);
+        std::unordered_map<std::string, isc::db::timestamp_t> const &old_timestamps(
+            config_timestamp.read(exchange.table()));
+
+#ifdef TERASTREAM_FULL_TRANSACTIONS
+        CassUuid txid(connection_.getTransactionID());
+#endif  // TERASTREAM_FULL_TRANSACTIONS
+
+        std::vector<bool> applied;
+        applied.reserve(subnets.size());
+        std::unordered_map<std::string, isc::db::timestamp_t> timestamps;
+        for (size_t first = 0; first < subnets.size(); first += MAX_IN_FLIGHT) {
+            size_t const count(std::min(MAX_IN_FLIGHT, subnets.size() - first));
+            std::vector<isc::db::AnyArray> data(count);
+            std::vector<isc::db::timestamp_t> chunk_old_timestamps(count, 0);
+            for (size_t i = 0; i < count; ++i) {
+                SubnetInfoPtr<D> &subnet(subnets[first + i]);
+                auto const &old_timestamp(old_timestamps.find(subnet->strings_.subnet_));
+                if (old_timestamp != old_timestamps.end()) {
+                    chunk_old_timestamps[i] = old_timestamp->second;
+                }
+                subnet->timestamp_ = isc::db::TimestampStore::now();
+                exchange.bindCommon(data[i], *subnet);
+                exchange.bindDelta(data[i], *subnet);
+                data[i].add(&subnet->strings_.subnet_);
+                data[i].add(&chunk_old_timestamps[i]);
+#ifdef TERASTREAM_FULL_TRANSACTIONS
+                data[i].add(&txid);
+#endif  // TERASTREAM_FULL_TRANSACTIONS
+            }
+            std::vector<bool> const &chunk_applied(
+                exchange.executeMutations(connection_, data, statement_tag));
+            for (size_t i = 0; i < count; ++i) {
+                if (chunk_applied[i]) {
+                    timestamps.insert_or_assign(subnets[first + i]->strings_.subnet_,
+                                                subnets[first + i]->timestamp_);
+                }
+                applied.push_back(chunk_applied[i]);
+            }
+        }
+        config_timestamp.write(exchange.table(), timestamps);
+
+        return applied;
+#endif  // GRANULAR_RETRIES
+    }
+    /// @}
+
     SubnetID maxSubnetID() override final {
         CqlMaxSubnetIdExchange<D> exchange;
 
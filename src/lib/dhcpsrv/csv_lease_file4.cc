@@ -102,56 +102,41 @@ CSVLeaseFile4::next(Lease4Ptr& lease) {
             return (true);
         }
 
-        // Get the lease address.
-        IOAddress addr(readAddress(row));
-
-        // Get client id. It is possible that the client id is empty and the
-        // returned pointer is NULL. This is ok, but if the client id is NULL,
-        // we need to be careful to not use the NULL pointer.
-        ClientIdPtr client_id = readClientId(row);
-        std::vector<uint8_t> client_id_vec;
-        if (client_id) {
-            client_id_vec = client_id->getClientId();
-        }
-        size_t client_id_len = client_id_vec.size();
-
-        // Get the HW address. It should never be empty and the readHWAddr checks
-        // that.
-        HWAddr hwaddr = readHWAddr(row);
-        uint32_t state = readState(row);
-
-        if ((hwaddr.hwaddr_.empty()) && (client_id_vec.empty()) &&
-            (state != Lease::STATE_DECLINED)) {
-            isc_throw(BadValue, "Lease4: " << addr.toText() << ", state: "
-                      << Lease::basicStatesToText(state)
-                      << " has neither hardware address or client id");
-        }
+        lease = rowToLease(row);
 
-        // Get the user context (can be NULL).
-        ElementPtr ctx = readContext(row);
+    } catch (const std::exception& ex) {
+        // bump the read error count
+        ++read_errs_;
 
-        lease.reset(new Lease4(addr,
-                               HWAddrPtr(new HWAddr(hwaddr)),
-                               client_id_vec.empty() ? NULL : &client_id_vec[0],
-                               client_id_len,
-                               readValid(row),
-                               readCltt(row),
-                               readSubnetID(row),
-                               readFqdnFwd(row),
-                               readFqdnRev(row),
-                               readHostname(row)));
-        lease->state_ = state;
+        // The lease might have been created, so let's set it back to NULL to
+        // signal that lease hasn't been parsed.
+        lease.reset();
+        setReadMsg(ex.what());
+        return (false);
+    }
+
+    // bump the number of leases read
+    ++read_leases_;
 
-        if (ctx) {
-            lease->setContext(ctx);
+    return (true);
+}
+
+bool
+CSVLeaseFile4::parse(const std::string& line, Lease4Ptr& lease) {
+    // Bump the number of read attempts
+    ++reads_;
+
+    try {
+        setReadMsg("success");
+        CSVRow row(line);
+        if (!adjustRow(row)) {
+            isc_throw(BadValue, getReadMsg());
         }
+        lease = rowToLease(row);
 
     } catch (const std::exception& ex) {
         // bump the read error count
         ++read_errs_;
-
-        // The lease might have been created, so let's set it back to NULL to
-        // signal that lease hasn't been parsed.
         lease.reset();
         setReadMsg(ex.what());
         return (false);
@@ -163,6 +148,55 @@ CSVLeaseFile4::next(Lease4Ptr& lease) {
     return (true);
 }
 
+Lease4Ptr
+CSVLeaseFile4::rowToLease(const CSVRow& row) {
+    // Get the lease address.
+    IOAddress addr(readAddress(row));
+
+    // Get client id. It is possible that the client id is empty and the
+    // returned pointer is NULL. This is ok, but if the client id is NULL,
+    // we need to be careful to not use the NULL pointer.
+    ClientIdPtr client_id = readClientId(row);
+    std::vector<uint8_t> client_id_vec;
+    if (client_id) {
+        client_id_vec = client_id->getClientId();
+    }
+    size_t client_id_len = client_id_vec.size();
+
+    // Get the HW address. It should never be empty and the readHWAddr checks
+    // that.
+    HWAddr hwaddr = readHWAddr(row);
+    uint32_t state = readState(row);
+
+    if ((hwaddr.hwaddr_.empty()) && (client_id_vec.empty()) &&
+        (state != Lease::STATE_DECLINED)) {
+        isc_throw(BadValue, "Lease4: " << addr.toText() << ", state: "
+                  << Lease::basicStatesToText(state)
+                  << " has neither hardware address or client id");
+    }
+
+    // Get the user context (can be NULL).
+    ElementPtr ctx = readContext(row);
+
+    Lease4Ptr lease(new Lease4(addr,
+                               HWAddrPtr(new HWAddr(hwaddr)),
+                               client_id_vec.empty() ? NULL : &client_id_vec[0],
+                               client_id_len,
+                               readValid(row),
+                               readCltt(row),
+                               readSubnetID(row),
+                               readFqdnFwd(row),
+                               readFqdnRev(row),
+                               readHostname(row)));
+    lease->state_ = state;
+
+    if (ctx) {
+        lease->setContext(ctx);
+    }
+
+    return (lease);
+}
+
 void
 CSVLeaseFile4::initColumns() {
     addColumn("address", "1.0");
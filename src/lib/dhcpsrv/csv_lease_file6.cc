@@ -102,28 +102,8 @@ CSVLeaseFile6::next(Lease6Ptr& lease) {
             return (true);
         }
 
-        lease.reset(new Lease6(readType(row), readAddress(row), readDUID(row),
-                               readIAID(row), readPreferred(row),
-                               readValid(row),
-                               readSubnetID(row),
-                               readHWAddr(row),
-                               readPrefixLen(row),
-                               readAllocation(row)));
-        lease->cltt_ = readCltt(row);
-        lease->fqdn_fwd_ = readFqdnFwd(row);
-        lease->fqdn_rev_ = readFqdnRev(row);
-        lease->hostname_ = readHostname(row);
-        lease->state_ = readState(row);
-        lease->pool_id_ = readPoolID(row);
-        if ((*lease->duid_ == DUID::EMPTY())
-            && lease->state_ != Lease::STATE_DECLINED) {
-            isc_throw(isc::BadValue, "The Empty DUID is"
-                      "only valid for declined leases");
-        }
-        ElementPtr ctx = readContext(row);
-        if (ctx) {
-            lease->setContext(ctx);
-        }
+        lease = rowToLease(row);
+
     } catch (const std::exception& ex) {
         // bump the read error count
         ++read_errs_;
@@ -141,6 +121,61 @@ CSVLeaseFile6::next(Lease6Ptr& lease) {
     return (true);
 }
 
+bool
+CSVLeaseFile6::parse(const std::string& line, Lease6Ptr& lease) {
+    // Bump the number of read attempts
+    ++reads_;
+
+    try {
+        setReadMsg("success");
+        CSVRow row(line);
+        if (!adjustRow(row)) {
+            isc_throw(BadValue, getReadMsg());
+        }
+        lease = rowToLease(row);
+
+    } catch (const std::exception& ex) {
+        // bump the read error count
+        ++read_errs_;
+        lease.reset();
+        setReadMsg(ex.what());
+        return (false);
+    }
+
+    // bump the number of leases read
+    ++read_leases_;
+
+    return (true);
+}
+
+Lease6Ptr
+CSVLeaseFile6::rowToLease(const CSVRow& row) {
+    Lease6Ptr lease(new Lease6(readType(row), readAddress(row), readDUID(row),
+                               readIAID(row), readPreferred(row),
+                               readValid(row),
+                               readSubnetID(row),
+                               readHWAddr(row),
+                               readPrefixLen(row),
+                               readAllocation(row)));
+    lease->cltt_ = readCltt(row);
+    lease->fqdn_fwd_ = readFqdnFwd(row);
+    lease->fqdn_rev_ = readFqdnRev(row);
+    lease->hostname_ = readHostname(row);
+    lease->state_ = readState(row);
+    lease->pool_id_ = readPoolID(row);
+    if ((*lease->duid_ == DUID::EMPTY())
+        && lease->state_ != Lease::STATE_DECLINED) {
+        isc_throw(isc::BadValue, "The Empty DUID is"
+                  "only valid for declined leases");
+    }
+    ElementPtr ctx = readContext(row);
+    if (ctx) {
+        lease->setContext(ctx);
+    }
+
+    return (lease);
+}
+
 void
 CSVLeaseFile6::initColumns() {
     addColumn("address", "1.0");
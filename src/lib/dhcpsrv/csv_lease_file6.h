@@ -83,8 +83,32 @@ public:
     /// ticket http://oldkea.isc.org/ticket/2405 is implemented.
     bool next(Lease6Ptr& lease);
 
+    /// @brief Parses a single row of the lease file.
+    ///
+    /// The row is validated and adjusted against the schema of the file,
+    /// which must have been opened before to parse its header. This is
+    /// used by callers reading the file contents themselves, e.g. in
+    /// large chunks. The statistics are updated as for @c next.
+    ///
+    /// This function is exception safe.
+    ///
+    /// @param line Row of the lease file without the trailing new line.
+    /// @param [out] lease Pointer to the lease parsed from the row or
+    /// NULL pointer if the row is invalid.
+    ///
+    /// @return true if the lease has been parsed, false otherwise. The
+    /// error message can be read using @c CSVFile::getReadMsg.
+    bool parse(const std::string& line, Lease6Ptr& lease);
+
 private:
 
+    /// @brief Creates the lease from the row adjusted to the current schema.
+    ///
+    /// @param row CSV file row holding lease information.
+    /// @return Pointer to the lease.
+    /// @throw isc::Exception or std::exception if the row is invalid.
+    Lease6Ptr rowToLease(const util::CSVRow& row);
+
     /// @brief Initializes columns of the CSV file holding leases.
     ///
     /// This function initializes the following columns:
@@ -47,6 +47,9 @@ extern const isc::log::MessageID DHCPSRV_CFGMGR_USE_UNICAST = "DHCPSRV_CFGMGR_US
 extern const isc::log::MessageID DHCPSRV_CLOSE_DB = "DHCPSRV_CLOSE_DB";
 extern const isc::log::MessageID DHCPSRV_CQL_ADD_ADDR4 = "DHCPSRV_CQL_ADD_ADDR4";
 extern const isc::log::MessageID DHCPSRV_CQL_ADD_ADDR6 = "DHCPSRV_CQL_ADD_ADDR6";
+extern const isc::log::MessageID DHCPSRV_CQL_ADD_LEASES4 = "DHCPSRV_CQL_ADD_LEASES4";
+extern const isc::log::MessageID DHCPSRV_CQL_ADD_LEASES6 = "DHCPSRV_CQL_ADD_LEASES6";
+extern const isc::log::MessageID DHCPSRV_CQL_ADD_LEASE_FAILED = "DHCPSRV_CQL_ADD_LEASE_FAILED";
 extern const isc::log::MessageID DHCPSRV_CQL_BEGIN_TRANSACTION = "DHCPSRV_CQL_BEGIN_TRANSACTION";
 extern const isc::log::MessageID DHCPSRV_CQL_CLEAR_MASTER_CONFIG = "DHCPSRV_CQL_CLEAR_MASTER_CONFIG";
 extern const isc::log::MessageID DHCPSRV_CQL_COMMIT = "DHCPSRV_CQL_COMMIT";
@@ -95,6 +98,9 @@ extern const isc::log::MessageID DHCPSRV_CQL_HOST_SYNC_RESERVATIONS = "DHCPSRV_C
 extern const isc::log::MessageID DHCPSRV_CQL_INSERT_MASTER_CONFIG = "DHCPSRV_CQL_INSERT_MASTER_CONFIG";
 extern const isc::log::MessageID DHCPSRV_CQL_INSERT_SHARD_CONFIG = "DHCPSRV_CQL_INSERT_SHARD_CONFIG";
 extern const isc::log::MessageID DHCPSRV_CQL_LEASE_EXCEPTION_THROWN = "DHCPSRV_CQL_LEASE_EXCEPTION_THROWN";
+extern const isc::log::MessageID DHCPSRV_CQL_LEASE_EXPIRATION_UPDATE_FAILED = "DHCPSRV_CQL_LEASE_EXPIRATION_UPDATE_FAILED";
+extern const isc::log::MessageID DHCPSRV_CQL_LEASE_STATS_COLLECTED = "DHCPSRV_CQL_LEASE_STATS_COLLECTED";
+extern const isc::log::MessageID DHCPSRV_CQL_LEASE_STAT_UPDATE_FAILED = "DHCPSRV_CQL_LEASE_STAT_UPDATE_FAILED";
 extern const isc::log::MessageID DHCPSRV_CQL_ROLLBACK = "DHCPSRV_CQL_ROLLBACK";
 extern const isc::log::MessageID DHCPSRV_CQL_SHARD_CONFIGURATION_DELETE = "DHCPSRV_CQL_SHARD_CONFIGURATION_DELETE";
 extern const isc::log::MessageID DHCPSRV_CQL_SUBNET_DB = "DHCPSRV_CQL_SUBNET_DB";
@@ -152,9 +158,13 @@ extern const isc::log::MessageID DHCPSRV_MEMFILE_GET_SUBID6 = "DHCPSRV_MEMFILE_G
 extern const isc::log::MessageID DHCPSRV_MEMFILE_GET_SUBID_CLIENTID = "DHCPSRV_MEMFILE_GET_SUBID_CLIENTID";
 extern const isc::log::MessageID DHCPSRV_MEMFILE_GET_SUBID_HWADDR = "DHCPSRV_MEMFILE_GET_SUBID_HWADDR";
 extern const isc::log::MessageID DHCPSRV_MEMFILE_GET_VERSION = "DHCPSRV_MEMFILE_GET_VERSION";
+extern const isc::log::MessageID DHCPSRV_MEMFILE_GROUP_COMMIT = "DHCPSRV_MEMFILE_GROUP_COMMIT";
+extern const isc::log::MessageID DHCPSRV_MEMFILE_LEASE_COMPACT_ROW_ERROR = "DHCPSRV_MEMFILE_LEASE_COMPACT_ROW_ERROR";
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LEASE_FILE_LOAD = "DHCPSRV_MEMFILE_LEASE_FILE_LOAD";
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LEASE_LOAD = "DHCPSRV_MEMFILE_LEASE_LOAD";
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LEASE_LOAD_ROW_ERROR = "DHCPSRV_MEMFILE_LEASE_LOAD_ROW_ERROR";
+extern const isc::log::MessageID DHCPSRV_MEMFILE_LEASE_SNAPSHOT_IGNORED = "DHCPSRV_MEMFILE_LEASE_SNAPSHOT_IGNORED";
+extern const isc::log::MessageID DHCPSRV_MEMFILE_LEASE_SNAPSHOT_LOAD = "DHCPSRV_MEMFILE_LEASE_SNAPSHOT_LOAD";
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_EXECUTE = "DHCPSRV_MEMFILE_LFC_EXECUTE";
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_LEASE_FILE_RENAME_FAIL = "DHCPSRV_MEMFILE_LFC_LEASE_FILE_RENAME_FAIL";
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_LEASE_FILE_REOPEN_FAIL = "DHCPSRV_MEMFILE_LFC_LEASE_FILE_REOPEN_FAIL";
@@ -177,6 +187,8 @@ extern const isc::log::MessageID DHCPSRV_MEMFILE_WIPE_LEASES6_FINISHED = "DHCPSR
 extern const isc::log::MessageID DHCPSRV_MULTIPLE_RAW_SOCKETS_PER_IFACE = "DHCPSRV_MULTIPLE_RAW_SOCKETS_PER_IFACE";
 extern const isc::log::MessageID DHCPSRV_MYSQL_ADD_ADDR4 = "DHCPSRV_MYSQL_ADD_ADDR4";
 extern const isc::log::MessageID DHCPSRV_MYSQL_ADD_ADDR6 = "DHCPSRV_MYSQL_ADD_ADDR6";
+extern const isc::log::MessageID DHCPSRV_MYSQL_ADD_LEASES4 = "DHCPSRV_MYSQL_ADD_LEASES4";
+extern const isc::log::MessageID DHCPSRV_MYSQL_ADD_LEASES6 = "DHCPSRV_MYSQL_ADD_LEASES6";
 extern const isc::log::MessageID DHCPSRV_MYSQL_BEGIN_TRANSACTION = "DHCPSRV_MYSQL_BEGIN_TRANSACTION";
 extern const isc::log::MessageID DHCPSRV_MYSQL_CLEAR_MASTER_CONFIG = "DHCPSRV_MYSQL_CLEAR_MASTER_CONFIG";
 extern const isc::log::MessageID DHCPSRV_MYSQL_COMMIT = "DHCPSRV_MYSQL_COMMIT";
@@ -225,11 +237,16 @@ extern const isc::log::MessageID DHCPSRV_MYSQL_UPDATE_ADDR4 = "DHCPSRV_MYSQL_UPD
 extern const isc::log::MessageID DHCPSRV_MYSQL_UPDATE_ADDR6 = "DHCPSRV_MYSQL_UPDATE_ADDR6";
 extern const isc::log::MessageID DHCPSRV_MYSQL_UPDATE_SHARD_CONFIG = "DHCPSRV_MYSQL_UPDATE_SHARD_CONFIG";
 extern const isc::log::MessageID DHCPSRV_MYSQL_UPDATE_SHARD_CONFIG_TIMESTAMP_CHANGED = "DHCPSRV_MYSQL_UPDATE_SHARD_CONFIG_TIMESTAMP_CHANGED";
+extern const isc::log::MessageID DHCPSRV_NOTIFICATIONS_BATCHING_UNSUPPORTED = "DHCPSRV_NOTIFICATIONS_BATCHING_UNSUPPORTED";
+extern const isc::log::MessageID DHCPSRV_NOTIFICATIONS_QUEUE_FULL = "DHCPSRV_NOTIFICATIONS_QUEUE_FULL";
+extern const isc::log::MessageID DHCPSRV_NOTIFICATIONS_SEND_FAILED = "DHCPSRV_NOTIFICATIONS_SEND_FAILED";
 extern const isc::log::MessageID DHCPSRV_NOTYPE_DB = "DHCPSRV_NOTYPE_DB";
 extern const isc::log::MessageID DHCPSRV_NO_SOCKETS_OPEN = "DHCPSRV_NO_SOCKETS_OPEN";
 extern const isc::log::MessageID DHCPSRV_OPEN_SOCKET_FAIL = "DHCPSRV_OPEN_SOCKET_FAIL";
 extern const isc::log::MessageID DHCPSRV_PGSQL_ADD_ADDR4 = "DHCPSRV_PGSQL_ADD_ADDR4";
 extern const isc::log::MessageID DHCPSRV_PGSQL_ADD_ADDR6 = "DHCPSRV_PGSQL_ADD_ADDR6";
+extern const isc::log::MessageID DHCPSRV_PGSQL_ADD_LEASES4 = "DHCPSRV_PGSQL_ADD_LEASES4";
+extern const isc::log::MessageID DHCPSRV_PGSQL_ADD_LEASES6 = "DHCPSRV_PGSQL_ADD_LEASES6";
 extern const isc::log::MessageID DHCPSRV_PGSQL_BEGIN_TRANSACTION = "DHCPSRV_PGSQL_BEGIN_TRANSACTION";
 extern const isc::log::MessageID DHCPSRV_PGSQL_CLEAR_MASTER_CONFIG = "DHCPSRV_PGSQL_CLEAR_MASTER_CONFIG";
 extern const isc::log::MessageID DHCPSRV_PGSQL_COMMIT = "DHCPSRV_PGSQL_COMMIT";
@@ -337,6 +354,9 @@ const char* values[] = {
     "DHCPSRV_CLOSE_DB", "closing currently open %1 database",
     "DHCPSRV_CQL_ADD_ADDR4", "adding IPv4 lease with address %1",
     "DHCPSRV_CQL_ADD_ADDR6", "adding IPv6 lease with address %1",
+    "DHCPSRV_CQL_ADD_LEASES4", "adding %1 IPv4 leases",
+    "DHCPSRV_CQL_ADD_LEASES6", "adding %1 IPv6 leases",
+    "DHCPSRV_CQL_ADD_LEASE_FAILED", "failed to add the lease with address %1: %2",
     "DHCPSRV_CQL_BEGIN_TRANSACTION", "begin transaction.",
     "DHCPSRV_CQL_CLEAR_MASTER_CONFIG", "Clearing the DHCP master configuration from database",
     "DHCPSRV_CQL_COMMIT", "committing to Cassandra database.",
@@ -385,6 +405,9 @@ const char* values[] = {
     "DHCPSRV_CQL_INSERT_MASTER_CONFIG", "Inserting a new DHCP master server configuration with ID %1 and shard name %2",
     "DHCPSRV_CQL_INSERT_SHARD_CONFIG", "Inserting a new DHCP server configuration with ID %1",
     "DHCPSRV_CQL_LEASE_EXCEPTION_THROWN", "Exception thrown during Cassandra operation: %1",
+    "DHCPSRV_CQL_LEASE_EXPIRATION_UPDATE_FAILED", "failed to update the IPv%1 lease expiration index: %2",
+    "DHCPSRV_CQL_LEASE_STATS_COLLECTED", "IPv%1 lease statistics collected from %2",
+    "DHCPSRV_CQL_LEASE_STAT_UPDATE_FAILED", "failed to update the IPv%1 lease statistics counters: %2",
     "DHCPSRV_CQL_ROLLBACK", "rolling back Cassandra database.",
     "DHCPSRV_CQL_SHARD_CONFIGURATION_DELETE", "Deleting DHCP server configuration with ID %1...",
     "DHCPSRV_CQL_SUBNET_DB", "opening Cassandra subnet database: %1",
@@ -442,9 +465,13 @@ const char* values[] = {
     "DHCPSRV_MEMFILE_GET_SUBID_CLIENTID", "obtaining IPv4 lease for subnet ID %1 and client ID %2",
     "DHCPSRV_MEMFILE_GET_SUBID_HWADDR", "obtaining IPv4 lease for subnet ID %1 and hardware address %2",
     "DHCPSRV_MEMFILE_GET_VERSION", "obtaining schema version information",
+    "DHCPSRV_MEMFILE_GROUP_COMMIT", "group commit of lease file updates enabled: fsync-policy %1, fsync-interval %2 ms, wait-for-durability %3",
+    "DHCPSRV_MEMFILE_LEASE_COMPACT_ROW_ERROR", "discarding row at offset %1 of the lease file %2, error: %3",
     "DHCPSRV_MEMFILE_LEASE_FILE_LOAD", "loading leases from file %1",
     "DHCPSRV_MEMFILE_LEASE_LOAD", "loading lease %1",
     "DHCPSRV_MEMFILE_LEASE_LOAD_ROW_ERROR", "discarding row %1, error: %2",
+    "DHCPSRV_MEMFILE_LEASE_SNAPSHOT_IGNORED", "ignoring the lease snapshot %1, loading the lease file %2 instead: %3",
+    "DHCPSRV_MEMFILE_LEASE_SNAPSHOT_LOAD", "loading leases from the lease snapshot %1",
     "DHCPSRV_MEMFILE_LFC_EXECUTE", "executing Lease File Cleanup using: %1",
     "DHCPSRV_MEMFILE_LFC_LEASE_FILE_RENAME_FAIL", "failed to rename the current lease file %1 to %2, reason: %3",
     "DHCPSRV_MEMFILE_LFC_LEASE_FILE_REOPEN_FAIL", "failed to reopen lease file %1 after preparing input file for lease file cleanup, reason: %2, new leases will not be persisted!",
@@ -467,6 +494,8 @@ const char* values[] = {
     "DHCPSRV_MULTIPLE_RAW_SOCKETS_PER_IFACE", "current configuration will result in opening multiple broadcast capable sockets on some interfaces and some DHCP messages may be duplicated",
     "DHCPSRV_MYSQL_ADD_ADDR4", "adding IPv4 lease with address %1",
     "DHCPSRV_MYSQL_ADD_ADDR6", "adding IPv6 lease with address %1, lease type %2",
+    "DHCPSRV_MYSQL_ADD_LEASES4", "adding %1 IPv4 leases",
+    "DHCPSRV_MYSQL_ADD_LEASES6", "adding %1 IPv6 leases",
     "DHCPSRV_MYSQL_BEGIN_TRANSACTION", "committing to MySQL database",
     "DHCPSRV_MYSQL_CLEAR_MASTER_CONFIG", "Clearing the DHCP master configuration from database",
     "DHCPSRV_MYSQL_COMMIT", "committing to MySQL database",
@@ -515,11 +544,16 @@ const char* values[] = {
     "DHCPSRV_MYSQL_UPDATE_ADDR6", "updating IPv6 lease for address %1, lease type %2",
     "DHCPSRV_MYSQL_UPDATE_SHARD_CONFIG", "Updating the DHCP server configuration with ID %1.",
     "DHCPSRV_MYSQL_UPDATE_SHARD_CONFIG_TIMESTAMP_CHANGED", "Cannot update the DHCP database server configuration (old timestamp is %1, new timestamp is %2)",
+    "DHCPSRV_NOTIFICATIONS_BATCHING_UNSUPPORTED", "notifications socket %1 does not accept batches, sending notifications one by one",
+    "DHCPSRV_NOTIFICATIONS_QUEUE_FULL", "notifications queue for socket %1 is full with %2 notifications, dropping notifications",
+    "DHCPSRV_NOTIFICATIONS_SEND_FAILED", "failed to send %1 notifications to socket %2: %3",
     "DHCPSRV_NOTYPE_DB", "no 'type' keyword to determine database backend: %1",
     "DHCPSRV_NO_SOCKETS_OPEN", "no interface configured to listen to DHCP traffic",
     "DHCPSRV_OPEN_SOCKET_FAIL", "failed to open socket: %1",
     "DHCPSRV_PGSQL_ADD_ADDR4", "adding IPv4 lease with address %1",
     "DHCPSRV_PGSQL_ADD_ADDR6", "adding IPv6 lease with address %1, lease type %2",
+    "DHCPSRV_PGSQL_ADD_LEASES4", "adding %1 IPv4 leases",
+    "DHCPSRV_PGSQL_ADD_LEASES6", "adding %1 IPv6 leases",
     "DHCPSRV_PGSQL_BEGIN_TRANSACTION", "committing to PostgreSQL database",
     "DHCPSRV_PGSQL_CLEAR_MASTER_CONFIG", "Clearing the DHCP master configuration from database",
     "DHCPSRV_PGSQL_COMMIT", "committing to PostgreSQL database",
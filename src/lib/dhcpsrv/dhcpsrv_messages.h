@@ -48,6 +48,9 @@ extern const isc::log::MessageID DHCPSRV_CFGMGR_USE_UNICAST;
 extern const isc::log::MessageID DHCPSRV_CLOSE_DB;
 extern const isc::log::MessageID DHCPSRV_CQL_ADD_ADDR4;
 extern const isc::log::MessageID DHCPSRV_CQL_ADD_ADDR6;
+extern const isc::log::MessageID DHCPSRV_CQL_ADD_LEASES4;
+extern const isc::log::MessageID DHCPSRV_CQL_ADD_LEASES6;
+extern const isc::log::MessageID DHCPSRV_CQL_ADD_LEASE_FAILED;
 extern const isc::log::MessageID DHCPSRV_CQL_BEGIN_TRANSACTION;
 extern const isc::log::MessageID DHCPSRV_CQL_CLEAR_MASTER_CONFIG;
 extern const isc::log::MessageID DHCPSRV_CQL_COMMIT;
@@ -96,6 +99,9 @@ extern const isc::log::MessageID DHCPSRV_CQL_HOST_SYNC_RESERVATIONS;
 extern const isc::log::MessageID DHCPSRV_CQL_INSERT_MASTER_CONFIG;
 extern const isc::log::MessageID DHCPSRV_CQL_INSERT_SHARD_CONFIG;
 extern const isc::log::MessageID DHCPSRV_CQL_LEASE_EXCEPTION_THROWN;
+extern const isc::log::MessageID DHCPSRV_CQL_LEASE_EXPIRATION_UPDATE_FAILED;
+extern const isc::log::MessageID DHCPSRV_CQL_LEASE_STATS_COLLECTED;
+extern const isc::log::MessageID DHCPSRV_CQL_LEASE_STAT_UPDATE_FAILED;
 extern const isc::log::MessageID DHCPSRV_CQL_ROLLBACK;
 extern const isc::log::MessageID DHCPSRV_CQL_SHARD_CONFIGURATION_DELETE;
 extern const isc::log::MessageID DHCPSRV_CQL_SUBNET_DB;
@@ -153,9 +159,13 @@ extern const isc::log::MessageID DHCPSRV_MEMFILE_GET_SUBID6;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_GET_SUBID_CLIENTID;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_GET_SUBID_HWADDR;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_GET_VERSION;
+extern const isc::log::MessageID DHCPSRV_MEMFILE_GROUP_COMMIT;
+extern const isc::log::MessageID DHCPSRV_MEMFILE_LEASE_COMPACT_ROW_ERROR;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LEASE_FILE_LOAD;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LEASE_LOAD;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LEASE_LOAD_ROW_ERROR;
+extern const isc::log::MessageID DHCPSRV_MEMFILE_LEASE_SNAPSHOT_IGNORED;
+extern const isc::log::MessageID DHCPSRV_MEMFILE_LEASE_SNAPSHOT_LOAD;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_EXECUTE;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_LEASE_FILE_RENAME_FAIL;
 extern const isc::log::MessageID DHCPSRV_MEMFILE_LFC_LEASE_FILE_REOPEN_FAIL;
@@ -178,6 +188,8 @@ extern const isc::log::MessageID DHCPSRV_MEMFILE_WIPE_LEASES6_FINISHED;
 extern const isc::log::MessageID DHCPSRV_MULTIPLE_RAW_SOCKETS_PER_IFACE;
 extern const isc::log::MessageID DHCPSRV_MYSQL_ADD_ADDR4;
 extern const isc::log::MessageID DHCPSRV_MYSQL_ADD_ADDR6;
+extern const isc::log::MessageID DHCPSRV_MYSQL_ADD_LEASES4;
+extern const isc::log::MessageID DHCPSRV_MYSQL_ADD_LEASES6;
 extern const isc::log::MessageID DHCPSRV_MYSQL_BEGIN_TRANSACTION;
 extern const isc::log::MessageID DHCPSRV_MYSQL_CLEAR_MASTER_CONFIG;
 extern const isc::log::MessageID DHCPSRV_MYSQL_COMMIT;
@@ -226,11 +238,16 @@ extern const isc::log::MessageID DHCPSRV_MYSQL_UPDATE_ADDR4;
 extern const isc::log::MessageID DHCPSRV_MYSQL_UPDATE_ADDR6;
 extern const isc::log::MessageID DHCPSRV_MYSQL_UPDATE_SHARD_CONFIG;
 extern const isc::log::MessageID DHCPSRV_MYSQL_UPDATE_SHARD_CONFIG_TIMESTAMP_CHANGED;
+extern const isc::log::MessageID DHCPSRV_NOTIFICATIONS_BATCHING_UNSUPPORTED;
+extern const isc::log::MessageID DHCPSRV_NOTIFICATIONS_QUEUE_FULL;
+extern const isc::log::MessageID DHCPSRV_NOTIFICATIONS_SEND_FAILED;
 extern const isc::log::MessageID DHCPSRV_NOTYPE_DB;
 extern const isc::log::MessageID DHCPSRV_NO_SOCKETS_OPEN;
 extern const isc::log::MessageID DHCPSRV_OPEN_SOCKET_FAIL;
 extern const isc::log::MessageID DHCPSRV_PGSQL_ADD_ADDR4;
 extern const isc::log::MessageID DHCPSRV_PGSQL_ADD_ADDR6;
+extern const isc::log::MessageID DHCPSRV_PGSQL_ADD_LEASES4;
+extern const isc::log::MessageID DHCPSRV_PGSQL_ADD_LEASES6;
 extern const isc::log::MessageID DHCPSRV_PGSQL_BEGIN_TRANSACTION;
 extern const isc::log::MessageID DHCPSRV_PGSQL_CLEAR_MASTER_CONFIG;
 extern const isc::log::MessageID DHCPSRV_PGSQL_COMMIT;
@@ -44,9 +44,10 @@ Lease::Lease(const isc::asiolink::IOAddress& addr,
 #ifdef TERASTREAM
       privacy_expire_(0), privacy_hash_(new PrivacyHash(0)),
 #endif  // TERASTREAM
-      subnet_id_(subnet_id),
+      subnet_id_(subnet_id), old_subnet_id_(subnet_id),
       hostname_(boost::algorithm::to_lower_copy(hostname)), fqdn_fwd_(fqdn_fwd),
-      fqdn_rev_(fqdn_rev), hwaddr_(hwaddr), state_(STATE_DEFAULT) {
+      fqdn_rev_(fqdn_rev), hwaddr_(hwaddr), state_(STATE_DEFAULT),
+      old_state_(STATE_DEFAULT) {
 }
 
 std::string
@@ -288,7 +289,9 @@ Lease4::Lease4(const Lease4& other)
     {
 
     // Copy over fields derived from Lease.
+    old_subnet_id_ = other.old_subnet_id_;
     state_ = other.state_;
+    old_state_ = other.old_state_;
 
     // Copy the hardware address if it is defined.
     if (other.hwaddr_) {
@@ -397,10 +400,12 @@ Lease4::operator=(const Lease4& other) {
         privacy_history_ = other.privacy_history_;
 #endif  // TERASTREAM
         subnet_id_ = other.subnet_id_;
+        old_subnet_id_ = other.old_subnet_id_;
         hostname_ = other.hostname_;
         fqdn_fwd_ = other.fqdn_fwd_;
         fqdn_rev_ = other.fqdn_rev_;
         state_ = other.state_;
+        old_state_ = other.old_state_;
 
         // Copy the hardware address if it is defined.
         if (other.hwaddr_) {
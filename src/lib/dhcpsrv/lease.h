@@ -162,6 +162,11 @@ struct Lease : public isc::data::UserContext, public isc::data::CfgToElement {
     /// Specifies the identification of the subnet to which the lease belongs.
     SubnetID subnet_id_;
 
+    /// @brief Old subnet identifier
+    ///
+    /// Specifies the subnet to which the lease belonged before update.
+    SubnetID old_subnet_id_;
+
     /// @brief Client hostname
     ///
     /// This field is in lower case and may be empty.
@@ -193,6 +198,11 @@ struct Lease : public isc::data::UserContext, public isc::data::CfgToElement {
     /// belonging to this class.
     uint32_t state_;
 
+    /// @brief Old lease state(s)
+    ///
+    /// Holds the lease state(s) before update.
+    uint32_t old_state_;
+
     /// @brief Convert Lease to Printable Form
     ///
     /// @return String form of the lease
@@ -0,0 +1,143 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <dhcpsrv/lease_expiration_buckets.h>
+
+#include <algorithm>
+#include <set>
+
+namespace isc {
+namespace dhcp {
+
+int64_t
+LeaseExpirationBuckets::getBucket(const int64_t time) {
+    // Round down, also for the times before the epoch.
+    const int64_t bucket = time / BUCKET_WIDTH;
+    return ((time % BUCKET_WIDTH < 0) ? bucket - 1 : bucket);
+}
+
+int64_t
+LeaseExpirationBuckets::getEntryBucket(const int64_t expire, const int64_t now) {
+    return (getBucket(std::max(expire, now)));
+}
+
+bool
+LeaseExpirationBuckets::needsEntry(const Lease& lease, const int64_t now) {
+    const bool reclaimed = lease.stateExpiredReclaimed();
+    const bool old_reclaimed = (lease.old_state_ == Lease::STATE_EXPIRED_RECLAIMED);
+    const int64_t expire = lease.getExpirationTime();
+    const int64_t old_expire = static_cast<int64_t>(lease.old_cltt_) + lease.old_valid_lft_;
+    return ((reclaimed != old_reclaimed) || (old_expire < now) ||
+            (getBucket(expire) != getBucket(old_expire)));
+}
+
+LeaseExpirationBuckets::LeaseExpirationBuckets(ExpirationBucketSource& source,
+                                               const size_t thread_count,
+                                               const size_t range_count)
+    : source_(source), thread_count_(std::max(thread_count, static_cast<size_t>(1))),
+      range_count_(range_count) {
+}
+
+bool
+LeaseExpirationBuckets::getExpiredLeases(const bool reclaimed, const int64_t limit,
+                                         const int64_t now, const size_t max_leases,
+                                         std::vector<LeasePtr>& leases) {
+    int64_t cursor = 0;
+    switch (source_.getCursor(reclaimed, cursor)) {
+    case ExpirationBucketSource::INDEX_READY:
+        break;
+    case ExpirationBucketSource::INDEX_ABSENT:
+        if (!rebuild(now) ||
+            (source_.getCursor(reclaimed, cursor) != ExpirationBucketSource::INDEX_READY)) {
+            return (false);
+        }
+        break;
+    case ExpirationBucketSource::INDEX_REBUILDING:
+        return (false);
+    }
+
+    // The cursor never moves to the buckets which may still get entries.
+    const int64_t last = getBucket(limit);
+    const int64_t movable = std::min(last, getBucket(now) - 1);
+
+    // A lease may have live entries in many buckets, e.g. when it has
+    // expired again after a renewal.
+    std::set<asiolink::IOAddress> found;
+    const size_t first_lease = leases.size();
+    int64_t new_cursor = cursor;
+    for (int64_t bucket = cursor; bucket <= last; ++bucket) {
+        if ((max_leases > 0) && (leases.size() - first_lease >= max_leases)) {
+            break;
+        }
+
+        std::vector<ExpirationBucketEntry> entries;
+        source_.readBucket(reclaimed, bucket, entries);
+        bool drained = true;
+        for (auto const& entry : entries) {
+            const LeasePtr& lease = entry.lease_;
+            if (!lease || (lease->stateExpiredReclaimed() != reclaimed) ||
+                (getBucket(lease->getExpirationTime()) > bucket)) {
+                source_.deleteEntry(reclaimed, bucket, entry.address_);
+                continue;
+            }
+
+            // The entry is kept until the lease moves or goes away.
+            drained = false;
+            if ((lease->getExpirationTime() < limit) &&
+                ((max_leases == 0) || (leases.size() - first_lease < max_leases)) &&
+                found.insert(lease->addr_).second) {
+                leases.push_back(lease);
+            }
+        }
+
+        if (drained && (bucket == new_cursor) && (bucket < movable)) {
+            new_cursor = bucket + 1;
+        }
+    }
+
+    if (new_cursor != cursor) {
+        source_.moveCursor(reclaimed, cursor, new_cursor);
+    }
+    return (true);
+}
+
+bool
+LeaseExpirationBuckets::rebuild(const int64_t now) {
+    if (!source_.claimIndexRebuild()) {
+        return (false);
+    }
+
+    try {
+        scanTokenRing(range_count_, thread_count_,
+                      [this, now](const TokenRange& range, const size_t) {
+            source_.indexTokenRange(range, now);
+        });
+
+        // The entries written during the rebuild are in the bucket of the
+        // start or later, give or take the clock differences.
+        source_.setIndexReady(getBucket(now) - 1);
+    } catch (...) {
+        source_.abortIndexRebuild();
+        throw;
+    }
+    return (true);
+}
+
+}  // namespace dhcp
+}  // namespace isc
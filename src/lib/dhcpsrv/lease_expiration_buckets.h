@@ -0,0 +1,216 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef LEASE_EXPIRATION_BUCKETS_H
+#define LEASE_EXPIRATION_BUCKETS_H
+
+#include <asiolink/io_address.h>
+#include <dhcpsrv/lease.h>
+#include <dhcpsrv/lease_stat_collector.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Entry of an expiration bucket.
+struct ExpirationBucketEntry {
+    /// @brief Address of the lease.
+    asiolink::IOAddress address_;
+
+    /// @brief Lease currently stored at the address, null if none.
+    LeasePtr lease_;
+};
+
+/// @brief Database queries of the expiration index.
+///
+/// The index maps a bucket, i.e. a minute of expiration time, to the
+/// addresses of the leases expiring in it. There is one set of buckets for
+/// the leases to reclaim and one for the reclaimed leases. The entries are
+/// never updated: a lease which changes gets a new entry and the old one
+/// is dropped when its bucket is read. The oldest bucket which may hold
+/// entries is tracked by a cursor per set. The backend implements it on top
+/// of its driver. All queries are for one lease family.
+class ExpirationBucketSource {
+public:
+
+    /// @brief State of the index.
+    typedef enum {
+        /// The index has never been built.
+        INDEX_ABSENT,
+        /// The index is being rebuilt.
+        INDEX_REBUILDING,
+        /// The index is up to date.
+        INDEX_READY
+    } IndexStatus;
+
+    /// @brief Destructor.
+    virtual ~ExpirationBucketSource() = default;
+
+    /// @brief Returns the state of the index and the cursor of a set.
+    ///
+    /// @param reclaimed Set of buckets.
+    /// @param cursor Oldest bucket of the set which may hold entries, only
+    /// set when the index is ready.
+    virtual IndexStatus getCursor(const bool reclaimed, int64_t& cursor) = 0;
+
+    /// @brief Marks the absent index as being rebuilt.
+    ///
+    /// @return true if the caller is to rebuild the index, false if
+    /// another server has claimed the rebuild in the meantime.
+    virtual bool claimIndexRebuild() = 0;
+
+    /// @brief Marks the index as absent again after a failed rebuild.
+    virtual void abortIndexRebuild() = 0;
+
+    /// @brief Marks the index as up to date.
+    ///
+    /// @param cursor Cursor of both sets.
+    virtual void setIndexReady(const int64_t cursor) = 0;
+
+    /// @brief Moves a cursor forward.
+    ///
+    /// Nothing is done when the cursor is no longer at @c from, i.e.
+    /// another server has moved it in the meantime.
+    ///
+    /// @param reclaimed Set of buckets.
+    /// @param from Expected bucket of the cursor.
+    /// @param to New bucket of the cursor.
+    virtual void moveCursor(const bool reclaimed, const int64_t from,
+                            const int64_t to) = 0;
+
+    /// @brief Reads the entries of a bucket with their leases.
+    ///
+    /// @param reclaimed Set of buckets.
+    /// @param bucket Bucket.
+    /// @param entries Entries to add the entries of the bucket to.
+    virtual void readBucket(const bool reclaimed, const int64_t bucket,
+                            std::vector<ExpirationBucketEntry>& entries) = 0;
+
+    /// @brief Deletes an entry.
+    ///
+    /// @param reclaimed Set of buckets.
+    /// @param bucket Bucket of the entry.
+    /// @param address Address of the entry.
+    virtual void deleteEntry(const bool reclaimed, const int64_t bucket,
+                             const asiolink::IOAddress& address) = 0;
+
+    /// @brief Adds an entry for every lease stored in a token range.
+    ///
+    /// Called concurrently for different ranges.
+    ///
+    /// @param range Token range.
+    /// @param now Time of the start of the rebuild.
+    virtual void indexTokenRange(const TokenRange& range, const int64_t now) = 0;
+};
+
+/// @brief Finds the expired leases in the expiration index.
+///
+/// The leases to reclaim are found by reading the buckets from the cursor
+/// to the current minute, instead of searching the lease table by state
+/// and expiration time. An entry is checked against the lease stored at
+/// its address: it is dropped when there is no lease, when the lease has
+/// moved to the other set or when it expires in a later bucket. A cursor
+/// moves past the buckets which have no entries left.
+///
+/// An entry is put in the bucket of the expiration time, or of the
+/// current time if the lease has already expired, so no entry is ever
+/// written behind a cursor. The cursors stay two buckets behind the
+/// current time to leave room for the clock differences between servers.
+///
+/// When the index is absent, the first server to notice claims the
+/// rebuild and indexes all leases by scanning the token ring.
+class LeaseExpirationBuckets {
+public:
+
+    /// @brief Width of a bucket in seconds.
+    static constexpr int64_t BUCKET_WIDTH = 60;
+
+    /// @brief Returns the bucket of a time.
+    ///
+    /// @param time Time in seconds since the epoch.
+    /// @return The bucket.
+    static int64_t getBucket(const int64_t time);
+
+    /// @brief Returns the bucket of a new entry.
+    ///
+    /// @param expire Expiration time of the lease.
+    /// @param now Current time.
+    /// @return The bucket of the expiration time or of the current time,
+    /// whichever comes last.
+    static int64_t getEntryBucket(const int64_t expire, const int64_t now);
+
+    /// @brief Checks if a stored lease needs a new entry.
+    ///
+    /// A lease already has a valid entry when it stays in the same set and
+    /// expires in the same bucket as before, still in the future. The
+    /// lease must hold the values stored before the change in its old_*
+    /// members.
+    ///
+    /// @param lease The lease after the change.
+    /// @param now Current time.
+    /// @return true if an entry must be written.
+    static bool needsEntry(const Lease& lease, const int64_t now);
+
+    /// @brief Constructor.
+    ///
+    /// @param source Database queries.
+    /// @param thread_count Number of threads scanning the ring during a
+    /// rebuild, the calling thread being one of them.
+    /// @param range_count Number of token ranges scanned during a rebuild.
+    LeaseExpirationBuckets(ExpirationBucketSource& source,
+                           const size_t thread_count, const size_t range_count);
+
+    /// @brief Gets the leases which expired before a time.
+    ///
+    /// The index is rebuilt when it is absent.
+    ///
+    /// @param reclaimed true to get reclaimed leases, false to get the
+    /// leases to reclaim.
+    /// @param limit Time before which the leases have expired.
+    /// @param now Current time.
+    /// @param max_leases Maximum number of leases to get, 0 for no limit.
+    /// @param leases Collection to add the leases to.
+    /// @return false if the index can't be used yet, in which case the
+    /// caller has to search the leases otherwise.
+    bool getExpiredLeases(const bool reclaimed, const int64_t limit,
+                          const int64_t now, const size_t max_leases,
+                          std::vector<LeasePtr>& leases);
+
+private:
+
+    /// @brief Indexes all leases.
+    ///
+    /// @param now Current time.
+    /// @return false if another server rebuilds the index.
+    bool rebuild(const int64_t now);
+
+    /// @brief Database queries.
+    ExpirationBucketSource& source_;
+
+    /// @brief Number of threads scanning the ring.
+    size_t thread_count_;
+
+    /// @brief Number of token ranges.
+    size_t range_count_;
+};
+
+}  // namespace dhcp
+}  // namespace isc
+
+#endif  // LEASE_EXPIRATION_BUCKETS_H
@@ -0,0 +1,1043 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef LEASE_FILE_COMPACTOR_H
+#define LEASE_FILE_COMPACTOR_H
+
+#include <dhcpsrv/dhcpsrv_log.h>
+#include <dhcpsrv/lease.h>
+#include <util/csv_file.h>
+#include <util/versioned_csv_file.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Splits a lease file row into values without copying them.
+///
+/// The values refer to the memory holding the row, so they are valid as
+/// long as the row is. Unlike @c util::CSVRow, no quoting is supported,
+/// which is consistent with the way lease files are written.
+///
+/// @param line Row without the trailing new line.
+/// @param [out] values Values of the row. The vector is cleared first.
+/// @param separator Separator of the values.
+inline void
+splitLeaseFileRow(const std::string_view& line,
+                  std::vector<std::string_view>& values,
+                  const char separator = ',') {
+    values.clear();
+    size_t start = 0;
+    for (;;) {
+        size_t end = line.find(separator, start);
+        if (end == std::string_view::npos) {
+            values.push_back(line.substr(start));
+            return;
+        }
+        values.push_back(line.substr(start, end - start));
+        start = end + 1;
+    }
+}
+
+/// @brief Describes how leases of the given type are keyed in the
+/// @c LeaseFileCompactor.
+///
+/// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+template<typename LeaseObjectType>
+struct LeaseFileKeyTraits;
+
+/// @brief Keys of the DHCPv4 leases are the addresses in host byte order.
+template<>
+struct LeaseFileKeyTraits<Lease4> {
+    /// @brief Type of the key.
+    typedef uint32_t Key;
+
+    /// @brief Converts the textual address to the key.
+    ///
+    /// @param text Address in textual form.
+    /// @param [out] key Resulting key.
+    /// @return true if the text holds an IPv4 address, false otherwise.
+    static bool fromText(const std::string_view& text, Key& key) {
+        char buf[INET_ADDRSTRLEN];
+        if (text.empty() || (text.size() >= sizeof(buf))) {
+            return (false);
+        }
+        text.copy(buf, text.size());
+        buf[text.size()] = '\0';
+        struct in_addr addr;
+        if (inet_pton(AF_INET, buf, &addr) != 1) {
+            return (false);
+        }
+        key = ntohl(addr.s_addr);
+        return (true);
+    }
+
+    /// @brief Hashes the key.
+    static uint64_t hash(const Key& key) {
+        // Multiplicative hashing spreads the consecutive addresses.
+        return (static_cast<uint64_t>(key) * 0x9e3779b97f4a7c15ULL);
+    }
+};
+
+/// @brief Keys of the DHCPv6 leases are the addresses in network byte
+/// order, so as they compare like @c asiolink::IOAddress.
+template<>
+struct LeaseFileKeyTraits<Lease6> {
+    /// @brief Type of the key.
+    typedef std::array<uint8_t, 16> Key;
+
+    /// @brief Converts the textual address to the key.
+    ///
+    /// @param text Address in textual form.
+    /// @param [out] key Resulting key.
+    /// @return true if the text holds an IPv6 address, false otherwise.
+    static bool fromText(const std::string_view& text, Key& key) {
+        char buf[INET6_ADDRSTRLEN];
+        if (text.empty() || (text.size() >= sizeof(buf))) {
+            return (false);
+        }
+        text.copy(buf, text.size());
+        buf[text.size()] = '\0';
+        return (inet_pton(AF_INET6, buf, key.data()) == 1);
+    }
+
+    /// @brief Hashes the key.
+    static uint64_t hash(const Key& key) {
+        uint64_t high;
+        uint64_t low;
+        memcpy(&high, key.data(), sizeof(high));
+        memcpy(&low, key.data() + sizeof(high), sizeof(low));
+        return ((high * 0x9e3779b97f4a7c15ULL) ^ (low * 0xc2b2ae3d27d4eb4fULL));
+    }
+};
+
+/// @brief Compact open addressing index of the last lease file row per
+/// lease address.
+///
+/// For every address, the index holds the location and the length of the
+/// row which was written last to the lease files and whether this row
+/// removes the lease. This takes a few tens of bytes per lease instead of
+/// a lease object held in the multi index container.
+///
+/// The index is not thread safe: the @c LeaseFileCompactor shards it and
+/// protects every shard with its own mutex.
+///
+/// @tparam Traits Key traits, see @c LeaseFileKeyTraits.
+template<typename Traits>
+class LeaseFileRowIndex {
+public:
+
+    /// @brief Type of the key.
+    typedef typename Traits::Key Key;
+
+    /// @brief Flag of the @c Entry::len_ set for the rows removing the
+    /// lease, i.e. the rows with a valid lifetime of 0.
+    static const uint32_t REMOVED = 0x80000000;
+
+    /// @brief Index entry.
+    struct Entry {
+        /// @brief Lease key.
+        Key key_;
+        /// @brief Location of the row: the index of the input file in the
+        /// 16 most significant bits and the offset within the file in the
+        /// remaining bits.
+        uint64_t loc_;
+        /// @brief Length of the row with the @c REMOVED flag. A value of 0
+        /// denotes an empty slot.
+        uint32_t len_;
+
+        /// @brief Returns the length of the row.
+        uint32_t getLength() const {
+            return (len_ & ~REMOVED);
+        }
+
+        /// @brief Checks if the row removes the lease.
+        bool isRemoved() const {
+            return ((len_ & REMOVED) != 0);
+        }
+    };
+
+    /// @brief Constructor.
+    LeaseFileRowIndex() : slots_(), size_(0) {
+    }
+
+    /// @brief Records a row, unless a row located further in the lease
+    /// files is already recorded for the same key.
+    ///
+    /// @param hash Hash of the entry key.
+    /// @param entry Entry describing the row.
+    void update(const uint64_t hash, const Entry& entry) {
+        // Keep the load factor below 0.75.
+        if ((size_ + 1) * 4 > slots_.size() * 3) {
+            grow();
+        }
+        Entry& slot = find(hash, entry.key_);
+        if (slot.len_ == 0) {
+            slot = entry;
+            ++size_;
+        } else if (slot.loc_ < entry.loc_) {
+            slot = entry;
+        }
+    }
+
+    /// @brief Returns the number of keys in the index.
+    size_t size() const {
+        return (size_);
+    }
+
+    /// @brief Moves the entries out of the index and sorts them by key.
+    ///
+    /// The index is empty and its memory is released after this call.
+    ///
+    /// @return Entries sorted by key.
+    std::vector<Entry> release() {
+        std::vector<Entry> entries;
+        entries.reserve(size_);
+        for (const Entry& slot : slots_) {
+            if (slot.len_ != 0) {
+                entries.push_back(slot);
+            }
+        }
+        std::vector<Entry>().swap(slots_);
+        size_ = 0;
+        std::sort(entries.begin(), entries.end(),
+                  [](const Entry& a, const Entry& b) {
+                      return (a.key_ < b.key_);
+                  });
+        return (entries);
+    }
+
+private:
+
+    /// @brief Finds the slot holding the key or the empty slot where the
+    /// key should be inserted.
+    ///
+    /// @param hash Hash of the key.
+    /// @param key Lease key.
+    /// @return Reference to the slot.
+    Entry& find(const uint64_t hash, const Key& key) {
+        const size_t mask = slots_.size() - 1;
+        for (size_t pos = hash & mask; ; pos = (pos + 1) & mask) {
+            Entry& slot = slots_[pos];
+            if ((slot.len_ == 0) || (slot.key_ == key)) {
+                return (slot);
+            }
+        }
+    }
+
+    /// @brief Doubles the number of slots.
+    void grow() {
+        std::vector<Entry> old;
+        old.swap(slots_);
+        slots_.resize(old.empty() ? 1024 : old.size() * 2, Entry());
+        for (const Entry& slot : old) {
+            if (slot.len_ != 0) {
+                find(Traits::hash(slot.key_), slot.key_) = slot;
+            }
+        }
+    }
+
+    /// @brief Slots, the number of slots is a power of two.
+    std::vector<Entry> slots_;
+
+    /// @brief Number of occupied slots.
+    size_t size_;
+};
+
+/// @brief Streaming, multi-threaded lease file cleanup.
+///
+/// This class produces the same output as loading the lease files with
+/// @c LeaseFileLoader::load into the lease storage and writing the storage
+/// with @c LeaseFileLoader::write, without holding all leases in memory.
+///
+/// The input files are processed in two passes:
+/// - The files are split in ranges which are read in large chunks by
+///   multiple threads. Every row is tokenized in place and only the lease
+///   address and the valid lifetime are converted. The location of the
+///   last row for every address is recorded in a sharded
+///   @c LeaseFileRowIndex.
+/// - The index entries are sorted by address and the rows they point to
+///   are parsed into leases by multiple threads, a window of rows at a
+///   time. The leases of every window are appended to the output file in
+///   address order, by the group commit writer of the file, while the
+///   next window is parsed.
+///
+/// If the last row for an address can't be parsed, the rows preceding it
+/// are searched for the last one which can be, like the lease file loader
+/// would do. Note that the rows superseded by further rows are only
+/// checked for the number of columns, the address and the valid lifetime,
+/// so they are not counted as errors if other columns are malformed.
+/// The lease sanity checks are not applied to the compacted leases.
+///
+/// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+/// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+template<typename LeaseObjectType, typename LeaseFileType>
+class LeaseFileCompactor : public boost::noncopyable {
+public:
+
+    /// @brief Key traits.
+    typedef LeaseFileKeyTraits<LeaseObjectType> Traits;
+
+    /// @brief Type of the key.
+    typedef typename Traits::Key Key;
+
+    /// @brief Type of the index.
+    typedef LeaseFileRowIndex<Traits> Index;
+
+    /// @brief Type of the index entry.
+    typedef typename Index::Entry Entry;
+
+    /// @brief Type of the pointer to the lease.
+    typedef std::shared_ptr<LeaseObjectType> LeasePtr;
+
+    /// @brief Type of the function called with every lease written.
+    typedef std::function<void(const LeaseObjectType&)> WriteCallback;
+
+    /// @brief Default size of the chunks read from the input files.
+    static const size_t DEFAULT_CHUNK_SIZE = 4 * 1024 * 1024;
+
+    /// @brief Default number of leases parsed and written at a time.
+    static const size_t DEFAULT_WINDOW_SIZE = 64 * 1024;
+
+    /// @brief Constructor.
+    ///
+    /// @param thread_count Number of threads, 0 selects the number of
+    /// hardware threads.
+    /// @param chunk_size Size of the chunks read from the input files.
+    /// @param window_size Number of leases parsed and written at a time.
+    LeaseFileCompactor(const size_t thread_count = 0,
+                       const size_t chunk_size = DEFAULT_CHUNK_SIZE,
+                       const size_t window_size = DEFAULT_WINDOW_SIZE)
+        : thread_count_(thread_count ? thread_count :
+                        std::max(1U, std::thread::hardware_concurrency())),
+          chunk_size_(chunk_size ? chunk_size : 1),
+          window_size_(window_size ? window_size : 1),
+          max_errors_(0), inputs_(), shards_(), parsers_(), aborted_(false),
+          reads_(0), read_errs_(0) {
+    }
+
+    /// @brief Destructor.
+    ~LeaseFileCompactor() {
+        closeInputs();
+    }
+
+    /// @brief Merges the lease files into the output file.
+    ///
+    /// @param inputs Names of the input files, in the order in which they
+    /// were written. The files which don't exist are skipped.
+    /// @param output Output lease file. The file doesn't need to be open
+    /// because the method re-opens it, and it is closed on return.
+    /// @param max_errors Maximum number of corrupted leases in an input
+    /// file, 0 disables the limit check.
+    /// @param callback Optional function called with every lease written,
+    /// in the order of writing. It is used to write the lease snapshot.
+    ///
+    /// @throw isc::util::CSVFileError when the maximum number of errors
+    /// has been exceeded or when reading the input files fails.
+    void compact(const std::vector<std::string>& inputs,
+                 LeaseFileType& output, const uint32_t max_errors = 0,
+                 const WriteCallback& callback = WriteCallback()) {
+        max_errors_ = max_errors;
+        aborted_ = false;
+        reads_ = 0;
+        read_errs_ = 0;
+        try {
+            openInputs(inputs);
+            scan();
+            write(output, callback);
+        } catch (...) {
+            closeInputs();
+            throw;
+        }
+        closeInputs();
+    }
+
+    /// @brief Returns the number of threads.
+    size_t getThreadCount() const {
+        return (thread_count_);
+    }
+
+    /// @brief Returns the number of rows read by the last @c compact.
+    uint64_t getReads() const {
+        return (reads_);
+    }
+
+    /// @brief Returns the number of leases read by the last @c compact.
+    uint64_t getReadLeases() const {
+        return (reads_ - read_errs_);
+    }
+
+    /// @brief Returns the number of corrupted rows found by the last
+    /// @c compact.
+    uint64_t getReadErrs() const {
+        return (read_errs_);
+    }
+
+private:
+
+    /// @brief Number of bits of the hash selecting the index shard.
+    static const size_t SHARD_BITS = 6;
+
+    /// @brief Number of index shards.
+    static const size_t SHARD_COUNT = 1 << SHARD_BITS;
+
+    /// @brief Number of entries buffered per shard before taking the
+    /// shard mutex.
+    static const size_t SHARD_BATCH = 256;
+
+    /// @brief Number of bits of the entry location holding the offset.
+    static const size_t OFFSET_BITS = 48;
+
+    /// @brief Minimum size of the file range scanned by a thread.
+    static const uint64_t MIN_RANGE_SIZE = 1024 * 1024;
+
+    /// @brief Input file.
+    struct Input {
+        /// @brief File name.
+        std::string filename_;
+        /// @brief File descriptor.
+        int fd_;
+        /// @brief Offset of the first row following the header.
+        uint64_t data_start_;
+        /// @brief File size.
+        uint64_t size_;
+        /// @brief Minimum number of columns of a valid row.
+        size_t min_cols_;
+        /// @brief Maximum number of columns of a valid row.
+        size_t max_cols_;
+        /// @brief Index of the address column.
+        size_t address_col_;
+        /// @brief Index of the valid lifetime column.
+        size_t valid_col_;
+        /// @brief Number of corrupted rows found in the file.
+        std::atomic<uint32_t> errors_;
+    };
+
+    /// @brief Index shard.
+    struct Shard {
+        /// @brief Mutex protecting the index.
+        std::mutex mutex_;
+        /// @brief Index of the entries with the keys hashed to this shard.
+        Index index_;
+    };
+
+    /// @brief Opens the input files and parses their headers.
+    ///
+    /// @param inputs Names of the input files.
+    void openInputs(const std::vector<std::string>& inputs) {
+        closeInputs();
+        for (const std::string& filename : inputs) {
+            LeaseFileType lease_file(filename);
+            if (!lease_file.exists()) {
+                continue;
+            }
+            if (inputs_.size() >= (1U << (64 - OFFSET_BITS))) {
+                isc_throw(util::CSVFileError, "too many lease files");
+            }
+
+            LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LEASE_FILE_LOAD)
+                .arg(filename);
+
+            // Let the lease file parse and validate the header.
+            lease_file.open();
+            lease_file.close();
+
+            std::unique_ptr<Input> input(new Input());
+            input->filename_ = filename;
+            input->address_col_ = lease_file.getColumnIndex("address");
+            input->valid_col_ = lease_file.getColumnIndex("valid_lifetime");
+            // Mirror the row validation of the VersionedCSVFile::adjustRow.
+            switch (lease_file.getInputSchemaState()) {
+            case util::VersionedCSVFile::CURRENT:
+                input->min_cols_ = lease_file.getColumnCount();
+                input->max_cols_ = lease_file.getColumnCount();
+                break;
+            case util::VersionedCSVFile::NEEDS_UPGRADE:
+                input->min_cols_ = lease_file.getValidColumnCount();
+                input->max_cols_ = lease_file.getColumnCount();
+                break;
+            default:
+                input->min_cols_ = 0;
+                input->max_cols_ = std::numeric_limits<size_t>::max();
+            }
+            input->min_cols_ = std::max(input->min_cols_,
+                                        std::max(input->address_col_,
+                                                 input->valid_col_) + 1);
+            input->errors_ = 0;
+
+            input->fd_ = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+            if (input->fd_ < 0) {
+                isc_throw(util::CSVFileError, "unable to open '" << filename
+                          << "': " << strerror(errno));
+            }
+            // Push it now, so as it is closed if anything fails.
+            inputs_.push_back(std::move(input));
+            Input& in = *inputs_.back();
+
+            struct stat st;
+            if (fstat(in.fd_, &st) != 0) {
+                isc_throw(util::CSVFileError, "unable to stat '" << filename
+                          << "': " << strerror(errno));
+            }
+            in.size_ = static_cast<uint64_t>(st.st_size);
+            if (in.size_ >= (1ULL << OFFSET_BITS)) {
+                isc_throw(util::CSVFileError, "lease file '" << filename
+                          << "' is too large");
+            }
+            in.data_start_ = in.size_;
+            scanRange(in, 0, 1, [&in](const std::string_view& header,
+                                      const uint64_t) {
+                in.data_start_ = std::min(in.size_, header.size() + 1);
+            });
+
+            if (lease_file.needsConversion()) {
+                LOG_WARN(dhcpsrv_logger,
+                         (lease_file.getInputSchemaState()
+                          == util::VersionedCSVFile::NEEDS_UPGRADE
+                          ?  DHCPSRV_MEMFILE_NEEDS_UPGRADING
+                          : DHCPSRV_MEMFILE_NEEDS_DOWNGRADING))
+                    .arg(filename)
+                    .arg(lease_file.getSchemaVersion());
+            }
+        }
+    }
+
+    /// @brief Closes the input files and releases the index.
+    void closeInputs() {
+        for (auto& input : inputs_) {
+            if (input->fd_ >= 0) {
+                ::close(input->fd_);
+            }
+        }
+        inputs_.clear();
+        parsers_.clear();
+        for (Shard& shard : shards_) {
+            shard.index_.release();
+        }
+    }
+
+    /// @brief First pass: records the last row for every lease address.
+    void scan() {
+        struct Range {
+            size_t input_;
+            uint64_t begin_;
+            uint64_t end_;
+        };
+
+        // Split the files in ranges, a few per thread so as the threads
+        // are kept busy until the end.
+        std::vector<Range> ranges;
+        for (size_t i = 0; i < inputs_.size(); ++i) {
+            const Input& in = *inputs_[i];
+            const uint64_t data = in.size_ - in.data_start_;
+            if (data == 0) {
+                continue;
+            }
+            uint64_t count = std::min(static_cast<uint64_t>(thread_count_ * 4),
+                                      data / MIN_RANGE_SIZE);
+            count = std::max(count, static_cast<uint64_t>(1));
+            for (uint64_t r = 0; r < count; ++r) {
+                ranges.push_back({ i, in.data_start_ + data * r / count,
+                                   in.data_start_ + data * (r + 1) / count });
+            }
+        }
+
+        runParallel(ranges.size(), [this, &ranges](const size_t task) {
+            const Range& range = ranges[task];
+            Input& in = *inputs_[range.input_];
+            const uint64_t file = static_cast<uint64_t>(range.input_) << OFFSET_BITS;
+
+            std::vector<std::string_view> values;
+            std::array<std::vector<std::pair<uint64_t, Entry> >, SHARD_COUNT> pending;
+            uint64_t reads = 0;
+
+            scanRange(in, range.begin_, range.end_,
+                      [&](const std::string_view& line, const uint64_t offset) {
+                ++reads;
+                Entry entry;
+                uint32_t valid = 0;
+                std::string error = checkRow(in, line, values, entry.key_, valid);
+                if (!error.empty()) {
+                    countError(in, offset, error);
+                    return;
+                }
+                entry.loc_ = file | offset;
+                entry.len_ = static_cast<uint32_t>(line.size()) |
+                    (valid == 0 ? Index::REMOVED : 0);
+
+                const uint64_t hash = Traits::hash(entry.key_);
+                const size_t shard = hash >> (64 - SHARD_BITS);
+                pending[shard].push_back(std::make_pair(hash, entry));
+                if (pending[shard].size() >= SHARD_BATCH) {
+                    flushShard(shard, pending[shard]);
+                }
+            });
+
+            for (size_t shard = 0; shard < SHARD_COUNT; ++shard) {
+                flushShard(shard, pending[shard]);
+            }
+            reads_ += reads;
+        });
+    }
+
+    /// @brief Second pass: parses the last rows in address order and
+    /// writes the leases.
+    ///
+    /// @param output Output lease file.
+    /// @param callback Function called with every lease written, may be
+    /// empty.
+    void write(LeaseFileType& output, const WriteCallback& callback) {
+        // Sort the shards in parallel.
+        std::vector<std::vector<Entry> > sorted(SHARD_COUNT);
+        runParallel(SHARD_COUNT, [this, &sorted](const size_t shard) {
+            sorted[shard] = shards_[shard].index_.release();
+        });
+
+        // Every thread parses rows with its own lease file objects.
+        parsers_.clear();
+        parsers_.resize(thread_count_);
+        for (auto& parsers : parsers_) {
+            for (const auto& input : inputs_) {
+                parsers.emplace_back(new LeaseFileType(input->filename_));
+                parsers.back()->open();
+            }
+        }
+
+        // Merge the sorted shards: the heap holds the position of the
+        // first unmerged entry of every non-empty shard.
+        typedef std::pair<size_t, size_t> Position;
+        auto greater = [&sorted](const Position& a, const Position& b) {
+            return (sorted[b.first][b.second].key_ <
+                    sorted[a.first][a.second].key_);
+        };
+        std::priority_queue<Position, std::vector<Position>,
+                            decltype(greater)> heap(greater);
+        for (size_t shard = 0; shard < SHARD_COUNT; ++shard) {
+            if (!sorted[shard].empty()) {
+                heap.push(Position(shard, 0));
+            }
+        }
+
+        const bool group_commit = output.getGroupCommit();
+        try {
+            // Reopen the file, as we don't know whether the file is open
+            // and we also don't know its current state. The rows are
+            // written by the group commit writer while the next window
+            // is parsed.
+            output.close();
+            output.setGroupCommit(true);
+            output.open();
+
+            std::vector<Entry> window;
+            window.reserve(window_size_);
+            std::vector<LeasePtr> leases(window_size_);
+            while (!heap.empty()) {
+                window.clear();
+                while (!heap.empty() && (window.size() < window_size_)) {
+                    Position pos = heap.top();
+                    heap.pop();
+                    window.push_back(sorted[pos.first][pos.second]);
+                    if (++pos.second < sorted[pos.first].size()) {
+                        heap.push(pos);
+                    } else {
+                        std::vector<Entry>().swap(sorted[pos.first]);
+                    }
+                }
+
+                const size_t count = window.size();
+                runParallel(thread_count_, [this, &window, &leases, count]
+                            (const size_t slot) {
+                    const size_t begin = count * slot / thread_count_;
+                    const size_t end = count * (slot + 1) / thread_count_;
+                    std::string line;
+                    for (size_t i = begin; i < end; ++i) {
+                        leases[i] = parseEntry(slot, window[i], line);
+                    }
+                });
+
+                resolveFailed(window, leases);
+
+                for (size_t i = 0; i < count; ++i) {
+                    if (leases[i] && (leases[i]->valid_lft_ > 0)) {
+                        output.append(*leases[i]);
+                        if (callback) {
+                            callback(*leases[i]);
+                        }
+                    }
+                    leases[i].reset();
+                }
+            }
+
+            // Report write errors, which are not reported by close.
+            util::CSVFile::waitForAppends();
+            output.close();
+            output.setGroupCommit(group_commit);
+
+        } catch (...) {
+            output.close();
+            output.setGroupCommit(group_commit);
+            throw;
+        }
+    }
+
+    /// @brief Parses the row pointed to by the index entry.
+    ///
+    /// @param slot Index of the thread slot.
+    /// @param entry Index entry.
+    /// @param line Buffer for the row.
+    /// @return Pointer to the lease or null pointer if the row is
+    /// corrupted.
+    LeasePtr parseEntry(const size_t slot, const Entry& entry,
+                        std::string& line) {
+        const size_t file = entry.loc_ >> OFFSET_BITS;
+        const uint64_t offset = entry.loc_ & ((1ULL << OFFSET_BITS) - 1);
+        Input& in = *inputs_[file];
+
+        line.resize(entry.getLength());
+        if (readAt(in, offset, &line[0], line.size()) != line.size()) {
+            isc_throw(util::CSVFileError, "lease file '" << in.filename_
+                      << "' was truncated while being processed");
+        }
+        LeasePtr lease;
+        LeaseFileType& parser = *parsers_[slot][file];
+        if (!parser.parse(line, lease)) {
+            countError(in, offset, parser.getReadMsg());
+        }
+        return (lease);
+    }
+
+    /// @brief Replaces the leases which failed to parse with the leases
+    /// from the last preceding rows which parse.
+    ///
+    /// The input files are scanned once for all failed leases of the
+    /// window, which is expensive but only happens for corrupted files.
+    ///
+    /// @param window Index entries.
+    /// @param [in,out] leases Leases parsed from the entries.
+    void resolveFailed(const std::vector<Entry>& window,
+                       std::vector<LeasePtr>& leases) {
+        // Map the keys of the failed leases to the location of the failed
+        // row and to the position in the window.
+        std::map<Key, std::pair<uint64_t, size_t> > failed;
+        for (size_t i = 0; i < window.size(); ++i) {
+            if (!leases[i]) {
+                failed[window[i].key_] = std::make_pair(window[i].loc_, i);
+            }
+        }
+        if (failed.empty()) {
+            return;
+        }
+
+        std::vector<std::string_view> values;
+        std::string copy;
+        for (size_t file = 0; file < inputs_.size(); ++file) {
+            const Input& in = *inputs_[file];
+            LeaseFileType& parser = *parsers_[0][file];
+            scanRange(in, in.data_start_, in.size_,
+                      [&](const std::string_view& line, const uint64_t offset) {
+                Key key;
+                uint32_t valid;
+                if (!checkRow(in, line, values, key, valid).empty()) {
+                    return;
+                }
+                auto it = failed.find(key);
+                const uint64_t loc =
+                    (static_cast<uint64_t>(file) << OFFSET_BITS) | offset;
+                if ((it == failed.end()) || (loc >= it->second.first)) {
+                    return;
+                }
+                LeasePtr lease;
+                copy.assign(line.data(), line.size());
+                if (parser.parse(copy, lease)) {
+                    // The rows are scanned in order, so this replaces
+                    // the leases from the rows found before.
+                    leases[it->second.second] = lease;
+                }
+            });
+        }
+    }
+
+    /// @brief Checks the row and extracts its key and valid lifetime.
+    ///
+    /// @param in Input file holding the row.
+    /// @param line Row.
+    /// @param values Buffer for the row values.
+    /// @param [out] key Lease key.
+    /// @param [out] valid Valid lifetime.
+    /// @return Empty string if the row is valid, error message otherwise.
+    static std::string checkRow(const Input& in, const std::string_view& line,
+                                std::vector<std::string_view>& values,
+                                Key& key, uint32_t& valid) {
+        splitLeaseFileRow(line, values);
+        if ((values.size() < in.min_cols_) || (values.size() > in.max_cols_)) {
+            std::ostringstream s;
+            s << "Invalid number of columns: " << values.size()
+              << " in row: '" << line << "', file: '" << in.filename_ << "'";
+            return (s.str());
+        }
+        if (line.size() >= Index::REMOVED) {
+            return ("row is too long");
+        }
+        if (!Traits::fromText(values[in.address_col_], key)) {
+            return ("invalid address '" + std::string(values[in.address_col_]) + "'");
+        }
+        const std::string_view& text = values[in.valid_col_];
+        auto result = std::from_chars(text.data(), text.data() + text.size(),
+                                      valid);
+        if ((result.ec != std::errc()) ||
+            (result.ptr != text.data() + text.size())) {
+            return ("invalid valid lifetime '" + std::string(text) + "'");
+        }
+        return ("");
+    }
+
+    /// @brief Counts and logs a corrupted row.
+    ///
+    /// @param in Input file holding the row.
+    /// @param offset Offset of the row.
+    /// @param error Error message.
+    /// @throw isc::util::CSVFileError when the maximum number of errors
+    /// has been exceeded.
+    void countError(Input& in, const uint64_t offset,
+                    const std::string& error) {
+        LOG_ERROR(dhcpsrv_logger, DHCPSRV_MEMFILE_LEASE_COMPACT_ROW_ERROR)
+            .arg(offset)
+            .arg(in.filename_)
+            .arg(error);
+        ++read_errs_;
+        if (max_errors_ && (++in.errors_ > max_errors_)) {
+            isc_throw(util::CSVFileError, "exceeded maximum number of"
+                      " failures " << max_errors_ << " to read a lease"
+                      " from the lease file " << in.filename_);
+        }
+    }
+
+    /// @brief Merges the pending entries into the shard.
+    ///
+    /// @param shard Index of the shard.
+    /// @param [in,out] pending Pending entries with their hashes, cleared
+    /// on return.
+    void flushShard(const size_t shard,
+                    std::vector<std::pair<uint64_t, Entry> >& pending) {
+        if (pending.empty()) {
+            return;
+        }
+        std::lock_guard<std::mutex> lk(shards_[shard].mutex_);
+        for (const auto& p : pending) {
+            shards_[shard].index_.update(p.first, p.second);
+        }
+        pending.clear();
+    }
+
+    /// @brief Calls the callback for every row starting in the range of
+    /// the input file.
+    ///
+    /// The row which starts before the range and ends within it belongs to
+    /// the previous range, so the ranges can be scanned independently.
+    ///
+    /// @param in Input file.
+    /// @param begin Offset of the beginning of the range.
+    /// @param end Offset of the end of the range.
+    /// @param callback Function called with the row, without the trailing
+    /// new line, and with its offset. The row is valid during the call.
+    template<typename Callback>
+    void scanRange(const Input& in, const uint64_t begin, const uint64_t end,
+                   Callback callback) const {
+        std::vector<char> buf(chunk_size_);
+        uint64_t pos = begin;
+
+        // Skip the row started in the previous range, unless the
+        // range begins exactly at the start of a row.
+        if (pos > in.data_start_) {
+            --pos;
+            for (;;) {
+                const size_t n = readAt(in, pos, buf.data(), buf.size());
+                const void* nl = memchr(buf.data(), '\n', n);
+                if (nl) {
+                    pos += static_cast<const char*>(nl) - buf.data() + 1;
+                    break;
+                }
+                pos += n;
+                if (n < buf.size()) {
+                    break;
+                }
+            }
+        }
+
+        while ((pos < end) && (pos < in.size_) && !aborted_) {
+            const size_t n = readAt(in, pos, buf.data(), buf.size());
+            const bool last = (pos + n >= in.size_);
+            size_t consumed = 0;
+            while ((consumed < n) && (pos + consumed < end)) {
+                const char* start = buf.data() + consumed;
+                const char* nl = static_cast<const char*>(memchr(start, '\n', n - consumed));
+                size_t len;
+                if (nl) {
+                    len = nl - start;
+                } else if (last) {
+                    // The last row is not terminated.
+                    len = n - consumed;
+                } else {
+                    break;
+                }
+                callback(std::string_view(start, len), pos + consumed);
+                consumed += len + (nl ? 1 : 0);
+            }
+            if (consumed == 0) {
+                if (n == 0) {
+                    break;
+                }
+                // The row doesn't fit in the buffer.
+                buf.resize(buf.size() * 2);
+                continue;
+            }
+            pos += consumed;
+        }
+    }
+
+    /// @brief Reads from the input file at the given offset.
+    ///
+    /// @param in Input file.
+    /// @param offset Offset in the file.
+    /// @param buf Buffer.
+    /// @param len Number of bytes to read.
+    /// @return Number of bytes read, less than requested only at the end
+    /// of the file.
+    /// @throw isc::util::CSVFileError on read error.
+    static size_t readAt(const Input& in, const uint64_t offset, char* buf,
+                         const size_t len) {
+        size_t done = 0;
+        while (done < len) {
+            ssize_t n = ::pread(in.fd_, buf + done, len - done,
+                                static_cast<off_t>(offset + done));
+            if (n < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                isc_throw(util::CSVFileError, "failed to read '"
+                          << in.filename_ << "': " << strerror(errno));
+            }
+            if (n == 0) {
+                break;
+            }
+            done += static_cast<size_t>(n);
+        }
+        return (done);
+    }
+
+    /// @brief Runs tasks in parallel.
+    ///
+    /// The tasks are distributed over up to @c thread_count_ threads, the
+    /// calling thread being one of them. The first exception thrown by a
+    /// task stops the remaining tasks and is rethrown.
+    ///
+    /// @param count Number of tasks.
+    /// @param task Function called with the index of every task.
+    void runParallel(const size_t count,
+                     const std::function<void(size_t)>& task) {
+        std::atomic<size_t> next(0);
+        std::mutex error_mutex;
+        std::exception_ptr error;
+        auto worker = [&]() {
+            for (size_t i = next++; (i < count) && !aborted_; i = next++) {
+                try {
+                    task(i);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lk(error_mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                    aborted_ = true;
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (size_t i = 1; i < std::min(thread_count_, count); ++i) {
+            threads.push_back(std::thread(worker));
+        }
+        worker();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    /// @brief Number of threads.
+    size_t thread_count_;
+
+    /// @brief Size of the chunks read from the input files.
+    size_t chunk_size_;
+
+    /// @brief Number of leases parsed and written at a time.
+    size_t window_size_;
+
+    /// @brief Maximum number of corrupted rows per input file.
+    uint32_t max_errors_;
+
+    /// @brief Input files.
+    std::vector<std::unique_ptr<Input> > inputs_;
+
+    /// @brief Index shards.
+    std::array<Shard, SHARD_COUNT> shards_;
+
+    /// @brief Lease file objects parsing the rows, per thread and input
+    /// file.
+    std::vector<std::vector<std::unique_ptr<LeaseFileType> > > parsers_;
+
+    /// @brief Flag set when a task failed.
+    std::atomic<bool> aborted_;
+
+    /// @brief Number of rows read.
+    std::atomic<uint64_t> reads_;
+
+    /// @brief Number of corrupted rows.
+    std::atomic<uint64_t> read_errs_;
+};
+
+} // namespace isc::dhcp
+} // namespace isc
+
+#endif // LEASE_FILE_COMPACTOR_H
@@ -8,6 +8,7 @@
 #define LEASE_FILE_LOADER_H
 
 #include <dhcpsrv/dhcpsrv_log.h>
+#include <dhcpsrv/lease_snapshot.h>
 #include <dhcpsrv/memfile_lease_storage.h>
 #include <util/versioned_csv_file.h>
 #include <dhcpsrv/sanity_checker.h>
@@ -185,6 +186,90 @@ public:
         }
     }
 
+    /// @brief Load leases from the lease snapshot into the specified storage.
+    ///
+    /// This method is used in place of @c load for the lease file the
+    /// snapshot has been created from. The leases are created directly
+    /// from the binary records without parsing the CSV rows. Since the
+    /// records are sorted by address, the leases are inserted at the end
+    /// of the address index.
+    ///
+    /// @param snapshot A reference to the open snapshot.
+    /// @param storage A reference to the container to which leases
+    /// should be inserted.
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    ///
+    /// @throw LeaseSnapshotError if a lease can't be read from the snapshot.
+    /// The storage may hold part of the leases in this case.
+    template<typename LeaseObjectType, typename StorageType>
+    static void loadSnapshot(const LeaseSnapshotFile& snapshot,
+                             StorageType& storage) {
+
+        LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LEASE_SNAPSHOT_LOAD)
+            .arg(snapshot.getFilename());
+
+        // Create lease sanity checker if checking is enabled.
+        std::unique_ptr<SanityChecker> lease_checker;
+        if (SanityChecker::leaseCheckingEnabled(false)) {
+            lease_checker.reset(new SanityChecker());
+        }
+
+        std::shared_ptr<LeaseObjectType> lease;
+        const uint64_t count = snapshot.getRecordCount();
+        for (uint64_t i = 0; i < count; ++i) {
+            snapshot.getLease(i, lease);
+
+            if (lease_checker)  {
+                lease_checker->checkLease(lease, false);
+                if (!lease) {
+                    continue;
+                }
+            }
+
+            // Entries with a valid lifetime of 0 are never written to
+            // the snapshot but handle them as the load does.
+            if (lease->valid_lft_ == 0) {
+                storage.erase(lease->addr_);
+                continue;
+            }
+
+            auto result = storage.insert(storage.end(), lease);
+            if (*result != lease) {
+                // Use replace to re-index leases on update.
+                storage.replace(result, lease);
+            }
+        }
+    }
+
+    /// @brief Write leases from the storage into a lease snapshot.
+    ///
+    /// The snapshot is committed against the lease file which has been
+    /// written from the same storage, so the lease file must be closed
+    /// and must not be modified afterwards.
+    ///
+    /// @param snapshot A reference to the snapshot writer. The writer
+    /// doesn't need to be open because the method opens it.
+    /// @param storage A reference to the container from which leases
+    /// should be written.
+    /// @param source Name of the lease file holding the same leases.
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    ///
+    /// @throw LeaseSnapshotError if the snapshot can't be written.
+    template<typename LeaseObjectType, typename StorageType>
+    static void writeSnapshot(LeaseSnapshotWriter& snapshot,
+                              const StorageType& storage,
+                              const std::string& source) {
+        snapshot.open();
+        for (typename StorageType::const_iterator lease = storage.begin();
+             lease != storage.end();
+             ++lease) {
+            snapshot.append(**lease);
+        }
+        snapshot.commit(source);
+    }
+
     /// @brief Write leases from the storage into a lease file
     ///
     /// This method iterates over the @c Lease4 or @c Lease6 object in the
@@ -44,6 +44,28 @@ LeasePageSize::LeasePageSize(const size_t page_size)
     }
 }
 
+size_t
+LeaseMgr::addLeases(const Lease4Collection& leases) {
+    size_t added = 0;
+    for (auto const& lease : leases) {
+        if (addLease(lease)) {
+            ++added;
+        }
+    }
+    return (added);
+}
+
+size_t
+LeaseMgr::addLeases(const Lease6Collection& leases) {
+    size_t added = 0;
+    for (auto const& lease : leases) {
+        if (addLease(lease)) {
+            ++added;
+        }
+    }
+    return (added);
+}
+
 Lease6Ptr
 LeaseMgr::getLease6(Lease::Type type, const DUID& duid,
                     uint32_t iaid, SubnetID subnet_id) const {
@@ -156,6 +178,71 @@ LeaseMgr::recountLeaseStats4() {
     }
 }
 
+void
+LeaseMgr::recountLeaseStats4(const SubnetID& subnet_id) {
+    using namespace stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+
+    LeaseStatsQueryPtr query = startSubnetLeaseStatsQuery4(subnet_id);
+    if (!query) {
+        /// NULL means not backend does not support recounting.
+        return;
+    }
+
+    // The declined leases of the subnet are counted again, so they are
+    // removed from the global value first.
+    const std::string& declined_name =
+        StatsMgr::generateName("subnet", subnet_id, "declined-addresses");
+    ObservationPtr declined = stats_mgr.getObservation(declined_name);
+    if (declined && stats_mgr.getObservation("declined-addresses")) {
+        stats_mgr.addValue("declined-addresses", -declined->getInteger().first);
+    }
+
+    int64_t zero = 0;
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "assigned-addresses"),
+                       zero);
+    stats_mgr.setValue(declined_name, zero);
+
+    if (!stats_mgr.getObservation(
+            StatsMgr::generateName("subnet", subnet_id,
+                                   "reclaimed-declined-addresses"))) {
+        stats_mgr.setValue(
+            StatsMgr::generateName("subnet", subnet_id,
+                                   "reclaimed-declined-addresses"),
+            zero);
+    }
+
+    if (!stats_mgr.getObservation(
+            StatsMgr::generateName("subnet", subnet_id,
+                                   "reclaimed-leases"))) {
+        stats_mgr.setValue(
+            StatsMgr::generateName("subnet", subnet_id,
+                                   "reclaimed-leases"),
+            zero);
+    }
+
+    LeaseStatsRow row;
+    while (query->getNextRow(row)) {
+        if (row.lease_state_ == Lease::STATE_DEFAULT) {
+            stats_mgr.addValue(StatsMgr::generateName("subnet", row.subnet_id_,
+                                                      "assigned-addresses"),
+                               row.state_count_);
+        } else if (row.lease_state_ == Lease::STATE_DECLINED) {
+            stats_mgr.setValue(StatsMgr::generateName("subnet", row.subnet_id_,
+                                                      "declined-addresses"),
+                               row.state_count_);
+            stats_mgr.addValue("declined-addresses", row.state_count_);
+
+            // Declined leases also count as assigned.
+            stats_mgr.addValue(StatsMgr::generateName("subnet", row.subnet_id_,
+                                                      "assigned-addresses"),
+                               row.state_count_);
+        }
+    }
+}
+
 LeaseStatsQuery::LeaseStatsQuery()
     : first_subnet_id_(0), last_subnet_id_(0), select_mode_(ALL_SUBNETS) {
 }
@@ -332,6 +419,94 @@ LeaseMgr::recountLeaseStats6() {
     }
 }
 
+void
+LeaseMgr::recountLeaseStats6(const SubnetID& subnet_id) {
+    using namespace stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+
+    LeaseStatsQueryPtr query = startSubnetLeaseStatsQuery6(subnet_id);
+    if (!query) {
+        /// NULL means not backend does not support recounting.
+        return;
+    }
+
+    // The declined leases of the subnet are counted again, so they are
+    // removed from the global value first.
+    const std::string& declined_name =
+        StatsMgr::generateName("subnet", subnet_id, "declined-addresses");
+    ObservationPtr declined = stats_mgr.getObservation(declined_name);
+    if (declined && stats_mgr.getObservation("declined-addresses")) {
+        stats_mgr.addValue("declined-addresses", -declined->getInteger().first);
+    }
+
+    int64_t zero = 0;
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "assigned-nas"),
+                       zero);
+    stats_mgr.setValue(declined_name, zero);
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "assigned-pds"),
+                       zero);
+
+    if (!stats_mgr.getObservation(
+            StatsMgr::generateName("subnet", subnet_id,
+                                   "reclaimed-declined-addresses"))) {
+        stats_mgr.setValue(
+            StatsMgr::generateName("subnet", subnet_id,
+                                   "reclaimed-declined-addresses"),
+            zero);
+    }
+
+    if (!stats_mgr.getObservation(
+            StatsMgr::generateName("subnet", subnet_id,
+                                   "reclaimed-leases"))) {
+        stats_mgr.setValue(
+            StatsMgr::generateName("subnet", subnet_id,
+                                   "reclaimed-leases"),
+            zero);
+    }
+
+    LeaseStatsRow row;
+    while (query->getNextRow(row)) {
+        switch(row.lease_type_) {
+            case Lease::TYPE_NA:
+                if (row.lease_state_ == Lease::STATE_DEFAULT) {
+                    stats_mgr.addValue(StatsMgr::
+                                       generateName("subnet", row.subnet_id_,
+                                                    "assigned-nas"),
+                                       row.state_count_);
+                } else if (row.lease_state_ == Lease::STATE_DECLINED) {
+                    stats_mgr.setValue(StatsMgr::
+                                       generateName("subnet", row.subnet_id_,
+                                                    "declined-addresses"),
+                                       row.state_count_);
+                    stats_mgr.addValue("declined-addresses", row.state_count_);
+
+                    // Declined leases also count as assigned.
+                    stats_mgr.addValue(StatsMgr::
+                                       generateName("subnet", row.subnet_id_,
+                                                    "assigned-nas"),
+                                       row.state_count_);
+                }
+                break;
+
+            case Lease::TYPE_PD:
+                if (row.lease_state_ == Lease::STATE_DEFAULT) {
+                    stats_mgr.setValue(StatsMgr::
+                                       generateName("subnet", row.subnet_id_,
+                                                    "assigned-pds"),
+                                       row.state_count_);
+                }
+                break;
+
+            default:
+                // We dont' support TYPE_TAs yet
+                break;
+        }
+    }
+}
+
 LeaseStatsQueryPtr
 LeaseMgr::startLeaseStatsQuery6() {
     return(LeaseStatsQueryPtr());
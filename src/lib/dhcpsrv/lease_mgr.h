@@ -259,6 +259,30 @@ public:
     ///         with the same address was already there or failed sanity checks)
     virtual bool addLease(const Lease6Ptr& lease) = 0;
 
+    /// @brief Adds a collection of IPv4 leases.
+    ///
+    /// Backends which can insert many rows at once override this method
+    /// to reduce the number of round trips to the database. The default
+    /// implementation adds the leases one by one. Leases which already
+    /// exist in the database are skipped.
+    ///
+    /// @param leases leases to be added
+    ///
+    /// @return number of added leases
+    virtual size_t addLeases(const Lease4Collection& leases);
+
+    /// @brief Adds a collection of IPv6 leases.
+    ///
+    /// Backends which can insert many rows at once override this method
+    /// to reduce the number of round trips to the database. The default
+    /// implementation adds the leases one by one. Leases which already
+    /// exist in the database are skipped.
+    ///
+    /// @param leases leases to be added
+    ///
+    /// @return number of added leases
+    virtual size_t addLeases(const Lease6Collection& leases);
+
     /// @brief Returns an IPv4 lease for specified IPv4 address
     ///
     /// This method return a lease that is associated with a given address.
@@ -599,6 +623,17 @@ public:
     /// adding to the appropriate global statistic.
     void recountLeaseStats4();
 
+    /// @brief Recalculates the stats for IPv4 leases of a single subnet
+    ///
+    /// This method recalculates the per-subnet assigned-addresses and
+    /// declined-addresses statistics of the given subnet and adjusts the
+    /// global declined-addresses statistic accordingly. It is used when
+    /// a subnet is added to the configuration without recounting the
+    /// leases of all the other subnets.
+    ///
+    /// @param subnet_id id of the subnet for which stats are recalculated
+    void recountLeaseStats4(const SubnetID& subnet_id);
+
     /// @brief Creates and runs the IPv4 lease stats query for all subnets
     ///
     /// LeaseMgr derivations implement this method such that it creates and
@@ -656,6 +691,17 @@ public:
     /// per subnet and adding to the appropriate global statistic.
     void recountLeaseStats6();
 
+    /// @brief Recalculates the stats for IPv6 leases of a single subnet
+    ///
+    /// This method recalculates the per-subnet assigned-nas,
+    /// declined-addresses and assigned-pds statistics of the given subnet
+    /// and adjusts the global declined-addresses statistic accordingly.
+    /// It is used when a subnet is added to the configuration without
+    /// recounting the leases of all the other subnets.
+    ///
+    /// @param subnet_id id of the subnet for which stats are recalculated
+    void recountLeaseStats6(const SubnetID& subnet_id);
+
     /// @brief Creates and runs the IPv6 lease stats query for all subnets
     ///
     /// LeaseMgr derivations implement this method such that it creates and
@@ -0,0 +1,526 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <dhcpsrv/lease_snapshot.h>
+#include <cc/data.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace isc::asiolink;
+using namespace isc::data;
+using namespace std;
+
+namespace isc {
+namespace dhcp {
+
+namespace {
+
+static_assert(sizeof(LeaseSnapshotHeader) == 72,
+              "unexpected size of the lease snapshot header");
+static_assert(sizeof(LeaseSnapshotRecord4) == 64,
+              "unexpected size of the DHCPv4 lease snapshot record");
+static_assert(sizeof(LeaseSnapshotRecord6) == 96,
+              "unexpected size of the DHCPv6 lease snapshot record");
+
+/// @brief Returns the size of the records of the given family.
+///
+/// @param family Protocol family, 4 or 6.
+size_t
+recordSize(const uint16_t family) {
+    return (family == 4 ? sizeof(LeaseSnapshotRecord4) :
+            sizeof(LeaseSnapshotRecord6));
+}
+
+/// @brief Fills the source file identification of the header.
+///
+/// @param source Name of the lease file.
+/// @param [out] header Header to fill.
+/// @throw LeaseSnapshotError if the file can't be stat'ed.
+void
+getSourceInfo(const string& source, LeaseSnapshotHeader& header) {
+    struct stat st;
+    if (stat(source.c_str(), &st) != 0) {
+        isc_throw(LeaseSnapshotError, "unable to stat the lease file '"
+                  << source << "': " << strerror(errno));
+    }
+    header.source_size_ = static_cast<uint64_t>(st.st_size);
+    header.source_mtime_ = static_cast<int64_t>(st.st_mtim.tv_sec) * 1000000000 +
+        st.st_mtim.tv_nsec;
+    header.source_inode_ = static_cast<uint64_t>(st.st_ino);
+}
+
+} // end of anonymous namespace
+
+const char LeaseSnapshotFile::MAGIC[8] = { 'K', 'E', 'A', 'L', 'S', 'N', 'A', 'P' };
+const uint32_t LeaseSnapshotFile::FORMAT_VERSION;
+const uint32_t LeaseSnapshotFile::BYTE_ORDER_MARK;
+const uint32_t LeaseSnapshotFile::FLAG_FQDN_FWD;
+const uint32_t LeaseSnapshotFile::FLAG_FQDN_REV;
+
+LeaseSnapshotFile::LeaseSnapshotFile(const string& filename)
+    : filename_(filename), data_(0), size_(0), record_size_(0),
+      record_count_(0), heap_(0), heap_size_(0) {
+}
+
+LeaseSnapshotFile::~LeaseSnapshotFile() {
+    close();
+}
+
+bool
+LeaseSnapshotFile::exists() const {
+    struct stat st;
+    return (stat(filename_.c_str(), &st) == 0);
+}
+
+void
+LeaseSnapshotFile::open(const uint16_t family, const string& source) {
+    close();
+
+    int fd = ::open(filename_.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        isc_throw(LeaseSnapshotError, "unable to open the lease snapshot '"
+                  << filename_ << "': " << strerror(errno));
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        int err = errno;
+        ::close(fd);
+        isc_throw(LeaseSnapshotError, "unable to stat the lease snapshot '"
+                  << filename_ << "': " << strerror(err));
+    }
+    if (static_cast<uint64_t>(st.st_size) < sizeof(LeaseSnapshotHeader)) {
+        ::close(fd);
+        isc_throw(LeaseSnapshotError, "lease snapshot '" << filename_
+                  << "' is truncated");
+    }
+    void* data = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping remains valid after the descriptor is closed.
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        isc_throw(LeaseSnapshotError, "unable to map the lease snapshot '"
+                  << filename_ << "': " << strerror(errno));
+    }
+    static_cast<void>(madvise(data, st.st_size, MADV_SEQUENTIAL));
+    data_ = static_cast<uint8_t*>(data);
+    size_ = st.st_size;
+
+    try {
+        LeaseSnapshotHeader header;
+        memcpy(&header, data_, sizeof(header));
+        if ((memcmp(header.magic_, MAGIC, sizeof(MAGIC)) != 0) ||
+            (header.byte_order_ != BYTE_ORDER_MARK)) {
+            isc_throw(LeaseSnapshotError, "'" << filename_
+                      << "' is not a lease snapshot written by this host");
+        }
+        if (header.version_ != FORMAT_VERSION) {
+            isc_throw(LeaseSnapshotError, "unsupported version "
+                      << header.version_ << " of the lease snapshot '"
+                      << filename_ << "'");
+        }
+        if ((header.family_ != family) ||
+            (header.record_size_ != recordSize(family))) {
+            isc_throw(LeaseSnapshotError, "lease snapshot '" << filename_
+                      << "' doesn't hold DHCPv" << family << " leases");
+        }
+        const uint64_t records_size = header.record_count_ * header.record_size_;
+        if ((header.record_count_ > size_ / header.record_size_) ||
+            (header.heap_offset_ != sizeof(header) + records_size) ||
+            (header.heap_offset_ > size_) ||
+            (header.heap_size_ != size_ - header.heap_offset_)) {
+            isc_throw(LeaseSnapshotError, "lease snapshot '" << filename_
+                      << "' is truncated or corrupted");
+        }
+
+        LeaseSnapshotHeader current;
+        getSourceInfo(source, current);
+        if ((current.source_size_ != header.source_size_) ||
+            (current.source_mtime_ != header.source_mtime_) ||
+            (current.source_inode_ != header.source_inode_)) {
+            isc_throw(LeaseSnapshotError, "lease snapshot '" << filename_
+                      << "' was not created from the current lease file '"
+                      << source << "'");
+        }
+
+        record_size_ = header.record_size_;
+        record_count_ = header.record_count_;
+        heap_ = data_ + header.heap_offset_;
+        heap_size_ = header.heap_size_;
+
+    } catch (...) {
+        close();
+        throw;
+    }
+}
+
+void
+LeaseSnapshotFile::close() {
+    if (data_) {
+        munmap(data_, size_);
+        data_ = 0;
+    }
+    size_ = 0;
+    record_size_ = 0;
+    record_count_ = 0;
+    heap_ = 0;
+    heap_size_ = 0;
+}
+
+const uint8_t*
+LeaseSnapshotFile::getRecord(const uint64_t index) const {
+    if (index >= record_count_) {
+        isc_throw(OutOfRange, "lease snapshot record index " << index
+                  << " out of range");
+    }
+    return (data_ + sizeof(LeaseSnapshotHeader) + index * record_size_);
+}
+
+const uint8_t*
+LeaseSnapshotFile::getBlob(const LeaseSnapshotBlob& blob) const {
+    if (static_cast<uint64_t>(blob.offset_) + blob.length_ > heap_size_) {
+        isc_throw(LeaseSnapshotError, "lease snapshot '" << filename_
+                  << "' references a value out of its heap");
+    }
+    return (heap_ + blob.offset_);
+}
+
+string
+LeaseSnapshotFile::getString(const LeaseSnapshotBlob& blob) const {
+    const uint8_t* value = getBlob(blob);
+    return (string(reinterpret_cast<const char*>(value), blob.length_));
+}
+
+vector<uint8_t>
+LeaseSnapshotFile::getBinary(const LeaseSnapshotBlob& blob) const {
+    const uint8_t* value = getBlob(blob);
+    return (vector<uint8_t>(value, value + blob.length_));
+}
+
+void
+LeaseSnapshotFile::getLease(const uint64_t index, Lease4Ptr& lease) const {
+    if (record_size_ != sizeof(LeaseSnapshotRecord4)) {
+        isc_throw(LeaseSnapshotError, "lease snapshot '" << filename_
+                  << "' doesn't hold DHCPv4 leases");
+    }
+    LeaseSnapshotRecord4 record;
+    memcpy(&record, getRecord(index), sizeof(record));
+
+    try {
+        HWAddrPtr hwaddr(new HWAddr(getBinary(record.hwaddr_), HTYPE_ETHER));
+        vector<uint8_t> client_id = getBinary(record.client_id_);
+        lease.reset(new Lease4(IOAddress(record.address_), hwaddr,
+                               client_id.empty() ? 0 : &client_id[0],
+                               client_id.size(), record.valid_lft_,
+                               static_cast<time_t>(record.cltt_),
+                               record.subnet_id_,
+                               record.flags_ & FLAG_FQDN_FWD,
+                               record.flags_ & FLAG_FQDN_REV,
+                               getString(record.hostname_)));
+        lease->state_ = record.state_;
+        if (record.user_context_.length_ > 0) {
+            lease->setContext(Element::fromJSON(getString(record.user_context_)));
+        }
+
+    } catch (const LeaseSnapshotError&) {
+        lease.reset();
+        throw;
+
+    } catch (const std::exception& ex) {
+        lease.reset();
+        isc_throw(LeaseSnapshotError, "invalid lease at index " << index
+                  << " of the lease snapshot '" << filename_ << "': "
+                  << ex.what());
+    }
+}
+
+void
+LeaseSnapshotFile::getLease(const uint64_t index, Lease6Ptr& lease) const {
+    if (record_size_ != sizeof(LeaseSnapshotRecord6)) {
+        isc_throw(LeaseSnapshotError, "lease snapshot '" << filename_
+                  << "' doesn't hold DHCPv6 leases");
+    }
+    LeaseSnapshotRecord6 record;
+    memcpy(&record, getRecord(index), sizeof(record));
+
+    try {
+        DuidPtr duid(new DUID(getBinary(record.duid_)));
+        HWAddrPtr hwaddr;
+        if (record.hwaddr_.length_ > 0) {
+            hwaddr.reset(new HWAddr(getBinary(record.hwaddr_), HTYPE_ETHER));
+        }
+        lease.reset(new Lease6(static_cast<Lease::Type>(record.type_),
+                               IOAddress::fromBytes(AF_INET6, record.address_),
+                               duid, record.iaid_, record.preferred_lft_,
+                               record.valid_lft_, record.subnet_id_, hwaddr,
+                               record.prefixlen_,
+                               static_cast<time_t>(record.alloc_time_)));
+        lease->cltt_ = static_cast<time_t>(record.cltt_);
+        lease->fqdn_fwd_ = record.flags_ & FLAG_FQDN_FWD;
+        lease->fqdn_rev_ = record.flags_ & FLAG_FQDN_REV;
+        lease->hostname_ = getString(record.hostname_);
+        lease->state_ = record.state_;
+        lease->pool_id_ = record.pool_id_;
+        if (record.user_context_.length_ > 0) {
+            lease->setContext(Element::fromJSON(getString(record.user_context_)));
+        }
+
+    } catch (const LeaseSnapshotError&) {
+        lease.reset();
+        throw;
+
+    } catch (const std::exception& ex) {
+        lease.reset();
+        isc_throw(LeaseSnapshotError, "invalid lease at index " << index
+                  << " of the lease snapshot '" << filename_ << "': "
+                  << ex.what());
+    }
+}
+
+LeaseSnapshotWriter::LeaseSnapshotWriter(const string& filename,
+                                         const uint16_t family)
+    : filename_(filename), tmp_filename_(filename + ".tmp"), family_(family),
+      heap_filename_(filename + ".heap"), fs_(), heap_fs_(), record_count_(0),
+      heap_size_(0) {
+    if ((family != 4) && (family != 6)) {
+        isc_throw(BadValue, "invalid protocol family " << family
+                  << " of the lease snapshot '" << filename << "'");
+    }
+}
+
+LeaseSnapshotWriter::~LeaseSnapshotWriter() {
+    abort();
+}
+
+void
+LeaseSnapshotWriter::open() {
+    abort();
+    fs_.open(tmp_filename_.c_str(), ios::out | ios::binary | ios::trunc);
+    if (!fs_.is_open()) {
+        isc_throw(LeaseSnapshotError, "unable to create the lease snapshot '"
+                  << tmp_filename_ << "'");
+    }
+    heap_fs_.open(heap_filename_.c_str(),
+                  ios::in | ios::out | ios::binary | ios::trunc);
+    if (!heap_fs_.is_open()) {
+        abort();
+        isc_throw(LeaseSnapshotError, "unable to create the lease snapshot "
+                  "heap '" << heap_filename_ << "'");
+    }
+    record_count_ = 0;
+    heap_size_ = 0;
+
+    // Reserve the space for the header written by commit.
+    LeaseSnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    write(&header, sizeof(header));
+}
+
+void
+LeaseSnapshotWriter::append(const Lease4& lease) {
+    checkAppend(4);
+
+    LeaseSnapshotRecord4 record;
+    memset(&record, 0, sizeof(record));
+    record.address_ = lease.addr_.toUint32();
+    record.valid_lft_ = lease.valid_lft_;
+    record.cltt_ = static_cast<int64_t>(lease.cltt_);
+    record.subnet_id_ = lease.subnet_id_;
+    record.state_ = lease.state_;
+    record.flags_ = (lease.fqdn_fwd_ ? LeaseSnapshotFile::FLAG_FQDN_FWD : 0) |
+        (lease.fqdn_rev_ ? LeaseSnapshotFile::FLAG_FQDN_REV : 0);
+    if (lease.hwaddr_) {
+        record.hwaddr_ = addBlob(lease.hwaddr_->hwaddr_);
+    }
+    if (lease.client_id_) {
+        record.client_id_ = addBlob(lease.client_id_->getClientId());
+    }
+    record.hostname_ = addBlob(lease.hostname_);
+    if (lease.getContext()) {
+        record.user_context_ = addBlob(lease.getContext()->str());
+    }
+    write(&record, sizeof(record));
+    ++record_count_;
+}
+
+void
+LeaseSnapshotWriter::append(const Lease6& lease) {
+    checkAppend(6);
+
+    LeaseSnapshotRecord6 record;
+    memset(&record, 0, sizeof(record));
+    const vector<uint8_t> address = lease.addr_.toBytes();
+    if (address.size() != sizeof(record.address_)) {
+        isc_throw(LeaseSnapshotError, "invalid DHCPv6 lease address "
+                  << lease.addr_);
+    }
+    memcpy(record.address_, &address[0], sizeof(record.address_));
+    record.cltt_ = static_cast<int64_t>(lease.cltt_);
+    record.alloc_time_ = static_cast<int64_t>(lease.alloc_time_);
+    record.pool_id_ = lease.pool_id_;
+    record.valid_lft_ = lease.valid_lft_;
+    record.preferred_lft_ = lease.preferred_lft_;
+    record.subnet_id_ = lease.subnet_id_;
+    record.iaid_ = lease.iaid_;
+    record.state_ = lease.state_;
+    record.type_ = static_cast<uint8_t>(lease.type_);
+    record.prefixlen_ = lease.prefixlen_;
+    record.flags_ = (lease.fqdn_fwd_ ? LeaseSnapshotFile::FLAG_FQDN_FWD : 0) |
+        (lease.fqdn_rev_ ? LeaseSnapshotFile::FLAG_FQDN_REV : 0);
+    if (lease.duid_) {
+        record.duid_ = addBlob(lease.duid_->getDuid());
+    }
+    if (lease.hwaddr_) {
+        record.hwaddr_ = addBlob(lease.hwaddr_->hwaddr_);
+    }
+    record.hostname_ = addBlob(lease.hostname_);
+    if (lease.getContext()) {
+        record.user_context_ = addBlob(lease.getContext()->str());
+    }
+    write(&record, sizeof(record));
+    ++record_count_;
+}
+
+void
+LeaseSnapshotWriter::commit(const string& source) {
+    if (!fs_.is_open()) {
+        isc_throw(LeaseSnapshotError, "lease snapshot '" << tmp_filename_
+                  << "' is not open");
+    }
+
+    LeaseSnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic_, LeaseSnapshotFile::MAGIC, sizeof(header.magic_));
+    header.version_ = LeaseSnapshotFile::FORMAT_VERSION;
+    header.family_ = family_;
+    header.record_size_ = recordSize(family_);
+    header.byte_order_ = LeaseSnapshotFile::BYTE_ORDER_MARK;
+    header.record_count_ = record_count_;
+    header.heap_offset_ = sizeof(header) + record_count_ * header.record_size_;
+    header.heap_size_ = heap_size_;
+    getSourceInfo(source, header);
+
+    copyHeap();
+    fs_.seekp(0);
+    write(&header, sizeof(header));
+    fs_.close();
+    if (fs_.fail()) {
+        isc_throw(LeaseSnapshotError, "unable to write the lease snapshot '"
+                  << tmp_filename_ << "'");
+    }
+
+    if (rename(tmp_filename_.c_str(), filename_.c_str()) != 0) {
+        isc_throw(LeaseSnapshotError, "unable to move the lease snapshot '"
+                  << tmp_filename_ << "' to '" << filename_ << "': "
+                  << strerror(errno));
+    }
+}
+
+void
+LeaseSnapshotWriter::abort() {
+    if (fs_.is_open()) {
+        fs_.close();
+        static_cast<void>(remove(tmp_filename_.c_str()));
+    }
+    fs_.clear();
+    if (heap_fs_.is_open()) {
+        heap_fs_.close();
+        static_cast<void>(remove(heap_filename_.c_str()));
+    }
+    heap_fs_.clear();
+    heap_size_ = 0;
+}
+
+LeaseSnapshotBlob
+LeaseSnapshotWriter::addBlob(const void* data, const size_t length) {
+    LeaseSnapshotBlob blob;
+    blob.offset_ = 0;
+    blob.length_ = 0;
+    if (length == 0) {
+        return (blob);
+    }
+    if (heap_size_ + length > numeric_limits<uint32_t>::max()) {
+        isc_throw(LeaseSnapshotError, "heap of the lease snapshot '"
+                  << tmp_filename_ << "' is full");
+    }
+    heap_fs_.write(static_cast<const char*>(data), length);
+    if (!heap_fs_.good()) {
+        isc_throw(LeaseSnapshotError, "unable to write the lease snapshot "
+                  "heap '" << heap_filename_ << "'");
+    }
+    blob.offset_ = static_cast<uint32_t>(heap_size_);
+    blob.length_ = static_cast<uint32_t>(length);
+    heap_size_ += length;
+    return (blob);
+}
+
+void
+LeaseSnapshotWriter::write(const void* data, const size_t length) {
+    fs_.write(static_cast<const char*>(data), length);
+    if (!fs_.good()) {
+        isc_throw(LeaseSnapshotError, "unable to write the lease snapshot '"
+                  << tmp_filename_ << "'");
+    }
+}
+
+void
+LeaseSnapshotWriter::copyHeap() {
+    heap_fs_.flush();
+    heap_fs_.seekg(0);
+    vector<char> buffer(65536);
+    uint64_t remaining = heap_size_;
+    while (remaining > 0) {
+        const size_t length = static_cast<size_t>(min<uint64_t>(remaining,
+                                                                buffer.size()));
+        heap_fs_.read(&buffer[0], length);
+        if (static_cast<size_t>(heap_fs_.gcount()) != length) {
+            isc_throw(LeaseSnapshotError, "unable to read the lease snapshot "
+                      "heap '" << heap_filename_ << "'");
+        }
+        write(&buffer[0], length);
+        remaining -= length;
+    }
+    heap_fs_.close();
+    static_cast<void>(remove(heap_filename_.c_str()));
+    heap_fs_.clear();
+}
+
+void
+LeaseSnapshotWriter::checkAppend(const uint16_t family) const {
+    if (!fs_.is_open()) {
+        isc_throw(LeaseSnapshotError, "lease snapshot '" << tmp_filename_
+                  << "' is not open");
+    }
+    if (family != family_) {
+        isc_throw(LeaseSnapshotError, "unable to append a DHCPv" << family
+                  << " lease to the DHCPv" << family_ << " lease snapshot '"
+                  << filename_ << "'");
+    }
+}
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
@@ -0,0 +1,416 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef LEASE_SNAPSHOT_H
+#define LEASE_SNAPSHOT_H
+
+#include <dhcpsrv/lease.h>
+#include <exceptions/exceptions.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Exception thrown when the lease snapshot can't be read or written.
+class LeaseSnapshotError : public Exception {
+public:
+    LeaseSnapshotError(const char* file, size_t line, const char* what) :
+        isc::Exception(file, line, what) {
+    }
+};
+
+/// @brief Reference to a variable length value held in the snapshot heap.
+struct LeaseSnapshotBlob {
+    /// @brief Offset of the value from the beginning of the heap.
+    uint32_t offset_;
+    /// @brief Length of the value.
+    uint32_t length_;
+};
+
+/// @brief Header of the lease snapshot file.
+///
+/// The snapshot file consists of the header, followed by fixed size lease
+/// records sorted by address, followed by the heap holding the variable
+/// length values (hardware addresses, client identifiers, DUIDs, hostnames
+/// and user contexts) referenced by the records. All values are stored in
+/// the host byte order: a snapshot is a cache of the lease file written and
+/// read on the same machine, not an interchange format.
+///
+/// The header also identifies the lease file the snapshot was created
+/// from. The snapshot is only used in place of the lease file as long as
+/// that file has the same size, modification time and inode number, i.e.
+/// it has been renamed but not modified since the snapshot was written.
+struct LeaseSnapshotHeader {
+    /// @brief Magic value identifying the file type.
+    char magic_[8];
+    /// @brief Version of the format.
+    uint32_t version_;
+    /// @brief Protocol family of the leases, 4 or 6.
+    uint32_t family_;
+    /// @brief Size of a lease record.
+    uint32_t record_size_;
+    /// @brief Byte order mark, @c LeaseSnapshotFile::BYTE_ORDER_MARK.
+    uint32_t byte_order_;
+    /// @brief Number of lease records.
+    uint64_t record_count_;
+    /// @brief Offset of the heap from the beginning of the file.
+    uint64_t heap_offset_;
+    /// @brief Size of the heap.
+    uint64_t heap_size_;
+    /// @brief Size of the lease file the snapshot was created from.
+    uint64_t source_size_;
+    /// @brief Modification time of the lease file in nanoseconds.
+    int64_t source_mtime_;
+    /// @brief Inode number of the lease file.
+    uint64_t source_inode_;
+};
+
+/// @brief DHCPv4 lease record of the snapshot.
+struct LeaseSnapshotRecord4 {
+    /// @brief Address in the host byte order.
+    uint32_t address_;
+    /// @brief Valid lifetime.
+    uint32_t valid_lft_;
+    /// @brief Client last transmission time.
+    int64_t cltt_;
+    /// @brief Subnet identifier.
+    uint32_t subnet_id_;
+    /// @brief Lease state.
+    uint32_t state_;
+    /// @brief Combination of the @c LeaseSnapshotFile flags.
+    uint32_t flags_;
+    /// @brief Padding.
+    uint32_t reserved_;
+    /// @brief Hardware address.
+    LeaseSnapshotBlob hwaddr_;
+    /// @brief Client identifier, empty if not set.
+    LeaseSnapshotBlob client_id_;
+    /// @brief Hostname.
+    LeaseSnapshotBlob hostname_;
+    /// @brief User context in JSON form, empty if not set.
+    LeaseSnapshotBlob user_context_;
+};
+
+/// @brief DHCPv6 lease record of the snapshot.
+struct LeaseSnapshotRecord6 {
+    /// @brief Address or prefix in the network byte order.
+    uint8_t address_[16];
+    /// @brief Client last transmission time.
+    int64_t cltt_;
+    /// @brief Allocation time.
+    int64_t alloc_time_;
+    /// @brief Pool identifier.
+    int64_t pool_id_;
+    /// @brief Valid lifetime.
+    uint32_t valid_lft_;
+    /// @brief Preferred lifetime.
+    uint32_t preferred_lft_;
+    /// @brief Subnet identifier.
+    uint32_t subnet_id_;
+    /// @brief IAID.
+    uint32_t iaid_;
+    /// @brief Lease state.
+    uint32_t state_;
+    /// @brief Lease type.
+    uint8_t type_;
+    /// @brief Prefix length.
+    uint8_t prefixlen_;
+    /// @brief Combination of the @c LeaseSnapshotFile flags.
+    uint8_t flags_;
+    /// @brief Padding.
+    uint8_t reserved_;
+    /// @brief DUID.
+    LeaseSnapshotBlob duid_;
+    /// @brief Hardware address, empty if not set.
+    LeaseSnapshotBlob hwaddr_;
+    /// @brief Hostname.
+    LeaseSnapshotBlob hostname_;
+    /// @brief User context in JSON form, empty if not set.
+    LeaseSnapshotBlob user_context_;
+};
+
+/// @brief Read-only, memory mapped lease snapshot.
+///
+/// The leases are created from the records on demand. The leases are the
+/// same as the leases which would be read from the lease file the snapshot
+/// was created from, so the snapshot can be loaded in place of that file.
+class LeaseSnapshotFile : public boost::noncopyable {
+public:
+
+    /// @brief Magic value identifying the file type.
+    static const char MAGIC[8];
+
+    /// @brief Current version of the format.
+    static const uint32_t FORMAT_VERSION = 1;
+
+    /// @brief Value of the byte order mark written by this host.
+    static const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+    /// @brief Flag set in the record when the forward DNS update is
+    /// performed for the lease.
+    static const uint32_t FLAG_FQDN_FWD = 0x1;
+
+    /// @brief Flag set in the record when the reverse DNS update is
+    /// performed for the lease.
+    static const uint32_t FLAG_FQDN_REV = 0x2;
+
+    /// @brief Constructor.
+    ///
+    /// The constructor doesn't open the file.
+    ///
+    /// @param filename Name of the snapshot file.
+    explicit LeaseSnapshotFile(const std::string& filename);
+
+    /// @brief Destructor.
+    ///
+    /// Unmaps the file.
+    ~LeaseSnapshotFile();
+
+    /// @brief Returns the name of the snapshot file.
+    std::string getFilename() const {
+        return (filename_);
+    }
+
+    /// @brief Checks if the snapshot file exists.
+    bool exists() const;
+
+    /// @brief Maps the snapshot file and validates it.
+    ///
+    /// @param family Expected protocol family of the leases, 4 or 6.
+    /// @param source Name of the lease file the snapshot is used in place
+    /// of.
+    ///
+    /// @throw LeaseSnapshotError if the file can't be mapped, is not a
+    /// valid snapshot of the given family, or was not created from the
+    /// current contents of the lease file.
+    void open(const uint16_t family, const std::string& source);
+
+    /// @brief Unmaps the snapshot file.
+    void close();
+
+    /// @brief Returns the number of lease records.
+    uint64_t getRecordCount() const {
+        return (record_count_);
+    }
+
+    /// @brief Creates the DHCPv4 lease from a record.
+    ///
+    /// @param index Index of the record.
+    /// @param [out] lease Created lease.
+    ///
+    /// @throw LeaseSnapshotError if the lease can't be created.
+    void getLease(const uint64_t index, Lease4Ptr& lease) const;
+
+    /// @brief Creates the DHCPv6 lease from a record.
+    ///
+    /// @param index Index of the record.
+    /// @param [out] lease Created lease.
+    ///
+    /// @throw LeaseSnapshotError if the lease can't be created.
+    void getLease(const uint64_t index, Lease6Ptr& lease) const;
+
+private:
+
+    /// @brief Returns the pointer to a record.
+    ///
+    /// @param index Index of the record.
+    /// @throw OutOfRange if the index is out of range.
+    const uint8_t* getRecord(const uint64_t index) const;
+
+    /// @brief Returns the pointer to a value held in the heap.
+    ///
+    /// @param blob Reference to the value.
+    /// @throw LeaseSnapshotError if the value is out of the heap.
+    const uint8_t* getBlob(const LeaseSnapshotBlob& blob) const;
+
+    /// @brief Returns a value held in the heap as a string.
+    ///
+    /// @param blob Reference to the value.
+    std::string getString(const LeaseSnapshotBlob& blob) const;
+
+    /// @brief Returns a value held in the heap as a vector.
+    ///
+    /// @param blob Reference to the value.
+    std::vector<uint8_t> getBinary(const LeaseSnapshotBlob& blob) const;
+
+    /// @brief Name of the snapshot file.
+    std::string filename_;
+
+    /// @brief Beginning of the mapped file, null when not open.
+    uint8_t* data_;
+
+    /// @brief Size of the mapped file.
+    size_t size_;
+
+    /// @brief Size of a record.
+    size_t record_size_;
+
+    /// @brief Number of records.
+    uint64_t record_count_;
+
+    /// @brief Beginning of the heap.
+    const uint8_t* heap_;
+
+    /// @brief Size of the heap.
+    uint64_t heap_size_;
+};
+
+/// @brief Writer of the lease snapshot.
+///
+/// The records are written as the leases are appended, in the order in
+/// which they are appended, which must be the address order. The heap is
+/// streamed to a second temporary file as the leases are appended and
+/// @c commit copies it after the records, so the memory used by the writer
+/// doesn't grow with the number of leases. The snapshot is written to a
+/// temporary file which @c commit renames to the snapshot file, so a
+/// partially written snapshot is never seen by the readers.
+class LeaseSnapshotWriter : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// The constructor doesn't open the file.
+    ///
+    /// @param filename Name of the snapshot file.
+    /// @param family Protocol family of the leases, 4 or 6.
+    LeaseSnapshotWriter(const std::string& filename, const uint16_t family);
+
+    /// @brief Destructor.
+    ///
+    /// Removes the temporary files if the snapshot hasn't been committed.
+    ~LeaseSnapshotWriter();
+
+    /// @brief Returns the name of the snapshot file.
+    std::string getFilename() const {
+        return (filename_);
+    }
+
+    /// @brief Returns the number of leases appended.
+    uint64_t getRecordCount() const {
+        return (record_count_);
+    }
+
+    /// @brief Creates the temporary files.
+    ///
+    /// @throw LeaseSnapshotError if the files can't be created.
+    void open();
+
+    /// @brief Appends the DHCPv4 lease.
+    ///
+    /// @param lease Lease to append.
+    /// @throw LeaseSnapshotError on write error or when the family of the
+    /// snapshot is not 4.
+    void append(const Lease4& lease);
+
+    /// @brief Appends the DHCPv6 lease.
+    ///
+    /// @param lease Lease to append.
+    /// @throw LeaseSnapshotError on write error or when the family of the
+    /// snapshot is not 6.
+    void append(const Lease6& lease);
+
+    /// @brief Appends the heap, writes the header and renames the temporary
+    /// file to the snapshot file.
+    ///
+    /// @param source Name of the lease file the snapshot has been created
+    /// from. The file must not be modified after this call for the
+    /// snapshot to be used.
+    /// @throw LeaseSnapshotError on error.
+    void commit(const std::string& source);
+
+    /// @brief Closes and removes the temporary files.
+    void abort();
+
+private:
+
+    /// @brief Writes a value to the heap file.
+    ///
+    /// @param data Value.
+    /// @param length Length of the value.
+    /// @return Reference to the value.
+    /// @throw LeaseSnapshotError if the heap is full or on write error.
+    LeaseSnapshotBlob addBlob(const void* data, const size_t length);
+
+    /// @brief Copies a string to the heap.
+    ///
+    /// @param value Value.
+    /// @return Reference to the value.
+    LeaseSnapshotBlob addBlob(const std::string& value) {
+        return (addBlob(value.data(), value.size()));
+    }
+
+    /// @brief Copies a binary value to the heap.
+    ///
+    /// @param value Value.
+    /// @return Reference to the value.
+    LeaseSnapshotBlob addBlob(const std::vector<uint8_t>& value) {
+        return (addBlob(value.data(), value.size()));
+    }
+
+    /// @brief Writes data to the temporary file.
+    ///
+    /// @param data Data.
+    /// @param length Length of the data.
+    /// @throw LeaseSnapshotError on write error.
+    void write(const void* data, const size_t length);
+
+    /// @brief Copies the heap file to the end of the temporary file.
+    ///
+    /// @throw LeaseSnapshotError on read or write error.
+    void copyHeap();
+
+    /// @brief Checks that the file is open for the given family.
+    ///
+    /// @param family Protocol family of the appended lease.
+    /// @throw LeaseSnapshotError if it isn't.
+    void checkAppend(const uint16_t family) const;
+
+    /// @brief Name of the snapshot file.
+    std::string filename_;
+
+    /// @brief Name of the temporary file.
+    std::string tmp_filename_;
+
+    /// @brief Protocol family of the leases.
+    uint16_t family_;
+
+    /// @brief Name of the temporary heap file.
+    std::string heap_filename_;
+
+    /// @brief Temporary file stream.
+    std::ofstream fs_;
+
+    /// @brief Temporary heap file stream.
+    std::fstream heap_fs_;
+
+    /// @brief Number of records written.
+    uint64_t record_count_;
+
+    /// @brief Size of the heap written to the heap file.
+    uint64_t heap_size_;
+};
+
+}  // namespace dhcp
+}  // namespace isc
+
+#endif // LEASE_SNAPSHOT_H
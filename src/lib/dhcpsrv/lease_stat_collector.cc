@@ -0,0 +1,198 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <dhcpsrv/lease_stat_collector.h>
+#include <exceptions/exceptions.h>
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <thread>
+
+namespace isc {
+namespace dhcp {
+
+namespace {
+
+/// @brief Converts an offset from the start of the ring to a token.
+///
+/// @param offset Offset, 0 being INT64_MIN.
+/// @return The token.
+int64_t
+offsetToToken(const uint64_t offset) {
+    return (static_cast<int64_t>(offset ^ (1ULL << 63)));
+}
+
+}  // namespace
+
+std::vector<TokenRange>
+splitTokenRing(const size_t count) {
+    if (count == 0) {
+        isc_throw(BadValue, "the token ring can't be split in 0 ranges");
+    }
+
+    const uint64_t last_offset = std::numeric_limits<uint64_t>::max();
+    const uint64_t width = last_offset / count;
+    std::vector<TokenRange> ranges;
+    ranges.reserve(count);
+    uint64_t first = 0;
+    for (size_t i = 0; i < count; ++i) {
+        const uint64_t last = (i + 1 == count ? last_offset : first + width - 1);
+        ranges.push_back(TokenRange(offsetToToken(first), offsetToToken(last)));
+        first = last + 1;
+    }
+    return (ranges);
+}
+
+void
+scanTokenRing(const size_t range_count, const size_t thread_count,
+              const std::function<void(const TokenRange&, size_t)>& scan) {
+    const std::vector<TokenRange> ranges = splitTokenRing(range_count);
+    const size_t threads_used = std::min(std::max(thread_count, static_cast<size_t>(1)),
+                                         ranges.size());
+
+    std::atomic<size_t> next(0);
+    std::atomic<bool> aborted(false);
+    std::mutex error_mutex;
+    std::exception_ptr error;
+    auto worker = [&](const size_t index) {
+        for (size_t i = next++; (i < ranges.size()) && !aborted; i = next++) {
+            try {
+                scan(ranges[i], index);
+            } catch (...) {
+                std::lock_guard<std::mutex> lk(error_mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                aborted = true;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < threads_used; ++i) {
+        threads.push_back(std::thread(worker, i));
+    }
+    worker(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+void
+addLeaseStatDelta(LeaseStatCounts& deltas, const LeaseStatsRow& from,
+                  const LeaseStatsRow& to) {
+    if (!(from < to) && !(to < from)) {
+        return;
+    }
+    --deltas[from];
+    ++deltas[to];
+}
+
+LeaseStatCollector::LeaseStatCollector(LeaseStatSource& source,
+                                       const bool use_counters,
+                                       const size_t thread_count,
+                                       const size_t range_count)
+    : source_(source), use_counters_(use_counters),
+      thread_count_(std::max(thread_count, static_cast<size_t>(1))),
+      range_count_(range_count), method_(NONE) {
+}
+
+LeaseStatCounts
+LeaseStatCollector::collect() {
+    if (use_counters_) {
+        switch (source_.getCounterStatus()) {
+        case LeaseStatSource::COUNTERS_READY: {
+            LeaseStatCounts counts;
+            source_.readCounters(counts);
+            method_ = COUNTERS;
+            return (counts);
+        }
+        case LeaseStatSource::COUNTERS_ABSENT:
+            if (source_.claimCounterRebuild()) {
+                LeaseStatCounts counts;
+                try {
+                    LeaseStatCounts deltas;
+                    source_.readDeltaCounters(deltas);
+                    counts = scan();
+                    rebuild(counts, deltas);
+                } catch (...) {
+                    source_.abortCounterRebuild();
+                    throw;
+                }
+                method_ = REBUILD;
+                return (counts);
+            }
+            break;
+        case LeaseStatSource::COUNTERS_REBUILDING:
+            break;
+        }
+    }
+
+    LeaseStatCounts counts = scan();
+    method_ = SCAN;
+    return (counts);
+}
+
+LeaseStatCounts
+LeaseStatCollector::scan() {
+    // Each thread counts into its own map, merged once all are done.
+    std::vector<LeaseStatCounts> partial(std::min(thread_count_, range_count_));
+    scanTokenRing(range_count_, thread_count_,
+                  [this, &partial](const TokenRange& range, const size_t index) {
+        source_.scanTokenRange(range, partial[index]);
+    });
+
+    LeaseStatCounts counts;
+    for (auto const& part : partial) {
+        for (auto const& count : part) {
+            counts[count.first] += count.second;
+        }
+    }
+    return (counts);
+}
+
+void
+LeaseStatCollector::rebuild(const LeaseStatCounts& scanned,
+                            const LeaseStatCounts& deltas) {
+    // The base counters plus the delta counters read before the scan
+    // give the scanned counts.
+    LeaseStatCounts base(scanned);
+    for (auto const& delta : deltas) {
+        base[delta.first] -= delta.second;
+    }
+    for (auto it = base.begin(); it != base.end(); ) {
+        if (it->second == 0) {
+            it = base.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    source_.addToBaseCounters(base);
+    source_.setCountersReady();
+}
+
+}  // namespace dhcp
+}  // namespace isc
@@ -0,0 +1,233 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef LEASE_STAT_COLLECTOR_H
+#define LEASE_STAT_COLLECTOR_H
+
+#include <dhcpsrv/lease_mgr.h>
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Lease counts per subnet, lease type and lease state.
+///
+/// The count of the @c LeaseStatsRow key is not used.
+typedef std::map<LeaseStatsRow, int64_t> LeaseStatCounts;
+
+/// @brief Inclusive range of partition tokens.
+typedef std::pair<int64_t, int64_t> TokenRange;
+
+/// @brief Splits the Murmur3 token ring into ranges of equal width.
+///
+/// The ranges are contiguous and cover all tokens, from INT64_MIN to
+/// INT64_MAX.
+///
+/// @param count Number of ranges.
+/// @return Ranges in the token order.
+/// @throw BadValue if the count is 0.
+std::vector<TokenRange> splitTokenRing(const size_t count);
+
+/// @brief Calls a function for every range of the split token ring.
+///
+/// The ranges are distributed over up to @c thread_count threads, the
+/// calling thread being one of them. The first exception thrown stops the
+/// remaining ranges and is rethrown.
+///
+/// @param range_count Number of token ranges.
+/// @param thread_count Number of threads.
+/// @param scan Function called with a range and the index of the thread
+/// calling it, from 0 to thread_count - 1.
+/// @throw BadValue if the range count is 0.
+void scanTokenRing(const size_t range_count, const size_t thread_count,
+                   const std::function<void(const TokenRange&, size_t)>& scan);
+
+/// @brief Adds the counter changes caused by a lease change.
+///
+/// Nothing is added when the lease stays in the same subnet and state.
+///
+/// @param deltas Counter changes to add to.
+/// @param from Subnet, type and state of the lease before the change.
+/// @param to Subnet, type and state of the lease after the change.
+void addLeaseStatDelta(LeaseStatCounts& deltas, const LeaseStatsRow& from,
+                       const LeaseStatsRow& to);
+
+/// @brief Database queries used to collect lease statistics.
+///
+/// The backend implements it on top of its driver. All counts are for
+/// one lease family.
+///
+/// The counters are made of two parts. The lease changes add to the delta
+/// counters, which are never reset. A rebuild writes base counters in a
+/// fresh generation, which it swaps in when they are complete. The
+/// statistics are the sum of the base counters in use and of the delta
+/// counters, so the lease changes made during a rebuild are not lost.
+class LeaseStatSource {
+public:
+
+    /// @brief State of the counter table.
+    typedef enum {
+        /// The counters have never been built.
+        COUNTERS_ABSENT,
+        /// The counters are being rebuilt.
+        COUNTERS_REBUILDING,
+        /// The counters are up to date.
+        COUNTERS_READY
+    } CounterStatus;
+
+    /// @brief Destructor.
+    virtual ~LeaseStatSource() = default;
+
+    /// @brief Returns the state of the counter table.
+    virtual CounterStatus getCounterStatus() = 0;
+
+    /// @brief Marks the absent counters as being rebuilt.
+    ///
+    /// The rebuild gets a fresh generation of base counters.
+    ///
+    /// @return true if the caller is to rebuild the counters, false if
+    /// another server has claimed the rebuild in the meantime.
+    virtual bool claimCounterRebuild() = 0;
+
+    /// @brief Marks the counters as absent again after a failed rebuild.
+    ///
+    /// The base counters of the claimed generation are dropped.
+    virtual void abortCounterRebuild() = 0;
+
+    /// @brief Swaps the base counters of the claimed generation in and
+    /// marks the counters as up to date.
+    virtual void setCountersReady() = 0;
+
+    /// @brief Reads all counters.
+    ///
+    /// Called after @ref getCounterStatus has returned COUNTERS_READY.
+    ///
+    /// @param counts Counts to add the base counters in use and the delta
+    /// counters to.
+    virtual void readCounters(LeaseStatCounts& counts) = 0;
+
+    /// @brief Reads the delta counters.
+    ///
+    /// @param counts Counts to add the delta counters to.
+    virtual void readDeltaCounters(LeaseStatCounts& counts) = 0;
+
+    /// @brief Adds values to the base counters of the claimed generation.
+    ///
+    /// @param values Values to add, by counter.
+    virtual void addToBaseCounters(const LeaseStatCounts& values) = 0;
+
+    /// @brief Counts the leases stored in a token range.
+    ///
+    /// Called concurrently for different ranges.
+    ///
+    /// @param range Token range.
+    /// @param counts Counts to add the leases to.
+    virtual void scanTokenRange(const TokenRange& range,
+                                LeaseStatCounts& counts) = 0;
+};
+
+/// @brief Collects the lease statistics of all subnets.
+///
+/// When the counters are enabled and up to date, they are returned as
+/// they are. Otherwise the leases are counted by scanning the token ring,
+/// split in ranges queried by a number of threads. When the counters are
+/// enabled but absent, the first server to notice claims the rebuild,
+/// scans the ring and brings the counters in line with the scan.
+///
+/// The rebuild reads the delta counters, scans the ring and writes the
+/// difference in a fresh generation of base counters. The lease changes
+/// made meanwhile keep adding to the delta counters and are counted once
+/// the generation is swapped in. A lease changed during the scan, before
+/// its range was scanned, is counted twice, so a rebuild is still best
+/// done when the servers are idle.
+class LeaseStatCollector {
+public:
+
+    /// @brief How the statistics have been collected.
+    typedef enum {
+        /// Not collected yet.
+        NONE,
+        /// Read from the counters.
+        COUNTERS,
+        /// Scanned, and the counters were rebuilt.
+        REBUILD,
+        /// Scanned.
+        SCAN
+    } Method;
+
+    /// @brief Constructor.
+    ///
+    /// @param source Database queries.
+    /// @param use_counters Whether the counters are enabled.
+    /// @param thread_count Number of threads scanning the ring, the
+    /// calling thread being one of them.
+    /// @param range_count Number of token ranges to scan.
+    LeaseStatCollector(LeaseStatSource& source, const bool use_counters,
+                       const size_t thread_count, const size_t range_count);
+
+    /// @brief Collects the statistics.
+    ///
+    /// A rebuild that fails is given up, so another server can claim it.
+    ///
+    /// @return Lease counts of all subnets.
+    LeaseStatCounts collect();
+
+    /// @brief Returns how the last statistics have been collected.
+    Method getMethod() const {
+        return (method_);
+    }
+
+private:
+
+    /// @brief Counts the leases of all token ranges.
+    ///
+    /// The first error stops the remaining ranges and is rethrown.
+    ///
+    /// @return Lease counts.
+    LeaseStatCounts scan();
+
+    /// @brief Brings the counters in line with a scan.
+    ///
+    /// @param scanned Lease counts from the scan.
+    /// @param deltas Delta counters read before the scan.
+    void rebuild(const LeaseStatCounts& scanned, const LeaseStatCounts& deltas);
+
+    /// @brief Database queries.
+    LeaseStatSource& source_;
+
+    /// @brief Whether the counters are enabled.
+    bool use_counters_;
+
+    /// @brief Number of threads scanning the ring.
+    size_t thread_count_;
+
+    /// @brief Number of token ranges.
+    size_t range_count_;
+
+    /// @brief How the last statistics have been collected.
+    Method method_;
+};
+
+}  // namespace dhcp
+}  // namespace isc
+
+#endif  // LEASE_STAT_COLLECTOR_H
@@ -23,6 +23,7 @@
 #include <iostream>
 #include <limits>
 #include <sstream>
+#include <type_traits>
 
 namespace {
 
@@ -86,10 +87,17 @@ public:
     /// @param run_once_now A flag that causes LFC to be invoked immediately,
     /// regardless of the value of lfc_interval.  This is primarily used to
     /// cause lease file schema upgrades upon startup.
+    /// @param lfc_threads Number of threads of the streaming cleanup, 0
+    /// for the number of processors. A negative value selects the cleanup
+    /// loading all leases in memory.
+    /// @param lfc_snapshot A flag that causes LFC to write the lease
+    /// snapshot along with the cleaned up lease file.
     void setup(const uint32_t lfc_interval,
                const std::shared_ptr<CSVLeaseFile4>& lease_file4,
                const std::shared_ptr<CSVLeaseFile6>& lease_file6,
-               bool run_once_now = false);
+               bool run_once_now = false,
+               const int lfc_threads = -1,
+               const bool lfc_snapshot = false);
 
     /// @brief Spawns a new process.
     void execute();
@@ -153,7 +161,9 @@ void
 LFCSetup::setup(const uint32_t lfc_interval,
                 const std::shared_ptr<CSVLeaseFile4>& lease_file4,
                 const std::shared_ptr<CSVLeaseFile6>& lease_file6,
-                bool run_once_now) {
+                bool run_once_now,
+                const int lfc_threads,
+                const bool lfc_snapshot) {
 
     // If to nothing to do, punt
     if (lfc_interval == 0 && !run_once_now) {
@@ -203,6 +213,19 @@ LFCSetup::setup(const uint32_t lfc_interval,
     args.push_back("-c");
     args.push_back("ignored-path");
 
+    // Streaming cleanup.
+    if (lfc_threads >= 0) {
+        args.push_back("-j");
+        args.push_back(boost::lexical_cast<std::string>(lfc_threads));
+    }
+
+    // Lease snapshot.
+    if (lfc_snapshot) {
+        args.push_back("-s");
+        args.push_back(Memfile_LeaseMgr::appendSuffix(lease_file,
+                                                      Memfile_LeaseMgr::FILE_SNAPSHOT));
+    }
+
     // Create the process (do not start it yet).
     process_.reset(new util::ProcessSpawn(executable, args));
 
@@ -630,7 +653,8 @@ const int Memfile_LeaseMgr::MAJOR_VERSION;
 const int Memfile_LeaseMgr::MINOR_VERSION;
 
 Memfile_LeaseMgr::Memfile_LeaseMgr(const DatabaseConnection::ParameterMap& parameters)
-    : LeaseMgr(), lfc_setup_(), conn_(parameters), mutex_() {
+    : LeaseMgr(), lfc_setup_(), wait_for_durability_(false), conn_(parameters),
+      mutex_() {
     bool conversion_needed = false;
 
     // Check the universe and use v4 file or v6 file.
@@ -665,6 +689,7 @@ Memfile_LeaseMgr::Memfile_LeaseMgr(const DatabaseConnection::ParameterMap& param
                     .arg(MAJOR_VERSION).arg(MINOR_VERSION);
         }
         lfcSetup(conversion_needed);
+        groupCommitSetup();
     }
 
     mutex_.reset(new std::mutex);
@@ -712,12 +737,15 @@ Memfile_LeaseMgr::addLease(const Lease4Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_ADD_ADDR4).arg(lease->addr_.toText());
 
+    bool result;
     if (MultiThreadingMgr::instance().getMode()) {
         std::lock_guard<std::mutex> lock(*mutex_);
-        return (addLeaseInternal(lease));
+        result = addLeaseInternal(lease);
     } else {
-        return (addLeaseInternal(lease));
+        result = addLeaseInternal(lease);
     }
+    waitForDurability();
+    return (result);
 }
 
 bool
@@ -743,12 +771,15 @@ Memfile_LeaseMgr::addLease(const Lease6Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_ADD_ADDR6).arg(lease->addr_.toText());
 
+    bool result;
     if (MultiThreadingMgr::instance().getMode()) {
         std::lock_guard<std::mutex> lock(*mutex_);
-        return (addLeaseInternal(lease));
+        result = addLeaseInternal(lease);
     } else {
-        return (addLeaseInternal(lease));
+        result = addLeaseInternal(lease);
     }
+    waitForDurability();
+    return (result);
 }
 
 Lease4Ptr
@@ -1346,10 +1377,12 @@ Memfile_LeaseMgr::getExpiredLeases4Internal(Lease4Collection& expired_leases,
         index.upper_bound(boost::make_tuple(false, time(NULL)));
 
     // Copy only the number of leases indicated by the max_leases parameter.
+    // The copies are counted: the distance between two iterators of the
+    // ordered index is linear.
+    size_t count = 0;
     for (Lease4StorageExpirationIndex::const_iterator lease = index.begin();
-         (lease != ub) && ((max_leases == 0) || (std::distance(index.begin(), lease) <
-                                                 max_leases));
-         ++lease) {
+         (lease != ub) && ((max_leases == 0) || (count < max_leases));
+         ++lease, ++count) {
         expired_leases.push_back(Lease4Ptr(new Lease4(**lease)));
     }
 }
@@ -1382,10 +1415,12 @@ Memfile_LeaseMgr::getExpiredLeases6Internal(Lease6Collection& expired_leases,
         index.upper_bound(boost::make_tuple(false, time(NULL)));
 
     // Copy only the number of leases indicated by the max_leases parameter.
+    // The copies are counted: the distance between two iterators of the
+    // ordered index is linear.
+    size_t count = 0;
     for (Lease6StorageExpirationIndex::const_iterator lease = index.begin();
-         (lease != ub) && ((max_leases == 0) || (std::distance(index.begin(), lease) <
-                                                 max_leases));
-         ++lease) {
+         (lease != ub) && ((max_leases == 0) || (count < max_leases));
+         ++lease, ++count) {
         expired_leases.push_back(Lease6Ptr(new Lease6(**lease)));
     }
 }
@@ -1438,6 +1473,7 @@ Memfile_LeaseMgr::updateLease4(const Lease4Ptr& lease) {
     } else {
         updateLease4Internal(lease);
     }
+    waitForDurability();
 }
 
 void
@@ -1476,6 +1512,7 @@ Memfile_LeaseMgr::updateLease6(const Lease6Ptr& lease) {
     } else {
         updateLease6Internal(lease);
     }
+    waitForDurability();
 }
 
 bool
@@ -1505,12 +1542,15 @@ Memfile_LeaseMgr::deleteLease(const Lease4Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_DELETE_ADDR).arg(lease->addr_.toText());
 
+    bool result;
     if (MultiThreadingMgr::instance().getMode()) {
         std::lock_guard<std::mutex> lock(*mutex_);
-        return (deleteLeaseInternal(lease));
+        result = deleteLeaseInternal(lease);
     } else {
-        return (deleteLeaseInternal(lease));
+        result = deleteLeaseInternal(lease);
     }
+    waitForDurability();
+    return (result);
 }
 
 bool
@@ -1540,12 +1580,15 @@ Memfile_LeaseMgr::deleteLease(const Lease6Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_DELETE_ADDR).arg(lease->addr_.toText());
 
+    bool result;
     if (MultiThreadingMgr::instance().getMode()) {
         std::lock_guard<std::mutex> lock(*mutex_);
-        return (deleteLeaseInternal(lease));
+        result = deleteLeaseInternal(lease);
     } else {
-        return (deleteLeaseInternal(lease));
+        result = deleteLeaseInternal(lease);
     }
+    waitForDurability();
+    return (result);
 }
 
 uint64_t
@@ -1554,16 +1597,19 @@ Memfile_LeaseMgr::deleteExpiredReclaimedLeases4(const uint32_t secs) {
               DHCPSRV_MEMFILE_DELETE_EXPIRED_RECLAIMED4)
         .arg(secs);
 
+    uint64_t deleted;
     if (MultiThreadingMgr::instance().getMode()) {
         std::lock_guard<std::mutex> lock(*mutex_);
-        return (deleteExpiredReclaimedLeases<
-                Lease4StorageExpirationIndex, Lease4
-                >(secs, V4, storage4_, lease_file4_));
+        deleted = deleteExpiredReclaimedLeases<
+            Lease4StorageExpirationIndex, Lease4
+            >(secs, V4, storage4_, lease_file4_);
     } else {
-        return (deleteExpiredReclaimedLeases<
-                Lease4StorageExpirationIndex, Lease4
-                >(secs, V4, storage4_, lease_file4_));
+        deleted = deleteExpiredReclaimedLeases<
+            Lease4StorageExpirationIndex, Lease4
+            >(secs, V4, storage4_, lease_file4_);
     }
+    waitForDurability();
+    return (deleted);
 }
 
 uint64_t
@@ -1572,16 +1618,19 @@ Memfile_LeaseMgr::deleteExpiredReclaimedLeases6(const uint32_t secs) {
               DHCPSRV_MEMFILE_DELETE_EXPIRED_RECLAIMED6)
         .arg(secs);
 
+    uint64_t deleted;
     if (MultiThreadingMgr::instance().getMode()) {
         std::lock_guard<std::mutex> lock(*mutex_);
-        return (deleteExpiredReclaimedLeases<
-                Lease6StorageExpirationIndex, Lease6
-                >(secs, V6, storage6_, lease_file6_));
+        deleted = deleteExpiredReclaimedLeases<
+            Lease6StorageExpirationIndex, Lease6
+            >(secs, V6, storage6_, lease_file6_);
     } else {
-        return (deleteExpiredReclaimedLeases<
-                Lease6StorageExpirationIndex, Lease6
-                >(secs, V6, storage6_, lease_file6_));
+        deleted = deleteExpiredReclaimedLeases<
+            Lease6StorageExpirationIndex, Lease6
+            >(secs, V6, storage6_, lease_file6_);
     }
+    waitForDurability();
+    return (deleted);
 }
 
 template<typename IndexType, typename LeaseType, typename StorageType,
@@ -1683,6 +1732,9 @@ Memfile_LeaseMgr::appendSuffix(const std::string& file_name,
     case FILE_PID:
         name += ".pid";
         break;
+    case FILE_SNAPSHOT:
+        name += ".snapshot";
+        break;
     default:
         // Do not append any suffix for the FILE_CURRENT.
         ;
@@ -1783,18 +1835,32 @@ bool Memfile_LeaseMgr::loadLeasesFromFiles(const std::string& filename,
                   << max_row_errors_str << " specified");
     }
 
+    // The lease snapshot written by the LFC is used in place of the
+    // leasefile.completed or leasefile.2, depending on which one it was
+    // created from.
+    const bool use_snapshot = useLeaseSnapshot();
+
     // Load the leasefile.completed, if exists.
     bool conversion_needed = false;
     lease_file.reset(new LeaseFileType(std::string(filename + ".completed")));
     if (lease_file->exists()) {
-        LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
-                                               max_row_errors);
-        conversion_needed = conversion_needed || lease_file->needsConversion();
+        if (!use_snapshot ||
+            !loadLeasesFromSnapshot<LeaseObjectType>(filename,
+                                                     lease_file->getFilename(),
+                                                     storage)) {
+            LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
+                                                   max_row_errors);
+            conversion_needed = conversion_needed || lease_file->needsConversion();
+        }
     } else {
         // If the leasefile.completed doesn't exist, let's load the leases
         // from leasefile.2 and leasefile.1, if they exist.
         lease_file.reset(new LeaseFileType(appendSuffix(filename, FILE_PREVIOUS)));
-        if (lease_file->exists()) {
+        if (lease_file->exists() &&
+            (!use_snapshot ||
+             !loadLeasesFromSnapshot<LeaseObjectType>(filename,
+                                                      lease_file->getFilename(),
+                                                      storage))) {
             LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
                                                    max_row_errors);
             conversion_needed =  conversion_needed || lease_file->needsConversion();
@@ -1822,6 +1888,46 @@ bool Memfile_LeaseMgr::loadLeasesFromFiles(const std::string& filename,
     return (conversion_needed);
 }
 
+template<typename LeaseObjectType, typename StorageType>
+bool Memfile_LeaseMgr::loadLeasesFromSnapshot(const std::string& filename,
+                                              const std::string& source,
+                                              StorageType& storage) {
+    LeaseSnapshotFile snapshot(appendSuffix(filename, FILE_SNAPSHOT));
+    if (!snapshot.exists()) {
+        return (false);
+    }
+    try {
+        snapshot.open(std::is_same<LeaseObjectType, Lease4>::value ? 4 : 6,
+                      source);
+        LeaseFileLoader::loadSnapshot<LeaseObjectType>(snapshot, storage);
+    } catch (const std::exception& ex) {
+        LOG_WARN(dhcpsrv_logger, DHCPSRV_MEMFILE_LEASE_SNAPSHOT_IGNORED)
+            .arg(snapshot.getFilename())
+            .arg(source)
+            .arg(ex.what());
+        // The snapshot is only used for the first lease file loaded.
+        storage.clear();
+        return (false);
+    }
+    return (true);
+}
+
+bool
+Memfile_LeaseMgr::useLeaseSnapshot() const {
+    std::string lfc_snapshot_str = "false";
+    try {
+        lfc_snapshot_str = conn_.getParameter("lfc-snapshot");
+    } catch (const std::exception&) {
+        // Ignore and default to false.
+    }
+    if (lfc_snapshot_str == "true") {
+        return (true);
+    } else if (lfc_snapshot_str != "false") {
+        isc_throw(isc::BadValue, "invalid value of the lfc-snapshot "
+                  << lfc_snapshot_str << " specified");
+    }
+    return (false);
+}
 
 bool
 Memfile_LeaseMgr::isLFCRunning() const {
@@ -1864,9 +1970,99 @@ Memfile_LeaseMgr::lfcSetup(bool conversion_needed) {
                   << lfc_interval_str << " specified");
     }
 
+    std::string lfc_threads_str;
+    try {
+        lfc_threads_str = conn_.getParameter("lfc-threads");
+    } catch (const std::exception&) {
+        // Ignore and use the cleanup loading all leases in memory.
+    }
+
+    int lfc_threads = -1;
+    if (!lfc_threads_str.empty()) {
+        try {
+            lfc_threads = boost::lexical_cast<uint16_t>(lfc_threads_str);
+        } catch (const boost::bad_lexical_cast&) {
+            isc_throw(isc::BadValue, "invalid value of the lfc-threads "
+                      << lfc_threads_str << " specified");
+        }
+    }
+
     if (lfc_interval > 0 || conversion_needed) {
         lfc_setup_.reset(new LFCSetup(std::bind(&Memfile_LeaseMgr::lfcCallback, this)));
-        lfc_setup_->setup(lfc_interval, lease_file4_, lease_file6_, conversion_needed);
+        lfc_setup_->setup(lfc_interval, lease_file4_, lease_file6_, conversion_needed,
+                          lfc_threads, useLeaseSnapshot());
+    }
+}
+
+void
+Memfile_LeaseMgr::groupCommitSetup() {
+    std::string group_commit_str = "false";
+    try {
+        group_commit_str = conn_.getParameter("group-commit");
+    } catch (const std::exception&) {
+        // Ignore and default to false.
+    }
+    if (group_commit_str == "false") {
+        return;
+    } else if (group_commit_str != "true") {
+        isc_throw(isc::BadValue, "invalid value of the group-commit "
+                  << group_commit_str << " specified");
+    }
+
+    std::string policy_str = "none";
+    try {
+        policy_str = conn_.getParameter("fsync-policy");
+    } catch (const std::exception&) {
+        // Ignore and default to none.
+    }
+    GroupCommitWriter::SyncPolicy policy =
+        GroupCommitWriter::syncPolicyFromText(policy_str);
+
+    std::string interval_str = "1000";
+    try {
+        interval_str = conn_.getParameter("fsync-interval");
+    } catch (const std::exception&) {
+        // Ignore and default to 1000.
+    }
+    uint32_t interval = 0;
+    try {
+        interval = boost::lexical_cast<uint32_t>(interval_str);
+    } catch (const boost::bad_lexical_cast&) {
+        isc_throw(isc::BadValue, "invalid value of the fsync-interval "
+                  << interval_str << " specified");
+    }
+
+    std::string wait_str = "false";
+    try {
+        wait_str = conn_.getParameter("wait-for-durability");
+    } catch (const std::exception&) {
+        // Ignore and default to false.
+    }
+    if ((wait_str != "true") && (wait_str != "false")) {
+        isc_throw(isc::BadValue, "invalid value of the wait-for-durability "
+                  << wait_str << " specified");
+    }
+    wait_for_durability_ = (wait_str == "true");
+
+    if (lease_file4_) {
+        lease_file4_->setGroupCommit(true, policy,
+                                     std::chrono::milliseconds(interval));
+    }
+    if (lease_file6_) {
+        lease_file6_->setGroupCommit(true, policy,
+                                     std::chrono::milliseconds(interval));
+    }
+
+    LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_GROUP_COMMIT)
+        .arg(GroupCommitWriter::syncPolicyToText(policy))
+        .arg(interval)
+        .arg(wait_for_durability_ ? "true" : "false");
+}
+
+void
+Memfile_LeaseMgr::waitForDurability() const {
+    if (wait_for_durability_) {
+        CSVFile::waitForAppends();
     }
 }
 
@@ -808,7 +808,8 @@ public:
         FILE_PREVIOUS, ///< Previous %Lease File
         FILE_OUTPUT,   ///< LFC Output File
         FILE_FINISH,   ///< LFC Finish File
-        FILE_PID       ///< PID File
+        FILE_PID,      ///< PID File
+        FILE_SNAPSHOT  ///< LFC %Lease Snapshot
     };
 
     /// @brief Appends appropriate suffix to the file name.
@@ -948,6 +949,38 @@ private:
                              std::shared_ptr<LeaseFileType>& lease_file,
                              StorageType& storage);
 
+    /// @brief Load leases from the lease snapshot written by the LFC.
+    ///
+    /// The snapshot <filename>.snapshot is used in place of the given
+    /// lease file when it has been created from this file, i.e. when the
+    /// file hasn't been modified since the LFC wrote both. If the snapshot
+    /// doesn't exist it is silently ignored. If it can't be used, a warning
+    /// is logged and the storage is cleared, so the caller can load the
+    /// lease file instead.
+    ///
+    /// @param filename Name of the lease file.
+    /// @param source Name of the <filename>.completed or <filename>.2
+    /// file the snapshot is used in place of.
+    /// @param storage An empty storage for the leases.
+    /// @tparam LeaseObjectType @c Lease4 or @c Lease6.
+    /// @tparam StorageType @c Lease4Storage or @c Lease6Storage.
+    ///
+    /// @return true if the leases have been loaded from the snapshot.
+    template<typename LeaseObjectType, typename StorageType>
+    bool loadLeasesFromSnapshot(const std::string& filename,
+                                const std::string& source,
+                                StorageType& storage);
+
+    /// @brief Checks if the lease snapshot is enabled.
+    ///
+    /// The lease snapshot is enabled by the @c lfc-snapshot configuration
+    /// parameter. When enabled, the LFC writes a binary snapshot of the
+    /// cleaned up leases which the server loads at startup.
+    ///
+    /// @return true if the @c lfc-snapshot parameter is set to true.
+    /// @throw BadValue if the parameter has an invalid value.
+    bool useLeaseSnapshot() const;
+
     /// @brief stores IPv4 leases
     Lease4Storage storage4_;
 
@@ -1084,6 +1117,29 @@ private:
     /// run_once_now parameter.
     void lfcSetup(bool conversion_needed = false);
 
+    /// @brief Configures group commit of the lease file.
+    ///
+    /// This method checks the @c group-commit configuration parameter and,
+    /// if it is set to true, enables asynchronous group commit of the lease
+    /// file updates: the rows are rendered by the packet processing threads
+    /// and written in batches by a dedicated writer thread. The
+    /// @c fsync-policy parameter (one of "none", "batch" or "interval") and
+    /// @c fsync-interval parameter (in milliseconds) control syncing of the
+    /// lease file to disk. If the @c wait-for-durability parameter is set
+    /// to true, the lease changes are acknowledged only when the lease
+    /// update has been written (and synced, unless the policy is "none").
+    ///
+    /// @throw BadValue if a parameter has an invalid value.
+    void groupCommitSetup();
+
+    /// @brief Waits for the lease file updates made by the calling thread
+    /// if the @c wait-for-durability parameter is set.
+    ///
+    /// It is called by the functions modifying leases after the manager
+    /// mutex is released, so as the updates made by concurrent threads are
+    /// written together.
+    void waitForDurability() const;
+
     /// @brief Performs a lease file cleanup for DHCPv4 or DHCPv6.
     ///
     /// This method performs all the actions necessary to prepare for the
@@ -1112,6 +1168,10 @@ private:
     /// @brief A pointer to the Lease File Cleanup configuration.
     std::unique_ptr<LFCSetup> lfc_setup_;
 
+    /// @brief Indicates if lease changes wait for the lease file updates
+    /// to be written by the group commit writer.
+    bool wait_for_durability_;
+
     /// @brief Parameters storage
     ///
     /// DatabaseConnection object is used only for storing, accessing and
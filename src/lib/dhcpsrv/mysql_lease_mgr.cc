@@ -97,6 +97,9 @@ const size_t ADDRESS6_TEXT_MAX_LEN = 39;
 /// @brief Maximum length of user context.
 const size_t USER_CONTEXT_MAX_LEN = 8192;
 
+/// @brief Maximum number of leases inserted by a single statement.
+const size_t MAX_BULK_INSERT_ROWS = 100;
+
 boost::array<TaggedStatement, MySqlLeaseMgr::NUM_STATEMENTS>
 tagged_statements = { {
     {MySqlLeaseMgr::DELETE_LEASE4,
@@ -2119,6 +2122,12 @@ MySqlLeaseContext::MySqlLeaseContext(const DatabaseConnection::ParameterMap& par
     : conn_(parameters) {
 }
 
+MySqlLeaseContext::~MySqlLeaseContext() {
+    for (auto const& statement : bulk_statements_) {
+        mysql_stmt_close(statement.second);
+    }
+}
+
 // MySqlLeaseContextAlloc Constructor and Destructor
 
 MySqlLeaseMgr::MySqlLeaseContextAlloc::MySqlLeaseContextAlloc(
@@ -2281,6 +2290,126 @@ MySqlLeaseMgr::addLease(const Lease6Ptr& lease) {
     return (result);
 }
 
+template<typename Exchange, typename LeaseCollection>
+size_t
+MySqlLeaseMgr::addLeasesCommon(MySqlLeaseContextPtr& ctx,
+                               StatementIndex stindex,
+                               std::unique_ptr<Exchange>& exchange,
+                               const LeaseCollection& leases) {
+    // The multi-row statement repeats the VALUES part of the single row
+    // INSERT statement.
+    const std::string& text = tagged_statements[stindex].text;
+    const std::string values("VALUES ");
+    const std::string row = text.substr(text.find(values) + values.size());
+
+    size_t added = 0;
+    for (size_t first = 0; first < leases.size(); first += MAX_BULK_INSERT_ROWS) {
+        const size_t count = std::min(MAX_BULK_INSERT_ROWS, leases.size() - first);
+
+        // The bound values point to the exchange buffers, so each lease
+        // needs its own exchange.
+        std::vector<std::unique_ptr<Exchange> > exchanges;
+        std::vector<MYSQL_BIND> bind;
+        for (size_t i = 0; i < count; ++i) {
+            exchanges.emplace_back(new Exchange());
+            std::vector<MYSQL_BIND> row_bind =
+                exchanges.back()->createBindForSend(leases[first + i]);
+            bind.insert(bind.end(), row_bind.begin(), row_bind.end());
+        }
+
+        // Only the last chunk may have another size, so the statements
+        // are prepared once and reused by the next calls.
+        const std::pair<int, size_t> key(stindex, count);
+        auto cached = ctx->bulk_statements_.find(key);
+        if (cached == ctx->bulk_statements_.end()) {
+            std::string statement_text = text;
+            for (size_t i = 1; i < count; ++i) {
+                statement_text += ", " + row;
+            }
+
+            MYSQL_STMT* statement = mysql_stmt_init(ctx->conn_.mysql_);
+            if (!statement) {
+                isc_throw(DbOperationError, "unable to allocate MySQL prepared "
+                          "statement structure, reason: " << mysql_error(ctx->conn_.mysql_));
+            }
+            if (mysql_stmt_prepare(statement, statement_text.c_str(),
+                                   statement_text.length()) != 0) {
+                std::string error = mysql_stmt_error(statement);
+                mysql_stmt_close(statement);
+                isc_throw(DbOperationError, "unable to prepare bulk insert of "
+                          << count << " leases, reason: " << error);
+            }
+            cached = ctx->bulk_statements_.insert(std::make_pair(key, statement)).first;
+        }
+        MYSQL_STMT* statement = cached->second;
+
+        int status = mysql_stmt_bind_param(statement, &bind[0]);
+        if (status == 0) {
+            status = MysqlExecuteStatement(statement);
+        }
+
+        bool duplicate = false;
+        if (status != 0) {
+            duplicate = (mysql_stmt_errno(statement) == ER_DUP_ENTRY);
+            if (!duplicate) {
+                // Do not keep a statement which may be unusable, e.g.
+                // after the connection has been lost.
+                std::string error = mysql_stmt_error(statement);
+                mysql_stmt_close(statement);
+                ctx->bulk_statements_.erase(cached);
+                isc_throw(DbOperationError, "unable to execute bulk insert of "
+                          << count << " leases, reason: " << error);
+            }
+        }
+
+        if (duplicate) {
+            // The whole statement has been rejected. Insert the leases of
+            // this chunk one by one to skip the existing ones.
+            for (size_t i = first; i < first + count; ++i) {
+                std::vector<MYSQL_BIND> row_bind = exchange->createBindForSend(leases[i]);
+                if (addLeaseCommon(ctx, stindex, row_bind)) {
+                    leases[i]->old_cltt_ = leases[i]->cltt_;
+                    leases[i]->old_valid_lft_ = leases[i]->valid_lft_;
+                    ++added;
+                }
+            }
+            continue;
+        }
+
+        for (size_t i = first; i < first + count; ++i) {
+            leases[i]->old_cltt_ = leases[i]->cltt_;
+            leases[i]->old_valid_lft_ = leases[i]->valid_lft_;
+        }
+        added += count;
+    }
+
+    return (added);
+}
+
+size_t
+MySqlLeaseMgr::addLeases(const Lease4Collection& leases) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_ADD_LEASES4)
+        .arg(leases.size());
+
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*this);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
+    return (addLeasesCommon(ctx, INSERT_LEASE4, ctx->exchange4_, leases));
+}
+
+size_t
+MySqlLeaseMgr::addLeases(const Lease6Collection& leases) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_ADD_LEASES6)
+        .arg(leases.size());
+
+    // Get a context
+    MySqlLeaseContextAlloc get_context(*this);
+    MySqlLeaseContextPtr ctx = get_context.ctx_;
+
+    return (addLeasesCommon(ctx, INSERT_LEASE6, ctx->exchange6_, leases));
+}
+
 // Extraction of leases from the database.
 //
 // All getLease() methods ultimately call getLeaseCollection().  This
@@ -15,8 +15,10 @@
 #include <mysql.h>
 
 #include <time.h>
+#include <map>
 #include <vector>
 #include <mutex>
+#include <utility>
 
 namespace isc {
 namespace dhcp {
@@ -43,6 +45,11 @@ public:
     /// @param parameters See MySqlLeaseMgr constructor.
     MySqlLeaseContext(const db::DatabaseConnection::ParameterMap& parameters);
 
+    /// @brief Destructor
+    ///
+    /// Closes the cached multi-row INSERT statements.
+    ~MySqlLeaseContext();
+
     /// The exchange objects are used for transfer of data to/from the database.
     /// They are pointed-to objects as the contents may change in "const" calls,
     /// while the rest of this object does not.  (At alternative would be to
@@ -50,6 +57,13 @@ public:
     std::unique_ptr<MySqlLease4Exchange> exchange4_; ///< Exchange object
     std::unique_ptr<MySqlLease6Exchange> exchange6_; ///< Exchange object
 
+    /// @brief Multi-row INSERT statements prepared by addLeases.
+    ///
+    /// The statements are indexed by the index of the single row INSERT
+    /// statement they are built from and by their number of rows, so each
+    /// chunk size is prepared once per context.
+    std::map<std::pair<int, size_t>, MYSQL_STMT*> bulk_statements_;
+
     /// @brief MySQL connection
     db::MySqlConnection conn_;
 };
@@ -143,6 +157,34 @@ public:
     ///        failed.
     virtual bool addLease(const Lease6Ptr& lease);
 
+    /// @brief Adds a collection of IPv4 leases
+    ///
+    /// The leases are inserted using multi-row INSERT statements. If any
+    /// of the leases in a statement already exists, the leases of this
+    /// statement are inserted one by one.
+    ///
+    /// @param leases leases to be added
+    ///
+    /// @return number of added leases
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual size_t addLeases(const Lease4Collection& leases);
+
+    /// @brief Adds a collection of IPv6 leases
+    ///
+    /// The leases are inserted using multi-row INSERT statements. If any
+    /// of the leases in a statement already exists, the leases of this
+    /// statement are inserted one by one.
+    ///
+    /// @param leases leases to be added
+    ///
+    /// @return number of added leases
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual size_t addLeases(const Lease6Collection& leases);
+
     /// @brief Returns an IPv4 lease for specified IPv4 address
     ///
     /// This method return a lease that is associated with a given address.
@@ -715,6 +757,30 @@ private:
     bool addLeaseCommon(MySqlLeaseContextPtr& ctx,
                         StatementIndex stindex, std::vector<MYSQL_BIND>& bind);
 
+    /// @brief Add Leases Common Code
+    ///
+    /// This method performs the common actions for both flavours (V4 and V6)
+    /// of the addLeases method. It inserts the leases in chunks using
+    /// multi-row variants of the INSERT statement.
+    ///
+    /// @param ctx Context
+    /// @param stindex Index of the single row INSERT statement
+    /// @param exchange Exchange used to insert the leases one by one
+    /// @param leases leases to be added
+    ///
+    /// @tparam Exchange Type of the exchange, i.e. MySqlLease4Exchange or
+    ///         MySqlLease6Exchange.
+    /// @tparam LeaseCollection Type of the lease collection.
+    ///
+    /// @return number of added leases
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    template<typename Exchange, typename LeaseCollection>
+    size_t addLeasesCommon(MySqlLeaseContextPtr& ctx, StatementIndex stindex,
+                           std::unique_ptr<Exchange>& exchange,
+                           const LeaseCollection& leases);
+
     /// @brief Get Lease Collection Common Code
     ///
     /// This method performs the common actions for obtaining multiple leases
@@ -24,11 +24,17 @@
 #include <database/db_exceptions.h>
 #include <mysql/mysql_connection.h>
 
+#include <algorithm>
+#include <memory>
+
 namespace isc {
 namespace dhcp {
 
 template <DhcpSpaceType D>
 struct MySqlSubnetMgr : public SubnetMgr<D> {
+    /// @brief Maximum number of subnets in the IN-list of a batch statement.
+    static constexpr size_t MAX_IN_LIST = 100u;
+
     explicit MySqlSubnetMgr(db::DatabaseConnection::ParameterMap const& parameters)
         : connection_(parameters) {
         // Open the database.
@@ -259,29 +265,7 @@ struct MySqlSubnetMgr : public SubnetMgr<D> {
 
     void update(SubnetInfoPtr<D>& subnet,
                 std::string const& /* config_timestamp_path */) override final {
-        uint32_t const index =
-            tagged_statements().at("UPDATE_SUBNET" + dhcpSpaceToString<D>() + "_ALL").index;
-        MYSQL_STMT* const& statement = connection_.statements_.at(index);
-
-        // Set up the WHERE clause values.
-        MySqlBind bind;
-        bindCommon(bind, subnet);
-        bindDelta(bind, subnet);
-        bind.add(&subnet->strings_.subnet_);
-
-        // Bind the input parameters to the statement.
-        int status = mysql_stmt_bind_param(statement, bind.data());
-        connection_.checkError(status, index, "unable to bind parameters");
-
-        // Execute the prepared statement.
-        status = mysql_stmt_execute(statement);
-        if (status != 0) {
-            connection_.checkError(status, index, "unable to execute");
-        }
-
-        // See how many rows were affected. Note that the statement may delete
-        // multiple rows.
-        auto affected_rows = mysql_stmt_affected_rows(statement);
+        auto affected_rows = executeUpdate(subnet);
 
         // Check success case first as it is the most likely outcome.
         if (affected_rows == 1) {
@@ -301,6 +285,93 @@ struct MySqlSubnetMgr : public SubnetMgr<D> {
                                             << "Mgr::update(): updated multiple, expected one");
     }
 
+    /// @brief the batch interface
+    ///
+    /// Selects and deletes are sent as one statement per @ref MAX_IN_LIST subnets. Updates
+    /// can't be grouped, they go row by row but report missing subnets through the returned
+    /// flags. Inserts keep the default implementation because a single duplicate would
+    /// reject a multi-row INSERT as a whole.
+    /// @{
+    SubnetInfoCollection<D> selectBySubnets(
+        std::vector<std::string>& subnets,
+        [[maybe_unused]] std::string const& config_timestamp_path = std::string()) override final {
+        uint32_t const index =
+            tagged_statements().at("SELECT_SUBNET" + dhcpSpaceToString<D>() + "_ALL").index;
+
+        SubnetInfoCollection<D> collection;
+        for (size_t first = 0; first < subnets.size(); first += MAX_IN_LIST) {
+            size_t const count(std::min(MAX_IN_LIST, subnets.size() - first));
+            StatementPtr const statement(prepareInList(
+                "SELECT subnet, " + columns() + " FROM subnet" + dhcpSpaceToString<D>(), count));
+
+            // Set up the WHERE clause values.
+            MySqlBind bind;
+            for (size_t i = 0; i < count; ++i) {
+                bind.add(&subnets[first + i]);
+            }
+
+            SubnetInfoCollection<D> const& records(selectCommon(index, statement.get(), bind));
+            collection.insert(collection.end(), records.begin(), records.end());
+        }
+        return collection;
+    }
+
+    void delBatch(SubnetInfoCollection<D>& subnets,
+                  std::string const& /* config_timestamp_path */) override final {
+        uint32_t const index =
+            tagged_statements().at("DELETE_SUBNET" + dhcpSpaceToString<D>() + "_ALL").index;
+
+        uint64_t deleted(0);
+        for (size_t first = 0; first < subnets.size(); first += MAX_IN_LIST) {
+            size_t const count(std::min(MAX_IN_LIST, subnets.size() - first));
+            StatementPtr const statement(
+                prepareInList("DELETE FROM subnet" + dhcpSpaceToString<D>(), count));
+
+            // Set up the WHERE clause values.
+            MySqlBind bind;
+            for (size_t i = 0; i < count; ++i) {
+                bind.add(&subnets[first + i]->strings_.subnet_);
+            }
+
+            // Bind the input parameters to the statement.
+            int status = mysql_stmt_bind_param(statement.get(), bind.data());
+            connection_.checkError(status, index, "unable to bind WHERE clause parameters");
+
+            // Execute the prepared statement.
+            status = mysql_stmt_execute(statement.get());
+            connection_.checkError(status, index, "unable to execute");
+
+            deleted += mysql_stmt_affected_rows(statement.get());
+        }
+
+        // The subnets which exist have all been deleted at this point.
+        if (deleted != subnets.size()) {
+            isc_throw(db::StatementNotApplied, "MySqlSubnet"
+                                                   << dhcpSpaceToString<D>()
+                                                   << "Mgr::delBatch(): deleted " << deleted
+                                                   << ", expected " << subnets.size());
+        }
+    }
+
+    std::vector<bool> updateBatch(SubnetInfoCollection<D>& subnets,
+                                  std::string const& /* config_timestamp_path */) override final {
+        std::vector<bool> applied;
+        applied.reserve(subnets.size());
+        for (SubnetInfoPtr<D>& subnet : subnets) {
+            auto affected_rows = executeUpdate(subnet);
+            if (affected_rows > 1) {
+                // Should not have happened, primary key constraint should only have filtered
+                // one row.
+                isc_throw(db::DbOperationError,
+                          "MySqlSubnet" << dhcpSpaceToString<D>()
+                                        << "Mgr::updateBatch(): updated multiple, expected one");
+            }
+            applied.push_back(affected_rows == 1);
+        }
+        return applied;
+    }
+    /// @}
+
     SubnetID maxSubnetID() override final {
         uint32_t const index =
             tagged_statements().at("SELECT_MAX_SUBNET_ID_" + dhcpSpaceToString<D>()).index;
@@ -485,6 +556,76 @@ struct MySqlSubnetMgr : public SubnetMgr<D> {
     }
 
 private:
+    /// @brief Type of the statements prepared for a single call.
+    using StatementPtr = std::unique_ptr<MYSQL_STMT, decltype(&mysql_stmt_close)>;
+
+    /// @brief Columns other than the subnet, as used in the universal statements.
+    static std::string columns() {
+        std::string columns;
+        for (std::string const& column : SubnetInfo<D>::columns()) {
+            if (column == "subnet") {
+                continue;
+            }
+            if (!columns.empty()) {
+                columns += ", ";
+            }
+            columns += column;
+        }
+        return columns;
+    }
+
+    /// @brief Prepares a statement filtering on an IN-list of subnets.
+    ///
+    /// @param text statement to which the WHERE clause is appended
+    /// @param count number of subnets in the IN-list
+    StatementPtr prepareInList(std::string text, size_t const count) {
+        text += " WHERE subnet IN (?";
+        for (size_t i = 1; i < count; ++i) {
+            text += ", ?";
+        }
+        text += ")";
+
+        StatementPtr statement(mysql_stmt_init(connection_.mysql_), &mysql_stmt_close);
+        if (!statement) {
+            isc_throw(db::DbOperationError, "unable to allocate MySQL prepared "
+                                            "statement structure, reason: "
+                                                << mysql_error(connection_.mysql_));
+        }
+        if (mysql_stmt_prepare(statement.get(), text.c_str(), text.length()) != 0) {
+            isc_throw(db::DbOperationError, "unable to prepare MySQL statement <"
+                                                << text << ">, reason: "
+                                                << mysql_error(connection_.mysql_));
+        }
+        return statement;
+    }
+
+    /// @brief Updates a subnet.
+    ///
+    /// @return the number of updated rows
+    my_ulonglong executeUpdate(SubnetInfoPtr<D>& subnet) {
+        uint32_t const index =
+            tagged_statements().at("UPDATE_SUBNET" + dhcpSpaceToString<D>() + "_ALL").index;
+        MYSQL_STMT* const& statement = connection_.statements_.at(index);
+
+        // Set up the WHERE clause values.
+        MySqlBind bind;
+        bindCommon(bind, subnet);
+        bindDelta(bind, subnet);
+        bind.add(&subnet->strings_.subnet_);
+
+        // Bind the input parameters to the statement.
+        int status = mysql_stmt_bind_param(statement, bind.data());
+        connection_.checkError(status, index, "unable to bind parameters");
+
+        // Execute the prepared statement.
+        status = mysql_stmt_execute(statement);
+        if (status != 0) {
+            connection_.checkError(status, index, "unable to execute");
+        }
+
+        return mysql_stmt_affected_rows(statement);
+    }
+
     inline void bindCommon(MySqlBind& bind, SubnetInfoPtr<D> const& subnet) {
         bind.add(&subnet->id_);
         bind.add(&subnet->timestamp_);
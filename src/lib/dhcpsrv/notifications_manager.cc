@@ -0,0 +1,282 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <dhcpsrv/dhcpsrv_log.h>
+#include <dhcpsrv/notifications_manager.h>
+#include <stats/stats_mgr.h>
+
+#include <algorithm>
+#include <map>
+
+using namespace isc::config;
+using namespace isc::data;
+using namespace isc::stats;
+
+namespace {
+
+/// @brief Senders shared by socket path, see @ref NotificationsSender::instance.
+struct Senders {
+    std::mutex mutex_;
+    std::map<std::string, isc::dhcp::NotificationsSenderPtr> senders_;
+    bool started_ = false;
+};
+
+Senders& sharedSenders() {
+    static Senders _;
+    return _;
+}
+
+}  // namespace
+
+namespace isc {
+namespace dhcp {
+
+NotificationsSender::NotificationsSender(std::string const& socket_path,
+                                         size_t const threads,
+                                         size_t const queue_capacity,
+                                         size_t const max_batch,
+                                         Transport const& transport)
+    : socket_path_(socket_path), queue_capacity_(queue_capacity),
+      max_batch_(std::max<size_t>(max_batch, 1)), transport_(transport), last_command_ID_(0),
+      stopping_(false), overflowing_(false), batching_(true), dropped_(0) {
+    for (size_t i = 0; i < std::max<size_t>(threads, 1); ++i) {
+        threads_.emplace_back(&NotificationsSender::run, this);
+    }
+}
+
+NotificationsSender::~NotificationsSender() {
+    join();
+}
+
+void NotificationsSender::start() {
+    Senders& senders(sharedSenders());
+    std::lock_guard<std::mutex> lock(senders.mutex_);
+    senders.started_ = true;
+}
+
+void NotificationsSender::stop() {
+    std::map<std::string, NotificationsSenderPtr> stopped;
+    {
+        Senders& senders(sharedSenders());
+        std::lock_guard<std::mutex> lock(senders.mutex_);
+        senders.started_ = false;
+        stopped.swap(senders.senders_);
+    }
+
+    // Joined outside the lock, the threads may take a while to finish sending.
+    for (auto const& [socket_path, sender] : stopped) {
+        sender->join();
+    }
+}
+
+NotificationsSenderPtr NotificationsSender::instance(std::string const& socket_path) {
+    Senders& senders(sharedSenders());
+    std::lock_guard<std::mutex> lock(senders.mutex_);
+    if (!senders.started_) {
+        return nullptr;
+    }
+    NotificationsSenderPtr& sender(senders.senders_[socket_path]);
+    if (!sender) {
+        sender = std::make_shared<NotificationsSender>(socket_path);
+    }
+    return sender;
+}
+
+NotificationsSender::timestamp_t NotificationsSender::enqueue(ElementPtr const& command) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (stopping_) {
+            return 0;
+        }
+        if (queue_.size() < queue_capacity_) {
+            timestamp_t const command_ID(++last_command_ID_);
+            queue_.push_back({command_ID, command});
+            pending_.insert(command_ID);
+            queue_cv_.notify_one();
+            return command_ID;
+        }
+
+        // Log once per overflow, not once per dropped notification.
+        if (!overflowing_) {
+            overflowing_ = true;
+            LOG_WARN(dhcpsrv_logger, DHCPSRV_NOTIFICATIONS_QUEUE_FULL)
+                .arg(socket_path_)
+                .arg(queue_capacity_);
+        }
+    }
+
+    ++dropped_;
+    StatsMgr::instance().addValue("notifications-dropped", static_cast<int64_t>(1));
+    return 0;
+}
+
+ElementPtr NotificationsSender::await(timestamp_t const command_ID) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    responses_cv_.wait(lock, [&] {
+        return responses_.count(command_ID) || !pending_.count(command_ID);
+    });
+    auto const& it(responses_.find(command_ID));
+    if (it == responses_.end()) {
+        return nullptr;
+    }
+    ElementPtr const response(it->second);
+    responses_.erase(it);
+    return response;
+}
+
+bool NotificationsSender::check(timestamp_t const command_ID) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return responses_.count(command_ID);
+}
+
+void NotificationsSender::forget(timestamp_t const command_ID) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.erase(command_ID);
+        responses_.erase(command_ID);
+    }
+    responses_cv_.notify_all();
+}
+
+void NotificationsSender::run() {
+    for (;;) {
+        std::vector<Queued> batch;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            queue_cv_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+            if (stopping_) {
+                return;
+            }
+            size_t const count(std::min(queue_.size(), max_batch_));
+            batch.reserve(count);
+            for (size_t i = 0; i < count; ++i) {
+                batch.push_back(std::move(queue_.front()));
+                queue_.pop_front();
+            }
+            overflowing_ = false;
+        }
+        send(batch);
+    }
+}
+
+void NotificationsSender::join() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+        queue_.clear();
+        pending_.clear();
+    }
+    queue_cv_.notify_all();
+    responses_cv_.notify_all();
+    for (std::thread& thread : threads_) {
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+}
+
+void NotificationsSender::send(std::vector<Queued> const& batch) {
+    if (batch.size() == 1 || !batching_) {
+        sendEach(batch);
+        return;
+    }
+
+    ElementPtr const& notifications(Element::createList());
+    for (Queued const& queued : batch) {
+        notifications->add(queued.command_);
+    }
+    ElementPtr const& arguments(Element::createMap());
+    arguments->set("notifications", notifications);
+    ElementPtr const& command(Element::createMap());
+    command->set(CONTROL_COMMAND, BATCH_COMMAND);
+    command->set(CONTROL_ARGUMENTS, arguments);
+
+    ElementPtr response;
+    try {
+        response = transport_(socket_path_, command);
+    } catch (std::exception const& exception) {
+        LOG_ERROR(dhcpsrv_logger, DHCPSRV_NOTIFICATIONS_SEND_FAILED)
+            .arg(batch.size())
+            .arg(socket_path_)
+            .arg(exception.what());
+        for (Queued const& queued : batch) {
+            respond(queued.command_ID_, nullptr);
+        }
+        return;
+    }
+
+    int rcode(CONTROL_RESULT_ERROR);
+    ElementPtr responses;
+    try {
+        responses = parseAnswer(rcode, response);
+    } catch (std::exception const&) {
+        // Malformed answer. Hand it over as it is.
+    }
+
+    if (rcode == CONTROL_RESULT_COMMAND_UNSUPPORTED) {
+        // The other end predates batching. Don't try again.
+        batching_ = false;
+        LOG_INFO(dhcpsrv_logger, DHCPSRV_NOTIFICATIONS_BATCHING_UNSUPPORTED).arg(socket_path_);
+        sendEach(batch);
+        return;
+    }
+
+    if (rcode == CONTROL_RESULT_SUCCESS && responses &&
+        responses->getType() == Element::list && responses->size() == batch.size()) {
+        for (size_t i = 0; i < batch.size(); ++i) {
+            respond(batch[i].command_ID_, responses->get(i));
+        }
+        return;
+    }
+
+    // The batch was answered as a whole.
+    for (Queued const& queued : batch) {
+        respond(queued.command_ID_, response);
+    }
+}
+
+void NotificationsSender::sendEach(std::vector<Queued> const& batch) {
+    for (Queued const& queued : batch) {
+        ElementPtr response;
+        try {
+            response = transport_(socket_path_, queued.command_);
+        } catch (std::exception const& exception) {
+            LOG_ERROR(dhcpsrv_logger, DHCPSRV_NOTIFICATIONS_SEND_FAILED)
+                .arg(1)
+                .arg(socket_path_)
+                .arg(exception.what());
+        }
+        respond(queued.command_ID_, response);
+    }
+}
+
+void NotificationsSender::respond(timestamp_t const command_ID, ElementPtr const& response) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!pending_.erase(command_ID)) {
+            // Nobody is waiting for it.
+            return;
+        }
+        responses_.insert_or_assign(command_ID, response);
+    }
+    responses_cv_.notify_all();
+}
+
+}  // namespace dhcp
+}  // namespace isc
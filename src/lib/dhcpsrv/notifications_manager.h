@@ -23,12 +23,163 @@
 #include <config/command_mgr.h>
 #include <database/timestamp_store.h>
 #include <dhcpsrv/cfgmgr.h>
-#include <util/dt_thread_pool.h>
-#include <util/functional.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace isc {
 namespace dhcp {
 
+/// @brief Delivers notifications to the netconf notifications socket.
+///
+/// Notifications are queued in a bounded queue and sent by a fixed number of
+/// sender threads, so the packet processing threads never create threads or
+/// open sockets. Each sender thread drains up to @c max_batch queued
+/// notifications and sends them in a single "notifications" command, which is
+/// one control channel connection for the whole batch. Notifications which
+/// don't fit in the queue are dropped and accounted for in the
+/// "notifications-dropped" statistic.
+///
+/// There is one sender per socket path, shared by all @c NotificationsManager
+/// instances, see @ref NotificationsSender::instance. The shared senders exist
+/// between @ref NotificationsSender::start and @ref NotificationsSender::stop,
+/// which the server controllers call when they start and shut down.
+struct NotificationsSender {
+    using timestamp_t = isc::db::timestamp_t;
+
+    /// @brief Function sending a command to a socket and returning the response.
+    using Transport =
+        std::function<isc::data::ElementPtr(std::string const&, isc::data::ElementPtr const&)>;
+
+    /// @brief Name of the command carrying a batch of notifications.
+    static constexpr char const* BATCH_COMMAND = "notifications";
+
+    /// @brief Default number of sender threads.
+    static constexpr size_t DEFAULT_THREADS = 1;
+
+    /// @brief Default maximum number of queued notifications.
+    static constexpr size_t DEFAULT_QUEUE_CAPACITY = 1024;
+
+    /// @brief Default maximum number of notifications sent in one command.
+    static constexpr size_t DEFAULT_MAX_BATCH = 64;
+
+    /// @brief Constructor. Starts the sender threads.
+    ///
+    /// @param socket_path path of the netconf notifications socket
+    /// @param threads number of sender threads, at least one is started
+    /// @param queue_capacity maximum number of queued notifications
+    /// @param max_batch maximum number of notifications sent in one command
+    /// @param transport function sending a command, @c CommandMgr::sendCommand
+    ///     by default
+    NotificationsSender(std::string const& socket_path,
+                        size_t threads = DEFAULT_THREADS,
+                        size_t queue_capacity = DEFAULT_QUEUE_CAPACITY,
+                        size_t max_batch = DEFAULT_MAX_BATCH,
+                        Transport const& transport = isc::config::CommandMgr::sendCommand);
+
+    /// @brief Destructor. Discards the queued notifications and joins the
+    /// sender threads.
+    ~NotificationsSender();
+
+    /// @brief Allows @ref instance to create the shared senders.
+    static void start();
+
+    /// @brief Stops the shared senders and forgets them.
+    ///
+    /// The queued notifications are discarded and the sender threads are
+    /// joined before returning, so nothing is sent afterwards even by senders
+    /// which are still referenced. @ref instance returns null until
+    /// @ref start is called again.
+    static void stop();
+
+    /// @brief Returns the sender shared by everyone notifying the given socket.
+    ///
+    /// @return the sender, null if the senders are not started
+    static std::shared_ptr<NotificationsSender> instance(std::string const& socket_path);
+
+    /// @brief Queues a command.
+    ///
+    /// @param command the notification command
+    ///
+    /// @return the ID of the command, 0 if the queue is full and the command
+    ///     was dropped or if the sender is stopped
+    timestamp_t enqueue(isc::data::ElementPtr const& command);
+
+    /// @brief Waits for the response of a queued command.
+    ///
+    /// @return the response, nullptr if the command could not be delivered or
+    ///     if the response was forgotten
+    isc::data::ElementPtr await(timestamp_t command_ID);
+
+    /// @brief Checks if the response of a queued command has arrived.
+    bool check(timestamp_t command_ID);
+
+    /// @brief Discards the response of a command, whether it arrived or not.
+    void forget(timestamp_t command_ID);
+
+    /// @brief Returns the number of notifications dropped because the queue
+    /// was full.
+    uint64_t getDroppedCount() const {
+        return dropped_;
+    }
+
+private:
+    struct Queued {
+        timestamp_t command_ID_;
+        isc::data::ElementPtr command_;
+    };
+
+    /// @brief Main loop of the sender threads.
+    void run();
+
+    /// @brief Discards the queued notifications and joins the sender threads.
+    /// Does nothing when called again.
+    void join();
+
+    /// @brief Sends a batch of commands and stores the responses.
+    void send(std::vector<Queued> const& batch);
+
+    /// @brief Sends a batch of commands one by one.
+    void sendEach(std::vector<Queued> const& batch);
+
+    /// @brief Stores a response if someone is still interested in it.
+    void respond(timestamp_t command_ID, isc::data::ElementPtr const& response);
+
+    std::string socket_path_;
+    size_t queue_capacity_;
+    size_t max_batch_;
+    Transport transport_;
+
+    std::deque<Queued> queue_;
+    std::unordered_set<timestamp_t> pending_;
+    std::unordered_map<timestamp_t, isc::data::ElementPtr> responses_;
+    timestamp_t last_command_ID_;
+    bool stopping_;
+
+    /// @brief Set while notifications are being dropped, so that the overflow
+    /// is logged only once.
+    bool overflowing_;
+    std::mutex mutex_;
+    std::condition_variable queue_cv_;
+    std::condition_variable responses_cv_;
+
+    /// @brief Cleared when the other end does not know the batch command.
+    std::atomic<bool> batching_;
+    std::atomic<uint64_t> dropped_;
+    std::vector<std::thread> threads_;
+};
+
+using NotificationsSenderPtr = std::shared_ptr<NotificationsSender>;
+
 struct NotificationsManager {
     using timestamp_t = isc::db::timestamp_t;
 
@@ -53,48 +204,55 @@ struct NotificationsManager {
         }
     }
 
+    /// @brief Destructor. Responses which were not awaited are discarded.
+    ~NotificationsManager() {
+        if (!sender_) {
+            return;
+        }
+        for (timestamp_t const command_ID : issued_) {
+            sender_->forget(command_ID);
+        }
+    }
+
     isc::data::ElementPtr await(timestamp_t const command_ID) {
-        if (command_ID == 0) {
+        if (command_ID == 0 || !sender_) {
             // Send failed.
             return nullptr;
         }
-        std::unique_lock<std::mutex> lock(mutex_);
-        if (!responses_.contains(command_ID)) {
-            cv_.wait(lock, [&] { return responses_.contains(command_ID); });
-        }
-        isc::data::ElementPtr const response(responses_.at(command_ID));
-        responses_.erase(command_ID);
-        return response;
+        issued_.erase(command_ID);
+        return sender_->await(command_ID);
     }
 
     bool check(timestamp_t const command_ID) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return responses_.contains(command_ID);
+        return sender_ && sender_->check(command_ID);
     }
 
     timestamp_t notify(std::string const& notification) {
         return notify(notification, "unused");
     }
 
+    /// @brief Queues a notification for sending.
+    ///
+    /// @return the ID to @ref await or @ref check on, 0 if there is no
+    ///     notifications socket, if the senders are not started or if the
+    ///     notification was dropped
     template <typename T>
     timestamp_t notify(std::string const& notification, T const& data) {
         if (socket_path_.empty()) {
             return 0;
         }
+        if (!sender_) {
+            sender_ = NotificationsSender::instance(socket_path_);
+            if (!sender_) {
+                // The senders are not started or have been stopped.
+                return 0;
+            }
+        }
 
-        // Send command asynchronously.
-        timestamp_t const command_ID(isc::db::TimestampStore::now());
-        std::thread(exceptionLoggedBind(PRETTY_METHOD_NAME(), [=, this] {
-            isc::data::ElementPtr const& command(isc::data::Element::createMap());
-            command->set(isc::config::CONTROL_COMMAND, notification);
-            command->set(isc::config::CONTROL_ARGUMENTS, data);
-            isc::data::ElementPtr const& response(
-                isc::config::CommandMgr::sendCommand(socket_path_, command));
-            std::lock_guard<std::mutex> lock(mutex_);
-            responses_.insert_or_assign(command_ID, response);
-            cv_.notify_all();
-        })).detach();
-
+        timestamp_t const command_ID(sender_->enqueue(createCommand(notification, data)));
+        if (command_ID) {
+            issued_.insert(command_ID);
+        }
         return command_ID;
     }
 
@@ -104,19 +262,23 @@ struct NotificationsManager {
 
     template <typename T>
     isc::data::ElementPtr notifySynchronous(std::string const& notification, T const& data) {
-        isc::data::ElementPtr const& command(isc::data::Element::createMap());
-        command->set(isc::config::CONTROL_COMMAND, notification);
-        command->set(isc::config::CONTROL_ARGUMENTS, data);
         isc::data::ElementPtr const& response(
-            isc::config::CommandMgr::sendCommand(socket_path_, command));
+            isc::config::CommandMgr::sendCommand(socket_path_, createCommand(notification, data)));
         return response;
     }
 
 private:
+    template <typename T>
+    static isc::data::ElementPtr createCommand(std::string const& notification, T const& data) {
+        isc::data::ElementPtr const& command(isc::data::Element::createMap());
+        command->set(isc::config::CONTROL_COMMAND, notification);
+        command->set(isc::config::CONTROL_ARGUMENTS, data);
+        return command;
+    }
+
     std::string socket_path_;
-    std::unordered_map<timestamp_t, isc::data::ElementPtr> responses_;
-    std::mutex mutex_;
-    std::condition_variable cv_;
+    NotificationsSenderPtr sender_;
+    std::unordered_set<timestamp_t> issued_;
 };
 
 }  // namespace dhcp
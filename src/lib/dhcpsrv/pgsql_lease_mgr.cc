@@ -37,6 +37,9 @@ namespace {
 static const size_t MAX_PRIVACY_HISTORY_LEN = 4096;
 #endif  // TERASTREAM
 
+/// @brief Maximum number of leases inserted by a single statement.
+const size_t MAX_BULK_INSERT_ROWS = 100;
+
 /// @brief Catalog of all the SQL statements currently supported.  Note
 /// that the order columns appear in statement body must match the order they
 /// that the occur in the table.  This does not apply to the where clause.
@@ -1610,6 +1613,103 @@ PgSqlLeaseMgr::addLease(const Lease6Ptr& lease) {
     return (result);
 }
 
+template<typename Exchange, typename LeaseCollection>
+size_t
+PgSqlLeaseMgr::addLeasesCommon(PgSqlLeaseContextPtr& ctx,
+                               StatementIndex stindex,
+                               std::unique_ptr<Exchange>& exchange,
+                               const LeaseCollection& leases) {
+    PgSqlTaggedStatement& tagged_statement = tagged_statements[stindex];
+
+    // The multi-row statement repeats the VALUES part of the single row
+    // INSERT statement with renumbered parameters.
+    const std::string text(tagged_statement.text);
+    const std::string values("VALUES ");
+    const std::string prefix = text.substr(0, text.find(values) + values.size());
+    const int nbparams = tagged_statement.nbparams;
+
+    size_t added = 0;
+    for (size_t first = 0; first < leases.size(); first += MAX_BULK_INSERT_ROWS) {
+        const size_t count = std::min(MAX_BULK_INSERT_ROWS, leases.size() - first);
+
+        // The bound values point to the exchange buffers, so each lease
+        // needs its own exchange.
+        std::vector<std::unique_ptr<Exchange> > exchanges;
+        PsqlBindArray bind_array;
+        std::vector<Oid> types;
+        std::ostringstream statement_text;
+        statement_text << prefix;
+        for (size_t i = 0; i < count; ++i) {
+            exchanges.emplace_back(new Exchange());
+            exchanges.back()->createBindForSend(leases[first + i], bind_array);
+            types.insert(types.end(), tagged_statement.types.begin(),
+                         tagged_statement.types.begin() + nbparams);
+            statement_text << (i > 0 ? ", (" : "(");
+            for (int param = 1; param <= nbparams; ++param) {
+                statement_text << (param > 1 ? ", $" : "$") << i * nbparams + param;
+            }
+            statement_text << ")";
+        }
+
+        PgSqlResult r(PQexecParams(ctx->conn_, statement_text.str().c_str(),
+                                   static_cast<int>(bind_array.size()), &types[0],
+                                   &bind_array.values_[0],
+                                   &bind_array.lengths_[0],
+                                   &bind_array.formats_[0], 0));
+
+        if (PQresultStatus(r) != PGRES_COMMAND_OK) {
+            if (!ctx->conn_.compareError(r, PgSqlConnection::DUPLICATE_KEY)) {
+                ctx->conn_.checkStatementError(r, tagged_statement);
+            }
+
+            // The whole statement has been rejected. Insert the leases of
+            // this chunk one by one to skip the existing ones.
+            for (size_t i = first; i < first + count; ++i) {
+                PsqlBindArray row_bind_array;
+                exchange->createBindForSend(leases[i], row_bind_array);
+                if (addLeaseCommon(ctx, stindex, row_bind_array)) {
+                    leases[i]->old_cltt_ = leases[i]->cltt_;
+                    leases[i]->old_valid_lft_ = leases[i]->valid_lft_;
+                    ++added;
+                }
+            }
+            continue;
+        }
+
+        for (size_t i = first; i < first + count; ++i) {
+            leases[i]->old_cltt_ = leases[i]->cltt_;
+            leases[i]->old_valid_lft_ = leases[i]->valid_lft_;
+        }
+        added += count;
+    }
+
+    return (added);
+}
+
+size_t
+PgSqlLeaseMgr::addLeases(const Lease4Collection& leases) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_PGSQL_ADD_LEASES4)
+        .arg(leases.size());
+
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*this);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
+    return (addLeasesCommon(ctx, INSERT_LEASE4, ctx->exchange4_, leases));
+}
+
+size_t
+PgSqlLeaseMgr::addLeases(const Lease6Collection& leases) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_PGSQL_ADD_LEASES6)
+        .arg(leases.size());
+
+    // Get a context
+    PgSqlLeaseContextAlloc get_context(*this);
+    PgSqlLeaseContextPtr ctx = get_context.ctx_;
+
+    return (addLeasesCommon(ctx, INSERT_LEASE6, ctx->exchange6_, leases));
+}
+
 template <typename Exchange, typename LeaseCollection>
 void
 PgSqlLeaseMgr::getLeaseCollection(PgSqlLeaseContextPtr& ctx,
@@ -144,6 +144,34 @@ public:
     ///        failed.
     virtual bool addLease(const Lease6Ptr& lease);
 
+    /// @brief Adds a collection of IPv4 leases
+    ///
+    /// The leases are inserted using multi-row INSERT statements. If any
+    /// of the leases in a statement already exists, the leases of this
+    /// statement are inserted one by one.
+    ///
+    /// @param leases leases to be added
+    ///
+    /// @return number of added leases
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual size_t addLeases(const Lease4Collection& leases);
+
+    /// @brief Adds a collection of IPv6 leases
+    ///
+    /// The leases are inserted using multi-row INSERT statements. If any
+    /// of the leases in a statement already exists, the leases of this
+    /// statement are inserted one by one.
+    ///
+    /// @param leases leases to be added
+    ///
+    /// @return number of added leases
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual size_t addLeases(const Lease6Collection& leases);
+
     /// @brief Returns an IPv4 lease for specified IPv4 address
     ///
     /// This method return a lease that is associated with a given address.
@@ -693,6 +721,30 @@ private:
                         StatementIndex stindex,
                         db::PsqlBindArray& bind_array);
 
+    /// @brief Add Leases Common Code
+    ///
+    /// This method performs the common actions for both flavours (V4 and V6)
+    /// of the addLeases method. It inserts the leases in chunks using
+    /// multi-row variants of the INSERT statement.
+    ///
+    /// @param ctx Context
+    /// @param stindex Index of the single row INSERT statement
+    /// @param exchange Exchange used to insert the leases one by one
+    /// @param leases leases to be added
+    ///
+    /// @tparam Exchange Type of the exchange, i.e. PgSqlLease4Exchange or
+    ///         PgSqlLease6Exchange.
+    /// @tparam LeaseCollection Type of the lease collection.
+    ///
+    /// @return number of added leases
+    ///
+    /// @throw isc::db::DbOperationError An operation on the open database has
+    ///        failed.
+    template<typename Exchange, typename LeaseCollection>
+    size_t addLeasesCommon(PgSqlLeaseContextPtr& ctx, StatementIndex stindex,
+                           std::unique_ptr<Exchange>& exchange,
+                           const LeaseCollection& leases);
+
     /// @brief Get Lease Collection Common Code
     ///
     /// This method performs the common actions for obtaining multiple leases
@@ -171,22 +171,7 @@ struct PgSqlSubnetMgr : public SubnetMgr<D> {
 
     void update(SubnetInfoPtr<D>& subnet,
                 std::string const& /* config_timestamp_path */) override final {
-        std::string const& index("UPDATE_SUBNET" + dhcpSpaceToString<D>() + "_ALL");
-        db::PgSqlTaggedStatement& statement = tagged_statements().at(index);
-
-        // Set up the WHERE clause values.
-        db::PsqlBindArray bind_array;
-        bindCommon(bind_array, subnet);
-        bindDelta(bind_array, subnet);
-        bind_array.add(subnet->strings_.subnet_);
-
-        db::PgSqlResult r(PQexecPrepared(connection_, statement.name, statement.nbparams,
-                                         &bind_array.values_[0], &bind_array.lengths_[0],
-                                         &bind_array.formats_[0], 0));
-
-        connection_.checkStatementError(r, statement);
-
-        int affected_rows = boost::lexical_cast<int>(PQcmdTuples(r));
+        int affected_rows = executeUpdate(subnet);
 
         // Check success case first as it is the most likely outcome.
         if (affected_rows == 1) {
@@ -206,6 +191,81 @@ struct PgSqlSubnetMgr : public SubnetMgr<D> {
                                             << "Mgr::update(): updated multiple, expected one");
     }
 
+    /// @brief the batch interface
+    ///
+    /// Selects and deletes are sent as a single statement taking all the subnets in an array.
+    /// Updates can't be grouped, they go row by row but report missing subnets through the
+    /// returned flags. Inserts keep the default implementation because a single duplicate
+    /// would reject a multi-row INSERT as a whole.
+    /// @{
+    SubnetInfoCollection<D> selectBySubnets(
+        std::vector<std::string>& subnets,
+        [[maybe_unused]] std::string const& config_timestamp_path = std::string()) override final {
+        std::string const& index("SELECT_SUBNET" + dhcpSpaceToString<D>() + "_ALL_IN");
+        db::PgSqlTaggedStatement& statement = tagged_statements().at(index);
+
+        // Set up the WHERE clause values.
+        std::string const& array(toArray(subnets));
+        db::PsqlBindArray bind_array;
+        bind_array.add(array);
+
+        db::PgSqlResult r(PQexecPrepared(connection_, statement.name, statement.nbparams,
+                                         &bind_array.values_[0], &bind_array.lengths_[0],
+                                         &bind_array.formats_[0], 0));
+
+        return selectCommon(statement, r);
+    }
+
+    void delBatch(SubnetInfoCollection<D>& subnets,
+                  std::string const& /* config_timestamp_path */) override final {
+        std::string const& index("DELETE_SUBNET" + dhcpSpaceToString<D>() + "_ALL_IN");
+        db::PgSqlTaggedStatement& statement = tagged_statements().at(index);
+
+        // Set up the WHERE clause values.
+        std::vector<std::string> prefixes;
+        prefixes.reserve(subnets.size());
+        for (SubnetInfoPtr<D> const& subnet : subnets) {
+            prefixes.push_back(subnet->strings_.subnet_);
+        }
+        std::string const& array(toArray(prefixes));
+        db::PsqlBindArray bind_array;
+        bind_array.add(array);
+
+        db::PgSqlResult r(PQexecPrepared(connection_, statement.name, statement.nbparams,
+                                         &bind_array.values_[0], &bind_array.lengths_[0],
+                                         &bind_array.formats_[0], 0));
+
+        connection_.checkStatementError(r, statement);
+        size_t const deleted = boost::lexical_cast<size_t>(PQcmdTuples(r));
+
+        // The subnets which exist have all been deleted at this point.
+        if (deleted != subnets.size()) {
+            isc_throw(db::StatementNotApplied, "PgSqlSubnet"
+                                                   << dhcpSpaceToString<D>()
+                                                   << "Mgr::delBatch(): deleted " << deleted
+                                                   << ", expected " << subnets.size());
+        }
+    }
+
+    std::vector<bool> updateBatch(SubnetInfoCollection<D>& subnets,
+                                  std::string const& /* config_timestamp_path */) override final {
+        std::vector<bool> applied;
+        applied.reserve(subnets.size());
+        for (SubnetInfoPtr<D>& subnet : subnets) {
+            int affected_rows = executeUpdate(subnet);
+            if (affected_rows > 1) {
+                // Should not have happened, primary key constraint should only have filtered
+                // one row.
+                isc_throw(db::DbOperationError,
+                          "PgSqlSubnet" << dhcpSpaceToString<D>()
+                                        << "Mgr::updateBatch(): updated multiple, expected one");
+            }
+            applied.push_back(affected_rows == 1);
+        }
+        return applied;
+    }
+    /// @}
+
     SubnetID maxSubnetID() override final {
         std::string const& index("SELECT_MAX_SUBNET_ID_" + dhcpSpaceToString<D>());
         db::PgSqlTaggedStatement& statement = tagged_statements().at(index);
@@ -354,6 +414,12 @@ struct PgSqlSubnetMgr : public SubnetMgr<D> {
             {tags.back(), db::PgSqlTaggedStatement{
                               1, {t.at("subnet")}, tags.back().c_str(), texts.back().c_str()}});
 
+        tags.push_back("DELETE_SUBNET" + dhcpSpaceToString<D>() + "_ALL_IN");
+        texts.push_back("DELETE FROM subnet" + dhcpSpaceToString<D>() + " WHERE subnet = ANY($1)");
+        tagged_statements.insert(
+            {tags.back(), db::PgSqlTaggedStatement{
+                              1, {db::OID_NONE}, tags.back().c_str(), texts.back().c_str()}});
+
         tags.push_back("DELETE_SUBNETS" + dhcpSpaceToString<D>() + "_ALL");
         texts.push_back("TRUNCATE subnet" + dhcpSpaceToString<D>());
         tagged_statements.insert(
@@ -374,6 +440,13 @@ struct PgSqlSubnetMgr : public SubnetMgr<D> {
             {tags.back(), db::PgSqlTaggedStatement{
                               1, {t.at("subnet")}, tags.back().c_str(), texts.back().c_str()}});
 
+        tags.push_back("SELECT_SUBNET" + dhcpSpaceToString<D>() + "_ALL_IN");
+        texts.push_back("SELECT subnet, " + columns + " FROM subnet" + dhcpSpaceToString<D>() +
+                        " WHERE subnet = ANY($1)");
+        tagged_statements.insert(
+            {tags.back(), db::PgSqlTaggedStatement{
+                              1, {db::OID_NONE}, tags.back().c_str(), texts.back().c_str()}});
+
         tags.push_back("SELECT_SUBNET" + dhcpSpaceToString<D>() + "_ALL_UNFILTERED");
         texts.push_back("SELECT subnet, " + columns + " FROM subnet" + dhcpSpaceToString<D>());
         tagged_statements.insert(
@@ -398,6 +471,41 @@ struct PgSqlSubnetMgr : public SubnetMgr<D> {
     }
 
 private:
+    /// @brief Formats subnets as a PostgreSQL array literal.
+    static std::string toArray(std::vector<std::string> const& subnets) {
+        std::string array("{");
+        for (std::string const& subnet : subnets) {
+            if (array.size() > 1) {
+                array += ",";
+            }
+            array += "\"" + subnet + "\"";
+        }
+        array += "}";
+        return array;
+    }
+
+    /// @brief Updates a subnet.
+    ///
+    /// @return the number of updated rows
+    int executeUpdate(SubnetInfoPtr<D>& subnet) {
+        std::string const& index("UPDATE_SUBNET" + dhcpSpaceToString<D>() + "_ALL");
+        db::PgSqlTaggedStatement& statement = tagged_statements().at(index);
+
+        // Set up the WHERE clause values.
+        db::PsqlBindArray bind_array;
+        bindCommon(bind_array, subnet);
+        bindDelta(bind_array, subnet);
+        bind_array.add(subnet->strings_.subnet_);
+
+        db::PgSqlResult r(PQexecPrepared(connection_, statement.name, statement.nbparams,
+                                         &bind_array.values_[0], &bind_array.lengths_[0],
+                                         &bind_array.formats_[0], 0));
+
+        connection_.checkStatementError(r, statement);
+
+        return boost::lexical_cast<int>(PQcmdTuples(r));
+    }
+
     SubnetInfoPtr<D> retrieve(db::PgSqlResult const& result, int row);
 
     SubnetInfoPtr<D> retrieveCommon(db::PgSqlResult const& result, int row) {
@@ -0,0 +1,137 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <dhcpsrv/resolved_options_cache.h>
+
+namespace isc {
+namespace dhcp {
+
+ResolvedOptionsCache::ResolvedOptionsCache(const size_t max_entries)
+    : max_entries_(max_entries), entries_(), generation_(0), mutex_() {
+}
+
+ResolvedOptionsCache::ResolvedOptionsPtr
+ResolvedOptionsCache::get(const CfgOptionList& co_list,
+                          const std::string& option_space,
+                          const std::vector<uint16_t>& codes,
+                          const bool persistent) {
+    const std::string key(createKey(co_list, option_space, codes, persistent));
+    uint64_t generation;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto entry = entries_.find(key);
+        if (entry != entries_.end()) {
+            return (entry->second.resolved_);
+        }
+        generation = generation_;
+    }
+
+    // Resolve the options without holding the lock. Another thread may
+    // resolve the same options meanwhile, which is harmless.
+    ResolvedOptionsPtr resolved = resolve(co_list, option_space, codes,
+                                          persistent);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (generation != generation_) {
+        // The cache was cleared meanwhile, the options may be outdated.
+        return (resolved);
+    }
+    if (entries_.size() >= max_entries_) {
+        entries_.clear();
+    }
+    entries_.emplace(key, Entry{co_list, resolved});
+    return (resolved);
+}
+
+ResolvedOptionsCache::ResolvedOptionsPtr
+ResolvedOptionsCache::resolve(const CfgOptionList& co_list,
+                              const std::string& option_space,
+                              const std::vector<uint16_t>& codes,
+                              const bool persistent) {
+    std::vector<uint16_t> requested_opts(codes);
+    if (persistent) {
+        for (auto const& copts : co_list) {
+            const OptionContainerPtr& opts = copts->getAll(option_space);
+            if (!opts) {
+                continue;
+            }
+            const OptionContainerPersistIndex& idx = opts->get<2>();
+            const OptionContainerPersistRange& range = idx.equal_range(true);
+            for (auto desc = range.first; desc != range.second; ++desc) {
+                if (desc->option_) {
+                    requested_opts.push_back(desc->option_->getType());
+                }
+            }
+        }
+    }
+
+    std::shared_ptr<ResolvedOptions> resolved(new ResolvedOptions());
+    resolved->reserve(requested_opts.size());
+    for (auto code : requested_opts) {
+        for (auto const& copts : co_list) {
+            OptionDescriptor desc = copts->get(option_space, code);
+            if (desc.option_) {
+                resolved->push_back(std::make_pair(code, desc.option_));
+                break;
+            }
+        }
+    }
+    return (resolved);
+}
+
+void
+ResolvedOptionsCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    ++generation_;
+}
+
+size_t
+ResolvedOptionsCache::size() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (entries_.size());
+}
+
+std::string
+ResolvedOptionsCache::createKey(const CfgOptionList& co_list,
+                                const std::string& option_space,
+                                const std::vector<uint16_t>& codes,
+                                const bool persistent) {
+    std::string key;
+    key.reserve(option_space.size() + 2 + co_list.size() * sizeof(void*) +
+                sizeof(uint32_t) +
+                codes.size() * sizeof(uint16_t));
+    key.append(option_space);
+    key.push_back('\0');
+    key.push_back(persistent ? 1 : 0);
+    for (auto const& copts : co_list) {
+        const void* ptr = copts.get();
+        key.append(reinterpret_cast<const char*>(&ptr), sizeof(ptr));
+    }
+    // The number of option configurations separates them from the codes.
+    const uint32_t count = co_list.size();
+    key.append(reinterpret_cast<const char*>(&count), sizeof(count));
+    for (auto code : codes) {
+        key.append(reinterpret_cast<const char*>(&code), sizeof(code));
+    }
+    return (key);
+}
+
+}  // namespace dhcp
+}  // namespace isc
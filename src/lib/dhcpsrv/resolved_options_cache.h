@@ -0,0 +1,155 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef RESOLVED_OPTIONS_CACHE_H
+#define RESOLVED_OPTIONS_CACHE_H
+
+#include <dhcp/option.h>
+#include <dhcpsrv/cfg_option.h>
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Cache of the options resolved for the responses.
+///
+/// The servers look up every option code requested by a client in the
+/// option configurations applying to the client, i.e. of the host, pool,
+/// subnet, shared network, client classes and the global one, in this
+/// order. The outcome only depends on the list of these configurations,
+/// the option space and the requested codes, so it is cached under a key
+/// made of them. Packets from clients in the same subnet, pool and classes
+/// asking for the same options reuse the resolved options.
+///
+/// The key refers to the option configurations by address. The entries keep
+/// their option configurations alive, so an address in a key can't be
+/// reused by another option configuration as long as the entry exists.
+/// Options changed in place are not detected, so the cache must be cleared
+/// whenever the configuration changes. It is owned by the server
+/// configuration and cleared when the configuration is committed or merged
+/// and when subnet deltas are applied. Options resolved while the cache is
+/// cleared are returned but not cached. The options of the hosts are not
+/// part of the committed configuration and the lists including them must
+/// not be cached.
+///
+/// The cache holds at most a configured number of entries and is cleared
+/// when it is full. The methods are thread safe.
+class ResolvedOptionsCache {
+public:
+    /// @brief Option codes and the options resolved for them, in the order
+    /// of the codes.
+    typedef std::vector<std::pair<uint16_t, OptionPtr>> ResolvedOptions;
+
+    /// @brief Pointer to the resolved options.
+    typedef std::shared_ptr<const ResolvedOptions> ResolvedOptionsPtr;
+
+    /// @brief Default maximal number of entries.
+    static const size_t DEFAULT_MAX_ENTRIES = 4096;
+
+    /// @brief Constructor.
+    ///
+    /// @param max_entries Maximal number of entries.
+    explicit ResolvedOptionsCache(const size_t max_entries = DEFAULT_MAX_ENTRIES);
+
+    /// @brief Resolves the options using the cache.
+    ///
+    /// @param co_list Option configurations by precedence.
+    /// @param option_space Option space of the options.
+    /// @param codes Requested option codes.
+    /// @param persistent Whether the codes of the persistent options of
+    /// the option configurations are requested as well.
+    /// @return Resolved options.
+    ResolvedOptionsPtr get(const CfgOptionList& co_list,
+                           const std::string& option_space,
+                           const std::vector<uint16_t>& codes,
+                           const bool persistent);
+
+    /// @brief Resolves the options without the cache.
+    ///
+    /// The requested codes are followed by the codes of the persistent
+    /// options if requested. Every code is resolved to the option of the
+    /// first option configuration holding it. The codes which are not
+    /// configured are skipped.
+    ///
+    /// @param co_list Option configurations by precedence.
+    /// @param option_space Option space of the options.
+    /// @param codes Requested option codes.
+    /// @param persistent Whether the codes of the persistent options of
+    /// the option configurations are requested as well.
+    /// @return Resolved options.
+    static ResolvedOptionsPtr resolve(const CfgOptionList& co_list,
+                                      const std::string& option_space,
+                                      const std::vector<uint16_t>& codes,
+                                      const bool persistent);
+
+    /// @brief Removes all entries.
+    void clear();
+
+    /// @brief Returns the number of entries.
+    size_t size();
+
+private:
+    /// @brief Creates the key of the entry.
+    ///
+    /// @param co_list Option configurations by precedence.
+    /// @param option_space Option space of the options.
+    /// @param codes Requested option codes.
+    /// @param persistent Whether the codes of the persistent options are
+    /// requested as well.
+    /// @return The key.
+    static std::string createKey(const CfgOptionList& co_list,
+                                 const std::string& option_space,
+                                 const std::vector<uint16_t>& codes,
+                                 const bool persistent);
+
+    /// @brief Maximal number of entries.
+    size_t max_entries_;
+
+    /// @brief Cached resolved options.
+    struct Entry {
+        /// @brief Option configurations referred to by the key.
+        CfgOptionList co_list_;
+
+        /// @brief Resolved options.
+        ResolvedOptionsPtr resolved_;
+    };
+
+    /// @brief Entries by key.
+    std::unordered_map<std::string, Entry> entries_;
+
+    /// @brief Incremented by every clear, so that options resolved before
+    /// are not cached after.
+    uint64_t generation_;
+
+    /// @brief Mutex protecting the entries.
+    std::mutex mutex_;
+};
+
+/// @brief Pointer to the @c ResolvedOptionsCache.
+typedef std::shared_ptr<ResolvedOptionsCache> ResolvedOptionsCachePtr;
+
+}  // namespace dhcp
+}  // namespace isc
+
+#endif  // RESOLVED_OPTIONS_CACHE_H
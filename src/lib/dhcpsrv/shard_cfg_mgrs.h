@@ -0,0 +1,251 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef SHARD_CFG_MGRS_H
+#define SHARD_CFG_MGRS_H
+
+#include <cc/data.h>
+#include <database/dbaccess_parser.h>
+#include <dhcpsrv/shard_config_mgr_factory.h>
+#include <dhcpsrv/subnet_mgr_factory.h>
+#include <exceptions/exceptions.h>
+#include <util/dhcp.h>
+#include <util/func.h>
+#include <util/thread_pool.h>
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief The configuration managers of a single shard.
+///
+/// Unlike @ref CfgDbAccess::createShardCfgMgrs, creating them neither touches
+/// the staging configuration nor replaces the current managers of the
+/// factories. Each shard gets its own database connections so that the shards
+/// can be processed concurrently.
+template <DhcpSpaceType D>
+struct ShardCfgMgrs {
+    /// @brief Constructor
+    ///
+    /// @param access_string the database access string as returned by
+    ///     @ref accessString
+    ShardCfgMgrs(std::string const& access_string)
+        : access_string_(access_string),
+          shard_config_mgr_(ShardConfigMgrFactory<D>::createInstance(access_string)),
+          subnet_mgr_(SubnetMgrFactory<D>::createInstance(access_string)) {
+    }
+
+    /// @brief Constructor from existing managers
+    ///
+    /// @param access_string the database access string of the managers
+    /// @param shard_config_mgr the shard configuration manager
+    /// @param subnet_mgr the subnet manager
+    ShardCfgMgrs(std::string const& access_string,
+                 std::shared_ptr<ShardConfigMgr> const& shard_config_mgr,
+                 std::unique_ptr<SubnetMgr<D>>&& subnet_mgr)
+        : access_string_(access_string), shard_config_mgr_(shard_config_mgr),
+          subnet_mgr_(std::move(subnet_mgr)) {
+    }
+
+    /// @brief Converts shard credentials to a database access string.
+    ///
+    /// @param credentials the config-database element of the shard
+    ///
+    /// @return the database access string
+    static std::string accessString(isc::data::ElementPtr const& credentials) {
+        if (!credentials) {
+            isc_throw(BadValue, PRETTY_FUNCTION_NAME() << ": no credentials configuration");
+        }
+        isc::db::DbAccessParser parser;
+        std::string access_string;
+        parser.parse(access_string, credentials);
+        return access_string + " universe=" + dhcpSpaceToString<D>();
+    }
+
+    /// @brief the database access string the managers were created with
+    std::string const access_string_;
+
+    /// @brief the shard configuration manager
+    std::shared_ptr<ShardConfigMgr> const shard_config_mgr_;
+
+    /// @brief the subnet manager
+    std::unique_ptr<SubnetMgr<D>> const subnet_mgr_;
+};
+
+template <DhcpSpaceType D>
+using ShardCfgMgrsPtr = std::shared_ptr<ShardCfgMgrs<D>>;
+
+/// @brief Keeps the configuration managers of the shards between uses so that
+/// the database connections are reused.
+///
+/// The managers are kept per shard, even when several shards share the same
+/// credentials, so the managers of different shards never share a database
+/// connection. It is safe to use from multiple threads. The managers of a
+/// shard are meant to be used by a single thread at a time, see
+/// @ref ShardTasks.
+template <DhcpSpaceType D>
+struct ShardCfgMgrsCache {
+    /// @brief Creates the managers from a database access string.
+    using creator_t = std::function<ShardCfgMgrsPtr<D>(std::string const&)>;
+
+    /// @brief Constructor
+    ///
+    /// @param create creates the managers of a shard, connecting to the
+    ///     database by default
+    ShardCfgMgrsCache(creator_t const& create = [](std::string const& access_string) {
+        return std::make_shared<ShardCfgMgrs<D>>(access_string);
+    })
+        : create_(create) {
+    }
+
+    /// @brief Returns the managers of the shard, creating them if needed.
+    ///
+    /// The managers are created again if the credentials of the shard have
+    /// changed since they were last created.
+    ///
+    /// @param master the name of the master the shard belongs to
+    /// @param shard the name of the shard
+    /// @param credentials the config-database element of the shard
+    ///
+    /// @return the managers of the shard
+    ShardCfgMgrsPtr<D> get(std::string const& master,
+                           std::string const& shard,
+                           isc::data::ElementPtr const& credentials) {
+        std::string const& access_string(ShardCfgMgrs<D>::accessString(credentials));
+        std::lock_guard<std::mutex> lock(mutex_);
+        ShardCfgMgrsPtr<D>& shard_cfg_mgrs(shard_cfg_mgrs_[std::make_pair(master, shard)]);
+        if (!shard_cfg_mgrs || shard_cfg_mgrs->access_string_ != access_string) {
+            shard_cfg_mgrs = create_(access_string);
+        }
+        return shard_cfg_mgrs;
+    }
+
+    /// @brief Closes the database connections of all the shards.
+    void clear() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        shard_cfg_mgrs_.clear();
+    }
+
+private:
+    /// @brief creates the managers of a shard
+    creator_t const create_;
+
+    /// @brief the managers indexed by master and shard name
+    std::map<std::pair<std::string, std::string>, ShardCfgMgrsPtr<D>> shard_cfg_mgrs_;
+
+    /// @brief protects shard_cfg_mgrs_
+    std::mutex mutex_;
+};
+
+/// @brief Tasks using the managers of the shards, run concurrently.
+///
+/// The tasks using the same managers run in the order in which they were added
+/// on a single thread, because a database connection is used by one thread at
+/// a time. The tasks using different managers run concurrently.
+template <DhcpSpaceType D>
+struct ShardTasks {
+    /// @brief Adds a task.
+    ///
+    /// @param shard_cfg_mgrs the managers used by the task
+    /// @param task the task
+    void add(ShardCfgMgrsPtr<D> const& shard_cfg_mgrs, std::function<void()> const& task) {
+        for (auto& [mgrs, tasks] : tasks_) {
+            if (mgrs == shard_cfg_mgrs) {
+                tasks.push_back(task);
+                return;
+            }
+        }
+        tasks_.emplace_back(shard_cfg_mgrs, std::vector<std::function<void()>>{task});
+    }
+
+    /// @brief Runs the tasks and waits for all of them.
+    ///
+    /// The tasks of the managers following a failed one are skipped. The first
+    /// exception thrown by a task is rethrown once all the tasks have finished.
+    ///
+    /// @param pool the thread pool running the tasks, started with @c threads
+    ///     threads if it is not running yet
+    /// @param threads the maximum number of threads, the tasks are run by the
+    ///     calling thread if it is lower than 2
+    void run(isc::util::ThreadPool<std::function<void()>>& pool, uint32_t const threads) {
+        if (tasks_.size() < 2 || threads < 2) {
+            for (auto const& [mgrs, tasks] : tasks_) {
+                for (std::function<void()> const& task : tasks) {
+                    task();
+                }
+            }
+            return;
+        }
+        if (!pool.size()) {
+            pool.start(threads);
+        }
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        size_t pending(tasks_.size());
+        std::exception_ptr first_exception;
+        for (auto const& [mgrs, tasks] : tasks_) {
+            std::vector<std::function<void()>> const& shard_tasks(tasks);
+            pool.add(std::make_shared<std::function<void()>>([&]() {
+                std::exception_ptr exception;
+                try {
+                    for (std::function<void()> const& task : shard_tasks) {
+                        task();
+                    }
+                } catch (...) {
+                    exception = std::current_exception();
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                if (exception && !first_exception) {
+                    first_exception = exception;
+                }
+                --pending;
+                cv.notify_all();
+            }));
+        }
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [&]() { return pending == 0; });
+        }
+        if (first_exception) {
+            std::rethrow_exception(first_exception);
+        }
+    }
+
+    /// @brief Returns the number of managers used by the tasks.
+    size_t size() const {
+        return tasks_.size();
+    }
+
+private:
+    /// @brief the tasks grouped by the managers they use
+    std::vector<std::pair<ShardCfgMgrsPtr<D>, std::vector<std::function<void()>>>> tasks_;
+};
+
+}  // namespace dhcp
+}  // namespace isc
+
+#endif  // SHARD_CFG_MGRS_H
@@ -38,6 +38,7 @@
 #include <iostream>
 #include <iterator>
 #include <map>
+#include <memory>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -97,6 +98,19 @@ struct ShardConfigMgrFactory {
     /// @throw isc::dhcp::InvalidType The "type" keyword in dbaccess does not
     ///        identify a supported backend.
     static void create(const std::string& dbaccess) {
+        getConfigurationMgrPtr() = createInstance(dbaccess);
+    }
+
+    /// @brief Create a shard configuration manager which is not the "current" one.
+    ///
+    /// Unlike @ref create, it leaves the current shard configuration manager alone
+    /// so that each shard can have its own manager, e.g. when the shards are
+    /// processed concurrently.
+    ///
+    /// @param dbaccess Database access parameters, see @ref create.
+    ///
+    /// @return the new shard configuration manager
+    static std::shared_ptr<ShardConfigMgr> createInstance(const std::string& dbaccess) {
         std::string const type("type");
 
         // Parse the access string and create a redacted string for logging.
@@ -115,23 +129,19 @@ struct ShardConfigMgrFactory {
 #ifdef HAVE_CQL
         if (parameters[type] == "cql") {
             LOG_INFO(dhcpsrv_logger, DHCPSRV_CQL_DB).arg(redacted);
-            getConfigurationMgrPtr() =
-                std::make_shared<CqlShardConfigMgr<ShardConfigT<D>>>(parameters);
-            return;
+            return std::make_shared<CqlShardConfigMgr<ShardConfigT<D>>>(parameters);
         }
 #endif
 #ifdef HAVE_MYSQL
         if (parameters[type] == "mysql") {
             LOG_INFO(dhcpsrv_logger, DHCPSRV_MYSQL_DB).arg(redacted);
-            getConfigurationMgrPtr() = std::make_shared<MySqlShardConfigMgr<D>>(parameters);
-            return;
+            return std::make_shared<MySqlShardConfigMgr<D>>(parameters);
         }
 #endif
 #ifdef HAVE_PGSQL
         if (parameters[type] == "postgresql") {
             LOG_INFO(dhcpsrv_logger, DHCPSRV_PGSQL_DB).arg(redacted);
-            getConfigurationMgrPtr() = std::make_shared<PgSqlShardConfigMgr<D>>(parameters);
-            return;
+            return std::make_shared<PgSqlShardConfigMgr<D>>(parameters);
         }
 #endif
 
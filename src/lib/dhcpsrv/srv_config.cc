@@ -46,7 +46,8 @@ SrvConfig::SrvConfig()
       history_size_(0), valid_lft_(0),
 #endif  // TERASTREAM
       d2_client_config_(new D2ClientConfig()), configured_globals_(Element::createMap()),
-      cfg_consist_(new CfgConsistency()) {
+      cfg_consist_(new CfgConsistency()),
+      resolved_options_cache_(new ResolvedOptionsCache()) {
 }
 
 SrvConfig::SrvConfig(const uint32_t sequence)
@@ -65,7 +66,8 @@ SrvConfig::SrvConfig(const uint32_t sequence)
       history_size_(0), valid_lft_(0),
 #endif  // TERASTREAM
       d2_client_config_(new D2ClientConfig()), configured_globals_(Element::createMap()),
-      cfg_consist_(new CfgConsistency()) {
+      cfg_consist_(new CfgConsistency()),
+      resolved_options_cache_(new ResolvedOptionsCache()) {
 }
 
 string SrvConfig::getConfigSummary(const uint32_t selection) const {
@@ -278,6 +280,12 @@ void SrvConfig::updateStatistics() {
     }
 }
 
+void SrvConfig::buildSubnetSelectionIndexes() {
+    getCfgSubnets4()->buildSelectionIndex();
+
+    getCfgSubnets6()->buildSelectionIndex();
+}
+
 isc::data::ElementPtr SrvConfig::getConfiguredGlobal(std::string name) const {
     isc::data::ElementPtr global;
     if (configured_globals_->contains(name)) {
@@ -590,6 +598,16 @@ template <>
 CfgSubnets6Ptr SrvConfig::getCfgSubnets<DHCP_SPACE_V6>() {
     return getCfgSubnets6();
 }
+
+template <>
+void SrvConfig::setCfgSubnets<DHCP_SPACE_V4>(CfgSubnets4Ptr const& subnets) {
+    cfg_subnets4_ = subnets;
+}
+
+template <>
+void SrvConfig::setCfgSubnets<DHCP_SPACE_V6>(CfgSubnets6Ptr const& subnets) {
+    cfg_subnets6_ = subnets;
+}
 /// @}
 
 DdnsParamsPtr SrvConfig::getDdnsParams(const Subnet4Ptr& subnet) const {
@@ -28,6 +28,7 @@
 #include <dhcpsrv/cfg_subnets6.h>
 #include <dhcpsrv/client_class_def.h>
 #include <dhcpsrv/d2_client_cfg.h>
+#include <dhcpsrv/resolved_options_cache.h>
 #include <hooks/hooks_config.h>
 #include <process/config_base.h>
 #include <util/strutil.h>
@@ -499,6 +500,14 @@ public:
         return (cfg_consist_);
     }
 
+    /// @brief Returns pointer to the cache of the options resolved for
+    /// the responses.
+    ///
+    /// The cache is cleared when the configuration is committed or merged.
+    ResolvedOptionsCachePtr getResolvedOptionsCache() const {
+        return (resolved_options_cache_);
+    }
+
     //@}
 
     /// @brief Returns non-const reference to an array that stores
@@ -740,6 +749,12 @@ public:
     /// @ref CfgSubnets6::updateStatistics for details.
     void updateStatistics();
 
+    /// @brief Builds the subnet selection indexes.
+    ///
+    /// See @ref CfgSubnets4::buildSelectionIndex and
+    /// @ref CfgSubnets6::buildSelectionIndex for details.
+    void buildSubnetSelectionIndexes();
+
     /// @brief Removes statistics.
     ///
     /// This method calls appropriate methods in child objects that remove
@@ -918,6 +933,15 @@ public:
 
     template <DhcpSpaceType D>
     std::shared_ptr<CfgSubnetsT<D> const> getCfgSubnets() const;
+
+    /// @brief Replaces the subnets of the configuration.
+    ///
+    /// Used by @c SubnetDelta to install the updated copy of the subnets
+    /// in the current configuration.
+    ///
+    /// @param subnets New subnets configuration.
+    template <DhcpSpaceType D>
+    void setCfgSubnets(std::shared_ptr<CfgSubnetsT<D>> const& subnets);
     /// @}
 
     /// @brief Moves deprecated parameters from dhcp-ddns element to global element
@@ -1124,6 +1148,10 @@ private:
 
     /// @brief Pointer to the configuration consistency settings
     CfgConsistencyPtr cfg_consist_;
+
+    /// @brief Pointer to the cache of the options resolved for the
+    /// responses.
+    ResolvedOptionsCachePtr resolved_options_cache_;
 };
 
 /// @name Pointers to the @c SrvConfig object.
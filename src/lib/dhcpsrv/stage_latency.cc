@@ -0,0 +1,266 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <cc/command_interpreter.h>
+#include <dhcpsrv/stage_latency.h>
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace isc::config;
+using namespace isc::data;
+using namespace isc::util;
+using namespace std;
+
+namespace isc {
+namespace dhcp {
+
+namespace {
+
+/// @brief Histograms of the stages recorded by a thread.
+///
+/// The mutex is only contended while the histograms are reported.
+struct ThreadHistograms {
+    /// @brief Constructor.
+    ThreadHistograms() : histograms_(StageLatency::STAGE_COUNT) {
+    }
+
+    /// @brief Mutex protecting the histograms.
+    mutex mutex_;
+
+    /// @brief Histograms indexed by stage.
+    vector<LatencyHistogram> histograms_;
+};
+
+/// @brief Histograms of all threads.
+struct Registry {
+    /// @brief Constructor.
+    Registry() : retired_(StageLatency::STAGE_COUNT) {
+    }
+
+    /// @brief Mutex protecting the registry.
+    mutex mutex_;
+
+    /// @brief Histograms of the running threads.
+    list<shared_ptr<ThreadHistograms>> threads_;
+
+    /// @brief Histograms merged from the exited threads.
+    vector<LatencyHistogram> retired_;
+};
+
+/// @brief Returns the registry.
+///
+/// The registry is never destroyed so that the threads exiting late
+/// can still retire their histograms.
+Registry&
+getRegistry() {
+    static Registry* registry = new Registry();
+    return (*registry);
+}
+
+/// @brief Slot of a thread in the registry.
+class ThreadSlot {
+public:
+
+    /// @brief Constructor, registers the histograms of the thread.
+    ThreadSlot() : histograms_(new ThreadHistograms()) {
+        Registry& registry = getRegistry();
+        lock_guard<mutex> lk(registry.mutex_);
+        registry.threads_.push_back(histograms_);
+    }
+
+    /// @brief Destructor, retires the histograms of the thread.
+    ~ThreadSlot() {
+        Registry& registry = getRegistry();
+        lock_guard<mutex> lk(registry.mutex_);
+        for (size_t i = 0; i < registry.retired_.size(); ++i) {
+            registry.retired_[i].merge(histograms_->histograms_[i]);
+        }
+        registry.threads_.remove(histograms_);
+    }
+
+    /// @brief Returns the histograms of the thread.
+    ThreadHistograms& get() {
+        return (*histograms_);
+    }
+
+private:
+
+    /// @brief Histograms of the thread.
+    shared_ptr<ThreadHistograms> histograms_;
+};
+
+/// @brief Names of the stages.
+const char* stage_names[] = {
+    "classify",
+    "select-subnet",
+    "host-lookup",
+    "lease-allocation",
+    "hooks",
+    "build-options",
+    "send",
+    "total"
+};
+
+static_assert(sizeof(stage_names) / sizeof(stage_names[0]) == StageLatency::STAGE_COUNT,
+              "a stage has no name");
+
+}  // namespace
+
+atomic<bool> StageLatency::enabled_(false);
+
+string
+StageLatency::stageToText(const Stage stage) {
+    if ((stage < 0) || (stage >= STAGE_COUNT)) {
+        return ("unknown");
+    }
+    return (stage_names[stage]);
+}
+
+void
+StageLatency::setEnabled(const bool enabled) {
+    enabled_.store(enabled, memory_order_relaxed);
+}
+
+void
+StageLatency::record(const Stage stage, const chrono::nanoseconds& duration) {
+    // Called from destructors: a failure loses the duration, nothing more.
+    try {
+        thread_local ThreadSlot slot;
+        ThreadHistograms& thread_histograms = slot.get();
+        lock_guard<mutex> lk(thread_histograms.mutex_);
+        thread_histograms.histograms_[stage].record(duration);
+    } catch (...) {
+    }
+}
+
+LatencyHistogram
+StageLatency::getHistogram(const Stage stage) {
+    Registry& registry = getRegistry();
+    lock_guard<mutex> lk(registry.mutex_);
+    LatencyHistogram histogram(registry.retired_[stage]);
+    for (auto const& thread : registry.threads_) {
+        lock_guard<mutex> thread_lk(thread->mutex_);
+        histogram.merge(thread->histograms_[stage]);
+    }
+    return (histogram);
+}
+
+void
+StageLatency::reset() {
+    Registry& registry = getRegistry();
+    lock_guard<mutex> lk(registry.mutex_);
+    for (auto& histogram : registry.retired_) {
+        histogram.clear();
+    }
+    for (auto const& thread : registry.threads_) {
+        lock_guard<mutex> thread_lk(thread->mutex_);
+        for (auto& histogram : thread->histograms_) {
+            histogram.clear();
+        }
+    }
+}
+
+ElementPtr
+StageLatency::toElement(const bool buckets) {
+    ElementPtr result = Element::createMap();
+    result->set("enabled", Element::create(isEnabled()));
+    ElementPtr stages = Element::createMap();
+    for (int i = 0; i < STAGE_COUNT; ++i) {
+        const Stage stage = static_cast<Stage>(i);
+        const LatencyHistogram histogram = getHistogram(stage);
+        ElementPtr map = Element::createMap();
+        map->set("count", Element::create(static_cast<int64_t>(histogram.getCount())));
+        map->set("min", Element::create(static_cast<int64_t>(histogram.getMin())));
+        map->set("max", Element::create(static_cast<int64_t>(histogram.getMax())));
+        map->set("mean", Element::create(histogram.getMean()));
+        map->set("p50", Element::create(static_cast<int64_t>(histogram.getPercentile(50))));
+        map->set("p90", Element::create(static_cast<int64_t>(histogram.getPercentile(90))));
+        map->set("p99", Element::create(static_cast<int64_t>(histogram.getPercentile(99))));
+        map->set("p999", Element::create(static_cast<int64_t>(histogram.getPercentile(99.9))));
+        if (buckets) {
+            ElementPtr list = Element::createList();
+            for (auto const& bucket : histogram.getBuckets()) {
+                ElementPtr entry = Element::createList();
+                entry->add(Element::create(static_cast<int64_t>(bucket.lowest_)));
+                entry->add(Element::create(static_cast<int64_t>(bucket.highest_)));
+                entry->add(Element::create(static_cast<int64_t>(bucket.count_)));
+                list->add(entry);
+            }
+            map->set("buckets", list);
+        }
+        stages->set(stageToText(stage), map);
+    }
+    result->set("stages", stages);
+    return (result);
+}
+
+ElementPtr
+StageLatency::commandStageLatencyGetHandler(const string&, ElementPtr args) {
+    bool buckets = false;
+    if (args) {
+        if (args->getType() != Element::map) {
+            return (createAnswer(CONTROL_RESULT_ERROR, "arguments must be a map"));
+        }
+        ElementPtr buckets_elem = args->get("buckets");
+        if (buckets_elem) {
+            if (buckets_elem->getType() != Element::boolean) {
+                return (createAnswer(CONTROL_RESULT_ERROR,
+                                     "'buckets' parameter expected to be a boolean."));
+            }
+            buckets = buckets_elem->boolValue();
+        }
+    }
+    return (createAnswer(CONTROL_RESULT_SUCCESS, toElement(buckets)));
+}
+
+ElementPtr
+StageLatency::commandStageLatencySetHandler(const string&, ElementPtr args) {
+    if (!args || (args->getType() != Element::map)) {
+        return (createAnswer(CONTROL_RESULT_ERROR, "arguments must be a map"));
+    }
+    ElementPtr enable = args->get("enable");
+    ElementPtr reset_elem = args->get("reset");
+    if (!enable && !reset_elem) {
+        return (createAnswer(CONTROL_RESULT_ERROR,
+                             "Missing 'enable' or 'reset' parameter."));
+    }
+    if (enable && (enable->getType() != Element::boolean)) {
+        return (createAnswer(CONTROL_RESULT_ERROR,
+                             "'enable' parameter expected to be a boolean."));
+    }
+    if (reset_elem && (reset_elem->getType() != Element::boolean)) {
+        return (createAnswer(CONTROL_RESULT_ERROR,
+                             "'reset' parameter expected to be a boolean."));
+    }
+    if (reset_elem && reset_elem->boolValue()) {
+        reset();
+    }
+    if (enable) {
+        setEnabled(enable->boolValue());
+    }
+    return (createAnswer(CONTROL_RESULT_SUCCESS,
+                         string("Stage latency timing is ") +
+                         (isEnabled() ? "enabled." : "disabled.")));
+}
+
+}  // namespace dhcp
+}  // namespace isc
@@ -0,0 +1,184 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef STAGE_LATENCY_H
+#define STAGE_LATENCY_H
+
+#include <cc/data.h>
+#include <util/latency_histogram.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Latency histograms of the stages of the query processing.
+///
+/// The servers and the allocation engine time the stages of the
+/// processing of every query with a @c StageLatencyTimer. Each thread
+/// records in its own set of histograms, which the commands merge when
+/// they report. The histograms of a thread which exits are kept. The
+/// stages may nest: the callouts of a hook point called during the
+/// selection of the subnet count in both stages.
+///
+/// The timing is disabled by default: a disabled timer only reads a flag,
+/// so the instrumentation is left in the hot path. It is switched at
+/// runtime with the stage-latency-set command.
+class StageLatency {
+public:
+
+    /// @brief Timed stages.
+    typedef enum {
+        /// Classification of the query.
+        CLASSIFY,
+        /// Selection of the subnet.
+        SELECT_SUBNET,
+        /// Lookup of the host reservations.
+        HOST_LOOKUP,
+        /// Allocation, renewal or release of the leases.
+        LEASE_ALLOCATION,
+        /// Callouts of the hook points of the processing.
+        HOOKS,
+        /// Building of the options of the response.
+        BUILD_OPTIONS,
+        /// Sending of the packed response.
+        SEND,
+        /// Whole processing of the query, from its reception.
+        TOTAL,
+        /// Number of stages, not a stage.
+        STAGE_COUNT
+    } Stage;
+
+    /// @brief Returns the name of a stage.
+    ///
+    /// @param stage Stage.
+    /// @return The name, e.g. "select-subnet".
+    static std::string stageToText(const Stage stage);
+
+    /// @brief Enables or disables the timing.
+    ///
+    /// @param enabled true to enable the timing.
+    static void setEnabled(const bool enabled);
+
+    /// @brief Checks if the timing is enabled.
+    static bool isEnabled() {
+        return (enabled_.load(std::memory_order_relaxed));
+    }
+
+    /// @brief Records the duration of a stage for the current thread.
+    ///
+    /// @param stage Stage.
+    /// @param duration Duration.
+    static void record(const Stage stage, const std::chrono::nanoseconds& duration);
+
+    /// @brief Returns the histogram of a stage merged over all threads.
+    ///
+    /// @param stage Stage.
+    static util::LatencyHistogram getHistogram(const Stage stage);
+
+    /// @brief Removes the recorded durations of all threads.
+    static void reset();
+
+    /// @brief Returns the merged histograms in Element format.
+    ///
+    /// The durations are in nanoseconds. A stage which has not been timed
+    /// yet has a count of 0.
+    ///
+    /// @param buckets true to add the buckets holding values.
+    /// @return A map with the enabled flag and a map of the stages to
+    /// their count, min, max, mean, p50, p90, p99 and p999.
+    static data::ElementPtr toElement(const bool buckets);
+
+    /// @brief Handles the stage-latency-get command.
+    ///
+    /// The optional boolean argument "buckets" adds the buckets of the
+    /// histograms to the answer.
+    ///
+    /// @param command (parameter ignored)
+    /// @param args Arguments of the command, may be null.
+    /// @return The answer with the histograms of @ref toElement.
+    static data::ElementPtr
+    commandStageLatencyGetHandler(const std::string& command,
+                                  data::ElementPtr args);
+
+    /// @brief Handles the stage-latency-set command.
+    ///
+    /// The optional boolean arguments are "enable", which switches the
+    /// timing, and "reset", which removes the recorded durations.
+    ///
+    /// @param command (parameter ignored)
+    /// @param args Arguments of the command.
+    /// @return The answer of the command.
+    static data::ElementPtr
+    commandStageLatencySetHandler(const std::string& command,
+                                  data::ElementPtr args);
+
+private:
+
+    /// @brief Whether the timing is enabled.
+    static std::atomic<bool> enabled_;
+};
+
+/// @brief Times a stage from its construction to its destruction.
+///
+/// The timer does nothing when the timing is disabled at its construction.
+class StageLatencyTimer : public boost::noncopyable {
+public:
+
+    /// @brief Constructor, starts the timer.
+    ///
+    /// @param stage Timed stage.
+    explicit StageLatencyTimer(const StageLatency::Stage stage)
+        : stage_(stage), running_(StageLatency::isEnabled()) {
+        if (running_) {
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    /// @brief Destructor, stops the timer if still running.
+    ~StageLatencyTimer() {
+        stop();
+    }
+
+    /// @brief Stops the timer and records the duration.
+    void stop() {
+        if (running_) {
+            running_ = false;
+            StageLatency::record(stage_, std::chrono::steady_clock::now() - start_);
+        }
+    }
+
+private:
+
+    /// @brief Timed stage.
+    StageLatency::Stage stage_;
+
+    /// @brief Whether the timer runs.
+    bool running_;
+
+    /// @brief Start time.
+    std::chrono::steady_clock::time_point start_;
+};
+
+}  // namespace dhcp
+}  // namespace isc
+
+#endif  // STAGE_LATENCY_H
@@ -8,6 +8,7 @@
 
 #include <asiolink/io_address.h>
 #include <asiolink/addr_utilities.h>
+#include <asiolink/compact_address.h>
 #include <dhcp/option_space.h>
 #include <dhcpsrv/shared_network.h>
 #include <dhcpsrv/subnet.h>
@@ -83,10 +84,9 @@ Subnet::Subnet(const isc::asiolink::IOAddress& prefix, uint8_t len,
 
 bool
 Subnet::inRange(const isc::asiolink::IOAddress& addr) const {
-    IOAddress first = firstAddrInPrefix(prefix_, prefix_len_);
-    IOAddress last = lastAddrInPrefix(prefix_, prefix_len_);
-
-    return ((first <= addr) && (addr <= last));
+    // Compare the address with the prefix under the mask rather than
+    // with the first and the last address of the prefix.
+    return (CompactAddress(addr).inPrefix(prefix_, prefix_len_));
 }
 
 isc::asiolink::IOAddress Subnet::getLastAllocated(Lease::Type type) const {
@@ -181,6 +181,11 @@ Subnet::toText() const {
 
 uint64_t
 Subnet::getPoolCapacity(Lease::Type type) const {
+    const PoolCapacity* capacity = getCachedPoolCapacity(type);
+    if (capacity) {
+        return (capacity->total_);
+    }
+
     switch (type) {
     case Lease::TYPE_V4:
     case Lease::TYPE_NA:
@@ -198,6 +203,18 @@ Subnet::getPoolCapacity(Lease::Type type) const {
 uint64_t
 Subnet::getPoolCapacity(Lease::Type type,
                         const ClientClasses& client_classes) const {
+    const PoolCapacity* capacity = getCachedPoolCapacity(type);
+    if (capacity) {
+        if (capacity->restricted_.empty()) {
+            return (capacity->unrestricted_);
+        }
+        uint64_t x = sumPoolCapacity(capacity->restricted_, client_classes);
+        if (x > std::numeric_limits<uint64_t>::max() - capacity->unrestricted_) {
+            return (std::numeric_limits<uint64_t>::max());
+        }
+        return (capacity->unrestricted_ + x);
+    }
+
     switch (type) {
     case Lease::TYPE_V4:
     case Lease::TYPE_NA:
@@ -252,6 +269,40 @@ Subnet::sumPoolCapacity(const PoolCollection& pools,
     return (sum);
 }
 
+void
+Subnet::buildPoolIndex() {
+    std::map<Lease::Type, PoolCapacity> pool_capacity;
+    for (auto type : { Lease::TYPE_NA, Lease::TYPE_TA, Lease::TYPE_PD }) {
+        const PoolCollection& pools = (type == Lease::TYPE_NA ? pools_ :
+                                       (type == Lease::TYPE_TA ? pools_ta_ :
+                                        pools_pd_));
+        PoolCollection unrestricted;
+        PoolCapacity& capacity = pool_capacity[type];
+        for (auto const& pool : pools) {
+            if (pool->getClientClass().empty()) {
+                unrestricted.push_back(pool);
+            } else {
+                capacity.restricted_.push_back(pool);
+            }
+        }
+        capacity.total_ = sumPoolCapacity(pools);
+        capacity.unrestricted_ = sumPoolCapacity(unrestricted);
+    }
+    pool_capacity_.swap(pool_capacity);
+}
+
+const Subnet::PoolCapacity*
+Subnet::getCachedPoolCapacity(Lease::Type type) const {
+    if (type == Lease::TYPE_V4) {
+        type = Lease::TYPE_NA;
+    }
+    auto capacity = pool_capacity_.find(type);
+    if (capacity == pool_capacity_.end()) {
+        return (0);
+    }
+    return (&capacity->second);
+}
+
 std::pair<IOAddress, uint8_t>
 Subnet::parsePrefixCommon(const std::string& prefix) {
     auto pos = prefix.find('/');
@@ -512,11 +563,15 @@ Subnet::addPool(const PoolPtr& pool) {
     // Sort pools by first address.
     std::sort(pools_writable.begin(), pools_writable.end(),
               comparePoolFirstAddress);
+
+    // The cached pool capacity is stale now.
+    pool_capacity_.clear();
 }
 
 void
 Subnet::delPools(Lease::Type type) {
     getPoolsWritable(type).clear();
+    pool_capacity_.clear();
 }
 
 bool
@@ -527,16 +582,19 @@ Subnet::inPool(Lease::Type type, const isc::asiolink::IOAddress& addr) const {
         return (false);
     }
 
+    // The pools don't overlap and are sorted by first address, so the
+    // only pool which may contain the address is the last one starting
+    // at or before it.
     const PoolCollection& pools = getPools(type);
-
-    for (PoolCollection::const_iterator pool = pools.begin();
-         pool != pools.end(); ++pool) {
-        if ((*pool)->inRange(addr)) {
-            return (true);
-        }
+    PoolCollection::const_iterator ub =
+        std::upper_bound(pools.begin(), pools.end(), addr,
+                         prefixLessThanFirstAddress);
+    if (ub == pools.begin()) {
+        // There's no pool that address belongs to
+        return (false);
     }
-    // There's no pool that address belongs to
-    return (false);
+    --ub;
+    return ((*ub)->inRange(addr));
 }
 
 bool
@@ -550,18 +608,15 @@ Subnet::inPool(Lease::Type type,
     }
 
     const PoolCollection& pools = getPools(type);
-
-    for (PoolCollection::const_iterator pool = pools.begin();
-         pool != pools.end(); ++pool) {
-        if (!(*pool)->clientSupported(client_classes)) {
-            continue;
-        }
-        if ((*pool)->inRange(addr)) {
-            return (true);
-        }
+    PoolCollection::const_iterator ub =
+        std::upper_bound(pools.begin(), pools.end(), addr,
+                         prefixLessThanFirstAddress);
+    if (ub == pools.begin()) {
+        // There's no pool that address belongs to
+        return (false);
     }
-    // There's no pool that address belongs to
-    return (false);
+    --ub;
+    return ((*ub)->inRange(addr) && (*ub)->clientSupported(client_classes));
 }
 
 bool
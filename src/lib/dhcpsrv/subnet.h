@@ -64,6 +64,9 @@ struct Subnet : public virtual Network {
     /// always true. For the given example, 2001::1234:abcd would return
     /// true for inRange(), but false for inPool() check.
     ///
+    /// The pools of a type don't overlap and are sorted by first address,
+    /// so the pool is looked up using binary search.
+    ///
     /// @param type type of pools to iterate over
     /// @param addr this address will be checked if it belongs to any pools in
     ///        that subnet
@@ -238,6 +241,17 @@ struct Subnet : public virtual Network {
     uint64_t getPoolCapacity(Lease::Type type,
                              const ClientClasses& client_classes) const;
 
+    /// @brief Builds the pool capacity index of the subnet.
+    ///
+    /// Caches the capacity of the pools of each type, so
+    /// @c getPoolCapacity doesn't iterate over the pools. The pools
+    /// restricted to a client class are kept aside, because whether they
+    /// count depends on the classes of the client. The index is discarded
+    /// when pools are added or deleted and @c getPoolCapacity sums the
+    /// pools until it is built again. It is built when the configuration
+    /// is committed.
+    void buildPoolIndex();
+
     /// @brief Returns textual representation of the subnet (e.g.
     /// "2001:db8::/64").
     ///
@@ -464,6 +478,26 @@ protected:
     virtual ~Subnet() = default;
 
 private:
+    /// @brief Cached capacity of the pools of a type.
+    struct PoolCapacity {
+        /// @brief Sum of the capacity of all pools.
+        uint64_t total_;
+
+        /// @brief Sum of the capacity of the pools not restricted to
+        /// a client class.
+        uint64_t unrestricted_;
+
+        /// @brief Pools restricted to a client class.
+        PoolCollection restricted_;
+    };
+
+    /// @brief Returns the cached capacity of the pools of a type.
+    ///
+    /// @param type type of the lease
+    /// @return pointer to the cached capacity or null if the pool
+    /// capacity index is not built
+    const PoolCapacity* getCachedPoolCapacity(Lease::Type type) const;
+
     /// @brief Specifies if the subnet-id has automatically been generated
     bool generated_;
 
@@ -482,6 +516,13 @@ private:
     /// @brief collection of IPv6 prefix pools in that subnet.
     PoolCollection pools_pd_;
 
+    /// @brief Cached capacity of the pools by type, empty when the pool
+    /// capacity index is not built.
+    ///
+    /// The IPv4 and non-temporary IPv6 pools are stored under
+    /// @c Lease::TYPE_NA.
+    std::map<Lease::Type, PoolCapacity> pool_capacity_;
+
     /// @brief a prefix of the subnet.
     isc::asiolink::IOAddress prefix_;
 
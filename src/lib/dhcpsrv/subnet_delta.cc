@@ -0,0 +1,502 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/parsers/dhcp_parsers.h>
+#include <dhcpsrv/parsers/host_reservation_parser.h>
+#include <dhcpsrv/parsers/host_reservations_list_parser.h>
+#include <dhcpsrv/parsers/simple_parser4.h>
+#include <dhcpsrv/parsers/simple_parser6.h>
+#include <dhcpsrv/subnet_delta.h>
+#include <util/defer.h>
+#include <util/multi_threading_mgr.h>
+
+#include <map>
+#include <string>
+
+using namespace isc::data;
+using namespace isc::util;
+
+namespace isc {
+namespace dhcp {
+
+namespace {
+
+/// @brief Subnet parser giving access to the reservation checks.
+class DeltaSubnet4Parser : public Subnet4ConfigParser {
+public:
+    using Subnet4ConfigParser::Subnet4ConfigParser;
+
+    /// @brief Checks that the reservation belongs to the subnet.
+    void validateHost(const Subnet4Ptr& subnet, ConstHostPtr host) {
+        validateResv(subnet, host);
+    }
+};
+
+/// @brief Subnet parser giving access to the reservation checks.
+class DeltaSubnet6Parser : public Subnet6ConfigParser {
+public:
+    using Subnet6ConfigParser::Subnet6ConfigParser;
+
+    /// @brief Checks that the reservations belong to the subnet.
+    void validateHost(const Subnet6Ptr& subnet, ConstHostPtr host) {
+        validateResvs(subnet, host);
+    }
+};
+
+/// @brief DHCP space specific parts of @c SubnetDelta.
+template <DhcpSpaceType D>
+struct DeltaTraits {};
+
+template <>
+struct DeltaTraits<DHCP_SPACE_V4> {
+    using SubnetParser = DeltaSubnet4Parser;
+    using HostParser = HostReservationParser4;
+    using SharedNetwork = SharedNetwork4;
+    using SharedNetworkPtr = SharedNetwork4Ptr;
+
+    static std::string const& subnetsKey() {
+        static std::string const _("subnet4");
+        return _;
+    }
+
+    static SimpleDefaults const& defaults() {
+        return (SimpleParser4::SUBNET4_DEFAULTS);
+    }
+
+    static SimpleDefaults const& sharedDefaults() {
+        return (SimpleParser4::SHARED_SUBNET4_DEFAULTS);
+    }
+
+    static ParamsList const& inherited() {
+        return (SimpleParser4::INHERIT_TO_SUBNET4);
+    }
+
+    static void delAllHosts(CfgHostsPtr const& hosts, SubnetID const& subnet_id) {
+        hosts->delAll4(subnet_id);
+    }
+
+    static SharedNetwork4Ptr getNetwork(SrvConfigPtr const& cfg, std::string const& name) {
+        return (cfg->getCfgSharedNetworks4()->getByName(name));
+    }
+
+    /// @brief Checks the parameters which must be the same in all subnets
+    /// of a shared network.
+    static void checkNetwork(SharedNetwork4Ptr const& network,
+                             std::vector<Subnet4Ptr> const&,
+                             Subnet4Ptr const& subnet) {
+        if (subnet->getAuthoritative() != network->getAuthoritative()) {
+            isc_throw(DhcpConfigError, "Subnet " << std::boolalpha
+                      << subnet->toText()
+                      << " has different authoritative setting "
+                      << subnet->getAuthoritative()
+                      << " than the shared-network itself: "
+                      << network->getAuthoritative());
+        }
+    }
+};
+
+template <>
+struct DeltaTraits<DHCP_SPACE_V6> {
+    using SubnetParser = DeltaSubnet6Parser;
+    using HostParser = HostReservationParser6;
+    using SharedNetwork = SharedNetwork6;
+    using SharedNetworkPtr = SharedNetwork6Ptr;
+
+    static std::string const& subnetsKey() {
+        static std::string const _("subnet6");
+        return _;
+    }
+
+    static SimpleDefaults const& defaults() {
+        return (SimpleParser6::SUBNET6_DEFAULTS);
+    }
+
+    static SimpleDefaults const& sharedDefaults() {
+        return (SimpleParser6::SHARED_SUBNET6_DEFAULTS);
+    }
+
+    static ParamsList const& inherited() {
+        return (SimpleParser6::INHERIT_TO_SUBNET6);
+    }
+
+    static void delAllHosts(CfgHostsPtr const& hosts, SubnetID const& subnet_id) {
+        hosts->delAll6(subnet_id);
+    }
+
+    static SharedNetwork6Ptr getNetwork(SrvConfigPtr const& cfg, std::string const& name) {
+        return (cfg->getCfgSharedNetworks6()->getByName(name));
+    }
+
+    /// @brief Checks the parameters which must be the same in all subnets
+    /// of a shared network.
+    static void checkNetwork(SharedNetwork6Ptr const&,
+                             std::vector<Subnet6Ptr> const& subnets,
+                             Subnet6Ptr const& subnet) {
+        for (auto const& other : subnets) {
+            if (other->getID() == subnet->getID()) {
+                continue;
+            }
+            if (other->getRapidCommit() != subnet->getRapidCommit()) {
+                isc_throw(DhcpConfigError, "All subnets in a shared network "
+                          "must have the same rapid-commit value. Subnet "
+                          << subnet->toText()
+                          << " has specified rapid-commit "
+                          << (subnet->getRapidCommit() ? "true" : "false")
+                          << ", but other subnets in the same shared-network"
+                          << " use rapid-commit "
+                          << (other->getRapidCommit() ? "true" : "false"));
+            }
+            break;
+        }
+    }
+};
+
+/// @brief Checks that the subnet uses the interface of its shared network.
+///
+/// @param network Shared network the subnet belongs to.
+/// @param subnets Subnets of the shared network after the changes.
+/// @param subnet Added or replacing subnet.
+template <typename SharedNetworkPtrType, typename SubnetPtrType>
+void
+checkNetworkInterface(SharedNetworkPtrType const& network,
+                      std::vector<SubnetPtrType> const& subnets,
+                      SubnetPtrType const& subnet) {
+    std::string subnet_iface = subnet->getIface();
+    if (subnet_iface.empty()) {
+        return;
+    }
+    std::string iface = network->getIface();
+    if (iface.empty()) {
+        for (auto const& other : subnets) {
+            if (other->getID() == subnet->getID()) {
+                continue;
+            }
+            iface = other->getIface();
+            if (!iface.empty()) {
+                break;
+            }
+        }
+    }
+    if (!iface.empty() && (iface != subnet_iface)) {
+        isc_throw(DhcpConfigError, "Subnet " << subnet->toText()
+                  << " has specified interface " << subnet_iface
+                  << ", but other subnets in the same shared-network"
+                  << " or the shared-network itself use " << iface);
+    }
+}
+
+} // end of anonymous namespace
+
+template <DhcpSpaceType D>
+SubnetDelta<D>::SubnetDelta(bool check_iface)
+    : check_iface_(check_iface), subnets_(), added_(), replaced_(), deleted_(),
+      network_deletions_(), network_replacements_(), network_additions_(),
+      hosts_() {
+}
+
+template <DhcpSpaceType D>
+void
+SubnetDelta<D>::parse(SrvConfigPtr const& cfg, ElementPtr const& arguments) {
+    using Traits = DeltaTraits<D>;
+
+    if (!arguments || (arguments->getType() != Element::map)) {
+        isc_throw(BadValue, "arguments must be a map");
+    }
+    ElementPtr subnets = arguments->get(Traits::subnetsKey());
+    if (subnets && (subnets->getType() != Element::list)) {
+        isc_throw(BadValue, "'" << Traits::subnetsKey() << "' must be a list");
+    }
+    ElementPtr deleted = arguments->get("deleted-subnets");
+    if (deleted && (deleted->getType() != Element::list)) {
+        isc_throw(BadValue, "'deleted-subnets' must be a list");
+    }
+
+    // The changes are applied to a copy, the subnets themselves are shared.
+    subnets_ = std::make_shared<CfgSubnetsT<D>>(*cfg->template getCfgSubnets<D>());
+
+    // Shared networks of the deleted subnets, which get them back when
+    // added again.
+    std::map<SubnetID, typename Traits::SharedNetworkPtr> former_networks;
+
+    if (deleted) {
+        for (auto const& id : deleted->listValue()) {
+            if (id->getType() != Element::integer) {
+                isc_throw(BadValue, "'deleted-subnets' must contain subnet identifiers");
+            }
+            SubnetID const subnet_id(static_cast<SubnetID>(id->intValue()));
+            SubnetTPtr<D> const& existing(subnets_->getSubnet(subnet_id));
+            if (!existing) {
+                isc_throw(BadValue, "no subnet with ID of '" << subnet_id << "' found");
+            }
+            typename Traits::SharedNetworkPtr network;
+            existing->getSharedNetwork(network);
+            if (network) {
+                network_deletions_.push_back(std::make_pair(network, subnet_id));
+                former_networks[subnet_id] = network;
+            }
+            subnets_->del(subnet_id);
+            deleted_.insert(subnet_id);
+        }
+    }
+
+    if (!subnets) {
+        return;
+    }
+
+    // The subnet parsers look up the option definitions and store the host
+    // reservations in the staging configuration. Start from a clean one
+    // holding the option definitions of the current configuration, and
+    // discard it when done.
+    CfgMgr::instance().rollback();
+    isc::util::Defer _([] { CfgMgr::instance().rollback(); });
+    SrvConfigPtr const& staging(CfgMgr::instance().getStagingCfg());
+    cfg->getCfgOptionDef()->copyTo(*staging->getCfgOptionDef());
+
+    for (auto const& subnet_json : subnets->listValue()) {
+        if (subnet_json->getType() != Element::map) {
+            isc_throw(BadValue, "'" << Traits::subnetsKey() << "' must contain maps");
+        }
+        ElementPtr id = subnet_json->get("id");
+        if (!id || (id->getType() != Element::integer) || (id->intValue() <= 0)) {
+            isc_throw(DhcpConfigError, "subnet must have a non-zero 'id' ("
+                      << subnet_json->getPosition() << ")");
+        }
+        SubnetID const subnet_id(static_cast<SubnetID>(id->intValue()));
+        if (added_.count(subnet_id) || replaced_.count(subnet_id)) {
+            isc_throw(DhcpConfigError, "subnet with ID of '" << subnet_id
+                      << "' specified twice (" << subnet_json->getPosition() << ")");
+        }
+
+        // The existing subnet and its shared network, if any.
+        SubnetTPtr<D> const& existing(subnets_->getSubnet(subnet_id));
+        typename Traits::SharedNetworkPtr current;
+        if (existing) {
+            existing->getSharedNetwork(current);
+        } else if (former_networks.count(subnet_id)) {
+            current = former_networks[subnet_id];
+        }
+
+        // The subnet stays in its shared network unless another one is
+        // specified.
+        typename Traits::SharedNetworkPtr network(current);
+        ElementPtr const& subnet_copy(isc::data::copy(subnet_json));
+        ElementPtr const& network_name(subnet_copy->get("shared-network-name"));
+        if (network_name) {
+            if (network_name->getType() != Element::string) {
+                isc_throw(DhcpConfigError, "'shared-network-name' must be a string ("
+                          << network_name->getPosition() << ")");
+            }
+            subnet_copy->remove("shared-network-name");
+            network.reset();
+            if (!network_name->stringValue().empty()) {
+                network = Traits::getNetwork(cfg, network_name->stringValue());
+                if (!network) {
+                    isc_throw(DhcpConfigError, "no shared network with the name of '"
+                              << network_name->stringValue() << "' found ("
+                              << network_name->getPosition() << ")");
+                }
+            }
+        }
+
+        // Set the defaults and derive the parameters from the shared network
+        // or the globals, like the configuration parser does.
+        ElementPtr const& reservations(subnet_copy->get("reservations"));
+        if (reservations) {
+            subnet_copy->remove("reservations");
+        }
+        if (network) {
+            SimpleParser::setDefaults(subnet_copy, Traits::sharedDefaults());
+            SimpleParser::deriveParams(network->toElement(), subnet_copy, Traits::inherited());
+        } else {
+            SimpleParser::setDefaults(subnet_copy, Traits::defaults());
+        }
+        SimpleParser::deriveParams(cfg->getConfiguredGlobals(), subnet_copy,
+                                   Traits::inherited());
+
+        typename Traits::SubnetParser parser(check_iface_);
+        SubnetTPtr<D> subnet;
+        try {
+            subnet = parser.parse(subnet_copy);
+        } catch (DhcpConfigError const&) {
+            throw;
+        } catch (std::exception const& ex) {
+            isc_throw(DhcpConfigError, ex.what() << " ("
+                      << subnet_json->getPosition() << ")");
+        }
+
+        // Check the reservations against the subnet.
+        if (reservations) {
+            HostCollection hosts;
+            HostReservationsListParser<typename Traits::HostParser> hosts_parser;
+            hosts_parser.parse(subnet_id, reservations, hosts);
+            for (auto const& host : hosts) {
+                parser.validateHost(subnet, host);
+                // Detects duplicates within the subnet.
+                staging->getCfgHosts()->add(host);
+                hosts_.push_back(host);
+            }
+        }
+
+        try {
+            if (existing) {
+                // The prefix may be used by another subnet.
+                auto const& same_prefix(subnets_->getByPrefix(subnet->toText()));
+                if (same_prefix && (same_prefix->getID() != subnet_id)) {
+                    isc_throw(DuplicateSubnetID, "subnet with the prefix of '"
+                              << subnet->toText() << "' already exists");
+                }
+                if (network && (network == current)) {
+                    network_replacements_.push_back(std::make_pair(network, subnet));
+                } else {
+                    if (current) {
+                        network_deletions_.push_back(std::make_pair(current, subnet_id));
+                    }
+                    if (network) {
+                        network_additions_.push_back(std::make_pair(network, subnet));
+                    }
+                }
+                subnets_->replace(subnet);
+                replaced_.insert(subnet_id);
+            } else {
+                subnets_->add(subnet);
+                if (network) {
+                    network_additions_.push_back(std::make_pair(network, subnet));
+                }
+                added_.insert(subnet_id);
+            }
+        } catch (DhcpConfigError const&) {
+            throw;
+        } catch (std::exception const& ex) {
+            isc_throw(DhcpConfigError, ex.what() << " ("
+                      << subnet_json->getPosition() << ")");
+        }
+    }
+
+    // Check the subnets put in shared networks against the other subnets
+    // of the networks, as they will be after the changes.
+    for (auto const* changes : {&network_replacements_, &network_additions_}) {
+        for (auto const& [network_ptr, subnet] : *changes) {
+            typename Traits::SharedNetworkPtr network;
+            network = std::dynamic_pointer_cast<typename Traits::SharedNetwork>(network_ptr);
+            std::vector<SubnetTPtr<D>> const& network_subnets(getNetworkSubnets(network));
+            checkNetworkInterface(network, network_subnets, subnet);
+            Traits::checkNetwork(network, network_subnets, subnet);
+        }
+    }
+}
+
+template <DhcpSpaceType D>
+std::vector<SubnetTPtr<D>>
+SubnetDelta<D>::getNetworkSubnets(NetworkPtr const& network) const {
+    using Traits = DeltaTraits<D>;
+
+    std::vector<SubnetTPtr<D>> subnets;
+    auto const& shared_network(std::dynamic_pointer_cast<typename Traits::SharedNetwork>(network));
+    for (auto const& subnet : *shared_network->getAllSubnets()) {
+        bool removed(false);
+        for (auto const& [deleted_network, subnet_id] : network_deletions_) {
+            if ((deleted_network == network) && (subnet_id == subnet->getID())) {
+                removed = true;
+                break;
+            }
+        }
+        if (removed) {
+            continue;
+        }
+        SubnetTPtr<D> member(subnet);
+        for (auto const& [replaced_network, replacement] : network_replacements_) {
+            if ((replaced_network == network) && (replacement->getID() == subnet->getID())) {
+                member = replacement;
+                break;
+            }
+        }
+        subnets.push_back(member);
+    }
+    for (auto const& [added_network, subnet] : network_additions_) {
+        if (added_network == network) {
+            subnets.push_back(subnet);
+        }
+    }
+    return (subnets);
+}
+
+template <DhcpSpaceType D>
+void
+SubnetDelta<D>::apply(SrvConfigPtr const& cfg) {
+    using Traits = DeltaTraits<D>;
+
+    if (!subnets_) {
+        return;
+    }
+
+    // The shared networks and the subnets are used by the packet processing.
+    MultiThreadingCriticalSection cs;
+
+    // The cached options refer to the option configurations of the subnets
+    // and shared networks, forget them even if something below fails.
+    isc::util::Defer _([&cfg] { cfg->getResolvedOptionsCache()->clear(); });
+
+    // Update the shared networks. The deletions go first so a subnet deleted
+    // and added again can be put back in its shared network.
+    for (auto const& [network, subnet_id] : network_deletions_) {
+        std::dynamic_pointer_cast<typename Traits::SharedNetwork>(network)->del(subnet_id);
+    }
+    for (auto const& [network, subnet] : network_replacements_) {
+        std::dynamic_pointer_cast<typename Traits::SharedNetwork>(network)->replace(subnet);
+    }
+    for (auto const& [network, subnet] : network_additions_) {
+        std::dynamic_pointer_cast<typename Traits::SharedNetwork>(network)->add(subnet);
+    }
+
+    // Install the subnets.
+    cfg->template setCfgSubnets<D>(subnets_);
+
+    // Replace the host reservations of the changed subnets.
+    CfgHostsPtr const& cfg_hosts(cfg->getCfgHosts());
+    for (auto const* ids : {&deleted_, &replaced_, &added_}) {
+        for (SubnetID const& subnet_id : *ids) {
+            Traits::delAllHosts(cfg_hosts, subnet_id);
+        }
+    }
+    for (auto const& host : hosts_) {
+        cfg_hosts->add(host);
+    }
+
+    // Update the statistics of the changed subnets only.
+    for (SubnetID const& subnet_id : deleted_) {
+        if (!added_.count(subnet_id)) {
+            subnets_->removeStatistics(subnet_id);
+        }
+    }
+    for (SubnetID const& subnet_id : replaced_) {
+        subnets_->updateStatistics(subnet_id, false);
+    }
+    for (SubnetID const& subnet_id : added_) {
+        subnets_->updateStatistics(subnet_id, true);
+    }
+
+    subnets_->buildSelectionIndex();
+}
+
+template class SubnetDelta<DHCP_SPACE_V4>;
+template class SubnetDelta<DHCP_SPACE_V6>;
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
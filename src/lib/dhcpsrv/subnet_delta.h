@@ -0,0 +1,145 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef SUBNET_DELTA_H
+#define SUBNET_DELTA_H
+
+#include <cc/data.h>
+#include <dhcpsrv/host.h>
+#include <dhcpsrv/srv_config.h>
+#include <dhcpsrv/subnet.h>
+#include <dhcpsrv/subnet_id.h>
+#include <util/dhcp.h>
+
+#include <memory>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Subnet level changes applied to the current configuration.
+///
+/// Backs the subnet4-delta-apply and subnet6-delta-apply commands which
+/// add, replace and delete subnets without reparsing the whole server
+/// configuration. The arguments of the commands are:
+///
+/// @code
+/// {
+///     "subnet4": [ { "id": 1, "subnet": "192.0.2.0/24", ... } ],
+///     "deleted-subnets": [ 2, 3 ]
+/// }
+/// @endcode
+///
+/// The subnets are matched by their identifiers, which are mandatory. A
+/// subnet with the identifier of an existing subnet replaces it, also in
+/// the shared network the existing subnet belongs to. The deletions are
+/// processed before the additions, so a subnet may be deleted and added
+/// again when its prefix changes: it then goes back to the shared network
+/// it belonged to. The optional "shared-network-name" parameter of a
+/// subnet names the existing shared network the subnet is put in, or is
+/// empty to take the subnet out of its shared network.
+///
+/// The changes are applied in two steps. @c parse builds and validates a
+/// copy of the subnets of the configuration, so an error leaves the
+/// configuration untouched. Only the changed subnets are parsed and
+/// validated: the global parameters and option definitions are taken
+/// from the current configuration. @c apply installs the copy and updates
+/// the shared networks, host reservations and statistics of the changed
+/// subnets. The shared networks are used by the packet processing, so
+/// @c apply stops it in a multi-threading critical section.
+///
+/// @tparam D DHCP space, i.e. DHCPv4 or DHCPv6.
+template <DhcpSpaceType D>
+class SubnetDelta {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param check_iface Check if the interfaces of the subnets exist.
+    explicit SubnetDelta(bool check_iface = true);
+
+    /// @brief Parses and validates the changes.
+    ///
+    /// @param cfg Configuration the changes are applied to.
+    /// @param arguments Arguments of the command.
+    /// @throw DhcpConfigError or BadValue if the changes are invalid.
+    void parse(SrvConfigPtr const& cfg, isc::data::ElementPtr const& arguments);
+
+    /// @brief Applies the parsed changes.
+    ///
+    /// @param cfg Configuration passed to @c parse.
+    void apply(SrvConfigPtr const& cfg);
+
+    /// @brief Returns the number of added subnets.
+    size_t getAddedCount() const {
+        return (added_.size());
+    }
+
+    /// @brief Returns the number of replaced subnets.
+    size_t getReplacedCount() const {
+        return (replaced_.size());
+    }
+
+    /// @brief Returns the number of deleted subnets.
+    size_t getDeletedCount() const {
+        return (deleted_.size());
+    }
+
+private:
+
+    /// @brief Returns the subnets of a shared network as they will be after
+    /// the changes.
+    ///
+    /// @param network Shared network.
+    std::vector<SubnetTPtr<D>> getNetworkSubnets(NetworkPtr const& network) const;
+
+    /// @brief Check if the interfaces of the subnets exist.
+    bool check_iface_;
+
+    /// @brief Copy of the subnets with the changes applied.
+    std::shared_ptr<CfgSubnetsT<D>> subnets_;
+
+    /// @brief Identifiers of the added subnets.
+    std::set<SubnetID> added_;
+
+    /// @brief Identifiers of the replaced subnets.
+    std::set<SubnetID> replaced_;
+
+    /// @brief Identifiers of the deleted subnets.
+    std::set<SubnetID> deleted_;
+
+    /// @brief Identifiers of the subnets removed from shared networks, with
+    /// the shared networks.
+    std::vector<std::pair<NetworkPtr, SubnetID>> network_deletions_;
+
+    /// @brief Subnets replacing the subnets of shared networks, with the
+    /// shared networks.
+    std::vector<std::pair<NetworkPtr, SubnetTPtr<D>>> network_replacements_;
+
+    /// @brief Subnets added to shared networks, with the shared networks.
+    std::vector<std::pair<NetworkPtr, SubnetTPtr<D>>> network_additions_;
+
+    /// @brief Host reservations of the added and replaced subnets.
+    HostCollection hosts_;
+};
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
+
+#endif // SUBNET_DELTA_H
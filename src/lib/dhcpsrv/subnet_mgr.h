@@ -38,6 +38,7 @@
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace isc {
@@ -658,6 +659,80 @@ struct SubnetMgr {
     virtual void update(SubnetInfoPtr<D>& subnet, std::string const& config_timestamp_path) = 0;
     /// @}
 
+    /// @brief the batch interface
+    ///
+    /// The default implementations go row by row. Backends override them to
+    /// save the round trips to the database: the SQL backends select and
+    /// delete with a single statement per IN-list, Cassandra keeps several
+    /// statements in flight.
+    /// @{
+    virtual SubnetInfoCollection<D>
+    selectBySubnets(std::vector<std::string>& subnets,
+                    std::string const& config_timestamp_path = std::string()) {
+        SubnetInfoCollection<D> collection;
+        for (std::string& subnet : subnets) {
+            SubnetInfoPtr<D> info(selectBySubnet(subnet, config_timestamp_path));
+            if (info) {
+                collection.push_back(info);
+            }
+        }
+        return collection;
+    }
+
+    /// @throw StatementNotApplied after all the other subnets have been deleted if any of them
+    ///     couldn't be deleted
+    virtual void delBatch(SubnetInfoCollection<D>& subnets,
+                          std::string const& config_timestamp_path) {
+        std::string not_applied;
+        for (SubnetInfoPtr<D>& subnet : subnets) {
+            try {
+                del(subnet, config_timestamp_path);
+            } catch (isc::db::StatementNotApplied const&) {
+                if (not_applied.empty()) {
+                    not_applied = subnet->strings_.subnet_;
+                }
+            }
+        }
+        if (!not_applied.empty()) {
+            isc_throw(isc::db::StatementNotApplied,
+                      PRETTY_METHOD_NAME() << ": subnet " << not_applied
+                                           << " has not been deleted");
+        }
+    }
+
+    /// @return flags indicating which subnets have been inserted, false for duplicates
+    virtual std::vector<bool> insertBatch(SubnetInfoCollection<D>& subnets,
+                                          std::string const& config_timestamp_path) {
+        std::vector<bool> applied;
+        applied.reserve(subnets.size());
+        for (SubnetInfoPtr<D>& subnet : subnets) {
+            try {
+                insert(subnet, config_timestamp_path);
+                applied.push_back(true);
+            } catch (isc::db::DuplicateEntry const&) {
+                applied.push_back(false);
+            }
+        }
+        return applied;
+    }
+
+    /// @return flags indicating which subnets have been updated
+    virtual std::vector<bool> updateBatch(SubnetInfoCollection<D>& subnets,
+                                          std::string const& config_timestamp_path) {
+        std::vector<bool> applied;
+        applied.reserve(subnets.size());
+        for (SubnetInfoPtr<D>& subnet : subnets) {
+            try {
+                update(subnet, config_timestamp_path);
+                applied.push_back(true);
+            } catch (isc::db::StatementNotApplied const&) {
+                applied.push_back(false);
+            }
+        }
+        return applied;
+    }
+    /// @}
+
     virtual void commit() = 0;
     virtual void rollback() = 0;
     virtual std::string getName() const = 0;
@@ -672,6 +747,19 @@ struct SubnetMgr {
         }
     }
 
+    void upsertBatch(SubnetInfoCollection<D>& subnets, std::string const& config_timestamp_path) {
+        std::vector<bool> const& updated(updateBatch(subnets, config_timestamp_path));
+        SubnetInfoCollection<D> missing;
+        for (size_t i = 0; i < subnets.size(); ++i) {
+            if (!updated[i]) {
+                missing.push_back(subnets[i]);
+            }
+        }
+        for (SubnetInfoPtr<D>& subnet : missing) {
+            insert(subnet, config_timestamp_path);
+        }
+    }
+
     /// @brief Abstractions
     void syncSubnets(std::string const& config_timestamp_path) {
         // Retrieve subnets first.
@@ -682,24 +770,21 @@ struct SubnetMgr {
             CfgMgr::instance().getStagingCfg()->getCfgSubnets<D>()->getAll());
 
         // Delete extra subnets.
+        std::unordered_set<std::string> new_prefixes;
+        for (SubnetTPtr<D> const& subnet : *new_subnets) {
+            new_prefixes.insert(subnet->toText());
+        }
+        SubnetInfoCollection<D> extra_subnets;
         for (SubnetInfoPtr<D>& database_subnet : subnets) {
-            bool found(false);
-            for (SubnetTPtr<D> const& subnet : *new_subnets) {
-                if (database_subnet->strings_.subnet_ == subnet->toText()) {
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) {
-                del(database_subnet, config_timestamp_path);
+            if (!new_prefixes.count(database_subnet->strings_.subnet_)) {
+                extra_subnets.push_back(database_subnet);
             }
         }
+        delBatch(extra_subnets, config_timestamp_path);
 
         // Upsert actual subnets.
-        for (SubnetTPtr<D> const& subnet : *new_subnets) {
-            SubnetInfoPtr<D> info(std::make_shared<SubnetInfo<D>>(subnet));
-            upsert(info, config_timestamp_path);
-        }
+        SubnetInfoCollection<D> infos(toSubnetInfos(*new_subnets));
+        upsertBatch(infos, config_timestamp_path);
     }
 
     void addSubnets(std::string const& config_timestamp_path) {
@@ -709,18 +794,18 @@ struct SubnetMgr {
 
         Subnet::setSubnetID(maxSubnetID());
         Subnet::generateNextID();
+        SubnetInfoCollection<D> infos;
+        infos.reserve(new_subnets->size());
         for (SubnetTPtr<D> const& subnet : *new_subnets) {
-            try {
-                SubnetInfoPtr<D> info(std::make_shared<SubnetInfo<D>>(subnet));
-                if (subnet->generated()) {
-                    info->id_ = Subnet::generateNextID();
-                }
-                insert(info, config_timestamp_path);
-            } catch (isc::db::DuplicateEntry const& exception) {
-                // A duplicate was being inserted. Duplicates are expected.
-                // Carry on.
+            SubnetInfoPtr<D> info(std::make_shared<SubnetInfo<D>>(subnet));
+            if (subnet->generated()) {
+                info->id_ = Subnet::generateNextID();
             }
+            infos.push_back(info);
         }
+
+        // Duplicates are expected, they are not inserted.
+        insertBatch(infos, config_timestamp_path);
     }
 
     void delSubnets(std::string const& config_timestamp_path) {
@@ -728,10 +813,8 @@ struct SubnetMgr {
         SubnetCollection<D> const* new_subnets(
             CfgMgr::instance().getStagingCfg()->getCfgSubnets<D>()->getAll());
 
-        for (SubnetTPtr<D> const& subnet : *new_subnets) {
-            SubnetInfoPtr<D> info(std::make_shared<SubnetInfo<D>>(subnet));
-            del(info, config_timestamp_path);
-        }
+        SubnetInfoCollection<D> infos(toSubnetInfos(*new_subnets));
+        delBatch(infos, config_timestamp_path);
     }
 
     void setSubnets(std::string const& config_timestamp_path) {
@@ -740,11 +823,24 @@ struct SubnetMgr {
             CfgMgr::instance().getStagingCfg()->getCfgSubnets<D>()->getAll());
 
         // Update.
-        isc::db::TimestampStore config_timestamp(config_timestamp_path);
-        for (SubnetTPtr<D> const& subnet : *new_subnets) {
-            SubnetInfoPtr<D> info(std::make_shared<SubnetInfo<D>>(subnet));
-            update(info, config_timestamp_path);
+        SubnetInfoCollection<D> infos(toSubnetInfos(*new_subnets));
+        std::vector<bool> const& updated(updateBatch(infos, config_timestamp_path));
+        for (size_t i = 0; i < infos.size(); ++i) {
+            if (!updated[i]) {
+                isc_throw(isc::db::StatementNotApplied,
+                          PRETTY_METHOD_NAME() << ": subnet " << infos[i]->strings_.subnet_
+                                               << " has not been updated");
+            }
+        }
+    }
+
+    static SubnetInfoCollection<D> toSubnetInfos(SubnetCollection<D> const& subnets) {
+        SubnetInfoCollection<D> infos;
+        infos.reserve(subnets.size());
+        for (SubnetTPtr<D> const& subnet : subnets) {
+            infos.push_back(std::make_shared<SubnetInfo<D>>(subnet));
         }
+        return infos;
     }
     /// @}
 
@@ -25,6 +25,7 @@
 #include <dhcpsrv/subnet_mgr.h>
 #include <exceptions/exceptions.h>
 
+#include <memory>
 #include <string>
 
 #ifdef HAVE_MYSQL
@@ -92,6 +93,19 @@ public:
     /// @throw isc::dhcp::InvalidType The "type" keyword in dbaccess does not
     ///        identify a supported backend.
     static void create(const std::string& dbaccess) {
+        getSubnetMgrPtr() = createInstance(dbaccess);
+    }
+
+    /// @brief Create a subnet manager which is not the "current" one.
+    ///
+    /// Unlike @ref create, it leaves the current subnet manager alone so that
+    /// each shard can have its own subnet manager, e.g. when the shards are
+    /// processed concurrently.
+    ///
+    /// @param dbaccess Database access parameters, see @ref create.
+    ///
+    /// @return the new subnet manager
+    static std::unique_ptr<SubnetMgr<D>> createInstance(const std::string& dbaccess) {
         const std::string type = "type";
 
         // Parse the access std::string and create a redacted string for logging.
@@ -108,28 +122,24 @@ public:
         // Yes, check what it is.
 #ifdef HAVE_MYSQL
         if (parameters[type] == std::string("mysql")) {
-            getSubnetMgrPtr().reset(new MySqlSubnetMgr<D>(parameters));
-            return;
+            return std::make_unique<MySqlSubnetMgr<D>>(parameters);
         }
 #endif
 #ifdef HAVE_PGSQL
         if (parameters[type] == std::string("postgresql")) {
             LOG_INFO(dhcpsrv_logger, DHCPSRV_PGSQL_SUBNET_DB).arg(redacted);
-            getSubnetMgrPtr().reset(new PgSqlSubnetMgr<D>(parameters));
-            return;
+            return std::make_unique<PgSqlSubnetMgr<D>>(parameters);
         }
 #endif
 #ifdef HAVE_CQL
         if (parameters[type] == std::string("cql")) {
             LOG_INFO(dhcpsrv_logger, DHCPSRV_CQL_SUBNET_DB).arg(redacted);
-            getSubnetMgrPtr().reset(new CqlSubnetMgr<D>(parameters));
-            return;
+            return std::make_unique<CqlSubnetMgr<D>>(parameters);
         }
 #endif
         if (parameters[type] == std::string("memfile")) {
             LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_SUBNET_DB).arg(redacted);
-            getSubnetMgrPtr().reset(new MemfileSubnetMgr<D>(parameters));
-            return;
+            return std::make_unique<MemfileSubnetMgr<D>>(parameters);
         }
 
         // Get here on no match
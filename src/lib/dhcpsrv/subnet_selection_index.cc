@@ -0,0 +1,150 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <dhcpsrv/subnet_selection_index.h>
+
+#include <algorithm>
+
+using namespace isc::asiolink;
+
+namespace isc {
+namespace dhcp {
+
+namespace {
+
+/// @brief Returned when there are no candidates.
+const SubnetSelectionIndex::Positions NO_POSITIONS;
+
+/// @brief Appends a position keeping the positions sorted and unique.
+///
+/// The subnets are indexed in the configuration order, so the position is
+/// usually appended at the end.
+void
+insertPosition(SubnetSelectionIndex::Positions& positions, const uint32_t position) {
+    if (positions.empty() || positions.back() < position) {
+        positions.push_back(position);
+        return;
+    }
+    auto it = std::lower_bound(positions.begin(), positions.end(), position);
+    if (it == positions.end() || *it != position) {
+        positions.insert(it, position);
+    }
+}
+
+}  // namespace
+
+void
+SubnetSelectionIndex::addPrefix(const IOAddress& prefix, const uint8_t length,
+                                const uint32_t position) {
+    insertPosition(prefixes_[length][mask(toKey(prefix), length, prefix.isV4())], position);
+}
+
+void
+SubnetSelectionIndex::addRelay(const IOAddress& relay, const uint32_t position) {
+    insertPosition(relays_[toKey(relay)], position);
+}
+
+void
+SubnetSelectionIndex::addInterface(const std::string& iface, const uint32_t position) {
+    insertPosition(interfaces_[iface], position);
+}
+
+void
+SubnetSelectionIndex::addInterfaceId(const OptionPtr& interface_id, const uint32_t position) {
+    insertPosition(interface_ids_[toKey(interface_id)], position);
+}
+
+SubnetSelectionIndex::Positions
+SubnetSelectionIndex::prefixCandidates(const IOAddress& address) const {
+    Positions result;
+    const Key key = toKey(address);
+    const bool v4 = address.isV4();
+    for (auto const& prefixes : prefixes_) {
+        auto it = prefixes.second.find(mask(key, prefixes.first, v4));
+        if (it != prefixes.second.end()) {
+            result.insert(result.end(), it->second.begin(), it->second.end());
+        }
+    }
+    // Longest prefixes were collected first, the caller wants them in the
+    // configuration order.
+    std::sort(result.begin(), result.end());
+    return (result);
+}
+
+const SubnetSelectionIndex::Positions&
+SubnetSelectionIndex::relayCandidates(const IOAddress& relay) const {
+    auto it = relays_.find(toKey(relay));
+    return (it != relays_.end() ? it->second : NO_POSITIONS);
+}
+
+const SubnetSelectionIndex::Positions&
+SubnetSelectionIndex::interfaceCandidates(const std::string& iface) const {
+    auto it = interfaces_.find(iface);
+    return (it != interfaces_.end() ? it->second : NO_POSITIONS);
+}
+
+const SubnetSelectionIndex::Positions&
+SubnetSelectionIndex::interfaceIdCandidates(const OptionPtr& interface_id) const {
+    auto it = interface_ids_.find(toKey(interface_id));
+    return (it != interface_ids_.end() ? it->second : NO_POSITIONS);
+}
+
+SubnetSelectionIndex::Key
+SubnetSelectionIndex::toKey(const IOAddress& address) {
+    if (address.isV4()) {
+        return (Key(0, address.toUint32()));
+    }
+    const std::vector<uint8_t>& bytes = address.toBytes();
+    Key key(0, 0);
+    for (size_t i = 0; i < 8; ++i) {
+        key.first = (key.first << 8) | bytes[i];
+        key.second = (key.second << 8) | bytes[i + 8];
+    }
+    return (key);
+}
+
+SubnetSelectionIndex::Key
+SubnetSelectionIndex::mask(const Key& key, const uint8_t length, const bool v4) {
+    if (v4) {
+        if (length == 0) {
+            return (Key(0, 0));
+        }
+        const uint64_t bits = length >= 32 ? 0xffffffffULL :
+            (0xffffffffULL << (32 - length)) & 0xffffffffULL;
+        return (Key(0, key.second & bits));
+    }
+    if (length == 0) {
+        return (Key(0, 0));
+    }
+    if (length <= 64) {
+        const uint64_t bits = length == 64 ? ~0ULL : ~0ULL << (64 - length);
+        return (Key(key.first & bits, 0));
+    }
+    const uint64_t bits = length >= 128 ? ~0ULL : ~0ULL << (128 - length);
+    return (Key(key.first, key.second & bits));
+}
+
+std::string
+SubnetSelectionIndex::toKey(const OptionPtr& interface_id) {
+    const OptionBuffer& data = interface_id->getData();
+    return (std::string(data.begin(), data.end()));
+}
+
+}  // namespace dhcp
+}  // namespace isc
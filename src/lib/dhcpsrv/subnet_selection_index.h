@@ -0,0 +1,124 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef SUBNET_SELECTION_INDEX_H
+#define SUBNET_SELECTION_INDEX_H
+
+#include <asiolink/io_address.h>
+#include <dhcp/option.h>
+
+#include <boost/functional/hash.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Lookup structures for subnet selection.
+///
+/// The index refers to the subnets by their position in the configuration,
+/// i.e. in the order in which @c CfgSubnets4 and @c CfgSubnets6 iterate over
+/// them. Every lookup returns the positions of all the candidate subnets in
+/// ascending order, so the caller can apply client class filtering and pick
+/// the first supported subnet exactly as the linear scans over the subnets do.
+///
+/// The prefix lookup is a longest prefix match over hash tables holding the
+/// prefixes of the same length. A lookup costs one hash probe per distinct
+/// prefix length in the configuration, which is a handful in practice, rather
+/// than one comparison per subnet.
+class SubnetSelectionIndex {
+public:
+    /// @brief Sorted positions of candidate subnets.
+    typedef std::vector<uint32_t> Positions;
+
+    /// @brief Indexes the prefix of a subnet.
+    ///
+    /// @param prefix subnet prefix
+    /// @param length prefix length
+    /// @param position position of the subnet in the configuration
+    void addPrefix(const asiolink::IOAddress& prefix, const uint8_t length,
+                   const uint32_t position);
+
+    /// @brief Indexes a relay address of a subnet or of its shared network.
+    void addRelay(const asiolink::IOAddress& relay, const uint32_t position);
+
+    /// @brief Indexes an interface name of a subnet or of its shared network.
+    void addInterface(const std::string& iface, const uint32_t position);
+
+    /// @brief Indexes the interface id option of a subnet.
+    void addInterfaceId(const OptionPtr& interface_id, const uint32_t position);
+
+    /// @brief Returns the subnets whose prefix includes the address.
+    Positions prefixCandidates(const asiolink::IOAddress& address) const;
+
+    /// @brief Returns the subnets matching the relay address.
+    const Positions& relayCandidates(const asiolink::IOAddress& relay) const;
+
+    /// @brief Returns the subnets matching the interface name.
+    const Positions& interfaceCandidates(const std::string& iface) const;
+
+    /// @brief Returns the subnets which may match the interface id.
+    ///
+    /// The candidates have an interface id with the same data, the caller
+    /// still compares the options.
+    const Positions& interfaceIdCandidates(const OptionPtr& interface_id) const;
+
+private:
+    /// @brief Address or prefix as a 128 bit number, IPv4 in the low bits.
+    typedef std::pair<uint64_t, uint64_t> Key;
+
+    /// @brief Hash of the keys.
+    typedef boost::hash<Key> KeyHash;
+
+    /// @brief Positions indexed by address.
+    typedef std::unordered_map<Key, Positions, KeyHash> AddressMap;
+
+    /// @brief Returns the key of an address.
+    static Key toKey(const asiolink::IOAddress& address);
+
+    /// @brief Returns the key of a prefix, i.e. the key with the bits beyond
+    /// the prefix length cleared.
+    static Key mask(const Key& key, const uint8_t length, const bool v4);
+
+    /// @brief Returns the key of an interface id option.
+    static std::string toKey(const OptionPtr& interface_id);
+
+    /// @brief Prefixes by prefix length, longest first.
+    std::map<uint8_t, AddressMap, std::greater<uint8_t>> prefixes_;
+
+    /// @brief Subnets by relay address.
+    AddressMap relays_;
+
+    /// @brief Subnets by interface name.
+    std::unordered_map<std::string, Positions> interfaces_;
+
+    /// @brief Subnets by interface id data.
+    std::unordered_map<std::string, Positions> interface_ids_;
+};
+
+/// @brief Pointer to the subnet selection index.
+typedef std::shared_ptr<const SubnetSelectionIndex> ConstSubnetSelectionIndexPtr;
+
+}  // namespace dhcp
+}  // namespace isc
+
+#endif  // SUBNET_SELECTION_INDEX_H
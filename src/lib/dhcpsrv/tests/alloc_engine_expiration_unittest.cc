@@ -12,6 +12,7 @@
 #include <dhcpsrv/tests/test_utils.h>
 #include <hooks/hooks_manager.h>
 #include <stats/stats_mgr.h>
+#include <testutils/multi_threading_utils.h>
 #include <gtest/gtest.h>
 #include <boost/static_assert.hpp>
 #include <functional>
@@ -29,6 +30,8 @@ using namespace isc::dhcp::test;
 using namespace isc::dhcp_ddns;
 using namespace isc::hooks;
 using namespace isc::stats;
+using namespace isc::test;
+using namespace isc::util;
 namespace ph = std::placeholders;
 
 namespace {
@@ -89,6 +92,26 @@ std::list<IOAddress> callouts_;
 /// @brief Callout argument name for expired lease.
 std::string callout_argument_name("lease4");
 
+/// @brief Stores a renewed copy of an IPv4 lease in the lease database.
+///
+/// @param lease Lease to renew.
+void
+renewStoredLease(const Lease4Ptr& lease) {
+    Lease4Ptr renewed(new Lease4(*lease));
+    renewed->cltt_ = time(NULL);
+    LeaseMgrFactory::instance().updateLease4(renewed);
+}
+
+/// @brief Stores a renewed copy of an IPv6 lease in the lease database.
+///
+/// @param lease Lease to renew.
+void
+renewStoredLease(const Lease6Ptr& lease) {
+    Lease6Ptr renewed(new Lease6(*lease));
+    renewed->cltt_ = time(NULL);
+    LeaseMgrFactory::instance().updateLease6(renewed);
+}
+
 /// @brief Base test fixture class for the lease reclamation routines in the
 /// @c AllocEngine.
 ///
@@ -562,6 +585,22 @@ public:
         return (0);
     }
 
+    /// @brief Implements "lease{4,6}_expire" or "lease{4,6}_recover" callout,
+    /// which renews the lease.
+    ///
+    /// It stands for a client renewing its lease while the lease is being
+    /// reclaimed.
+    ///
+    /// @param callout_handle Callout handle.
+    /// @return Zero.
+    static int leaseExpireWithRenewCallout(CalloutHandle& callout_handle) {
+        LeasePtrType lease;
+        callout_handle.getArgument(callout_argument_name, lease);
+        renewStoredLease(lease);
+
+        return (0);
+    }
+
     /// @brief Returns removal name change request from the D2 client queue.
     ///
     /// @param lease Pointer to the lease to be matched with NCR.
@@ -946,6 +985,58 @@ public:
                                UpperBound(TEST_LEASES_NUM)));
     }
 
+    /// @brief This test verifies that the leases are reclaimed by many
+    /// threads in multi-threading mode.
+    void testReclaimExpiredLeasesMultiThreading() {
+        MultiThreadingTest mt(true);
+        MultiThreadingMgr::instance().setThreadPoolSize(4);
+
+        for (unsigned int i = 0; i < TEST_LEASES_NUM; ++i) {
+            // Mark leases with even indexes as expired.
+            if (evenLeaseIndex(i)) {
+                expire(i, 10 + i);
+            }
+        }
+
+        ASSERT_NO_THROW(reclaimExpiredLeases(0, 0, false));
+        MultiThreadingMgr::instance().setThreadPoolSize(0);
+
+        // Leases with even indexes should be marked as reclaimed.
+        EXPECT_TRUE(testLeases(&leaseReclaimed, &evenLeaseIndex));
+        // Leases with odd indexes shouldn't be marked as reclaimed.
+        EXPECT_TRUE(testLeases(&leaseNotReclaimed, &oddLeaseIndex));
+        EXPECT_TRUE(testStatistics("reclaimed-leases", TEST_LEASES_NUM / 2));
+    }
+
+    /// @brief This test verifies that a lease renewed while the callouts
+    /// run is not reclaimed in multi-threading mode.
+    void testReclaimExpiredLeasesMultiThreadingRenewed() {
+        MultiThreadingTest mt(true);
+        MultiThreadingMgr::instance().setThreadPoolSize(4);
+
+        for (unsigned int i = 0; i < TEST_LEASES_NUM; ++i) {
+            if (evenLeaseIndex(i)) {
+                expire(i, 1000 - i);
+            }
+        }
+
+        HookLibsCollection libraries; // no libraries at this time
+        HooksManager::loadLibraries(libraries);
+
+        // Install a callout: lease4_expire or lease6_expire.
+        std::ostringstream callout_name;
+        callout_name << callout_argument_name << "_expire";
+        EXPECT_NO_THROW(HooksManager::preCalloutsLibraryHandle().registerCallout(
+                        callout_name.str(), leaseExpireWithRenewCallout));
+
+        ASSERT_NO_THROW(reclaimExpiredLeases(0, 0, false));
+        MultiThreadingMgr::instance().setThreadPoolSize(0);
+
+        // The renewed leases are left as they are.
+        EXPECT_TRUE(testLeases(&leaseNotReclaimed, &allLeaseIndexes));
+        EXPECT_TRUE(testStatistics("reclaimed-leases", 0));
+    }
+
     /// @brief This test verifies that expired-reclaimed leases are removed
     /// from the lease database.
     void testDeleteExpiredReclaimedLeases() {
@@ -1095,6 +1186,49 @@ public:
         testStatistics("subnet[2].reclaimed-declined-addresses", 20000 + subnet1_cnt);
     }
 
+    /// @brief Test that the declined addresses statistics are left unchanged
+    /// for the declined leases renewed between the two stages of the
+    /// reclamation in multi-threading mode.
+    void testReclaimDeclinedStatsRenewed() {
+        MultiThreadingTest mt(true);
+        MultiThreadingMgr::instance().setThreadPoolSize(4);
+
+        for (unsigned int i = 0; i < TEST_LEASES_NUM; ++i) {
+            decline(i, 100);
+            expire(i, 10 + 1);
+        }
+
+        StatsMgr& stats_mgr = StatsMgr::instance();
+        stats_mgr.setValue("declined-addresses", static_cast<int64_t>(1000));
+        stats_mgr.setValue("reclaimed-declined-addresses",
+                           static_cast<int64_t>(2000));
+        stats_mgr.setValue(stats_mgr.generateName("subnet", 1,
+                           "declined-addresses"), int64_t(100));
+        stats_mgr.setValue(stats_mgr.generateName("subnet", 1,
+                           "reclaimed-declined-addresses"), int64_t(10000));
+
+        HookLibsCollection libraries; // no libraries at this time
+        HooksManager::loadLibraries(libraries);
+
+        // Install a callout renewing the lease in the first stage:
+        // lease4_recover or lease6_recover.
+        std::ostringstream callout_name;
+        callout_name << callout_argument_name << "_recover";
+        EXPECT_NO_THROW(HooksManager::preCalloutsLibraryHandle().registerCallout(
+                        callout_name.str(), leaseExpireWithRenewCallout));
+
+        ASSERT_NO_THROW(reclaimExpiredLeases(0, 0, true));
+        MultiThreadingMgr::instance().setThreadPoolSize(0);
+
+        // The renewed leases are left as they are, so are the statistics.
+        EXPECT_TRUE(testLeases(&leaseDeclined, &allLeaseIndexes));
+        EXPECT_TRUE(testStatistics("declined-addresses", 1000));
+        EXPECT_TRUE(testStatistics("reclaimed-declined-addresses", 2000));
+        EXPECT_TRUE(testStatistics("subnet[1].declined-addresses", 100));
+        EXPECT_TRUE(testStatistics("subnet[1].reclaimed-declined-addresses",
+                                   10000));
+    }
+
     /// @brief Collection of leases created at construction time.
     std::vector<LeasePtrType> leases_;
 
@@ -1546,6 +1680,18 @@ TEST_F(ExpirationAllocEngine6Test, reclaimExpiredLeasesHooksWithSkip) {
     testReclaimExpiredLeasesHooksWithSkip();
 }
 
+// This test verifies that the leases are reclaimed by many threads in
+// multi-threading mode.
+TEST_F(ExpirationAllocEngine6Test, reclaimExpiredLeasesMultiThreading) {
+    testReclaimExpiredLeasesMultiThreading();
+}
+
+// This test verifies that a lease renewed during its reclamation is not
+// reclaimed in multi-threading mode.
+TEST_F(ExpirationAllocEngine6Test, reclaimExpiredLeasesMultiThreadingRenewed) {
+    testReclaimExpiredLeasesMultiThreadingRenewed();
+}
+
 // This test verifies that it is possible to set the timeout for the
 // execution of the lease reclamation routine.
 TEST_F(ExpirationAllocEngine6Test, reclaimExpiredLeasesTimeout) {
@@ -1595,6 +1741,12 @@ TEST_F(ExpirationAllocEngine6Test, reclaimDeclinedStats) {
     testReclaimDeclinedStats("assigned-nas");
 }
 
+/// This test verifies that the declined addresses statistics are not
+/// modified for the leases renewed during their reclamation.
+TEST_F(ExpirationAllocEngine6Test, reclaimDeclinedStatsRenewed) {
+    testReclaimDeclinedStatsRenewed();
+}
+
 // This test verifies that expired leases are reclaimed before they are
 // allocated to another client sending a Request message.
 TEST_F(ExpirationAllocEngine6Test, reclaimReusedLeases) {
@@ -2211,6 +2363,18 @@ TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesHooksWithSkip) {
     testReclaimExpiredLeasesHooksWithSkip();
 }
 
+// This test verifies that the leases are reclaimed by many threads in
+// multi-threading mode.
+TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesMultiThreading) {
+    testReclaimExpiredLeasesMultiThreading();
+}
+
+// This test verifies that a lease renewed during its reclamation is not
+// reclaimed in multi-threading mode.
+TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesMultiThreadingRenewed) {
+    testReclaimExpiredLeasesMultiThreadingRenewed();
+}
+
 // This test verifies that it is possible to set the timeout for the
 // execution of the lease reclamation routine.
 TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesTimeout) {
@@ -2260,6 +2424,12 @@ TEST_F(ExpirationAllocEngine4Test, reclaimDeclinedStats) {
     testReclaimDeclinedStats("assigned-addresses");
 }
 
+/// This test verifies that the declined addresses statistics are not
+/// modified for the leases renewed during their reclamation.
+TEST_F(ExpirationAllocEngine4Test, reclaimDeclinedStatsRenewed) {
+    testReclaimDeclinedStatsRenewed();
+}
+
 // This test verifies that the lease is reclaimed before it is reused.
 TEST_F(ExpirationAllocEngine4Test, reclaimReusedLeases) {
     // First false value indicates that the leases will be reused.
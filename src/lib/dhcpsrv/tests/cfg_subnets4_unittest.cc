@@ -1203,6 +1203,97 @@ TEST(CfgSubnets4Test, getSubnet) {
     EXPECT_EQ(Subnet4Ptr(), cfg.getSubnet(400)); // no such subnet
 }
 
+// This test verifies that the subnet selection index selects the same
+// subnets as the scans over all subnets.
+TEST(CfgSubnets4Test, selectSubnetIndexed) {
+    IfaceMgrTestConfig config(true);
+
+    // Overlapping prefixes, the broadest one restricted to a class.
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 3, 1));
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.0.2.0"), 26, 1, 2, 3, 2));
+    Subnet4Ptr subnet3(new Subnet4(IOAddress("192.0.2.128"), 25, 1, 2, 3, 3));
+    Subnet4Ptr subnet4(new Subnet4(IOAddress("10.0.0.0"), 8, 1, 2, 3, 4));
+    Subnet4Ptr subnet5(new Subnet4(IOAddress("10.1.0.0"), 16, 1, 2, 3, 5));
+    subnet1->allowClientClass("foo");
+    subnet3->addRelayAddress(IOAddress("10.2.3.4"));
+    subnet4->setIface("eth1");
+
+    // The relay address and the interface of the network are inherited by
+    // the subnets without their own.
+    SharedNetwork4Ptr network(new SharedNetwork4("network"));
+    network->addRelayAddress(IOAddress("10.2.3.4"));
+    network->addRelayAddress(IOAddress("10.5.6.7"));
+    network->setIface("lo");
+    network->add(subnet2);
+    network->add(subnet5);
+
+    CfgSubnets4 indexed;
+    CfgSubnets4 scanned;
+    for (auto const& subnet : { subnet1, subnet2, subnet3, subnet4, subnet5 }) {
+        indexed.add(subnet);
+        scanned.add(subnet);
+    }
+    indexed.buildSelectionIndex();
+
+    ClientClasses foo;
+    foo.insert("foo");
+    for (auto const& classes : { ClientClasses(), foo }) {
+        for (auto const& address : { "192.0.2.1", "192.0.2.100", "192.0.2.200",
+                                     "10.1.2.3", "10.2.3.4", "10.5.6.7",
+                                     "172.16.0.1" }) {
+            SubnetSelector selector;
+            selector.client_classes_ = classes;
+            selector.local_address_ = IOAddress("10.0.0.100");
+            selector.ciaddr_ = IOAddress(address);
+            EXPECT_EQ(scanned.selectSubnet(selector), indexed.selectSubnet(selector))
+                << "ciaddr " << address;
+
+            selector.ciaddr_ = IOAddress::IPV4_ZERO_ADDRESS();
+            selector.giaddr_ = IOAddress(address);
+            EXPECT_EQ(scanned.selectSubnet(selector), indexed.selectSubnet(selector))
+                << "giaddr " << address;
+        }
+        for (auto const& iface : { "eth0", "eth1", "lo" }) {
+            EXPECT_EQ(scanned.selectSubnet(iface, classes), indexed.selectSubnet(iface, classes))
+                << "interface " << iface;
+        }
+    }
+
+    // Spot check a few of the selections.
+    SubnetSelector selector;
+    selector.local_address_ = IOAddress("10.0.0.100");
+    selector.ciaddr_ = IOAddress("192.0.2.1");
+    EXPECT_EQ(subnet2, indexed.selectSubnet(selector));
+    selector.client_classes_ = foo;
+    EXPECT_EQ(subnet1, indexed.selectSubnet(selector));
+    selector.ciaddr_ = IOAddress::IPV4_ZERO_ADDRESS();
+    selector.giaddr_ = IOAddress("10.2.3.4");
+    EXPECT_EQ(subnet2, indexed.selectSubnet(selector));
+    EXPECT_EQ(subnet5, indexed.selectSubnet("lo", ClientClasses()));
+    EXPECT_EQ(subnet3, indexed.getSubnet(3));
+}
+
+// This test verifies that the subnets added after the subnet selection index
+// has been built can be selected.
+TEST(CfgSubnets4Test, selectSubnetIndexInvalidated) {
+    CfgSubnets4 cfg;
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.0.2.0"), 26, 1, 2, 3, 1));
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.0.2.64"), 26, 1, 2, 3, 2));
+    cfg.add(subnet1);
+    cfg.buildSelectionIndex();
+    EXPECT_EQ(subnet1, cfg.selectSubnet(IOAddress("192.0.2.1")));
+    EXPECT_FALSE(cfg.selectSubnet(IOAddress("192.0.2.65")));
+
+    cfg.add(subnet2);
+    EXPECT_EQ(subnet2, cfg.selectSubnet(IOAddress("192.0.2.65")));
+
+    cfg.buildSelectionIndex();
+    EXPECT_EQ(subnet2, cfg.selectSubnet(IOAddress("192.0.2.65")));
+
+    cfg.del(subnet1);
+    EXPECT_FALSE(cfg.selectSubnet(IOAddress("192.0.2.1")));
+}
+
 // This test verifies that hasSubnetWithServerId returns correct value.
 TEST(CfgSubnets4Test, hasSubnetWithServerId) {
     CfgSubnets4 cfg;
@@ -856,6 +856,90 @@ TEST(CfgSubnets6Test, getSubnet) {
     EXPECT_EQ(Subnet6Ptr(), cfg.getSubnet(400)); // no such subnet
 }
 
+// This test verifies that the subnet selection index selects the same
+// subnets as the scans over all subnets.
+TEST(CfgSubnets6Test, selectSubnetIndexed) {
+    // Overlapping prefixes, the broadest one restricted to a class.
+    Subnet6Ptr subnet1(new Subnet6(IOAddress("2001:db8::"), 32, 1, 2, 3, 4, 1));
+    Subnet6Ptr subnet2(new Subnet6(IOAddress("2001:db8:1::"), 48, 1, 2, 3, 4, 2));
+    Subnet6Ptr subnet3(new Subnet6(IOAddress("2001:db8:1:1::"), 64, 1, 2, 3, 4, 3));
+    Subnet6Ptr subnet4(new Subnet6(IOAddress("2001:db8:2::"), 65, 1, 2, 3, 4, 4));
+    Subnet6Ptr subnet5(new Subnet6(IOAddress("3000::"), 16, 1, 2, 3, 4, 5));
+    subnet1->allowClientClass("foo");
+    subnet3->addRelayAddress(IOAddress("3000::1"));
+    subnet3->setIface("eth1");
+    subnet4->setInterfaceId(generateInterfaceId("relay1.eth0"));
+    subnet5->setInterfaceId(generateInterfaceId("relay1.eth0"));
+
+    SharedNetwork6Ptr network(new SharedNetwork6("network"));
+    network->addRelayAddress(IOAddress("3000::1"));
+    network->addRelayAddress(IOAddress("3000::2"));
+    network->add(subnet2);
+    network->add(subnet4);
+
+    CfgSubnets6 indexed;
+    CfgSubnets6 scanned;
+    for (auto const& subnet : { subnet1, subnet2, subnet3, subnet4, subnet5 }) {
+        indexed.add(subnet);
+        scanned.add(subnet);
+    }
+    indexed.buildSelectionIndex();
+
+    ClientClasses foo;
+    foo.insert("foo");
+    for (auto const& classes : { ClientClasses(), foo }) {
+        for (auto const& address : { "2001:db8::1", "2001:db8:1::1", "2001:db8:1:1::1",
+                                     "2001:db8:2::1", "2001:db8:2:0:8000::1",
+                                     "3000::1", "3000::2", "4000::1" }) {
+            SubnetSelector selector;
+            selector.client_classes_ = classes;
+            selector.remote_address_ = IOAddress(address);
+            EXPECT_EQ(scanned.selectSubnet(selector), indexed.selectSubnet(selector))
+                << "remote address " << address;
+
+            selector.iface_name_ = "eth1";
+            EXPECT_EQ(scanned.selectSubnet(selector), indexed.selectSubnet(selector))
+                << "remote address " << address << " on eth1";
+
+            selector.first_relay_linkaddr_ = IOAddress(address);
+            EXPECT_EQ(scanned.selectSubnet(selector), indexed.selectSubnet(selector))
+                << "relay " << address;
+
+            selector.interface_id_ = generateInterfaceId("relay1.eth0");
+            EXPECT_EQ(scanned.selectSubnet(selector), indexed.selectSubnet(selector))
+                << "relay " << address << " with interface id";
+        }
+    }
+
+    // Spot check a few of the selections.
+    EXPECT_EQ(subnet3, indexed.selectSubnet(IOAddress("2001:db8:1:1::1"), ClientClasses()));
+    EXPECT_EQ(subnet1, indexed.selectSubnet(IOAddress("2001:db8:1:1::1"), foo));
+    EXPECT_EQ(subnet2, indexed.selectSubnet(IOAddress("3000::1"), ClientClasses(), true));
+    EXPECT_EQ(subnet5, indexed.selectSubnet(IOAddress("3000::1"), ClientClasses()));
+    EXPECT_EQ(subnet3, indexed.getSubnet(3));
+}
+
+// This test verifies that the subnets added after the subnet selection index
+// has been built can be selected.
+TEST(CfgSubnets6Test, selectSubnetIndexInvalidated) {
+    CfgSubnets6 cfg;
+    Subnet6Ptr subnet1(new Subnet6(IOAddress("2001:db8:1::"), 48, 1, 2, 3, 4, 1));
+    Subnet6Ptr subnet2(new Subnet6(IOAddress("2001:db8:2::"), 48, 1, 2, 3, 4, 2));
+    cfg.add(subnet1);
+    cfg.buildSelectionIndex();
+    EXPECT_EQ(subnet1, cfg.selectSubnet(IOAddress("2001:db8:1::1"), ClientClasses()));
+    EXPECT_FALSE(cfg.selectSubnet(IOAddress("2001:db8:2::1"), ClientClasses()));
+
+    cfg.add(subnet2);
+    EXPECT_EQ(subnet2, cfg.selectSubnet(IOAddress("2001:db8:2::1"), ClientClasses()));
+
+    cfg.buildSelectionIndex();
+    EXPECT_EQ(subnet2, cfg.selectSubnet(IOAddress("2001:db8:2::1"), ClientClasses()));
+
+    cfg.del(subnet1);
+    EXPECT_FALSE(cfg.selectSubnet(IOAddress("2001:db8:1::1"), ClientClasses()));
+}
+
 // This test verifies that subnets configuration is properly merged.
 TEST(CfgSubnets6Test, mergeSubnets) {
     // Create custom options dictionary for testing merge. We're keeping it
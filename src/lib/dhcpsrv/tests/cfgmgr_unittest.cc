@@ -567,6 +567,34 @@ TEST_F(CfgMgrTest, revert) {
     EXPECT_EQ(12, cfg_mgr.getCurrentCfg()->getLoggingInfo()[0].debuglevel_);
 }
 
+// This test verifies that the snapshot keeps the current configuration
+// seen by the thread unchanged until it is destroyed.
+TEST_F(CfgMgrTest, snapshot) {
+    CfgMgr& cfg_mgr = CfgMgr::instance();
+    SrvConfigPtr first = cfg_mgr.getCurrentCfg();
+    {
+        CfgSnapshot snapshot;
+        EXPECT_EQ(first, cfg_mgr.getCurrentCfg());
+
+        // Commit another configuration. The snapshot still sees the
+        // previous one.
+        cfg_mgr.getStagingCfg();
+        cfg_mgr.commit();
+        EXPECT_EQ(first, cfg_mgr.getCurrentCfg());
+
+        // Nested snapshot pins the same configuration.
+        {
+            CfgSnapshot nested;
+            EXPECT_EQ(first, cfg_mgr.getCurrentCfg());
+        }
+        EXPECT_EQ(first, cfg_mgr.getCurrentCfg());
+    }
+
+    // The committed configuration is visible after the snapshot is gone.
+    EXPECT_NE(first, cfg_mgr.getCurrentCfg());
+    EXPECT_EQ(first->getSequence() + 1, cfg_mgr.getCurrentCfg()->getSequence());
+}
+
 // This test verifies that the address family can be set and obtained
 // from the configuration manager.
 TEST_F(CfgMgrTest, family) {
@@ -632,6 +660,52 @@ TEST_F(CfgMgrTest, commitStats4) {
     EXPECT_EQ("00:00:02", durationToText(total_addrs->getMaxSampleAge().second, 0));
 }
 
+// This test verifies that the statistics of the subnets removed by the
+// new configuration are kept while the previous configuration is pinned.
+TEST_F(CfgMgrTest, commitStatsPinned4) {
+    CfgMgr& cfg_mgr = CfgMgr::instance();
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    startBackend(AF_INET);
+
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.1.2.0"), 24, 1, 2, 3, 123));
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.1.3.0"), 24, 1, 2, 3, 124));
+    cfg_mgr.getStagingCfg()->getCfgSubnets4()->add(subnet1);
+    cfg_mgr.getStagingCfg()->getCfgSubnets4()->add(subnet2);
+    cfg_mgr.commit();
+    stats_mgr.setValue("subnet[123].assigned-addresses", static_cast<int64_t>(150));
+    stats_mgr.setValue("subnet[124].assigned-addresses", static_cast<int64_t>(10));
+
+    {
+        // A packet is being processed with the first configuration.
+        CfgSnapshot snapshot;
+
+        // The new configuration no longer has the subnet 123.
+        Subnet4Ptr subnet3(new Subnet4(IOAddress("192.1.3.0"), 24, 1, 2, 3, 124));
+        cfg_mgr.getStagingCfg()->getCfgSubnets4()->add(subnet3);
+        cfg_mgr.commit();
+
+        // The statistics of the subnet are kept while it is pinned.
+        ObservationPtr assigned = stats_mgr.getObservation("subnet[123].assigned-addresses");
+        ASSERT_TRUE(assigned);
+        EXPECT_EQ(150, assigned->getInteger().first);
+
+        // Another configuration configures the subnet 123 again.
+        Subnet4Ptr subnet4(new Subnet4(IOAddress("192.1.2.0"), 24, 1, 2, 3, 123));
+        cfg_mgr.getStagingCfg()->getCfgSubnets4()->add(subnet4);
+        cfg_mgr.commit();
+
+        // The subnet 124 is gone from the last configuration, but the first
+        // configuration which has it is still pinned.
+        EXPECT_TRUE(stats_mgr.getObservation("subnet[124].total-addresses"));
+    }
+
+    // The first configuration is released. The subnet 123 is configured,
+    // so its statistics are kept. The subnet 124 is not.
+    EXPECT_TRUE(stats_mgr.getObservation("subnet[123].total-addresses"));
+    EXPECT_FALSE(stats_mgr.getObservation("subnet[124].total-addresses"));
+    EXPECT_FALSE(stats_mgr.getObservation("subnet[124].assigned-addresses"));
+}
+
 // This test verifies that once the configuration is merged into the current
 // configuration, statistics are updated appropriately.
 TEST_F(CfgMgrTest, mergeIntoCurrentStats4) {
@@ -531,6 +531,11 @@ TEST_F(CqlLeaseMgrTest, basicLease4) {
     testBasicLease4();
 }
 
+/// @brief Checks that many IPv4 leases can be added at once.
+TEST_F(CqlLeaseMgrTest, addLeases4) {
+    testAddLeases4();
+}
+
 /// @brief checks that infinite lifetimes do not overflow.
 TEST_F(CqlLeaseMgrTest, infiniteLifeTime4) {
     testInfiniteLifeTime4();
@@ -716,6 +721,11 @@ TEST_F(CqlLeaseMgrTest, basicLease6) {
     testBasicLease6();
 }
 
+/// @brief Checks that many IPv6 leases can be added at once.
+TEST_F(CqlLeaseMgrTest, addLeases6) {
+    testAddLeases6();
+}
+
 /// @brief checks that infinite lifetimes do not overflow.
 TEST_F(CqlLeaseMgrTest, infiniteLifeTime6) {
     testInfiniteLifeTime6();
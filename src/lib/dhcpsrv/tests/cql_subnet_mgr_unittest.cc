@@ -261,6 +261,10 @@ TEST_F(CqlSubnet4MgrTest, testUpdate) {
     testUpdate();
 }
 
+TEST_F(CqlSubnet4MgrTest, testBatch) {
+    testBatch();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////// SUBNET6 ///////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -298,4 +302,8 @@ TEST_F(CqlSubnet6MgrTest, testUpdate) {
     testUpdate();
 }
 
+TEST_F(CqlSubnet6MgrTest, testBatch) {
+    testBatch();
+}
+
 }  // namespace
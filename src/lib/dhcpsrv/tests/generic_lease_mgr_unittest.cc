@@ -747,6 +747,32 @@ GenericLeaseMgrTest::testAddGetDelete6() {
     EXPECT_FALSE(x);
 }
 
+void
+GenericLeaseMgrTest::testAddLeases4() {
+    // Get the leases to be used for the test.
+    vector<Lease4Ptr> leases = createLeases4();
+
+    // One lease is in the database already.
+    ASSERT_TRUE(lmptr_->addLease(leases[1]));
+
+    // Add all leases at once. The existing lease is skipped.
+    Lease4Collection collection(leases.begin(), leases.end());
+    EXPECT_EQ(leases.size() - 1, lmptr_->addLeases(collection));
+    lmptr_->commit();
+
+    // Reopen the database to ensure that they actually got stored.
+    reopen(V4);
+
+    for (size_t i = 0; i < leases.size(); ++i) {
+        Lease4Ptr l_returned = lmptr_->getLease4(ioaddress4_[i]);
+        ASSERT_TRUE(l_returned);
+        detailCompareLease(leases[i], l_returned);
+    }
+
+    // Adding no leases is fine.
+    EXPECT_EQ(0, lmptr_->addLeases(Lease4Collection()));
+}
+
 void
 GenericLeaseMgrTest::testMaxDate4() {
     // Get the leases to be used for the test.
@@ -938,6 +964,32 @@ GenericLeaseMgrTest::testBasicLease6() {
     detailCompareLease(leases[2], l_returned);
 }
 
+void
+GenericLeaseMgrTest::testAddLeases6() {
+    // Get the leases to be used for the test.
+    vector<Lease6Ptr> leases = createLeases6();
+
+    // One lease is in the database already.
+    ASSERT_TRUE(lmptr_->addLease(leases[1]));
+
+    // Add all leases at once. The existing lease is skipped.
+    Lease6Collection collection(leases.begin(), leases.end());
+    EXPECT_EQ(leases.size() - 1, lmptr_->addLeases(collection));
+    lmptr_->commit();
+
+    // Reopen the database to ensure that they actually got stored.
+    reopen(V6);
+
+    for (size_t i = 0; i < leases.size(); ++i) {
+        Lease6Ptr l_returned = lmptr_->getLease6(leasetype6_[i], ioaddress6_[i]);
+        ASSERT_TRUE(l_returned);
+        detailCompareLease(leases[i], l_returned);
+    }
+
+    // Adding no leases is fine.
+    EXPECT_EQ(0, lmptr_->addLeases(Lease6Collection()));
+}
+
 void
 GenericLeaseMgrTest::testMaxDate6() {
     // Get the leases to be used for the test.
@@ -148,6 +148,10 @@ public:
     /// @brief checks that addLease, getLease4(addr) and deleteLease() works
     void testBasicLease4();
 
+    /// @brief checks that addLeases adds many IPv4 leases and skips
+    /// the existing ones
+    void testAddLeases4();
+
     /// @brief checks that invalid dates are safely handled.
     void testMaxDate4();
 
@@ -257,6 +261,10 @@ public:
     ///     an IPv6 address) works.
     void testBasicLease6();
 
+    /// @brief checks that addLeases adds many IPv6 leases and skips
+    /// the existing ones
+    void testAddLeases6();
+
     /// @brief Checks that invalid dates are safely handled.
     void testMaxDate6();
 
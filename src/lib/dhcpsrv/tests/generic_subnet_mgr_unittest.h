@@ -230,6 +230,66 @@ struct GenericSubnetMgrTest : public ::testing::Test {
         compare({subnet, returned.back()});
     }
 
+    void testBatch() {
+        // Insert three subnets at once.
+        SubnetInfoCollection<D> subnets;
+        for (size_t i = 2; i <= 4; ++i) {
+            subnets.push_back(initialize(subnets_[i]));
+        }
+        std::vector<bool> applied;
+        ASSERT_NO_THROW(applied = smptr_->insertBatch(subnets, config_timestamp_()));
+        EXPECT_EQ(std::vector<bool>(3, true), applied);
+        SubnetInfoCollection<D> returned = order(smptr_->select(config_timestamp_()));
+        ASSERT_EQ(3, returned.size());
+        for (size_t i = 0; i < 3; ++i) {
+            compare({subnets[i], returned[i]});
+        }
+
+        // Select two of them at once.
+        std::vector<std::string> keys = {subnets_[2], subnets_[4]};
+        returned = order(smptr_->selectBySubnets(keys, config_timestamp_()));
+        ASSERT_EQ(2, returned.size());
+        compare({subnets[0], returned[0]});
+        compare({subnets[2], returned[1]});
+
+        // Update all of them at once.
+        for (SubnetInfoPtr<D>& subnet : subnets) {
+            subnet->valid_lifetime_ += 1;
+        }
+        ASSERT_NO_THROW(applied = smptr_->updateBatch(subnets, config_timestamp_()));
+        EXPECT_EQ(std::vector<bool>(3, true), applied);
+        returned = order(smptr_->select(config_timestamp_()));
+        ASSERT_EQ(3, returned.size());
+        for (size_t i = 0; i < 3; ++i) {
+            compare({subnets[i], returned[i]});
+        }
+
+        // Inserting a duplicate is reported, not thrown.
+        SubnetInfoCollection<D> duplicates = {initialize(subnets_[2])};
+        ASSERT_NO_THROW(applied = smptr_->insertBatch(duplicates, config_timestamp_()));
+        EXPECT_EQ(std::vector<bool>(1, false), applied);
+
+        // Delete two of them at once.
+        SubnetInfoCollection<D> deleted = {subnets[0], subnets[1]};
+        ASSERT_NO_THROW(smptr_->delBatch(deleted, config_timestamp_()));
+        returned = order(smptr_->select(config_timestamp_()));
+        ASSERT_EQ(1, returned.size());
+        compare({subnets[2], returned[0]});
+
+        // Missing subnets are skipped by selects and reported by updates.
+        keys = {subnets_[2], subnets_[4]};
+        returned = smptr_->selectBySubnets(keys, config_timestamp_());
+        ASSERT_EQ(1, returned.size());
+        compare({subnets[2], returned[0]});
+        ASSERT_NO_THROW(applied = smptr_->updateBatch(subnets, config_timestamp_()));
+        EXPECT_EQ(std::vector<bool>({false, false, true}), applied);
+
+        // A missing subnet does not prevent the others from being deleted.
+        EXPECT_THROW(smptr_->delBatch(subnets, config_timestamp_()),
+                     isc::db::StatementNotApplied);
+        EXPECT_TRUE(smptr_->select(config_timestamp_()).empty());
+    }
+
     std::array<std::string, 8> const generateSubnets();
 
     std::array<std::string, 8> const subnets_;
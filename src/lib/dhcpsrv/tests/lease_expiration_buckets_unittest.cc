@@ -0,0 +1,356 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <dhcpsrv/lease_expiration_buckets.h>
+#include <exceptions/exceptions.h>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <mutex>
+#include <set>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Current time used by the tests.
+const int64_t NOW = 1600000000;
+
+/// @brief Stub of the database queries.
+///
+/// The lease table is a map of addresses to leases and the index a map of
+/// set and bucket to addresses.
+class ExpirationBucketSourceStub : public ExpirationBucketSource {
+public:
+
+    /// @brief Constructor.
+    ExpirationBucketSourceStub()
+        : status_(INDEX_ABSENT), claim_(true), fail_scan_(false), reads_(0) {
+    }
+
+    /// @brief Returns the state of the index and a cursor.
+    IndexStatus getCursor(const bool reclaimed, int64_t& cursor) override {
+        if (status_ == INDEX_READY) {
+            cursor = cursors_[reclaimed];
+        }
+        return (status_);
+    }
+
+    /// @brief Claims the rebuild unless @c claim_ is false.
+    bool claimIndexRebuild() override {
+        if (!claim_ || (status_ != INDEX_ABSENT)) {
+            return (false);
+        }
+        status_ = INDEX_REBUILDING;
+        return (true);
+    }
+
+    /// @brief Marks the index as absent.
+    void abortIndexRebuild() override {
+        status_ = INDEX_ABSENT;
+    }
+
+    /// @brief Marks the index as up to date.
+    void setIndexReady(const int64_t cursor) override {
+        cursors_[false] = cursor;
+        cursors_[true] = cursor;
+        status_ = INDEX_READY;
+    }
+
+    /// @brief Moves a cursor unless it has moved.
+    void moveCursor(const bool reclaimed, const int64_t from,
+                    const int64_t to) override {
+        if (cursors_[reclaimed] == from) {
+            cursors_[reclaimed] = to;
+        }
+    }
+
+    /// @brief Reads the entries of a bucket.
+    void readBucket(const bool reclaimed, const int64_t bucket,
+                    std::vector<ExpirationBucketEntry>& entries) override {
+        ++reads_;
+        for (auto const& address : index_[Bucket(reclaimed, bucket)]) {
+            auto lease = leases_.find(address);
+            entries.push_back({ address, lease == leases_.end() ?
+                                         LeasePtr() : lease->second });
+        }
+    }
+
+    /// @brief Deletes an entry.
+    void deleteEntry(const bool reclaimed, const int64_t bucket,
+                     const IOAddress& address) override {
+        index_[Bucket(reclaimed, bucket)].erase(address);
+    }
+
+    /// @brief Indexes the leases of a token range.
+    ///
+    /// The token of a lease is its address, as an IPv4 address.
+    void indexTokenRange(const TokenRange& range, const int64_t now) override {
+        if (fail_scan_) {
+            isc_throw(Unexpected, "scan failed");
+        }
+        for (auto const& lease : leases_) {
+            const int64_t token = lease.first.toUint32();
+            if ((token >= range.first) && (token <= range.second)) {
+                std::lock_guard<std::mutex> lk(mutex_);
+                addEntry(*lease.second, now);
+            }
+        }
+    }
+
+    /// @brief Stores a lease and adds its entry, as the backend does.
+    ///
+    /// @param address Address of the lease.
+    /// @param expire Expiration time.
+    /// @param state State of the lease.
+    /// @param now Current time.
+    /// @return The lease.
+    LeasePtr storeLease(const std::string& address, const int64_t expire,
+                        const uint32_t state, const int64_t now = NOW) {
+        LeasePtr lease(new Lease4(IOAddress(address), HWAddrPtr(), ClientIdPtr(),
+                                  3600, expire - 3600, 1));
+        lease->state_ = state;
+        leases_[lease->addr_] = lease;
+        addEntry(*lease, now);
+        return (lease);
+    }
+
+    /// @brief Adds the entry of a lease.
+    ///
+    /// @param lease The lease.
+    /// @param now Current time.
+    void addEntry(const Lease& lease, const int64_t now) {
+        const int64_t bucket =
+            LeaseExpirationBuckets::getEntryBucket(lease.getExpirationTime(), now);
+        index_[Bucket(lease.stateExpiredReclaimed(), bucket)].insert(lease.addr_);
+    }
+
+    /// @brief Returns the number of entries of a set.
+    ///
+    /// @param reclaimed Set of buckets.
+    size_t countEntries(const bool reclaimed) {
+        size_t count = 0;
+        for (auto const& bucket : index_) {
+            if (bucket.first.first == reclaimed) {
+                count += bucket.second.size();
+            }
+        }
+        return (count);
+    }
+
+    /// @brief Set and bucket.
+    typedef std::pair<bool, int64_t> Bucket;
+
+    /// @brief Lease table.
+    std::map<IOAddress, LeasePtr> leases_;
+
+    /// @brief Expiration index.
+    std::map<Bucket, std::set<IOAddress> > index_;
+
+    /// @brief Cursors of the sets.
+    std::map<bool, int64_t> cursors_;
+
+    /// @brief State of the index.
+    IndexStatus status_;
+
+    /// @brief Whether the rebuild claims succeed.
+    bool claim_;
+
+    /// @brief Whether the scans fail.
+    bool fail_scan_;
+
+    /// @brief Number of read buckets.
+    size_t reads_;
+
+private:
+
+    /// @brief Protects the index during the rebuild.
+    std::mutex mutex_;
+};
+
+/// @brief Test fixture class for @c LeaseExpirationBuckets.
+class LeaseExpirationBucketsTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    LeaseExpirationBucketsTest() : buckets_(source_, 4, 16) {
+    }
+
+    /// @brief Returns the addresses of the expired leases.
+    ///
+    /// @param reclaimed Set of buckets.
+    /// @param limit Time before which the leases have expired.
+    /// @param max_leases Maximum number of leases.
+    std::set<std::string> getExpired(const bool reclaimed, const int64_t limit,
+                                     const size_t max_leases = 0) {
+        std::vector<LeasePtr> leases;
+        EXPECT_TRUE(buckets_.getExpiredLeases(reclaimed, limit, NOW, max_leases,
+                                              leases));
+        std::set<std::string> addresses;
+        for (auto const& lease : leases) {
+            addresses.insert(lease->addr_.toText());
+        }
+        EXPECT_EQ(leases.size(), addresses.size());
+        return (addresses);
+    }
+
+    /// @brief Stub of the database queries.
+    ExpirationBucketSourceStub source_;
+
+    /// @brief Object under test.
+    LeaseExpirationBuckets buckets_;
+};
+
+// Verifies the bucket computations.
+TEST(LeaseExpirationBucketsStaticTest, buckets) {
+    EXPECT_EQ(0, LeaseExpirationBuckets::getBucket(0));
+    EXPECT_EQ(0, LeaseExpirationBuckets::getBucket(59));
+    EXPECT_EQ(1, LeaseExpirationBuckets::getBucket(60));
+    EXPECT_EQ(-1, LeaseExpirationBuckets::getBucket(-1));
+    EXPECT_EQ(-1, LeaseExpirationBuckets::getBucket(-60));
+    EXPECT_EQ(-2, LeaseExpirationBuckets::getBucket(-61));
+
+    // Expired leases go to the current bucket.
+    EXPECT_EQ(LeaseExpirationBuckets::getBucket(NOW),
+              LeaseExpirationBuckets::getEntryBucket(NOW - 3600, NOW));
+    EXPECT_EQ(LeaseExpirationBuckets::getBucket(NOW + 3600),
+              LeaseExpirationBuckets::getEntryBucket(NOW + 3600, NOW));
+}
+
+// Verifies when a changed lease needs a new entry.
+TEST(LeaseExpirationBucketsStaticTest, needsEntry) {
+    Lease4 lease(IOAddress("192.0.2.1"), HWAddrPtr(), ClientIdPtr(), 3600, NOW, 1);
+    lease.old_cltt_ = NOW;
+    lease.old_valid_lft_ = 3600;
+    lease.old_state_ = Lease::STATE_DEFAULT;
+
+    // Same bucket in the future.
+    EXPECT_FALSE(LeaseExpirationBuckets::needsEntry(lease, NOW));
+
+    // Other bucket.
+    lease.cltt_ = NOW + 60;
+    EXPECT_TRUE(LeaseExpirationBuckets::needsEntry(lease, NOW));
+    lease.cltt_ = NOW;
+
+    // The old entry may be in the bucket of the time it was written.
+    EXPECT_TRUE(LeaseExpirationBuckets::needsEntry(lease, NOW + 7200));
+
+    // Other set.
+    lease.state_ = Lease::STATE_EXPIRED_RECLAIMED;
+    EXPECT_TRUE(LeaseExpirationBuckets::needsEntry(lease, NOW));
+}
+
+// Verifies that the expired leases are read from the buckets.
+TEST_F(LeaseExpirationBucketsTest, getExpired) {
+    source_.setIndexReady(LeaseExpirationBuckets::getBucket(NOW) - 10);
+    source_.storeLease("192.0.2.1", NOW - 300, Lease::STATE_DEFAULT, NOW - 600);
+    source_.storeLease("192.0.2.2", NOW - 100, Lease::STATE_DECLINED, NOW - 600);
+    source_.storeLease("192.0.2.3", NOW + 100, Lease::STATE_DEFAULT, NOW - 600);
+    source_.storeLease("192.0.2.4", NOW - 200, Lease::STATE_EXPIRED_RECLAIMED,
+                       NOW - 600);
+
+    EXPECT_EQ(std::set<std::string>({ "192.0.2.1", "192.0.2.2" }),
+              getExpired(false, NOW));
+    EXPECT_EQ(std::set<std::string>({ "192.0.2.4" }), getExpired(true, NOW));
+    EXPECT_EQ(std::set<std::string>(), getExpired(true, NOW - 300));
+
+    // The limit applies.
+    EXPECT_EQ(1, getExpired(false, NOW, 1).size());
+}
+
+// Verifies that the stale entries are dropped and the cursors move.
+TEST_F(LeaseExpirationBucketsTest, staleEntries) {
+    const int64_t start = LeaseExpirationBuckets::getBucket(NOW) - 10;
+    source_.setIndexReady(start);
+
+    // A lease renewed to a later time and a deleted lease.
+    LeasePtr renewed = source_.storeLease("192.0.2.1", NOW - 300,
+                                          Lease::STATE_DEFAULT, NOW - 600);
+    renewed->cltt_ = NOW;
+    source_.addEntry(*renewed, NOW);
+    source_.storeLease("192.0.2.2", NOW - 300, Lease::STATE_DEFAULT, NOW - 600);
+    source_.leases_.erase(IOAddress("192.0.2.2"));
+
+    // A lease reclaimed since it was returned.
+    LeasePtr reclaimed = source_.storeLease("192.0.2.3", NOW - 200,
+                                            Lease::STATE_DEFAULT, NOW - 600);
+    EXPECT_EQ(std::set<std::string>({ "192.0.2.3" }), getExpired(false, NOW));
+    reclaimed->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+    source_.addEntry(*reclaimed, NOW);
+
+    EXPECT_EQ(std::set<std::string>(), getExpired(false, NOW));
+    EXPECT_EQ(1, source_.countEntries(false));
+
+    // The cursor stays two buckets behind.
+    EXPECT_EQ(LeaseExpirationBuckets::getBucket(NOW) - 1, source_.cursors_[false]);
+    EXPECT_EQ(start, source_.cursors_[true]);
+
+    // The next read starts at the cursor.
+    source_.reads_ = 0;
+    getExpired(false, NOW);
+    EXPECT_EQ(2, source_.reads_);
+}
+
+// Verifies that a lease with many live entries is returned once.
+TEST_F(LeaseExpirationBucketsTest, duplicates) {
+    source_.setIndexReady(LeaseExpirationBuckets::getBucket(NOW) - 10);
+    LeasePtr lease = source_.storeLease("192.0.2.1", NOW - 300,
+                                        Lease::STATE_DEFAULT, NOW - 600);
+    source_.addEntry(*lease, NOW - 120);
+    EXPECT_EQ(2, source_.countEntries(false));
+    EXPECT_EQ(std::set<std::string>({ "192.0.2.1" }), getExpired(false, NOW));
+}
+
+// Verifies that an absent index is rebuilt.
+TEST_F(LeaseExpirationBucketsTest, rebuild) {
+    source_.storeLease("192.0.2.1", NOW - 300, Lease::STATE_DEFAULT);
+    source_.storeLease("192.0.2.2", NOW + 300, Lease::STATE_DEFAULT);
+    source_.storeLease("192.0.2.3", NOW - 300, Lease::STATE_EXPIRED_RECLAIMED);
+    source_.index_.clear();
+
+    EXPECT_EQ(std::set<std::string>({ "192.0.2.1" }), getExpired(false, NOW));
+    EXPECT_EQ(ExpirationBucketSource::INDEX_READY, source_.status_);
+    EXPECT_EQ(2, source_.countEntries(false));
+    EXPECT_EQ(1, source_.countEntries(true));
+}
+
+// Verifies that the index is not used while it is rebuilt elsewhere.
+TEST_F(LeaseExpirationBucketsTest, rebuilding) {
+    std::vector<LeasePtr> leases;
+    source_.status_ = ExpirationBucketSource::INDEX_REBUILDING;
+    EXPECT_FALSE(buckets_.getExpiredLeases(false, NOW, NOW, 0, leases));
+
+    source_.status_ = ExpirationBucketSource::INDEX_ABSENT;
+    source_.claim_ = false;
+    EXPECT_FALSE(buckets_.getExpiredLeases(false, NOW, NOW, 0, leases));
+    EXPECT_TRUE(leases.empty());
+}
+
+// Verifies that a failed rebuild is given up.
+TEST_F(LeaseExpirationBucketsTest, rebuildError) {
+    source_.fail_scan_ = true;
+    std::vector<LeasePtr> leases;
+    EXPECT_THROW(buckets_.getExpiredLeases(false, NOW, NOW, 0, leases), Unexpected);
+    EXPECT_EQ(ExpirationBucketSource::INDEX_ABSENT, source_.status_);
+}
+
+}  // namespace
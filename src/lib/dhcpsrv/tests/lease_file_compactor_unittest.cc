@@ -0,0 +1,292 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <dhcpsrv/csv_lease_file4.h>
+#include <dhcpsrv/csv_lease_file6.h>
+#include <dhcpsrv/lease_file_compactor.h>
+#include <dhcpsrv/lease_file_loader.h>
+#include <dhcpsrv/memfile_lease_storage.h>
+#include <dhcpsrv/testutils/lease_file_io.h>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace isc;
+using namespace isc::dhcp;
+using namespace isc::dhcp::test;
+using namespace std;
+
+namespace {
+
+/// @brief Test fixture class for @c LeaseFileCompactor class.
+class LeaseFileCompactorTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Removes the files left by previous tests.
+    LeaseFileCompactorTest()
+        : previous_(absolutePath("leases.csv.2")),
+          copy_(absolutePath("leases.csv.1")),
+          output_(absolutePath("leases.csv.output")),
+          expected_(absolutePath("leases.csv.expected")),
+          io_previous_(previous_), io_copy_(copy_), io_output_(output_),
+          io_expected_(expected_) {
+        v4_hdr_ = "address,hwaddr,client_id,valid_lifetime,expire,subnet_id,"
+                  "fqdn_fwd,fqdn_rev,hostname,state,user_context\n";
+        v6_hdr_ = "address,duid,valid_lifetime,expire,subnet_id,"
+                  "pref_lifetime,lease_type,iaid,prefix_len,fqdn_fwd,"
+                  "fqdn_rev,hostname,hwaddr,state,user_context,"
+                  "allocation_time,pool_id\n";
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Removes the test files.
+    virtual ~LeaseFileCompactorTest() {
+        io_previous_.removeFile();
+        io_copy_.removeFile();
+        io_output_.removeFile();
+        io_expected_.removeFile();
+    }
+
+    /// @brief Prepends the absolute path to the file specified
+    /// as an argument.
+    ///
+    /// @param filename Name of the file.
+    /// @return Absolute path to the test file.
+    static string absolutePath(const string& filename) {
+        ostringstream s;
+        s << DHCP_DATA_DIR << "/" << filename;
+        return (s.str());
+    }
+
+    /// @brief Cleans up the input files with the @c LeaseFileLoader.
+    ///
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    /// @return Contents of the resulting file.
+    template<typename LeaseObjectType, typename LeaseFileType,
+             typename StorageType>
+    string loadWrite() {
+        StorageType storage;
+        LeaseFileType lf_previous(previous_);
+        if (lf_previous.exists()) {
+            LeaseFileLoader::load<LeaseObjectType>(lf_previous, storage);
+        }
+        LeaseFileType lf_copy(copy_);
+        if (lf_copy.exists()) {
+            LeaseFileLoader::load<LeaseObjectType>(lf_copy, storage);
+        }
+        LeaseFileType lf_expected(expected_);
+        LeaseFileLoader::write<LeaseObjectType>(lf_expected, storage);
+        return (io_expected_.readFile());
+    }
+
+    /// @brief Cleans up the input files with the @c LeaseFileCompactor.
+    ///
+    /// @param thread_count Number of threads.
+    /// @param chunk_size Size of the chunks read from the input files.
+    /// @param window_size Number of leases parsed and written at a time.
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @return Contents of the resulting file.
+    template<typename LeaseObjectType, typename LeaseFileType>
+    string compact(const size_t thread_count, const size_t chunk_size,
+                   const size_t window_size) {
+        io_output_.removeFile();
+        LeaseFileCompactor<LeaseObjectType, LeaseFileType>
+            compactor(thread_count, chunk_size, window_size);
+        LeaseFileType lf_output(output_);
+        vector<string> inputs = { previous_, copy_ };
+        compactor.compact(inputs, lf_output);
+        return (io_output_.readFile());
+    }
+
+    /// @brief Checks that the compactor produces the same file as the
+    /// lease file loader, for various numbers of threads and sizes of
+    /// the chunks and windows.
+    ///
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    template<typename LeaseObjectType, typename LeaseFileType,
+             typename StorageType>
+    void checkSameOutput() {
+        string expected = loadWrite<LeaseObjectType, LeaseFileType,
+                                    StorageType>();
+        for (size_t threads : { 1, 2, 4 }) {
+            for (size_t chunk_size : { 1, 7, 4096 }) {
+                for (size_t window_size : { 1, 3, 1024 }) {
+                    ostringstream s;
+                    s << "threads " << threads << ", chunk " << chunk_size
+                      << ", window " << window_size;
+                    SCOPED_TRACE(s.str());
+                    string output;
+                    ASSERT_NO_THROW(output = (compact<LeaseObjectType,
+                                              LeaseFileType>(threads,
+                                                             chunk_size,
+                                                             window_size)));
+                    EXPECT_EQ(expected, output);
+                }
+            }
+        }
+    }
+
+    /// @brief Names of the input and output files.
+    string previous_;
+    string copy_;
+    string output_;
+    string expected_;
+
+    /// @brief Objects providing access to the files.
+    LeaseFileIO io_previous_;
+    LeaseFileIO io_copy_;
+    LeaseFileIO io_output_;
+    LeaseFileIO io_expected_;
+
+    string v4_hdr_; ///< Header of the v4 lease files
+    string v6_hdr_; ///< Header of the v6 lease files
+};
+
+// Verifies the lease file row splitting.
+TEST(SplitLeaseFileRowTest, split) {
+    vector<string_view> values;
+    splitLeaseFileRow("", values);
+    ASSERT_EQ(1, values.size());
+    EXPECT_EQ("", values[0]);
+
+    splitLeaseFileRow("a,,bc,", values);
+    ASSERT_EQ(4, values.size());
+    EXPECT_EQ("a", values[0]);
+    EXPECT_EQ("", values[1]);
+    EXPECT_EQ("bc", values[2]);
+    EXPECT_EQ("", values[3]);
+}
+
+// Verifies that the DHCPv4 lease files are cleaned up the same way as by
+// the lease file loader: the last entry for every lease is written in
+// address order, the released leases and the invalid entries are dropped.
+TEST_F(LeaseFileCompactorTest, compact4) {
+    io_previous_.writeFile(v4_hdr_ +
+        "192.0.2.1,06:07:08:09:0a:bc,,200,200,8,1,1,host.example.com,1,"
+        "{ \"foobar\": true }\n"
+        "192.0.3.15,dd:de:ba:0d:1b:2e:3e:4f,0a:00:01:04,100,100,7,0,0,,1,\n"
+        "192.0.2.3,,,200,200,8,1,1,host.example.com,0,\n"
+        "192.0.2.7,06:07:08:09:0a:bc,,200,200,8,1,1,,0,\n");
+    io_copy_.writeFile(v4_hdr_ +
+        "192.0.3.15,dd:de:ba:0d:1b:2e:3e:4f,0a:00:01:04,100,135,7,0,0,,1,\n"
+        "192.0.2.7,06:07:08:09:0a:bc,,0,500,8,1,1,,0,\n"
+        "too,few,columns\n"
+        "\n"
+        "192.0.2.1,06:07:08:09:0a:bc,,200,500,8,1,1,host.example.com,1,"
+        "{ \"foobar\": true }\n"
+        "10.0.0.1,06:07:08:09:0a:bd,,300,600,8,0,0,,0,");
+
+    checkSameOutput<Lease4, CSVLeaseFile4, Lease4Storage>();
+
+    // Check the statistics.
+    LeaseFileCompactor<Lease4, CSVLeaseFile4> compactor(2);
+    CSVLeaseFile4 lf_output(output_);
+    io_output_.removeFile();
+    ASSERT_NO_THROW(compactor.compact({ previous_, copy_ }, lf_output));
+    EXPECT_EQ(10, compactor.getReads());
+    EXPECT_EQ(7, compactor.getReadLeases());
+    EXPECT_EQ(3, compactor.getReadErrs());
+    EXPECT_EQ(3, lf_output.getWriteLeases());
+}
+
+// Verifies that the DHCPv6 lease files are cleaned up the same way as by
+// the lease file loader, including the files which need to be upgraded.
+TEST_F(LeaseFileCompactorTest, compact6) {
+    io_previous_.writeFile(
+        "address,duid,valid_lifetime,expire,subnet_id,"
+        "pref_lifetime,lease_type,iaid,prefix_len,fqdn_fwd,"
+        "fqdn_rev,hostname,hwaddr,state,user_context\n"
+        "2001:db8:1::1,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,"
+        "200,200,8,100,0,7,0,1,1,host.example.com,,1,"
+        "{ \"foobar\": true }\n"
+        "2001:db8:1::1,,200,200,8,100,0,7,0,1,1,host.example.com,,1,\n"
+        "2001:db8:2::10,01:01:01:01:0a:01:02:03:04:05,"
+        "300,300,6,150,0,8,0,0,0,,,1,\n"
+        "3000:1::,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,"
+        "100,200,8,0,2,16,64,0,0,,,1,\n");
+    io_copy_.writeFile(v6_hdr_ +
+        "2001:db8:2::10,01:01:01:01:0a:01:02:03:04:05,"
+        "300,800,6,150,0,8,0,0,0,,,1,,0,0\n"
+        "3000:1::,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,"
+        "0,200,8,0,2,16,64,0,0,,,1,,0,0\n"
+        "2001:db8:1::1,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,"
+        "200,400,8,100,0,7,0,1,1,host.example.com,,1,"
+        "{ \"foobar\": true },0,0\n");
+
+    checkSameOutput<Lease6, CSVLeaseFile6, Lease6Storage>();
+}
+
+// Verifies that when the last entry for a lease is corrupted, the last
+// valid entry preceding it is used, as the lease file loader does.
+TEST_F(LeaseFileCompactorTest, corruptedLastEntry) {
+    io_previous_.writeFile(v4_hdr_ +
+        "192.0.2.1,06:07:08:09:0a:bc,,200,200,8,1,1,first,1,\n"
+        "192.0.2.2,06:07:08:09:0a:bd,,200,200,8,1,1,,1,\n");
+    io_copy_.writeFile(v4_hdr_ +
+        "192.0.2.1,06:07:08:09:0a:bc,,200,300,8,1,1,second,1,\n"
+        // Invalid hardware address.
+        "192.0.2.1,zz,,200,400,8,1,1,third,1,\n"
+        // Invalid state, so the release is ignored.
+        "192.0.2.2,06:07:08:09:0a:bd,,0,400,8,1,1,,foo,\n");
+
+    checkSameOutput<Lease4, CSVLeaseFile4, Lease4Storage>();
+    EXPECT_NE(string::npos, io_output_.readFile().find("second"));
+}
+
+// Verifies that the maximum number of errors per file is enforced.
+TEST_F(LeaseFileCompactorTest, maxRowErrors) {
+    io_copy_.writeFile(v4_hdr_ +
+        "192.0.2.100,08:00:27:25:d3:f4,31:31:31:31,3600,1565356064,1,0,0,,0,\n"
+        "192.0.2.101,FF:FF:FF:FF:FF:01,32:32:32:31,3600,1565356073,1,0,0\n"
+        "192.0.2.102,FF:FF:FF:FF:FF:02,32:32:32:32,3600,1565356073,1,0,0\n"
+        "192.0.2.103,FF:FF:FF:FF:FF:03,32:32:32:33,3600,1565356073,1,0,0\n");
+
+    LeaseFileCompactor<Lease4, CSVLeaseFile4> compactor(2);
+    CSVLeaseFile4 lf_output(output_);
+    EXPECT_THROW(compactor.compact({ previous_, copy_ }, lf_output, 2),
+                 util::CSVFileError);
+
+    io_output_.removeFile();
+    ASSERT_NO_THROW(compactor.compact({ previous_, copy_ }, lf_output, 3));
+    EXPECT_EQ(3, compactor.getReadErrs());
+    EXPECT_EQ(1, lf_output.getWriteLeases());
+}
+
+// Verifies that missing input files produce an empty lease file.
+TEST_F(LeaseFileCompactorTest, noInputs) {
+    LeaseFileCompactor<Lease6, CSVLeaseFile6> compactor;
+    EXPECT_LE(1, compactor.getThreadCount());
+    CSVLeaseFile6 lf_output(output_);
+    ASSERT_NO_THROW(compactor.compact({ previous_, copy_ }, lf_output));
+    EXPECT_EQ(0, compactor.getReads());
+    EXPECT_EQ(v6_hdr_, io_output_.readFile());
+}
+
+} // end of anonymous namespace
@@ -0,0 +1,314 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <dhcpsrv/csv_lease_file4.h>
+#include <dhcpsrv/csv_lease_file6.h>
+#include <dhcpsrv/lease_file_loader.h>
+#include <dhcpsrv/lease_snapshot.h>
+#include <dhcpsrv/memfile_lease_storage.h>
+#include <dhcpsrv/testutils/lease_file_io.h>
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <string>
+
+#include <unistd.h>
+
+using namespace isc;
+using namespace isc::dhcp;
+using namespace isc::dhcp::test;
+using namespace std;
+
+namespace {
+
+/// @brief Test fixture class for the lease snapshot.
+class LeaseSnapshotTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Removes the files left by previous tests.
+    LeaseSnapshotTest()
+        : csv_(absolutePath("leases.csv.2")),
+          snapshot_(absolutePath("leases.csv.snapshot")),
+          io_csv_(csv_), io_snapshot_(snapshot_),
+          io_tmp_(snapshot_ + ".tmp"), io_heap_(snapshot_ + ".heap") {
+        io_csv_.removeFile();
+        io_snapshot_.removeFile();
+        io_tmp_.removeFile();
+        io_heap_.removeFile();
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Removes the test files.
+    virtual ~LeaseSnapshotTest() {
+        io_csv_.removeFile();
+        io_snapshot_.removeFile();
+        io_tmp_.removeFile();
+        io_heap_.removeFile();
+    }
+
+    /// @brief Prepends the absolute path to the file specified
+    /// as an argument.
+    ///
+    /// @param filename Name of the file.
+    /// @return Absolute path to the test file.
+    static string absolutePath(const string& filename) {
+        ostringstream s;
+        s << DHCP_DATA_DIR << "/" << filename;
+        return (s.str());
+    }
+
+    /// @brief Writes the snapshot of the lease file.
+    ///
+    /// The leases are loaded from the lease file and written to the
+    /// snapshot committed against the lease file.
+    ///
+    /// @param contents Contents of the lease file.
+    /// @param [out] storage Leases loaded from the lease file.
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    template<typename LeaseObjectType, typename LeaseFileType,
+             typename StorageType>
+    void writeSnapshot(const string& contents, StorageType& storage) {
+        io_csv_.writeFile(contents);
+        LeaseFileType lf(csv_);
+        ASSERT_NO_THROW(LeaseFileLoader::load<LeaseObjectType>(lf, storage));
+
+        const uint16_t family = std::is_same<LeaseObjectType, Lease4>::value ? 4 : 6;
+        LeaseSnapshotWriter writer(snapshot_, family);
+        ASSERT_NO_THROW(LeaseFileLoader::writeSnapshot<LeaseObjectType>(writer,
+                                                                        storage,
+                                                                        csv_));
+        EXPECT_EQ(storage.size(), writer.getRecordCount());
+        EXPECT_FALSE(io_tmp_.exists());
+        EXPECT_FALSE(io_heap_.exists());
+    }
+
+    /// @brief Checks that the snapshot holds the same leases as the
+    /// lease file it was created from.
+    ///
+    /// @param contents Contents of the lease file.
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    template<typename LeaseObjectType, typename LeaseFileType,
+             typename StorageType>
+    void checkRoundTrip(const string& contents) {
+        StorageType expected;
+        writeSnapshot<LeaseObjectType, LeaseFileType>(contents, expected);
+        ASSERT_FALSE(expected.empty());
+
+        const uint16_t family = std::is_same<LeaseObjectType, Lease4>::value ? 4 : 6;
+        LeaseSnapshotFile snapshot(snapshot_);
+        ASSERT_TRUE(snapshot.exists());
+        ASSERT_NO_THROW(snapshot.open(family, csv_));
+        EXPECT_EQ(expected.size(), snapshot.getRecordCount());
+
+        StorageType storage;
+        ASSERT_NO_THROW(LeaseFileLoader::loadSnapshot<LeaseObjectType>(snapshot,
+                                                                       storage));
+        ASSERT_EQ(expected.size(), storage.size());
+        auto lease = storage.begin();
+        for (auto exp = expected.begin(); exp != expected.end(); ++exp, ++lease) {
+            checkLease(**exp, **lease);
+        }
+    }
+
+    /// @brief Compares the DHCPv4 leases.
+    ///
+    /// The old lifetime and cltt are not compared, as they are set to
+    /// the time of creation of the lease objects.
+    ///
+    /// @param expected Expected lease.
+    /// @param lease Lease to check.
+    void checkLease(const Lease4& expected, const Lease4& lease) {
+        EXPECT_EQ(expected.toText(), lease.toText());
+        ASSERT_EQ(static_cast<bool>(expected.client_id_),
+                  static_cast<bool>(lease.client_id_));
+        ASSERT_TRUE(expected.hwaddr_ && lease.hwaddr_);
+        EXPECT_TRUE(*expected.hwaddr_ == *lease.hwaddr_);
+        EXPECT_EQ(expected.hostname_, lease.hostname_);
+        checkContext(expected, lease);
+    }
+
+    /// @brief Compares the DHCPv6 leases.
+    ///
+    /// @param expected Expected lease.
+    /// @param lease Lease to check.
+    void checkLease(const Lease6& expected, const Lease6& lease) {
+        EXPECT_EQ(expected.toText(), lease.toText());
+        ASSERT_TRUE(expected.duid_ && lease.duid_);
+        EXPECT_TRUE(*expected.duid_ == *lease.duid_);
+        ASSERT_EQ(static_cast<bool>(expected.hwaddr_),
+                  static_cast<bool>(lease.hwaddr_));
+        if (expected.hwaddr_) {
+            EXPECT_TRUE(*expected.hwaddr_ == *lease.hwaddr_);
+        }
+        EXPECT_EQ(expected.cltt_, lease.cltt_);
+        EXPECT_EQ(expected.alloc_time_, lease.alloc_time_);
+        EXPECT_EQ(expected.pool_id_, lease.pool_id_);
+        checkContext(expected, lease);
+    }
+
+    /// @brief Compares the user contexts of the leases.
+    ///
+    /// @param expected Expected lease.
+    /// @param lease Lease to check.
+    void checkContext(const Lease& expected, const Lease& lease) {
+        ASSERT_EQ(static_cast<bool>(expected.getContext()),
+                  static_cast<bool>(lease.getContext()));
+        if (expected.getContext()) {
+            EXPECT_TRUE(expected.getContext()->equals(*lease.getContext()));
+        }
+    }
+
+    /// @brief Header of the DHCPv4 lease file.
+    string v4_hdr_ = "address,hwaddr,client_id,valid_lifetime,expire,subnet_id,"
+                     "fqdn_fwd,fqdn_rev,hostname,state,user_context\n";
+
+    /// @brief Header of the DHCPv6 lease file.
+    string v6_hdr_ = "address,duid,valid_lifetime,expire,subnet_id,"
+                     "pref_lifetime,lease_type,iaid,prefix_len,fqdn_fwd,"
+                     "fqdn_rev,hostname,hwaddr,state,user_context,"
+                     "allocation_time,pool_id\n";
+
+    /// @brief Name of the lease file.
+    string csv_;
+
+    /// @brief Name of the snapshot file.
+    string snapshot_;
+
+    /// @brief Object providing access to the lease file.
+    LeaseFileIO io_csv_;
+
+    /// @brief Object providing access to the snapshot file.
+    LeaseFileIO io_snapshot_;
+
+    /// @brief Object providing access to the temporary snapshot file.
+    LeaseFileIO io_tmp_;
+
+    /// @brief Object providing access to the temporary heap file.
+    LeaseFileIO io_heap_;
+};
+
+// Verifies that the snapshot holds the same DHCPv4 leases as the lease
+// file, including the optional values.
+TEST_F(LeaseSnapshotTest, roundTrip4) {
+    checkRoundTrip<Lease4, CSVLeaseFile4, Lease4Storage>(v4_hdr_ +
+        "192.0.2.1,06:07:08:09:0a:bc,,200,200,8,1,1,host.example.com,1,"
+        "{ \"foobar\": true }\n"
+        "192.0.3.15,dd:de:ba:0d:1b:2e:3e:4f,0a:00:01:04,100,135,7,0,0,,0,\n"
+        "192.0.2.3,,,200,200,8,1,0,host&#x2cexample.com,1,\n"
+        "10.0.0.1,06:07:08:09:0a:bd,,300,600,8,0,1,,2,\n");
+}
+
+// Verifies that the snapshot holds the same DHCPv6 leases as the lease
+// file, including the optional values.
+TEST_F(LeaseSnapshotTest, roundTrip6) {
+    checkRoundTrip<Lease6, CSVLeaseFile6, Lease6Storage>(v6_hdr_ +
+        "2001:db8:1::1,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,"
+        "200,200,8,100,0,7,128,1,1,host.example.com,,1,"
+        "{ \"foobar\": true },100,3\n"
+        "2001:db8:2::,01:01:01:01:0a:01:02:03:04:05,"
+        "300,400,6,150,2,8,64,0,0,,06:07:08:09:0a:bc,0,,50,0\n"
+        "3000:1::,00,200,200,8,100,0,7,128,0,0,,,1,,0,0\n");
+}
+
+// Verifies that the snapshot is rejected when the lease file has been
+// modified since the snapshot was created.
+TEST_F(LeaseSnapshotTest, staleSnapshot) {
+    Lease4Storage expected;
+    writeSnapshot<Lease4, CSVLeaseFile4>(v4_hdr_ +
+        "192.0.2.1,06:07:08:09:0a:bc,,200,200,8,1,1,host.example.com,1,\n",
+        expected);
+
+    {
+        LeaseSnapshotFile snapshot(snapshot_);
+        EXPECT_NO_THROW(snapshot.open(4, csv_));
+    }
+
+    // Rewrite the lease file with different contents.
+    io_csv_.writeFile(v4_hdr_ +
+        "192.0.2.1,06:07:08:09:0a:bc,,200,300,8,1,1,host.example.com,1,\n"
+        "192.0.2.2,06:07:08:09:0a:bd,,200,300,8,1,1,host.example.com,1,\n");
+
+    LeaseSnapshotFile snapshot(snapshot_);
+    EXPECT_THROW(snapshot.open(4, csv_), LeaseSnapshotError);
+    EXPECT_EQ(0, snapshot.getRecordCount());
+
+    // The lease file must exist.
+    io_csv_.removeFile();
+    EXPECT_THROW(snapshot.open(4, csv_), LeaseSnapshotError);
+}
+
+// Verifies that snapshots of the wrong family or corrupted snapshots are
+// rejected.
+TEST_F(LeaseSnapshotTest, invalidSnapshot) {
+    Lease4Storage expected;
+    writeSnapshot<Lease4, CSVLeaseFile4>(v4_hdr_ +
+        "192.0.2.1,06:07:08:09:0a:bc,,200,200,8,1,1,host.example.com,1,\n"
+        "192.0.2.2,06:07:08:09:0a:bd,,200,300,8,1,1,host.example.com,1,\n",
+        expected);
+
+    LeaseSnapshotFile snapshot(snapshot_);
+    EXPECT_THROW(snapshot.open(6, csv_), LeaseSnapshotError);
+
+    // Truncate the heap.
+    string contents = io_snapshot_.readFile();
+    io_snapshot_.writeFile(contents.substr(0, contents.size() - 1));
+    EXPECT_THROW(snapshot.open(4, csv_), LeaseSnapshotError);
+
+    // Not a snapshot.
+    io_snapshot_.writeFile(string(sizeof(LeaseSnapshotHeader), 'x'));
+    EXPECT_THROW(snapshot.open(4, csv_), LeaseSnapshotError);
+
+    io_snapshot_.writeFile("short");
+    EXPECT_THROW(snapshot.open(4, csv_), LeaseSnapshotError);
+
+    io_snapshot_.removeFile();
+    EXPECT_FALSE(snapshot.exists());
+    EXPECT_THROW(snapshot.open(4, csv_), LeaseSnapshotError);
+}
+
+// Verifies that the writer rejects leases of the wrong family and that
+// an uncommitted snapshot and its heap are discarded.
+TEST_F(LeaseSnapshotTest, writerErrors) {
+    EXPECT_THROW(LeaseSnapshotWriter(snapshot_, 5), BadValue);
+
+    Lease4 lease4;
+    Lease6 lease6;
+    {
+        LeaseSnapshotWriter writer(snapshot_, 4);
+        EXPECT_THROW(writer.append(lease4), LeaseSnapshotError);
+        ASSERT_NO_THROW(writer.open());
+        EXPECT_TRUE(io_tmp_.exists());
+        EXPECT_TRUE(io_heap_.exists());
+        EXPECT_THROW(writer.append(lease6), LeaseSnapshotError);
+        EXPECT_THROW(writer.commit(csv_), LeaseSnapshotError);
+    }
+    EXPECT_FALSE(io_tmp_.exists());
+    EXPECT_FALSE(io_heap_.exists());
+    EXPECT_FALSE(io_snapshot_.exists());
+}
+
+} // end of anonymous namespace
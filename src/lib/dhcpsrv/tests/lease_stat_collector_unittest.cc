@@ -0,0 +1,344 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <dhcpsrv/lease_stat_collector.h>
+#include <exceptions/exceptions.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <limits>
+#include <map>
+#include <mutex>
+
+using namespace isc;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Stub of the database queries.
+///
+/// The lease table is a map of tokens to the subnet, type and state of
+/// the lease stored there.
+class LeaseStatSourceStub : public LeaseStatSource {
+public:
+
+    /// @brief Constructor.
+    LeaseStatSourceStub()
+        : status_(COUNTERS_ABSENT), claim_(true), fail_scan_(false),
+          scans_(0), generation_(0), claimed_generation_(0) {
+    }
+
+    /// @brief Returns the state of the counter table.
+    CounterStatus getCounterStatus() override {
+        return (status_);
+    }
+
+    /// @brief Claims the rebuild unless @c claim_ is false.
+    bool claimCounterRebuild() override {
+        if (!claim_ || (status_ != COUNTERS_ABSENT)) {
+            return (false);
+        }
+        status_ = COUNTERS_REBUILDING;
+        claimed_generation_ = generation_ + 1;
+        return (true);
+    }
+
+    /// @brief Marks the counters as absent.
+    void abortCounterRebuild() override {
+        base_.erase(claimed_generation_);
+        status_ = COUNTERS_ABSENT;
+    }
+
+    /// @brief Marks the counters as up to date.
+    void setCountersReady() override {
+        generation_ = claimed_generation_;
+        status_ = COUNTERS_READY;
+    }
+
+    /// @brief Reads all counters.
+    void readCounters(LeaseStatCounts& counts) override {
+        for (auto const& counter : base_[generation_]) {
+            counts[counter.first] += counter.second;
+        }
+        readDeltaCounters(counts);
+    }
+
+    /// @brief Reads the delta counters.
+    void readDeltaCounters(LeaseStatCounts& counts) override {
+        std::lock_guard<std::mutex> lk(mutex_);
+        for (auto const& counter : counters_) {
+            counts[counter.first] += counter.second;
+        }
+    }
+
+    /// @brief Adds values to the base counters of the claimed generation.
+    void addToBaseCounters(const LeaseStatCounts& values) override {
+        for (auto const& value : values) {
+            base_[claimed_generation_][value.first] += value.second;
+        }
+    }
+
+    /// @brief Counts the leases of a token range.
+    ///
+    /// The first call adds @c concurrent_deltas_ to the delta counters, as
+    /// a server changing leases in ranges already scanned would.
+    void scanTokenRange(const TokenRange& range, LeaseStatCounts& counts) override {
+        ++scans_;
+        if (fail_scan_) {
+            isc_throw(Unexpected, "scan failed");
+        }
+        {
+            std::lock_guard<std::mutex> lk(mutex_);
+            for (auto const& delta : concurrent_deltas_) {
+                counters_[delta.first] += delta.second;
+            }
+            concurrent_deltas_.clear();
+        }
+        for (auto it = leases_.lower_bound(range.first);
+             (it != leases_.end()) && (it->first <= range.second); ++it) {
+            ++counts[it->second];
+        }
+    }
+
+    /// @brief Adds leases to the table.
+    ///
+    /// @param row Subnet, type and state of the leases.
+    /// @param count Number of leases.
+    void addLeases(const LeaseStatsRow& row, const size_t count) {
+        // Spread the leases over the ring.
+        for (size_t i = 0; i < count; ++i) {
+            const uint64_t token = ++lease_count_ * 0x9e3779b97f4a7c15ULL;
+            leases_[static_cast<int64_t>(token)] = row;
+        }
+    }
+
+    /// @brief Lease table.
+    std::map<int64_t, LeaseStatsRow> leases_;
+
+    /// @brief Delta counters.
+    LeaseStatCounts counters_;
+
+    /// @brief Base counters, by generation.
+    std::map<uint64_t, LeaseStatCounts> base_;
+
+    /// @brief Lease changes made during the next scan.
+    LeaseStatCounts concurrent_deltas_;
+
+    /// @brief State of the counters.
+    CounterStatus status_;
+
+    /// @brief Whether the rebuild claims succeed.
+    bool claim_;
+
+    /// @brief Whether the scans fail.
+    bool fail_scan_;
+
+    /// @brief Number of scanned token ranges.
+    std::atomic<size_t> scans_;
+
+    /// @brief Generation of the base counters in use.
+    uint64_t generation_;
+
+    /// @brief Generation of the base counters being rebuilt.
+    uint64_t claimed_generation_;
+
+private:
+
+    /// @brief Protects the delta counters.
+    std::mutex mutex_;
+
+    /// @brief Number of added leases.
+    uint64_t lease_count_ = 0;
+};
+
+/// @brief Test fixture class for @c LeaseStatCollector.
+class LeaseStatCollectorTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Stores leases of two subnets.
+    LeaseStatCollectorTest()
+        : default1_(1, Lease::TYPE_NA, Lease::STATE_DEFAULT, 0),
+          declined1_(1, Lease::TYPE_NA, Lease::STATE_DECLINED, 0),
+          default2_(2, Lease::TYPE_PD, Lease::STATE_DEFAULT, 0) {
+        source_.addLeases(default1_, 300);
+        source_.addLeases(declined1_, 20);
+        source_.addLeases(default2_, 1000);
+    }
+
+    /// @brief Checks the counts of the stored leases.
+    ///
+    /// @param counts Collected counts.
+    void checkCounts(const LeaseStatCounts& counts) {
+        ASSERT_EQ(3, counts.size());
+        EXPECT_EQ(300, counts.at(default1_));
+        EXPECT_EQ(20, counts.at(declined1_));
+        EXPECT_EQ(1000, counts.at(default2_));
+    }
+
+    /// @brief Stub of the database queries.
+    LeaseStatSourceStub source_;
+
+    /// @brief Counters of the stored leases.
+    /// @{
+    LeaseStatsRow default1_;
+    LeaseStatsRow declined1_;
+    LeaseStatsRow default2_;
+    /// @}
+};
+
+// Verifies that the token ring is split in contiguous ranges.
+TEST(SplitTokenRingTest, split) {
+    EXPECT_THROW(splitTokenRing(0), BadValue);
+
+    std::vector<TokenRange> ranges = splitTokenRing(1);
+    ASSERT_EQ(1, ranges.size());
+    EXPECT_EQ(std::numeric_limits<int64_t>::min(), ranges[0].first);
+    EXPECT_EQ(std::numeric_limits<int64_t>::max(), ranges[0].second);
+
+    for (size_t count : { 2, 3, 7, 256 }) {
+        ranges = splitTokenRing(count);
+        ASSERT_EQ(count, ranges.size());
+        EXPECT_EQ(std::numeric_limits<int64_t>::min(), ranges.front().first);
+        EXPECT_EQ(std::numeric_limits<int64_t>::max(), ranges.back().second);
+        for (size_t i = 0; i < count; ++i) {
+            EXPECT_LT(ranges[i].first, ranges[i].second);
+            if (i > 0) {
+                EXPECT_EQ(ranges[i - 1].second + 1, ranges[i].first);
+            }
+        }
+    }
+}
+
+// Verifies the counter changes of a lease change.
+TEST(AddLeaseStatDeltaTest, delta) {
+    LeaseStatsRow assigned(1, Lease::STATE_DEFAULT, 0);
+    LeaseStatsRow declined(1, Lease::STATE_DECLINED, 0);
+    LeaseStatsRow moved(2, Lease::STATE_DEFAULT, 0);
+
+    LeaseStatCounts deltas;
+    addLeaseStatDelta(deltas, assigned, assigned);
+    EXPECT_TRUE(deltas.empty());
+
+    addLeaseStatDelta(deltas, assigned, declined);
+    addLeaseStatDelta(deltas, declined, moved);
+    ASSERT_EQ(3, deltas.size());
+    EXPECT_EQ(-1, deltas[assigned]);
+    EXPECT_EQ(0, deltas[declined]);
+    EXPECT_EQ(1, deltas[moved]);
+}
+
+// Verifies that the leases are scanned when the counters are disabled.
+TEST_F(LeaseStatCollectorTest, scan) {
+    source_.status_ = LeaseStatSource::COUNTERS_READY;
+    LeaseStatCollector collector(source_, false, 1, 16);
+    EXPECT_EQ(LeaseStatCollector::NONE, collector.getMethod());
+    checkCounts(collector.collect());
+    EXPECT_EQ(LeaseStatCollector::SCAN, collector.getMethod());
+    EXPECT_EQ(16, source_.scans_);
+}
+
+// Verifies that the ranges are scanned by many threads.
+TEST_F(LeaseStatCollectorTest, scanThreads) {
+    LeaseStatCollector collector(source_, false, 4, 64);
+    checkCounts(collector.collect());
+    EXPECT_EQ(64, source_.scans_);
+}
+
+// Verifies that up to date counters are read as they are.
+TEST_F(LeaseStatCollectorTest, counters) {
+    source_.status_ = LeaseStatSource::COUNTERS_READY;
+    source_.counters_[default1_] = 5;
+    LeaseStatCollector collector(source_, true, 4, 64);
+    LeaseStatCounts counts = collector.collect();
+    EXPECT_EQ(LeaseStatCollector::COUNTERS, collector.getMethod());
+    ASSERT_EQ(1, counts.size());
+    EXPECT_EQ(5, counts[default1_]);
+    EXPECT_EQ(0, source_.scans_);
+}
+
+// Verifies that absent counters are rebuilt from a scan.
+TEST_F(LeaseStatCollectorTest, rebuild) {
+    // The changes made before the rebuild are off.
+    source_.counters_[default1_] = 10;
+    source_.counters_[declined1_] = 25;
+    LeaseStatCollector collector(source_, true, 4, 64);
+    checkCounts(collector.collect());
+    EXPECT_EQ(LeaseStatCollector::REBUILD, collector.getMethod());
+    EXPECT_EQ(LeaseStatSource::COUNTERS_READY, source_.status_);
+    EXPECT_EQ(1, source_.generation_);
+    LeaseStatCounts counters;
+    source_.readCounters(counters);
+    checkCounts(counters);
+
+    // The next collection reads the counters.
+    source_.scans_ = 0;
+    checkCounts(collector.collect());
+    EXPECT_EQ(LeaseStatCollector::COUNTERS, collector.getMethod());
+    EXPECT_EQ(0, source_.scans_);
+}
+
+// Verifies that the lease changes made during a rebuild are counted.
+TEST_F(LeaseStatCollectorTest, rebuildConcurrentChanges) {
+    source_.counters_[default1_] = 10;
+    // Leases added and declined in ranges already scanned.
+    source_.concurrent_deltas_[default1_] = 7;
+    source_.concurrent_deltas_[declined1_] = 2;
+    LeaseStatCollector collector(source_, true, 4, 64);
+    checkCounts(collector.collect());
+    EXPECT_EQ(LeaseStatCollector::REBUILD, collector.getMethod());
+
+    LeaseStatCounts counts = collector.collect();
+    EXPECT_EQ(LeaseStatCollector::COUNTERS, collector.getMethod());
+    ASSERT_EQ(3, counts.size());
+    EXPECT_EQ(307, counts[default1_]);
+    EXPECT_EQ(22, counts[declined1_]);
+    EXPECT_EQ(1000, counts[default2_]);
+}
+
+// Verifies that the leases are scanned while another server rebuilds the
+// counters.
+TEST_F(LeaseStatCollectorTest, rebuilding) {
+    source_.status_ = LeaseStatSource::COUNTERS_REBUILDING;
+    LeaseStatCollector collector(source_, true, 4, 64);
+    checkCounts(collector.collect());
+    EXPECT_EQ(LeaseStatCollector::SCAN, collector.getMethod());
+    EXPECT_TRUE(source_.counters_.empty());
+
+    // The same happens when the claim of the rebuild is lost.
+    source_.status_ = LeaseStatSource::COUNTERS_ABSENT;
+    source_.claim_ = false;
+    checkCounts(collector.collect());
+    EXPECT_EQ(LeaseStatCollector::SCAN, collector.getMethod());
+    EXPECT_TRUE(source_.counters_.empty());
+}
+
+// Verifies that a failed scan is reported and gives the rebuild up.
+TEST_F(LeaseStatCollectorTest, scanError) {
+    source_.fail_scan_ = true;
+    LeaseStatCollector collector(source_, true, 4, 64);
+    EXPECT_THROW(collector.collect(), Unexpected);
+    EXPECT_EQ(LeaseStatSource::COUNTERS_ABSENT, source_.status_);
+    EXPECT_TRUE(source_.counters_.empty());
+    EXPECT_TRUE(source_.base_.empty());
+}
+
+}  // namespace
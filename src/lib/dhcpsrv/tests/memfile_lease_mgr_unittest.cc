@@ -384,6 +384,12 @@ TEST_F(MemfileLeaseMgrTest, constructor) {
     pmap["max-row-errors"] = "bogus";
     EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), isc::BadValue);
 
+    // The lfc-threads must be an integer.
+    pmap["max-row-errors"] = "5";
+    pmap["lfc-interval"] = "10";
+    pmap["lfc-threads"] = "bogus";
+    EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), isc::BadValue);
+
     // The max-row-errors must be >= 0.
     pmap["persist"] = "true";
     pmap["max-row-errors"] = "-1";
@@ -572,6 +578,138 @@ TEST_F(MemfileLeaseMgrTest, leaseFileCleanup4) {
     EXPECT_EQ(result_file_contents, input_file.readFile());
 }
 
+/// @brief This test checks that the lease file cleanup produces the same
+/// result when the streaming mode of the kea-lfc is configured.
+TEST_F(MemfileLeaseMgrTest, leaseFileCleanup4Streaming) {
+    std::string new_file_contents =
+        "address,hwaddr,client_id,valid_lifetime,expire,"
+        "subnet_id,fqdn_fwd,fqdn_rev,hostname,state,user_context\n";
+
+    std::string current_file_contents = new_file_contents +
+        "192.0.2.2,02:02:02:02:02:02,,200,200,8,1,1,,1,{ \"foo\": true }\n"
+        "192.0.2.2,02:02:02:02:02:02,,200,800,8,1,1,,1,\n"
+        "192.0.2.1,01:01:01:01:01:01,,0,800,8,1,1,,1,\n";
+    LeaseFileIO current_file(getLeaseFilePath("leasefile4_0.csv"));
+    current_file.writeFile(current_file_contents);
+
+    std::string previous_file_contents = new_file_contents +
+        "192.0.2.3,03:03:03:03:03:03,,200,200,8,1,1,,1,\n"
+        "192.0.2.1,01:01:01:01:01:01,,200,200,8,1,1,,1,\n"
+        "192.0.2.3,03:03:03:03:03:03,,200,800,8,1,1,,1,{ \"bar\": true }\n";
+    LeaseFileIO previous_file(getLeaseFilePath("leasefile4_0.csv.2"));
+    previous_file.writeFile(previous_file_contents);
+
+    DatabaseConnection::ParameterMap pmap;
+    pmap["type"] = "memfile";
+    pmap["universe"] = "4";
+    pmap["name"] = getLeaseFilePath("leasefile4_0.csv");
+    pmap["lfc-interval"] = "1";
+    pmap["lfc-threads"] = "2";
+    std::unique_ptr<NakedMemfileLeaseMgr> lease_mgr(new NakedMemfileLeaseMgr(pmap));
+
+    ASSERT_NO_THROW(lease_mgr->lfcCallback());
+    ASSERT_TRUE(waitForProcess(*lease_mgr, 10));
+    EXPECT_EQ(0, lease_mgr->getLFCExitStatus())
+        << "Executing the LFC process failed: make sure that"
+        " the kea-lfc program has been compiled.";
+
+    // The released lease is removed and the other leases are written
+    // in address order.
+    std::string result_file_contents = new_file_contents +
+        "192.0.2.2,02:02:02:02:02:02,,200,800,8,1,1,,1,\n"
+        "192.0.2.3,03:03:03:03:03:03,,200,800,8,1,1,,1,{ \"bar\": true }\n";
+    LeaseFileIO input_file(getLeaseFilePath("leasefile4_0.csv.2"), false);
+    ASSERT_TRUE(input_file.exists());
+    EXPECT_EQ(result_file_contents, input_file.readFile());
+}
+
+/// @brief This test checks that lease file updates are written when the
+/// group commit of the lease file is enabled, including after the lease
+/// file has been rotated by the lease file cleanup.
+TEST_F(MemfileLeaseMgrTest, groupCommit4) {
+    std::string new_file_contents =
+        "address,hwaddr,client_id,valid_lifetime,expire,"
+        "subnet_id,fqdn_fwd,fqdn_rev,hostname,state,user_context\n";
+    LeaseFileIO current_file(getLeaseFilePath("leasefile4_0.csv"));
+
+    DatabaseConnection::ParameterMap pmap;
+    pmap["type"] = "memfile";
+    pmap["universe"] = "4";
+    pmap["name"] = getLeaseFilePath("leasefile4_0.csv");
+    pmap["lfc-interval"] = "1";
+    pmap["group-commit"] = "true";
+    pmap["fsync-policy"] = "batch";
+    pmap["wait-for-durability"] = "true";
+    std::unique_ptr<NakedMemfileLeaseMgr> lease_mgr(new NakedMemfileLeaseMgr(pmap));
+
+    std::vector<uint8_t> hwaddr_vec(6);
+    HWAddrPtr hwaddr(new HWAddr(hwaddr_vec, HTYPE_ETHER));
+    Lease4Ptr new_lease(new Lease4(IOAddress("192.0.2.45"), hwaddr,
+                                   static_cast<const uint8_t*>(0), 0,
+                                   100, 0, 1));
+    ASSERT_NO_THROW(lease_mgr->addLease(new_lease));
+
+    // The lease must be in the file when addLease returns, because the
+    // backend waits for durability.
+    EXPECT_EQ(new_file_contents +
+              "192.0.2.45,00:00:00:00:00:00,,100,100,1,0,0,,0,\n",
+              current_file.readFile());
+
+    // Deleting the lease appends the entry with valid lifetime set to 0.
+    ASSERT_TRUE(lease_mgr->deleteLease(new_lease));
+    EXPECT_EQ(new_file_contents +
+              "192.0.2.45,00:00:00:00:00:00,,100,100,1,0,0,,0,\n"
+              "192.0.2.45,00:00:00:00:00:00,,0,0,1,0,0,,0,\n",
+              current_file.readFile());
+
+    // Run the lease file cleanup. The lease file is rotated and a new
+    // one, containing only the header, is opened for writing.
+    ASSERT_NO_THROW(lease_mgr->lfcCallback());
+    ASSERT_TRUE(current_file.exists());
+    EXPECT_EQ(new_file_contents, current_file.readFile());
+
+    ASSERT_TRUE(waitForProcess(*lease_mgr, 10));
+    EXPECT_EQ(0, lease_mgr->getLFCExitStatus())
+        << "Executing the LFC process failed: make sure that"
+        " the kea-lfc program has been compiled.";
+
+    // The group commit must continue with the new lease file.
+    new_lease.reset(new Lease4(IOAddress("192.0.2.46"), hwaddr,
+                               static_cast<const uint8_t*>(0), 0,
+                               100, 0, 1));
+    ASSERT_NO_THROW(lease_mgr->addLease(new_lease));
+    EXPECT_EQ(new_file_contents +
+              "192.0.2.46,00:00:00:00:00:00,,100,100,1,0,0,,0,\n",
+              current_file.readFile());
+}
+
+/// @brief This test checks that invalid group commit parameters are
+/// rejected.
+TEST_F(MemfileLeaseMgrTest, groupCommitInvalidParameters) {
+    DatabaseConnection::ParameterMap pmap;
+    pmap["type"] = "memfile";
+    pmap["universe"] = "4";
+    pmap["name"] = getLeaseFilePath("leasefile4_0.csv");
+    pmap["lfc-interval"] = "0";
+    pmap["group-commit"] = "yes";
+    EXPECT_THROW(NakedMemfileLeaseMgr lease_mgr(pmap), isc::BadValue);
+
+    pmap["group-commit"] = "true";
+    pmap["fsync-policy"] = "always";
+    EXPECT_THROW(NakedMemfileLeaseMgr lease_mgr(pmap), isc::BadValue);
+
+    pmap["fsync-policy"] = "interval";
+    pmap["fsync-interval"] = "ten";
+    EXPECT_THROW(NakedMemfileLeaseMgr lease_mgr(pmap), isc::BadValue);
+
+    pmap["fsync-interval"] = "100";
+    pmap["wait-for-durability"] = "maybe";
+    EXPECT_THROW(NakedMemfileLeaseMgr lease_mgr(pmap), isc::BadValue);
+
+    pmap["wait-for-durability"] = "false";
+    EXPECT_NO_THROW(NakedMemfileLeaseMgr lease_mgr(pmap));
+}
+
 /// @brief This test checks that the callback function executing the cleanup of the
 /// DHCPv6 lease file works as expected.
 TEST_F(MemfileLeaseMgrTest, leaseFileCleanup6) {
@@ -846,6 +984,12 @@ TEST_F(MemfileLeaseMgrTest, basicLease4) {
     testBasicLease4();
 }
 
+/// @brief Checks that many IPv4 leases can be added at once.
+TEST_F(MemfileLeaseMgrTest, addLeases4) {
+    startBackend(V4);
+    testAddLeases4();
+}
+
 /// @brief Basic Lease4 Checks
 TEST_F(MemfileLeaseMgrTest, basicLease4MultiThread) {
     startBackend(V4);
@@ -1132,6 +1276,12 @@ TEST_F(MemfileLeaseMgrTest, basicLease6) {
     testBasicLease6();
 }
 
+/// @brief Checks that many IPv6 leases can be added at once.
+TEST_F(MemfileLeaseMgrTest, addLeases6) {
+    startBackend(V6);
+    testAddLeases6();
+}
+
 /// @brief Basic Lease6 Checks
 TEST_F(MemfileLeaseMgrTest, basicLease6MultiThread) {
     startBackend(V6);
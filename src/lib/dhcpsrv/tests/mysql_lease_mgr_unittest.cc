@@ -300,6 +300,11 @@ TEST_F(MySqlLeaseMgrTest, basicLease4) {
     testBasicLease4();
 }
 
+/// @brief Checks that many IPv4 leases can be added at once.
+TEST_F(MySqlLeaseMgrTest, addLeases4) {
+    testAddLeases4();
+}
+
 /// @brief Basic Lease4 Checks
 TEST_F(MySqlLeaseMgrTest, basicLease4MultiThreading) {
     MultiThreadingTest mt(true);
@@ -642,6 +647,11 @@ TEST_F(MySqlLeaseMgrTest, basicLease6) {
     testBasicLease6();
 }
 
+/// @brief Checks that many IPv6 leases can be added at once.
+TEST_F(MySqlLeaseMgrTest, addLeases6) {
+    testAddLeases6();
+}
+
 /// @brief Basic Lease6 Checks
 TEST_F(MySqlLeaseMgrTest, basicLease6MultiThreading) {
     MultiThreadingTest mt(true);
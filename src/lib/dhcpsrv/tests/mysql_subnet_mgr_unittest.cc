@@ -229,6 +229,10 @@ TEST_F(MySqlSubnet4MgrTest, testUpdate) {
     testUpdate();
 }
 
+TEST_F(MySqlSubnet4MgrTest, testBatch) {
+    testBatch();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////// SUBNET6 ///////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -266,4 +270,8 @@ TEST_F(MySqlSubnet6MgrTest, testUpdate) {
     testUpdate();
 }
 
+TEST_F(MySqlSubnet6MgrTest, testBatch) {
+    testBatch();
+}
+
 }  // namespace
@@ -0,0 +1,261 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <cc/command_interpreter.h>
+#include <cc/data.h>
+#include <dhcpsrv/notifications_manager.h>
+#include <stats/stats_mgr.h>
+
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace isc;
+using namespace isc::config;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::stats;
+
+namespace {
+
+/// @brief Transport recording the commands instead of sending them.
+///
+/// The transport blocks while it is closed, so that the tests can pile up
+/// notifications in the queue.
+struct FakeTransport {
+    /// @brief Sends a command.
+    ElementPtr send(std::string const& /* socket_path */, ElementPtr const& command) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        commands_.push_back(command);
+        cv_.notify_all();
+        cv_.wait(lock, [this] { return open_; });
+        if (fail_) {
+            isc_throw(Unexpected, "no one is listening");
+        }
+        std::string const& name(command->get(CONTROL_COMMAND)->stringValue());
+        if (name == NotificationsSender::BATCH_COMMAND) {
+            if (!batching_) {
+                return createAnswer(CONTROL_RESULT_COMMAND_UNSUPPORTED, "unsupported");
+            }
+            ElementPtr const& answers(Element::createList());
+            for (ElementPtr const& notification :
+                 command->get(CONTROL_ARGUMENTS)->get("notifications")->listValue()) {
+                answers->add(answer(notification));
+            }
+            return createAnswer(CONTROL_RESULT_SUCCESS, "batch", answers);
+        }
+        return answer(command);
+    }
+
+    /// @brief Answers a notification with its own name as text.
+    static ElementPtr answer(ElementPtr const& notification) {
+        return createAnswer(CONTROL_RESULT_SUCCESS,
+                            notification->get(CONTROL_COMMAND)->stringValue());
+    }
+
+    /// @brief Waits until the given number of commands has been sent.
+    void waitForCommands(size_t const count) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [&] { return commands_.size() >= count; });
+    }
+
+    /// @brief Lets the blocked and future commands through.
+    void open() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        open_ = true;
+        cv_.notify_all();
+    }
+
+    NotificationsSender::Transport transport() {
+        return [this](std::string const& socket_path, ElementPtr const& command) {
+            return send(socket_path, command);
+        };
+    }
+
+    std::vector<ElementPtr> commands_;
+    bool open_ = false;
+    bool fail_ = false;
+    bool batching_ = true;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+};
+
+/// @brief Creates a notification command.
+ElementPtr notification(std::string const& name) {
+    ElementPtr const& command(Element::createMap());
+    command->set(CONTROL_COMMAND, name);
+    command->set(CONTROL_ARGUMENTS, Element::createMap());
+    return command;
+}
+
+/// @brief Returns the text of an answer.
+std::string answerText(ElementPtr const& answer) {
+    return answer->get(CONTROL_TEXT)->stringValue();
+}
+
+// Verifies that the notifications queued while a command is in flight are
+// sent in one batch and that each gets its own response.
+TEST(NotificationsSenderTest, batch) {
+    FakeTransport fake;
+    NotificationsSender sender("socket", 1, 16, 8, fake.transport());
+
+    auto const first(sender.enqueue(notification("first")));
+    ASSERT_NE(0, first);
+    fake.waitForCommands(1);
+
+    std::vector<NotificationsSender::timestamp_t> ids;
+    for (size_t i = 0; i < 10; ++i) {
+        ids.push_back(sender.enqueue(notification("n" + std::to_string(i))));
+        ASSERT_NE(0, ids.back());
+    }
+    fake.open();
+
+    EXPECT_EQ("first", answerText(sender.await(first)));
+    for (size_t i = 0; i < ids.size(); ++i) {
+        ElementPtr const& response(sender.await(ids[i]));
+        ASSERT_TRUE(response);
+        EXPECT_EQ("n" + std::to_string(i), answerText(response));
+    }
+
+    // One single command, a batch of 8 and the remaining 2.
+    ASSERT_EQ(3, fake.commands_.size());
+    EXPECT_EQ("first", fake.commands_[0]->get(CONTROL_COMMAND)->stringValue());
+    ElementPtr const& batch(fake.commands_[1]);
+    ASSERT_EQ(NotificationsSender::BATCH_COMMAND, batch->get(CONTROL_COMMAND)->stringValue());
+    EXPECT_EQ(8, batch->get(CONTROL_ARGUMENTS)->get("notifications")->size());
+    EXPECT_EQ(2, fake.commands_[2]->get(CONTROL_ARGUMENTS)->get("notifications")->size());
+}
+
+// Verifies that notifications are dropped and counted when the queue is full.
+TEST(NotificationsSenderTest, overflow) {
+    StatsMgr::instance().removeAll();
+    FakeTransport fake;
+    NotificationsSender sender("socket", 1, 2, 8, fake.transport());
+
+    ASSERT_NE(0, sender.enqueue(notification("in-flight")));
+    fake.waitForCommands(1);
+    EXPECT_NE(0, sender.enqueue(notification("queued-1")));
+    EXPECT_NE(0, sender.enqueue(notification("queued-2")));
+    EXPECT_EQ(0, sender.enqueue(notification("dropped-1")));
+    EXPECT_EQ(0, sender.enqueue(notification("dropped-2")));
+    EXPECT_EQ(2, sender.getDroppedCount());
+
+    ObservationPtr const& dropped(StatsMgr::instance().getObservation("notifications-dropped"));
+    ASSERT_TRUE(dropped);
+    EXPECT_EQ(2, dropped->getInteger().first);
+
+    fake.open();
+    fake.waitForCommands(2);
+    StatsMgr::instance().removeAll();
+}
+
+// Verifies that the notifications are sent one by one when the other end
+// does not know the batch command.
+TEST(NotificationsSenderTest, batchingUnsupported) {
+    FakeTransport fake;
+    fake.batching_ = false;
+    NotificationsSender sender("socket", 1, 16, 8, fake.transport());
+
+    ASSERT_NE(0, sender.enqueue(notification("first")));
+    fake.waitForCommands(1);
+    auto const second(sender.enqueue(notification("second")));
+    auto const third(sender.enqueue(notification("third")));
+    fake.open();
+
+    EXPECT_EQ("second", answerText(sender.await(second)));
+    EXPECT_EQ("third", answerText(sender.await(third)));
+
+    // The rejected batch is followed by the individual notifications.
+    ASSERT_EQ(4, fake.commands_.size());
+    EXPECT_EQ("second", fake.commands_[2]->get(CONTROL_COMMAND)->stringValue());
+    EXPECT_EQ("third", fake.commands_[3]->get(CONTROL_COMMAND)->stringValue());
+}
+
+// Verifies that waiting for an undelivered notification returns no response.
+TEST(NotificationsSenderTest, sendFailed) {
+    FakeTransport fake;
+    fake.fail_ = true;
+    fake.open();
+    NotificationsSender sender("socket", 1, 16, 8, fake.transport());
+
+    auto const id(sender.enqueue(notification("lost")));
+    ASSERT_NE(0, id);
+    EXPECT_FALSE(sender.await(id));
+}
+
+// Verifies that forgotten responses are not kept.
+TEST(NotificationsSenderTest, forget) {
+    FakeTransport fake;
+    NotificationsSender sender("socket", 1, 16, 8, fake.transport());
+
+    auto const id(sender.enqueue(notification("forgotten")));
+    ASSERT_NE(0, id);
+    sender.forget(id);
+    fake.open();
+    fake.waitForCommands(1);
+
+    EXPECT_FALSE(sender.check(id));
+    EXPECT_FALSE(sender.await(id));
+}
+
+// Verifies that the shared senders exist only between start and stop.
+TEST(NotificationsSenderTest, startStop) {
+    EXPECT_FALSE(NotificationsSender::instance("socket"));
+
+    NotificationsSender::start();
+    NotificationsSenderPtr const sender(NotificationsSender::instance("socket"));
+    ASSERT_TRUE(sender);
+    EXPECT_EQ(sender, NotificationsSender::instance("socket"));
+    EXPECT_NE(sender, NotificationsSender::instance("other-socket"));
+
+    // A stopped sender drops everything, even if it is still referenced.
+    NotificationsSender::stop();
+    EXPECT_FALSE(NotificationsSender::instance("socket"));
+    EXPECT_EQ(0, sender->enqueue(notification("late")));
+
+    // Starting again creates new senders.
+    NotificationsSender::start();
+    NotificationsSenderPtr const restarted(NotificationsSender::instance("socket"));
+    ASSERT_TRUE(restarted);
+    EXPECT_NE(sender, restarted);
+    NotificationsSender::stop();
+}
+
+// Verifies that nothing is notified while the senders are stopped.
+TEST(NotificationsManagerTest, stopped) {
+    ElementPtr const& socket(Element::fromJSON(R"({ "socket-name": "socket" })"));
+    NotificationsManager manager(socket);
+    auto const id(manager.notify("decline-received"));
+    EXPECT_EQ(0, id);
+    EXPECT_FALSE(manager.await(id));
+}
+
+// Verifies that nothing is sent without a notifications socket.
+TEST(NotificationsManagerTest, noSocket) {
+    NotificationsManager manager(ElementPtr{});
+    auto const id(manager.notify("decline-received"));
+    EXPECT_EQ(0, id);
+    EXPECT_FALSE(manager.check(id));
+    EXPECT_FALSE(manager.await(id));
+}
+
+}  // namespace
@@ -258,6 +258,11 @@ TEST_F(PgSqlLeaseMgrTest, basicLease4) {
     testBasicLease4();
 }
 
+/// @brief Checks that many IPv4 leases can be added at once.
+TEST_F(PgSqlLeaseMgrTest, addLeases4) {
+    testAddLeases4();
+}
+
 /// @brief Basic Lease4 Checks
 TEST_F(PgSqlLeaseMgrTest, basicLease4MultiThreading) {
     MultiThreadingTest mt(true);
@@ -600,6 +605,11 @@ TEST_F(PgSqlLeaseMgrTest, basicLease6) {
     testBasicLease6();
 }
 
+/// @brief Checks that many IPv6 leases can be added at once.
+TEST_F(PgSqlLeaseMgrTest, addLeases6) {
+    testAddLeases6();
+}
+
 /// @brief Basic Lease6 Checks
 TEST_F(PgSqlLeaseMgrTest, basicLease6MultiThreading) {
     MultiThreadingTest mt(true);
@@ -229,6 +229,10 @@ TEST_F(PgSqlSubnet4MgrTest, testUpdate) {
     testUpdate();
 }
 
+TEST_F(PgSqlSubnet4MgrTest, testBatch) {
+    testBatch();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////// SUBNET6 ///////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -266,4 +270,8 @@ TEST_F(PgSqlSubnet6MgrTest, testUpdate) {
     testUpdate();
 }
 
+TEST_F(PgSqlSubnet6MgrTest, testBatch) {
+    testBatch();
+}
+
 }  // namespace
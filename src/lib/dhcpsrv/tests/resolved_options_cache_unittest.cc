@@ -0,0 +1,158 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <dhcp/dhcp4.h>
+#include <dhcp/option.h>
+#include <dhcp/option_space.h>
+#include <dhcpsrv/cfg_option.h>
+#include <dhcpsrv/resolved_options_cache.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace isc;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Creates an option with the specified code and one byte of data.
+OptionPtr createOption(const uint16_t code, const uint8_t value) {
+    return (OptionPtr(new Option(Option::V4, code,
+                                 OptionBuffer(1, value))));
+}
+
+/// @brief Test fixture class for @c ResolvedOptionsCache.
+class ResolvedOptionsCacheTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Configures the routers option at both levels, the domain name
+    /// option at the subnet level and the persistent time offset option
+    /// at the global level.
+    ResolvedOptionsCacheTest()
+        : subnet_(new CfgOption()), global_(new CfgOption()) {
+        subnet_->add(createOption(DHO_ROUTERS, 1), false, DHCP4_OPTION_SPACE);
+        subnet_->add(createOption(DHO_DOMAIN_NAME, 1), false, DHCP4_OPTION_SPACE);
+        global_->add(createOption(DHO_ROUTERS, 2), false, DHCP4_OPTION_SPACE);
+        global_->add(createOption(DHO_TIME_OFFSET, 2), true, DHCP4_OPTION_SPACE);
+        co_list_.push_back(subnet_);
+        co_list_.push_back(global_);
+    }
+
+    /// @brief Subnet level options.
+    CfgOptionPtr subnet_;
+
+    /// @brief Global options.
+    CfgOptionPtr global_;
+
+    /// @brief Configured option list.
+    CfgOptionList co_list_;
+};
+
+// Verifies that the options are resolved by the precedence of the option
+// configurations and that the persistent options follow the requested ones.
+TEST_F(ResolvedOptionsCacheTest, resolve) {
+    std::vector<uint16_t> codes = { DHO_DOMAIN_NAME, DHO_HOST_NAME, DHO_ROUTERS };
+    ResolvedOptionsCache::ResolvedOptionsPtr resolved =
+        ResolvedOptionsCache::resolve(co_list_, DHCP4_OPTION_SPACE, codes, true);
+    ASSERT_TRUE(resolved);
+    ASSERT_EQ(3, resolved->size());
+    EXPECT_EQ(DHO_DOMAIN_NAME, (*resolved)[0].first);
+    EXPECT_EQ(DHO_ROUTERS, (*resolved)[1].first);
+    EXPECT_EQ(1, (*resolved)[1].second->getData()[0]);
+    EXPECT_EQ(DHO_TIME_OFFSET, (*resolved)[2].first);
+
+    // Without the persistent options.
+    resolved = ResolvedOptionsCache::resolve(co_list_, DHCP4_OPTION_SPACE,
+                                             codes, false);
+    ASSERT_EQ(2, resolved->size());
+    EXPECT_EQ(DHO_ROUTERS, (*resolved)[1].first);
+
+    // Nothing is resolved in other option spaces.
+    resolved = ResolvedOptionsCache::resolve(co_list_, "isc", codes, false);
+    EXPECT_TRUE(resolved->empty());
+}
+
+// Verifies that the resolved options are cached by the option
+// configurations and the requested codes.
+TEST_F(ResolvedOptionsCacheTest, get) {
+    ResolvedOptionsCache cache;
+    std::vector<uint16_t> codes = { DHO_ROUTERS };
+
+    ResolvedOptionsCache::ResolvedOptionsPtr resolved =
+        cache.get(co_list_, DHCP4_OPTION_SPACE, codes, false);
+    ASSERT_EQ(1, resolved->size());
+    EXPECT_EQ(1, cache.size());
+    EXPECT_EQ(resolved, cache.get(co_list_, DHCP4_OPTION_SPACE, codes, false));
+    EXPECT_EQ(1, cache.size());
+
+    // Other codes, persistent flag and option configurations are other
+    // entries.
+    codes.push_back(DHO_DOMAIN_NAME);
+    EXPECT_NE(resolved, cache.get(co_list_, DHCP4_OPTION_SPACE, codes, false));
+    EXPECT_EQ(2, cache.size());
+    cache.get(co_list_, DHCP4_OPTION_SPACE, codes, true);
+    EXPECT_EQ(3, cache.size());
+
+    CfgOptionList global_list;
+    global_list.push_back(global_);
+    resolved = cache.get(global_list, DHCP4_OPTION_SPACE, codes, false);
+    ASSERT_EQ(1, resolved->size());
+    EXPECT_EQ(2, (*resolved)[0].second->getData()[0]);
+    EXPECT_EQ(4, cache.size());
+
+    cache.clear();
+    EXPECT_EQ(0, cache.size());
+}
+
+// Verifies that the cache is emptied when it is full.
+TEST_F(ResolvedOptionsCacheTest, maxEntries) {
+    ResolvedOptionsCache cache(2);
+    for (uint16_t code = 1; code <= 2; ++code) {
+        cache.get(co_list_, DHCP4_OPTION_SPACE,
+                  std::vector<uint16_t>(1, code), false);
+    }
+    EXPECT_EQ(2, cache.size());
+
+    cache.get(co_list_, DHCP4_OPTION_SPACE, std::vector<uint16_t>(1, 3), false);
+    EXPECT_EQ(1, cache.size());
+}
+
+// Verifies that an entry is not hit by another option configuration
+// allocated where a freed one was.
+TEST_F(ResolvedOptionsCacheTest, replacedConfiguration) {
+    ResolvedOptionsCache cache;
+    const std::vector<uint16_t> codes(1, DHO_ROUTERS);
+    for (uint8_t value = 1; value <= 8; ++value) {
+        CfgOptionPtr cfg_option(new CfgOption());
+        cfg_option->add(createOption(DHO_ROUTERS, value), false,
+                        DHCP4_OPTION_SPACE);
+        CfgOptionList co_list;
+        co_list.push_back(cfg_option);
+        ResolvedOptionsCache::ResolvedOptionsPtr resolved =
+            cache.get(co_list, DHCP4_OPTION_SPACE, codes, false);
+        ASSERT_EQ(1, resolved->size());
+        EXPECT_EQ(value, (*resolved)[0].second->getData()[0]);
+    }
+    EXPECT_EQ(8, cache.size());
+}
+
+}
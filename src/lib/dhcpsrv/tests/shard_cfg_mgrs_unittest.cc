@@ -0,0 +1,197 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <dhcpsrv/shard_cfg_mgrs.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace isc;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::util;
+
+namespace {
+
+using Mgrs = ShardCfgMgrs<DHCP_SPACE_V4>;
+using MgrsPtr = ShardCfgMgrsPtr<DHCP_SPACE_V4>;
+using Cache = ShardCfgMgrsCache<DHCP_SPACE_V4>;
+using Tasks = ShardTasks<DHCP_SPACE_V4>;
+
+/// @brief Test fixture creating managers without database connections.
+struct ShardCfgMgrsTest : ::testing::Test {
+    /// @brief Constructor
+    ShardCfgMgrsTest()
+        : created_(0), cache_([this](std::string const& access_string) {
+              ++created_;
+              return createMgrs(access_string);
+          }) {
+    }
+
+    /// @brief Creates managers without database connections.
+    static MgrsPtr createMgrs(std::string const& access_string = "type=mysql") {
+        return std::make_shared<Mgrs>(access_string, std::shared_ptr<ShardConfigMgr>(),
+                                      std::unique_ptr<SubnetMgr<DHCP_SPACE_V4>>());
+    }
+
+    /// @brief Returns shard credentials.
+    static ElementPtr credentials(std::string const& password = "keatest") {
+        return Element::fromJSON("{ \"type\": \"mysql\", \"name\": \"keatest\","
+                                 " \"user\": \"keatest\", \"password\": \"" +
+                                 password + "\" }");
+    }
+
+    /// @brief number of managers created by the cache
+    std::atomic<size_t> created_;
+
+    /// @brief the tested cache
+    Cache cache_;
+};
+
+// Verifies that the shards get their own managers even when they share the
+// same credentials, and that the managers are reused.
+TEST_F(ShardCfgMgrsTest, cachePerShard) {
+    MgrsPtr const first(cache_.get("master", "shard1", credentials()));
+    MgrsPtr const second(cache_.get("master", "shard2", credentials()));
+    MgrsPtr const third(cache_.get("other-master", "shard1", credentials()));
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    ASSERT_TRUE(third);
+    EXPECT_NE(first, second);
+    EXPECT_NE(first, third);
+    EXPECT_NE(second, third);
+    EXPECT_EQ(3, created_);
+
+    EXPECT_EQ(first, cache_.get("master", "shard1", credentials()));
+    EXPECT_EQ(second, cache_.get("master", "shard2", credentials()));
+    EXPECT_EQ(3, created_);
+}
+
+// Verifies that the managers are created again when the credentials of the
+// shard change or when the cache is cleared.
+TEST_F(ShardCfgMgrsTest, cacheRenew) {
+    MgrsPtr const first(cache_.get("master", "shard", credentials()));
+    MgrsPtr const second(cache_.get("master", "shard", credentials("other")));
+    EXPECT_NE(first, second);
+    EXPECT_NE(first->access_string_, second->access_string_);
+    EXPECT_EQ(second, cache_.get("master", "shard", credentials("other")));
+
+    cache_.clear();
+    EXPECT_NE(second, cache_.get("master", "shard", credentials("other")));
+    EXPECT_EQ(3, created_);
+
+    EXPECT_THROW(cache_.get("master", "shard", ElementPtr()), BadValue);
+}
+
+// Verifies that the threads getting the managers of a shard concurrently
+// get the same managers.
+TEST_F(ShardCfgMgrsTest, cacheConcurrentGet) {
+    std::vector<MgrsPtr> mgrs(8);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < mgrs.size(); ++i) {
+        threads.emplace_back([&, i]() {
+            mgrs[i] = cache_.get("master", "shard", credentials());
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    for (MgrsPtr const& m : mgrs) {
+        EXPECT_EQ(mgrs.front(), m);
+    }
+    EXPECT_EQ(1, created_);
+}
+
+// Verifies that the tasks using the same managers run in order and never at
+// the same time while the tasks of different managers run on the pool.
+TEST_F(ShardCfgMgrsTest, tasksConcurrentDispatch) {
+    size_t const shards(4);
+    size_t const tasks_per_shard(16);
+    std::vector<MgrsPtr> mgrs;
+    std::vector<std::atomic<int>> in_use(shards);
+    std::vector<std::vector<size_t>> order(shards);
+    std::atomic<bool> overlap(false);
+
+    // All the shards share the same credentials.
+    Tasks tasks;
+    for (size_t shard = 0; shard < shards; ++shard) {
+        mgrs.push_back(createMgrs());
+        in_use[shard] = 0;
+    }
+    for (size_t i = 0; i < tasks_per_shard; ++i) {
+        for (size_t shard = 0; shard < shards; ++shard) {
+            tasks.add(mgrs[shard], [&, shard, i]() {
+                if (in_use[shard]++) {
+                    overlap = true;
+                }
+                order[shard].push_back(i);
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                --in_use[shard];
+            });
+        }
+    }
+    EXPECT_EQ(shards, tasks.size());
+
+    ThreadPool<std::function<void()>> pool;
+    ASSERT_NO_THROW(tasks.run(pool, 4));
+    EXPECT_EQ(4, pool.size());
+    EXPECT_FALSE(overlap);
+    for (size_t shard = 0; shard < shards; ++shard) {
+        ASSERT_EQ(tasks_per_shard, order[shard].size());
+        for (size_t i = 0; i < tasks_per_shard; ++i) {
+            EXPECT_EQ(i, order[shard][i]);
+        }
+    }
+    pool.stop();
+}
+
+// Verifies that the first exception thrown by a task is rethrown once all
+// the shards are done and that the tasks of a failed shard stop there.
+TEST_F(ShardCfgMgrsTest, tasksException) {
+    MgrsPtr const failing(createMgrs());
+    MgrsPtr const working(createMgrs());
+    std::atomic<size_t> failing_done(0);
+    std::atomic<size_t> working_done(0);
+
+    Tasks tasks;
+    tasks.add(failing, [&]() { ++failing_done; });
+    tasks.add(working, [&]() { ++working_done; });
+    tasks.add(failing, []() { isc_throw(Unexpected, "shard failure"); });
+    tasks.add(working, [&]() { ++working_done; });
+    tasks.add(failing, [&]() { ++failing_done; });
+
+    ThreadPool<std::function<void()>> pool;
+    EXPECT_THROW(tasks.run(pool, 2), Unexpected);
+    EXPECT_EQ(1, failing_done);
+    EXPECT_EQ(2, working_done);
+    pool.stop();
+
+    // Without threads, the tasks run in the calling thread.
+    failing_done = 0;
+    working_done = 0;
+    EXPECT_THROW(tasks.run(pool, 1), Unexpected);
+    EXPECT_EQ(0, pool.size());
+    EXPECT_EQ(1, failing_done);
+}
+
+}  // namespace
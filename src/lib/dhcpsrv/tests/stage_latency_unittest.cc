@@ -0,0 +1,204 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <cc/command_interpreter.h>
+#include <dhcpsrv/stage_latency.h>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace isc;
+using namespace isc::config;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::util;
+
+namespace {
+
+/// @brief Test fixture class for @c StageLatency.
+class StageLatencyTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    StageLatencyTest() {
+        StageLatency::setEnabled(false);
+        StageLatency::reset();
+    }
+
+    /// @brief Destructor.
+    ~StageLatencyTest() {
+        StageLatency::setEnabled(false);
+        StageLatency::reset();
+    }
+
+    /// @brief Checks the status of an answer and returns its arguments.
+    ///
+    /// @param answer Answer of a command.
+    /// @param expected_status Expected status code.
+    ElementPtr checkAnswer(const ElementPtr& answer, const int expected_status) {
+        int status = -1;
+        ElementPtr args = parseAnswer(status, answer);
+        EXPECT_EQ(expected_status, status) << answerToText(answer);
+        return (args);
+    }
+};
+
+// Verifies the names of the stages.
+TEST_F(StageLatencyTest, stageToText) {
+    EXPECT_EQ("classify", StageLatency::stageToText(StageLatency::CLASSIFY));
+    EXPECT_EQ("select-subnet", StageLatency::stageToText(StageLatency::SELECT_SUBNET));
+    EXPECT_EQ("host-lookup", StageLatency::stageToText(StageLatency::HOST_LOOKUP));
+    EXPECT_EQ("lease-allocation", StageLatency::stageToText(StageLatency::LEASE_ALLOCATION));
+    EXPECT_EQ("hooks", StageLatency::stageToText(StageLatency::HOOKS));
+    EXPECT_EQ("build-options", StageLatency::stageToText(StageLatency::BUILD_OPTIONS));
+    EXPECT_EQ("send", StageLatency::stageToText(StageLatency::SEND));
+    EXPECT_EQ("total", StageLatency::stageToText(StageLatency::TOTAL));
+    EXPECT_EQ("unknown", StageLatency::stageToText(StageLatency::STAGE_COUNT));
+}
+
+// Verifies that a timer records only when the timing is enabled.
+TEST_F(StageLatencyTest, timer) {
+    EXPECT_FALSE(StageLatency::isEnabled());
+    {
+        StageLatencyTimer timer(StageLatency::CLASSIFY);
+    }
+    EXPECT_EQ(0, StageLatency::getHistogram(StageLatency::CLASSIFY).getCount());
+
+    StageLatency::setEnabled(true);
+    {
+        StageLatencyTimer timer(StageLatency::CLASSIFY);
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    LatencyHistogram histogram = StageLatency::getHistogram(StageLatency::CLASSIFY);
+    EXPECT_EQ(1, histogram.getCount());
+    EXPECT_LE(2000000, histogram.getMin());
+
+    // A stopped timer records once.
+    {
+        StageLatencyTimer timer(StageLatency::SEND);
+        timer.stop();
+        timer.stop();
+    }
+    EXPECT_EQ(1, StageLatency::getHistogram(StageLatency::SEND).getCount());
+
+    // A timer started while disabled stays idle.
+    StageLatency::setEnabled(false);
+    {
+        StageLatencyTimer timer(StageLatency::SEND);
+        StageLatency::setEnabled(true);
+    }
+    EXPECT_EQ(1, StageLatency::getHistogram(StageLatency::SEND).getCount());
+}
+
+// Verifies that the histograms of the threads are merged, also after the
+// threads have exited, and that they are reset.
+TEST_F(StageLatencyTest, threads) {
+    StageLatency::setEnabled(true);
+    std::vector<std::thread> threads;
+    for (uint64_t i = 1; i <= 4; ++i) {
+        threads.push_back(std::thread([i]() {
+            for (uint64_t j = 0; j < 100; ++j) {
+                StageLatency::record(StageLatency::LEASE_ALLOCATION,
+                                     std::chrono::nanoseconds(i * 1000));
+            }
+        }));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    StageLatency::record(StageLatency::LEASE_ALLOCATION, std::chrono::nanoseconds(1));
+
+    LatencyHistogram histogram = StageLatency::getHistogram(StageLatency::LEASE_ALLOCATION);
+    EXPECT_EQ(401, histogram.getCount());
+    EXPECT_EQ(1, histogram.getMin());
+    EXPECT_EQ(4000, histogram.getMax());
+    EXPECT_EQ(0, StageLatency::getHistogram(StageLatency::HOOKS).getCount());
+
+    StageLatency::reset();
+    EXPECT_EQ(0, StageLatency::getHistogram(StageLatency::LEASE_ALLOCATION).getCount());
+}
+
+// Verifies the stage-latency-get command.
+TEST_F(StageLatencyTest, getCommand) {
+    StageLatency::record(StageLatency::SELECT_SUBNET, std::chrono::nanoseconds(100));
+    StageLatency::record(StageLatency::SELECT_SUBNET, std::chrono::nanoseconds(300));
+
+    ElementPtr args = checkAnswer(StageLatency::commandStageLatencyGetHandler("", ElementPtr()),
+                                  CONTROL_RESULT_SUCCESS);
+    ASSERT_TRUE(args);
+    ASSERT_TRUE(args->get("enabled"));
+    EXPECT_FALSE(args->get("enabled")->boolValue());
+    ElementPtr stages = args->get("stages");
+    ASSERT_TRUE(stages);
+    EXPECT_EQ(StageLatency::STAGE_COUNT, stages->mapValue().size());
+    ElementPtr stage = stages->get("select-subnet");
+    ASSERT_TRUE(stage);
+    EXPECT_EQ(2, stage->get("count")->intValue());
+    EXPECT_EQ(100, stage->get("min")->intValue());
+    EXPECT_EQ(300, stage->get("max")->intValue());
+    EXPECT_DOUBLE_EQ(200.0, stage->get("mean")->doubleValue());
+    EXPECT_GE(stage->get("p99")->intValue(), stage->get("p50")->intValue());
+    EXPECT_FALSE(stage->get("buckets"));
+    EXPECT_EQ(0, stages->get("total")->get("count")->intValue());
+
+    ElementPtr get_args = Element::fromJSON("{ \"buckets\": true }");
+    args = checkAnswer(StageLatency::commandStageLatencyGetHandler("", get_args),
+                       CONTROL_RESULT_SUCCESS);
+    ElementPtr buckets = args->get("stages")->get("select-subnet")->get("buckets");
+    ASSERT_TRUE(buckets);
+    ASSERT_EQ(2, buckets->size());
+    EXPECT_EQ(1, buckets->get(0)->get(2)->intValue());
+
+    get_args = Element::fromJSON("{ \"buckets\": 1 }");
+    checkAnswer(StageLatency::commandStageLatencyGetHandler("", get_args),
+                CONTROL_RESULT_ERROR);
+}
+
+// Verifies the stage-latency-set command.
+TEST_F(StageLatencyTest, setCommand) {
+    checkAnswer(StageLatency::commandStageLatencySetHandler("", ElementPtr()),
+                CONTROL_RESULT_ERROR);
+    checkAnswer(StageLatency::commandStageLatencySetHandler("", Element::createMap()),
+                CONTROL_RESULT_ERROR);
+    checkAnswer(StageLatency::commandStageLatencySetHandler("",
+                    Element::fromJSON("{ \"enable\": \"yes\" }")),
+                CONTROL_RESULT_ERROR);
+    EXPECT_FALSE(StageLatency::isEnabled());
+
+    checkAnswer(StageLatency::commandStageLatencySetHandler("",
+                    Element::fromJSON("{ \"enable\": true }")),
+                CONTROL_RESULT_SUCCESS);
+    EXPECT_TRUE(StageLatency::isEnabled());
+
+    StageLatency::record(StageLatency::HOOKS, std::chrono::nanoseconds(10));
+    checkAnswer(StageLatency::commandStageLatencySetHandler("",
+                    Element::fromJSON("{ \"reset\": true }")),
+                CONTROL_RESULT_SUCCESS);
+    EXPECT_TRUE(StageLatency::isEnabled());
+    EXPECT_EQ(0, StageLatency::getHistogram(StageLatency::HOOKS).getCount());
+
+    checkAnswer(StageLatency::commandStageLatencySetHandler("",
+                    Element::fromJSON("{ \"enable\": false }")),
+                CONTROL_RESULT_SUCCESS);
+    EXPECT_FALSE(StageLatency::isEnabled());
+}
+
+}  // namespace
@@ -0,0 +1,349 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <cc/data.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <dhcpsrv/parsers/dhcp_parsers.h>
+#include <dhcpsrv/shared_network.h>
+#include <dhcpsrv/srv_config.h>
+#include <dhcpsrv/subnet.h>
+#include <dhcpsrv/subnet_delta.h>
+#include <stats/stats_mgr.h>
+
+#include <gtest/gtest.h>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::stats;
+
+namespace {
+
+/// @brief Test fixture class for @c SubnetDelta.
+class SubnetDeltaTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Creates a configuration with the subnet 1 and with the subnet 2
+    /// in the shared network "frog".
+    SubnetDeltaTest() : cfg_(new SrvConfig()) {
+        CfgMgr::instance().clear();
+        StatsMgr::instance().removeAll();
+
+        Subnet4Ptr subnet1(new Subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 3,
+                                       SubnetID(1)));
+        cfg_->getCfgSubnets4()->add(subnet1);
+
+        Subnet4Ptr subnet2(new Subnet4(IOAddress("192.0.3.0"), 24, 1, 2, 3,
+                                       SubnetID(2)));
+        network_.reset(new SharedNetwork4("frog"));
+        network_->add(subnet2);
+        cfg_->getCfgSharedNetworks4()->add(network_);
+        cfg_->getCfgSubnets4()->add(subnet2);
+    }
+
+    /// @brief Destructor.
+    virtual ~SubnetDeltaTest() {
+        LeaseMgrFactory::destroy();
+        CfgMgr::instance().clear();
+        StatsMgr::instance().removeAll();
+    }
+
+    /// @brief Returns the value of the statistic of the subnet.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    /// @param name Name of the statistic.
+    /// @return Value of the statistic, -1 if it doesn't exist.
+    int64_t getStat(const SubnetID& subnet_id, const std::string& name) {
+        ObservationPtr stat = StatsMgr::instance().getObservation(
+            StatsMgr::generateName("subnet", subnet_id, name));
+        return (stat ? stat->getInteger().first : -1);
+    }
+
+    /// @brief Configuration the changes are applied to.
+    SrvConfigPtr cfg_;
+
+    /// @brief Shared network holding the subnet 2.
+    SharedNetwork4Ptr network_;
+};
+
+// Verifies that a subnet is added and its statistics are set.
+TEST_F(SubnetDeltaTest, add4) {
+    ASSERT_NO_THROW(LeaseMgrFactory::create("universe=4 type=memfile persist=false"));
+    ElementPtr args = Element::fromJSON(
+        "{ \"subnet4\": [ { \"id\": 3, \"subnet\": \"192.0.4.0/24\","
+        " \"pools\": [ { \"pool\": \"192.0.4.10 - 192.0.4.19\" } ] } ] }");
+
+    SubnetDelta<DHCP_SPACE_V4> delta(false);
+    ASSERT_NO_THROW(delta.parse(cfg_, args));
+    // Nothing changes before the changes are applied.
+    EXPECT_FALSE(cfg_->getCfgSubnets4()->getBySubnetId(3));
+
+    ASSERT_NO_THROW(delta.apply(cfg_));
+    EXPECT_EQ(1, delta.getAddedCount());
+    EXPECT_EQ(0, delta.getReplacedCount());
+    EXPECT_EQ(0, delta.getDeletedCount());
+
+    ConstSubnet4Ptr subnet = cfg_->getCfgSubnets4()->getBySubnetId(3);
+    ASSERT_TRUE(subnet);
+    EXPECT_EQ("192.0.4.0/24", subnet->toText());
+    EXPECT_EQ(3, cfg_->getCfgSubnets4()->getAll()->size());
+    EXPECT_EQ(10, getStat(3, "total-addresses"));
+    EXPECT_EQ(0, getStat(3, "assigned-addresses"));
+}
+
+// Verifies that a subnet of a shared network is replaced in the network.
+TEST_F(SubnetDeltaTest, replace4) {
+    ElementPtr args = Element::fromJSON(
+        "{ \"subnet4\": [ { \"id\": 2, \"subnet\": \"192.0.3.0/24\","
+        " \"pools\": [ { \"pool\": \"192.0.3.10 - 192.0.3.29\" } ] } ] }");
+
+    SubnetDelta<DHCP_SPACE_V4> delta(false);
+    ASSERT_NO_THROW(delta.parse(cfg_, args));
+    ASSERT_NO_THROW(delta.apply(cfg_));
+    EXPECT_EQ(0, delta.getAddedCount());
+    EXPECT_EQ(1, delta.getReplacedCount());
+
+    ConstSubnet4Ptr subnet = cfg_->getCfgSubnets4()->getBySubnetId(2);
+    ASSERT_TRUE(subnet);
+    EXPECT_EQ(1, subnet->getPools(Lease::TYPE_V4).size());
+    ASSERT_EQ(1, network_->getAllSubnets()->size());
+    EXPECT_EQ(subnet, network_->getSubnet(2));
+    SharedNetwork4Ptr network;
+    subnet->getSharedNetwork(network);
+    EXPECT_EQ(network_, network);
+    EXPECT_EQ(20, getStat(2, "total-addresses"));
+}
+
+// Verifies that the options resolved for a replaced subnet are forgotten.
+TEST_F(SubnetDeltaTest, resolvedOptions4) {
+    ResolvedOptionsCachePtr cache = cfg_->getResolvedOptionsCache();
+    CfgOptionList co_list;
+    co_list.push_back(cfg_->getCfgSubnets4()->getBySubnetId(2)->getCfgOption());
+    ASSERT_TRUE(cache->get(co_list, DHCP4_OPTION_SPACE,
+                           std::vector<uint16_t>(1, DHO_ROUTERS), false)->empty());
+    EXPECT_EQ(1, cache->size());
+
+    ElementPtr args = Element::fromJSON(
+        "{ \"subnet4\": [ { \"id\": 2, \"subnet\": \"192.0.3.0/24\","
+        " \"option-data\": [ { \"name\": \"routers\","
+        " \"data\": \"192.0.3.1\" } ] } ] }");
+    SubnetDelta<DHCP_SPACE_V4> delta(false);
+    ASSERT_NO_THROW(delta.parse(cfg_, args));
+    ASSERT_NO_THROW(delta.apply(cfg_));
+    EXPECT_EQ(0, cache->size());
+
+    co_list.clear();
+    co_list.push_back(cfg_->getCfgSubnets4()->getBySubnetId(2)->getCfgOption());
+    EXPECT_EQ(1, cache->get(co_list, DHCP4_OPTION_SPACE,
+                            std::vector<uint16_t>(1, DHO_ROUTERS), false)->size());
+}
+
+// Verifies that subnets are deleted, also from their shared networks.
+TEST_F(SubnetDeltaTest, delete4) {
+    cfg_->getCfgSubnets4()->updateStatistics(1, false);
+    ASSERT_NE(-1, getStat(1, "total-addresses"));
+
+    ElementPtr args = Element::fromJSON("{ \"deleted-subnets\": [ 1, 2 ] }");
+
+    SubnetDelta<DHCP_SPACE_V4> delta(false);
+    ASSERT_NO_THROW(delta.parse(cfg_, args));
+    ASSERT_NO_THROW(delta.apply(cfg_));
+    EXPECT_EQ(2, delta.getDeletedCount());
+
+    EXPECT_TRUE(cfg_->getCfgSubnets4()->getAll()->empty());
+    EXPECT_TRUE(network_->getAllSubnets()->empty());
+    EXPECT_EQ(-1, getStat(1, "total-addresses"));
+}
+
+// Verifies that the host reservations of the replaced subnet are replaced.
+TEST_F(SubnetDeltaTest, reservations4) {
+    HostPtr host(new Host("01:02:03:04:05:06", "hw-address", SubnetID(1),
+                          SubnetID(0), IOAddress("192.0.2.5")));
+    cfg_->getCfgHosts()->add(host);
+
+    ElementPtr args = Element::fromJSON(
+        "{ \"subnet4\": [ { \"id\": 1, \"subnet\": \"192.0.2.0/24\","
+        " \"reservations\": [ { \"hw-address\": \"01:02:03:04:05:07\","
+        " \"ip-address\": \"192.0.2.6\" } ] } ] }");
+
+    SubnetDelta<DHCP_SPACE_V4> delta(false);
+    ASSERT_NO_THROW(delta.parse(cfg_, args));
+    ASSERT_NO_THROW(delta.apply(cfg_));
+
+    HostCollection hosts = cfg_->getCfgHosts()->getAll4(SubnetID(1));
+    ASSERT_EQ(1, hosts.size());
+    EXPECT_EQ("192.0.2.6", hosts[0]->getIPv4Reservation().toText());
+}
+
+// Verifies that invalid changes leave the configuration untouched.
+TEST_F(SubnetDeltaTest, invalid4) {
+    ConstCfgSubnets4Ptr subnets = cfg_->getCfgSubnets4();
+
+    // Unknown subnet deleted.
+    {
+        SubnetDelta<DHCP_SPACE_V4> delta(false);
+        EXPECT_THROW(delta.parse(cfg_, Element::fromJSON(
+            "{ \"deleted-subnets\": [ 1, 7 ] }")), BadValue);
+    }
+
+    // Subnet without identifier.
+    {
+        SubnetDelta<DHCP_SPACE_V4> delta(false);
+        EXPECT_THROW(delta.parse(cfg_, Element::fromJSON(
+            "{ \"subnet4\": [ { \"subnet\": \"192.0.4.0/24\" } ] }")),
+            DhcpConfigError);
+    }
+
+    // Prefix of another subnet.
+    {
+        SubnetDelta<DHCP_SPACE_V4> delta(false);
+        EXPECT_THROW(delta.parse(cfg_, Element::fromJSON(
+            "{ \"subnet4\": [ { \"id\": 1, \"subnet\": \"192.0.3.0/24\" } ] }")),
+            DhcpConfigError);
+    }
+
+    // Reservation outside the subnet.
+    {
+        SubnetDelta<DHCP_SPACE_V4> delta(false);
+        EXPECT_THROW(delta.parse(cfg_, Element::fromJSON(
+            "{ \"subnet4\": [ { \"id\": 3, \"subnet\": \"192.0.4.0/24\","
+            " \"reservations\": [ { \"hw-address\": \"01:02:03:04:05:07\","
+            " \"ip-address\": \"192.0.2.6\" } ] } ] }")),
+            DhcpConfigError);
+    }
+
+    EXPECT_EQ(subnets, cfg_->getCfgSubnets4());
+    EXPECT_EQ(2, cfg_->getCfgSubnets4()->getAll()->size());
+    EXPECT_EQ(1, network_->getAllSubnets()->size());
+}
+
+// Verifies that a subnet deleted and added again in one change may
+// change its prefix.
+TEST_F(SubnetDeltaTest, changePrefix4) {
+    ASSERT_NO_THROW(LeaseMgrFactory::create("universe=4 type=memfile persist=false"));
+    ElementPtr args = Element::fromJSON(
+        "{ \"deleted-subnets\": [ 1 ],"
+        " \"subnet4\": [ { \"id\": 1, \"subnet\": \"192.0.5.0/24\" } ] }");
+
+    SubnetDelta<DHCP_SPACE_V4> delta(false);
+    ASSERT_NO_THROW(delta.parse(cfg_, args));
+    ASSERT_NO_THROW(delta.apply(cfg_));
+
+    ConstSubnet4Ptr subnet = cfg_->getCfgSubnets4()->getBySubnetId(1);
+    ASSERT_TRUE(subnet);
+    EXPECT_EQ("192.0.5.0/24", subnet->toText());
+    EXPECT_EQ(subnet, cfg_->getCfgSubnets4()->selectSubnet(IOAddress("192.0.5.1")));
+}
+
+// Verifies that a subnet deleted and added again stays in its shared network.
+TEST_F(SubnetDeltaTest, changePrefixInNetwork4) {
+    ASSERT_NO_THROW(LeaseMgrFactory::create("universe=4 type=memfile persist=false"));
+    ElementPtr args = Element::fromJSON(
+        "{ \"deleted-subnets\": [ 2 ],"
+        " \"subnet4\": [ { \"id\": 2, \"subnet\": \"192.0.6.0/24\" } ] }");
+
+    SubnetDelta<DHCP_SPACE_V4> delta(false);
+    ASSERT_NO_THROW(delta.parse(cfg_, args));
+    ASSERT_NO_THROW(delta.apply(cfg_));
+
+    ConstSubnet4Ptr subnet = cfg_->getCfgSubnets4()->getBySubnetId(2);
+    ASSERT_TRUE(subnet);
+    EXPECT_EQ("192.0.6.0/24", subnet->toText());
+    ASSERT_EQ(1, network_->getAllSubnets()->size());
+    EXPECT_EQ(subnet, network_->getSubnet(2));
+    SharedNetwork4Ptr network;
+    subnet->getSharedNetwork(network);
+    EXPECT_EQ(network_, network);
+}
+
+// Verifies that subnets are put in and taken out of shared networks.
+TEST_F(SubnetDeltaTest, sharedNetworkName4) {
+    ASSERT_NO_THROW(LeaseMgrFactory::create("universe=4 type=memfile persist=false"));
+    ElementPtr args = Element::fromJSON(
+        "{ \"subnet4\": [ { \"id\": 3, \"subnet\": \"192.0.4.0/24\","
+        " \"shared-network-name\": \"frog\" },"
+        " { \"id\": 2, \"subnet\": \"192.0.3.0/24\","
+        " \"shared-network-name\": \"\" } ] }");
+
+    SubnetDelta<DHCP_SPACE_V4> delta(false);
+    ASSERT_NO_THROW(delta.parse(cfg_, args));
+    // The shared network is not changed before the changes are applied.
+    ASSERT_EQ(1, network_->getAllSubnets()->size());
+    EXPECT_TRUE(network_->getSubnet(2));
+
+    ASSERT_NO_THROW(delta.apply(cfg_));
+    ConstSubnet4Ptr added = cfg_->getCfgSubnets4()->getBySubnetId(3);
+    ASSERT_TRUE(added);
+    ASSERT_EQ(1, network_->getAllSubnets()->size());
+    EXPECT_EQ(added, network_->getSubnet(3));
+    EXPECT_EQ("frog", added->getSharedNetworkName());
+
+    ConstSubnet4Ptr replaced = cfg_->getCfgSubnets4()->getBySubnetId(2);
+    ASSERT_TRUE(replaced);
+    SharedNetwork4Ptr network;
+    replaced->getSharedNetwork(network);
+    EXPECT_FALSE(network);
+}
+
+// Verifies that subnets can't be put in unknown or incompatible shared
+// networks.
+TEST_F(SubnetDeltaTest, sharedNetworkNameInvalid4) {
+    {
+        SubnetDelta<DHCP_SPACE_V4> delta(false);
+        EXPECT_THROW(delta.parse(cfg_, Element::fromJSON(
+            "{ \"subnet4\": [ { \"id\": 3, \"subnet\": \"192.0.4.0/24\","
+            " \"shared-network-name\": \"toad\" } ] }")),
+            DhcpConfigError);
+    }
+
+    network_->setIface("eth0");
+    {
+        SubnetDelta<DHCP_SPACE_V4> delta(false);
+        EXPECT_THROW(delta.parse(cfg_, Element::fromJSON(
+            "{ \"subnet4\": [ { \"id\": 3, \"subnet\": \"192.0.4.0/24\","
+            " \"interface\": \"eth1\", \"shared-network-name\": \"frog\" } ] }")),
+            DhcpConfigError);
+    }
+
+    EXPECT_EQ(1, network_->getAllSubnets()->size());
+}
+
+// Verifies that an IPv6 subnet is added.
+TEST_F(SubnetDeltaTest, add6) {
+    ASSERT_NO_THROW(LeaseMgrFactory::create("universe=6 type=memfile persist=false"));
+    ElementPtr args = Element::fromJSON(
+        "{ \"subnet6\": [ { \"id\": 3, \"subnet\": \"2001:db8:1::/64\","
+        " \"pools\": [ { \"pool\": \"2001:db8:1::10 - 2001:db8:1::1f\" } ] } ] }");
+
+    SubnetDelta<DHCP_SPACE_V6> delta(false);
+    ASSERT_NO_THROW(delta.parse(cfg_, args));
+    ASSERT_NO_THROW(delta.apply(cfg_));
+    EXPECT_EQ(1, delta.getAddedCount());
+
+    ConstSubnet6Ptr subnet = cfg_->getCfgSubnets6()->getBySubnetId(3);
+    ASSERT_TRUE(subnet);
+    EXPECT_EQ(16, getStat(3, "total-nas"));
+}
+
+} // end of anonymous namespace
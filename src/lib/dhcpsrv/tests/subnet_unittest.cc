@@ -443,6 +443,49 @@ TEST(Subnet4Test, getCapacity) {
     EXPECT_EQ(200, subnet->getPoolCapacity(Lease::TYPE_V4, three_classes));
 }
 
+// Checks that the pool capacity is cached by the pool index and that
+// the index is discarded when the pools change.
+TEST(Subnet4Test, getCapacityIndexed) {
+    Subnet4Ptr subnet(new Subnet4(IOAddress("192.1.2.0"), 24, 1, 2, 3));
+
+    // The index of a subnet without pools holds no capacity.
+    subnet->buildPoolIndex();
+    EXPECT_EQ(0, subnet->getPoolCapacity(Lease::TYPE_V4));
+
+    PoolPtr pool1(new Pool4(IOAddress("192.1.2.0"), 25));
+    PoolPtr pool2(new Pool4(IOAddress("192.1.2.128"), 26));
+    PoolPtr pool3(new Pool4(IOAddress("192.1.2.192"), 30));
+    pool3->allowClientClass("bar");
+    subnet->addPool(pool1);
+    subnet->addPool(pool2);
+    subnet->addPool(pool3);
+
+    // The index was discarded when the pools were added.
+    EXPECT_EQ(196, subnet->getPoolCapacity(Lease::TYPE_V4));
+
+    isc::dhcp::ClientClasses no_class;
+    isc::dhcp::ClientClasses bar_class;
+    bar_class.insert("bar");
+
+    subnet->buildPoolIndex();
+    EXPECT_EQ(196, subnet->getPoolCapacity(Lease::TYPE_V4));
+    EXPECT_EQ(192, subnet->getPoolCapacity(Lease::TYPE_V4, no_class));
+    EXPECT_EQ(196, subnet->getPoolCapacity(Lease::TYPE_V4, bar_class));
+
+    // Adding a pool discards the index.
+    PoolPtr pool4(new Pool4(IOAddress("192.1.2.200"), 30));
+    subnet->addPool(pool4);
+    EXPECT_EQ(200, subnet->getPoolCapacity(Lease::TYPE_V4));
+    EXPECT_EQ(196, subnet->getPoolCapacity(Lease::TYPE_V4, no_class));
+
+    // So does deleting the pools.
+    subnet->buildPoolIndex();
+    EXPECT_EQ(200, subnet->getPoolCapacity(Lease::TYPE_V4));
+    subnet->delPools(Lease::TYPE_V4);
+    EXPECT_EQ(0, subnet->getPoolCapacity(Lease::TYPE_V4));
+    EXPECT_EQ(0, subnet->getPoolCapacity(Lease::TYPE_V4, bar_class));
+}
+
 // Checks that it is not allowed to add invalid pools.
 TEST(Subnet4Test, pool4Checks) {
 
@@ -641,6 +684,41 @@ TEST(Subnet4Test, inRangeinPool) {
     EXPECT_TRUE(subnet->inPool(Lease::TYPE_V4, IOAddress("192.2.3.4"), three_classes));
 }
 
+// Checks that the pool containing an address is found among many small
+// pools, including the addresses between the pools.
+TEST(Subnet4Test, inPoolManyPools) {
+    Subnet4Ptr subnet(new Subnet4(IOAddress("10.0.0.0"), 16, 1, 2, 3));
+
+    // Add /30 pools leaving a gap of 4 addresses after each of them, in
+    // reverse order.
+    for (int i = 255; i >= 0; --i) {
+        IOAddress first(IOAddress("10.0.0.0").toUint32() + 8 * i);
+        PoolPtr pool(new Pool4(first, 30));
+        if (i % 2) {
+            pool->allowClientClass("odd");
+        }
+        subnet->addPool(pool);
+    }
+
+    isc::dhcp::ClientClasses no_class;
+    isc::dhcp::ClientClasses odd_class;
+    odd_class.insert("odd");
+
+    for (uint32_t offset = 0; offset < 8 * 256 + 8; ++offset) {
+        IOAddress address(IOAddress("10.0.0.0").toUint32() + offset);
+        bool in_pool = (offset < 8 * 256) && (offset % 8 < 4);
+        bool odd = (offset / 8) % 2;
+        EXPECT_EQ(in_pool, subnet->inPool(Lease::TYPE_V4, address))
+            << address;
+        EXPECT_EQ(in_pool && !odd,
+                  subnet->inPool(Lease::TYPE_V4, address, no_class))
+            << address;
+        EXPECT_EQ(in_pool,
+                  subnet->inPool(Lease::TYPE_V4, address, odd_class))
+            << address;
+    }
+}
+
 // This test checks if the toText() method returns text representation
 TEST(Subnet4Test, toText) {
     Subnet4Ptr subnet(new Subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 3));
@@ -1061,6 +1139,32 @@ TEST(Subnet6Test, Pool6PdgetPoolCapacity) {
               subnet->getPoolCapacity(Lease::TYPE_PD));
 }
 
+// Checks that the capacity cached by the pool index saturates the same
+// way as the summed capacity.
+TEST(Subnet6Test, Pool6PdgetPoolCapacityIndexed) {
+    Subnet6Ptr subnet(new Subnet6(IOAddress("2001:db8::"), 32, 1, 2, 3, 4));
+
+    // This is 2^64.
+    PoolPtr pool1(new Pool6(Lease::TYPE_PD, IOAddress("2001:db8:1::"), 48, 112));
+    PoolPtr pool2(new Pool6(Lease::TYPE_PD, IOAddress("2001:db8:2::"), 48, 112));
+    pool2->allowClientClass("foo");
+    subnet->addPool(pool1);
+    subnet->addPool(pool2);
+    subnet->buildPoolIndex();
+
+    isc::dhcp::ClientClasses foo_class;
+    foo_class.insert("foo");
+
+    EXPECT_EQ(0, subnet->getPoolCapacity(Lease::TYPE_NA));
+    EXPECT_EQ(0, subnet->getPoolCapacity(Lease::TYPE_TA));
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(),
+              subnet->getPoolCapacity(Lease::TYPE_PD));
+    EXPECT_EQ(std::numeric_limits<uint64_t>::max(),
+              subnet->getPoolCapacity(Lease::TYPE_PD, foo_class));
+    EXPECT_TRUE(subnet->inPool(Lease::TYPE_PD, IOAddress("2001:db8:2::1")));
+    EXPECT_FALSE(subnet->inPool(Lease::TYPE_PD, IOAddress("2001:db8:3::")));
+}
+
 TEST(Subnet6Test, Pool6InSubnet6) {
 
     Subnet6Ptr subnet(new Subnet6(IOAddress("2001:db8:1::"), 56, 1, 2, 3, 4));
@@ -0,0 +1,277 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef CALLOUT_ARGUMENT_H
+#define CALLOUT_ARGUMENT_H
+
+#include <exceptions/exceptions.h>
+
+#include <boost/any.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+namespace isc {
+namespace hooks {
+
+/// @brief Names of the arguments a hook point passes to its callouts.
+///
+/// A hook point declares its arguments when it is registered. The position
+/// of an argument name in the schema is the index of the slot holding the
+/// argument in the @c CalloutHandle, so the server sets and gets the
+/// arguments through @c CalloutArgument objects instead of looking them up
+/// by name. The libraries keep accessing them by name.
+class CalloutArgumentSchema {
+public:
+
+    /// @brief Maximum number of arguments of a hook point.
+    static constexpr size_t MAX_ARGUMENTS = 8;
+
+    /// @brief Constructor.
+    ///
+    /// @param names Names of the arguments.
+    ///
+    /// @throw isc::BadValue if there are too many arguments or if a name is
+    ///        used twice.
+    explicit CalloutArgumentSchema(const std::vector<std::string>& names)
+        : names_(names) {
+        if (names_.size() > MAX_ARGUMENTS) {
+            isc_throw(BadValue, "a hook point can't have more than "
+                      << MAX_ARGUMENTS << " arguments");
+        }
+        for (size_t i = 0; i < names_.size(); ++i) {
+            if (find(names_[i]) != static_cast<int>(i)) {
+                isc_throw(BadValue, "argument " << names_[i]
+                          << " is declared twice");
+            }
+        }
+    }
+
+    /// @brief Returns the slot index of an argument.
+    ///
+    /// @param name Name of the argument.
+    ///
+    /// @return Slot index or -1 if the schema has no such argument.
+    int find(const std::string& name) const {
+        for (size_t i = 0; i < names_.size(); ++i) {
+            if (names_[i] == name) {
+                return (static_cast<int>(i));
+            }
+        }
+        return (-1);
+    }
+
+    /// @brief Returns the name of the argument in a slot.
+    ///
+    /// @param slot Slot index.
+    const std::string& getName(size_t slot) const {
+        return (names_.at(slot));
+    }
+
+    /// @brief Returns the names of the arguments.
+    const std::vector<std::string>& getNames() const {
+        return (names_);
+    }
+
+private:
+
+    /// @brief Names of the arguments in slot order.
+    std::vector<std::string> names_;
+};
+
+/// @brief Pointer to a @c CalloutArgumentSchema.
+typedef std::shared_ptr<const CalloutArgumentSchema> CalloutArgumentSchemaPtr;
+
+/// @brief Typed reference to an argument of a hook point.
+///
+/// Obtained from @c ServerHooks::getArgument once when the hook point is
+/// registered and used by the server to set and get the argument in the
+/// @c CalloutHandle with no lookup by name.
+///
+/// @tparam T Type of the argument. The libraries must get the argument with
+///         exactly this type.
+template <typename T>
+struct CalloutArgument {
+
+    /// @brief Default constructor.
+    CalloutArgument() : schema_(), slot_(0) {
+    }
+
+    /// @brief Constructor.
+    ///
+    /// @param schema Schema of the hook point.
+    /// @param slot Index of the argument in the schema.
+    CalloutArgument(const CalloutArgumentSchemaPtr& schema, size_t slot)
+        : schema_(schema), slot_(slot) {
+    }
+
+    /// @brief Returns the name of the argument.
+    const std::string& getName() const {
+        return (schema_->getName(slot_));
+    }
+
+    /// @brief Schema of the hook point.
+    CalloutArgumentSchemaPtr schema_;
+
+    /// @brief Index of the argument in the schema.
+    size_t slot_;
+};
+
+/// @brief Type-erased value of an argument held in place.
+///
+/// Unlike @c boost::any, the value is stored in a fixed buffer inside the
+/// object, so setting an argument doesn't allocate memory. Only the types
+/// which fit in the buffer can be stored: the smart pointers, the integers,
+/// the strings and the vectors the hook points pass.
+class CalloutArgumentValue {
+public:
+
+    /// @brief Size of the buffer holding the value.
+    static constexpr size_t BUFFER_SIZE = 48;
+
+    /// @brief Checks if a type can be stored.
+    template <typename T>
+    static constexpr bool fits() {
+        return (sizeof(T) <= BUFFER_SIZE &&
+                alignof(T) <= alignof(std::max_align_t) &&
+                std::is_copy_constructible<T>::value);
+    }
+
+    /// @brief Constructor.
+    CalloutArgumentValue() : buffer_(), ops_(0) {
+    }
+
+    /// @brief Copy constructor.
+    CalloutArgumentValue(const CalloutArgumentValue& other)
+        : buffer_(), ops_(0) {
+        *this = other;
+    }
+
+    /// @brief Destructor.
+    ~CalloutArgumentValue() {
+        reset();
+    }
+
+    /// @brief Assignment operator.
+    CalloutArgumentValue& operator=(const CalloutArgumentValue& other) {
+        if (this != &other) {
+            reset();
+            if (other.ops_) {
+                other.ops_->copy_(&buffer_, &other.buffer_);
+                ops_ = other.ops_;
+            }
+        }
+        return (*this);
+    }
+
+    /// @brief Stores a value.
+    ///
+    /// @param value Value to store.
+    template <typename T>
+    void set(const T& value) {
+        static_assert(fits<T>(), "the argument type doesn't fit in the slot");
+        reset();
+        new (&buffer_) T(value);
+        ops_ = &Ops<T>::ops_;
+    }
+
+    /// @brief Returns the value.
+    ///
+    /// @return Pointer to the value or null if the value has another type
+    ///         or there is no value.
+    template <typename T>
+    const T* get() const {
+        if (ops_ && (*ops_->type_ == typeid(T))) {
+            return (reinterpret_cast<const T*>(&buffer_));
+        }
+        return (0);
+    }
+
+    /// @brief Checks if there is a value.
+    bool empty() const {
+        return (!ops_);
+    }
+
+    /// @brief Returns a copy of the value in a @c boost::any.
+    boost::any toAny() const {
+        return (ops_ ? ops_->to_any_(&buffer_) : boost::any());
+    }
+
+    /// @brief Destroys the value.
+    void reset() {
+        if (ops_) {
+            ops_->destroy_(&buffer_);
+            ops_ = 0;
+        }
+    }
+
+private:
+
+    /// @brief Operations on the value of a type.
+    struct Operations {
+        /// @brief Type of the value.
+        const std::type_info* type_;
+
+        /// @brief Copies a value into an empty buffer.
+        void (*copy_)(void* buffer, const void* value);
+
+        /// @brief Destroys a value.
+        void (*destroy_)(void* value);
+
+        /// @brief Copies a value into a @c boost::any.
+        boost::any (*to_any_)(const void* value);
+    };
+
+    /// @brief Operations on the values of type T.
+    template <typename T>
+    struct Ops {
+        static void copy(void* buffer, const void* value) {
+            new (buffer) T(*static_cast<const T*>(value));
+        }
+
+        static void destroy(void* value) {
+            static_cast<T*>(value)->~T();
+        }
+
+        static boost::any toAny(const void* value) {
+            return (boost::any(*static_cast<const T*>(value)));
+        }
+
+        static const Operations ops_;
+    };
+
+    /// @brief Buffer holding the value.
+    typename std::aligned_storage<BUFFER_SIZE, alignof(std::max_align_t)>::type buffer_;
+
+    /// @brief Operations on the value or null if there is no value.
+    const Operations* ops_;
+};
+
+template <typename T>
+const CalloutArgumentValue::Operations CalloutArgumentValue::Ops<T>::ops_ = {
+    &typeid(T), &Ops<T>::copy, &Ops<T>::destroy, &Ops<T>::toAny
+};
+
+} // namespace hooks
+} // namespace isc
+
+#endif // CALLOUT_ARGUMENT_H
@@ -11,6 +11,7 @@
 #include <hooks/library_handle.h>
 #include <hooks/server_hooks.h>
 
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <vector>
@@ -23,7 +24,8 @@ namespace hooks {
 // Constructor.
 CalloutHandle::CalloutHandle(const std::shared_ptr<CalloutManager>& manager,
                     const std::shared_ptr<LibraryManagerCollection>& lmcoll)
-    : lm_collection_(lmcoll), arguments_(), context_collection_(),
+    : lm_collection_(lmcoll), arguments_(), schema_(), slots_(),
+      context_collection_(),
       manager_(manager), server_hooks_(ServerHooks::getServerHooks()),
       current_library_(-1), current_hook_(-1), next_step_(NEXT_STEP_CONTINUE) {
 
@@ -42,7 +44,7 @@ CalloutHandle::~CalloutHandle() {
 
     // Explicitly clear the argument and context objects.  This should free up
     // all memory that could have been allocated by libraries that were loaded.
-    arguments_.clear();
+    deleteAllArguments();
     context_collection_.clear();
 
     // Normal destruction of the remaining variables will include the
@@ -69,9 +71,35 @@ CalloutHandle::getArgumentNames() const {
         names.push_back(i->first);
     }
 
+    // Add the arguments in the slots, keeping the names sorted.
+    if (schema_) {
+        for (size_t slot = 0; slot < schema_->getNames().size(); ++slot) {
+            if (!slots_[slot].empty()) {
+                names.push_back(schema_->getName(slot));
+            }
+        }
+        sort(names.begin(), names.end());
+    }
+
     return (names);
 }
 
+// Move the arguments in the slots to the argument collection and use the
+// slots for the arguments of another hook point.
+
+void
+CalloutHandle::useSchema(const CalloutArgumentSchemaPtr& schema) {
+    if (schema_) {
+        for (size_t slot = 0; slot < schema_->getNames().size(); ++slot) {
+            if (!slots_[slot].empty()) {
+                arguments_[schema_->getName(slot)] = slots_[slot].toAny();
+                slots_[slot].reset();
+            }
+        }
+    }
+    schema_ = schema;
+}
+
 ParkingLotHandlePtr
 CalloutHandle::getParkingLotHandlePtr() const {
     return (std::make_shared<ParkingLotHandle>(server_hooks_.getParkingLotPtr(current_hook_)));
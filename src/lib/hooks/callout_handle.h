@@ -8,11 +8,13 @@
 #define CALLOUT_HANDLE_H
 
 #include <exceptions/exceptions.h>
+#include <hooks/callout_argument.h>
 #include <hooks/library_handle.h>
 #include <hooks/parking_lots.h>
 
 #include <boost/any.hpp>
 
+#include <array>
 #include <map>
 #include <string>
 #include <vector>
@@ -139,13 +141,46 @@ public:
     /// Sets the value of an argument.  The argument is created if it does not
     /// already exist.
     ///
+    /// If the argument is declared by the hook point whose arguments are
+    /// set, the value is stored in the slot of the argument.
+    ///
     /// @param name Name of the argument.
     /// @param value Value to set.  That can be of any data type.
     template <typename T>
     void setArgument(const std::string& name, T value) {
+        int slot = findSlot(name);
+        if (slot >= 0) {
+            if constexpr (CalloutArgumentValue::fits<T>()) {
+                slots_[slot].set(value);
+                if (!arguments_.empty()) {
+                    static_cast<void>(arguments_.erase(name));
+                }
+                return;
+            }
+            slots_[slot].reset();
+        }
         arguments_[name] = value;
     }
 
+    /// @brief Set argument in its slot
+    ///
+    /// Sets the value of an argument declared by a hook point without looking
+    /// it up by name.  The arguments of another hook point which are still
+    /// set are kept, but are looked up by name from then on.
+    ///
+    /// @param argument Typed reference to the argument.
+    /// @param value Value to set.
+    template <typename T>
+    void setArgument(const CalloutArgument<T>& argument, const T& value) {
+        if (schema_ != argument.schema_) {
+            useSchema(argument.schema_);
+        }
+        slots_[argument.slot_].set(value);
+        if (!arguments_.empty()) {
+            static_cast<void>(arguments_.erase(argument.getName()));
+        }
+    }
+
     /// @brief Get argument
     ///
     /// Gets the value of an argument.
@@ -160,6 +195,16 @@ public:
     ///        the variable provided to receive the value.
     template <typename T>
     void getArgument(const std::string& name, T& value) const {
+        int slot = findSlot(name);
+        if ((slot >= 0) && !slots_[slot].empty()) {
+            const T* slot_value = slots_[slot].template get<T>();
+            if (!slot_value) {
+                throw boost::bad_any_cast();
+            }
+            value = *slot_value;
+            return;
+        }
+
         ElementCollection::const_iterator element_ptr = arguments_.find(name);
         if (element_ptr == arguments_.end()) {
             isc_throw(NoSuchArgument, "unable to find argument with name " <<
@@ -169,6 +214,30 @@ public:
         value = boost::any_cast<T>(element_ptr->second);
     }
 
+    /// @brief Get argument from its slot
+    ///
+    /// Gets the value of an argument declared by a hook point without looking
+    /// it up by name, unless a callout stored it in a way which doesn't fit
+    /// the slot.
+    ///
+    /// @param argument Typed reference to the argument.
+    /// @param value [out] Value to set.
+    ///
+    /// @throw NoSuchArgument The argument is not present.
+    /// @throw boost::bad_any_cast A callout replaced the argument with a value
+    ///        of another type.
+    template <typename T>
+    void getArgument(const CalloutArgument<T>& argument, T& value) const {
+        if (schema_ == argument.schema_) {
+            const T* slot_value = slots_[argument.slot_].template get<T>();
+            if (slot_value) {
+                value = *slot_value;
+                return;
+            }
+        }
+        getArgument(argument.getName(), value);
+    }
+
     /// @brief Get argument names
     ///
     /// Returns a vector holding the names of arguments in the argument
@@ -187,6 +256,10 @@ public:
     ///
     /// @param name Name of the element in the argument list to set.
     void deleteArgument(const std::string& name) {
+        int slot = findSlot(name);
+        if (slot >= 0) {
+            slots_[slot].reset();
+        }
         static_cast<void>(arguments_.erase(name));
     }
 
@@ -197,6 +270,12 @@ public:
     /// N.B. If any elements are raw pointers, the pointed-to data is NOT
     /// deleted by this method.
     void deleteAllArguments() {
+        if (schema_) {
+            for (auto& slot : slots_) {
+                slot.reset();
+            }
+            schema_.reset();
+        }
         arguments_.clear();
     }
 
@@ -367,6 +446,23 @@ private:
     ///        handle collection.
     int getLibraryIndex() const;
 
+    /// @brief Find the slot of an argument
+    ///
+    /// @param name Name of the argument.
+    ///
+    /// @return Slot index or -1 if the argument has no slot.
+    int findSlot(const std::string& name) const {
+        return (schema_ ? schema_->find(name) : -1);
+    }
+
+    /// @brief Switch to the arguments of another hook point
+    ///
+    /// The arguments in the slots are moved to the argument collection, so
+    /// they can still be accessed by name.
+    ///
+    /// @param schema Arguments of the hook point.
+    void useSchema(const CalloutArgumentSchemaPtr& schema);
+
     /// @brief Return reference to context for current library
     ///
     /// Called by all context-setting functions, this returns a reference to
@@ -399,9 +495,15 @@ private:
     /// created.
     std::shared_ptr<LibraryManagerCollection> lm_collection_;
 
-    /// Collection of arguments passed to the callouts
+    /// Collection of arguments passed to the callouts which have no slot
     ElementCollection arguments_;
 
+    /// Arguments of the hook point whose arguments are in the slots
+    CalloutArgumentSchemaPtr schema_;
+
+    /// Arguments declared by the hook point, in the order of the schema
+    std::array<CalloutArgumentValue, CalloutArgumentSchema::MAX_ARGUMENTS> slots_;
+
     /// Context collection - there is one entry per library context.
     ContextCollection context_collection_;
 
@@ -10,17 +10,32 @@
 #include <hooks/callout_manager.h>
 #include <hooks/hooks_log.h>
 #include <hooks/pointer_converter.h>
-#include <util/stopwatch.h>
+#include <util/stopwatch_impl.h>
 
 #include <boost/static_assert.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <climits>
 #include <functional>
 #include <utility>
 
 using namespace std;
 
+namespace {
+
+/// @brief Formats the callout execution time for logging.
+///
+/// @param duration Measured duration.
+/// @return Duration in milliseconds as formatted by the stopwatch.
+std::string
+logFormat(const std::chrono::steady_clock::duration& duration) {
+    return (isc::util::StopwatchImpl::logFormat(boost::posix_time::microseconds(
+        std::chrono::duration_cast<std::chrono::microseconds>(duration).count())));
+}
+
+} // end of anonymous namespace
+
 namespace isc {
 namespace hooks {
 
@@ -145,9 +160,11 @@ CalloutManager::callCallouts(int hook_index, CalloutHandle& callout_handle) {
         // determine to what hook it is attached.
         callout_handle.setCurrentHook(hook_index);
 
-        // This object will be used to measure execution time of each callout
-        // and the total time spent in callouts for this hook point.
-        util::Stopwatch stopwatch;
+        // Measure the execution time of each callout and the total time
+        // spent in callouts for this hook point. The monotonic clock is
+        // read directly rather than through a util::Stopwatch, which would
+        // allocate its implementation on every call.
+        std::chrono::steady_clock::duration total(0);
 
         // Mark that the callouts begin for the hook.
         LOG_DEBUG(callouts_logger, HOOKS_DBG_CALLS, HOOKS_CALLOUTS_BEGIN)
@@ -163,35 +180,40 @@ CalloutManager::callCallouts(int hook_index, CalloutHandle& callout_handle) {
             callout_handle.setCurrentLibrary(i->first);
 
             // Call the callout
+            std::chrono::steady_clock::time_point start =
+                std::chrono::steady_clock::now();
             try {
-                stopwatch.start();
                 int status = (*i->second)(callout_handle);
-                stopwatch.stop();
+                std::chrono::steady_clock::duration last =
+                    std::chrono::steady_clock::now() - start;
+                total += last;
                 if (status == 0) {
                     LOG_DEBUG(callouts_logger, HOOKS_DBG_EXTENDED_CALLS,
                               HOOKS_CALLOUT_CALLED)
                         .arg(callout_handle.getCurrentLibrary())
                         .arg(server_hooks_.getName(callout_handle.getCurrentHook()))
                         .arg(PointerConverter(i->second).dlsymPtr())
-                        .arg(stopwatch.logFormatLastDuration());
+                        .arg(logFormat(last));
                 } else {
                     LOG_ERROR(callouts_logger, HOOKS_CALLOUT_ERROR)
                         .arg(callout_handle.getCurrentLibrary())
                         .arg(server_hooks_.getName(callout_handle.getCurrentHook()))
                         .arg(PointerConverter(i->second).dlsymPtr())
-                        .arg(stopwatch.logFormatLastDuration());
+                        .arg(logFormat(last));
                 }
             } catch (const std::exception& e) {
-                // If an exception occurred, the stopwatch.stop() hasn't been
-                // called, so we have to call it here.
-                stopwatch.stop();
+                // If an exception occurred, the duration hasn't been
+                // measured, so we have to measure it here.
+                std::chrono::steady_clock::duration last =
+                    std::chrono::steady_clock::now() - start;
+                total += last;
                 // Any exception, not just ones based on isc::Exception
                 LOG_ERROR(callouts_logger, HOOKS_CALLOUT_EXCEPTION)
                     .arg(callout_handle.getCurrentLibrary())
                     .arg(server_hooks_.getName(callout_handle.getCurrentHook()))
                     .arg(PointerConverter(i->second).dlsymPtr())
                     .arg(e.what())
-                    .arg(stopwatch.logFormatLastDuration());
+                    .arg(logFormat(last));
             }
 
         }
@@ -200,7 +222,7 @@ CalloutManager::callCallouts(int hook_index, CalloutHandle& callout_handle) {
         // time for callouts.
         LOG_DEBUG(callouts_logger, HOOKS_DBG_CALLS, HOOKS_CALLOUTS_COMPLETE)
             .arg(server_hooks_.getName(callout_handle.getCurrentHook()))
-            .arg(stopwatch.logFormatTotalDuration());
+            .arg(logFormat(total));
 
         // Reset the current hook and library indexes to an invalid value to
         // catch any programming errors.
@@ -12,8 +12,9 @@
 
 namespace {
 
-// Version 21 of the hooks framework, set for Kea 1.8.0
-const int KEA_HOOKS_VERSION = 21;
+// Version 22 of the hooks framework, set when the callout handle gained
+// the typed argument slots
+const int KEA_HOOKS_VERSION = 22;
 
 // Names of the framework functions.
 const char* const LOAD_FUNCTION_NAME = "load";
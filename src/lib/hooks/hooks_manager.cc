@@ -228,6 +228,12 @@ HooksManager::registerHook(const std::string& name) {
     return (ServerHooks::getServerHooks().registerHook(name));
 }
 
+int
+HooksManager::registerHook(const std::string& name,
+                           const std::vector<std::string>& arguments) {
+    return (ServerHooks::getServerHooks().registerHook(name, arguments));
+}
+
 // Return pre- and post- library handles.
 
 isc::hooks::LibraryHandle&
@@ -221,6 +221,33 @@ public:
     ///         registered.
     static int registerHook(const std::string& name);
 
+    /// @brief Register Hook with its arguments
+    ///
+    /// This is just a convenience shell around the ServerHooks::registerHook()
+    /// method.
+    ///
+    /// @param name Name of the hook
+    /// @param arguments Names of the arguments of the hook
+    ///
+    /// @return Index of the hook, to be used in subsequent calls.
+    static int registerHook(const std::string& name,
+                            const std::vector<std::string>& arguments);
+
+    /// @brief Get typed reference to an argument of a hook
+    ///
+    /// This is just a convenience shell around the ServerHooks::getArgument()
+    /// method.
+    ///
+    /// @tparam T Type of the argument
+    /// @param index Index of the hook
+    /// @param name Name of the argument
+    ///
+    /// @return Reference used to set and get the argument in a callout handle.
+    template <typename T>
+    static CalloutArgument<T> getArgument(int index, const std::string& name) {
+        return (ServerHooks::getServerHooks().getArgument<T>(index, name));
+    }
+
     /// @brief Return list of loaded libraries
     ///
     /// Returns the names of the loaded libraries.
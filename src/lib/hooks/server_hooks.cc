@@ -81,6 +81,27 @@ ServerHooks::registerHook(const string& name) {
     return (index);
 }
 
+// Register a hook along with its arguments. A hook which is registered again
+// keeps the arguments it was registered with first.
+
+int
+ServerHooks::registerHook(const string& name,
+                          const vector<string>& arguments) {
+    CalloutArgumentSchemaPtr schema(new CalloutArgumentSchema(arguments));
+    int index = registerHook(name);
+    argument_schemas_.insert(make_pair(index, schema));
+    return (index);
+}
+
+CalloutArgumentSchemaPtr
+ServerHooks::getArgumentSchema(int index) const {
+    auto schema = argument_schemas_.find(index);
+    if (schema == argument_schemas_.end()) {
+        return (CalloutArgumentSchemaPtr());
+    }
+    return (schema->second);
+}
+
 // Set ServerHooks object to initial state.
 
 void
@@ -89,6 +110,7 @@ ServerHooks::initialize() {
     // Clear out the name->index and index->name maps.
     hooks_.clear();
     inverse_hooks_.clear();
+    argument_schemas_.clear();
     parking_lots_.reset(new ParkingLots());
 
     // Register the pre-defined hooks.
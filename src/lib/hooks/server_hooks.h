@@ -8,6 +8,7 @@
 #define SERVER_HOOKS_H
 
 #include <exceptions/exceptions.h>
+#include <hooks/callout_argument.h>
 #include <hooks/parking_lots.h>
 
 #include <boost/noncopyable.hpp>
@@ -90,6 +91,54 @@ public:
     ///         registered.
     int registerHook(const std::string& name);
 
+    /// @brief Register a hook with its arguments
+    ///
+    /// Registers a hook along with the names of the arguments it passes to
+    /// the callouts. The typed references to the arguments are returned by
+    /// @ref getArgument.
+    ///
+    /// @param name Name of the hook
+    /// @param arguments Names of the arguments of the hook
+    ///
+    /// @return Index of the hook, to be used in subsequent hook-related calls.
+    ///
+    /// @throw isc::BadValue if the arguments are not valid.
+    int registerHook(const std::string& name,
+                     const std::vector<std::string>& arguments);
+
+    /// @brief Get the arguments of a hook
+    ///
+    /// @param index Index of the hook
+    ///
+    /// @return Schema of the arguments of the hook or null if the hook was
+    ///         registered without declaring its arguments.
+    CalloutArgumentSchemaPtr getArgumentSchema(int index) const;
+
+    /// @brief Get typed reference to an argument of a hook
+    ///
+    /// @tparam T Type of the argument
+    /// @param index Index of the hook
+    /// @param name Name of the argument
+    ///
+    /// @return Reference used to set and get the argument in a callout handle.
+    ///
+    /// @throw NoSuchHook if the hook declared no arguments.
+    /// @throw isc::BadValue if the hook has no such argument.
+    template <typename T>
+    CalloutArgument<T> getArgument(int index, const std::string& name) const {
+        CalloutArgumentSchemaPtr schema = getArgumentSchema(index);
+        if (!schema) {
+            isc_throw(NoSuchHook, "hook with index " << index
+                      << " declared no arguments");
+        }
+        int slot = schema->find(name);
+        if (slot < 0) {
+            isc_throw(BadValue, "hook with index " << index
+                      << " has no argument " << name);
+        }
+        return (CalloutArgument<T>(schema, slot));
+    }
+
     /// @brief Get hook name
     ///
     /// Returns the name of a hook given the index.  This is most likely to be
@@ -236,6 +285,9 @@ private:
     HookCollection  hooks_;                 ///< Hook name/index collection
     InverseHookCollection inverse_hooks_;   ///< Hook index/name collection
 
+    /// Arguments of the hooks which declared them.
+    std::map<int, CalloutArgumentSchemaPtr> argument_schemas_;
+
     ParkingLotsPtr parking_lots_;
 };
 
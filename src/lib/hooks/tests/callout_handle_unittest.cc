@@ -375,6 +375,61 @@ TEST_F(CalloutHandleTest, scopedState) {
     EXPECT_EQ(three, value);
 }
 
+// Test that the arguments declared by a hook point are stored in the slots
+// and are accessible by name as well.
+
+TEST_F(CalloutHandleTest, ArgumentSlots) {
+    CalloutArgumentSchemaPtr schema(new CalloutArgumentSchema({ "query", "id" }));
+    CalloutArgument<std::string> query(schema, 0);
+    CalloutArgument<int> id(schema, 1);
+
+    CalloutHandle handle(getCalloutManager());
+    handle.setArgument(query, std::string("discover"));
+    handle.setArgument(id, 42);
+    handle.setArgument("other", 7);
+
+    // The arguments are accessible by name.
+    std::string text;
+    int value = 0;
+    EXPECT_NO_THROW(handle.getArgument("query", text));
+    EXPECT_EQ("discover", text);
+    EXPECT_NO_THROW(handle.getArgument("id", value));
+    EXPECT_EQ(42, value);
+    EXPECT_THROW(handle.getArgument("id", text), boost::bad_any_cast);
+
+    vector<string> expected = { "id", "other", "query" };
+    EXPECT_TRUE(expected == handle.getArgumentNames());
+
+    // A callout modifying an argument by name updates the slot.
+    handle.setArgument("id", 43);
+    EXPECT_NO_THROW(handle.getArgument(id, value));
+    EXPECT_EQ(43, value);
+
+    // A callout may replace an argument with a value of another type.
+    handle.setArgument("query", 5);
+    EXPECT_THROW(handle.getArgument(query, text), boost::bad_any_cast);
+    EXPECT_NO_THROW(handle.getArgument("query", value));
+    EXPECT_EQ(5, value);
+
+    // Arguments of another hook point move the previous ones to the
+    // collection, so they can still be accessed by name.
+    CalloutArgumentSchemaPtr other(new CalloutArgumentSchema({ "id" }));
+    CalloutArgument<int> other_id(other, 0);
+    handle.setArgument(other_id, 100);
+    EXPECT_NO_THROW(handle.getArgument(other_id, value));
+    EXPECT_EQ(100, value);
+    EXPECT_NO_THROW(handle.getArgument("query", value));
+    EXPECT_EQ(5, value);
+
+    // The arguments in the slots are deleted as well.
+    handle.deleteArgument("id");
+    EXPECT_THROW(handle.getArgument(other_id, value), NoSuchArgument);
+    handle.setArgument(other_id, 100);
+    handle.deleteAllArguments();
+    EXPECT_THROW(handle.getArgument(other_id, value), NoSuchArgument);
+    EXPECT_TRUE(handle.getArgumentNames().empty());
+}
+
 // Further tests of the "skip" flag and tests of getting the name of the
 // hook to which the current callout is attached is in the "handles_unittest"
 // module.
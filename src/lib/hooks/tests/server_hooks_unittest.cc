@@ -229,4 +229,47 @@ TEST(ServerHooksTest, getParkingLots) {
     ASSERT_TRUE(hooks.getParkingLotPtr("alpha"));
 }
 
+// Check that the hooks declare their arguments and the typed references
+// to the arguments are returned.
+
+TEST(ServerHooksTest, ArgumentSchema) {
+    ServerHooks& hooks = ServerHooks::getServerHooks();
+    hooks.reset();
+
+    int alpha = hooks.registerHook("alpha", { "query", "subnet" });
+    int beta = hooks.registerHook("beta");
+
+    CalloutArgumentSchemaPtr schema = hooks.getArgumentSchema(alpha);
+    ASSERT_TRUE(schema);
+    EXPECT_EQ(0, schema->find("query"));
+    EXPECT_EQ(1, schema->find("subnet"));
+    EXPECT_EQ(-1, schema->find("lease"));
+    EXPECT_FALSE(hooks.getArgumentSchema(beta));
+
+    CalloutArgument<int> subnet;
+    ASSERT_NO_THROW(subnet = hooks.getArgument<int>(alpha, "subnet"));
+    EXPECT_EQ(1, subnet.slot_);
+    EXPECT_EQ("subnet", subnet.getName());
+    EXPECT_THROW(hooks.getArgument<int>(alpha, "lease"), isc::BadValue);
+    EXPECT_THROW(hooks.getArgument<int>(beta, "query"), NoSuchHook);
+
+    // Registering the hook again keeps the arguments.
+    EXPECT_EQ(alpha, hooks.registerHook("alpha", { "lease" }));
+    EXPECT_EQ(schema, hooks.getArgumentSchema(alpha));
+
+    // Duplicate names and too many arguments are rejected.
+    EXPECT_THROW(hooks.registerHook("gamma", { "query", "query" }),
+                 isc::BadValue);
+    EXPECT_THROW(hooks.registerHook("delta",
+                                    std::vector<std::string>(
+                                        CalloutArgumentSchema::MAX_ARGUMENTS + 1,
+                                        "x")),
+                 isc::BadValue);
+
+    // The reset clears the arguments.
+    hooks.reset();
+    alpha = hooks.registerHook("alpha");
+    EXPECT_FALSE(hooks.getArgumentSchema(alpha));
+}
+
 } // Anonymous namespace
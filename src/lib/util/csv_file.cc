@@ -111,8 +111,25 @@ CSVRow::checkIndex(const size_t at) const {
     }
 }
 
+namespace {
+
+/// @brief The last row appended by the thread with group commit enabled.
+///
+/// The writer pointer keeps the writer alive until the thread waits for
+/// the row, even if the file is closed in the meantime.
+struct PendingAppend {
+    GroupCommitWriterPtr writer_;
+    uint64_t seq_;
+};
+
+thread_local PendingAppend pending_append;
+
+}
+
 CSVFile::CSVFile(const std::string& filename)
-    : filename_(filename), fs_(), cols_(0), read_msg_() {
+    : filename_(filename), fs_(), cols_(0), read_msg_(), group_commit_(false),
+      sync_policy_(GroupCommitWriter::SYNC_NONE),
+      sync_interval_(std::chrono::milliseconds(1000)), writer_() {
 }
 
 CSVFile::~CSVFile() {
@@ -121,6 +138,9 @@ CSVFile::~CSVFile() {
 
 void
 CSVFile::close() {
+    // Write pending rows before the file goes away.
+    stopWriter();
+
     // It is allowed to close multiple times. If file has been already closed,
     // this is no-op.
     if (fs_) {
@@ -141,6 +161,70 @@ void
 CSVFile::flush() const {
     checkStreamStatusAndReset("flush");
     fs_->flush();
+    if (writer_) {
+        try {
+            writer_->flush();
+        } catch (const std::exception& ex) {
+            isc_throw(CSVFileError, "failed to flush the file '"
+                      << filename_ << "': " << ex.what());
+        }
+    }
+}
+
+void
+CSVFile::setGroupCommit(const bool enable,
+                        const GroupCommitWriter::SyncPolicy policy,
+                        const std::chrono::milliseconds& sync_interval) {
+    stopWriter();
+    group_commit_ = enable;
+    sync_policy_ = policy;
+    sync_interval_ = sync_interval;
+    if (fs_) {
+        startWriter();
+    }
+}
+
+void
+CSVFile::waitForAppends() {
+    if (!pending_append.writer_) {
+        return;
+    }
+    GroupCommitWriterPtr writer;
+    writer.swap(pending_append.writer_);
+    try {
+        writer->wait(pending_append.seq_);
+    } catch (const std::exception& ex) {
+        isc_throw(CSVFileError, "failed to write CSV rows to the file '"
+                  << writer->getFilename() << "': " << ex.what());
+    }
+}
+
+void
+CSVFile::startWriter() {
+    if (!group_commit_ || writer_) {
+        return;
+    }
+    // Anything buffered by the stream must reach the file before the
+    // writer appends to it.
+    fs_->flush();
+    try {
+        GroupCommitWriterPtr writer(new GroupCommitWriter(filename_,
+                                                          sync_policy_,
+                                                          sync_interval_));
+        writer->start();
+        writer_ = writer;
+    } catch (const std::exception& ex) {
+        isc_throw(CSVFileError, "unable to start group commit for the file '"
+                  << filename_ << "': " << ex.what());
+    }
+}
+
+void
+CSVFile::stopWriter() {
+    if (writer_) {
+        writer_->stop();
+        writer_.reset();
+    }
 }
 
 void
@@ -173,6 +257,19 @@ CSVFile::append(const CSVRow& row) const {
                   " columns in the CSV file '" << getColumnCount() << "'");
     }
 
+    if (writer_) {
+        std::string text = row.render();
+        text.push_back('\n');
+        try {
+            pending_append.seq_ = writer_->enqueue(std::move(text));
+            pending_append.writer_ = writer_;
+        } catch (const std::exception& ex) {
+            isc_throw(CSVFileError, "failed to queue CSV row for the file '"
+                      << filename_ << "': " << ex.what());
+        }
+        return;
+    }
+
     /// @todo Apparently, seekp and seekg are interchangeable. A call to seekp
     /// results in moving the input pointer too. This is ok for now. It means
     /// that when the append() is called, the read pointer is moved to the EOF.
@@ -353,6 +450,8 @@ CSVFile::open(const bool seek_to_end) {
                 fs_->clear();
             }
 
+            startWriter();
+
         } catch (const std::exception&) {
             close();
             throw;
@@ -384,6 +483,8 @@ CSVFile::recreate() {
         }
         *fs_ << header << std::endl;
 
+        startWriter();
+
     } catch (const std::exception& ex) {
         close();
         isc_throw(CSVFileError, ex.what());
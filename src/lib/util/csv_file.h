@@ -8,7 +8,9 @@
 #define CSV_FILE_H
 
 #include <exceptions/exceptions.h>
+#include <util/group_commit_writer.h>
 
+#include <chrono>
 #include <fstream>
 #include <memory>
 #include <ostream>
@@ -358,6 +360,12 @@ std::ostream& operator<<(std::ostream& os, const CSVRow& row);
 /// immediately written into it. The header consists of the column names
 /// specified with the @c addColumn function. The subsequent rows are written
 /// into this file by calling @c append.
+///
+/// By default, each appended row is written and flushed synchronously. When
+/// group commit is enabled with @c setGroupCommit, the rows are handed over to
+/// a @c GroupCommitWriter which writes them in batches from its own thread.
+/// The caller which needs to know that its rows reached the file calls
+/// @c waitForAppends.
 class CSVFile {
 public:
 
@@ -384,11 +392,51 @@ public:
     ///
     /// @param row Object representing a CSV file row.
     ///
+    /// When group commit is enabled, the row is only queued for writing and
+    /// the function returns immediately. The calling thread may then wait for
+    /// the row to be written with @c waitForAppends.
+    ///
     /// @throw CSVFileError When error occurred during IO operation or if the
     /// size of the row doesn't match the number of columns.
     void append(const CSVRow& row) const;
 
+    /// @brief Enables or disables group commit of the appended rows.
+    ///
+    /// If the file is open, the writer is started (or stopped) immediately.
+    /// Otherwise, it is started when the file is opened. The setting is
+    /// retained when the file is closed and opened again.
+    ///
+    /// @param enable Boolean flag enabling or disabling group commit.
+    /// @param policy Synchronization policy used by the writer.
+    /// @param sync_interval Interval between syncs for the
+    /// @c GroupCommitWriter::SYNC_INTERVAL policy.
+    ///
+    /// @throw CSVFileError if the writer can't be started.
+    void setGroupCommit(const bool enable,
+                        const GroupCommitWriter::SyncPolicy policy =
+                            GroupCommitWriter::SYNC_NONE,
+                        const std::chrono::milliseconds& sync_interval =
+                            std::chrono::milliseconds(1000));
+
+    /// @brief Checks if group commit is enabled.
+    bool getGroupCommit() const {
+        return (group_commit_);
+    }
+
+    /// @brief Waits until the rows appended by the calling thread with
+    /// group commit enabled have been written (and synced, depending on
+    /// the synchronization policy).
+    ///
+    /// It is a no-op when the calling thread has nothing pending. It is
+    /// intended to be called after releasing locks held while appending,
+    /// so as concurrent appends are committed together.
+    ///
+    /// @throw CSVFileError if writing failed.
+    static void waitForAppends();
+
     /// @brief Closes the CSV file.
+    ///
+    /// Pending rows are written before the file is closed.
     void close();
 
     /// @brief Checks if the CSV file exists and can be opened for reading.
@@ -400,6 +448,8 @@ public:
     bool exists() const;
 
     /// @brief Flushes a file.
+    ///
+    /// When group commit is enabled, waits for all queued rows.
     void flush() const;
 
     /// @brief Returns the number of columns in the file.
@@ -559,6 +609,14 @@ private:
     /// @brief Returns size of the CSV file.
     std::streampos size() const;
 
+    /// @brief Starts the group commit writer if group commit is enabled.
+    ///
+    /// @throw CSVFileError if the writer can't be started.
+    void startWriter();
+
+    /// @brief Stops the group commit writer, if running.
+    void stopWriter();
+
     /// @brief CSV file name.
     std::string filename_;
 
@@ -570,6 +628,19 @@ private:
 
     /// @brief Holds last error during row reading or validation.
     std::string read_msg_;
+
+    /// @brief Indicates if group commit is enabled.
+    bool group_commit_;
+
+    /// @brief Synchronization policy of the group commit writer.
+    GroupCommitWriter::SyncPolicy sync_policy_;
+
+    /// @brief Sync interval of the group commit writer.
+    std::chrono::milliseconds sync_interval_;
+
+    /// @brief Group commit writer, null when group commit is disabled
+    /// or the file is closed.
+    GroupCommitWriterPtr writer_;
 };
 
 } // namespace isc::util
@@ -0,0 +1,334 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <util/group_commit_writer.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+using namespace std;
+
+namespace isc {
+namespace util {
+
+GroupCommitWriter::SyncPolicy
+GroupCommitWriter::syncPolicyFromText(const string& policy) {
+    if (policy == "none") {
+        return (SYNC_NONE);
+    } else if (policy == "batch") {
+        return (SYNC_BATCH);
+    } else if (policy == "interval") {
+        return (SYNC_INTERVAL);
+    }
+    isc_throw(BadValue, "unknown sync policy '" << policy
+              << "', expected one of: none, batch, interval");
+}
+
+string
+GroupCommitWriter::syncPolicyToText(const SyncPolicy policy) {
+    switch (policy) {
+    case SYNC_BATCH:
+        return ("batch");
+    case SYNC_INTERVAL:
+        return ("interval");
+    default:
+        return ("none");
+    }
+}
+
+GroupCommitWriter::GroupCommitWriter(const string& filename,
+                                     const SyncPolicy policy,
+                                     const chrono::milliseconds& sync_interval,
+                                     const size_t max_batch_size)
+    : filename_(filename), policy_(policy), sync_interval_(sync_interval),
+      max_batch_size_(max_batch_size ? max_batch_size : 1), fd_(-1),
+      thread_(), queued_bytes_(0), enqueued_seq_(0), written_seq_(0),
+      synced_seq_(0), batches_(0), stopping_(false), running_(false),
+      error_() {
+}
+
+GroupCommitWriter::~GroupCommitWriter() {
+    try {
+        stop();
+    } catch (...) {
+        // Destructors must not throw.
+    }
+}
+
+void
+GroupCommitWriter::start() {
+    lock_guard<mutex> lk(mutex_);
+    if (running_) {
+        isc_throw(InvalidOperation, "group commit writer for '" << filename_
+                  << "' already started");
+    }
+    fd_ = ::open(filename_.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC,
+                 S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if (fd_ < 0) {
+        isc_throw(GroupCommitError, "unable to open '" << filename_
+                  << "' for appending: " << strerror(errno));
+    }
+    queue_.clear();
+    queued_bytes_ = 0;
+    enqueued_seq_ = 0;
+    written_seq_ = 0;
+    synced_seq_ = 0;
+    stopping_ = false;
+    error_.clear();
+    running_ = true;
+    thread_.reset(new thread(&GroupCommitWriter::run, this));
+}
+
+void
+GroupCommitWriter::stop() {
+    {
+        lock_guard<mutex> lk(mutex_);
+        if (!thread_) {
+            return;
+        }
+        stopping_ = true;
+    }
+    work_cv_.notify_all();
+    thread_->join();
+    thread_.reset();
+
+    lock_guard<mutex> lk(mutex_);
+    running_ = false;
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+    // Wake up waiters which may be waiting for records dropped because
+    // of an error.
+    done_cv_.notify_all();
+}
+
+bool
+GroupCommitWriter::isRunning() const {
+    lock_guard<mutex> lk(mutex_);
+    return (running_ && !stopping_);
+}
+
+uint64_t
+GroupCommitWriter::enqueue(string&& record) {
+    uint64_t seq;
+    {
+        lock_guard<mutex> lk(mutex_);
+        checkErrorInternal();
+        if (!running_ || stopping_) {
+            isc_throw(GroupCommitError, "group commit writer for '"
+                      << filename_ << "' is not running");
+        }
+        queued_bytes_ += record.size();
+        queue_.push_back(move(record));
+        seq = ++enqueued_seq_;
+    }
+    work_cv_.notify_one();
+    return (seq);
+}
+
+void
+GroupCommitWriter::wait(const uint64_t seq) {
+    unique_lock<mutex> lk(mutex_);
+    done_cv_.wait(lk, [this, seq]() {
+        return ((completedSeqInternal() >= seq) || !error_.empty() ||
+                !running_);
+    });
+    if (completedSeqInternal() < seq) {
+        checkErrorInternal();
+        isc_throw(GroupCommitError, "group commit writer for '" << filename_
+                  << "' stopped before record " << seq << " was completed");
+    }
+}
+
+void
+GroupCommitWriter::flush() {
+    uint64_t seq;
+    {
+        lock_guard<mutex> lk(mutex_);
+        seq = enqueued_seq_;
+    }
+    wait(seq);
+}
+
+uint64_t
+GroupCommitWriter::getBatchCount() const {
+    lock_guard<mutex> lk(mutex_);
+    return (batches_);
+}
+
+uint64_t
+GroupCommitWriter::getWrittenCount() const {
+    lock_guard<mutex> lk(mutex_);
+    return (written_seq_);
+}
+
+uint64_t
+GroupCommitWriter::completedSeqInternal() const {
+    return (policy_ == SYNC_NONE ? written_seq_ : synced_seq_);
+}
+
+void
+GroupCommitWriter::checkErrorInternal() const {
+    if (!error_.empty()) {
+        isc_throw(GroupCommitError, error_);
+    }
+}
+
+void
+GroupCommitWriter::run() {
+    auto last_sync = chrono::steady_clock::now();
+    vector<string> batch;
+
+    unique_lock<mutex> lk(mutex_);
+    for (;;) {
+        // Wait for records, for the stop request or, when there are
+        // records written but not yet synced, for the sync deadline.
+        if (queue_.empty() && !stopping_) {
+            if ((policy_ == SYNC_INTERVAL) && (synced_seq_ < written_seq_)) {
+                work_cv_.wait_until(lk, last_sync + sync_interval_);
+            } else {
+                work_cv_.wait(lk);
+            }
+        }
+
+        // Take the records to be written in this pass.
+        batch.clear();
+        if (queued_bytes_ <= max_batch_size_) {
+            batch.swap(queue_);
+            queued_bytes_ = 0;
+        } else {
+            size_t bytes = 0;
+            size_t count = 0;
+            while ((count < queue_.size()) && (bytes < max_batch_size_)) {
+                bytes += queue_[count].size();
+                ++count;
+            }
+            batch.assign(make_move_iterator(queue_.begin()),
+                         make_move_iterator(queue_.begin() + count));
+            queue_.erase(queue_.begin(), queue_.begin() + count);
+            queued_bytes_ -= bytes;
+        }
+        const uint64_t batch_end = written_seq_ + batch.size();
+        const bool stopping = stopping_ && queue_.empty();
+        const uint64_t unsynced = batch_end;
+
+        lk.unlock();
+        string error;
+        bool synced = false;
+        try {
+            if (!batch.empty()) {
+                writeBatch(batch);
+            }
+            auto now = chrono::steady_clock::now();
+            if ((policy_ == SYNC_BATCH && !batch.empty()) ||
+                (policy_ != SYNC_NONE && stopping) ||
+                (policy_ == SYNC_INTERVAL &&
+                 (now - last_sync >= sync_interval_))) {
+                sync();
+                last_sync = now;
+                synced = true;
+            }
+        } catch (const exception& ex) {
+            error = ex.what();
+        }
+        lk.lock();
+
+        if (!error.empty()) {
+            error_ = error;
+            queue_.clear();
+            queued_bytes_ = 0;
+            done_cv_.notify_all();
+            return;
+        }
+        if (!batch.empty()) {
+            written_seq_ = batch_end;
+            ++batches_;
+        }
+        if (synced) {
+            synced_seq_ = unsynced;
+        }
+        done_cv_.notify_all();
+
+        if (stopping) {
+            return;
+        }
+    }
+}
+
+void
+GroupCommitWriter::writeBatch(const vector<string>& batch) {
+    vector<struct iovec> iov;
+    iov.reserve(min(batch.size(), static_cast<size_t>(IOV_MAX)));
+
+    size_t next = 0;
+    while (next < batch.size()) {
+        // Gather as many records as a single writev accepts.
+        iov.clear();
+        while ((next < batch.size()) && (iov.size() < IOV_MAX)) {
+            if (!batch[next].empty()) {
+                struct iovec v;
+                v.iov_base = const_cast<char*>(batch[next].data());
+                v.iov_len = batch[next].size();
+                iov.push_back(v);
+            }
+            ++next;
+        }
+
+        // Write, resuming after partial writes and interruptions.
+        size_t first = 0;
+        while (first < iov.size()) {
+            ssize_t written = ::writev(fd_, &iov[first],
+                                       static_cast<int>(iov.size() - first));
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                isc_throw(GroupCommitError, "failed to write to '"
+                          << filename_ << "': " << strerror(errno));
+            }
+            size_t left = static_cast<size_t>(written);
+            while ((first < iov.size()) && (left >= iov[first].iov_len)) {
+                left -= iov[first].iov_len;
+                ++first;
+            }
+            if (left > 0) {
+                iov[first].iov_base = static_cast<char*>(iov[first].iov_base) + left;
+                iov[first].iov_len -= left;
+            }
+        }
+    }
+}
+
+void
+GroupCommitWriter::sync() {
+    if (::fdatasync(fd_) != 0) {
+        isc_throw(GroupCommitError, "failed to sync '" << filename_
+                  << "': " << strerror(errno));
+    }
+}
+
+} // namespace isc::util
+} // namespace isc
@@ -0,0 +1,247 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef GROUP_COMMIT_WRITER_H
+#define GROUP_COMMIT_WRITER_H
+
+#include <exceptions/exceptions.h>
+
+#include <boost/noncopyable.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace isc {
+namespace util {
+
+/// @brief Exception thrown when the group commit writer fails.
+class GroupCommitError : public Exception {
+public:
+    GroupCommitError(const char* file, size_t line, const char* what) :
+        isc::Exception(file, line, what) {
+    }
+};
+
+/// @brief Asynchronous, batching writer for append-only files.
+///
+/// Callers enqueue complete records (e.g. rendered CSV rows including the
+/// trailing new line) which are written by a dedicated writer thread. The
+/// writer takes everything queued since its previous pass and writes it with
+/// as few @c writev calls as possible, so that the cost of the system calls
+/// is shared by all records enqueued concurrently ("group commit").
+///
+/// Every enqueued record gets a sequence number. A caller which needs to
+/// know that its record reached the file (or the disk, depending on the
+/// synchronization policy) waits for that sequence number with @c wait.
+///
+/// The file is opened in append mode so it can be shared with a stream
+/// which was used to read the file or to write its header, as long as that
+/// stream does not write anything while the writer is running.
+class GroupCommitWriter : public boost::noncopyable {
+public:
+
+    /// @brief Policy controlling when written data are synced to disk.
+    enum SyncPolicy {
+        /// @brief Never sync; data are left to the operating system.
+        SYNC_NONE,
+        /// @brief Sync after each batch written.
+        SYNC_BATCH,
+        /// @brief Sync at most once per configured interval.
+        SYNC_INTERVAL
+    };
+
+    /// @brief Converts textual policy name to the policy value.
+    ///
+    /// @param policy One of "none", "batch" or "interval".
+    /// @return Policy value.
+    /// @throw BadValue if the name is not recognized.
+    static SyncPolicy syncPolicyFromText(const std::string& policy);
+
+    /// @brief Converts policy value to its textual name.
+    ///
+    /// @param policy Policy value.
+    /// @return Policy name.
+    static std::string syncPolicyToText(const SyncPolicy policy);
+
+    /// @brief Constructor.
+    ///
+    /// The constructor doesn't open the file. The @c start function
+    /// does it.
+    ///
+    /// @param filename Name of the file to append to.
+    /// @param policy Synchronization policy.
+    /// @param sync_interval Interval between syncs when policy is
+    /// @c SYNC_INTERVAL.
+    /// @param max_batch_size Maximum number of bytes written in a single
+    /// pass of the writer thread.
+    GroupCommitWriter(const std::string& filename,
+                      const SyncPolicy policy = SYNC_NONE,
+                      const std::chrono::milliseconds& sync_interval =
+                          std::chrono::milliseconds(1000),
+                      const size_t max_batch_size = 1024 * 1024);
+
+    /// @brief Destructor.
+    ///
+    /// Writes all pending records and stops the writer thread.
+    ~GroupCommitWriter();
+
+    /// @brief Opens the file and starts the writer thread.
+    ///
+    /// @throw GroupCommitError if the file can't be opened.
+    /// @throw InvalidOperation if the writer is already running.
+    void start();
+
+    /// @brief Writes all pending records, syncs the file if the policy
+    /// requires it, stops the writer thread and closes the file.
+    ///
+    /// It is allowed to stop the writer multiple times.
+    void stop();
+
+    /// @brief Checks if the writer thread is running.
+    bool isRunning() const;
+
+    /// @brief Enqueues a record for writing.
+    ///
+    /// @param record Record to be written. It must contain the record
+    /// terminator, if any.
+    /// @return Sequence number of the record.
+    /// @throw GroupCommitError if the writer is not running or if an error
+    /// occurred while writing previous records.
+    uint64_t enqueue(std::string&& record);
+
+    /// @brief Waits until a record has been written and, unless the policy
+    /// is @c SYNC_NONE, synced to disk.
+    ///
+    /// @param seq Sequence number returned by @c enqueue.
+    /// @throw GroupCommitError if the writer failed before the record was
+    /// completed.
+    void wait(const uint64_t seq);
+
+    /// @brief Waits until all records enqueued so far are completed.
+    ///
+    /// @throw GroupCommitError on write error.
+    void flush();
+
+    /// @brief Returns the name of the file.
+    std::string getFilename() const {
+        return (filename_);
+    }
+
+    /// @brief Returns the number of completed write passes.
+    uint64_t getBatchCount() const;
+
+    /// @brief Returns the number of records written.
+    uint64_t getWrittenCount() const;
+
+private:
+
+    /// @brief Writer thread main loop.
+    void run();
+
+    /// @brief Writes the batch to the file.
+    ///
+    /// Called without the mutex held.
+    ///
+    /// @param batch Records to be written.
+    /// @throw GroupCommitError on write error.
+    void writeBatch(const std::vector<std::string>& batch);
+
+    /// @brief Syncs the file to disk.
+    ///
+    /// @throw GroupCommitError on sync error.
+    void sync();
+
+    /// @brief Returns the sequence number up to which the records are
+    /// completed according to the policy.
+    ///
+    /// Must be called with the mutex held.
+    uint64_t completedSeqInternal() const;
+
+    /// @brief Throws the recorded writer error, if any.
+    ///
+    /// Must be called with the mutex held.
+    void checkErrorInternal() const;
+
+    /// @brief Name of the file.
+    std::string filename_;
+
+    /// @brief Synchronization policy.
+    SyncPolicy policy_;
+
+    /// @brief Interval between syncs for @c SYNC_INTERVAL.
+    std::chrono::milliseconds sync_interval_;
+
+    /// @brief Maximum number of bytes written per pass.
+    size_t max_batch_size_;
+
+    /// @brief File descriptor, -1 when closed.
+    int fd_;
+
+    /// @brief The writer thread.
+    std::unique_ptr<std::thread> thread_;
+
+    /// @brief Mutex protecting the fields below.
+    mutable std::mutex mutex_;
+
+    /// @brief Signals the writer thread that there is work or that it
+    /// should stop.
+    std::condition_variable work_cv_;
+
+    /// @brief Signals the waiters that the completed sequence moved.
+    std::condition_variable done_cv_;
+
+    /// @brief Records waiting to be written.
+    std::vector<std::string> queue_;
+
+    /// @brief Number of bytes in @c queue_.
+    size_t queued_bytes_;
+
+    /// @brief Sequence number of the last enqueued record.
+    uint64_t enqueued_seq_;
+
+    /// @brief Sequence number of the last written record.
+    uint64_t written_seq_;
+
+    /// @brief Sequence number of the last synced record.
+    uint64_t synced_seq_;
+
+    /// @brief Number of completed write passes.
+    uint64_t batches_;
+
+    /// @brief Flag indicating that the writer should stop.
+    bool stopping_;
+
+    /// @brief Flag indicating that the writer is running.
+    bool running_;
+
+    /// @brief Error reported by the writer thread, empty if none.
+    std::string error_;
+};
+
+/// @brief Pointer to the @c GroupCommitWriter.
+typedef std::shared_ptr<GroupCommitWriter> GroupCommitWriterPtr;
+
+} // namespace isc::util
+} // namespace isc
+
+#endif // GROUP_COMMIT_WRITER_H
@@ -0,0 +1,127 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <util/latency_histogram.h>
+#include <exceptions/exceptions.h>
+
+#include <cmath>
+#include <limits>
+
+namespace isc {
+namespace util {
+
+LatencyHistogram::LatencyHistogram()
+    : counts_(BUCKET_COUNT, 0), count_(0), sum_(0),
+      min_(std::numeric_limits<uint64_t>::max()), max_(0) {
+}
+
+void
+LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        counts_[i] += other.counts_[i];
+    }
+    count_ += other.count_;
+    sum_ += other.sum_;
+    if (other.min_ < min_) {
+        min_ = other.min_;
+    }
+    if (other.max_ > max_) {
+        max_ = other.max_;
+    }
+}
+
+void
+LatencyHistogram::clear() {
+    counts_.assign(BUCKET_COUNT, 0);
+    count_ = 0;
+    sum_ = 0;
+    min_ = std::numeric_limits<uint64_t>::max();
+    max_ = 0;
+}
+
+double
+LatencyHistogram::getMean() const {
+    if (count_ == 0) {
+        return (0.);
+    }
+    return (static_cast<double>(sum_) / count_);
+}
+
+uint64_t
+LatencyHistogram::getPercentile(const double percentile) const {
+    if (!(percentile >= 0.) || (percentile > 100.)) {
+        isc_throw(BadValue, "percentile " << percentile
+                  << " is not between 0 and 100");
+    }
+    if (count_ == 0) {
+        return (0);
+    }
+    if (percentile == 0.) {
+        return (min_);
+    }
+
+    // The rank of the value, starting at 1.
+    uint64_t rank = static_cast<uint64_t>(std::ceil(percentile / 100. * count_));
+    if (rank == 0) {
+        rank = 1;
+    } else if (rank > count_) {
+        rank = count_;
+    }
+    uint64_t seen = 0;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        seen += counts_[i];
+        if (seen >= rank) {
+            const uint64_t highest = getHighest(i);
+            return (highest < max_ ? highest : max_);
+        }
+    }
+    return (max_);
+}
+
+std::vector<LatencyHistogram::Bucket>
+LatencyHistogram::getBuckets() const {
+    std::vector<Bucket> buckets;
+    for (size_t i = 0; i < BUCKET_COUNT; ++i) {
+        if (counts_[i] > 0) {
+            buckets.push_back(Bucket{getLowest(i), getHighest(i), counts_[i]});
+        }
+    }
+    return (buckets);
+}
+
+uint64_t
+LatencyHistogram::getLowest(const size_t index) {
+    if (index < 2 * SUB_BUCKET_COUNT) {
+        return (index);
+    }
+    const unsigned shift = index / SUB_BUCKET_COUNT - 1;
+    return ((index % SUB_BUCKET_COUNT + SUB_BUCKET_COUNT) << shift);
+}
+
+uint64_t
+LatencyHistogram::getHighest(const size_t index) {
+    if (index < 2 * SUB_BUCKET_COUNT) {
+        return (index);
+    }
+    const unsigned shift = index / SUB_BUCKET_COUNT - 1;
+    return (getLowest(index) + ((1ULL << shift) - 1));
+}
+
+}  // namespace util
+}  // namespace isc
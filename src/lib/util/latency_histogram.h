@@ -0,0 +1,172 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <chrono>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace isc {
+namespace util {
+
+/// @brief Histogram of latencies with a bounded relative error.
+///
+/// The values, usually durations in nanoseconds, are counted in log-linear
+/// buckets in the manner of HdrHistogram: every power of two is split in
+/// 32 buckets of equal width, and the values below 64 have a bucket each.
+/// A value is thus known within 1/32 of itself, whatever its magnitude,
+/// and the whole 64 bit range fits in less than 2000 counters.
+///
+/// Recording a value is a few arithmetic operations and an increment, so
+/// the histogram can be used on the hot path. It is not thread safe: each
+/// thread records in its own histogram and the histograms are merged when
+/// reported.
+class LatencyHistogram {
+public:
+
+    /// @brief Number of bits of a value kept by its bucket.
+    static constexpr unsigned SUB_BUCKET_BITS = 5;
+
+    /// @brief Number of buckets per power of two.
+    static constexpr uint64_t SUB_BUCKET_COUNT = 1ULL << SUB_BUCKET_BITS;
+
+    /// @brief Total number of buckets.
+    static constexpr size_t BUCKET_COUNT =
+        (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKET_COUNT;
+
+    /// @brief Bucket of the histogram: lowest value, highest value and
+    /// count.
+    struct Bucket {
+        uint64_t lowest_;
+        uint64_t highest_;
+        uint64_t count_;
+    };
+
+    /// @brief Constructor.
+    LatencyHistogram();
+
+    /// @brief Records a value.
+    ///
+    /// @param value Value, e.g. a duration in nanoseconds.
+    void record(const uint64_t value) {
+        ++counts_[getIndex(value)];
+        ++count_;
+        sum_ += value;
+        if (value < min_) {
+            min_ = value;
+        }
+        if (value > max_) {
+            max_ = value;
+        }
+    }
+
+    /// @brief Records a duration in nanoseconds.
+    ///
+    /// Negative durations, which a clock adjustment can produce, are
+    /// recorded as 0.
+    ///
+    /// @param duration Duration.
+    void record(const std::chrono::nanoseconds& duration) {
+        record(duration.count() > 0 ? static_cast<uint64_t>(duration.count()) : 0);
+    }
+
+    /// @brief Adds the values of another histogram.
+    ///
+    /// @param other Histogram to add.
+    void merge(const LatencyHistogram& other);
+
+    /// @brief Removes all values.
+    void clear();
+
+    /// @brief Returns the number of values.
+    uint64_t getCount() const {
+        return (count_);
+    }
+
+    /// @brief Returns the smallest value, 0 when there are none.
+    uint64_t getMin() const {
+        return (count_ ? min_ : 0);
+    }
+
+    /// @brief Returns the largest value, 0 when there are none.
+    uint64_t getMax() const {
+        return (max_);
+    }
+
+    /// @brief Returns the mean of the values, 0 when there are none.
+    double getMean() const;
+
+    /// @brief Returns the value at a percentile.
+    ///
+    /// The returned value is the highest value of the bucket holding the
+    /// percentile, bounded by the largest value, so that at least the given
+    /// share of the values is smaller or equal.
+    ///
+    /// @param percentile Percentile between 0 and 100.
+    /// @return The value, 0 when there are none.
+    /// @throw BadValue if the percentile is out of range.
+    uint64_t getPercentile(const double percentile) const;
+
+    /// @brief Returns the buckets holding values, in increasing order.
+    std::vector<Bucket> getBuckets() const;
+
+    /// @brief Returns the index of the bucket of a value.
+    ///
+    /// @param value Value.
+    static size_t getIndex(const uint64_t value) {
+        if (value < 2 * SUB_BUCKET_COUNT) {
+            return (value);
+        }
+        const unsigned shift = 63 - __builtin_clzll(value) - SUB_BUCKET_BITS;
+        return ((shift + 1) * SUB_BUCKET_COUNT + (value >> shift) - SUB_BUCKET_COUNT);
+    }
+
+    /// @brief Returns the lowest value of a bucket.
+    ///
+    /// @param index Index of the bucket.
+    static uint64_t getLowest(const size_t index);
+
+    /// @brief Returns the highest value of a bucket.
+    ///
+    /// @param index Index of the bucket.
+    static uint64_t getHighest(const size_t index);
+
+private:
+
+    /// @brief Counts of the buckets.
+    std::vector<uint64_t> counts_;
+
+    /// @brief Number of values.
+    uint64_t count_;
+
+    /// @brief Sum of the values, wrapping after 584 years of nanoseconds.
+    uint64_t sum_;
+
+    /// @brief Smallest value.
+    uint64_t min_;
+
+    /// @brief Largest value.
+    uint64_t max_;
+};
+
+}  // namespace util
+}  // namespace isc
+
+#endif  // LATENCY_HISTOGRAM_H
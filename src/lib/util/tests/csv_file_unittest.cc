@@ -578,4 +578,51 @@ TEST_F(CSVFileTest, exists) {
     EXPECT_FALSE(csv->exists());
 }
 
+// This test checks that the rows appended with group commit enabled are
+// written to the file in order, and that reopening the file keeps the
+// group commit setting.
+TEST_F(CSVFileTest, groupCommit) {
+    std::unique_ptr<CSVFile> csv(new CSVFile(testfile_));
+    csv->addColumn("animal");
+    csv->addColumn("color");
+    ASSERT_NO_THROW(csv->recreate());
+    ASSERT_NO_THROW(csv->setGroupCommit(true, GroupCommitWriter::SYNC_BATCH));
+    EXPECT_TRUE(csv->getGroupCommit());
+
+    CSVRow row0(2);
+    row0.writeAt(0, "dog");
+    row0.writeAt(1, "grey");
+    ASSERT_NO_THROW(csv->append(row0));
+
+    // Wait for the row appended by this thread.
+    ASSERT_NO_THROW(CSVFile::waitForAppends());
+    EXPECT_EQ("animal,color\n"
+              "dog,grey\n",
+              readFile());
+
+    // Reopen the file and append another row. It should still go through
+    // the group commit writer and be written on close.
+    csv->close();
+    ASSERT_NO_THROW(csv->open(true));
+    CSVRow row1(2);
+    row1.writeAt(0, "cat");
+    row1.writeAt(1, "black");
+    ASSERT_NO_THROW(csv->append(row1));
+    csv->close();
+
+    // Waiting after the file has been closed must not fail, because the
+    // row was written when the file was closed.
+    EXPECT_NO_THROW(CSVFile::waitForAppends());
+
+    EXPECT_EQ("animal,color\n"
+              "dog,grey\n"
+              "cat,black\n",
+              readFile());
+
+    // The row with wrong number of values is rejected right away.
+    ASSERT_NO_THROW(csv->open(true));
+    CSVRow row2(3);
+    EXPECT_THROW(csv->append(row2), CSVFileError);
+}
+
 } // end of anonymous namespace
@@ -0,0 +1,177 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <util/group_commit_writer.h>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace isc;
+using namespace isc::util;
+using namespace std;
+
+namespace {
+
+/// @brief Test fixture for @c GroupCommitWriter.
+class GroupCommitWriterTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Removes the test file left by previous tests.
+    GroupCommitWriterTest()
+        : testfile_(string(TEST_DATA_BUILDDIR) + "/group-commit.csv") {
+        static_cast<void>(remove(testfile_.c_str()));
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Removes the test file.
+    virtual ~GroupCommitWriterTest() {
+        static_cast<void>(remove(testfile_.c_str()));
+    }
+
+    /// @brief Reads the whole test file.
+    ///
+    /// @return Contents of the file.
+    string readFile() const {
+        ifstream fs(testfile_.c_str());
+        return (string((istreambuf_iterator<char>(fs)),
+                       istreambuf_iterator<char>()));
+    }
+
+    /// @brief Path to the test file.
+    string testfile_;
+};
+
+// Verifies conversion of the sync policy names.
+TEST_F(GroupCommitWriterTest, syncPolicy) {
+    EXPECT_EQ(GroupCommitWriter::SYNC_NONE,
+              GroupCommitWriter::syncPolicyFromText("none"));
+    EXPECT_EQ(GroupCommitWriter::SYNC_BATCH,
+              GroupCommitWriter::syncPolicyFromText("batch"));
+    EXPECT_EQ(GroupCommitWriter::SYNC_INTERVAL,
+              GroupCommitWriter::syncPolicyFromText("interval"));
+    EXPECT_THROW(GroupCommitWriter::syncPolicyFromText("always"), BadValue);
+
+    EXPECT_EQ("none", GroupCommitWriter::syncPolicyToText(GroupCommitWriter::SYNC_NONE));
+    EXPECT_EQ("batch", GroupCommitWriter::syncPolicyToText(GroupCommitWriter::SYNC_BATCH));
+    EXPECT_EQ("interval", GroupCommitWriter::syncPolicyToText(GroupCommitWriter::SYNC_INTERVAL));
+}
+
+// Verifies that records can't be enqueued when the writer is not running
+// and that the writer can't be started twice.
+TEST_F(GroupCommitWriterTest, startStop) {
+    GroupCommitWriter writer(testfile_);
+    EXPECT_FALSE(writer.isRunning());
+    EXPECT_THROW(writer.enqueue("foo\n"), GroupCommitError);
+
+    ASSERT_NO_THROW(writer.start());
+    EXPECT_TRUE(writer.isRunning());
+    EXPECT_THROW(writer.start(), InvalidOperation);
+
+    ASSERT_NO_THROW(writer.stop());
+    EXPECT_FALSE(writer.isRunning());
+    // Stopping again is a no-op.
+    EXPECT_NO_THROW(writer.stop());
+}
+
+// Verifies that records are appended in order and that the writer
+// appends to the existing contents of the file.
+TEST_F(GroupCommitWriterTest, append) {
+    {
+        ofstream fs(testfile_.c_str());
+        fs << "header\n";
+    }
+
+    for (auto policy : { GroupCommitWriter::SYNC_NONE,
+                         GroupCommitWriter::SYNC_BATCH,
+                         GroupCommitWriter::SYNC_INTERVAL }) {
+        GroupCommitWriter writer(testfile_, policy,
+                                 std::chrono::milliseconds(10));
+        ASSERT_NO_THROW(writer.start());
+        uint64_t seq = 0;
+        ASSERT_NO_THROW(seq = writer.enqueue("foo\n"));
+        EXPECT_EQ(1, seq);
+        ASSERT_NO_THROW(seq = writer.enqueue("bar\n"));
+        EXPECT_EQ(2, seq);
+        ASSERT_NO_THROW(writer.wait(seq));
+        EXPECT_EQ(2, writer.getWrittenCount());
+        ASSERT_NO_THROW(writer.stop());
+    }
+
+    EXPECT_EQ("header\n"
+              "foo\nbar\n"
+              "foo\nbar\n"
+              "foo\nbar\n", readFile());
+}
+
+// Verifies that records enqueued by many threads are all written, batched
+// into fewer writes than records, and that small batch sizes split the
+// queue into multiple passes.
+TEST_F(GroupCommitWriterTest, concurrentAppend) {
+    const size_t threads = 8;
+    const size_t records = 500;
+
+    GroupCommitWriter writer(testfile_, GroupCommitWriter::SYNC_NONE,
+                             std::chrono::milliseconds(1000), 64);
+    ASSERT_NO_THROW(writer.start());
+
+    vector<thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+        workers.push_back(thread([&writer, t, records]() {
+            for (size_t i = 0; i < records; ++i) {
+                ostringstream s;
+                s << t << "-" << i << "\n";
+                writer.wait(writer.enqueue(s.str()));
+            }
+        }));
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+    ASSERT_NO_THROW(writer.flush());
+    EXPECT_EQ(threads * records, writer.getWrittenCount());
+    EXPECT_LE(writer.getBatchCount(), threads * records);
+    ASSERT_NO_THROW(writer.stop());
+
+    // Every record must be present exactly once.
+    set<string> lines;
+    istringstream contents(readFile());
+    string line;
+    while (getline(contents, line)) {
+        EXPECT_TRUE(lines.insert(line).second) << line;
+    }
+    EXPECT_EQ(threads * records, lines.size());
+}
+
+// Verifies that an error opening the file is reported.
+TEST_F(GroupCommitWriterTest, openError) {
+    GroupCommitWriter writer("/this/directory/does/not/exist/file.csv");
+    EXPECT_THROW(writer.start(), GroupCommitError);
+    EXPECT_FALSE(writer.isRunning());
+}
+
+} // end of anonymous namespace
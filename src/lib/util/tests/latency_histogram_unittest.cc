@@ -0,0 +1,134 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <exceptions/exceptions.h>
+#include <util/latency_histogram.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <limits>
+
+using namespace isc;
+using namespace isc::util;
+using namespace std;
+
+namespace {
+
+// Verifies that the buckets cover the whole range without gaps.
+TEST(LatencyHistogramTest, buckets) {
+    EXPECT_EQ(0, LatencyHistogram::getLowest(0));
+    for (size_t i = 1; i < LatencyHistogram::BUCKET_COUNT; ++i) {
+        ASSERT_EQ(LatencyHistogram::getHighest(i - 1) + 1,
+                  LatencyHistogram::getLowest(i)) << "bucket " << i;
+        ASSERT_EQ(i, LatencyHistogram::getIndex(LatencyHistogram::getLowest(i)));
+        ASSERT_EQ(i, LatencyHistogram::getIndex(LatencyHistogram::getHighest(i)));
+    }
+    EXPECT_EQ(numeric_limits<uint64_t>::max(),
+              LatencyHistogram::getHighest(LatencyHistogram::BUCKET_COUNT - 1));
+
+    // The small values are exact and the large ones within 1/32.
+    EXPECT_EQ(63, LatencyHistogram::getIndex(63));
+    for (uint64_t value : { 64ULL, 1000ULL, 123456789ULL, 1ULL << 40 }) {
+        const size_t index = LatencyHistogram::getIndex(value);
+        const uint64_t width = LatencyHistogram::getHighest(index) -
+            LatencyHistogram::getLowest(index) + 1;
+        EXPECT_LE(width * LatencyHistogram::SUB_BUCKET_COUNT, value);
+    }
+}
+
+// Verifies the statistics of the recorded values.
+TEST(LatencyHistogramTest, record) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(0, histogram.getCount());
+    EXPECT_EQ(0, histogram.getMin());
+    EXPECT_EQ(0, histogram.getMax());
+    EXPECT_EQ(0., histogram.getMean());
+    EXPECT_EQ(0, histogram.getPercentile(50.));
+
+    for (uint64_t value = 1; value <= 50; ++value) {
+        histogram.record(value);
+    }
+    histogram.record(chrono::nanoseconds(-5));
+    EXPECT_EQ(51, histogram.getCount());
+    EXPECT_EQ(0, histogram.getMin());
+    EXPECT_EQ(50, histogram.getMax());
+    EXPECT_DOUBLE_EQ(25., histogram.getMean());
+
+    // The values below 64 are exact.
+    EXPECT_EQ(0, histogram.getPercentile(0.));
+    EXPECT_EQ(25, histogram.getPercentile(50.));
+    EXPECT_EQ(50, histogram.getPercentile(100.));
+    EXPECT_THROW(histogram.getPercentile(-1.), BadValue);
+    EXPECT_THROW(histogram.getPercentile(101.), BadValue);
+}
+
+// Verifies the percentiles of a wide range of values.
+TEST(LatencyHistogramTest, percentiles) {
+    LatencyHistogram histogram;
+    for (uint64_t value = 1; value <= 100000; ++value) {
+        histogram.record(chrono::microseconds(value));
+    }
+    for (double percentile : { 50., 90., 99., 99.9 }) {
+        const double exact = percentile * 1000. * 1000.;
+        const double found = histogram.getPercentile(percentile);
+        EXPECT_GE(found, exact) << percentile;
+        EXPECT_LE(found, exact * (1. + 1. / LatencyHistogram::SUB_BUCKET_COUNT))
+            << percentile;
+    }
+    EXPECT_EQ(100000000, histogram.getPercentile(100.));
+}
+
+// Verifies that histograms are merged and cleared.
+TEST(LatencyHistogramTest, merge) {
+    LatencyHistogram first;
+    LatencyHistogram second;
+    first.record(10);
+    first.record(1000);
+    second.record(5);
+    second.record(1000000);
+    first.merge(second);
+    EXPECT_EQ(4, first.getCount());
+    EXPECT_EQ(5, first.getMin());
+    EXPECT_EQ(1000000, first.getMax());
+
+    vector<LatencyHistogram::Bucket> buckets = first.getBuckets();
+    ASSERT_EQ(4, buckets.size());
+    EXPECT_EQ(5, buckets[0].lowest_);
+    EXPECT_EQ(5, buckets[0].highest_);
+    EXPECT_EQ(10, buckets[1].lowest_);
+    EXPECT_LE(buckets[2].lowest_, 1000);
+    EXPECT_GE(buckets[2].highest_, 1000);
+    for (auto const& bucket : buckets) {
+        EXPECT_EQ(1, bucket.count_);
+    }
+
+    // Merging an empty histogram changes nothing.
+    first.merge(LatencyHistogram());
+    EXPECT_EQ(4, first.getCount());
+    EXPECT_EQ(5, first.getMin());
+
+    first.clear();
+    EXPECT_EQ(0, first.getCount());
+    EXPECT_EQ(0, first.getMin());
+    EXPECT_EQ(0, first.getMax());
+    EXPECT_TRUE(first.getBuckets().empty());
+}
+
+}  // namespace
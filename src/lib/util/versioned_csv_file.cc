@@ -130,6 +130,11 @@ VersionedCSVFile::next(CSVRow& row) {
         return(true);
     }
 
+    return (adjustRow(row));
+}
+
+bool
+VersionedCSVFile::adjustRow(CSVRow& row) {
     bool row_valid = true;
     switch(getInputSchemaState()) {
         case CURRENT:
@@ -229,6 +229,18 @@ public:
     /// failed.
     bool next(CSVRow& row);
 
+    /// @brief Adjusts a row to the current schema.
+    ///
+    /// Applies the rules described for @c next to a row which hasn't been
+    /// read by @c next, e.g. a row extracted from the file contents read
+    /// by the caller. The file must have been opened before, so as the
+    /// input schema is known.
+    ///
+    /// @param [in,out] row Row to be validated and adjusted.
+    ///
+    /// @return true if row has been validated; false if validation failed.
+    bool adjustRow(CSVRow& row);
+
     /// @brief Returns the schema version of the physical file
     ///
     /// @return text version of the schema found or string "undefined" if the
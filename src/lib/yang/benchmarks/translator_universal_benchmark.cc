@@ -0,0 +1,191 @@
+// (C) 2020 Deutsche Telekom AG.
+//
+// Deutsche Telekom AG and all other contributors /
+// copyright owners license this file to you under the Apache
+// License, Version 2.0 (the "License"); you may not use this
+// file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <config.h>
+
+#include <cc/data.h>
+#include <yang/translator_universal.h>
+#include <yang/yang_models.h>
+
+#include <benchmark/benchmark.h>
+
+#include <sysrepo-cpp/Session.hpp>
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+using isc::data::Element;
+using isc::data::ElementPtr;
+using isc::yang::KEA_DHCP6_SERVER;
+using isc::yang::TranslatorUniversal;
+using std::make_shared;
+using std::string;
+using std::stringstream;
+using sysrepo::Connection;
+using sysrepo::S_Connection;
+using sysrepo::S_Session;
+using sysrepo::Session;
+
+namespace {
+
+/// @brief Number of pools in every generated subnet.
+constexpr size_t POOLS_PER_SUBNET = 4;
+
+/// @brief Generates a kea-dhcp6-server configuration.
+///
+/// Every subnet has @c POOLS_PER_SUBNET pools and two options, so lists are searched by key
+/// at two levels.
+///
+/// @param subnets number of subnets
+ElementPtr generateConfig(size_t const subnets) {
+    ElementPtr const subnet6(Element::createList());
+    for (size_t i = 0; i < subnets; ++i) {
+        stringstream prefix;
+        prefix << "2001:db8:" << std::hex << (i >> 16) << ":" << (i & 0xffff);
+
+        ElementPtr const subnet(Element::createMap());
+        subnet->set("subnet", Element::create(prefix.str() + "::/64"));
+        subnet->set("id", Element::create(static_cast<int64_t>(i + 1)));
+        subnet->set("valid-lifetime", Element::create(4000));
+        subnet->set("preferred-lifetime", Element::create(3000));
+
+        ElementPtr const pools(Element::createList());
+        for (size_t p = 0; p < POOLS_PER_SUBNET; ++p) {
+            stringstream start;
+            stringstream end;
+            start << prefix.str() << ":" << std::hex << p << "::1";
+            end << prefix.str() << ":" << std::hex << p << "::ffff";
+            ElementPtr const pool(Element::createMap());
+            pool->set("start-address", Element::create(start.str()));
+            pool->set("end-address", Element::create(end.str()));
+            pools->add(pool);
+        }
+        subnet->set("pools", pools);
+
+        ElementPtr const option_data(Element::createList());
+        ElementPtr const dns(Element::createMap());
+        dns->set("code", Element::create(23));
+        dns->set("space", Element::create(string("dhcp6")));
+        dns->set("data", Element::create(string("2001:db8::53")));
+        option_data->add(dns);
+        ElementPtr const domains(Element::createMap());
+        domains->set("code", Element::create(24));
+        domains->set("space", Element::create(string("dhcp6")));
+        domains->set("data", Element::create(string("example.com")));
+        option_data->add(domains);
+        subnet->set("option-data", option_data);
+
+        subnet6->add(subnet);
+    }
+
+    ElementPtr const dhcp6(Element::createMap());
+    dhcp6->set("valid-lifetime", Element::create(4000));
+    dhcp6->set("subnet6", subnet6);
+
+    ElementPtr const config(Element::createMap());
+    config->set("Dhcp6", dhcp6);
+    return config;
+}
+
+/// @brief Fixture which stores a generated configuration of state.range(0) subnets in the
+/// running datastore.
+class TranslatorUniversalBenchmark : public ::benchmark::Fixture {
+public:
+    void SetUp(::benchmark::State const& state) override {
+        connection_ = make_shared<Connection>();
+        session_ = make_shared<Session>(connection_, SR_DS_RUNNING);
+        translator_ = make_shared<TranslatorUniversal>(session_, KEA_DHCP6_SERVER);
+        config_ = generateConfig(state.range(0));
+        translator_->del();
+        translator_->set(config_);
+        session_->apply_changes();
+    }
+
+    void SetUp(::benchmark::State& s) override {
+        ::benchmark::State const& cs = s;
+        SetUp(cs);
+    }
+
+    void TearDown(::benchmark::State const&) override {
+        translator_->del();
+        session_->apply_changes();
+        translator_.reset();
+        config_.reset();
+        session_.reset();
+        connection_.reset();
+    }
+
+    void TearDown(::benchmark::State& s) override {
+        ::benchmark::State const& cs = s;
+        TearDown(cs);
+    }
+
+    S_Connection connection_;
+    S_Session session_;
+    std::shared_ptr<TranslatorUniversal> translator_;
+    ElementPtr config_;
+};
+
+BENCHMARK_DEFINE_F(TranslatorUniversalBenchmark, get)(benchmark::State& state) {
+    for (auto _ : state) {
+        ElementPtr const result(translator_->get());
+        benchmark::DoNotOptimize(result);
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK_DEFINE_F(TranslatorUniversalBenchmark, set)(benchmark::State& state) {
+    for (auto _ : state) {
+        translator_->set(config_);
+        session_->discard_changes();
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK_DEFINE_F(TranslatorUniversalBenchmark, setDiff)(benchmark::State& state) {
+    for (auto _ : state) {
+        translator_->setDiff(config_);
+        session_->discard_changes();
+    }
+    state.SetComplexityN(state.range(0));
+}
+
+/// A benchmark that measures reading the whole kea-dhcp6-server datastore for 256 to 16384
+/// subnets. Time should grow linearly with the number of subnets.
+BENCHMARK_REGISTER_F(TranslatorUniversalBenchmark, get)
+    ->RangeMultiplier(4)
+    ->Range(256, 16384)
+    ->Unit(benchmark::kMillisecond)
+    ->Complexity(benchmark::oN);
+
+/// A benchmark that measures preparing the edit which writes the whole configuration.
+BENCHMARK_REGISTER_F(TranslatorUniversalBenchmark, set)
+    ->RangeMultiplier(4)
+    ->Range(256, 16384)
+    ->Unit(benchmark::kMillisecond)
+    ->Complexity(benchmark::oN);
+
+/// A benchmark that measures writing the configuration which is already in the datastore,
+/// which results in no edits.
+BENCHMARK_REGISTER_F(TranslatorUniversalBenchmark, setDiff)
+    ->RangeMultiplier(4)
+    ->Range(256, 16384)
+    ->Unit(benchmark::kMillisecond)
+    ->Complexity(benchmark::oN);
+
+}  // namespace
@@ -29,6 +29,7 @@ using isc::data::ElementPtr;
 using isc::yang::IETF_DHCPV6_SERVER;
 using isc::yang::KEA_DHCP6_SERVER;
 using isc::yang::KEATEST_MODULE;
+using isc::yang::TranslatorBasic;
 using isc::yang::TranslatorUniversal;
 using isc::yang::test::YangMock;
 using std::array;
@@ -36,6 +37,9 @@ using std::endl;
 using std::make_shared;
 using std::string;
 using std::tuple;
+using std::vector;
+using libyang::Data_Node_Leaf_List;
+using libyang::S_Data_Node;
 using sysrepo::Connection;
 using sysrepo::S_Connection;
 using sysrepo::S_Session;
@@ -43,6 +47,97 @@ using sysrepo::Session;
 
 namespace {
 
+/// @brief Reads the data the way get() did before it walked the data tree: every node is set
+/// into the result at its absolute xpath.
+ElementPtr getByXpath(S_Session const& session, string const& model) {
+    ElementPtr result(Element::createMap());
+    for (string const& root_node : TranslatorBasic::rootNodes().at(model)) {
+        string const path("/" + model + ":" + root_node);
+        S_Data_Node const toplevel(session->get_data(path.c_str()));
+        if (!toplevel) {
+            continue;
+        }
+        for (S_Data_Node const& root : toplevel->tree_for()) {
+            for (S_Data_Node const& node : root->tree_dfs()) {
+                ElementPtr element;
+                lys_nodetype const node_type(node->schema()->nodetype());
+                switch (node_type) {
+                case LYS_LEAF:
+                case LYS_LEAFLIST:
+                    element = Element::fromJSONFallbackToString(
+                        Data_Node_Leaf_List(node).value_str());
+                    break;
+                case LYS_CONTAINER:
+                    element = Element::createMap();
+                    break;
+                case LYS_LIST:
+                    element = Element::createList();
+                    break;
+                default:
+                    break;
+                }
+                if (element) {
+                    result->xpath(node->path(), element, node_type == LYS_LEAFLIST);
+                }
+            }
+        }
+    }
+    result->removeEmptyRecursively();
+    return result;
+}
+
+/// @brief Sets the data and checks that get() reads it the same way as getByXpath().
+void checkGet(string const& module, ElementPtr const& json) {
+    S_Connection connection(make_shared<Connection>());
+    S_Session session(make_shared<Session>(connection, SR_DS_RUNNING));
+    TranslatorUniversal translator(session, module);
+    translator.del();
+    translator.set(json);
+    session->apply_changes();
+    ElementPtr const& expected(getByXpath(session, module));
+    ElementPtr const& output(translator.get());
+    EXPECT_TRUE(isEquivalent(expected, output)) << "expected:" << endl
+                                                << prettyPrint(expected) << endl
+                                                << "output:" << endl
+                                                << prettyPrint(output);
+}
+
+/// @brief Builds the kea-dhcp6-server data for the given subnets, in the given order, each with
+/// the given pools.
+ElementPtr subnet6(vector<tuple<int, vector<string>>> const& subnets) {
+    ElementPtr list(Element::createList());
+    for (auto const& [id, pools] : subnets) {
+        ElementPtr subnet(Element::createMap());
+        subnet->set("id", Element::create(id));
+        subnet->set("subnet", Element::create("2001:db8:" + std::to_string(id) + "::/64"));
+        if (!pools.empty()) {
+            ElementPtr pool_list(Element::createList());
+            for (string const& pool : pools) {
+                ElementPtr entry(Element::createMap());
+                entry->set("start-address", Element::create("2001:db8:" + std::to_string(id) +
+                                                        "::" + pool + "00"));
+                entry->set("end-address", Element::create("2001:db8:" + std::to_string(id) +
+                                                      "::" + pool + "ff"));
+                pool_list->add(entry);
+            }
+            subnet->set("pools", pool_list);
+        }
+        list->add(subnet);
+    }
+    ElementPtr dhcp6(Element::createMap());
+    dhcp6->set("subnet6", list);
+    ElementPtr result(Element::createMap());
+    result->set("Dhcp6", dhcp6);
+    return result;
+}
+
+/// @brief Checks that the data is the expected one, including the order of the lists.
+void checkOrder(ElementPtr const& expected, ElementPtr const& output) {
+    // isEquivalent() ignores the order of list entries, the printed form does not.
+    EXPECT_TRUE(isEquivalent(expected, output));
+    EXPECT_EQ(prettyPrint(expected), prettyPrint(output));
+}
+
 TEST(TranslatorUniversal, test) {
     for (auto const& [module, json] : array<tuple<string, ElementPtr>, 3>{{
              {IETF_DHCPV6_SERVER, YangMock::ietf_dhcpv6_server()},
@@ -62,4 +157,144 @@ TEST(TranslatorUniversal, test) {
     }
 }
 
+// Verifies that get() reads the same data as the former xpath based insertion.
+TEST(TranslatorUniversal, getMatchesXpathInsertion) {
+    checkGet(IETF_DHCPV6_SERVER, YangMock::ietf_dhcpv6_server());
+    checkGet(KEA_DHCP6_SERVER, YangMock::kea_dhcp6_server());
+    checkGet(KEATEST_MODULE, YangMock::keatest_module());
+}
+
+// Verifies that get() reads nested lists with composite keys like before.
+TEST(TranslatorUniversal, getNestedLists) {
+    checkGet(KEATEST_MODULE, Element::fromJSON(R"(
+{
+  "container": {
+    "list": [
+      { "key1": "lorem", "key2": "ipsum", "leaf": "dolor" },
+      { "key1": "lorem", "key2": "sit" },
+      { "key1": "amet", "key2": "ipsum", "leaf": "consectetur" }
+    ]
+  },
+  "kernel-modules": {
+    "kernel-module": [
+      { "name": "adipiscing", "loaded": true },
+      { "name": "elit", "location": "/opt/modules", "loaded": false }
+    ]
+  }
+}
+)"));
+}
+
+// Verifies that get() reads leaf-lists like before.
+TEST(TranslatorUniversal, getLeafLists) {
+    checkGet(KEATEST_MODULE, Element::fromJSON(R"(
+{
+  "main": {
+    "numbers": [ 1, 2, 3, 5, 8 ],
+    "string": "sed"
+  }
+}
+)"));
+    checkGet(KEATEST_MODULE, Element::fromJSON(R"(
+{
+  "main": {
+    "numbers": [ 13 ]
+  }
+}
+)"));
+}
+
+// Verifies that get() reads empty and defaulted containers like before.
+TEST(TranslatorUniversal, getEmptyContainers) {
+    checkGet(KEATEST_MODULE, Element::fromJSON(R"(
+{
+  "presence-container": {}
+}
+)"));
+    checkGet(KEATEST_MODULE, Element::fromJSON(R"(
+{
+  "presence-container": {
+    "child1": {
+      "grandchild1": {}
+    },
+    "child2": {
+      "child2-leaf": -1
+    }
+  }
+}
+)"));
+    checkGet(KEATEST_MODULE, Element::createMap());
+}
+
+// Verifies that setting only the differences yields the same data as deleting and setting.
+TEST(TranslatorUniversal, setDiff) {
+    for (auto const& [module, json] : array<tuple<string, ElementPtr>, 3>{{
+             {IETF_DHCPV6_SERVER, YangMock::ietf_dhcpv6_server()},
+             {KEA_DHCP6_SERVER, YangMock::kea_dhcp6_server()},
+             {KEATEST_MODULE, YangMock::keatest_module()},
+         }}) {
+        S_Connection connection(make_shared<Connection>());
+        S_Session session(make_shared<Session>(connection, SR_DS_RUNNING));
+        TranslatorUniversal translator(session, module);
+        translator.del();
+        session->apply_changes();
+
+        // Everything is new.
+        translator.setDiff(json);
+        session->apply_changes();
+        ElementPtr output(translator.get());
+        EXPECT_TRUE(isEquivalent(json, output)) << "input:" << endl
+                                                << prettyPrint(json) << endl
+                                                << "output:" << endl
+                                                << prettyPrint(output);
+
+        // Nothing changed.
+        translator.setDiff(json);
+        session->apply_changes();
+        output = translator.get();
+        EXPECT_TRUE(isEquivalent(json, output)) << "input:" << endl
+                                                << prettyPrint(json) << endl
+                                                << "output:" << endl
+                                                << prettyPrint(output);
+
+        // Everything is gone.
+        translator.setDiff(Element::createMap());
+        session->apply_changes();
+        output = translator.get();
+        EXPECT_TRUE(output->empty()) << prettyPrint(output);
+    }
+}
+
+// Verifies that entries of lists ordered by the user are moved when only their order changes.
+TEST(TranslatorUniversal, setDiffOrderedByUser) {
+    S_Connection connection(make_shared<Connection>());
+    S_Session session(make_shared<Session>(connection, SR_DS_RUNNING));
+    TranslatorUniversal translator(session, KEA_DHCP6_SERVER);
+    translator.del();
+    session->apply_changes();
+
+    ElementPtr json(subnet6({{1, {"1", "2"}}, {2, {}}, {3, {}}}));
+    translator.setDiff(json);
+    session->apply_changes();
+    checkOrder(json, translator.get());
+
+    // Same entries, different order.
+    json = subnet6({{3, {}}, {1, {"2", "1"}}, {2, {}}});
+    translator.setDiff(json);
+    session->apply_changes();
+    checkOrder(json, translator.get());
+
+    // A new entry between kept ones.
+    json = subnet6({{3, {}}, {4, {}}, {2, {}}});
+    translator.setDiff(json);
+    session->apply_changes();
+    checkOrder(json, translator.get());
+
+    // A new entry at the end keeps the others in place.
+    json = subnet6({{3, {}}, {4, {}}, {2, {}}, {5, {}}});
+    translator.setDiff(json);
+    session->apply_changes();
+    checkOrder(json, translator.get());
+}
+
 }  // anonymous namespace
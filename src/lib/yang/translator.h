@@ -267,47 +267,6 @@ struct TranslatorBasic {
         return _;
     }
 
-    /// @brief Populate xpaths for all descending elements.
-    void populateXpaths(isc::data::ElementPtr const& root_node, std::string const& root_node_name) {
-        // First, empty xpath for all elements.
-        isc::data::Element::forEach(
-            root_node, [](isc::data::ElementPtr const& i) { i->xpath_ = std::string(); });
-
-        root_node->xpath_ = root_node->parent_->xpath_ + root_node_name;
-        for (auto const& [key, value] : root_node->mapValue()) {
-            value->xpath_ = root_node->xpath_ + "/" + key;
-        }
-
-        isc::data::Element::forEach(root_node, [&](isc::data::ElementPtr const& i) {
-            reassessChildren(i);
-            if (i->parent_) {
-                if (i->parent_->getType() == isc::data::Element::list) {
-                    dynamic_pointer_cast<isc::data::ListElement>(i->parent_)->setXpathToChild(i);
-                } else if (i->parent_->getType() == isc::data::Element::map) {
-                    dynamic_pointer_cast<isc::data::MapElement>(i->parent_)
-                        ->setXpathFromParentAndChild(
-                            std::bind(&TranslatorBasic::keys, this, std::placeholders::_1));
-                }
-            }
-        });
-    }
-
-    /// @brief Set all direct children again in order to reset their parent.
-    static void reassessChildren(isc::data::ElementPtr const& parent) {
-        if (parent->getType() == isc::data::Element::list) {
-            for (size_t i = 0; i < parent->size(); ++i) {
-                isc::data::ElementPtr const& child(parent->get(i));
-                parent->set(i, child);
-            }
-        } else if (parent->getType() == isc::data::Element::map) {
-            for (size_t i = 0; i < parent->size(); ++i) {
-                std::string const& key(parent->get(i)->stringValue());
-                isc::data::ElementPtr const& child(parent->get(key));
-                parent->set(key, child);
-            }
-        }
-    }
-
     /// @brief Check if a certain xpath is a key to it's list parent. Uses @ref findPath() to
     /// actually check if the xpath is valid rather than pertaining to a key node. Hacky because it
     /// catches a pretty critical exception which could have resulted from some other erroneous
@@ -356,6 +315,23 @@ struct TranslatorBasic {
         return result;
     }
 
+    /// @brief Check if the list or leaf-list at given schema xpath is ordered by the user.
+    bool userOrdered(std::string const& xpath) {
+        S_Set const set(findPath(xpath));
+        if (!set) {
+            return false;
+        }
+
+        for (S_Schema_Node const& schema_node : set->schema()) {
+            if ((schema_node->nodetype() == LYS_LIST || schema_node->nodetype() == LYS_LEAFLIST) &&
+                (schema_node->flags() & LYS_USERORDERED)) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
 private:
     /// @brief Return schema node for given xpath.
     S_Set findPath(std::string const& xpath) const {
@@ -21,12 +21,45 @@
 #include <util/log.h>
 #include <yang/translator_universal.h>
 
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+using isc::data::copy;
 using isc::data::Element;
 using isc::data::ElementPtr;
-using isc::data::MapElement;
 using isc::log::Spdlog;
 using std::string;
 
+namespace {
+
+/// @brief Remove list predicates from an xpath so that it can be used to find the schema node.
+string withoutPredicates(string const& xpath) {
+    string result;
+    result.reserve(xpath.size());
+    char quote(0);
+    size_t depth(0);
+    for (char const c : xpath) {
+        if (quote) {
+            if (c == quote) {
+                quote = 0;
+            }
+        } else if (depth && (c == '\'' || c == '"')) {
+            quote = c;
+        } else if (c == '[') {
+            ++depth;
+        } else if (c == ']') {
+            --depth;
+        } else if (!depth) {
+            result += c;
+        }
+    }
+    return result;
+}
+
+}  // namespace
+
 namespace isc {
 namespace yang {
 
@@ -43,16 +76,20 @@ void TranslatorUniversal::del(string const& xpath /* = string() */) {
 }
 
 ElementPtr TranslatorUniversal::get(string const& xpath /* = string() */) {
+    return getInternal(xpath, /* defaults = */ true);
+}
+
+ElementPtr TranslatorUniversal::getInternal(string const& xpath, bool const defaults) {
     ElementPtr result(Element::createMap());
 
     if (xpath.empty()) {
         // For each node...
         for (string const& root_node : rootNodes().at(model_)) {
             string const path("/" + model_ + ":" + root_node);
-            getInternal(result, path);
+            getInternal(result, path, defaults);
         }
     } else {
-        getInternal(result, xpath);
+        getInternal(result, xpath, defaults);
     }
 
     // Remove empty lists and maps resulted from non-existing, but defaulted
@@ -65,28 +102,131 @@ ElementPtr TranslatorUniversal::get(string const& xpath /* = string() */) {
 
 void TranslatorUniversal::set(ElementPtr const& config, string const& xpath /* = string() */) {
     if (!xpath.empty()) {
-        config->xpath_ = xpath;
-        setInternal(config, getRootNodeFromXpath(xpath));
+        setInternal(config, xpath);
+        return;
+    }
+
+    for (string const& root_node : rootNodes().at(model_)) {
+        ElementPtr const& toplevel(config->get(root_node));
+        if (!toplevel) {
+            continue;
+        }
+        setInternal(toplevel, "/" + model_ + ":" + root_node);
+    }
+}
+
+void TranslatorUniversal::setDiff(ElementPtr const& config, string const& xpath /* = string() */) {
+    Edits edits;
+    std::vector<std::tuple<ElementPtr, string>> differences;
+
+    if (!xpath.empty()) {
+        ElementPtr const& current(getInternal(xpath, /* defaults = */ false)->xpath(xpath));
+        ElementPtr const& difference(
+            diff(config, current, xpath, withoutPredicates(xpath), edits));
+        if (difference) {
+            differences.push_back({difference, xpath});
+        }
+        applyEdits(edits, differences);
         return;
     }
 
-    config->xpath_ = "/" + model_ + ":";
+    // Default nodes are left out, otherwise they would be deleted when missing from the input.
+    ElementPtr const& current(getInternal(string(), /* defaults = */ false));
     for (string const& root_node : rootNodes().at(model_)) {
+        string const path("/" + model_ + ":" + root_node);
         ElementPtr const& toplevel(config->get(root_node));
         if (!toplevel) {
+            if (current->get(root_node)) {
+                edits.deletions_.push_back(path);
+            }
             continue;
         }
-        setInternal(toplevel, root_node);
+        ElementPtr const& difference(diff(toplevel, current->get(root_node), path, path, edits));
+        if (difference) {
+            differences.push_back({difference, path});
+        }
+    }
+    applyEdits(edits, differences);
+}
+
+void TranslatorUniversal::applyEdits(
+    Edits const& edits, std::vector<std::tuple<ElementPtr, string>> const& differences) {
+    // Deletions go first since nodes replaced by nodes of another kind are deleted and set again.
+    for (string const& deletion : edits.deletions_) {
+        delItem(deletion);
+    }
+    for (auto const& [difference, path] : differences) {
+        setInternal(difference, path);
+    }
+
+    // Moves go last since they refer to entries which may have just been created.
+    for (Move const& move : edits.moves_) {
+        Spdlog::debug("{}: {}", PRETTY_METHOD_NAME(), move.xpath_);
+        char const* const relative(move.position_ == SR_MOVE_FIRST ? nullptr :
+                                                                     move.relative_.c_str());
+        try {
+            session_->move_item(move.xpath_.c_str(), move.position_,
+                                move.leaf_list_ ? nullptr : relative,
+                                move.leaf_list_ ? relative : nullptr);
+        } catch (sysrepo::sysrepo_exception const& exception) {
+            isc_throw(SysrepoError, "sysrepo error moving item at '" << move.xpath_
+                                                                     << "': " << exception.what());
+        }
     }
 }
 
-void TranslatorUniversal::getInternal(ElementPtr const& result, string const& xpath) {
+void TranslatorUniversal::getInternal(ElementPtr const& result,
+                                      string const& xpath,
+                                      bool const defaults) {
     S_Data_Node toplevel(session_->get_data(xpath.c_str()));
+    if (!toplevel) {
+        return;
+    }
+
+    // Nodes waiting to be visited with the Element of their parent and the module of their
+    // parent. Children are pushed in reverse so that they are visited in order, which keeps
+    // user-ordered lists in order.
+    struct Visit {
+        S_Data_Node node_;
+        ElementPtr parent_;
+        string parent_module_;
+    };
+    std::vector<Visit> stack;
+    ListIndex index;
+
+    std::vector<S_Data_Node> const& roots(toplevel->tree_for());
+    for (auto root(roots.rbegin()); root != roots.rend(); ++root) {
+        stack.push_back({*root, result, string()});
+    }
+
+    while (!stack.empty()) {
+        Visit const visit(stack.back());
+        stack.pop_back();
+
+        if (!defaults && visit.node_->dflt()) {
+            continue;
+        }
+
+        // Nodes coming from a different module than their parent are prefixed with the module
+        // name, the same way as in their xpath. Toplevel nodes never are.
+        S_Schema_Node const schema(visit.node_->schema());
+        string const module(schema->module()->name());
+        string key(schema->name());
+        if (!visit.parent_module_.empty() && module != visit.parent_module_) {
+            key = module + ":" + key;
+        }
+
+        ElementPtr const& element(nodeIntoParent(visit.parent_, key, visit.node_, index));
+        if (!element) {
+            continue;
+        }
 
-    for (libyang::S_Data_Node& root : toplevel->tree_for()) {
-        for (S_Data_Node const& n : root->tree_dfs()) {
-            // Set it into result at it's reported xpath in Sysrepo.
-            nodeIntoResult(result, n);
+        std::vector<S_Data_Node> children;
+        for (S_Data_Node child(visit.node_->child()); child; child = child->next()) {
+            children.push_back(child);
+        }
+        for (auto child(children.rbegin()); child != children.rend(); ++child) {
+            stack.push_back({*child, element, module});
         }
     }
 }
@@ -117,52 +257,370 @@ string TranslatorUniversal::getRootNodeFromXpath(string const& xpath) {
     return root_node.substr(0, position);
 }
 
-void TranslatorUniversal::nodeIntoResult(ElementPtr const& result, S_Data_Node const& node) {
-    ElementPtr element;
+ElementPtr TranslatorUniversal::nodeIntoParent(ElementPtr const& parent,
+                                               string const& key,
+                                               S_Data_Node const& node,
+                                               ListIndex& index) {
     lys_nodetype const node_type(node->schema()->nodetype());
-    string const& xpath(node->path());
     switch (node_type) {
     case LYS_LEAF:
-        [[fallthrough]];
-    case LYS_LEAFLIST:
-        element = getLeafOrLeafList(node);
+        parent->set(key, getLeafOrLeafList(node));
+        return ElementPtr();
+    case LYS_LEAFLIST: {
+        ElementPtr leaf_list(parent->get(key));
+        if (!leaf_list || leaf_list->getType() != Element::list) {
+            leaf_list = Element::createList();
+            parent->set(key, leaf_list);
+        }
+        leaf_list->add(getLeafOrLeafList(node));
+        return ElementPtr();
+    }
+    case LYS_CONTAINER: {
+        ElementPtr container(parent->get(key));
+        if (!container || container->getType() != Element::map) {
+            container = Element::createMap();
+            parent->set(key, container);
+        }
+        return container;
+    }
+    case LYS_LIST: {
+        ElementPtr list(parent->get(key));
+        if (!list || list->getType() != Element::list) {
+            list = Element::createList();
+            parent->set(key, list);
+        }
 
-        // Log.
-        Spdlog::debug("{}: {} {}", PRETTY_METHOD_NAME(), xpath, element->str());
+        std::vector<string> keys;
+        Schema_Node_List schema_node_list(node->schema());
+        for (S_Schema_Node_Leaf const& key_node : schema_node_list.keys()) {
+            keys.push_back(key_node->name());
+        }
 
-        break;
-    case LYS_CONTAINER:
-        element = Element::createMap();
-        break;
-    case LYS_LIST:
-        element = Element::createList();
-        break;
+        // Index the entries already in the list the first time it is encountered.
+        auto indexed(index.find(list.get()));
+        if (indexed == index.end()) {
+            indexed = index.emplace(list.get(), ListIndex::mapped_type()).first;
+            for (ElementPtr const& entry : list->listValue()) {
+                string entry_key;
+                for (string const& k : keys) {
+                    ElementPtr const& value(entry->get(k));
+                    entry_key += (value ? value->str() : string()) + "\n";
+                }
+                indexed->second.emplace(entry_key, entry);
+            }
+        }
+
+        // Keys are unique within a list, so the entry is either new or it was indexed before.
+        string const entry_key(listEntryKey(node, keys));
+        auto const& found(indexed->second.find(entry_key));
+        if (found != indexed->second.end()) {
+            return found->second;
+        }
+        ElementPtr const entry(Element::createMap());
+        list->add(entry);
+        indexed->second.emplace(entry_key, entry);
+        return entry;
+    }
     default:
         isc_throw(BadValue, PRETTY_METHOD_NAME() << ": " << magic_enum::enum_name(node_type));
+    }
+}
+
+string TranslatorUniversal::listEntryKey(S_Data_Node const& node, std::vector<string> const& keys) {
+    string result;
+    for (string const& k : keys) {
+        for (S_Data_Node child(node->child()); child; child = child->next()) {
+            if (k == child->schema()->name()) {
+                result += getLeafOrLeafList(child)->str();
+                break;
+            }
+        }
+        result += "\n";
+    }
+    return result;
+}
+
+void TranslatorUniversal::setInternal(ElementPtr const& toplevel, string const& xpath) {
+    S_Context const context(session_->get_context());
+    S_Module const module(context->get_module(model_.c_str()));
+
+    // Maps are created at xpath, anything else under its parent.
+    string path(xpath);
+    string name;
+    if (toplevel->getType() != Element::map) {
+        size_t const slash(xpath.rfind('/'));
+        path = xpath.substr(0, slash);
+        name = xpath.substr(slash + 1);
+    }
+
+    // Create the node together with its ancestors.
+    S_Data_Node const tree(
+        std::make_shared<Data_Node>(context, path.c_str(), nullptr, LYD_ANYDATA_CONSTSTRING, 0));
+    S_Set const set(tree->find_path(path.c_str()));
+    if (!set || set->data().empty()) {
+        isc_throw(BadValue, PRETTY_METHOD_NAME() << ": could not create " << path);
+    }
+    S_Data_Node const node(set->data().at(0));
+
+    // Build the rest of the tree in a single traversal.
+    if (toplevel->getType() == Element::map) {
+        for (auto const& [key, value] : toplevel->mapValue()) {
+            elementIntoParent(node, module, key, value);
+        }
+    } else {
+        elementIntoParent(node, module, name, toplevel);
+    }
+
+    Spdlog::debug("{}: {}", PRETTY_METHOD_NAME(), xpath);
+
+    // Submit it as a single edit.
+    session_->edit_batch(tree, "merge");
+}
+
+void TranslatorUniversal::elementIntoParent(S_Data_Node const& parent,
+                                            S_Module const& parent_module,
+                                            string const& key,
+                                            ElementPtr const& element) {
+    // Keys of nodes coming from other modules are prefixed with the module name.
+    S_Module module(parent_module);
+    string name(key);
+    size_t const colon(key.find(':'));
+    if (colon != string::npos) {
+        module = session_->get_context()->get_module(key.substr(0, colon).c_str());
+        if (!module) {
+            isc_throw(BadValue, PRETTY_METHOD_NAME() << ": unknown module in " << key);
+        }
+        name = key.substr(colon + 1);
+    }
+
+    switch (element->getType()) {
+    case Element::map: {
+        S_Data_Node const container(std::make_shared<Data_Node>(parent, module, name.c_str()));
+        for (auto const& [k, value] : element->mapValue()) {
+            elementIntoParent(container, module, k, value);
+        }
+        break;
+    }
+    case Element::list:
+        for (ElementPtr const& entry : element->listValue()) {
+            if (entry->getType() != Element::map) {
+                // Leaf-list value.
+                string const value(entry->toUnquotedString());
+                std::make_shared<Data_Node>(parent, module, name.c_str(), value.c_str());
+                continue;
+            }
+
+            // List entry. The keys have to be created first.
+            S_Data_Node const list(std::make_shared<Data_Node>(parent, module, name.c_str()));
+            std::set<string> key_names;
+            Schema_Node_List schema_node_list(list->schema());
+            for (S_Schema_Node_Leaf const& key_node : schema_node_list.keys()) {
+                string const key_name(key_node->name());
+                ElementPtr const& key_value(entry->get(key_name));
+                if (!key_value) {
+                    isc_throw(BadValue, PRETTY_METHOD_NAME() << ": missing key " << key_name
+                                                             << " in " << entry->str());
+                }
+                string const value(key_value->toUnquotedString());
+                std::make_shared<Data_Node>(list, module, key_name.c_str(), value.c_str());
+                key_names.insert(key_name);
+            }
+            for (auto const& [k, value] : entry->mapValue()) {
+                if (!key_names.count(k)) {
+                    elementIntoParent(list, module, k, value);
+                }
+            }
+        }
+        break;
+    default: {
+        string const value(element->toUnquotedString());
+        std::make_shared<Data_Node>(parent, module, name.c_str(), value.c_str());
         break;
     }
-    if (element) {
-        result->xpath(xpath, element, node_type == LYS_LEAFLIST);
     }
 }
 
-void TranslatorUniversal::setInternal(ElementPtr const& toplevel, string const& root_node) {
-    populateXpaths(toplevel, root_node);
+ElementPtr TranslatorUniversal::diff(ElementPtr const& input,
+                                     ElementPtr const& current,
+                                     string const& xpath,
+                                     string const& schema_xpath,
+                                     Edits& edits) {
+    // Leaves are compared by value.
+    if (input->getType() != Element::map && input->getType() != Element::list) {
+        if (current && current->toUnquotedString() == input->toUnquotedString()) {
+            return ElementPtr();
+        }
+        return copy(input);
+    }
+
+    // Anything replacing a node of another kind is set entirely after deleting the node.
+    if (!current || current->getType() != input->getType()) {
+        if (current) {
+            edits.deletions_.push_back(xpath);
+        }
+        return copy(input);
+    }
+
+    if (input->getType() == Element::map) {
+        ElementPtr result;
+        for (auto const& [key, value] : input->mapValue()) {
+            ElementPtr const& difference(diff(value, current->get(key), xpath + "/" + key,
+                                              schema_xpath + "/" + key, edits));
+            if (difference) {
+                if (!result) {
+                    result = Element::createMap();
+                }
+                result->set(key, difference);
+            }
+        }
+        for (auto const& [key, value] : current->mapValue()) {
+            if (!input->contains(key)) {
+                edits.deletions_.push_back(xpath + "/" + key);
+            }
+        }
+        return result;
+    }
+
+    // Leaf-lists are compared by value.
+    if ((!input->empty() && input->get(0)->getType() != Element::map) ||
+        (!current->empty() && current->get(0)->getType() != Element::map)) {
+        std::set<string> input_values;
+        std::set<string> current_values;
+        std::vector<string> input_order;
+        std::vector<string> current_order;
+        for (ElementPtr const& value : input->listValue()) {
+            input_values.insert(value->toUnquotedString());
+            input_order.push_back(value->toUnquotedString());
+        }
+        ElementPtr result;
+        for (ElementPtr const& value : current->listValue()) {
+            string const v(value->toUnquotedString());
+            current_values.insert(v);
+            current_order.push_back(v);
+            if (!input_values.count(v)) {
+                edits.deletions_.push_back(xpath + predicate(".", v));
+            }
+        }
+        order(xpath, schema_xpath, input_order, current_order, /* leaf_list = */ true, edits);
+        for (ElementPtr const& value : input->listValue()) {
+            if (!current_values.count(value->toUnquotedString())) {
+                if (!result) {
+                    result = Element::createList();
+                }
+                result->add(copy(value));
+            }
+        }
+        return result;
+    }
+
+    // List entries are matched by their keys.
+    auto cached(edits.keys_.find(schema_xpath));
+    if (cached == edits.keys_.end()) {
+        cached = edits.keys_.emplace(schema_xpath, TranslatorBasic::keys(schema_xpath)).first;
+    }
+    std::vector<string> const& key_names(cached->second);
+    auto const& entry_key = [&](ElementPtr const& entry) {
+        string result;
+        for (string const& key_name : key_names) {
+            ElementPtr const& value(entry->get(key_name));
+            result += predicate(key_name, value ? value->toUnquotedString() : string());
+        }
+        return result;
+    };
+
+    std::unordered_map<string, ElementPtr> current_entries;
+    std::vector<string> current_order;
+    for (ElementPtr const& entry : current->listValue()) {
+        string const predicates(entry_key(entry));
+        current_entries.emplace(predicates, entry);
+        current_order.push_back(predicates);
+    }
+
+    ElementPtr result;
+    std::set<string> input_entries;
+    std::vector<string> input_order;
+    for (ElementPtr const& entry : input->listValue()) {
+        string const predicates(entry_key(entry));
+        input_entries.insert(predicates);
+        input_order.push_back(predicates);
+        auto const& found(current_entries.find(predicates));
+        ElementPtr difference;
+        if (found == current_entries.end()) {
+            difference = copy(entry);
+        } else {
+            difference = diff(entry, found->second, xpath + predicates, schema_xpath, edits);
+            if (difference) {
+                // The keys identify the entry.
+                for (string const& key_name : key_names) {
+                    difference->set(key_name, copy(entry->get(key_name)));
+                }
+            }
+        }
+        if (difference) {
+            if (!result) {
+                result = Element::createList();
+            }
+            result->add(difference);
+        }
+    }
+    for (auto const& [predicates, entry] : current_entries) {
+        if (!input_entries.count(predicates)) {
+            edits.deletions_.push_back(xpath + predicates);
+        }
+    }
+    order(xpath, schema_xpath, input_order, current_order, /* leaf_list = */ false, edits);
+    return result;
+}
 
-    // For itself and all it's descendants...
-    Element::forEach(toplevel, [&](ElementPtr const& i) {
-        // If it is a leaf...
-        if (i->getType() != Element::list && i->getType() != Element::map) {
-            // Get unquoted value.
-            string const unquoted_value(i->toUnquotedString());
+void TranslatorUniversal::order(string const& xpath,
+                                string const& schema_xpath,
+                                std::vector<string> const& input_order,
+                                std::vector<string> const& current_order,
+                                bool const leaf_list,
+                                Edits& edits) {
+    // Entries ordered by the system are sorted by sysrepo itself.
+    auto cached(edits.user_ordered_.find(schema_xpath));
+    if (cached == edits.user_ordered_.end()) {
+        cached = edits.user_ordered_.emplace(schema_xpath, userOrdered(schema_xpath)).first;
+    }
+    if (!cached->second) {
+        return;
+    }
 
-            // Log.
-            Spdlog::debug("{}: {} {}", PRETTY_METHOD_NAME(), i->xpath_, unquoted_value);
+    // Order after deletions and insertions: kept entries stay in place, new ones are appended.
+    std::set<string> const input_entries(input_order.begin(), input_order.end());
+    std::set<string> const current_entries(current_order.begin(), current_order.end());
+    std::vector<string> resulting_order;
+    for (string const& entry : current_order) {
+        if (input_entries.count(entry)) {
+            resulting_order.push_back(entry);
+        }
+    }
+    for (string const& entry : input_order) {
+        if (!current_entries.count(entry)) {
+            resulting_order.push_back(entry);
+        }
+    }
+    if (resulting_order == input_order) {
+        return;
+    }
 
-            // Set it in Sysrepo.
-            session_->set_item_str(i->xpath_.c_str(), unquoted_value.c_str());
+    // Chain every entry after the previous one, starting with the first.
+    for (size_t i = 0; i < input_order.size(); ++i) {
+        Move move;
+        move.xpath_ = xpath + (leaf_list ? predicate(".", input_order[i]) : input_order[i]);
+        move.position_ = i ? SR_MOVE_AFTER : SR_MOVE_FIRST;
+        if (i) {
+            move.relative_ = input_order[i - 1];
         }
-    });
+        move.leaf_list_ = leaf_list;
+        edits.moves_.push_back(move);
+    }
+}
+
+string TranslatorUniversal::predicate(string const& key, string const& value) {
+    char const quote(value.find('\'') == string::npos ? '\'' : '"');
+    return "[" + key + "=" + quote + value + quote + "]";
 }
 
 }  // namespace yang
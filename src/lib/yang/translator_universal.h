@@ -21,6 +21,11 @@
 #include <cc/data.h>
 #include <yang/translator.h>
 
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
 namespace isc {
 namespace yang {
 
@@ -44,20 +49,138 @@ struct TranslatorUniversal : TranslatorBasic {
     isc::data::ElementPtr get(std::string const& xpath = std::string());
 
     /// @brief Set the entire YANG data from an ElementPtr.
+    ///
+    /// A single libyang data tree is built from the input and submitted as one edit batch.
     void set(isc::data::ElementPtr const& input, std::string const& xpath = std::string());
 
+    /// @brief Set only the differences between the input and the current YANG data.
+    ///
+    /// Nodes missing from the input are deleted and the new or changed nodes are submitted as
+    /// one edit batch, so the outcome is that of @ref del() followed by @ref set() with only as
+    /// many edits as there are differences.
+    ///
+    /// Entries of lists and leaf-lists ordered by the user are moved when the input orders them
+    /// differently than the current data.
+    void setDiff(isc::data::ElementPtr const& input, std::string const& xpath = std::string());
+
 private:
-    void getInternal(isc::data::ElementPtr const& result, std::string const& xpath);
+    /// @brief Entries of the lists in the result indexed by their key values.
+    using ListIndex = std::unordered_map<isc::data::Element const*,
+                                         std::unordered_map<std::string, isc::data::ElementPtr>>;
+
+    /// @brief Get the data found at given xpath or the entire YANG data if missing.
+    ///
+    /// @param xpath the xpath
+    /// @param defaults whether nodes holding default values are included
+    isc::data::ElementPtr getInternal(std::string const& xpath, bool const defaults);
+
+    /// @brief Get the data found at given xpath into the result.
+    ///
+    /// The Element tree is built in lockstep with the libyang data tree: every data node is
+    /// inserted directly into the Element created for its parent, and list entries are found
+    /// through @ref ListIndex, so the cost is linear in the number of data nodes.
+    void getInternal(isc::data::ElementPtr const& result,
+                     std::string const& xpath,
+                     bool const defaults);
 
     /// @brief Get the value of a leaf or a leaf-list child into an @ref ElementPtr.
     isc::data::ElementPtr getLeafOrLeafList(S_Data_Node const& node);
 
     std::string getRootNodeFromXpath(std::string const& xpath);
 
-    /// @brief Set a single node into a toplevel @ref ElementPtr via it's reported xpath in Sysrepo.
-    void nodeIntoResult(isc::data::ElementPtr const& result, S_Data_Node const& node);
+    /// @brief Set a single node into the @ref ElementPtr created for its parent.
+    ///
+    /// @return the map into which the children of the node are to be set, null for leaves and
+    /// leaf-lists
+    isc::data::ElementPtr nodeIntoParent(isc::data::ElementPtr const& parent,
+                                         std::string const& key,
+                                         S_Data_Node const& node,
+                                         ListIndex& index);
+
+    /// @brief Get the key values of a list entry as a string unique within the list.
+    std::string listEntryKey(S_Data_Node const& node, std::vector<std::string> const& keys);
+
+    /// @brief Build a libyang data tree for the data at given xpath and submit it as an edit
+    /// batch.
+    void setInternal(isc::data::ElementPtr const& toplevel, std::string const& xpath);
+
+    /// @brief Create the data node for an element and its descendants under a parent.
+    void elementIntoParent(S_Data_Node const& parent,
+                           S_Module const& parent_module,
+                           std::string const& key,
+                           isc::data::ElementPtr const& element);
+
+    /// @brief Move of an entry of a list or a leaf-list ordered by the user.
+    struct Move {
+        /// @brief xpath of the entry being moved
+        std::string xpath_;
+
+        /// @brief where the entry goes, first or after the relative entry
+        sr_move_position_t position_;
+
+        /// @brief predicates of the relative list entry, or value of the relative leaf-list
+        ///     entry
+        std::string relative_;
+
+        /// @brief whether the entry belongs to a leaf-list
+        bool leaf_list_;
+    };
+
+    /// @brief Edits found by @ref diff() besides the data to be set.
+    struct Edits {
+        /// @brief cache of list keys by schema xpath
+        std::unordered_map<std::string, std::vector<std::string>> keys_;
+
+        /// @brief cache of the ordered-by user property by schema xpath
+        std::unordered_map<std::string, bool> user_ordered_;
+
+        /// @brief xpaths of the current nodes missing from the input
+        std::vector<std::string> deletions_;
+
+        /// @brief moves restoring the input order of user-ordered lists and leaf-lists, to be
+        ///     applied after the data has been set
+        std::vector<Move> moves_;
+    };
+
+    /// @brief Compute the nodes of the input which are missing or different in the current data.
+    ///
+    /// @param input the desired data
+    /// @param current the current data, null if missing
+    /// @param xpath data xpath of both
+    /// @param schema_xpath xpath without predicates, used to find list keys
+    /// @param edits the deletions and moves found so far
+    ///
+    /// @return the data to be set, null if there is none
+    isc::data::ElementPtr diff(isc::data::ElementPtr const& input,
+                               isc::data::ElementPtr const& current,
+                               std::string const& xpath,
+                               std::string const& schema_xpath,
+                               Edits& edits);
+
+    /// @brief Add the moves which give a user-ordered list or leaf-list the input order.
+    ///
+    /// Entries kept from the current data stay in place and new entries are appended, so
+    /// nothing is moved when that already yields the input order.
+    ///
+    /// @param xpath data xpath of the list or leaf-list
+    /// @param schema_xpath xpath without predicates
+    /// @param input_order predicates or values of the input entries, in input order
+    /// @param current_order predicates or values of the current entries, in current order
+    /// @param leaf_list whether this is a leaf-list
+    /// @param edits where the moves are added
+    void order(std::string const& xpath,
+               std::string const& schema_xpath,
+               std::vector<std::string> const& input_order,
+               std::vector<std::string> const& current_order,
+               bool const leaf_list,
+               Edits& edits);
+
+    /// @brief Apply the deletions, the differences and the moves to the session.
+    void applyEdits(Edits const& edits,
+                    std::vector<std::tuple<isc::data::ElementPtr, std::string>> const& differences);
 
-    void setInternal(isc::data::ElementPtr const& toplevel, std::string const& root_node);
+    /// @brief Format a list predicate.
+    static std::string predicate(std::string const& key, std::string const& value);
 };
 
 }  // namespace yang
@@ -28,7 +28,7 @@ static const std::unordered_map<std::string, std::string> YANG_REVISIONS = {
     { "keatest-module", "2018-11-20" },
 #endif  // KEATEST_MODULE
     { "kea-ctrl-agent", "2019-08-12" },
-    { "kea-dhcp4-server", "2019-08-12" },
+    { "kea-dhcp4-server", "2026-10-19" },
     { "kea-dhcp6-server", "2019-08-12" },
     { "kea-dhcp-ddns", "2019-08-12" },
     { "kea-dhcp-types", "2019-08-12" },